@@ -22,12 +22,16 @@ package org.platanios.tensorflow.api.config
 sealed trait CheckpointConfig {
   val maxCheckpointsToKeep     : Int
   val keepCheckpointEveryNHours: Int
+  val asyncWriters             : Int
+  val parallelWriters          : Int
 }
 
 /** Checkpoint configuration for not saving any checkpoints. */
 case object NoCheckpoints extends CheckpointConfig {
   override val maxCheckpointsToKeep     : Int = 0
   override val keepCheckpointEveryNHours: Int = 10000
+  override val asyncWriters             : Int = 0
+  override val parallelWriters          : Int = 0
 }
 
 /** Checkpoint configuration for step-based checkpoints (i.e., checkpoints every `n` steps).
@@ -38,11 +42,21 @@ case object NoCheckpoints extends CheckpointConfig {
   *                                   is, the 5 most recent checkpoint files are kept).
   * @param  keepCheckpointEveryNHours Save checkpoints every this many hours. The default value of 10,000 hours
   *                                   effectively disables the feature.
+  * @param  asyncWriters              If positive, checkpoints are saved asynchronously: training only pauses while the
+  *                                   variables are copied to host memory, and the checkpoints are then written in the
+  *                                   background, by this many parallel writers. Defaults to 0 (i.e., checkpoints are
+  *                                   saved synchronously).
+  * @param  parallelWriters           If positive, the variables of each device are written by this many parallel
+  *                                   writers, each writing its own data file (see `ParallelSaverDefBuilder`). This
+  *                                   is useful for storage systems with low per-stream bandwidth. Defaults to 0 (i.e.,
+  *                                   a single writer per device).
   */
 case class StepBasedCheckpoints(
     steps: Int = 1000,
     maxCheckpointsToKeep: Int = 5,
-    keepCheckpointEveryNHours: Int = 10000
+    keepCheckpointEveryNHours: Int = 10000,
+    asyncWriters: Int = 0,
+    parallelWriters: Int = 0
 ) extends CheckpointConfig {
   require(steps >= 0, s"'steps' (set to $steps) needs to be a non-negative integer.")
   require(
@@ -51,6 +65,8 @@ case class StepBasedCheckpoints(
   require(
     keepCheckpointEveryNHours > 0,
     s"'checkpointEveryNHours' (set to $keepCheckpointEveryNHours) needs to be a positive integer.")
+  require(asyncWriters >= 0, s"'asyncWriters' (set to $asyncWriters) needs to be a non-negative integer.")
+  require(parallelWriters >= 0, s"'parallelWriters' (set to $parallelWriters) needs to be a non-negative integer.")
 }
 
 /** Checkpoint configuration for time-based checkpoints (i.e., checkpoints every `n` seconds).
@@ -61,11 +77,21 @@ case class StepBasedCheckpoints(
   *                                   is, the 5 most recent checkpoint files are kept).
   * @param  keepCheckpointEveryNHours Save checkpoints every this many hours. The default value of 10,000 hours
   *                                   effectively disables the feature.
+  * @param  asyncWriters              If positive, checkpoints are saved asynchronously: training only pauses while the
+  *                                   variables are copied to host memory, and the checkpoints are then written in the
+  *                                   background, by this many parallel writers. Defaults to 0 (i.e., checkpoints are
+  *                                   saved synchronously).
+  * @param  parallelWriters           If positive, the variables of each device are written by this many parallel
+  *                                   writers, each writing its own data file (see `ParallelSaverDefBuilder`). This
+  *                                   is useful for storage systems with low per-stream bandwidth. Defaults to 0 (i.e.,
+  *                                   a single writer per device).
   */
 case class TimeBasedCheckpoints(
     seconds: Int = 600,
     override val maxCheckpointsToKeep: Int = 5,
-    override val keepCheckpointEveryNHours: Int = 10000
+    override val keepCheckpointEveryNHours: Int = 10000,
+    override val asyncWriters: Int = 0,
+    override val parallelWriters: Int = 0
 ) extends CheckpointConfig {
   require(seconds >= 0, s"'seconds' (set to $seconds) needs to be a non-negative integer.")
   require(
@@ -74,4 +100,6 @@ case class TimeBasedCheckpoints(
   require(
     keepCheckpointEveryNHours > 0,
     s"'checkpointEveryNHours' (set to $keepCheckpointEveryNHours) needs to be a positive integer.")
+  require(asyncWriters >= 0, s"'asyncWriters' (set to $asyncWriters) needs to be a non-negative integer.")
+  require(parallelWriters >= 0, s"'parallelWriters' (set to $parallelWriters) needs to be a non-negative integer.")
 }
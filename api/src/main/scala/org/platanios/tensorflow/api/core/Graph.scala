@@ -21,7 +21,7 @@ import org.platanios.tensorflow.api.ops.{InstantiatedFunction, Op, Output, Resou
 import org.platanios.tensorflow.api.ops.variables.{Saver, Variable, VariableStore}
 import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
 import org.platanios.tensorflow.api.utilities.Proto.{Serializable => ProtoSerializable}
-import org.platanios.tensorflow.jni.{Function => NativeFunction, Graph => NativeGraph, TensorFlow => NativeLibrary}
+import org.platanios.tensorflow.jni.{Function => NativeFunction, Graph => NativeGraph, GraphSnapshot => NativeGraphSnapshot, TensorFlow => NativeLibrary}
 
 import com.google.protobuf.ByteString
 import org.tensorflow.framework.CollectionDef.{BytesList, Int64List, NodeList}
@@ -29,7 +29,13 @@ import org.tensorflow.framework.MetaGraphDef.MetaInfoDef
 import org.tensorflow.framework._
 import org.tensorflow.util.SaverDef
 
+import java.nio.ByteBuffer
+import java.nio.file.Path
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.atomic.AtomicInteger
+
 import scala.collection.JavaConverters._
+import scala.collection.concurrent.TrieMap
 import scala.collection.mutable
 import scala.language.postfixOps
 import scala.util.matching.Regex
@@ -77,22 +83,36 @@ class Graph private[api](private[api] var nativeHandle: Long) extends Closeable
   private[api] val defaultSession: Session = Session(this)
 
   /** Map from native op handle to op object in the Scala side. Used for caching ops that have already been obtained
-    * from the native library. */
-  private[api] val opsCache: mutable.Map[Long, Op] = mutable.LongMap.empty[Op]
+    * from the native library. It is a concurrent map because ops may be created from multiple threads at once. */
+  private[api] val opsCache: mutable.Map[Long, Op] = TrieMap.empty[Long, Op]
 
   /** Variable store object of this graph, used to store created variables and keep track of variable scope usages. */
   private[api] val variableStore: VariableStore = VariableStore()
 
   /** Set that contains the current names in use in this graph. */
-  private[this] val namesInUse: mutable.Set[String] = mutable.Set.empty[String]
+  private[this] val namesInUse: java.util.Set[String] = ConcurrentHashMap.newKeySet[String]()
+
+  /** Map from name to the next suffix to try when making that name unique, so that repeatedly requesting the same name
+    * does not require probing all of its previously used suffixes. */
+  private[this] val nameSuffixCounters: TrieMap[String, AtomicInteger] = TrieMap.empty[String, AtomicInteger]
 
   /** Marks `name` as a used name in this graph (i.e., increments its usage counter). */
-  private[this] def markNameAsUsed(name: String): Unit = namesInUse synchronized {
+  private[this] def markNameAsUsed(name: String): Unit = {
     assertNotFrozen()
-    namesInUse += name
+    namesInUse.add(name)
+  }
+
+  /** Returns the suffix counter for `name`, creating it if necessary. */
+  private[this] def nameSuffixCounter(name: String): AtomicInteger = {
+    val counter = new AtomicInteger(1)
+    nameSuffixCounters.putIfAbsent(name, counter).getOrElse(counter)
   }
 
   /** Returns a unique op name in this graph, based on the provided `name`.
+    *
+    * This method does not lock the graph and can be called concurrently from multiple threads (e.g., threads that
+    * construct separate towers of a model, each within its own name scope), while still guaranteeing that no two calls
+    * that mark their names as used return the same name.
     *
     * @note Operation names are displayed in error messages reported by the TensorFlow runtime, and in various
     *       visualization tools such as TensorBoard.
@@ -104,7 +124,7 @@ class Graph private[api](private[api] var nativeHandle: Long) extends Closeable
     *                    caller simply wants to know what the name to be created will be.
     * @return Unique name.
     */
-  private[api] def uniqueName(name: String, markAsUsed: Boolean = true): String = namesInUse synchronized {
+  private[api] def uniqueName(name: String, markAsUsed: Boolean = true): String = {
     val nameScope = Op.convertNameScopeToName(Op.currentNameScope)
     val fullName = {
       if (nameScope == null || nameScope == "")
@@ -112,23 +132,24 @@ class Graph private[api](private[api] var nativeHandle: Long) extends Closeable
       else
         s"$nameScope/$name"
     }
-    var count = if (namesInUse.contains(fullName)) 1 else 0
-    // Increment the counter for the provided name.
-    if (markAsUsed)
-      namesInUse += fullName
-    if (count > 0) {
-      var uniqueName = fullName
-      // Make sure the composed name is not already being used.
-      while (namesInUse.contains(uniqueName)) {
-        uniqueName = s"${fullName}_$count"
-        count += 1
+    if (markAsUsed) {
+      if (namesInUse.add(fullName)) {
+        fullName
+      } else {
+        // Adding a name to the set is atomic and so, only one thread can claim each composed name.
+        val counter = nameSuffixCounter(fullName)
+        var uniqueName = s"${fullName}_${counter.getAndIncrement()}"
+        while (!namesInUse.add(uniqueName))
+          uniqueName = s"${fullName}_${counter.getAndIncrement()}"
+        uniqueName
       }
-      // Mark the composed name as used.
-      if (markAsUsed)
-        namesInUse += uniqueName
-      uniqueName
-    } else {
+    } else if (!namesInUse.contains(fullName)) {
       fullName
+    } else {
+      var count = nameSuffixCounter(fullName).get()
+      while (namesInUse.contains(s"${fullName}_$count"))
+        count += 1
+      s"${fullName}_$count"
     }
   }
 
@@ -400,6 +421,19 @@ class Graph private[api](private[api] var nativeHandle: Long) extends Closeable
     NativeGraph.ops(nativeHandle).map(handle => opsCache.getOrElseUpdate(handle, Op(this, handle)))
   }
 
+  /** Returns a snapshot of the metadata of all ops in this graph, collected in a single native call, along with the
+    * ops themselves (in the same order as the ops in the snapshot).
+    *
+    * This is meant for traversals over the whole graph, where querying the inputs and outputs of each op separately
+    * would otherwise cross the JNI boundary multiple times per op.
+    *
+    * @note This function may be called concurrently from multiple threads (i.e., it is thread-safe).
+    */
+  private[api] def snapshot: (Array[Op], NativeGraphSnapshot) = NativeHandleLock.synchronized {
+    val snapshot = NativeGraph.snapshot(nativeHandle)
+    (snapshot.opHandles.map(handle => opsCache.getOrElseUpdate(handle, Op(this, handle))), snapshot)
+  }
+
   /** Returns the op referred to by the provided name, in this graph.
     *
     * If such an op cannot be found, an informative exception is thrown.
@@ -515,6 +549,223 @@ class Graph private[api](private[api] var nativeHandle: Long) extends Closeable
   def importGraphDef(
       graphDef: GraphDef, importScope: String = null, inputsMap: Map[(String, Int), Output] = Map.empty,
       controlDependenciesMap: Map[String, Op] = Map.empty, controlDependencies: Set[Op] = Set.empty): Unit = {
+    importGraphDefHelper(importScope, inputsMap, controlDependenciesMap, controlDependencies)(
+      NativeGraph.importGraphDef(nativeHandle, graphDef.toByteArray, _, _, _, _, _, _, _, _))
+  }
+
+  /** Imports a serialized representation of a graph, stored in a direct byte buffer, into the current graph. This is
+    * equivalent to [[importGraphDef]], except that the serialized graph is read directly from the native memory that
+    * backs `graphDef`, and is thus never copied to the JVM heap.
+    *
+    * @param  graphDef               Direct byte buffer containing the serialized [[GraphDef]] that will be imported
+    *                                into this graph.
+    * @param  importScope            Optional prefix that will be prepended to all node names in the graph that is
+    *                                being imported to this graph.
+    * @param  inputsMap              Optional inputs mapping (see [[importGraphDef]]).
+    * @param  controlDependenciesMap Optional control dependencies mapping (see [[importGraphDef]]).
+    * @param  controlDependencies    Optional control dependencies set (see [[importGraphDef]]).
+    * @throws IllegalArgumentException If `graphDef` is not a direct byte buffer.
+    */
+  @throws[IllegalArgumentException]
+  def importGraphDefFromBuffer(
+      graphDef: ByteBuffer, importScope: String = null, inputsMap: Map[(String, Int), Output] = Map.empty,
+      controlDependenciesMap: Map[String, Op] = Map.empty, controlDependencies: Set[Op] = Set.empty): Unit = {
+    if (!graphDef.isDirect)
+      throw new IllegalArgumentException("The provided graph definition buffer must be direct.")
+    importGraphDefHelper(importScope, inputsMap, controlDependenciesMap, controlDependencies)(
+      NativeGraph.importGraphDefFromBuffer(nativeHandle, graphDef, _, _, _, _, _, _, _, _))
+  }
+
+  /** Imports a serialized representation of a graph, stored in a file, into the current graph. This is equivalent to
+    * [[importGraphDef]], except that the file is memory-mapped natively, instead of being read into the JVM heap.
+    * Mapped files are cached, so that importing the same (unmodified) file into multiple graphs only reads it once.
+    * The cache can be cleared using [[Graph.clearGraphDefFileCache]].
+    *
+    * @param  file                   File containing the serialized [[GraphDef]] that will be imported into this graph.
+    * @param  importScope            Optional prefix that will be prepended to all node names in the graph that is
+    *                                being imported to this graph.
+    * @param  inputsMap              Optional inputs mapping (see [[importGraphDef]]).
+    * @param  controlDependenciesMap Optional control dependencies mapping (see [[importGraphDef]]).
+    * @param  controlDependencies    Optional control dependencies set (see [[importGraphDef]]).
+    */
+  def importGraphDefFromFile(
+      file: Path, importScope: String = null, inputsMap: Map[(String, Int), Output] = Map.empty,
+      controlDependenciesMap: Map[String, Op] = Map.empty, controlDependencies: Set[Op] = Set.empty): Unit = {
+    importGraphDefHelper(importScope, inputsMap, controlDependenciesMap, controlDependencies)(
+      NativeGraph.importGraphDefFromFile(nativeHandle, file.toAbsolutePath.toString, _, _, _, _, _, _, _, _))
+  }
+
+  /** Imports an optimized version of `graph` into the current graph. The optimizations are performed by Grappler
+    * (e.g., constant folding, arithmetic simplification, layout and memory optimizations), offline, and their result is
+    * imported natively, without being handed to the JVM. This allows optimizing a graph (e.g., a frozen serving graph)
+    * once, rather than every time a session is created for it. If the persistent optimized graph cache is enabled
+    * (using [[Graph.enableOptimizedGraphCache]]), the optimized graph is read from it whenever possible, and so the
+    * optimizations are not even repeated across processes.
+    *
+    * @param  graph                  Graph to optimize.
+    * @param  fetches                Ops whose outputs must be preserved by the optimizations (e.g., the outputs of a
+    *                                serving signature). Ops that are not needed in order to compute them may be pruned.
+    * @param  rewriterConfig         Configuration of the optimizations to perform. If `null`, the default Grappler
+    *                                configuration is used.
+    * @param  importScope            Optional prefix that will be prepended to all node names in the graph that is
+    *                                being imported to this graph.
+    * @param  inputsMap              Optional inputs mapping (see [[importGraphDef]]).
+    * @param  controlDependenciesMap Optional control dependencies mapping (see [[importGraphDef]]).
+    * @param  controlDependencies    Optional control dependencies set (see [[importGraphDef]]).
+    * @throws GraphMismatchException If any of the `fetches` does not belong to `graph`.
+    */
+  @throws[GraphMismatchException]
+  def importOptimizedGraph(
+      graph: Graph, fetches: Set[Op], rewriterConfig: RewriterConfig = null, importScope: String = null,
+      inputsMap: Map[(String, Int), Output] = Map.empty, controlDependenciesMap: Map[String, Op] = Map.empty,
+      controlDependencies: Set[Op] = Set.empty): Unit = {
+    fetches.foreach(op => {
+      if (op.graph != graph)
+        throw GraphMismatchException(s"Fetch op '${op.name}' does not belong to the graph being optimized.")
+    })
+    val fetchNames = fetches.map(_.name).toArray
+    val serializedRewriterConfig = if (rewriterConfig == null) null else rewriterConfig.toByteArray
+    importGraphDefHelper(importScope, inputsMap, controlDependenciesMap, controlDependencies)(
+      NativeGraph.importOptimizedGraphDef(
+        nativeHandle, graph.nativeHandle, serializedRewriterConfig, fetchNames, _, _, _, _, _, _, _, _))
+  }
+
+  /** Estimates the cost (i.e., execution time and peak memory usage) of computing `fetches` using this graph,
+    * analytically and without running it. Please refer to the documentation of [[GraphCostReport]] for details.
+    *
+    * @param  fetches Ops to compute. Only the ops that are needed in order to compute them are taken into account.
+    * @return Estimated costs.
+    * @throws IllegalArgumentException If `fetches` is empty.
+    * @throws GraphMismatchException   If any of the `fetches` does not belong to this graph.
+    */
+  @throws[IllegalArgumentException]
+  @throws[GraphMismatchException]
+  def estimateCosts(fetches: Set[Op]): GraphCostReport = {
+    if (fetches.isEmpty)
+      throw new IllegalArgumentException("At least one fetch is required in order to estimate graph costs.")
+    fetches.foreach(op => {
+      if (op.graph != this)
+        throw GraphMismatchException(s"Fetch op '${op.name}' does not belong to this graph.")
+    })
+    GraphCostReport.fromNative(NativeHandleLock.synchronized {
+      NativeGraph.estimateCosts(nativeHandle, fetches.map(_.name).toArray)
+    })
+  }
+
+  /** Runs the Grappler layout optimizer on this graph, as if its unplaced ops were placed on a GPU, and reports the
+    * changes that it makes, without modifying this graph. Please refer to the documentation of
+    * [[LayoutOptimizationReport]] for details.
+    *
+    * @param  fetches Ops to compute. Only the ops that are needed in order to compute them are taken into account.
+    * @return Report of the changes made by the layout optimizer.
+    * @throws IllegalArgumentException If `fetches` is empty.
+    * @throws GraphMismatchException   If any of the `fetches` does not belong to this graph.
+    */
+  @throws[IllegalArgumentException]
+  @throws[GraphMismatchException]
+  def layoutOptimizationReport(fetches: Set[Op]): LayoutOptimizationReport = {
+    if (fetches.isEmpty)
+      throw new IllegalArgumentException("At least one fetch is required in order to optimize the graph layout.")
+    fetches.foreach(op => {
+      if (op.graph != this)
+        throw GraphMismatchException(s"Fetch op '${op.name}' does not belong to this graph.")
+    })
+    LayoutOptimizationReport(this, GraphDef.parseFrom(NativeHandleLock.synchronized {
+      NativeGraph.optimizeLayout(nativeHandle, fetches.map(_.name).toArray)
+    }))
+  }
+
+  /** Returns a serving version of this graph, which only computes `fetches`, and in which all variables have been
+    * replaced by constants. The graph is frozen and pruned natively, without handing the whole graph or the variable
+    * values to the JVM:
+    *
+    *   - Only the ops that are needed in order to compute `fetches` are kept, and the ops of `feeds` are replaced by
+    *     placeholders (which is why only the first output of an op may be fed).
+    *   - The variables are replaced by constants holding their values, which are read from `session`, if provided, or
+    *     from the checkpoint with prefix `checkpoint`, otherwise. Variable reads become identities and resource
+    *     gathers become gathers.
+    *   - Training-only ops (i.e., savers, summaries, asserts, prints, and variable updates) that are only reachable
+    *     through control dependencies are dropped, and `CheckNumerics` and `Print` ops become identities.
+    *
+    * @param  fetches    Ops whose outputs must be computable by the returned graph.
+    * @param  feeds      Outputs that will be fed when using the returned graph.
+    * @param  session    Session from which to read the variable values.
+    * @param  checkpoint Prefix of the checkpoint from which to read the variable values, if `session` is `null`.
+    * @return Frozen and pruned graph definition.
+    * @throws IllegalArgumentException If `fetches` is empty, or if variables need to be frozen but neither `session`
+    *                                  nor `checkpoint` is provided.
+    * @throws GraphMismatchException   If any of the `fetches` or the `feeds` does not belong to this graph.
+    */
+  @throws[IllegalArgumentException]
+  @throws[GraphMismatchException]
+  def freezeAndPrune(
+      fetches: Set[Op], feeds: Set[Output] = Set.empty, session: Session = null, checkpoint: Path = null): GraphDef = {
+    if (fetches.isEmpty)
+      throw new IllegalArgumentException("At least one fetch is required in order to freeze a graph.")
+    fetches.foreach(op => {
+      if (op.graph != this)
+        throw GraphMismatchException(s"Fetch op '${op.name}' does not belong to this graph.")
+    })
+    feeds.foreach(output => {
+      if (output.graph != this)
+        throw GraphMismatchException(s"Feed '${output.name}' does not belong to this graph.")
+    })
+    val checkpointPrefix = if (session == null && checkpoint != null) checkpoint.toAbsolutePath.toString else null
+    GraphDef.parseFrom(NativeHandleLock.synchronized {
+      NativeGraph.freezeAndPrune(
+        nativeHandle, if (session == null) 0L else session.nativeHandle, checkpointPrefix,
+        fetches.map(_.name).toArray, feeds.map(_.name).toArray)
+    })
+  }
+
+  /** Returns the outputs of this graph whose ranges must be calibrated in order to quantize it using
+    * [[importQuantizedGraph]] (e.g., using [[Quantization.calibrate]]). These are the inputs and outputs of the
+    * `MatMul` and `Conv2D` ops with constant weights, and the outputs of the `BiasAdd` ops that follow them. */
+  def quantizationCalibrationOutputs: Seq[Output] = {
+    NativeHandleLock.synchronized(NativeGraph.quantizationCalibrationTensors(nativeHandle)).map(getOutputByName).toSeq
+  }
+
+  /** Imports an eight-bit quantized version of `graph` into the current graph. `graph` must be frozen (i.e., its
+    * weights must be constants) and its `MatMul` and `Conv2D` ops with constant weights, along with any `BiasAdd`,
+    * `ReLU` and `ReLU6` ops that directly follow them, are rewritten to the corresponding quantized ops. Please refer
+    * to the documentation of [[Quantization]] for details.
+    *
+    * @param  graph                  Graph to quantize.
+    * @param  ranges                 Calibrated ranges of the outputs of `graph` (e.g., computed using
+    *                                [[Quantization.calibrate]]), which must contain a range for each of the
+    *                                [[quantizationCalibrationOutputs]] of `graph`.
+    * @param  importScope            Optional prefix that will be prepended to all node names in the graph that is
+    *                                being imported to this graph.
+    * @param  inputsMap              Optional inputs mapping (see [[importGraphDef]]).
+    * @param  controlDependenciesMap Optional control dependencies mapping (see [[importGraphDef]]).
+    * @param  controlDependencies    Optional control dependencies set (see [[importGraphDef]]).
+    * @throws GraphMismatchException   If any of the outputs in `ranges` does not belong to `graph`.
+    * @throws InvalidArgumentException If a range is missing for any of the outputs that need to be quantized.
+    */
+  @throws[GraphMismatchException]
+  @throws[InvalidArgumentException]
+  def importQuantizedGraph(
+      graph: Graph, ranges: Map[Output, (Float, Float)], importScope: String = null,
+      inputsMap: Map[(String, Int), Output] = Map.empty, controlDependenciesMap: Map[String, Op] = Map.empty,
+      controlDependencies: Set[Op] = Set.empty): Unit = {
+    ranges.keys.foreach(output => {
+      if (output.graph != graph)
+        throw GraphMismatchException(s"Output '${output.name}' does not belong to the graph being quantized.")
+    })
+    val rangesSeq = ranges.toSeq
+    importGraphDefHelper(importScope, inputsMap, controlDependenciesMap, controlDependencies)(
+      NativeGraph.importQuantizedGraphDef(
+        nativeHandle, graph.nativeHandle, rangesSeq.map(_._1.name).toArray, rangesSeq.map(_._2._1).toArray,
+        rangesSeq.map(_._2._2).toArray, _, _, _, _, _, _, _, _))
+  }
+
+  /** Helper method for [[importGraphDef]], [[importGraphDefFromBuffer]], and [[importGraphDefFromFile]], which
+    * converts the import arguments to their native representation and passes them to `nativeImport`. */
+  private[this] def importGraphDefHelper(
+      importScope: String, inputsMap: Map[(String, Int), Output], controlDependenciesMap: Map[String, Op],
+      controlDependencies: Set[Op]
+  )(nativeImport: (String, Array[String], Array[Int], Array[Long], Array[Int], Array[String], Array[Long],
+      Array[Long]) => Unit): Unit = {
     assertNotFrozen()
     val prefix = {
       if (importScope == null || importScope == "")
@@ -532,13 +783,63 @@ class Graph private[api](private[api] var nativeHandle: Long) extends Closeable
     val controlDependenciesMapDestinationOpHandles = controlDependenciesMap.map(_._2.nativeHandle).toArray
     val controlDependenciesOpHandles = controlDependencies.map(_.nativeHandle).toArray
     NativeHandleLock.synchronized {
-      NativeGraph.importGraphDef(
-        nativeHandle, graphDef.toByteArray, prefix, inputsMapSourceOpNames, inputsMapSourceOutputIndices,
-        inputsMapDestinationOpHandles, inputsMapDestinationOutputIndices, controlDependenciesMapSourceOpNames,
+      nativeImport(
+        prefix, inputsMapSourceOpNames, inputsMapSourceOutputIndices, inputsMapDestinationOpHandles,
+        inputsMapDestinationOutputIndices, controlDependenciesMapSourceOpNames,
         controlDependenciesMapDestinationOpHandles, controlDependenciesOpHandles)
     }
     // TODO: [PERFORMANCE] Make this faster?
-    namesInUse synchronized ops.foreach(op => markNameAsUsed(op.name))
+    ops.foreach(op => markNameAsUsed(op.name))
+  }
+
+  /** Adds the ops described by `nodeDefs` to this graph, using a single native call, and returns them in the same
+    * order. This avoids the per-op (and per-attribute) native calls made when creating ops using [[Op.Builder]], which
+    * dominate the construction time of very large graphs.
+    *
+    * The node definitions must be provided in topological order and must have unique names that are not already used
+    * in this graph. Their inputs (including control inputs) may refer either to other ops in `nodeDefs`, or to ops that
+    * already exist in this graph.
+    *
+    * @param  nodeDefs Definitions of the ops to add.
+    * @return Created ops, in the same order as `nodeDefs`.
+    * @throws InvalidArgumentException If any of the ops cannot be created, or if an input refers to an op that does
+    *                                  not exist.
+    */
+  @throws[InvalidArgumentException]
+  def addOps(nodeDefs: Seq[NodeDef]): Seq[Op] = {
+    assertNotFrozen()
+    val names = nodeDefs.map(_.getName)
+    val batchNames = names.toSet
+    val inputsMap = mutable.LinkedHashMap.empty[(String, Int), Output]
+    val controlDependenciesMap = mutable.LinkedHashMap.empty[String, Op]
+    nodeDefs.foreach(_.getInputList.asScala.foreach(input => {
+      if (input.startsWith("^")) {
+        val opName = input.substring(1)
+        if (!batchNames.contains(opName))
+          controlDependenciesMap.getOrElseUpdate(opName, getOpByName(opName))
+      } else {
+        val separatorIndex = input.lastIndexOf(':')
+        val (opName, outputIndex) = {
+          if (separatorIndex < 0)
+            (input, 0)
+          else
+            (input.substring(0, separatorIndex), input.substring(separatorIndex + 1).toInt)
+        }
+        if (!batchNames.contains(opName))
+          inputsMap.getOrElseUpdate((opName, outputIndex), getOpByName(opName).outputs(outputIndex))
+      }
+    }))
+    val graphDef = GraphDef.newBuilder().addAllNode(nodeDefs.asJava).build()
+    val ops = NativeHandleLock.synchronized {
+      val opHandles = NativeGraph.importOps(
+        nativeHandle, graphDef.toByteArray, "", inputsMap.keys.map(_._1).toArray, inputsMap.keys.map(_._2).toArray,
+        inputsMap.values.map(_.op.nativeHandle).toArray, inputsMap.values.map(_.index).toArray,
+        controlDependenciesMap.keys.toArray, controlDependenciesMap.values.map(_.nativeHandle).toArray,
+        Array.empty[Long], names.toArray)
+      opHandles.map(handle => opsCache.getOrElseUpdate(handle, Op(this, handle))).toSeq
+    }
+    names.foreach(markNameAsUsed)
+    ops
   }
 
   /** Imports a serialized representation of a graph and its meta-information into the current graph.
@@ -628,6 +929,53 @@ class Graph private[api](private[api] var nativeHandle: Long) extends Closeable
     */
   def toGraphDef: GraphDef = GraphDef.parseFrom(NativeHandleLock.synchronized(NativeGraph.toGraphDef(nativeHandle)))
 
+  /** Writes the serialized [[GraphDef]] representation of this graph directly to `file`. Unlike [[toGraphDef]], this
+    * never materializes the serialized graph on the JVM heap and thus also works for graphs whose serialized
+    * representation is larger than 2GB.
+    *
+    * @param  file File to write to. It is overwritten if it already exists.
+    */
+  def writeGraphDef(file: Path): Unit = NativeHandleLock.synchronized {
+    NativeGraph.toGraphDefFile(nativeHandle, file.toAbsolutePath.toString)
+  }
+
+  /** Writes the serialized [[GraphDef]] representation of this graph into `buffer`, starting at its beginning, and
+    * returns its size in bytes. If `buffer` is too small, nothing is written to it and the returned size can be used to
+    * allocate a large enough buffer.
+    *
+    * @param  buffer Direct byte buffer to write to.
+    * @return Size of the serialized graph definition in bytes.
+    * @throws IllegalArgumentException If `buffer` is not a direct byte buffer.
+    */
+  @throws[IllegalArgumentException]
+  def writeGraphDef(buffer: ByteBuffer): Long = {
+    if (!buffer.isDirect)
+      throw new IllegalArgumentException("The provided target buffer must be direct.")
+    NativeHandleLock.synchronized(NativeGraph.toGraphDefBuffer(nativeHandle, buffer))
+  }
+
+  /** Writes the node definitions of the ops created in this graph since some earlier export, serialized as a
+    * [[GraphDef]] that only contains those nodes, and returns a marker to use for the next export.
+    *
+    * Since concatenated serialized [[GraphDef]]s are parsed as a single, merged, [[GraphDef]], this can be used to keep
+    * a serialized representation of a growing graph up to date without re-exporting all of it. For example:
+    * {{{
+    *   var marker = graph.writeNodeDefs(file)                       // Writes all ops.
+    *   ...                                                           // Adds more ops to the graph.
+    *   marker = graph.writeNodeDefs(file, marker, append = true)    // Appends only the new ops.
+    * }}}
+    * Note that the written [[GraphDef]]s do not include the function library or the version information of this
+    * graph.
+    *
+    * @param  file   File to write to.
+    * @param  since  Marker returned by a previous call to this method. All ops are written if it is `0`.
+    * @param  append If `true`, the node definitions are appended to `file`. Otherwise, `file` is overwritten.
+    * @return Marker to pass to the next call to this method.
+    */
+  def writeNodeDefs(file: Path, since: Long = 0L, append: Boolean = false): Long = NativeHandleLock.synchronized {
+    NativeGraph.nodeDefsToFile(nativeHandle, since, file.toAbsolutePath.toString, append)
+  }
+
   /** Constructs and returns a [[MetaGraphDef]] object using the provided arguments.
     *
     * In combination with [[importMetaGraphDef]], this function can be used to:
@@ -808,6 +1156,46 @@ object Graph {
   /** Constructs and returns an empty new graph. */
   def apply(): Graph = new Graph(nativeHandle = NativeGraph.allocate())
 
+  /** Releases all memory-mapped files cached by [[Graph.importGraphDefFromFile]]. Graphs that have already been
+    * imported from those files are not affected. */
+  def clearGraphDefFileCache(): Unit = NativeGraph.clearGraphDefFileCache()
+
+  /** Enables the process-wide persistent cache of the graphs optimized by [[Graph.importOptimizedGraph]], which stores
+    * them in `directory`, so that processes which import the same optimized graphs (e.g., serving replicas that are
+    * started on similar machines) only need to run the Grappler optimizations once. Each optimized graph is identified
+    * by a fingerprint of the TensorFlow version, the properties of the local CPU, the rewriter configuration, the
+    * fetches, and the graph that is being optimized, and so changing any of them never results in stale graphs being
+    * used. The directory may be in any file system supported by [[org.platanios.tensorflow.api.io.FileIO]], and it may
+    * be shared by multiple processes, but a local directory is best for fast startup.
+    *
+    * @param  directory Directory in which to store the optimized graphs, which is created if it does not exist.
+    */
+  def enableOptimizedGraphCache(directory: Path): Unit = {
+    NativeGraph.enableOptimizedGraphCache(directory.toAbsolutePath.toString)
+  }
+
+  /** Disables the process-wide optimized graph cache. The optimized graphs are kept in the cache directory. */
+  def disableOptimizedGraphCache(): Unit = NativeGraph.disableOptimizedGraphCache()
+
+  /** Returns the statistics of the process-wide optimized graph cache, since it was last enabled. */
+  def optimizedGraphCacheStatistics: OptimizedGraphCacheStatistics = {
+    val values = NativeGraph.optimizedGraphCacheStatistics()
+    OptimizedGraphCacheStatistics(values(0), values(1), values(2), values(3))
+  }
+
+  /** Statistics of the optimized graph cache.
+    *
+    * @param  hits               Number of optimized graphs read from the cache.
+    * @param  misses             Number of graphs that had to be optimized, because the cache did not contain them.
+    * @param  failedWrites       Number of optimized graphs that could not be written to the cache (which does not
+    *                            cause their import to fail).
+    * @param  optimizationMicros Time spent optimizing graphs on misses, in microseconds.
+    */
+  case class OptimizedGraphCacheStatistics(hits: Long, misses: Long, failedWrites: Long, optimizationMicros: Long) {
+    /** Fraction of optimized graph imports that were served by the cache. */
+    def hitRate: Double = if (hits + misses == 0L) 0.0 else hits.toDouble / (hits + misses).toDouble
+  }
+
   /** Imports a graph from the provided serialized graph object.
     *
     * @param  graphDef    Serialized representation of the graph that will be imported.
@@ -1332,6 +1720,11 @@ object Graph {
       override def name: String = "local_resources"
     }
 
+    /** Key to collect the handles of all hash embedding tables, which are saved in checkpoints by the default saver. */
+    object HASH_EMBEDDING_TABLES extends OutputCollectionKey {
+      override def name: String = "hash_embedding_tables"
+    }
+
     /** Key to collect all trainable resource-style variables. */
     object TRAINABLE_RESOURCE_VARIABLES extends VariableCollectionKey {
       override def name: String = "trainable_resource_variables"
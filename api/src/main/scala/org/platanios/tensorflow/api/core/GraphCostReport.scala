@@ -0,0 +1,91 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core
+
+import org.platanios.tensorflow.jni.{GraphCostReport => NativeGraphCostReport}
+
+import java.util.concurrent.TimeUnit
+
+import scala.concurrent.duration.Duration
+
+/** Analytical estimate of the cost of running a graph once, computed using [[Graph.estimateCosts]].
+  *
+  * The estimate is computed without running the graph, by scheduling its ops on a virtual cluster and predicting the
+  * cost of each op from the statically inferred shapes of its inputs and outputs. It is thus only as accurate as the
+  * static shape information in the graph, but it is cheap to compute and can be used, for example, to size batches
+  * and replica counts, or to detect graphs that would run out of device memory, before launching a job.
+  *
+  * @param  executionTime Estimated execution time of the whole graph.
+  * @param  devices       Estimated costs for each device.
+  * @param  nodes         Estimated costs for each node, in the order in which the nodes were scheduled.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class GraphCostReport(
+    executionTime: Duration, devices: Seq[GraphCostReport.DeviceCost], nodes: Seq[GraphCostReport.NodeCost]) {
+  /** Estimated peak memory usage (in bytes) over all devices. */
+  def peakMemoryBytes: Long = if (devices.isEmpty) 0L else devices.map(_.peakMemoryBytes).max
+
+  /** Returns a table summarizing this report, containing the costs of each device and of the `maxRows` most expensive
+    * op types. */
+  def summary(maxRows: Int = 20): String = {
+    val builder = new StringBuilder
+    builder ++= f"Estimated execution time: ${executionTime.toMicros / 1000.0}%.3f ms.\n"
+    builder ++= f"${"Device"}%-50s ${"Time (ms)"}%12s ${"Peak Memory (bytes)"}%20s\n"
+    devices.foreach(d => {
+      builder ++= f"${d.device}%-50s ${d.executionTime.toMicros / 1000.0}%12.3f ${d.peakMemoryBytes}%20d\n"
+    })
+    val opTypes = nodes.groupBy(_.opType).mapValues(n => (n.size, n.map(_.executionTime.toMicros).sum)).toSeq
+    builder ++= f"${"Op Type"}%-30s ${"Nodes"}%8s ${"Time (ms)"}%12s\n"
+    opTypes.sortBy(-_._2._2).take(maxRows).foreach(t => {
+      builder ++= f"${t._1}%-30s ${t._2._1}%8d ${t._2._2 / 1000.0}%12.3f\n"
+    })
+    builder.toString
+  }
+}
+
+object GraphCostReport {
+  /** Estimated costs for a single device.
+    *
+    * @param  device          Device name.
+    * @param  executionTime   Time at which the last op executed on the device finishes.
+    * @param  peakMemoryBytes Peak memory used by the outputs of the ops executed on the device.
+    */
+  case class DeviceCost(device: String, executionTime: Duration, peakMemoryBytes: Long)
+
+  /** Estimated costs for a single node.
+    *
+    * @param  name          Node name.
+    * @param  opType        Op type of the node.
+    * @param  device        Device on which the node is executed.
+    * @param  executionTime Estimated execution time of the node.
+    * @param  computeTime   Estimated time spent computing (as opposed to accessing memory).
+    * @param  memoryTime    Estimated time spent accessing memory.
+    */
+  case class NodeCost(
+      name: String, opType: String, device: String, executionTime: Duration, computeTime: Duration,
+      memoryTime: Duration)
+
+  private[core] def fromNative(report: NativeGraphCostReport): GraphCostReport = {
+    def micros(value: Long): Duration = Duration(value, TimeUnit.MICROSECONDS)
+    val devices = report.deviceNames.indices.map(i => DeviceCost(
+      report.deviceNames(i), micros(report.deviceExecutionMicros(i)), report.devicePeakMemoryBytes(i)))
+    val nodes = report.nodeNames.indices.map(i => NodeCost(
+      report.nodeNames(i), report.nodeOpTypes(i), report.nodeDevices(i), micros(report.nodeExecutionMicros(i)),
+      micros(report.nodeComputeMicros(i)), micros(report.nodeMemoryMicros(i))))
+    GraphCostReport(micros(report.executionMicros), devices, nodes)
+  }
+}
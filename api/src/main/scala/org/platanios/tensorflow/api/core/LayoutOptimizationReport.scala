@@ -0,0 +1,76 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core
+
+import org.platanios.tensorflow.api.ops.Op
+
+import org.tensorflow.framework.{GraphDef, NodeDef}
+
+import scala.collection.JavaConverters._
+import scala.util.Try
+
+/** Report of the changes that the Grappler layout optimizer makes to a graph, computed using
+  * [[Graph.layoutOptimizationReport]].
+  *
+  * The layout optimizer converts the convolution-related ops that run on GPUs (e.g., convolutions, pooling, fused batch
+  * normalization, and bias additions) from the NHWC data format, which is the default for the ops in
+  * [[org.platanios.tensorflow.api.ops.NN]], to the NCHW data format, which cuDNN runs faster. Whole chains of such ops
+  * are converted together, and so transposes are only inserted at the boundaries of each chain. The optimizer is
+  * enabled for sessions using the `graphLayoutOptimization` option of
+  * [[org.platanios.tensorflow.api.core.client.SessionConfig]], and this report can be used to preview its changes
+  * (e.g., to check that the transposes are not more than expected), even on machines without GPUs.
+  *
+  * @param  convertedOps   Ops of the original graph that were converted from NHWC to NCHW.
+  * @param  addedNodes     Nodes that were added by the optimizer (i.e., the boundary transposes and the constants and
+  *                        shape computations that they need).
+  * @param  optimizedGraph Optimized graph definition.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class LayoutOptimizationReport(convertedOps: Seq[Op], addedNodes: Seq[NodeDef], optimizedGraph: GraphDef) {
+  /** Added transpose nodes. */
+  def addedTransposes: Seq[NodeDef] = addedNodes.filter(_.getOp == "Transpose")
+
+  /** Returns a table summarizing this report, containing the number of converted ops and of added nodes per op type. */
+  def summary: String = {
+    val builder = new StringBuilder
+    builder ++= s"Converted ${convertedOps.size} ops to NCHW and added ${addedTransposes.size} transposes.\n"
+    builder ++= f"${"Converted Op Type"}%-30s ${"Ops"}%8s\n"
+    convertedOps.groupBy(_.opType).mapValues(_.size).toSeq.sortBy(-_._2).foreach(t => {
+      builder ++= f"${t._1}%-30s ${t._2}%8d\n"
+    })
+    builder ++= f"${"Added Op Type"}%-30s ${"Nodes"}%8s\n"
+    addedNodes.groupBy(_.getOp).mapValues(_.size).toSeq.sortBy(-_._2).foreach(t => {
+      builder ++= f"${t._1}%-30s ${t._2}%8d\n"
+    })
+    builder.toString
+  }
+}
+
+object LayoutOptimizationReport {
+  private[core] def apply(graph: Graph, optimizedGraph: GraphDef): LayoutOptimizationReport = {
+    val convertedOps = Seq.newBuilder[Op]
+    val addedNodes = Seq.newBuilder[NodeDef]
+    optimizedGraph.getNodeList.asScala.foreach(node => graph.findOp(node.getName) match {
+      case Some(op) =>
+        val dataFormat = Option(node.getAttrMap.get("data_format")).map(_.getS.toStringUtf8)
+        if (dataFormat.contains("NCHW") && Try(op.stringAttribute("data_format")).toOption.contains("NHWC"))
+          convertedOps += op
+      case None => addedNodes += node
+    })
+    LayoutOptimizationReport(convertedOps.result(), addedNodes.result(), optimizedGraph)
+  }
+}
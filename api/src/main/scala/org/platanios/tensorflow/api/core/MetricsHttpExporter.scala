@@ -0,0 +1,42 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core
+
+import org.platanios.tensorflow.api.utilities.Closeable
+import org.platanios.tensorflow.jni.{Monitoring => NativeMonitoring}
+
+/** HTTP exporter of the native monitoring metrics, created using [[Monitoring.startHttpExporter]].
+  *
+  * The exporter serves requests on a native background thread, one at a time, and it is not stopped when it is garbage
+  * collected, so that it can keep serving metrics for the lifetime of the process. It must be closed explicitly in
+  * order to stop it.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class MetricsHttpExporter private[core](private[this] var nativeHandle: Long) extends Closeable {
+  private[this] object NativeHandleLock
+
+  /** Port that this exporter listens on. */
+  val port: Int = NativeMonitoring.metricsHttpExporterPort(nativeHandle)
+
+  /** Stops this exporter, waiting for the request being served (if any) to complete. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      NativeMonitoring.deleteMetricsHttpExporter(nativeHandle)
+      nativeHandle = 0
+    }
+  }
+}
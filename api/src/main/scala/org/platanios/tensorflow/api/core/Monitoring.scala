@@ -0,0 +1,72 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core
+
+import org.platanios.tensorflow.api.core.distributed.ServerMetrics
+import org.platanios.tensorflow.jni.{Monitoring => NativeMonitoring}
+
+import java.nio.charset.StandardCharsets
+
+/** Contains functions for exporting the metrics of the process-wide native monitoring registry.
+  *
+  * The registry holds the metrics of the TensorFlow runtime (e.g., `/tensorflow/core/graph_runs`), along with those of
+  * the JNI bindings, which are:
+  *   - `/tensorflow/jni/session_runs`: Number of session runs (including callable and batched runs).
+  *   - `/tensorflow/jni/session_run_latency`: Histogram of the session run latencies, in microseconds.
+  *   - `/tensorflow/jni/eager_dispatches`: Number of eager op dispatches.
+  *   - `/tensorflow/jni/record_reader_bytes`: Number of record bytes read by the record readers.
+  *
+  * For example, the following exposes all metrics to Prometheus at `http://<host>:9090/metrics`:
+  * {{{
+  *   val exporter = Monitoring.startHttpExporter(port = 9090)
+  * }}}
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object Monitoring {
+  /** Collects the current values of the metrics whose names start with `prefix` (e.g., `"/tensorflow/"`).
+    *
+    * @param  prefix Prefix of the names of the metrics to collect. All metrics are collected if it is empty.
+    * @return Snapshot of the collected metrics.
+    */
+  def metrics(prefix: String = ""): ServerMetrics = ServerMetrics.fromNative(NativeMonitoring.collectMetrics(prefix))
+
+  /** Collects the current values of the metrics whose names start with `prefix` and formats them natively in the
+    * OpenMetrics text format. Metric names are converted to valid OpenMetrics names (e.g.,
+    * `/tensorflow/core/graph_runs` becomes `tensorflow_core_graph_runs`).
+    *
+    * @param  prefix Prefix of the names of the metrics to collect. All metrics are collected if it is empty.
+    * @return Collected metrics in the OpenMetrics text format.
+    */
+  def openMetrics(prefix: String = ""): String = {
+    new String(NativeMonitoring.collectOpenMetrics(prefix), StandardCharsets.UTF_8)
+  }
+
+  /** Starts serving the metrics whose names start with `prefix` in the OpenMetrics text format over HTTP, at path
+    * `/metrics`, on a native background thread, so that they can be scraped (e.g., by Prometheus). The exporter keeps
+    * running until it is closed.
+    *
+    * @param  port   Port to listen on, or `0` to listen on an ephemeral port (see [[MetricsHttpExporter.port]]).
+    * @param  host   IPv4 address to listen on (e.g., `"127.0.0.1"` to only accept local connections).
+    * @param  prefix Prefix of the names of the metrics to serve. All metrics are served if it is empty.
+    * @return Started exporter.
+    * @throws UnavailableException If the exporter cannot listen on the provided address.
+    */
+  @throws[exception.UnavailableException]
+  def startHttpExporter(port: Int = 0, host: String = "0.0.0.0", prefix: String = ""): MetricsHttpExporter = {
+    new MetricsHttpExporter(NativeMonitoring.startMetricsHttpExporter(host, port, prefix))
+  }
+}
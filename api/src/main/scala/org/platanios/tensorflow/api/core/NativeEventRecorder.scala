@@ -0,0 +1,276 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core
+
+import org.platanios.tensorflow.api.utilities.Closeable
+import org.platanios.tensorflow.jni.{NativeEvents => NativeEventsJNI}
+
+import com.typesafe.scalalogging.Logger
+import org.slf4j.LoggerFactory
+
+import java.nio.{ByteBuffer, ByteOrder}
+import java.util.concurrent.atomic.AtomicBoolean
+
+import scala.collection.JavaConverters._
+import scala.collection.mutable
+
+/** Timed event recorded natively for one of the hot paths of the JNI bindings.
+  *
+  * @param  kind           Kind of the event.
+  * @param  name           Name of the event (e.g., `"Session.run"` or the name of the executed eager op).
+  * @param  startTimeNanos Start time of the event, in nanoseconds since the epoch.
+  * @param  durationNanos  Duration of the event, in nanoseconds.
+  * @param  numBytes       Number of bytes processed (i.e., bytes fed for session runs and record bytes read for record
+  *                        reads), or `0` if not applicable.
+  * @param  numInputs      Number of inputs (i.e., feeds for session runs), or `0` if not applicable.
+  * @param  numOutputs     Number of outputs (i.e., fetches for session runs, outputs for eager ops, and records for
+  *                        batched record reads), or `0` if not applicable.
+  * @param  threadId       Identifier of the native thread that recorded the event (i.e., its OS thread ID, on Linux).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class NativeEvent(
+    kind: NativeEvent.Kind,
+    name: String,
+    startTimeNanos: Long,
+    durationNanos: Long,
+    numBytes: Long,
+    numInputs: Int,
+    numOutputs: Int,
+    threadId: Long)
+
+object NativeEvent {
+  sealed trait Kind {
+    val name: String
+    override def toString: String = name
+  }
+
+  case object SessionRun extends Kind {
+    override val name: String = "SessionRun"
+  }
+
+  case object EagerExecute extends Kind {
+    override val name: String = "EagerExecute"
+  }
+
+  case object RecordRead extends Kind {
+    override val name: String = "RecordRead"
+  }
+
+  private[core] def kindFromNative(kind: Int): Kind = kind match {
+    case 0 => SessionRun
+    case 1 => EagerExecute
+    case 2 => RecordRead
+    case _ => throw new IllegalArgumentException(s"Invalid native event kind: $kind.")
+  }
+}
+
+/** Recorder of native events, created using [[NativeEventRecorder.start]].
+  *
+  * While a recorder is running, session runs, eager op executions, and record reads are timed natively and stored in
+  * per-thread ring buffers, which a daemon thread drains every `flushIntervalMillis` milliseconds, passing the drained
+  * events to the sink. Recording an event does not cross the JNI boundary and does not allocate, and so the overhead
+  * on the instrumented paths is small. Events recorded while a ring buffer is full (i.e., if the sink cannot keep up)
+  * are dropped and counted by [[numDropped]].
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class NativeEventRecorder private[core](
+    val flushIntervalMillis: Long,
+    private[this] val sink: NativeEvent => Unit
+) extends Closeable {
+  private[this] val eventSize: Int = NativeEventsJNI.eventSize()
+
+  private[this] val buffer: ByteBuffer = {
+    ByteBuffer.allocateDirect(NativeEventRecorder.MAX_EVENTS_PER_DRAIN * eventSize).order(ByteOrder.nativeOrder())
+  }
+
+  /** Names of the events, cached by the addresses of their native strings, which have static storage duration. */
+  private[this] val names: mutable.LongMap[String] = mutable.LongMap.empty[String]
+
+  private[this] val flushing: AtomicBoolean = new AtomicBoolean(true)
+
+  private[this] val thread: Thread = {
+    val thread = new Thread(new Runnable {
+      override def run(): Unit = {
+        while (flushing.get()) {
+          try {
+            Thread.sleep(flushIntervalMillis)
+          } catch {
+            case _: InterruptedException => ()
+          }
+          flush()
+        }
+        flush()
+      }
+    }, "tf_scala_native_event_recorder")
+    thread.setDaemon(true)
+    thread.start()
+    thread
+  }
+
+  /** Returns the total number of events that were dropped because their ring buffer was full. */
+  def numDropped: Long = NativeEventsJNI.numDropped()
+
+  /** Drains all recorded events and passes them to the sink. */
+  private[this] def flush(): Unit = {
+    var numEvents = NativeEventsJNI.drain(buffer)
+    while (numEvents > 0) {
+      (0 until numEvents).foreach(i => {
+        val offset = i * eventSize
+        val nameAddress = buffer.getLong(offset + 16)
+        val event = NativeEvent(
+          kind = NativeEvent.kindFromNative(buffer.getInt(offset + 40)),
+          name = names.getOrElseUpdate(nameAddress, NativeEventsJNI.eventName(nameAddress)),
+          startTimeNanos = buffer.getLong(offset),
+          durationNanos = buffer.getLong(offset + 8),
+          numBytes = buffer.getLong(offset + 24),
+          numInputs = buffer.getInt(offset + 44),
+          numOutputs = buffer.getInt(offset + 48),
+          threadId = buffer.getLong(offset + 32))
+        try {
+          sink(event)
+        } catch {
+          case t: Throwable => NativeEventRecorder.logger.warn("The native event sink failed.", t)
+        }
+      })
+      numEvents = if (numEvents == NativeEventRecorder.MAX_EVENTS_PER_DRAIN) NativeEventsJNI.drain(buffer) else 0
+    }
+  }
+
+  /** Stops recording native events, and drains and passes the remaining events to the sink. */
+  override def close(): Unit = {
+    if (flushing.compareAndSet(true, false)) {
+      NativeEventsJNI.setEnabled(false)
+      thread.interrupt()
+      thread.join()
+      NativeEventRecorder.running.set(false)
+    }
+  }
+}
+
+/** Contains functions for recording the hot paths of the JNI bindings as native events.
+  *
+  * By default, the events are emitted as JDK Flight Recorder events named `org.platanios.tensorflow.NativeCall`, so
+  * that they show up next to the JVM events (e.g., garbage collections) in JDK Mission Control. For example:
+  * {{{
+  *   // Run with "-XX:StartFlightRecording=filename=run.jfr".
+  *   val recorder = NativeEventRecorder.start()
+  *   ...
+  *   recorder.close()
+  * }}}
+  *
+  * The Flight Recorder API does not allow setting the timestamps of the events that it records and so each event is
+  * committed when it is drained, with its native start time and duration stored in its `nativeStartTime` and
+  * `nativeDuration` fields.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object NativeEventRecorder {
+  private[core] val logger = Logger(LoggerFactory.getLogger("Core / Native Event Recorder"))
+
+  /** Maximum number of events moved to the JVM with each JNI call. */
+  val MAX_EVENTS_PER_DRAIN: Int = 4096
+
+  /** Name of the JDK Flight Recorder events emitted by [[flightRecorderSink]]. */
+  val FLIGHT_RECORDER_EVENT_NAME: String = "org.platanios.tensorflow.NativeCall"
+
+  private[core] val running: AtomicBoolean = new AtomicBoolean(false)
+
+  /** Starts recording native events. Only one recorder may be running at a time.
+    *
+    * @param  flushIntervalMillis Interval between drains of the native ring buffers, in milliseconds.
+    * @param  sink                Sink that receives the drained events, on the thread of the recorder. Defaults to
+    *                             [[flightRecorderSink]] and, if the JDK Flight Recorder is not available (i.e., on
+    *                             JDK 8), the events are dropped with a warning.
+    * @return Started recorder.
+    * @throws IllegalStateException If another recorder is already running.
+    */
+  @throws[IllegalStateException]
+  def start(flushIntervalMillis: Long = 100L, sink: Option[NativeEvent => Unit] = None): NativeEventRecorder = {
+    require(flushIntervalMillis > 0, s"The flush interval ($flushIntervalMillis) must be positive.")
+    if (!running.compareAndSet(false, true))
+      throw new IllegalStateException("Another native event recorder is already running.")
+    val eventSink = sink.orElse(flightRecorderSink).getOrElse({
+      logger.warn("The JDK Flight Recorder is not available and no sink was provided. Native events will be dropped.")
+      (_: NativeEvent) => ()
+    })
+    val recorder = new NativeEventRecorder(flushIntervalMillis, eventSink)
+    NativeEventsJNI.setEnabled(true)
+    recorder
+  }
+
+  /** Sink that emits the events as JDK Flight Recorder events, or `None` if the Flight Recorder is not available. The
+    * Flight Recorder API is accessed using reflection, because it is only available on JDK 9 or newer. */
+  lazy val flightRecorderSink: Option[NativeEvent => Unit] = {
+    try {
+      val annotationElementClass = Class.forName("jdk.jfr.AnnotationElement")
+      val valueDescriptorClass = Class.forName("jdk.jfr.ValueDescriptor")
+      val eventFactoryClass = Class.forName("jdk.jfr.EventFactory")
+      val eventClass = Class.forName("jdk.jfr.Event")
+      val annotationConstructor = annotationElementClass.getConstructor(classOf[Class[_]], classOf[Object])
+      val markerConstructor = annotationElementClass.getConstructor(classOf[Class[_]])
+      val valueDescriptorConstructor = valueDescriptorClass.getConstructor(
+        classOf[Class[_]], classOf[String], classOf[java.util.List[_]])
+
+      def annotation(name: String, value: AnyRef = null): AnyRef = {
+        if (value == null)
+          markerConstructor.newInstance(Class.forName(s"jdk.jfr.$name")).asInstanceOf[AnyRef]
+        else
+          annotationConstructor.newInstance(Class.forName(s"jdk.jfr.$name"), value).asInstanceOf[AnyRef]
+      }
+
+      def field(fieldType: Class[_], name: String, label: String, annotations: AnyRef*): AnyRef = {
+        valueDescriptorConstructor.newInstance(
+          fieldType, name, (annotation("Label", label) +: annotations).asJava).asInstanceOf[AnyRef]
+      }
+
+      val eventAnnotations = Seq(
+        annotation("Name", FLIGHT_RECORDER_EVENT_NAME),
+        annotation("Label", "TensorFlow Native Call"),
+        annotation("Category", Array("TensorFlow")),
+        annotation("Description", "Session run, eager op execution, or record read, timed in the JNI bindings."))
+      val fields = Seq(
+        field(classOf[String], "kind", "Kind"),
+        field(classOf[String], "name", "Name"),
+        field(classOf[Long], "nativeStartTime", "Native Start Time",
+          annotation("Timestamp", "MILLISECONDS_SINCE_EPOCH")),
+        field(classOf[Long], "nativeDuration", "Native Duration", annotation("Timespan", "NANOSECONDS")),
+        field(classOf[Long], "bytes", "Bytes", annotation("DataAmount", "BYTES")),
+        field(classOf[Int], "inputs", "Inputs"),
+        field(classOf[Int], "outputs", "Outputs"),
+        field(classOf[Long], "nativeThreadId", "Native Thread ID"))
+      val factory = eventFactoryClass.getMethod("create", classOf[java.util.List[_]], classOf[java.util.List[_]])
+          .invoke(null, eventAnnotations.asJava, fields.asJava)
+      val newEvent = eventFactoryClass.getMethod("newEvent")
+      val isEnabled = eventClass.getMethod("isEnabled")
+      val set = eventClass.getMethod("set", classOf[Int], classOf[Object])
+      val commit = eventClass.getMethod("commit")
+      Some((event: NativeEvent) => {
+        val jfrEvent = newEvent.invoke(factory)
+        if (isEnabled.invoke(jfrEvent).asInstanceOf[Boolean]) {
+          val values = Seq[AnyRef](
+            event.kind.name, event.name, Long.box(event.startTimeNanos / 1000000L), Long.box(event.durationNanos),
+            Long.box(event.numBytes), Int.box(event.numInputs), Int.box(event.numOutputs), Long.box(event.threadId))
+          values.zipWithIndex.foreach(v => set.invoke(jfrEvent, Int.box(v._2), v._1))
+          commit.invoke(jfrEvent)
+        }
+      })
+    } catch {
+      case _: ReflectiveOperationException | _: LinkageError => None
+    }
+  }
+}
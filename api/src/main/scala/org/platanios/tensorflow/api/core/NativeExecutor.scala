@@ -0,0 +1,157 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+
+package org.platanios.tensorflow.api.core
+
+import org.platanios.tensorflow.jni.{NativeExecutor => NativeExecutorJNI}
+
+import java.util.concurrent.TimeUnit
+
+import scala.concurrent.duration.Duration
+
+/** Contains functions for configuring and monitoring the process-wide native executor, which runs the background work
+  * of the native library (i.e., concurrent file system requests, the packing of large tensor batches, asynchronous
+  * callable runs, and the tokenization of text corpora) on a single set of work-stealing native threads, instead of
+  * each feature using its own threads. The executor threads are attached to the JVM for their whole lifetime, and so
+  * callbacks into the JVM are cheap.
+  *
+  * The work of each [[NativeExecutor.Subsystem]] runs with a [[NativeExecutor.Priority]], which limits the number of
+  * threads that it may occupy: low priority work may occupy up to half of the threads, and normal priority work all
+  * threads except for a quarter of them, which remain available for high priority work. For example, the following
+  * keeps asynchronous callable runs responsive while large batches are being packed:
+  * {{{
+  *   NativeExecutor.setPriority(NativeExecutor.TensorPacking, NativeExecutor.Low)
+  *   NativeExecutor.setPriority(NativeExecutor.SessionCallbacks, NativeExecutor.High)
+  * }}}
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object NativeExecutor {
+  sealed trait Subsystem {
+    val name: String
+    private[NativeExecutor] val index: Int
+    override def toString: String = name
+  }
+
+  /** Concurrent file system requests issued by [[org.platanios.tensorflow.api.io.FileIO]]. */
+  case object FileIO extends Subsystem {
+    override val name: String = "FileIO"
+    override private[NativeExecutor] val index: Int = 0
+  }
+
+  /** Packing of large batches of tensors. */
+  case object TensorPacking extends Subsystem {
+    override val name: String = "TensorPacking"
+    override private[NativeExecutor] val index: Int = 1
+  }
+
+  /** Asynchronous callable runs, along with the invocation of their callbacks. */
+  case object SessionCallbacks extends Subsystem {
+    override val name: String = "SessionCallbacks"
+    override private[NativeExecutor] val index: Int = 2
+  }
+
+  /** Tokenization of the text corpora loaded by [[org.platanios.tensorflow.api.io.CorpusLoader]]. */
+  case object CorpusLoading extends Subsystem {
+    override val name: String = "CorpusLoading"
+    override private[NativeExecutor] val index: Int = 3
+  }
+
+  val subsystems: Seq[Subsystem] = Seq(FileIO, TensorPacking, SessionCallbacks, CorpusLoading)
+
+  sealed trait Priority {
+    val name: String
+    private[NativeExecutor] val index: Int
+    override def toString: String = name
+  }
+
+  case object Low extends Priority {
+    override val name: String = "Low"
+    override private[NativeExecutor] val index: Int = 0
+  }
+
+  case object Normal extends Priority {
+    override val name: String = "Normal"
+    override private[NativeExecutor] val index: Int = 1
+  }
+
+  case object High extends Priority {
+    override val name: String = "High"
+    override private[NativeExecutor] val index: Int = 2
+  }
+
+  val priorities: Seq[Priority] = Seq(Low, Normal, High)
+
+  /** Usage statistics of a subsystem of the native executor.
+    *
+    * Dividing `totalTaskTime` by the time elapsed between two snapshots of these statistics gives the average number of
+    * executor threads that were occupied by the subsystem.
+    *
+    * @param  subsystem      Subsystem.
+    * @param  priority       Current priority of the subsystem.
+    * @param  scheduledTasks Number of tasks scheduled by the subsystem.
+    * @param  completedTasks Number of tasks of the subsystem that have completed.
+    * @param  activeTasks    Number of tasks of the subsystem that are currently running.
+    * @param  queuedTasks    Number of tasks of the subsystem that are waiting for their priority to allow them to
+    *                        start.
+    * @param  totalTaskTime  Sum of the durations of all completed tasks of the subsystem.
+    */
+  case class Statistics(
+      subsystem: Subsystem,
+      priority: Priority,
+      scheduledTasks: Long,
+      completedTasks: Long,
+      activeTasks: Long,
+      queuedTasks: Long,
+      totalTaskTime: Duration) {
+    override def toString: String = {
+      s"NativeExecutor.Statistics[subsystem = $subsystem, priority = $priority, scheduled = $scheduledTasks, " +
+          s"completed = $completedTasks, active = $activeTasks, queued = $queuedTasks, task time = $totalTaskTime]"
+    }
+  }
+
+  /** Sets the number of executor threads, which defaults to the larger of the number of available processors and
+    * `16`, since file system requests spend most of their time blocked.
+    *
+    * @param  numThreads Number of threads.
+    * @throws InvalidArgumentException   If `numThreads` is not positive.
+    * @throws FailedPreconditionException If the executor has already been created with a different number of threads
+    *                                     (i.e., if native background work has already run).
+    */
+  @throws[exception.InvalidArgumentException]
+  @throws[exception.FailedPreconditionException]
+  def setNumThreads(numThreads: Int): Unit = NativeExecutorJNI.setNumThreads(numThreads)
+
+  /** Returns the number of executor threads. */
+  def numThreads: Int = NativeExecutorJNI.numThreads()
+
+  /** Sets the priority of the work of `subsystem`, which is [[Normal]] by default. The new priority applies to tasks
+    * that are scheduled after this call. */
+  def setPriority(subsystem: Subsystem, priority: Priority): Unit = {
+    NativeExecutorJNI.setPriority(subsystem.index, priority.index)
+  }
+
+  /** Returns the usage statistics of all subsystems. */
+  def statistics: Seq[Statistics] = {
+    val values = NativeExecutorJNI.statistics()
+    val n = NativeExecutorJNI.NumValues
+    subsystems.map(subsystem => {
+      val v = values.slice(subsystem.index * n, (subsystem.index + 1) * n)
+      Statistics(
+        subsystem, priorities(v(0).toInt), v(1), v(2), v(3), v(4), Duration(v(5), TimeUnit.MICROSECONDS))
+    })
+  }
+}
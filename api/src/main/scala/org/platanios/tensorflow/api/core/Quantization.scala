@@ -0,0 +1,174 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core
+
+import org.platanios.tensorflow.api.core.client.{FeedMap, Session}
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
+import org.platanios.tensorflow.api.ops.{Math, Op, Output}
+import org.platanios.tensorflow.api.tensors.Tensor
+
+import java.util.concurrent.TimeUnit
+
+import scala.concurrent.duration.Duration
+
+/** Contains tools for post-training eight-bit quantization of frozen inference graphs.
+  *
+  * Quantization consists of three steps:
+  *
+  *   1. '''Calibration:''' The float graph is run over a few representative batches of inputs, using [[calibrate]],
+  *      which records the range of each activation that is going to be quantized.
+  *   2. '''Rewriting:''' The `MatMul` and `Conv2D` ops with constant weights, along with any `BiasAdd`, `ReLU` and
+  *      `ReLU6` ops that directly follow them, are rewritten to quantized ops, using [[quantize]]. The weights and
+  *      biases are quantized offline and, since the calibrated ranges are known, the 32-bit accumulators of the
+  *      quantized ops are requantized to eight bits using constant ranges, instead of computing the range of every
+  *      batch. Consecutive quantized ops exchange their eight-bit outputs directly, and each rewritten op is replaced
+  *      by a `Dequantize` op with the same name, so that the quantized graph can be fed and fetched in the same way as
+  *      the float one.
+  *   3. '''Evaluation:''' The accuracy and latency of the quantized graph is compared to that of the float graph, using
+  *      [[compare]].
+  *
+  * For example:
+  * {{{
+  *   val floatSession = Session(frozenGraph)
+  *   val ranges = Quantization.calibrate(floatSession, calibrationFeeds)
+  *   val quantizedGraph = Quantization.quantize(frozenGraph, ranges)
+  *   val quantizedSession = Session(quantizedGraph)
+  *   val report = Quantization.compare(floatSession, quantizedSession, Seq("Logits:0"), evaluationFeeds)
+  *   println(report.summary)
+  * }}}
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object Quantization {
+  /** Calibrates the ranges of the outputs of the graph of `session` that need to be quantized, by running it for each
+    * of the provided `feeds`.
+    *
+    * @param  session  Session used to run the float graph.
+    * @param  feeds    Feeds for the calibration runs, which should be representative of the inputs of the graph at
+    *                  inference time.
+    * @param  outputs  Outputs whose ranges to calibrate. Defaults to the
+    *                  [[Graph.quantizationCalibrationOutputs]] of the graph of `session`.
+    * @param  averaged If `true`, the calibrated range of each output is the average of its ranges over the calibration
+    *                  runs, which is less sensitive to outliers. Otherwise, it is the union of those ranges.
+    * @return Map from the calibrated outputs to their ranges.
+    * @throws InvalidArgumentException If `feeds` is empty.
+    */
+  @throws[InvalidArgumentException]
+  def calibrate(
+      session: Session, feeds: Iterator[FeedMap], outputs: Seq[Output] = null,
+      averaged: Boolean = false): Map[Output, (Float, Float)] = {
+    val calibratedOutputs = if (outputs == null) session.graph.quantizationCalibrationOutputs else outputs
+    if (calibratedOutputs.isEmpty) {
+      Map.empty
+    } else {
+      val ranges = Op.createWith(session.graph) {
+        Op.createWithNameScope("QuantizationCalibration") {
+          calibratedOutputs.map(o => (Math.min(o), Math.max(o)))
+        }
+      }
+      val fetches = ranges.map(_._1) ++ ranges.map(_._2)
+      val numOutputs = calibratedOutputs.size
+      val mins = Array.fill(numOutputs)(if (averaged) 0.0 else Double.PositiveInfinity)
+      val maxs = Array.fill(numOutputs)(if (averaged) 0.0 else Double.NegativeInfinity)
+      var numRuns = 0
+      feeds.foreach(feed => {
+        val values = session.run(feeds = feed, fetches = fetches)
+        var i = 0
+        while (i < numOutputs) {
+          val min = values(i).scalar.asInstanceOf[Float].toDouble
+          val max = values(numOutputs + i).scalar.asInstanceOf[Float].toDouble
+          if (averaged) {
+            mins(i) += min
+            maxs(i) += max
+          } else {
+            mins(i) = scala.math.min(mins(i), min)
+            maxs(i) = scala.math.max(maxs(i), max)
+          }
+          i += 1
+        }
+        numRuns += 1
+      })
+      if (numRuns == 0)
+        throw InvalidArgumentException("At least one calibration feed is required.")
+      val scale = if (averaged) 1.0 / numRuns else 1.0
+      calibratedOutputs.indices.map(i => {
+        calibratedOutputs(i) -> ((mins(i) * scale).toFloat, (maxs(i) * scale).toFloat)
+      }).toMap
+    }
+  }
+
+  /** Returns a new graph containing an eight-bit quantized version of `graph`, which must be frozen, using the
+    * calibrated `ranges`. Please refer to [[Graph.importQuantizedGraph]] for details. */
+  def quantize(graph: Graph, ranges: Map[Output, (Float, Float)]): Graph = {
+    val quantizedGraph = Graph()
+    quantizedGraph.importQuantizedGraph(graph, ranges)
+    quantizedGraph
+  }
+
+  /** Compares the outputs and the latency of a quantized graph to those of the corresponding float graph.
+    *
+    * The two graphs are run for each of the provided `feeds`, and the values of the `outputs` computed by the quantized
+    * graph are compared to the ones computed by the float graph. Since quantized graphs preserve the names of the nodes
+    * of float graphs, both the feeds and the outputs are specified by name.
+    *
+    * @param  floatSession     Session used to run the float graph.
+    * @param  quantizedSession Session used to run the quantized graph.
+    * @param  outputs          Names of the outputs to compare (e.g., `"Logits:0"`).
+    * @param  feeds            Feeds for the comparison runs, as maps from output names to values.
+    * @param  numWarmUpRuns    Number of runs of each graph, using the first feed, that are executed before the
+    *                          compared runs and that are not timed.
+    * @return Comparison report.
+    * @throws InvalidArgumentException If `outputs` is empty.
+    */
+  @throws[InvalidArgumentException]
+  def compare(
+      floatSession: Session, quantizedSession: Session, outputs: Seq[String], feeds: Iterator[Map[String, Tensor]],
+      numWarmUpRuns: Int = 1): QuantizationReport = {
+    if (outputs.isEmpty)
+      throw InvalidArgumentException("At least one output is required in order to compare graphs.")
+    val floatFetches = outputs.map(floatSession.graph.getOutputByName)
+    val quantizedFetches = outputs.map(quantizedSession.graph.getOutputByName)
+    def feedMap(session: Session, feed: Map[String, Tensor]): FeedMap = {
+      FeedMap(feed.map(f => session.graph.getOutputByName(f._1) -> f._2))
+    }
+    def timedRun(session: Session, fetches: Seq[Output], feed: Map[String, Tensor]): (Seq[Tensor], Duration) = {
+      val feeds = feedMap(session, feed)
+      val start = System.nanoTime()
+      val values = session.run(feeds = feeds, fetches = fetches)
+      (values, Duration(System.nanoTime() - start, TimeUnit.NANOSECONDS))
+    }
+    val errors = Array.fill(outputs.size)(QuantizationReport.ErrorAccumulator())
+    val floatLatencies = Seq.newBuilder[Duration]
+    val quantizedLatencies = Seq.newBuilder[Duration]
+    var warmedUp = false
+    feeds.foreach(feed => {
+      if (!warmedUp) {
+        (0 until numWarmUpRuns).foreach(_ => {
+          floatSession.run(feeds = feedMap(floatSession, feed), fetches = floatFetches)
+          quantizedSession.run(feeds = feedMap(quantizedSession, feed), fetches = quantizedFetches)
+        })
+        warmedUp = true
+      }
+      val (floatValues, floatLatency) = timedRun(floatSession, floatFetches, feed)
+      val (quantizedValues, quantizedLatency) = timedRun(quantizedSession, quantizedFetches, feed)
+      floatLatencies += floatLatency
+      quantizedLatencies += quantizedLatency
+      errors.indices.foreach(i => errors(i).add(floatValues(i), quantizedValues(i)))
+    })
+    QuantizationReport(
+      outputs.indices.map(i => errors(i).result(outputs(i))), floatLatencies.result(), quantizedLatencies.result())
+  }
+}
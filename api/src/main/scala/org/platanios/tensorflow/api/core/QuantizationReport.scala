@@ -0,0 +1,154 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core
+
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
+import org.platanios.tensorflow.api.tensors.Tensor
+
+import scala.concurrent.duration.Duration
+
+/** Report comparing a quantized graph to the corresponding float graph, computed using [[Quantization.compare]].
+  *
+  * @param  outputs            Errors of each compared output of the quantized graph.
+  * @param  floatLatencies     Latency of each run of the float graph.
+  * @param  quantizedLatencies Latency of each run of the quantized graph.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class QuantizationReport(
+    outputs: Seq[QuantizationReport.OutputError], floatLatencies: Seq[Duration],
+    quantizedLatencies: Seq[Duration]) {
+  /** Mean latency of the float graph. */
+  def floatMeanLatency: Duration = QuantizationReport.mean(floatLatencies)
+
+  /** Mean latency of the quantized graph. */
+  def quantizedMeanLatency: Duration = QuantizationReport.mean(quantizedLatencies)
+
+  /** Ratio of the mean latency of the float graph to that of the quantized graph. */
+  def speedup: Double = {
+    if (quantizedMeanLatency == Duration.Zero) 0.0 else floatMeanLatency / quantizedMeanLatency
+  }
+
+  /** Returns a table summarizing this report. */
+  def summary: String = {
+    val builder = new StringBuilder
+    builder ++= f"Float mean latency:     ${floatMeanLatency.toMicros / 1000.0}%.3f ms.\n"
+    builder ++= f"Quantized mean latency: ${quantizedMeanLatency.toMicros / 1000.0}%.3f ms.\n"
+    builder ++= f"Speedup:                $speedup%.2fx\n"
+    builder ++= f"${"Output"}%-40s ${"Max Abs Error"}%14s ${"Mean Abs Error"}%15s ${"Rel. Error"}%11s " +
+        f"${"Top-1 Agreement"}%16s\n"
+    outputs.foreach(o => {
+      builder ++= f"${o.name}%-40s ${o.maxAbsoluteError}%14.6f ${o.meanAbsoluteError}%15.6f " +
+          f"${o.relativeError}%11.6f ${o.top1Agreement}%16.4f\n"
+    })
+    builder.toString
+  }
+}
+
+object QuantizationReport {
+  /** Errors of an output of a quantized graph, with respect to the same output of the float graph.
+    *
+    * @param  name              Output name.
+    * @param  maxAbsoluteError  Maximum absolute difference over all output elements.
+    * @param  meanAbsoluteError Mean absolute difference over all output elements.
+    * @param  relativeError     L2 norm of the differences divided by the L2 norm of the float output.
+    * @param  top1Agreement     Fraction of the rows of the output (i.e., slices along its last axis) for which the
+    *                           index of the largest element is the same for both graphs. For classifiers, this is the
+    *                           fraction of predictions that the quantization leaves unchanged.
+    */
+  case class OutputError(
+      name: String, maxAbsoluteError: Double, meanAbsoluteError: Double, relativeError: Double,
+      top1Agreement: Double)
+
+  private[core] def mean(latencies: Seq[Duration]): Duration = {
+    if (latencies.isEmpty) Duration.Zero else latencies.reduce(_ + _) / latencies.length.toDouble
+  }
+
+  /** Accumulates the errors of an output over multiple runs. */
+  private[core] case class ErrorAccumulator() {
+    private[this] var numElements    : Long   = 0L
+    private[this] var maxAbsolute    : Double = 0.0
+    private[this] var sumAbsolute    : Double = 0.0
+    private[this] var sumSquaredError: Double = 0.0
+    private[this] var sumSquaredValue: Double = 0.0
+    private[this] var numRows        : Long   = 0L
+    private[this] var numAgreeingRows: Long   = 0L
+
+    @throws[InvalidArgumentException]
+    def add(floatValue: Tensor, quantizedValue: Tensor): Unit = {
+      if (floatValue.shape != quantizedValue.shape)
+        throw InvalidArgumentException(
+          s"The float output shape ${floatValue.shape} does not match the quantized output shape " +
+              s"${quantizedValue.shape}.")
+      val rowSize = if (floatValue.rank < 1 || floatValue.shape(-1) <= 0) 1 else floatValue.shape(-1)
+      val floatIterator = floatValue.entriesIterator
+      val quantizedIterator = quantizedValue.entriesIterator
+      var i = 0
+      var floatArgMax = 0
+      var floatMax = Double.NegativeInfinity
+      var quantizedArgMax = 0
+      var quantizedMax = Double.NegativeInfinity
+      while (floatIterator.hasNext) {
+        val f = toDouble(floatIterator.next())
+        val q = toDouble(quantizedIterator.next())
+        val error = scala.math.abs(f - q)
+        maxAbsolute = scala.math.max(maxAbsolute, error)
+        sumAbsolute += error
+        sumSquaredError += error * error
+        sumSquaredValue += f * f
+        numElements += 1
+        if (f > floatMax) {
+          floatMax = f
+          floatArgMax = i
+        }
+        if (q > quantizedMax) {
+          quantizedMax = q
+          quantizedArgMax = i
+        }
+        i += 1
+        if (i == rowSize) {
+          numRows += 1
+          if (floatArgMax == quantizedArgMax)
+            numAgreeingRows += 1
+          i = 0
+          floatMax = Double.NegativeInfinity
+          quantizedMax = Double.NegativeInfinity
+        }
+      }
+    }
+
+    def result(name: String): OutputError = {
+      OutputError(
+        name = name,
+        maxAbsoluteError = maxAbsolute,
+        meanAbsoluteError = if (numElements == 0) 0.0 else sumAbsolute / numElements,
+        relativeError = if (sumSquaredValue == 0.0) 0.0 else scala.math.sqrt(sumSquaredError / sumSquaredValue),
+        top1Agreement = if (numRows == 0) 1.0 else numAgreeingRows.toDouble / numRows)
+    }
+
+    @throws[InvalidArgumentException]
+    private[this] def toDouble(value: Any): Double = value match {
+      case v: Float => v.toDouble
+      case v: Double => v
+      case v: Int => v.toDouble
+      case v: Long => v.toDouble
+      case v: Short => v.toDouble
+      case v: Byte => v.toDouble
+      case v: Boolean => if (v) 1.0 else 0.0
+      case _ => throw InvalidArgumentException(s"Unsupported output value type for quantization comparisons: $value.")
+    }
+  }
+}
@@ -0,0 +1,62 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.jni.{AllocatorStatistics => NativeAllocatorStatistics}
+
+/** Memory statistics of a native device allocator, obtained using [[Session.allocatorStatistics]] or the corresponding
+  * method of eager execution contexts.
+  *
+  * Note that device allocators are shared by all sessions and contexts in the same process, and so these statistics
+  * cover all of them. Furthermore, the peak statistics cover the whole lifetime of the process, as they cannot be reset.
+  *
+  * @param  device                Name of the device that the allocator was found through.
+  * @param  allocator             Name of the allocator.
+  * @param  numAllocations        Number of allocations performed so far.
+  * @param  bytesInUse            Number of bytes currently in use.
+  * @param  peakBytesInUse        Maximum number of bytes that were in use at the same time.
+  * @param  largestAllocationSize Size of the largest allocation, in bytes.
+  * @param  bytesLimit            Maximum number of bytes that the allocator may allocate, if known.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class AllocatorStatistics(
+    device: String,
+    allocator: String,
+    numAllocations: Long,
+    bytesInUse: Long,
+    peakBytesInUse: Long,
+    largestAllocationSize: Long,
+    bytesLimit: Option[Long]) {
+  override def toString: String = {
+    s"AllocatorStatistics[device = $device, allocator = $allocator, allocations = $numAllocations, " +
+        s"in use = $bytesInUse B, peak = $peakBytesInUse B, largest = $largestAllocationSize B" +
+        s"${bytesLimit.map(l => s", limit = $l B").getOrElse("")}]"
+  }
+}
+
+object AllocatorStatistics {
+  /** Unpacks the allocator statistics returned by the native library. */
+  private[api] def fromNative(statistics: NativeAllocatorStatistics): Seq[AllocatorStatistics] = {
+    val n = NativeAllocatorStatistics.NumValues
+    statistics.deviceNames.indices.map(i => {
+      val values = statistics.statistics.slice(i * n, (i + 1) * n)
+      AllocatorStatistics(
+        statistics.deviceNames(i), statistics.allocatorNames(i), values(0), values(1), values(2), values(3),
+        if (values(4) > 0) Some(values(4)) else None)
+    })
+  }
+}
@@ -0,0 +1,53 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.jni.{Session => NativeSession}
+
+/** CPU set that the threads of a session or an eager execution context may be pinned to, using
+  * [[SessionConfig.cpuAffinity]].
+  *
+  * On multi-socket hosts, pinning a session to the CPUs of a single NUMA node keeps its threads on one socket and,
+  * since memory is placed on the node of the thread that first touches it, keeps the tensors produced by its kernels in
+  * memory local to that socket. CPU affinities are only supported on Linux.
+  *
+  * @param  cpus     Indices of the CPUs in the set.
+  * @param  numaNode NUMA node whose CPUs are also in the set, if any.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class CPUAffinity(cpus: Set[Int] = Set.empty, numaNode: Option[Int] = None) {
+  require(cpus.forall(_ >= 0), "CPU indices must be non-negative.")
+  require(numaNode.forall(_ >= 0), "The NUMA node index must be non-negative.")
+
+  /** Returns `true` if this CPU set is empty, in which case no pinning is performed. */
+  def isEmpty: Boolean = cpus.isEmpty && numaNode.isEmpty
+
+  /** Pins the calling thread to this CPU set. This is useful for pinning the threads that fill in the tensors fed to
+    * pinned sessions, so that the memory of those tensors is also local to the CPU set. */
+  def pinCurrentThread(): Unit = {
+    if (!isEmpty)
+      NativeSession.setCurrentThreadAffinity(nativeCPUs, nativeNumaNode)
+  }
+
+  private[api] def nativeCPUs: Array[Int] = if (cpus.isEmpty) null else cpus.toArray
+  private[api] def nativeNumaNode: Int = numaNode.getOrElse(-1)
+}
+
+object CPUAffinity {
+  /** Creates a CPU affinity that consists of all the CPUs of NUMA node `node`. */
+  def forNumaNode(node: Int): CPUAffinity = CPUAffinity(numaNode = Some(node))
+}
@@ -0,0 +1,532 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.api.ops.Output
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{AsyncRunCallback, TensorFlowException, Session => NativeSession, Tensor => NativeTensor}
+
+import org.tensorflow.framework.RunMetadata
+
+import java.nio.ByteBuffer
+import java.nio.file.Path
+import java.util.concurrent.TimeUnit
+
+import scala.concurrent.{Future, Promise}
+import scala.concurrent.duration.Duration
+
+/** Callables represent a single session step (i.e., a fixed set of feeds, fetches, and targets), that has been resolved
+  * once and can then be run repeatedly, with minimal overhead. Callables are created using [[Session.makeCallable]].
+  *
+  * @param  session        Session in which this callable runs.
+  * @param  feeds          Outputs that are fed when running this callable.
+  * @param  numFetches     Number of unique fetches of this callable.
+  * @param  resultsBuilder Function used to build the results of this callable from the fetched tensors.
+  * @param  nativeHandle   Handle to the native callable object.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class Callable[R] private[client](
+    val session: Session,
+    val feeds: Seq[Output],
+    private[client] val numFetches: Int,
+    private[client] val resultsBuilder: Seq[Tensor] => R,
+    private[client] var nativeHandle: Long
+) extends Closeable {
+  private[this] object NativeHandleLock
+  private[this] var referenceCount: Int = 0
+
+  // Keep track of references in the Scala side and notify the native library when the callable is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Runs this callable, feeding `feedValues` to its feeds, and returns the values of its fetches.
+    *
+    * @param  feedValues Values to feed, in the same order as [[feeds]].
+    * @return The evaluated tensors using the structure of the fetches that were used to create this callable.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def apply(feedValues: Seq[Tensor] = Seq.empty): R = runHelper(feedValues)._1
+
+  /** Runs this callable, feeding `feedValues` to its feeds, and returns the values of its fetches, along with any run
+    * metadata that may have been collected.
+    *
+    * @param  feedValues Values to feed, in the same order as [[feeds]].
+    * @return A tuple containing the evaluated tensors and a [[RunMetadata]] protocol buffer option containing the
+    *         collected run metadata, if any.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def runWithMetadata(feedValues: Seq[Tensor] = Seq.empty): (R, Option[RunMetadata]) = {
+    runHelper(feedValues, wantMetadata = true)
+  }
+
+  /** Runs this callable once for each element of `feedValues`, back-to-back, within a single native call, and returns
+    * the values of its fetches for each step. This amortizes the cost of crossing the JNI boundary over multiple steps,
+    * which matters for small models where that cost dominates the step time.
+    *
+    * @param  feedValues Values to feed for each step, each in the same order as [[feeds]].
+    * @return The evaluated tensors for each step, using the structure of the fetches that were used to create this
+    *         callable.
+    * @throws IllegalArgumentException If the number of feed values for any step does not match the number of feeds.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def runBatch(feedValues: Seq[Seq[Tensor]]): Seq[R] = runBatchHelper(feedValues)._1
+
+  /** Runs this callable, feeding `feedValues` to its feeds, and copies the values of its fetches into `outputBuffers`,
+    * instead of returning them as new tensors. This is meant for steps with fixed-shape fetches (e.g., inference
+    * outputs) that are run repeatedly: the output buffers can be allocated once and reused across steps, and so no
+    * tensors are created on the JVM side for the fetches, which avoids the allocation churn and the garbage collection
+    * pressure that comes with them.
+    *
+    * After this call, the position of each output buffer is set to zero and its limit to the number of bytes of the
+    * corresponding fetch. The fetch values are laid out in row-major order, using the native byte order.
+    *
+    * @param  feedValues    Values to feed, in the same order as [[feeds]].
+    * @param  outputBuffers Direct buffers to copy the fetch values into, one for each unique fetch of this callable,
+    *                       in the order in which the fetches were provided when creating this callable (with duplicate
+    *                       fetches removed). Each buffer must have enough capacity for the corresponding fetch value.
+    * @param  wantMetadata  If `true`, the run metadata collected for this step is returned.
+    * @return [[RunMetadata]] protocol buffer option containing the collected run metadata, if any.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds, if the number
+    *                                  of output buffers does not match the number of fetches, or if some output buffer
+    *                                  is not direct or is too small for its fetch value (which cannot be a string).
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def runInto(
+      feedValues: Seq[Tensor], outputBuffers: Seq[ByteBuffer], wantMetadata: Boolean = false
+  ): Option[RunMetadata] = {
+    if (feedValues.length != feeds.length)
+      throw new IllegalArgumentException(s"Expected ${feeds.length} feed values, but got ${feedValues.length}, instead.")
+    if (outputBuffers.length != numFetches)
+      throw new IllegalArgumentException(
+        s"Expected $numFetches output buffers, but got ${outputBuffers.length}, instead.")
+    outputBuffers.zipWithIndex.foreach(buffer => {
+      if (!buffer._1.isDirect)
+        throw new IllegalArgumentException(s"Output buffer ${buffer._2} is not a direct buffer.")
+    })
+    val inputTensorHandles: Array[Long] = feedValues.map(_.resolve()).toArray
+    val outputNumBytes: Array[Long] = Array.ofDim[Long](numFetches)
+    val metadata = try {
+      incrementReferenceCount()
+      try {
+        session.acquire()
+        try {
+          NativeSession.runCallableIntoBuffers(
+            nativeHandle, inputTensorHandles, wantMetadata, outputBuffers.toArray, outputNumBytes)
+        } finally {
+          session.release()
+        }
+      } finally {
+        decrementReferenceCount()
+      }
+    } finally {
+      inputTensorHandles.foreach(NativeTensor.delete)
+    }
+    outputBuffers.zip(outputNumBytes).foreach(buffer => {
+      buffer._1.clear()
+      buffer._1.limit(buffer._2.toInt)
+    })
+    Option(metadata).map(RunMetadata.parseFrom)
+  }
+
+  /** Runs this callable, feeding `feedValues` to its feeds, and returns the values of its fetches, while profiling the
+    * step using `profiler`. If the profiler samples this step, then the step is traced and its execution statistics are
+    * aggregated natively by the profiler.
+    *
+    * @param  feedValues Values to feed, in the same order as [[feeds]].
+    * @param  profiler   Profiler to use.
+    * @return The evaluated tensors using the structure of the fetches that were used to create this callable.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds.
+    * @throws IllegalStateException    If this callable, its session, or the profiler has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def runProfiled(feedValues: Seq[Tensor], profiler: StepStatsProfiler): R = {
+    runNativeHelper(feedValues)((inputTensorHandles, outputTensorHandles) => {
+      profiler.withNativeHandle(profilerHandle => NativeSession.runCallableProfiled(
+        nativeHandle, inputTensorHandles, profilerHandle, outputTensorHandles))
+    })
+  }
+
+  /** Runs this callable with full tracing enabled, feeding `feedValues` to its feeds, and returns the values of its
+    * fetches. The execution timeline of the step is written to `file`, in the Chrome trace event format (which can be
+    * viewed using `chrome://tracing`). The timeline shows the execution of the ops on each device and thread, the
+    * tensor transfers between devices, and optionally, the memory in use by each allocator. It is created natively
+    * and so the run metadata of the step is never handed to the JVM.
+    *
+    * @param  feedValues Values to feed, in the same order as [[feeds]].
+    * @param  file       File to write the timeline to.
+    * @param  showMemory If `true`, the memory in use by each allocator is also included in the timeline.
+    * @return The evaluated tensors using the structure of the fetches that were used to create this callable.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def runWithTimeline(feedValues: Seq[Tensor], file: Path, showMemory: Boolean = false): R = {
+    runNativeHelper(feedValues)((inputTensorHandles, outputTensorHandles) => {
+      NativeSession.runCallableWithTimeline(
+        nativeHandle, inputTensorHandles, file.toAbsolutePath.toString, showMemory, outputTensorHandles)
+    })
+  }
+
+  /** Runs this callable once for each element of `feedValues`, similar to [[runBatch]], and also returns the run
+    * metadata collected for the last step, if any.
+    *
+    * @param  feedValues Values to feed for each step, each in the same order as [[feeds]].
+    * @return A tuple containing the evaluated tensors for each step and a [[RunMetadata]] protocol buffer option
+    *         containing the run metadata collected for the last step, if any.
+    * @throws IllegalArgumentException If the number of feed values for any step does not match the number of feeds.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def runBatchWithMetadata(feedValues: Seq[Seq[Tensor]]): (Seq[R], Option[RunMetadata]) = {
+    runBatchHelper(feedValues, wantMetadata = true)
+  }
+
+  /** Runs this callable asynchronously, feeding `feedValues` to its feeds, and returns a future that completes with the
+    * values of its fetches. The run is executed on a native worker thread and so the calling thread is never blocked
+    * waiting for it to complete.
+    *
+    * @param  feedValues Values to feed, in the same order as [[feeds]].
+    * @return Future that completes with the evaluated tensors using the structure of the fetches that were used to
+    *         create this callable, or that fails with the corresponding [[TensorFlowException]] if the run fails.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def runAsync(feedValues: Seq[Tensor] = Seq.empty): Future[R] = {
+    runAsyncHelper(feedValues, wantMetadata = false).map(_._1)(Callable.callingThreadExecutionContext)
+  }
+
+  /** Runs this callable asynchronously, similar to [[runAsync]], and also returns any run metadata that may have been
+    * collected.
+    *
+    * @param  feedValues Values to feed, in the same order as [[feeds]].
+    * @return Future that completes with a tuple containing the evaluated tensors and a [[RunMetadata]] protocol buffer
+    *         option containing the collected run metadata, if any.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def runAsyncWithMetadata(feedValues: Seq[Tensor] = Seq.empty): Future[(R, Option[RunMetadata])] = {
+    runAsyncHelper(feedValues, wantMetadata = true)
+  }
+
+  /** Helper method for [[runAsync]] and [[runAsyncWithMetadata]]. */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  private[this] def runAsyncHelper(
+      feedValues: Seq[Tensor], wantMetadata: Boolean): Future[(R, Option[RunMetadata])] = {
+    if (feedValues.length != feeds.length)
+      throw new IllegalArgumentException(
+        s"Expected ${feeds.length} feed values, but got ${feedValues.length}, instead.")
+    val inputTensorHandles: Array[Long] = feedValues.map(_.resolve()).toArray
+    val promise = Promise[(R, Option[RunMetadata])]()
+    // Both the callable and its session are kept alive until the run completes, at which point the native worker thread
+    // invokes the callback.
+    val callback = new AsyncRunCallback {
+      override def onSuccess(outputTensorHandles: Array[Long], runMetadata: Array[Byte]): Unit = {
+        releaseAsync()
+        promise.complete(scala.util.Try {
+          val outputTensors = outputTensorHandles.map(handle => {
+            val tensor = Tensor.fromHostNativeHandle(handle)
+            NativeTensor.delete(handle)
+            tensor
+          })
+          (resultsBuilder(outputTensors.toSeq), Option(runMetadata).map(RunMetadata.parseFrom))
+        })
+      }
+
+      override def onFailure(errorCode: Int, message: String): Unit = {
+        releaseAsync()
+        promise.failure(TensorFlowException.fromCode(errorCode, message))
+      }
+    }
+    try {
+      incrementReferenceCount()
+      try {
+        session.acquire()
+      } catch {
+        case e: Throwable =>
+          decrementReferenceCount()
+          throw e
+      }
+    } catch {
+      case e: Throwable =>
+        inputTensorHandles.foreach(NativeTensor.delete)
+        throw e
+    }
+    try {
+      NativeSession.runCallableAsync(nativeHandle, inputTensorHandles, wantMetadata, callback)
+    } catch {
+      case e: Throwable =>
+        // The native library only takes ownership of the input tensors once the run has been scheduled.
+        releaseAsync()
+        inputTensorHandles.foreach(NativeTensor.delete)
+        throw e
+    }
+    promise.future
+  }
+
+  /** Creates a request batcher for this callable, which dynamically batches concurrent requests, concatenating their
+    * feed values along their leading dimension, running this callable once for each batch, and splitting the fetched
+    * values back into the results of each request. All fetches of this callable must have a leading dimension whose
+    * size equals the number of rows fed (e.g., the batch dimension of an inference graph).
+    *
+    * The batcher keeps this callable and its session alive until it is closed, and so it must be closed before they
+    * can be closed.
+    *
+    * @param  maxBatchSize    Maximum number of rows (i.e., elements of the leading dimension of the feed values) in
+    *                         each batch. Requests with more rows are run on their own.
+    * @param  batchTimeout    Maximum time to wait for more requests to arrive, after the oldest queued request was
+    *                         submitted, before running a batch that is not full.
+    * @param  maxQueueSize    Maximum number of queued requests, above which new requests are rejected.
+    * @param  numBatchThreads Number of native threads that form and run batches (i.e., maximum number of batches that
+    *                         can be running concurrently).
+    * @return Created request batcher.
+    * @throws IllegalArgumentException If this callable has no feeds, or if any of the provided sizes is not positive.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def requestBatcher(
+      maxBatchSize: Int = 32,
+      batchTimeout: Duration = Duration(1, TimeUnit.MILLISECONDS),
+      maxQueueSize: Int = 1024,
+      numBatchThreads: Int = 1
+  ): RequestBatcher[R] = {
+    require(feeds.nonEmpty, "Only callables with at least one feed can be batched.")
+    require(maxBatchSize > 0, s"The maximum batch size ($maxBatchSize) must be positive.")
+    require(maxQueueSize > 0, s"The maximum queue size ($maxQueueSize) must be positive.")
+    require(numBatchThreads > 0, s"The number of batch threads ($numBatchThreads) must be positive.")
+    incrementReferenceCount()
+    try {
+      session.acquire()
+    } catch {
+      case e: Throwable =>
+        decrementReferenceCount()
+        throw e
+    }
+    val schedulerHandle = try {
+      NativeSession.makeBatchScheduler(
+        nativeHandle, maxBatchSize, batchTimeout.toMicros, maxQueueSize, numBatchThreads)
+    } catch {
+      case e: Throwable =>
+        releaseAsync()
+        throw e
+    }
+    new RequestBatcher[R](this, schedulerHandle)
+  }
+
+  /** Releases the references to this callable and its session that are held by an asynchronous run or by a request
+    * batcher. */
+  private[client] def releaseAsync(): Unit = {
+    session.release()
+    decrementReferenceCount()
+  }
+
+  /** Marks this callable as being in use, so that it is not deleted while running. */
+  @throws[IllegalStateException]
+  private[this] def incrementReferenceCount(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("This callable has already been closed.")
+    referenceCount += 1
+  }
+
+  /** Reverses the effect of [[incrementReferenceCount]]. */
+  private[this] def decrementReferenceCount(): Unit = NativeHandleLock.synchronized {
+    referenceCount -= 1
+    if (referenceCount == 0)
+      NativeHandleLock.notifyAll()
+  }
+
+  /** Helper method for [[runProfiled]] and [[runWithTimeline]], which runs a single step using `nativeRun`. */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  private[this] def runNativeHelper(feedValues: Seq[Tensor])(nativeRun: (Array[Long], Array[Long]) => Unit): R = {
+    if (feedValues.length != feeds.length)
+      throw new IllegalArgumentException(s"Expected ${feeds.length} feed values, but got ${feedValues.length}, instead.")
+    val inputTensorHandles: Array[Long] = feedValues.map(_.resolve()).toArray
+    val outputTensorHandles: Array[Long] = Array.ofDim[Long](numFetches)
+    try {
+      incrementReferenceCount()
+      try {
+        session.acquire()
+        try {
+          nativeRun(inputTensorHandles, outputTensorHandles)
+        } finally {
+          session.release()
+        }
+      } finally {
+        decrementReferenceCount()
+      }
+    } finally {
+      inputTensorHandles.foreach(NativeTensor.delete)
+    }
+    resultsBuilder(outputTensorHandles.map(handle => {
+      val tensor = Tensor.fromHostNativeHandle(handle)
+      NativeTensor.delete(handle)
+      tensor
+    }).toSeq)
+  }
+
+  /** Helper method for [[apply]] and [[runWithMetadata]]. */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  private[this] def runHelper(feedValues: Seq[Tensor], wantMetadata: Boolean = false): (R, Option[RunMetadata]) = {
+    val (outputs, metadata) = runBatchHelper(Seq(feedValues), wantMetadata)
+    (outputs.head, metadata)
+  }
+
+  /** Helper method for [[runBatch]] and [[runBatchWithMetadata]]. */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  private[this] def runBatchHelper(
+      feedValues: Seq[Seq[Tensor]], wantMetadata: Boolean = false): (Seq[R], Option[RunMetadata]) = {
+    feedValues.foreach(stepFeedValues => {
+      if (stepFeedValues.length != feeds.length)
+        throw new IllegalArgumentException(
+          s"Expected ${feeds.length} feed values, but got ${stepFeedValues.length}, instead.")
+    })
+    val numSteps = feedValues.length
+    val inputTensorHandles: Array[Long] = feedValues.flatMap(_.map(_.resolve())).toArray
+    val outputTensorHandles: Array[Long] = Array.ofDim[Long](numSteps * numFetches)
+    incrementReferenceCount()
+    val metadata = try {
+      session.acquire()
+      try {
+        if (numSteps == 1)
+          NativeSession.runCallable(nativeHandle, inputTensorHandles, wantMetadata, outputTensorHandles)
+        else
+          NativeSession.runCallableBatch(nativeHandle, numSteps, inputTensorHandles, wantMetadata, outputTensorHandles)
+      } finally {
+        session.release()
+      }
+    } finally {
+      decrementReferenceCount()
+      inputTensorHandles.foreach(NativeTensor.delete)
+    }
+    val outputTensors = outputTensorHandles.map(handle => {
+      val tensor = Tensor.fromHostNativeHandle(handle)
+      NativeTensor.delete(handle)
+      tensor
+    })
+    val outputs: Seq[R] = {
+      if (numFetches == 0)
+        Seq.fill(numSteps)(resultsBuilder(Seq.empty))
+      else
+        outputTensors.grouped(numFetches).map(stepOutputs => resultsBuilder(stepOutputs.toSeq)).toSeq
+    }
+    (outputs, Option(metadata).map(RunMetadata.parseFrom))
+  }
+
+  /** Warms up this callable by running it `numRuns` times, back-to-back, within a single native call. The first runs
+    * of a step are typically much slower than the rest, because they instantiate kernels, autotune them (e.g., cuDNN
+    * convolutions), and grow the allocators. Warming up a callable before it serves real traffic keeps these latency
+    * spikes away from it.
+    *
+    * @param  numRuns    Number of times to run this callable.
+    * @param  feedValues Values to feed to every run, in the same order as [[feeds]]. If empty, synthetic all-zeros
+    *                    values are created using the data types and static shapes of the feeds.
+    * @return Warm-up report containing the latency of each run.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds, or if synthetic
+    *                                  values are needed but the shape of some feed is not fully defined.
+    * @throws IllegalStateException    If this callable or its session has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def warmUp(numRuns: Int = 10, feedValues: Seq[Tensor] = Seq.empty): WarmUpReport = {
+    val values = {
+      if (feedValues.nonEmpty || feeds.isEmpty) {
+        feedValues
+      } else {
+        feeds.map(feed => {
+          if (!feed.shape.isFullyDefined)
+            throw new IllegalArgumentException(
+              s"Cannot create a synthetic value for feed '${feed.name}', because its shape (${feed.shape}) is not " +
+                  "fully defined. Please provide sample feed values, instead.")
+          Tensor.zeros(feed.dataType, feed.shape)
+        })
+      }
+    }
+    if (values.length != feeds.length)
+      throw new IllegalArgumentException(s"Expected ${feeds.length} feed values, but got ${values.length}, instead.")
+    val inputTensorHandles: Array[Long] = values.map(_.resolve()).toArray
+    val latencies = try {
+      incrementReferenceCount()
+      try {
+        session.acquire()
+        try {
+          NativeSession.warmUpCallable(nativeHandle, inputTensorHandles, numRuns)
+        } finally {
+          session.release()
+        }
+      } finally {
+        decrementReferenceCount()
+      }
+    } finally {
+      inputTensorHandles.foreach(NativeTensor.delete)
+    }
+    WarmUpReport(latencies.toSeq.map(Duration(_, TimeUnit.MICROSECONDS)))
+  }
+
+  /** Returns a boolean flag indicating whether this callable has been closed. */
+  def closed: Boolean = nativeHandle == 0
+
+  /** Closes this callable and releases any resources associated with it. Note that a callable is not usable after it
+    * has been closed. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      while (referenceCount > 0) {
+        try {
+          NativeHandleLock.wait()
+        } catch {
+          case _: InterruptedException =>
+            Thread.currentThread().interrupt()
+            return
+        }
+      }
+      NativeSession.deleteCallable(nativeHandle)
+      nativeHandle = 0
+    }
+  }
+}
+
+private[client] object Callable {
+  /** Execution context that runs the (cheap) future transformations used by [[Callable]] on the completing thread. */
+  private[client] val callingThreadExecutionContext: scala.concurrent.ExecutionContext = {
+    new scala.concurrent.ExecutionContext {
+      override def execute(runnable: Runnable): Unit = runnable.run()
+      override def reportFailure(cause: Throwable): Unit = ()
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.tensorflow.framework.DeviceAttributes
+
+/** Local device of a session, obtained using [[Session.listDevices]].
+  *
+  * @param  name                Fully specified name of the device (e.g., `"/job:localhost/replica:0/task:0/gpu:0"`).
+  * @param  deviceType          Type of the device (e.g., `"CPU"` or `"GPU"`).
+  * @param  memoryLimit         Memory capacity of the device, in bytes.
+  * @param  numaNode            NUMA node that the device is attached to, if known.
+  * @param  pciBusId            PCI bus identifier of the device (e.g., `"0000:81:00.0"`), if known.
+  * @param  physicalDescription String description of the physical device (e.g., its vendor and model).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class LocalDevice(
+    name: String,
+    deviceType: String,
+    memoryLimit: Long,
+    numaNode: Option[Int],
+    pciBusId: Option[String],
+    physicalDescription: String) {
+  /** Returns `true` if this device and `other` are known to be attached to the same NUMA node (i.e., to the same CPU
+    * socket), meaning that copies between them do not need to cross the inter-socket interconnect. */
+  def sharesNumaNodeWith(other: LocalDevice): Boolean = numaNode.isDefined && numaNode == other.numaNode
+
+  override def toString: String = {
+    s"LocalDevice[name = $name, type = $deviceType, memory = $memoryLimit B" +
+        s"${numaNode.map(n => s", NUMA node = $n").getOrElse("")}${pciBusId.map(id => s", PCI bus = $id").getOrElse("")}]"
+  }
+}
+
+object LocalDevice {
+  private[this] val pciBusIdRegex = "pci bus id: ([0-9a-fA-F:.]+)".r.unanchored
+
+  /** Creates a local device from its `DeviceAttributes` protocol buffer. */
+  def fromDeviceAttributes(attributes: DeviceAttributes): LocalDevice = {
+    // TensorFlow stores the NUMA node of each device incremented by one, using zero to denote an unknown node.
+    val busId = if (attributes.hasLocality) attributes.getLocality.getBusId else 0
+    val pciBusId = attributes.getPhysicalDeviceDesc match {
+      case pciBusIdRegex(id) => Some(id)
+      case _ => None
+    }
+    LocalDevice(
+      attributes.getName, attributes.getDeviceType, attributes.getMemoryLimit,
+      if (busId > 0) Some(busId - 1) else None, pciBusId, attributes.getPhysicalDeviceDesc)
+  }
+
+  /** Groups the provided devices by the NUMA node they are attached to. Devices whose NUMA node is unknown are grouped
+    * under `None`. */
+  def groupByNumaNode(devices: Seq[LocalDevice]): Map[Option[Int], Seq[LocalDevice]] = devices.groupBy(_.numaNode)
+}
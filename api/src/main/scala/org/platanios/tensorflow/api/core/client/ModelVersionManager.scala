@@ -0,0 +1,210 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.utilities.Closeable
+
+import org.tensorflow.framework.RunOptions
+
+import java.nio.file.Path
+import java.util.concurrent.atomic.AtomicReference
+
+import scala.annotation.tailrec
+import scala.concurrent.{ExecutionContext, Future}
+
+/** Version of a model that is served by a [[ModelVersionManager]].
+  *
+  * @param  version   Version number.
+  * @param  exportDir SavedModel export directory from which this version was loaded.
+  * @param  model     Loaded model.
+  * @param  callable  Callable used to serve requests against this version.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class ModelVersion[R] private[client](
+    val version: Long,
+    val exportDir: Path,
+    val model: SavedModel,
+    val callable: Callable[R]
+) {
+  private[this] object InFlightLock
+  private[this] var inFlight: Int     = 0
+  private[this] var retired : Boolean = false
+
+  /** Number of requests that are currently running against this version. */
+  def numInFlight: Int = InFlightLock.synchronized(inFlight)
+
+  /** Returns a boolean flag indicating whether this version has been retired (i.e., replaced by another version). */
+  def isRetired: Boolean = InFlightLock.synchronized(retired)
+
+  /** Marks a request as running against this version, unless it has already been retired, in which case `false` is
+    * returned. */
+  private[client] def tryAcquire(): Boolean = InFlightLock.synchronized {
+    if (retired) {
+      false
+    } else {
+      inFlight += 1
+      true
+    }
+  }
+
+  /** Reverses the effect of [[tryAcquire]]. */
+  private[client] def release(): Unit = InFlightLock.synchronized {
+    inFlight -= 1
+    if (inFlight == 0)
+      InFlightLock.notifyAll()
+  }
+
+  /** Retires this version, waits for the requests that are running against it to complete, and then closes its
+    * callable and its model. */
+  private[client] def retire(): Unit = {
+    InFlightLock.synchronized {
+      retired = true
+      while (inFlight > 0)
+        InFlightLock.wait()
+    }
+    callable.close()
+    model.close()
+  }
+
+  override def toString: String = s"ModelVersion($version, $exportDir)"
+}
+
+/** Serves successive versions of a model that is exported in the SavedModel format, swapping versions without
+  * interrupting the requests being served.
+  *
+  * New versions are loaded (and optionally warmed up) while the current version keeps serving requests. Once a new
+  * version is ready, it atomically replaces the current one, so that all subsequent requests run against it. The
+  * replaced version is freed only after all requests that were already running against it have completed. Therefore,
+  * at most two versions are ever loaded at the same time, and only while a new version is being loaded or while the
+  * replaced version is draining. Note that the two versions do not share any variable values, because each one is
+  * restored in its own session.
+  *
+  * @param  makeCallable  Function used to create the callable that serves requests against a loaded model (e.g.,
+  *                       using its default serving signature).
+  * @param  tags          Tags that identify the meta-graph to load from each export.
+  * @param  sessionConfig Optional configuration for the sessions of the loaded versions.
+  * @param  runOptions    Optional options for the session runs that restore the variables of the loaded versions.
+  * @param  numWarmUpRuns Number of times to run the callable of each loaded version, using synthetic feed values,
+  *                       before it replaces the current version (please refer to [[Callable.warmUp]] for details).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class ModelVersionManager[R](
+    val makeCallable: SavedModel => Callable[R],
+    val tags: Set[String] = Set(SavedModel.SERVING_TAG),
+    val sessionConfig: Option[SessionConfig] = None,
+    val runOptions: Option[RunOptions] = None,
+    val numWarmUpRuns: Int = 0
+) extends Closeable {
+  private[this] object LoadLock
+  private[this] val currentVersion: AtomicReference[ModelVersion[R]] = new AtomicReference[ModelVersion[R]](null)
+  private[this] var isClosed      : Boolean                          = false
+
+  /** Returns the version that is currently being served, if any. */
+  def current: Option[ModelVersion[R]] = Option(currentVersion.get())
+
+  /** Loads version `version` of the model from `exportDir`, makes it the current version, and then waits for the
+    * requests running against the replaced version, if any, to complete, before freeing it. Requests submitted while
+    * the new version is being loaded are served by the replaced version. Loads are serialized.
+    *
+    * @param  version   Version number.
+    * @param  exportDir SavedModel export directory.
+    * @return Loaded version.
+    * @throws IllegalStateException If this manager has already been closed.
+    */
+  @throws[IllegalStateException]
+  def load(version: Long, exportDir: Path): ModelVersion[R] = LoadLock.synchronized {
+    if (isClosed)
+      throw new IllegalStateException("This model version manager has already been closed.")
+    val model = SavedModel.load(exportDir, tags, sessionConfig, runOptions)
+    val loaded = try {
+      val callable = makeCallable(model)
+      if (numWarmUpRuns > 0)
+        callable.warmUp(numWarmUpRuns)
+      new ModelVersion[R](version, exportDir, model, callable)
+    } catch {
+      case t: Throwable =>
+        model.close()
+        throw t
+    }
+    Option(currentVersion.getAndSet(loaded)).foreach(_.retire())
+    loaded
+  }
+
+  /** Loads a model version in the background, similar to [[load]], and returns a future that completes with the loaded
+    * version once it has replaced the current version and the replaced version has been freed. */
+  def loadAsync(version: Long, exportDir: Path)(implicit
+      executionContext: ExecutionContext
+  ): Future[ModelVersion[R]] = {
+    Future(load(version, exportDir))
+  }
+
+  /** Runs the callable of the current version, feeding `feedValues` to its feeds, and returns the values of its
+    * fetches.
+    *
+    * @throws IllegalStateException If no version has been loaded yet, or if this manager has already been closed.
+    */
+  @throws[IllegalStateException]
+  def apply(feedValues: Seq[Tensor]): R = {
+    val version = acquireCurrent()
+    try {
+      version.callable(feedValues)
+    } finally {
+      version.release()
+    }
+  }
+
+  /** Runs the callable of the current version asynchronously, similar to [[Callable.runAsync]]. The version is not
+    * freed before the returned future completes.
+    *
+    * @throws IllegalStateException If no version has been loaded yet, or if this manager has already been closed.
+    */
+  @throws[IllegalStateException]
+  def runAsync(feedValues: Seq[Tensor]): Future[R] = {
+    val version = acquireCurrent()
+    val result = try {
+      version.callable.runAsync(feedValues)
+    } catch {
+      case t: Throwable =>
+        version.release()
+        throw t
+    }
+    result.onComplete(_ => version.release())(Callable.callingThreadExecutionContext)
+    result
+  }
+
+  /** Returns the current version, after marking a request as running against it. */
+  @tailrec
+  @throws[IllegalStateException]
+  private[this] def acquireCurrent(): ModelVersion[R] = {
+    val version = currentVersion.get()
+    if (version == null)
+      throw new IllegalStateException("No model version is currently loaded.")
+    // The version may be retired between reading it and acquiring it, in which case the new current one is used.
+    if (version.tryAcquire()) version else acquireCurrent()
+  }
+
+  /** Closes this manager, after waiting for the requests running against the current version to complete, and frees
+    * the current version. */
+  override def close(): Unit = LoadLock.synchronized {
+    if (!isClosed) {
+      isClosed = true
+      Option(currentVersion.getAndSet(null)).foreach(_.retire())
+    }
+  }
+}
@@ -0,0 +1,109 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.api.ops.{Op, Output}
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{Session => NativeSession, Tensor => NativeTensor}
+
+/** Partial runs represent a single session step whose feeds and fetches are provided incrementally, over multiple
+  * calls to [[run]]. The intermediate state of the step (i.e., the values computed so far) stays in the session
+  * between calls, and so later calls reuse computations made by earlier ones, rather than recomputing them. Partial
+  * runs are created using [[Session.makePartialRun]].
+  *
+  * Each feed can only be fed once and each fetch can only be fetched once over the lifetime of a partial run. A partial
+  * run is complete once all of its fetches have been fetched.
+  *
+  * @param  session      Session in which this partial run executes.
+  * @param  feeds        Outputs that may be fed over the calls to [[run]].
+  * @param  fetches      Outputs that may be fetched over the calls to [[run]].
+  * @param  nativeHandle Handle to the native partial run object.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class PartialRun private[client](
+    val session: Session,
+    val feeds: Seq[Output],
+    val fetches: Seq[Output],
+    private[client] var nativeHandle: Long
+) extends Closeable {
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the partial run is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Continues this partial run, feeding `feeds`, fetching `fetches`, and executing `targets`.
+    *
+    * @param  feeds   Feed map. Each fed output must be one of the [[PartialRun.feeds]] that has not been fed yet.
+    * @param  fetches Values to fetch. Please refer to the documentation of the [[Fetchable]] type class for details on
+    *                 the allowed types. Each fetched output must be one of the [[PartialRun.fetches]] that has not been
+    *                 fetched yet.
+    * @param  targets Ops to execute, without returning their value. Please refer to the documentation of the
+    *                 [[Executable]] type class for details on the allowed types of `targets`.
+    * @return The evaluated tensors using the structure of `fetches`.
+    * @throws IllegalStateException If this partial run or its session has already been closed.
+    */
+  @throws[IllegalStateException]
+  def run[F, E, R](
+      feeds: FeedMap = FeedMap.empty, fetches: F = Seq.empty[Output], targets: E = Traversable.empty[Op])
+      (implicit executable: Executable[E], fetchable: Fetchable.Aux[F, R]): R = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("This partial run has already been closed.")
+    val (inputs, inputTensors) = feeds.values.toSeq.unzip
+    val (uniqueFetches, resultsBuilder) = Fetchable.process(fetches)(fetchable)
+    val inputTensorHandles: Array[Long] = inputTensors.map(_.resolve()).toArray
+    val outputTensorHandles: Array[Long] = Array.ofDim[Long](uniqueFetches.length)
+    try {
+      session.acquire()
+      try {
+        NativeSession.partialRun(
+          handle = session.nativeHandle,
+          partialRunHandle = nativeHandle,
+          inputTensorHandles = inputTensorHandles,
+          inputOpHandles = inputs.map(_.op.nativeHandle).toArray,
+          inputOpIndices = inputs.map(_.index).toArray,
+          outputOpHandles = uniqueFetches.map(_.op.nativeHandle).toArray,
+          outputOpIndices = uniqueFetches.map(_.index).toArray,
+          targetOpHandles = executable.ops(targets).map(_.nativeHandle).toArray,
+          outputTensorHandles = outputTensorHandles)
+      } finally {
+        session.release()
+      }
+    } finally {
+      inputTensorHandles.foreach(NativeTensor.delete)
+    }
+    resultsBuilder(outputTensorHandles.map(handle => {
+      val tensor = Tensor.fromHostNativeHandle(handle)
+      NativeTensor.delete(handle)
+      tensor
+    }))
+  }
+
+  /** Returns a boolean flag indicating whether this partial run has been closed. */
+  def closed: Boolean = nativeHandle == 0
+
+  /** Closes this partial run and releases any resources associated with it, including the intermediate state kept in
+    * the session. Note that a partial run is not usable after it has been closed. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      NativeSession.deletePartialRun(nativeHandle)
+      nativeHandle = 0
+    }
+  }
+}
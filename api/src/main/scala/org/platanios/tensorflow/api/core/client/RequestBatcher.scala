@@ -0,0 +1,153 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{AsyncRunCallback, TensorFlowException, Session => NativeSession, Tensor => NativeTensor}
+
+import scala.concurrent.{Future, Promise}
+
+/** Request batchers dynamically batch concurrent requests against a callable (e.g., inference requests submitted by
+  * multiple serving threads). Requests are queued natively and a number of native batch threads combine them into
+  * batches, concatenating the feed values of all requests in a batch along their leading dimension, running the
+  * callable once for the whole batch, and splitting the fetched values back along their leading dimension. This
+  * amortizes the per-step overhead over multiple requests and lets the kernels work on larger inputs, in exchange for
+  * a bounded amount of added latency. Request batchers are created using [[Callable.requestBatcher]].
+  *
+  * All feed values of a request must have the same leading dimension size (i.e., number of rows), and all fetches of
+  * the callable must have a leading dimension whose size equals the total number of rows of the batch.
+  *
+  * @param  callable     Callable whose runs are batched.
+  * @param  nativeHandle Handle to the native batch scheduler object.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class RequestBatcher[R] private[client](
+    val callable: Callable[R],
+    private[this] var nativeHandle: Long
+) extends Closeable {
+  private[this] object NativeHandleLock
+  private[this] var referenceCount: Int = 0
+
+  // Keep track of references in the Scala side and notify the native library when the batcher is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Submits a request, feeding `feedValues` to the feeds of the callable, and returns a future that completes with
+    * the values of its fetches, for the rows of this request. The request is queued and the calling thread is never
+    * blocked waiting for it to complete.
+    *
+    * @param  feedValues Values to feed, in the same order as the callable feeds.
+    * @return Future that completes with the evaluated tensors using the structure of the fetches that were used to
+    *         create the callable, or that fails with the corresponding [[TensorFlowException]] if the batch fails.
+    * @throws IllegalArgumentException If the number of feed values does not match the number of feeds, or if their
+    *                                  leading dimension sizes differ.
+    * @throws IllegalStateException    If this batcher has already been closed.
+    * @throws TensorFlowException      If the request queue is full.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  @throws[TensorFlowException]
+  def submit(feedValues: Seq[Tensor]): Future[R] = {
+    if (feedValues.length != callable.feeds.length)
+      throw new IllegalArgumentException(
+        s"Expected ${callable.feeds.length} feed values, but got ${feedValues.length}, instead.")
+    val inputTensorHandles: Array[Long] = feedValues.map(_.resolve()).toArray
+    val promise = Promise[R]()
+    val callback = new AsyncRunCallback {
+      override def onSuccess(outputTensorHandles: Array[Long], runMetadata: Array[Byte]): Unit = {
+        promise.complete(scala.util.Try {
+          callable.resultsBuilder(outputTensorHandles.map(handle => {
+            val tensor = Tensor.fromHostNativeHandle(handle)
+            NativeTensor.delete(handle)
+            tensor
+          }).toSeq)
+        })
+      }
+
+      override def onFailure(errorCode: Int, message: String): Unit = {
+        promise.failure(TensorFlowException.fromCode(errorCode, message))
+      }
+    }
+    try {
+      incrementReferenceCount()
+      try {
+        NativeSession.batchSchedulerSchedule(nativeHandle, inputTensorHandles, callback)
+      } finally {
+        decrementReferenceCount()
+      }
+    } catch {
+      case e: Throwable =>
+        // The native library only takes ownership of the input tensors once the request has been scheduled.
+        inputTensorHandles.foreach(NativeTensor.delete)
+        throw e
+    }
+    promise.future
+  }
+
+  /** Returns the current statistics of this batcher (e.g., its queue depth and its batch size histogram).
+    *
+    * @throws IllegalStateException If this batcher has already been closed.
+    */
+  @throws[IllegalStateException]
+  def statistics: RequestBatcherStatistics = {
+    incrementReferenceCount()
+    try {
+      RequestBatcherStatistics.fromNative(NativeSession.batchSchedulerStatistics(nativeHandle))
+    } finally {
+      decrementReferenceCount()
+    }
+  }
+
+  /** Marks this batcher as being in use, so that it is not deleted while a request is being scheduled. */
+  @throws[IllegalStateException]
+  private[this] def incrementReferenceCount(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("This request batcher has already been closed.")
+    referenceCount += 1
+  }
+
+  /** Reverses the effect of [[incrementReferenceCount]]. */
+  private[this] def decrementReferenceCount(): Unit = NativeHandleLock.synchronized {
+    referenceCount -= 1
+    if (referenceCount == 0)
+      NativeHandleLock.notifyAll()
+  }
+
+  /** Returns a boolean flag indicating whether this batcher has been closed. */
+  def closed: Boolean = nativeHandle == 0
+
+  /** Closes this batcher, after its running batches complete, and releases its references to the callable and its
+    * session. Requests that are still queued fail with a [[TensorFlowException]] (i.e., a cancellation error). */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      while (referenceCount > 0) {
+        try {
+          NativeHandleLock.wait()
+        } catch {
+          case _: InterruptedException =>
+            Thread.currentThread().interrupt()
+            return
+        }
+      }
+      NativeSession.deleteBatchScheduler(nativeHandle)
+      nativeHandle = 0
+      callable.releaseAsync()
+    }
+  }
+}
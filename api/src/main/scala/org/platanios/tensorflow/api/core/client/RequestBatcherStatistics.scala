@@ -0,0 +1,70 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+/** Statistics of a [[RequestBatcher]].
+  *
+  * @param  numRequests         Number of requests that have been scheduled.
+  * @param  numRejected         Number of requests that have been rejected because the queue was full.
+  * @param  numBatches          Number of batches that have been formed.
+  * @param  queueDepth          Number of requests that are currently queued.
+  * @param  peakQueueDepth      Maximum number of requests that have been queued at the same time.
+  * @param  queueDepthHistogram Histogram of the number of other requests found queued by each scheduled request.
+  *                             Element `i` counts the requests that found between `2^(i-1)` (or `0`, for `i = 0`) and
+  *                             `2^i - 1` other requests queued.
+  * @param  batchSizeHistogram  Histogram of the batch sizes. Element `i` counts the batches that contained `i` rows
+  *                             and the last element counts the batches with more rows than the maximum batch size
+  *                             (i.e., batches that consist of a single oversized request).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class RequestBatcherStatistics(
+    numRequests: Long,
+    numRejected: Long,
+    numBatches: Long,
+    queueDepth: Long,
+    peakQueueDepth: Long,
+    queueDepthHistogram: Seq[Long],
+    batchSizeHistogram: Seq[Long]) {
+  /** Average number of rows per batch, not counting oversized batches. */
+  def averageBatchSize: Double = {
+    val counts = batchSizeHistogram.dropRight(1)
+    val numCounted = counts.sum
+    if (numCounted > 0) counts.zipWithIndex.map(c => c._1 * c._2).sum.toDouble / numCounted else 0.0
+  }
+
+  override def toString: String = {
+    f"Requests: $numRequests, rejected: $numRejected, batches: $numBatches, average batch size: " +
+        f"$averageBatchSize%.2f, queue depth: $queueDepth, peak queue depth: $peakQueueDepth"
+  }
+}
+
+private[client] object RequestBatcherStatistics {
+  /** Number of buckets of the queue depth histogram that is returned by the native library. */
+  private[this] val NUM_QUEUE_DEPTH_BUCKETS: Int = 32
+
+  /** Creates a statistics object from the array returned by the native library. */
+  private[client] def fromNative(values: Array[Long]): RequestBatcherStatistics = {
+    RequestBatcherStatistics(
+      numRequests = values(0),
+      numRejected = values(1),
+      numBatches = values(2),
+      queueDepth = values(3),
+      peakQueueDepth = values(4),
+      queueDepthHistogram = values.slice(5, 5 + NUM_QUEUE_DEPTH_BUCKETS).toSeq,
+      batchSizeHistogram = values.drop(5 + NUM_QUEUE_DEPTH_BUCKETS).toSeq)
+  }
+}
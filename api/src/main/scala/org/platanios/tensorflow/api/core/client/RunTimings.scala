@@ -0,0 +1,101 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+/** Breakdown of the time spent in a call to [[Session.run]], obtained using [[Session.lastRunTimings]].
+  *
+  * The native durations are measured using monotonic high-resolution timestamps taken by the native library, and the
+  * JVM durations are measured using `System.nanoTime`. Only differences between timestamps of the same clock are used
+  * and so, the two clocks do not need to be synchronized. All durations are in nanoseconds.
+  *
+  * @param  jvmMarshalIn     Time spent on the JVM preparing the feeds, fetches, and targets of the run.
+  * @param  nativeMarshalIn  Time spent in the native library resolving the arguments of the run, before calling
+  *                          `TF_SessionRun`.
+  * @param  execution        Time spent in `TF_SessionRun`, which includes both queueing in the session and executing
+  *                          the graph.
+  * @param  nativeMarshalOut Time spent in the native library returning the outputs of the run, after `TF_SessionRun`
+  *                          has returned.
+  * @param  jniTransition    Time spent crossing the JNI boundary (i.e., time spent in the native call, excluding the
+  *                          time measured by the native library).
+  * @param  jvmMarshalOut    Time spent on the JVM converting the fetched tensors and releasing the fed ones.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class RunTimings(
+    jvmMarshalIn: Long,
+    nativeMarshalIn: Long,
+    execution: Long,
+    nativeMarshalOut: Long,
+    jniTransition: Long,
+    jvmMarshalOut: Long) {
+  /** Total duration of the run. */
+  def total: Long = jvmMarshalIn + nativeMarshalIn + execution + nativeMarshalOut + jniTransition + jvmMarshalOut
+
+  /** Time spent outside of `TF_SessionRun` (i.e., the non-compute overhead of the run). */
+  def overhead: Long = total - execution
+
+  /** Returns the element-wise sum of these timings and `other`. */
+  def +(other: RunTimings): RunTimings = {
+    RunTimings(
+      jvmMarshalIn + other.jvmMarshalIn,
+      nativeMarshalIn + other.nativeMarshalIn,
+      execution + other.execution,
+      nativeMarshalOut + other.nativeMarshalOut,
+      jniTransition + other.jniTransition,
+      jvmMarshalOut + other.jvmMarshalOut)
+  }
+
+  /** Returns these timings divided by `n` (e.g., to average the sum of the timings of `n` runs). */
+  def /(n: Long): RunTimings = {
+    RunTimings(
+      jvmMarshalIn / n, nativeMarshalIn / n, execution / n, nativeMarshalOut / n, jniTransition / n, jvmMarshalOut / n)
+  }
+
+  /** Returns the durations of this breakdown, along with their names. */
+  def durations: Seq[(String, Long)] = Seq(
+    "JVMMarshalIn" -> jvmMarshalIn,
+    "NativeMarshalIn" -> nativeMarshalIn,
+    "Execution" -> execution,
+    "NativeMarshalOut" -> nativeMarshalOut,
+    "JNITransition" -> jniTransition,
+    "JVMMarshalOut" -> jvmMarshalOut)
+
+  override def toString: String = {
+    def ms(duration: Long): String = f"${duration / 1e6}%.3f ms"
+    s"RunTimings[total = ${ms(total)}, execution = ${ms(execution)}, " +
+        s"JVM marshal in/out = ${ms(jvmMarshalIn)}/${ms(jvmMarshalOut)}, " +
+        s"native marshal in/out = ${ms(nativeMarshalIn)}/${ms(nativeMarshalOut)}, JNI = ${ms(jniTransition)}]"
+  }
+}
+
+object RunTimings {
+  /** Timings with all durations equal to zero. */
+  val zero: RunTimings = RunTimings(0L, 0L, 0L, 0L, 0L, 0L)
+
+  /** Computes the timings of a run from the JVM timestamps taken when entering `Session.run`, before and after the
+    * native call, and after the outputs have been converted, and from the native timestamps. */
+  private[client] def fromTimestamps(
+      jvmStart: Long, jvmNativeCall: Long, jvmNativeReturn: Long, jvmEnd: Long,
+      nativeTimestamps: Array[Long]): RunTimings = {
+    RunTimings(
+      jvmMarshalIn = jvmNativeCall - jvmStart,
+      nativeMarshalIn = nativeTimestamps(1) - nativeTimestamps(0),
+      execution = nativeTimestamps(2) - nativeTimestamps(1),
+      nativeMarshalOut = nativeTimestamps(3) - nativeTimestamps(2),
+      jniTransition = (jvmNativeReturn - jvmNativeCall) - (nativeTimestamps(3) - nativeTimestamps(0)),
+      jvmMarshalOut = jvmEnd - jvmNativeReturn)
+  }
+}
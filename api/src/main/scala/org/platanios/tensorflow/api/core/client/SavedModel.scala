@@ -0,0 +1,124 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.api.core.Graph
+import org.platanios.tensorflow.api.ops.Output
+import org.platanios.tensorflow.api.utilities.Closeable
+import org.platanios.tensorflow.jni.{Session => NativeSession}
+
+import org.tensorflow.framework.{MetaGraphDef, RunOptions, SignatureDef}
+
+import java.nio.file.Path
+
+import scala.collection.JavaConverters._
+
+/** Model loaded from a SavedModel export directory, using [[SavedModel.load]].
+  *
+  * @param  session      Session that contains the graph of the model, with all variables restored.
+  * @param  metaGraphDef Meta-graph definition of the loaded model, without its graph definition (which is already
+  *                      loaded in `session.graph`). It contains the signature definitions of the model, among other
+  *                      things.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class SavedModel private[client](session: Session, metaGraphDef: MetaGraphDef) extends Closeable {
+  /** Graph of the loaded model. */
+  val graph: Graph = session.graph
+
+  /** Signature definitions of the loaded model, keyed by signature name. */
+  val signatures: Map[String, SignatureDef] = metaGraphDef.getSignatureDefMap.asScala.toMap
+
+  /** Returns the signature definition named `name`.
+    *
+    * @throws NoSuchElementException If the loaded model has no signature named `name`.
+    */
+  @throws[NoSuchElementException]
+  def signature(name: String = SavedModel.DEFAULT_SERVING_SIGNATURE): SignatureDef = {
+    signatures.getOrElse(name, throw new NoSuchElementException(
+      s"The loaded model has no signature named '$name'. Available signatures: ${signatures.keys.mkString(", ")}."))
+  }
+
+  /** Returns the outputs of the graph that the inputs of the signature named `name` refer to, keyed by input name. */
+  @throws[NoSuchElementException]
+  def inputs(name: String = SavedModel.DEFAULT_SERVING_SIGNATURE): Map[String, Output] = {
+    signature(name).getInputsMap.asScala.map(i => i._1 -> graph.getOutputByName(i._2.getName)).toMap
+  }
+
+  /** Returns the outputs of the graph that the outputs of the signature named `name` refer to, keyed by output name. */
+  @throws[NoSuchElementException]
+  def outputs(name: String = SavedModel.DEFAULT_SERVING_SIGNATURE): Map[String, Output] = {
+    signature(name).getOutputsMap.asScala.map(o => o._1 -> graph.getOutputByName(o._2.getName)).toMap
+  }
+
+  /** Closes the session and the graph of this model. */
+  override def close(): Unit = {
+    session.close()
+    graph.close()
+  }
+}
+
+/** Contains helper functions for loading SavedModel exports. */
+object SavedModel {
+  /** Tag of the meta-graphs used for serving. */
+  val SERVING_TAG: String = "serve"
+
+  /** Tag of the meta-graphs used for training. */
+  val TRAINING_TAG: String = "train"
+
+  /** Name of the default serving signature. */
+  val DEFAULT_SERVING_SIGNATURE: String = "serving_default"
+
+  /** Loads the meta-graph tagged with `tags` from the SavedModel export stored in `exportDir`.
+    *
+    * The graph is imported and a session is created for it, in a single native call, and the variables of the model are
+    * restored natively by running the restore op of the export, without moving any values through the JVM.
+    *
+    * @param  exportDir     SavedModel export directory.
+    * @param  tags          Tags that identify the meta-graph to load.
+    * @param  sessionConfig Optional configuration for the created session.
+    * @param  runOptions    Optional options for the session run that restores the variables.
+    * @return Loaded model.
+    */
+  def load(
+      exportDir: Path,
+      tags: Set[String] = Set(SERVING_TAG),
+      sessionConfig: Option[SessionConfig] = None,
+      runOptions: Option[RunOptions] = None
+  ): SavedModel = {
+    val graph = Graph()
+    val graphReference = graph.reference
+    val metaGraphDef = new Array[Array[Byte]](1)
+    val nativeHandle = try {
+      NativeSession.loadFromSavedModel(
+        graphReference.nativeHandle,
+        exportDir.toAbsolutePath.toString,
+        tags.toArray,
+        sessionConfig.map(_.configProto.toByteArray).orNull,
+        runOptions.map(_.toByteArray).orNull,
+        sessionConfig.flatMap(_.cpuAffinity).map(_.nativeCPUs).orNull,
+        sessionConfig.flatMap(_.cpuAffinity).map(_.nativeNumaNode).getOrElse(-1),
+        metaGraphDef)
+    } catch {
+      case t: Throwable =>
+        graphReference.close()
+        graph.close()
+        throw t
+    }
+    SavedModel(new Session(graphReference, nativeHandle), MetaGraphDef.parseFrom(metaGraphDef(0)))
+  }
+}
@@ -16,12 +16,16 @@
 package org.platanios.tensorflow.api.core.client
 
 import org.platanios.tensorflow.api.core.Graph
+import org.platanios.tensorflow.api.core.exception.FailedPreconditionException
 import org.platanios.tensorflow.api.ops.{Op, Output}
 import org.platanios.tensorflow.api.tensors.Tensor
 import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
 import org.platanios.tensorflow.jni.{Session => NativeSession, Tensor => NativeTensor}
 
-import org.tensorflow.framework.{RunMetadata, RunOptions}
+import org.tensorflow.framework.{DeviceAttributes, RunMetadata, RunOptions}
+import org.tensorflow.util.SaverDef
+
+import java.nio.file.Path
 
 /** Sessions provide the client interface for interacting with TensorFlow computations.
   *
@@ -41,6 +45,7 @@ class Session private[api](
 
   private[this] object NativeHandleLock
   private[this] var referenceCount: Int = 0
+  @volatile private[this] var isWarmedUp: Boolean = false
 
   // Keep track of references in the Scala side and notify the native library when the session is not referenced
   // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
@@ -117,6 +122,7 @@ class Session private[api](
       feeds: FeedMap = FeedMap.empty, fetches: F = Seq.empty[Output], targets: E = Traversable.empty[Op],
       options: RunOptions = null, wantMetadata: Boolean = false)
       (implicit executable: Executable[E], fetchable: Fetchable.Aux[F, R]): (R, Option[RunMetadata]) = {
+    val jvmStart = System.nanoTime()
     if (nativeHandle == 0)
       throw new IllegalStateException("This session has already been closed.")
     val (inputs, inputTensors) = feeds.values.toSeq.unzip
@@ -128,11 +134,9 @@ class Session private[api](
     val outputOpIndices: Array[Int] = uniqueFetches.map(_.index).toArray
     val outputTensorHandles: Array[Long] = Array.ofDim[Long](uniqueFetches.length)
     val targetOpHandles: Array[Long] = executable.ops(targets).map(_.nativeHandle).toArray
-    NativeHandleLock.synchronized {
-      if (nativeHandle == 0)
-        throw new IllegalStateException("close() has been called on the session.")
-      referenceCount += 1
-    }
+    val nativeTimestamps: Array[Long] = Array.ofDim[Long](NativeSession.NumRunTimestamps)
+    acquire()
+    val jvmNativeCall = System.nanoTime()
     val metadata: Array[Byte] = NativeSession.run(
       handle = nativeHandle,
       runOptions = if (options != null) options.toByteArray else Array.empty[Byte],
@@ -143,23 +147,195 @@ class Session private[api](
       outputOpIndices = outputOpIndices,
       targetOpHandles = targetOpHandles,
       wantRunMetadata = wantMetadata,
-      outputTensorHandles = outputTensorHandles)
+      outputTensorHandles = outputTensorHandles,
+      timings = nativeTimestamps)
+    val jvmNativeReturn = System.nanoTime()
     val outputs: R = resultsBuilder(outputTensorHandles.map(handle => {
       val tensor = Tensor.fromHostNativeHandle(handle)
-      NativeTensor.delete(handle)
+      NativeTensor.deleteDeferred(handle)
       tensor
     }))
-    NativeHandleLock.synchronized {
-      if (nativeHandle != 0) {
-        referenceCount -= 1
-        if (referenceCount == 0)
-          NativeHandleLock.notifyAll()
-      }
-    }
-    inputTensorHandles.foreach(NativeTensor.delete)
+    release()
+    inputTensorHandles.foreach(NativeTensor.deleteDeferred)
+    Session.runTimings.set(RunTimings.fromTimestamps(
+      jvmStart, jvmNativeCall, jvmNativeReturn, System.nanoTime(), nativeTimestamps))
     (outputs, Option(metadata).map(RunMetadata.parseFrom))
   }
 
+  /** Creates a [[Callable]] that runs the same step in this session repeatedly, feeding `feeds`, fetching `fetches`,
+    * and executing `targets`, each time it is called.
+    *
+    * The feeds, fetches, and targets are resolved once, when the callable is created, and so running the callable
+    * avoids most of the per-step overhead of [[run]]. This is useful for serving and training loops that keep running
+    * the same step.
+    *
+    * @param  feeds   Outputs that will be fed when running the callable, in the order in which their values will be
+    *                 provided.
+    * @param  fetches Optional argument specifying which values to fetch from the TensorFlow session. Please refer to
+    *                 the documentation of the [[Fetchable]] type class for details on the allowed types.
+    * @param  targets Optional argument specifying which ops to execute in the TensorFlow graph, without returning their
+    *                 value. Please refer to the documentation of the [[Executable]] type class for details on the
+    *                 allowed types of `targets`.
+    * @param  options Optional [[RunOptions]] protocol buffer to use for all runs of the callable.
+    * @return Created callable.
+    * @throws IllegalStateException If this session has already been closed.
+    */
+  @throws[IllegalStateException]
+  def makeCallable[F, E, R](
+      feeds: Seq[Output] = Seq.empty, fetches: F = Seq.empty[Output], targets: E = Traversable.empty[Op],
+      options: RunOptions = null)
+      (implicit executable: Executable[E], fetchable: Fetchable.Aux[F, R]): Callable[R] = {
+    val (uniqueFetches, resultsBuilder) = Fetchable.process(fetches)(fetchable)
+    acquire()
+    val callableHandle = NativeSession.makeCallable(
+      handle = nativeHandle,
+      runOptions = if (options != null) options.toByteArray else Array.empty[Byte],
+      inputOpHandles = feeds.map(_.op.nativeHandle).toArray,
+      inputOpIndices = feeds.map(_.index).toArray,
+      outputOpHandles = uniqueFetches.map(_.op.nativeHandle).toArray,
+      outputOpIndices = uniqueFetches.map(_.index).toArray,
+      targetOpHandles = executable.ops(targets).map(_.nativeHandle).toArray)
+    release()
+    new Callable[R](this, feeds, uniqueFetches.length, resultsBuilder, callableHandle)
+  }
+
+  /** Sets up a partial run in this session. Partial runs allow feeding `feeds` and fetching `fetches` incrementally,
+    * over multiple calls to [[PartialRun.run]], while keeping the intermediate state of the step in the session. This
+    * avoids recomputing the parts of the graph that earlier calls have already computed.
+    *
+    * @param  feeds   Outputs that may be fed over the partial run.
+    * @param  fetches Outputs that may be fetched over the partial run.
+    * @param  targets Ops to execute over the partial run, without returning their value. Please refer to the
+    *                 documentation of the [[Executable]] type class for details on the allowed types of `targets`.
+    * @return Created partial run, which must be closed once it is no longer needed.
+    * @throws IllegalStateException If this session has already been closed.
+    */
+  @throws[IllegalStateException]
+  def makePartialRun[E](
+      feeds: Seq[Output] = Seq.empty, fetches: Seq[Output] = Seq.empty, targets: E = Traversable.empty[Op])
+      (implicit executable: Executable[E]): PartialRun = {
+    acquire()
+    val partialRunHandle = try {
+      NativeSession.partialRunSetup(
+        handle = nativeHandle,
+        inputOpHandles = feeds.map(_.op.nativeHandle).toArray,
+        inputOpIndices = feeds.map(_.index).toArray,
+        outputOpHandles = fetches.map(_.op.nativeHandle).toArray,
+        outputOpIndices = fetches.map(_.index).toArray,
+        targetOpHandles = executable.ops(targets).map(_.nativeHandle).toArray)
+    } finally {
+      release()
+    }
+    new PartialRun(this, feeds, fetches, partialRunHandle)
+  }
+
+  /** Warms up this session by running each of the provided callables `numRuns` times, after which the session is
+    * marked as warmed up (i.e., [[warmedUp]] returns `true`). Serving replicas can use this to prime the kernels and the
+    * allocators used by their signatures before they start serving real traffic.
+    *
+    * @param  signatures Callables to warm up, along with the values to feed to them. If the values provided for a
+    *                    callable are empty, synthetic values are used. Please refer to the documentation of
+    *                    [[Callable.warmUp]] for details.
+    * @param  numRuns    Number of times to run each callable.
+    * @return Warm-up report for each callable, in the same order as `signatures`.
+    * @throws IllegalArgumentException If the feed values of any callable are invalid.
+    * @throws IllegalStateException    If this session or any of the callables has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def warmUp(signatures: Seq[(Callable[_], Seq[Tensor])], numRuns: Int = 10): Seq[WarmUpReport] = {
+    signatures.foreach(s => {
+      if (s._1.session ne this)
+        throw new IllegalArgumentException("All callables being warmed up must belong to this session.")
+    })
+    val reports = signatures.map(s => s._1.warmUp(numRuns, s._2))
+    isWarmedUp = true
+    reports
+  }
+
+  /** Returns a boolean flag indicating whether this session has been warmed up using [[warmUp]]. */
+  def warmedUp: Boolean = isWarmedUp
+
+  /** Returns the local devices of this session, along with their memory limits and localities, which can be used for
+    * topology-aware device placement.
+    *
+    * @throws IllegalStateException If this session has already been closed.
+    */
+  @throws[IllegalStateException]
+  def listDevices: Seq[LocalDevice] = {
+    acquire()
+    try {
+      NativeSession.listDevices(nativeHandle).map(a => LocalDevice.fromDeviceAttributes(DeviceAttributes.parseFrom(a)))
+    } finally {
+      release()
+    }
+  }
+
+  /** Returns the memory statistics of the allocators used by the local devices of this session (e.g., the CPU and
+    * each GPU), one per allocator.
+    *
+    * @throws IllegalStateException If this session has already been closed.
+    */
+  @throws[IllegalStateException]
+  def allocatorStatistics: Seq[AllocatorStatistics] = {
+    acquire()
+    try {
+      AllocatorStatistics.fromNative(NativeSession.allocatorStatistics(nativeHandle))
+    } finally {
+      release()
+    }
+  }
+
+  /** Restores the variables of this session from the checkpoint with prefix `checkpoint`, using the restore op of the
+    * saver defined by `saverDef`, and then makes sure that the model is ready, all in a single native call. The
+    * tensors of V2 checkpoints are read in parallel, on the native executor, and fed to the assignments of the restore
+    * op. After restoring, `localInitOp` is run if `readyForLocalInitOp` passes, and `readyOp` is evaluated once. This
+    * is what [[org.platanios.tensorflow.api.learn.SessionManager]] uses in order to recover preempted workers quickly.
+    *
+    * @param  saverDef            Saver definition whose restore op is used.
+    * @param  checkpoint          Prefix of the checkpoint to restore.
+    * @param  readyForLocalInitOp Op used to check if the model is ready to execute `localInitOp`.
+    * @param  localInitOp         Op run after restoring, if the model is ready for it.
+    * @param  readyOp             Op used to check if the model is ready.
+    * @return Tuple containing the reason why the model is not ready for local initialization, if it is not, and the
+    *         reason why it is not ready, if it is not. The latter is only checked if the former check passed.
+    * @throws IllegalStateException If this session has already been closed.
+    */
+  @throws[IllegalStateException]
+  private[api] def recover(
+      saverDef: SaverDef, checkpoint: Path, readyForLocalInitOp: Option[Output], localInitOp: Option[Op],
+      readyOp: Option[Output]): (Option[String], Option[String]) = {
+    acquire()
+    try {
+      val messages = NativeSession.recover(
+        nativeHandle, checkpoint.toString, saverDef.getRestoreOpName, saverDef.getFilenameTensorName,
+        readyForLocalInitOp.map(_.name).orNull, localInitOp.map(_.name).orNull, readyOp.map(_.name).orNull)
+      (Option(messages(0)), Option(messages(1)))
+    } finally {
+      release()
+    }
+  }
+
+  /** Marks this session as being in use, so that it cannot be closed until [[release]] is called.
+    *
+    * @throws IllegalStateException If this session has already been closed.
+    */
+  @throws[IllegalStateException]
+  private[client] def acquire(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("close() has been called on the session.")
+    referenceCount += 1
+  }
+
+  /** Releases a use of this session that was previously marked using [[acquire]]. */
+  private[client] def release(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      referenceCount -= 1
+      if (referenceCount == 0)
+        NativeHandleLock.notifyAll()
+    }
+  }
+
   /** Returns a boolean flag indicating whether this session has been closed. */
   def closed: Boolean = nativeHandle == 0
 
@@ -188,6 +364,43 @@ class Session private[api](
 
 /** Contains helper functions for managing [[Session]] instances. */
 object Session {
+  /** Timings of the last successful [[Session.run]] call performed by each thread. */
+  private[client] val runTimings: ThreadLocal[RunTimings] = new ThreadLocal[RunTimings]
+
+  /** Returns the breakdown of the time spent in the last successful call to `Session.run()` (or
+    * `Session.runWithMetadata()`) that was performed by the current thread, in any session, if there is one. This is
+    * useful for finding out how much of the time of a step is spent outside of the graph execution (e.g., marshalling
+    * values over the JNI boundary). */
+  def lastRunTimings(): Option[RunTimings] = Option(runTimings.get())
+
+  /** Registers a named inter-op thread pool with `numThreads` threads, which sessions can then share deliberately, by
+    * including it in their `SessionConfig.sessionInterOpThreadPools` (e.g., as `(Some(name), None)`). All sessions that
+    * use the pool share the same threads, which avoids oversubscribing the machine when many sessions (e.g., of
+    * different models served by the same process) run concurrently. The configurations of these sessions are rewritten
+    * to use the registered size of the pool.
+    *
+    * Pools that are used by sessions without being registered are registered implicitly, with the size requested by
+    * the first session that uses them.
+    *
+    * @param  name       Name of the pool.
+    * @param  numThreads Number of threads of the pool.
+    * @throws IllegalArgumentException     If `name` is empty or `numThreads` is not positive.
+    * @throws FailedPreconditionException If the pool has already been used by a session with a different size, as
+    *                                     pools cannot be resized once created.
+    */
+  @throws[IllegalArgumentException]
+  @throws[FailedPreconditionException]
+  def registerSharedThreadPool(name: String, numThreads: Int): Unit = {
+    require(name.nonEmpty, "The name of a shared thread pool cannot be empty.")
+    require(numThreads > 0, s"The number of threads ($numThreads) must be positive.")
+    NativeSession.registerSharedThreadPool(name, numThreads)
+  }
+
+  /** Returns the usage statistics of all named inter-op thread pools that are shared by sessions. */
+  def sharedThreadPoolStatistics: Seq[SharedThreadPoolStatistics] = {
+    SharedThreadPoolStatistics.fromNative(NativeSession.sharedThreadPoolStatistics())
+  }
+
   def apply(
       graph: Graph = Op.currentGraph,
       target: String = null,
@@ -197,7 +410,9 @@ object Session {
     val nativeHandle = NativeSession.allocate(
       graphReference.nativeHandle,
       target,
-      sessionConfig.map(_.configProto.toByteArray).orNull)
+      sessionConfig.map(_.configProto.toByteArray).orNull,
+      sessionConfig.flatMap(_.cpuAffinity).map(_.nativeCPUs).orNull,
+      sessionConfig.flatMap(_.cpuAffinity).map(_.nativeNumaNode).getOrElse(-1))
     new Session(graphReference, nativeHandle, target)
   }
 }
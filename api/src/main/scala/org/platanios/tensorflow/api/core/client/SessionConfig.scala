@@ -68,6 +68,9 @@ import scala.collection.JavaConverters._
   *                                             thrown if the existing pool was created using a different
   *                                             `threadPoolSize` value, as is specified in this call.
   *                                           - Thread pools created this way are never garbage collected.
+  *                                           - The sizes of global thread pools can be fixed explicitly, and their
+  *                                             usage can be monitored, using [[Session.registerSharedThreadPool]] and
+  *                                             [[Session.sharedThreadPoolStatistics]].
   * @param  allowSoftPlacement                Specified whether soft placement is allowed. If `allowSoftPlacement` is
   *                                           `true`, an op will be placed on the CPU if:
   *                                           1. There's no GPU implementation for the op, or
@@ -105,6 +108,17 @@ import scala.collection.JavaConverters._
   * @param  graphEnableBFloat16SendReceive    If `true`, transfer floating-point values between processes as `BFLOAT16`.
   * @param  graphTimelineSteps                '''EXPERIMENTAL''' If `> 0`, record a timeline every this many steps.
   *                                           Currently, this option has no effect in `MasterSession`.
+  * @param  graphMemoryOptimization           Memory optimization performed by Grappler on the graph (e.g.,
+  *                                           [[SessionConfig.ManualRecomputation]] for the activation recomputation of
+  *                                           the ops marked using `Gradients.recomputed`).
+  * @param  graphMemoryOptimizerTargetNodeNamePrefix Name prefix of the ops that the Grappler memory optimizer treats
+  *                                           as gradient ops, for which it recomputes activations. Defaults to
+  *                                           `"gradients/"`, which matches the gradient ops created natively.
+  * @param  graphLayoutOptimization           If `true`, Grappler converts the convolution-related ops placed on GPUs
+  *                                           (e.g., `conv2D` and the pooling ops) from NHWC to NCHW, which cuDNN runs
+  *                                           faster, inserting transposes only at the boundaries of each converted
+  *                                           chain of ops. Ops placed on CPUs keep using NHWC. The changes can be
+  *                                           previewed using `Graph.layoutOptimizationReport`.
   * @param  gpuAllocationStrategy             Type of GPU allocation strategy to use.
   * @param  gpuAllowMemoryGrowth              If `true`, the GPU allocator does not pre-allocate the entire specified
   *                                           GPU memory region, instead starting small and growing as needed.
@@ -150,6 +164,9 @@ import scala.collection.JavaConverters._
   *                                           client-master communication that avoids the RPC stack. This option is
   *                                           primarily used for testing the RPC stack.
   * @param  clusterConfig                     Cluster configuration that contains all workers to use in the session.
+  * @param  cpuAffinity                       CPU set that the thread pools of the session are pinned to. If provided,
+  *                                           and neither `usePerSessionThreads` nor `sessionInterOpThreadPools` are,
+  *                                           the session uses its own inter-op thread pool, so that it can be pinned.
   *
   * @author Emmanouil Antonios Platanios
   */
@@ -176,7 +193,10 @@ case class SessionConfig(
     graphPlacePruned: Option[Boolean] = None,
     graphEnableBFloat16SendReceive: Option[Boolean] = None,
     graphTimelineSteps: Option[Int] = None,
-    // TODO: [[CONFIG]] Add support for `RewriterConfig`.
+    // TODO: [[CONFIG]] Add support for the remaining `RewriterConfig` options.
+    graphMemoryOptimization: Option[MemoryOptimization] = None,
+    graphMemoryOptimizerTargetNodeNamePrefix: Option[String] = None,
+    graphLayoutOptimization: Option[Boolean] = None,
     gpuAllocationStrategy: Option[GPUAllocationStrategy] = None,
     gpuAllowMemoryGrowth: Option[Boolean] = None,
     gpuPerProcessMemoryFraction: Option[Double] = None,
@@ -186,7 +206,8 @@ case class SessionConfig(
     gpuPollingInactiveDelayMillis: Option[Int] = None,
     gpuForceCompatible: Option[Boolean] = None,
     rpcUseInProcess: Option[Boolean] = None,
-    clusterConfig: Option[ClusterConfig] = None
+    clusterConfig: Option[ClusterConfig] = None,
+    cpuAffinity: Option[CPUAffinity] = None
 ) extends ProtoSerializable {
   val configProto: ConfigProto = {
     val configProto = ConfigProto.newBuilder()
@@ -194,6 +215,8 @@ case class SessionConfig(
     intraOpParallelismThreads.foreach(configProto.setIntraOpParallelismThreads)
     interOpParallelismThreads.foreach(configProto.setInterOpParallelismThreads)
     usePerSessionThreads.foreach(configProto.setUsePerSessionThreads)
+    if (cpuAffinity.exists(!_.isEmpty) && usePerSessionThreads.isEmpty && sessionInterOpThreadPools.isEmpty)
+      configProto.setUsePerSessionThreads(true)
     if (sessionInterOpThreadPools.nonEmpty) {
       sessionInterOpThreadPools.foreach(tp => {
         val threadPoolOptions = ThreadPoolOptionProto.newBuilder()
@@ -219,7 +242,10 @@ case class SessionConfig(
         graphInferShapes.isDefined ||
         graphPlacePruned.isDefined ||
         graphEnableBFloat16SendReceive.isDefined ||
-        graphTimelineSteps.isDefined) {
+        graphTimelineSteps.isDefined ||
+        graphMemoryOptimization.isDefined ||
+        graphMemoryOptimizerTargetNodeNamePrefix.isDefined ||
+        graphLayoutOptimization.isDefined) {
       val graphOptions = GraphOptions.newBuilder()
       if (optLevel.isDefined ||
           optCommonSubExpressionElimination.isDefined ||
@@ -239,6 +265,15 @@ case class SessionConfig(
       graphPlacePruned.foreach(graphOptions.setPlacePrunedGraph)
       graphEnableBFloat16SendReceive.foreach(graphOptions.setEnableBfloat16Sendrecv)
       graphTimelineSteps.foreach(graphOptions.setTimelineStep)
+      if (graphMemoryOptimization.isDefined ||
+          graphMemoryOptimizerTargetNodeNamePrefix.isDefined ||
+          graphLayoutOptimization.isDefined) {
+        val rewriterConfig = RewriterConfig.newBuilder()
+        graphMemoryOptimization.foreach(o => rewriterConfig.setMemoryOptimization(o.memOptType))
+        graphMemoryOptimizerTargetNodeNamePrefix.foreach(rewriterConfig.setMemoryOptimizerTargetNodeNamePrefix)
+        graphLayoutOptimization.foreach(rewriterConfig.setOptimizeTensorLayout)
+        graphOptions.setRewriteOptions(rewriterConfig)
+      }
       configProto.setGraphOptions(graphOptions)
     }
     if (gpuAllowMemoryGrowth.isDefined ||
@@ -299,6 +334,33 @@ object SessionConfig {
     override def level: OptimizerOptions.Level = OptimizerOptions.Level.L1
   }
 
+  /** Memory optimization performed by Grappler on the graph. */
+  sealed trait MemoryOptimization {
+    def memOptType: RewriterConfig.MemOptType
+  }
+
+  /** Default memory optimization, as determined by the TensorFlow native library. */
+  case object DefaultMemoryOptimization extends MemoryOptimization {
+    override def memOptType: RewriterConfig.MemOptType = RewriterConfig.MemOptType.DEFAULT_MEM_OPT
+  }
+
+  /** No memory optimization performed. */
+  case object NoMemoryOptimization extends MemoryOptimization {
+    override def memOptType: RewriterConfig.MemOptType = RewriterConfig.MemOptType.NO_MEM_OPT
+  }
+
+  /** Activation recomputation of the ops that have been manually marked for recomputation (i.e., using
+    * `Gradients.recomputed`). */
+  case object ManualRecomputation extends MemoryOptimization {
+    override def memOptType: RewriterConfig.MemOptType = RewriterConfig.MemOptType.MANUAL
+  }
+
+  /** Activation recomputation of the ops that are automatically selected by Grappler as being cheap to recompute,
+    * along with the ops that have been manually marked for recomputation. */
+  case object HeuristicRecomputation extends MemoryOptimization {
+    override def memOptType: RewriterConfig.MemOptType = RewriterConfig.MemOptType.HEURISTICS
+  }
+
   /** '''EXPERIMENTAL''' Graph JIT compilation level. */
   sealed trait GraphOptimizerGlobalJITLevel {
     def level: OptimizerOptions.GlobalJitLevel
@@ -0,0 +1,68 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.jni.{SharedThreadPoolStatistics => NativeSharedThreadPoolStatistics}
+
+import java.util.concurrent.TimeUnit
+
+import scala.concurrent.duration.Duration
+
+/** Usage statistics of a named inter-op thread pool that is shared by sessions, obtained using
+  * [[Session.sharedThreadPoolStatistics]].
+  *
+  * The step statistics are collected at the granularity of session steps (i.e., runs of sessions and callables) that
+  * are executed on the pool, rather than of individual ops. Dividing `totalStepTime` by the time elapsed between two
+  * snapshots of these statistics gives the average number of steps that were running concurrently on the pool, which,
+  * compared to `numThreads`, indicates whether the pool is over or under subscribed.
+  *
+  * @param  name            Name of the pool.
+  * @param  numThreads      Number of threads of the pool.
+  * @param  numSessions     Number of live sessions that use the pool.
+  * @param  activeSteps     Number of steps currently running on the pool.
+  * @param  peakActiveSteps Maximum number of steps that were running on the pool at the same time.
+  * @param  totalSteps      Number of steps that have completed on the pool.
+  * @param  totalStepTime   Sum of the durations of all steps that have completed on the pool.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class SharedThreadPoolStatistics(
+    name: String,
+    numThreads: Int,
+    numSessions: Int,
+    activeSteps: Long,
+    peakActiveSteps: Long,
+    totalSteps: Long,
+    totalStepTime: Duration) {
+  override def toString: String = {
+    s"SharedThreadPoolStatistics[name = $name, threads = $numThreads, sessions = $numSessions, " +
+        s"active steps = $activeSteps, peak active steps = $peakActiveSteps, steps = $totalSteps, " +
+        s"step time = $totalStepTime]"
+  }
+}
+
+object SharedThreadPoolStatistics {
+  /** Unpacks the shared thread pool statistics returned by the native library. */
+  private[api] def fromNative(statistics: NativeSharedThreadPoolStatistics): Seq[SharedThreadPoolStatistics] = {
+    val n = NativeSharedThreadPoolStatistics.NumValues
+    statistics.names.indices.map(i => {
+      val values = statistics.statistics.slice(i * n, (i + 1) * n)
+      SharedThreadPoolStatistics(
+        statistics.names(i), values(0).toInt, values(1).toInt, values(2), values(3), values(4),
+        Duration(values(5), TimeUnit.MICROSECONDS))
+    })
+  }
+}
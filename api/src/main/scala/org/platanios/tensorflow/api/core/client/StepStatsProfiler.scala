@@ -0,0 +1,129 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{Session => NativeSession}
+
+/** Step-level profiler that aggregates the per-node execution statistics of session steps natively, over many steps.
+  *
+  * Steps are profiled by running callables using [[Callable.runProfiled]]. Only every `samplingPeriod`-th such step is
+  * traced and the run metadata of the traced steps is summarized natively, without ever being handed to the JVM. This
+  * makes it cheap enough to keep profiling enabled with a low sampling rate in production.
+  *
+  * @param  samplingPeriod Number of steps per traced step (e.g., `100` traces one out of every hundred steps).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class StepStatsProfiler private[client](val samplingPeriod: Long, private[this] var nativeHandle: Long)
+    extends Closeable {
+  private[this] object NativeHandleLock
+  private[this] var referenceCount: Int = 0
+
+  // Keep track of references in the Scala side and notify the native library when the profiler is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Returns the number of steps that have been traced and aggregated so far. */
+  def numSteps: Long = withNativeHandle(NativeSession.profilerNumSteps)
+
+  /** Returns a table summarizing the statistics aggregated so far, sorted in descending order of total execution time.
+    *
+    * @param  byNode  If `true`, the table contains one row for each node, along with its op type and device.
+    *                 Otherwise, it contains one row for each op type.
+    * @param  maxRows Maximum number of rows to include in the table. If not positive, all rows are included.
+    * @return Summary table containing the number of calls, the total and mean execution time, the share of the total
+    *         execution time, and the mean and peak allocated memory, for each row.
+    */
+  def summary(byNode: Boolean = false, maxRows: Int = 20): String = {
+    withNativeHandle(NativeSession.profilerSummary(_, byNode, maxRows))
+  }
+
+  /** Returns a table summarizing the XLA clusters executed by the profiled steps so far. Sessions form and compile XLA
+    * clusters when JIT compilation is enabled in their configuration (i.e., using [[SessionConfig.optGlobalJITLevel]]).
+    *
+    * For each cluster, the table contains the number of ops it consists of and the number of times it was executed,
+    * along with its first and mean execution times. XLA compiles a cluster the first time it is executed and caches the
+    * result, and so the compilation time of each cluster is estimated as the difference between its first and its
+    * fastest execution, and its executions after the first are counted as compilation cache hits. Both estimates
+    * assume that the input shapes of the clusters do not change over steps and that the first execution of each cluster
+    * is traced (i.e., that the sampling period is `1` while the clusters are being compiled).
+    */
+  def jitSummary: String = withNativeHandle(NativeSession.profilerJitSummary)
+
+  /** Discards all statistics aggregated so far. */
+  def reset(): Unit = withNativeHandle(NativeSession.resetProfiler)
+
+  /** Calls `fn` with the native handle of this profiler, making sure that it is not deleted while `fn` runs.
+    *
+    * @throws IllegalStateException If this profiler has already been closed.
+    */
+  @throws[IllegalStateException]
+  private[client] def withNativeHandle[T](fn: Long => T): T = {
+    val handle = NativeHandleLock.synchronized {
+      if (nativeHandle == 0)
+        throw new IllegalStateException("This profiler has already been closed.")
+      referenceCount += 1
+      nativeHandle
+    }
+    try {
+      fn(handle)
+    } finally {
+      NativeHandleLock.synchronized {
+        referenceCount -= 1
+        if (referenceCount == 0)
+          NativeHandleLock.notifyAll()
+      }
+    }
+  }
+
+  /** Returns a boolean flag indicating whether this profiler has been closed. */
+  def closed: Boolean = nativeHandle == 0
+
+  /** Closes this profiler and releases any resources associated with it. Note that a profiler is not usable after it
+    * has been closed. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      while (referenceCount > 0) {
+        try {
+          NativeHandleLock.wait()
+        } catch {
+          case _: InterruptedException =>
+            Thread.currentThread().interrupt()
+            return
+        }
+      }
+      NativeSession.deleteProfiler(nativeHandle)
+      nativeHandle = 0
+    }
+  }
+}
+
+object StepStatsProfiler {
+  /** Creates a new step-level profiler.
+    *
+    * @param  samplingPeriod Number of steps per traced step (e.g., `100` traces one out of every hundred steps).
+    * @return Created profiler, which must be closed once it is no longer needed.
+    * @throws IllegalArgumentException If `samplingPeriod` is not positive.
+    */
+  @throws[IllegalArgumentException]
+  def apply(samplingPeriod: Long = 1): StepStatsProfiler = {
+    if (samplingPeriod < 1)
+      throw new IllegalArgumentException(s"The sampling period must be positive, but was $samplingPeriod.")
+    new StepStatsProfiler(samplingPeriod, NativeSession.allocateProfiler(samplingPeriod))
+  }
+}
@@ -0,0 +1,44 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import org.platanios.tensorflow.jni.{Session => NativeSession}
+
+import org.tensorflow.framework.RunMetadata
+
+import java.nio.file.Path
+
+/** Contains helpers for exporting the execution timelines of session steps.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object Timeline {
+  /** Writes the execution timeline contained in `runMetadata` to `file`, in the Chrome trace event format (which can be
+    * viewed using `chrome://tracing`). The timeline is created natively and shows the execution of the ops on each
+    * device and thread, the tensor transfers between devices, and optionally, the memory in use by each allocator.
+    *
+    * Note that `runMetadata` only contains step statistics if the step was run with tracing enabled (i.e., with a
+    * non-zero trace level in its run options). [[Callable.runWithTimeline]] can be used to avoid collecting the run
+    * metadata altogether.
+    *
+    * @param  runMetadata Run metadata collected for a session step.
+    * @param  file        File to write the timeline to. It may use any file system supported by TensorFlow.
+    * @param  showMemory  If `true`, the memory in use by each allocator is also included in the timeline.
+    */
+  def write(runMetadata: RunMetadata, file: Path, showMemory: Boolean = false): Unit = {
+    NativeSession.writeChromeTrace(runMetadata.toByteArray, file.toAbsolutePath.toString, showMemory)
+  }
+}
@@ -0,0 +1,42 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.client
+
+import scala.concurrent.duration.Duration
+
+/** Report of warming up a callable, using [[Callable.warmUp]].
+  *
+  * @param  latencies Latency of each warm-up run, in the order in which the runs were executed.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class WarmUpReport(latencies: Seq[Duration]) {
+  /** Latency of the first (i.e., coldest) run. */
+  def firstLatency: Duration = latencies.headOption.getOrElse(Duration.Zero)
+
+  /** Latency of the last (i.e., warmest) run. */
+  def lastLatency: Duration = latencies.lastOption.getOrElse(Duration.Zero)
+
+  /** Mean latency over all runs. */
+  def meanLatency: Duration = {
+    if (latencies.isEmpty) Duration.Zero else latencies.reduce(_ + _) / latencies.length.toDouble
+  }
+
+  override def toString: String = {
+    s"WarmUpReport[runs = ${latencies.length}, first = ${firstLatency.toMicros} us, " +
+        s"mean = ${meanLatency.toMicros} us, last = ${lastLatency.toMicros} us]"
+  }
+}
@@ -0,0 +1,94 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.distributed
+
+import org.platanios.tensorflow.api.config.{ClusterConfig, JobConfig}
+import org.platanios.tensorflow.api.core.client.SessionConfig
+import org.platanios.tensorflow.api.utilities.Closeable
+
+import java.net.{InetAddress, ServerSocket}
+
+/** Cluster of in-process TensorFlow servers, for testing distributed code and for scaling on a single host.
+  *
+  * All servers of a local cluster run in the current process and listen on loopback ports picked by the operating
+  * system. Sessions created for the targets of these servers talk to their masters directly, without using RPC (unless
+  * `rpcUseInProcess` is set in their configuration), and each worker accesses its own devices directly. Tensors
+  * exchanged between different tasks of a local cluster are still sent over loopback gRPC connections, because the
+  * server implementation of the native library does not expose its worker caches. For single-host multi-GPU data
+  * parallelism it is thus preferable to use a single worker task that owns all GPUs, so that tensors are copied between
+  * devices directly.
+  *
+  * @param  clusterConfig    Configuration of the cluster.
+  * @param  workers          Servers of the `"worker"` job, ordered by task index.
+  * @param  parameterServers Servers of the `"ps"` job, ordered by task index.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class LocalCluster private[distributed] (
+    val clusterConfig: ClusterConfig,
+    val workers: Seq[Server],
+    val parameterServers: Seq[Server]
+) extends Closeable {
+  /** Returns the session targets of the workers of this cluster, ordered by task index. */
+  def workerTargets: Seq[String] = workers.map(_.target)
+
+  /** Stops and closes all servers of this cluster. */
+  override def close(): Unit = (workers ++ parameterServers).foreach(_.close())
+}
+
+/** Contains helper methods for creating [[LocalCluster]]s. */
+object LocalCluster {
+  /** Creates and starts a new in-process cluster, with a `"worker"` job and, optionally, a `"ps"` job.
+    *
+    * @param  numWorkers          Number of worker tasks.
+    * @param  numParameterServers Number of parameter server tasks.
+    * @param  sessionConfig       Default session configuration for all sessions that run on the workers.
+    * @param  protocol            Communication protocol to be used by the servers.
+    * @return Created cluster.
+    */
+  def apply(
+      numWorkers: Int, numParameterServers: Int = 0, sessionConfig: SessionConfig = null,
+      protocol: Protocol = GRPC): LocalCluster = {
+    require(numWorkers > 0, "A local cluster must have at least one worker.")
+    require(numParameterServers >= 0, "The number of parameter servers must be non-negative.")
+    val addresses = pickLoopbackAddresses(numWorkers + numParameterServers)
+    val jobs = Map("worker" -> JobConfig.fromSeq(addresses.take(numWorkers))) ++ {
+      if (numParameterServers > 0) Map("ps" -> JobConfig.fromSeq(addresses.drop(numWorkers))) else Map.empty
+    }
+    val clusterConfig = ClusterConfig(jobs)
+    val servers = collection.mutable.ArrayBuffer.empty[Server]
+    try {
+      (0 until numWorkers).foreach(task => servers += Server(clusterConfig, "worker", task, protocol, sessionConfig))
+      (0 until numParameterServers).foreach(task => servers += Server(clusterConfig, "ps", task, protocol))
+    } catch {
+      case t: Throwable =>
+        servers.foreach(_.close())
+        throw t
+    }
+    new LocalCluster(clusterConfig, servers.take(numWorkers), servers.drop(numWorkers))
+  }
+
+  /** Picks `number` distinct free loopback addresses. The ports are picked by binding sockets to port 0 and are
+    * released right before the servers bind to them. */
+  private[this] def pickLoopbackAddresses(number: Int): Seq[String] = {
+    val sockets = (0 until number).map(_ => new ServerSocket(0, 1, InetAddress.getLoopbackAddress))
+    try {
+      sockets.map(s => s"localhost:${s.getLocalPort}")
+    } finally {
+      sockets.foreach(_.close())
+    }
+  }
+}
@@ -15,15 +15,32 @@
 
 package org.platanios.tensorflow.api.core.distributed
 
+import org.platanios.tensorflow.jni.{Server => NativeServer}
+
 /** Trait used to represented supported communication protocols for [[Server]]s.
   *
   * @author Emmanouil Antonios Platanios
   */
 sealed trait Protocol {
   val name: String
+
+  /** Returns `true` if a server factory for this protocol has been linked into the native library. The gRPC+verbs and
+    * gRPC+MPI factories are only available if the native library was built using the `TENSORFLOW_WITH_VERBS` and
+    * `TENSORFLOW_WITH_MPI` CMake options, respectively, or if the TensorFlow library itself includes them. */
+  def isSupported: Boolean = NativeServer.isProtocolSupported(name)
 }
 
 /** GRPC communication protocol. */
 case object GRPC extends Protocol {
   override val name: String = "grpc"
 }
+
+/** GRPC communication protocol, using RDMA over InfiniBand verbs for transferring tensors. */
+case object GRPC_VERBS extends Protocol {
+  override val name: String = "grpc+verbs"
+}
+
+/** GRPC communication protocol, using MPI for transferring tensors. */
+case object GRPC_MPI extends Protocol {
+  override val name: String = "grpc+mpi"
+}
@@ -16,8 +16,9 @@
 package org.platanios.tensorflow.api.core.distributed
 
 import org.platanios.tensorflow.api.config.ClusterConfig
-import org.platanios.tensorflow.api.core.DeviceSpecification
+import org.platanios.tensorflow.api.core.{DeviceSpecification, Shape}
 import org.platanios.tensorflow.api.ops.OpSpecification
+import org.platanios.tensorflow.api.types.DataType
 
 /** Device placement strategy to use in a replicated training setup.
   *
@@ -66,7 +67,9 @@ object ReplicaDevicePlacer {
     * `psNumTasks` is derived from `clusterConfig`.
     *
     * By default, only variable ops are placed on parameter server tasks and the placement strategy is round-robin over
-    * all parameter server tasks. A custom `psStrategy` may be used to do more intelligent device placement.
+    * all parameter server tasks. A custom `psStrategy` may be used to do more intelligent device placement. For
+    * example, [[GreedyLoadBalancingStrategy]] balances the variable byte sizes (and optionally, their access rates)
+    * across the parameter server tasks, which prevents any single task from becoming a hotspot.
     *
     * For example:
     * {{{
@@ -136,4 +139,69 @@ object ReplicaDevicePlacer {
       task
     }
   }
+
+  /** Device placement strategy which places each parameter server op on the task with the smallest total load so far,
+    * where the load of each op is computed using `loadFunction`.
+    *
+    * The ops are placed as they are being created, and so the placement is greedy in their creation order. Creating
+    * the largest variables first and partitioning very large variables into similarly-sized shards (e.g., using a
+    * [[org.platanios.tensorflow.api.ops.variables.VariableAxisSizePartitioner]]) results in more balanced placements.
+    *
+    * For example:
+    * {{{
+    *   val strategy = ReplicaDevicePlacer.GreedyLoadBalancingStrategy(psNumTasks = 2)
+    *   Op.createWith(deviceFunction = ReplicaDevicePlacer(psNumTasks = 2, psStrategy = strategy.apply).apply) {
+    *     val embeddings = tf.variable("Embeddings", FLOAT32, Shape(1000000, 64))  // Assigned to `/job:ps/task:0`
+    *     val w1 = tf.variable("W1", FLOAT32, Shape(64, 1024))                      // Assigned to `/job:ps/task:1`
+    *     val w2 = tf.variable("W2", FLOAT32, Shape(1024, 1024))                    // Assigned to `/job:ps/task:1`
+    *   }
+    * }}}
+    *
+    * @param  psNumTasks   Number of parameter server tasks to balance the load across.
+    * @param  loadFunction Function that returns the load of a parameter server op (e.g., [[byteSizeLoad]], or
+    *                      [[accessWeightedByteSizeLoad]]).
+    */
+  case class GreedyLoadBalancingStrategy(psNumTasks: Int, loadFunction: OpSpecification => Double = byteSizeLoad) {
+    require(psNumTasks > 0, s"The number of parameter server tasks ($psNumTasks) must be positive.")
+
+    private[this] val taskLoads: Array[Double] = Array.fill(psNumTasks)(0.0)
+
+    /** Current total load of each parameter server task. */
+    def loads: Seq[Double] = taskLoads.synchronized(taskLoads.toSeq)
+
+    def apply(opSpecification: OpSpecification): Int = {
+      val load = loadFunction(opSpecification)
+      taskLoads.synchronized {
+        val task = taskLoads.indices.minBy(taskLoads(_))
+        taskLoads(task) += load
+        task
+      }
+    }
+  }
+
+  /** Returns the size in bytes of the variable created by the provided op, which is obtained from its `"shape"` and
+    * `"dtype"` attributes. Ops that do not have these attributes or that have a partially-known shape are assigned a
+    * load of `0`. Strings are assumed to occupy `16` bytes per element. */
+  def byteSizeLoad(opSpecification: OpSpecification): Double = {
+    (opSpecification.attributes.get("shape"), opSpecification.attributes.get("dtype")) match {
+      case (Some(shape: Shape), Some(dataType: DataType)) if shape.isFullyDefined =>
+        shape.numElements.toDouble * (if (dataType.byteSize > 0) dataType.byteSize else 16)
+      case _ => 0.0
+    }
+  }
+
+  /** Returns a load function that weighs the byte size of each variable (i.e., [[byteSizeLoad]]) by its access rate
+    * (e.g., the measured number of reads and updates per step), so that frequently accessed variables are spread across
+    * the parameter server tasks.
+    *
+    * @param  accessRates Access rates of the variables, keyed by the names of the ops that create them.
+    * @param  defaultRate Access rate used for variables that are not included in `accessRates`.
+    * @return Load function that can be used with [[GreedyLoadBalancingStrategy]].
+    */
+  def accessWeightedByteSizeLoad(
+      accessRates: Map[String, Double],
+      defaultRate: Double = 1.0
+  ): OpSpecification => Double = {
+    opSpecification => byteSizeLoad(opSpecification) * accessRates.getOrElse(opSpecification.name, defaultRate)
+  }
 }
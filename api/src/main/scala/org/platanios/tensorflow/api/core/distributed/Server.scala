@@ -23,7 +23,12 @@ import org.platanios.tensorflow.api.utilities.Proto.{Serializable => ProtoSerial
 import org.platanios.tensorflow.jni.{Server => NativeServer}
 
 import com.google.protobuf.GeneratedMessageV3
-import org.tensorflow.distruntime.ServerDef
+import org.tensorflow.distruntime.{ClusterDef, ServerDef}
+
+import java.util.concurrent.{Executors, ScheduledExecutorService, ThreadFactory, TimeUnit}
+
+import scala.concurrent.duration.Duration
+import scala.util.control.NonFatal
 
 /** In-process TensorFlow server, for use in distributed training.
   *
@@ -45,6 +50,9 @@ class Server private[distributed] (serverDef: ServerDef, startImmediately: Boole
   /** Lock for the native handle. */
   private[this] object NativeHandleLock
 
+  /** Executor used to report metrics periodically, created on first use by [[reportMetrics]]. */
+  private[this] var metricsReporter: ScheduledExecutorService = _
+
   if (startImmediately)
     start()
 
@@ -65,6 +73,116 @@ class Server private[distributed] (serverDef: ServerDef, startImmediately: Boole
   /** Returns the target for a [[Session]] to connect to this server. */
   def target: String = NativeServer.target(nativeHandle)
 
+  /** Returns the current cluster of this server, which is the cluster it was created with, until it is changed using
+    * [[updateCluster]], [[addTask]], or [[removeTask]]. */
+  def clusterConfig: ClusterConfig = withNativeHandle(h => ClusterConfig.fromClusterDef(
+    ClusterDef.parseFrom(NativeServer.cluster(h))))
+
+  /** Returns the version of the cluster membership of this server, which is `0` until its cluster is first changed and
+    * is incremented by every change. Sessions can compare it with the version at the time they were created, in order
+    * to detect that they need to be recreated. */
+  def clusterVersion: Long = withNativeHandle(NativeServer.clusterVersion)
+
+  /** Replaces the cluster of this server by `clusterConfig`, without restarting the server, so that workers can join
+    * and leave the cluster (e.g., when training on preemptible machines that are autoscaled).
+    *
+    * The [[ServerDef]] of a server is fixed, but its master creates a separate set of worker channels for each session
+    * whose configuration specifies a cluster, and it establishes those channels lazily, when they are first used.
+    * Thus, all sessions that are created on the [[target]] of this server after this call use the new cluster (unless
+    * their configuration specifies a different one), while sessions created before it keep using the cluster they
+    * were created with, until they are recreated. The servers of any new workers must be created with a cluster that
+    * includes them.
+    *
+    * @param  clusterConfig New cluster, which must still contain the task of this server, at the same address.
+    * @return New version of the cluster membership of this server.
+    * @throws IllegalArgumentException If `clusterConfig` does not contain the task of this server.
+    * @throws IllegalStateException    If this server has already been closed or detached.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def updateCluster(clusterConfig: ClusterConfig): Long = withNativeHandle(h => {
+    NativeServer.updateCluster(h, clusterConfig.toClusterDef.toByteArray)
+  })
+
+  /** Adds task `task` of job `job`, at `address`, to the cluster of this server, or changes its address, if it is
+    * already part of the cluster. Please refer to the documentation of [[updateCluster]] for details.
+    *
+    * @return New version of the cluster membership of this server.
+    * @throws IllegalArgumentException If the task is the task of this server.
+    * @throws IllegalStateException    If this server has already been closed or detached.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def addTask(job: String, task: Int, address: String): Long = withNativeHandle(h => {
+    NativeServer.addTask(h, job, task, address)
+  })
+
+  /** Removes task `task` of job `job` from the cluster of this server. Please refer to the documentation of
+    * [[updateCluster]] for details.
+    *
+    * @return New version of the cluster membership of this server.
+    * @throws IllegalArgumentException If the task is the task of this server.
+    * @throws IllegalStateException    If this server has already been closed or detached.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def removeTask(job: String, task: Int): Long = withNativeHandle(h => NativeServer.removeTask(h, job, task))
+
+  /** Calls `fn` with the native handle of this server, while holding the native handle lock. */
+  @throws[IllegalStateException]
+  private[this] def withNativeHandle[R](fn: Long => R): R = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("This server has already been closed or detached.")
+    fn(nativeHandle)
+  }
+
+  /** Collects the current values of the runtime metrics whose names start with `prefix` (e.g., `"/tensorflow/"`).
+    *
+    * Note that the metrics are collected from the process-wide native monitoring registry, and so they also include the
+    * metrics of any other servers and sessions running in the same process.
+    *
+    * @param  prefix Prefix of the names of the metrics to collect. All metrics are collected if it is empty.
+    * @return Snapshot of the collected metrics.
+    * @throws IllegalStateException If this server has already been closed.
+    */
+  @throws[IllegalStateException]
+  def metrics(prefix: String = ""): ServerMetrics = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("This server has already been closed.")
+    ServerMetrics.fromNative(NativeServer.collectMetrics(nativeHandle, prefix))
+  }
+
+  /** Collects the runtime metrics whose names start with `prefix` every `interval`, on a background thread, and passes
+    * them to `callback`, until this server is closed. Exceptions thrown by `callback` are ignored.
+    *
+    * @param  interval Interval between consecutive reports.
+    * @param  prefix   Prefix of the names of the metrics to report. All metrics are reported if it is empty.
+    * @param  callback Function to invoke with each metrics snapshot. It should return quickly.
+    */
+  def reportMetrics(interval: Duration, prefix: String = "")(callback: ServerMetrics => Unit): Unit = {
+    require(interval.toMillis > 0, "The metrics reporting interval must be positive.")
+    NativeHandleLock.synchronized {
+      if (metricsReporter == null) {
+        metricsReporter = Executors.newSingleThreadScheduledExecutor(new ThreadFactory {
+          override def newThread(runnable: Runnable): Thread = {
+            val thread = new Thread(runnable, "tensorflow-server-metrics")
+            thread.setDaemon(true)
+            thread
+          }
+        })
+      }
+      metricsReporter.scheduleAtFixedRate(new Runnable {
+        override def run(): Unit = {
+          try {
+            callback(metrics(prefix))
+          } catch {
+            case NonFatal(_) => ()
+          }
+        }
+      }, interval.toMillis, interval.toMillis, TimeUnit.MILLISECONDS)
+    }
+  }
+
   /** Constructs and returns a [[ServerDef]] object that represents this session.
     *
     * @return Constructed [[ServerDef]].
@@ -77,10 +195,38 @@ class Server private[distributed] (serverDef: ServerDef, startImmediately: Boole
     */
   override def toProto: GeneratedMessageV3 = toServerDef
 
+  /** Detaches this [[Server]] from the native server, without stopping it, so that it can be reused later in the same
+    * process without losing the state of its devices (e.g., variables, queues, and tables), and without having to
+    * restore it from a checkpoint.
+    *
+    * The native server keeps serving requests (e.g., from other workers) after being detached, and the next [[Server]]
+    * that is created in this process with an identical configuration reattaches to it, instead of creating a new
+    * server. Note that this [[Server]] is not usable after it has been detached, and that closing it afterwards does
+    * not affect the native server. Sessions created in this process finish their in-flight runs before they are
+    * closed, and so closing them before detaching the server drains them.
+    *
+    * @throws IllegalStateException If this server has already been closed or detached.
+    */
+  @throws[IllegalStateException]
+  def detach(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("This server has already been closed or detached.")
+    if (metricsReporter != null) {
+      metricsReporter.shutdownNow()
+      metricsReporter = null
+    }
+    NativeServer.detachServer(nativeHandle)
+    nativeHandle = 0
+  }
+
   /** Closes this [[Server]] and releases any resources associated with it. Note that an [[Server]] is not
     * usable after it has been closed. */
   override def close(): Unit = {
     NativeHandleLock.synchronized {
+      if (metricsReporter != null) {
+        metricsReporter.shutdownNow()
+        metricsReporter = null
+      }
       if (nativeHandle != 0) {
         NativeServer.deleteServer(nativeHandle)
         nativeHandle = 0
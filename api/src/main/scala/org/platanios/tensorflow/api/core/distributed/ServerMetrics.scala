@@ -0,0 +1,81 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.core.distributed
+
+import org.platanios.tensorflow.jni.{CollectedMetrics => NativeCollectedMetrics}
+
+import org.tensorflow.framework.HistogramProto
+
+/** Snapshot of the runtime metrics of a [[Server]], obtained using [[Server.metrics]].
+  *
+  * The metrics are collected from the native monitoring registry, which is shared by the whole process. They thus
+  * include the metrics that the server runtime registers, along with those of any sessions running in the same process.
+  *
+  * @param  points Collected metric points.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class ServerMetrics(points: Seq[ServerMetrics.Point]) {
+  /** Returns the names of all collected metrics. */
+  def names: Set[String] = points.map(_.name).toSet
+
+  /** Returns the points of the metric named `name`. */
+  def apply(name: String): Seq[ServerMetrics.Point] = points.filter(_.name == name)
+
+  /** Returns the sum of the integer values of all points of the metric named `name` (e.g., the total count of a counter
+    * over all of its label values). */
+  def total(name: String): Long = apply(name).flatMap(_.int64Value).sum
+
+  override def toString: String = points.mkString("ServerMetrics[\n  ", "\n  ", "\n]")
+}
+
+object ServerMetrics {
+  /** Value of a metric for specific label values.
+    *
+    * @param  name       Name of the metric.
+    * @param  labels     Label values of this point.
+    * @param  int64Value Value of this point, for integer-valued metrics (e.g., counters).
+    * @param  histogram  Value of this point, for histogram-valued metrics (e.g., latency distributions).
+    * @param  timestamp  Time at which this point was last updated, in milliseconds since the epoch.
+    */
+  case class Point(
+      name: String,
+      labels: Map[String, String],
+      int64Value: Option[Long],
+      histogram: Option[HistogramProto],
+      timestamp: Long) {
+    override def toString: String = {
+      val labelsString = if (labels.isEmpty) "" else labels.map(l => s"${l._1}=${l._2}").mkString("{", ",", "}")
+      val valueString = int64Value.map(_.toString).getOrElse(histogram.map(h =>
+        s"histogram[count = ${h.getNum}, sum = ${h.getSum}, min = ${h.getMin}, max = ${h.getMax}]").getOrElse(""))
+      s"$name$labelsString = $valueString"
+    }
+  }
+
+  /** Unpacks the metrics returned by the native library. */
+  private[api] def fromNative(metrics: NativeCollectedMetrics): ServerMetrics = {
+    ServerMetrics(metrics.names.indices.map(i => {
+      val labels = metrics.labels(i).split(',').filter(_.nonEmpty).map(l => {
+        val parts = l.split("=", 2)
+        parts(0) -> (if (parts.length > 1) parts(1) else "")
+      }).toMap
+      val histogram = Option(metrics.histograms(i)).map(HistogramProto.parseFrom)
+      Point(
+        metrics.names(i), labels, if (histogram.isEmpty) Some(metrics.int64Values(i)) else None, histogram,
+        metrics.timestamps(i))
+    }))
+  }
+}
@@ -0,0 +1,124 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{ArrowReader => NativeReader}
+
+import java.nio.file.Path
+
+/** Reader for Arrow IPC files (i.e., Feather V2 files) that memory-maps the file and decodes the requested columns
+  * natively and directly into tensors, one per column and record batch, without materializing individual rows.
+  *
+  * Only the column chunks of the columns in `columns` and of the columns referenced by `predicates` are ever read. If
+  * there are no predicates, fixed-width columns without null values are returned without being copied, as tensors over
+  * the mapped file, whenever that is suitably aligned. Otherwise, the predicates are evaluated first and only the rows
+  * that satisfy all of them are decoded, for all other columns, and record batches with no such rows are skipped.
+  *
+  * Supported column types are signed integers, 8-bit and 16-bit unsigned integers, floating-point numbers, booleans,
+  * and UTF-8 strings and binary values, which are decoded as `STRING` tensors. Null values are decoded as zeros or
+  * empty strings. Compressed and dictionary-encoded columns are not supported. Parquet files can be converted to this
+  * format without loss (e.g., using `pyarrow.feather.write_feather(table, path, compression = "uncompressed")`).
+  *
+  * @param  filePath   Path to the file being read.
+  * @param  columns    Names of the columns to decode.
+  * @param  predicates Predicates that the returned rows must satisfy.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class ArrowReader(
+    val filePath: Path,
+    val columns: Seq[String],
+    val predicates: Seq[ArrowReader.Range] = Seq.empty
+) extends Closeable with Loader[Seq[Tensor]] {
+  private[this] var nativeHandle: Long = {
+    NativeReader.newArrowReader(
+      filePath.toAbsolutePath.toString, columns.toArray, predicates.map(_.column).toArray,
+      predicates.map(_.min).toArray, predicates.map(_.max).toArray)
+  }
+
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the reader is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Data types of the decoded columns, in the same order as `columns`. */
+  val dataTypes: Seq[DataType] = NativeHandleLock.synchronized {
+    NativeReader.arrowReaderDataTypes(nativeHandle).map(DataType.fromCValue).toSeq
+  }
+
+  /** Number of record batches in the file. */
+  val numRecordBatches: Long = NativeHandleLock.synchronized {
+    NativeReader.arrowReaderNumRecordBatches(nativeHandle)
+  }
+
+  /** Returns the total number of rows in the file, before any predicates are applied. */
+  def numRows: Long = NativeHandleLock.synchronized {
+    NativeReader.arrowReaderNumRows(nativeHandle)
+  }
+
+  /** Returns the decoded columns of the rows of the `index`-th record batch that satisfy all predicates, or `None` if
+    * no rows satisfy them. */
+  def recordBatch(index: Long): Option[Seq[Tensor]] = {
+    require(index >= 0 && index < numRecordBatches, s"Record batch index $index is out of range.")
+    NativeHandleLock.synchronized {
+      Option(NativeReader.arrowReaderReadRecordBatch(nativeHandle, index))
+    }.map(_.map(Tensor.fromNativeHandle).toSeq)
+  }
+
+  /** Returns an iterator over the decoded columns of all record batches with rows that satisfy all predicates. */
+  override def load(): Iterator[Seq[Tensor]] = load(shardIndex = 0, numShards = 1)
+
+  /** Returns an iterator over the decoded columns of the record batches with rows that satisfy all predicates, among
+    * those whose index modulo `numShards` is equal to `shardIndex`. This allows splitting a file across workers. */
+  def load(shardIndex: Int, numShards: Int): Iterator[Seq[Tensor]] = {
+    require(numShards > 0, s"'numShards' (= $numShards) must be positive.")
+    require(shardIndex >= 0 && shardIndex < numShards, s"'shardIndex' (= $shardIndex) must be in [0, $numShards).")
+    (shardIndex.toLong until numRecordBatches by numShards.toLong).iterator.flatMap(index => recordBatch(index))
+  }
+
+  /** Closes this reader and unmaps the file. Note that the reader is not usable after it has been closed, but the
+    * tensors it returned remain valid. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        NativeReader.deleteArrowReader(nativeHandle)
+        nativeHandle = 0
+      }
+    }
+  }
+}
+
+object ArrowReader {
+  /** Predicate that keeps the rows whose values in the numeric column named `column` lie within `[min, max]`. Rows with
+    * null values in that column are dropped. */
+  case class Range(column: String, min: Double = Double.NegativeInfinity, max: Double = Double.PositiveInfinity)
+
+  /** Creates a new Arrow reader.
+    *
+    * @param  filePath   Path to the file being read.
+    * @param  columns    Names of the columns to decode.
+    * @param  predicates Predicates that the returned rows must satisfy.
+    * @return Newly constructed Arrow reader.
+    */
+  def apply(filePath: Path, columns: Seq[String], predicates: Seq[Range] = Seq.empty): ArrowReader = {
+    new ArrowReader(filePath, columns, predicates)
+  }
+}
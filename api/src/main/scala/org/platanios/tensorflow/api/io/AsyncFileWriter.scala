@@ -0,0 +1,118 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{FileIO => NativeFileIO}
+
+import java.nio.ByteBuffer
+import java.nio.charset.StandardCharsets
+import java.nio.file.Path
+
+/** File writer that coalesces many small appends into large writes, performed on a native background thread.
+  *
+  * Appends only copy the provided data into a native buffer and return, unless several buffers are already waiting to
+  * be written. This makes it well suited for writing many small records (e.g., lines of text). `flush()` and `sync()`
+  * act as barriers: they wait until all previously appended data has been written. The first error that occurs while
+  * writing in the background is reported by all subsequent calls.
+  *
+  * @param  filePath   Path to the file being written.
+  * @param  append     If `true`, data is appended to the file, if it already exists. Otherwise, the file is truncated.
+  * @param  bufferSize Size (in bytes) of the buffers into which appends are coalesced.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class AsyncFileWriter(
+    val filePath: Path,
+    val append: Boolean = false,
+    val bufferSize: Long = 1024L * 1024L
+) extends Closeable {
+  private[this] var nativeHandle: Long = {
+    NativeFileIO.newAsyncWritableFile(filePath.toAbsolutePath.toString, append, bufferSize)
+  }
+
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the writer is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Appends `content`, encoded using UTF-8, to the file. */
+  def write(content: String): AsyncFileWriter = {
+    write(content.getBytes(StandardCharsets.UTF_8))
+  }
+
+  /** Appends `length` bytes of `content`, starting at `offset`, to the file. */
+  def write(content: Array[Byte], offset: Int, length: Int): AsyncFileWriter = NativeHandleLock.synchronized {
+    NativeFileIO.asyncWritableFileAppendBytes(nativeHandle, content, offset, length)
+    this
+  }
+
+  /** Appends `content` to the file. */
+  def write(content: Array[Byte]): AsyncFileWriter = {
+    write(content, 0, content.length)
+  }
+
+  /** Appends the remaining bytes of `buffer`, which must be a direct buffer, to the file. The position of `buffer` is
+    * advanced to its limit. */
+  def write(buffer: ByteBuffer): AsyncFileWriter = NativeHandleLock.synchronized {
+    NativeFileIO.asyncWritableFileAppendBuffer(nativeHandle, buffer, buffer.position(), buffer.remaining())
+    buffer.position(buffer.limit())
+    this
+  }
+
+  /** Waits until all appended data has been written and then flushes the file. */
+  def flush(): AsyncFileWriter = NativeHandleLock.synchronized {
+    NativeFileIO.asyncWritableFileFlush(nativeHandle)
+    this
+  }
+
+  /** Waits until all appended data has been written and then syncs the file to persistent storage. */
+  def sync(): AsyncFileWriter = NativeHandleLock.synchronized {
+    NativeFileIO.asyncWritableFileSync(nativeHandle)
+    this
+  }
+
+  /** Waits until all appended data has been written, closes the file, and releases any resources associated with this
+    * writer, including its background thread. Note that a writer is not usable after it has been closed. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        try {
+          NativeFileIO.asyncWritableFileClose(nativeHandle)
+        } finally {
+          NativeFileIO.deleteAsyncWritableFile(nativeHandle)
+          nativeHandle = 0
+        }
+      }
+    }
+  }
+}
+
+object AsyncFileWriter {
+  /** Creates a new asynchronous file writer.
+    *
+    * @param  filePath   Path to the file being written.
+    * @param  append     If `true`, data is appended to the file, if it already exists. Otherwise, the file is
+    *                    truncated.
+    * @param  bufferSize Size (in bytes) of the buffers into which appends are coalesced.
+    * @return Newly constructed asynchronous file writer.
+    */
+  def apply(filePath: Path, append: Boolean = false, bufferSize: Long = 1024L * 1024L): AsyncFileWriter = {
+    new AsyncFileWriter(filePath, append, bufferSize)
+  }
+}
@@ -0,0 +1,146 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.types.{DataType, FLOAT32, FLOAT64, INT32, INT64, STRING}
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{CSVReader => NativeReader}
+
+import java.nio.file.Path
+
+/** Reader for delimiter-separated text files (e.g., CSV or TSV files) that parses the requested columns natively and
+  * directly into batch tensors, without first splitting the file into lines.
+  *
+  * The file is read in large blocks, which are scanned for delimiters and newlines using SIMD instructions, when those
+  * are available. Only the columns in `columns` are decoded, and each batch returned by [[load]] contains one rank-1
+  * tensor per such column, in the same order, holding the values of up to `batchSize` consecutive records. Fields may
+  * be enclosed in double quotes, if `useQuotes` is `true`, in which case they may contain delimiters, newlines, and
+  * escaped (i.e., doubled) double quotes. Empty lines are skipped.
+  *
+  * @param  filePath        Path to the file being read.
+  * @param  columns         Columns to decode.
+  * @param  delimiter       Field delimiter, which must be an ASCII character.
+  * @param  useQuotes       If `true`, fields may be enclosed in double quotes.
+  * @param  skipHeaderLines Number of lines to skip at the beginning of the file.
+  * @param  batchSize       Maximum number of records in each returned batch.
+  * @param  blockSize       Number of bytes read from the file at a time.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class CSVReader(
+    val filePath: Path,
+    val columns: Seq[CSVReader.Column],
+    val delimiter: Char = ',',
+    val useQuotes: Boolean = true,
+    val skipHeaderLines: Int = 0,
+    val batchSize: Int = 1024,
+    val blockSize: Int = 1024 * 1024
+) extends Closeable with Loader[Seq[Tensor]] {
+  require(delimiter < 128, s"The delimiter ('$delimiter') must be an ASCII character.")
+  require(batchSize > 0, s"'batchSize' (= $batchSize) must be positive.")
+  require(blockSize > 0, s"'blockSize' (= $blockSize) must be positive.")
+
+  private[this] var nativeHandle: Long = {
+    NativeReader.newCSVReader(
+      filePath.toAbsolutePath.toString, delimiter.toByte, useQuotes, skipHeaderLines, columns.map(_.index).toArray,
+      columns.map(_.dataType.cValue).toArray, columns.map(_.default.orNull).toArray, blockSize)
+  }
+
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the reader is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Returns an iterator over batches of the records stored in the file, starting from the current position of this
+    * reader. The iterator ends when the end of the file is reached. */
+  override def load(): Iterator[Seq[Tensor]] = new Iterator[Seq[Tensor]] {
+    private[this] var nextBatch: Option[Seq[Tensor]] = None
+    private[this] var exhausted: Boolean = false
+
+    override def hasNext: Boolean = {
+      if (nextBatch.isEmpty && !exhausted) {
+        NativeHandleLock.synchronized {
+          Option(NativeReader.csvReaderNextBatch(nativeHandle, batchSize)) match {
+            case Some(tensorHandles) => nextBatch = Some(tensorHandles.map(Tensor.fromNativeHandle).toSeq)
+            case None => exhausted = true
+          }
+        }
+      }
+      nextBatch.isDefined
+    }
+
+    override def next(): Seq[Tensor] = {
+      if (!hasNext)
+        throw new NoSuchElementException(s"No more records stored at '${filePath.toAbsolutePath}'.")
+      val batch = nextBatch.get
+      nextBatch = None
+      batch
+    }
+  }
+
+  /** Returns the number of lines consumed so far, including any header lines. */
+  def lineNumber: Long = NativeHandleLock.synchronized {
+    NativeReader.csvReaderLineNumber(nativeHandle)
+  }
+
+  /** Closes this reader and releases any resources associated with it. Note that the reader is not usable after it has
+    * been closed. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        NativeReader.deleteCSVReader(nativeHandle)
+        nativeHandle = 0
+      }
+    }
+  }
+}
+
+object CSVReader {
+  /** Column of a delimiter-separated text file to decode.
+    *
+    * @param  index    Index of the column in the file.
+    * @param  dataType Data type into which the column is decoded. Must be one of `INT32`, `INT64`, `FLOAT32`,
+    *                  `FLOAT64`, or `STRING`.
+    * @param  default  Value used for empty fields, encoded as text. If `None`, empty fields are errors, except for
+    *                  `STRING` columns, for which they are decoded as empty strings.
+    */
+  case class Column(index: Int, dataType: DataType, default: Option[String] = None) {
+    require(index >= 0, s"The column index (= $index) must be non-negative.")
+    require(
+      Set[DataType](INT32, INT64, FLOAT32, FLOAT64, STRING).contains(dataType),
+      s"Unsupported data type '$dataType' for column $index.")
+  }
+
+  /** Creates a new CSV reader.
+    *
+    * @param  filePath        Path to the file being read.
+    * @param  columns         Columns to decode.
+    * @param  delimiter       Field delimiter, which must be an ASCII character.
+    * @param  useQuotes       If `true`, fields may be enclosed in double quotes.
+    * @param  skipHeaderLines Number of lines to skip at the beginning of the file.
+    * @param  batchSize       Maximum number of records in each returned batch.
+    * @param  blockSize       Number of bytes read from the file at a time.
+    * @return Newly constructed CSV reader.
+    */
+  def apply(
+      filePath: Path, columns: Seq[Column], delimiter: Char = ',', useQuotes: Boolean = true, skipHeaderLines: Int = 0,
+      batchSize: Int = 1024, blockSize: Int = 1024 * 1024): CSVReader = {
+    new CSVReader(filePath, columns, delimiter, useQuotes, skipHeaderLines, batchSize, blockSize)
+  }
+}
@@ -15,23 +15,33 @@
 
 package org.platanios.tensorflow.api.io
 
+import org.platanios.tensorflow.api.core.Shape
 import org.platanios.tensorflow.api.core.exception.UnavailableException
 import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.types.DataType
 import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
 import org.platanios.tensorflow.jni.{CheckpointReader => NativeCheckpointReader}
 
+import java.nio.ByteBuffer
 import java.nio.file.Path
 
 /** Helper class for reading checkpoint files.
   *
   * This class currently only interacts with single-slice (i.e., non-partitioned) variables.
   *
-  * @param  nativeHandle Handle to a native checkpoint reader object.
+  * Delta checkpoints (i.e., checkpoints written by savers using an `IncrementalSaverDefBuilder`) are transparently
+  * merged with their base checkpoints. The tensors that were saved as deltas are read from the base checkpoint and
+  * their changed rows are then overwritten with the ones stored in the delta checkpoint.
+  *
+  * @param  nativeHandle  Handle to a native checkpoint reader object.
+  * @param  memoryMapping Memory mapping mode used when reading tensors.
   *
   * @author Emmanouil Antonios Platanios
   */
-class CheckpointReader private[CheckpointReader] (private[CheckpointReader] var nativeHandle: Long)
-    extends Closeable {
+class CheckpointReader private[CheckpointReader] (
+    private[CheckpointReader] var nativeHandle: Long,
+    val memoryMapping: CheckpointReader.MemoryMapping
+) extends Closeable {
   /** Lock for the native handle. */
   private[this] object NativeHandleLock
 
@@ -40,6 +50,33 @@ class CheckpointReader private[CheckpointReader] (private[CheckpointReader] var
   // potential memory leak.
   Disposer.add(this, () => this.close())
 
+  /** Names, shapes, and data types of all variables stored in the checkpoint file, loaded once using a single native
+    * call. */
+  private[this] lazy val variables: Seq[(String, Shape, DataType)] = {
+    if (nativeHandle == 0)
+      throw UnavailableException("This checkpoint reader has already been disposed.")
+    val packed = NativeCheckpointReader.variables(nativeHandle)
+    packed.names.indices.map(i => {
+      val shape = Shape.fromSeq(
+        packed.shapes.slice(packed.shapeOffsets(i), packed.shapeOffsets(i + 1)).map(_.toInt))
+      (packed.names(i), shape, DataType.fromCValue(packed.dataTypes(i)))
+    })
+  }
+
+  /** Returns a map from the names of all variables stored in the checkpoint file to their shapes.
+    *
+    * @throws UnavailableException If this checkpoint reader object has already been disposed.
+    */
+  @throws[UnavailableException]
+  def variableShapes: Map[String, Shape] = variables.map(v => v._1 -> v._2).toMap
+
+  /** Returns a map from the names of all variables stored in the checkpoint file to their data types.
+    *
+    * @throws UnavailableException If this checkpoint reader object has already been disposed.
+    */
+  @throws[UnavailableException]
+  def variableDataTypes: Map[String, DataType] = variables.map(v => v._1 -> v._3).toMap
+
   /** Checks if the checkpoint file contains a tensor named `name`.
     *
     * @param  name Tensor name.
@@ -64,7 +101,77 @@ class CheckpointReader private[CheckpointReader] (private[CheckpointReader] var
   def getTensor(name: String): Option[Tensor] = {
     if (nativeHandle == 0)
       throw UnavailableException("This checkpoint reader has already been disposed.")
-    Option(NativeCheckpointReader.getTensor(nativeHandle, name)).map(Tensor.fromNativeHandle)
+    val tensorHandle = memoryMapping match {
+      case CheckpointReader.NoMemoryMapping => NativeCheckpointReader.getTensor(nativeHandle, name)
+      case CheckpointReader.ReadOnlyMemoryMapping => NativeCheckpointReader.getMappedTensor(nativeHandle, name, false)
+      case CheckpointReader.CopyOnWriteMemoryMapping => NativeCheckpointReader.getMappedTensor(nativeHandle, name, true)
+    }
+    Option(tensorHandle).map(Tensor.fromNativeHandle)
+  }
+
+  /** Looks up the tensors named `names` in the checkpoint file and returns them, in the same order. For V2 checkpoints,
+    * the tensors are read concurrently, in the order in which they are stored in the checkpoint data files, which is
+    * much faster than calling [[getTensor]] for each tensor when the checkpoint is stored on a remote file system. When
+    * memory mapping is enabled, the tensors are instead mapped one at a time, which requires no reads.
+    *
+    * @param  names            Tensor names.
+    * @param  parallelism      Number of tensors to read concurrently.
+    * @param  maxBytesInFlight Maximum total size (in bytes) of the tensors being read concurrently. A single tensor is
+    *                          always allowed to be read, regardless of its size.
+    * @return Tensors found in the checkpoint file.
+    * @throws UnavailableException If this checkpoint reader object has already been disposed.
+    */
+  @throws[UnavailableException]
+  def getTensors(
+      names: Seq[String], parallelism: Int = 16, maxBytesInFlight: Long = 1L << 30): Seq[Tensor] = {
+    if (nativeHandle == 0)
+      throw UnavailableException("This checkpoint reader has already been disposed.")
+    if (memoryMapping != CheckpointReader.NoMemoryMapping) {
+      names.map(name => getTensor(name).get)
+    } else {
+      NativeCheckpointReader.getTensors(nativeHandle, names.toArray, parallelism, maxBytesInFlight)
+          .map(Tensor.fromNativeHandle)
+    }
+  }
+
+  /** Reads only a slice of the tensor named `name` from the checkpoint file. Only the slice is allocated and read,
+    * which makes this well suited for loading a few rows or a partition of a large tensor (e.g., an embedding table).
+    * The stored slices of partitioned tensors are combined as necessary.
+    *
+    * @param  name  Tensor name.
+    * @param  begin Start index of the slice, along each dimension.
+    * @param  size  Size of the slice, along each dimension. A size of `-1` denotes all remaining elements of the
+    *               corresponding dimension.
+    * @return Tensor containing the slice.
+    * @throws UnavailableException If this checkpoint reader object has already been disposed.
+    */
+  @throws[UnavailableException]
+  def getTensorSlice(name: String, begin: Seq[Long], size: Seq[Long]): Tensor = {
+    if (nativeHandle == 0)
+      throw UnavailableException("This checkpoint reader has already been disposed.")
+    Tensor.fromNativeHandle(NativeCheckpointReader.getTensorSlice(nativeHandle, name, begin.toArray, size.toArray))
+  }
+
+  /** Reads only a slice of the tensor named `name` from the checkpoint file directly into `buffer`, in row-major
+    * order, without allocating a tensor for it. `buffer` must be a direct buffer, and its position is advanced by the
+    * number of bytes written. String tensors are not supported.
+    *
+    * @param  name   Tensor name.
+    * @param  begin  Start index of the slice, along each dimension.
+    * @param  size   Size of the slice, along each dimension. A size of `-1` denotes all remaining elements of the
+    *                corresponding dimension.
+    * @param  buffer Direct buffer into which to read the slice.
+    * @return Number of bytes written to `buffer`.
+    * @throws UnavailableException If this checkpoint reader object has already been disposed.
+    */
+  @throws[UnavailableException]
+  def getTensorSliceInto(name: String, begin: Seq[Long], size: Seq[Long], buffer: ByteBuffer): Long = {
+    if (nativeHandle == 0)
+      throw UnavailableException("This checkpoint reader has already been disposed.")
+    val numBytes = NativeCheckpointReader.getTensorSliceInto(
+      nativeHandle, name, begin.toArray, size.toArray, buffer, buffer.position())
+    buffer.position(buffer.position() + numBytes.toInt)
+    numBytes
   }
 
   /** Closes this [[CheckpointReader]] and releases any resources associated with it. Note that a [[CheckpointReader]]
@@ -80,12 +187,46 @@ class CheckpointReader private[CheckpointReader] (private[CheckpointReader] var
 }
 
 object CheckpointReader {
+  /** Memory mapping mode of a [[CheckpointReader]].
+    *
+    * When memory mapping is enabled, tensors read from V2 checkpoints that are stored on the local file system alias a
+    * memory mapping of the checkpoint data files, instead of being copied into newly allocated memory. The mapped pages
+    * are backed by the page cache and are thus shared by all processes that load the same checkpoint, which makes this
+    * well suited for read-only serving replicas. Note that the data of mapped tensors is not checksummed, and that
+    * tensors that cannot be mapped (e.g., string tensors, partitioned tensors, or tensors that are not suitably aligned
+    * in the data files) are read as usual.
+    */
+  sealed trait MemoryMapping
+
+  /** Tensors are read into newly allocated memory. */
+  case object NoMemoryMapping extends MemoryMapping
+
+  /** Tensors alias a read-only mapping. Writing to them (e.g., using in-place ops) crashes the process. */
+  case object ReadOnlyMemoryMapping extends MemoryMapping
+
+  /** Tensors alias a private mapping, whose pages are only copied when written to. */
+  case object CopyOnWriteMemoryMapping extends MemoryMapping
+
   /** Creates a new [[CheckpointReader]] for the checkpoint file pointed to by `checkpointPath`.
     *
     * @param  checkpointPath Path to a checkpoint file.
+    * @param  memoryMapping  Memory mapping mode used when reading tensors.
     * @return Constructed checkpoint reader.
     */
-  def apply(checkpointPath: Path): CheckpointReader = {
-    new CheckpointReader(NativeCheckpointReader.newCheckpointReader(checkpointPath.toAbsolutePath.toString))
+  def apply(checkpointPath: Path, memoryMapping: MemoryMapping = NoMemoryMapping): CheckpointReader = {
+    new CheckpointReader(
+      NativeCheckpointReader.newCheckpointReader(checkpointPath.toAbsolutePath.toString), memoryMapping)
+  }
+
+  /** Returns the path of the base checkpoint of the checkpoint pointed to by `checkpointPath`, if it is a delta
+    * checkpoint (i.e., a checkpoint written by a saver using an `IncrementalSaverDefBuilder`), and `None` otherwise.
+    * Only the index file of the checkpoint is read.
+    *
+    * @param  checkpointPath Path to a V2 checkpoint.
+    * @return Path of the base checkpoint, if `checkpointPath` points to a delta checkpoint.
+    */
+  def deltaBase(checkpointPath: Path): Option[Path] = {
+    Option(NativeCheckpointReader.deltaBase(checkpointPath.toAbsolutePath.toString))
+        .map(checkpointPath.getFileSystem.getPath(_))
   }
 }
@@ -36,3 +36,21 @@ case object ZLIBCompression extends CompressionType {
 case object GZIPCompression extends CompressionType {
   override val name: String = "GZIP"
 }
+
+/** ZSTD compression, which is only supported by the native record readers and writers of this package (e.g.,
+  * [[TFRecordReader]], [[InterleavedTFRecordReader]], and [[TFRecordWriter]]), and not by the TensorFlow ops. Files are
+  * compressed as a sequence of independent ZSTD frames, which are compressed and decompressed in parallel, and so they
+  * can also be decompressed by the `zstd` command line tool. This requires the native library to be built with the
+  * `TENSORFLOW_WITH_ZSTD` CMake option. */
+case object ZSTDCompression extends CompressionType {
+  override val name: String = "ZSTD"
+}
+
+/** LZ4 compression, which is only supported by the native record readers and writers of this package (e.g.,
+  * [[TFRecordReader]], [[InterleavedTFRecordReader]], and [[TFRecordWriter]]), and not by the TensorFlow ops. Files are
+  * compressed as a sequence of independent LZ4 frames, which are compressed and decompressed in parallel, and so they
+  * can also be decompressed by the `lz4` command line tool. This requires the native library to be built with the
+  * `TENSORFLOW_WITH_LZ4` CMake option. */
+case object LZ4Compression extends CompressionType {
+  override val name: String = "LZ4"
+}
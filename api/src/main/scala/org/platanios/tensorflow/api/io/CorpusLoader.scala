@@ -0,0 +1,79 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.Implicits._
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.jni.{CorpusLoader => NativeCorpusLoader}
+
+import java.nio.file.Path
+
+/** Loader for text corpora (e.g., for language modeling), which builds their vocabulary and converts their tokens to
+  * IDs natively, without creating a JVM object per token.
+  *
+  * The files are read in large chunks, which are tokenized in parallel on the native executor (i.e., as the
+  * [[org.platanios.tensorflow.api.core.NativeExecutor.CorpusLoading]] subsystem), and the token counts of all chunks
+  * are merged into a concurrent hash map. The vocabulary is sorted by decreasing token count (breaking ties
+  * lexicographically) and the token IDs of all files are returned in a single `INT32` tensor, which can be used
+  * directly with `tf.data.fromTensorSlices`.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object CorpusLoader {
+  /** Loaded corpus.
+    *
+    * @param  ids         `INT32` tensor with the IDs of the tokens of all files, in order.
+    * @param  fileOffsets `INT64` tensor with the offsets in `ids` at which the tokens of each file start, followed by
+    *                     the total number of tokens.
+    * @param  vocabulary  `STRING` tensor with the vocabulary, where the ID of each token is its index.
+    * @param  counts      `INT64` tensor with the number of occurrences of each vocabulary token. The count of the
+    *                     unknown token includes the occurrences of all out-of-vocabulary tokens.
+    */
+  case class Corpus(ids: Tensor, fileOffsets: Tensor, vocabulary: Tensor, counts: Tensor) {
+    /** Returns the token IDs of the file with index `index`. */
+    def fileIds(index: Int): Tensor = {
+      val offsets = fileOffsets.entriesIterator.map(_.asInstanceOf[Long].toInt).toIndexedSeq
+      ids(offsets(index) :: offsets(index + 1))
+    }
+  }
+
+  /** Loads the corpus stored in `files`.
+    *
+    * @param  files             Files to load, which share a single vocabulary.
+    * @param  delimiters        ASCII characters that separate tokens. Newlines always separate tokens.
+    * @param  endOfLineToken    If provided, token appended at the end of each line.
+    * @param  unknownToken      If provided, token to which out-of-vocabulary tokens are mapped. Otherwise,
+    *                           out-of-vocabulary tokens are dropped.
+    * @param  minCount          Minimum number of occurrences of the tokens included in the vocabulary.
+    * @param  maxVocabularySize If positive, maximum size of the vocabulary, including the unknown token (if any).
+    * @param  chunkSize         Number of bytes of each chunk of the files that is tokenized by a single thread.
+    * @return Loaded corpus.
+    */
+  def load(
+      files: Seq[Path], delimiters: String = " \t\r\n\u000b\f", endOfLineToken: Option[String] = None,
+      unknownToken: Option[String] = None, minCount: Long = 1L, maxVocabularySize: Long = 0L,
+      chunkSize: Long = 16L * 1024L * 1024L): Corpus = {
+    require(delimiters.forall(_ < 128), s"The delimiters ('$delimiters') must be ASCII characters.")
+    require(endOfLineToken.forall(_.nonEmpty), "The end-of-line token must not be empty.")
+    require(unknownToken.forall(_.nonEmpty), "The unknown token must not be empty.")
+    require(chunkSize > 0, s"'chunkSize' (= $chunkSize) must be positive.")
+    val handles = NativeCorpusLoader.loadCorpus(
+      files.map(_.toAbsolutePath.toString).toArray, delimiters, endOfLineToken.getOrElse(""),
+      unknownToken.getOrElse(""), minCount, maxVocabularySize, chunkSize)
+    val tensors = handles.map(Tensor.fromNativeHandle)
+    Corpus(tensors(0), tensors(1), tensors(2), tensors(3))
+  }
+}
@@ -167,7 +167,9 @@ case class DirectoryLoader[T](
       if (!FileIO.isGCSPath(sortedPaths.head) && !outOfOrderWritesDetected) {
         // Check the previous `OUT_OF_ORDER_WRITE_CHECK_COUNT` paths for out of order writes.
         val outOfOrderCheckStart = math.max(0, currentPathIndex - OUT_OF_ORDER_WRITE_CHECK_COUNT)
-        _outOfOrderWritesDetected = sortedPaths.slice(outOfOrderCheckStart, currentPathIndex).exists(hasOutOfOrderWrite)
+        val checkedPaths = sortedPaths.slice(outOfOrderCheckStart, currentPathIndex)
+        val checkedSizes = FileIO.fileStatisticsMany(checkedPaths).map(_.map(_.length).getOrElse(-1L))
+        _outOfOrderWritesDetected = checkedPaths.zip(checkedSizes).exists(p => hasOutOfOrderWrite(p._1, p._2))
       }
       sortedPaths.drop(currentPathIndex + 1).headOption.orNull
     }
@@ -191,10 +193,9 @@ case class DirectoryLoader[T](
     this._loader = loaderFactory(path)
   }
 
-  /** Returns a boolean value indicating whether `path` has had an out-of-order write. */
-  private[this] def hasOutOfOrderWrite(path: Path): Boolean = {
+  /** Returns a boolean value indicating whether `path`, whose current size is `size`, has had an out-of-order write. */
+  private[this] def hasOutOfOrderWrite(path: Path, size: Long): Boolean = {
     // Check the sizes of each path before the current one.
-    val size = FileIO.fileStatistics(path).length
     val oldSize = _finalizedSizes.getOrElse(path, -1L)
     if (size != oldSize) {
       if (oldSize == -1L)
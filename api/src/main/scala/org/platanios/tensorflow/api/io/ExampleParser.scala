@@ -0,0 +1,111 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.tensors.{SparseTensor, Tensor}
+import org.platanios.tensorflow.api.types.{DataType, STRING}
+import org.platanios.tensorflow.jni.{ExampleParser => NativeExampleParser}
+
+import java.nio.ByteBuffer
+
+/** Parser for batches of serialized `Example` protos, which is meant for JVM services that receive serialized
+  * examples and need to convert them into tensors (e.g., to feed them to a model), without building tensors feature
+  * by feature from parsed proto objects.
+  *
+  * The examples are stored one after the other in a byte buffer, each one prefixed by its size encoded as a varint
+  * (i.e., as written by `Example.writeDelimitedTo` of the protobuf Java API), and they are parsed natively and in
+  * parallel, using the same parser as the `ParseExample` op. The output tensors have the same format as the outputs of
+  * that op.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object ExampleParser {
+  /** Dense feature to parse.
+    *
+    * @param  key          Feature name.
+    * @param  dataType     Feature data type, which must be `FLOAT32`, `INT64`, or `STRING`.
+    * @param  shape        Shape of the feature in each example. If its first dimension is `-1`, then the feature has
+    *                      variable length and it is padded (with `defaultValue`) to the largest length in the batch.
+    * @param  defaultValue Default value of the feature, used for examples in which it is missing. If `null`, the
+    *                      feature is required (for fixed-length features) or padded with zeros (for variable-length
+    *                      features).
+    */
+  case class DenseFeature(key: String, dataType: DataType, shape: Shape, defaultValue: Tensor = null)
+
+  /** Sparse (i.e., variable-length) feature to parse.
+    *
+    * @param  key      Feature name.
+    * @param  dataType Feature data type, which must be `FLOAT32`, `INT64`, or `STRING`.
+    */
+  case class SparseFeature(key: String, dataType: DataType)
+
+  /** Parsed features of a batch of examples.
+    *
+    * @param  dense  Dense features, with shape `[batchSize] ++ shape`, keyed by name.
+    * @param  sparse Sparse features, with dense shape `[batchSize, maxLength]`, keyed by name.
+    */
+  case class ParsedExamples(dense: Map[String, Tensor], sparse: Map[String, SparseTensor])
+
+  /** Parses the serialized examples stored in the remaining bytes of `buffer` (i.e., between its position and its
+    * limit), without modifying its position.
+    *
+    * @param  buffer         Buffer containing the length-prefixed serialized examples. Non-direct buffers are first
+    *                        copied to a direct buffer.
+    * @param  denseFeatures  Dense features to parse.
+    * @param  sparseFeatures Sparse features to parse.
+    * @return Parsed features.
+    */
+  def parse(
+      buffer: ByteBuffer, denseFeatures: Seq[DenseFeature] = Seq.empty,
+      sparseFeatures: Seq[SparseFeature] = Seq.empty): ParsedExamples = {
+    val (directBuffer, offset) = {
+      if (buffer.isDirect) {
+        (buffer, buffer.position())
+      } else {
+        val direct = ByteBuffer.allocateDirect(buffer.remaining())
+        direct.put(buffer.duplicate())
+        (direct, 0)
+      }
+    }
+    val defaults = denseFeatures.map(f => {
+      if (f.defaultValue != null)
+        f.defaultValue
+      else if (f.shape.rank > 0 && f.shape(0) == -1 && f.dataType == STRING)
+        Tensor.fill(STRING, Shape())("")
+      else if (f.shape.rank > 0 && f.shape(0) == -1)
+        Tensor.zeros(f.dataType, Shape())
+      else
+        null
+    })
+    val handles = NativeExampleParser.parseExamples(
+      directBuffer, offset, buffer.remaining(),
+      denseFeatures.map(_.key).toArray,
+      denseFeatures.map(_.dataType.cValue).toArray,
+      denseFeatures.map(_.shape.rank).toArray,
+      denseFeatures.flatMap(_.shape.asArray.map(_.toLong)).toArray,
+      defaults.map(d => if (d == null) 0L else d.nativeHandle).toArray,
+      sparseFeatures.map(_.key).toArray,
+      sparseFeatures.map(_.dataType.cValue).toArray)
+    val tensors = handles.map(Tensor.fromNativeHandle)
+    val numSparse = sparseFeatures.size
+    val sparse = sparseFeatures.indices.map(i => {
+      sparseFeatures(i).key -> SparseTensor(tensors(i), tensors(numSparse + i), tensors(2 * numSparse + i))
+    }).toMap
+    val dense = denseFeatures.indices.map(i => denseFeatures(i).key -> tensors(3 * numSparse + i)).toMap
+    ParsedExamples(dense, sparse)
+  }
+}
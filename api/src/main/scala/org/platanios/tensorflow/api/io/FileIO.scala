@@ -20,6 +20,8 @@ import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
 import org.platanios.tensorflow.jni
 import org.platanios.tensorflow.jni.{PermissionDeniedException, FileIO => NativeFileIO}
 
+import java.nio.ByteBuffer
+import java.nio.charset.StandardCharsets
 import java.nio.file._
 import java.util.UUID
 import java.util.concurrent.TimeUnit
@@ -84,10 +86,29 @@ case class FileIO(filePath: Path, mode: FileIO.Mode, readBufferSize: Long = 1024
     this
   }
 
-  /** Appends `content` to the end of the file. */
+  /** Appends `content`, encoded using UTF-8, to the end of the file. */
   def write(content: String): FileIO = {
+    write(content.getBytes(StandardCharsets.UTF_8))
+  }
+
+  /** Appends `length` bytes of `content`, starting at `offset`, to the end of the file. */
+  def write(content: Array[Byte], offset: Int, length: Int): FileIO = {
+    preWriteCheck()
+    NativeFileIO.appendBytesToWritableFile(writableFileNativeHandle, content, offset, length)
+    this
+  }
+
+  /** Appends `content` to the end of the file. */
+  def write(content: Array[Byte]): FileIO = {
+    write(content, 0, content.length)
+  }
+
+  /** Appends the remaining bytes of `buffer`, which must be a direct buffer, to the end of the file, without copying
+    * them. The position of `buffer` is advanced to its limit. */
+  def write(buffer: ByteBuffer): FileIO = {
     preWriteCheck()
-    NativeFileIO.appendToWritableFile(writableFileNativeHandle, content)
+    NativeFileIO.appendBufferToWritableFile(writableFileNativeHandle, buffer, buffer.position(), buffer.remaining())
+    buffer.position(buffer.limit())
     this
   }
 
@@ -102,36 +123,97 @@ case class FileIO(filePath: Path, mode: FileIO.Mode, readBufferSize: Long = 1024
     NativeFileIO.readFromBufferedInputStream(readBufferNativeHandle, if (numBytes == -1L) size - tell else numBytes)
   }
 
+  /** Reads bytes from the file into `buffer`, starting from current position in the file, until either `buffer` has no
+    * remaining space or the end of the file is reached. The bytes are copied directly into `buffer`, which must be a
+    * direct buffer, and its position is advanced accordingly.
+    *
+    * @param  buffer Direct buffer into which to read.
+    * @return Number of bytes read, which is `0` if the end of the file has been reached.
+    */
+  def read(buffer: ByteBuffer): Int = {
+    preReadCheck()
+    val numBytes = NativeFileIO.readFromBufferedInputStreamInto(
+      readBufferNativeHandle, buffer, buffer.position(), buffer.remaining())
+    buffer.position(buffer.position() + numBytes)
+    numBytes
+  }
+
   /** Reads the next line from the file and returns it (including the new-line character at the end). */
   def readLine(): String = {
     preReadCheck()
     NativeFileIO.readLineAsStringFromBufferedInputStream(readBufferNativeHandle)
   }
 
-  /** Reads all the lines from the file and returns them (including the new-line character at the end of each line). */
-  def readLines(): Seq[String] = {
+  /** Reads up to `offsets.length - 1` whole lines from the file, starting from its current position, and packs their
+    * bytes into `buffer`, which must be a direct buffer, starting at its position. The lines are read and packed
+    * natively, in a single call, and so this is much faster than reading them one at a time using [[readLine]], when
+    * reading large text files (e.g., vocabularies).
+    *
+    * @param  buffer       Direct buffer into which to pack the lines. Its position is advanced past the packed lines.
+    * @param  offsets      Array in which the offsets of the lines in `buffer` are stored, such that line `i` occupies
+    *                      the bytes `[offsets(i), offsets(i + 1))` of `buffer`. It must contain at least one element.
+    * @param  keepNewLines If `true`, the new-line character at the end of each line is included in its bytes.
+    * @param  validateUtf8 If `true`, the lines are checked natively to be valid UTF-8, and an exception is thrown for
+    *                      the first line that is not.
+    * @return Number of lines read, which is `0` if the end of the file has been reached, or `-1` if the next line does
+    *         not fit in the remaining space of `buffer`, in which case nothing is read.
+    */
+  def readLines(
+      buffer: ByteBuffer, offsets: Array[Int], keepNewLines: Boolean = false, validateUtf8: Boolean = false): Int = {
     preReadCheck()
-    var lines = Seq.empty[String]
-    var continue = true
-    while (continue) {
-      val line = NativeFileIO.readLineAsStringFromBufferedInputStream(readBufferNativeHandle)
-      if (line == null)
-        continue = false
-      else
-        lines :+= line
-    }
-    lines
+    val numLines = NativeFileIO.readLinesFromBufferedInputStream(
+      readBufferNativeHandle, buffer, buffer.position(), buffer.remaining(), offsets, keepNewLines, validateUtf8)
+    if (numLines > 0)
+      buffer.position(offsets(numLines))
+    numLines
   }
 
-  /** Returns an iterator over the lines in this file (including the new-line character at the end of each line). */
+  /** Reads all the lines from the file and returns them (including the new-line character at the end of each line). */
+  def readLines(): Seq[String] = linesIterator.toVector
+
+  /** Returns an iterator over the lines in this file (including the new-line character at the end of each line). The
+    * lines are read natively in batches, and so only one native call is made for each batch of lines. */
   def linesIterator: Iterator[String] = new Iterator[String] {
-    private[this] var nextLine: String = readLine()
+    private[this] var buffer : ByteBuffer  = ByteBuffer.allocateDirect(readBufferSize.toInt)
+    private[this] val offsets: Array[Int]  = new Array[Int](FileIO.LINES_BATCH_SIZE + 1)
+    private[this] var bytes  : Array[Byte] = Array.emptyByteArray
+    private[this] var numLines: Int     = 0
+    private[this] var nextLine: Int     = 0
+    private[this] var done    : Boolean = false
+
+    private[this] def readBatch(): Unit = {
+      nextLine = 0
+      numLines = 0
+      while (numLines == 0 && !done) {
+        buffer.clear()
+        numLines = readLines(buffer, offsets, keepNewLines = true)
+        if (numLines == -1) {
+          // The next line is longer than the buffer and so we grow the buffer and try again.
+          buffer = ByteBuffer.allocateDirect(2 * buffer.capacity())
+          numLines = 0
+        } else if (numLines == 0) {
+          done = true
+        }
+      }
+      if (numLines > 0) {
+        bytes = new Array[Byte](buffer.position())
+        buffer.flip()
+        buffer.get(bytes)
+      }
+    }
+
+    override def hasNext: Boolean = {
+      if (nextLine == numLines)
+        readBatch()
+      nextLine < numLines
+    }
 
-    override def hasNext: Boolean = nextLine != null
     override def next(): String = {
-      val line = nextLine
-      nextLine = readLine()
-      line
+      if (!hasNext)
+        throw new NoSuchElementException("The end of the file has been reached.")
+      val start = offsets(nextLine)
+      nextLine += 1
+      new String(bytes, start, offsets(nextLine) - start, StandardCharsets.UTF_8)
     }
   }
 
@@ -144,6 +226,13 @@ case class FileIO(filePath: Path, mode: FileIO.Mode, readBufferSize: Long = 1024
     this
   }
 
+  /** Flushes the file and syncs it to persistent storage, so that the data would also survive an OS crash. */
+  def sync(): FileIO = {
+    if (writableFileNativeHandle != 0)
+      NativeFileIO.syncWritableFile(writableFileNativeHandle)
+    this
+  }
+
   /** Closes this file IO object and releases any resources associated with it. Note that an events file reader is not
     * usable after it has been closed. */
   def close(): Unit = {
@@ -165,6 +254,9 @@ case class FileIO(filePath: Path, mode: FileIO.Mode, readBufferSize: Long = 1024
   * @author Emmanouil Antonios Platanios
   */
 object FileIO {
+  /** Number of lines read by each native call made by [[FileIO.linesIterator]]. */
+  private[FileIO] val LINES_BATCH_SIZE: Int = 4096
+
   type FileStatistics = jni.FileStatistics
 
   val FileStatistics: jni.FileStatistics.type = jni.FileStatistics
@@ -245,6 +337,16 @@ object FileIO {
     }
   }
 
+  /** Determines whether each of the provided paths exists or not. The underlying file system requests are issued
+    * concurrently, which makes this much faster than calling [[exists]] for each path, on remote file systems.
+    *
+    * @param  filePaths Paths to files or directories.
+    * @return Sequence containing `true` for each path that exists, and `false` for each path that does not.
+    */
+  def existsMany(filePaths: Seq[Path]): Seq[Boolean] = {
+    NativeFileIO.existsMany(filePaths.map(_.toAbsolutePath.toString).toArray)
+  }
+
   /** Deletes the file located at `filePath`.
     *
     * @param  filePath File path.
@@ -302,15 +404,38 @@ object FileIO {
     NativeFileIO.statistics(path.toAbsolutePath.toString)
   }
 
+  /** Returns the file statistics of each of the provided paths. The underlying file system requests are issued
+    * concurrently, which makes this much faster than calling [[fileStatistics]] for each path, on remote file systems.
+    *
+    * @param  paths Paths to files or directories.
+    * @return Sequence containing the statistics of each path, or `None` for paths that do not exist.
+    */
+  def fileStatisticsMany(paths: Seq[Path]): Seq[Option[FileStatistics]] = {
+    val lengths = new Array[Long](paths.length)
+    val lastModifiedTimes = new Array[Long](paths.length)
+    val kinds = new Array[Byte](paths.length)
+    NativeFileIO.statisticsMany(paths.map(_.toAbsolutePath.toString).toArray, lengths, lastModifiedTimes, kinds)
+    kinds.indices.map(i => {
+      if (kinds(i) == 0)
+        None
+      else
+        Some(FileStatistics(lengths(i), lastModifiedTimes(i), kinds(i) == 2))
+    })
+  }
+
   /** Copies data from the file at `oldPath` to a new file at `newPath`.
+    *
+    * Local files are copied in the kernel, when supported. Otherwise, the file is streamed in chunks, with reads and
+    * writes overlapping, and so only a few chunks are held in memory at any time.
     *
     * @param  oldPath   Old file path.
     * @param  newPath   New file path.
     * @param  overwrite Boolean value indicating whether it is allowed to overwrite the file at `newPath`, if one
     *                   already exists.
+    * @param  chunkSize Size (in bytes) of the chunks in which the file is copied, when it is streamed.
     */
-  def copyFile(oldPath: Path, newPath: Path, overwrite: Boolean = false): Unit = {
-    NativeFileIO.copyFile(oldPath.toAbsolutePath.toString, newPath.toAbsolutePath.toString, overwrite)
+  def copyFile(oldPath: Path, newPath: Path, overwrite: Boolean = false, chunkSize: Long = 8L * 1024L * 1024L): Unit = {
+    NativeFileIO.copyFile(oldPath.toAbsolutePath.toString, newPath.toAbsolutePath.toString, overwrite, chunkSize)
   }
 
   /** Rename/move data from the file/directory at `oldPath` to a new file/directory at `newPath`.
@@ -357,12 +482,9 @@ object FileIO {
     }
     var files: Seq[Path] = Seq.empty[Path]
     var subDirs: Seq[Path] = Seq.empty[Path]
-    children.foreach(child => {
-      val fullPath = dirPath.resolve(child)
-      if (!isDirectory(fullPath))
-        files :+= child
-      else
-        subDirs :+= child
+    children.zip(fileStatisticsMany(children.map(dirPath.resolve))).foreach({
+      case (child, Some(statistics)) if statistics.isDirectory => subDirs :+= child
+      case (child, _) => files :+= child
     })
     val hereStream = Stream((dirPath, subDirs, files))
     val subDirsStream = subDirs.toStream.map(s => walk(dirPath.resolve(s), inOrder))
@@ -414,7 +536,12 @@ object FileIO {
   def getMatchingPaths(path: Path, useNativeFileIO: Boolean = true): Set[Path] = {
     val pathAsString = path.toAbsolutePath.toString
     if (useNativeFileIO) {
-      NativeFileIO.getMatchingFiles(pathAsString).toSet[String].map(Paths.get(_))
+      val lister = new FileLister(pathAsString, DEFAULT_LISTING_PARALLELISM, recursive = false, withStatistics = false)
+      try {
+        lister.map(_._1).toSet
+      } finally {
+        lister.close()
+      }
     } else {
       val separator = FileSystems.getDefault.getSeparator
 
@@ -434,6 +561,83 @@ object FileIO {
     }
   }
 
+  /** Returns an iterator over all the matching paths to the path pattern provided, along with their statistics.
+    *
+    * The pattern follows the same rules as for [[getMatchingPaths]]. The directories spanned by the pattern are listed
+    * in parallel, natively, and the matching paths are returned in batches, in no particular order, as soon as they
+    * are found. This is much faster than [[getMatchingPaths]] for patterns that span many directories on remote file
+    * systems (e.g., GCS).
+    *
+    * @param  path        Path pattern.
+    * @param  parallelism Number of directories to list concurrently.
+    * @param  recursive   If `true`, matching directories are also listed recursively and all of their descendants are
+    *                     returned.
+    * @return Iterator over tuples containing the matching paths and their statistics, which are obtained in the same
+    *         pass.
+    */
+  def listMatchingPaths(
+      path: Path, parallelism: Int = DEFAULT_LISTING_PARALLELISM,
+      recursive: Boolean = false): Iterator[(Path, FileStatistics)] = {
+    new FileLister(path.toAbsolutePath.toString, parallelism, recursive, withStatistics = true)
+        .map(p => (p._1, p._2.get))
+  }
+
+  /** Default number of directories listed concurrently when matching path patterns. */
+  private[io] val DEFAULT_LISTING_PARALLELISM: Int = 16
+
+  /** Iterator over the paths returned by a native file lister. The lister is closed once all paths have been
+    * returned. */
+  private[this] class FileLister(pattern: String, numThreads: Int, recursive: Boolean, withStatistics: Boolean)
+      extends Iterator[(Path, Option[FileStatistics])] with Closeable {
+    private[this] var nativeHandle: Long = NativeFileIO.newFileLister(pattern, numThreads, recursive, withStatistics)
+
+    private[this] object NativeHandleLock
+
+    private[this] var listing: jni.FileListing = _
+    private[this] var index  : Int             = 0
+
+    // Keep track of references in the Scala side and notify the native library when the lister is not referenced
+    // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+    // potential memory leak.
+    Disposer.add(this, () => this.close())
+
+    override def hasNext: Boolean = NativeHandleLock.synchronized {
+      if ((listing == null || index >= listing.paths.length) && nativeHandle != 0) {
+        listing = NativeFileIO.fileListerNext(nativeHandle, FileLister.BATCH_SIZE)
+        index = 0
+        if (listing == null)
+          close()
+      }
+      listing != null && index < listing.paths.length
+    }
+
+    override def next(): (Path, Option[FileStatistics]) = NativeHandleLock.synchronized {
+      if (!hasNext)
+        throw new NoSuchElementException("No more matching paths available.")
+      val path = Paths.get(listing.paths(index))
+      val statistics = {
+        if (withStatistics)
+          Some(FileStatistics(listing.lengths(index), listing.lastModifiedTimes(index), listing.isDirectory(index)))
+        else
+          None
+      }
+      index += 1
+      (path, statistics)
+    }
+
+    override def close(): Unit = NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        NativeFileIO.deleteFileLister(nativeHandle)
+        nativeHandle = 0
+      }
+    }
+  }
+
+  private[this] object FileLister {
+    /** Maximum number of paths transferred from the native lister per call. */
+    val BATCH_SIZE: Int = 1024
+  }
+
   /** Deletes all the matching paths to the path pattern provided.
     *
     * The pattern must follow the TensorFlow path pattern rules and it pattern must match all of a name (i.e., not just
@@ -463,6 +667,23 @@ object FileIO {
     FileIO(filePath, READ).read()
   }
 
+  /** Reads bytes from the file located at `filePath`, starting at `fileOffset`, directly into `buffer`, until either
+    * `buffer` has no remaining space or the end of the file is reached. `buffer` must be a direct buffer and its
+    * position is advanced by the number of bytes read. Large files can be read in chunks by calling this method
+    * repeatedly, with increasing offsets.
+    *
+    * @param  filePath   Path to the file.
+    * @param  buffer     Direct buffer into which to read.
+    * @param  fileOffset Offset in the file from which to start reading.
+    * @return Number of bytes read.
+    */
+  def readFileInto(filePath: Path, buffer: ByteBuffer, fileOffset: Long = 0L): Int = {
+    val numBytes = NativeFileIO.readFileInto(
+      filePath.toAbsolutePath.toString, fileOffset, buffer, buffer.position(), buffer.remaining())
+    buffer.position(buffer.position() + numBytes)
+    numBytes
+  }
+
   /** Writes the provided string to the file located at `filePath`. */
   def writeStringToFile(filePath: Path, content: String): Unit = {
     FileIO(filePath, WRITE).write(content).close()
@@ -484,4 +705,46 @@ object FileIO {
         deleteFile(temporaryFilePath)
     }
   }
+
+  /** Enables the process-wide block cache of remote files (e.g., files stored in GCS, S3, or HDFS), which stores blocks
+    * of those files in a local directory (ideally on a local SSD), so that reading the same files again (e.g., in every
+    * training epoch) does not download them again. The cache is transparent to all native readers (e.g., the TF record
+    * readers and the file IO objects), it evicts blocks in least recently used order, and it reuses the blocks that
+    * already exist in `directory`. Files are only read through the cache if they are opened after it is enabled.
+    *
+    * @param  directory     Local directory in which to store the cached blocks, which is created if it does not exist.
+    * @param  capacityBytes Maximum number of bytes of cached blocks.
+    * @param  blockSize     Size of the cached blocks, in bytes. Remote files are always read in whole blocks.
+    */
+  def enableBlockCache(directory: Path, capacityBytes: Long, blockSize: Long = 8L * 1024L * 1024L): Unit = {
+    NativeFileIO.enableBlockCache(directory.toAbsolutePath.toString, capacityBytes, blockSize)
+  }
+
+  /** Disables the process-wide block cache of remote files. The cached blocks are kept in the cache directory. */
+  def disableBlockCache(): Unit = {
+    NativeFileIO.disableBlockCache()
+  }
+
+  /** Returns the statistics of the process-wide block cache of remote files, since it was last enabled. */
+  def blockCacheStatistics: BlockCacheStatistics = {
+    val values = NativeFileIO.blockCacheStatistics()
+    BlockCacheStatistics(values(0), values(1), values(2), values(3), values(4), values(5), values(6))
+  }
+
+  /** Statistics of the block cache of remote files.
+    *
+    * @param  hits         Number of block reads served by the cache.
+    * @param  misses       Number of block reads that had to fetch the block from its remote file system.
+    * @param  bytesSaved   Number of bytes read from the cache, instead of from the remote file systems.
+    * @param  bytesFetched Number of bytes fetched from the remote file systems, due to misses.
+    * @param  evictions    Number of evicted blocks.
+    * @param  cachedBytes  Number of bytes currently stored in the cache.
+    * @param  cachedBlocks Number of blocks currently stored in the cache.
+    */
+  case class BlockCacheStatistics(
+      hits: Long, misses: Long, bytesSaved: Long, bytesFetched: Long, evictions: Long, cachedBytes: Long,
+      cachedBlocks: Long) {
+    /** Fraction of block reads that were served by the cache. */
+    def hitRate: Double = if (hits + misses == 0L) 0.0 else hits.toDouble / (hits + misses).toDouble
+  }
 }
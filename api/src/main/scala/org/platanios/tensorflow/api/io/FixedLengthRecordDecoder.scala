@@ -0,0 +1,94 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.types.{DataType, UINT8}
+import org.platanios.tensorflow.jni.{RecordDecoder => NativeRecordDecoder}
+
+import java.nio.file.Path
+
+/** Decoder for files that consist of a fixed-size header followed by fixed-length binary records (e.g., the files of
+  * the MNIST and CIFAR datasets).
+  *
+  * Decoding happens entirely natively, in a single streaming pass over the file, and without materializing the whole
+  * file in the heap. Each decoded field is written directly into a single, pre-allocated tensor.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object FixedLengthRecordDecoder {
+  /** Field stored in each record.
+    *
+    * @param  offset      Offset, in bytes, of the field within each record.
+    * @param  shape       Shape of the field, as stored in the record (one byte per element).
+    * @param  permutation Permutation of the field dimensions applied while decoding (i.e., dimension `i` of the
+    *                     decoded field is dimension `permutation(i)` of the stored field). Empty for no reordering.
+    * @param  dataType    Data type of the decoded field, which must be either `UINT8` or `FLOAT32`.
+    * @param  scale       Scale applied to each stored byte while decoding. Must be `1` for `UINT8` fields.
+    * @param  shift       Shift applied to each stored byte while decoding, after the scale.
+    */
+  case class Field(
+      offset: Long,
+      shape: Shape,
+      permutation: Seq[Int] = Seq.empty,
+      dataType: DataType = UINT8,
+      scale: Float = 1.0f,
+      shift: Float = 0.0f)
+
+  /** Decodes the records of a file.
+    *
+    * @param  path        Path to the file.
+    * @param  headerBytes Size, in bytes, of the file header, which is skipped.
+    * @param  recordBytes Size, in bytes, of each record.
+    * @param  fields      Fields to decode from each record.
+    * @param  gzip        Boolean value indicating whether the file is compressed using GZIP.
+    * @return Decoded fields, each with a leading dimension over the records of the file.
+    */
+  def decode(
+      path: Path, headerBytes: Long, recordBytes: Long, fields: Seq[Field], gzip: Boolean = false): Seq[Tensor] = {
+    decode(path, Seq.empty, headerBytes, recordBytes, fields, gzip).head
+  }
+
+  /** Decodes the records of multiple entries of a tar archive, in a single pass over the archive.
+    *
+    * @param  path        Path to the tar archive.
+    * @param  tarEntries  Names of the entries to decode. Each entry is matched against the archive entries whose names
+    *                     end with it.
+    * @param  headerBytes Size, in bytes, of the header of each entry, which is skipped.
+    * @param  recordBytes Size, in bytes, of each record.
+    * @param  fields      Fields to decode from each record.
+    * @param  gzip        Boolean value indicating whether the archive is compressed using GZIP.
+    * @return Decoded fields of each entry, in the order of `tarEntries`.
+    */
+  def decode(
+      path: Path, tarEntries: Seq[String], headerBytes: Long, recordBytes: Long, fields: Seq[Field],
+      gzip: Boolean): Seq[Seq[Tensor]] = {
+    require(fields.nonEmpty, "At least one field must be provided.")
+    val handles = NativeRecordDecoder.decodeFixedLengthRecords(
+      path.toAbsolutePath.toString, gzip, tarEntries.toArray, headerBytes, recordBytes,
+      fields.map(_.offset).toArray,
+      fields.map(_.shape.rank).toArray,
+      fields.flatMap(_.shape.asArray.map(_.toLong)).toArray,
+      if (fields.forall(_.permutation.isEmpty)) Array.empty[Int] else fields.flatMap(f => {
+        if (f.permutation.isEmpty) 0 until f.shape.rank else f.permutation
+      }).toArray,
+      fields.map(_.dataType.cValue).toArray,
+      fields.map(_.scale).toArray,
+      fields.map(_.shift).toArray)
+    handles.map(Tensor.fromNativeHandle).grouped(fields.size).map(_.toSeq).toSeq
+  }
+}
@@ -0,0 +1,136 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{FixedLengthRecordReader => NativeReader}
+
+import java.nio.file.Path
+
+/** Reader for files that consist of a fixed-size header, followed by fixed-length binary records, followed by a
+  * fixed-size footer (e.g., the files of the CIFAR datasets), which reads the records in batches, concurrently.
+  *
+  * The records are split into batches of `recordsPerBatch` contiguous records, which are read natively on `numThreads`
+  * threads and returned in order. Each batch is returned as a single `UINT8` tensor with shape
+  * `[numRecords, recordBytes]`, rather than as one tensor per record. If `useDirectIO` is `true`, local files are read
+  * with requests that bypass the page cache (i.e., using `O_DIRECT`), where that is supported, which avoids polluting
+  * the page cache when the file is only read once per epoch. [[directIO]] tells whether that is the case.
+  *
+  * Note that the reader pre-fetches batches as soon as it is created.
+  *
+  * @param  filePath           Path to the file being read.
+  * @param  headerBytes        Size, in bytes, of the file header, which is skipped.
+  * @param  recordBytes        Size, in bytes, of each record.
+  * @param  footerBytes        Size, in bytes, of the file footer, which is skipped.
+  * @param  recordsPerBatch    Maximum number of records in each batch.
+  * @param  numThreads         Number of threads reading batches concurrently.
+  * @param  maxBufferedBatches Maximum number of batches read ahead of the consumer.
+  * @param  useDirectIO        If `true`, local files are read using direct I/O, where that is supported.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class FixedLengthRecordReader(
+    val filePath: Path,
+    val headerBytes: Long,
+    val recordBytes: Long,
+    val footerBytes: Long = 0L,
+    val recordsPerBatch: Long = 1024L,
+    val numThreads: Int = 4,
+    val maxBufferedBatches: Int = 8,
+    val useDirectIO: Boolean = true
+) extends Closeable with Loader[Tensor] {
+  private[this] var nativeHandle: Long = {
+    NativeReader.newParallelFixedLengthReader(
+      filePath.toAbsolutePath.toString, headerBytes, recordBytes, footerBytes, recordsPerBatch, numThreads,
+      maxBufferedBatches, useDirectIO)
+  }
+
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the reader is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Number of records stored in the file. */
+  val numRecords: Long = NativeHandleLock.synchronized {
+    NativeReader.parallelFixedLengthReaderNumRecords(nativeHandle)
+  }
+
+  /** Boolean value indicating whether the file is read using direct I/O. */
+  val directIO: Boolean = NativeHandleLock.synchronized {
+    NativeReader.parallelFixedLengthReaderDirectIO(nativeHandle)
+  }
+
+  /** Returns an iterator over the remaining batches of records in the file. The iterator ends when all batches have
+    * been returned. */
+  override def load(): Iterator[Tensor] = new Iterator[Tensor] {
+    private[this] var nextBatch: Option[Tensor] = None
+    private[this] var exhausted: Boolean = false
+
+    override def hasNext: Boolean = {
+      if (nextBatch.isEmpty && !exhausted) {
+        NativeHandleLock.synchronized {
+          NativeReader.parallelFixedLengthReaderNext(nativeHandle) match {
+            case 0L => exhausted = true
+            case tensorHandle => nextBatch = Some(Tensor.fromNativeHandle(tensorHandle))
+          }
+        }
+      }
+      nextBatch.isDefined
+    }
+
+    override def next(): Tensor = {
+      if (!hasNext)
+        throw new NoSuchElementException(s"No more records stored at '${filePath.toAbsolutePath}'.")
+      val batch = nextBatch.get
+      nextBatch = None
+      batch
+    }
+  }
+
+  /** Closes this reader, which stops reading batches, and releases any resources associated with it. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        NativeReader.deleteParallelFixedLengthReader(nativeHandle)
+        nativeHandle = 0
+      }
+    }
+  }
+}
+
+object FixedLengthRecordReader {
+  /** Creates a new fixed-length record reader.
+    *
+    * @param  filePath           Path to the file being read.
+    * @param  headerBytes        Size, in bytes, of the file header, which is skipped.
+    * @param  recordBytes        Size, in bytes, of each record.
+    * @param  footerBytes        Size, in bytes, of the file footer, which is skipped.
+    * @param  recordsPerBatch    Maximum number of records in each batch.
+    * @param  numThreads         Number of threads reading batches concurrently.
+    * @param  maxBufferedBatches Maximum number of batches read ahead of the consumer.
+    * @param  useDirectIO        If `true`, local files are read using direct I/O, where that is supported.
+    * @return Newly constructed fixed-length record reader.
+    */
+  def apply(
+      filePath: Path, headerBytes: Long, recordBytes: Long, footerBytes: Long = 0L, recordsPerBatch: Long = 1024L,
+      numThreads: Int = 4, maxBufferedBatches: Int = 8, useDirectIO: Boolean = true): FixedLengthRecordReader = {
+    new FixedLengthRecordReader(
+      filePath, headerBytes, recordBytes, footerBytes, recordsPerBatch, numThreads, maxBufferedBatches, useDirectIO)
+  }
+}
@@ -0,0 +1,205 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{RecordReader => NativeReader}
+
+import java.nio.{ByteBuffer, ByteOrder}
+import java.nio.file.{Path, Paths}
+
+import scala.collection.mutable.ArrayBuffer
+import scala.util.Random
+
+/** Reader that provides random access to the records of an uncompressed TFRecord file, using an offset index built
+  * for it by [[IndexedTFRecordReader.buildIndices]].
+  *
+  * This allows reading arbitrary records without scanning the file, which is useful for shuffling whole datasets
+  * every epoch and for resuming reading from any record (e.g., after preemption).
+  *
+  * @param  filePath        Path to the file being read.
+  * @param  indexPath       Path to the index of the file.
+  * @param  verifyChecksums If `true`, the checksums of the records are verified when they are read.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class IndexedTFRecordReader(
+    val filePath: Path,
+    val indexPath: Path = null,
+    val verifyChecksums: Boolean = false
+) extends Closeable {
+  private[this] var nativeHandle: Long = {
+    NativeReader.newIndexedRecordReader(
+      filePath.toAbsolutePath.toString,
+      Option(indexPath).getOrElse(IndexedTFRecordReader.defaultIndexPath(filePath)).toAbsolutePath.toString,
+      verifyChecksums)
+  }
+
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the reader is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Number of records stored in the file. */
+  lazy val numRecords: Long = NativeHandleLock.synchronized {
+    NativeReader.indexedRecordReaderNumRecords(nativeHandle)
+  }
+
+  /** Reads the record with the provided index. */
+  def read(index: Long): Array[Byte] = NativeHandleLock.synchronized {
+    NativeReader.indexedRecordReaderRead(nativeHandle, index)
+  }
+
+  /** Returns an iterator over the records with the provided indices, in order. The records are read in batches, so that
+    * reading each record does not require a separate native call. */
+  def read(indices: Seq[Long]): Iterator[Array[Byte]] = {
+    read(indices, ByteBuffer.allocateDirect(TFRecordReader.BUFFER_SIZE).order(ByteOrder.LITTLE_ENDIAN))
+  }
+
+  /** Returns an iterator over the records with the provided indices, in order, which reads them in batches into
+    * `buffer`. The buffer must not be used by any other iterator until the returned iterator has been exhausted. */
+  private[io] def read(indices: Seq[Long], buffer: ByteBuffer): Iterator[Array[Byte]] = new Iterator[Array[Byte]] {
+    private[this] val remainingIndices: Array[Long] = indices.toArray
+    private[this] var position: Int = 0
+    private[this] var numBufferedRecords: Int = 0
+
+    override def hasNext: Boolean = numBufferedRecords > 0 || position < remainingIndices.length
+
+    override def next(): Array[Byte] = {
+      if (!hasNext)
+        throw new NoSuchElementException("No more records to read.")
+      if (numBufferedRecords == 0) {
+        val batchIndices = remainingIndices.slice(position, position + TFRecordReader.BATCH_SIZE)
+        numBufferedRecords = NativeHandleLock.synchronized {
+          NativeReader.indexedRecordReaderReadBatch(nativeHandle, batchIndices, TFRecordReader.BUFFER_SIZE, buffer)
+        }
+        buffer.clear()
+        if (numBufferedRecords == 0) {
+          // The next record is too large to fit in the buffer.
+          position += 1
+          return read(remainingIndices(position - 1))
+        }
+        position += numBufferedRecords
+      }
+      numBufferedRecords -= 1
+      val record = new Array[Byte](buffer.getInt())
+      buffer.get(record)
+      record
+    }
+  }
+
+  /** Returns an iterator over all records stored in the file, in a random order determined by `seed`. */
+  def shuffled(seed: Long): Iterator[Array[Byte]] = {
+    read(new Random(seed).shuffle((0L until numRecords).toVector))
+  }
+
+  /** Closes this reader and releases any resources associated with it. Note that a reader is not usable after it has
+    * been closed. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        NativeReader.deleteIndexedRecordReader(nativeHandle)
+        nativeHandle = 0
+      }
+    }
+  }
+}
+
+object IndexedTFRecordReader {
+  /** Returns the default path of the index of the TFRecord file stored at `filePath` (i.e., a sidecar file with the
+    * same name and an `.index` suffix). */
+  def defaultIndexPath(filePath: Path): Path = Paths.get(filePath.toString + ".index")
+
+  /** Returns an iterator over all records stored in the files read by `readers`, in a random order determined by
+    * `seed`, which is obtained using a two-level shuffle that keeps memory usage bounded.
+    *
+    * The records of each file are split into blocks of `blockSize` consecutive records, and all blocks, across files,
+    * are read in a uniformly random order, using the offset indices of the files. The records read are then passed
+    * through a shuffle buffer that holds up to `bufferSize` encoded records, from which records are returned in a
+    * random order, similar to [[org.platanios.tensorflow.api.ops.io.data.ShuffleDataset]]. Because the buffer holds
+    * encoded records, which are typically decoded only after they have been shuffled, it can be large enough to mix
+    * records across many blocks even for datasets whose decoded elements are large (e.g., images). Reading blocks of
+    * consecutive records, rather than individual records, keeps reads mostly sequential within each file.
+    *
+    * @param  readers    Readers for the files whose records to shuffle.
+    * @param  seed       Seed used for shuffling.
+    * @param  blockSize  Number of consecutive records in each block. `1` results in a full shuffle of the record order.
+    * @param  bufferSize Maximum number of encoded records held in the shuffle buffer.
+    * @return Iterator over the shuffled records.
+    * @throws IllegalArgumentException If `blockSize` or `bufferSize` is not positive.
+    */
+  @throws[IllegalArgumentException]
+  def shuffled(
+      readers: Seq[IndexedTFRecordReader], seed: Long, blockSize: Int = 64, bufferSize: Int = 1024
+  ): Iterator[Array[Byte]] = {
+    require(blockSize > 0, s"'blockSize' (= $blockSize) must be positive.")
+    require(bufferSize > 0, s"'bufferSize' (= $bufferSize) must be positive.")
+    val random = new Random(seed)
+    val blocks = random.shuffle(readers.toVector.flatMap(reader => {
+      (0L until reader.numRecords by blockSize.toLong).map(start => {
+        (reader, start until math.min(start + blockSize, reader.numRecords))
+      })
+    }))
+    // All blocks are read sequentially and so they can share the same buffer.
+    val buffer = ByteBuffer.allocateDirect(TFRecordReader.BUFFER_SIZE).order(ByteOrder.LITTLE_ENDIAN)
+    val records = blocks.iterator.flatMap(block => block._1.read(block._2, buffer))
+    new Iterator[Array[Byte]] {
+      private[this] val shuffleBuffer = new ArrayBuffer[Array[Byte]](bufferSize)
+
+      override def hasNext: Boolean = shuffleBuffer.nonEmpty || records.hasNext
+
+      override def next(): Array[Byte] = {
+        while (shuffleBuffer.size < bufferSize && records.hasNext)
+          shuffleBuffer += records.next()
+        if (shuffleBuffer.isEmpty)
+          throw new NoSuchElementException("No more records to read.")
+        val index = random.nextInt(shuffleBuffer.size)
+        val record = shuffleBuffer(index)
+        shuffleBuffer(index) = shuffleBuffer.last
+        shuffleBuffer.remove(shuffleBuffer.size - 1)
+        record
+      }
+    }
+  }
+
+  /** Builds offset indices for the provided uncompressed TFRecord files, scanning them concurrently.
+    *
+    * @param  filePaths  Paths to the files to index.
+    * @param  indexPaths Paths to the index files to write. Defaults to [[defaultIndexPath]] for each file.
+    * @param  numThreads Number of threads to use.
+    * @return Number of records indexed for each file.
+    */
+  def buildIndices(
+      filePaths: Seq[Path], indexPaths: Seq[Path] = null,
+      numThreads: Int = Runtime.getRuntime.availableProcessors()): Seq[Long] = {
+    val indices = Option(indexPaths).getOrElse(filePaths.map(defaultIndexPath))
+    NativeReader.buildRecordIndices(
+      filePaths.map(_.toAbsolutePath.toString).toArray, indices.map(_.toAbsolutePath.toString).toArray, numThreads)
+  }
+
+  /** Creates a new indexed TFRecord reader.
+    *
+    * @param  filePath        Path to the file being read.
+    * @param  indexPath       Path to the index of the file. Defaults to [[defaultIndexPath]].
+    * @param  verifyChecksums If `true`, the checksums of the records are verified when they are read.
+    * @return Newly constructed indexed TFRecord reader.
+    */
+  def apply(filePath: Path, indexPath: Path = null, verifyChecksums: Boolean = false): IndexedTFRecordReader = {
+    new IndexedTFRecordReader(filePath, indexPath, verifyChecksums)
+  }
+}
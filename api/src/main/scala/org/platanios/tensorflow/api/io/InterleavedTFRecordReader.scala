@@ -0,0 +1,98 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{RecordReader => NativeReader}
+
+/** TFRecord reader that interleaves the records of multiple files, reading several of them concurrently on a native
+  * thread pool.
+  *
+  * The file patterns are expanded natively (with the same semantics as `FileIO.getMatchingPaths`) and the files
+  * matching each pattern are read in order of their names. Up to `cycleLength` files are read at the same time, with
+  * file `i` being read by slot `i % cycleLength`. If `deterministic` is `true`, records are returned in round-robin
+  * order over the slots, and so their order only depends on the file contents. Otherwise, records are returned as soon
+  * as they become available, which avoids stalling on slow files.
+  *
+  * @param  filePatterns              File patterns (or plain paths) of the files to read.
+  * @param  compressionType           Compression type used for the files.
+  * @param  cycleLength               Number of files to read concurrently.
+  * @param  deterministic             If `true`, records are returned in a deterministic order.
+  * @param  maxBufferedRecordsPerFile Maximum number of records to read ahead of time, per file being read.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class InterleavedTFRecordReader(
+    val filePatterns: Seq[String],
+    val compressionType: CompressionType = NoCompression,
+    val cycleLength: Int = Runtime.getRuntime.availableProcessors(),
+    val deterministic: Boolean = true,
+    val maxBufferedRecordsPerFile: Long = 256L
+) extends Closeable with Loader[Array[Byte]] {
+  private[this] var nativeHandle: Long = {
+    NativeReader.newInterleavedRecordReaderWrapper(
+      filePatterns.toArray, compressionType.name, cycleLength, deterministic, maxBufferedRecordsPerFile)
+  }
+
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the reader is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Number of files that match the file patterns of this reader. */
+  lazy val numFiles: Long = NativeHandleLock.synchronized {
+    NativeReader.interleavedRecordReaderWrapperNumFiles(nativeHandle)
+  }
+
+  /** Returns an iterator over the interleaved records, which ends once all files have been read. Errors encountered
+    * while reading a file are thrown by the iterator, after which the remaining files can still be read. */
+  override def load(): Iterator[Array[Byte]] = new TFRecordReader.BatchedRecordIterator(
+    NativeHandleLock,
+    buffer => NativeReader.interleavedRecordReaderWrapperReadBatch(
+      nativeHandle, TFRecordReader.BATCH_SIZE, TFRecordReader.BUFFER_SIZE, buffer),
+    () => NativeReader.interleavedRecordReaderWrapperReadNext(nativeHandle))
+
+  /** Closes this reader and releases any resources associated with it, including its I/O threads. Note that a reader
+    * is not usable after it has been closed. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        NativeReader.deleteInterleavedRecordReaderWrapper(nativeHandle)
+        nativeHandle = 0
+      }
+    }
+  }
+}
+
+object InterleavedTFRecordReader {
+  /** Creates a new interleaved TFRecord reader.
+    *
+    * @param  filePatterns              File patterns (or plain paths) of the files to read.
+    * @param  compressionType           Compression type used for the files.
+    * @param  cycleLength               Number of files to read concurrently.
+    * @param  deterministic             If `true`, records are returned in a deterministic order.
+    * @param  maxBufferedRecordsPerFile Maximum number of records to read ahead of time, per file being read.
+    * @return Newly constructed interleaved TFRecord reader.
+    */
+  def apply(
+      filePatterns: Seq[String], compressionType: CompressionType = NoCompression,
+      cycleLength: Int = Runtime.getRuntime.availableProcessors(), deterministic: Boolean = true,
+      maxBufferedRecordsPerFile: Long = 256L): InterleavedTFRecordReader = {
+    new InterleavedTFRecordReader(filePatterns, compressionType, cycleLength, deterministic, maxBufferedRecordsPerFile)
+  }
+}
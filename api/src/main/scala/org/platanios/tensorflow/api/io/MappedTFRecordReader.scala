@@ -0,0 +1,109 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.core.exception.OutOfRangeException
+import org.platanios.tensorflow.api.utilities.Closeable
+import org.platanios.tensorflow.jni.{RecordReader => NativeReader}
+
+import java.nio.ByteBuffer
+import java.nio.file.Path
+
+/** Reader for local uncompressed TFRecord files that memory-maps the file and returns each record as a read-only
+  * byte buffer pointing directly into the mapping, without copying it.
+  *
+  * Note that the returned buffers are only valid while the reader is open. For that reason, and unlike other readers,
+  * this reader is not closed automatically when it is garbage collected and [[close]] must be called explicitly once
+  * the records are not needed anymore.
+  *
+  * @param  filePath        Path to the file being read.
+  * @param  startOffset     Offset in the file from which to start reading.
+  * @param  verifyChecksums If `true`, the checksums of the record contents are verified when they are read. The
+  *                         checksums of the record headers are always verified.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class MappedTFRecordReader(
+    val filePath: Path,
+    val startOffset: Long = 0L,
+    val verifyChecksums: Boolean = false
+) extends Closeable with Loader[ByteBuffer] {
+  private[this] var nativeHandle: Long = {
+    NativeReader.newMappedRecordReader(filePath.toAbsolutePath.toString, startOffset, verifyChecksums)
+  }
+
+  private[this] object NativeHandleLock
+
+  /** Returns an iterator over the records stored in the file, starting from the current offset of this reader. The
+    * iterator ends when the end of the file is reached. */
+  override def load(): Iterator[ByteBuffer] = new Iterator[ByteBuffer] {
+    private[this] var records: Array[ByteBuffer] = Array.empty
+    private[this] var position: Int = 0
+
+    override def hasNext: Boolean = {
+      if (position == records.length) {
+        records = NativeHandleLock.synchronized {
+          try {
+            NativeReader.mappedRecordReaderReadBatch(nativeHandle, MappedTFRecordReader.BATCH_SIZE)
+          } catch {
+            case _: OutOfRangeException => Array.empty[ByteBuffer]
+          }
+        }
+        position = 0
+      }
+      position < records.length
+    }
+
+    override def next(): ByteBuffer = {
+      if (!hasNext)
+        throw new NoSuchElementException(s"No more records stored at '${filePath.toAbsolutePath}'.")
+      position += 1
+      records(position - 1).asReadOnlyBuffer()
+    }
+  }
+
+  /** Returns the offset in the file right after the last record that was read. */
+  def offset: Long = NativeHandleLock.synchronized {
+    NativeReader.mappedRecordReaderOffset(nativeHandle)
+  }
+
+  /** Closes this reader and unmaps the file. Note that neither the reader nor any of the buffers it returned are usable
+    * after it has been closed. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        NativeReader.deleteMappedRecordReader(nativeHandle)
+        nativeHandle = 0
+      }
+    }
+  }
+}
+
+object MappedTFRecordReader {
+  /** Maximum number of records read per native call. */
+  private[MappedTFRecordReader] val BATCH_SIZE: Int = 1024
+
+  /** Creates a new memory-mapped TFRecord reader.
+    *
+    * @param  filePath        Path to the file being read.
+    * @param  startOffset     Offset in the file from which to start reading.
+    * @param  verifyChecksums If `true`, the checksums of the record contents are verified when they are read.
+    * @return Newly constructed memory-mapped TFRecord reader.
+    */
+  def apply(filePath: Path, startOffset: Long = 0L, verifyChecksums: Boolean = false): MappedTFRecordReader = {
+    new MappedTFRecordReader(filePath, startOffset, verifyChecksums)
+  }
+}
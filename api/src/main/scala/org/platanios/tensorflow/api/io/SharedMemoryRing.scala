@@ -0,0 +1,228 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{SharedMemoryRing => NativeRing}
+
+import java.nio.ByteBuffer
+
+import scala.concurrent.duration.Duration
+
+/** Shared memory ring, used to move elements (i.e., lists of numeric tensors, such as batches of features and labels)
+  * between processes on the same machine, without any serialization and without copying them on the consumer side.
+  *
+  * A ring is a named POSIX shared memory object that contains a fixed number of fixed-size slots, each of which holds
+  * one element. Producers either copy existing tensors into a slot, using [[write]], or claim a slot, using [[claim]],
+  * fill its byte buffer directly (e.g., while decoding), and then commit it. Consumers read elements using [[read]],
+  * which returns tensors over the slot memory itself, and a slot is recycled once all tensors of its element have been
+  * garbage collected (or otherwise deallocated). Any number of producers and consumers, in any number of processes,
+  * may use the same ring concurrently, and the elements are read in the order in which their slots were claimed.
+  *
+  * For example:
+  * {{{
+  *   // In the trainer process:
+  *   val ring = SharedMemoryRing.create("/batches", numSlots = 16, slotSize = 64L * 1024 * 1024)
+  *   val Some(Seq(images, labels)) = ring.read()
+  *
+  *   // In a preprocessing process:
+  *   val ring = SharedMemoryRing.open("/batches")
+  *   ring.write(Seq(images, labels))
+  * }}}
+  *
+  * Note that elements that are never deallocated (e.g., because the consumer process crashed while holding them) keep
+  * their slots occupied.
+  *
+  * @param  name Name of the ring.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class SharedMemoryRing private[io](val name: String, private[this] var nativeHandle: Long) extends Closeable {
+  private[this] object NativeHandleLock
+  private[this] var referenceCount: Int = 0
+
+  // Keep track of references in the Scala side and notify the native library when the ring is not referenced anymore
+  // anywhere in the Scala side. This will let the native library free the allocated resources and prevent a potential
+  // memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Number of slots of this ring. */
+  val numSlots: Int = NativeRing.sharedMemoryRingNumSlots(nativeHandle)
+
+  /** Size of each slot of this ring, in bytes. */
+  val slotSize: Long = NativeRing.sharedMemoryRingSlotSize(nativeHandle)
+
+  /** Copies `element` into the next free slot of this ring, waiting for at most `timeout` for a slot to become free.
+    *
+    * @param  element Tensors to write. All of them must be numeric tensors.
+    * @param  timeout Maximum time to wait for a free slot.
+    * @return `false` if no slot became free before the timeout, and `true` otherwise.
+    * @throws IllegalArgumentException If the element does not fit in a slot.
+    * @throws IllegalStateException    If this ring has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def write(element: Seq[Tensor], timeout: Duration = Duration.Inf): Boolean = {
+    require(element.size <= SharedMemoryRing.MAX_COMPONENTS,
+      s"Elements can have at most ${SharedMemoryRing.MAX_COMPONENTS} components.")
+    val end = SharedMemoryRing.componentOffsets(element.map(t => t.shape.numElements * t.dataType.byteSize)).last
+    require(end <= slotSize, s"The element ($end bytes) does not fit in a slot ($slotSize bytes).")
+    withNativeHandle(handle => {
+      NativeRing.sharedMemoryRingWrite(handle, element.map(_.nativeHandle).toArray, SharedMemoryRing.micros(timeout))
+    })
+  }
+
+  /** Claims the next free slot of this ring, waiting for at most `timeout` for a slot to become free, so that its
+    * contents can be written directly. The returned slot must always be committed, because consumers read the slots in
+    * the order in which they were claimed.
+    *
+    * @param  timeout Maximum time to wait for a free slot.
+    * @return Claimed slot, or `None` if no slot became free before the timeout.
+    * @throws IllegalStateException If this ring has already been closed.
+    */
+  @throws[IllegalStateException]
+  def claim(timeout: Duration = Duration.Inf): Option[SharedMemoryRing.Slot] = {
+    val sequence = Array(0L)
+    val buffer = withNativeHandle(NativeRing.sharedMemoryRingClaim(_, SharedMemoryRing.micros(timeout), sequence))
+    Option(buffer).map(b => new SharedMemoryRing.Slot(this, sequence(0), b))
+  }
+
+  /** Publishes a slot claimed using [[claim]], which contains components with the provided data types and shapes. */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  private[io] def commit(sequence: Long, components: Seq[(DataType, Shape)]): Unit = {
+    withNativeHandle(handle => NativeRing.sharedMemoryRingCommit(
+      handle, sequence, components.map(_._1.cValue).toArray, components.map(_._2.rank).toArray,
+      components.flatMap(_._2.asArray.map(_.toLong)).toArray,
+      components.map(c => c._2.numElements * c._1.byteSize).toArray))
+  }
+
+  /** Reads the next element of this ring, waiting for at most `timeout` for one to be written. The returned tensors are
+    * backed by the slot memory, which is recycled once they have all been deallocated.
+    *
+    * @param  timeout Maximum time to wait for an element.
+    * @return Element tensors, or `None` if no element was written before the timeout.
+    * @throws IllegalStateException If this ring has already been closed.
+    */
+  @throws[IllegalStateException]
+  def read(timeout: Duration = Duration.Inf): Option[Seq[Tensor]] = {
+    val tensorHandles = withNativeHandle(NativeRing.sharedMemoryRingRead(_, SharedMemoryRing.micros(timeout)))
+    Option(tensorHandles).map(_.map(Tensor.fromNativeHandle).toSeq)
+  }
+
+  /** Invokes `function` with the native handle of this ring, making sure that the ring is not closed meanwhile. */
+  @throws[IllegalStateException]
+  private[this] def withNativeHandle[T](function: Long => T): T = {
+    val handle = NativeHandleLock.synchronized {
+      if (nativeHandle == 0)
+        throw new IllegalStateException("This shared memory ring has already been closed.")
+      referenceCount += 1
+      nativeHandle
+    }
+    try {
+      function(handle)
+    } finally {
+      NativeHandleLock.synchronized {
+        referenceCount -= 1
+        if (referenceCount == 0)
+          NativeHandleLock.notifyAll()
+      }
+    }
+  }
+
+  /** Closes this ring, after any reads and writes in progress complete. If this ring was created by this process, its
+    * name is also removed, but the shared memory remains valid for as long as other processes have it open or any of
+    * the tensors read from it are alive. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      while (referenceCount > 0) {
+        try {
+          NativeHandleLock.wait()
+        } catch {
+          case _: InterruptedException =>
+            Thread.currentThread().interrupt()
+            return
+        }
+      }
+      NativeRing.deleteSharedMemoryRing(nativeHandle)
+      nativeHandle = 0
+    }
+  }
+}
+
+object SharedMemoryRing {
+  /** Maximum number of components of each element. */
+  val MAX_COMPONENTS: Int = 8
+
+  /** Alignment of the element components within each slot, in bytes. */
+  val COMPONENT_ALIGNMENT: Long = 64L
+
+  /** Slot claimed using [[SharedMemoryRing.claim]], whose contents can be written directly to [[buffer]].
+    *
+    * @param  ring     Ring that contains this slot.
+    * @param  sequence Sequence number of this slot.
+    * @param  buffer   Direct byte buffer over the data of this slot. The components of the element must be written at
+    *                  the offsets returned by [[SharedMemoryRing.componentOffsets]].
+    */
+  class Slot private[io](val ring: SharedMemoryRing, val sequence: Long, val buffer: ByteBuffer) {
+    private[this] var committed: Boolean = false
+
+    /** Publishes this slot, which contains components with the provided data types and shapes.
+      *
+      * @throws IllegalArgumentException If the components are invalid or do not fit in the slot, in which case an empty
+      *                                  element is published instead.
+      * @throws IllegalStateException    If this slot has already been committed.
+      */
+    @throws[IllegalArgumentException]
+    @throws[IllegalStateException]
+    def commit(components: Seq[(DataType, Shape)]): Unit = {
+      if (committed)
+        throw new IllegalStateException("This slot has already been committed.")
+      committed = true
+      ring.commit(sequence, components)
+    }
+  }
+
+  /** Returns the offsets, within a slot, of components with sizes `numBytes`, followed by the end of the last one. */
+  def componentOffsets(numBytes: Seq[Long]): Seq[Long] = {
+    val starts = numBytes.dropRight(1).scanLeft(0L)((offset, size) => {
+      (offset + size + COMPONENT_ALIGNMENT - 1) / COMPONENT_ALIGNMENT * COMPONENT_ALIGNMENT
+    })
+    if (numBytes.isEmpty) starts else starts :+ (starts.last + numBytes.last)
+  }
+
+  /** Creates a new ring named `name` (e.g., `"/batches"`), with `numSlots` slots of `slotSize` bytes each.
+    *
+    * @throws IllegalArgumentException If the number of slots or the slot size is not positive.
+    * @throws org.platanios.tensorflow.jni.AlreadyExistsException If a ring named `name` already exists.
+    */
+  def create(name: String, numSlots: Int, slotSize: Long): SharedMemoryRing = {
+    require(numSlots > 0, s"The number of slots ($numSlots) must be positive.")
+    require(slotSize > 0, s"The slot size ($slotSize) must be positive.")
+    new SharedMemoryRing(name, NativeRing.createSharedMemoryRing(name, numSlots, slotSize))
+  }
+
+  /** Opens an existing ring named `name`, which was created by another process (or by this one).
+    *
+    * @throws org.platanios.tensorflow.jni.NotFoundException If no ring named `name` exists.
+    */
+  def open(name: String): SharedMemoryRing = new SharedMemoryRing(name, NativeRing.openSharedMemoryRing(name))
+
+  private[io] def micros(timeout: Duration): Long = if (timeout.isFinite) timeout.toMicros else -1L
+}
@@ -0,0 +1,168 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.core.exception.OutOfRangeException
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni
+import org.platanios.tensorflow.jni.{RecordReader => NativeReader}
+
+import java.nio.{ByteBuffer, ByteOrder}
+import java.nio.file.Path
+
+/** TFRecord file reader that reads records ahead of time, on a native I/O thread.
+  *
+  * Records are read into a bounded native buffer while the consumer processes the previously read records, which hides
+  * the latency of remote file systems (e.g., GCS or HDFS). They are then transferred to the JVM in batches, so that
+  * reading each record does not require a separate native call.
+  *
+  * @param  filePath           Path to the file being read.
+  * @param  compressionType    Compression type used for the file.
+  * @param  maxBufferedRecords Maximum number of records to read ahead of time.
+  * @param  maxBufferedBytes   Maximum number of bytes to read ahead of time.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class TFRecordReader(
+    val filePath: Path,
+    val compressionType: CompressionType = NoCompression,
+    val maxBufferedRecords: Long = 1024L,
+    val maxBufferedBytes: Long = 16L * 1024L * 1024L
+) extends Closeable with Loader[Array[Byte]] {
+  private[this] var nativeHandle: Long = {
+    NativeReader.newPrefetchingRecordReaderWrapper(
+      filePath.toAbsolutePath.toString, compressionType.name, 0L, maxBufferedRecords, maxBufferedBytes)
+  }
+
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the reader is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Returns an iterator over the records stored in the file, starting from the current offset of this reader. The
+    * iterator ends when the end of the file is reached. */
+  override def load(): Iterator[Array[Byte]] = new TFRecordReader.BatchedRecordIterator(
+    NativeHandleLock,
+    buffer => NativeReader.prefetchingRecordReaderWrapperReadBatch(
+      nativeHandle, TFRecordReader.BATCH_SIZE, TFRecordReader.BUFFER_SIZE, buffer),
+    () => NativeReader.prefetchingRecordReaderWrapperReadNext(nativeHandle))
+
+  /** Returns the offset in the file right after the last record that was transferred from the native reader. */
+  def offset: Long = NativeHandleLock.synchronized {
+    NativeReader.prefetchingRecordReaderWrapperOffset(nativeHandle)
+  }
+
+  /** Returns statistics about the read-ahead buffer of this reader (e.g., the total time spent waiting for records to
+    * be read). */
+  def statistics: TFRecordReader.Statistics = NativeHandleLock.synchronized {
+    NativeReader.prefetchingRecordReaderWrapperStatistics(nativeHandle)
+  }
+
+  /** Closes this reader and releases any resources associated with it, including its I/O thread. Note that a reader is
+    * not usable after it has been closed. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        NativeReader.deletePrefetchingRecordReaderWrapper(nativeHandle)
+        nativeHandle = 0
+      }
+    }
+  }
+}
+
+object TFRecordReader {
+  type Statistics = jni.RecordReaderStatistics
+
+  val Statistics: jni.RecordReaderStatistics.type = jni.RecordReaderStatistics
+
+  /** Maximum number of records transferred from the native reader per call. */
+  private[io] val BATCH_SIZE: Int = 1024
+
+  /** Size (in bytes) of the buffer used to transfer records from the native reader. */
+  private[io] val BUFFER_SIZE: Int = 1 << 20
+
+  /** Iterator over records that are transferred from a native reader in batches, through a direct buffer.
+    *
+    * @param  lock      Lock held while calling into the native reader.
+    * @param  readBatch Function that fills the provided buffer with length-prefixed records and returns their number,
+    *                   which is zero if the next record does not fit in the buffer.
+    * @param  readNext  Function that reads the next record on its own.
+    */
+  private[io] class BatchedRecordIterator(
+      lock: AnyRef,
+      readBatch: ByteBuffer => Int,
+      readNext: () => Array[Byte]
+  ) extends Iterator[Array[Byte]] {
+    /** Buffer holding the records that have been transferred from the native reader but not consumed yet. */
+    private[this] val buffer: ByteBuffer = ByteBuffer.allocateDirect(BUFFER_SIZE).order(ByteOrder.LITTLE_ENDIAN)
+
+    /** Number of records in `buffer` that have not been consumed yet. */
+    private[this] var numBufferedRecords: Int = 0
+
+    /** Caches the next record. */
+    private[this] var nextRecord: Array[Byte] = _
+
+    private[this] def read(): Array[Byte] = lock.synchronized {
+      try {
+        if (numBufferedRecords == 0) {
+          numBufferedRecords = readBatch(buffer)
+          buffer.clear()
+        }
+        if (numBufferedRecords > 0) {
+          numBufferedRecords -= 1
+          val record = new Array[Byte](buffer.getInt())
+          buffer.get(record)
+          record
+        } else {
+          // The next record is too large to fit in the buffer.
+          readNext()
+        }
+      } catch {
+        case _: OutOfRangeException => null
+      }
+    }
+
+    override def hasNext: Boolean = {
+      if (nextRecord == null)
+        nextRecord = read()
+      nextRecord != null
+    }
+
+    override def next(): Array[Byte] = {
+      if (!hasNext)
+        throw new NoSuchElementException("No more records available.")
+      val record = nextRecord
+      nextRecord = null
+      record
+    }
+  }
+
+  /** Creates a new TFRecord file reader.
+    *
+    * @param  filePath           Path to the file being read.
+    * @param  compressionType    Compression type used for the file.
+    * @param  maxBufferedRecords Maximum number of records to read ahead of time.
+    * @param  maxBufferedBytes   Maximum number of bytes to read ahead of time.
+    * @return Newly constructed TFRecord file reader.
+    */
+  def apply(
+      filePath: Path, compressionType: CompressionType = NoCompression, maxBufferedRecords: Long = 1024L,
+      maxBufferedBytes: Long = 16L * 1024L * 1024L): TFRecordReader = {
+    new TFRecordReader(filePath, compressionType, maxBufferedRecords, maxBufferedBytes)
+  }
+}
@@ -0,0 +1,133 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{RecordWriter => NativeWriter}
+
+import java.nio.{ByteBuffer, ByteOrder}
+import java.nio.file.Path
+
+/** TFRecord file writer.
+  *
+  * Records are framed (i.e., length-prefixed and checksummed) and optionally compressed natively. Multiple records can
+  * be written at once, using `write(records)`, in which case they are transferred to the native writer in batches
+  * through a direct buffer, so that writing each record does not require a separate native call.
+  *
+  * @param  filePath        Path to the file being written.
+  * @param  compressionType Compression type to use for the file.
+  * @param  append          If `true`, records are appended to the file, if it already exists. Otherwise, the file is
+  *                         truncated.
+  * @param  flushInterval   If positive, the writer is flushed every `flushInterval` milliseconds, on a native
+  *                         background thread.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class TFRecordWriter(
+    val filePath: Path,
+    val compressionType: CompressionType = NoCompression,
+    val append: Boolean = false,
+    val flushInterval: Long = 0L
+) extends Closeable {
+  private[this] var nativeHandle: Long = {
+    NativeWriter.newRecordWriter(filePath.toAbsolutePath.toString, compressionType.name, append, flushInterval)
+  }
+
+  private[this] object NativeHandleLock
+
+  /** Buffer used to transfer records to the native writer. It is only allocated if batches of records are written. */
+  private[this] var buffer: ByteBuffer = _
+
+  // Keep track of references in the Scala side and notify the native library when the writer is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Writes `record` to the file. */
+  def write(record: Array[Byte]): Unit = NativeHandleLock.synchronized {
+    NativeWriter.recordWriterWrite(nativeHandle, record)
+  }
+
+  /** Writes `records` to the file, in order. */
+  def write(records: Iterable[Array[Byte]]): Unit = NativeHandleLock.synchronized {
+    if (buffer == null)
+      buffer = ByteBuffer.allocateDirect(TFRecordWriter.BUFFER_SIZE).order(ByteOrder.LITTLE_ENDIAN)
+    var numRecords = 0
+    records.foreach(record => {
+      if (4 + record.length > buffer.remaining()) {
+        writeBuffer(numRecords)
+        numRecords = 0
+      }
+      if (4 + record.length > buffer.remaining()) {
+        // The record is too large to fit in the buffer.
+        NativeWriter.recordWriterWrite(nativeHandle, record)
+      } else {
+        buffer.putInt(record.length)
+        buffer.put(record)
+        numRecords += 1
+      }
+    })
+    writeBuffer(numRecords)
+  }
+
+  /** Transfers the `numRecords` records stored in `buffer` to the native writer and clears `buffer`. */
+  private[this] def writeBuffer(numRecords: Int): Unit = {
+    if (numRecords > 0)
+      NativeWriter.recordWriterWriteBatch(nativeHandle, buffer, buffer.position(), numRecords)
+    buffer.clear()
+  }
+
+  /** Pushes all written records to the file system. */
+  def flush(): Unit = NativeHandleLock.synchronized {
+    NativeWriter.recordWriterFlush(nativeHandle)
+  }
+
+  /** Flushes and closes the file, and releases any resources associated with this writer, including its background
+    * flushing thread. Note that a writer is not usable after it has been closed. */
+  override def close(): Unit = {
+    NativeHandleLock.synchronized {
+      if (nativeHandle != 0) {
+        try {
+          NativeWriter.recordWriterClose(nativeHandle)
+        } finally {
+          NativeWriter.deleteRecordWriter(nativeHandle)
+          nativeHandle = 0
+        }
+      }
+    }
+  }
+}
+
+object TFRecordWriter {
+  /** Size (in bytes) of the buffer used to transfer records to the native writer. */
+  private[io] val BUFFER_SIZE: Int = 1 << 20
+
+  /** Creates a new TFRecord file writer.
+    *
+    * @param  filePath        Path to the file being written.
+    * @param  compressionType Compression type to use for the file.
+    * @param  append          If `true`, records are appended to the file, if it already exists. Otherwise, the file is
+    *                         truncated.
+    * @param  flushInterval   If positive, the writer is flushed every `flushInterval` milliseconds, on a native
+    *                         background thread.
+    * @return Newly constructed TFRecord file writer.
+    */
+  def apply(
+      filePath: Path, compressionType: CompressionType = NoCompression, append: Boolean = false,
+      flushInterval: Long = 0L): TFRecordWriter = {
+    new TFRecordWriter(filePath, compressionType, append, flushInterval)
+  }
+}
@@ -0,0 +1,164 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io
+
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.ops.{Op, Output}
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{TensorProducer => NativeProducer}
+
+import scala.concurrent.duration.Duration
+
+/** Tensor producer, used to feed elements (i.e., lists of tensors, such as batches of features and labels) from JVM
+  * threads directly into a graph, without running a session for each element.
+  *
+  * Feeding a queue or a staging area normally requires a separate `Session.run` call for each enqueued element, which
+  * adds a full session step (feed conversion, graph pruning, executor setup, etc.) per batch. Instead, any number of
+  * JVM threads may [[push]] elements into a producer, which holds up to `capacity` of them, and the graph consumes them
+  * using the op returned by [[dequeue]], which behaves like a queue dequeue op. The pushed tensors are not copied, and
+  * pushes block while the producer is full, which provides back-pressure to the producing threads.
+  *
+  * For example:
+  * {{{
+  *   val producer = TensorProducer(capacity = 4)
+  *   val Seq(images, labels) = producer.dequeue(Seq(FLOAT32, INT32), Seq(Shape(-1, 784), Shape(-1)))
+  *   // The dequeued element can be consumed directly, or staged using `StagingArea.put`, in which case the staging
+  *   // area put op is simply run as part of the training step.
+  *   val loss = ...
+  *
+  *   // In one or more loading threads:
+  *   producer.push(Seq(imagesBatch, labelsBatch))
+  *   ...
+  *   producer.finish()
+  * }}}
+  *
+  * The dequeue ops refer to the producer directly, and so a producer must not be closed while sessions that may run
+  * them are still open.
+  *
+  * @param  capacity Maximum number of elements that can be buffered.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class TensorProducer private[io](val capacity: Long, private[this] var nativeHandle: Long) extends Closeable {
+  private[this] object NativeHandleLock
+  private[this] var referenceCount: Int = 0
+
+  // Keep track of references in the Scala side and notify the native library when the producer is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** String representation of the native producer pointer, used by the dequeue ops. */
+  private[this] val pointer: String = NativeProducer.pointer(nativeHandle)
+
+  /** Number of elements currently buffered in this producer. */
+  @throws[IllegalStateException]
+  def size: Long = withNativeHandle(NativeProducer.size)
+
+  /** Pushes `element` into this producer, waiting for at most `timeout` for it to have space for it.
+    *
+    * @param  element Tensors to push. They are not copied and must not be modified afterwards.
+    * @param  timeout Maximum time to wait for space in this producer.
+    * @return `false` if this producer did not have space for the element before the timeout, and `true` otherwise.
+    * @throws IllegalStateException If this producer has already been closed.
+    * @throws org.platanios.tensorflow.jni.CancelledException If this producer has already been finished.
+    */
+  @throws[IllegalStateException]
+  def push(element: Seq[Tensor], timeout: Duration = Duration.Inf): Boolean = {
+    val micros = if (timeout.isFinite) timeout.toMicros else -1L
+    withNativeHandle(NativeProducer.push(_, element.map(_.nativeHandle).toArray, micros))
+  }
+
+  /** Creates an op that dequeues the next element of this producer, blocking until one is available. Once this
+    * producer has been finished and all of its elements have been dequeued, the op fails with an out-of-range error, in
+    * the same way as queue dequeue ops do when their queue is closed.
+    *
+    * @param  dataTypes Data types of the element components.
+    * @param  shapes    Optional (possibly partially-known) shapes of the element components.
+    * @param  name      Name for the created op.
+    * @return Created op outputs, one for each element component.
+    */
+  def dequeue(
+      dataTypes: Seq[DataType],
+      shapes: Seq[Shape] = Seq.empty,
+      name: String = "TensorProducerDequeue"
+  ): Seq[Output] = {
+    require(dataTypes.nonEmpty, "The elements must have at least one component.")
+    require(shapes.isEmpty || shapes.size == dataTypes.size,
+      s"The number of shapes (${shapes.size}) must match the number of data types (${dataTypes.size}).")
+    Op.Builder(opType = "TensorProducerDequeue", name = name)
+        .setAttribute("producer_pointer", pointer)
+        .setAttribute("component_types", dataTypes.toArray)
+        .setAttribute("shapes", shapes.toArray)
+        .build().outputs.toSeq
+  }
+
+  /** Finishes this producer, which signals the end of its input. Pending and future pushes fail and the dequeue ops
+    * fail with an out-of-range error once all buffered elements have been dequeued. */
+  @throws[IllegalStateException]
+  def finish(): Unit = withNativeHandle(NativeProducer.close)
+
+  /** Invokes `function` with the native handle of this producer, making sure that it is not closed meanwhile. */
+  @throws[IllegalStateException]
+  private[this] def withNativeHandle[T](function: Long => T): T = {
+    val handle = NativeHandleLock.synchronized {
+      if (nativeHandle == 0)
+        throw new IllegalStateException("This tensor producer has already been closed.")
+      referenceCount += 1
+      nativeHandle
+    }
+    try {
+      function(handle)
+    } finally {
+      NativeHandleLock.synchronized {
+        referenceCount -= 1
+        if (referenceCount == 0)
+          NativeHandleLock.notifyAll()
+      }
+    }
+  }
+
+  /** Closes this producer, after finishing it and waiting for any pushes in progress to complete. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      NativeProducer.close(nativeHandle)
+      while (referenceCount > 0) {
+        try {
+          NativeHandleLock.wait()
+        } catch {
+          case _: InterruptedException =>
+            Thread.currentThread().interrupt()
+            return
+        }
+      }
+      NativeProducer.delete(nativeHandle)
+      nativeHandle = 0
+    }
+  }
+}
+
+object TensorProducer {
+  /** Creates a new tensor producer that can buffer up to `capacity` elements.
+    *
+    * @throws IllegalArgumentException If the capacity is not positive.
+    */
+  def apply(capacity: Long): TensorProducer = {
+    require(capacity > 0, s"The capacity ($capacity) must be positive.")
+    new TensorProducer(capacity, NativeProducer.allocate(capacity))
+  }
+}
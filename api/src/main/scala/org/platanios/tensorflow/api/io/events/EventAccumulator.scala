@@ -69,6 +69,9 @@ case class EventAccumulator(
 
   private[this] object EventLoaderLock
 
+  /** Native scanner used by `scanScalars()`, which is created the first time it is used. */
+  private[this] lazy val scanner: EventScanner = EventScanner(reservoirSize = _actualSizeGuidance(ScalarEventType))
+
   private[this] var _firstEventTimeStamp: Double = -1.0
   private[this] var _fileVersion        : Float  = -1.0f
 
@@ -130,6 +133,29 @@ case class EventAccumulator(
     _reservoirs(ScalarEventType).asInstanceOf[Reservoir[String, ScalarEventRecord]].items(tag)
   }
 
+  /** Returns the scalar summaries associated with the provided tag, using a native [[EventScanner]] instead of loading
+    * the events on the JVM.
+    *
+    * The event files are scanned natively and in parallel, and each call only reads the events that were written since
+    * the previous call. The values are reservoir sampled natively, according to the size guidance for scalars, and are
+    * stored as packed arrays, and so their memory footprint is bounded and much smaller than that of `scalars()`.
+    * Filtering by step and downsampling are also performed natively. Note that, unlike `scalars()`, this method does
+    * not purge orphaned data.
+    *
+    * @param  tag       Summary tag.
+    * @param  minStep   Minimum step (inclusive) of the returned values.
+    * @param  maxStep   Maximum step (inclusive) of the returned values.
+    * @param  maxPoints If positive, the values are downsampled to at most `maxPoints` evenly spaced values.
+    * @return Scalar summary values.
+    */
+  def scanScalars(
+      tag: String, minStep: Long = Long.MinValue, maxStep: Long = Long.MaxValue,
+      maxPoints: Int = 0): EventScanner.Scalars = {
+    val files = EventScanner.eventFiles(path)
+    scanner.scan(files)
+    scanner.scalars(files, tag, minStep, maxStep, maxPoints)
+  }
+
   /** Returns all image events associated with the provided summary tag. */
   def images(tag: String): List[ImageEventRecord] = {
     _reservoirs(ImageEventType).asInstanceOf[Reservoir[String, ImageEventRecord]].items(tag)
@@ -24,6 +24,7 @@ import com.typesafe.scalalogging.Logger
 import org.slf4j.LoggerFactory
 import org.tensorflow.util.Event
 
+import java.nio.{ByteBuffer, ByteOrder}
 import java.nio.file.Path
 
 /** Event file reader.
@@ -58,10 +59,36 @@ class EventFileReader(val filePath: Path, val compressionType: CompressionType =
     /** Caches the next event stored in the file. */
     private[this] var nextEvent: Event = _
 
-    /** Reads the next event stored in the file. */
+    /** Buffer holding the records that have been read from the file but not consumed yet. */
+    private[this] val buffer: ByteBuffer = {
+      ByteBuffer.allocateDirect(EventFileReader.BUFFER_SIZE).order(ByteOrder.LITTLE_ENDIAN)
+    }
+
+    /** Number of records in `buffer` that have not been consumed yet. */
+    private[this] var numBufferedRecords: Int = 0
+
+    /** Reads the next event stored in the file. Records are read from the file in batches, so that reading each event
+      * does not require a separate native call. */
     private[this] def readNext(): Event = {
       try {
-        Event.parseFrom(NativeReader.recordReaderWrapperReadNext(nativeHandle))
+        if (numBufferedRecords == 0) {
+          numBufferedRecords = NativeHandleLock.synchronized {
+            NativeReader.recordReaderWrapperReadBatch(
+              nativeHandle, EventFileReader.BATCH_SIZE, EventFileReader.BUFFER_SIZE, buffer)
+          }
+          buffer.clear()
+        }
+        if (numBufferedRecords > 0) {
+          numBufferedRecords -= 1
+          val length = buffer.getInt()
+          val record = buffer.slice()
+          record.limit(length)
+          buffer.position(buffer.position() + length)
+          Event.parseFrom(record)
+        } else {
+          // The next record is too large to fit in the buffer.
+          Event.parseFrom(NativeReader.recordReaderWrapperReadNext(nativeHandle))
+        }
       } catch {
         case _: OutOfRangeException | _: DataLossException =>
           // We ignore partial read exceptions, because a record may be truncated. The record readers holds the offset
@@ -105,6 +132,12 @@ class EventFileReader(val filePath: Path, val compressionType: CompressionType =
 private[io] object EventFileReader {
   private[EventFileReader] val logger: Logger = Logger(LoggerFactory.getLogger("Event File Reader"))
 
+  /** Maximum number of records read from the file per native call. */
+  private[EventFileReader] val BATCH_SIZE: Int = 1024
+
+  /** Size (in bytes) of the buffer used to read records from the file. */
+  private[EventFileReader] val BUFFER_SIZE: Int = 1 << 20
+
   /** Creates a new events file reader.
     *
     * @param  filePath        Path to the file being read.
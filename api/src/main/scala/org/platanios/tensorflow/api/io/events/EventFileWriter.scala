@@ -15,16 +15,18 @@
 
 package org.platanios.tensorflow.api.io.events
 
-import org.platanios.tensorflow.api.utilities.{CRC32C, Coding}
+import org.platanios.tensorflow.api.io.TFRecordWriter
 
 import com.typesafe.scalalogging.Logger
 import org.slf4j.LoggerFactory
 import org.tensorflow.util.Event
 
-import java.io.BufferedOutputStream
-import java.nio.file.{Files, Path, StandardOpenOption}
+import java.nio.file.{Files, Path}
+import java.util
 import java.util.concurrent.{BlockingQueue, LinkedBlockingDeque}
 
+import scala.collection.JavaConverters._
+
 /** Writes `Event` protocol buffers to files.
   *
   * The `EventFileWriter` class creates an event file in the specified directory and asynchronously writes `Event`
@@ -33,6 +35,11 @@ import java.util.concurrent.{BlockingQueue, LinkedBlockingDeque}
   * On construction the event file writer creates a new event file in `workingDir`. This event file will contain `Event`
   * protocol buffers, which are written to disk via the `EventFileWriter.write()` method.
   *
+  * Events are queued and written by a dedicated background thread, which drains all pending events from the queue at
+  * once, serializes them, and passes them to the native record writer as a single batch. The native writer frames the
+  * records and flushes them to disk every `flushFrequency` seconds on its own background thread. Thus, writing an event
+  * from the training loop only costs enqueueing it.
+  *
   * @param  workingDir     Directory in which to write the event file.
   * @param  queueCapacity  Maximum number of events pending to be written to disk before a call to `write()` blocks.
   * @param  flushFrequency Specifies how often to flush the written events to disk (in seconds).
@@ -50,29 +57,42 @@ class EventFileWriter private[io](
 
   private[this] var _closed: Boolean = false
 
-  private[this] val queue            : BlockingQueue[Event] = new LinkedBlockingDeque[Event](queueCapacity)
-  private[this] val sentinelEvent    : Event                = Event.newBuilder().build()
-  private[this] var eventWriter      : EventWriter          = new EventWriter(workingDir, "events", filenameSuffix)
-  private[this] var eventWriterThread: Thread               = newEventWriterThread()
+  private[this] val queue            : BlockingQueue[() => Event] = new LinkedBlockingDeque[() => Event](queueCapacity)
+  private[this] val sentinelEvent    : () => Event                = () => null
+  private[this] var eventWriter      : EventWriter                = newEventWriter()
+  private[this] var eventWriterThread: Thread                     = newEventWriterThread()
+
+  /** Number of events that have been queued, but not written yet. */
+  private[this] var numPendingEvents: Long = 0L
+
+  private[this] object PendingEventsLock
 
   eventWriterThread.start()
 
   /** Writes the provided event to the event file. */
-  def write(event: Event): Unit = {
+  def write(event: Event): Unit = writeDeferred(event)
+
+  /** Writes the event created by `event` to the event file. `event` is evaluated on the event writer thread, after all
+    * previously written events, which allows subclasses to move the cost of constructing events off the calling thread
+    * (e.g., parsing serialized summaries). */
+  protected[events] def writeDeferred(event: => Event): Unit = {
     if (!_closed)
-      queue.put(event)
+      enqueue(() => event)
   }
 
   /** Pushes outstanding events to disk. */
-  def flush(): Unit = queue synchronized {
-    while (!queue.isEmpty)
-      queue.wait()
+  def flush(): Unit = {
+    PendingEventsLock synchronized {
+      while (numPendingEvents > 0)
+        PendingEventsLock.wait()
+    }
     eventWriter.flush()
   }
 
   /** Calls `flush()` and then closes the current event file. */
   def close(): Unit = {
-    write(sentinelEvent)
+    if (!_closed)
+      enqueue(sentinelEvent)
     flush()
     eventWriterThread.join()
     eventWriter.close()
@@ -85,36 +105,45 @@ class EventFileWriter private[io](
   /** Reopens this event file writer. */
   def reopen(): Unit = {
     if (_closed) {
-      eventWriter = new EventWriter(workingDir, "events", filenameSuffix)
+      eventWriter = newEventWriter()
       eventWriterThread = newEventWriterThread()
       eventWriterThread.start()
       _closed = false
     }
   }
 
-  /** Creates a thread that pulls events from the queue and writes them to the event file. */
+  private[this] def enqueue(event: () => Event): Unit = {
+    PendingEventsLock synchronized {
+      numPendingEvents += 1
+    }
+    queue.put(event)
+  }
+
+  /** Creates an event writer for a new event file, which is flushed every `flushFrequency` seconds. */
+  private[this] def newEventWriter(): EventWriter = {
+    new EventWriter(workingDir, "events", filenameSuffix, flushInterval = flushFrequency * 1000L)
+  }
+
+  /** Creates a thread that pulls batches of events from the queue and writes them to the event file. */
   private[this] def newEventWriterThread(): Thread = {
     val thread = new Thread(new Runnable {
-      // The first event will be flushed immediately.
-      private[this] var nextEventFlushTime: Int = 0
-
       override def run(): Unit = {
+        val batch = new util.ArrayList[() => Event]()
         var sentinelReceived = false
         while (!sentinelReceived) {
-          val event = queue.take()
-          if (event == sentinelEvent)
-            sentinelReceived = true
-          else
-            eventWriter.write(event)
-          queue synchronized {
-            if (queue.isEmpty)
-              queue.notify()
-          }
-          // Flush the event writer every so often.
-          val currentTime = System.currentTimeMillis() / 1000
-          if (currentTime > nextEventFlushTime) {
-            eventWriter.flush()
-            nextEventFlushTime += flushFrequency
+          batch.add(queue.take())
+          queue.drainTo(batch)
+          try {
+            val events = batch.asScala.takeWhile(_ ne sentinelEvent)
+            sentinelReceived = events.size < batch.size
+            eventWriter.write(events.map(_.apply()))
+          } finally {
+            PendingEventsLock synchronized {
+              numPendingEvents -= batch.size
+              if (numPendingEvents == 0)
+                PendingEventsLock.notifyAll()
+            }
+            batch.clear()
           }
         }
       }
@@ -148,15 +177,18 @@ object EventFileWriter {
   * @param  workingDir     Directory in which to write the event file.
   * @param  filenamePrefix Filename prefix to use for the event file.
   * @param  filenameSuffix Filename suffix to use for the event file.
+  * @param  flushInterval  If positive, the event file is flushed every `flushInterval` milliseconds, on a native
+  *                        background thread.
   */
 private[io] class EventWriter private[io](
     val workingDir: Path,
     val filenamePrefix: String,
-    val filenameSuffix: String = ""
+    val filenameSuffix: String = "",
+    val flushInterval: Long = 0L
 ) {
-  private[this] var _filePath            : Path                  = _
-  private[this] var _fileStream          : Option[BufferedOutputStream] = None
-  private[this] var _numOutstandingEvents: Int                   = 0
+  private[this] var _filePath            : Path                   = _
+  private[this] var _recordWriter        : Option[TFRecordWriter] = None
+  private[this] var _numOutstandingEvents: Int                    = 0
 
   /** Returns the path of the current events file. */
   def filePath: Path = {
@@ -174,7 +206,7 @@ private[io] class EventWriter private[io](
     */
   def initialize(): Unit = {
     var initialized = false
-    if (_fileStream.isDefined) {
+    if (_recordWriter.isDefined) {
       if (fileHasDisappeared) {
         // Warn the user about the data loss and then do some basic cleanup.
         if (_numOutstandingEvents > 0)
@@ -190,8 +222,8 @@ private[io] class EventWriter private[io](
       val currentTime = System.currentTimeMillis().toDouble / 1000.0
       val hostname = java.net.InetAddress.getLocalHost.getHostName
       _filePath = workingDir.resolve(f"$filenamePrefix.out.tfevents.${currentTime.toInt}%010d.$hostname$filenameSuffix")
-      _fileStream = Some(new BufferedOutputStream(Files.newOutputStream(
-        _filePath, StandardOpenOption.CREATE_NEW, StandardOpenOption.APPEND)))
+      _recordWriter.foreach(_.close())
+      _recordWriter = Some(TFRecordWriter(_filePath, flushInterval = flushInterval))
       _numOutstandingEvents = 0
       // Write the first event with the current version, and flush right away so the file contents can be easily
       // determined.
@@ -208,27 +240,28 @@ private[io] class EventWriter private[io](
     if (_filePath == null)
       initialize()
     _numOutstandingEvents += 1
-    val recordBytes = event.toByteArray
-    // Format of a single record:
-    //  uint64    length
-    //  uint32    masked crc of length
-    //  byte      data[length]
-    //  uint32    masked crc of data
-    val encLength = Coding.encodeFixedInt64(recordBytes.length)
-    val encLengthMaskedCrc = Coding.encodeFixedInt32(CRC32C.mask(CRC32C.value(encLength)))
-    val encDataMaskedCrc = Coding.encodeFixedInt32(CRC32C.mask(CRC32C.value(recordBytes)))
-    _fileStream.foreach(_.write(encLength ++ encLengthMaskedCrc ++ recordBytes ++ encDataMaskedCrc))
+    _recordWriter.foreach(_.write(event.toByteArray))
+  }
+
+  /** Appends `events` to the events file, in order, using a single batched write. */
+  def write(events: Seq[Event]): Unit = {
+    if (events.nonEmpty) {
+      if (_filePath == null)
+        initialize()
+      _numOutstandingEvents += events.size
+      _recordWriter.foreach(_.write(events.map(_.toByteArray)))
+    }
   }
 
   /** Pushes outstanding events to disk. */
   def flush(): Unit = {
-    _fileStream.foreach(_.flush())
+    _recordWriter.foreach(_.flush())
     _numOutstandingEvents = 0
   }
 
   /** Calls `flush()` and then closes the current event file. */
   def close(): Unit = {
-    _fileStream.foreach(_.close())
+    _recordWriter.foreach(_.close())
     _numOutstandingEvents = 0
   }
 
@@ -79,6 +79,10 @@ case class EventMultiplexer(
 
   private[this] var reloadCalled: Boolean = false
 
+  /** Native scanner used by `scanScalars()`, which is created the first time it is used. */
+  private[this] lazy val scanner: EventScanner = EventScanner(
+    reservoirSize = (EventAccumulator.DEFAULT_SIZE_GUIDANCE ++ sizeGuidance)(ScalarEventType))
+
   // Initialize the multiplexer for the provided run paths.
   initialRunPaths.foreach(p => addRun(p._2, p._1))
 
@@ -192,6 +196,29 @@ case class EventMultiplexer(
     accumulator(run).map(_.scalars(tag))
   }
 
+  /** Returns the scalar summaries associated with the provided tag for each run, using a native [[EventScanner]]
+    * instead of the event accumulators.
+    *
+    * The event files of all runs are scanned natively and in parallel, and each call only reads the events that were
+    * written since the previous call. Filtering by step and downsampling are also performed natively. This is much
+    * faster than using `reload()` and `scalars()` for large log directories that are polled continuously. The values
+    * of each event file are reservoir sampled natively, according to the size guidance for scalars, and are stored as
+    * packed arrays, which bounds the memory used for long runs. Note that this method does not purge orphaned data.
+    *
+    * @param  tag       Summary tag.
+    * @param  minStep   Minimum step (inclusive) of the returned values.
+    * @param  maxStep   Maximum step (inclusive) of the returned values.
+    * @param  maxPoints If positive, the values of each run are downsampled to at most `maxPoints` evenly spaced values.
+    * @return Map from run names to scalar summary values.
+    */
+  def scanScalars(
+      tag: String, minStep: Long = Long.MinValue, maxStep: Long = Long.MaxValue,
+      maxPoints: Int = 0): Map[String, EventScanner.Scalars] = {
+    val runFiles = runPaths.map(p => p._1 -> EventScanner.eventFiles(p._2))
+    scanner.scan(runFiles.values.flatten.toSeq)
+    runFiles.map(r => r._1 -> scanner.scalars(r._2, tag, minStep, maxStep, maxPoints))
+  }
+
   /** Returns all image events associated with the provided run and summary tag. */
   def images(run: String, tag: String): Option[List[ImageEventRecord]] = {
     accumulator(run).map(_.images(tag))
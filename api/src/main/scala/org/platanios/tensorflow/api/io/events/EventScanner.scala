@@ -0,0 +1,148 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.io.events
+
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{EventScanner => NativeScanner}
+
+import java.nio.file.{Files, Path}
+
+import scala.collection.JavaConverters._
+
+/** Native scanner of the scalar summaries stored in event files.
+  *
+  * Unlike [[EventAccumulator]], which parses every `Event` on the JVM, an event scanner parses the event files
+  * natively, reading multiple files in parallel, and only keeps the scalar summary values whose tags are in `tags`
+  * (or all scalar summary values, if `tags` is empty), stored as packed arrays. Scans are incremental: scanning a file
+  * again only reads the records that were appended to it since it was last scanned, which makes polling large log
+  * directories that are still being written to cheap. Filtering by step and downsampling are also performed natively.
+  *
+  * If `reservoirSize` is positive, the values of each file and tag are reservoir sampled natively, in the same way as
+  * by [[org.platanios.tensorflow.api.utilities.Reservoir]] (i.e., uniformly, while always keeping the most recent
+  * value), and so the memory used by the scanner is bounded, irrespective of the length of the runs.
+  *
+  * @param  tags          Tags of the scalar summaries to keep. If empty, all scalar summaries are kept.
+  * @param  reservoirSize Maximum number of values kept per file and tag. If `0`, all values are kept.
+  * @param  seed          Seed for the random number generators used for reservoir sampling.
+  * @param  numThreads    Number of threads used to scan files in parallel.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class EventScanner private[events] (
+    val tags: Set[String], val reservoirSize: Int, val seed: Long, val numThreads: Int) extends Closeable {
+  private[this] var nativeHandle: Long = NativeScanner.newEventScanner(tags.toArray, reservoirSize, seed, numThreads)
+
+  private[this] object NativeHandleLock
+
+  // Keep track of references in the Scala side and notify the native library when the scanner is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Reads the events that were appended to `files` since they were last scanned (or all of their events, for files
+    * that are scanned for the first time). Truncated records at the end of a file (e.g., because the file is still
+    * being written to) are read by the next scan. */
+  def scan(files: Seq[Path]): Unit = NativeHandleLock.synchronized {
+    NativeScanner.eventScannerScan(nativeHandle, EventScanner.filenames(files))
+  }
+
+  /** Returns the sorted tags of the scalar summaries found in `files` by previous scans. */
+  def scalarTags(files: Seq[Path]): Seq[String] = NativeHandleLock.synchronized {
+    NativeScanner.eventScannerTags(nativeHandle, EventScanner.filenames(files)).toSeq
+  }
+
+  /** Returns the scalar summaries with tag `tag` found in `files` by previous scans.
+    *
+    * The values are returned in the order of `files` and, within each file, in the order in which they were written.
+    *
+    * @param  files     Event files.
+    * @param  tag       Summary tag.
+    * @param  minStep   Minimum step (inclusive) of the returned values.
+    * @param  maxStep   Maximum step (inclusive) of the returned values.
+    * @param  maxPoints If positive and more values are found, they are downsampled to `maxPoints` evenly spaced values,
+    *                   always keeping the last one.
+    * @return Scalar summary values.
+    */
+  def scalars(
+      files: Seq[Path], tag: String, minStep: Long = Long.MinValue, maxStep: Long = Long.MaxValue,
+      maxPoints: Int = 0): EventScanner.Scalars = NativeHandleLock.synchronized {
+    val scalars = NativeScanner.eventScannerScalars(
+      nativeHandle, EventScanner.filenames(files), tag, minStep, maxStep, maxPoints)
+    EventScanner.Scalars(scalars.steps, scalars.wallTimes, scalars.values)
+  }
+
+  /** Closes this scanner and releases any resources associated with it. Note that an event scanner is not usable after
+    * it has been closed. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      NativeScanner.deleteEventScanner(nativeHandle)
+      nativeHandle = 0
+    }
+  }
+}
+
+object EventScanner {
+  /** Scalar summary values of a single tag, stored as packed arrays.
+    *
+    * @param  steps     Step of each value.
+    * @param  wallTimes Wall time of each value, in seconds.
+    * @param  values    Values.
+    */
+  case class Scalars(steps: Array[Long], wallTimes: Array[Double], values: Array[Double]) {
+    /** Number of values. */
+    def size: Int = steps.length
+
+    /** Returns the values as scalar event records. */
+    def records: Seq[ScalarEventRecord] = {
+      steps.indices.map(i => ScalarEventRecord(wallTimes(i), steps(i), values(i).toFloat))
+    }
+  }
+
+  /** Creates a new event scanner.
+    *
+    * @param  tags          Tags of the scalar summaries to keep. If empty, all scalar summaries are kept.
+    * @param  reservoirSize Maximum number of values kept per file and tag. If `0`, all values are kept.
+    * @param  seed          Seed for the random number generators used for reservoir sampling.
+    * @param  numThreads    Number of threads used to scan files in parallel.
+    * @return Newly constructed event scanner.
+    */
+  def apply(
+      tags: Set[String] = Set.empty, reservoirSize: Int = 0, seed: Long = 0L,
+      numThreads: Int = Runtime.getRuntime.availableProcessors()): EventScanner = {
+    new EventScanner(tags, reservoirSize, seed, numThreads)
+  }
+
+  /** Returns the event files at `path`, which is either a single event file or a directory containing event files,
+    * sorted by name (i.e., by creation time). */
+  def eventFiles(path: Path): Seq[Path] = {
+    if (Files.isRegularFile(path)) {
+      if (isEventFile(path)) Seq(path) else Seq.empty
+    } else if (Files.isDirectory(path)) {
+      val stream = Files.list(path)
+      try {
+        stream.iterator().asScala.filter(p => Files.isRegularFile(p) && isEventFile(p)).toSeq.sortBy(_.toString)
+      } finally {
+        stream.close()
+      }
+    } else {
+      Seq.empty
+    }
+  }
+
+  private[this] def isEventFile(path: Path): Boolean = path.getFileName.toString.contains("tfevents")
+
+  private[EventScanner] def filenames(files: Seq[Path]): Array[String] = files.map(_.toAbsolutePath.toString).toArray
+}
@@ -120,13 +120,16 @@ class SummaryFileWriter private[io](
     *
     * This method wraps the provided summary in an `Event` protocol buffer and writes it to the event file.
     *
-    * You can pass the result of evaluating any summary op (e.g., using `Session.run()`) to this function.
+    * You can pass the result of evaluating any summary op (e.g., using `Session.run()`) to this function. The summary
+    * is parsed on the event writer thread, and so this method does not block the caller for longer than it takes to
+    * enqueue the summary.
     *
     * @param  summary String representation of the summary to write.
     * @param  step    Global step number to record with the summary.
     */
   def writeSummaryString(summary: String, step: Long = 0L): Unit = {
-    writeSummary(Summary.parseFrom(ByteString.copyFrom(summary.getBytes("ISO-8859-1"))), step)
+    val wallTime = currentWallTime
+    writeDeferred(summaryEvent(Summary.parseFrom(ByteString.copyFrom(summary.getBytes("ISO-8859-1"))), step, wallTime))
   }
 
   /** Writes a `Summary` protocol buffer to the event file.
@@ -137,6 +140,13 @@ class SummaryFileWriter private[io](
     * @param  step    Global step number to record with the summary.
     */
   def writeSummary(summary: Summary, step: Long = 0L): Unit = {
+    val wallTime = currentWallTime
+    writeDeferred(summaryEvent(summary, step, wallTime))
+  }
+
+  /** Wraps `summary` in an `Event` protocol buffer. This method is only called on the event writer thread, which is
+    * also the only thread that accesses `seenSummaryTags`. */
+  private[this] def summaryEvent(summary: Summary, step: Long, wallTime: Double): Event = {
     val summaryBuilder = Summary.newBuilder(summary)
     summaryBuilder.clearValue()
     // We strip the summary metadata for values with tags that we have seen before in order to save space. We just store
@@ -152,7 +162,7 @@ class SummaryFileWriter private[io](
         seenSummaryTags.add(value.getTag)
       }
     })
-    write(eventBuilder(step).setSummary(summaryBuilder).build())
+    eventBuilder(step, wallTime).setSummary(summaryBuilder).build()
   }
 
   /** Writes a [[SessionLog]] to the event file.
@@ -185,8 +195,10 @@ class SummaryFileWriter private[io](
     write(eventBuilder(step).setTaggedRunMetadata(taggedRunMetadataBuilder).build())
   }
 
-  private[this] def eventBuilder(step: Long = 0L): Event.Builder = {
-    Event.newBuilder().setWallTime(System.currentTimeMillis().toDouble / 1000.0).setStep(step)
+  private[this] def currentWallTime: Double = System.currentTimeMillis().toDouble / 1000.0
+
+  private[this] def eventBuilder(step: Long = 0L, wallTime: Double = currentWallTime): Event.Builder = {
+    Event.newBuilder().setWallTime(wallTime).setStep(step)
   }
 }
 
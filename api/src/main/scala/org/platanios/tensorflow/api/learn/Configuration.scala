@@ -19,6 +19,7 @@ import org.platanios.tensorflow.api.config._
 import org.platanios.tensorflow.api.core.client.SessionConfig
 import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
 import org.platanios.tensorflow.api.learn.Configuration._
+import org.platanios.tensorflow.api.ops.training.MixedPrecision
 
 import io.circe._
 import io.circe.parser._
@@ -138,6 +139,12 @@ import java.nio.file.Path
   * @param  summaryConfig    Configuration specifying when to save summaries.
   * @param  randomSeed       Random seed value to be used by the TensorFlow initializers. Setting this value allows
   *                          consistency between re-runs.
+  * @param  mixedPrecision   Mixed-precision training configuration. If provided, the compute-intensive ops of the
+  *                          model layers are performed in reduced precision, while the variables are kept in full
+  *                          precision, and the loss is scaled when computing its gradients.
+  * @param  towerReplication Multi-device replication configuration. If provided, the model is replicated over the
+  *                          specified devices and each training batch is split evenly among the replicas, whose
+  *                          gradients are averaged before being applied.
   * @author Emmanouil Antonios Platanios
   */
 case class Configuration(
@@ -146,7 +153,9 @@ case class Configuration(
     sessionConfig: Option[SessionConfig] = None,
     checkpointConfig: CheckpointConfig = TimeBasedCheckpoints(600, 5, 10000),
     summaryConfig: SummaryConfig = StepBasedSummaries(100),
-    randomSeed: Int = 1
+    randomSeed: Int = 1,
+    mixedPrecision: Option[MixedPrecision] = None,
+    towerReplication: Option[TowerReplication] = None
 ) {
   val (clusterConfig, taskType, taskIndex, master, numParameterServers, numWorkers, isChief): (
       Option[ClusterConfig], String, Int, String, Int, Int, Boolean) = {
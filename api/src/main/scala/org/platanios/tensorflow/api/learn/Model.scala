@@ -15,12 +15,15 @@
 
 package org.platanios.tensorflow.api.learn
 
+import org.platanios.tensorflow.api.Implicits._
 import org.platanios.tensorflow.api.core.Graph
 import org.platanios.tensorflow.api.learn.layers.{Input, Layer}
-import org.platanios.tensorflow.api.ops.{Math, Op, Output}
-import org.platanios.tensorflow.api.ops.training.optimizers.Optimizer
+import org.platanios.tensorflow.api.ops.{Basic, Collective, Math, Op, OpSpecification}
+import org.platanios.tensorflow.api.ops.{Output, OutputIndexedSlices, OutputLike}
+import org.platanios.tensorflow.api.ops.training.optimizers.{LossScaleOptimizer, Optimizer}
 import org.platanios.tensorflow.api.ops.io.data.Iterator
 import org.platanios.tensorflow.api.ops.metrics.Metric
+import org.platanios.tensorflow.api.ops.variables.Variable
 import org.platanios.tensorflow.api.types.FLOAT32
 
 /**
@@ -105,6 +108,107 @@ object Model {
       metricUpdates: Seq[Output],
       metricResets: Seq[Op])
 
+  /** Creates an op that minimizes `loss` using `optimizer` and increments `iteration`. If mixed-precision training is
+    * enabled in the current layer creation context, then `optimizer` is wrapped in a [[LossScaleOptimizer]]. */
+  private[learn] def minimize(optimizer: Optimizer, loss: Output, iteration: Variable): Op = {
+    Layer.currentMixedPrecision match {
+      case Some(mixedPrecision) => LossScaleOptimizer(optimizer, mixedPrecision.lossScale).minimize(
+        loss, iteration = Some(iteration))
+      case None => optimizer.minimize(loss, iteration = Some(iteration))
+    }
+  }
+
+  /** Op types of the ops that create variables, which are placed on the variables device when using tower
+    * replication. */
+  private[this] val VARIABLE_OP_TYPES: Set[String] = Set("VarHandleOp", "VariableV2", "Variable")
+
+  /** Builds the training ops of a model, given its input iterator and a function `tower` that builds its layers for
+    * the provided input and returns their output along with the loss.
+    *
+    * If tower replication is enabled in the current layer creation context, then each batch obtained from
+    * `inputIterator` is split evenly over the towers, `tower` is invoked once per tower device (with all variables
+    * shared among the towers and placed on the variables device), and the tower gradients are combined before being
+    * applied. In that case, the returned input and output are those of the first tower and the returned loss is the
+    * average of the tower losses. Otherwise, `tower` is invoked once and the loss is minimized as in [[minimize]].
+    *
+    * @return Tuple containing the input, the output, the loss, and the train op.
+    */
+  private[learn] def buildTrainingOps[T, O, D, S, R](
+      optimizer: Optimizer, inputIterator: Iterator[T, O, D, S], iteration: Variable
+  )(tower: O => (R, Output)): (O, R, Output, Op) = {
+    Layer.currentTowerReplication match {
+      case None =>
+        val input = inputIterator.next()
+        val (output, loss) = tower(input)
+        (input, output, loss, minimize(optimizer, loss, iteration))
+      case Some(replication) =>
+        val replicaOptimizer = Layer.currentMixedPrecision match {
+          case Some(mixedPrecision) => LossScaleOptimizer(optimizer, mixedPrecision.lossScale)
+          case None => optimizer
+        }
+        val variablesDevice = replication.variablesDevice
+        val deviceFunction = (op: OpSpecification) => {
+          if (VARIABLE_OP_TYPES.contains(op.opType)) variablesDevice else op.device
+        }
+        val inputs = inputIterator.nextSplit(replication.numTowers)
+        val towers = replication.devices.zip(inputs).zipWithIndex.map {
+          case ((device, input), index) =>
+            Op.createWith(nameScope = s"Tower$index", device = device, deviceFunction = deviceFunction) {
+              Layer.createWith(device = device, deviceFunction = deviceFunction) {
+                val (output, loss) = tower(input)
+                (input, output, loss, replicaOptimizer.computeGradients(loss))
+              }
+            }
+        }
+        val loss = Op.createWith(device = variablesDevice) {
+          Math.mean(Basic.stack(towers.map(_._3)), name = "TowerLoss")
+        }
+        val gradientsAndVariables = combineTowerGradients(towers.map(_._4), replication)
+        val trainOp = replicaOptimizer.applyGradients(gradientsAndVariables, Some(iteration))
+        (towers.head._1, towers.head._2, loss, trainOp)
+    }
+  }
+
+  /** Combines the gradients computed by the towers of `replication` into their average, for each variable. */
+  private[this] def combineTowerGradients(
+      towerGradients: Seq[Seq[(OutputLike, Variable)]], replication: TowerReplication
+  ): Seq[(OutputLike, Variable)] = {
+    val numTowers = replication.numTowers
+    val towerGradientMaps = towerGradients.map(_.map(_.swap).toMap)
+    Op.createWithNameScope("CombineTowerGradients") {
+      towerGradients.head.map(_._2).map(variable => {
+        val gradients = towerGradientMaps.flatMap(_.get(variable)).filter(_ != null)
+        val combined: OutputLike = {
+          if (gradients.isEmpty) {
+            null
+          } else if (gradients.forall(_.isInstanceOf[OutputIndexedSlices])) {
+            // Sparse gradients are concatenated and their values are scaled, which is equivalent to averaging them.
+            val slices = gradients.map(_.asInstanceOf[OutputIndexedSlices])
+            Op.createWith(device = replication.variablesDevice) {
+              val values = Basic.concatenate(slices.map(_.values))
+              OutputIndexedSlices(
+                indices = Basic.concatenate(slices.map(_.indices)),
+                values = Math.divide(values, Basic.constant(numTowers, values.dataType)),
+                denseShape = slices.head.denseShape)
+            }
+          } else {
+            val dense = gradients.map(_.toOutput)
+            if (replication.variablePlacement == AllReduceGradients &&
+                dense.size == numTowers && dense.forall(_.shape.isFullyDefined)) {
+              Collective.ringAllReduce(dense, average = true).head
+            } else {
+              Op.createWith(device = replication.variablesDevice) {
+                val sum = Math.addN(dense)
+                Math.divide(sum, Basic.constant(numTowers, sum.dataType))
+              }
+            }
+          }
+        }
+        (combined, variable)
+      })
+    }
+  }
+
   trait API {
     def Model[IT, IO, ID, IS, I, TT, TO, TD, TS, T](
         input: Input[IT, IO, ID, IS],
@@ -156,12 +260,13 @@ private[learn] class SimpleUnsupervisedTrainableModel[IT, IO, ID, IS, I] private
   def buildTrainingOps(graph: Graph = Op.currentGraph): Model.UnsupervisedTrainingOps[IT, IO, ID, IS, I] = {
     Op.createWith(graph = graph) {
       val tfInputIterator = input()
-      val tfInput = tfInputIterator.next()
-      val tfOutput = layer(tfInput, TRAINING).output
-      // TODO: [LEARN] Remove this cast.
-      val tfLoss = Math.cast(loss(tfOutput, TRAINING).output, FLOAT32, name = "LossCast")
       val tfIteration = Counter.getOrCreate(Graph.Keys.GLOBAL_STEP, local = false)
-      val tfTrainOp = optimizer.minimize(tfLoss, iteration = Some(tfIteration))
+      val (tfInput, tfOutput, tfLoss, tfTrainOp) = Model.buildTrainingOps(optimizer, tfInputIterator, tfIteration)(
+        tfInput => {
+          val tfOutput = layer(tfInput, TRAINING).output
+          // TODO: [LEARN] Remove this cast.
+          (tfOutput, Math.cast(loss(tfOutput, TRAINING).output, FLOAT32, name = "LossCast"))
+        })
       Model.UnsupervisedTrainingOps(tfInputIterator, tfInput, tfOutput, tfLoss, tfTrainOp)
     }
   }
@@ -195,13 +300,15 @@ private[learn] class SimpleSupervisedTrainableModel[IT, IO, ID, IS, I, TT, TO, T
   ): Model.SupervisedTrainingOps[IT, IO, ID, IS, I, TT, TO, TD, TS, T] = {
     Op.createWith(graph = graph) {
       val tfInputIterator = input.zip(trainInput).apply()
-      val tfInput = tfInputIterator.next()
-      val tfOutput = layer(tfInput._1, TRAINING).output
-      val tfTrainOutput = trainLayer(tfInput._2, TRAINING).output
-      // TODO: [LEARN] Remove this cast.
-      val tfLoss = Math.cast(loss((tfOutput, tfTrainOutput), TRAINING).output, FLOAT32, name = "LossCast")
       val tfIteration = Counter.getOrCreate(Graph.Keys.GLOBAL_STEP, local = false)
-      val tfTrainOp = optimizer.minimize(tfLoss, iteration = Some(tfIteration))
+      val (tfInput, (tfOutput, tfTrainOutput), tfLoss, tfTrainOp) = Model.buildTrainingOps(
+        optimizer, tfInputIterator, tfIteration)(tfInput => {
+        val tfOutput = layer(tfInput._1, TRAINING).output
+        val tfTrainOutput = trainLayer(tfInput._2, TRAINING).output
+        // TODO: [LEARN] Remove this cast.
+        val tfLoss = Math.cast(loss((tfOutput, tfTrainOutput), TRAINING).output, FLOAT32, name = "LossCast")
+        ((tfOutput, tfTrainOutput), tfLoss)
+      })
       Model.SupervisedTrainingOps(tfInputIterator, tfInput, tfOutput, tfTrainOutput, tfLoss, tfTrainOp)
     }
   }
@@ -132,20 +132,22 @@ private[learn] case class SessionManager(
       master: String, saver: Option[Saver] = None, checkpointPath: Option[Path], waitForCheckpoint: Boolean = false,
       maxWaitSeconds: Int = 7200, sessionConfig: Option[SessionConfig] = None, initOp: Option[Op] = None,
       initFeedMap: FeedMap = FeedMap.empty, initFunction: Option[(Session) => Unit] = None): Session = {
-    val (session, isLoadedFromCheckpoint) = restoreCheckpoint(
+    val (session, recovery) = restoreCheckpoint(
       master, saver, checkpointPath, waitForCheckpoint, maxWaitSeconds, sessionConfig)
-    if (!isLoadedFromCheckpoint) {
+    val (localInitMessage, readyMessage) = recovery.getOrElse({
       if (initOp.isEmpty && initFunction.isEmpty && localInitOp.isEmpty)
         throw InvalidArgumentException(
           "Model is not initialized and no 'initOp', 'initFunction', or 'localInitOp' was provided.")
       initOp.foreach(op => session.run(feeds = initFeedMap, targets = op))
       initFunction.foreach(f => f(session))
-    }
-    tryLocalInitOp(session).foreach(
+      val localInitMessage = tryLocalInitOp(session)
+      (localInitMessage, if (localInitMessage.isEmpty) isModelReady(session) else None)
+    })
+    localInitMessage.foreach(
       message => throw InvalidArgumentException(
         s"Initialization ops did not make the model ready for local initialization. " +
             s"[initOp: $initOp, initFunction: $initFunction, error: $message]."))
-    isModelReady(session).foreach(
+    readyMessage.foreach(
       message => throw InvalidArgumentException(
         s"Initialization ops did not make the model ready. " +
             s"[initOp: $initOp, initFunction: $initFunction, localInitOp: $localInitOp, error: $message]."))
@@ -173,31 +175,23 @@ private[learn] case class SessionManager(
       master: String, saver: Option[Saver] = None, checkpointPath: Option[Path] = None,
       waitForCheckpoint: Boolean = false, maxWaitSeconds: Int = 7200,
       sessionConfig: Option[SessionConfig] = None): (Session, Boolean) = {
-    val (session, isLoadedFromCheckpoint) = restoreCheckpoint(
+    val (session, recovery) = restoreCheckpoint(
       master, saver, checkpointPath, waitForCheckpoint, maxWaitSeconds, sessionConfig)
-
-    // Always try to run the local initialization op.
-    val localInitMessage = tryLocalInitOp(session)
-
-    if (!isLoadedFromCheckpoint) {
-      // We do not need to run checks for readiness.
-      (session, false)
-    } else {
-      localInitMessage match {
-        case Some(message) =>
-          SessionManager.logger.info(
-            s"Restoring model from $checkpointPath did not make it ready for local initialization: $message.")
-          (session, false)
-        case None => isModelReady(session) match {
-          case Some(message) =>
-            SessionManager.logger.info(
-              s"Restoring model from $checkpointPath did not make it ready: $message.")
-            (session, false)
-          case None =>
-            SessionManager.logger.info(s"Restored model from $checkpointPath.")
-            (session, true)
-        }
-      }
+    recovery match {
+      case None =>
+        // Always try to run the local initialization op, but we do not need to run checks for readiness.
+        tryLocalInitOp(session)
+        (session, false)
+      case Some((Some(message), _)) =>
+        SessionManager.logger.info(
+          s"Restoring model from $checkpointPath did not make it ready for local initialization: $message.")
+        (session, false)
+      case Some((None, Some(message))) =>
+        SessionManager.logger.info(s"Restoring model from $checkpointPath did not make it ready: $message.")
+        (session, false)
+      case Some((None, None)) =>
+        SessionManager.logger.info(s"Restored model from $checkpointPath.")
+        (session, true)
     }
   }
 
@@ -260,19 +254,19 @@ private[learn] case class SessionManager(
     *                           readily available when this function is called.
     * @param  maxWaitSeconds    Maximum time to wait for checkpoints to become available.
     * @param  sessionConfig     Session configuration to be used for the new session.
-    * @return Tuple containing the newly created session and a boolean value specifying whether the checkpoint
-    *         restoration was successful or not.
+    * @return Tuple containing the newly created session and, if the checkpoint was restored, the results of the
+    *         readiness checks that follow the restoration (i.e., the reason why the model is not ready for local
+    *         initialization, if it is not, and the reason why it is not ready, if it is not).
     */
   private[this] def restoreCheckpoint(
       master: String, saver: Option[Saver] = None, checkpointPath: Option[Path] = None,
       waitForCheckpoint: Boolean = false, maxWaitSeconds: Int = 7200,
-      sessionConfig: Option[SessionConfig] = None): (Session, Boolean) = {
+      sessionConfig: Option[SessionConfig] = None): (Session, Option[(Option[String], Option[String])]) = {
     val session = Session(graph, master, sessionConfig)
     (saver, checkpointPath) match {
       case (Some(_saver), Some(_checkpointPath)) =>
         if (Files.isRegularFile(_checkpointPath)) {
-          _saver.restore(session, _checkpointPath)
-          (session, true)
+          (session, Some(recover(session, _saver, _checkpointPath)))
         } else {
           // Wait up until `maxWaitSeconds` for the checkpoint to become available.
           var waitTime = 0
@@ -291,21 +285,35 @@ private[learn] case class SessionManager(
             }
           }
           if (timeout) {
-            (session, false)
+            (session, None)
           } else {
             // Load the checkpoint.
-            _saver.restore(session, Paths.get(checkpointState.get.getModelCheckpointPath))
+            val recovery = recover(session, _saver, Paths.get(checkpointState.get.getModelCheckpointPath))
             _saver.recoverLastCheckpoints(checkpointState.get.getAllModelCheckpointPathsList.asScala.map(Paths.get(_)))
-            (session, true)
+            (session, Some(recovery))
           }
         }
       case _ =>
         // If either the saver or the checkpoint path is not specified we cannot restore any checkpoints and we thus
         // just return the created session.
-        (session, false)
+        (session, None)
     }
   }
 
+  /** Restores the checkpoint at `checkpointPath` using `saver` and then runs `localInitOp` and checks if the model is
+    * ready, all in a single native call, which reads the checkpoint tensors in parallel and does not run any
+    * initializers for the restored variables.
+    *
+    * @param  session        Session to use.
+    * @param  saver          Saver to use for restoring the model.
+    * @param  checkpointPath Path to the checkpoint to restore.
+    * @return Tuple containing the reason why the model is not ready for local initialization, if it is not, and the
+    *         reason why it is not ready, if it is not.
+    */
+  private[this] def recover(session: Session, saver: Saver, checkpointPath: Path): (Option[String], Option[String]) = {
+    saver.recover(session, checkpointPath, readyForLocalInitOp, localInitOp, readyOp)
+  }
+
   /** Checks if the model is ready or not, as determined by `readyOp`.
     *
     * @param  session Session to use.
@@ -115,8 +115,9 @@ class SessionWrapper private[learn](
         combinedArgs.feeds, combinedArgs.fetches, combinedArgs.targets, combinedArgs.options, wantMetadata)
 
       // Invoke the hooks' `afterSessionRun` callbacks.
+      val timings = Session.lastRunTimings()
       currentHooks.zipWithIndex.foreach(hook => {
-        hook._1.afterSessionRun(runContext, Hook.SessionRunResult(result._1._2(hook._2), result._2))
+        hook._1.afterSessionRun(runContext, Hook.SessionRunResult(result._1._2(hook._2), result._2, timings))
       })
 
       // Update the `_shouldStop` flag and return.
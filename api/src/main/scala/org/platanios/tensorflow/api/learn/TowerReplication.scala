@@ -0,0 +1,71 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.learn
+
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
+
+/** Multi-device (i.e., tower) replication configuration, used for synchronous data-parallel training.
+  *
+  * When training with tower replication, the model layers are replicated once per device in `devices` (each replica is
+  * called a tower), each batch obtained from the input iterator is split evenly along its first dimension over the
+  * towers, and each tower computes the loss and its gradients for its part of the batch. The gradients of all towers
+  * are then combined into their average, which is applied once to the variables that are shared among the towers.
+  * The batch size must thus be divisible by the number of towers.
+  *
+  * @param  devices           Devices on which to place the towers (e.g., `"/device:GPU:0"` and `"/device:GPU:1"`).
+  * @param  variablePlacement Specifies where the shared variables are placed and how the tower gradients are combined.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class TowerReplication(devices: Seq[String], variablePlacement: VariablePlacement = VariablesOnCPU) {
+  if (devices.isEmpty)
+    throw InvalidArgumentException("At least one tower device must be provided.")
+
+  /** Number of towers. */
+  def numTowers: Int = devices.size
+
+  /** Device on which the shared variables are placed. */
+  def variablesDevice: String = variablePlacement match {
+    case VariablesOnCPU => "/device:CPU:0"
+    case VariablesOnFirstDevice | AllReduceGradients => devices.head
+  }
+}
+
+object TowerReplication {
+  /** Creates a tower replication configuration with one tower on each of the first `numGPUs` GPUs. */
+  def gpus(numGPUs: Int, variablePlacement: VariablePlacement = VariablesOnCPU): TowerReplication = {
+    if (numGPUs <= 0)
+      throw InvalidArgumentException(s"The number of GPUs must be positive, but it was $numGPUs.")
+    TowerReplication((0 until numGPUs).map(i => s"/device:GPU:$i"), variablePlacement)
+  }
+}
+
+/** Specifies where the variables shared among the towers of a [[TowerReplication]] are placed and how the gradients
+  * computed by the towers are combined. */
+sealed trait VariablePlacement
+
+/** Places the variables on the CPU, where the tower gradients are also averaged. This is usually the best choice when
+  * the devices are not connected using peer-to-peer links. */
+case object VariablesOnCPU extends VariablePlacement
+
+/** Places the variables on the first tower device, where the tower gradients are also averaged. */
+case object VariablesOnFirstDevice extends VariablePlacement
+
+/** Places the variables on the first tower device and combines the dense tower gradients using a ring all-reduce
+  * among the tower devices (see [[org.platanios.tensorflow.api.ops.Collective.ringAllReduce]]), which balances the
+  * communication cost over all devices. Sparse gradients and gradients whose shape is not fully defined are averaged
+  * on the first tower device instead. */
+case object AllReduceGradients extends VariablePlacement
@@ -22,10 +22,12 @@ import org.platanios.tensorflow.api.core.distributed.ReplicaDevicePlacer
 import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
 import org.platanios.tensorflow.api.learn._
 import org.platanios.tensorflow.api.learn.hooks._
+import org.platanios.tensorflow.api.learn.layers.Layer
 import org.platanios.tensorflow.api.ops.io.data.{Data, Dataset, TensorDataset}
 import org.platanios.tensorflow.api.ops.{Function, Op, OpSpecification, Output, OutputToTensor}
 import org.platanios.tensorflow.api.ops.metrics.Metric
-import org.platanios.tensorflow.api.ops.variables.Saver
+import org.platanios.tensorflow.api.ops.training.MixedPrecision
+import org.platanios.tensorflow.api.ops.variables.{DefaultSaverDefBuilder, ParallelSaverDefBuilder, Saver}
 import org.platanios.tensorflow.api.tensors.Tensor
 import org.platanios.tensorflow.api.io.events.SummaryFileWriterCache
 import org.platanios.tensorflow.api.types.FLOAT32
@@ -132,6 +134,20 @@ abstract class Estimator[IT, IO, ID, IS, I, TT, TO, TD, TS, EI] private[estimato
   /** Random seed value to be used by the TensorFlow initializers in this estimator. */
   def randomSeed: Int = configuration.randomSeed
 
+  /** Mixed-precision training configuration used by this estimator, if any. */
+  def mixedPrecision: Option[MixedPrecision] = configuration.mixedPrecision
+
+  /** Tower replication configuration used by this estimator, if any. */
+  def towerReplication: Option[TowerReplication] = configuration.towerReplication
+
+  /** Builds the model ops created by `block`, using the mixed-precision and tower replication configurations of this
+    * estimator, if any. */
+  protected def buildOps[R](block: => R): R = {
+    Layer.createWithMixedPrecision(mixedPrecision) {
+      Layer.createWithTowerReplication(towerReplication)(block)
+    }
+  }
+
   /** Gets an existing saver from the current graph, or creates a new one if none exists. */
   protected def getOrCreateSaver(): Option[Saver] = {
     val graph = Op.currentGraph
@@ -141,7 +157,14 @@ abstract class Estimator[IT, IO, ID, IS, I, TT, TO, TD, TS, EI] private[estimato
         sharded = true,
         maxToKeep = configuration.checkpointConfig.maxCheckpointsToKeep,
         keepCheckpointEveryNHours = configuration.checkpointConfig.keepCheckpointEveryNHours,
-        saveRelativePaths = true)
+        builder = {
+          if (configuration.checkpointConfig.parallelWriters > 0)
+            ParallelSaverDefBuilder(configuration.checkpointConfig.parallelWriters)
+          else
+            DefaultSaverDefBuilder
+        },
+        saveRelativePaths = true,
+        asyncWriters = configuration.checkpointConfig.asyncWriters)
       graph.addToCollection(saver, Graph.Keys.SAVERS)
       Some(saver)
     } else {
@@ -371,10 +394,12 @@ object Estimator {
         if (!chiefHooks.exists(_.isInstanceOf[CheckpointSaverHook])) {
           configuration.checkpointConfig match {
             case NoCheckpoints => ()
-            case StepBasedCheckpoints(steps, _, _) =>
-              chiefHooks += CheckpointSaverHook(workingDir, StepHookTrigger(steps))
-            case TimeBasedCheckpoints(seconds, _, _) =>
-              chiefHooks += CheckpointSaverHook(workingDir, TimeHookTrigger(seconds))
+            case StepBasedCheckpoints(steps, _, _, asyncWriters, _) =>
+              chiefHooks += CheckpointSaverHook(
+                workingDir, StepHookTrigger(steps), asynchronous = asyncWriters > 0)
+            case TimeBasedCheckpoints(seconds, _, _, asyncWriters, _) =>
+              chiefHooks += CheckpointSaverHook(
+                workingDir, TimeHookTrigger(seconds), asynchronous = asyncWriters > 0)
           }
         }
       })
@@ -17,25 +17,29 @@ package org.platanios.tensorflow.api.learn.estimators
 
 import org.platanios.tensorflow.api.config._
 import org.platanios.tensorflow.api.core.Graph
-import org.platanios.tensorflow.api.core.client.Fetchable
-import org.platanios.tensorflow.api.core.exception.{CheckpointNotFoundException, InvalidArgumentException}
+import org.platanios.tensorflow.api.core.client.{Executable, Fetchable, Session}
+import org.platanios.tensorflow.api.core.exception._
 import org.platanios.tensorflow.api.io.CheckpointReader
 import org.platanios.tensorflow.api.learn._
 import org.platanios.tensorflow.api.learn.hooks._
 import org.platanios.tensorflow.api.ops.control_flow.ControlFlow
 import org.platanios.tensorflow.api.ops.io.data.Dataset
 import org.platanios.tensorflow.api.ops.metrics.Metric
-import org.platanios.tensorflow.api.ops.variables.Saver
+import org.platanios.tensorflow.api.ops.variables.{Saver, Variable}
 import org.platanios.tensorflow.api.ops.{Op, Output}
 import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.utilities.Closeable
 
 import com.typesafe.scalalogging.Logger
 import org.slf4j.LoggerFactory
 
 import java.nio.file.Path
+import java.util.concurrent.{ExecutorService, Executors, ThreadFactory, TimeUnit}
 
 import scala.collection.immutable.TreeMap
 import scala.collection.mutable
+import scala.concurrent.{Await, ExecutionContext, Future}
+import scala.concurrent.duration.Duration
 
 // TODO: Issue warning if using this estimator with no checkpoints specified in the provided configuration.
 
@@ -137,7 +141,7 @@ class FileBasedEstimator[IT, IO, ID, IS, I, TT, TO, TD, TS, EI] private[estimato
         // TODO: [LEARN] !!! Do we ever update the global epoch?
         Counter.getOrCreate(Graph.Keys.GLOBAL_EPOCH, local = false)
         val globalStep = Counter.getOrCreate(Graph.Keys.GLOBAL_STEP, local = false)
-        val trainingOps = Op.createWithNameScope("Model")(model.buildTrainingOps())
+        val trainingOps = Op.createWithNameScope("Model")(buildOps(model.buildTrainingOps()))
         val inputInitializer = trainingOps.inputIterator.createInitializer(data)
         graph.addToCollection(trainingOps.loss, Graph.Keys.LOSSES)
         allHooks += TensorNaNHook(Set(trainingOps.loss.name))
@@ -250,7 +254,7 @@ class FileBasedEstimator[IT, IO, ID, IS, I, TT, TO, TD, TS, EI] private[estimato
       graph.setRandomSeed(randomSeed)
       Counter.getOrCreate(Graph.Keys.GLOBAL_EPOCH, local = false)
       Counter.getOrCreate(Graph.Keys.GLOBAL_STEP, local = false)
-      val inferenceOps = Op.createWithNameScope("Model")(model.buildInferenceOps())
+      val inferenceOps = Op.createWithNameScope("Model")(buildOps(model.buildInferenceOps()))
       val inputInitializer = inferenceOps.inputIterator.createInitializer(ev.toDataset(input))
       val saver = getOrCreateSaver()
       val session = MonitoredSession(
@@ -370,7 +374,7 @@ class FileBasedEstimator[IT, IO, ID, IS, I, TT, TO, TD, TS, EI] private[estimato
     val graph = Graph()
     Op.createWith(graph) {
       graph.setRandomSeed(randomSeed)
-      val evaluationOps = Op.createWithNameScope("Model")(model.buildEvaluationOps(metrics))
+      val evaluationOps = Op.createWithNameScope("Model")(buildOps(model.buildEvaluationOps(metrics)))
       val inputInitializer = evaluationOps.inputIterator.createInitializer(data)
       Counter.getOrCreate(Graph.Keys.GLOBAL_EPOCH, local = false)
       val globalStep = Counter.getOrCreate(Graph.Keys.GLOBAL_STEP, local = false)
@@ -415,6 +419,201 @@ class FileBasedEstimator[IT, IO, ID, IS, I, TT, TO, TD, TS, EI] private[estimato
       metricValues
     }
   }
+
+  /** Creates an evaluator that evaluates the model managed by this estimator asynchronously, while it is being trained.
+    *
+    * The returned evaluator is a training hook (i.e., it can be passed to [[trainWithHooks]]) that, whenever it is
+    * triggered, evaluates the latest checkpoint found in this estimator's working directory (e.g., the one saved most
+    * recently, possibly asynchronously, by a [[CheckpointSaverHook]]) on a separate thread, using its own session and,
+    * optionally, its own device. Training continues while evaluating, instead of pausing for every evaluation. The
+    * evaluation graph, including its input iterator, is only built once and it is then reused by all evaluations.
+    * Evaluations that are triggered while another one is still running are skipped, as are evaluations of checkpoints
+    * that have already been evaluated. The evaluator can also be used directly, through [[AsyncEvaluator.evaluate]].
+    *
+    * The evaluator must be closed after it is no longer needed, in order to release its session.
+    *
+    * @param  data          Evaluation dataset. Each element is a tuple over input and training inputs (i.e.,
+    *                       supervision labels).
+    * @param  metrics       Evaluation metrics to use.
+    * @param  maxSteps      Maximum number of steps to perform for each evaluation. If `-1`, each evaluation will run
+    *                       until `data` is exhausted.
+    * @param  trigger       Hook trigger specifying when evaluations are started, while training.
+    * @param  device        Device on which to place the evaluation ops (e.g., `"/device:GPU:1"`). If empty, the ops are
+    *                       placed automatically.
+    * @param  saveSummaries Boolean indicator specifying whether to save the evaluation results as summaries in the
+    *                       working directory of this estimator.
+    * @param  name          Name for the evaluations, used in the same way as by [[evaluate]].
+    * @return Created evaluator.
+    * @throws InvalidArgumentException If `saveSummaries` is `true`, but the estimator has no working directory
+    *                                  specified.
+    */
+  @throws[InvalidArgumentException]
+  def asyncEvaluator(
+      data: Dataset[TT, TO, TD, TS],
+      metrics: Seq[Metric[EI, Output]] = this.evaluationMetrics,
+      maxSteps: Long = -1L,
+      trigger: HookTrigger = StepHookTrigger(1000),
+      device: String = "",
+      saveSummaries: Boolean = true,
+      name: String = null): AsyncEvaluator = {
+    if (saveSummaries && workingDir.isEmpty)
+      throw InvalidArgumentException(
+        "No working directory is provided and thus evaluation summaries cannot be saved.")
+    new AsyncEvaluator(data, metrics, maxSteps, trigger, device, saveSummaries, name)
+  }
+
+  /** Evaluator that evaluates the model managed by this estimator asynchronously, using its own graph and session.
+    * Please refer to the documentation of [[asyncEvaluator]] for details. */
+  class AsyncEvaluator private[FileBasedEstimator](
+      val data: Dataset[TT, TO, TD, TS],
+      val metrics: Seq[Metric[EI, Output]],
+      val maxSteps: Long,
+      val trigger: HookTrigger,
+      val device: String,
+      val saveSummaries: Boolean,
+      val name: String
+  ) extends Hook with Closeable {
+    /** Single thread on which all evaluations run, in order. */
+    private[this] val executor: ExecutorService = Executors.newSingleThreadExecutor(new ThreadFactory {
+      override def newThread(runnable: Runnable): Thread = {
+        val thread = new Thread(runnable, "Estimator Evaluator")
+        thread.setDaemon(true)
+        thread
+      }
+    })
+
+    private[this] val executionContext: ExecutionContext = ExecutionContext.fromExecutorService(executor)
+
+    private[this] val graph: Graph = Graph()
+
+    private[this] val (globalStep, metricValues, evalUpdateOps, localInitOp, saver) = {
+      Op.createWith(graph = graph, device = device) {
+        graph.setRandomSeed(randomSeed)
+        val model = modelFunction(configuration)
+        val evaluationOps = Op.createWithNameScope("Model")(buildOps(model.buildEvaluationOps(metrics)))
+        val inputInitializer = evaluationOps.inputIterator.createInitializer(data)
+        Counter.getOrCreate(Graph.Keys.GLOBAL_EPOCH, local = false)
+        val globalStep = Counter.getOrCreate(Graph.Keys.GLOBAL_STEP, local = false)
+        val evalStep = Counter.getOrCreate(Graph.Keys.EVAL_STEP, local = true)
+        val evalStepUpdate = evalStep.assignAdd(1L)
+        val evalUpdateOps = ControlFlow.group(evaluationOps.metricUpdates.map(_.op).toSet + evalStepUpdate.op)
+        val localInitOp = ControlFlow.group(Set(inputInitializer, graph.localVariablesInitializer()))
+        val saver = getOrCreateSaver().getOrElse(throw InvalidArgumentException(
+          "A saver is required in order to restore checkpoints for asynchronous evaluation."))
+        (globalStep, evaluationOps.metricValues, evalUpdateOps, localInitOp, saver)
+      }
+    }
+
+    private[this] val session: Session = {
+      Session(graph, Option(configuration.evaluationMaster).filter(_.nonEmpty).orNull, configuration.sessionConfig)
+    }
+
+    // Training graph state used when this evaluator is used as a hook.
+    private[this] var trainStep      : Variable    = _
+    private[this] val internalTrigger: HookTrigger = trigger.copy()
+    private[this] var lastStep       : Long        = 0L
+    private[this] var shouldTrigger  : Boolean     = false
+
+    /** Most recently started evaluation, along with the path of the checkpoint that it evaluates. */
+    private[this] var lastEvaluation: Option[(Path, Future[Seq[Tensor]])] = None
+
+    /** Evaluates the checkpoint at `checkpointPath`, or the latest checkpoint found in the working directory of this
+      * estimator, if `checkpointPath` is `null`, asynchronously.
+      *
+      * @param  checkpointPath Path to a checkpoint file to use.
+      * @return Future evaluation metric values. The future fails with a [[CheckpointNotFoundException]] if no
+      *         checkpoint could be found.
+      */
+    def evaluate(checkpointPath: Path = null): Future[Seq[Tensor]] = synchronized {
+      Option(checkpointPath).orElse(workingDir.flatMap(Saver.latestCheckpoint(_))) match {
+        case Some(path) =>
+          val evaluation = Future(evaluateCheckpoint(path))(executionContext)
+          lastEvaluation = Some((path, evaluation))
+          evaluation
+        case None =>
+          Future.failed(CheckpointNotFoundException(
+            "No checkpoint was found. Please provide a valid 'workingDir' the estimator configuration, or a path to " +
+                "a valid checkpoint file through the 'checkpointPath' argument."))
+      }
+    }
+
+    /** Evaluates the checkpoint at `path` on the calling thread (which is always the evaluator thread). */
+    private[this] def evaluateCheckpoint(path: Path): Seq[Tensor] = {
+      FileBasedEstimator.logger.info(s"Starting asynchronous evaluation of checkpoint '$path'.")
+      saver.restore(session, path)
+      session.run(targets = localInitOp)
+      val step = session.run(fetches = globalStep.value).scalar.asInstanceOf[Long]
+      var numSteps = 0L
+      try {
+        while (maxSteps < 0 || numSteps < maxSteps) {
+          session.run(targets = evalUpdateOps)
+          numSteps += 1
+        }
+      } catch {
+        case _: OutOfRangeException => ()
+      }
+      val values = session.run(fetches = metricValues)
+      FileBasedEstimator.logger.info(s"Finished asynchronous evaluation for step $step.")
+      if (saveSummaries)
+        saveEvaluationSummaries(step, metrics, values, name)
+      values
+    }
+
+    override def begin(): Unit = {
+      internalTrigger.reset()
+      trainStep = Counter.get(Graph.Keys.GLOBAL_STEP, local = false).getOrElse(throw InvalidArgumentException(
+        s"A ${Graph.Keys.GLOBAL_STEP.name} variable should be created in order to use the 'AsyncEvaluator'."))
+    }
+
+    override def afterSessionCreation(session: Session): Unit = {
+      lastStep = session.run(fetches = trainStep.value).scalar.asInstanceOf[Long]
+    }
+
+    override def beforeSessionRun[F, E, R](runContext: Hook.SessionRunContext[F, E, R])(implicit
+        executableEv: Executable[E],
+        fetchableEv: Fetchable.Aux[F, R]
+    ): Option[Hook.SessionRunArgs[Seq[Output], Traversable[Op], Seq[Tensor]]] = {
+      shouldTrigger = internalTrigger.shouldTriggerForStep(lastStep.toInt)
+      Some(Hook.SessionRunArgs(fetches = Seq(trainStep.value)))
+    }
+
+    override def afterSessionRun[F, E, R](
+        runContext: Hook.SessionRunContext[F, E, R],
+        runResult: Hook.SessionRunResult[Seq[Output], Seq[Tensor]]
+    )(implicit
+        executableEv: Executable[E],
+        fetchableEv: Fetchable.Aux[F, R]
+    ): Unit = {
+      lastStep = runResult.values(0).scalar.asInstanceOf[Long]
+      if (shouldTrigger) {
+        internalTrigger.updateLastTrigger(lastStep.toInt - 1)
+        maybeStartEvaluation()
+      }
+    }
+
+    override def end(session: Session): Unit = {
+      lastEvaluation.foreach(evaluation => Await.ready(evaluation._2, Duration.Inf))
+    }
+
+    /** Starts evaluating the latest checkpoint, unless an evaluation is still running or that checkpoint has already
+      * been evaluated. Evaluation failures are logged, but they do not stop training. */
+    private[this] def maybeStartEvaluation(): Unit = synchronized {
+      val latestCheckpoint = workingDir.flatMap(Saver.latestCheckpoint(_))
+      val isRunning = lastEvaluation.exists(!_._2.isCompleted)
+      if (!isRunning && latestCheckpoint.isDefined && !lastEvaluation.map(_._1).contains(latestCheckpoint.get)) {
+        evaluate(latestCheckpoint.get).failed.foreach(exception => {
+          FileBasedEstimator.logger.error("Asynchronous evaluation failed.", exception)
+        })(executionContext)
+      }
+    }
+
+    /** Waits for the running evaluation, if any, and releases the session used by this evaluator. */
+    override def close(): Unit = {
+      executor.shutdown()
+      executor.awaitTermination(Long.MaxValue, TimeUnit.NANOSECONDS)
+      session.close()
+    }
+  }
 }
 
 object FileBasedEstimator {
@@ -83,7 +83,7 @@ class InMemoryEstimator[IT, IO, ID, IS, I, TT, TO, TD, TS, EI] private[estimator
       // TODO: [LEARN] !!! Do we ever update the global epoch?
       Counter.getOrCreate(Graph.Keys.GLOBAL_EPOCH, local = false)
       val globalStep = Counter.getOrCreate(Graph.Keys.GLOBAL_STEP, local = false)
-      Op.createWithNameScope("Model") {
+      Op.createWithNameScope("Model")(buildOps {
         val trainingOps = model.buildTrainingOps()
         val inferenceOps = model.buildInferenceOps()
         val evaluationOps = model.buildEvaluationOps(evaluationMetrics)
@@ -91,7 +91,7 @@ class InMemoryEstimator[IT, IO, ID, IS, I, TT, TO, TD, TS, EI] private[estimator
         val evalStepUpdate = evalStep.assignAdd(1L)
         val evalUpdateOps = ControlFlow.group(evaluationOps.metricUpdates.map(_.op).toSet + evalStepUpdate.op)
         (globalStep, trainingOps, inferenceOps, evaluationOps, evalUpdateOps)
-      }
+      })
     }
   }
 
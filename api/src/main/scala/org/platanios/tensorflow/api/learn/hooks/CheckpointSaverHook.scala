@@ -30,6 +30,10 @@ import org.tensorflow.util.SessionLog
 
 import java.nio.file.{Files, Path}
 
+import scala.concurrent.{Await, Future}
+import scala.concurrent.duration.Duration
+import scala.util.{Failure, Success}
+
 /** Saves checkpoints to files based on a [[HookTrigger]]. Checkpoints include the current graph, as well as the trained
   * values of all variables, so far.
   *
@@ -41,6 +45,10 @@ import java.nio.file.{Files, Path}
   *                            set to `true`, then all summaries must be computable without using a feed map for the
   *                            [[Session.run()]] call.
   * @param  checkpointBaseName Base name for the checkpoint files.
+  * @param  asynchronous       If `true`, checkpoints are saved asynchronously using [[Saver.saveAsync]], and so the
+  *                            graph saver must have been created with `asyncWriters > 0`. Training then only pauses
+  *                            while the variables are being copied to host memory. The completion of each save is
+  *                            logged after a subsequent session run, and its failure is rethrown by this hook.
   *
   * @author Emmanouil Antonios Platanios
   */
@@ -48,7 +56,8 @@ case class CheckpointSaverHook(
     directory: Path,
     trigger: HookTrigger = StepHookTrigger(1000),
     triggerAtEnd: Boolean = true,
-    checkpointBaseName: String = "model.ckpt"
+    checkpointBaseName: String = "model.ckpt",
+    asynchronous: Boolean = false
 ) extends Hook {
   private[this] val savePath: Path = directory.resolve(checkpointBaseName)
 
@@ -60,6 +69,9 @@ case class CheckpointSaverHook(
   private[this] var lastStep       : Long        = 0L
   private[this] var shouldTrigger  : Boolean     = false
 
+  /** Step and future of the most recent asynchronous save, if it has not been reported yet. */
+  private[this] var pendingSave: Option[(Long, Future[Option[Path]])] = None
+
   override def begin(): Unit = {
     internalTrigger.reset()
     step = Counter.get(Graph.Keys.GLOBAL_STEP, local = false).getOrElse(throw InvalidArgumentException(
@@ -68,6 +80,9 @@ case class CheckpointSaverHook(
     if (savers.isEmpty || savers.size > 1)
       throw InvalidArgumentException("There should exist one (and only one) saver in the graph.")
     saver = Some(savers.head)
+    if (asynchronous && !savers.head.supportsAsyncSave)
+      throw InvalidArgumentException(
+        "Asynchronous checkpoint saving requires a saver created with 'asyncWriters > 0'.")
     summaryWriter = Some(SummaryFileWriterCache.get(directory))
   }
 
@@ -101,6 +116,7 @@ case class CheckpointSaverHook(
       fetchableEv: Fetchable.Aux[F, R]
   ): Unit = {
     lastStep = runResult.values(0).scalar.asInstanceOf[Long]
+    reportPendingSave(waitForCompletion = false)
     if (shouldTrigger)
       save(runContext.session)
   }
@@ -108,13 +124,45 @@ case class CheckpointSaverHook(
   override def end(session: Session): Unit = {
     if (triggerAtEnd && lastStep.toInt != internalTrigger.lastTriggerStep().getOrElse(-1))
       save(session)
+    reportPendingSave(waitForCompletion = true)
     summaryWriter.foreach(_.flush())
   }
 
   private[this] def save(session: Session): Unit = {
     internalTrigger.updateLastTrigger(lastStep.toInt - 1)
-    CheckpointSaverHook.logger.info(s"Saving checkpoint for step $lastStep.")
-    saver.foreach(_.save(session, savePath, Some(lastStep.toInt)))
+    if (asynchronous) {
+      // The saver waits for the previous save anyway, and so we report it before starting a new one.
+      reportPendingSave(waitForCompletion = true)
+      CheckpointSaverHook.logger.info(s"Saving checkpoint for step $lastStep asynchronously.")
+      pendingSave = saver.map(s => (lastStep, s.saveAsync(session, savePath, Some(lastStep.toInt))))
+    } else {
+      CheckpointSaverHook.logger.info(s"Saving checkpoint for step $lastStep.")
+      saver.foreach(_.save(session, savePath, Some(lastStep.toInt)))
+      writeCheckpointSessionLog()
+    }
+  }
+
+  /** Reports the outcome of the pending asynchronous save, if it has completed (or after waiting for it to complete, if
+    * `waitForCompletion` is `true`). Failed saves are rethrown so that they are not silently ignored. */
+  private[this] def reportPendingSave(waitForCompletion: Boolean): Unit = {
+    pendingSave.foreach { case (step, save) =>
+      if (waitForCompletion)
+        Await.ready(save, Duration.Inf)
+      save.value.foreach(result => {
+        pendingSave = None
+        result match {
+          case Success(_) =>
+            CheckpointSaverHook.logger.info(s"Saved checkpoint for step $step.")
+            writeCheckpointSessionLog()
+          case Failure(exception) =>
+            CheckpointSaverHook.logger.error(s"Failed to save checkpoint for step $step.", exception)
+            throw exception
+        }
+      })
+    }
+  }
+
+  private[this] def writeCheckpointSessionLog(): Unit = {
     summaryWriter.foreach(_.writeSessionLog(
       SessionLog.newBuilder()
           .setStatus(SessionLog.SessionStatus.CHECKPOINT)
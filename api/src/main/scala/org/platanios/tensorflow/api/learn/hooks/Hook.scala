@@ -15,7 +15,7 @@
 
 package org.platanios.tensorflow.api.learn.hooks
 
-import org.platanios.tensorflow.api.core.client.{Executable, FeedMap, Fetchable, Session}
+import org.platanios.tensorflow.api.core.client.{Executable, FeedMap, Fetchable, RunTimings, Session}
 import org.platanios.tensorflow.api.core.exception.OutOfRangeException
 import org.platanios.tensorflow.api.learn.MonitoredSession
 import org.platanios.tensorflow.api.ops.{Op, Output}
@@ -223,8 +223,15 @@ object Hook {
       fetchableEv: Fetchable.Aux[F, R]
   )
 
-  /** Represents the results of a call to `Session.run()`. */
-  case class SessionRunResult[F, R](values: R, runMetadata: Option[RunMetadata])(implicit
+  /** Represents the results of a call to `Session.run()`.
+    *
+    * @param  values      Fetched values.
+    * @param  runMetadata Collected run metadata, if any.
+    * @param  timings     Breakdown of the time spent in the call, if available.
+    */
+  case class SessionRunResult[F, R](
+      values: R, runMetadata: Option[RunMetadata], timings: Option[RunTimings] = None
+  )(implicit
       fetchableEv: Fetchable.Aux[F, R]
   )
 }
@@ -16,7 +16,7 @@
 package org.platanios.tensorflow.api.learn.hooks
 
 import org.platanios.tensorflow.api.core.Graph
-import org.platanios.tensorflow.api.core.client.{Executable, Fetchable, Session}
+import org.platanios.tensorflow.api.core.client.{Executable, Fetchable, RunTimings, Session}
 import org.platanios.tensorflow.api.io.events.{SummaryFileWriter, SummaryFileWriterCache}
 import org.platanios.tensorflow.api.learn.Counter
 import org.platanios.tensorflow.api.ops.{Op, Output}
@@ -30,6 +30,11 @@ import org.tensorflow.framework.Summary
 import java.nio.file.Path
 
 /** Saves summaries to files based on a [[HookTrigger]].
+  *
+  * If `logTimings` is `true`, the hook also reports the average breakdown of the time spent in each `Session.run()`
+  * call since it was last triggered (i.e., time spent executing the graph in `TF_SessionRun`, versus time spent
+  * marshalling values on the JVM and in the native library, and crossing the JNI boundary), as measured by
+  * [[RunTimings]]. This is useful for finding out how much of the step time is non-compute overhead.
   *
   * @param  log              If `true`, the step rate is logged using the current logging configuration.
   * @param  summaryDirectory If provided, summaries for the step rate will be saved in this directory. This is useful
@@ -41,6 +46,9 @@ import java.nio.file.Path
   *                          to `true`, then the global step must be computable without using a feed map for the
   *                          [[Session.run()]] call (which should always be the case by default).
   * @param  tag              Tag to use for the step rate when logging and saving summaries.
+  * @param  logTimings       If `true`, the average breakdown of the step times is also logged and/or saved, in
+  *                          milliseconds.
+  * @param  timingsTag       Tag prefix to use for the step time breakdown when saving summaries.
   *
   * @author Emmanouil Antonios Platanios
   */
@@ -49,7 +57,9 @@ case class StepRateHook(
     summaryDirectory: Path = null,
     trigger: HookTrigger = StepHookTrigger(10),
     triggerAtEnd: Boolean = true,
-    tag: String = "Steps/Sec"
+    tag: String = "Steps/Sec",
+    logTimings: Boolean = true,
+    timingsTag: String = "StepTimings"
 ) extends Hook {
   require(log || summaryDirectory != null, "At least one of 'log' and 'summaryDirectory' needs to be provided.")
 
@@ -60,8 +70,13 @@ case class StepRateHook(
   private[this] var lastStep       : Long        = 0L
   private[this] var shouldTrigger  : Boolean     = false
 
+  private[this] var timingsSum  : RunTimings = RunTimings.zero
+  private[this] var numTimedRuns: Long       = 0L
+
   override def begin(): Unit = {
     internalTrigger.reset()
+    timingsSum = RunTimings.zero
+    numTimedRuns = 0L
     step = Counter.get(Graph.Keys.GLOBAL_STEP, local = false).getOrElse(throw new IllegalStateException(
       s"A ${Graph.Keys.GLOBAL_STEP.name} variable should be created in order to use the 'StepRateHook'."))
     summaryWriter = Option(summaryDirectory).map(SummaryFileWriterCache.get(_))
@@ -86,6 +101,10 @@ case class StepRateHook(
       executableEv: Executable[E],
       fetchableEv: Fetchable.Aux[F, R]
   ): Unit = {
+    runResult.timings.foreach(timings => {
+      timingsSum += timings
+      numTimedRuns += 1
+    })
     saveStepRateSummary(runResult.values)
   }
 
@@ -108,9 +127,27 @@ case class StepRateHook(
                             .setTag(tag)
                             .setSimpleValue(stepRate.toFloat))
                   .build(), lastStep))
+        if (logTimings && numTimedRuns > 0)
+          saveTimingsSummary(timingsSum / numTimedRuns)
       })
+      timingsSum = RunTimings.zero
+      numTimedRuns = 0L
     }
   }
+
+  private[this] def saveTimingsSummary(timings: RunTimings): Unit = {
+    if (log)
+      StepRateHook.logger.info(s"$timingsTag: $timings")
+    summaryWriter.foreach(writer => {
+      val summary = Summary.newBuilder()
+      (("Total" -> timings.total) +: timings.durations).foreach(duration => {
+        summary.addValue(Summary.Value.newBuilder()
+                             .setTag(s"$timingsTag/${duration._1}")
+                             .setSimpleValue((duration._2 / 1e6).toFloat))
+      })
+      writer.writeSummary(summary.build(), lastStep)
+    })
+  }
 }
 
 object StepRateHook {
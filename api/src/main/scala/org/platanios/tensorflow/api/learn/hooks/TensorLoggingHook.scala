@@ -16,7 +16,7 @@
 package org.platanios.tensorflow.api.learn.hooks
 
 import org.platanios.tensorflow.api.core.Graph
-import org.platanios.tensorflow.api.core.client.{Executable, Fetchable, Session}
+import org.platanios.tensorflow.api.core.client.{Executable, Fetchable, RunTimings, Session}
 import org.platanios.tensorflow.api.learn.Counter
 import org.platanios.tensorflow.api.ops.{Op, Output}
 import org.platanios.tensorflow.api.ops.variables.Variable
@@ -42,6 +42,8 @@ import org.slf4j.LoggerFactory
   * @param  formatter    Function used to format the strings being logged that takes a `Map[String, Tensor]` as input,
   *                      with the keys corresponding to tags, and returns a string to log. Defaults to a simple summary
   *                      of all the tensors in the map.
+  * @param  logTimings   If `true` and `formatter` is not provided, the breakdown of the time spent in the
+  *                      `Session.run()` call that produced the logged values (see [[RunTimings]]) is also logged.
   *
   * @author Emmanouil Antonios Platanios
   */
@@ -49,7 +51,8 @@ case class TensorLoggingHook(
     tensors: Map[String, String],
     trigger: HookTrigger = StepHookTrigger(1),
     triggerAtEnd: Boolean = true,
-    formatter: (Map[String, Tensor]) => String = null)
+    formatter: (Map[String, Tensor]) => String = null,
+    logTimings: Boolean = true)
     extends Hook {
   private[this] val tensorTags: Seq[String] = tensors.keys.toSeq
   private[this] val tensorNames: Seq[String] = tensors.values.toSeq
@@ -59,6 +62,7 @@ case class TensorLoggingHook(
   private[this] val internalTrigger: HookTrigger = trigger.copy()
   private[this] var lastStep       : Long        = 0L
   private[this] var shouldTrigger: Boolean = false
+  private[this] var lastTimings: Option[RunTimings] = None
 
   override def begin(): Unit = {
     step = Counter.get(Graph.Keys.GLOBAL_STEP, local = false).getOrElse(throw new IllegalStateException(
@@ -92,13 +96,17 @@ case class TensorLoggingHook(
       fetchableEv: Fetchable.Aux[F, R]
   ): Unit = {
     lastStep = runResult.values.head.scalar.asInstanceOf[Long]
+    lastTimings = runResult.timings
     if (shouldTrigger)
       logTensors(tensorTags.zip(runResult.values.tail))
   }
 
   override def end(session: Session): Unit = {
-    if (triggerAtEnd && lastStep.toInt != internalTrigger.lastTriggerStep().getOrElse(-1))
-      logTensors(tensorTags.zip(session.run(fetches = outputs)))
+    if (triggerAtEnd && lastStep.toInt != internalTrigger.lastTriggerStep().getOrElse(-1)) {
+      val values = session.run(fetches = outputs)
+      lastTimings = Session.lastRunTimings()
+      logTensors(tensorTags.zip(values))
+    }
   }
 
   /** Logs the provided tensor values. */
@@ -113,7 +121,10 @@ case class TensorLoggingHook(
         case Some(s) => f"($s%.3f s) $valuesLog"
         case None => s"( N/A ) $valuesLog"
       }
-      TensorLoggingHook.logger.info(log)
+      if (logTimings && lastTimings.isDefined)
+        TensorLoggingHook.logger.info(s"$log ${lastTimings.get}")
+      else
+        TensorLoggingHook.logger.info(log)
     }
   }
 }
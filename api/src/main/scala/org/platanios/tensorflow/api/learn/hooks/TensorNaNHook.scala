@@ -16,7 +16,7 @@
 package org.platanios.tensorflow.api.learn.hooks
 
 import org.platanios.tensorflow.api.core.client.{Executable, Fetchable}
-import org.platanios.tensorflow.api.ops.{Op, Output}
+import org.platanios.tensorflow.api.ops.{Math, Op, Output}
 import org.platanios.tensorflow.api.tensors.Tensor
 
 import com.typesafe.scalalogging.Logger
@@ -26,24 +26,38 @@ import org.slf4j.LoggerFactory
   *
   * This hook can either fail with an exception or just stop training.
   *
-  * @param  tensorNames Names of the tensors to monitor.
+  * The tensors are checked in the graph, using a single fused op (see [[Math.allFinite]]), and so only a boolean flag
+  * and the index of the failing tensor are fetched every step, rather than the tensors themselves. This makes it
+  * cheap to also monitor large tensors, such as gradients.
+  *
+  * @param  tensorNames Names of the tensors to monitor, which must have `HALF`, `FLOAT32`, or `FLOAT64` data type.
   * @param  failOnNaN   If `true`, an exception is thrown when `NaN` values are encountered. Otherwise, training stops.
+  * @param  checkInf    If `true`, infinite values are treated in the same way as `NaN` values.
   *
   * @author Emmanouil Antonios Platanios
   */
-case class TensorNaNHook(tensorNames: Set[String], failOnNaN: Boolean = true) extends Hook {
-  private[this] var outputs: Seq[Output] = _
+case class TensorNaNHook(tensorNames: Set[String], failOnNaN: Boolean = true, checkInf: Boolean = false) extends Hook {
+  private[this] var outputs     : Seq[Output] = _
+  private[this] var checkOutputs: Seq[Output] = _
 
   override def begin(): Unit = {
     // Convert tensor names to op outputs.
     outputs = tensorNames.map(Op.currentGraph.getOutputByName).toSeq
+    if (outputs.nonEmpty) {
+      val (allFinite, nonFiniteIndex) = Op.createWithNameScope("TensorNaNHook") {
+        Math.allFinite(outputs, ignoreInf = !checkInf)
+      }
+      checkOutputs = Seq(allFinite, nonFiniteIndex)
+    } else {
+      checkOutputs = Seq.empty
+    }
   }
 
   override def beforeSessionRun[F, E, R](runContext: Hook.SessionRunContext[F, E, R])(implicit
       executableEv: Executable[E],
       fetchableEv: Fetchable.Aux[F, R]
   ): Option[Hook.SessionRunArgs[Seq[Output], Traversable[Op], Seq[Tensor]]] = {
-    Some(Hook.SessionRunArgs(fetches = outputs))
+    Some(Hook.SessionRunArgs(fetches = checkOutputs))
   }
 
   @throws[IllegalStateException]
@@ -54,8 +68,10 @@ case class TensorNaNHook(tensorNames: Set[String], failOnNaN: Boolean = true) ex
       executableEv: Executable[E],
       fetchableEv: Fetchable.Aux[F, R]
   ): Unit = {
-    runResult.values.filter(_.isNaN.any().scalar.asInstanceOf[Boolean]).foreach(value => {
-      val message = s"Encountered NaN values in tensor: $value."
+    if (runResult.values.nonEmpty && !runResult.values(0).scalar.asInstanceOf[Boolean]) {
+      val index = runResult.values(1).scalar.asInstanceOf[Int]
+      val kind = if (checkInf) "NaN or infinite" else "NaN"
+      val message = s"Encountered $kind values in tensor: ${outputs(index).name}."
       if (failOnNaN) {
         TensorNaNHook.logger.error(message)
         throw new IllegalStateException(message)
@@ -64,7 +80,7 @@ case class TensorNaNHook(tensorNames: Set[String], failOnNaN: Boolean = true) ex
         // We do not raise an error but we request to stop iterating without throwing an exception.
         runContext.requestStop()
       }
-    })
+    }
   }
 }
 
@@ -29,6 +29,7 @@ object Activation {
     type Activation = layers.Activation
 
     val Sigmoid : layers.Sigmoid.type  = layers.Sigmoid
+    val Tanh    : layers.Tanh.type     = layers.Tanh
     val ReLU    : layers.ReLU.type     = layers.ReLU
     val ReLU6   : layers.ReLU6.type    = layers.ReLU6
     val CReLU   : layers.CReLU.type    = layers.CReLU
@@ -39,6 +40,17 @@ object Activation {
   }
 
   object API extends API
+
+  /** Returns the name with which `activation` is supported by the fused linear kernel (i.e., `ops.NN.fusedLinear`), if
+    * it is supported. */
+  private[layers] def fusedName(activation: Activation): Option[String] = activation match {
+    case _: Sigmoid => Some("sigmoid")
+    case _: Tanh => Some("tanh")
+    case a: ReLU if a.alpha == 0.0f => Some("relu")
+    case _: ReLU6 => Some("relu6")
+    case _: ELU => Some("elu")
+    case _ => None
+  }
 }
 
 case class Sigmoid(override protected val name: String = "Sigmoid")
@@ -50,6 +62,15 @@ case class Sigmoid(override protected val name: String = "Sigmoid")
   }
 }
 
+case class Tanh(override protected val name: String = "Tanh")
+    extends Activation(name) {
+  override val layerType: String = "Tanh"
+
+  override def forward(input: Output, mode: Mode): LayerInstance[Output, Output] = {
+    LayerInstance(input, ops.Math.tanh(input, name = uniquifiedName))
+  }
+}
+
 case class ReLU(alpha: Float = 0.0f, override protected val name: String = "ReLU")
     extends Activation(name) {
   override val layerType: String = if (alpha > 0.0f) f"LeakyReLU($alpha%.2f)" else "ReLU"
@@ -63,13 +63,21 @@ case class Compose[T, R, S] private[layers] (
   override val layerType: String = s"Compose[$layer1>>$layer2]"
 
   override def forward(input: T, mode: Mode): LayerInstance[T, S] = {
-    val layer1Instance = layer1.forward(input, mode)
-    val layer2Instance = layer2.forward(layer1Instance.output, mode)
-    LayerInstance(
-      input, layer2Instance.output,
-      layer1Instance.trainableVariables ++ layer2Instance.trainableVariables,
-      layer1Instance.nonTrainableVariables ++ layer2Instance.nonTrainableVariables,
-      layer1Instance.graph)
+    // A linear layer followed by an activation is computed using a single fused kernel, when that is supported.
+    val fusedInstance = (layer1, layer2, input) match {
+      case (linear: Linear, activation: Activation, output: Output) =>
+        Activation.fusedName(activation).flatMap(linear.fusedForward(output, _))
+      case _ => None
+    }
+    fusedInstance.map(_.asInstanceOf[LayerInstance[T, S]]).getOrElse({
+      val layer1Instance = layer1.forward(input, mode)
+      val layer2Instance = layer2.forward(layer1Instance.output, mode)
+      LayerInstance(
+        input, layer2Instance.output,
+        layer1Instance.trainableVariables ++ layer2Instance.trainableVariables,
+        layer1Instance.nonTrainableVariables ++ layer2Instance.nonTrainableVariables,
+        layer1Instance.graph)
+    })
   }
 }
 
@@ -17,16 +17,20 @@ package org.platanios.tensorflow.api.learn.layers
 
 import org.platanios.tensorflow.api.Implicits._
 import org.platanios.tensorflow.api.core.Shape
-import org.platanios.tensorflow.api.learn.{Mode, layers}
+import org.platanios.tensorflow.api.learn.{Mode, TRAINING, layers}
 import org.platanios.tensorflow.api.ops
-import org.platanios.tensorflow.api.ops.Output
+import org.platanios.tensorflow.api.ops.{EmbeddingParameters, HashEmbeddingTable, Output}
+import org.platanios.tensorflow.api.ops.variables.ZerosInitializer
 import org.platanios.tensorflow.api.tensors.Tensor
-import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.api.types.{DataType, FLOAT32}
 
 object Embedding {
   private[layers] trait API {
     type Embedding = layers.Embedding
-    val Embedding: layers.Embedding.type = layers.Embedding
+    type HashEmbedding = layers.HashEmbedding
+
+    val Embedding    : layers.Embedding.type     = layers.Embedding
+    val HashEmbedding: layers.HashEmbedding.type = layers.HashEmbedding
   }
 
   object API extends API
@@ -52,3 +56,58 @@ case class Embedding(
     LayerInstance(input, output, Set(embeddingMap))
   }
 }
+
+/** Embedding layer for open-vocabulary `INT32` or `INT64` ids, which uses growable [[HashEmbeddingTable]]s rather
+  * than an embedding variable with a fixed vocabulary size.
+  *
+  * The ids are partitioned across `numShards` tables using [[ops.Embedding.ModStrategy]] (and so, when using multiple
+  * shards, the ids must be non-negative). The rows of new ids are only created in the `TRAINING` mode, and ids that are
+  * not in the tables are embedded as zero vectors in the other modes. In the `TRAINING` mode, the tables are updated by
+  * their own sparse update ops (using `optimizer` and `learningRate`), which run whenever the optimizer of the model
+  * updates the `GradientSink` variable of this layer. That variable is a trainable scalar whose gradient is always
+  * zero. The tables are saved in checkpoints by the default saver.
+  *
+  * @param  embeddingSize    Size of each embedding.
+  * @param  numShards        Number of tables over which the ids are partitioned.
+  * @param  initializerRange Range of the uniformly distributed initial values of the rows.
+  * @param  seed             Seed used to derive the initial values of the rows from their ids.
+  * @param  minFrequency     Number of lookups after which an id is admitted into the tables.
+  * @param  ttlSteps         Number of steps after which rows that have not been accessed can be evicted. If `0`, rows
+  *                          are never evicted. Note that eviction must be performed explicitly (e.g., periodically,
+  *                          using [[HashEmbeddingTable.evict]] on the tables of the graph collection
+  *                          `Graph.Keys.HASH_EMBEDDING_TABLES`).
+  * @param  optimizer        Update rule used for the tables, which must be either `"sgd"` or `"adagrad"`.
+  * @param  learningRate     Learning rate used for the tables.
+  * @param  name             Name for this layer.
+  */
+case class HashEmbedding(
+    embeddingSize: Int,
+    numShards: Int = 1,
+    initializerRange: Float = 0.05f,
+    seed: Long = 0L,
+    minFrequency: Int = 1,
+    ttlSteps: Long = 0L,
+    optimizer: String = "adagrad",
+    learningRate: Float = 0.05f,
+    override protected val name: String = "HashEmbedding")
+    extends Layer[Output, Output](name) {
+  override val layerType: String = "HashEmbedding"
+
+  override def forward(input: Output, mode: Mode): LayerInstance[Output, Output] = {
+    val tables = (0 until numShards).map(shard => HashEmbeddingTable(
+      embeddingSize, initializerRange, seed, minFrequency, ttlSteps, optimizer, learningRate,
+      sharedName = s"$uniquifiedName/Shard$shard", name = s"$uniquifiedName/Shard$shard"))
+    if (mode == TRAINING) {
+      val sink = variable(s"$uniquifiedName/GradientSink", FLOAT32, Shape(), ZerosInitializer)
+      val trainingTables = tables.map(_.withLookupSettings(gradientSinks = Seq(sink.value)))
+      val output = ops.Embedding.embeddingLookup(
+        trainingTables: Seq[EmbeddingParameters], input, ops.Embedding.ModStrategy, name = uniquifiedName)
+      LayerInstance(input, output, Set(sink))
+    } else {
+      val inferenceTables = tables.map(_.withLookupSettings(createMissing = false))
+      val output = ops.Embedding.embeddingLookup(
+        inferenceTables: Seq[EmbeddingParameters], input, ops.Embedding.ModStrategy, name = uniquifiedName)
+      LayerInstance(input, output)
+    }
+  }
+}
@@ -20,8 +20,9 @@ import org.platanios.tensorflow.api.learn._
 import org.platanios.tensorflow.api.ops.variables.Variable.VariableGetter
 import org.platanios.tensorflow.api.ops.variables.VariableScope.maybeWrapCustomVariableGetter
 import org.platanios.tensorflow.api.ops.{Op, OpSpecification}
+import org.platanios.tensorflow.api.ops.training.MixedPrecision
 import org.platanios.tensorflow.api.ops.variables._
-import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.api.types.{DataType, FLOAT32}
 
 import scala.collection.generic.CanBuildFrom
 import scala.collection.{TraversableLike, mutable}
@@ -86,12 +87,23 @@ abstract class Layer[T, R](
       collections, cachingDevice)
   }
 
+  /** Returns the data type in which the compute-intensive ops of this layer (e.g., matrix multiplications and
+    * convolutions) should be performed, for inputs of data type `dataType`. This is the mixed-precision compute data
+    * type for `FLOAT32` inputs, if mixed-precision training is enabled in the current layer creation context, and
+    * `dataType` otherwise. */
+  protected def computeDataType(dataType: DataType): DataType = context.value.mixedPrecision match {
+    case Some(mixedPrecision) if dataType == FLOAT32 => mixedPrecision.computeDataType
+    case _ => dataType
+  }
+
   override def toString: String = s"$uniquifiedName[$layerType]"
 }
 
 private[api] final case class LayerCreationContext(
     nameScope: String = "", variableScope: VariableScope = VariableScope(reuse = ReuseOrCreateNew),
-    device: String = "", deviceFunction: OpSpecification => String = _.device)
+    device: String = "", deviceFunction: OpSpecification => String = _.device,
+    mixedPrecision: Option[MixedPrecision] = None,
+    towerReplication: Option[TowerReplication] = None)
 
 object Layer {
   trait API {
@@ -169,6 +181,41 @@ object Layer {
     context.value.deviceFunction
   }
 
+  /** Returns the mixed-precision configuration of the current layer creation context. */
+  private[learn] def currentMixedPrecision(
+      implicit context: DynamicVariable[LayerCreationContext]): Option[MixedPrecision] = {
+    context.value.mixedPrecision
+  }
+
+  /** Creates a context in which the layers use the provided mixed-precision configuration. If `mixedPrecision` is
+    * `None`, the configuration of the current layer creation context is used instead. */
+  private[learn] def createWithMixedPrecision[R](mixedPrecision: Option[MixedPrecision])(block: => R)(implicit
+      context: DynamicVariable[LayerCreationContext]
+  ): R = {
+    if (mixedPrecision.isEmpty)
+      block
+    else
+      context.withValue(context.value.copy(mixedPrecision = mixedPrecision))(block)
+  }
+
+  /** Returns the tower replication configuration of the current layer creation context. */
+  private[learn] def currentTowerReplication(
+      implicit context: DynamicVariable[LayerCreationContext]): Option[TowerReplication] = {
+    context.value.towerReplication
+  }
+
+  /** Creates a context in which the trainable models replicate their layers using the provided tower replication
+    * configuration. If `towerReplication` is `None`, the configuration of the current layer creation context is used
+    * instead. */
+  private[learn] def createWithTowerReplication[R](towerReplication: Option[TowerReplication])(block: => R)(implicit
+      context: DynamicVariable[LayerCreationContext]
+  ): R = {
+    if (towerReplication.isEmpty)
+      block
+    else
+      context.withValue(context.value.copy(towerReplication = towerReplication))(block)
+  }
+
   /** Set that contains the current layer names in use. */
   private[this] val namesInUse: mutable.Set[String] = mutable.Set.empty[String]
 
@@ -15,10 +15,13 @@
 
 package org.platanios.tensorflow.api.learn.layers
 
-import org.platanios.tensorflow.api.learn.{Mode, layers}
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.learn.{Mode, TRAINING, layers}
 import org.platanios.tensorflow.api.ops
 import org.platanios.tensorflow.api.ops.Output
+import org.platanios.tensorflow.api.ops.variables.{Initializer, RandomNormalInitializer, Variable, ZerosInitializer}
 import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.types.INT64
 
 /**
   * @author Emmanouil Antonios Platanios
@@ -34,6 +37,8 @@ object Loss {
     type SigmoidCrossEntropy = layers.SigmoidCrossEntropy
     type LogPoissonLoss = layers.LogPoissonLoss
     type SequenceLoss = layers.SequenceLoss
+    type SampledSoftmaxLoss = layers.SampledSoftmaxLoss
+    type NCELoss = layers.NCELoss
 
     val L2Loss                   : layers.L2Loss.type                    = layers.L2Loss
     val SoftmaxCrossEntropy      : layers.SoftmaxCrossEntropy.type       = layers.SoftmaxCrossEntropy
@@ -41,6 +46,8 @@ object Loss {
     val SigmoidCrossEntropy      : layers.SigmoidCrossEntropy.type       = layers.SigmoidCrossEntropy
     val LogPoissonLoss           : layers.LogPoissonLoss.type            = layers.LogPoissonLoss
     val SequenceLoss             : layers.SequenceLoss.type              = layers.SequenceLoss
+    val SampledSoftmaxLoss       : layers.SampledSoftmaxLoss.type        = layers.SampledSoftmaxLoss
+    val NCELoss                  : layers.NCELoss.type                   = layers.NCELoss
   }
 
   object API extends API
@@ -107,3 +114,110 @@ case class SequenceLoss(
       averageAcrossTimeSteps, averageAcrossBatch, lossFn, name = uniquifiedName))
   }
 }
+
+/** Base class for losses over a large number of classes that are computed over a random sample of the classes while
+  * training, and over all classes otherwise.
+  *
+  * The input consists of the activations of the last hidden layer, with shape `[batchSize, dimension]`, and the target
+  * classes, with shape `[batchSize, numTrue]`. The layer owns the output embeddings and biases of the classes. If
+  * `distributionFile` is provided, the classes are sampled from the unigram distribution stored in it (using
+  * [[ops.NN.mappedUnigramCandidateSampler]]). Otherwise, they are sampled from a log-uniform distribution, which
+  * assumes that the classes are sorted in order of decreasing frequency.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+abstract class CandidateSamplingLoss(override protected val name: String) extends Loss[(Output, Output)](name) {
+  val numClasses        : Int
+  val numSampled        : Int
+  val numTrue           : Int
+  val distributionFile  : String
+  val distortion        : Float
+  val weightsInitializer: Initializer
+  val seed              : Option[Int]
+
+  protected def sampledLoss(
+      weights: Output, biases: Output, labels: Output, inputs: Output, sampledValues: (Output, Output, Output)): Output
+
+  protected def fullLoss(logits: Output, labels: Output): Output
+
+  override def forward(input: (Output, Output), mode: Mode): LayerInstance[(Output, Output), Output] = {
+    val (inputs, labels) = input
+    val weights = variable(
+      s"$uniquifiedName/Weights", inputs.dataType, Shape(numClasses, inputs.shape(-1)), weightsInitializer)
+    val biases = variable(s"$uniquifiedName/Biases", inputs.dataType, Shape(numClasses), ZerosInitializer)
+    val int64Labels = ops.Basic.reshape(ops.Math.cast(labels, INT64), Shape(-1, numTrue))
+    val loss = mode match {
+      case TRAINING =>
+        val sampledValues = {
+          if (distributionFile != null)
+            ops.NN.mappedUnigramCandidateSampler(
+              int64Labels, numTrue, numSampled, unique = true, numClasses, distributionFile, distortion, seed,
+              name = s"$uniquifiedName/CandidateSampler")
+          else
+            ops.NN.logUniformCandidateSampler(
+              int64Labels, numTrue, numSampled, unique = true, numClasses, seed,
+              name = s"$uniquifiedName/CandidateSampler")
+        }
+        sampledLoss(weights.value, biases.value, int64Labels, inputs, sampledValues)
+      case _ =>
+        val logits = ops.NN.addBias(ops.Math.matmul(inputs, weights.value, transposeB = true), biases.value)
+        fullLoss(logits, int64Labels)
+    }
+    LayerInstance(input, loss, Set[Variable](weights, biases))
+  }
+}
+
+case class SampledSoftmaxLoss(
+    numClasses: Int,
+    numSampled: Int,
+    numTrue: Int = 1,
+    distributionFile: String = null,
+    distortion: Float = 1.0f,
+    removeAccidentalHits: Boolean = true,
+    weightsInitializer: Initializer = RandomNormalInitializer(),
+    seed: Option[Int] = None,
+    override protected val name: String = "SampledSoftmaxLoss"
+) extends CandidateSamplingLoss(name) {
+  override val layerType: String = s"SampledSoftmaxLoss[$numSampled/$numClasses]"
+
+  override protected def sampledLoss(
+      weights: Output, biases: Output, labels: Output, inputs: Output,
+      sampledValues: (Output, Output, Output)): Output = {
+    ops.NN.sampledSoftmaxLoss(
+      weights, biases, labels, inputs, numSampled, numClasses, numTrue, sampledValues, removeAccidentalHits, seed,
+      name = uniquifiedName)
+  }
+
+  override protected def fullLoss(logits: Output, labels: Output): Output = {
+    val oneHotLabels = ops.Math.sum(ops.Basic.oneHot(labels, numClasses, dataType = logits.dataType), axes = 1)
+    ops.NN.softmaxCrossEntropy(logits, oneHotLabels / ops.Basic.constant(numTrue, logits.dataType),
+      name = uniquifiedName)
+  }
+}
+
+case class NCELoss(
+    numClasses: Int,
+    numSampled: Int,
+    numTrue: Int = 1,
+    distributionFile: String = null,
+    distortion: Float = 1.0f,
+    removeAccidentalHits: Boolean = false,
+    weightsInitializer: Initializer = RandomNormalInitializer(),
+    seed: Option[Int] = None,
+    override protected val name: String = "NCELoss"
+) extends CandidateSamplingLoss(name) {
+  override val layerType: String = s"NCELoss[$numSampled/$numClasses]"
+
+  override protected def sampledLoss(
+      weights: Output, biases: Output, labels: Output, inputs: Output,
+      sampledValues: (Output, Output, Output)): Output = {
+    ops.NN.nceLoss(
+      weights, biases, labels, inputs, numSampled, numClasses, numTrue, sampledValues, removeAccidentalHits, seed,
+      name = uniquifiedName)
+  }
+
+  override protected def fullLoss(logits: Output, labels: Output): Output = {
+    val oneHotLabels = ops.Math.sum(ops.Basic.oneHot(labels, numClasses, dataType = logits.dataType), axes = 1)
+    ops.Math.sum(ops.NN.sigmoidCrossEntropy(logits, oneHotLabels), axes = 1, name = uniquifiedName)
+  }
+}
@@ -20,7 +20,7 @@ import org.platanios.tensorflow.api.learn.{Mode, layers}
 import org.platanios.tensorflow.api.ops
 import org.platanios.tensorflow.api.ops.Output
 import org.platanios.tensorflow.api.ops.variables.{Initializer, RandomNormalInitializer, Variable}
-import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.api.types.{DataType, FLOAT32, FLOAT64}
 
 import scala.collection.mutable
 
@@ -94,18 +94,44 @@ case class Linear(
   override val layerType: String = s"Linear[$units]"
 
   override def forward(input: Output, mode: Mode): LayerInstance[Output, Output] = {
-    val weights = variable(s"$uniquifiedName/Weights", input.dataType, Shape(input.shape(-1), units), weightsInitializer)
+    val weights = weightsVariable(input)
     val trainableVariables = mutable.Set[Variable](weights)
-    val product = ops.Math.matmul(input, weights.value)
+    // The variables are always kept in the input data type, but the computation may use a lower precision.
+    val dataType = computeDataType(input.dataType)
+    val product = ops.Math.matmul(ops.Math.cast(input, dataType), ops.Math.cast(weights.value, dataType))
     val output = {
       if (useBias) {
-        val bias = variable(s"$uniquifiedName/Bias", input.dataType, Shape(units), biasInitializer)
+        val bias = biasVariable(input)
         trainableVariables += bias
-        ops.NN.addBias(product, bias.value)
+        ops.NN.addBias(product, ops.Math.cast(bias.value, dataType))
       } else {
         product
       }
     }
-    LayerInstance(input, output, trainableVariables.toSet)
+    LayerInstance(input, ops.Math.cast(output, input.dataType), trainableVariables.toSet)
+  }
+
+  /** Applies this layer followed by `activation` to `input` using a single fused kernel, if that is supported for
+    * `input` (i.e., if it is a [[FLOAT32]] or [[FLOAT64]] matrix that is not computed in a lower precision) and for
+    * this layer (i.e., if it uses a bias). Returns `None` otherwise. The created variables are the same as those of
+    * [[forward]]. */
+  private[layers] def fusedForward(input: Output, activation: String): Option[LayerInstance[Output, Output]] = {
+    val dataType = computeDataType(input.dataType)
+    if (useBias && input.rank == 2 && dataType == input.dataType && (dataType == FLOAT32 || dataType == FLOAT64)) {
+      val weights = weightsVariable(input)
+      val bias = biasVariable(input)
+      val output = ops.NN.fusedLinear(input, weights.value, bias.value, activation, s"$uniquifiedName/FusedLinear")
+      Some(LayerInstance(input, output, Set(weights, bias)))
+    } else {
+      None
+    }
+  }
+
+  private[this] def weightsVariable(input: Output): Variable = {
+    variable(s"$uniquifiedName/Weights", input.dataType, Shape(input.shape(-1), units), weightsInitializer)
+  }
+
+  private[this] def biasVariable(input: Output): Variable = {
+    variable(s"$uniquifiedName/Bias", input.dataType, Shape(units), biasInitializer)
   }
 }
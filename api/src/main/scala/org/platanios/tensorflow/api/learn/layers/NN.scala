@@ -19,8 +19,10 @@ import org.platanios.tensorflow.api.Shape
 import org.platanios.tensorflow.api.learn.{Mode, TRAINING, layers}
 import org.platanios.tensorflow.api.ops
 import org.platanios.tensorflow.api.ops.NN.{CNNDataFormat, PaddingMode}
-import org.platanios.tensorflow.api.ops.Output
+import org.platanios.tensorflow.api.ops.{Op, Output}
 import org.platanios.tensorflow.api.ops.variables.{Initializer, RandomNormalInitializer}
+import org.platanios.tensorflow.api.ops.variables.{OnesInitializer, ZerosInitializer}
+import org.platanios.tensorflow.api.types.FLOAT32
 
 /**
   * @author Emmanouil Antonios Platanios
@@ -32,12 +34,14 @@ object NN {
     type Dropout = layers.Dropout
     type Conv2D = layers.Conv2D
     type MaxPool = layers.MaxPool
+    type BatchNormalization = layers.BatchNormalization
 
-    val Softmax   : layers.Softmax.type    = layers.Softmax
-    val LogSoftmax: layers.LogSoftmax.type = layers.LogSoftmax
-    val Dropout   : layers.Dropout.type    = layers.Dropout
-    val Conv2D    : layers.Conv2D.type     = layers.Conv2D
-    val MaxPool   : layers.MaxPool.type    = layers.MaxPool
+    val Softmax           : layers.Softmax.type            = layers.Softmax
+    val LogSoftmax        : layers.LogSoftmax.type         = layers.LogSoftmax
+    val Dropout           : layers.Dropout.type            = layers.Dropout
+    val Conv2D            : layers.Conv2D.type             = layers.Conv2D
+    val MaxPool           : layers.MaxPool.type            = layers.MaxPool
+    val BatchNormalization: layers.BatchNormalization.type = layers.BatchNormalization
   }
 
   object API extends API
@@ -94,8 +98,12 @@ case class Conv2D(
 
   override def forward(input: Output, mode: Mode): LayerInstance[Output, Output] = {
     val weights = variable(s"$uniquifiedName/Weights", input.dataType, filterShape, weightsInitializer)
-    val output = ops.NN.conv2D(input, weights, stride1, stride2, padding, dataFormat, useCuDNNOnGPU, s"$uniquifiedName/Conv2D")
-    LayerInstance(input, output, Set(weights))
+    // The weights are always kept in the input data type, but the computation may use a lower precision.
+    val dataType = computeDataType(input.dataType)
+    val output = ops.NN.conv2D(
+      ops.Math.cast(input, dataType), ops.Math.cast(weights.value, dataType), stride1, stride2, padding, dataFormat,
+      useCuDNNOnGPU, s"$uniquifiedName/Conv2D")
+    LayerInstance(input, ops.Math.cast(output, input.dataType), Set(weights))
   }
 }
 
@@ -114,3 +122,76 @@ case class MaxPool(
     LayerInstance(input, output)
   }
 }
+
+/** Batch normalization layer, which normalizes its input over all axes except for the last one (i.e., the channels
+  * axis), and then scales and shifts it using trainable per-channel parameters.
+  *
+  * While training, the input is normalized using the statistics of the current batch and moving averages of these
+  * statistics are maintained in non-trainable variables. Otherwise, the moving averages are used for the
+  * normalization. [[FLOAT32]] inputs are normalized using the fused batch normalization kernel, which computes the
+  * batch statistics and the normalized output together. For other data types, the batch statistics are computed using
+  * [[ops.Statistics.moments]].
+  *
+  * @param  momentum Momentum of the moving averages of the batch statistics.
+  * @param  epsilon  Small number added to the variance to avoid dividing by zero.
+  * @param  name     Name for this layer.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class BatchNormalization(
+    momentum: Float = 0.99f,
+    epsilon: Float = 1e-3f,
+    override protected val name: String = "BatchNormalization"
+) extends Layer[Output, Output](name) {
+  override val layerType: String = s"BatchNormalization[$momentum]"
+
+  override def forward(input: Output, mode: Mode): LayerInstance[Output, Output] = {
+    val channelsShape = Shape(input.shape(-1))
+    val gamma = variable(s"$uniquifiedName/Gamma", input.dataType, channelsShape, OnesInitializer)
+    val beta = variable(s"$uniquifiedName/Beta", input.dataType, channelsShape, ZerosInitializer)
+    val movingMean = variable(
+      s"$uniquifiedName/MovingMean", input.dataType, channelsShape, ZerosInitializer, trainable = false)
+    val movingVariance = variable(
+      s"$uniquifiedName/MovingVariance", input.dataType, channelsShape, OnesInitializer, trainable = false)
+    val isTraining = mode == TRAINING
+    val (output, batchMean, batchVariance) = {
+      if (input.dataType == FLOAT32) {
+        // The fused kernel expects a 4-D input and so all axes but the last are collapsed into the batch axis.
+        val reshapedInput = ops.Basic.reshape(input, Shape(-1, 1, 1, input.shape(-1)))
+        val (output, batchMean, batchVariance) = {
+          if (isTraining)
+            ops.NN.fusedBatchNormalization(
+              reshapedInput, gamma.value, beta.value, epsilon = epsilon, isTraining = true,
+              name = s"$uniquifiedName/FusedBatchNormalization")
+          else
+            ops.NN.fusedBatchNormalization(
+              reshapedInput, gamma.value, beta.value, movingMean.value, movingVariance.value, epsilon,
+              isTraining = false, name = s"$uniquifiedName/FusedBatchNormalization")
+        }
+        (ops.Basic.reshape(output, ops.Basic.shape(input)), batchMean, batchVariance)
+      } else {
+        val (mean, variance) = {
+          if (isTraining)
+            ops.Statistics.moments(input, 0 until input.rank - 1, name = s"$uniquifiedName/Moments")
+          else
+            (movingMean.value, movingVariance.value)
+        }
+        val scale = ops.Math.rsqrt(variance + ops.Basic.constant(epsilon, input.dataType)) * gamma.value
+        ((input - mean) * scale + beta.value, mean, variance)
+      }
+    }
+    val finalOutput = {
+      if (isTraining) {
+        val decay = ops.Basic.constant(1.0f - momentum, input.dataType)
+        val meanUpdate = movingMean.assignSub((movingMean.value - batchMean) * decay)
+        val varianceUpdate = movingVariance.assignSub((movingVariance.value - batchVariance) * decay)
+        Op.createWith(controlDependencies = Set(meanUpdate.op, varianceUpdate.op)) {
+          ops.Basic.identity(output, name = s"$uniquifiedName/Output")
+        }
+      } else {
+        output
+      }
+    }
+    LayerInstance(input, finalOutput, Set(gamma, beta), Set(movingMean, movingVariance))
+  }
+}
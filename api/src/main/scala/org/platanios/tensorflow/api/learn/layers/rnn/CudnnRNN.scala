@@ -0,0 +1,98 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.platanios.tensorflow.api.learn.layers.rnn
+
+import org.platanios.tensorflow.api.Implicits._
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.core.exception.InvalidShapeException
+import org.platanios.tensorflow.api.learn.{Mode, TRAINING}
+import org.platanios.tensorflow.api.learn.layers.{Layer, LayerInstance}
+import org.platanios.tensorflow.api.learn.layers.rnn.cell.RNNCell
+import org.platanios.tensorflow.api.ops
+import org.platanios.tensorflow.api.ops.Output
+import org.platanios.tensorflow.api.ops.variables.{Initializer, RandomUniformInitializer}
+
+/** Creates a multi-layer RNN layer that uses a fused, cuDNN-backed, kernel for whole sequences, instead of a dynamic
+  * loop over the time steps. This is an alternative execution mode for the [[RNN]] and [[BidirectionalRNN]] layers,
+  * for the cell types supported by cuDNN, when running on GPUs.
+  *
+  * $OpDocRNNCudnnRNN
+  *
+  * The output of this layer is an RNN cell tuple whose `output` contains the RNN outputs for all time steps, with
+  * the forward and backward outputs concatenated along the last axis for bidirectional RNNs, and whose `state` contains
+  * the final hidden and cell states, each shaped `[numLayers * numDirections, batchSize, numUnits]`. The cell state is
+  * only meaningful for LSTM RNNs.
+  *
+  * @param  mode                  RNN mode (i.e., type of RNN cell).
+  * @param  numUnits              Number of units per layer and direction.
+  * @param  numLayers             Number of layers.
+  * @param  bidirectional         If `true`, a bidirectional RNN is created.
+  * @param  dropout               Dropout probability applied between layers, during training.
+  * @param  timeMajor             Boolean value indicating whether the inputs are provided in time-major format (i.e.,
+  *                               have shape `[time, batch, depth]`) or in batch-major format (i.e., have shape
+  *                               `[batch, time, depth]`). The outputs use the same format as the inputs.
+  * @param  parametersInitializer Variable initializer for the opaque parameters tensor.
+  * @param  name                  Desired name for this layer (note that this name will be made unique by potentially
+  *                               appending a number to it, if it has been used before for another layer).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class CudnnRNN private[rnn] (
+    val mode: ops.rnn.CudnnRNN.Mode,
+    val numUnits: Int,
+    val numLayers: Int = 1,
+    val bidirectional: Boolean = false,
+    val dropout: Float = 0.0f,
+    val timeMajor: Boolean = false,
+    val parametersInitializer: Initializer = RandomUniformInitializer(-0.1f, 0.1f),
+    override protected val name: String = "CudnnRNN"
+) extends Layer[Output, RNNCell.Tuple[Output, (Output, Output)]](name) {
+  override val layerType: String = "CudnnRNN"
+
+  @throws[InvalidShapeException]
+  override def forward(input: Output, mode: Mode): LayerInstance[Output, RNNCell.Tuple[Output, (Output, Output)]] = {
+    if (input.rank != 3 || input.shape(-1) == -1)
+      throw InvalidShapeException(
+        s"The input must be rank-3 with a known last axis size, but its shape is ${input.shape}.")
+    val inputSize = input.shape(-1)
+    val parametersSize = ops.rnn.CudnnRNN.parametersSize(this.mode, numLayers, numUnits, inputSize, bidirectional)
+    val parameters = variable("Parameters", input.dataType, Shape(parametersSize.toInt), parametersInitializer)
+    val timeMajorInput = if (timeMajor) input else ops.rnn.RNN.transposeBatchTime(input)
+    val numDirections = if (bidirectional) 2 else 1
+    val batchSize = ops.Basic.shape(timeMajorInput)(1)
+    val stateShape = ops.Basic.stack(Seq[Output](numLayers * numDirections, batchSize, numUnits))
+    val initialState = ops.Basic.fill(input.dataType, stateShape)(0, name = "InitialState")
+    val (output, h, c) = ops.rnn.CudnnRNN.cudnnRNN(
+      timeMajorInput, initialState, initialState, parameters.value, this.mode, bidirectional, dropout,
+      training = mode == TRAINING, name = uniquifiedName)
+    val result = if (timeMajor) output else ops.rnn.RNN.transposeBatchTime(output)
+    LayerInstance(input, RNNCell.Tuple(result, (h, c)), Set(parameters))
+  }
+}
+
+object CudnnRNN {
+  def apply(
+      mode: ops.rnn.CudnnRNN.Mode,
+      numUnits: Int,
+      numLayers: Int = 1,
+      bidirectional: Boolean = false,
+      dropout: Float = 0.0f,
+      timeMajor: Boolean = false,
+      parametersInitializer: Initializer = RandomUniformInitializer(-0.1f, 0.1f),
+      name: String = "CudnnRNN"
+  ): CudnnRNN = {
+    new CudnnRNN(mode, numUnits, numLayers, bidirectional, dropout, timeMajor, parametersInitializer, name)
+  }
+}
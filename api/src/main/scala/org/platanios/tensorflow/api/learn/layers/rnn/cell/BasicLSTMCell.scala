@@ -28,6 +28,9 @@ import org.platanios.tensorflow.api.ops.variables.{Initializer, ZerosInitializer
   * @param  activation        Activation function used by this GRU cell.
   * @param  kernelInitializer Variable initializer for kernel matrices.
   * @param  biasInitializer   Variable initializer for the bias vectors.
+  * @param  fused             If `true`, each step is computed using a single fused kernel (and so is each gradient
+  *                           step). The fused kernel always uses the `tanh` activation function and `activation` must
+  *                           thus be left to its default value.
   * @param  name              Desired name for this layer (note that this name will be made unique by potentially
   *                           appending a number to it, if it has been used before for another layer).
   *
@@ -39,6 +42,7 @@ class BasicLSTMCell private[cell] (
     val activation: Output => Output = ops.Math.tanh(_),
     val kernelInitializer: Initializer = null,
     val biasInitializer: Initializer = ZerosInitializer,
+    val fused: Boolean = false,
     override protected val name: String = "BasicLSTMCell"
 ) extends RNNCell.LSTMCell(name) {
   override val layerType: String = "BasicLSTMCell"
@@ -47,7 +51,7 @@ class BasicLSTMCell private[cell] (
     val kernel = variable(
       KERNEL_NAME, input.dataType, Shape(input.shape(-1) + numUnits, 4 * numUnits), kernelInitializer)
     val bias = variable(BIAS_NAME, input.dataType, Shape(4 * numUnits), biasInitializer)
-    val cell = ops.rnn.cell.BasicLSTMCell(kernel, bias, activation, forgetBias, name)
+    val cell = ops.rnn.cell.BasicLSTMCell(kernel, bias, activation, forgetBias, fused, name)
     RNNCell.LSTMCellInstance(cell, Set(kernel, bias))
   }
 }
@@ -59,7 +63,8 @@ object BasicLSTMCell {
       activation: Output => Output = ops.Math.tanh(_),
       kernelInitializer: Initializer = null,
       biasInitializer: Initializer = ZerosInitializer,
+      fused: Boolean = false,
       name: String = "BasicLSTMCell"): BasicLSTMCell = {
-    new BasicLSTMCell(numUnits, forgetBias, activation, kernelInitializer, biasInitializer, name)
+    new BasicLSTMCell(numUnits, forgetBias, activation, kernelInitializer, biasInitializer, fused, name)
   }
 }
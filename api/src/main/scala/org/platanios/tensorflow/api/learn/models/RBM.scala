@@ -24,7 +24,7 @@ import org.platanios.tensorflow.api.ops.training.optimizers.Optimizer
 import org.platanios.tensorflow.api.ops.variables.{RandomNormalInitializer, Variable, ZerosInitializer}
 import org.platanios.tensorflow.api.ops.{Basic, Math, NN, Op, Output, Random}
 import org.platanios.tensorflow.api.tensors.Tensor
-import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.api.types.{DataType, FLOAT32, FLOAT64}
 
 import scala.collection.mutable
 
@@ -36,7 +36,8 @@ class RBM(
     val meanFieldCD: Boolean = false,
     val cdSteps: Int = 1,
     val optimizer: Optimizer,
-    val name: String = "RBM"
+    val name: String = "RBM",
+    val fusedCD: Boolean = true
 ) extends UnsupervisedTrainableModel[Tensor, Output, DataType, Shape, Output] {
   type InferOps = Model.InferenceOps[Tensor, Output, DataType, Shape, Output]
   type TrainOps = Model.UnsupervisedTrainingOps[Tensor, Output, DataType, Shape, Output]
@@ -119,18 +120,24 @@ class RBM(
     })
   }
 
-  /** Runs a `k`-step Gibbs sampling chain to sample from the probability distribution of an RBM. */
+  /** Runs a `k`-step Gibbs sampling chain to sample from the probability distribution of an RBM. If `fusedCD` is
+    * `true` and the data type is `FLOAT32` or `FLOAT64`, the whole chain runs in a single fused op (see
+    * [[RBM.gibbsChain]]). */
   private[this] def contrastiveDivergence(initialV: Output, vb: Variable, hb: Variable, w: Variable): Output = {
-    var i = 0
-    var v = initialV
-    while (i < cdSteps) {
-      val hProb = RBM.conditionalHGivenV(v, hb, w)
-      val h = if (meanFieldCD) hProb else RBM.sampleBinary(hProb)
-      val vProb = RBM.conditionalVGivenH(h, vb, w)
-      v = if (meanFieldCD) vProb else RBM.sampleBinary(vProb)
-      i += 1
+    if (fusedCD && (dataType == FLOAT32 || dataType == FLOAT64)) {
+      Basic.stopGradient(RBM.gibbsChain(initialV, vb, hb, w, cdSteps, meanFieldCD))
+    } else {
+      var i = 0
+      var v = initialV
+      while (i < cdSteps) {
+        val hProb = RBM.conditionalHGivenV(v, hb, w)
+        val h = if (meanFieldCD) hProb else RBM.sampleBinary(hProb)
+        val vProb = RBM.conditionalVGivenH(h, vb, w)
+        v = if (meanFieldCD) vProb else RBM.sampleBinary(vProb)
+        i += 1
+      }
+      Basic.stopGradient(v)
     }
-    Basic.stopGradient(v)
   }
 }
 
@@ -143,9 +150,10 @@ object RBM {
       meanFieldCD: Boolean = false,
       cdSteps: Int = 1,
       optimizer: Optimizer,
-      name: String = "RBM"
+      name: String = "RBM",
+      fusedCD: Boolean = true
   ): RBM = {
-    new RBM(input, numHidden, meanField, numSamples, meanFieldCD, cdSteps, optimizer, name)
+    new RBM(input, numHidden, meanField, numSamples, meanFieldCD, cdSteps, optimizer, name, fusedCD)
   }
 
   private[RBM] def conditionalHGivenV(v: Output, hb: Variable, w: Variable): Output = {
@@ -160,6 +168,35 @@ object RBM {
     NN.relu(Math.sign(p - Random.randomUniform(p.dataType, p.shape, 0, 1)))
   }
 
+  /** Creates an op that runs a `numSteps`-step block Gibbs sampling chain starting at `v`, and returns the final
+    * visible units. The matrix multiplications, sigmoids, and Bernoulli sampling of all steps run in a single fused op
+    * that draws its random numbers from a counter-based generator, instead of in five ops per half step.
+    *
+    * @param  v         Initial visible units, shaped `[batchSize, numVisible]`.
+    * @param  vb        Visible unit biases.
+    * @param  hb        Hidden unit biases.
+    * @param  w         Weights, shaped `[numVisible, numHidden]`.
+    * @param  numSteps  Number of Gibbs sampling steps.
+    * @param  meanField If `true`, unit probabilities are used instead of samples.
+    * @param  name      Name for the created op.
+    * @return Visible units after the last step.
+    */
+  private[RBM] def gibbsChain(
+      v: Output, vb: Variable, hb: Variable, w: Variable, numSteps: Int, meanField: Boolean,
+      name: String = "RBMGibbsChain"): Output = {
+    val (graphSeed, opSeed) = Op.currentGraphRandomSeed()
+    Op.Builder(opType = "RBMGibbsChain", name = name)
+        .addInput(v)
+        .addInput(vb.value)
+        .addInput(hb.value)
+        .addInput(w.value)
+        .setAttribute("num_steps", numSteps)
+        .setAttribute("mean_field", meanField)
+        .setAttribute("seed", graphSeed.getOrElse(0))
+        .setAttribute("seed2", opSeed.getOrElse(0))
+        .build().outputs(0)
+  }
+
   private[RBM] def freeEnergy(v: Output, vb: Variable, hb: Variable, w: Variable): Output = {
     val condTerm = -Math.sum(Math.log(1 + Math.exp(Math.add(hb.value, Math.matmul(v, w.value)))), axes = 1, keepDims = true)
     val biasTerm = -Math.matmul(v, Basic.transpose(vb.value(NewAxis)))
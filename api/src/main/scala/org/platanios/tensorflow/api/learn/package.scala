@@ -33,9 +33,16 @@ package object learn {
           with optimizers.API {
     type Configuration = learn.Configuration
     type StopCriteria = learn.StopCriteria
+    type TowerReplication = learn.TowerReplication
+    type VariablePlacement = learn.VariablePlacement
 
     val Configuration: learn.Configuration.type = learn.Configuration
     val StopCriteria : learn.StopCriteria.type  = learn.StopCriteria
+    val TowerReplication: learn.TowerReplication.type = learn.TowerReplication
+
+    val VariablesOnCPU        : learn.VariablesOnCPU.type         = learn.VariablesOnCPU
+    val VariablesOnFirstDevice: learn.VariablesOnFirstDevice.type = learn.VariablesOnFirstDevice
+    val AllReduceGradients    : learn.AllReduceGradients.type     = learn.AllReduceGradients
 
     type Mode = learn.Mode
 
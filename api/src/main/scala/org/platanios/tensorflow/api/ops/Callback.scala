@@ -15,10 +15,16 @@
 
 package org.platanios.tensorflow.api.ops
 
+import org.platanios.tensorflow.api.core.Shape
 import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
 import org.platanios.tensorflow.api.tensors.{SparseTensor, Tensor, TensorIndexedSlices}
 import org.platanios.tensorflow.api.types.{DataType, INT64}
-import org.platanios.tensorflow.jni.{ScalaCallbacksRegistry => NativeCallbacksRegistry, TensorFlow => NativeLibrary}
+import org.platanios.tensorflow.jni.{BufferCallback, ScalaCallbacksRegistry => NativeCallbacksRegistry}
+import org.platanios.tensorflow.jni.{TensorFlow => NativeLibrary}
+
+import java.nio.ByteBuffer
+
+import scala.concurrent.{ExecutionContext, Future}
 
 import scala.collection.SeqLike
 import scala.collection.generic.CanBuildFrom
@@ -38,6 +44,9 @@ private[api] trait Callback {
     *                         given the same input it will return the same output and have no observable side effects.
     *                         Optimizations such as common subexpression elimination are only performed on stateless
     *                         operations.
+    * @param  outputShapes    Optional (possibly partially-known) shapes of the flattened Scala function outputs (i.e.,
+    *                         of the op outputs), which allow downstream ops to infer static shapes. If empty, the
+    *                         output shapes are unknown.
     * @param  name            Name for the created op.
     * @tparam T               Scala function input type (e.g., `Tensor`).
     * @tparam TS              Op input type, which is the symbolic type corresponding to `T` (e.g., `Output`).
@@ -48,7 +57,7 @@ private[api] trait Callback {
     */
   def callback[T, TS, TD, R, RS, RD](
       function: (T) => R, input: TS, outputDataType: RD, stateful: Boolean = true,
-      name: String = "Callback")(implicit
+      outputShapes: Seq[Shape] = Seq.empty, name: String = "Callback")(implicit
       evInput: Callback.ArgType.Aux[T, TS, TD],
       evOutput: Callback.ArgType.Aux[R, RS, RD]
   ): RS = {
@@ -79,9 +88,186 @@ private[api] trait Callback {
     builder.setAttribute("registry_pointer", NativeLibrary.currentCallbackRegistryPointer)
     builder.setAttribute("registry_call_pointer", NativeLibrary.currentCallbackRegistryCallMethodPointer)
     builder.setAttribute("Tout", evOutput.dataTypes(outputDataType).toArray)
+    if (outputShapes.nonEmpty)
+      builder.setAttribute("output_shapes", outputShapes.toArray)
     builder.addInputList(evInput.outputs(input))
     evOutput.decodeSymbolic(builder.build().outputs.toSeq)
   }
+
+  /** $OpDocCallbackAsyncCallback
+    *
+    * @group CallbackOps
+    * @param  function        Scala function to use for the callback op. It is invoked using the provided execution
+    *                         context and the op completes once the future that it returns resolves.
+    * @param  input           Input for the created op.
+    * @param  outputDataType  Data types of the Scala function outputs.
+    * @param  stateful        If `true`, the function should be considered stateful. If a function is stateless, when
+    *                         given the same input it will return the same output and have no observable side effects.
+    *                         Optimizations such as common subexpression elimination are only performed on stateless
+    *                         operations.
+    * @param  outputShapes    Optional (possibly partially-known) shapes of the flattened Scala function outputs (i.e.,
+    *                         of the op outputs), which allow downstream ops to infer static shapes. If empty, the
+    *                         output shapes are unknown.
+    * @param  name            Name for the created op.
+    * @param  executionContext Execution context used to invoke the Scala function.
+    * @tparam T               Scala function input type (e.g., `Tensor`).
+    * @tparam TS              Op input type, which is the symbolic type corresponding to `T` (e.g., `Output`).
+    * @tparam R               Scala function output type (e.g., `Tensor`).
+    * @tparam RS              Op output type, which is the symbolic type corresponding to `R` (e.g., `Output`).
+    * @tparam RD              Structure of data types corresponding to `R` (e.g., `DataType`).
+    * @return Created op output.
+    */
+  def asyncCallback[T, TS, TD, R, RS, RD](
+      function: (T) => Future[R], input: TS, outputDataType: RD, stateful: Boolean = true,
+      outputShapes: Seq[Shape] = Seq.empty, name: String = "AsyncCallback")(implicit
+      evInput: Callback.ArgType.Aux[T, TS, TD],
+      evOutput: Callback.ArgType.Aux[R, RS, RD],
+      executionContext: ExecutionContext
+  ): RS = {
+    val id = NativeCallbacksRegistry.registerAsync(inputs => {
+      val inputTensors = inputs.map(Tensor.fromNativeHandle).toSeq
+      function(evInput.decode(inputTensors)).map(outputs => {
+        evOutput.tensors(outputs).map(_.nativeHandle).toArray
+      })
+    }, executionContext)
+    // The lifetime of the registered function is tied to that of the outermost graph, as for the `callback` op.
+    var graph = Op.currentGraph
+    while (graph.isInstanceOf[FunctionGraph])
+      graph = graph.asInstanceOf[FunctionGraph].outerGraph
+    graph.addCleanupFunction(() => NativeCallbacksRegistry.deregister(id))
+    val builder = {
+      if (stateful)
+        Op.Builder(opType = "JVMAsyncCallback", name = name)
+      else
+        Op.Builder(opType = "JVMAsyncCallbackStateless", name = name)
+    }
+    builder.setAttribute("id", id)
+    builder.setAttribute("jvm_pointer", NativeLibrary.currentJvmPointer)
+    builder.setAttribute("registry_pointer", NativeLibrary.currentCallbackRegistryPointer)
+    builder.setAttribute("registry_call_pointer", NativeLibrary.currentCallbackRegistryCallAsyncMethodPointer)
+    builder.setAttribute("Tout", evOutput.dataTypes(outputDataType).toArray)
+    if (outputShapes.nonEmpty)
+      builder.setAttribute("output_shapes", outputShapes.toArray)
+    builder.addInputList(evInput.outputs(input))
+    evOutput.decodeSymbolic(builder.build().outputs.toSeq)
+  }
+
+  /** $OpDocCallbackBatchCallback
+    *
+    * @group CallbackOps
+    * @param  function           Scala function to use for the callback op. It is given the inputs of all executions
+    *                            in a batch and must return their outputs, in the same order.
+    * @param  input              Input for the created op.
+    * @param  outputDataType     Data types of the Scala function outputs.
+    * @param  maxBatchSize       Maximum number of executions to batch together.
+    * @param  batchTimeoutMicros Maximum number of microseconds that an execution waits for other executions to batch
+    *                            with.
+    * @param  outputShapes       Optional (possibly partially-known) shapes of the flattened outputs of each execution
+    *                            (i.e., of the op outputs), which allow downstream ops to infer static shapes. If
+    *                            empty, the output shapes are unknown.
+    * @param  name               Name for the created op.
+    * @tparam T                  Scala function input type (e.g., `Tensor`).
+    * @tparam TS                 Op input type, which is the symbolic type corresponding to `T` (e.g., `Output`).
+    * @tparam R                  Scala function output type (e.g., `Tensor`).
+    * @tparam RS                 Op output type, which is the symbolic type corresponding to `R` (e.g., `Output`).
+    * @tparam RD                 Structure of data types corresponding to `R` (e.g., `DataType`).
+    * @return Created op output.
+    */
+  def batchCallback[T, TS, TD, R, RS, RD](
+      function: (Seq[T]) => Seq[R], input: TS, outputDataType: RD, maxBatchSize: Int = 32,
+      batchTimeoutMicros: Int = 1000, outputShapes: Seq[Shape] = Seq.empty,
+      name: String = "BatchCallback")(implicit
+      evInput: Callback.ArgType.Aux[T, TS, TD],
+      evOutput: Callback.ArgType.Aux[R, RS, RD]
+  ): RS = {
+    require(maxBatchSize >= 1, s"'maxBatchSize' ($maxBatchSize) must be at least 1.")
+    require(batchTimeoutMicros >= 0, s"'batchTimeoutMicros' ($batchTimeoutMicros) must be non-negative.")
+    val id = NativeCallbacksRegistry.registerBatch((inputs, batchSize) => {
+      val numInputs = inputs.length / batchSize
+      val inputTensors = inputs.map(Tensor.fromNativeHandle).toSeq
+      val batchInputs = (0 until batchSize).map(b => {
+        evInput.decode(inputTensors.slice(b * numInputs, (b + 1) * numInputs))
+      })
+      function(batchInputs).flatMap(evOutput.tensors).map(_.nativeHandle).toArray
+    })
+    // The lifetime of the registered function is tied to that of the outermost graph, as for the `callback` op.
+    var graph = Op.currentGraph
+    while (graph.isInstanceOf[FunctionGraph])
+      graph = graph.asInstanceOf[FunctionGraph].outerGraph
+    graph.addCleanupFunction(() => NativeCallbacksRegistry.deregister(id))
+    val builder = Op.Builder(opType = "JVMBatchCallback", name = name)
+    builder.setAttribute("id", id)
+    builder.setAttribute("jvm_pointer", NativeLibrary.currentJvmPointer)
+    builder.setAttribute("registry_pointer", NativeLibrary.currentCallbackRegistryPointer)
+    builder.setAttribute("registry_call_pointer", NativeLibrary.currentCallbackRegistryCallBatchMethodPointer)
+    builder.setAttribute("Tout", evOutput.dataTypes(outputDataType).toArray)
+    if (outputShapes.nonEmpty)
+      builder.setAttribute("output_shapes", outputShapes.toArray)
+    builder.setAttribute("max_batch_size", maxBatchSize.toLong)
+    builder.setAttribute("batch_timeout_micros", batchTimeoutMicros.toLong)
+    builder.addInputList(evInput.outputs(input))
+    evOutput.decodeSymbolic(builder.build().outputs.toSeq)
+  }
+
+  /** $OpDocCallbackBufferCallback
+    *
+    * @group CallbackOps
+    * @param  function        Scala function to use for the callback op. It is given the inputs and direct buffers over
+    *                         the memory of the already allocated outputs, which it must fill in, in row-major order and
+    *                         in the native byte order.
+    * @param  input           Inputs for the created op.
+    * @param  outputDataTypes Data types of the outputs.
+    * @param  outputShapes    Fully-defined shapes of the outputs.
+    * @param  stateful        If `true`, the function should be considered stateful. If a function is stateless, when
+    *                         given the same input it will return the same output and have no observable side effects.
+    *                         Optimizations such as common subexpression elimination are only performed on stateless
+    *                         operations.
+    * @param  name            Name for the created op.
+    * @return Created op outputs.
+    */
+  def bufferCallback(
+      function: (Seq[Callback.TensorBuffer], Seq[ByteBuffer]) => Unit, input: Seq[Output],
+      outputDataTypes: Seq[DataType], outputShapes: Seq[Shape], stateful: Boolean = true,
+      name: String = "BufferCallback"): Seq[Output] = {
+    require(outputDataTypes.size == outputShapes.size, "There must be one output shape per output data type.")
+    require(outputShapes.forall(_.isFullyDefined), "All output shapes must be fully defined.")
+    val id = NativeCallbacksRegistry.registerBuffers(new BufferCallback {
+      override def call(
+          inputs: Array[ByteBuffer],
+          inputDataTypes: Array[Int],
+          inputShapes: Array[Long],
+          inputRanks: Array[Int],
+          outputs: Array[ByteBuffer]
+      ): Unit = {
+        var shapeOffset = 0
+        val inputBuffers = inputs.indices.map(i => {
+          val shape = Shape.fromSeq(inputShapes.slice(shapeOffset, shapeOffset + inputRanks(i)).map(_.toInt))
+          shapeOffset += inputRanks(i)
+          Callback.TensorBuffer(inputs(i), DataType.fromCValue(inputDataTypes(i)), shape)
+        })
+        function(inputBuffers, outputs)
+      }
+    })
+    // The lifetime of the registered function is tied to that of the outermost graph, as for the `callback` op.
+    var graph = Op.currentGraph
+    while (graph.isInstanceOf[FunctionGraph])
+      graph = graph.asInstanceOf[FunctionGraph].outerGraph
+    graph.addCleanupFunction(() => NativeCallbacksRegistry.deregister(id))
+    val builder = {
+      if (stateful)
+        Op.Builder(opType = "JVMBufferCallback", name = name)
+      else
+        Op.Builder(opType = "JVMBufferCallbackStateless", name = name)
+    }
+    builder.setAttribute("id", id)
+    builder.setAttribute("jvm_pointer", NativeLibrary.currentJvmPointer)
+    builder.setAttribute("registry_pointer", NativeLibrary.currentCallbackRegistryPointer)
+    builder.setAttribute("registry_call_pointer", NativeLibrary.currentCallbackRegistryCallBuffersMethodPointer)
+    builder.setAttribute("Tout", outputDataTypes.toArray)
+    builder.setAttribute("output_shapes", outputShapes.toArray)
+    builder.addInputList(input)
+    builder.build().outputs.toSeq
+  }
 }
 
 /** Contains helpers for dealing with callbacks. */
@@ -89,8 +275,22 @@ private[ops] object Callback extends Callback {
   private[ops] object Gradients {
     GradientsRegistry.registerNonDifferentiable("JVMCallback")
     GradientsRegistry.registerNonDifferentiable("JVMCallbackStateless")
+    GradientsRegistry.registerNonDifferentiable("JVMAsyncCallback")
+    GradientsRegistry.registerNonDifferentiable("JVMAsyncCallbackStateless")
+    GradientsRegistry.registerNonDifferentiable("JVMBatchCallback")
+    GradientsRegistry.registerNonDifferentiable("JVMBufferCallback")
+    GradientsRegistry.registerNonDifferentiable("JVMBufferCallbackStateless")
   }
 
+  /** Input of a buffer callback function (see the `bufferCallback` op).
+    *
+    * @param  buffer   Direct buffer over the memory of the input tensor, in the native byte order. It must not be written
+    *                  to and it is only valid for the duration of the callback function invocation.
+    * @param  dataType Data type of the input tensor.
+    * @param  shape    Shape of the input tensor.
+    */
+  case class TensorBuffer(buffer: ByteBuffer, dataType: DataType, shape: Shape)
+
   /** Type trait representing valid callback function argument/output types. */
   trait ArgType[T] {
     /** Represents the corresponding symbolic type of `T` where tensors are replaced with their symbolic equivalent. */
@@ -341,6 +541,40 @@ private[ops] object Callback extends Callback {
     *    not use this op if you need to serialize your model and restore it in a different environment.
     *  - The op must be able to access the JVM instance that the Scala program that constructed it was running on. This
     *    can be important if you are using distributed TensorFlow.
+    *
+    * @define OpDocCallbackAsyncCallback
+    *  The `asyncCallback` op wraps an asynchronous Scala function and uses it as a TensorFlow op.
+    *
+    *  Unlike the `callback` op, the TensorFlow thread executing the op is not blocked while the Scala function runs.
+    *  Instead, the function is invoked using the provided execution context and the op completes once the future that
+    *  it returns resolves. This allows slow functions (e.g., ones that perform remote lookups) to run concurrently with
+    *  the rest of the graph, without starving the TensorFlow inter-op thread pool.
+    *
+    *  '''NOTE:''' The `asyncCallback` op has the same known limitations as the `callback` op.
+    *
+    * @define OpDocCallbackBatchCallback
+    *  The `batchCallback` op wraps a Scala function that operates on batches of inputs and uses it as a TensorFlow op.
+    *
+    *  The inputs of concurrent executions of the op (e.g., for concurrent requests in a serving graph) are collected
+    *  until `maxBatchSize` of them are pending, or until `batchTimeoutMicros` microseconds have passed since the first of
+    *  them arrived, and the Scala function is invoked once for the whole batch. Its outputs are then scattered back to
+    *  the corresponding executions. This amortizes the cost of calling into the JVM over many executions. The op is
+    *  always considered stateful, because its executions depend on each other.
+    *
+    *  '''NOTE:''' The `batchCallback` op has the same known limitations as the `callback` op.
+    *
+    * @define OpDocCallbackBufferCallback
+    *  The `bufferCallback` op wraps a Scala function that operates directly on the memory of its input and output
+    *  tensors, and uses it as a TensorFlow op.
+    *
+    *  Unlike the `callback` op, no tensors are created for the inputs and outputs of the function and no tensor handles
+    *  cross the JNI boundary. Instead, the function is given direct buffers over the memory of the input tensors, along
+    *  with their data types and shapes, and direct buffers over the memory of the output tensors, which are allocated by
+    *  the op using `outputShapes` and which it must fill in. This makes the op much cheaper to invoke than the
+    *  `callback` op for small functions that are invoked very frequently (e.g., per-example feature transformations).
+    *  String tensors are not supported.
+    *
+    *  '''NOTE:''' The `bufferCallback` op has the same known limitations as the `callback` op.
     */
   private[ops] trait Documentation
 }
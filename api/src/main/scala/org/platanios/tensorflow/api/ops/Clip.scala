@@ -15,7 +15,7 @@
 
 package org.platanios.tensorflow.api.ops
 
-import org.platanios.tensorflow.api.types.INT32
+import org.platanios.tensorflow.api.types.{FLOAT32, FLOAT64, INT32}
 
 /** Contains functions for constructing ops related to clipping tensor values.
   *
@@ -112,27 +112,43 @@ private[ops] trait Clip {
     * @param  clipNorm   0-D (scalar) tensor > 0, specifying the maximum clipping value.
     * @param  globalNorm 0-D (scalar) tensor containing the global norm to use. If not provided, `globalNorm()` is used
     *                    to compute the norm.
+    * @param  fused      If `true` and `globalNorm` is not provided, a single (CPU-only) op is used that computes the
+    *                    global norm in one parallel pass over all tensors and scales them in a second pass, in-place
+    *                    when possible, instead of using two ops per tensor. This requires all tensors to have the same
+    *                    [[FLOAT32]] or [[FLOAT64]] data type and, in that case, no gradients are defined for the
+    *                    clipped tensors. Otherwise, this argument is ignored.
     * @param  name       Name prefix for created ops.
     * @return Tuple containing the clipped tensors as well as the global norm that was used for the clipping.
     */
   def clipByGlobalNorm(
-      inputs: Seq[OutputLike], clipNorm: Output, globalNorm: Output = null,
+      inputs: Seq[OutputLike], clipNorm: Output, globalNorm: Output = null, fused: Boolean = false,
       name: String = "ClipByGlobalNorm"): (Seq[OutputLike], Output) = {
     Op.createWithNameScope(name) {
-      val norm = if (globalNorm != null) globalNorm else this.globalNorm(inputs)
-      // Calculate the l2-norm and clip elements by the ratio of `clipNorm` to that l2-norm.
-      val scale = clipNorm * Math.minimum(1 / norm, 1 / clipNorm)
       val values = inputs.map {
         case o: Output => o
         case o: OutputIndexedSlices => o.values
         case o: SparseOutput => o.values
       }
-      val clippedValues = values.map(value => {
-        if (value == null)
-          null
-        else
-          Op.colocateWith(Set(value.op))(Basic.identity(value * scale))
-      })
+      val nonNullValues = values.filter(_ != null)
+      val dataTypes = nonNullValues.map(_.dataType).toSet
+      val (norm, clippedValues) = {
+        if (fused && globalNorm == null && nonNullValues.nonEmpty && dataTypes.size == 1 &&
+            (dataTypes.head == FLOAT32 || dataTypes.head == FLOAT64)) {
+          val (clipped, norm) = Clip.clipByGlobalNormList(nonNullValues, clipNorm.cast(dataTypes.head))
+          val clippedIterator = clipped.iterator
+          (norm, values.map(value => if (value == null) null else clippedIterator.next()))
+        } else {
+          val norm = if (globalNorm != null) globalNorm else this.globalNorm(inputs)
+          // Calculate the l2-norm and clip elements by the ratio of `clipNorm` to that l2-norm.
+          val scale = clipNorm * Math.minimum(1 / norm, 1 / clipNorm)
+          (norm, values.map(value => {
+            if (value == null)
+              null
+            else
+              Op.colocateWith(Set(value.op))(Basic.identity(value * scale))
+          }))
+        }
+      }
       val result = inputs.zip(clippedValues).map {
         case (_: Output, c: Output) => c
         case (i: OutputIndexedSlices, c: Output) => OutputIndexedSlices(i.indices, c, i.denseShape)
@@ -145,6 +161,23 @@ private[ops] trait Clip {
 }
 
 private[ops] object Clip extends Clip {
+  /** Creates an op that clips `inputs` by the ratio of `clipNorm` to their global norm, using the fused
+    * `ClipByGlobalNormList` kernel.
+    *
+    * @param  inputs   Input tensors, which must all have the same data type.
+    * @param  clipNorm 0-D (scalar) tensor > 0, with the same data type as `inputs`.
+    * @param  name     Name for the created op.
+    * @return Tuple containing the clipped tensors and the global norm of `inputs`.
+    */
+  private[Clip] def clipByGlobalNormList(
+      inputs: Seq[Output], clipNorm: Output, name: String = "ClipByGlobalNormList"): (Seq[Output], Output) = {
+    val outputs = Op.Builder(opType = "ClipByGlobalNormList", name = name)
+        .addInputList(inputs)
+        .addInput(clipNorm)
+        .build().outputs
+    (outputs.init.toSeq, outputs.last)
+  }
+
   private[ops] trait Implicits {
     implicit def outputToClipOps(value: Output): ClipOps = ClipOps(value)
     implicit def outputConvertibleToClipOps[T](value: T)(implicit f: (T) => Output): ClipOps = ClipOps(f(value))
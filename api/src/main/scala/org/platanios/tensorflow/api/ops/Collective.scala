@@ -0,0 +1,160 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops
+
+import org.platanios.tensorflow.api.Implicits._
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
+import org.platanios.tensorflow.api.tensors.Tensor
+
+/** Contains functions for constructing collective ops, which combine tensors that live on multiple devices (e.g., the
+  * gradients computed by the replicas of a synchronous data-parallel training setup).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+private[api] trait Collective {
+  /** $OpDocCollectiveRingAllReduce
+    *
+    * @group CollectiveOps
+    * @param  inputs  Tensors to reduce, one per device, all with the same data type and fully defined shape.
+    * @param  average If `true`, the reduced value is averaged over the inputs, instead of just being summed.
+    * @param  name    Name for the created ops.
+    * @return Reduced tensors, one per input, each placed on the device of the corresponding input.
+    * @throws InvalidArgumentException If the inputs are empty, or if they have different data types or shapes, or
+    *                                  shapes that are not fully defined.
+    */
+  @throws[InvalidArgumentException]
+  def ringAllReduce(inputs: Seq[Output], average: Boolean = false, name: String = "RingAllReduce"): Seq[Output] = {
+    Collective.checkInputs(inputs)
+    val n = inputs.size
+    if (n == 1) {
+      Seq(inputs.head)
+    } else {
+      Op.createWithNameScope(name, inputs.map(_.op).toSet) {
+        val shape = inputs.head.shape
+        val numElements = shape.numElements
+        val chunkSize = (numElements + n - 1) / n
+        val devices = inputs.map(_.device)
+        // Flatten every input, pad it to a multiple of the number of devices, and split it into one chunk per device.
+        val chunks = inputs.zip(devices).map {
+          case (input, device) => Op.createWith(device = device) {
+            val flat = Basic.reshape(input, Shape(-1))
+            val padded = {
+              if (chunkSize * n == numElements) flat
+              else Basic.pad(flat, Tensor(Tensor(0, (chunkSize * n - numElements).toInt)))
+            }
+            Basic.splitEvenly(padded, n).toArray
+          }
+        }.toArray
+        // Reduce-scatter: in step `s`, device `i` sends chunk `(i - s) mod n` to device `i + 1`, which reduces it with
+        // its own copy of that chunk. After `n - 1` steps, device `i` holds the fully reduced chunk `(i + 1) mod n`.
+        for (s <- 0 until n - 1; i <- 0 until n) {
+          val j = (i - s + n) % n
+          val destination = (i + 1) % n
+          Op.createWith(device = devices(destination)) {
+            chunks(destination)(j) = Math.add(chunks(destination)(j), chunks(i)(j))
+          }
+        }
+        // All-gather: in step `s`, device `i` forwards the fully reduced chunk `(i + 1 - s) mod n` to device `i + 1`.
+        for (s <- 0 until n - 1; i <- 0 until n) {
+          val j = (i + 1 - s + n) % n
+          val destination = (i + 1) % n
+          Op.createWith(device = devices(destination)) {
+            chunks(destination)(j) = Basic.identity(chunks(i)(j))
+          }
+        }
+        chunks.zip(devices).map {
+          case (deviceChunks, device) => Op.createWith(device = device) {
+            val flat = Basic.concatenate(deviceChunks.toSeq)
+            val unpadded = {
+              if (chunkSize * n == numElements) flat
+              else Basic.slice(flat, Tensor(0), Tensor(numElements.toInt))
+            }
+            val reduced = Basic.reshape(unpadded, shape)
+            if (average) Math.divide(reduced, Basic.constant(n, reduced.dataType)) else reduced
+          }
+        }.toSeq
+      }
+    }
+  }
+
+  /** $OpDocCollectiveNCCLAllReduce
+    *
+    * @group CollectiveOps
+    * @param  inputs    Tensors to reduce, one per local GPU, all with the same data type and shape.
+    * @param  reduction Reduction to perform. Must be one of `"sum"`, `"prod"`, `"max"`, or `"min"`.
+    * @param  name      Name for the created ops.
+    * @return Reduced tensors, one per input, each placed on the device of the corresponding input.
+    * @throws InvalidArgumentException If the inputs are empty, or if they have different data types or shapes, or if
+    *                                  the reduction is not supported.
+    */
+  @throws[InvalidArgumentException]
+  def ncclAllReduce(inputs: Seq[Output], reduction: String = "sum", name: String = "NCCLAllReduce"): Seq[Output] = {
+    Collective.checkInputs(inputs, requireFullyDefinedShapes = false)
+    if (!Set("sum", "prod", "max", "min").contains(reduction))
+      throw InvalidArgumentException(s"Unsupported NCCL reduction '$reduction'.")
+    Op.createWithNameScope(name, inputs.map(_.op).toSet) {
+      // All ops that participate in the same reduction must share the same name, which must be unique in the graph.
+      val sharedName = Op.currentGraph.uniqueName("NCCLAllReduceShared")
+      inputs.map(input => Op.createWith(device = input.device) {
+        Op.Builder(opType = "NcclAllReduce", name = "NCCLAllReduce")
+            .addInput(input)
+            .setAttribute("reduction", reduction)
+            .setAttribute("num_devices", inputs.size)
+            .setAttribute("shared_name", sharedName)
+            .build().outputs(0)
+      })
+    }
+  }
+}
+
+private[api] object Collective extends Collective {
+  /** Checks that the provided collective op inputs are valid. */
+  @throws[InvalidArgumentException]
+  private[ops] def checkInputs(inputs: Seq[Output], requireFullyDefinedShapes: Boolean = true): Unit = {
+    if (inputs.isEmpty)
+      throw InvalidArgumentException("At least one input must be provided to a collective op.")
+    if (inputs.exists(_.dataType != inputs.head.dataType))
+      throw InvalidArgumentException("All inputs to a collective op must have the same data type.")
+    if (inputs.exists(!_.shape.isCompatibleWith(inputs.head.shape)))
+      throw InvalidArgumentException("All inputs to a collective op must have the same shape.")
+    if (requireFullyDefinedShapes && !inputs.head.shape.isFullyDefined)
+      throw InvalidArgumentException("The inputs to a ring all-reduce must have fully defined shapes.")
+  }
+
+  /** @define OpDocCollectiveRingAllReduce
+    *   The `ringAllReduce` op reduces a set of tensors that live on different devices (possibly on different workers of
+    *   a cluster), using the ring all-reduce algorithm, and returns a copy of the reduced value on each one of these
+    *   devices.
+    *
+    *   The devices are arranged in a ring and each tensor is split into one chunk per device. The chunks are first
+    *   reduced while being passed around the ring (i.e., a reduce-scatter), and the reduced chunks are then passed
+    *   around the ring once more (i.e., an all-gather). Each device thus sends and receives `2 * (n - 1) / n` times the
+    *   size of a tensor, regardless of the number of devices `n`, which avoids the bottleneck of aggregating all
+    *   tensors on a single parameter server. The ring is made up of regular ops, and the transfers between devices
+    *   are performed by the send and receive ops that TensorFlow inserts between devices.
+    *
+    * @define OpDocCollectiveNCCLAllReduce
+    *   The `ncclAllReduce` op reduces a set of tensors that live on different GPUs of the same machine using NVIDIA
+    *   NCCL, and returns a copy of the reduced value on each one of these GPUs.
+    *
+    *   This op requires the NCCL ops of TensorFlow to be registered, which are not part of the core TensorFlow library.
+    *   They can be registered by loading their op library (i.e., `_nccl_ops.so` of the TensorFlow NCCL package) using
+    *   `org.platanios.tensorflow.jni.TensorFlow.loadOpLibrary`. All ops created by this function must be executed in
+    *   the same step.
+    */
+  private[ops] trait Documentation
+}
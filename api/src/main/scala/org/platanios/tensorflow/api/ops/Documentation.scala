@@ -37,4 +37,5 @@ private[api] trait Documentation
         with Text.Documentation
         with control_flow.ControlFlow.Documentation
         with rnn.RNN.Documentation
+        with rnn.CudnnRNN.Documentation
         with rnn.cell.RNNCell.Documentation
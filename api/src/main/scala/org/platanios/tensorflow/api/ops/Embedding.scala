@@ -20,6 +20,7 @@ import org.platanios.tensorflow.api.core.Shape
 import org.platanios.tensorflow.api.core.Indexer._
 import org.platanios.tensorflow.api.core.exception.InvalidShapeException
 import org.platanios.tensorflow.api.ops.Embedding.{Combiner, PartitionStrategy}
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
 import org.platanios.tensorflow.api.ops.variables.{PartitionedVariable, Variable}
 import org.platanios.tensorflow.api.types.INT32
 
@@ -155,13 +156,17 @@ private[ops] trait Embedding {
     * @param  partitionStrategy Partitioning strategy to use if `parameters.numPartitions > 1`.
     * @param  combiner          Combination/reduction strategy to use for the obtained embeddings.
     * @param  maxNorm           If provided, embedding values are l2-normalized to this value.
+    * @param  fused             If `true` and `maxNorm` is not provided, the embeddings are looked up and combined using
+    *                           a single (CPU-only) op, without materializing the individual embeddings of all ids. The
+    *                           gradient of that op with respect to each partition of `parameters` is an
+    *                           [[OutputIndexedSlices]].
     * @param  name              Name prefix used for the created op.
     * @return Obtained embeddings for the provided `ids`.
     */
   def sparseEmbeddingLookup(
       parameters: EmbeddingMap, sparseIds: SparseOutput, sparseWeights: SparseOutput = null,
       partitionStrategy: PartitionStrategy = Embedding.ModStrategy, combiner: Combiner = Embedding.SumSqrtNCombiner,
-      maxNorm: Output = null, name: String = "SparseEmbeddingLookup"): Output = {
+      maxNorm: Output = null, fused: Boolean = false, name: String = "SparseEmbeddingLookup"): Output = {
     val ignoreWeights = sparseWeights == null
     if (!ignoreWeights) {
       sparseIds.indices.shape.assertIsCompatibleWith(sparseWeights.indices.shape)
@@ -173,24 +178,36 @@ private[ops] trait Embedding {
     }
     Op.createWithNameScope(name) {
       val segmentIds = sparseIds.indices(::, 0).cast(INT32)
-      val (ids, idx) = if (ignoreWeights) Basic.unique(sparseIds.values) else (sparseIds.values, null)
-      val embeddings = embeddingLookup(parameters, ids, partitionStrategy, maxNorm = maxNorm)
-      if (ignoreWeights) {
-        combiner.combine(embeddings, idx, segmentIds)
+      if (fused && maxNorm == null) {
+        val parametersValues = parameters.partitionParameters.map(_.value)
+        val weights = {
+          if (ignoreWeights)
+            Basic.zeros(parametersValues.head.dataType, Shape(0))
+          else
+            sparseWeights.values.cast(parametersValues.head.dataType)
+        }
+        Embedding.fusedSparseEmbeddingLookup(
+          parametersValues, sparseIds.values, segmentIds, weights, combiner, partitionStrategy)
       } else {
-        val weights = sparseWeights.values.cast(embeddings.dataType)
-        // Reshape weights to allow broadcasting.
-        val weightsStaticShape = weights.shape
-        val weightsDynamicShape = Basic.shape(weights)
-        val ones = Basic.fill(weightsDynamicShape.dataType, Basic.expandDims(Basic.rank(embeddings) - 1, 0))(1)
-        val broadcastedWeightsShape = Basic.concatenate(Seq(weightsDynamicShape, ones), 0)
-        val reshapedWeights = weights.reshape(broadcastedWeightsShape)
-        // Set the weight shape, since after reshaping to `broadcastedWeightsShape`, the shape becomes unknown.
-        if (embeddings.shape.rank != -1)
-          reshapedWeights.setShape(
-            weightsStaticShape.concatenateWith(Shape.fromSeq((0 until embeddings.shape.rank - 1).map(_ => 1))))
-        val weightedEmbeddings = embeddings * reshapedWeights
-        combiner.combineWeighted(weightedEmbeddings, reshapedWeights, segmentIds)
+        val (ids, idx) = if (ignoreWeights) Basic.unique(sparseIds.values) else (sparseIds.values, null)
+        val embeddings = embeddingLookup(parameters, ids, partitionStrategy, maxNorm = maxNorm)
+        if (ignoreWeights) {
+          combiner.combine(embeddings, idx, segmentIds)
+        } else {
+          val weights = sparseWeights.values.cast(embeddings.dataType)
+          // Reshape weights to allow broadcasting.
+          val weightsStaticShape = weights.shape
+          val weightsDynamicShape = Basic.shape(weights)
+          val ones = Basic.fill(weightsDynamicShape.dataType, Basic.expandDims(Basic.rank(embeddings) - 1, 0))(1)
+          val broadcastedWeightsShape = Basic.concatenate(Seq(weightsDynamicShape, ones), 0)
+          val reshapedWeights = weights.reshape(broadcastedWeightsShape)
+          // Set the weight shape, since after reshaping to `broadcastedWeightsShape`, the shape becomes unknown.
+          if (embeddings.shape.rank != -1)
+            reshapedWeights.setShape(
+              weightsStaticShape.concatenateWith(Shape.fromSeq((0 until embeddings.shape.rank - 1).map(_ => 1))))
+          val weightedEmbeddings = embeddings * reshapedWeights
+          combiner.combineWeighted(weightedEmbeddings, reshapedWeights, segmentIds)
+        }
       }
     }
   }
@@ -199,6 +216,9 @@ private[ops] trait Embedding {
 object Embedding extends Embedding {
   /** Partitioning strategy for the embeddings map. */
   sealed trait PartitionStrategy {
+    /** Name of this partition strategy, as used by the fused sparse embedding lookup op. */
+    private[Embedding] val name: String
+
     /** Transforms the provided ids based on this partition strategy and returns the partition assignments and the
       * new/transformed ids. */
     def transformIds(ids: Output, parameters: Seq[EmbeddingParameters], numPartitions: Int): (Output, Output)
@@ -207,6 +227,8 @@ object Embedding extends Embedding {
   /** Each id is assigned to partition `p = id % parameters.numPartitions`. For instance, 13 ids are split across 5
     * partitions as: `[[0, 5, 10], [1, 6, 11], [2, 7, 12], [3, 8], [4, 9]]`.*/
   case object ModStrategy extends PartitionStrategy {
+    override private[Embedding] val name: String = "mod"
+
     override def transformIds(
         ids: Output, parameters: Seq[EmbeddingParameters], numPartitions: Int): (Output, Output) = {
       val numPartitionsOutput = numPartitions: Output
@@ -219,6 +241,8 @@ object Embedding extends Embedding {
   /** Ids are assigned to partitions in a contiguous manner. In this case, 13 ids are split across 5 partitions as:
     * `[[0, 1, 2], [3, 4, 5], [6, 7, 8], [9, 10], [11, 12]]`. */
   case object DivStrategy extends PartitionStrategy {
+    override private[Embedding] val name: String = "div"
+
     override def transformIds(
         ids: Output, parameters: Seq[EmbeddingParameters], numPartitions: Int): (Output, Output) = {
       val numPartitionsOutput = numPartitions: Output
@@ -254,12 +278,17 @@ object Embedding extends Embedding {
 
   /** Method for combining sparse embeddings. */
   sealed trait Combiner {
+    /** Name of this combiner, as used by the fused sparse embedding lookup op. */
+    private[Embedding] val name: String
+
     @inline def combine(parameters: Output, indices: Output, segmentIndices: Output): Output
     @inline def combineWeighted(parameters: Output, weights: Output, segmentIndices: Output): Output
   }
 
   /** Combines sparse embeddings by using a weighted sum. */
   case object SumCombiner extends Combiner {
+    override private[Embedding] val name: String = "sum"
+
     @inline override def combine(
         parameters: Output, indices: Output, segmentIndices: Output): Output = {
       Math.sparseSegmentSum(parameters, indices, segmentIndices)
@@ -272,6 +301,8 @@ object Embedding extends Embedding {
 
   /** Combines sparse embeddings by using a weighted sum divided by the total weight. */
   case object MeanCombiner extends Combiner {
+    override private[Embedding] val name: String = "mean"
+
     @inline override def combine(parameters: Output, indices: Output, segmentIndices: Output): Output = {
       Math.sparseSegmentMean(parameters, indices, segmentIndices)
     }
@@ -286,6 +317,8 @@ object Embedding extends Embedding {
   /** Combines sparse embeddings by using a weighted sum divided by the square root of the sum of the
       squares of the weights. */
   case object SumSqrtNCombiner extends Combiner {
+    override private[Embedding] val name: String = "sqrtn"
+
     @inline override def combine(parameters: Output, indices: Output, segmentIndices: Output): Output = {
       Math.sparseSegmentSumSqrtN(parameters, indices, segmentIndices)
     }
@@ -308,6 +341,67 @@ object Embedding extends Embedding {
       parameters.clipByNorm(maxNorm, Math.range(Basic.rank(indices), Basic.rank(parameters)))
   }
 
+  /** Creates an op that looks up the embeddings of `ids` in the embedding map that `parameters` is a partitioning of,
+    * multiplies them by `weights`, and combines them over segments, all in a single pass over the ids.
+    *
+    * @param  parameters        Embedding map partitions.
+    * @param  ids               `INT32` or `INT64` vector containing the ids to look up.
+    * @param  segmentIds        `INT32` vector containing the segment index of each id, sorted in non-decreasing order.
+    * @param  weights           Vector containing the weight of each id, or an empty vector, in which case all weights
+    *                           are equal to 1.
+    * @param  combiner          Combination/reduction strategy to use for the obtained embeddings.
+    * @param  partitionStrategy Partitioning strategy to use if `parameters.size > 1`.
+    * @param  name              Name for the created op.
+    * @return Created op output.
+    */
+  private[Embedding] def fusedSparseEmbeddingLookup(
+      parameters: Seq[Output], ids: Output, segmentIds: Output, weights: Output, combiner: Combiner,
+      partitionStrategy: PartitionStrategy, name: String = "FusedSparseEmbeddingLookup"): Output = {
+    Op.Builder(opType = "SparseEmbeddingLookup", name = name)
+        .addInputList(parameters)
+        .addInput(ids)
+        .addInput(segmentIds)
+        .addInput(weights)
+        .setAttribute("combiner", combiner.name)
+        .setAttribute("partition_strategy", partitionStrategy.name)
+        .build().outputs(0)
+  }
+
+  private[ops] object Gradients {
+    GradientsRegistry.register("SparseEmbeddingLookup", sparseEmbeddingLookupGradient)
+    GradientsRegistry.registerNonDifferentiable("SparseEmbeddingLookupGrad")
+    GradientsRegistry.registerNonDifferentiable("SparseEmbeddingLookupWeightsGrad")
+
+    private[this] def sparseEmbeddingLookupGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
+      val numPartitions = op.longAttribute("N").toInt
+      val parameters = op.inputs.take(numPartitions)
+      val lookupInputs = op.inputs.drop(numPartitions)
+      val outputGradient = outputGradients.head.toOutput
+      val parametersGradients = Op.Builder(opType = "SparseEmbeddingLookupGrad", name = "SparseEmbeddingLookupGrad")
+          .addInput(outputGradient)
+          .addInputList(parameters)
+          .addInputList(lookupInputs)
+          .setAttribute("combiner", op.stringAttribute("combiner"))
+          .setAttribute("partition_strategy", op.stringAttribute("partition_strategy"))
+          .build().outputs
+      // The weights gradient op is only executed if the weights gradient is actually used.
+      val weightsGradient = Op.Builder("SparseEmbeddingLookupWeightsGrad", "SparseEmbeddingLookupWeightsGrad")
+          .addInput(outputGradient)
+          .addInputList(parameters)
+          .addInputList(lookupInputs)
+          .addInput(op.outputs(0))
+          .setAttribute("combiner", op.stringAttribute("combiner"))
+          .setAttribute("partition_strategy", op.stringAttribute("partition_strategy"))
+          .build().outputs(0)
+      parameters.indices.map(i => {
+        // The parameters can be large, so we colocate the shape calculation with them.
+        val denseShape = Op.colocateWith(Set(parameters(i).op))(Basic.shape(parameters(i)))
+        OutputIndexedSlices(
+          indices = parametersGradients(numPartitions + i), values = parametersGradients(i), denseShape = denseShape)
+      }) ++ Seq(null, null, weightsGradient)
+    }
+  }
+
   private[ops] trait Implicits {
     implicit def singlePartitionEmbeddingMap(parameters: EmbeddingParameters): EmbeddingMap = {
       EmbeddingMap(Seq(parameters))
@@ -329,6 +423,7 @@ object Embedding extends Embedding {
     @inline override def colocationOp: Op = parameters.op
     @inline override def staticShape: Shape = parameters.shape
     @inline override def dynamicShape: Output = Basic.shape(parameters)
+    @inline override def value: Output = parameters
 
     override def gather(indices: Output, name: String = "Gather"): Output = {
       Basic.gather(parameters, indices, name = name)
@@ -339,6 +434,7 @@ object Embedding extends Embedding {
     @inline override def colocationOp: Op = parameters.op
     @inline override def staticShape: Shape = parameters.shape
     @inline override def dynamicShape: Output = Basic.shape(parameters.value)
+    @inline override def value: Output = parameters.value
 
     override def gather(indices: Output, name: String = "Gather"): Output = {
       parameters.sparseRead(indices, name = name)
@@ -415,6 +511,9 @@ trait EmbeddingParameters {
   /** Returns the dynamic shape of this parameters tensor. */
   @inline def dynamicShape: Output
 
+  /** Returns the value of this parameters tensor. */
+  @inline def value: Output
+
   /** Gathers the embeddings corresponding to `indices` from `parameters`. */
   def gather(indices: Output, name: String = "Gather"): Output
 }
@@ -27,7 +27,10 @@ import org.tensorflow.framework.FunctionDef
 import shapeless._
 import shapeless.ops.hlist.Tupler
 
+import java.nio.file.Path
+
 import scala.collection.mutable
+import scala.ref.WeakReference
 import scala.util.DynamicVariable
 
 // TODO: [FUNCTIONS] !!! Unique name using the hashing functionality.
@@ -46,20 +49,71 @@ case class Function[I, O](name: String, function: (I) => O)(implicit
     val dataTypes = evInput.dataTypes(arg)
     val key = dataTypes.map(_.toString).mkString(":")
     instantiatedFunctions.getOrElseUpdate(key, {
-      InstantiatedFunction(s"${name}_$key", function, dataTypes)(evInput, evOutput)
+      Function.cachedInstantiation(function, s"${name}_$key") {
+        InstantiatedFunction(s"${name}_$key", function, dataTypes)(evInput, evOutput)
+      }
     })(arg)
   }
 
+  /** Instantiates this function for the provided input data types and, optionally, input shapes. Instantiations for
+    * different (e.g., static) input shapes are separate variants, specialized for those shapes. */
   private[ops] def instantiate(
       inputDataTypes: Seq[DataType], inputShapes: Seq[Shape] = null): InstantiatedFunction[I, O] = {
     val key = (inputDataTypes.map(_.toString) ++ Option(inputShapes).map(_.map(_.toString))).mkString(":")
     instantiatedFunctions.getOrElseUpdate(key, {
-      InstantiatedFunction(s"${name}_$key", function, inputDataTypes, Option(inputShapes))(evInput, evOutput)
+      Function.cachedInstantiation(function, s"${name}_$key") {
+        InstantiatedFunction(s"${name}_$key", function, inputDataTypes, Option(inputShapes))(evInput, evOutput)
+      }
     })
   }
 }
 
 object Function {
+  /** Instantiated functions, keyed by the Scala function that they were traced from and by their name (which encodes
+    * their input data types and shapes). Datasets (e.g., ones that are re-created for every epoch or evaluation) create
+    * a new [[Function]] every time they are created and so, without this cache, the same Scala function would be traced
+    * and converted to a native function again every time. Only instantiations that do not capture outputs of other
+    * graphs are cached, since they can be added to any graph. Both the Scala functions and the instantiations are
+    * weakly referenced, so that the cache does not keep them alive. */
+  private[this] val instantiationCache = {
+    new java.util.WeakHashMap[AnyRef, mutable.Map[String, WeakReference[InstantiatedFunction[_, _]]]]()
+  }
+
+  /** Returns the cached instantiation of `function` named `name`, if there is one that is still usable, and otherwise
+    * creates it using `create` and caches it, if it can be cached. */
+  private[ops] def cachedInstantiation[I, O](function: I => O, name: String)(
+      create: => InstantiatedFunction[I, O]
+  ): InstantiatedFunction[I, O] = {
+    def lookUp(): Option[InstantiatedFunction[I, O]] = instantiationCache.synchronized {
+      Option(instantiationCache.get(function))
+          .flatMap(_.get(name))
+          .flatMap(reference => Option(reference.get))
+          .filter(_.nativeHandle != 0)
+          .map(_.asInstanceOf[InstantiatedFunction[I, O]])
+    }
+
+    lookUp().getOrElse({
+      // The function is traced without holding the cache lock, since tracing may take a while and may also instantiate
+      // other functions.
+      val instantiatedFunction = create
+      if (instantiatedFunction.extraInputs.isEmpty) {
+        instantiationCache.synchronized {
+          lookUp().getOrElse({
+            var functionCache = instantiationCache.get(function)
+            if (functionCache == null) {
+              functionCache = mutable.Map.empty[String, WeakReference[InstantiatedFunction[_, _]]]
+              instantiationCache.put(function, functionCache)
+            }
+            functionCache.update(name, WeakReference(instantiatedFunction))
+            instantiatedFunction
+          })
+        }
+      } else {
+        instantiatedFunction
+      }
+    })
+  }
+
   trait ArgType[O] {
     def numOutputs: Int
     def outputs(arg: O): Seq[Output]
@@ -132,7 +186,7 @@ object Function {
   }
 }
 
-private[api] case class InstantiatedFunction[I, O] private[ops] (
+private[api] case class InstantiatedFunction[I, O] private[api] (
     name: String, function: (I) => O,
     inputDataTypes: Seq[DataType],
     inputShapes: Option[Seq[Shape]] = None,
@@ -233,7 +287,7 @@ private[api] case class InstantiatedFunction[I, O] private[ops] (
 
   /** Extra inputs to feed to the function as arguments when calling it, which correspond to the values of op outputs
     * that are used in the function, btu which belong to a different graph, than the function graph. */
-  private[ops] val extraInputs = initializationOutput._6
+  private[api] val extraInputs = initializationOutput._6
 
   /** Lock for the native handle. */
   private[this] object NativeHandleLock
@@ -303,6 +357,12 @@ private[api] case class InstantiatedFunction[I, O] private[ops] (
     FunctionDef.parseFrom(NativeHandleLock.synchronized(NativeFunction.toFunctionDef(_nativeHandle)))
   }
 
+  /** Writes the serialized [[FunctionDef]] representation of this function directly to `file`, without materializing
+    * it on the JVM heap. */
+  def writeFunctionDef(file: Path): Unit = NativeHandleLock.synchronized {
+    NativeFunction.toFunctionDefFile(_nativeHandle, file.toAbsolutePath.toString)
+  }
+
   /** Releases the native resources associated with this function instance. */
   override def close(): Unit = NativeHandleLock.synchronized {
     if (_nativeHandle != 0) {
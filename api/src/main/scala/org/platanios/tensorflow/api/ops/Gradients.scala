@@ -20,6 +20,7 @@ import org.platanios.tensorflow.api.core.exception.InvalidDataTypeException
 import org.platanios.tensorflow.api.ops
 import org.platanios.tensorflow.api.ops.control_flow.{Context, ControlFlow, GradientState}
 import org.platanios.tensorflow.api.types._
+import org.platanios.tensorflow.api.utilities.using
 import org.platanios.tensorflow.jni.{Graph => NativeGraph, Output => NativeOutput}
 
 import com.typesafe.scalalogging.Logger
@@ -38,11 +39,21 @@ private[ops] object Gradients {
     val GradientsRegistry: ops.Gradients.Registry.type = ops.Gradients.Registry
   }
 
-  // TODO: [DOC] Document the "gradients" function.
+  // TODO: [DOC] Document the rest of the "gradients" function arguments.
+  /** Adds ops to the graph to compute the partial derivatives of the sum of `ys` with respect to `xs`.
+    *
+    * If `useNativeGradients` is `true`, then the gradients of each maximal sub-graph whose ops all have gradient
+    * functions in the C++ gradient registry of the TensorFlow native library are built using a single native call (see
+    * [[cc_gradients]]), rather than op-by-op in Scala, and only the remaining ops use the Scala gradient functions.
+    * This is not done when the sub-graph between `ys` and `xs` contains while loops, or when `colocateGradientsWithOps`
+    * is `true`, and never for ops whose Scala gradient function has been overridden using [[Registry.register]]. If
+    * `gateGradients` is `true`, the gradients are gated per native sub-graph, rather than per op. Note that the ops
+    * created natively are placed under a top-level `gradients` name scope, rather than under `name`.
+    */
   def gradients(
       ys: Seq[Output], xs: Seq[Output], dys: Seq[OutputLike] = null, gateGradients: Boolean = false,
       aggregationMethod: AggregationMethod = AddAggregationMethod, colocateGradientsWithOps: Boolean = false,
-      name: String = "Gradients"): Seq[OutputLike] = {
+      name: String = "Gradients", useNativeGradients: Boolean = true): Seq[OutputLike] = {
     // The `accumulatedGradients` variable collects the gradients received on each output endpoint of the op. The
     // gradients for each endpoint are initially collected as a sequence. When it is time to call the op's gradient
     // function, for each endpoint we aggregate the list of received gradients into a "add" operation, if there is more
@@ -91,69 +102,16 @@ private[ops] object Gradients {
       // in `sourceOps`. An op has predecessors in `sourceOps` if and only if `pendingCounts(op) > 0`.
       val stopOps = sourceOps.filter(_.inputs.forall(i => pendingCounts.getOrElse(i.op, 0) <= 0))
 
-      while (readyOps.nonEmpty) {
-        val op = readyOps.dequeue()
-        maybeColocateWith(op, colocateGradientsWithOps) {
-          controlFlowGradientState.foreach(_.enterGradientWhileLoopContext(op, before = true))
-          val opGradients = aggregationMethod.aggregateGradients(accumulatedGradients, op)
-          controlFlowGradientState.foreach(_.exitGradientWhileLoopContext(op, before = true))
-          val hasOutputGradients = opGradients.nonEmpty
-          val gradientFunction: Registry.GradientFunction = {
-            if (hasOutputGradients && !stopOps.contains(op)) {
-              Registry(op.opType)
-            } else {
-              null
-            }
-          }
-
-          controlFlowGradientState.foreach(_.enterGradientWhileLoopContext(op, before = false))
-          if (hasOutputGradients && gradientFunction != null) {
-            // Note that, the gradient aggregation not computing a value for the i'th output, means that the cost does
-            // not depend on output i and therefore the gradient with respect to that output is 0.
-            for ((gradient, outputIndex) <- opGradients.zipWithIndex) {
-              // Only floating-point outputs get a zero gradient. Gradient functions should ignore the gradient for
-              // other outputs.
-              val output = op.outputs(outputIndex)
-              if (gradient.isEmpty && isTrainable(output))
-              // TODO: !!! [GRADIENTS] Gradients of resource handles might be an issue here because of the zeros.
-                opGradients(outputIndex) = Seq({
-                  controlFlowGradientState
-                      .map(_.zerosLike(op, outputIndex))
-                      .getOrElse(Some(Context.zerosLikeOutsideLoop(op, outputIndex)))
-                      .orNull
-                })
-            }
-
-            // Compute the actual op gradients.
-            Op.createWith(nameScope = s"${op.name}Gradient") {
-              // TODO: [CONTEXT] Add support for original op context.
-              val outputGradients = opGradients.map(_.headOption.orNull)
-              var inputGradients = maybeCompile(name, op, () => gradientFunction(op, outputGradients))
-              if (op.inputs.length != inputGradients.length)
-                throw new IllegalStateException(
-                  s"The number of gradients (${inputGradients.length}) generated for op '$op' do not match its " +
-                      s"number of inputs (${op.inputs.length}).")
-              if (gateGradients && inputGradients.count(_ != null) > 1) {
-                Op.createWith(device = "") {
-                  Op.colocateWith(Set.empty[Op], ignoreExisting = true) {
-                    inputGradients = ControlFlow.tuple(inputGradients.filter(_ != null).toArray).toSeq
-                  }
-                }
-              }
-              logGradients(op, outputGradients, inputGradients)
-              op.inputs.zip(inputGradients).filter(_._2 != null).foreach(i => {
-                i._2 match {
-                  case gradient: Output if i._1.dataType != RESOURCE => gradient.setShape(i._1.shape)
-                  case _ =>
-                }
-                setGradient(accumulatedGradients, i._1, i._2)
-              })
-            }
-          }
-          controlFlowGradientState.foreach(_.exitGradientWhileLoopContext(op, before = false))
-        }
+      // Ops whose gradients can be built natively, along with the rest of the maximal sub-graph they belong to.
+      val nativeOps = {
+        if (useNativeGradients && controlFlowGradientState.isEmpty && !colocateGradientsWithOps)
+          nativeGradientOps(pendingCounts.keySet ++ destinationOps, stopOps)
+        else
+          Set.empty[Op]
+      }
 
-        // Update the pending counts for the inputs of `op` and enqueue ready ops.
+      // Updates the pending counts for the inputs of `op` and enqueues the ops that become ready.
+      def updatePendingCounts(op: Op): Unit = {
         op.inputs.foreach(input => {
           pendingCounts.update(input.op, pendingCounts.getOrElse(input.op, 0) - 1)
           var ready = pendingCounts(input.op) == 0
@@ -199,6 +157,82 @@ private[ops] object Gradients {
         })
       }
 
+      while (readyOps.nonEmpty) {
+        val op = readyOps.dequeue()
+        if (nativeOps.contains(op) && hasDenseGradients(accumulatedGradients, op)) {
+          // Collect the maximal sub-graph of natively differentiable ops that become ready once `op` and the other
+          // natively differentiable ready ops are processed, build its gradients using a single native call, and then
+          // process all of its ops at once.
+          def isNative(o: Op): Boolean = nativeOps.contains(o) && hasDenseGradients(accumulatedGradients, o)
+          val subGraph = nativeGradientSubGraph(op +: readyOps.dequeueAll(isNative), pendingCounts, isNative)
+          addNativeGradients(subGraph, accumulatedGradients, aggregationMethod, gateGradients)
+          subGraph.foreach(updatePendingCounts)
+          readyOps.dequeueAll(subGraph.contains)
+        } else {
+          maybeColocateWith(op, colocateGradientsWithOps) {
+            controlFlowGradientState.foreach(_.enterGradientWhileLoopContext(op, before = true))
+            val opGradients = aggregationMethod.aggregateGradients(accumulatedGradients, op)
+            controlFlowGradientState.foreach(_.exitGradientWhileLoopContext(op, before = true))
+            val hasOutputGradients = opGradients.nonEmpty
+            val gradientFunction: Registry.GradientFunction = {
+              if (hasOutputGradients && !stopOps.contains(op)) {
+                Registry(op.opType)
+              } else {
+                null
+              }
+            }
+
+            controlFlowGradientState.foreach(_.enterGradientWhileLoopContext(op, before = false))
+            if (hasOutputGradients && gradientFunction != null) {
+              // Note that, the gradient aggregation not computing a value for the i'th output, means that the cost does
+              // not depend on output i and therefore the gradient with respect to that output is 0.
+              for ((gradient, outputIndex) <- opGradients.zipWithIndex) {
+                // Only floating-point outputs get a zero gradient. Gradient functions should ignore the gradient for
+                // other outputs.
+                val output = op.outputs(outputIndex)
+                if (gradient.isEmpty && isTrainable(output))
+                // TODO: !!! [GRADIENTS] Gradients of resource handles might be an issue here because of the zeros.
+                  opGradients(outputIndex) = Seq({
+                    controlFlowGradientState
+                        .map(_.zerosLike(op, outputIndex))
+                        .getOrElse(Some(Context.zerosLikeOutsideLoop(op, outputIndex)))
+                        .orNull
+                  })
+              }
+
+              // Compute the actual op gradients.
+              Op.createWith(nameScope = s"${op.name}Gradient") {
+                // TODO: [CONTEXT] Add support for original op context.
+                val outputGradients = opGradients.map(_.headOption.orNull)
+                var inputGradients = maybeCompile(name, op, () => gradientFunction(op, outputGradients))
+                if (op.inputs.length != inputGradients.length)
+                  throw new IllegalStateException(
+                    s"The number of gradients (${inputGradients.length}) generated for op '$op' do not match its " +
+                        s"number of inputs (${op.inputs.length}).")
+                if (gateGradients && inputGradients.count(_ != null) > 1) {
+                  Op.createWith(device = "") {
+                    Op.colocateWith(Set.empty[Op], ignoreExisting = true) {
+                      inputGradients = ControlFlow.tuple(inputGradients.filter(_ != null).toArray).toSeq
+                    }
+                  }
+                }
+                logGradients(op, outputGradients, inputGradients)
+                op.inputs.zip(inputGradients).filter(_._2 != null).foreach(i => {
+                  i._2 match {
+                    case gradient: Output if i._1.dataType != RESOURCE => gradient.setShape(i._1.shape)
+                    case _ =>
+                  }
+                  setGradient(accumulatedGradients, i._1, i._2)
+                })
+              }
+            }
+            controlFlowGradientState.foreach(_.exitGradientWhileLoopContext(op, before = false))
+          }
+
+          updatePendingCounts(op)
+        }
+      }
+
       controlFlowGradientState.foreach(_.postProcess())
     }
 
@@ -211,6 +245,40 @@ private[ops] object Gradients {
     })
   }
 
+  /** Name of the op attribute that marks ops whose outputs should be recomputed during the backward pass, rather than
+    * being kept alive from the forward pass, by the Grappler memory optimizer. */
+  private[ops] val RECOMPUTE_HINT: String = "_recompute_hint"
+
+  /** Marks all ops created within `block` for recomputation (i.e., activation recomputation, also known as gradient
+    * checkpointing).
+    *
+    * The outputs of the marked ops are not kept alive until the gradient ops that consume them are executed. Instead,
+    * when the session uses the [[core.client.SessionConfig.ManualRecomputation]] memory optimization, they are
+    * recomputed right before being needed by the gradient ops, starting from the closest unmarked ops, whose outputs
+    * thus act as checkpoints. Checkpoints can also be placed inside `block` using [[checkpoint]]. This trades extra
+    * computation for a lower peak memory usage (i.e., for the activations of deep models).
+    *
+    * Note that the gradient ops must be created outside `block` and must be named such that Grappler identifies them
+    * as gradient ops (see [[core.client.SessionConfig]]'s `graphMemoryOptimizerTargetNodeNamePrefix`).
+    *
+    * @param  block Block of code that creates the ops to mark for recomputation.
+    * @return Return value of `block`.
+    */
+  def recomputed[R](block: => R): R = Op.createWith(attributes = Map(RECOMPUTE_HINT -> 1L))(block)
+
+  /** Marks `output` as a checkpoint (i.e., it is not recomputed during the backward pass, even when it is created
+    * within a [[recomputed]] block), by returning an identity of it that is not marked for recomputation.
+    *
+    * @param  output Output to mark as a checkpoint.
+    * @param  name   Name for the created op.
+    * @return Created op output, which has the same value as `output`.
+    */
+  def checkpoint(output: Output, name: String = "Checkpoint"): Output = {
+    Op.createWith(attributes = Map(RECOMPUTE_HINT -> null)) {
+      Basic.identity(output, name = name)
+    }
+  }
+
   /** If `colocateGradientsWithOps` is `true`, then all ops created within `block` will be colocated with `op`.
     *
     * @param  op                       Op to maybe colocate with.
@@ -266,6 +334,108 @@ private[ops] object Gradients {
     Set[DataType](FLOAT16, FLOAT32, FLOAT64, COMPLEX64, COMPLEX128).contains(tensor.dataType)
   }
 
+  /** Returns the subset of `ops` whose gradients can be built natively, using the C++ gradient registry of the
+    * TensorFlow native library. These are the ops that are not in `stopOps`, whose op types have gradient functions
+    * both in the C++ gradient registry and in [[Registry]] (without having been overridden), and which are not marked
+    * for XLA compilation. The C++ gradient registry is queried for all ops using a single native call.
+    *
+    * @param  ops     Ops to check.
+    * @param  stopOps Ops that must not be differentiated.
+    * @return Ops whose gradients can be built natively.
+    */
+  private[this] def nativeGradientOps(ops: Set[Op], stopOps: Set[Op]): Set[Op] = {
+    val candidates = ops.filter(op => !stopOps.contains(op) && Registry.allowsNativeGradient(op.opType)).toArray
+    if (candidates.isEmpty) {
+      Set.empty[Op]
+    } else {
+      val graph = candidates.head.graph
+      val supported = using(graph.reference) { r =>
+        NativeGraph.nativeGradientSupport(r.nativeHandle, candidates.map(_.nativeHandle))
+      }
+      candidates.zip(supported).filter(_._2).map(_._1).toSet
+    }
+  }
+
+  /** Returns `true` if all gradients collected so far for the outputs of `op` are dense (i.e., [[Output]]s), and can
+    * thus be passed to the C++ gradient functions. */
+  private[this] def hasDenseGradients(gradients: mutable.Map[Op, mutable.Seq[Seq[OutputLike]]], op: Op): Boolean = {
+    gradients.get(op).forall(_.forall(_.forall(_.isInstanceOf[Output])))
+  }
+
+  /** Collects the maximal sub-graph of ops whose gradients can be built natively, starting from `seeds`.
+    *
+    * An op is added to the sub-graph once all the ops that consume its outputs (and lie between the sources and the
+    * destinations of the gradients) have either been processed or been added to the sub-graph, and if `isNative`
+    * returns `true` for it. That guarantees that no path leaves the sub-graph and re-enters it, and so its gradients
+    * can be built in one step. `pendingCounts` is not modified.
+    *
+    * @param  seeds         Ready ops with which to start the sub-graph.
+    * @param  pendingCounts Map from op to the number of its consumers that have not been processed yet.
+    * @param  isNative      Function that returns `true` for ops whose gradients can be built natively.
+    * @return Ops in the sub-graph, in the order in which they were added.
+    */
+  private[this] def nativeGradientSubGraph(
+      seeds: Seq[Op], pendingCounts: mutable.Map[Op, Int], isNative: Op => Boolean): Seq[Op] = {
+    val subGraph = mutable.LinkedHashSet[Op](seeds: _*)
+    val remainingCounts = mutable.Map.empty[Op, Int]
+    val queue = mutable.Queue[Op](seeds: _*)
+    while (queue.nonEmpty) {
+      queue.dequeue().inputs.foreach(input => {
+        val count = remainingCounts.getOrElse(input.op, pendingCounts.getOrElse(input.op, 0)) - 1
+        remainingCounts.update(input.op, count)
+        if (count == 0 && !subGraph.contains(input.op) && isNative(input.op)) {
+          subGraph += input.op
+          queue.enqueue(input.op)
+        }
+      })
+    }
+    subGraph.toSeq
+  }
+
+  /** Builds the gradients of the ops in `subGraph` using a single native call and adds the resulting gradients for the
+    * inputs of the sub-graph (i.e., the inputs of its ops that are produced by ops outside it) to `gradients`.
+    *
+    * @param  subGraph          Ops whose gradients to build, as returned by [[nativeGradientSubGraph]].
+    * @param  gradients         Map where the collected gradients are stored.
+    * @param  aggregationMethod Aggregation method used to combine the gradients collected for each op output.
+    * @param  gateGradients     If `true`, a tuple is added around the gradients of the sub-graph inputs, so that they
+    *                           all become available at the same time.
+    */
+  private[this] def addNativeGradients(
+      subGraph: Seq[Op], gradients: mutable.Map[Op, mutable.Seq[Seq[OutputLike]]],
+      aggregationMethod: AggregationMethod, gateGradients: Boolean): Unit = {
+    val subGraphOps = subGraph.toSet
+    val ys = mutable.ArrayBuffer.empty[Output]
+    val dys = mutable.ArrayBuffer.empty[Output]
+    subGraph.foreach(op => {
+      aggregationMethod.aggregateGradients(gradients, op).zipWithIndex.foreach {
+        case (Seq(gradient: Output), index) =>
+          ys += op.outputs(index)
+          dys += gradient
+        case _ => ()
+      }
+    })
+    val xs = subGraph.flatMap(_.inputs).filter(i => !subGraphOps.contains(i.op)).distinct
+    if (ys.nonEmpty && xs.nonEmpty) {
+      var xGradients: Seq[Output] = cc_gradients(ys.toArray, xs.toArray, dys.toArray)
+      if (gateGradients && xGradients.count(_ != null) > 1) {
+        Op.createWith(device = "") {
+          Op.colocateWith(Set.empty[Op], ignoreExisting = true) {
+            val gated = ControlFlow.tuple(xGradients.filter(_ != null).toArray).iterator
+            xGradients = xGradients.map(g => if (g == null) null else gated.next())
+          }
+        }
+      }
+      logger.debug(s"Native gradients for ops '${subGraph.map(_.name).mkString(", ")}':")
+      logger.debug(s"  in  --> ${dys.map(_.name).mkString(", ")}")
+      logger.debug(s"  out --> ${xGradients.filter(_ != null).map(_.name).mkString(", ")}")
+      val xsWithGradients = xs.zip(xGradients).filter(_._2 != null)
+      val shapedGradients = xsWithGradients.filter(_._1.dataType != RESOURCE)
+      Output.setShapes(shapedGradients.map(_._2), Output.shapes(shapedGradients.map(_._1)))
+      xsWithGradients.foreach(i => setGradient(gradients, i._1, i._2))
+    }
+  }
+
   /** Computes initial values for the provided gradients, and checks whether their data types are correct.
     *
     * @param  ys                       Sequence containing the variables corresponding to `dys`.
@@ -365,14 +535,27 @@ private[ops] object Gradients {
   private[this] def initialPendingCounts(
       sourceOps: Set[Op], destinationOps: Set[Op],
       colocateGradientsWithOps: Boolean): (mutable.Map[Op, Int], Option[GradientState]) = {
+    // Collect the inputs and consumers of all ops with a single native call, rather than querying them op-by-op
+    val graph = destinationOps.head.graph
+    val (ops, snapshot) = graph.snapshot
+    val opIndices = mutable.LongMap.empty[Int]
+    ops.indices.foreach(i => opIndices.update(snapshot.opHandles(i), i))
+    val inputIndices = Array.tabulate(ops.length)(i => {
+      (snapshot.inputOffsets(i) until snapshot.inputOffsets(i + 1))
+          .map(j => opIndices.getOrElse(snapshot.inputOpHandles(j), -1))
+    })
+    val consumerIndices = Array.fill(ops.length)(mutable.ArrayBuffer.empty[Int])
+    inputIndices.indices.foreach(i => inputIndices(i).foreach(j => if (j >= 0) consumerIndices(j) += i))
+
     // Mark ops reached when going from 'sources' to 'destinations'
-    val reached = mutable.Set[Op](destinationOps.toSeq: _*)
-    val reachedQueue = mutable.Queue[Op](sourceOps.toSeq: _*)
+    val reached = mutable.BitSet.empty
+    destinationOps.foreach(op => opIndices.get(op.nativeHandle).foreach(reached += _))
+    val reachedQueue = mutable.Queue[Int](sourceOps.toSeq.flatMap(op => opIndices.get(op.nativeHandle)): _*)
     while (reachedQueue.nonEmpty) {
       val op = reachedQueue.dequeue()
       if (!reached.contains(op)) {
         reached += op
-        op.outputs.foreach(o => reachedQueue.enqueue(o.consumers.map(_.op): _*))
+        reachedQueue.enqueue(consumerIndices(op): _*)
       }
     }
 
@@ -380,14 +563,16 @@ private[ops] object Gradients {
     val between = mutable.Set.empty[Op]
     // TODO: [CONTROL_FLOW] Do we need the list aside from the set?
     val betweenList = mutable.ListBuffer.empty[Op]
-    val betweenQueue = mutable.Queue[Op](destinationOps.toSeq: _*)
+    val betweenIndices = mutable.ListBuffer.empty[Int]
+    val betweenQueue = mutable.Queue[Int](destinationOps.toSeq.flatMap(op => opIndices.get(op.nativeHandle)): _*)
     while (betweenQueue.nonEmpty) {
       val op = betweenQueue.dequeue()
       if (reached.contains(op)) {
-        between += op
-        betweenList += op
+        between += ops(op)
+        betweenList += ops(op)
+        betweenIndices += op
         reached -= op // Done so we don't go through the same ops twice
-        op.inputs.foreach(i => betweenQueue.enqueue(i.op))
+        betweenQueue.enqueue(inputIndices(op).filter(_ >= 0): _*)
       }
     }
 
@@ -396,8 +581,8 @@ private[ops] object Gradients {
 
     // Initialize the pending counts for the between ops
     val pendingCounts = mutable.Map.empty[Op, Int]
-    betweenList.flatMap(_.inputs).map(_.op).filter(between.contains).foreach(input => {
-      pendingCounts.update(input, pendingCounts.getOrElse(input, 0) + 1)
+    betweenIndices.flatMap(inputIndices(_)).filter(i => i >= 0 && between.contains(ops(i))).foreach(i => {
+      pendingCounts.update(ops(i), pendingCounts.getOrElse(ops(i), 0) + 1)
     })
 
     (pendingCounts, controlFlowGradientState)
@@ -523,15 +708,24 @@ private[ops] object Gradients {
 
     private[this] val registry = mutable.Map.empty[String, GradientFunction]
 
+    /** Op types whose gradient functions have been overridden, and for which the C++ gradient functions of the
+      * TensorFlow native library must thus not be used. */
+    private[this] val overriddenOpTypes = mutable.Set.empty[String]
+
     /** Registers the provided gradient function to the gradient function registry.
       *
       * Note that if a gradient function for an op of the same type already exists in the registry, then it will be
-      * overriden by the provided gradient function.
+      * overriden by the provided gradient function. The C++ gradient functions of the TensorFlow native library are
+      * then never used for ops of that type (see [[Gradients.gradients]]).
       *
       * @param  opType   Op type for which a gradient function is being registered.
       * @param  function Gradient function (takes op and output gradients as inputs and returns the input gradients).
       */
-    def register(opType: String, function: GradientFunction): Unit = registry.update(opType, function)
+    def register(opType: String, function: GradientFunction): Unit = {
+      if (registry.contains(opType))
+        overriddenOpTypes += opType
+      registry.update(opType, function)
+    }
 
     /** Registers the provided op type as non-differentiable (i.e., having `null` as its registered gradient function).
       *
@@ -560,6 +754,13 @@ private[ops] object Gradients {
         throw new NoSuchElementException(s"No gradient registered for op type '$opType'.")
       registry(opType)
     }
+
+    /** Returns `true` if the C++ gradient function of the TensorFlow native library can be used in place of the
+      * gradient function registered for the provided op type (i.e., if a non-`null` gradient function is registered
+      * for it and it has not been overridden). */
+    private[Gradients] def allowsNativeGradient(opType: String): Boolean = {
+      registry.get(opType).exists(_ != null) && !overriddenOpTypes.contains(opType)
+    }
   }
 
   /** Adds ops to the graph to compute the partial derivatives of the sum of `y`s with respect to the `x`s, using the
@@ -569,6 +770,7 @@ private[ops] object Gradients {
     * many use cases. It is mainly exposed as means of comparison to the Scala API functionality.
     *
     * The result of this function is an array containing: `d(y_1 + y_2 + ...)/dx_1`, `d(y_1 + y_2 + ...)/dx_2`, `...`.
+    * Its elements are `null` for the `x`s to which no gradient is back-propagated.
     *
     * @param  y  Tensors whose partial derivatives are computed.
     * @param  x  Tensors with respect to which the gradients are computed.
@@ -597,8 +799,13 @@ private[ops] object Gradients {
     // Add the gradients to the graph and collect them to the array that is returned
     val jniGradients = NativeGraph.addGradients(graph.nativeHandle, yJNI, xJNI, dxJNI)
     jniGradients.map(o => {
-      val op = graph.opsCache.getOrElseUpdate(o.opHandle, Op(graph, o.opHandle))
-      Output(op, o.outputIndex)
+      // A null op handle means that no gradient could be computed for the corresponding `x`.
+      if (o.opHandle == 0) {
+        null
+      } else {
+        val op = graph.opsCache.getOrElseUpdate(o.opHandle, Op(graph, o.opHandle))
+        Output(op, o.outputIndex)
+      }
     })
   }
 }
@@ -0,0 +1,248 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops
+
+import org.platanios.tensorflow.api.core.{Graph, Shape}
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
+import org.platanios.tensorflow.api.types.{INT32, INT64}
+
+/** Growable embedding table, keyed by arbitrary `INT64` ids, whose rows are created the first time that their ids are
+  * looked up. Unlike embedding variables, hash embedding tables do not need a fixed vocabulary size and they do not
+  * hash ids into a fixed number of buckets, which avoids both wasting memory and id collisions for open-vocabulary
+  * features (e.g., user or item ids in recommendation models).
+  *
+  * Hash embedding tables are (CPU-only) resources that are created when first used in a session. An id is admitted
+  * into the table once it has been looked up `minFrequency` times (and it is looked up as a zero row until then), and
+  * its row is then initialized with uniformly distributed values that are a deterministic function of the id and of the
+  * table seed. If `ttlSteps` is positive, rows that have not been looked up for `ttlSteps` steps can be evicted using
+  * [[evict]].
+  *
+  * The tables implement [[EmbeddingParameters]], and so a sequence of tables can be used as a partitioned embedding map
+  * by [[Embedding.embeddingLookup]], with [[Embedding.ModStrategy]]. Each table then only stores the ids of its own
+  * partition, and so the tables can be placed on different parameter servers.
+  *
+  * The tables are updated by their own native sparse SGD or Adagrad update op ([[applyGradient]]), rather than by the
+  * optimizers. When looked up with `gradientSinks`, the gradients of the sinks (which are zero) depend on the table
+  * update, and so using a scalar trainable variable as a sink makes any optimizer that minimizes a loss that depends on
+  * the lookup also update the table.
+  *
+  * All tables are added to the [[Graph.Keys.HASH_EMBEDDING_TABLES]] collection, and the default saver saves their rows
+  * in checkpoints, along with the variables.
+  *
+  * @param  handle        Handle to the table resource.
+  * @param  embeddingSize Size of each embedding.
+  * @param  createMissing If `true`, lookups are counted towards the admission of the ids and create the rows of the
+  *                       admitted ids. This should be set to `false` for inference.
+  * @param  gradientSinks Scalar `FLOAT32` tensors whose gradients depend on the table update.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class HashEmbeddingTable private[ops] (
+    val handle: Output,
+    val embeddingSize: Int,
+    val createMissing: Boolean = true,
+    val gradientSinks: Seq[Output] = Seq.empty
+) extends EmbeddingParameters {
+  @inline override def colocationOp: Op = handle.op
+  @inline override def staticShape: Shape = Shape(-1, embeddingSize)
+  @inline override def dynamicShape: Output = Basic.stack(Seq(size().cast(INT32), Basic.constant(embeddingSize)))
+  @inline override def value: Output = export()._2
+
+  override def gather(indices: Output, name: String = "Gather"): Output = lookup(indices, name = name)
+
+  /** Returns a copy of this table (sharing the same resource) that uses the provided lookup settings. */
+  def withLookupSettings(
+      createMissing: Boolean = this.createMissing,
+      gradientSinks: Seq[Output] = this.gradientSinks
+  ): HashEmbeddingTable = {
+    new HashEmbeddingTable(handle, embeddingSize, createMissing, gradientSinks)
+  }
+
+  /** Creates an op that looks up the rows of `ids` in this table.
+    *
+    * @param  ids  `INT32` or `INT64` tensor containing the ids to look up.
+    * @param  step `INT64` scalar containing the current step, which is recorded as the last access step of the rows.
+    *              If `null`, the value of the global step variable is used, if it exists, and `0` otherwise.
+    * @param  name Name for the created op.
+    * @return Created op output, with shape `ids.shape + [embeddingSize]`.
+    */
+  def lookup(ids: Output, step: Output = null, name: String = "HashEmbeddingLookup"): Output = {
+    val embeddings = Op.Builder("HashEmbeddingLookup", name)
+        .addInput(handle)
+        .addInput(ids.cast(INT64))
+        .addInput(if (step != null) step.cast(INT64) else HashEmbeddingTable.currentStep)
+        .addInputList(gradientSinks)
+        .setAttribute("num_sinks", gradientSinks.size)
+        .setAttribute("create_missing", createMissing)
+        .build().outputs(0)
+    embeddings.setShape(ids.shape.concatenateWith(Shape(embeddingSize)))
+    embeddings
+  }
+
+  /** Creates an op that applies a sparse update to the rows of `ids`, using the optimizer of this table.
+    *
+    * @param  ids       `INT32` or `INT64` tensor containing the ids whose rows to update.
+    * @param  gradients `FLOAT32` tensor containing the gradients, with shape `ids.shape + [embeddingSize]`.
+    * @param  name      Name for the created op.
+    * @return Created op.
+    */
+  def applyGradient(ids: Output, gradients: Output, name: String = "HashEmbeddingApplyGradient"): Op = {
+    HashEmbeddingTable.applyGradient(handle, ids.cast(INT64), gradients, name)
+  }
+
+  /** Creates an op that evicts the rows that have not been accessed since `step - ttlSteps`, and returns the number of
+    * evicted rows.
+    *
+    * @param  step `INT64` scalar containing the current step. If `null`, the value of the global step variable is
+    *              used, if it exists, and `0` otherwise.
+    * @param  name Name for the created op.
+    * @return Created op output.
+    */
+  def evict(step: Output = null, name: String = "HashEmbeddingEvict"): Output = {
+    Op.Builder("HashEmbeddingEvict", name)
+        .addInput(handle)
+        .addInput(if (step != null) step.cast(INT64) else HashEmbeddingTable.currentStep)
+        .build().outputs(0)
+  }
+
+  /** Creates an op that computes the number of rows of this table.
+    *
+    * @param  name Name for the created op.
+    * @return Created op output.
+    */
+  def size(name: String = "HashEmbeddingSize"): Output = {
+    Op.Builder("HashEmbeddingSize", name)
+        .addInput(handle)
+        .build().outputs(0)
+  }
+
+  /** Creates an op that exports all rows of this table.
+    *
+    * @param  name Name for the created op.
+    * @return Tuple containing the ids, values, Adagrad accumulators, and last access steps of the rows.
+    */
+  def export(name: String = "HashEmbeddingExport"): (Output, Output, Output, Output) = {
+    HashEmbeddingTable.export(handle, name)
+  }
+}
+
+object HashEmbeddingTable {
+  /** Creates a new hash embedding table.
+    *
+    * @param  embeddingSize           Size of each embedding.
+    * @param  initializerRange        Range of the uniformly distributed initial values of the rows.
+    * @param  seed                    Seed used to derive the initial values of the rows from their ids.
+    * @param  minFrequency            Number of lookups after which an id is admitted into the table.
+    * @param  ttlSteps                Number of steps after which rows that have not been accessed can be evicted. If
+    *                                 `0`, rows are never evicted.
+    * @param  optimizer               Update rule used by [[HashEmbeddingTable.applyGradient]], which must be either
+    *                                 `"sgd"` or `"adagrad"`.
+    * @param  learningRate            Learning rate used by [[HashEmbeddingTable.applyGradient]].
+    * @param  initialAccumulatorValue Initial value of the Adagrad accumulators.
+    * @param  container               If non-empty, the created table is placed in the given container. Otherwise, a
+    *                                 default container is used.
+    * @param  sharedName              If non-empty, the created table is shared under this name across multiple
+    *                                 sessions.
+    * @param  name                    Name for the created op.
+    * @return Created hash embedding table.
+    */
+  def apply(
+      embeddingSize: Int, initializerRange: Float = 0.05f, seed: Long = 0L, minFrequency: Int = 1,
+      ttlSteps: Long = 0L, optimizer: String = "sgd", learningRate: Float = 0.01f,
+      initialAccumulatorValue: Float = 0.1f, container: String = "", sharedName: String = "",
+      name: String = "HashEmbeddingTable"): HashEmbeddingTable = {
+    require(embeddingSize > 0, s"The embedding size ($embeddingSize) must be positive.")
+    require(minFrequency > 0, s"The minimum frequency ($minFrequency) must be positive.")
+    require(optimizer == "sgd" || optimizer == "adagrad", s"Unsupported optimizer '$optimizer'.")
+    val handle = Op.Builder("HashEmbeddingTable", name)
+        .setAttribute("container", container)
+        .setAttribute("shared_name", sharedName)
+        .setAttribute("embedding_dim", embeddingSize)
+        .setAttribute("initializer_range", initializerRange)
+        .setAttribute("seed", seed)
+        .setAttribute("min_frequency", minFrequency)
+        .setAttribute("ttl_steps", ttlSteps)
+        .setAttribute("optimizer", optimizer)
+        .setAttribute("learning_rate", learningRate)
+        .setAttribute("initial_accumulator_value", initialAccumulatorValue)
+        .build().outputs(0)
+    handle.graph.addToCollection(handle, Graph.Keys.HASH_EMBEDDING_TABLES)
+    new HashEmbeddingTable(handle, embeddingSize)
+  }
+
+  /** Returns the value of the global step variable, if it exists, and `0` otherwise, as an `INT64` scalar. */
+  private[ops] def currentStep: Output = {
+    Op.currentGraph.getCollection(Graph.Keys.GLOBAL_STEP).headOption
+        .map(_.value.cast(INT64))
+        .getOrElse(Basic.constant(0L))
+  }
+
+  private[ops] def applyGradient(table: Output, ids: Output, gradients: Output, name: String): Op = {
+    Op.Builder("HashEmbeddingApplyGradient", name)
+        .addInput(table)
+        .addInput(ids)
+        .addInput(gradients)
+        .build()
+  }
+
+  /** Creates an op that exports all rows of the table with handle `table`. */
+  private[api] def export(table: Output, name: String = "HashEmbeddingExport"): (Output, Output, Output, Output) = {
+    val outputs = Op.Builder("HashEmbeddingExport", name)
+        .addInput(table)
+        .build().outputs
+    (outputs(0), outputs(1), outputs(2), outputs(3))
+  }
+
+  /** Creates an op that replaces all rows of the table with handle `table`. */
+  private[api] def importRows(
+      table: Output, ids: Output, values: Output, accumulators: Output, lastSteps: Output,
+      name: String = "HashEmbeddingImport"): Op = {
+    Op.Builder("HashEmbeddingImport", name)
+        .addInput(table)
+        .addInput(ids)
+        .addInput(values)
+        .addInput(accumulators)
+        .addInput(lastSteps)
+        .build()
+  }
+
+  private[ops] object Gradients {
+    GradientsRegistry.register("HashEmbeddingLookup", hashEmbeddingLookupGradient)
+    GradientsRegistry.registerNonDifferentiable("HashEmbeddingTable")
+    GradientsRegistry.registerNonDifferentiable("HashEmbeddingApplyGradient")
+    GradientsRegistry.registerNonDifferentiable("HashEmbeddingEvict")
+    GradientsRegistry.registerNonDifferentiable("HashEmbeddingSize")
+    GradientsRegistry.registerNonDifferentiable("HashEmbeddingExport")
+    GradientsRegistry.registerNonDifferentiable("HashEmbeddingImport")
+
+    /** The table itself is updated by the native update op, and the gradients of the sinks (if any) are zeros that
+      * depend on that update. */
+    private[this] def hashEmbeddingLookupGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
+      val sinks = op.inputs.drop(3)
+      if (sinks.isEmpty) {
+        Seq(null, null, null)
+      } else {
+        val update = Op.colocateWith(Set(op.inputs(0).op)) {
+          applyGradient(op.inputs(0), op.inputs(1), outputGradients.head.toOutput, "HashEmbeddingApplyGradient")
+        }
+        val sinksGradients = Op.createWith(controlDependencies = Set(update)) {
+          sinks.map(Basic.zerosLike(_))
+        }
+        Seq(null, null, null) ++ sinksGradients
+      }
+    }
+  }
+}
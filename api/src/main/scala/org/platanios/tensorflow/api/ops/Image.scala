@@ -15,6 +15,8 @@
 
 package org.platanios.tensorflow.api.ops
 
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
+
 /** Contains functions for constructing ops related to processing image data.
   *
   * @author Emmanouil Antonios Platanios
@@ -45,11 +47,54 @@ private[ops] trait Image {
         .setAttribute("rates", rates.map(_.toLong).toArray)
         .build().outputs(0)
   }
+
+  /** $OpDocImageDecodeCropAndResizeJpeg
+    *
+    * @group ImageOps
+    * @param  contents   `STRING` scalar or vector containing the JPEG-encoded images.
+    * @param  cropWindow [[INT32]] tensor with shape `[4]` or `[batchSize, 4]`, containing the crop window(s),
+    *                    represented as `[cropY, cropX, cropHeight, cropWidth]`. A single crop window is shared by all
+    *                    images.
+    * @param  size       [[INT32]] tensor with shape `[2]`, containing the new size of the images, represented as
+    *                    `[height, width]`.
+    * @param  channels   Number of color channels of the decoded images. Must be `1` (for grayscale images) or `3` (for
+    *                    RGB images).
+    * @param  name       Name for the created op.
+    * @return Created op output, which is a [[FLOAT32]] tensor with shape `[height, width, channels]`, if `contents` is
+    *         a scalar, or `[batchSize, height, width, channels]`, if it is a vector.
+    */
+  def decodeCropAndResizeJpeg(
+      contents: Output, cropWindow: Output, size: Output, channels: Int = 3,
+      name: String = "DecodeCropAndResizeJpeg"): Output = {
+    Op.Builder(opType = "DecodeCropAndResizeJpeg", name = name)
+        .addInput(contents)
+        .addInput(cropWindow)
+        .addInput(size)
+        .setAttribute("channels", channels)
+        .build().outputs(0)
+  }
 }
 
 private[ops] object Image extends Image {
+  private[ops] object Gradients {
+    GradientsRegistry.registerNonDifferentiable("DecodeCropAndResizeJpeg")
+  }
+
   /** @define OpDocImageExtractImagePatches
     *   The `extractImagePatches` op extracts `patches` from `images` and puts them in the `depth` output dimension.
+    *
+    * @define OpDocImageDecodeCropAndResizeJpeg
+    *   The `decodeCropAndResizeJpeg` op decodes, crops, and resizes JPEG-encoded images, in a single step.
+    *
+    *   The result is the same as decoding each image, cropping it using `cropWindow`, and resizing the crop to `size`
+    *   using bilinear interpolation, up to JPEG decoding differences. However, the full-resolution images are never
+    *   decoded. Each image is decoded at the smallest DCT-domain scale (out of `1/8`, `2/8`, ..., `8/8`) at which its
+    *   crop window is at least as large as `size`, and only the parts of it that overlap with the crop window are
+    *   decoded. The images of a batch are processed in parallel and each one is written directly to its slot in the
+    *   output batch, which avoids a separate batching step for image input pipelines.
+    *
+    *   Note that this op is only available if the op library was built with JPEG support (i.e., using the
+    *   `TENSORFLOW_WITH_JPEG` CMake option), and it only supports CPU devices.
     */
   private[ops] trait Documentation
 }
@@ -689,6 +689,26 @@ private[api] trait Math {
             .build().outputs(0))
   }
 
+  /** Creates an op that checks whether all elements of all `inputs` are finite, using a single (CPU-only) fused kernel
+    * that outputs one boolean, instead of one boolean tensor per input. This makes it cheap to check many large tensors
+    * (e.g., all gradients) every step, since only two scalars need to be fetched.
+    *
+    * @group MathOps
+    * @param  inputs    Input tensors that must each be one of the following types: `HALF`, `FLOAT32`, or `FLOAT64`.
+    * @param  ignoreInf If `true`, only `NaN` values are considered non-finite.
+    * @param  name      Name for the created op.
+    * @return Tuple containing a `BOOLEAN` scalar that is `true` if all elements of all `inputs` are finite, and an
+    *         `INT32` scalar containing the index of the first input that contains non-finite values, or `-1` if there
+    *         is none.
+    */
+  def allFinite(inputs: Seq[Output], ignoreInf: Boolean = false, name: String = "AllFinite"): (Output, Output) = {
+    val outputs = Op.Builder(opType = "AllFinite", name = name)
+        .addInputList(inputs)
+        .setAttribute("ignore_inf", ignoreInf)
+        .build().outputs
+    (outputs(0), outputs(1))
+  }
+
   //endregion Unary Ops
 
   //region Binary Ops
@@ -68,6 +68,27 @@ private[api] trait NN {
     }
   }
 
+  /** $OpDocNNFusedLinear
+    *
+    * @group NNOps
+    * @param  x          Two-dimensional [[FLOAT32]] or [[FLOAT64]] input tensor.
+    * @param  weights    Weights matrix.
+    * @param  bias       Bias vector.
+    * @param  activation Name of the activation function to apply. Must be one of: `"none"`, `"relu"`, `"relu6"`,
+    *                    `"elu"`, `"tanh"`, or `"sigmoid"`.
+    * @param  name       Name for the created op.
+    * @return Created op output.
+    */
+  def fusedLinear(
+      x: Output, weights: Output, bias: Output, activation: String = "none", name: String = "FusedLinear"): Output = {
+    Op.Builder(opType = "FusedDense", name = name)
+        .addInput(x)
+        .addInput(weights)
+        .addInput(bias)
+        .setAttribute("activation", activation)
+        .build().outputs(0)
+  }
+
   /** $OpDocNNL2Normalize
     *
     * @group NNOps
@@ -546,6 +567,126 @@ private[api] trait NN {
     }
   }
 
+  /** $OpDocNNSampledSoftmaxLoss
+    *
+    * @group NNOps
+    * @param  weights              Tensor of shape `[numClasses, dimension]` containing the class embeddings.
+    * @param  biases               Tensor of shape `[numClasses]` containing the class biases.
+    * @param  labels               Integer tensor of shape `[batchSize, numTrue]` containing the target classes.
+    * @param  inputs               Tensor of shape `[batchSize, dimension]` containing the input activations.
+    * @param  numSampled           Number of classes to randomly sample per batch.
+    * @param  numClasses           Number of possible classes.
+    * @param  numTrue              Number of target classes per training example.
+    * @param  sampledValues        Tuple containing the outputs of a candidate sampler (e.g.,
+    *                              [[logUniformCandidateSampler]] or [[mappedUnigramCandidateSampler]]). Defaults to
+    *                              `null`, in which case the classes are sampled using [[logUniformCandidateSampler]].
+    * @param  removeAccidentalHits If `true`, sampled classes that happen to be equal to one of the target classes are
+    *                              removed from the loss.
+    * @param  seed                 Optional random seed for the default candidate sampler.
+    * @param  name                 Name for the created op.
+    * @return Created op output, with shape `[batchSize]`, containing the sampled softmax loss of each example.
+    */
+  def sampledSoftmaxLoss(
+      weights: Output, biases: Output, labels: Output, inputs: Output, numSampled: Int, numClasses: Int,
+      numTrue: Int = 1, sampledValues: (Output, Output, Output) = null, removeAccidentalHits: Boolean = true,
+      seed: Option[Int] = None, name: String = "SampledSoftmaxLoss"): Output = {
+    Op.createWithNameScope(name, Set(weights.op, biases.op, labels.op, inputs.op)) {
+      val (logits, sampledLabels) = computeSampledLogits(
+        weights, biases, labels, inputs, numSampled, numClasses, numTrue, sampledValues, subtractLogQ = true,
+        removeAccidentalHits, seed)
+      softmaxCrossEntropy(logits, Basic.stopGradient(sampledLabels))
+    }
+  }
+
+  /** $OpDocNNNCELoss
+    *
+    * @group NNOps
+    * @param  weights              Tensor of shape `[numClasses, dimension]` containing the class embeddings.
+    * @param  biases               Tensor of shape `[numClasses]` containing the class biases.
+    * @param  labels               Integer tensor of shape `[batchSize, numTrue]` containing the target classes.
+    * @param  inputs               Tensor of shape `[batchSize, dimension]` containing the input activations.
+    * @param  numSampled           Number of classes to randomly sample per batch.
+    * @param  numClasses           Number of possible classes.
+    * @param  numTrue              Number of target classes per training example.
+    * @param  sampledValues        Tuple containing the outputs of a candidate sampler (e.g.,
+    *                              [[logUniformCandidateSampler]] or [[mappedUnigramCandidateSampler]]). Defaults to
+    *                              `null`, in which case the classes are sampled using [[logUniformCandidateSampler]].
+    * @param  removeAccidentalHits If `true`, sampled classes that happen to be equal to one of the target classes are
+    *                              removed from the loss.
+    * @param  seed                 Optional random seed for the default candidate sampler.
+    * @param  name                 Name for the created op.
+    * @return Created op output, with shape `[batchSize]`, containing the NCE loss of each example.
+    */
+  def nceLoss(
+      weights: Output, biases: Output, labels: Output, inputs: Output, numSampled: Int, numClasses: Int,
+      numTrue: Int = 1, sampledValues: (Output, Output, Output) = null, removeAccidentalHits: Boolean = false,
+      seed: Option[Int] = None, name: String = "NCELoss"): Output = {
+    Op.createWithNameScope(name, Set(weights.op, biases.op, labels.op, inputs.op)) {
+      val (logits, sampledLabels) = computeSampledLogits(
+        weights, biases, labels, inputs, numSampled, numClasses, numTrue, sampledValues, subtractLogQ = true,
+        removeAccidentalHits, seed)
+      Math.sum(sigmoidCrossEntropy(logits, sampledLabels), axes = 1)
+    }
+  }
+
+  /** Computes the logits and labels of the true and the sampled classes, which are used by [[sampledSoftmaxLoss]] and
+    * [[nceLoss]]. Only the embeddings of these classes are gathered, and so the cost of the computation is
+    * proportional to the number of sampled classes, rather than to the number of classes.
+    *
+    * The returned logits and labels both have shape `[batchSize, numTrue + numSampled]`. */
+  private[this] def computeSampledLogits(
+      weights: Output, biases: Output, labels: Output, inputs: Output, numSampled: Int, numClasses: Int,
+      numTrue: Int, sampledValues: (Output, Output, Output), subtractLogQ: Boolean, removeAccidentalHits: Boolean,
+      seed: Option[Int]): (Output, Output) = {
+    val int64Labels = Math.cast(labels, INT64)
+    val (sampledCandidates, trueExpectedCount, sampledExpectedCount) = {
+      if (sampledValues != null)
+        sampledValues
+      else
+        logUniformCandidateSampler(int64Labels, numTrue, numSampled, unique = true, numClasses, seed)
+    }
+    val sampled = Basic.stopGradient(sampledCandidates)
+    val flatLabels = Basic.reshape(int64Labels, Shape(-1))
+    val numFlatLabels = Basic.shape(flatLabels)
+    // The embeddings and biases of the true and sampled classes are gathered together.
+    val allIds = Basic.concatenate(Seq(flatLabels, sampled), 0)
+    val allWeights = Basic.gather(weights, allIds)
+    val allBiases = Basic.gather(biases, allIds)
+    val trueWeights = Basic.slice(allWeights, Seq(0, 0), Basic.concatenate(Seq(numFlatLabels, Shape(-1).toOutput())))
+    val sampledWeights = Basic.slice(
+      allWeights, Basic.concatenate(Seq(numFlatLabels, Shape(0).toOutput())), Seq(-1, -1))
+    val trueBiases = Basic.reshape(Basic.slice(allBiases, Seq(0), numFlatLabels), Shape(-1, numTrue))
+    val sampledBiases = Basic.slice(allBiases, numFlatLabels, Seq(-1))
+    // The true logits are computed using row-wise dot products of the inputs with the true class embeddings.
+    val dimension = Basic.shape(trueWeights)(1 :: 2)
+    val rowWiseDots = Math.multiply(
+      Basic.expandDims(inputs, 1),
+      Basic.reshape(trueWeights, Basic.concatenate(Seq(Shape(-1, numTrue).toOutput(), dimension))))
+    val dotsAsMatrix = Basic.reshape(rowWiseDots, Basic.concatenate(Seq(Shape(-1).toOutput(), dimension)))
+    var trueLogits = Basic.reshape(Math.sum(dotsAsMatrix, axes = 1), Shape(-1, numTrue)) + trueBiases
+    var sampledLogits = Math.matmul(inputs, sampledWeights, transposeB = true) + sampledBiases
+    if (removeAccidentalHits) {
+      // Sampled classes that are equal to one of the target classes are masked out by adding a large negative number
+      // to their logits.
+      val (hitIndices, hitIds, hitWeights) = computeAccidentalHits(int64Labels, sampled, numTrue, seed)
+      val sparseIndices = Basic.concatenate(Seq(
+        Basic.reshape(Math.cast(hitIndices, INT64), Shape(-1, 1)),
+        Basic.reshape(hitIds, Shape(-1, 1))), 1)
+      val sampledLogitsShape = Basic.shape(sampledLogits, INT64)
+      sampledLogits += Basic.scatterND(sparseIndices, Math.cast(hitWeights, sampledLogits.dataType), sampledLogitsShape)
+    }
+    if (subtractLogQ) {
+      // The logits are adjusted by the log-probabilities of the classes being sampled.
+      trueLogits -= Math.log(Math.cast(trueExpectedCount, trueLogits.dataType))
+      sampledLogits -= Math.log(Math.cast(sampledExpectedCount, sampledLogits.dataType))
+    }
+    val logits = Basic.concatenate(Seq(trueLogits, sampledLogits), 1)
+    val sampledLabels = Basic.concatenate(Seq(
+      Basic.onesLike(trueLogits) / Basic.constant(numTrue, trueLogits.dataType),
+      Basic.zerosLike(sampledLogits)), 1)
+    (logits, sampledLabels)
+  }
+
   //endregion Loss Ops
 
   /** $OpDocNNDropout
@@ -585,16 +726,21 @@ private[api] trait NN {
   /** $OpDocNNTopK
     *
     * @group NNOps
-    * @param  input  Input tensor whose last axis has size at least `k`.
-    * @param  k      Scalar [[INT32]] tensor containing the number of top elements to look for along the last axis of
-    *                `input`.
-    * @param  sorted If `true`, the resulting `k` elements will be sorted by their values in descending order.
-    * @param  name   Name for the created op.
+    * @param  input       Input tensor whose last axis has size at least `k`.
+    * @param  k           Scalar [[INT32]] tensor containing the number of top elements to look for along the last axis
+    *                     of `input`.
+    * @param  sorted      If `true`, the resulting `k` elements will be sorted by their values in descending order.
+    * @param  partialSort If `true`, a (CPU-only) kernel specialized for large last axes and small `k` (e.g., for
+    *                     vocabulary-sized logits) is used, which skips most elements using a vectorized threshold
+    *                     filter and only partially sorts the remaining candidates.
+    * @param  name        Name for the created op.
     * @return Tuple containing the created op outputs: (i) `values`: the `k` largest elements along each last
     *         dimensional slice, and (ii) `indices`: the indices of `values` within the last axis of `input`.
     */
-  def topK(input: Output, k: Output = 1, sorted: Boolean = true, name: String = "TopK"): (Output, Output) = {
-    val outputs = Op.Builder(opType = "TopKV2", name = name)
+  def topK(
+      input: Output, k: Output = 1, sorted: Boolean = true, partialSort: Boolean = false,
+      name: String = "TopK"): (Output, Output) = {
+    val outputs = Op.Builder(opType = if (partialSort) "LargeTopK" else "TopKV2", name = name)
         .addInput(input)
         .addInput(k)
         .setAttribute("sorted", sorted)
@@ -608,12 +754,17 @@ private[api] trait NN {
     * @param  predictions [[FLOAT32]] tensor containing the predictions.
     * @param  targets     [[INT32]] or [[INT64]] tensor containing the targets.
     * @param  k           Scalar [[INT32]] or [[INT64]] tensor containing the number of top elements to look at.
+    * @param  partialSort If `true`, a (CPU-only) kernel specialized for large numbers of classes is used, which
+    *                     counts the predictions larger than each target using vectorized comparisons and stops as soon
+    *                     as `k` of them have been found.
     * @param  name        Name for the created op.
     * @return Created op output.
     */
-  def inTopK(predictions: Output, targets: Output, k: Output, name: String = "InTopK"): Output = {
+  def inTopK(
+      predictions: Output, targets: Output, k: Output, partialSort: Boolean = false,
+      name: String = "InTopK"): Output = {
     val mostPreciseDataType = DataType.mostPrecise(targets.dataType, k.dataType)
-    Op.Builder(opType = "InTopKV2", name = name)
+    Op.Builder(opType = if (partialSort) "LargeInTopK" else "InTopKV2", name = name)
         .addInput(predictions)
         .addInput(targets.cast(mostPreciseDataType))
         .addInput(k.cast(mostPreciseDataType))
@@ -795,6 +946,152 @@ private[api] trait NN {
   }
 
   //endregion Pooling Ops
+
+  //region Normalization Ops
+
+  /** $OpDocNNFusedBatchNormalization
+    *
+    * @group NNOps
+    * @param  x          4-D [[FLOAT32]] tensor whose dimension order is interpreted according to the value of
+    *                    `dataFormat`.
+    * @param  scale      1-D tensor containing the scale factor (i.e., `gamma`) of each channel.
+    * @param  offset     1-D tensor containing the offset (i.e., `beta`) of each channel.
+    * @param  mean       1-D tensor containing the population mean of each channel, used for inference. Must be `null`
+    *                    when `isTraining` is `true`.
+    * @param  variance   1-D tensor containing the population variance of each channel, used for inference. Must be
+    *                    `null` when `isTraining` is `true`.
+    * @param  epsilon    Small number added to the variance to avoid dividing by zero.
+    * @param  dataFormat Format of the input and output data.
+    * @param  isTraining If `true`, the batch statistics are computed and used for the normalization. Otherwise, the
+    *                    provided population statistics are used.
+    * @param  name       Name for the created op.
+    * @return Tuple containing the created op outputs: (i) the normalized tensor, (ii) the batch mean, and (iii) the
+    *         batch variance. The batch mean and variance are only meaningful when `isTraining` is `true`.
+    * @throws IllegalArgumentException If `isTraining` is `false` and `mean` or `variance` are not provided.
+    */
+  @throws[IllegalArgumentException]
+  def fusedBatchNormalization(
+      x: Output, scale: Output, offset: Output, mean: Output = null, variance: Output = null,
+      epsilon: Float = 0.001f, dataFormat: CNNDataFormat = CNNDataFormat.default, isTraining: Boolean = true,
+      name: String = "FusedBatchNormalization"): (Output, Output, Output) = {
+    if (!isTraining && (mean == null || variance == null))
+      throw new IllegalArgumentException("Both 'mean' and 'variance' must be provided when 'isTraining' is 'false'.")
+    Op.createWithNameScope(name, Set(x.op, scale.op, offset.op)) {
+      // The population statistics are not used by the op when training and so empty tensors are fed in their place.
+      val populationMean = if (mean != null) mean else Basic.zeros(x.dataType, Shape(0))
+      val populationVariance = if (variance != null) variance else Basic.zeros(x.dataType, Shape(0))
+      val outputs = Op.Builder(opType = "FusedBatchNorm", name = "FusedBatchNorm")
+          .addInput(x)
+          .addInput(scale)
+          .addInput(offset)
+          .addInput(populationMean)
+          .addInput(populationVariance)
+          .setAttribute("epsilon", epsilon)
+          .setAttribute("data_format", dataFormat.name)
+          .setAttribute("is_training", isTraining)
+          .build().outputs
+      (outputs(0), outputs(1), outputs(2))
+    }
+  }
+
+  //endregion Normalization Ops
+
+  //region Candidate Sampling Ops
+
+  /** $OpDocNNLogUniformCandidateSampler
+    *
+    * @group NNOps
+    * @param  trueClasses [[INT64]] tensor of shape `[batchSize, numTrue]` containing the target classes.
+    * @param  numTrue     Number of target classes per training example.
+    * @param  numSampled  Number of classes to randomly sample.
+    * @param  unique      If `true`, the classes are sampled without replacement.
+    * @param  rangeMax    Number of possible classes.
+    * @param  seed        Optional random seed, used to generate a random seed pair for the random number generator,
+    *                     when combined with the graph-level seed.
+    * @param  name        Name for the created op.
+    * @return Tuple containing the created op outputs: (i) the sampled candidates, (ii) the expected counts of the true
+    *         classes, and (iii) the expected counts of the sampled candidates.
+    */
+  def logUniformCandidateSampler(
+      trueClasses: Output, numTrue: Int, numSampled: Int, unique: Boolean, rangeMax: Long, seed: Option[Int] = None,
+      name: String = "LogUniformCandidateSampler"): (Output, Output, Output) = {
+    val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
+    val outputs = Op.Builder(opType = "LogUniformCandidateSampler", name = name)
+        .addInput(trueClasses)
+        .setAttribute("num_true", numTrue)
+        .setAttribute("num_sampled", numSampled)
+        .setAttribute("unique", unique)
+        .setAttribute("range_max", rangeMax)
+        .setAttribute("seed", graphSeed.getOrElse(0))
+        .setAttribute("seed2", opSeed.getOrElse(0))
+        .build().outputs
+    (outputs(0), outputs(1), outputs(2))
+  }
+
+  /** $OpDocNNMappedUnigramCandidateSampler
+    *
+    * @group NNOps
+    * @param  trueClasses      [[INT64]] tensor of shape `[batchSize, numTrue]` containing the target classes.
+    * @param  numTrue          Number of target classes per training example.
+    * @param  numSampled       Number of classes to randomly sample.
+    * @param  unique           If `true`, the classes are sampled without replacement.
+    * @param  rangeMax         Number of possible classes.
+    * @param  distributionFile Path to the file containing the class weights, as a little-endian `float32` array with
+    *                          `rangeMax` elements.
+    * @param  distortion       Power to which the class weights are raised before they are normalized.
+    * @param  seed             Optional random seed, used to generate a random seed pair for the random number
+    *                          generator, when combined with the graph-level seed.
+    * @param  name             Name for the created op.
+    * @return Tuple containing the created op outputs: (i) the sampled candidates, (ii) the expected counts of the true
+    *         classes, and (iii) the expected counts of the sampled candidates.
+    */
+  def mappedUnigramCandidateSampler(
+      trueClasses: Output, numTrue: Int, numSampled: Int, unique: Boolean, rangeMax: Long, distributionFile: String,
+      distortion: Float = 1.0f, seed: Option[Int] = None,
+      name: String = "MappedUnigramCandidateSampler"): (Output, Output, Output) = {
+    val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
+    val outputs = Op.Builder(opType = "MappedUnigramCandidateSampler", name = name)
+        .addInput(trueClasses)
+        .setAttribute("num_true", numTrue)
+        .setAttribute("num_sampled", numSampled)
+        .setAttribute("unique", unique)
+        .setAttribute("range_max", rangeMax)
+        .setAttribute("distribution_file", distributionFile)
+        .setAttribute("distortion", distortion)
+        .setAttribute("seed", graphSeed.getOrElse(0))
+        .setAttribute("seed2", opSeed.getOrElse(0))
+        .build().outputs
+    (outputs(0), outputs(1), outputs(2))
+  }
+
+  /** $OpDocNNComputeAccidentalHits
+    *
+    * @group NNOps
+    * @param  trueClasses       [[INT64]] tensor of shape `[batchSize, numTrue]` containing the target classes.
+    * @param  sampledCandidates [[INT64]] tensor of shape `[numSampled]` containing the sampled candidates.
+    * @param  numTrue           Number of target classes per training example.
+    * @param  seed              Optional random seed, used to generate a random seed pair for the random number
+    *                           generator, when combined with the graph-level seed.
+    * @param  name              Name for the created op.
+    * @return Tuple containing the created op outputs: (i) the row (i.e., example) indices of the accidental hits,
+    *         (ii) the sampled candidate indices of the accidental hits, and (iii) the weights that must be added to
+    *         the corresponding logits in order to remove the accidental hits (i.e., large negative numbers).
+    */
+  def computeAccidentalHits(
+      trueClasses: Output, sampledCandidates: Output, numTrue: Int, seed: Option[Int] = None,
+      name: String = "ComputeAccidentalHits"): (Output, Output, Output) = {
+    val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
+    val outputs = Op.Builder(opType = "ComputeAccidentalHits", name = name)
+        .addInput(trueClasses)
+        .addInput(sampledCandidates)
+        .setAttribute("num_true", numTrue)
+        .setAttribute("seed", graphSeed.getOrElse(0))
+        .setAttribute("seed2", opSeed.getOrElse(0))
+        .build().outputs
+    (outputs(0), outputs(1), outputs(2))
+  }
+
+  //endregion Candidate Sampling Ops
 }
 
 object NN extends NN {
@@ -928,22 +1225,28 @@ object NN extends NN {
     /** $OpDocNNTopK
       *
       * @group NNOps
-      * @param  k      Scalar [[INT32]] tensor containing the number of top elements to look for along the last axis of
-      *                `input`.
-      * @param  sorted If `true`, the resulting `k` elements will be sorted by their values in descending order.
+      * @param  k           Scalar [[INT32]] tensor containing the number of top elements to look for along the last
+      *                     axis of `input`.
+      * @param  sorted      If `true`, the resulting `k` elements will be sorted by their values in descending order.
+      * @param  partialSort If `true`, a (CPU-only) kernel specialized for large last axes and small `k` is used.
       * @return Tuple containing the created op outputs: (i) `values`: the `k` largest elements along each last
       *         dimensional slice, and (ii) `indices`: the indices of `values` within the last axis of `input`.
       */
-    def topK(k: Output = 1, sorted: Boolean = true): (Output, Output) = NN.topK(output, k, sorted)
+    def topK(k: Output = 1, sorted: Boolean = true, partialSort: Boolean = false): (Output, Output) = {
+      NN.topK(output, k, sorted, partialSort)
+    }
 
     /** $OpDocNNInTopK
       *
       * @group NNOps
-      * @param  targets [[INT32]] or [[INT64]] tensor containing the targets.
-      * @param  k       Scalar [[INT32]] or [[INT64]] tensor containing the number of top elements to look at.
+      * @param  targets     [[INT32]] or [[INT64]] tensor containing the targets.
+      * @param  k           Scalar [[INT32]] or [[INT64]] tensor containing the number of top elements to look at.
+      * @param  partialSort If `true`, a (CPU-only) kernel specialized for large numbers of classes is used.
       * @return Created op output.
       */
-    def inTopK(targets: Output, k: Output): Output = NN.inTopK(output, targets, k)
+    def inTopK(targets: Output, k: Output, partialSort: Boolean = false): Output = {
+      NN.inTopK(output, targets, k, partialSort)
+    }
 
     //region Convolution Ops
 
@@ -1098,8 +1401,14 @@ object NN extends NN {
     GradientsRegistry.register("L2Loss", l2LossGradient)
     GradientsRegistry.register("TopK", topKGradient)
     GradientsRegistry.register("TopKV2", topKGradient)
+    GradientsRegistry.register("LargeTopK", topKGradient)
     GradientsRegistry.register("BatchNormWithGlobalNormalization", batchNormalizationWithGlobalNormalizationGradient)
     GradientsRegistry.register("FusedBatchNorm", fusedBatchNormalizationGradient)
+    GradientsRegistry.register("FusedDense", fusedLinearGradient)
+    GradientsRegistry.registerNonDifferentiable("FusedDenseGrad")
+    GradientsRegistry.registerNonDifferentiable("LogUniformCandidateSampler")
+    GradientsRegistry.registerNonDifferentiable("MappedUnigramCandidateSampler")
+    GradientsRegistry.registerNonDifferentiable("ComputeAccidentalHits")
     GradientsRegistry.register("Conv2D", conv2DGradient)
     GradientsRegistry.register("MaxPool", maxPoolGradient)
     GradientsRegistry.register("MaxPoolGrad", maxPoolHessian)
@@ -1386,6 +1695,17 @@ object NN extends NN {
         .build().outputs.asInstanceOf[Seq[OutputLike]]
   }
 
+  private[this] def fusedLinearGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
+    val outputGradient = outputGradients.head.toOutput
+    Op.Builder(opType = "FusedDenseGrad", name = "FusedLinearGradient")
+        .addInput(op.inputs(0))
+        .addInput(op.inputs(1))
+        .addInput(op.outputs(0))
+        .addInput(outputGradient)
+        .setAttribute("activation", op.stringAttribute("activation"))
+        .build().outputs.asInstanceOf[Seq[OutputLike]]
+  }
+
   private[this] def conv2DGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
     val outputGradient = outputGradients.head.toOutput
     val strides = op.longArrayAttribute("strides")
@@ -1452,6 +1772,12 @@ object NN extends NN {
     * @define OpDocNNLinear
     *   The `linear` op computes `x * weights + bias`.
     *
+    * @define OpDocNNFusedLinear
+    *   The `fusedLinear` op computes `activation(x * weights + bias)` using a single fused kernel.
+    *
+    *   The bias addition and the activation are applied to the matrix product in place, and so, unlike when using
+    *   separate ops, the product is only materialized once. The gradient is also computed using a single fused kernel.
+    *
     * @define OpDocNNL2Normalize
     *   The `l2Normalize` op normalizes along axes `axes` using an L2 norm.
     *
@@ -1634,6 +1960,29 @@ object NN extends NN {
     *   `[batchSize, sequenceLength]`, over their respective dimensions. For examplem if `averageAcrossTimeSteps` is
     *   `true` and `averageAcrossBatch` is `false`, then the returned tensor will have shape `[batchSize]`.
     *
+    * @define OpDocNNSampledSoftmaxLoss
+    *   The `sampledSoftmaxLoss` op computes and returns the sampled softmax training loss.
+    *
+    *   This is a faster way to train a softmax classifier over a huge number of classes, as the loss is only computed
+    *   over the target classes and a small random sample of the remaining classes. Its cost is thus proportional to
+    *   the number of sampled classes, rather than to the total number of classes. The loss should only be used for
+    *   training; the full softmax cross entropy should be used for evaluation and inference.
+    *
+    *   The sampled classes are drawn using `logUniformCandidateSampler` by default, which assumes that the classes are
+    *   sorted in order of decreasing frequency. Other samplers, such as `mappedUnigramCandidateSampler`, can be used
+    *   by providing their outputs as `sampledValues`.
+    *
+    *   Reference: [On Using Very Large Target Vocabulary for Neural Machine Translation](https://arxiv.org/abs/1412.2007)
+    *
+    * @define OpDocNNNCELoss
+    *   The `nceLoss` op computes and returns the noise-contrastive estimation (NCE) training loss.
+    *
+    *   Like `sampledSoftmaxLoss`, the loss is only computed over the target classes and a small random sample of the
+    *   remaining classes, but each class is treated as an independent binary classification problem, using the
+    *   sigmoid cross entropy.
+    *
+    *   Reference: [Noise-Contrastive Estimation](http://www.jmlr.org/proceedings/papers/v9/gutmann10a/gutmann10a.pdf)
+    *
     * @define OpDocNNDropout
     *   The `dropout` op computes a dropout layer.
     *
@@ -1706,6 +2055,35 @@ object NN extends NN {
     *
     * @define OpDocMaxPoolGradGrad
     *   The `maxPoolGradGrad` op computes the gradient of the `maxPoolGrad` op.
+    *
+    * @define OpDocNNFusedBatchNormalization
+    *   The `fusedBatchNormalization` op performs batch normalization on a 4-D tensor, using a single fused kernel.
+    *
+    *   The tensor is normalized over all of its dimensions except for the channels dimension. When training, the op
+    *   computes the batch mean and variance together with the normalized tensor, and returns them so that they can be
+    *   used to update moving averages of the population statistics.
+    *
+    * @define OpDocNNLogUniformCandidateSampler
+    *   The `logUniformCandidateSampler` op samples classes from an approximately log-uniform (i.e., Zipfian)
+    *   distribution over `[0, rangeMax)`.
+    *
+    *   The probability of class `c` is `(log(c + 2) - log(c + 1)) / log(rangeMax + 1)`, which is appropriate when the
+    *   classes are sorted in order of decreasing frequency.
+    *
+    * @define OpDocNNMappedUnigramCandidateSampler
+    *   The `mappedUnigramCandidateSampler` op samples classes from a unigram distribution over `[0, rangeMax)` that is
+    *   stored in a memory-mapped file.
+    *
+    *   The file contains the (unnormalized) class weights (e.g., the class counts) and it is mapped into memory, rather
+    *   than parsed, which keeps the start-up cost low for distributions over millions of classes. The weights are
+    *   raised to the power of `distortion` before being normalized, and the classes are sampled in constant time per
+    *   sample.
+    *
+    * @define OpDocNNComputeAccidentalHits
+    *   The `computeAccidentalHits` op computes the positions of the sampled candidates that match target classes.
+    *
+    *   In candidate sampling, this op facilitates removing the sampled classes that happen to match target classes,
+    *   which is known as an "accidental hit".
     */
   private[ops] trait Documentation
 }
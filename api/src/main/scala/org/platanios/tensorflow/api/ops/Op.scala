@@ -342,7 +342,14 @@ final case class Op private (graph: Graph, private[api] val nativeHandle: Long)
   }
 }
 
-final case class OpSpecification(name: String, opType: String, device: String)
+/** Specification of an op that is being created, which is passed to device functions.
+  *
+  * @param  name       Name of the op.
+  * @param  opType     Type of the op.
+  * @param  device     Device of the op creation context.
+  * @param  attributes Attributes that have been set for the op (e.g., the `"shape"` and `"dtype"` of variable ops).
+  */
+final case class OpSpecification(name: String, opType: String, device: String, attributes: Map[String, Any] = Map.empty)
 
 private[api] final case class OpCreationContext(
     graph: Graph = Graph(), nameScope: String = "", variableScope: VariableScope = VariableScope(reuse = CreateNewOnly),
@@ -1156,6 +1163,34 @@ object Op {
     }
   }
 
+  /** Builds the ops described by `builders`, which must all belong to the same graph, and returns them in the same
+    * order. All ops are first described and then finished using a single native call, which takes the native graph
+    * lock only once, rather than once per op. This is useful when creating many independent ops at once (note that
+    * none of the builders may use an op built by another one of them as an input).
+    *
+    * @throws OpBuilderUsedException   If any of the builders has already been used to build an op.
+    * @throws IllegalArgumentException If the builders do not all belong to the same graph.
+    */
+  @throws[OpBuilderUsedException]
+  @throws[IllegalArgumentException]
+  private[ops] def buildAll(builders: Seq[Builder]): Seq[Op] = {
+    if (builders.isEmpty) {
+      Seq.empty
+    } else {
+      val graph = builders.head.graph
+      if (builders.exists(_.graph != graph))
+        throw new IllegalArgumentException("All op builders must belong to the same graph.")
+      using(graph.reference) { r =>
+        val opHandles = NativeOp.finishAll(r.nativeHandle, builders.map(_.describe(r.nativeHandle)).toArray)
+        builders.zip(opHandles).map(b => {
+          val op = Op(graph, b._2)
+          b._1.addToControlFlowContext(op)
+          op
+        })
+      }
+    }
+  }
+
   private[ops] final case class Builder(opType: String, name: String)
       (implicit context: DynamicVariable[OpCreationContext]) {
     context.value.graph.assertNotFrozen()
@@ -1163,7 +1198,7 @@ object Op {
     if (!checkName(name))
       throw IllegalNameException(s"Illegal op name '$name'.")
 
-    private val graph: Graph = context.value.graph
+    private[Op] val graph: Graph = context.value.graph
 
     private var built         : Boolean           = false
     // TODO: [OP] Avoid using this extra input functions sequence.
@@ -1173,35 +1208,53 @@ object Op {
     private var device        : Option[String]    = None
     private var attributes    : Map[String, Any]  = Map.empty
 
-    def build(): Op = graph.synchronized {
-      using(graph.reference) { r =>
-        if (built)
-          throw OpBuilderUsedException("This op builder has already been used to built an op and cannot be re-used.")
-        device = Option(context.value.deviceFunction(OpSpecification(this.name, opType, context.value.device)))
-        val name = {
-          // If a name ends with a "/" then it is a name scope and we use it as-is, after removing the trailing "/".
-          if (this.name.endsWith("/"))
-            convertNameScopeToName(this.name)
-          else
-            graph.uniqueName(this.name)
-        }
-        val nativeHandle: Long = NativeOp.allocate(r.nativeHandle, opType, name)
-        inputFunctions.foreach(_ (nativeHandle))
-        val controlDependencies: mutable.Set[Op] = mutable.Set(context.value.controlDependencies.toSeq: _*)
-        inputs.foreach(input => pruneControlDependencies(controlDependencies, input.op))
-        inputLists.foreach(_.foreach(input => pruneControlDependencies(controlDependencies, input.op)))
-        controlDependencies.foreach(op => NativeOp.addControlInput(nativeHandle, op.nativeHandle))
-        device.foreach(NativeOp.setDevice(nativeHandle, _))
-        context.value.colocationOps.foreach(op => NativeOp.colocateWith(nativeHandle, op.nativeHandle))
-        mergeAttributes(context.value.attributes)
-        setAttributes(nativeHandle)
-        // TODO: !!! Set the "container" attribute when necessary. Need a way to check for statefulness.
-        val op = Op(graph, NativeOp.finish(nativeHandle))
-        op.controlFlowContext = context.value.controlFlowContext
-        op.controlFlowContext.foreach(_.add(op))
-        built = true
-        op
+    /** Builds the op described by this builder.
+      *
+      * The graph is not locked while the op is being described (e.g., while its inputs and attributes are being set).
+      * Only finishing the op takes the native graph lock, and only adding it to its control flow context (if any)
+      * synchronizes on the graph. Multiple threads can thus build ops in the same graph concurrently. */
+    def build(): Op = using(graph.reference) { r =>
+      val op = Op(graph, NativeOp.finish(describe(r.nativeHandle)))
+      addToControlFlowContext(op)
+      op
+    }
+
+    /** Allocates a native op description in the graph with handle `graphHandle`, sets all of its properties, and
+      * returns its handle. The returned description must be finished using either `NativeOp.finish` or
+      * `NativeOp.finishAll`. */
+    private[Op] def describe(graphHandle: Long): Long = {
+      if (built)
+        throw OpBuilderUsedException("This op builder has already been used to built an op and cannot be re-used.")
+      val opSpecification = OpSpecification(this.name, opType, context.value.device, attributes)
+      device = Option(context.value.deviceFunction(opSpecification))
+      val name = {
+        // If a name ends with a "/" then it is a name scope and we use it as-is, after removing the trailing "/".
+        if (this.name.endsWith("/"))
+          convertNameScopeToName(this.name)
+        else
+          graph.uniqueName(this.name)
       }
+      val nativeHandle: Long = NativeOp.allocate(graphHandle, opType, name)
+      inputFunctions.foreach(_ (nativeHandle))
+      val controlDependencies: mutable.Set[Op] = mutable.Set(context.value.controlDependencies.toSeq: _*)
+      inputs.foreach(input => pruneControlDependencies(controlDependencies, input.op))
+      inputLists.foreach(_.foreach(input => pruneControlDependencies(controlDependencies, input.op)))
+      controlDependencies.foreach(op => NativeOp.addControlInput(nativeHandle, op.nativeHandle))
+      device.foreach(NativeOp.setDevice(nativeHandle, _))
+      context.value.colocationOps.foreach(op => NativeOp.colocateWith(nativeHandle, op.nativeHandle))
+      mergeAttributes(context.value.attributes)
+      setAttributes(nativeHandle)
+      // TODO: !!! Set the "container" attribute when necessary. Need a way to check for statefulness.
+      built = true
+      nativeHandle
+    }
+
+    /** Adds `op`, which was built by this builder, to the control flow context of this builder's op creation context,
+      * if there is one. Control flow contexts are not thread-safe and so, this synchronizes on the graph. */
+    private[Op] def addToControlFlowContext(op: Op): Unit = {
+      op.controlFlowContext = context.value.controlFlowContext
+      if (op.controlFlowContext.isDefined)
+        graph.synchronized(op.controlFlowContext.foreach(_.add(op)))
     }
 
     private def mergeAttributes(attributes: Map[String, Any]): Unit = {
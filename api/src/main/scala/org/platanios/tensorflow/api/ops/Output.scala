@@ -18,6 +18,7 @@ package org.platanios.tensorflow.api.ops
 import org.platanios.tensorflow.api._
 import org.platanios.tensorflow.api.core.{Graph, Indexer, Shape}
 import org.platanios.tensorflow.api.core.client.{FeedMap, Session}
+import org.platanios.tensorflow.api.core.exception.GraphMismatchException
 import org.platanios.tensorflow.api.ops
 import org.platanios.tensorflow.api.ops.Basic.BasicOps
 import org.platanios.tensorflow.api.ops.Op.{createWith, getGraphFromInputs}
@@ -278,6 +279,53 @@ object Output {
   implicit def outputToOp(output: Output): Op = output.op
   implicit def outputToInitialValueFunction(output: Output): () => Output = () => output
 
+  /** Returns the shapes of `outputs`, which must all belong to the same graph, using a single native call that holds
+    * the graph lock only once, rather than once per output.
+    *
+    * @throws GraphMismatchException If the outputs do not all belong to the same graph.
+    */
+  @throws[GraphMismatchException]
+  private[api] def shapes(outputs: Seq[Output]): Seq[Shape] = {
+    if (outputs.isEmpty) {
+      Seq.empty
+    } else {
+      val graph = getGraphFromInputs(outputs.map(_.op).toSet)
+      val packed = using(graph.reference) { r =>
+        NativeOp.shapes(r.nativeHandle, outputs.map(_.op.nativeHandle).toArray, outputs.map(_.index).toArray)
+      }
+      var position = 0
+      (0 until outputs.size).map(_ => {
+        val rank = packed(position).toInt
+        position += 1
+        if (rank == -1) {
+          Shape.unknown()
+        } else {
+          position += rank
+          Shape.fromSeq(packed.slice(position - rank, position).map(_.toInt))
+        }
+      })
+    }
+  }
+
+  /** Sets the shapes of `outputs`, which must all belong to the same graph, to `shapes`, using a single native call that
+    * holds the graph lock only once, rather than once per output. Shapes with unknown rank are ignored, as in
+    * [[Output.setShape]].
+    *
+    * @throws GraphMismatchException If the outputs do not all belong to the same graph.
+    */
+  @throws[GraphMismatchException]
+  private[api] def setShapes(outputs: Seq[Output], shapes: Seq[Shape]): Unit = {
+    val known = outputs.zip(shapes).filter(_._2.rank != -1)
+    if (known.nonEmpty) {
+      val graph = getGraphFromInputs(known.map(_._1.op).toSet)
+      using(graph.reference) { r =>
+        NativeOp.setShapes(
+          r.nativeHandle, known.map(_._1.op.nativeHandle).toArray, known.map(_._1.index).toArray,
+          known.map(_._2.rank).toArray, known.flatMap(_._2.asArray.map(_.toLong)).toArray)
+      }
+    }
+  }
+
   private[ops] trait API {
     type OutputLike = ops.OutputLike
     type Output = ops.Output
@@ -681,6 +729,13 @@ final case class SparseOutput(indices: Output, values: Output, denseShape: Outpu
     *                  shape of this tensor at graph creation time (instead of execution time), if known.
     * @return [[OutputIndexedSlices]] that has the same value as this [[OutputLike]].
     */
+  /** Converts this rank-2 sparse tensor to the compressed sparse row (CSR) format.
+    *
+    * @param  name Name for the created op.
+    * @return Sparse tensor in CSR format.
+    */
+  def toCSR(name: String = "SparseTensorToCSR"): CSRSparseOutput = Sparse.sparseToCSR(this, name)
+
   @throws[UnsupportedOperationException]
   override def toOutputIndexedSlices(optimize: Boolean = true): OutputIndexedSlices = {
     throw new UnsupportedOperationException(s"Cannot convert sparse output '$this' to output indexed slices.")
@@ -691,3 +746,51 @@ final case class SparseOutput(indices: Output, values: Output, denseShape: Outpu
         s"device = $device)}"
   }
 }
+
+/** Represents a rank-2 sparse tensor in compressed sparse row (CSR) format.
+  *
+  * The non-zero entries of row `i` are stored in positions `rowPointers(i)` (inclusive) through `rowPointers(i + 1)`
+  * (exclusive) of `columnIndices` and `values`. Compared to the coordinate format of [[SparseOutput]], this format
+  * allows sparse-dense matrix multiplications to process each row of the result independently.
+  *
+  * For example, the sparse tensor `SparseOutput(indices = [[0, 0], [1, 2]], values = [1, 2], denseShape = [3, 4])`
+  * is represented as `CSRSparseOutput(rowPointers = [0, 1, 2, 2], columnIndices = [0, 2], values = [1, 2],
+  * denseShape = [3, 4])`.
+  *
+  * @param  rowPointers   One-dimensional [[INT64]] tensor with shape `[denseShape(0) + 1]`.
+  * @param  columnIndices One-dimensional [[INT64]] tensor with shape `[N]`.
+  * @param  values        One-dimensional tensor with shape `[N]`.
+  * @param  denseShape    One-dimensional [[INT64]] tensor with shape `[2]`.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+final case class CSRSparseOutput(rowPointers: Output, columnIndices: Output, values: Output, denseShape: Output) {
+  require(rowPointers.dataType == INT64,
+          s"Row pointers cannot have '${rowPointers.dataType}' data type. They have to be 'INT64'.")
+  require(columnIndices.dataType == INT64,
+          s"Column indices cannot have '${columnIndices.dataType}' data type. They have to be 'INT64'.")
+  require(denseShape.dataType == INT64,
+          s"Dense shape cannot have '${denseShape.dataType}' data type. It has to be 'INT64'.")
+
+  Shape(columnIndices.shape.withRank(1)(0)).assertIsCompatibleWith(Shape(values.shape.withRank(1)(0)))
+  denseShape.shape.assertIsCompatibleWith(Shape(2))
+
+  /** Data type of this sparse op output. */
+  def dataType: DataType = values.dataType
+
+  /** Multiplies this sparse tensor with the dense matrix `other`.
+    *
+    * @param  other    Dense matrix.
+    * @param  adjointA If `true`, this sparse tensor is transposed before the multiplication.
+    * @param  name     Name for the created op.
+    * @return Created op output.
+    */
+  def matmul(other: Output, adjointA: Boolean = false, name: String = "CSRSparseDenseMatMul"): Output = {
+    Sparse.csrSparseDenseMatMul(this, other, adjointA, name)
+  }
+
+  override def toString: String = {
+    s"CSRSparseOutput(rowPointers = ${rowPointers.name}, columnIndices = ${columnIndices.name}, " +
+        s"values = ${values.name}, denseShape = ${denseShape.name})"
+  }
+}
@@ -122,7 +122,7 @@ class Queue private[Queue](val handle: Output, val dataTypes: Seq[DataType])
     */
   def dequeue(timeout: Option[Double] = None, name: String = s"$name/Dequeue"): Seq[Output] = {
     val dequeued = Queue.queueDequeue(handle, timeout.map(t => (t * 1000).toInt), name)
-    dequeued.head.op.outputs.zip(shapes).foreach(p => p._1.setShape(p._2))
+    Output.setShapes(dequeued.head.op.outputs, shapes)
     dequeued
   }
 
@@ -145,7 +145,7 @@ class Queue private[Queue](val handle: Output, val dataTypes: Seq[DataType])
   def dequeueMany(n: Output, timeout: Option[Double] = None, name: String = s"$name/DequeueMany"): Seq[Output] = {
     val dequeued = Queue.queueDequeueMany(handle, n, timeout.map(t => (t * 1000).toInt), name)
     val batchAxis = Output.constantValue(dequeued.head.op.inputs(1)).get.scalar.asInstanceOf[Int]
-    dequeued.head.op.outputs.zip(shapes).foreach(p => p._1.setShape(Shape(batchAxis) ++ p._2))
+    Output.setShapes(dequeued.head.op.outputs, shapes.map(Shape(batchAxis) ++ _))
     dequeued
   }
 
@@ -169,7 +169,7 @@ class Queue private[Queue](val handle: Output, val dataTypes: Seq[DataType])
   def dequeueUpTo(n: Output, timeout: Option[Double] = None, name: String = s"$name/DequeueUpTo"): Seq[Output] = {
     val dequeued = Queue.queueDequeueUpTo(handle, n, timeout.map(t => (t * 1000).toInt), name)
     val batchAxis = Output.constantValue(dequeued.head.op.inputs(1)).get.scalar.asInstanceOf[Int]
-    dequeued.head.op.outputs.zip(shapes).foreach(p => p._1.setShape(Shape(batchAxis) ++ p._2))
+    Output.setShapes(dequeued.head.op.outputs, shapes.map(Shape(batchAxis) ++ _))
     dequeued
   }
 
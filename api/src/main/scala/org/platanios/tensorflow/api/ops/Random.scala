@@ -37,6 +37,9 @@ private[api] trait Random {
     *                  Defaults to `1`.
     * @param  seed     Optional random seed, used to generate a random seed pair for the random number generator, when
     *                  combined with the graph-level seed.
+    * @param  parallel If `true`, the values are generated by the parallel counter-based kernel, which splits the output
+    *                  into fixed-size chunks that are filled concurrently. Only supported for [[FLOAT32]] and
+    *                  [[FLOAT64]].
     * @param  name     Name for the created op.
     * @return Created op output.
     * @throws IllegalArgumentException If `dataType` has an unsupported value.
@@ -44,10 +47,12 @@ private[api] trait Random {
   @throws[IllegalArgumentException]
   def randomUniform(
       dataType: DataType = FLOAT32, shape: Output = Shape.scalar(), minValue: Output = 0.0, maxValue: Output = 1.0,
-      seed: Option[Int] = None, name: String = "RandomUniform"): Output = {
+      seed: Option[Int] = None, parallel: Boolean = false, name: String = "RandomUniform"): Output = {
     if (!Set[DataType](FLOAT16, FLOAT32, FLOAT64, INT32, INT64).contains(dataType))
       throw new IllegalArgumentException(
         s"'dataType' ($dataType) must be one of: FLOAT16, FLOAT32, FLOAT64, INT32, or INT64.")
+    if (parallel && dataType != FLOAT32 && dataType != FLOAT64)
+      throw new IllegalArgumentException(s"'dataType' ($dataType) must be FLOAT32 or FLOAT64 when 'parallel' is set.")
     Op.createWithNameScope(name, Set(shape.op, minValue.op, maxValue.op)) {
       val castedMinValue = Math.cast(minValue, dataType)
       val castedMaxValue = Math.cast(maxValue, dataType)
@@ -60,6 +65,14 @@ private[api] trait Random {
             .setAttribute("seed", graphSeed.getOrElse(0))
             .setAttribute("seed2", opSeed.getOrElse(0))
             .build().outputs(0)
+      } else if (parallel) {
+        Op.Builder(opType = "ParallelRandomUniform", name = name)
+            .addInput(shape)
+            .addInput(castedMinValue)
+            .addInput(castedMaxValue)
+            .setAttribute("seed", graphSeed.getOrElse(0))
+            .setAttribute("seed2", opSeed.getOrElse(0))
+            .build().outputs(0)
       } else {
         val random = Op.Builder(opType = "RandomUniform", name = name)
             .addInput(shape)
@@ -72,6 +85,15 @@ private[api] trait Random {
     }
   }
 
+  /** $OpDocRandomRandomNormal
+    *
+    * @group RandomOps
+    * @param  dataType          Data type for the output tensor. Must be one of: [[FLOAT16]], [[FLOAT32]], or
+    *                           [[FLOAT64]].
+    * @param  shape             Rank-1 tensor containing the shape of the output tensor. Defaults to a scalar tensor.
+    * @param  mean              Scalar tensor containing the mean of the Normal distribution. Defaults to `0`.
+    * @param  standardDeviation Scalar tensor containing the standard deviation of the Normal distribution. Defaults to
+    *                           `1`.
   /** $OpDocRandomRandomNormal
     *
     * @group RandomOps
@@ -83,6 +105,9 @@ private[api] trait Random {
     *                           `1`.
     * @param  seed              Optional random seed, used to generate a random seed pair for the random number
     *                           generator, when combined with the graph-level seed.
+    * @param  parallel          If `true`, the values are generated by the parallel counter-based kernel, which splits
+    *                           the output into fixed-size chunks that are filled concurrently. Only supported for
+    *                           [[FLOAT32]] and [[FLOAT64]].
     * @param  name              Name for the created op.
     * @return Created op output.
     * @throws IllegalArgumentException If `dataType` has an unsupported value.
@@ -90,20 +115,82 @@ private[api] trait Random {
   @throws[IllegalArgumentException]
   def randomNormal(
       dataType: DataType = FLOAT32, shape: Output = Shape.scalar(), mean: Output = 0.0, standardDeviation: Output = 1.0,
-      seed: Option[Int] = None, name: String = "RandomNormal"): Output = {
+      seed: Option[Int] = None, parallel: Boolean = false, name: String = "RandomNormal"): Output = {
+    if (dataType != FLOAT16 && dataType != FLOAT32 && dataType != FLOAT64)
+      throw new IllegalArgumentException(s"'dataType' ($dataType) must be one of: FLOAT16, FLOAT32, or FLOAT64.")
+    if (parallel && dataType != FLOAT32 && dataType != FLOAT64)
+      throw new IllegalArgumentException(s"'dataType' ($dataType) must be FLOAT32 or FLOAT64 when 'parallel' is set.")
+    Op.createWithNameScope(name, Set(shape.op, mean.op, standardDeviation.op)) {
+      val castedMean = Math.cast(mean, dataType)
+      val castedStandardDeviation = Math.cast(standardDeviation, dataType)
+      val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
+      if (parallel) {
+        Op.Builder(opType = "ParallelRandomNormal", name = name)
+            .addInput(shape)
+            .addInput(castedMean)
+            .addInput(castedStandardDeviation)
+            .setAttribute("seed", graphSeed.getOrElse(0))
+            .setAttribute("seed2", opSeed.getOrElse(0))
+            .build().outputs(0)
+      } else {
+        val random = Op.Builder(opType = "RandomStandardNormal", name = name)
+            .addInput(shape)
+            .setAttribute("dtype", dataType)
+            .setAttribute("seed", graphSeed.getOrElse(0))
+            .setAttribute("seed2", opSeed.getOrElse(0))
+            .build().outputs(0)
+        Math.add(random * castedStandardDeviation, castedMean)
+      }
+    }
+  }
+
+  /** $OpDocRandomRandomTruncatedNormal
+    *
+    * @group RandomOps
+    * @param  dataType          Data type for the output tensor. Must be one of: [[FLOAT16]], [[FLOAT32]], or
+    *                           [[FLOAT64]].
+    * @param  shape             Rank-1 tensor containing the shape of the output tensor. Defaults to a scalar tensor.
+    * @param  mean              Scalar tensor containing the mean of the Normal distribution. Defaults to `0`.
+    * @param  standardDeviation Scalar tensor containing the standard deviation of the Normal distribution. Defaults to
+    *                           `1`.
+    * @param  seed              Optional random seed, used to generate a random seed pair for the random number
+    *                           generator, when combined with the graph-level seed.
+    * @param  parallel          If `true`, the values are generated by the parallel counter-based kernel, which splits
+    *                           the output into fixed-size chunks that are filled concurrently. Only supported for
+    *                           [[FLOAT32]] and [[FLOAT64]].
+    * @param  name              Name for the created op.
+    * @return Created op output.
+    * @throws IllegalArgumentException If `dataType` has an unsupported value.
+    */
+  @throws[IllegalArgumentException]
+  def randomTruncatedNormal(
+      dataType: DataType = FLOAT32, shape: Output = Shape.scalar(), mean: Output = 0.0, standardDeviation: Output = 1.0,
+      seed: Option[Int] = None, parallel: Boolean = false, name: String = "RandomTruncatedNormal"): Output = {
     if (dataType != FLOAT16 && dataType != FLOAT32 && dataType != FLOAT64)
       throw new IllegalArgumentException(s"'dataType' ($dataType) must be one of: FLOAT16, FLOAT32, or FLOAT64.")
+    if (parallel && dataType != FLOAT32 && dataType != FLOAT64)
+      throw new IllegalArgumentException(s"'dataType' ($dataType) must be FLOAT32 or FLOAT64 when 'parallel' is set.")
     Op.createWithNameScope(name, Set(shape.op, mean.op, standardDeviation.op)) {
       val castedMean = Math.cast(mean, dataType)
       val castedStandardDeviation = Math.cast(standardDeviation, dataType)
       val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
-      val random = Op.Builder(opType = "RandomStandardNormal", name = name)
-          .addInput(shape)
-          .setAttribute("dtype", dataType)
-          .setAttribute("seed", graphSeed.getOrElse(0))
-          .setAttribute("seed2", opSeed.getOrElse(0))
-          .build().outputs(0)
-      Math.add(random * castedStandardDeviation, castedMean)
+      if (parallel) {
+        Op.Builder(opType = "ParallelTruncatedNormal", name = name)
+            .addInput(shape)
+            .addInput(castedMean)
+            .addInput(castedStandardDeviation)
+            .setAttribute("seed", graphSeed.getOrElse(0))
+            .setAttribute("seed2", opSeed.getOrElse(0))
+            .build().outputs(0)
+      } else {
+        val random = Op.Builder(opType = "TruncatedNormal", name = name)
+            .addInput(shape)
+            .setAttribute("dtype", dataType)
+            .setAttribute("seed", graphSeed.getOrElse(0))
+            .setAttribute("seed2", opSeed.getOrElse(0))
+            .build().outputs(0)
+        Math.add(random * castedStandardDeviation, castedMean)
+      }
     }
   }
 }
@@ -113,6 +200,10 @@ private[api] object Random extends Random {
     GradientsRegistry.registerNonDifferentiable("RandomUniform")
     GradientsRegistry.registerNonDifferentiable("RandomUniformInt")
     GradientsRegistry.registerNonDifferentiable("RandomStandardNormal")
+    GradientsRegistry.registerNonDifferentiable("TruncatedNormal")
+    GradientsRegistry.registerNonDifferentiable("ParallelRandomUniform")
+    GradientsRegistry.registerNonDifferentiable("ParallelRandomNormal")
+    GradientsRegistry.registerNonDifferentiable("ParallelTruncatedNormal")
   }
 
   /** @define OpDocRandomRandomUniform
@@ -129,6 +220,13 @@ private[api] object Random extends Random {
     *   The `randomUniform` op outputs random values drawn from a Normal distribution.
     *
     *   The generated values follow a Normal distribution with mean `mean` and standard deviation `standardDeviation`.
+    *
+    * @define OpDocRandomRandomTruncatedNormal
+    *   The `randomTruncatedNormal` op outputs random values drawn from a truncated Normal distribution.
+    *
+    *   The generated values follow a Normal distribution with mean `mean` and standard deviation `standardDeviation`,
+    *   except that values whose magnitude is more than two standard deviations from the mean are dropped and
+    *   re-picked.
     */
   private[ops] trait Documentation
 }
@@ -126,6 +126,7 @@ private[api] object Sets extends Sets {
   private[ops] object Gradients {
     GradientsRegistry.registerNonDifferentiable("SetSize")
     GradientsRegistry.registerNonDifferentiable("DenseToDenseSetOperation")
+    GradientsRegistry.registerNonDifferentiable("SortedDenseToDenseSetOperation")
     GradientsRegistry.registerNonDifferentiable("DenseToSparseSetOperation")
     GradientsRegistry.registerNonDifferentiable("SparseToSparseSetOperation")
   }
@@ -147,7 +148,9 @@ private[api] object Sets extends Sets {
     *     - `(a: Output, b: SparseOutput)`
     *     - `(a: Output, b: Output)`
     *
-    *   For sparse tensors, the indices must be sorted in row-major order.
+    *   For sparse tensors, the indices must be sorted in row-major order. For two dense [[INT32]] or [[INT64]] tensors,
+    *   the op uses a merge-based kernel that processes rows in parallel and is fastest when the rows are already
+    *   sorted.
     *
     *   For example:
     *   {{{
@@ -302,7 +305,14 @@ object SetOps {
     @inline override def dataTypeB(b: Output): DataType = b.dataType
     @inline override def applyOperation(
         a: Output, b: Output, operation: String, validateIndices: Boolean, name: String): SparseOutput = {
-      val result = Op.Builder("DenseToDenseSetOperation", name)
+      // Integer sets are processed using the merge-based kernel, which avoids building a set for each row.
+      val opType = {
+        if ((a.dataType == INT32 || a.dataType == INT64) && a.dataType == b.dataType)
+          "SortedDenseToDenseSetOperation"
+        else
+          "DenseToDenseSetOperation"
+      }
+      val result = Op.Builder(opType, name)
           .addInput(a)
           .addInput(b)
           .setAttribute("set_operation", operation)
@@ -15,6 +15,9 @@
 
 package org.platanios.tensorflow.api.ops
 
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
+import org.platanios.tensorflow.api.types.INT64
+
 /** Contains functions for constructing ops related to sparse tensors.
   *
   * @author Emmanouil Antonios Platanios
@@ -58,9 +61,81 @@ private[api] trait Sparse {
         .addInput(y)
         .build().outputs(0)
   }
+
+  /** $OpDocSparseSparseToCSR
+    *
+    * @group SparseOps
+    * @param  input Rank-2 sparse tensor.
+    * @param  name  Name for the created op.
+    * @return Sparse tensor in CSR format.
+    */
+  def sparseToCSR(input: SparseOutput, name: String = "SparseTensorToCSR"): CSRSparseOutput = {
+    Op.createWithNameScope(name, Set(input.indices.op, input.values.op, input.denseShape.op)) {
+      val denseShape = Math.cast(input.denseShape, INT64)
+      val result = Op.Builder("SparseTensorToCSR", name)
+          .addInput(Math.cast(input.indices, INT64))
+          .addInput(input.values)
+          .addInput(denseShape)
+          .build().outputs
+      CSRSparseOutput(result(0), result(1), result(2), denseShape)
+    }
+  }
+
+  /** $OpDocSparseCSRSparseDenseMatMul
+    *
+    * @group SparseOps
+    * @param  a        Sparse matrix in CSR format.
+    * @param  b        Dense matrix with the same data type as `a`.
+    * @param  adjointA If `true`, `a` is transposed before the multiplication.
+    * @param  name     Name for the created op.
+    * @return Created op output.
+    */
+  def csrSparseDenseMatMul(
+      a: CSRSparseOutput, b: Output, adjointA: Boolean = false, name: String = "CSRSparseDenseMatMul"): Output = {
+    Op.Builder("CSRSparseDenseMatMul", name)
+        .addInput(a.rowPointers)
+        .addInput(a.columnIndices)
+        .addInput(a.values)
+        .addInput(a.denseShape)
+        .addInput(b)
+        .setAttribute("adjoint_a", adjointA)
+        .build().outputs(0)
+  }
+
+  /** $OpDocSparseIndexedSlicesUniqueSum
+    *
+    * @group SparseOps
+    * @param  input Indexed slices with potentially duplicate indices (the values must have data type [[FLOAT16]],
+    *               [[FLOAT32]], or [[FLOAT64]]).
+    * @param  name  Name for the created op.
+    * @return Indexed slices with unique indices, in ascending order, and the sums of the slices of each index.
+    */
+  def indexedSlicesUniqueSum(
+      input: OutputIndexedSlices, name: String = "IndexedSlicesUniqueSum"): OutputIndexedSlices = {
+    val result = Op.Builder("IndexedSlicesUniqueSum", name)
+        .addInput(input.indices)
+        .addInput(input.values)
+        .build().outputs
+    OutputIndexedSlices(indices = result(0), values = result(1), denseShape = input.denseShape)
+  }
 }
 
 private[api] object Sparse extends Sparse {
+  private[ops] object Gradients {
+    GradientsRegistry.registerNonDifferentiable("SparseTensorToCSR")
+    GradientsRegistry.registerNonDifferentiable("IndexedSlicesUniqueSum")
+    GradientsRegistry.register("CSRSparseDenseMatMul", csrSparseDenseMatMulGradient)
+
+    /** Only the gradient with respect to the dense matrix is computed. It is obtained by multiplying the adjoint of
+      * the sparse matrix with the output gradient, which reuses the same kernel. */
+    private[this] def csrSparseDenseMatMulGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
+      val a = CSRSparseOutput(op.inputs(0), op.inputs(1), op.inputs(2), op.inputs(3))
+      val adjointA = op.booleanAttribute("adjoint_a")
+      val outputGradient = outputGradients.head.toOutput
+      Seq(null, null, null, null, csrSparseDenseMatMul(a, outputGradient, adjointA = !adjointA))
+    }
+  }
+
   private[ops] trait Implicits {
     implicit def sparseOutputToNNOps(value: SparseOutput): SparseOps = SparseOps(value)
   }
@@ -110,6 +185,27 @@ private[api] object Sparse extends Sparse {
     *
     *   The input sparse tensor's indices are not required to be ordered in any particular way.
     *
+    * @define OpDocSparseSparseToCSR
+    *   The `sparseToCSR` op converts a rank-2 sparse tensor from the coordinate (COO) format to the compressed sparse
+    *   row (CSR) format.
+    *
+    *   The entries of each row keep their relative order. The input indices are not required to be ordered, but if
+    *   they are ordered lexicographically, then the column indices within each row of the result are ordered as well.
+    *
+    * @define OpDocSparseCSRSparseDenseMatMul
+    *   The `csrSparseDenseMatMul` op multiplies a rank-2 sparse tensor in CSR format with a dense matrix.
+    *
+    *   The rows of the result are computed in parallel, each one as a sum of rows of the dense matrix scaled by the
+    *   non-zero entries of the corresponding row of the sparse matrix. This avoids the scattered writes of
+    *   multiplications in the coordinate format. The gradient is only computed with respect to the dense matrix.
+    *
+    * @define OpDocSparseIndexedSlicesUniqueSum
+    *   The `indexedSlicesUniqueSum` op sums the slices of indexed slices that correspond to the same index.
+    *
+    *   It is equivalent to a `unique` op over the indices, followed by an `unsortedSegmentSum` op over the values, but
+    *   it uses a single kernel. Small inputs are grouped by sorting their indices, and larger ones using a hash table.
+    *   The slices of each unique index are then summed in parallel. On GPU devices, all tensors are kept in host
+    *   memory. The op is not differentiable.
     */
   private[ops] trait Documentation
 }
@@ -16,7 +16,9 @@
 package org.platanios.tensorflow.api.ops
 
 import org.platanios.tensorflow.api.Implicits._
-import org.platanios.tensorflow.api.types.{FLOAT16, FLOAT32}
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
+import org.platanios.tensorflow.api.types.{FLOAT16, FLOAT32, FLOAT64}
 
 /** Contains functions for constructing ops related to statistics.
   *
@@ -105,15 +107,35 @@ private[api] trait Statistics {
         // workaround we simply perform the operations on 32-bit floats before converting the mean and variance back to
         // FLOAT16.
         val preciseInput = if (input.dataType == FLOAT16) Math.cast(input, FLOAT32) else input
-        // Compute true mean while keeping the dimensions for proper broadcasting.
-        var mean = Math.mean(preciseInput, axes = dynamicAxes, keepDims = true, name = "Mean")
-        // Compute the sample variance (i.e., not an unbiased variance estimate).
-        var variance = Math.mean(
-          Math.squaredDifference(preciseInput, Basic.stopGradient(input)),
-          axes = dynamicAxes, keepDims = true, name = "Variance")
-        if (!keepDims) {
-          mean = Basic.squeeze(mean, axes)
-          variance = Basic.squeeze(variance, axes)
+        val reducedAxes = axes.map(a => if (a < 0) a + input.rank else a).distinct.sorted
+        var (mean, variance) = {
+          if ((preciseInput.dataType == FLOAT32 || preciseInput.dataType == FLOAT64) && input.rank > 0 &&
+              reducedAxes == (0 until reducedAxes.size) && preciseInput.shape(reducedAxes.size ::).isFullyDefined) {
+            // When reducing over leading axes, the input can be viewed as a matrix whose columns are reduced using the
+            // single-pass kernel.
+            val trailingShape = preciseInput.shape(reducedAxes.size ::)
+            val matrix = Basic.reshape(preciseInput, Shape(-1, trailingShape.numElements.toInt))
+            val (mean, variance) = welfordMoments(matrix)
+            val outputShape = {
+              if (keepDims)
+                Shape(Array.fill(reducedAxes.size)(1) ++ trailingShape.asArray)
+              else
+                trailingShape
+            }
+            (Basic.reshape(mean, outputShape, name = "Mean"), Basic.reshape(variance, outputShape, name = "Variance"))
+          } else {
+            // Compute true mean while keeping the dimensions for proper broadcasting.
+            var mean = Math.mean(preciseInput, axes = dynamicAxes, keepDims = true, name = "Mean")
+            // Compute the sample variance (i.e., not an unbiased variance estimate).
+            var variance = Math.mean(
+              Math.squaredDifference(preciseInput, Basic.stopGradient(input)),
+              axes = dynamicAxes, keepDims = true, name = "Variance")
+            if (!keepDims) {
+              mean = Basic.squeeze(mean, axes)
+              variance = Basic.squeeze(variance, axes)
+            }
+            (mean, variance)
+          }
         }
         // Cast back to FLOAT16 if necessary.
         if (input.dataType == FLOAT16)
@@ -157,9 +179,38 @@ private[api] trait Statistics {
       }
     }
   }
+
+  /** $OpDocStatisticsWelfordMoments
+    *
+    * @group StatisticsOps
+    * @param  input Two-dimensional [[FLOAT32]] or [[FLOAT64]] input tensor.
+    * @param  name  Name for the created op.
+    * @return Tuple containing the created op outputs: (i) the mean of each column of `input`, and (ii) the variance of
+    *         each column of `input`.
+    */
+  def welfordMoments(input: Output, name: String = "WelfordMoments"): (Output, Output) = {
+    val outputs = Op.Builder(opType = "WelfordMoments", name = name)
+        .addInput(input)
+        .build().outputs
+    (outputs(0), outputs(1))
+  }
 }
 
 private[api] object Statistics extends Statistics {
+  private[ops] object Gradients {
+    GradientsRegistry.register("WelfordMoments", welfordMomentsGradient)
+
+    private[this] def welfordMomentsGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
+      val input = op.inputs(0)
+      val meanGradient = outputGradients(0).toOutput
+      val varianceGradient = outputGradients(1).toOutput
+      val count = Math.cast(Basic.shape(input)(0), input.dataType)
+      val centered = input - op.outputs(0)
+      val two = Basic.constant(2, input.dataType)
+      Seq((meanGradient + two * varianceGradient * centered) / count)
+    }
+  }
+
   private[ops] trait Implicits {
     implicit def outputToStatisticsOps(value: Output): StatisticsOps = StatisticsOps(value)
     implicit def outputConvertibleToStatisticsOps[T](value: T)(implicit f: (T) => Output): StatisticsOps = {
@@ -223,6 +274,16 @@ private[api] object Statistics extends Statistics {
     *     - for so-called "global normalization", used with convolutional filters with shape
     *       `[batch, height, width, depth]`, pass `axes = [0, 1, 2]`.
     *     - for simple batch normalization pass `axes = [0]` (batch only).
+    *
+    *   When `axes` are the leading axes of `input` and the remaining dimensions are statically known, and no weights
+    *   are provided, the moments are computed in a single pass using [[welfordMoments]].
+    *
+    * @define OpDocStatisticsWelfordMoments
+    *   The `welfordMoments` op calculates the mean and variance of each column of a matrix, in a single pass.
+    *
+    *   The op uses Welford's algorithm, which is numerically stable, over blocks of rows that are processed in
+    *   parallel and then merged. The results do not depend on the number of threads used. The variance is the sample
+    *   variance (i.e., it is not an unbiased variance estimate).
     */
   private[ops] trait Documentation
 }
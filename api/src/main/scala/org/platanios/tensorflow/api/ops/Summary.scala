@@ -80,13 +80,23 @@ private[api] trait Summary {
     * @param  collections Graph collections in which to add the new summary op. Defaults to `Graph.Keys.SUMMARIES`.
     * @param  family      If provided, used as prefix for the summary tag name, which controls the tab name used for
     *                     display on TensorBoard.
+    * @param  onDevice    If `true`, the histogram buckets are computed on the device of `values` and only the compact
+    *                     histogram (a few kilobytes) is copied to the host, instead of all of `values`. This is useful
+    *                     for large tensors that live on GPUs (e.g., weights). The resulting summary is the same.
     * @return Created op output.
     */
   def histogram(
       name: String, values: Output, collections: Set[Graph.Key[Output]] = Set(Graph.Keys.SUMMARIES),
-      family: String = null): Output = {
+      family: String = null, onDevice: Boolean = false): Output = {
     Summary.scoped((scope, tag) => {
-      val summary = Summary.histogramSummary(values, tag, scope)
+      val summary = {
+        if (onDevice) {
+          val buckets = Op.colocateWith(Set(values.op))(Summary.histogramBuckets(values))
+          Summary.histogramSummaryFromBuckets(buckets, tag, scope)
+        } else {
+          Summary.histogramSummary(values, tag, scope)
+        }
+      }
       collections.foreach(key => Op.currentGraph.addToCollection(summary, key))
       summary
     }, name, family)
@@ -323,6 +333,35 @@ private[api] object Summary extends Summary {
         .build().outputs(0)
   }
 
+  /** $OpDocSummaryHistogramBuckets
+    *
+    * @group SummaryOps
+    * @param  values Values to use to build the histogram.
+    * @param  name   Name for the created op.
+    * @return Created op output.
+    */
+  private[Summary] def histogramBuckets(values: Output, name: String = "HistogramBuckets"): Output = {
+    Op.Builder("HistogramBuckets", name)
+        .addInput(values)
+        .build().outputs(0)
+  }
+
+  /** $OpDocSummaryHistogramSummaryFromBuckets
+    *
+    * @group SummaryOps
+    * @param  histogram Compact histogram created by [[histogramBuckets]].
+    * @param  tag       Tag to use for the created summary. Used for organizing summaries in TensorBoard.
+    * @param  name      Name for the created op.
+    * @return Created op output.
+    */
+  private[Summary] def histogramSummaryFromBuckets(
+      histogram: Output, tag: Output, name: String = "HistogramSummaryFromBuckets"): Output = {
+    Op.Builder("HistogramSummaryFromBuckets", name)
+        .addInput(tag)
+        .addInput(histogram)
+        .build().outputs(0)
+  }
+
   /** $OpDocSummaryImage
     *
     * @group SummaryOps
@@ -590,6 +629,21 @@ private[api] object Summary extends Summary {
     *
     *   This op will throw an [[IllegalArgumentException]] if any of the provided values is not finite.
     *
+    * @define OpDocSummaryHistogramBuckets
+    *   The `histogramBuckets` op computes a compact histogram of the provided values, on their device.
+    *
+    *   The histogram uses the bucket limits of the default TensorFlow histograms and is computed in a single pass over
+    *   the values. It is a vector containing the minimum, the maximum, the number, the sum, the sum of squares, and the
+    *   number of non-finite values (which are not included in the other statistics), followed by the count of each
+    *   bucket, and so its size does not depend on the number of values.
+    *
+    * @define OpDocSummaryHistogramSummaryFromBuckets
+    *   The `histogramSummaryFromBuckets` op outputs a `Summary` protocol buffer containing a histogram, given a compact
+    *   histogram computed by the `histogramBuckets` op.
+    *
+    *   The generated summary is the same as the one generated by the `histogramSummary` op for the values of the
+    *   compact histogram. This op will throw an [[IllegalArgumentException]] if any of these values is not finite.
+    *
     * @define OpDocSummaryImageSummary
     *   The `imageSummary` op outputs a `Summary` protocol buffer containing images.
     *
@@ -15,6 +15,7 @@
 
 package org.platanios.tensorflow.api.ops
 
+import org.platanios.tensorflow.api.Implicits._
 import org.platanios.tensorflow.api.core.Shape
 import org.platanios.tensorflow.api.core.exception.{InvalidArgumentException, InvalidShapeException}
 import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
@@ -41,12 +42,15 @@ import org.platanios.tensorflow.api.types.{DataType, INT64}
   *                                `unstack`, and `split`). If `false`, the tensor array will be placed on the device
   *                                determined by the op creation context available during its initialization.
   * @param  colocationOps          Used to keep track of what ops the tensor array should be colocated with.
+  * @param  contiguous             Boolean value indicating whether the tensor array elements are stored in a single
+  *                                contiguous buffer (see [[TensorArray.create]] for details).
   *
   * @author Emmanouil Antonios Platanios
   */
 private[api] case class TensorArray private (
     handle: Output, flow: Output, dataType: DataType, inferShape: Boolean, private var elementShape: Option[Shape],
-    colocateWithFirstWrite: Boolean = true, private var colocationOps: List[Op] = null) {
+    colocateWithFirstWrite: Boolean = true, private var colocationOps: List[Op] = null,
+    contiguous: Boolean = false) {
   /** Changes the element shape of the array given a shape to merge with.
     *
     * @param  shape Shape to merge with.
@@ -69,7 +73,9 @@ private[api] case class TensorArray private (
     *         control dependencies for writes, reads, etc. Use this object for all subsequent operations.
     */
   private[api] def identity: TensorArray = {
-    TensorArray(handle, Basic.identity(flow), dataType, inferShape, elementShape, colocateWithFirstWrite, colocationOps)
+    TensorArray(
+      handle, Basic.identity(flow), dataType, inferShape, elementShape, colocateWithFirstWrite, colocationOps,
+      contiguous)
   }
 
   /** Creates an op that reads an element from this tensor array.
@@ -80,7 +86,7 @@ private[api] case class TensorArray private (
     */
   private[api] def read(index: Output, name: String = "TensorArrayRead"): Output = {
     Op.createWith(colocationOps = Set(handle.op)) {
-      val value = TensorArray.readOp(handle, index, flow, dataType, name)
+      val value = TensorArray.readOp(handle, index, flow, dataType, contiguous, name)
       elementShape.foreach(value.setShape)
       value
     }
@@ -94,9 +100,9 @@ private[api] case class TensorArray private (
     * @return Output flow of the tensor array, used to enforce proper chaining of operations.
     */
   private[api] def write(index: Output, value: Output, name: String = "TensorArrayWrite"): TensorArray = {
-    val writeFlow = maybeColocateWith(value.op)(TensorArray.writeOp(handle, index, value, flow, name))
+    val writeFlow = maybeColocateWith(value.op)(TensorArray.writeOp(handle, index, value, flow, contiguous, name))
     val returnValue = TensorArray(
-      handle, writeFlow, dataType, inferShape, elementShape, colocateWithFirstWrite, colocationOps)
+      handle, writeFlow, dataType, inferShape, elementShape, colocateWithFirstWrite, colocationOps, contiguous)
     if (inferShape)
       returnValue.mergeElementShape(value.shape)
     returnValue
@@ -114,7 +120,8 @@ private[api] case class TensorArray private (
   private[api] def gather(indices: Output, name: String = "TensorArrayGather"): Output = {
     Op.createWith(colocationOps = Set(handle.op)) {
       val ind = if (indices.rank == 0) indices.expandDims(0) else indices
-      val value = TensorArray.gatherOp(handle, ind, flow, dataType, elementShape.getOrElse(Shape.unknown()), name)
+      val value = TensorArray.gatherOp(
+        handle, ind, flow, dataType, elementShape.getOrElse(Shape.unknown()), contiguous, name)
       if (elementShape.isDefined)
         value.setShape(Shape(-1 +: elementShape.get.asArray: _*))
       value
@@ -133,10 +140,10 @@ private[api] case class TensorArray private (
     */
   private[api] def scatter(indices: Output, value: Output, name: String = "TensorArrayScatter"): TensorArray = {
     val scatterFlow = maybeColocateWith(value.op) {
-      TensorArray.scatterOp(handle, indices, value, flow, name)
+      TensorArray.scatterOp(handle, indices, value, flow, contiguous, name)
     }
     val returnValue = TensorArray(
-      handle, scatterFlow, dataType, inferShape, elementShape, colocateWithFirstWrite, colocationOps)
+      handle, scatterFlow, dataType, inferShape, elementShape, colocateWithFirstWrite, colocationOps, contiguous)
     if (this.inferShape) {
       val valueShape = scatterFlow.inputs(2).shape
       val shape = if (valueShape != Shape.unknown()) Shape.fromSeq(valueShape.asArray.tail) else valueShape
@@ -147,7 +154,8 @@ private[api] case class TensorArray private (
 
   /** Creates an op that returns the elements in this tensor array as a stacked tensor.
     *
-    * Note that all elements of this tensor array must have been written and must have the same shape.
+    * Note that all elements of this tensor array must have been written and must have the same shape. For contiguous
+    * tensor arrays, the stacked tensor shares the buffer of the tensor array and nothing is copied.
     *
     * If the elements have rank `R`, then the returned tensor shape will be equal to `R + 1`.
     *
@@ -181,14 +189,25 @@ private[api] case class TensorArray private (
     * The op takes `T` elements with shapes `[n0, d0, d1, ...]`, `[n1, d0, d1, ...]`, ..., `[n(T-1), d0, d1, ...]` and
     * concatenates them into a tensor with shape `[n0 + n1 + ... + n(T-1), d0, d1, ...]`.
     *
-    * All elements must have been written and must have the same shape, except for their first dimension.
+    * All elements must have been written and must have the same shape, except for their first dimension. For
+    * contiguous tensor arrays, all elements have the same shape, and so the concatenated tensor is a reshaped stacked
+    * tensor.
     *
     * @param  name Name for the created op.
     * @return Tensor with all of the elements in the tensor array, concatenated along the first axis.
     */
   private[api] def concatenate(name: String = "TensorArrayConcatenate"): Output = {
     val shape = elementShape.map(s => Shape.fromSeq(s.asArray.tail)).getOrElse(Shape.unknown())
-    val (value, _) = TensorArray.concatenateOp(handle, flow, dataType, shape, name)
+    val value = {
+      if (contiguous) {
+        Op.createWithNameScope(name, Set(handle.op)) {
+          val stacked = stack()
+          stacked.reshape(Basic.concatenate(Seq(Basic.constant(-1, shape = Shape(1)), Basic.shape(stacked)(2 ::))))
+        }
+      } else {
+        TensorArray.concatenateOp(handle, flow, dataType, shape, name)._1
+      }
+    }
     if (elementShape.isDefined)
       value.setShape(Shape(-1 +: shape.asArray: _*))
     value
@@ -200,12 +219,17 @@ private[api] case class TensorArray private (
     * @param  lengths 1-D integer tensor with the lengths to use when splitting `input` along its first dimension.
     * @param  name    Name for the created op.
     * @return Tensor array with flow that ensures the split occurs. Use this object for all subsequent operations.
+    * @throws InvalidArgumentException If this is a contiguous tensor array, whose elements must all have the same
+    *                                  shape (use `unstack` instead).
     */
+  @throws[InvalidArgumentException]
   def split(input: Output, lengths: Output, name: String = "TensorArraySplit"): TensorArray = {
+    if (contiguous)
+      throw InvalidArgumentException("Contiguous tensor arrays do not support 'split'. Use 'unstack' instead.")
     Op.createWithNameScope(name, Set(handle.op, input.op, lengths.op)) {
       val splitFlow = maybeColocateWith(input.op)(TensorArray.splitOp(handle, input, lengths.cast(INT64), flow, name))
       val returnValue = TensorArray(
-        handle, splitFlow, dataType, inferShape, elementShape, colocateWithFirstWrite, colocationOps)
+        handle, splitFlow, dataType, inferShape, elementShape, colocateWithFirstWrite, colocationOps, contiguous)
       if (inferShape) {
         val valueShape = splitFlow.inputs(1).shape
         val lengths = Output.constantValue(splitFlow.inputs(2))
@@ -228,7 +252,7 @@ private[api] case class TensorArray private (
     */
   private[api] def size(name: String = "TensorArraySize"): Output = {
     Op.createWith(colocationOps = Set(handle.op)) {
-      TensorArray.sizeOp(handle, flow, name)
+      TensorArray.sizeOp(handle, flow, contiguous, name)
     }
   }
 
@@ -276,12 +300,13 @@ private[api] case class TensorArray private (
     // creation of the gradient tensor array only once the final forward array's size is fixed.
     Op.createWithNameScope(name, Set(handle.op)) {
       Op.createWith(colocationOps = Set(handle.op)) {
-        val (gradientHandle, _) = TensorArray.gradientOp(handle, flow, source)
+        val (gradientHandle, _) = TensorArray.gradientOp(handle, flow, source, contiguous)
         val gradientFlow = Op.createWith(controlDependencies = Set(gradientHandle.op)) {
           Basic.identity(flow, name = "GradientFlow")
         }
         TensorArray(
-          gradientHandle, gradientFlow, dataType, inferShape, elementShape, colocateWithFirstWrite = false)
+          gradientHandle, gradientFlow, dataType, inferShape, elementShape, colocateWithFirstWrite = false,
+          contiguous = contiguous)
       }
     }
   }
@@ -295,7 +320,7 @@ private[api] case class TensorArray private (
     */
   private[api] def close(name: String = "TensorArrayClose"): Op = {
     Op.createWith(colocationOps = Set(handle.op)) {
-      TensorArray.closeOp(handle, name)
+      TensorArray.closeOp(handle, contiguous, name)
     }
   }
 
@@ -335,13 +360,38 @@ private[api] object TensorArray {
     *                                the tensor used on its first write call (write operations include `write`,
     *                                `unstack`, and `split`). If `false`, the tensor array will be placed on the device
     *                                determined by the op creation context available during its initialization.
+    * @param  contiguous             Boolean value indicating whether to store all elements in a single contiguous
+    *                                buffer with shape `[size, elementShape...]`, instead of in separate tensors. This
+    *                                requires that the size is fixed and that all elements have the same shape, but not
+    *                                that this shape is known statically (the buffer is then allocated on the first
+    *                                write). Writes copy their value into the buffer, while `read`, `gather`, and
+    *                                `stack` return slices of the buffer without copying it (e.g., stacking the
+    *                                per-step outputs of a dynamic RNN is free), and unstacking a tensor into an empty
+    *                                array shares its buffer. Elements of contiguous tensor arrays cannot be written
+    *                                after they have been read, `clearAfterRead` is ignored, `split` is not supported,
+    *                                and only numeric data types are supported.
     * @param  name                   Name for the created tensor array ops.
     * @return Created tensor array.
+    * @throws InvalidArgumentException If `contiguous` is `true` and `dynamicSize` is also `true` or `dataType` is not
+    *                                  numeric.
     */
+  @throws[InvalidArgumentException]
   private[api] def create(
       size: Output, dataType: DataType, dynamicSize: Boolean = false, clearAfterRead: Boolean = true,
       tensorArrayName: String = "", inferShape: Boolean = true, elementShape: Shape = Shape.unknown(),
-      colocateWithFirstWrite: Boolean = true, name: String = "TensorArray"): TensorArray = {
+      colocateWithFirstWrite: Boolean = true, contiguous: Boolean = false,
+      name: String = "TensorArray"): TensorArray = {
+    if (contiguous && dynamicSize)
+      throw InvalidArgumentException("Contiguous tensor arrays cannot have a dynamic size.")
+    if (contiguous && !supportsContiguous(dataType))
+      throw InvalidArgumentException(s"Contiguous tensor arrays do not support the '$dataType' data type.")
+    def createOp(): (Output, Output) = {
+      if (contiguous)
+        TensorArray.createContiguousOp(size, dataType, elementShape, tensorArrayName, name)
+      else
+        TensorArray.createOp(size, dataType, elementShape, dynamicSize, clearAfterRead, tensorArrayName, name)
+    }
+
     // We construct the tensor array with an empty device. The first write into the tensor array from a tensor with a
     // set device will retroactively set the device value of this op.
     val (handle, flow) = {
@@ -349,19 +399,22 @@ private[api] object TensorArray {
         Op.createWith(device = null) {
           Op.colocateWith(Set.empty[Op], ignoreExisting = true) {
             Op.createWithNameScope(nameScope = name, Set(size.op)) {
-              TensorArray.createOp(size, dataType, elementShape, dynamicSize, clearAfterRead, tensorArrayName, name)
+              createOp()
             }
           }
         }
       } else {
         Op.createWithNameScope(nameScope = name, Set(size.op)) {
-          TensorArray.createOp(size, dataType, elementShape, dynamicSize, clearAfterRead, tensorArrayName, name)
+          createOp()
         }
       }
     }
-    createFromHandle(handle, flow, dataType, inferShape, elementShape, colocateWithFirstWrite)
+    createFromHandle(handle, flow, dataType, inferShape, elementShape, colocateWithFirstWrite, contiguous)
   }
 
+  /** Returns `true` if contiguous tensor arrays (see [[create]]) support elements with data type `dataType`. */
+  private[api] def supportsContiguous(dataType: DataType): Boolean = dataType.isNumeric && !dataType.isQuantized
+
   /** Creates a tensor array from an existing tensor array handle.
     *
     * @param  handle                 Tensor handle to the tensor array.
@@ -375,11 +428,13 @@ private[api] object TensorArray {
     *                                the tensor used on its first write call (write operations include `write`,
     *                                `unstack`, and `split`). If `false`, the tensor array will be placed on the device
     *                                determined by the op creation context available during its initialization.
+    * @param  contiguous             Boolean value indicating whether `handle` is a handle to a contiguous tensor array.
     * @return Created tensor array.
     */
   private[api] def createFromHandle(
       handle: Output, flow: Output, dataType: DataType, inferShape: Boolean = true,
-      elementShape: Shape = Shape.unknown(), colocateWithFirstWrite: Boolean = true): TensorArray = {
+      elementShape: Shape = Shape.unknown(), colocateWithFirstWrite: Boolean = true,
+      contiguous: Boolean = false): TensorArray = {
     // Record the current static shape for the array elements. The element shape is defined either by `elementShape` or
     // the shape of the tensor of the first write. If `inferShape` is `true`, then all writes check for shape equality.
     TensorArray(
@@ -388,7 +443,8 @@ private[api] object TensorArray {
       dataType = dataType,
       inferShape = inferShape || elementShape.rank != -1,
       elementShape = if (elementShape.rank == -1) None else Some(elementShape),
-      colocateWithFirstWrite = colocateWithFirstWrite)
+      colocateWithFirstWrite = colocateWithFirstWrite,
+      contiguous = contiguous)
   }
 
   /** Creates an op that constructs a tensor array with the provided shape.
@@ -422,17 +478,44 @@ private[api] object TensorArray {
     (outputs(0), outputs(1))
   }
 
+  /** Creates an op that constructs a contiguous tensor array, whose elements are stored in a single buffer.
+    *
+    * @param  size            Size of the tensor array.
+    * @param  dataType        Data type of the elements in the tensor array.
+    * @param  elementShape    Expected shape of the elements in the tensor array, if known. If it is fully defined, then
+    *                         the buffer is allocated when the tensor array is first used, and otherwise, on its first
+    *                         write.
+    * @param  tensorArrayName Overrides the name used for the temporary tensor array resource. If not provided or if an
+    *                         empty string is provided, then the name of the created op is used, which is guaranteed to
+    *                         be unique.
+    * @param  name            Name for the created op.
+    * @return Tuple containing the resource handle to the tensor array and a scalar used to control gradient flow.
+    */
+  private[TensorArray] def createContiguousOp(
+      size: Output, dataType: DataType, elementShape: Shape = Shape.unknown(), tensorArrayName: String = "",
+      name: String = "TensorArray"): (Output, Output) = {
+    val outputs = Op.Builder(opType = "ContiguousTensorArray", name = name)
+        .addInput(size)
+        .setAttribute("dtype", dataType)
+        .setAttribute("element_shape", elementShape)
+        .setAttribute("tensor_array_name", tensorArrayName)
+        .build().outputs
+    (outputs(0), outputs(1))
+  }
+
   /** Creates an op that reads an element from the provided tensor array.
     *
-    * @param  handle Tensor array handle.
-    * @param  index  Position to read from, inside the tensor array.
-    * @param  flow   Input flow of the tensor array, used to enforce proper chaining of operations.
-    * @param  name   Name for the created op.
+    * @param  handle     Tensor array handle.
+    * @param  index      Position to read from, inside the tensor array.
+    * @param  flow       Input flow of the tensor array, used to enforce proper chaining of operations.
+    * @param  contiguous Boolean value indicating whether `handle` is a handle to a contiguous tensor array.
+    * @param  name       Name for the created op.
     * @return Tensor in the specified position of the tensor array.
     */
   private[TensorArray] def readOp(
-      handle: Output, index: Output, flow: Output, dataType: DataType, name: String = "TensorArrayRead"): Output = {
-    Op.Builder(opType = "TensorArrayReadV3", name = name)
+      handle: Output, index: Output, flow: Output, dataType: DataType, contiguous: Boolean = false,
+      name: String = "TensorArrayRead"): Output = {
+    Op.Builder(opType = if (contiguous) "ContiguousTensorArrayRead" else "TensorArrayReadV3", name = name)
         .addInput(handle)
         .addInput(index)
         .addInput(flow)
@@ -442,17 +525,18 @@ private[api] object TensorArray {
 
   /** Creates an op that writes an element to the provided tensor array.
     *
-    * @param  handle Tensor array handle.
-    * @param  index  Position to write to, inside the tensor array.
-    * @param  value  Tensor to write to the tensor array.
-    * @param  flow   Input flow of the tensor array, used to enforce proper chaining of operations.
-    * @param  name   Name for the created op.
+    * @param  handle     Tensor array handle.
+    * @param  index      Position to write to, inside the tensor array.
+    * @param  value      Tensor to write to the tensor array.
+    * @param  flow       Input flow of the tensor array, used to enforce proper chaining of operations.
+    * @param  contiguous Boolean value indicating whether `handle` is a handle to a contiguous tensor array.
+    * @param  name       Name for the created op.
     * @return Output flow of the tensor array, used to enforce proper chaining of operations.
     */
   private[TensorArray] def writeOp(
-      handle: Output, index: Output, value: Output, flow: Output,
+      handle: Output, index: Output, value: Output, flow: Output, contiguous: Boolean = false,
       name: String = "TensorArrayWrite"): Output = {
-    Op.Builder(opType = "TensorArrayWriteV3", name = name)
+    Op.Builder(opType = if (contiguous) "ContiguousTensorArrayWrite" else "TensorArrayWriteV3", name = name)
         .addInput(handle)
         .addInput(index)
         .addInput(value)
@@ -464,19 +548,20 @@ private[api] object TensorArray {
     *
     * Note that all elements selected by `indices` must have the same shape.
     *
-    * @param  handle   Tensor array handle.
-    * @param  indices  Positions in the tensor array from which to read tensor elements.
-    * @param  flow     Input flow of the tensor array, used to enforce proper chaining of operations.
-    * @param  dataType Data type of the tensor that is returned.
-    * @param  shape    Expected shape of the elements in the tensor array, if known. If this shape is not fully defined,
-    *                  then gathering zero-sized tensor array elements will cause an error.
-    * @param  name     Name for the created op.
+    * @param  handle     Tensor array handle.
+    * @param  indices    Positions in the tensor array from which to read tensor elements.
+    * @param  flow       Input flow of the tensor array, used to enforce proper chaining of operations.
+    * @param  dataType   Data type of the tensor that is returned.
+    * @param  shape      Expected shape of the elements in the tensor array, if known. If this shape is not fully
+    *                    defined, then gathering zero-sized tensor array elements will cause an error.
+    * @param  contiguous Boolean value indicating whether `handle` is a handle to a contiguous tensor array.
+    * @param  name       Name for the created op.
     * @return Tensor containing the gathered elements, concatenated along a new axis (the new dimension `0`).
     */
   private[TensorArray] def gatherOp(
       handle: Output, indices: Output, flow: Output, dataType: DataType, shape: Shape = Shape.unknown(),
-      name: String = "TensorArrayGather"): Output = {
-    Op.Builder(opType = "TensorArrayGatherV3", name = name)
+      contiguous: Boolean = false, name: String = "TensorArrayGather"): Output = {
+    Op.Builder(opType = if (contiguous) "ContiguousTensorArrayGather" else "TensorArrayGatherV3", name = name)
         .addInput(handle)
         .addInput(indices)
         .addInput(flow)
@@ -489,17 +574,18 @@ private[api] object TensorArray {
     *
     * Note that `indices` must be a vector and its length must match the first dimension of `value`.
     *
-    * @param  handle  Tensor array handle.
-    * @param  indices Positions in the tensor array at which to write the tensor elements.
-    * @param  value   Concatenated tensor to write to the tensor array.
-    * @param  flow    Input flow of the tensor array, used to enforce proper chaining of operations.
-    * @param  name    Name for the created op.
+    * @param  handle     Tensor array handle.
+    * @param  indices    Positions in the tensor array at which to write the tensor elements.
+    * @param  value      Concatenated tensor to write to the tensor array.
+    * @param  flow       Input flow of the tensor array, used to enforce proper chaining of operations.
+    * @param  contiguous Boolean value indicating whether `handle` is a handle to a contiguous tensor array.
+    * @param  name       Name for the created op.
     * @return Output flow of the tensor array, used to enforce proper chaining of operations.
     */
   private[TensorArray] def scatterOp(
-      handle: Output, indices: Output, value: Output, flow: Output,
+      handle: Output, indices: Output, value: Output, flow: Output, contiguous: Boolean = false,
       name: String = "TensorArrayScatter"): Output = {
-    Op.Builder(opType = "TensorArrayScatterV3", name = name)
+    Op.Builder(opType = if (contiguous) "ContiguousTensorArrayScatter" else "TensorArrayScatterV3", name = name)
         .addInput(handle)
         .addInput(indices)
         .addInput(value)
@@ -565,13 +651,15 @@ private[api] object TensorArray {
 
   /** Creates an op that gets the current size of the tensor array.
     *
-    * @param  handle Tensor array handle.
-    * @param  flow   Input flow of the tensor array, used to enforce proper chaining of operations.
-    * @param  name   Name for the created op.
+    * @param  handle     Tensor array handle.
+    * @param  flow       Input flow of the tensor array, used to enforce proper chaining of operations.
+    * @param  contiguous Boolean value indicating whether `handle` is a handle to a contiguous tensor array.
+    * @param  name       Name for the created op.
     * @return Created op output, containing the current size of the tensor array.
     */
-  private[TensorArray] def sizeOp(handle: Output, flow: Output, name: String = "TensorArraySize"): Output = {
-    Op.Builder(opType = "TensorArraySizeV3", name = name)
+  private[TensorArray] def sizeOp(
+      handle: Output, flow: Output, contiguous: Boolean = false, name: String = "TensorArraySize"): Output = {
+    Op.Builder(opType = if (contiguous) "ContiguousTensorArraySize" else "TensorArraySizeV3", name = name)
         .addInput(handle)
         .addInput(flow)
         .build().outputs(0)
@@ -611,16 +699,19 @@ private[api] object TensorArray {
     * The attribute `source` is added as a suffix to the forward tensor array's name when performing the
     * creation/lookup, so that each separate gradient calculation gets its own tensor array accumulator.
     *
-    * @param  handle Handle to the forward tensor array.
-    * @param  flow   Float scalar that enforces proper chaining of operations.
-    * @param  source Gradient source string used to decide which gradient tensor array to return.
-    * @param  name   Name for the created op.
+    * @param  handle     Handle to the forward tensor array.
+    * @param  flow       Float scalar that enforces proper chaining of operations.
+    * @param  source     Gradient source string used to decide which gradient tensor array to return.
+    * @param  contiguous Boolean value indicating whether `handle` is a handle to a contiguous tensor array. The
+    *                    gradient tensor arrays of contiguous tensor arrays are also contiguous.
+    * @param  name       Name for the created op.
     * @return Tuple containing the resource handle to the gradient tensor array and a scalar used to control gradient
     *         flow.
     */
   private[TensorArray] def gradientOp(
-      handle: Output, flow: Output, source: String, name: String = "TensorArrayGrad"): (Output, Output) = {
-    val outputs = Op.Builder(opType = "TensorArrayGradV3", name = name)
+      handle: Output, flow: Output, source: String, contiguous: Boolean = false,
+      name: String = "TensorArrayGrad"): (Output, Output) = {
+    val outputs = Op.Builder(opType = if (contiguous) "ContiguousTensorArrayGrad" else "TensorArrayGradV3", name = name)
         .addInput(handle)
         .addInput(flow)
         .setAttribute("source", source)
@@ -632,12 +723,14 @@ private[api] object TensorArray {
     *
     * This enables the user to close and release the resource in the middle of a step/run.
     *
-    * @param  handle Tensor array handle.
-    * @param  name   Name for the created op.
+    * @param  handle     Tensor array handle.
+    * @param  contiguous Boolean value indicating whether `handle` is a handle to a contiguous tensor array.
+    * @param  name       Name for the created op.
     * @return Created op.
     */
-  private[TensorArray] def closeOp(handle: Output, name: String = "TensorArrayClose"): Op = {
-    Op.Builder(opType = "TensorArrayCloseV3", name = name)
+  private[TensorArray] def closeOp(
+      handle: Output, contiguous: Boolean = false, name: String = "TensorArrayClose"): Op = {
+    Op.Builder(opType = if (contiguous) "ContiguousTensorArrayClose" else "TensorArrayCloseV3", name = name)
         .addInput(handle)
         .build()
   }
@@ -659,21 +752,30 @@ private[api] object TensorArray {
     GradientsRegistry.registerNonDifferentiable("TensorArraySizeV3")
     GradientsRegistry.registerNonDifferentiable("TensorArrayCloseV3")
 
+    GradientsRegistry.registerNonDifferentiable("ContiguousTensorArray")
+    GradientsRegistry.registerNonDifferentiable("ContiguousTensorArrayGrad")
+    GradientsRegistry.registerNonDifferentiable("ContiguousTensorArraySize")
+    GradientsRegistry.registerNonDifferentiable("ContiguousTensorArrayClose")
+
     GradientsRegistry.register("TensorArrayRead", tensorArrayReadGradient)
     GradientsRegistry.register("TensorArrayReadV2", tensorArrayReadGradient)
     GradientsRegistry.register("TensorArrayReadV3", tensorArrayReadGradient)
+    GradientsRegistry.register("ContiguousTensorArrayRead", tensorArrayReadGradient)
 
     GradientsRegistry.register("TensorArrayWrite", tensorArrayWriteGradient)
     GradientsRegistry.register("TensorArrayWriteV2", tensorArrayWriteGradient)
     GradientsRegistry.register("TensorArrayWriteV3", tensorArrayWriteGradient)
+    GradientsRegistry.register("ContiguousTensorArrayWrite", tensorArrayWriteGradient)
 
     GradientsRegistry.register("TensorArrayGather", tensorArrayGatherGradient)
     GradientsRegistry.register("TensorArrayGatherV2", tensorArrayGatherGradient)
     GradientsRegistry.register("TensorArrayGatherV3", tensorArrayGatherGradient)
+    GradientsRegistry.register("ContiguousTensorArrayGather", tensorArrayGatherGradient)
 
     GradientsRegistry.register("TensorArrayScatter", tensorArrayScatterGradient)
     GradientsRegistry.register("TensorArrayScatterV2", tensorArrayScatterGradient)
     GradientsRegistry.register("TensorArrayScatterV3", tensorArrayScatterGradient)
+    GradientsRegistry.register("ContiguousTensorArrayScatter", tensorArrayScatterGradient)
 
     GradientsRegistry.register("TensorArrayConcat", tensorArrayConcatenateGradient)
     GradientsRegistry.register("TensorArrayConcatV2", tensorArrayConcatenateGradient)
@@ -706,6 +808,9 @@ private[api] object TensorArray {
       nameParts.take(gradPosition + 1).mkString("/")
     }
 
+    /** Returns `true` if `op` uses a contiguous tensor array, whose gradient tensor array must also be contiguous. */
+    private[this] def isContiguous(op: Op): Boolean = op.opType.startsWith("ContiguousTensorArray")
+
     private[this] def tensorArrayReadGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
       // Note that the forward flow dependency in the call to `gradient()` is necessary for the case of dynamically
       // sized tensor arrays. When creating the gradient tensor array, the final size of the forward array must be
@@ -713,7 +818,8 @@ private[api] object TensorArray {
       Seq(
         null, null,
         TensorArray.createFromHandle(
-          op.inputs(0), op.inputs(2), op.dataTypeAttribute("dtype"), colocateWithFirstWrite = false)
+          op.inputs(0), op.inputs(2), op.dataTypeAttribute("dtype"), colocateWithFirstWrite = false,
+          contiguous = isContiguous(op))
             .gradient(getGradientSource(outputGradients.head.name), op.inputs(2))
             .write(op.inputs(1), outputGradients.head.toOutput).flow)
     }
@@ -723,7 +829,8 @@ private[api] object TensorArray {
       Seq(
         null, null,
         TensorArray.createFromHandle(
-          op.inputs(0), flow, op.dataTypeAttribute("T"), colocateWithFirstWrite = false)
+          op.inputs(0), flow, op.dataTypeAttribute("T"), colocateWithFirstWrite = false,
+          contiguous = isContiguous(op))
             .gradient(getGradientSource(flow.name), flow)
             .read(op.inputs(1)),
         flow)
@@ -736,7 +843,8 @@ private[api] object TensorArray {
       Seq(
         null, null,
         TensorArray.createFromHandle(
-          op.inputs(0), op.inputs(2), op.dataTypeAttribute("dtype"), colocateWithFirstWrite = false)
+          op.inputs(0), op.inputs(2), op.dataTypeAttribute("dtype"), colocateWithFirstWrite = false,
+          contiguous = isContiguous(op))
             .gradient(getGradientSource(outputGradients.head.name), op.inputs(2))
             .scatter(op.inputs(1), outputGradients.head.toOutput).flow)
     }
@@ -746,7 +854,8 @@ private[api] object TensorArray {
       Seq(
         null, null,
         TensorArray.createFromHandle(
-          op.inputs(0), flow, op.dataTypeAttribute("T"), colocateWithFirstWrite = false)
+          op.inputs(0), flow, op.dataTypeAttribute("T"), colocateWithFirstWrite = false,
+          contiguous = isContiguous(op))
             .gradient(getGradientSource(flow.name), flow)
             .gather(op.inputs(1)),
         flow)
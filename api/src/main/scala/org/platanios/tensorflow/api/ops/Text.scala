@@ -16,6 +16,7 @@
 package org.platanios.tensorflow.api.ops
 
 import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
+import org.platanios.tensorflow.api.ops.Text.{FarmHash, StringHashFunction}
 
 /**
   * @author Emmanouil Antonios Platanios
@@ -134,9 +135,94 @@ private[api] trait Text {
         .setAttribute("key", Seq(key1, key2))
         .build().outputs(0)
   }
+
+  /** $OpDocTextTokenizeStrings
+    *
+    * @group TextOps
+    * @param  input     Input `STRING` tensor.
+    * @param  delimiter Delimiter bytes used for splitting. Each byte of `delimiter` is considered a potential split
+    *                   point. Defaults to the ASCII whitespace characters.
+    * @param  skipEmpty Boolean value indicating whether or not to skip empty tokens.
+    * @param  name      Name for the created op.
+    * @return Tuple containing the created op outputs: (i) `values`: one-dimensional `STRING` tensor containing the
+    *         tokens of all elements of `input`, and (ii) `rowSplits`: one-dimensional [[INT64]] tensor containing the
+    *         row splits of `values`.
+    */
+  def tokenizeStrings(
+      input: Output, delimiter: String = " \t\n\r\u000b\f", skipEmpty: Boolean = true,
+      name: String = "TokenizeStrings"): (Output, Output) = {
+    val outputs = Op.Builder(opType = "TokenizeStrings", name = name)
+        .addInput(input)
+        .setAttribute("delimiter", delimiter)
+        .setAttribute("skip_empty", skipEmpty)
+        .build().outputs
+    (outputs(0), outputs(1))
+  }
+
+  /** $OpDocTextStringToHashBucketBatch
+    *
+    * @group TextOps
+    * @param  input        `STRING` tensor containing the strings to assign to each bucket.
+    * @param  numBuckets   Number of buckets.
+    * @param  hashFunction Hash function to use.
+    * @param  name         Name for the created op.
+    * @return Created op output, which has the same shape as `input`.
+    */
+  def stringToHashBucketBatch(
+      input: Output, numBuckets: Int, hashFunction: StringHashFunction = FarmHash,
+      name: String = "StringToHashBucketBatch"): Output = {
+    Op.Builder(opType = "StringToHashBucketBatch", name = name)
+        .addInput(input)
+        .setAttribute("num_buckets", numBuckets)
+        .setAttribute("hash_function", hashFunction.name)
+        .build().outputs(0)
+  }
+
+  /** $OpDocTextWordPieceTokenize
+    *
+    * @group TextOps
+    * @param  input           Input `STRING` tensor containing the words to split.
+    * @param  vocabularyFile  Vocabulary file, containing one sub-word unit per line. The ID of each unit is its
+    *                         (zero-based) line number.
+    * @param  suffixIndicator Prefix of the units that do not start a word.
+    * @param  unknownToken    Unit used to represent unknown words. It must be in the vocabulary.
+    * @param  maxBytesPerWord Maximum size (in bytes) of the words that are split. Longer words are represented by
+    *                         `unknownToken`.
+    * @param  name            Name for the created op.
+    * @return Tuple containing the created op outputs: (i) `values`: one-dimensional [[INT64]] tensor containing the
+    *         vocabulary IDs of the units of all elements of `input`, and (ii) `rowSplits`: one-dimensional [[INT64]]
+    *         tensor containing the row splits of `values`.
+    */
+  def wordPieceTokenize(
+      input: Output, vocabularyFile: String, suffixIndicator: String = "##", unknownToken: String = "[UNK]",
+      maxBytesPerWord: Int = 100, name: String = "WordPieceTokenize"): (Output, Output) = {
+    val outputs = Op.Builder(opType = "WordPieceTokenize", name = name)
+        .addInput(input)
+        .setAttribute("vocabulary_file", vocabularyFile)
+        .setAttribute("suffix_indicator", suffixIndicator)
+        .setAttribute("unknown_token", unknownToken)
+        .setAttribute("max_bytes_per_word", maxBytesPerWord)
+        .build().outputs
+    (outputs(0), outputs(1))
+  }
 }
 
 private[api] object Text extends Text {
+  /** Hash function used by the `stringToHashBucketBatch` op. */
+  sealed trait StringHashFunction {
+    val name: String
+  }
+
+  /** 64-bit FarmHash fingerprint, which is also used by the `stringToHashBucketFast` op. */
+  case object FarmHash extends StringHashFunction {
+    override val name: String = "farmhash"
+  }
+
+  /** 64-bit xxHash, with seed 0. */
+  case object XXHash64 extends StringHashFunction {
+    override val name: String = "xxhash64"
+  }
+
   private[ops] trait Implicits {
     implicit def outputToTextOps(value: Output): TextOps = TextOps(value)
     implicit def outputConvertibleToTextOps[T](value: T)(implicit f: (T) => Output): TextOps = TextOps(f(value))
@@ -181,6 +267,57 @@ private[api] object Text extends Text {
       Text.stringToHashBucketStrong(output, numBuckets, key1, key2, name)
     }
 
+    /** $OpDocTextStringToHashBucketBatch
+      *
+      * @group TextOps
+      * @param  numBuckets   Number of buckets.
+      * @param  hashFunction Hash function to use.
+      * @param  name         Name for the created op.
+      * @return Created op output, which has the same shape as `input`.
+      */
+    def stringToHashBucketBatch(
+        numBuckets: Int, hashFunction: StringHashFunction = FarmHash,
+        name: String = "StringToHashBucketBatch"): Output = {
+      Text.stringToHashBucketBatch(output, numBuckets, hashFunction, name)
+    }
+
+    /** $OpDocTextTokenizeStrings
+      *
+      * @group TextOps
+      * @param  delimiter Delimiter bytes used for splitting. Each byte of `delimiter` is considered a potential split
+      *                   point. Defaults to the ASCII whitespace characters.
+      * @param  skipEmpty Boolean value indicating whether or not to skip empty tokens.
+      * @param  name      Name for the created op.
+      * @return Tuple containing the created op outputs: (i) `values`: one-dimensional `STRING` tensor containing the
+      *         tokens of all elements of `input`, and (ii) `rowSplits`: one-dimensional [[INT64]] tensor containing
+      *         the row splits of `values`.
+      */
+    def tokenizeStrings(
+        delimiter: String = " \t\n\r\u000b\f", skipEmpty: Boolean = true,
+        name: String = "TokenizeStrings"): (Output, Output) = {
+      Text.tokenizeStrings(output, delimiter, skipEmpty, name)
+    }
+
+    /** $OpDocTextWordPieceTokenize
+      *
+      * @group TextOps
+      * @param  vocabularyFile  Vocabulary file, containing one sub-word unit per line. The ID of each unit is its
+      *                         (zero-based) line number.
+      * @param  suffixIndicator Prefix of the units that do not start a word.
+      * @param  unknownToken    Unit used to represent unknown words. It must be in the vocabulary.
+      * @param  maxBytesPerWord Maximum size (in bytes) of the words that are split. Longer words are represented by
+      *                         `unknownToken`.
+      * @param  name            Name for the created op.
+      * @return Tuple containing the created op outputs: (i) `values`: one-dimensional [[INT64]] tensor containing the
+      *         vocabulary IDs of the units of all elements of `input`, and (ii) `rowSplits`: one-dimensional [[INT64]]
+      *         tensor containing the row splits of `values`.
+      */
+    def wordPieceTokenize(
+        vocabularyFile: String, suffixIndicator: String = "##", unknownToken: String = "[UNK]",
+        maxBytesPerWord: Int = 100, name: String = "WordPieceTokenize"): (Output, Output) = {
+      Text.wordPieceTokenize(output, vocabularyFile, suffixIndicator, unknownToken, maxBytesPerWord, name)
+    }
+
     /** $OpDocTextStringSplit
       *
       * @group TextOps
@@ -228,6 +365,9 @@ private[api] object Text extends Text {
     GradientsRegistry.registerNonDifferentiable("StringToHashBucket")
     GradientsRegistry.registerNonDifferentiable("StringToHashBucketFast")
     GradientsRegistry.registerNonDifferentiable("StringToHashBucketStrong")
+    GradientsRegistry.registerNonDifferentiable("StringToHashBucketBatch")
+    GradientsRegistry.registerNonDifferentiable("TokenizeStrings")
+    GradientsRegistry.registerNonDifferentiable("WordPieceTokenize")
   }
 
   /** @define OpDocTextStringJoin
@@ -295,6 +435,46 @@ private[api] object Text extends Text {
     *   to the same bucket for a denial-of-service attack or to skew the results. A strong hash prevents this by making
     *   it difficult, if not infeasible, to compute inputs that hash to the same bucket. This comes at a cost of roughly
     *   4x higher compute time than `stringToHashBucketFast`.
+    *
+    * @define OpDocTextStringToHashBucketBatch
+    *   The `stringToHashBucketBatch` op converts each string in the input tensor to its hash mod the number of
+    *   buckets.
+    *
+    *   Unlike `stringToHashBucketFast`, the strings are hashed in parallel, which makes this op more efficient for
+    *   large batches of strings. When using the [[FarmHash]] hash function, it computes the same output as
+    *   `stringToHashBucketFast`. The [[XXHash64]] hash function is also supported. Neither one is suitable for
+    *   cryptography.
+    *
+    * @define OpDocTextTokenizeStrings
+    *   The `tokenizeStrings` op splits the elements of `input` into tokens, based on the bytes of `delimiter`.
+    *
+    *   The result is a ragged tensor, represented by its `values` and `rowSplits`. `values` contains the tokens of all
+    *   elements of `input` (in row-major order) and the tokens of element `i` are
+    *   `values(rowSplits(i) :: rowSplits(i + 1))`. Compared to `stringSplit`, this op avoids the construction of the
+    *   sparse tensor indices, it scans the strings for delimiters using SIMD instructions (when `delimiter` contains
+    *   at most 8 distinct bytes), and it processes the strings in parallel.
+    *
+    *   For example:
+    *   {{{
+    *     // input = Tensor("hello world", "a b c")
+    *     val (values, rowSplits) = tokenizeStrings(input)
+    *     values ==> ["hello", "world", "a", "b", "c"]
+    *     rowSplits ==> [0, 2, 5]
+    *   }}}
+    *
+    * @define OpDocTextWordPieceTokenize
+    *   The `wordPieceTokenize` op splits the words in `input` into WordPiece sub-word units and returns their
+    *   vocabulary IDs.
+    *
+    *   Each word is split using a greedy longest-match-first algorithm, where all units except for the first one of
+    *   each word are looked up after prefixing them with `suffixIndicator`. Words that cannot be split into units that
+    *   are all in the vocabulary are represented by the ID of `unknownToken`. The result is a ragged tensor,
+    *   represented by its `values` and `rowSplits`, where the IDs of the units of word `i` are
+    *   `values(rowSplits(i) :: rowSplits(i + 1))`.
+    *
+    *   The vocabulary file is memory-mapped (when supported by its file system) and it is only read once, when the op
+    *   kernel is created. The words are processed in parallel. The op is typically applied to the `values` produced
+    *   by `tokenizeStrings`.
     */
   private[ops] trait Documentation
 }
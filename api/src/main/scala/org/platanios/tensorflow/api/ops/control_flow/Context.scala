@@ -80,12 +80,12 @@ abstract class Context protected (
         controlPivot.foreach(ControlFlow.addControlInput(op, _))
       op.outputs.foreach(values += _.name)
     } else {
-      op.inputs.zipWithIndex.foreach({
+      // The inputs that need to be replaced are all updated using a single native call.
+      ControlFlow.updateInputs(op.inputs.zipWithIndex.flatMap({
         case (input, index) =>
           val realInput = add(input)
-          if (realInput != input)
-            ControlFlow.updateInput(op, index, realInput)
-      })
+          if (realInput != input) Some((op, index, realInput)) else None
+      }))
       // Remove any external control dependencies on this op.
       removeExternalControlEdges(op)
       // Add a control dependency to the op if it only depends on loop invariants. That is to prevent loop invariants
@@ -575,6 +575,18 @@ private[api] object ControlFlow extends ControlFlow {
     })
   }
 
+  /** Updates multiple ops at once, as done by [[updateInput]], using a single native call. Each element of `updates`
+    * contains an op, the index of the input to update, and the new input to use. */
+  private[control_flow] def updateInputs(updates: Seq[(Op, Int, Output)]): Unit = {
+    if (updates.nonEmpty) {
+      using(updates.head._1.graph.reference)(r => {
+        NativeLibrary.updateInputs(
+          r.nativeHandle, updates.map(_._1.nativeHandle).toArray, updates.map(_._2).toArray,
+          updates.map(_._3.op.nativeHandle).toArray, updates.map(_._3.index).toArray)
+      })
+    }
+  }
+
   /** Adds `inputOp` as a control input of `op`. */
   private[control_flow] def addControlInput(op: Op, inputOp: Op): Unit = {
     using(op.graph.reference)(r => {
@@ -241,6 +241,8 @@ private[ops] class GradientState private[control_flow] () {
     *   1. Patch the gradient graph if the output of a loop variable doesn't depend on its input.
     */
   private[ops] def postProcess(): Unit = {
+    // The back edges of all loops are updated using a single native call.
+    val backEdges = mutable.ListBuffer.empty[(Op, Int, Output)]
     map.values.foreach(gradientLoopState => {
       gradientLoopState.switchMap.values.flatMap({
         case o: Output => Seq(o)
@@ -282,9 +284,10 @@ private[ops] class GradientState private[control_flow] () {
             nextGradientValue
           }
         }
-        ControlFlow.updateInput(merge.op, 1, nextGradientValue)
+        backEdges += ((merge.op, 1, nextGradientValue))
       })
     })
+    ControlFlow.updateInputs(backEdges)
   }
 }
 
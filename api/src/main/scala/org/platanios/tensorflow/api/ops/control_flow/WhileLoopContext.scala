@@ -245,9 +245,7 @@ private[ops] case class WhileLoopContext private[control_flow] (
       val flattenedBodyResult = ev.flatten(bodyResult)
 
       // Add the `NextIteration` op and the back edges to complete the loop.
-      val nextVariables = mergeVariables.zip(flattenedBodyResult).map(p => {
-        WhileLoopContext.addNextIterationAndBackEdge(p._1, p._2)
-      })
+      val nextVariables = WhileLoopContext.addNextIterationsAndBackEdges(mergeVariables, flattenedBodyResult)
 
       // Add the exit ops.
       val exitVariables = switchVariables.map(v => ControlFlow.exit(v._1))
@@ -519,8 +517,7 @@ private[ops] case class WhileLoopContext private[control_flow] (
           // For the shape we just keep the maximum.
           addAcc += Math.maximum(g.denseShape, switchAcc(2)._2)
         })
-        val nextAcc = addAcc.map(ControlFlow.nextIteration(_))
-        mergeAcc.zip(nextAcc).foreach(a => ControlFlow.updateInput(a._1.op, 1, a._2))
+        WhileLoopContext.addNextIterationsAndBackEdges(mergeAcc, addAcc)
         val exitAcc = switchAcc.map(a => ControlFlow.exit(a._1))
         loopExits ++= exitAcc
         exitResult(exitAcc)
@@ -588,8 +585,7 @@ private[ops] case class WhileLoopContext private[control_flow] (
           // For the shape we just keep the maximum.
           addAcc += Math.maximum(g.denseShape, switchAcc(2)._2)
         })
-        val nextAcc = addAcc.map(ControlFlow.nextIteration(_))
-        mergeAcc.zip(nextAcc).foreach(a => ControlFlow.updateInput(a._1.op, 1, a._2))
+        WhileLoopContext.addNextIterationsAndBackEdges(mergeAcc, addAcc)
         val exitAcc = switchAcc.map(a => ControlFlow.exit(a._1, name = "BackwardAccumulator"))
         loopExits ++= exitAcc
         exitResult(exitAcc)
@@ -651,38 +647,51 @@ object WhileLoopContext {
   /** Creates a next iteration op for `v` and adds a back edge from `v` to `m`. */
   @throws[IllegalArgumentException]
   private[ops] def addNextIterationAndBackEdge[T <: OutputLike](m: T, v: T): T = {
-    val result = (m, v) match {
-      case (mm: Output, vv: Output) =>
-        val nextVV = ControlFlow.nextIteration(vv)
-        ControlFlow.updateInput(mm.op, 1, nextVV)
-        nextVV
-      case (mm: OutputIndexedSlices, vv: OutputIndexedSlices) =>
-        val nextVV = ControlFlow.nextIteration(vv)
-        ControlFlow.updateInput(mm.values.op, 1, nextVV.values)
-        ControlFlow.updateInput(mm.indices.op, 1, nextVV.indices)
-        if (mm.denseShape != null) {
-          if (nextVV.denseShape == null)
-            throw new IllegalArgumentException(s"Output indexed slices '$nextVV' must have dense shape information.")
-          else
-            ControlFlow.updateInput(mm.denseShape.op, 1, nextVV.denseShape)
-        }
-        nextVV
-      case (mm: SparseOutput, vv: SparseOutput) =>
-        val nextVV = ControlFlow.nextIteration(vv)
-        ControlFlow.updateInput(mm.values.op, 1, nextVV.values)
-        ControlFlow.updateInput(mm.indices.op, 1, nextVV.indices)
-        if (mm.denseShape != null) {
-          if (nextVV.denseShape == null)
-            throw new IllegalArgumentException(s"Sparse output '$nextVV' must have dense shape information.")
-          else
-            ControlFlow.updateInput(mm.denseShape.op, 1, nextVV.denseShape)
-        }
-        nextVV
-      case (_, _) =>
-        throw new IllegalArgumentException(
-          "Only 'Output', 'OutputIndexedSlices', and 'SparseOutput' are supported. Also, the tensor types must match.")
-    }
-    result.asInstanceOf[T]
+    addNextIterationsAndBackEdges(Seq(m), Seq(v)).head
+  }
+
+  /** Creates a next iteration op for each element of `vs` and adds a back edge from it to the corresponding element of
+    * `ms`. All back edges are added using a single native call, which acquires the graph lock only once. */
+  @throws[IllegalArgumentException]
+  private[ops] def addNextIterationsAndBackEdges[T <: OutputLike](ms: Seq[T], vs: Seq[T]): Seq[T] = {
+    val backEdges = mutable.ListBuffer.empty[(Op, Int, Output)]
+    val results = ms.zip(vs).map(p => {
+      val result = (p._1, p._2) match {
+        case (mm: Output, vv: Output) =>
+          val nextVV = ControlFlow.nextIteration(vv)
+          backEdges += ((mm.op, 1, nextVV))
+          nextVV
+        case (mm: OutputIndexedSlices, vv: OutputIndexedSlices) =>
+          val nextVV = ControlFlow.nextIteration(vv)
+          backEdges += ((mm.values.op, 1, nextVV.values))
+          backEdges += ((mm.indices.op, 1, nextVV.indices))
+          if (mm.denseShape != null) {
+            if (nextVV.denseShape == null)
+              throw new IllegalArgumentException(s"Output indexed slices '$nextVV' must have dense shape information.")
+            else
+              backEdges += ((mm.denseShape.op, 1, nextVV.denseShape))
+          }
+          nextVV
+        case (mm: SparseOutput, vv: SparseOutput) =>
+          val nextVV = ControlFlow.nextIteration(vv)
+          backEdges += ((mm.values.op, 1, nextVV.values))
+          backEdges += ((mm.indices.op, 1, nextVV.indices))
+          if (mm.denseShape != null) {
+            if (nextVV.denseShape == null)
+              throw new IllegalArgumentException(s"Sparse output '$nextVV' must have dense shape information.")
+            else
+              backEdges += ((mm.denseShape.op, 1, nextVV.denseShape))
+          }
+          nextVV
+        case (_, _) =>
+          throw new IllegalArgumentException(
+            "Only 'Output', 'OutputIndexedSlices', and 'SparseOutput' are supported. Also, the tensor types must " +
+                "match.")
+      }
+      result.asInstanceOf[T]
+    })
+    ControlFlow.updateInputs(backEdges)
+    results
   }
 
   //region Shape Invariants
@@ -0,0 +1,217 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.io.data
+
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.ops.{Basic, Math, Op, Output}
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.types.{INT64, STRING}
+
+/** Dataset that wraps the application of the `paddedBatch` op to a window of a [[BucketBySequenceLengthDataset]],
+  * using padded shapes that are computed in the graph from the bucket of the window.
+  *
+  * @param  inputDataset          Input dataset.
+  * @param  batchSize             Batch size to use.
+  * @param  flattenedPaddedShapes `INT64` vectors representing the flattened padded shapes of the element components.
+  * @param  paddingValues         Scalar tensor structure representing the padding values to use for the respective
+  *                               components. Defaults to zero for numeric types and the empty string for string types.
+  * @param  name                  Name for this dataset.
+  * @tparam T                     Tensor type (i.e., nested structure of tensors).
+  * @tparam O                     Output type (i.e., nested structure of symbolic tensors).
+  * @tparam D                     Data type of the outputs (i.e., nested structure of TensorFlow data types).
+  * @tparam S                     Shape type of the outputs (i.e., nested structure of TensorFlow shapes).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+private[data] case class BucketPaddedBatchDataset[T, O, D, S](
+    inputDataset: Dataset[T, O, D, S],
+    batchSize: Long,
+    flattenedPaddedShapes: Seq[Output],
+    paddingValues: T = null.asInstanceOf[T],
+    override val name: String = "BucketPaddedBatchDataset"
+) extends Dataset[T, O, D, S](name)(inputDataset.evOToT, inputDataset.ev, inputDataset.evFunctionInput) {
+  override def createHandle(): Output = {
+    Op.Builder(opType = "PaddedBatchDataset", name = name)
+        .addInput(Op.createWithNameScope(name)(inputDataset.createHandle()))
+        .addInput(Op.createWithNameScope(name)(Basic.constant(batchSize)))
+        .addInputList(flattenedPaddedShapes)
+        .addInputList(Op.createWithNameScope(name)(flattenedPaddingValues))
+        .setAttribute("Toutput_types", flattenedOutputDataTypes.toArray)
+        .setAttribute("output_shapes", flattenedOutputShapes.toArray)
+        .build().outputs(0)
+  }
+
+  private[this] def flattenedPaddingValues: Seq[Output] = {
+    if (paddingValues != null) {
+      ev.flattenedTensors(paddingValues).map(Basic.constant(_))
+    } else {
+      flattenedOutputDataTypes.map({
+        case STRING => Basic.constant("", STRING, Shape.scalar())
+        case dataType => Basic.constant(0, dataType, Shape.scalar())
+      })
+    }
+  }
+
+  override def outputDataTypes: D = inputDataset.outputDataTypes
+  override def outputShapes: S = {
+    ev.unflattenShapes(outputDataTypes, inputDataset.flattenedOutputShapes.map(Shape(-1) ++ _))
+  }
+}
+
+/** Dataset that wraps the application of the `bucketBySequenceLength` op.
+  *
+  * $OpDocDatasetBucketBySequenceLength
+  *
+  * @param  inputDataset        Input dataset.
+  * @param  elementLengthFn     Function that returns the length of an element, as an integer scalar.
+  * @param  bucketBoundaries    Upper length boundaries of the buckets, which must be positive and strictly
+  *                             increasing.
+  * @param  bucketBatchSizes    Batch size per bucket. Its length must be equal to the number of bucket boundaries
+  *                             plus one.
+  * @param  paddingValues       Scalar tensor structure representing the padding values to use for the respective
+  *                             components. Defaults to zero for numeric types and the empty string for string types.
+  * @param  padToBucketBoundary If `true`, the unknown dimensions of the element components are padded to the length
+  *                             boundary of the bucket minus one, rather than to the maximum size of that dimension in
+  *                             each batch. The elements of the last bucket, which has no upper boundary, are always
+  *                             padded to the maximum size in each batch.
+  * @param  name                Name for this dataset.
+  * @tparam T                   Tensor type (i.e., nested structure of tensors).
+  * @tparam O                   Output type (i.e., nested structure of symbolic tensors).
+  * @tparam D                   Data type of the outputs (i.e., nested structure of TensorFlow data types).
+  * @tparam S                   Shape type of the outputs (i.e., nested structure of TensorFlow shapes).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class BucketBySequenceLengthDataset[T, O, D, S](
+    inputDataset: Dataset[T, O, D, S],
+    elementLengthFn: (O) => Output,
+    bucketBoundaries: Seq[Long],
+    bucketBatchSizes: Seq[Long],
+    paddingValues: T = null.asInstanceOf[T],
+    padToBucketBoundary: Boolean = false,
+    override val name: String = "BucketBySequenceLengthDataset"
+) extends Dataset[T, O, D, S](name)(inputDataset.evOToT, inputDataset.ev, inputDataset.evFunctionInput) {
+  require(bucketBoundaries.nonEmpty, "At least one bucket boundary must be provided.")
+  require(bucketBoundaries.head > 0, "The bucket boundaries must be positive.")
+  require(bucketBoundaries.zip(bucketBoundaries.tail).forall(b => b._1 < b._2),
+    "The bucket boundaries must be strictly increasing.")
+  require(bucketBatchSizes.size == bucketBoundaries.size + 1,
+    s"The number of bucket batch sizes (${bucketBatchSizes.size}) must be equal to the number of bucket boundaries " +
+        s"(${bucketBoundaries.size}) plus one.")
+  require(bucketBatchSizes.forall(_ > 0), "The bucket batch sizes must be positive.")
+  require(!padToBucketBoundary || inputDataset.flattenedOutputShapes.forall(_.rank != -1),
+    "Padding to the bucket boundaries requires all element components to have known ranks.")
+
+  /** Returns the bucket of an element, which is the number of bucket boundaries that are less than or equal to its
+    * length. */
+  private[this] def keyFn(element: O): Output = {
+    val length = Math.cast(elementLengthFn(element), INT64)
+    val boundaries = Basic.constant(Tensor(INT64, bucketBoundaries.head, bucketBoundaries.tail: _*))
+    Math.sum(Math.cast(Math.lessEqual(boundaries, length), INT64))
+  }
+
+  private[this] def windowSizeFn(key: Output): Output = {
+    Basic.gather(Basic.constant(Tensor(INT64, bucketBatchSizes.head, bucketBatchSizes.tail: _*)), key)
+  }
+
+  private[this] def reduceFn(keyAndWindow: (Output, Dataset[T, O, D, S])): Dataset[T, O, D, S] = {
+    val (key, window) = keyAndWindow
+    val paddedShapes = {
+      if (!padToBucketBoundary) {
+        window.flattenedOutputShapes.map(_.toOutput(INT64))
+      } else {
+        val boundaries = bucketBoundaries.map(_ - 1) :+ -1L
+        val boundary = Basic.gather(Basic.constant(Tensor(INT64, boundaries.head, boundaries.tail: _*)), key)
+        window.flattenedOutputShapes.map(shape => {
+          if (shape.rank == 0)
+            Basic.constant(Tensor(INT64))
+          else
+            Basic.stack(shape.asArray.map(d => if (d == -1) boundary else Basic.constant(d.toLong)).toSeq)
+        })
+      }
+    }
+    // Each window contains at most as many elements as the batch size of its bucket, and so it results in exactly one
+    // batch when batched using the largest batch size.
+    BucketPaddedBatchDataset(window, bucketBatchSizes.max, paddedShapes, paddingValues, s"$name/PaddedBatch")
+  }
+
+  private[this] lazy val groupedDataset: Dataset[T, O, D, S] = {
+    GroupByWindowDataset(inputDataset, keyFn, reduceFn, windowSizeFn, s"$name/GroupByWindow")
+  }
+
+  override def createHandle(): Output = Op.createWithNameScope(name)(groupedDataset.createHandle())
+
+  override def outputDataTypes: D = groupedDataset.outputDataTypes
+  override def outputShapes: S = groupedDataset.outputShapes
+}
+
+object BucketBySequenceLengthDataset {
+  private[data] trait Implicits {
+    implicit def datasetToBucketBySequenceLengthDatasetOps[T, O, D, S](
+        dataset: Dataset[T, O, D, S]): BucketBySequenceLengthDatasetOps[T, O, D, S] = {
+      BucketBySequenceLengthDatasetOps(dataset)
+    }
+  }
+
+  case class BucketBySequenceLengthDatasetOps[T, O, D, S] private[BucketBySequenceLengthDataset] (
+      dataset: Dataset[T, O, D, S]) {
+    /** $OpDocDatasetBucketBySequenceLength
+      *
+      * @param  elementLengthFn     Function that returns the length of an element, as an integer scalar.
+      * @param  bucketBoundaries    Upper length boundaries of the buckets, which must be positive and strictly
+      *                             increasing.
+      * @param  bucketBatchSizes    Batch size per bucket. Its length must be equal to the number of bucket
+      *                             boundaries plus one.
+      * @param  paddingValues       Scalar tensor structure representing the padding values to use for the respective
+      *                             components. Defaults to zero for numeric types and the empty string for string
+      *                             types.
+      * @param  padToBucketBoundary If `true`, the unknown dimensions of the element components are padded to the
+      *                             length boundary of the bucket minus one, rather than to the maximum size of that
+      *                             dimension in each batch.
+      * @param  name                Name for the created dataset.
+      * @return Created dataset.
+      */
+    def bucketBySequenceLength(
+        elementLengthFn: (O) => Output,
+        bucketBoundaries: Seq[Long],
+        bucketBatchSizes: Seq[Long],
+        paddingValues: T = null.asInstanceOf[T],
+        padToBucketBoundary: Boolean = false,
+        name: String = "BucketBySequenceLength"
+    ): Dataset[T, O, D, S] = {
+      Op.createWithNameScope(dataset.name) {
+        BucketBySequenceLengthDataset(
+          dataset, elementLengthFn, bucketBoundaries, bucketBatchSizes, paddingValues, padToBucketBoundary, name)
+      }
+    }
+  }
+
+  /** @define OpDocDatasetBucketBySequenceLength
+    *   The dataset `bucketBySequenceLength` op groups the elements of a dataset into buckets by their length and then
+    *   combines consecutive elements of each bucket into padded batches.
+    *
+    *   Bucket `i` contains the elements whose length lies in `[bucketBoundaries(i - 1), bucketBoundaries(i))`, where
+    *   the first bucket has no lower boundary and the last bucket has no upper boundary, and its batches contain
+    *   `bucketBatchSizes(i)` elements (except for the final batch of each bucket, which may be smaller). Because the
+    *   elements of each batch have similar lengths, much less padding is used than when batching elements of arbitrary
+    *   lengths, which is useful, for example, when training sequence models. For example:
+    *   {{{
+    *     sentences.bucketBySequenceLength(
+    *       s => tf.size(s), bucketBoundaries = Seq(10, 20, 40), bucketBatchSizes = Seq(128, 64, 32, 16))
+    *   }}}
+    */
+  private[data] trait Documentation
+}
@@ -73,6 +73,10 @@ object CacheDataset {
   /** @define OpDocDatasetCache
     *   The dataset `cache` op caches the elements in a dataset in the provided directory. If the provided directory is
     *   empty, then the elements are cached in memory.
+    *
+    *   Note that elements cached in files are decoded again in every epoch. For repeated-epoch training on datasets of
+    *   numeric tensors, [[Dataset.createMappedCache]] instead stores the elements in memory-mapped files that are
+    *   replayed without any decoding or copying.
     */
   private[data] trait Documentation
 }
@@ -17,6 +17,7 @@ package org.platanios.tensorflow.api.ops.io.data
 
 import org.platanios.tensorflow.api.Implicits._
 import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.core.client.{Fetchable, SessionConfig}
 import org.platanios.tensorflow.api.core.exception._
 import org.platanios.tensorflow.api.ops.{Callback, Function, Math, Op, Output, OutputToTensor}
 import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
@@ -68,6 +69,75 @@ abstract class Dataset[T, O, D, S](
     Iterator.fromDataset(this, sharedName, name)
   }
 
+  /** Creates an [[EagerIterator]] for enumerating the elements of this dataset as tensors, without requiring a session
+    * run for each element.
+    *
+    * For example:
+    * {{{
+    *   val iterator = tf.data.TFRecordDataset(filename).batch(32).createEagerIterator(prefetchSize = 4)
+    *   try {
+    *     iterator.foreach(batch => process(batch))
+    *   } finally {
+    *     iterator.close()
+    *   }
+    * }}}
+    *
+    * The prefetch size and the number of producing threads can also be autotuned at runtime, and the chosen values
+    * then obtained through [[EagerIterator.statistics]]:
+    * {{{
+    *   val iterator = dataset.createEagerIterator(
+    *     autotuning = Some(EagerIterator.Autotuning(maxPrefetchSize = 32, maxBufferedBytes = 1L << 30)))
+    * }}}
+    *
+    * Statistics about the individual stages of the dataset can be collected by marking them using `stageStats` and
+    * setting `collectStats` to `true`, and then obtained using [[EagerIterator.statsSummary]]:
+    * {{{
+    *   val iterator = tf.data.TFRecordDataset(filename).stageStats("Read")
+    *     .map(decode).stageStats("Decode")
+    *     .createEagerIterator(prefetchSize = 4, collectStats = true)
+    *   ...
+    *   iterator.writeStats(summaryWriter, step)
+    * }}}
+    *
+    * @param  prefetchSize  Number of elements to produce ahead of time on native threads, or `0` to produce each
+    *                       element when it is requested. If autotuning, this is the initial value.
+    * @param  sessionConfig Optional configuration for the private session in which the iterator ops are run.
+    * @param  numThreads    Number of native threads producing elements, if `prefetchSize` is positive. Note that,
+    *                       with more than one thread, elements may be produced out of order. If autotuning, this is
+    *                       the initial value.
+    * @param  autotuning    Optional limits within which to autotune the prefetch size and the number of threads.
+    * @param  collectStats  If `true`, the statistics recorded by the stages of this dataset are collected.
+    * @return Created iterator, which must be closed once it is not needed anymore.
+    * @throws IllegalArgumentException If `prefetchSize` is negative or `numThreads` is not positive.
+    */
+  @throws[IllegalArgumentException]
+  def createEagerIterator(
+      prefetchSize: Int = 0, sessionConfig: Option[SessionConfig] = None, numThreads: Int = 1,
+      autotuning: Option[EagerIterator.Autotuning] = None, collectStats: Boolean = false
+  )(implicit evFetchable: Fetchable.Aux[O, T]): EagerIterator[T] = {
+    EagerIterator(this, prefetchSize, sessionConfig, numThreads, autotuning, collectStats)
+  }
+
+  /** Creates a [[MappedCache]] for the elements of this dataset, which is written to memory-mapped files with file
+    * prefix `prefix` during the first pass over this dataset, and from which all subsequent passes are replayed, as
+    * tensors, without any decoding or copying.
+    *
+    * @param  prefix        File prefix of the cache. If a complete cache already exists with this prefix, then it is
+    *                       reused and this dataset is never iterated over.
+    * @param  prefetchSize  Number of elements to produce ahead of time on a native thread while writing the cache, or
+    *                       `0` to produce each element when it is requested.
+    * @param  sessionConfig Optional configuration for the private session in which this dataset is iterated over while
+    *                       writing the cache.
+    * @return Created cache, which must be closed once it is not needed anymore.
+    * @throws IllegalArgumentException If `prefetchSize` is negative.
+    */
+  @throws[IllegalArgumentException]
+  def createMappedCache(prefix: String, prefetchSize: Int = 0, sessionConfig: Option[SessionConfig] = None)(implicit
+      evFetchable: Fetchable.Aux[O, T]
+  ): MappedCache[T] = {
+    MappedCache(this, prefix, prefetchSize, sessionConfig)
+  }
+
   // TODO: [DATASETS] "createOneShotIterator".
 
   /** Returns the data types corresponding to each element of this dataset, matching the structure of the elements. */
@@ -157,6 +227,12 @@ abstract class Dataset[T, O, D, S](
 object Dataset {
   private[io] trait API {
     type Dataset[T, O, D, S] = data.Dataset[T, O, D, S]
+    type EagerIterator[T] = data.EagerIterator[T]
+    val EagerIterator: data.EagerIterator.type = data.EagerIterator
+    type MappedCache[T] = data.MappedCache[T]
+    type StatsAggregator = data.StatsAggregator
+    type DevicePrefetcher[O] = data.DevicePrefetcher[O]
+    val StatsAggregator: data.StatsAggregator.type = data.StatsAggregator
 
     type RangeDataset = data.RangeDataset
     type TensorDataset[T, O, D, S] = data.TensorDataset[T, O, D, S]
@@ -182,7 +258,11 @@ object Dataset {
 
     type FilterDataset[T, O, D, S] = data.FilterDataset[T, O, D, S]
     type MapDataset[T, O, D, S, RT, RO, RD, RS] = data.MapDataset[T, O, D, S, RT, RO, RD, RS]
+    type MapAndBatchDataset[T, O, D, S, RT, RO, RD, RS] = data.MapAndBatchDataset[T, O, D, S, RT, RO, RD, RS]
     type FlatMapDataset[T, O, D, S, RT, RO, RD, RS] = data.FlatMapDataset[T, O, D, S, RT, RO, RD, RS]
+    type InterleaveDataset[T, O, D, S, RT, RO, RD, RS] = data.InterleaveDataset[T, O, D, S, RT, RO, RD, RS]
+    type ParallelInterleaveDataset[T, O, D, S, RT, RO, RD, RS] =
+      data.ParallelInterleaveDataset[T, O, D, S, RT, RO, RD, RS]
 
     type ZipDataset[T1, O1, D1, S1, T2, O2, D2, S2] = data.ZipDataset[T1, O1, D1, S1, T2, O2, D2, S2]
     type Zip3Dataset[T1, O1, D1, S1, T2, O2, D2, S2, T3, O3, D3, S3] = data.Zip3Dataset[T1, O1, D1, S1, T2, O2, D2, S2, T3, O3, D3, S3]
@@ -191,6 +271,10 @@ object Dataset {
     type ConcatenatedDataset[T, O, D, S] = data.ConcatenatedDataset[T, O, D, S]
 
     type GroupByWindowDataset[T, O, D, S] = data.GroupByWindowDataset[T, O, D, S]
+    type BucketBySequenceLengthDataset[T, O, D, S] = data.BucketBySequenceLengthDataset[T, O, D, S]
+
+    type LatencyStatsDataset[T, O, D, S] = data.LatencyStatsDataset[T, O, D, S]
+    type BytesProducedStatsDataset[T, O, D, S] = data.BytesProducedStatsDataset[T, O, D, S]
 
     val RangeDataset             : data.RangeDataset.type              = data.RangeDataset
     val TensorDataset            : data.TensorDataset.type             = data.TensorDataset
@@ -214,9 +298,12 @@ object Dataset {
     val TakeDataset: data.TakeDataset.type = data.TakeDataset
     val DropDataset: data.DropDataset.type = data.DropDataset
 
-    val FilterDataset : data.FilterDataset.type  = data.FilterDataset
-    val MapDataset    : data.MapDataset.type     = data.MapDataset
-    val FlatMapDataset: data.FlatMapDataset.type = data.FlatMapDataset
+    val FilterDataset            : data.FilterDataset.type             = data.FilterDataset
+    val MapDataset               : data.MapDataset.type                = data.MapDataset
+    val MapAndBatchDataset       : data.MapAndBatchDataset.type        = data.MapAndBatchDataset
+    val FlatMapDataset           : data.FlatMapDataset.type            = data.FlatMapDataset
+    val InterleaveDataset        : data.InterleaveDataset.type         = data.InterleaveDataset
+    val ParallelInterleaveDataset: data.ParallelInterleaveDataset.type = data.ParallelInterleaveDataset
 
     val ZipDataset        : data.ZipDataset.type         = data.ZipDataset
     val Zip3Dataset       : data.Zip3Dataset.type        = data.Zip3Dataset
@@ -224,7 +311,11 @@ object Dataset {
 
     val ConcatenatedDataset: data.ConcatenatedDataset.type = data.ConcatenatedDataset
 
-    val GroupByWindowDataset: data.GroupByWindowDataset.type = data.GroupByWindowDataset
+    val GroupByWindowDataset         : data.GroupByWindowDataset.type          = data.GroupByWindowDataset
+    val BucketBySequenceLengthDataset: data.BucketBySequenceLengthDataset.type = data.BucketBySequenceLengthDataset
+
+    val LatencyStatsDataset      : data.LatencyStatsDataset.type       = data.LatencyStatsDataset
+    val BytesProducedStatsDataset: data.BytesProducedStatsDataset.type = data.BytesProducedStatsDataset
 
     def fromGenerator[T, O, D, S](
         generator: () => Iterable[T], outputDataType: D, outputShape: S = null
@@ -429,12 +520,16 @@ object Dataset {
     GradientsRegistry.registerNonDifferentiable("ConcatenateDataset")
     GradientsRegistry.registerNonDifferentiable("MapDataset")
     GradientsRegistry.registerNonDifferentiable("ParallelMapDataset")
+    GradientsRegistry.registerNonDifferentiable("MapAndBatchDataset")
     GradientsRegistry.registerNonDifferentiable("FlatMapDataset")
     GradientsRegistry.registerNonDifferentiable("FilterDataset")
     GradientsRegistry.registerNonDifferentiable("InterleaveDataset")
+    GradientsRegistry.registerNonDifferentiable("ParallelInterleaveDataset")
     GradientsRegistry.registerNonDifferentiable("GroupByWindowDataset")
     GradientsRegistry.registerNonDifferentiable("PrefetchDataset")
     GradientsRegistry.registerNonDifferentiable("IgnoreErrorsDataset")
+    GradientsRegistry.registerNonDifferentiable("LatencyStatsDataset")
+    GradientsRegistry.registerNonDifferentiable("BytesProducedStatsDataset")
     GradientsRegistry.registerNonDifferentiable("DenseToSparseBatchDataset")
   }
 }
@@ -0,0 +1,191 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.io.data
+
+import org.platanios.tensorflow.api.ops.{Op, Output}
+import org.platanios.tensorflow.api.ops.control_flow.ControlFlow
+import org.platanios.tensorflow.api.types.DataType
+
+/** Prefetcher that keeps up to `bufferSize` elements of an [[Iterator]] already copied to a device (e.g., a GPU), so
+  * that the host-to-device copies of the next elements overlap with the computation that consumes the current one.
+  *
+  * The elements are staged in a staging area placed on `device`. Elements are obtained from the iterator on the host
+  * and enter the area through `Stage` ops placed on the device, and so TensorFlow copies them to the device (using the
+  * dedicated host-to-device stream of the device, for GPUs) as part of staging them. [[next]] then returns the oldest
+  * staged element, which already resides in device memory.
+  *
+  * The prefetcher is used as follows:
+  * {{{
+  *   val prefetcher = iterator.prefetchToDevice("/GPU:0", bufferSize = 2)
+  *   val loss = model(prefetcher.next)
+  *   ...
+  *   session.run(targets = Set(iterator.initializer))
+  *   session.run(targets = Set(prefetcher.initializer))
+  *   while (...) session.run(fetches = loss, targets = Set(trainOp, prefetcher.update))
+  * }}}
+  * Running [[update]] along with each step stages the element that replaces the one consumed by that step, which
+  * happens concurrently with the computation of the step.
+  *
+  * @param  device      Device on which the elements are staged.
+  * @param  bufferSize  Maximum number of staged elements.
+  * @param  next        Oldest staged element, which is removed from the staging area when it is computed.
+  * @param  initializer Op that fills the staging area with `bufferSize` elements.
+  * @param  update      Op that stages one more element.
+  * @param  size        `INT32` scalar containing the current number of staged elements.
+  * @param  clear       Op that removes all staged elements.
+  * @tparam O           Output type (i.e., nested structure of symbolic tensors).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class DevicePrefetcher[O] private[data](
+    val device: String,
+    val bufferSize: Int,
+    val next: O,
+    val initializer: Op,
+    val update: Op,
+    val size: Output,
+    val clear: Op)
+
+object DevicePrefetcher {
+  /** Creates a new [[DevicePrefetcher]] for the elements of `iterator`.
+    *
+    * @param  iterator    Iterator whose elements are prefetched.
+    * @param  device      Device on which the elements are staged.
+    * @param  bufferSize  Maximum number of staged elements.
+    * @param  memoryLimit Maximum number of bytes of staged elements, or `0` for no limit.
+    * @param  name        Name for the created ops.
+    * @return Created prefetcher.
+    * @throws IllegalArgumentException If `bufferSize` is not positive or `memoryLimit` is negative.
+    */
+  @throws[IllegalArgumentException]
+  private[data] def apply[T, O, D, S](
+      iterator: Iterator[T, O, D, S], device: String, bufferSize: Int, memoryLimit: Long, name: String
+  )(implicit ev: Data.Aux[T, O, D, S]): DevicePrefetcher[O] = {
+    require(bufferSize > 0, s"'bufferSize' (= $bufferSize) must be positive.")
+    require(memoryLimit >= 0, s"'memoryLimit' (= $memoryLimit) must be non-negative.")
+    Op.createWithNameScope(name) {
+      val dataTypes = ev.flattenedDataTypes(iterator.outputDataTypes)
+      val shapes = ev.flattenedShapes(iterator.outputShapes)
+      // The stage and unstage ops refer to the same staging area through its shared name.
+      val sharedName = Op.currentGraph.uniqueName(s"$name/StagingArea")
+      def stage(opName: String): Op = {
+        val element = ev.flattenedOutputsFromO(iterator.next())
+        Op.createWith(device = device) {
+          stagingAreaPut(element, bufferSize, memoryLimit, sharedName, opName)
+        }
+      }
+      // Each element of the initial fill is staged only after the previous one, so that they keep their order.
+      val initializer = (0 until bufferSize).foldLeft(Option.empty[Op])((previous, i) => {
+        Some(Op.createWith(controlDependencies = previous.toSet)(stage(s"Fill$i")))
+      }).get
+      val update = stage("Update")
+      val (next, size, clear) = Op.createWith(device = device) {
+        val unstaged = stagingAreaGet(dataTypes, bufferSize, memoryLimit, sharedName)
+        unstaged.zip(shapes).foreach(o => o._1.setShape(o._2))
+        (ev.unflattenOutputs(iterator.outputDataTypes, unstaged),
+            stagingAreaSize(dataTypes, bufferSize, memoryLimit, sharedName),
+            stagingAreaClear(dataTypes, bufferSize, memoryLimit, sharedName))
+      }
+      new DevicePrefetcher[O](
+        device, bufferSize, next, ControlFlow.group(Set(initializer), "Initializer"), update, size, clear)
+    }
+  }
+
+  /** Creates an op that stages `values` in the staging area with shared name `sharedName`, blocking while the area is
+    * full.
+    *
+    * @param  values      Values to stage.
+    * @param  capacity    Maximum number of elements in the staging area.
+    * @param  memoryLimit Maximum number of bytes in the staging area, or `0` for no limit.
+    * @param  sharedName  Shared name of the staging area.
+    * @param  name        Name for the created op.
+    * @return Created op.
+    */
+  private[data] def stagingAreaPut(
+      values: Seq[Output], capacity: Int, memoryLimit: Long, sharedName: String, name: String = "Stage"): Op = {
+    Op.Builder(opType = "Stage", name = name)
+        .addInputList(values)
+        .setAttribute("capacity", capacity.toLong)
+        .setAttribute("memory_limit", memoryLimit)
+        .setAttribute("container", "")
+        .setAttribute("shared_name", sharedName)
+        .build()
+  }
+
+  /** Creates an op that removes and returns the oldest element of the staging area with shared name `sharedName`,
+    * blocking while the area is empty.
+    *
+    * @param  dataTypes   Data types of the staged values.
+    * @param  capacity    Maximum number of elements in the staging area.
+    * @param  memoryLimit Maximum number of bytes in the staging area, or `0` for no limit.
+    * @param  sharedName  Shared name of the staging area.
+    * @param  name        Name for the created op.
+    * @return Created op outputs.
+    */
+  private[data] def stagingAreaGet(
+      dataTypes: Seq[DataType], capacity: Int, memoryLimit: Long, sharedName: String,
+      name: String = "Unstage"): Seq[Output] = {
+    Op.Builder(opType = "Unstage", name = name)
+        .setAttribute("capacity", capacity.toLong)
+        .setAttribute("memory_limit", memoryLimit)
+        .setAttribute("dtypes", dataTypes.toArray)
+        .setAttribute("container", "")
+        .setAttribute("shared_name", sharedName)
+        .build().outputs.toSeq
+  }
+
+  /** Creates an op that returns the number of elements in the staging area with shared name `sharedName`.
+    *
+    * @param  dataTypes   Data types of the staged values.
+    * @param  capacity    Maximum number of elements in the staging area.
+    * @param  memoryLimit Maximum number of bytes in the staging area, or `0` for no limit.
+    * @param  sharedName  Shared name of the staging area.
+    * @param  name        Name for the created op.
+    * @return Created op output, which is an `INT32` scalar.
+    */
+  private[data] def stagingAreaSize(
+      dataTypes: Seq[DataType], capacity: Int, memoryLimit: Long, sharedName: String,
+      name: String = "StageSize"): Output = {
+    Op.Builder(opType = "StageSize", name = name)
+        .setAttribute("capacity", capacity.toLong)
+        .setAttribute("memory_limit", memoryLimit)
+        .setAttribute("dtypes", dataTypes.toArray)
+        .setAttribute("container", "")
+        .setAttribute("shared_name", sharedName)
+        .build().outputs(0)
+  }
+
+  /** Creates an op that removes all elements from the staging area with shared name `sharedName`.
+    *
+    * @param  dataTypes   Data types of the staged values.
+    * @param  capacity    Maximum number of elements in the staging area.
+    * @param  memoryLimit Maximum number of bytes in the staging area, or `0` for no limit.
+    * @param  sharedName  Shared name of the staging area.
+    * @param  name        Name for the created op.
+    * @return Created op.
+    */
+  private[data] def stagingAreaClear(
+      dataTypes: Seq[DataType], capacity: Int, memoryLimit: Long, sharedName: String,
+      name: String = "StageClear"): Op = {
+    Op.Builder(opType = "StageClear", name = name)
+        .setAttribute("capacity", capacity.toLong)
+        .setAttribute("memory_limit", memoryLimit)
+        .setAttribute("dtypes", dataTypes.toArray)
+        .setAttribute("container", "")
+        .setAttribute("shared_name", sharedName)
+        .build()
+  }
+}
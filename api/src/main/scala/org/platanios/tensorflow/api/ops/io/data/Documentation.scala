@@ -27,12 +27,16 @@ private[ops] trait Documentation
         with FilterDataset.Documentation
         with FlatMapDataset.Documentation
         with GroupByWindowDataset.Documentation
+        with BucketBySequenceLengthDataset.Documentation
         with IgnoreErrorsDataset.Documentation
+        with InterleaveDataset.Documentation
         with MapDataset.Documentation
+        with MapAndBatchDataset.Documentation
         with PaddedBatchDataset.Documentation
         with PrefetchDataset.Documentation
         with RangeDataset.Documentation
         with RepeatDataset.Documentation
         with ShuffleDataset.Documentation
+        with StatsDataset.Documentation
         with TakeDataset.Documentation
         with ZipDataset.Documentation
@@ -0,0 +1,279 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.io.data
+
+import org.platanios.tensorflow.api.core.Graph
+import org.platanios.tensorflow.api.core.client.{Fetchable, Session, SessionConfig}
+import org.platanios.tensorflow.api.io.events.SummaryFileWriter
+import org.platanios.tensorflow.api.ops.{Op, Output}
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{Session => NativeSession}
+
+import com.google.protobuf.ByteString
+import org.tensorflow.framework.Summary
+
+/** Iterator over the elements of a [[Dataset]] that returns them directly as tensors, without requiring a session run
+  * (and a corresponding crossing of the JNI boundary) for each element.
+  *
+  * The dataset is built in a private graph, along with an iterator over it, which is initialized once, in a private
+  * session. The op that gets the next element of that iterator is then run natively, and each element is handed back
+  * to the JVM as a set of tensor handles. If `prefetchSize` is positive, up to that many elements are produced ahead of
+  * time on native threads, so that the input pipeline runs concurrently with the consumer of its elements.
+  *
+  * Instead of fixing the prefetch size and the number of producing threads, they can be autotuned at runtime: whenever
+  * the consumer has to wait for an element, either a thread is added (if all threads were busy) or the prefetch buffer
+  * is grown, within the limits specified by [[EagerIterator.Autotuning]]. The chosen values, along with other
+  * statistics, are available through [[statistics]], so that they can be fixed in later runs.
+  *
+  * If the iterator is created with `collectStats` set to `true`, a [[StatsAggregator]] is also associated with it, and
+  * the statistics recorded by the individual stages of the dataset (e.g., using
+  * [[StatsDataset.StatsDatasetOps.stageStats]]) can be obtained at any time using [[statsSummary]], or written to an
+  * event file using [[writeStats]].
+  *
+  * Eager iterators are created using [[Dataset.createEagerIterator]] and must be closed once they are not needed
+  * anymore, which also closes their private graph and session. Note that, because the dataset is built in a private
+  * graph, it cannot depend on outputs of other graphs (e.g., [[OutputDataset]]s that were created from symbolic
+  * tensors).
+  *
+  * @param  prefetchSize   Number of elements produced ahead of time, or `0` if each element is produced when it is
+  *                        requested.
+  * @param  graph          Private graph that contains the dataset and the iterator ops.
+  * @param  session        Private session in which the iterator ops are run.
+  * @param  resultsBuilder Function used to build the elements from the fetched tensors.
+  * @param  statsSummaryOp Op output that returns a snapshot of the statistics recorded by the dataset stages, if
+  *                        collecting them.
+  * @param  nativeHandle   Handle to the native dataset iterator object.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class EagerIterator[T] private[data](
+    val prefetchSize: Int,
+    private[this] val graph: Graph,
+    private[this] val session: Session,
+    private[this] val resultsBuilder: Seq[Tensor] => T,
+    private[this] val statsSummaryOp: Option[Output],
+    private[this] var nativeHandle: Long
+) extends scala.collection.Iterator[T] with Closeable {
+  private[this] object NativeHandleLock
+  private[this] var nextElement: Option[T] = None
+  private[this] var exhausted: Boolean = false
+
+  // Keep track of references in the Scala side and notify the native library when the iterator is not referenced
+  // anymore anywhere in the Scala side. This will let the native library free the allocated resources and prevent a
+  // potential memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Returns `true` if the dataset has more elements. This blocks until the next element has been produced.
+    *
+    * @throws IllegalStateException If this iterator has already been closed.
+    */
+  @throws[IllegalStateException]
+  override def hasNext: Boolean = NativeHandleLock.synchronized {
+    if (nextElement.isEmpty && !exhausted) {
+      if (nativeHandle == 0)
+        throw new IllegalStateException("close() has been called on the eager iterator.")
+      Option(NativeSession.datasetIteratorNext(nativeHandle)) match {
+        case Some(tensorHandles) => nextElement = Some(resultsBuilder(tensorHandles.map(Tensor.fromNativeHandle)))
+        case None => exhausted = true
+      }
+    }
+    nextElement.isDefined
+  }
+
+  /** Returns the next element of the dataset. This blocks until the next element has been produced.
+    *
+    * @throws NoSuchElementException If the dataset has no more elements.
+    * @throws IllegalStateException  If this iterator has already been closed.
+    */
+  @throws[NoSuchElementException]
+  @throws[IllegalStateException]
+  override def next(): T = NativeHandleLock.synchronized {
+    if (!hasNext)
+      throw new NoSuchElementException("The dataset of the eager iterator has no more elements.")
+    val element = nextElement.get
+    nextElement = None
+    element
+  }
+
+  /** Returns the number of elements that have been produced ahead of time and are currently buffered natively. */
+  def bufferedElements: Int = NativeHandleLock.synchronized {
+    if (nativeHandle == 0) 0 else NativeSession.datasetIteratorBufferedElements(nativeHandle)
+  }
+
+  /** Returns a snapshot of the statistics of this iterator, including its current (possibly autotuned) prefetch size
+    * and number of threads.
+    *
+    * @throws IllegalStateException If this iterator has already been closed.
+    */
+  @throws[IllegalStateException]
+  def statistics: EagerIterator.Statistics = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("close() has been called on the eager iterator.")
+    val values = NativeSession.datasetIteratorStatistics(nativeHandle)
+    EagerIterator.Statistics(
+      prefetchSize = values(0).toInt, numThreads = values(1).toInt, elementsProduced = values(2),
+      bufferedElements = values(3), bufferedBytes = values(4), peakBufferedBytes = values(5),
+      consumerWaits = values(6), consumerWaitMicros = values(7), producerMicros = values(8))
+  }
+
+  /** Returns a snapshot of the statistics recorded by the stages of the dataset (e.g., their latency and the number
+    * of bytes they produced), as a `Summary` protocol buffer.
+    *
+    * @throws IllegalStateException If this iterator has already been closed, or if it was not created with
+    *                               `collectStats` set to `true`.
+    */
+  @throws[IllegalStateException]
+  def statsSummary(): Summary = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("close() has been called on the eager iterator.")
+    val summaryOp = statsSummaryOp.getOrElse(throw new IllegalStateException(
+      "The eager iterator was not created with 'collectStats' set to 'true'."))
+    val serialized = session.run(fetches = summaryOp).scalar.asInstanceOf[String]
+    Summary.parseFrom(ByteString.copyFrom(serialized.getBytes("ISO-8859-1")))
+  }
+
+  /** Writes a snapshot of the statistics recorded by the stages of the dataset to `writer`, for the provided step.
+    *
+    * @throws IllegalStateException If this iterator has already been closed, or if it was not created with
+    *                               `collectStats` set to `true`.
+    */
+  @throws[IllegalStateException]
+  def writeStats(writer: SummaryFileWriter, step: Long = 0L): Unit = {
+    writer.writeSummary(statsSummary(), step)
+  }
+
+  /** Closes this iterator, along with its private session and graph, and releases any resources associated with them.
+    * This waits for the element being produced ahead of time, if any. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      NativeSession.deleteDatasetIterator(nativeHandle)
+      nativeHandle = 0
+      nextElement = None
+      session.close()
+      graph.close()
+    }
+  }
+}
+
+object EagerIterator {
+  /** Limits within which the prefetch size and the number of producing threads of an eager iterator are autotuned.
+    *
+    * @param  maxPrefetchSize  Maximum number of elements produced ahead of time.
+    * @param  maxThreads       Maximum number of native threads producing elements. Note that, with more than one
+    *                          thread, elements may be produced out of order.
+    * @param  maxBufferedBytes Maximum number of bytes of buffered elements, or `0` for no limit.
+    */
+  case class Autotuning(maxPrefetchSize: Int = 64, maxThreads: Int = 1, maxBufferedBytes: Long = 0L) {
+    require(maxPrefetchSize > 0, s"'maxPrefetchSize' (= $maxPrefetchSize) must be positive.")
+    require(maxThreads > 0, s"'maxThreads' (= $maxThreads) must be positive.")
+    require(maxBufferedBytes >= 0, s"'maxBufferedBytes' (= $maxBufferedBytes) must be non-negative.")
+  }
+
+  /** Snapshot of the statistics of an eager iterator.
+    *
+    * @param  prefetchSize       Current prefetch size.
+    * @param  numThreads         Current number of native threads producing elements.
+    * @param  elementsProduced   Number of elements produced so far.
+    * @param  bufferedElements   Number of elements currently buffered.
+    * @param  bufferedBytes      Number of bytes of the elements currently buffered.
+    * @param  peakBufferedBytes  Maximum number of bytes of buffered elements so far.
+    * @param  consumerWaits      Number of times the consumer had to wait for an element.
+    * @param  consumerWaitMicros Total time, in microseconds, that the consumer waited for elements.
+    * @param  producerMicros     Total time, in microseconds, spent producing elements, summed over all threads.
+    */
+  case class Statistics(
+      prefetchSize: Int, numThreads: Int, elementsProduced: Long, bufferedElements: Long, bufferedBytes: Long,
+      peakBufferedBytes: Long, consumerWaits: Long, consumerWaitMicros: Long, producerMicros: Long)
+
+  /** Creates a new [[EagerIterator]] over the elements of `dataset`.
+    *
+    * @param  dataset       Dataset over whose elements to iterate.
+    * @param  prefetchSize  Number of elements to produce ahead of time, or `0` to produce each element when it is
+    *                       requested. If autotuning, this is the initial value.
+    * @param  sessionConfig Optional configuration for the private session in which the iterator ops are run.
+    * @param  numThreads    Number of native threads producing elements, if `prefetchSize` is positive. If autotuning,
+    *                       this is the initial value.
+    * @param  autotuning    Optional limits within which to autotune the prefetch size and the number of threads.
+    * @param  collectStats  If `true`, a [[StatsAggregator]] is associated with the iterator.
+    * @return Created eager iterator.
+    * @throws IllegalArgumentException If `prefetchSize` is negative or `numThreads` is not positive.
+    */
+  @throws[IllegalArgumentException]
+  private[data] def apply[T, O, D, S](
+      dataset: Dataset[T, O, D, S], prefetchSize: Int, sessionConfig: Option[SessionConfig], numThreads: Int = 1,
+      autotuning: Option[Autotuning] = None, collectStats: Boolean = false
+  )(implicit evFetchable: Fetchable.Aux[O, T]): EagerIterator[T] = {
+    create(dataset, prefetchSize, sessionConfig, evFetchable.resultsBuilder _, numThreads, autotuning, collectStats)
+  }
+
+  /** Creates a new [[EagerIterator]] over the elements of `dataset`, which are built by `resultsBuilder` from the
+    * structure of the symbolic elements of `dataset` and from the fetched tensors.
+    *
+    * @param  dataset        Dataset over whose elements to iterate.
+    * @param  prefetchSize   Number of elements to produce ahead of time, or `0` to produce each element when it is
+    *                        requested. If autotuning, this is the initial value.
+    * @param  sessionConfig  Optional configuration for the private session in which the iterator ops are run.
+    * @param  resultsBuilder Function used to build the elements.
+    * @param  numThreads     Number of native threads producing elements, if `prefetchSize` is positive. If
+    *                        autotuning, this is the initial value.
+    * @param  autotuning     Optional limits within which to autotune the prefetch size and the number of threads.
+    * @param  collectStats   If `true`, a [[StatsAggregator]] is associated with the iterator.
+    * @return Created eager iterator.
+    * @throws IllegalArgumentException If `prefetchSize` is negative or `numThreads` is not positive.
+    */
+  @throws[IllegalArgumentException]
+  private[data] def create[T, O, D, S, R](
+      dataset: Dataset[T, O, D, S], prefetchSize: Int, sessionConfig: Option[SessionConfig],
+      resultsBuilder: (O, Seq[Tensor]) => R, numThreads: Int = 1, autotuning: Option[Autotuning] = None,
+      collectStats: Boolean = false
+  )(implicit evFetchable: Fetchable[O]): EagerIterator[R] = {
+    require(prefetchSize >= 0, s"'prefetchSize' (= $prefetchSize) must be non-negative.")
+    require(numThreads > 0, s"'numThreads' (= $numThreads) must be positive.")
+    val graph = Graph()
+    try {
+      val (initializers, next, statsSummaryOp) = Op.createWith(graph) {
+        val iterator = dataset.createInitializableIterator(name = s"${dataset.name}/EagerIterator")
+        if (collectStats) {
+          val aggregator = StatsAggregator(name = s"${dataset.name}/EagerIterator/StatsAggregator")
+          val setAggregator = iterator.setStatsAggregator(aggregator)
+          (Set(iterator.initializer, setAggregator), iterator.next(), Some(aggregator.summary()))
+        } else {
+          (Set(iterator.initializer), iterator.next(), None)
+        }
+      }
+      val session = Session(graph, sessionConfig = sessionConfig)
+      try {
+        session.run(targets = initializers)
+        val fetches = evFetchable.fetches(next)
+        val nativeHandle = NativeSession.allocateDatasetIterator(
+          session.nativeHandle, fetches.map(_.op.nativeHandle).toArray, fetches.map(_.index).toArray, prefetchSize,
+          numThreads, autotuning.isDefined, autotuning.map(_.maxPrefetchSize).getOrElse(0),
+          autotuning.map(_.maxThreads).getOrElse(0), autotuning.map(_.maxBufferedBytes).getOrElse(0L))
+        new EagerIterator[R](
+          prefetchSize, graph, session, tensors => resultsBuilder(next, tensors), statsSummaryOp, nativeHandle)
+      } catch {
+        case t: Throwable =>
+          session.close()
+          throw t
+      }
+    } catch {
+      case t: Throwable =>
+        graph.close()
+        throw t
+    }
+  }
+}
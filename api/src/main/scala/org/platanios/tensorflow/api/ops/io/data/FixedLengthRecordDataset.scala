@@ -21,6 +21,10 @@ import org.platanios.tensorflow.api.tensors.Tensor
 import org.platanios.tensorflow.api.types.{DataType, STRING}
 
 /** Dataset with elements read from binary files.
+  *
+  * Records are read sequentially, one at a time. When the records of a file are consumed directly as tensors,
+  * [[org.platanios.tensorflow.api.io.FixedLengthRecordReader]] reads them in batches, concurrently, and returns each
+  * batch as a single tensor.
   *
   * @param  filenames      [[STRING]] scalar or vector tensor containing the the name(s) of the file(s) to be read.
   * @param  recordNumBytes Number of bytes in the record.
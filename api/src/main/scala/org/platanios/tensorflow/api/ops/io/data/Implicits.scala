@@ -27,11 +27,15 @@ private[io] trait Implicits
         with FilterDataset.Implicits
         with FlatMapDataset.Implicits
         with GroupByWindowDataset.Implicits
+        with BucketBySequenceLengthDataset.Implicits
         with IgnoreErrorsDataset.Implicits
+        with InterleaveDataset.Implicits
         with MapDataset.Implicits
+        with MapAndBatchDataset.Implicits
         with PaddedBatchDataset.Implicits
         with PrefetchDataset.Implicits
         with RepeatDataset.Implicits
         with ShuffleDataset.Implicits
+        with StatsDataset.Implicits
         with TakeDataset.Implicits
         with ZipDataset.Implicits
@@ -0,0 +1,210 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.io.data
+
+import org.platanios.tensorflow.api.ops.{Basic, Function, Op, Output, OutputToTensor}
+
+/** Dataset that wraps the application of the `interleave` op.
+  *
+  * $OpDocDatasetInterleave
+  *
+  * @param  inputDataset Input dataset.
+  * @param  function     Mapping function.
+  * @param  cycleLength  Number of input elements that are processed concurrently.
+  * @param  blockLength  Number of consecutive elements to produce from each input element before cycling to another
+  *                      input element.
+  * @param  name         Name for this dataset.
+  * @tparam T            Tensor type (i.e., nested structure of tensors).
+  * @tparam O            Output type (i.e., nested structure of symbolic tensors).
+  * @tparam D            Data type of the outputs (i.e., nested structure of TensorFlow data types).
+  * @tparam S            Shape type of the outputs (i.e., nested structure of TensorFlow shapes).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class InterleaveDataset[T, O, D, S, RT, RO, RD, RS](
+    inputDataset: Dataset[T, O, D, S],
+    function: (O) => Dataset[RT, RO, RD, RS],
+    cycleLength: Long,
+    blockLength: Long = 1L,
+    override val name: String = "InterleaveDataset"
+)(implicit
+    evOToT: OutputToTensor.Aux[O, T] = inputDataset.evOToT,
+    ev: Data.Aux[T, O, D, S] = inputDataset.ev,
+    evFunctionInput: Function.ArgType[O] = inputDataset.evFunctionInput,
+    evROToRT: OutputToTensor.Aux[RO, RT],
+    evR: Data.Aux[RT, RO, RD, RS],
+    evFunctionOutput: Function.ArgType[RO]
+) extends Dataset[RT, RO, RD, RS](name)(evROToRT, evR, evFunctionOutput) {
+  private[this] lazy val instantiatedFunction = {
+    Function(s"$name/Function", function).instantiate(
+      inputDataset.flattenedOutputDataTypes, inputDataset.flattenedOutputShapes)
+  }
+
+  override def createHandle(): Output = {
+    Op.Builder(opType = "InterleaveDataset", name = name)
+        .addInput(Op.createWithNameScope(name)(inputDataset.createHandle()))
+        .addInputList(instantiatedFunction.extraInputs)
+        .addInput(Op.createWithNameScope(name)(Basic.constant(cycleLength, name = "CycleLength")))
+        .addInput(Op.createWithNameScope(name)(Basic.constant(blockLength, name = "BlockLength")))
+        .setAttribute("f", instantiatedFunction)
+        .setAttribute("output_types", flattenedOutputDataTypes.toArray)
+        .setAttribute("output_shapes", flattenedOutputShapes.toArray)
+        .build().outputs(0)
+  }
+
+  override def outputDataTypes: RD = instantiatedFunction.dummyOutputs.outputDataTypes
+  override def outputShapes: RS = instantiatedFunction.dummyOutputs.outputShapes
+}
+
+/** Dataset that wraps the application of the `parallelInterleave` op.
+  *
+  * $OpDocDatasetParallelInterleave
+  *
+  * @param  inputDataset Input dataset.
+  * @param  function     Mapping function.
+  * @param  cycleLength  Number of input elements that are processed concurrently, each one on its own thread.
+  * @param  blockLength  Number of consecutive elements to produce from each input element before cycling to another
+  *                      input element.
+  * @param  sloppy       If `true`, elements are produced in the order in which they become available, rather than in
+  *                      the deterministic order of the `interleave` op.
+  * @param  name         Name for this dataset.
+  * @tparam T            Tensor type (i.e., nested structure of tensors).
+  * @tparam O            Output type (i.e., nested structure of symbolic tensors).
+  * @tparam D            Data type of the outputs (i.e., nested structure of TensorFlow data types).
+  * @tparam S            Shape type of the outputs (i.e., nested structure of TensorFlow shapes).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class ParallelInterleaveDataset[T, O, D, S, RT, RO, RD, RS](
+    inputDataset: Dataset[T, O, D, S],
+    function: (O) => Dataset[RT, RO, RD, RS],
+    cycleLength: Long,
+    blockLength: Long = 1L,
+    sloppy: Boolean = false,
+    override val name: String = "ParallelInterleaveDataset"
+)(implicit
+    evOToT: OutputToTensor.Aux[O, T] = inputDataset.evOToT,
+    ev: Data.Aux[T, O, D, S] = inputDataset.ev,
+    evFunctionInput: Function.ArgType[O] = inputDataset.evFunctionInput,
+    evROToRT: OutputToTensor.Aux[RO, RT],
+    evR: Data.Aux[RT, RO, RD, RS],
+    evFunctionOutput: Function.ArgType[RO]
+) extends Dataset[RT, RO, RD, RS](name)(evROToRT, evR, evFunctionOutput) {
+  private[this] lazy val instantiatedFunction = {
+    Function(s"$name/Function", function).instantiate(
+      inputDataset.flattenedOutputDataTypes, inputDataset.flattenedOutputShapes)
+  }
+
+  override def createHandle(): Output = {
+    Op.Builder(opType = "ParallelInterleaveDataset", name = name)
+        .addInput(Op.createWithNameScope(name)(inputDataset.createHandle()))
+        .addInputList(instantiatedFunction.extraInputs)
+        .addInput(Op.createWithNameScope(name)(Basic.constant(cycleLength, name = "CycleLength")))
+        .addInput(Op.createWithNameScope(name)(Basic.constant(blockLength, name = "BlockLength")))
+        .addInput(Op.createWithNameScope(name)(Basic.constant(sloppy, name = "Sloppy")))
+        .setAttribute("f", instantiatedFunction)
+        .setAttribute("output_types", flattenedOutputDataTypes.toArray)
+        .setAttribute("output_shapes", flattenedOutputShapes.toArray)
+        .build().outputs(0)
+  }
+
+  override def outputDataTypes: RD = instantiatedFunction.dummyOutputs.outputDataTypes
+  override def outputShapes: RS = instantiatedFunction.dummyOutputs.outputShapes
+}
+
+object InterleaveDataset {
+  private[data] trait Implicits {
+    implicit def datasetToInterleaveDatasetOps[T, O, D, S](
+        dataset: Dataset[T, O, D, S]): InterleaveDatasetOps[T, O, D, S] = {
+      InterleaveDatasetOps(dataset)
+    }
+  }
+
+  case class InterleaveDatasetOps[T, O, D, S] private[InterleaveDataset] (dataset: Dataset[T, O, D, S]) {
+    /** $OpDocDatasetInterleave
+      *
+      * @param  function    Mapping function.
+      * @param  cycleLength Number of input elements that are processed concurrently.
+      * @param  blockLength Number of consecutive elements to produce from each input element before cycling to another
+      *                     input element.
+      * @param  name        Name for the created dataset.
+      * @return Created dataset.
+      */
+    def interleave[RT, RO, RD, RS](
+        function: (O) => Dataset[RT, RO, RD, RS],
+        cycleLength: Long,
+        blockLength: Long = 1L,
+        name: String = "Interleave"
+    )(implicit
+        evROToRT: OutputToTensor.Aux[RO, RT],
+        evR: Data.Aux[RT, RO, RD, RS],
+        evFunctionOutput: Function.ArgType[RO]
+    ): Dataset[RT, RO, RD, RS] = {
+      Op.createWithNameScope(dataset.name) {
+        InterleaveDataset(dataset, function, cycleLength, blockLength, name)
+      }
+    }
+
+    /** $OpDocDatasetParallelInterleave
+      *
+      * @param  function    Mapping function.
+      * @param  cycleLength Number of input elements that are processed concurrently, each one on its own thread.
+      * @param  blockLength Number of consecutive elements to produce from each input element before cycling to another
+      *                     input element.
+      * @param  sloppy      If `true`, elements are produced in the order in which they become available, rather than
+      *                     in the deterministic order of the `interleave` op.
+      * @param  name        Name for the created dataset.
+      * @return Created dataset.
+      */
+    def parallelInterleave[RT, RO, RD, RS](
+        function: (O) => Dataset[RT, RO, RD, RS],
+        cycleLength: Long,
+        blockLength: Long = 1L,
+        sloppy: Boolean = false,
+        name: String = "ParallelInterleave"
+    )(implicit
+        evROToRT: OutputToTensor.Aux[RO, RT],
+        evR: Data.Aux[RT, RO, RD, RS],
+        evFunctionOutput: Function.ArgType[RO]
+    ): Dataset[RT, RO, RD, RS] = {
+      Op.createWithNameScope(dataset.name) {
+        ParallelInterleaveDataset(dataset, function, cycleLength, blockLength, sloppy, name)
+      }
+    }
+  }
+
+  /** @define OpDocDatasetInterleave
+    *   The dataset `interleave` op creates a new dataset by a mapping function across all elements of another dataset
+    *   and then interleaving the results.
+    *
+    *   The op is similar to `flatMap`, but it processes `cycleLength` input elements at a time, cycling through them
+    *   and producing `blockLength` consecutive elements from each one. For example, it can be used to read multiple
+    *   files concurrently:
+    *   {{{
+    *     tf.data.TensorSlicesDataset(filenames)
+    *       .interleave(f => tf.data.TFRecordDataset(f), cycleLength = 4, blockLength = 16)
+    *   }}}
+    *
+    * @define OpDocDatasetParallelInterleave
+    *   The dataset `parallelInterleave` op is a parallel version of the `interleave` op, which produces the elements of
+    *   each of the `cycleLength` input elements being processed on a separate thread.
+    *
+    *   If `sloppy` is `true`, then the elements are produced in the order in which they become available, so that a
+    *   slow input element (e.g., a file on a slow disk) does not stall the whole dataset. Otherwise, the elements are
+    *   produced in the same deterministic order as with the `interleave` op.
+    */
+  private[data] trait Documentation
+}
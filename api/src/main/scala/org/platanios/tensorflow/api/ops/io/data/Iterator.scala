@@ -16,7 +16,7 @@
 package org.platanios.tensorflow.api.ops.io.data
 
 import org.platanios.tensorflow.api.core.Shape
-import org.platanios.tensorflow.api.ops.{Op, Output}
+import org.platanios.tensorflow.api.ops.{Basic, Op, Output}
 import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
 import org.platanios.tensorflow.api.ops.io.data
 import org.platanios.tensorflow.api.types.DataType
@@ -76,6 +76,31 @@ class Iterator[T, O, D, S] private[io](
     ev.unflattenOutputs(outputDataTypes, flattenedNext)
   }
 
+  /** Creates an op that obtains the next element of this iterator and splits each one of its tensors into `numSplits`
+    * parts, along its first (i.e., batch) dimension. This is useful for distributing each batch over multiple
+    * data-parallel model replicas (e.g., one per GPU). The batch size must be divisible by `numSplits`.
+    *
+    * @param  numSplits Number of parts to split the next element into.
+    * @param  name      Name for the created ops.
+    * @return Sequence of `numSplits` nested structures of [[Output]]s, each one corresponding to a part of the next
+    *         element.
+    */
+  def nextSplit(numSplits: Int, name: String = s"$name/Next"): Seq[O] = {
+    if (numSplits == 1) {
+      Seq(next(name))
+    } else {
+      val flattenedNext = Iterator.iteratorGetNext(
+        iteratorHandle = handle,
+        outputDataTypes = flattenedOutputDataTypes,
+        outputShapes = flattenedOutputShapes,
+        name = name)
+      val flattenedSplits = Op.createWithNameScope(s"$name/Split") {
+        flattenedNext.map(Basic.splitEvenly(_, numSplits))
+      }
+      (0 until numSplits).map(i => ev.unflattenOutputs(outputDataTypes, flattenedSplits.map(_ (i))))
+    }
+  }
+
   // TODO: Add automatic disposal of iterators if necessary.
 
   /** Creates an op that destroys this iterator.
@@ -98,6 +123,37 @@ class Iterator[T, O, D, S] private[io](
     Iterator.iteratorToStringHandle(iteratorHandle = handle, name = name)
   }
 
+  /** Creates an op that associates the provided stats aggregator with this iterator.
+    *
+    * After the returned op is run, the statistics recorded by the stages of the dataset over which this iterator
+    * iterates (e.g., using [[StatsDataset.StatsDatasetOps.latencyStats]]) are aggregated in `aggregator`.
+    *
+    * @param  aggregator Stats aggregator to associate with this iterator.
+    * @param  name       Name for the created op.
+    * @return Created op.
+    */
+  def setStatsAggregator(aggregator: StatsAggregator, name: String = s"$name/SetStatsAggregator"): Op = {
+    Iterator.iteratorSetStatsAggregator(iteratorHandle = handle, statsAggregatorHandle = aggregator.handle, name = name)
+  }
+
+  /** Creates a [[DevicePrefetcher]] that keeps up to `bufferSize` elements of this iterator already copied to
+    * `device`, so that the host-to-device copies of the next elements overlap with the computation that consumes the
+    * current one.
+    *
+    * @param  device      Device on which the elements are staged (e.g., `"/GPU:0"`).
+    * @param  bufferSize  Maximum number of staged elements.
+    * @param  memoryLimit Maximum number of bytes of staged elements, or `0` for no limit.
+    * @param  name        Name for the created ops.
+    * @return Created prefetcher.
+    * @throws IllegalArgumentException If `bufferSize` is not positive or `memoryLimit` is negative.
+    */
+  @throws[IllegalArgumentException]
+  def prefetchToDevice(
+      device: String, bufferSize: Int = 2, memoryLimit: Long = 0L,
+      name: String = s"$name/PrefetchToDevice"): DevicePrefetcher[O] = {
+    DevicePrefetcher(this, device, bufferSize, memoryLimit, name)
+  }
+
   /** Returns a sequence of [[DataType]]s that correspond to the flattened data types of the nested [[Output]] structure
     * of the elements of this iterator. */
   private[this] def flattenedOutputDataTypes: Seq[DataType] = ev.flattenedDataTypes(outputDataTypes)
@@ -404,6 +460,21 @@ object Iterator {
         .build().outputs(0)
   }
 
+  /** Creates an op that associates the provided stats aggregator with the provided iterator.
+    *
+    * @param  iteratorHandle        Handle of the iterator.
+    * @param  statsAggregatorHandle Handle of the stats aggregator.
+    * @param  name                  Name for the created op.
+    * @return Created op.
+    */
+  private[io] def iteratorSetStatsAggregator(
+      iteratorHandle: Output, statsAggregatorHandle: Output, name: String = "IteratorSetStatsAggregator"): Op = {
+    Op.Builder(opType = "IteratorSetStatsAggregator", name = name)
+        .addInput(iteratorHandle)
+        .addInput(statsAggregatorHandle)
+        .build()
+  }
+
   private[ops] object Gradients {
     GradientsRegistry.registerNonDifferentiable("Iterator")
     GradientsRegistry.registerNonDifferentiable("MakeIterator")
@@ -412,5 +483,12 @@ object Iterator {
     GradientsRegistry.registerNonDifferentiable("IteratorDispose")
     GradientsRegistry.registerNonDifferentiable("IteratorToStringHandle")
     GradientsRegistry.registerNonDifferentiable("IteratorFromStringHandle")
+    GradientsRegistry.registerNonDifferentiable("IteratorSetStatsAggregator")
+    GradientsRegistry.registerNonDifferentiable("StatsAggregatorHandle")
+    GradientsRegistry.registerNonDifferentiable("StatsAggregatorSummary")
+    GradientsRegistry.registerNonDifferentiable("Stage")
+    GradientsRegistry.registerNonDifferentiable("Unstage")
+    GradientsRegistry.registerNonDifferentiable("StageSize")
+    GradientsRegistry.registerNonDifferentiable("StageClear")
   }
 }
@@ -0,0 +1,121 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.io.data
+
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.ops.{Basic, Function, Op, Output, OutputToTensor}
+
+/** Dataset that wraps the application of the `mapAndBatch` op.
+  *
+  * $OpDocDatasetMapAndBatch
+  *
+  * @param  inputDataset       Input dataset.
+  * @param  function           Mapping function.
+  * @param  batchSize          Batch size to use.
+  * @param  numParallelBatches Number of batches to create in parallel.
+  * @param  name               Name for this dataset.
+  * @tparam T                  Tensor type (i.e., nested structure of tensors).
+  * @tparam O                  Output type (i.e., nested structure of symbolic tensors).
+  * @tparam D                  Data type of the outputs (i.e., nested structure of TensorFlow data types).
+  * @tparam S                  Shape type of the outputs (i.e., nested structure of TensorFlow shapes).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class MapAndBatchDataset[T, O, D, S, RT, RO, RD, RS](
+    inputDataset: Dataset[T, O, D, S],
+    function: (O) => RO,
+    batchSize: Long,
+    numParallelBatches: Long = 1L,
+    override val name: String = "MapAndBatchDataset"
+)(implicit
+    evOToT: OutputToTensor.Aux[O, T] = inputDataset.evOToT,
+    ev: Data.Aux[T, O, D, S] = inputDataset.ev,
+    evFunctionInput: Function.ArgType[O] = inputDataset.evFunctionInput,
+    evROToRT: OutputToTensor.Aux[RO, RT],
+    evR: Data.Aux[RT, RO, RD, RS],
+    evFunctionOutput: Function.ArgType[RO]
+) extends Dataset[RT, RO, RD, RS](name)(evROToRT, evR, evFunctionOutput) {
+  private[this] lazy val instantiatedFunction = {
+    Function(s"$name/Function", function).instantiate(
+      inputDataset.flattenedOutputDataTypes, inputDataset.flattenedOutputShapes)
+  }
+
+  override def createHandle(): Output = {
+    Op.Builder(opType = "MapAndBatchDataset", name = name)
+        .addInput(Op.createWithNameScope(name)(inputDataset.createHandle()))
+        .addInputList(instantiatedFunction.extraInputs)
+        .addInput(Op.createWithNameScope(name)(Basic.constant(batchSize, name = "BatchSize")))
+        .addInput(Op.createWithNameScope(name)(Basic.constant(numParallelBatches, name = "NumParallelBatches")))
+        .setAttribute("f", instantiatedFunction)
+        .setAttribute("output_types", flattenedOutputDataTypes.toArray)
+        .setAttribute("output_shapes", flattenedOutputShapes.toArray)
+        .build().outputs(0)
+  }
+
+  private[this] lazy val (_outputDataTypes, _outputShapes): (RD, RS) = {
+    val dataTypes = evR.dataTypesFromO(instantiatedFunction.dummyOutputs)
+    (evR.unflattenDataTypes(dataTypes, instantiatedFunction.outputDataTypes),
+        evR.unflattenShapes(dataTypes, instantiatedFunction.outputShapes.map(Shape(-1) ++ _)))
+  }
+
+  override def outputDataTypes: RD = _outputDataTypes
+  override def outputShapes: RS = _outputShapes
+}
+
+object MapAndBatchDataset {
+  private[data] trait Implicits {
+    implicit def datasetToMapAndBatchDatasetOps[T, O, D, S](
+        dataset: Dataset[T, O, D, S]): MapAndBatchDatasetOps[T, O, D, S] = {
+      MapAndBatchDatasetOps(dataset)
+    }
+  }
+
+  case class MapAndBatchDatasetOps[T, O, D, S] private[MapAndBatchDataset] (dataset: Dataset[T, O, D, S]) {
+    /** $OpDocDatasetMapAndBatch
+      *
+      * @param  function           Mapping function.
+      * @param  batchSize          Batch size to use.
+      * @param  numParallelBatches Number of batches to create in parallel. Each batch is filled by `batchSize`
+      *                            concurrent invocations of `function`.
+      * @param  name               Name for the created dataset.
+      * @return Created dataset.
+      */
+    def mapAndBatch[RT, RO, RD, RS](
+        function: (O) => RO,
+        batchSize: Long,
+        numParallelBatches: Long = 1L,
+        name: String = "MapAndBatch"
+    )(implicit
+        evROToRT: OutputToTensor.Aux[RO, RT],
+        evR: Data.Aux[RT, RO, RD, RS],
+        evFunctionOutput: Function.ArgType[RO]
+    ): Dataset[RT, RO, RD, RS] = {
+      Op.createWithNameScope(dataset.name) {
+        MapAndBatchDataset(dataset, function, batchSize, numParallelBatches, name)
+      }
+    }
+  }
+
+  /** @define OpDocDatasetMapAndBatch
+    *   The dataset `mapAndBatch` op creates a new dataset by a function across all elements of another dataset and
+    *   then combining consecutive elements of the result into batches.
+    *
+    *   The op is equivalent to `dataset.map(function).batch(batchSize)`, but it writes the outputs of `function`
+    *   directly into the preallocated batch tensors, thus avoiding an extra copy of every element. `function` is
+    *   invoked in parallel for all elements of a batch.
+    */
+  private[data] trait Documentation
+}
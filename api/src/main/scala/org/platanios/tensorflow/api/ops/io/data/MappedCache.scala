@@ -0,0 +1,259 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.io.data
+
+import org.platanios.tensorflow.api.core.Graph
+import org.platanios.tensorflow.api.core.client.{Fetchable, SessionConfig}
+import org.platanios.tensorflow.api.ops.Op
+import org.platanios.tensorflow.api.tensors.Tensor
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.jni.{MappedCache => NativeMappedCache}
+
+/** Cache of the elements of a [[Dataset]] in memory-mapped files, which is written during the first pass over the
+  * dataset and replayed from the mapped files in all subsequent passes.
+  *
+  * The cache consists of one column file per element component, named `<prefix>.column-<i>`, that contains the
+  * contents of that component for all elements, stored contiguously, and of an index file, named `<prefix>.index`,
+  * that contains the shapes of all elements. The index file is written last, once the first pass over the dataset is
+  * complete, and so an interrupted first pass results in a new pass over the dataset the next time the cache is used.
+  * When replaying the cache, each element (or batch of elements) is returned as a set of tensors that are slices of the
+  * mapped column files, and so replaying involves no decoding and, whenever the slices are suitably aligned, no
+  * copying. All element components must be numeric tensors (i.e., strings are not supported).
+  *
+  * For example:
+  * {{{
+  *   val cache = tf.data.TFRecordDataset(filename).map(parse).createMappedCache("/tmp/features")
+  *   for (epoch <- 0 until numEpochs) {
+  *     val iterator = cache.epoch()
+  *     try {
+  *       iterator.foreach(element => process(element))
+  *     } finally {
+  *       iterator.close()
+  *     }
+  *   }
+  *   cache.close()
+  * }}}
+  *
+  * Mapped caches are created using [[Dataset.createMappedCache]] and must be closed once they are not needed anymore.
+  * Only a single pass over a cache that is not complete yet may be in progress at any time.
+  *
+  * @param  prefix          File prefix of the cache.
+  * @param  graph           Private graph that contains the symbolic elements used to build the replayed elements.
+  * @param  iteratorFactory Function that creates an iterator over the elements of the dataset, along with their
+  *                         tensors, which is used for writing the cache.
+  * @param  resultsBuilder  Function used to build the replayed elements from their tensors.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class MappedCache[T] private[data](
+    val prefix: String,
+    private[this] val graph: Graph,
+    private[this] val iteratorFactory: () => EagerIterator[(T, Seq[Tensor])],
+    private[this] val resultsBuilder: Seq[Tensor] => T
+) extends Closeable {
+  private[this] object NativeHandleLock
+  private[this] var readerHandle: Long = 0
+  private[this] var closed: Boolean = false
+
+  // Keep track of references in the Scala side and notify the native library when the cache is not referenced anymore
+  // anywhere in the Scala side. This will let the native library free the allocated resources and prevent a potential
+  // memory leak.
+  Disposer.add(this, () => this.close())
+
+  /** Returns `true` if the cache has been completely written (i.e., if a first pass over the dataset has completed). */
+  def isComplete: Boolean = NativeMappedCache.mappedCacheExists(prefix)
+
+  /** Returns the number of cached elements, writing the cache first, if it is not complete yet.
+    *
+    * @throws IllegalStateException If this cache has already been closed.
+    */
+  @throws[IllegalStateException]
+  def numElements: Long = NativeHandleLock.synchronized {
+    complete()
+    NativeMappedCache.mappedCacheReaderNumElements(reader())
+  }
+
+  /** Returns an iterator over all elements of the dataset. If the cache is complete, the elements are replayed from the
+    * cache, and otherwise, they are produced by the dataset and written to the cache. In the latter case, the cache
+    * becomes complete once the returned iterator has been exhausted.
+    *
+    * @return Iterator over the elements of the dataset, which must be closed if it is not exhausted.
+    * @throws IllegalStateException If this cache has already been closed.
+    */
+  @throws[IllegalStateException]
+  def epoch(): scala.collection.Iterator[T] with Closeable = {
+    if (isComplete) new ReplayIterator(batchSize = 0) else new WritingIterator
+  }
+
+  /** Returns an iterator over batches of `batchSize` consecutive cached elements, stacked along a new leading
+    * dimension, each of which is a slice of the mapped column files. The last batch is smaller if the number of cached
+    * elements is not a multiple of `batchSize`. If the cache is not complete yet, then it is first written by a full
+    * pass over the dataset.
+    *
+    * @param  batchSize Batch size to use.
+    * @return Iterator over the batches.
+    * @throws IllegalArgumentException If `batchSize` is not positive.
+    * @throws IllegalStateException    If this cache has already been closed.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IllegalStateException]
+  def batches(batchSize: Int): scala.collection.Iterator[T] with Closeable = {
+    require(batchSize > 0, s"'batchSize' (= $batchSize) must be positive.")
+    complete()
+    new ReplayIterator(batchSize)
+  }
+
+  /** Closes this cache and releases any resources associated with it. Iterators over the cache cannot be used after it
+    * has been closed, but tensors that they have already returned remain valid. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (!closed) {
+      if (readerHandle != 0) {
+        NativeMappedCache.deleteMappedCacheReader(readerHandle)
+        readerHandle = 0
+      }
+      graph.close()
+      closed = true
+    }
+  }
+
+  /** Writes the cache by a full pass over the dataset, if it is not complete yet. */
+  private[this] def complete(): Unit = {
+    if (!isComplete) {
+      val iterator = new WritingIterator
+      try {
+        iterator.foreach(_ => ())
+      } finally {
+        iterator.close()
+      }
+    }
+  }
+
+  /** Returns the handle to the native cache reader, creating it if necessary. */
+  private[this] def reader(): Long = NativeHandleLock.synchronized {
+    if (closed)
+      throw new IllegalStateException("close() has been called on the mapped cache.")
+    if (readerHandle == 0)
+      readerHandle = NativeMappedCache.newMappedCacheReader(prefix)
+    readerHandle
+  }
+
+  /** Iterator that produces the elements of the dataset and writes them to the cache. */
+  private[this] class WritingIterator extends scala.collection.Iterator[T] with Closeable {
+    if (closed)
+      throw new IllegalStateException("close() has been called on the mapped cache.")
+
+    private[this] val iterator = iteratorFactory()
+    private[this] var writerHandle: Long = {
+      try {
+        NativeMappedCache.newMappedCacheWriter(prefix)
+      } catch {
+        case t: Throwable =>
+          iterator.close()
+          throw t
+      }
+    }
+
+    override def hasNext: Boolean = {
+      if (writerHandle == 0) {
+        false
+      } else if (iterator.hasNext) {
+        true
+      } else {
+        NativeMappedCache.mappedCacheWriterFinish(writerHandle)
+        close()
+        false
+      }
+    }
+
+    override def next(): T = {
+      if (!hasNext)
+        throw new NoSuchElementException("The dataset of the mapped cache has no more elements.")
+      val (element, tensors) = iterator.next()
+      NativeMappedCache.mappedCacheWriterAppend(writerHandle, tensors.map(_.nativeHandle).toArray)
+      element
+    }
+
+    /** Closes this iterator. If it has not been exhausted, the cache remains incomplete. */
+    override def close(): Unit = {
+      if (writerHandle != 0) {
+        NativeMappedCache.deleteMappedCacheWriter(writerHandle)
+        writerHandle = 0
+      }
+      iterator.close()
+    }
+  }
+
+  /** Iterator that replays the cached elements, either one at a time, if `batchSize` is `0`, or in batches. */
+  private[this] class ReplayIterator(batchSize: Int) extends scala.collection.Iterator[T] with Closeable {
+    private[this] val numElements: Long = NativeMappedCache.mappedCacheReaderNumElements(reader())
+    private[this] var position: Long = 0L
+
+    override def hasNext: Boolean = position < numElements
+
+    override def next(): T = {
+      if (!hasNext)
+        throw new NoSuchElementException("The mapped cache has no more elements.")
+      val tensorHandles = NativeHandleLock.synchronized {
+        if (batchSize == 0) {
+          NativeMappedCache.mappedCacheReaderElement(reader(), position)
+        } else {
+          val count = math.min(batchSize.toLong, numElements - position)
+          NativeMappedCache.mappedCacheReaderBatch(reader(), position, count)
+        }
+      }
+      position += math.max(batchSize, 1)
+      resultsBuilder(tensorHandles.map(Tensor.fromNativeHandle))
+    }
+
+    override def close(): Unit = ()
+  }
+}
+
+private[data] object MappedCache {
+  /** Creates a new [[MappedCache]] for the elements of `dataset`.
+    *
+    * @param  dataset       Dataset whose elements to cache.
+    * @param  prefix        File prefix of the cache.
+    * @param  prefetchSize  Number of elements to produce ahead of time while writing the cache, or `0` to produce each
+    *                       element when it is requested.
+    * @param  sessionConfig Optional configuration for the private session in which the dataset is iterated over while
+    *                       writing the cache.
+    * @return Created mapped cache.
+    * @throws IllegalArgumentException If `prefetchSize` is negative.
+    */
+  @throws[IllegalArgumentException]
+  def apply[T, O, D, S](
+      dataset: Dataset[T, O, D, S], prefix: String, prefetchSize: Int, sessionConfig: Option[SessionConfig]
+  )(implicit evFetchable: Fetchable.Aux[O, T]): MappedCache[T] = {
+    require(prefetchSize >= 0, s"'prefetchSize' (= $prefetchSize) must be non-negative.")
+    val graph = Graph()
+    val structure = {
+      try {
+        Op.createWith(graph)(dataset.createInitializableIterator(name = s"${dataset.name}/MappedCache").next())
+      } catch {
+        case t: Throwable =>
+          graph.close()
+          throw t
+      }
+    }
+    new MappedCache[T](
+      prefix, graph,
+      () => EagerIterator.create(
+        dataset, prefetchSize, sessionConfig,
+        (outputs: O, tensors: Seq[Tensor]) => (evFetchable.resultsBuilder(outputs, tensors), tensors)),
+      tensors => evFetchable.resultsBuilder(structure, tensors))
+  }
+}
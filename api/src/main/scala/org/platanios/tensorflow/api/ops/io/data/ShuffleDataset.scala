@@ -81,6 +81,12 @@ object ShuffleDataset {
 
   /** @define OpDocDatasetShuffle
     *   The dataset `shuffle` op randomly shuffles the elements of a dataset.
+    *
+    *   The op buffers up to `bufferSize` elements of its input dataset, and so, when shuffling large decoded elements
+    *   (e.g., images), it is usually better to shuffle the encoded records before decoding them. For indexed TFRecord
+    *   files, [[org.platanios.tensorflow.api.io.IndexedTFRecordReader.shuffled]] performs such a shuffle with bounded
+    *   memory, by shuffling the order of blocks of records across files and then shuffling the encoded records in a
+    *   small buffer.
     */
   private[data] trait Documentation
 }
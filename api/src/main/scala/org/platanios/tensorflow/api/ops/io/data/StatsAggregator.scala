@@ -0,0 +1,62 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.io.data
+
+import org.platanios.tensorflow.api.ops.{Op, Output}
+
+/** Resource that aggregates the statistics recorded by the stages of an input pipeline (e.g., using
+  * [[StatsDataset.StatsDatasetOps.latencyStats]] and [[StatsDataset.StatsDatasetOps.bytesProducedStats]]), while
+  * iterating over it using an [[Iterator]] that has been associated with the aggregator using
+  * [[Iterator.setStatsAggregator]].
+  *
+  * The statistics are recorded natively, within the kernels of the dataset stages, and a snapshot of them can be
+  * obtained at any time as a serialized `Summary` protocol buffer, using [[summary]]. Such snapshots can then be
+  * written to event files using a summary file writer.
+  *
+  * @param  handle Handle of the stats aggregator resource.
+  * @param  name   Name for this stats aggregator.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class StatsAggregator private[data](val handle: Output, val name: String) {
+  /** Creates an op that returns a snapshot of the aggregated statistics, as a serialized `Summary` protocol buffer.
+    *
+    * @param  name Name for the created op.
+    * @return Created op output, which is a `STRING` scalar.
+    */
+  def summary(name: String = s"${this.name}/Summary"): Output = {
+    Op.Builder(opType = "StatsAggregatorSummary", name = name)
+        .addInput(handle)
+        .build().outputs(0)
+  }
+}
+
+object StatsAggregator {
+  /** Creates a new [[StatsAggregator]].
+    *
+    * @param  sharedName If non-empty, the aggregator is shared under this name across sessions that share the same
+    *                    devices (e.g., when using remote servers).
+    * @param  name       Name for the stats aggregator.
+    * @return Created stats aggregator.
+    */
+  def apply(sharedName: String = "", name: String = "StatsAggregator"): StatsAggregator = {
+    val handle = Op.Builder(opType = "StatsAggregatorHandle", name = name)
+        .setAttribute("container", "")
+        .setAttribute("shared_name", sharedName)
+        .build().outputs(0)
+    new StatsAggregator(handle, name)
+  }
+}
@@ -0,0 +1,150 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.io.data
+
+import org.platanios.tensorflow.api.ops.{Basic, Op, Output}
+
+/** Dataset that wraps the application of the `latencyStats` op.
+  *
+  * $OpDocDatasetLatencyStats
+  *
+  * @param  inputDataset Input dataset.
+  * @param  tag          Tag under which the statistics are recorded.
+  * @param  name         Name for this dataset.
+  * @tparam T            Tensor type (i.e., nested structure of tensors).
+  * @tparam O            Output type (i.e., nested structure of symbolic tensors).
+  * @tparam D            Data type of the outputs (i.e., nested structure of TensorFlow data types).
+  * @tparam S            Shape type of the outputs (i.e., nested structure of TensorFlow shapes).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class LatencyStatsDataset[T, O, D, S](
+    inputDataset: Dataset[T, O, D, S],
+    tag: String,
+    override val name: String = "LatencyStatsDataset"
+) extends Dataset[T, O, D, S](name)(inputDataset.evOToT, inputDataset.ev, inputDataset.evFunctionInput) {
+  override def createHandle(): Output = {
+    Op.Builder(opType = "LatencyStatsDataset", name = name)
+        .addInput(Op.createWithNameScope(name)(inputDataset.createHandle()))
+        .addInput(Op.createWithNameScope(name)(Basic.constant(tag, name = "Tag")))
+        .setAttribute("output_types", flattenedOutputDataTypes.toArray)
+        .setAttribute("output_shapes", flattenedOutputShapes.toArray)
+        .build().outputs(0)
+  }
+
+  override def outputDataTypes: D = inputDataset.outputDataTypes
+  override def outputShapes: S = inputDataset.outputShapes
+}
+
+/** Dataset that wraps the application of the `bytesProducedStats` op.
+  *
+  * $OpDocDatasetBytesProducedStats
+  *
+  * @param  inputDataset Input dataset.
+  * @param  tag          Tag under which the statistics are recorded.
+  * @param  name         Name for this dataset.
+  * @tparam T            Tensor type (i.e., nested structure of tensors).
+  * @tparam O            Output type (i.e., nested structure of symbolic tensors).
+  * @tparam D            Data type of the outputs (i.e., nested structure of TensorFlow data types).
+  * @tparam S            Shape type of the outputs (i.e., nested structure of TensorFlow shapes).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class BytesProducedStatsDataset[T, O, D, S](
+    inputDataset: Dataset[T, O, D, S],
+    tag: String,
+    override val name: String = "BytesProducedStatsDataset"
+) extends Dataset[T, O, D, S](name)(inputDataset.evOToT, inputDataset.ev, inputDataset.evFunctionInput) {
+  override def createHandle(): Output = {
+    Op.Builder(opType = "BytesProducedStatsDataset", name = name)
+        .addInput(Op.createWithNameScope(name)(inputDataset.createHandle()))
+        .addInput(Op.createWithNameScope(name)(Basic.constant(tag, name = "Tag")))
+        .setAttribute("output_types", flattenedOutputDataTypes.toArray)
+        .setAttribute("output_shapes", flattenedOutputShapes.toArray)
+        .build().outputs(0)
+  }
+
+  override def outputDataTypes: D = inputDataset.outputDataTypes
+  override def outputShapes: S = inputDataset.outputShapes
+}
+
+object StatsDataset {
+  private[data] trait Implicits {
+    implicit def datasetToStatsDatasetOps[T, O, D, S](dataset: Dataset[T, O, D, S]): StatsDatasetOps[T, O, D, S] = {
+      StatsDatasetOps(dataset)
+    }
+  }
+
+  case class StatsDatasetOps[T, O, D, S] private[StatsDataset] (dataset: Dataset[T, O, D, S]) {
+    /** $OpDocDatasetLatencyStats
+      *
+      * @param  tag  Tag under which the statistics are recorded.
+      * @param  name Name for the created dataset.
+      * @return Created dataset.
+      */
+    def latencyStats(tag: String, name: String = "LatencyStats"): Dataset[T, O, D, S] = {
+      Op.createWithNameScope(dataset.name) {
+        LatencyStatsDataset(dataset, tag, name)
+      }
+    }
+
+    /** $OpDocDatasetBytesProducedStats
+      *
+      * @param  tag  Tag under which the statistics are recorded.
+      * @param  name Name for the created dataset.
+      * @return Created dataset.
+      */
+    def bytesProducedStats(tag: String, name: String = "BytesProducedStats"): Dataset[T, O, D, S] = {
+      Op.createWithNameScope(dataset.name) {
+        BytesProducedStatsDataset(dataset, tag, name)
+      }
+    }
+
+    /** Records both the latency and the size of the elements produced by this dataset, under the tags
+      * `<stage>/Latency` and `<stage>/BytesProduced`, respectively.
+      *
+      * Applying this op after each stage of an input pipeline allows telling which stage is slow: the latency of each
+      * stage includes the time spent waiting on the stages before it, and so the time spent computing in a stage is the
+      * difference between its latency and the latency of the previous stage. For example:
+      * {{{
+      *   tf.data.TFRecordDataset(filenames).stageStats("Read")
+      *     .map(decode).stageStats("Decode")
+      *     .shuffle(10000).stageStats("Shuffle")
+      * }}}
+      *
+      * @param  stage Name of the stage, used as a prefix for the tags of the statistics.
+      * @param  name  Name for the created dataset.
+      * @return Created dataset.
+      */
+    def stageStats(stage: String, name: String = "StageStats"): Dataset[T, O, D, S] = {
+      Op.createWithNameScope(dataset.name) {
+        BytesProducedStatsDataset(
+          LatencyStatsDataset(dataset, s"$stage/Latency", s"$name/Latency"),
+          s"$stage/BytesProduced", s"$name/BytesProduced")
+      }
+    }
+  }
+
+  /** @define OpDocDatasetLatencyStats
+    *   The dataset `latencyStats` op records the latency of producing each element of a dataset, in the
+    *   [[StatsAggregator]] associated with the iterator over the dataset (if any).
+    *
+    * @define OpDocDatasetBytesProducedStats
+    *   The dataset `bytesProducedStats` op records the size, in bytes, of each element of a dataset, in the
+    *   [[StatsAggregator]] associated with the iterator over the dataset (if any).
+    */
+  private[data] trait Documentation
+}
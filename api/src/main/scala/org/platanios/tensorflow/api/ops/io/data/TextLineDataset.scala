@@ -25,6 +25,10 @@ import org.platanios.tensorflow.api.types.{DataType, STRING}
   *
   * **Note:** New-line characters are stripped from the output.
   *
+  * For delimiter-separated files (e.g., CSV or TSV files), [[org.platanios.tensorflow.api.io.CSVReader]] avoids
+  * splitting them into lines and parsing each line separately, by decoding the requested columns natively and directly
+  * into batch tensors.
+  *
   * @param  filenames       [[STRING]] scalar or vector tensor containing the the name(s) of the file(s) to be read.
   * @param  compressionType Compression type for the file.
   * @param  bufferSize      Number of bytes to buffer while reading from the file.
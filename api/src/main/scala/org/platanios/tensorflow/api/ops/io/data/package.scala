@@ -18,6 +18,4 @@ package org.platanios.tensorflow.api.ops.io
 /**
   * @author Emmanouil Antonios Platanios
   */
-package object data {
-  // TODO: [DATA] Add support for "interleave".
-}
+package object data
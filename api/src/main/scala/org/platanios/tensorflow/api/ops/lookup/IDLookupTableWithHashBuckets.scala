@@ -61,7 +61,7 @@ import org.platanios.tensorflow.api.types.{DataType, INT64, STRING}
   * @author Emmanouil Antonios Platanios
   */
 class IDLookupTableWithHashBuckets(
-    val table: HashTable,
+    val table: InitializableLookupTable,
     val numOOVBuckets: Int,
     val hashSpecification: HashSpecification = FAST_HASH,
     override val keysDataType: DataType = null,
@@ -145,7 +145,7 @@ class IDLookupTableWithHashBuckets(
 
 object IDLookupTableWithHashBuckets {
   def apply(
-      table: HashTable, numOOVBuckets: Int, hashSpecification: HashSpecification = FAST_HASH,
+      table: InitializableLookupTable, numOOVBuckets: Int, hashSpecification: HashSpecification = FAST_HASH,
       keysDataType: DataType = null, name: String = "IDLookupTableWithHashBuckets"): IDLookupTableWithHashBuckets = {
     new IDLookupTableWithHashBuckets(table, numOOVBuckets, hashSpecification, keysDataType, name)
   }
@@ -83,13 +83,15 @@ private[lookup] trait Lookup {
     * @param  numOOVBuckets     Number of out-of-vocabulary buckets.
     * @param  hashSpecification Hashing function specification to use.
     * @param  keysDataType      Data type of the table keys.
+    * @param  lockFree          If `true`, a [[LockFreeHashTable]] is used instead of a [[HashTable]], which allows for
+    *                           concurrent lookups without any locking.
     * @param  name              Name for the created table.
     * @return Created table.
     */
   def indexTableFromFile(
       filename: String, delimiter: String = "\t", vocabularySize: Int = -1, defaultValue: Int = -1,
       numOOVBuckets: Int = 0, hashSpecification: HashSpecification = FAST_HASH,
-      keysDataType: DataType = STRING, name: String = "IndexTableFromFile"): LookupTable = {
+      keysDataType: DataType = STRING, lockFree: Boolean = false, name: String = "IndexTableFromFile"): LookupTable = {
     Op.createWithNameScope(name) {
       Op.createWithNameScope("HashTable") {
         val sharedName = {
@@ -101,7 +103,62 @@ private[lookup] trait Lookup {
         val initializer = LookupTableTextFileInitializer(
           filename, if (keysDataType.isInteger) INT64 else keysDataType, INT64,
           TextFileWholeLine, TextFileLineNumber, delimiter, vocabularySize)
-        val table = HashTable(initializer, defaultValue, sharedName, name = "Table")
+        val table = {
+          if (lockFree)
+            LockFreeHashTable(initializer, defaultValue, sharedName = s"lock_free_$sharedName", name = "Table")
+          else
+            HashTable(initializer, defaultValue, sharedName, name = "Table")
+        }
+        if (numOOVBuckets > 0)
+          IDLookupTableWithHashBuckets(table, numOOVBuckets, hashSpecification, table.keysDataType)
+        else
+          table
+      }
+    }
+  }
+
+  /** Creates a lookup table that converts tensors into integer IDs, using a memory-mapped table file.
+    *
+    * This function is similar to [[indexTableFromFile]], but it uses a [[MappedHashTable]] that is memory-mapped from
+    * a table file built using [[buildMappedHashTable]], instead of parsing a vocabulary text file and building a hash
+    * table in memory. This makes initializing the table much faster for large vocabularies, and allows multiple
+    * processes to share the memory used by the table.
+    *
+    * Example usage:
+    *
+    * If we have a vocabulary file `"test.txt"` with the following content:
+    * {{{
+    *   emerson
+    *   lake
+    *   palmer
+    * }}}
+    * Then, we can use the following code to build a table file and create a table mapping `"emerson" -> 0`,
+    * `"lake" -> 1`, and `"palmer" -> 2`:
+    * {{{
+    *   // Run once to build the table file.
+    *   val build = tf.buildMappedHashTable("test.txt", "test.table", TextFileWholeLine, TextFileLineNumber)
+    *   val table = tf.indexTableFromMappedFile("test.table")
+    * }}}
+    *
+    * @param  filename          Filename of the table file to be used for initialization. The path must be accessible
+    *                           from wherever the graph is initialized (e.g., trainer or evaluation workers).
+    * @param  defaultValue      Default value to use if a key is missing from the table.
+    * @param  numOOVBuckets     Number of out-of-vocabulary buckets.
+    * @param  hashSpecification Hashing function specification to use.
+    * @param  keysDataType      Data type of the table keys.
+    * @param  name              Name for the created table.
+    * @return Created table.
+    */
+  def indexTableFromMappedFile(
+      filename: String, defaultValue: Int = -1, numOOVBuckets: Int = 0,
+      hashSpecification: HashSpecification = FAST_HASH, keysDataType: DataType = STRING,
+      name: String = "IndexTableFromMappedFile"): LookupTable = {
+    Op.createWithNameScope(name) {
+      Op.createWithNameScope("HashTable") {
+        val initializer = LookupTableMappedFileInitializer(
+          filename, if (keysDataType.isInteger) INT64 else keysDataType)
+        val table = MappedHashTable(
+          initializer, defaultValue, sharedName = s"mapped_hash_table_$filename", name = "Table")
         if (numOOVBuckets > 0)
           IDLookupTableWithHashBuckets(table, numOOVBuckets, hashSpecification, table.keysDataType)
         else
@@ -109,6 +166,41 @@ private[lookup] trait Lookup {
       }
     }
   }
+
+  /** Creates an op that builds a table file for a [[MappedHashTable]] from a text file.
+    *
+    * The op extracts one key-value pair from each line of the text file, in the same way as
+    * [[LookupTableTextFileInitializer]], computes a perfect hash function over the keys, and writes the table file to
+    * `filename`. The table file is written to a temporary file first, which is then renamed, so that tables being
+    * initialized never observe partially written files. The op only needs to be run once for each vocabulary (e.g.,
+    * when exporting a model) and it can be run in a separate graph.
+    *
+    * @param  textFilename    Scalar `STRING` tensor containing the filename of the text file.
+    * @param  filename        Scalar `STRING` tensor containing the filename of the table file to write.
+    * @param  keysExtractor   Text file field extractor to use for the keys (e.g., `TextFileWholeLine`).
+    * @param  valuesExtractor Text file field extractor to use for the values (e.g., `TextFileLineNumber`), which must
+    *                         produce `INT64` values.
+    * @param  delimiter       Delimiter to use in case a `TextFileColumn` extractor is being used.
+    * @param  vocabularySize  Number of elements in the file, if known. If not known, set to `-1` (the default value).
+    * @param  keysDataType    Data type of the table keys, which must be `INT64` or `STRING`.
+    * @param  name            Name for the created op.
+    * @return Created op.
+    */
+  def buildMappedHashTable(
+      textFilename: Output, filename: Output, keysExtractor: TextFileFieldExtractor = TextFileWholeLine,
+      valuesExtractor: TextFileFieldExtractor = TextFileLineNumber, delimiter: String = "\t",
+      vocabularySize: Int = -1, keysDataType: DataType = STRING, name: String = "BuildMappedHashTable"): Op = {
+    MappedHashTable.checkKeysDataType(keysDataType)
+    Op.Builder("BuildMappedHashTable", name)
+        .addInput(textFilename)
+        .addInput(filename)
+        .setAttribute("key_index", keysExtractor.value)
+        .setAttribute("value_index", valuesExtractor.value)
+        .setAttribute("vocab_size", vocabularySize)
+        .setAttribute("delimiter", delimiter)
+        .setAttribute("key_dtype", keysDataType)
+        .build()
+  }
 }
 
 object Lookup extends Lookup {
@@ -174,17 +266,87 @@ object Lookup extends Lookup {
         .build().outputs(0)
   }
 
+  /** Creates an op that creates a non-initialized hash table with lock-free lookups.
+    *
+    * The op creates a hash table, specifying the type of its keys and values. Before using the table the caller will
+    * have to initialize it, by importing its keys and values into it. After initialization the table will be immutable.
+    *
+    * @param  keysDataType       Data type for the keys of the table.
+    * @param  valuesDataType     Data type for the values of the table.
+    * @param  container          If non-empty, the created table is placed in the given container. Otherwise, a
+    *                            default container is used.
+    * @param  sharedName         If non-empty, the created table is named in the given bucket with this shared name.
+    *                            Otherwise, the op name is used, instead.
+    * @param  useNodeNameSharing If set to `true` and `sharedName` is empty, the table is shared using the node name.
+    * @param  name               Name for the created op.
+    * @return Created op.
+    */
+  private[lookup] def createLockFreeHashTable(
+      keysDataType: DataType, valuesDataType: DataType, container: String = "", sharedName: String = "",
+      useNodeNameSharing: Boolean = false, name: String = "LockFreeHashTable"): Output = {
+    Op.Builder("LockFreeHashTable", name)
+        .setAttribute("key_dtype", keysDataType)
+        .setAttribute("value_dtype", valuesDataType)
+        .setAttribute("container", container)
+        .setAttribute("shared_name", sharedName)
+        .setAttribute("use_node_name_sharing", useNodeNameSharing)
+        .build().outputs(0)
+  }
+
+  /** Creates an op that creates a non-initialized memory-mapped hash table.
+    *
+    * The op creates a hash table from keys to `INT64` values, specifying the type of its keys. Before using the table
+    * the caller will have to initialize it, by mapping a table file into it. After initialization the table will be
+    * immutable.
+    *
+    * @param  keysDataType       Data type for the keys of the table.
+    * @param  container          If non-empty, the created table is placed in the given container. Otherwise, a
+    *                            default container is used.
+    * @param  sharedName         If non-empty, the created table is named in the given bucket with this shared name.
+    *                            Otherwise, the op name is used, instead.
+    * @param  useNodeNameSharing If set to `true` and `sharedName` is empty, the table is shared using the node name.
+    * @param  name               Name for the created op.
+    * @return Created op.
+    */
+  private[lookup] def createMappedHashTable(
+      keysDataType: DataType, container: String = "", sharedName: String = "", useNodeNameSharing: Boolean = false,
+      name: String = "MappedHashTable"): Output = {
+    Op.Builder("MappedHashTable", name)
+        .setAttribute("key_dtype", keysDataType)
+        .setAttribute("container", container)
+        .setAttribute("shared_name", sharedName)
+        .setAttribute("use_node_name_sharing", useNodeNameSharing)
+        .build().outputs(0)
+  }
+
+  /** Creates an op that initializes the mapped hash table referenced by `handle` by memory-mapping a table file.
+    *
+    * @param  handle   Resource handle to a mapped hash table which will be initialized.
+    * @param  filename Tensor containing the filename of a table file built using [[Lookup.buildMappedHashTable]].
+    * @param  name     Name for the created op.
+    * @return Created op.
+    */
+  private[lookup] def createMappedHashTableInitializer(
+      handle: Output, filename: Output, name: String = "InitializeMappedHashTable"): Op = {
+    Op.Builder("InitializeMappedHashTable", name)
+        .addInput(handle)
+        .addInput(filename)
+        .build()
+  }
+
   /** Creates an op that initializes the table referenced by `handle` to the provided keys and values.
     *
     * @param  handle Resource handle to a lookup table which will be initialized.
     * @param  keys   Tensor containing the lookup keys.
     * @param  values Tensor containing the lookup values.
+    * @param  opType Type of the initialization op to create, which depends on the type of the table.
     * @param  name   Name for the created op.
     * @return Created op.
     */
   private[lookup] def createLookupTableTensorInitializer(
-      handle: Output, keys: Output, values: Output, name: String = "InitializeLookupTable"): Op = {
-    Op.Builder("InitializeTableV2", name)
+      handle: Output, keys: Output, values: Output, opType: String = "InitializeTableV2",
+      name: String = "InitializeLookupTable"): Op = {
+    Op.Builder(opType, name)
         .addInput(handle)
         .addInput(keys)
         .addInput(values)
@@ -206,13 +368,16 @@ object Lookup extends Lookup {
     * @param  keyIndex       Key index value (described above).
     * @param  valueIndex     Value index value (described above).
     * @param  vocabularySize Number of elements in the file.
+    * @param  delimiter      Delimiter to use for splitting the lines of the file.
+    * @param  opType         Type of the initialization op to create, which depends on the type of the table.
     * @param  name           Name for the created op.
     * @return Created op.
     */
   private[lookup] def createLookupTableTextFileInitializer(
       handle: Output, filename: Output, keyIndex: Int = -2, valueIndex: Int = -2, vocabularySize: Int = -1,
-      delimiter: String = "\t", name: String = "InitializeLookupTableFromTextFile"): Op = {
-    Op.Builder("InitializeTableFromTextFileV2", name)
+      delimiter: String = "\t", opType: String = "InitializeTableFromTextFileV2",
+      name: String = "InitializeLookupTableFromTextFile"): Op = {
+    Op.Builder(opType, name)
         .addInput(handle)
         .addInput(filename)
         .setAttribute("key_index", keyIndex)
@@ -235,6 +400,11 @@ object Lookup extends Lookup {
     GradientsRegistry.registerNonDifferentiable("InitializeTableV2")
     GradientsRegistry.registerNonDifferentiable("InitializeTableFromTextFile")
     GradientsRegistry.registerNonDifferentiable("InitializeTableFromTextFileV2")
+    GradientsRegistry.registerNonDifferentiable("LockFreeHashTable")
+    GradientsRegistry.registerNonDifferentiable("LookupTableImportFromTextFile")
+    GradientsRegistry.registerNonDifferentiable("MappedHashTable")
+    GradientsRegistry.registerNonDifferentiable("InitializeMappedHashTable")
+    GradientsRegistry.registerNonDifferentiable("BuildMappedHashTable")
     GradientsRegistry.registerNonDifferentiable("MutableDenseHashTable")
     GradientsRegistry.registerNonDifferentiable("MutableDenseHashTableV2")
     GradientsRegistry.registerNonDifferentiable("MutableHashTable")
@@ -18,7 +18,7 @@ package org.platanios.tensorflow.api.ops.lookup
 import org.platanios.tensorflow.api.core.Shape
 import org.platanios.tensorflow.api.core.exception.InvalidDataTypeException
 import org.platanios.tensorflow.api.ops.{Op, Output, OutputLike, OutputOps}
-import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.api.types.{DataType, INT64, STRING}
 
 /** Lookup table that persists across different session runs.
   *
@@ -86,6 +86,12 @@ abstract class InitializableLookupTable private[lookup] (
   // Make sure that the provided default value is a scalar
   defaultValue.shape.mergeWith(Shape.scalar())
 
+  /** Type of the op used to initialize this table from tensors containing its keys and values. */
+  private[lookup] val tensorInitializerOpType: String = "InitializeTableV2"
+
+  /** Type of the op used to initialize this table from a text file. */
+  private[lookup] val textFileInitializerOpType: String = "InitializeTableFromTextFileV2"
+
   /** Creates and returns an op used to initialize this table.
     *
     * @param  name Name for the created op.
@@ -151,3 +157,92 @@ case class HashTable(
   Lookup.createHashTable(
     initializer.keysDataType, initializer.valuesDataType, container, sharedName, useNodeNameSharing, name),
   initializer, defaultValue)
+
+/** Immutable hash table with lock-free lookups.
+  *
+  * This table can be used in place of [[HashTable]] when it is looked up concurrently by many sessions (e.g., for
+  * vocabulary lookups in serving models). Lookups into a [[HashTable]] are serialized by the table lock, whereas
+  * lookups into this table use no locks at all. The table uses open addressing over cache-line-aligned buckets, whose
+  * slots are probed using SIMD instructions, and it looks up keys in batches, prefetching their buckets. Before using
+  * the table the caller will have to initialize it. After initialization the table will be immutable.
+  *
+  * Example usage:
+  * {{{
+  *   val table = LockFreeHashTable(LookupTableTensorInitializer(keys, values), -1)
+  *   val output = table.lookup(input)
+  *   // Can now run evaluate the `output` tensor after executing the table initializer.
+  * }}}
+  *
+  * @param  initializer        Lookup table initializer to use.
+  * @param  defaultValue       Default value to use if a key is missing from the table.
+  * @param  container          If non-empty, the created table is placed in the given container. Otherwise, a
+  *                            default container is used.
+  * @param  sharedName         If non-empty, the created table is named in the given bucket with this shared name.
+  *                            Otherwise, the op name is used, instead.
+  * @param  useNodeNameSharing If set to `true` and `sharedName` is empty, the table is shared using the node name.
+  * @param  name               Name for the created table.
+  */
+case class LockFreeHashTable(
+    override protected val initializer: LookupTableInitializer,
+    override val defaultValue: Output,
+    container: String = "",
+    sharedName: String = "",
+    useNodeNameSharing: Boolean = false,
+    override val name: String = "LockFreeHashTable"
+) extends InitializableLookupTable(
+  Lookup.createLockFreeHashTable(
+    initializer.keysDataType, initializer.valuesDataType, container, sharedName, useNodeNameSharing, name),
+  initializer, defaultValue) {
+  override private[lookup] val tensorInitializerOpType  : String = "LookupTableImportV2"
+  override private[lookup] val textFileInitializerOpType: String = "LookupTableImportFromTextFile"
+}
+
+/** Immutable hash table from keys to `INT64` values, which is memory-mapped from a table file.
+  *
+  * This table can be used in place of [[HashTable]] for large vocabularies, which are expensive to parse and to build
+  * in memory each time a session is started. The table file is built once, using [[Lookup.buildMappedHashTable]], and
+  * contains a perfect hash function over the table keys, along with the keys and values themselves. Initializing the
+  * table only maps that file into memory, the pages of the file are loaded lazily and shared by all processes that use
+  * the same file, and each lookup reads exactly one bucket and one slot of the table, using no locks at all. Before
+  * using the table the caller will have to initialize it, using a [[LookupTableMappedFileInitializer]].
+  *
+  * Example usage:
+  * {{{
+  *   val table = MappedHashTable(LookupTableMappedFileInitializer("vocabulary.table", STRING), -1)
+  *   val output = table.lookup(input)
+  *   // Can now run evaluate the `output` tensor after executing the table initializer.
+  * }}}
+  *
+  * @param  initializer        Lookup table initializer to use.
+  * @param  defaultValue       Default value to use if a key is missing from the table.
+  * @param  container          If non-empty, the created table is placed in the given container. Otherwise, a
+  *                            default container is used.
+  * @param  sharedName         If non-empty, the created table is named in the given bucket with this shared name.
+  *                            Otherwise, the op name is used, instead.
+  * @param  useNodeNameSharing If set to `true` and `sharedName` is empty, the table is shared using the node name.
+  * @param  name               Name for the created table.
+  */
+case class MappedHashTable(
+    override protected val initializer: LookupTableMappedFileInitializer,
+    override val defaultValue: Output,
+    container: String = "",
+    sharedName: String = "",
+    useNodeNameSharing: Boolean = false,
+    override val name: String = "MappedHashTable"
+) extends InitializableLookupTable(
+  Lookup.createMappedHashTable(initializer.keysDataType, container, sharedName, useNodeNameSharing, name),
+  initializer, defaultValue)
+
+object MappedHashTable {
+  /** Checks that the provided data type is supported for the keys of mapped hash tables.
+    *
+    * @param  keysDataType Keys data type to check.
+    * @throws InvalidDataTypeException If the provided data type is not `INT64` or `STRING`.
+    */
+  @throws[InvalidDataTypeException]
+  private[lookup] def checkKeysDataType(keysDataType: DataType): Unit = {
+    if (keysDataType != INT64 && keysDataType != STRING)
+      throw InvalidDataTypeException(
+        s"Invalid keys data type $keysDataType for a mapped hash table (expected INT64 or STRING).")
+  }
+}
@@ -0,0 +1,71 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.lookup
+
+import org.platanios.tensorflow.api.core.Graph
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
+import org.platanios.tensorflow.api.ops.{Op, Output}
+import org.platanios.tensorflow.api.types.{DataType, INT64}
+
+/** Lookup table initializer that memory-maps a table file into a [[MappedHashTable]].
+  *
+  * The table file must have been built using [[Lookup.buildMappedHashTable]], for example as follows:
+  * {{{
+  *   // Run once (e.g., when exporting a model) to build the table file from a vocabulary text file.
+  *   val build = tf.buildMappedHashTable("vocabulary.txt", "vocabulary.table", TextFileWholeLine, TextFileLineNumber)
+  *   // Use the table file.
+  *   val table = MappedHashTable(LookupTableMappedFileInitializer("vocabulary.table", STRING), -1)
+  * }}}
+  *
+  * Initializing the table only maps the file into memory and validates its header, and so it is much faster than
+  * parsing the original text file and building a hash table in memory. Furthermore, the pages of the mapped file are
+  * shared by all processes that use the same table file.
+  *
+  * @param  filename     Scalar `STRING` tensor containing the filename of the table file to be used for
+  *                      initialization. The path must be accessible from wherever the graph is initialized (e.g.,
+  *                      trainer or evaluation workers).
+  * @param  keysDataType Data type of the table keys, which must be `INT64` or `STRING`.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class LookupTableMappedFileInitializer(
+    val filename: Output,
+    override val keysDataType: DataType
+) extends LookupTableInitializer(keysDataType, INT64) {
+  MappedHashTable.checkKeysDataType(keysDataType)
+
+  @throws[InvalidArgumentException]
+  override def initialize(table: InitializableLookupTable, name: String = "LookupTableMappedFileInitialize"): Op = {
+    if (!table.isInstanceOf[MappedHashTable])
+      throw InvalidArgumentException("Mapped file initializers can only be used to initialize mapped hash tables.")
+    table.checkDataTypes(keysDataType, valuesDataType)
+    Op.createWithNameScope(name, Set(table.handle.op)) {
+      val initializationOp = Lookup.createMappedHashTableInitializer(table.handle, filename)
+      Op.currentGraph.addToCollection(initializationOp, Graph.Keys.TABLE_INITIALIZERS)
+      // If the filename asset tensor is anything other than a string constant (e.g., if it is a placeholder), then it
+      // does not make sense to track it as an asset.
+      if (filename.op.opType == "Const")
+        Op.currentGraph.addToCollection(filename, Graph.Keys.ASSET_FILEPATHS)
+      initializationOp
+    }
+  }
+}
+
+object LookupTableMappedFileInitializer {
+  def apply(filename: Output, keysDataType: DataType): LookupTableMappedFileInitializer = {
+    new LookupTableMappedFileInitializer(filename, keysDataType)
+  }
+}
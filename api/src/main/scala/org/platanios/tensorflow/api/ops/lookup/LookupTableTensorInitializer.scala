@@ -36,7 +36,8 @@ case class LookupTableTensorInitializer(keys: Output, values: Output)
   override def initialize(table: InitializableLookupTable, name: String = "Initialize"): Op = {
     table.checkDataTypes(keys.dataType, values.dataType)
     Op.createWithNameScope(name, Set(table.handle.op, keys.op, values.op)) {
-      val initializationOp = Lookup.createLookupTableTensorInitializer(table.handle, keys, values, name)
+      val initializationOp = Lookup.createLookupTableTensorInitializer(
+        table.handle, keys, values, table.tensorInitializerOpType, name)
       Op.currentGraph.addToCollection(initializationOp, Graph.Keys.TABLE_INITIALIZERS)
       initializationOp
     }
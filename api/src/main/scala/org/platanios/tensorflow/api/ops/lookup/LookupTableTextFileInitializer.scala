@@ -85,7 +85,8 @@ class LookupTableTextFileInitializer(
     table.checkDataTypes(keysDataType, valuesDataType)
     Op.createWithNameScope(name, Set(table.handle.op)) {
       val initializationOp = Lookup.createLookupTableTextFileInitializer(
-        table.handle, filename, keysExtractor.value, valuesExtractor.value, vocabularySize, delimiter)
+        table.handle, filename, keysExtractor.value, valuesExtractor.value, vocabularySize, delimiter,
+        table.textFileInitializerOpType)
       Op.currentGraph.addToCollection(initializationOp, Graph.Keys.TABLE_INITIALIZERS)
       // If the filename asset tensor is anything other than a string constant (e.g., if it is a placeholder), then it
       // does not make sense to track it as an asset.
@@ -23,17 +23,24 @@ package object lookup {
       extends Lookup {
     type LookupTable = lookup.LookupTable
     type HashTable = lookup.HashTable
+    type LockFreeHashTable = lookup.LockFreeHashTable
+    type MappedHashTable = lookup.MappedHashTable
     type IDLookupTableWithHashBuckets = lookup.IDLookupTableWithHashBuckets
 
     val HashTable                   : lookup.HashTable.type                    = lookup.HashTable
+    val LockFreeHashTable           : lookup.LockFreeHashTable.type            = lookup.LockFreeHashTable
+    val MappedHashTable             : lookup.MappedHashTable.type              = lookup.MappedHashTable
     val IDLookupTableWithHashBuckets: lookup.IDLookupTableWithHashBuckets.type = lookup.IDLookupTableWithHashBuckets
 
     type LookupTableInitializer = lookup.LookupTableInitializer
     type LookupTableTensorInitializer = lookup.LookupTableTensorInitializer
     type LookupTableTextFileInitializer = lookup.LookupTableTextFileInitializer
+    type LookupTableMappedFileInitializer = lookup.LookupTableMappedFileInitializer
 
     val LookupTableTensorInitializer  : lookup.LookupTableTensorInitializer.type   = lookup.LookupTableTensorInitializer
     val LookupTableTextFileInitializer: lookup.LookupTableTextFileInitializer.type =
       lookup.LookupTableTextFileInitializer
+    val LookupTableMappedFileInitializer: lookup.LookupTableMappedFileInitializer.type =
+      lookup.LookupTableMappedFileInitializer
   }
 }
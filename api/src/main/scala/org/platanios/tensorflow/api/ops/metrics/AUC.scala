@@ -0,0 +1,213 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.metrics
+
+import org.platanios.tensorflow.api.core.{Graph, Shape}
+import org.platanios.tensorflow.api.core.Indexer._
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
+import org.platanios.tensorflow.api.ops.metrics.Metric._
+import org.platanios.tensorflow.api.ops.variables.{Variable, ZerosInitializer}
+import org.platanios.tensorflow.api.ops.{Basic, Math, Op, Output}
+import org.platanios.tensorflow.api.types.{BOOLEAN, DataType, FLOAT32, FLOAT64, INT32}
+
+/** Area under the ROC curve (AUC) metric, for binary classification.
+  *
+  * The metric splits the `[0, 1]` range of predicted probabilities into `numBuckets` buckets of equal width, and
+  * computes two histograms over these buckets: one containing the (weighted) number of positive examples whose
+  * prediction falls into each bucket, and one containing the same number for the negative examples. The ROC curve is
+  * then computed using the bucket boundaries as thresholds, and its area is computed using the trapezoidal rule (i.e.,
+  * examples whose predictions fall into the same bucket are treated as ties). Predictions outside `[0, 1]` are clipped
+  * to the first or the last bucket.
+  *
+  * For estimation of the metric over a stream of data, the histograms are accumulated in a local variable with shape
+  * `[2, numBuckets]`, and `update` adds the histograms of each batch to it. If `native` is `true`, the histograms are
+  * instead accumulated in a native [[MetricAccumulator]], which `update` updates using a single op.
+  *
+  * If `weights` is `null`, the weights default to 1. Use weights of `0` to mask values.
+  *
+  * @param  numBuckets           Number of prediction buckets. Larger numbers result in more accurate AUC estimates.
+  * @param  variablesCollections Graph collections in which to add the metric variables (for streaming metrics).
+  * @param  valuesCollections    Graph collections in which to add the metric values.
+  * @param  updatesCollections   Graph collections in which to add the metric updates.
+  * @param  resetsCollections    Graph collections in which to add the metric resets.
+  * @param  native               If `true`, the streaming metric uses a (CPU-only) [[MetricAccumulator]] instead of
+  *                              local variables.
+  * @param  name                 Name prefix for the created ops.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class AUC private[metrics] (
+    val numBuckets: Int = 200,
+    variablesCollections: Set[Graph.Key[Variable]] = Set(METRIC_VARIABLES),
+    valuesCollections: Set[Graph.Key[Output]] = Set(METRIC_VALUES),
+    updatesCollections: Set[Graph.Key[Output]] = Set(METRIC_UPDATES),
+    resetsCollections: Set[Graph.Key[Op]] = Set(METRIC_RESETS),
+    val native: Boolean = false,
+    override val name: String = "AUC"
+) extends Metric[(Output, Output), Output] {
+  if (numBuckets <= 0)
+    throw InvalidArgumentException(s"'numBuckets' must be positive, but it was $numBuckets.")
+
+  /** Computes the value of this metric for the provided predictions and targets, optionally weighted by `weights`.
+    *
+    * @param  values  Tuple containing the predictions tensor (i.e., the predicted probabilities of the positive class)
+    *                 and the targets tensor (which is cast to `BOOLEAN`).
+    * @param  weights Tensor containing weights for the values.
+    * @param  name    Name prefix for the created ops.
+    * @return Created output containing the metric value.
+    */
+  override def compute(values: (Output, Output), weights: Output = null, name: String = name): Output = {
+    var ops = Set(values._1.op, values._2.op)
+    if (weights != null)
+      ops += weights.op
+    Op.createWithNameScope(name, ops) {
+      val value = AUC.value(histograms(values, weights), castedPredictions(values._1).dataType, name = "Value")
+      valuesCollections.foreach(Op.currentGraph.addToCollection(value, _))
+      value
+    }
+  }
+
+  /** Creates ops for computing the value of this metric in a streaming fashion. This function returns an op for
+    * obtaining the value of this metric, as well as a pair of ops to update its accumulated value and reset it.
+    *
+    * @param  values  Tuple containing the predictions tensor (i.e., the predicted probabilities of the positive class)
+    *                 and the targets tensor (which is cast to `BOOLEAN`).
+    * @param  weights Tensor containing weights for the predictions.
+    * @param  name    Name prefix for the created ops.
+    * @return Tuple containing: (i) output representing the current value of the metric, (ii) op used to reset its
+    *         value, and (iii) op used to update its current value and obtain the new value.
+    */
+  override def streaming(
+      values: (Output, Output), weights: Output = null, name: String = name): (Output, Output, Op) = {
+    var ops = Set(values._1.op, values._2.op)
+    if (weights != null)
+      ops += weights.op
+    Op.createWithNameScope(name, ops) {
+      val dataType = castedPredictions(values._1).dataType
+      val (value, update, reset) = {
+        if (native) {
+          val (matchedPredictions, matchedTargets, matchedWeights) = matchInputs(values, weights)
+          val accumulatorWeights = Metric.accumulatorWeights(matchedPredictions, matchedWeights, dataType)
+          val accumulator = MetricAccumulator(Shape(2, numBuckets), name = "Accumulator")
+          val value = AUC.value(accumulator.read(), dataType, name = "Value")
+          val update = Math.cast(
+            MetricAccumulator.aucUpdate(accumulator, matchedPredictions, matchedTargets, accumulatorWeights),
+            dataType, name = "Update")
+          val valueAndReset = AUC.value(accumulator.readAndReset(), dataType, name = "ValueAndReset")
+          Op.currentGraph.addToCollection(valueAndReset, METRIC_VALUES_AND_RESETS)
+          (value, update, accumulator.reset())
+        } else {
+          val accumulator = localVariable(
+            s"$name/Histograms", FLOAT64, Shape(2, numBuckets), ZerosInitializer, variablesCollections)
+          val value = AUC.value(accumulator.value, dataType, name = "Value")
+          val update = AUC.value(accumulator.assignAdd(histograms(values, weights)), dataType, name = "Update")
+          (value, update, accumulator.initializer)
+        }
+      }
+      valuesCollections.foreach(Op.currentGraph.addToCollection(value, _))
+      updatesCollections.foreach(Op.currentGraph.addToCollection(update, _))
+      resetsCollections.foreach(Op.currentGraph.addToCollection(reset, _))
+      (value, update, reset)
+    }
+  }
+
+  /** Casts the predictions to `FLOAT32`, unless they are `FLOAT64`. */
+  private[this] def castedPredictions(predictions: Output): Output = {
+    if (predictions.dataType != FLOAT64) predictions.cast(FLOAT32) else predictions
+  }
+
+  /** Flattens and matches the axes of the predictions, the targets, and the weights. */
+  private[this] def matchInputs(values: (Output, Output), weights: Output): (Output, Output, Output) = {
+    val predictions = castedPredictions(values._1)
+    val targets = values._2
+    val flattenedPredictions = if (predictions.rank > 1) Basic.reshape(predictions, -1) else predictions
+    val flattenedTargets = if (targets.rank > 1) Basic.reshape(targets, -1) else targets
+    val flattenedWeights = if (weights != null && weights.rank > 1) Basic.reshape(weights, -1) else weights
+    val (matchedPredictions, matchedTargets, matchedWeights) =
+      Metric.matchAxes(flattenedPredictions, flattenedTargets, flattenedWeights)
+    matchedPredictions.shape.assertIsCompatibleWith(matchedTargets.shape)
+    (matchedPredictions, matchedTargets.cast(BOOLEAN), matchedWeights)
+  }
+
+  /** Computes the `FLOAT64` histograms of the predictions of the positive and the negative examples, stacked in a
+    * tensor with shape `[2, numBuckets]`. */
+  private[this] def histograms(values: (Output, Output), weights: Output): Output = {
+    val (matchedPredictions, matchedTargets, matchedWeights) = matchInputs(values, weights)
+    val dataType = matchedPredictions.dataType
+    val buckets = Math.minimum(
+      Math.maximum(
+        Math.floor(Math.multiply(matchedPredictions, Basic.constant(numBuckets, dataType))),
+        Basic.zeros(dataType, Shape.scalar())),
+      Basic.constant(numBuckets - 1, dataType)).cast(INT32)
+    val processedWeights = {
+      if (matchedWeights == null)
+        Basic.onesLike(matchedPredictions, FLOAT64)
+      else
+        weightsBroadcast(matchedPredictions, matchedWeights.cast(FLOAT64))
+    }
+    val positiveWeights = Math.multiply(processedWeights, matchedTargets.cast(FLOAT64))
+    val negativeWeights = Math.subtract(processedWeights, positiveWeights)
+    Basic.stack(Seq(
+      Math.unsortedSegmentSum(positiveWeights, buckets, numBuckets, name = "PositivesHistogram"),
+      Math.unsortedSegmentSum(negativeWeights, buckets, numBuckets, name = "NegativesHistogram")))
+  }
+}
+
+object AUC {
+  /** Creates a new AUC metric.
+    *
+    * @param  numBuckets           Number of prediction buckets. Larger numbers result in more accurate AUC estimates.
+    * @param  variablesCollections Graph collections in which to add the metric variables (for streaming metrics).
+    * @param  valuesCollections    Graph collections in which to add the metric values.
+    * @param  updatesCollections   Graph collections in which to add the metric updates.
+    * @param  resetsCollections    Graph collections in which to add the metric resets.
+    * @param  native               If `true`, the streaming metric uses a (CPU-only) [[MetricAccumulator]] instead of
+    *                              local variables.
+    * @param  name                 Name prefix for the created ops.
+    * @return New AUC metric.
+    */
+  def apply(
+      numBuckets: Int = 200,
+      variablesCollections: Set[Graph.Key[Variable]] = Set(METRIC_VARIABLES),
+      valuesCollections: Set[Graph.Key[Output]] = Set(METRIC_VALUES),
+      updatesCollections: Set[Graph.Key[Output]] = Set(METRIC_UPDATES),
+      resetsCollections: Set[Graph.Key[Op]] = Set(METRIC_RESETS),
+      native: Boolean = false,
+      name: String = "AUC"
+  ): AUC = {
+    new AUC(
+      numBuckets, variablesCollections, valuesCollections, updatesCollections, resetsCollections, native, name)
+  }
+
+  /** Computes the area under the ROC curve from the state of an AUC [[MetricAccumulator]] (i.e., the histograms of the
+    * predictions of the positive and the negative examples, stacked in a tensor with shape `[2, numBuckets]`).
+    *
+    * @param  state    Accumulator state.
+    * @param  dataType Data type of the computed AUC.
+    * @param  name     Name for the created op.
+    * @return Created op output.
+    */
+  def value(state: Output, dataType: DataType = FLOAT64, name: String = "Value"): Output = {
+    Op.createWithNameScope(name, Set(state.op)) {
+      val positives = state(0)
+      val negatives = state(1)
+      // Weight of the positive examples whose predictions fall into higher buckets than each bucket.
+      val positivesAbove = Math.cumsum(positives, exclusive = true, reverse = true)
+      val area = Math.sum(Math.multiply(negatives, Math.add(positivesAbove, Math.multiply(positives, 0.5))))
+      Math.cast(safeDiv(area, Math.multiply(Math.sum(positives), Math.sum(negatives))), dataType)
+    }
+  }
+}
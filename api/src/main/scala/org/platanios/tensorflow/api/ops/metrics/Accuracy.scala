@@ -39,6 +39,8 @@ import org.platanios.tensorflow.api.ops.variables.Variable
   * @param  valuesCollections    Graph collections in which to add the metric values.
   * @param  updatesCollections   Graph collections in which to add the metric updates.
   * @param  resetsCollections    Graph collections in which to add the metric resets.
+  * @param  native               If `true`, the streaming metric uses a (CPU-only) [[MetricAccumulator]] instead of
+  *                              local variables.
   * @param  name                 Name prefix for the created ops.
   *
   * @author Emmanouil Antonios Platanios
@@ -48,10 +50,11 @@ class Accuracy private[metrics] (
     valuesCollections: Set[Graph.Key[Output]] = Set(METRIC_VALUES),
     updatesCollections: Set[Graph.Key[Output]] = Set(METRIC_UPDATES),
     resetsCollections: Set[Graph.Key[Op]] = Set(METRIC_RESETS),
+    val native: Boolean = false,
     override val name: String = "Accuracy"
 ) extends Metric[(Output, Output), Output] {
   private[this] val meanMetric =
-    Mean(variablesCollections, valuesCollections, updatesCollections, resetsCollections, name)
+    Mean(variablesCollections, valuesCollections, updatesCollections, resetsCollections, native, name)
 
   /** Computes the value of this metric for the provided predictions and targets, optionally weighted by `weights`.
     *
@@ -94,6 +97,8 @@ object Accuracy {
     * @param  valuesCollections    Graph collections in which to add the metric values.
     * @param  updatesCollections   Graph collections in which to add the metric updates.
     * @param  resetsCollections    Graph collections in which to add the metric resets.
+    * @param  native               If `true`, the streaming metric uses a (CPU-only) [[MetricAccumulator]] instead of
+    *                              local variables.
     * @param  name                 Name prefix for the created ops.
     * @return New mean metric.
     */
@@ -102,8 +107,9 @@ object Accuracy {
       valuesCollections: Set[Graph.Key[Output]] = Set(METRIC_VALUES),
       updatesCollections: Set[Graph.Key[Output]] = Set(METRIC_UPDATES),
       resetsCollections: Set[Graph.Key[Op]] = Set(METRIC_RESETS),
+      native: Boolean = false,
       name: String = "Accuracy"
   ): Accuracy = {
-    new Accuracy(variablesCollections, valuesCollections, updatesCollections, resetsCollections, name)
+    new Accuracy(variablesCollections, valuesCollections, updatesCollections, resetsCollections, native, name)
   }
 }
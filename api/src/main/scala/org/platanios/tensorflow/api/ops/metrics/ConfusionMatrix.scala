@@ -16,11 +16,12 @@
 package org.platanios.tensorflow.api.ops.metrics
 
 import org.platanios.tensorflow.api.core.{Graph, Shape}
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
 import org.platanios.tensorflow.api.ops.control_flow.ControlFlow
 import org.platanios.tensorflow.api.ops.metrics.Metric.{METRIC_RESETS, METRIC_UPDATES, METRIC_VALUES, METRIC_VARIABLES}
 import org.platanios.tensorflow.api.ops.variables.{Variable, ZerosInitializer}
 import org.platanios.tensorflow.api.ops.{Basic, Checks, Math, Op, Output, SparseOutput}
-import org.platanios.tensorflow.api.types.{DataType, FLOAT64, INT32, INT64}
+import org.platanios.tensorflow.api.types.{DataType, FLOAT32, FLOAT64, INT32, INT64}
 
 /** Confusion matrix classification metric.
   *
@@ -46,12 +47,18 @@ import org.platanios.tensorflow.api.types.{DataType, FLOAT64, INT32, INT64}
   *
   * Note that the possible labels are assumed to be `[0, 1, 2, 3, 4]`, resulting in a 5x5 confusion matrix.
   *
+  * If `native` is `true`, the streaming confusion matrix is kept in a native [[MetricAccumulator]], whose update op
+  * adds the (weighted) count of each target/prediction pair directly to the corresponding cell, instead of building a
+  * dense confusion matrix for each batch.
+  *
   * @param  numClasses           Number of classes over which the confusion matrix is computed.
   * @param  dataType             Data type for the confusion matrix.
   * @param  variablesCollections Graph collections in which to add the metric variables (for streaming metrics).
   * @param  valuesCollections    Graph collections in which to add the metric values.
   * @param  updatesCollections   Graph collections in which to add the metric updates.
   * @param  resetsCollections    Graph collections in which to add the metric resets.
+  * @param  native               If `true`, the streaming metric uses a (CPU-only) [[MetricAccumulator]] instead of
+  *                              local variables.
   * @param  name                 Name prefix for the created ops.
   *
   *
@@ -64,6 +71,7 @@ class ConfusionMatrix private[metrics] (
     valuesCollections: Set[Graph.Key[Output]] = Set(METRIC_VALUES),
     updatesCollections: Set[Graph.Key[Output]] = Set(METRIC_UPDATES),
     resetsCollections: Set[Graph.Key[Op]] = Set(METRIC_RESETS),
+    val native: Boolean = false,
     override val name: String = "ConfusionMatrix"
 ) extends Metric[(Output, Output), Output] {
   private[this] val numClassesOutput: Output = if (numClasses != -1) Basic.constant(numClasses) else null
@@ -134,6 +142,15 @@ class ConfusionMatrix private[metrics] (
     */
   override def streaming(
       values: (Output, Output), weights: Output = null, name: String = name): (Output, Output, Op) = {
+    if (native)
+      nativeStreaming(values, weights, name)
+    else
+      variablesStreaming(values, weights, name)
+  }
+
+  /** Creates ops for computing the value of this metric in a streaming fashion, using a local variable. */
+  private[this] def variablesStreaming(
+      values: (Output, Output), weights: Output, name: String): (Output, Output, Op) = {
     val accumulator = Metric.localVariable(
       s"$name/Accumulator", dataType, Shape(numClasses, numClasses), ZerosInitializer, variablesCollections)
     val value = compute(values, weights, name = s"$name/Value")
@@ -144,6 +161,42 @@ class ConfusionMatrix private[metrics] (
     resetsCollections.foreach(Op.currentGraph.addToCollection(reset, _))
     (accumulator.value, update, reset)
   }
+
+  /** Creates ops for computing the value of this metric in a streaming fashion, using a native accumulator. */
+  private[this] def nativeStreaming(
+      values: (Output, Output), weights: Output, name: String): (Output, Output, Op) = {
+    if (numClasses == -1)
+      throw InvalidArgumentException("'numClasses' must be provided when using a native confusion matrix accumulator.")
+    val predictions = values._1
+    val targets = values._2
+    // Flatten the inputs if their rank is bigger than 1.
+    val flattenedPredictions = if (predictions.rank > 1) Basic.reshape(predictions, -1) else predictions
+    val flattenedTargets = if (targets.rank > 1) Basic.reshape(targets, -1) else targets
+    val flattenedWeights = if (weights != null && weights.rank > 1) Basic.reshape(weights, -1) else weights
+    var ops = Set(predictions.op, targets.op)
+    if (flattenedWeights != null)
+      ops += flattenedWeights
+    Op.createWithNameScope(name, ops) {
+      val (matchedPredictions, matchedTargets, matchedWeights) =
+        Metric.matchAxes(flattenedPredictions, flattenedTargets, flattenedWeights)
+      // The update op validates the targets and the predictions itself, and so no assertions are needed here.
+      val weightsDataType = if (dataType == FLOAT32) FLOAT32 else FLOAT64
+      val accumulatorWeights = Metric.accumulatorWeights(matchedPredictions, matchedWeights, weightsDataType)
+      val accumulator = MetricAccumulator(Shape(numClasses, numClasses), name = "Accumulator")
+      val value = Math.cast(accumulator.read(), dataType, name = "Value")
+      val update = Math.cast(
+        MetricAccumulator.confusionMatrixUpdate(
+          accumulator, matchedTargets.cast(INT64), matchedPredictions.cast(INT64), accumulatorWeights),
+        dataType, name = "Update")
+      val reset = accumulator.reset()
+      val valueAndReset = Math.cast(accumulator.readAndReset(), dataType, name = "ValueAndReset")
+      valuesCollections.foreach(Op.currentGraph.addToCollection(value, _))
+      updatesCollections.foreach(Op.currentGraph.addToCollection(update, _))
+      resetsCollections.foreach(Op.currentGraph.addToCollection(reset, _))
+      Op.currentGraph.addToCollection(valueAndReset, Metric.METRIC_VALUES_AND_RESETS)
+      (value, update, reset)
+    }
+  }
 }
 
 object ConfusionMatrix {
@@ -155,6 +208,8 @@ object ConfusionMatrix {
     * @param  valuesCollections    Graph collections in which to add the metric values.
     * @param  updatesCollections   Graph collections in which to add the metric updates.
     * @param  resetsCollections    Graph collections in which to add the metric resets.
+    * @param  native               If `true`, the streaming metric uses a (CPU-only) [[MetricAccumulator]] instead of
+    *                              local variables.
     * @param  name                 Name prefix for the created ops.
     * @return New confusion matrix metric.
     */
@@ -164,9 +219,11 @@ object ConfusionMatrix {
       valuesCollections: Set[Graph.Key[Output]] = Set(METRIC_VALUES),
       updatesCollections: Set[Graph.Key[Output]] = Set(METRIC_UPDATES),
       resetsCollections: Set[Graph.Key[Op]] = Set(METRIC_RESETS),
+      native: Boolean = false,
       name: String = "ConfusionMatrix"
   ): ConfusionMatrix = {
     new ConfusionMatrix(
-      numClasses, dataType, variablesCollections, valuesCollections, updatesCollections, resetsCollections, name)
+      numClasses, dataType, variablesCollections, valuesCollections, updatesCollections, resetsCollections, native,
+      name)
   }
 }
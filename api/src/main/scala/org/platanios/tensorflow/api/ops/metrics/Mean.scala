@@ -16,11 +16,12 @@
 package org.platanios.tensorflow.api.ops.metrics
 
 import org.platanios.tensorflow.api.core.{Graph, Shape}
+import org.platanios.tensorflow.api.core.Indexer._
 import org.platanios.tensorflow.api.ops.control_flow.ControlFlow
 import org.platanios.tensorflow.api.ops.metrics.Metric._
 import org.platanios.tensorflow.api.ops.variables.{Variable, ZerosInitializer}
 import org.platanios.tensorflow.api.ops.{Basic, Math, Op, Output}
-import org.platanios.tensorflow.api.types.{FLOAT32, FLOAT64}
+import org.platanios.tensorflow.api.types.{DataType, FLOAT32, FLOAT64}
 
 /** Mean metric.
   *
@@ -33,10 +34,15 @@ import org.platanios.tensorflow.api.types.{FLOAT32, FLOAT64}
   *
   * If `weights` is `null`, the weights default to 1. Use weights of `0` to mask values.
   *
+  * If `native` is `true`, `total` and `count` are instead kept in a native [[MetricAccumulator]], which `update`
+  * increments using a single op.
+  *
   * @param  variablesCollections Graph collections in which to add the metric variables (for streaming metrics).
   * @param  valuesCollections    Graph collections in which to add the metric values.
   * @param  updatesCollections   Graph collections in which to add the metric updates.
   * @param  resetsCollections    Graph collections in which to add the metric resets.
+  * @param  native               If `true`, the streaming metric uses a (CPU-only) [[MetricAccumulator]] instead of
+  *                              local variables.
   * @param  name                 Name prefix for the created ops.
   *
   * @author Emmanouil Antonios Platanios
@@ -46,6 +52,7 @@ class Mean private[metrics] (
     valuesCollections: Set[Graph.Key[Output]] = Set(METRIC_VALUES),
     updatesCollections: Set[Graph.Key[Output]] = Set(METRIC_UPDATES),
     resetsCollections: Set[Graph.Key[Op]] = Set(METRIC_RESETS),
+    val native: Boolean = false,
     override val name: String = "Mean"
 ) extends Metric[Output, Output] {
   /** Computes the value of this metric for the provided values, optionally weighted by `weights`.
@@ -88,6 +95,14 @@ class Mean private[metrics] (
     *         value, and (iii) op used to update its current value and obtain the new value.
     */
   def streaming(values: Output, weights: Output = null, name: String = name): (Output, Output, Op) = {
+    if (native)
+      nativeStreaming(values, weights, name)
+    else
+      variablesStreaming(values, weights, name)
+  }
+
+  /** Creates ops for computing the value of this metric in a streaming fashion, using local variables. */
+  private[this] def variablesStreaming(values: Output, weights: Output, name: String): (Output, Output, Op) = {
     var ops = Set(values.op)
     if (weights != null)
       ops += weights.op
@@ -119,6 +134,29 @@ class Mean private[metrics] (
       (value, update, reset)
     }
   }
+
+  /** Creates ops for computing the value of this metric in a streaming fashion, using a native accumulator. */
+  private[this] def nativeStreaming(values: Output, weights: Output, name: String): (Output, Output, Op) = {
+    var ops = Set(values.op)
+    if (weights != null)
+      ops += weights.op
+    Op.createWithNameScope(name, ops) {
+      val castedValues = if (values.dataType != FLOAT64) values.cast(FLOAT32) else values
+      val accumulator = MetricAccumulator(Shape(2), name = "Accumulator")
+      val accumulatorWeights = Metric.accumulatorWeights(castedValues, weights, castedValues.dataType)
+      val value = Mean.value(accumulator.read(), castedValues.dataType, name = "Value")
+      val update = Math.cast(
+        MetricAccumulator.meanUpdate(accumulator, castedValues, accumulatorWeights), castedValues.dataType,
+        name = "Update")
+      val reset = accumulator.reset()
+      val valueAndReset = Mean.value(accumulator.readAndReset(), castedValues.dataType, name = "ValueAndReset")
+      valuesCollections.foreach(Op.currentGraph.addToCollection(value, _))
+      updatesCollections.foreach(Op.currentGraph.addToCollection(update, _))
+      resetsCollections.foreach(Op.currentGraph.addToCollection(reset, _))
+      Op.currentGraph.addToCollection(valueAndReset, METRIC_VALUES_AND_RESETS)
+      (value, update, reset)
+    }
+  }
 }
 
 object Mean {
@@ -128,6 +166,8 @@ object Mean {
     * @param  valuesCollections    Graph collections in which to add the metric values.
     * @param  updatesCollections   Graph collections in which to add the metric updates.
     * @param  resetsCollections    Graph collections in which to add the metric resets.
+    * @param  native               If `true`, the streaming metric uses a (CPU-only) [[MetricAccumulator]] instead of
+    *                              local variables.
     * @param  name                 Name prefix for the created ops.
     * @return New mean metric.
     */
@@ -136,8 +176,22 @@ object Mean {
       valuesCollections: Set[Graph.Key[Output]] = Set(METRIC_VALUES),
       updatesCollections: Set[Graph.Key[Output]] = Set(METRIC_UPDATES),
       resetsCollections: Set[Graph.Key[Op]] = Set(METRIC_RESETS),
+      native: Boolean = false,
       name: String = "Mean"
   ): Mean = {
-    new Mean(variablesCollections, valuesCollections, updatesCollections, resetsCollections, name)
+    new Mean(variablesCollections, valuesCollections, updatesCollections, resetsCollections, native, name)
+  }
+
+  /** Computes the mean value from the state of a mean [[MetricAccumulator]] (i.e., `[total, count]`).
+    *
+    * @param  state    Accumulator state.
+    * @param  dataType Data type of the computed mean.
+    * @param  name     Name for the created op.
+    * @return Created op output.
+    */
+  def value(state: Output, dataType: DataType = FLOAT64, name: String = "Value"): Output = {
+    Op.createWithNameScope(name, Set(state.op)) {
+      Math.cast(safeDiv(state(0), state(1)), dataType)
+    }
   }
 }
@@ -76,6 +76,12 @@ object Metric {
     override def name: String = "metric_resets"
   }
 
+  /** Key to collect the subset of tensors that are used for obtaining metric values and resetting them at the same
+    * time. Only metrics that use native accumulators (i.e., [[MetricAccumulator]]s) add tensors to this collection. */
+  object METRIC_VALUES_AND_RESETS extends OutputCollectionKey {
+    override def name: String = "metric_values_and_resets"
+  }
+
   /** Creates a new variable and adds it to the `LOCAL_VARIABLES` graph collection. */
   private[metrics] def localVariable(
       name: String, dataType: DataType = null, shape: Shape = null, initializer: Initializer = ZerosInitializer,
@@ -83,6 +89,17 @@ object Metric {
     Variable.getVariable(name = name, trainable = false, collections = collections + Graph.Keys.LOCAL_VARIABLES)
   }
 
+  /** Returns weights for the update ops of metric accumulators, which have the same number of elements as `values`, or
+    * an empty tensor if `weights` is `null` (meaning that all weights are equal to 1). */
+  private[metrics] def accumulatorWeights(values: Output, weights: Output, dataType: DataType): Output = {
+    if (weights == null) {
+      Basic.zeros(dataType, Shape(0))
+    } else {
+      val (matchedValues, _, matchedWeights) = matchAxes(values, null, weights)
+      weightsBroadcast(matchedValues, matchedWeights.cast(dataType))
+    }
+  }
+
   /** Divides two values, returning 0 if the denominator is <= 0. */
   private[metrics] def safeDiv(numerator: Output, denominator: Output, name: String = "SafeDiv"): Output = {
     Math.select(Math.greater(denominator, 0), Math.divide(numerator, denominator), 0, name)
@@ -0,0 +1,172 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.metrics
+
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
+import org.platanios.tensorflow.api.ops.{Op, Output}
+
+/** Native accumulator of the statistics of a streaming metric.
+  *
+  * Metric accumulators are (CPU-only) resources that hold the accumulated statistics of a metric as a `FLOAT64` tensor
+  * with a fixed shape (e.g., the weighted sum and count of a mean). Unlike metric variables, which are updated using
+  * several small ops per evaluation step, an accumulator is updated using a single op per metric, which reduces the
+  * provided batch natively. Its state is initialized to zeros when the accumulator is first created in a session, and
+  * it can be read, reset, or read and reset atomically, without running any variable initializers.
+  *
+  * @param  handle Handle to the accumulator resource.
+  * @param  shape  Shape of the accumulator state.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class MetricAccumulator private[metrics] (val handle: Output, val shape: Shape) {
+  /** Creates an op that reads the current state of this accumulator.
+    *
+    * @param  name Name for the created op.
+    * @return Created op output.
+    */
+  def read(name: String = "Read"): Output = {
+    val state = Op.Builder("MetricAccumulatorRead", name)
+        .addInput(handle)
+        .build().outputs(0)
+    state.setShape(shape)
+    state
+  }
+
+  /** Creates an op that resets the state of this accumulator to zeros.
+    *
+    * @param  name Name for the created op.
+    * @return Created op.
+    */
+  def reset(name: String = "Reset"): Op = {
+    Op.Builder("MetricAccumulatorReset", name)
+        .addInput(handle)
+        .build()
+  }
+
+  /** Creates an op that reads the current state of this accumulator and resets it to zeros, atomically. This allows
+    * obtaining the final value of a metric and resetting it for the next evaluation using a single session run.
+    *
+    * @param  name Name for the created op.
+    * @return Created op output, containing the state of this accumulator before it was reset.
+    */
+  def readAndReset(name: String = "ReadAndReset"): Output = {
+    val state = Op.Builder("MetricAccumulatorReadAndReset", name)
+        .addInput(handle)
+        .build().outputs(0)
+    state.setShape(shape)
+    state
+  }
+}
+
+object MetricAccumulator {
+  /** Creates a new metric accumulator.
+    *
+    * @param  shape      Shape of the accumulator state.
+    * @param  container  If non-empty, the created accumulator is placed in the given container. Otherwise, a default
+    *                    container is used.
+    * @param  sharedName If non-empty, the created accumulator is shared under this name across multiple sessions.
+    * @param  name       Name for the created op.
+    * @return Created metric accumulator.
+    */
+  def apply(
+      shape: Shape, container: String = "", sharedName: String = "",
+      name: String = "MetricAccumulator"): MetricAccumulator = {
+    val handle = Op.Builder("MetricAccumulator", name)
+        .setAttribute("shape", shape)
+        .setAttribute("container", container)
+        .setAttribute("shared_name", sharedName)
+        .build().outputs(0)
+    new MetricAccumulator(handle, shape)
+  }
+
+  /** Creates an op that updates a mean accumulator (with state `[total, count]`) and returns the updated mean.
+    *
+    * @param  accumulator Mean accumulator.
+    * @param  values      `FLOAT32` or `FLOAT64` tensor containing the values.
+    * @param  weights     Tensor containing the weights of the values, which must either have as many elements as
+    *                     `values`, or be empty, in which case all weights are equal to 1.
+    * @param  name        Name for the created op.
+    * @return Created op output, which is a `FLOAT64` scalar.
+    */
+  private[metrics] def meanUpdate(
+      accumulator: MetricAccumulator, values: Output, weights: Output,
+      name: String = "MeanAccumulatorUpdate"): Output = {
+    Op.Builder("MeanAccumulatorUpdate", name)
+        .addInput(accumulator.handle)
+        .addInput(values)
+        .addInput(weights)
+        .build().outputs(0)
+  }
+
+  /** Creates an op that updates a confusion matrix accumulator (with state `[numClasses, numClasses]`) and returns the
+    * updated confusion matrix.
+    *
+    * @param  accumulator Confusion matrix accumulator.
+    * @param  targets     `INT32` or `INT64` tensor containing the target labels.
+    * @param  predictions Tensor containing the predicted labels, with the same data type as `targets`.
+    * @param  weights     `FLOAT32` or `FLOAT64` tensor containing the weights of the target/prediction pairs, which
+    *                     must either have as many elements as `targets`, or be empty, in which case all weights are
+    *                     equal to 1.
+    * @param  name        Name for the created op.
+    * @return Created op output, which is a `FLOAT64` matrix.
+    */
+  private[metrics] def confusionMatrixUpdate(
+      accumulator: MetricAccumulator, targets: Output, predictions: Output, weights: Output,
+      name: String = "ConfusionMatrixAccumulatorUpdate"): Output = {
+    val confusionMatrix = Op.Builder("ConfusionMatrixAccumulatorUpdate", name)
+        .addInput(accumulator.handle)
+        .addInput(targets)
+        .addInput(predictions)
+        .addInput(weights)
+        .build().outputs(0)
+    confusionMatrix.setShape(accumulator.shape)
+    confusionMatrix
+  }
+
+  /** Creates an op that updates an AUC accumulator (with state `[2, numBuckets]`, containing the histograms of the
+    * predictions of the positive and the negative examples) and returns the updated area under the ROC curve.
+    *
+    * @param  accumulator AUC accumulator.
+    * @param  predictions `FLOAT32` or `FLOAT64` tensor containing the predicted probabilities of the positive class.
+    * @param  targets     `BOOLEAN` tensor containing the target labels.
+    * @param  weights     Tensor containing the weights of the examples, with the same data type as `predictions`,
+    *                     which must either have as many elements as `predictions`, or be empty, in which case all
+    *                     weights are equal to 1.
+    * @param  name        Name for the created op.
+    * @return Created op output, which is a `FLOAT64` scalar.
+    */
+  private[metrics] def aucUpdate(
+      accumulator: MetricAccumulator, predictions: Output, targets: Output, weights: Output,
+      name: String = "AUCAccumulatorUpdate"): Output = {
+    Op.Builder("AUCAccumulatorUpdate", name)
+        .addInput(accumulator.handle)
+        .addInput(predictions)
+        .addInput(targets)
+        .addInput(weights)
+        .build().outputs(0)
+  }
+
+  private[ops] object Gradients {
+    GradientsRegistry.registerNonDifferentiable("MetricAccumulator")
+    GradientsRegistry.registerNonDifferentiable("MetricAccumulatorRead")
+    GradientsRegistry.registerNonDifferentiable("MetricAccumulatorReadAndReset")
+    GradientsRegistry.registerNonDifferentiable("MetricAccumulatorReset")
+    GradientsRegistry.registerNonDifferentiable("MeanAccumulatorUpdate")
+    GradientsRegistry.registerNonDifferentiable("ConfusionMatrixAccumulatorUpdate")
+    GradientsRegistry.registerNonDifferentiable("AUCAccumulatorUpdate")
+  }
+}
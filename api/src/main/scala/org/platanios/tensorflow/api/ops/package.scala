@@ -47,6 +47,9 @@ package object ops {
 
   ops.Basic.Gradients
   ops.DataFlow.Gradients
+  ops.Embedding.Gradients
+  ops.HashEmbeddingTable.Gradients
+  ops.Image.Gradients
   ops.Logging.Gradients
   ops.Math.Gradients
   ops.NN.Gradients
@@ -54,6 +57,8 @@ package object ops {
   ops.Parsing.Gradients
   ops.Random.Gradients
   ops.Sets.Gradients
+  ops.Sparse.Gradients
+  ops.Statistics.Gradients
   ops.TensorArray.Gradients
   ops.Text.Gradients
   ops.control_flow.ControlFlow.Gradients
@@ -62,6 +67,10 @@ package object ops {
   ops.io.data.Dataset.Gradients
   ops.io.data.Iterator.Gradients
   ops.lookup.Lookup.Gradients
+  ops.metrics.MetricAccumulator.Gradients
+  ops.rnn.CudnnRNN.Gradients
+  ops.rnn.decoder.BeamSearchRNNDecoder.Gradients
+  ops.rnn.cell.RNNCell.Gradients
   ops.variables.Variable.Gradients
 
   private[api] trait API
@@ -69,6 +78,7 @@ package object ops {
           with Callback
           with Checks
           with Clip
+          with Collective
           with DataFlow
           with Image
           with Logging
@@ -0,0 +1,155 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package org.platanios.tensorflow.api.ops.rnn
+
+import org.platanios.tensorflow.api.core.exception.InvalidShapeException
+import org.platanios.tensorflow.api.ops.{Op, Output, OutputLike}
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
+
+/** Contains functions for constructing ops related to fused, cuDNN-backed, recurrent neural networks (RNNs).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+private[rnn] trait CudnnRNN {
+  /** $OpDocRNNCudnnRNN
+    *
+    * @group RNNOps
+    * @param  input         Time-major input to the RNN, with shape `[time, batch, inputSize]`.
+    * @param  initialH      Initial hidden state, with shape `[numLayers * numDirections, batch, numUnits]`.
+    * @param  initialC      Initial cell state, with the same shape as `initialH`. It is only used by LSTM RNNs and,
+    *                       if `null`, it defaults to `initialH` for the other modes.
+    * @param  parameters    One-dimensional tensor containing all weights and biases of the RNN, in the opaque cuDNN
+    *                       layout. Its size must be equal to `CudnnRNN.parametersSize(...)`.
+    * @param  mode          RNN mode (i.e., type of RNN cell).
+    * @param  bidirectional If `true`, a bidirectional RNN is created, with `numDirections = 2`. Otherwise,
+    *                       `numDirections = 1`.
+    * @param  dropout       Dropout probability applied between layers (i.e., to the outputs of all layers but the
+    *                       last one), during training.
+    * @param  seed          Optional random seed used for the dropout, when combined with the graph-level seed.
+    * @param  training      Boolean value indicating whether the RNN is used for training, in which case the op also
+    *                       produces the intermediate results needed by its gradient.
+    * @param  name          Name for the created op.
+    * @return Tuple containing the RNN outputs for all time steps (with shape
+    *         `[time, batch, numDirections * numUnits]`), the final hidden state, and the final cell state (which is
+    *         meaningful only for LSTM RNNs).
+    * @throws InvalidShapeException If the input or the initial state shapes are invalid.
+    */
+  @throws[InvalidShapeException]
+  def cudnnRNN(
+      input: Output, initialH: Output, initialC: Output = null, parameters: Output,
+      mode: CudnnRNN.Mode = CudnnRNN.LSTM, bidirectional: Boolean = false, dropout: Float = 0.0f,
+      seed: Option[Int] = None, training: Boolean = true, name: String = "CudnnRNN"): (Output, Output, Output) = {
+    if (input.rank != -1 && input.rank != 3)
+      throw InvalidShapeException(s"'input' must be rank-3 (i.e., [time, batch, depth]), but has shape ${input.shape}.")
+    if (initialH.rank != -1 && initialH.rank != 3)
+      throw InvalidShapeException(
+        s"'initialH' must be rank-3 (i.e., [layers * directions, batch, units]), but has shape ${initialH.shape}.")
+    val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
+    val outputs = Op.Builder(opType = "CudnnRNN", name = name)
+        .addInput(input)
+        .addInput(initialH)
+        .addInput(if (initialC == null) initialH else initialC)
+        .addInput(parameters)
+        .setAttribute("rnn_mode", mode.name)
+        .setAttribute("input_mode", "linear_input")
+        .setAttribute("direction", if (bidirectional) "bidirectional" else "unidirectional")
+        .setAttribute("dropout", dropout)
+        .setAttribute("seed", graphSeed.getOrElse(0))
+        .setAttribute("seed2", opSeed.getOrElse(0))
+        .setAttribute("is_training", training)
+        .build().outputs
+    (outputs(0), outputs(1), outputs(2))
+  }
+}
+
+object CudnnRNN extends CudnnRNN {
+  /** Type of the RNN cell used by a cuDNN RNN.
+    *
+    * @param  name     Name of the mode, as expected by the cuDNN RNN ops.
+    * @param  numGates Number of gates of the cell, which determines the number of weight matrices per layer.
+    */
+  sealed abstract class Mode(val name: String, val numGates: Int) {
+    override def toString: String = name
+  }
+
+  /** Long-Short Term Memory (LSTM) cell, equivalent to the basic LSTM cell with a forget bias of `0`. */
+  case object LSTM extends Mode("lstm", 4)
+
+  /** Gated Recurrent Unit (GRU) cell. */
+  case object GRU extends Mode("gru", 3)
+
+  /** Basic RNN cell with the `tanh` activation function. */
+  case object RNNTanh extends Mode("rnn_tanh", 1)
+
+  /** Basic RNN cell with the `relu` activation function. */
+  case object RNNReLU extends Mode("rnn_relu", 1)
+
+  /** Returns the number of elements of the opaque parameters tensor of a cuDNN RNN.
+    *
+    * For each layer and direction, cuDNN stores one input weight matrix and one recurrent weight matrix per gate, and
+    * two bias vectors per gate (i.e., one for the input and one for the recurrent connection). The inputs of all layers
+    * but the first one are the (concatenated, for bidirectional RNNs) outputs of the previous layer.
+    *
+    * @param  mode          RNN mode.
+    * @param  numLayers     Number of layers.
+    * @param  numUnits      Number of units per layer and direction.
+    * @param  inputSize     Size of the last axis of the RNN input.
+    * @param  bidirectional Boolean value indicating whether the RNN is bidirectional.
+    * @return Number of parameters.
+    */
+  def parametersSize(mode: Mode, numLayers: Int, numUnits: Int, inputSize: Int, bidirectional: Boolean): Long = {
+    val numDirections = if (bidirectional) 2 else 1
+    (0 until numLayers).map(layer => {
+      val layerInputSize = if (layer == 0) inputSize else numUnits * numDirections
+      numDirections.toLong * mode.numGates * numUnits * (layerInputSize + numUnits + 2)
+    }).sum
+  }
+
+  private[ops] object Gradients {
+    GradientsRegistry.register("CudnnRNN", cudnnRNNGradient)
+    GradientsRegistry.registerNonDifferentiable("CudnnRNNBackprop")
+    GradientsRegistry.registerNonDifferentiable("CudnnRNNParamsSize")
+
+    private[this] def cudnnRNNGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
+      Op.Builder(opType = "CudnnRNNBackprop", name = "CudnnRNNGradient")
+          .addInputList(op.inputs)
+          .addInputList(op.outputs.take(3))
+          .addInputList(outputGradients.take(3).map(_.toOutput))
+          .addInput(op.outputs(3))
+          .setAttribute("rnn_mode", op.stringAttribute("rnn_mode"))
+          .setAttribute("input_mode", op.stringAttribute("input_mode"))
+          .setAttribute("direction", op.stringAttribute("direction"))
+          .setAttribute("dropout", op.floatAttribute("dropout"))
+          .setAttribute("seed", op.longAttribute("seed"))
+          .setAttribute("seed2", op.longAttribute("seed2"))
+          .build().outputs.toSeq
+    }
+  }
+
+  /** @define OpDocRNNCudnnRNN
+    *   The `cudnnRNN` op creates a multi-layer recurrent neural network (RNN) that processes whole sequences using a
+    *   single fused cuDNN kernel, instead of a dynamic loop over the time steps (as `dynamicRNN` does).
+    *
+    *   This avoids the per-iteration control flow overhead and the tensor array reads and writes of dynamic RNNs, but
+    *   it only supports the cell types of cuDNN, with all weights and biases packed in a single opaque parameters
+    *   tensor, and it only runs on GPUs. The cuDNN RNN kernels (i.e., `CudnnRNN` and `CudnnRNNBackprop`) are provided
+    *   by the TensorFlow contrib op library for cuDNN RNNs (`_cudnn_rnn_ops.so`), which must have been loaded (using
+    *   `org.platanios.tensorflow.jni.TensorFlow.loadOpLibrary`).
+    *
+    *   Input tensors must be time-major (i.e., shaped `[time, batch, depth]`) and all sequences in a batch are
+    *   processed for the same number of time steps.
+    */
+  private[ops] trait Documentation
+}
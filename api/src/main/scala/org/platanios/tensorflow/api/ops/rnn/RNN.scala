@@ -248,11 +248,19 @@ object RNN extends RNN {
     }
     val time = Basic.constant(0, INT32, name = "Time")
     val baseName = Op.createWithNameScope("DynamicRNN")(Op.currentNameScope)
-    val outputTensorArrays = zeroOutputs.indices.map(i => {
-      TensorArray.create(timeSteps, inferredDataType, name = s"$baseName/Output_$i")
+    // The per-step inputs and outputs all have the same shape, and so they are stored in contiguous tensor arrays,
+    // which makes unstacking the inputs and stacking the outputs free (in both the forward and the backward pass).
+    val outputTensorArrays = zeroOutputs.zip(evO.shapes(cell.outputShape)).zipWithIndex.map({
+      case ((zeroOutput, outputShape), index) =>
+        TensorArray.create(
+          timeSteps, inferredDataType, elementShape = Shape(constantBatchSize) ++ outputShape,
+          contiguous = TensorArray.supportsContiguous(zeroOutput.dataType), name = s"$baseName/Output_$index")
     })
-    val inputTensorArrays = inputs.zipWithIndex.map({
-      case (in, index) => TensorArray.create(timeSteps, in.dataType, name = s"$baseName/Input_$index").unstack(in)
+    val inputTensorArrays = inputs.zip(inputsGotShape).zipWithIndex.map({
+      case ((in, inShape), index) =>
+        TensorArray.create(
+          timeSteps, in.dataType, elementShape = inShape(1 ::),
+          contiguous = TensorArray.supportsContiguous(in.dataType), name = s"$baseName/Input_$index").unstack(in)
     })
 
     def seqCell(inputs: Seq[Output], states: Seq[Output]): (Seq[Output], Seq[Output]) = {
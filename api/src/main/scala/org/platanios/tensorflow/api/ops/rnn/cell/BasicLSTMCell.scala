@@ -25,6 +25,9 @@ import org.platanios.tensorflow.api.ops.{Math, Output}
   * @param  bias       Bias vector to use.
   * @param  activation Activation function to use.
   * @param  forgetBias Forget bias added to the forget gate.
+  * @param  fused      If `true`, each step is computed using a single fused kernel (and so is each gradient step), as
+  *                    described in the documentation of the `fusedBasicLSTMCell` op. The fused kernel always uses the
+  *                    `tanh` activation function and `activation` must thus be left to its default value.
   * @param  name       Name scope for the created ops.
   *
   * @author Emmanouil Antonios Platanios
@@ -34,6 +37,7 @@ class BasicLSTMCell private[cell] (
     val bias: Output,
     val activation: Output => Output = Math.tanh(_),
     val forgetBias: Float = 1.0f,
+    val fused: Boolean = false,
     val name: String = "BasicLSTMCell"
 ) extends RNNCell.LSTMCell {
   private[this] val numUnits = bias.shape(0) / 4
@@ -42,14 +46,17 @@ class BasicLSTMCell private[cell] (
   override def stateShape: (Shape, Shape) = (Shape(numUnits), Shape(numUnits))
 
   override def forward(input: RNNCell.LSTMTuple): RNNCell.LSTMTuple = {
-    RNNCell.basicLSTMCell(input, kernel, bias, activation, forgetBias, name)
+    if (fused)
+      RNNCell.fusedBasicLSTMCell(input, kernel, bias, forgetBias, name)
+    else
+      RNNCell.basicLSTMCell(input, kernel, bias, activation, forgetBias, name)
   }
 }
 
 object BasicLSTMCell {
   def apply(
       kernel: Output, bias: Output, activation: Output => Output = Math.tanh(_), forgetBias: Float = 1.0f,
-      name: String = "BasicLSTMCell"): BasicLSTMCell = {
-    new BasicLSTMCell(kernel, bias, activation, forgetBias, name)
+      fused: Boolean = false, name: String = "BasicLSTMCell"): BasicLSTMCell = {
+    new BasicLSTMCell(kernel, bias, activation, forgetBias, fused, name)
   }
 }
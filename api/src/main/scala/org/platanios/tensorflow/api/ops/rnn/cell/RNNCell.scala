@@ -19,7 +19,8 @@ import org.platanios.tensorflow.api.Implicits._
 import org.platanios.tensorflow.api.core.Shape
 import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
 import org.platanios.tensorflow.api.ops
-import org.platanios.tensorflow.api.ops.{Basic, Math, NN, Op, Output}
+import org.platanios.tensorflow.api.ops.{Basic, Math, NN, Op, Output, OutputLike}
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
 import org.platanios.tensorflow.api.types.{DataType, INT32}
 
 import shapeless._
@@ -248,6 +249,47 @@ object RNNCell {
     }
   }
 
+  /** $OpDocRNNCellFusedBasicLSTMCell
+    *
+    * @group RNNCellOps
+    * @param  input      Input tuple consisting of the previous RNN cell output and state.
+    * @param  kernel     Kernel matrix to use.
+    * @param  bias       Bias vector to use.
+    * @param  forgetBias Forget bias added to the forget gate.
+    * @param  name       Name scope for the created ops.
+    * @return New RNN cell tuple, after this cell has been applied.
+    * @throws InvalidArgumentException If the `input` shape is invalid.
+    */
+  @throws[InvalidArgumentException]
+  private[cell] def fusedBasicLSTMCell(
+      input: LSTMTuple, kernel: Output, bias: Output, forgetBias: Float = 1.0f, name: String = "BasicLSTMCell"
+  ): LSTMTuple = {
+    Op.createWithNameScope(name) {
+      val output = input.output
+      if (output.rank != 2)
+        throw InvalidArgumentException(s"Input must be rank-2 (provided rank-${output.rank}).")
+      if (output.shape(1) == -1)
+        throw InvalidArgumentException(s"Last axis of input shape (${output.shape}) must be known.")
+      // The basic LSTM cell has no peep-hole connections, and so zero peep-hole weights are fed to the fused op.
+      val peepholeWeights = Basic.zeros(kernel.dataType, Shape(bias.shape(0) / 4))
+      val outputs = Op.Builder(opType = "FusedLSTMBlockCell", name = "FusedLSTMBlockCell")
+          .addInput(output)
+          .addInput(input.state._1)
+          .addInput(input.state._2)
+          .addInput(kernel)
+          .addInput(peepholeWeights)
+          .addInput(peepholeWeights)
+          .addInput(peepholeWeights)
+          .addInput(bias)
+          .setAttribute("forget_bias", forgetBias)
+          .setAttribute("cell_clip", -1.0f)
+          .setAttribute("use_peephole", false)
+          .build().outputs
+      val (c, m) = (outputs(1), outputs(6))
+      LSTMTuple(m, (c, m))
+    }
+  }
+
   /** $OpDocRNNCellLSTMCell
     *
     * @group RNNCellOps
@@ -325,6 +367,25 @@ object RNNCell {
     }
   }
 
+  private[ops] object Gradients {
+    GradientsRegistry.register("FusedLSTMBlockCell", fusedLSTMBlockCellGradient)
+    GradientsRegistry.registerNonDifferentiable("FusedLSTMBlockCellGrad")
+
+    private[this] def fusedLSTMBlockCellGradient(op: Op, outputGradients: Seq[OutputLike]): Seq[OutputLike] = {
+      // Only the gradients with respect to the cell state and the cell output are back-propagated. The other outputs
+      // are activations that the fused gradient op uses to avoid recomputing them.
+      val csGradient = outputGradients(1).toOutput
+      val hGradient = outputGradients(6).toOutput
+      Op.Builder(opType = "FusedLSTMBlockCellGrad", name = "FusedLSTMBlockCellGradient")
+          .addInputList(op.inputs)
+          .addInputList(op.outputs.take(6))
+          .addInput(csGradient)
+          .addInput(hGradient)
+          .setAttribute("use_peephole", op.booleanAttribute("use_peephole"))
+          .build().outputs.toSeq
+    }
+  }
+
   /** @define OpDocRNNCellBasicRNNCell
     *   The `basicRNNCell` op creates an instance of the most basic RNN cell, which is defined as:
     *   `output = newState = activation(W * input + U * state + b)`.
@@ -352,6 +413,19 @@ object RNNCell {
     *
     *   Input tensors must be two-dimensional.
     *
+    * @define OpDocRNNCellFusedBasicLSTMCell
+    *   The `fusedBasicLSTMCell` op creates an instance of a basic Long-Short Term Memory (LSTM) cell, which computes
+    *   each step in a single fused kernel (i.e., `FusedLSTMBlockCell`), and each gradient step in another one (i.e.,
+    *   `FusedLSTMBlockCellGrad`), rather than using separate matrix multiplication, bias addition, split, activation,
+    *   and multiplication ops.
+    *
+    *   The cell is equivalent to the `basicLSTMCell` op using the `tanh` activation function, and it uses the same
+    *   kernel and bias layout. The fused kernels are provided by the `tensorflow_ops` library, which must have been
+    *   loaded (using `org.platanios.tensorflow.jni.TensorFlow.loadOpLibrary`). They are defined for CPUs, and for GPUs
+    *   when that library is built with CUDA support.
+    *
+    *   Input tensors must be two-dimensional.
+    *
     * @define OpDocRNNCellLSTMCell
     *   The `lstmCell` op creates an instance of an Long-Short Term Memory (LSTM) cell.
     *
@@ -1,115 +1,224 @@
-///* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
-// *
-// * Licensed under the Apache License, Version 2.0 (the "License"); you may not
-// * use this file except in compliance with the License. You may obtain a copy of
-// * the License at
-// *
-// *     http://www.apache.org/licenses/LICENSE-2.0
-// *
-// * Unless required by applicable law or agreed to in writing, software
-// * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
-// * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
-// * License for the specific language governing permissions and limitations under
-// * the License.
-// */
-//
-//package org.platanios.tensorflow.api.ops.rnn.decoder
-//
-//import org.platanios.tensorflow.api.Implicits._
-//import org.platanios.tensorflow.api.core.exception.{InvalidArgumentException, InvalidShapeException}
-//import org.platanios.tensorflow.api.{Shape, ops}
-//import org.platanios.tensorflow.api.ops.{Basic, Output, TensorArray}
-//import org.platanios.tensorflow.api.ops.control_flow.WhileLoopVariable
-//import org.platanios.tensorflow.api.ops.rnn.cell.RNNCell
-//import org.platanios.tensorflow.api.tensors.Tensor
-//
-//import scala.language.postfixOps
-//
-///** Recurrent Neural Network (RNN) that uses beam search to find the highest scoring sequence.
-//  *
-//  * @author Emmanouil Antonios Platanios
-//  */
-//class BeamSearchRNNDecoder[T: RNNCell.Supported](
-//    override val cell: RNNCell.Tuple[T] => RNNCell.Tuple[T],
-//    override val cellOutputSize: Seq[Int],
-//    override val initialCellState: Seq[Output],
-//    val beginTokens: Output,
-//    val endToken: Output,
-//    val beamWidth: Int,
-//    val lengthPenaltyWeight: Float = 0.0f,
-//    override val name: String = "BeamSearchRNNDecoder"
-//)(implicit
-//    whileLoopEvT: WhileLoopVariable.Aux[T, _],
-//    whileLoopEvOutput: WhileLoopVariable.Aux[BeamSearchRNNDecoder.Output[Output], _],
-//    whileLoopEvOutputTensorArray: WhileLoopVariable.Aux[BeamSearchRNNDecoder.Output[TensorArray], _],
-//    whileLoopEvStateT: WhileLoopVariable.Aux[BeamSearchRNNDecoder.State, _]
-//) extends RNNDecoder[
-//    T,
-//    BeamSearchRNNDecoder.Output[Output],
-//    BeamSearchRNNDecoder.Output[TensorArray],
-//    BeamSearchRNNDecoder.State](
-//  cell,
-//  cellOutputSize,
-//  initialCellState,
-//  name
-//) {
-//  if (initialCellState.exists(_.rank == -1))
-//    throw InvalidArgumentException("All tensors in the state need to have known rank for the beam search decoder.")
-//
-//  /** Scalar `INT32` tensor representing the batch size of the input values. */
-//  override val batchSize: Output = Basic.size(beginTokens)
-//
-//  /** Describes whether the decoder keeps track of finished states.
-//    *
-//    * Most decoders will emit a true/false `finished` value independently at each time step. In this case, the
-//    * `dynamicDecode()` function keeps track of which batch entries have already finished, and performs a logical OR to
-//    * insert new batches to the finished set.
-//    *
-//    * Some decoders, however, shuffle batches/beams between time steps and `dynamicDecode()` will mix up the finished
-//    * state across these entries because it does not track the reshuffling across time steps. In this case, it is up to
-//    * the decoder to declare that it will keep track of its own finished state by setting this property to `true`.
-//    */
-//  override val tracksOwnFinished: Boolean = true
-//
-//  private[this] def splitBatchBeams(value: Output, shape: Shape): Output = {
-//    val valueShape = Basic.shape(value)
-//    val reshapedValue = Basic.reshape(value, Basic.concatenate(Seq(
-//      batchSize.expandDims(0),
-//      Tensor(batchSize.dataType, beamWidth).toOutput,
-//      valueShape(1 ::).cast(batchSize.dataType)), axis = 0))
-//    val staticBatchSize = Output.constantValue(batchSize).scalar.asInstanceOf[Int]
-//    val expectedReshapedShape = Shape(staticBatchSize, beamWidth) ++ shape
-//    if (!reshapedValue.shape.isCompatibleWith(expectedReshapedShape))
-//      throw InvalidShapeException(
-//        "Unexpected behavior when reshaping between beam width and batch size. " +
-//            s"The reshaped tensor has shape: ${reshapedValue.shape}. " +
-//            s"We expected it to have shape [batchSize, beamWidth, depth] == $expectedReshapedShape. " +
-//            "Perhaps you forgot to create a zero state with batchSize = encoderBatchSize * beamWidth?")
-//    reshapedValue.setShape(expectedReshapedShape)
-//    reshapedValue
-//  }
-//
-//  override def createZeroOutputTensorArrays(): (
-//      BeamSearchRNNDecoder.Output[Output], BeamSearchRNNDecoder.Output[TensorArray]) = {
-//    val zeroOutput = BeamSearchRNNDecoder.Output()
-//
-//    val zeroOutputs = cellOutputSize.map(s => Basic.fill(initialCellState.head.dataType, Basic.stack(Seq(batchSize, s)))(0))
-//    val rnnCellZeroOutput = RNNCell.Supported[T].fromOutputs(zeroOutputs)
-//    val rnnCellTensorArrays = zeroOutputs.map(output => {
-//      TensorArray.create(0, output.dataType, dynamicSize = true, elementShape = output.shape)
-//    })
-//    val zeroOutput = BasicRNNDecoder.Output[T](rnnCellZeroOutput, rnnCellZeroOutput)
-//    val tensorArrays = BasicRNNDecoder.Output[Seq[TensorArray]](rnnCellTensorArrays, rnnCellTensorArrays)
-//    (zeroOutput, tensorArrays)
-//  }
-//
-//}
-//
-//object BeamSearchRNNDecoder {
-//  case class State(
-//      rnnState: Seq[ops.Output], logProbabilities: ops.Output, sequenceLengths: ops.Output, finished: ops.Output)
-//
-//  case class Output[T](
-//      scores: T, predictedIDs: T, parentIDs: T
-//  )(implicit whileLoopEvT: WhileLoopVariable.Aux[T, _])
-//}
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.rnn.decoder
+
+import org.platanios.tensorflow.api.Implicits._
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.core.exception.{InvalidArgumentException, InvalidShapeException}
+import org.platanios.tensorflow.api.ops.Gradients.{Registry => GradientsRegistry}
+import org.platanios.tensorflow.api.ops.{Basic, Op, Output}
+import org.platanios.tensorflow.api.ops.rnn.RNN
+import org.platanios.tensorflow.api.ops.rnn.cell.RNNCell
+import org.platanios.tensorflow.api.types.{BOOLEAN, DataType, INT32}
+
+import scala.language.postfixOps
+
+/** Recurrent Neural Network (RNN) decoder that uses beam search to find the highest scoring sequences.
+  *
+  * Each decoding step is performed by a single native op (`BeamSearchStep`), which computes the log-softmax of the
+  * logits, adds the beam log-probabilities, applies the length penalty, selects the top `beamWidth` candidates, and
+  * gathers the finished flags, the sequence lengths, and the cell states of their parent beams, in a single pass over
+  * the logits. This avoids the long chain of small ops (and the corresponding per-op overhead) that is otherwise
+  * executed at every decoding step.
+  *
+  * The cell state must be created with batch size equal to the batch size of `beginTokens` times `beamWidth` (e.g.,
+  * by tiling the encoder state), with the beams of each batch entry stored in consecutive rows. The decoder outputs
+  * consist of the scores, the predicted token IDs, and the parent beam indices for each step, each with shape
+  * `[batchSize, beamWidth]` per step. The full beams can be obtained from the latter two using
+  * [[BeamSearchRNNDecoder.gatherTree]]. Note that `imputeFinished` must be `false` when using this decoder with
+  * `dynamicDecode()`.
+  *
+  * @param  cell                RNN cell to use for decoding.
+  * @param  initialCellState    Initial RNN cell state, with batch size equal to `batchSize * beamWidth`.
+  * @param  embeddingFn         Function that takes an `INT32` vector of IDs and returns the corresponding embedded
+  *                             values that will be passed to the decoder input.
+  * @param  beginTokens         `INT32` vector with length equal to the batch size, which contains the begin token IDs.
+  * @param  endToken            `INT32` scalar containing the end token ID (i.e., token ID which marks the end of
+  *                             decoding).
+  * @param  beamWidth           Beam width.
+  * @param  lengthPenaltyWeight Length penalty weight, where `0` means no length penalty.
+  * @param  outputLayer         Function applied to the RNN cell output, before the beam search step (e.g., a dense
+  *                             layer that projects it to the vocabulary size).
+  * @param  name                Name prefix used for all created ops.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class BeamSearchRNNDecoder[S, SS](
+    override val cell: RNNCell[Output, Shape, S, SS],
+    override val initialCellState: S,
+    val embeddingFn: (Output) => Output,
+    val beginTokens: Output,
+    val endToken: Output,
+    val beamWidth: Int,
+    val lengthPenaltyWeight: Float = 0.0f,
+    val outputLayer: (Output) => Output = (output: Output) => output,
+    override val name: String = "BeamSearchRNNDecoder"
+)(implicit
+    evS: RNNCell.Supported.Aux[S, SS]
+) extends RNNDecoder[
+    Output, Shape, S, SS,
+    (Output, Output, Output), (Shape, Shape, Shape),
+    (S, Output, Output, Output), (SS, Shape, Shape, Shape)](
+  cell,
+  initialCellState,
+  name
+) {
+  if (beamWidth <= 0)
+    throw InvalidArgumentException(s"'beamWidth' must be positive, but it was $beamWidth.")
+  if (beginTokens.rank != 1)
+    throw InvalidShapeException(s"'beginTokens' (shape = ${beginTokens.shape}) must have rank 1.")
+  if (endToken.rank != 0)
+    throw InvalidShapeException(s"'endToken' (shape = ${endToken.shape}) must have rank 0.")
+
+  /** Scalar `INT32` tensor representing the batch size of the input values. */
+  override val batchSize: Output = Op.createWithNameScope(name, Set(beginTokens.op)) {
+    Basic.size(beginTokens)
+  }
+
+  /** The beams are reordered at each step and so, the decoder keeps track of its own finished state. */
+  override val tracksOwnFinished: Boolean = true
+
+  /** Data type of the cell state, which is also used for the scores and the log-probabilities of the beams. */
+  private[this] val stateDataType: DataType = RNN.inferStateDataType(null, evS.outputs(initialCellState))
+
+  /** Returns an `INT32` tensor containing the shape `[batchSize, beamWidth]`. */
+  private[this] def beamShape: Output = Basic.stack(Seq(batchSize, Basic.constant(beamWidth)))
+
+  override protected def zeroOutputDataType(initialStates: Seq[Output]): DataType = stateDataType
+
+  override def zeroOutput(dataType: DataType): (Output, Output, Output) = {
+    Op.createWithNameScope(s"$name/ZeroOutput") {
+      val shape = beamShape
+      (Basic.fill(dataType, shape)(0), Basic.fill(INT32, shape)(0), Basic.fill(INT32, shape)(0))
+    }
+  }
+
+  /** This method is called before any decoding iterations. It computes the initial input values and the initial state.
+    *
+    * @return Tuple containing: (i) a `BOOLEAN` tensor with shape `[batchSize, beamWidth]` specifying which beams have
+    *         finished, (ii) the next input, and (iii) the initial decoder state.
+    */
+  override def initialize(): (Output, Output, (S, Output, Output, Output)) = {
+    Op.createWithNameScope(s"$name/Initialize") {
+      val shape = beamShape
+      val finished = Basic.fill(BOOLEAN, shape)(false)
+      val sequenceLengths = Basic.fill(INT32, shape)(0)
+      // Only the first beam is initially alive, so that the first step does not select the same token multiple times.
+      val logProbabilities = Basic.oneHot(
+        Basic.fill(INT32, batchSize.expandDims(0))(0), beamWidth,
+        onValue = Basic.constant(0, stateDataType),
+        offValue = Basic.constant(Float.NegativeInfinity, stateDataType),
+        dataType = stateDataType)
+      val tiledBeginTokens = Basic.reshape(Basic.tile(beginTokens.expandDims(1), Basic.stack(Seq(1, beamWidth))), -1)
+      (finished, embeddingFn(tiledBeginTokens), (initialCellState, logProbabilities, finished, sequenceLengths))
+    }
+  }
+
+  /** This method is called once per step of decoding (but only once for dynamic decoding).
+    *
+    * @return Tuple containing: (i) the decoder output for this step (i.e., the scores, the predicted token IDs, and the
+    *         parent beam indices), (ii) the next decoder state, (iii) the next input, and (iv) a `BOOLEAN` tensor with
+    *         shape `[batchSize, beamWidth]` specifying which beams have finished.
+    */
+  override def next(
+      time: Output, input: Output, state: (S, Output, Output, Output)
+  ): ((Output, Output, Output), (S, Output, Output, Output), Output, Output) = {
+    val (cellState, logProbabilities, finished, sequenceLengths) = state
+    val states = evS.outputs(cellState)
+    Op.createWithNameScope(
+      s"$name/Step",
+      Set(time.op, input.op, logProbabilities.op, finished.op, sequenceLengths.op) ++ states.map(_.op).toSet
+    ) {
+      val nextTuple = cell(RNNCell.Tuple(input, cellState))
+      val logits = outputLayer(nextTuple.output).cast(stateDataType)
+      val beamLogits = Basic.reshape(logits, Basic.stack(Seq(batchSize, Basic.constant(beamWidth), -1)))
+      val (scores, predictedIDs, parentIDs, nextLogProbabilities, nextFinished, nextSequenceLengths, nextStates) =
+        BeamSearchRNNDecoder.beamSearchStep(
+          beamLogits, logProbabilities, finished, sequenceLengths, endToken, evS.outputs(nextTuple.state),
+          lengthPenaltyWeight)
+      val nextCellState = evS.fromOutputs(nextTuple.state, nextStates)
+      val nextInput = embeddingFn(Basic.reshape(predictedIDs, -1))
+      ((scores, predictedIDs, parentIDs),
+          (nextCellState, nextLogProbabilities, nextFinished, nextSequenceLengths),
+          nextInput,
+          nextFinished)
+    }
+  }
+}
+
+object BeamSearchRNNDecoder {
+  /** Creates an op that performs a single step of beam search decoding.
+    *
+    * For each batch entry, the op computes the log-softmax of the logits of all beams, adds to it the log-probabilities
+    * of the beams, divides the result by the length penalty of the extended sequences, selects the top `beamWidth`
+    * candidates, and gathers the finished flags, the sequence lengths, and the states of their parent beams. Finished
+    * beams can only be extended by `endToken`, which keeps their log-probability and length unchanged.
+    *
+    * @param  logits              Tensor with shape `[batchSize, beamWidth, vocabSize]`, containing the logits of the
+    *                             next token.
+    * @param  logProbabilities    Tensor with shape `[batchSize, beamWidth]`, containing the log-probabilities of the
+    *                             beams, with the same data type as `logits`.
+    * @param  finished            `BOOLEAN` tensor with shape `[batchSize, beamWidth]`, specifying which beams have
+    *                             finished.
+    * @param  sequenceLengths     `INT32` tensor with shape `[batchSize, beamWidth]`, containing the beam lengths.
+    * @param  endToken            `INT32` scalar containing the end token ID.
+    * @param  states              Decoder states, each with first dimension equal to `batchSize * beamWidth`.
+    * @param  lengthPenaltyWeight Length penalty weight, where `0` means no length penalty.
+    * @param  name                Name for the created op.
+    * @return Tuple containing the scores, the predicted token IDs, the parent beam indices, the log-probabilities, the
+    *         finished flags, and the sequence lengths of the selected beams, as well as the gathered decoder states.
+    */
+  private[decoder] def beamSearchStep(
+      logits: Output, logProbabilities: Output, finished: Output, sequenceLengths: Output, endToken: Output,
+      states: Seq[Output], lengthPenaltyWeight: Float = 0.0f, name: String = "BeamSearchStep"
+  ): (Output, Output, Output, Output, Output, Output, Seq[Output]) = {
+    val outputs = Op.Builder("BeamSearchStep", name)
+        .addInput(logits)
+        .addInput(logProbabilities)
+        .addInput(finished)
+        .addInput(sequenceLengths)
+        .addInput(endToken)
+        .addInputList(states)
+        .setAttribute("length_penalty_weight", lengthPenaltyWeight)
+        .build().outputs
+    val nextStates = outputs.drop(6).toSeq
+    nextStates.zip(states).foreach(s => s._1.setShape(s._2.shape))
+    (outputs(0), outputs(1), outputs(2), outputs(3), outputs(4), outputs(5), nextStates)
+  }
+
+  /** Creates an op that reconstructs the full beams from the outputs of a beam search decoder, by following the parent
+    * beam indices backwards, starting from the last step.
+    *
+    * @param  predictedIDs `INT32` tensor with shape `[batchSize, maxTime, beamWidth]`, containing the token IDs
+    *                      selected at each step.
+    * @param  parentIDs    `INT32` tensor with shape `[batchSize, maxTime, beamWidth]`, containing the parent beam
+    *                      indices selected at each step.
+    * @param  name         Name for the created op.
+    * @return Created op output, which is an `INT32` tensor with shape `[batchSize, maxTime, beamWidth]`, containing
+    *         the token IDs of the reconstructed beams.
+    */
+  def gatherTree(predictedIDs: Output, parentIDs: Output, name: String = "BeamSearchGatherTree"): Output = {
+    Op.Builder("BeamSearchGatherTree", name)
+        .addInput(predictedIDs)
+        .addInput(parentIDs)
+        .build().outputs(0)
+  }
+
+  private[ops] object Gradients {
+    GradientsRegistry.registerNonDifferentiable("BeamSearchStep")
+    GradientsRegistry.registerNonDifferentiable("BeamSearchGatherTree")
+  }
+}
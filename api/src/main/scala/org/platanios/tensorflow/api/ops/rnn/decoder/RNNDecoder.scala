@@ -64,6 +64,12 @@ abstract class RNNDecoder[O, OS, S, SS, DO, DOS, DS, DSS](
 
   def zeroOutput(dataType: DataType): DO
 
+  /** Returns the data type of the zero output, given the initial decoder state. By default, it is inferred from the
+    * initial decoder state, which requires all of its tensors to have the same data type. */
+  protected def zeroOutputDataType(initialStates: Seq[Output]): DataType = {
+    RNN.inferStateDataType(null, initialStates)
+  }
+
   /** This method is called before any decoding iterations. It computes the initial input values and the initial state.
     *
     * @return Tuple containing: (i) a scalar `BOOLEAN` tensor specifying whether initialization has finished,
@@ -102,7 +108,7 @@ abstract class RNNDecoder[O, OS, S, SS, DO, DOS, DS, DSS](
       var (initialFinished, initialInput, initialState) = initialize()
       val initialInputs = evO.outputs(initialInput)
       val initialStates = evDS.outputs(initialState)
-      val zeroOutput = this.zeroOutput(RNN.inferStateDataType(null, initialStates))
+      val zeroOutput = this.zeroOutput(zeroOutputDataType(initialStates))
       val zeroOutputs = evDO.outputs(zeroOutput)
       val initialOutputTensorArrays = zeroOutputs.map(output => {
         TensorArray.create(0, output.dataType, dynamicSize = true, elementShape = output.shape)
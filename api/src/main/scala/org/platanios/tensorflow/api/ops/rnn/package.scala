@@ -21,4 +21,5 @@ package org.platanios.tensorflow.api.ops
 package object rnn {
   private[ops] trait API
       extends RNN
+          with CudnnRNN
 }
@@ -0,0 +1,175 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.training
+
+import org.platanios.tensorflow.api.Implicits._
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
+import org.platanios.tensorflow.api.ops._
+import org.platanios.tensorflow.api.ops.variables.{Variable, ZerosInitializer}
+import org.platanios.tensorflow.api.types.{FLOAT16, FLOAT32, INT32, INT8}
+
+/** Gradient compression scheme, used to reduce the amount of data sent between the workers that compute gradients and
+  * the devices that hold the corresponding variables (e.g., parameter servers) in distributed training.
+  *
+  * A compression scheme encodes each gradient into a set of tensors on the device where it was computed and decodes it
+  * on the device of the corresponding variable, so that only the encoded tensors cross device boundaries. Such schemes
+  * are applied using [[GradientCompression.compress]].
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+sealed trait GradientCompression {
+  /** Encodes `gradient`, which corresponds to `variable`, into a set of tensors. All ops created by this method are
+    * placed on the device of the gradient. */
+  protected def encode(gradient: Output, variable: Variable): Seq[Output]
+
+  /** Decodes a gradient with data type `gradient.dataType` and shape `gradient.shape` from the tensors returned by
+    * [[encode]]. All ops created by this method are placed on the device of the variable. */
+  protected def decode(encoded: Seq[Output], gradient: Output): Output
+
+  /** Compresses `gradient` on its device and decompresses it on the device of `variable`. */
+  private[training] def apply(gradient: OutputLike, variable: Variable): OutputLike = gradient match {
+    case g: Output => transfer(g, variable)
+    case g: OutputIndexedSlices =>
+      // Only the values of indexed slices are compressed, as their indices are typically much smaller.
+      OutputIndexedSlices(indices = g.indices, values = transfer(g.values, variable), denseShape = g.denseShape)
+    case g => g
+  }
+
+  private[this] def transfer(gradient: Output, variable: Variable): Output = {
+    val encoded = Op.createWith(device = gradient.device)(encode(gradient, variable))
+    Op.createWith(device = variable.device)(decode(encoded, gradient))
+  }
+}
+
+/** Contains the supported gradient compression schemes, along with helper functions for applying them. */
+object GradientCompression {
+  /** Compresses the gradients in `gradientsAndVariables` (e.g., as returned by
+    * [[optimizers.Optimizer.computeGradients]]), using `compression`, and returns the decompressed gradients paired with
+    * their variables, ready to be passed to [[optimizers.Optimizer.applyGradients]].
+    *
+    * Only floating-point gradients are compressed. Gradients that are computed on the same device as their variables
+    * are also left untouched, since they never cross device boundaries.
+    *
+    * @param  gradientsAndVariables Gradients paired with their corresponding variables.
+    * @param  compression           Compression scheme to use.
+    * @param  name                  Name scope for the created ops.
+    * @return Decompressed gradients paired with their corresponding variables.
+    */
+  def compress(
+      gradientsAndVariables: Seq[(OutputLike, Variable)], compression: GradientCompression,
+      name: String = "GradientCompression"): Seq[(OutputLike, Variable)] = {
+    Op.createWithNameScope(name) {
+      gradientsAndVariables.map {
+        case (gradient, variable) if gradient != null && gradient.dataType.isFloatingPoint &&
+            gradient.device != variable.device =>
+          (compression(gradient, variable), variable)
+        case gradientAndVariable => gradientAndVariable
+      }
+    }
+  }
+
+  /** Compression scheme that casts gradients to 16-bit floating-point numbers, halving the size of 32-bit gradients. */
+  case object FP16Compression extends GradientCompression {
+    override protected def encode(gradient: Output, variable: Variable): Seq[Output] = {
+      Seq(Math.cast(gradient, FLOAT16, name = "FP16Encode"))
+    }
+
+    override protected def decode(encoded: Seq[Output], gradient: Output): Output = {
+      Math.cast(encoded.head, gradient.dataType, name = "FP16Decode")
+    }
+  }
+
+  /** Compression scheme that quantizes gradients to 8-bit integers, using a single scale per gradient (i.e., its
+    * maximum absolute value), which quarters the size of 32-bit gradients. */
+  case object Int8Compression extends GradientCompression {
+    override protected def encode(gradient: Output, variable: Variable): Seq[Output] = {
+      Op.createWithNameScope("Int8Encode") {
+        val preciseGradient = Math.cast(gradient, FLOAT32)
+        val scale = Math.maximum(Math.max(Math.abs(preciseGradient)), 1e-30f)
+        val quantized = Math.cast(Math.round(Math.divide(preciseGradient, scale) * 127.0f), INT8)
+        Seq(quantized, scale)
+      }
+    }
+
+    override protected def decode(encoded: Seq[Output], gradient: Output): Output = {
+      Op.createWithNameScope("Int8Decode") {
+        val dequantized = Math.multiply(Math.cast(encoded(0), FLOAT32), Math.divide(encoded(1), 127.0f))
+        Math.cast(dequantized, gradient.dataType)
+      }
+    }
+  }
+
+  /** Compression scheme that only sends the `fraction` largest (in magnitude) elements of each gradient, along with
+    * their indices.
+    *
+    * With error feedback, the elements that are not sent are accumulated in a local variable, on the device of the
+    * gradient, and added to the gradient of the next step, so that no update is lost but only delayed. Indexed slices
+    * gradients (e.g., of embeddings) are already sparse and are thus not compressed by this scheme.
+    *
+    * @param  fraction      Fraction of the elements of each gradient to send. Must be in `(0, 1]`.
+    * @param  errorFeedback If `true`, the elements that are not sent are accumulated and added to future gradients.
+    */
+  case class TopKCompression(fraction: Double, errorFeedback: Boolean = true) extends GradientCompression {
+    if (fraction <= 0.0 || fraction > 1.0)
+      throw InvalidArgumentException(s"The top-k compression fraction must be in (0, 1], but was $fraction.")
+
+    override private[training] def apply(gradient: OutputLike, variable: Variable): OutputLike = gradient match {
+      case g: Output => super.apply(g, variable)
+      case g => g
+    }
+
+    override protected def encode(gradient: Output, variable: Variable): Seq[Output] = {
+      if (!gradient.shape.isFullyDefined)
+        throw InvalidArgumentException("Top-k gradient compression requires gradients with fully defined shapes.")
+      Op.createWithNameScope("TopKEncode") {
+        val numElements = gradient.shape.numElements.toInt
+        val k = math.max(1, math.ceil(fraction * numElements).toInt)
+        val residual = {
+          if (errorFeedback) {
+            Some(Variable.getLocalVariable(
+              s"${variable.name}/TopKResidual", gradient.dataType, gradient.shape, ZerosInitializer))
+          } else {
+            None
+          }
+        }
+        val accumulated = residual.map(r => Math.add(gradient, r.value)).getOrElse(gradient)
+        val flat = Basic.reshape(accumulated, Shape(-1))
+        val (_, indices) = NN.topK(Math.abs(flat), k, sorted = false)
+        val values = Basic.gather(flat, indices)
+        residual match {
+          case Some(r) =>
+            // The residual keeps everything that was not sent, and is updated before the encoded values are used.
+            val sent = Basic.scatterND(Basic.expandDims(indices, -1), values, Basic.constant(Shape(numElements)))
+            val update = r.assign(Basic.reshape(Math.subtract(flat, sent), gradient.shape))
+            Op.createWith(controlDependencies = Set(update.op)) {
+              Seq(Basic.identity(values), Basic.identity(indices))
+            }
+          case None => Seq(values, indices)
+        }
+      }
+    }
+
+    override protected def decode(encoded: Seq[Output], gradient: Output): Output = {
+      Op.createWithNameScope("TopKDecode") {
+        val numElements = gradient.shape.numElements.toInt
+        val dense = Basic.scatterND(
+          Basic.expandDims(Math.cast(encoded(1), INT32), -1), encoded(0), Basic.constant(Shape(numElements)))
+        Basic.reshape(dense, gradient.shape)
+      }
+    }
+  }
+}
@@ -0,0 +1,80 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.training
+
+import org.platanios.tensorflow.api.core.exception.InvalidArgumentException
+import org.platanios.tensorflow.api.types.{BFLOAT16, DataType, FLOAT16}
+
+/** Mixed-precision training configuration.
+  *
+  * When training in mixed precision, all variables (i.e., the master weights) are kept in `FLOAT32`, but the
+  * compute-intensive ops of the layers (i.e., matrix multiplications and convolutions) are performed in
+  * `computeDataType`, by casting their inputs and weights to that data type and casting their outputs back to
+  * `FLOAT32`. This allows using the half-precision units of the devices (e.g., the tensor cores of recent GPUs), while
+  * the variable updates are still computed in full precision.
+  *
+  * Gradients computed in half precision may underflow, and so the loss is multiplied by `lossScale` before the
+  * gradients are computed, and the gradients are divided by it before they are applied (see [[LossScale]] and
+  * [[optimizers.LossScaleOptimizer]]).
+  *
+  * @param  computeDataType Data type in which the compute-intensive ops are performed. Must be `FLOAT16` or `BFLOAT16`.
+  * @param  lossScale       Loss scaling method to use.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class MixedPrecision(computeDataType: DataType = FLOAT16, lossScale: LossScale = DynamicLossScale()) {
+  if (computeDataType != FLOAT16 && computeDataType != BFLOAT16)
+    throw InvalidArgumentException(
+      s"The mixed-precision compute data type must be FLOAT16 or BFLOAT16, but it was $computeDataType.")
+}
+
+/** Loss scaling method, used for mixed-precision training. */
+sealed trait LossScale
+
+/** Loss scaling method that uses a constant loss scale.
+  *
+  * @param  value Loss scale. Must be `>= 1`.
+  */
+case class StaticLossScale(value: Float) extends LossScale {
+  if (value < 1.0f)
+    throw InvalidArgumentException(s"The loss scale must be at least 1, but it was $value.")
+}
+
+/** Loss scaling method that adapts the loss scale during training.
+  *
+  * The loss scale starts at `initialValue`. Whenever the gradients of a step overflow (i.e., some of them are infinite
+  * or `NaN`), the update of that step is skipped and the loss scale is divided by `factor` (but it never falls below
+  * `minValue`). Whenever `increaseEvery` consecutive steps do not overflow, the loss scale is multiplied by `factor`.
+  *
+  * @param  initialValue  Initial loss scale. Must be `>= minValue`.
+  * @param  increaseEvery Number of consecutive steps without overflow after which the loss scale is increased. Must be
+  *                       `> 0`.
+  * @param  factor        Factor by which the loss scale is increased or decreased. Must be `> 1`.
+  * @param  minValue      Minimum loss scale. Must be `>= 1`.
+  */
+case class DynamicLossScale(
+    initialValue: Float = 32768.0f, increaseEvery: Int = 2000, factor: Float = 2.0f, minValue: Float = 1.0f
+) extends LossScale {
+  if (minValue < 1.0f)
+    throw InvalidArgumentException(s"The minimum loss scale must be at least 1, but it was $minValue.")
+  if (initialValue < minValue)
+    throw InvalidArgumentException(
+      s"The initial loss scale ($initialValue) must be at least equal to the minimum loss scale ($minValue).")
+  if (increaseEvery <= 0)
+    throw InvalidArgumentException(s"'increaseEvery' must be positive, but it was $increaseEvery.")
+  if (factor <= 1.0f)
+    throw InvalidArgumentException(s"The loss scale factor must be greater than 1, but it was $factor.")
+}
@@ -38,13 +38,16 @@ import org.platanios.tensorflow.api.ops.variables.Variable
   * @param  epsilon      AdaDelta constant factor.
   * @param  useLocking   If `true`, the gradient descent updates will be protected by a lock. Otherwise, the behavior is
   *                      undefined, but may exhibit less contention.
+  * @param  groupUpdates If `true`, the dense updates of variables placed on the same device and having the same data
+  *                      type are applied using a single op.
   * @param  name         Name for this optimizer.
   *
   * @author Emmanouil Antonios Platanios
   */
 case class AdaDelta private[api](
     learningRate: Double = 0.01, decay: Decay = NoDecay, rho: Double = 0.95, epsilon: Double = 1e-8,
-    useLocking: Boolean = false, name: String = "AdaDeltaOptimizer") extends Optimizer {
+    useLocking: Boolean = false, override val groupUpdates: Boolean = false,
+    name: String = "AdaDeltaOptimizer") extends Optimizer {
   private[this] var learningRateTensor: Output = _
   private[this] var rhoTensor         : Output = _
   private[this] var epsilonTensor     : Output = _
@@ -95,6 +98,19 @@ case class AdaDelta private[api](
       useLocking = useLocking)
   }
 
+  override protected def applyDenseGroup(
+      gradients: Seq[Output], variables: Seq[Variable], iteration: Option[Variable]): Op = {
+    AdaDelta.resourceApplyDenseList(
+      variables = variables,
+      accumulators = variables.map(getSlot("accumulator", _)),
+      accumulatorUpdates = variables.map(getSlot("accumulator_update", _)),
+      stepSize = getLearningRate(variables.head, iteration),
+      rho = getRho(variables.head),
+      epsilon = getEpsilon(variables.head),
+      gradients = gradients,
+      useLocking = useLocking)
+  }
+
   override def applySparse(gradient: OutputIndexedSlices, variable: Variable, iteration: Option[Variable]): Op = {
     val accumulator = getSlot("accumulator", variable)
     val accumulatorUpdate = getSlot("accumulator_update", variable)
@@ -149,6 +165,37 @@ private[api] object AdaDelta {
         .build()
   }
 
+  /** Creates an op that updates all of `variables` by applying the AdaDelta algorithm update to them. All variables
+    * must have the same data type.
+    *
+    * @param  variables          Variables whose values to update.
+    * @param  accumulators       AdaDelta accumulator variables, one for each variable.
+    * @param  accumulatorUpdates AdaDelta accumulator update variables, one for each variable.
+    * @param  stepSize           Step size to use for the AdaDelta update.
+    * @param  rho                AdaDelta decay factor.
+    * @param  epsilon            AdaDelta constant factor.
+    * @param  gradients          Gradients to apply, one for each variable.
+    * @param  useLocking         If `true`, the subtraction will be protected by a lock. Otherwise, the behavior is
+    *                            undefined, but may exhibit less contention.
+    * @param  name               Name for the created op.
+    * @return Created op.
+    */
+  private[AdaDelta] def resourceApplyDenseList(
+      variables: Seq[Variable], accumulators: Seq[Variable], accumulatorUpdates: Seq[Variable], stepSize: Output,
+      rho: Output, epsilon: Output, gradients: Seq[Output], useLocking: Boolean = false,
+      name: String = "ResourceApplyAdaDeltaList"): Op = {
+    Op.Builder(opType = "ResourceApplyAdadeltaList", name = name)
+        .addInputList(variables.map(_.handle))
+        .addInputList(accumulators.map(_.handle))
+        .addInputList(accumulatorUpdates.map(_.handle))
+        .addInput(stepSize)
+        .addInput(rho)
+        .addInput(epsilon)
+        .addInputList(gradients)
+        .setAttribute("use_locking", useLocking)
+        .build()
+  }
+
   /** Creates an op that applies sparse updates to `variable` by applying the AdaDelta algorithm update to it.
     *
     * That is for rows that we have a gradient for, the AdaDelta update is as follows:
@@ -36,13 +36,15 @@ import org.platanios.tensorflow.api.ops.variables.{ConstantInitializer, Variable
   *                      value).
   * @param  useLocking   If `true`, the gradient descent updates will be protected by a lock. Otherwise, the behavior is
   *                      undefined, but may exhibit less contention.
+  * @param  groupUpdates If `true`, the dense updates of variables placed on the same device and having the same data
+  *                      type are applied using a single op.
   * @param  name         Name for this optimizer.
   *
   * @author Emmanouil Antonios Platanios
   */
 case class AdaGrad private[api](
     learningRate: Double = 0.01, decay: Decay = NoDecay, epsilon: Double = 1e-8, useLocking: Boolean = false,
-    name: String = "AdaGradOptimizer") extends Optimizer {
+    override val groupUpdates: Boolean = false, name: String = "AdaGradOptimizer") extends Optimizer {
   private[this] var learningRateTensor: Output = _
 
   private[this] def getLearningRate(variable: Variable, iteration: Option[Variable]): Output = {
@@ -68,6 +70,13 @@ case class AdaGrad private[api](
     AdaGrad.resourceApplyDense(variable, accumulator, getLearningRate(variable, iteration), gradient, useLocking)
   }
 
+  override protected def applyDenseGroup(
+      gradients: Seq[Output], variables: Seq[Variable], iteration: Option[Variable]): Op = {
+    val accumulators = variables.map(getSlot("accumulator", _))
+    AdaGrad.resourceApplyDenseList(
+      variables, accumulators, getLearningRate(variables.head, iteration), gradients, useLocking)
+  }
+
   override def applySparse(gradient: OutputIndexedSlices, variable: Variable, iteration: Option[Variable]): Op = {
     val accumulator = getSlot("accumulator", variable)
     AdaGrad.resourceApplySparse(
@@ -105,6 +114,30 @@ private[api] object AdaGrad {
         .build()
   }
 
+  /** Creates an op that updates all of `variables` by applying the AdaGrad algorithm update to them. All variables
+    * must have the same data type.
+    *
+    * @param  variables    Variables whose values to update.
+    * @param  accumulators AdaGrad accumulator variables, one for each variable.
+    * @param  stepSize     Step size to use for the AdaGrad update.
+    * @param  gradients    Gradients to apply, one for each variable.
+    * @param  useLocking   If `true`, the subtraction will be protected by a lock. Otherwise, the behavior is
+    *                      undefined, but may exhibit less contention.
+    * @param  name         Name for the created op.
+    * @return Created op.
+    */
+  private[AdaGrad] def resourceApplyDenseList(
+      variables: Seq[Variable], accumulators: Seq[Variable], stepSize: Output, gradients: Seq[Output],
+      useLocking: Boolean = false, name: String = "ResourceApplyAdaGradList"): Op = {
+    Op.Builder(opType = "ResourceApplyAdagradList", name = name)
+        .addInputList(variables.map(_.handle))
+        .addInputList(accumulators.map(_.handle))
+        .addInput(stepSize)
+        .addInputList(gradients)
+        .setAttribute("use_locking", useLocking)
+        .build()
+  }
+
   /** Creates an op that applies sparse updates to `variable` by applying the AdaGrad algorithm update to it.
     *
     * That is for rows that we have a gradient for, the AdaGrad update is as follows:
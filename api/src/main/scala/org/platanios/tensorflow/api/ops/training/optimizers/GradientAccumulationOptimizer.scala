@@ -0,0 +1,157 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.training.optimizers
+
+import org.platanios.tensorflow.api.Implicits._
+import org.platanios.tensorflow.api.core.{Graph, Shape}
+import org.platanios.tensorflow.api.ops._
+import org.platanios.tensorflow.api.ops.control_flow.ControlFlow
+import org.platanios.tensorflow.api.ops.variables.{Variable, VariableScope, ZerosInitializer}
+import org.platanios.tensorflow.api.types.INT64
+
+/** Optimizer wrapper that accumulates gradients over multiple steps before applying them, which allows training with
+  * effective batch sizes that do not fit in device memory.
+  *
+  * Each call of the op returned by [[applyGradients]] (i.e., each micro-step) adds the provided gradients in place to
+  * persistent accumulator slots (one per variable), using `AssignAddVariableOp` for dense gradients and
+  * `ResourceScatterAdd` for [[OutputIndexedSlices]] gradients, so that no copies of the accumulated gradients are
+  * created. Every `numSteps` micro-steps, the average of the accumulated gradients is applied using the wrapped
+  * optimizer and the accumulators are reset to zero. The accumulators live on the devices of their variables and so
+  * no host round trips are required.
+  *
+  * Note that `iteration` is incremented on every micro-step, while the wrapped optimizer only sees one update every
+  * `numSteps` micro-steps (and it is not provided with `iteration`).
+  *
+  * @param  optimizer Wrapped optimizer, used to apply the accumulated gradients.
+  * @param  numSteps  Number of micro-steps over which the gradients are accumulated before being applied. Must be
+  *                   `> 0`.
+  * @param  name      Name for this optimizer.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class GradientAccumulationOptimizer private[api](
+    val optimizer: Optimizer,
+    val numSteps: Int,
+    override val name: String = "GradientAccumulationOptimizer"
+) extends Optimizer {
+  if (numSteps <= 0)
+    throw new IllegalArgumentException(s"'numSteps' must be positive, but it was $numSteps.")
+
+  override val useLocking  : Boolean = optimizer.useLocking
+  override val groupUpdates: Boolean = optimizer.groupUpdates
+
+  private[this] var stepVariable: Variable = _
+
+  /** Returns the variable that counts the accumulated micro-steps, creating it if needed. */
+  private[this] def accumulatedSteps(graph: Graph): Variable = {
+    if (stepVariable == null) {
+      stepVariable = Op.createWith(graph = graph, controlDependencies = Set.empty[Op]) {
+        VariableScope.createWithVariableScope(name) {
+          Variable.getVariable("AccumulatedSteps", INT64, Shape.scalar(), ZerosInitializer, trainable = false)
+        }
+      }
+    }
+    stepVariable
+  }
+
+  override protected def createSlots(variables: Seq[Variable]): Unit = {
+    variables.foreach(v => zerosSlot("Accumulator", v, name))
+  }
+
+  override def applyGradients(
+      gradientsAndVariables: Seq[(OutputLike, Variable)], iteration: Option[Variable] = None,
+      name: String = this.name): Op = {
+    val nonNullGradientsAndVariables = gradientsAndVariables.filter(_._1 != null)
+    val variables = nonNullGradientsAndVariables.map(_._2)
+    if (variables.isEmpty)
+      throw new IllegalArgumentException(
+        s"No gradients were provided for any of the variables: ${gradientsAndVariables.map(_._2).mkString(", ")}.")
+
+    // All slots must be created outside the conditional that applies the accumulated gradients.
+    createSlotsForVariables(variables, this.name)
+    optimizer.createSlotsForVariables(variables, optimizer.name)
+    val steps = accumulatedSteps(variables.head.graph)
+
+    Op.createWithNameScope(name) {
+      val accumulators = variables.map(getSlot("Accumulator", _))
+      val accumulateOps = Op.createWithNameScope("Accumulate") {
+        nonNullGradientsAndVariables.zip(accumulators).map {
+          case ((gradient: OutputIndexedSlices, _), accumulator) =>
+            accumulator.assignScatterAdd(gradient.indices, gradient.values).op
+          case ((gradient, _), accumulator) =>
+            accumulator.assignAdd(gradient.toOutput).op
+        }.toSet
+      }
+      val currentStep = Op.createWith(controlDependencies = accumulateOps) {
+        steps.assignAdd(Basic.constant(1L, INT64))
+      }
+      val applyUpdates = ControlFlow.cond(
+        Math.equal(Math.floorMod(currentStep, Basic.constant(numSteps.toLong, INT64)), Basic.constant(0L, INT64)),
+        () => {
+          val averagedGradientsAndVariables = Op.createWithNameScope("Average") {
+            accumulators.zip(variables).map {
+              case (accumulator, variable) =>
+                val value = accumulator.value
+                (Math.divide(value, Basic.constant(numSteps, value.dataType)), variable)
+            }
+          }
+          val applyOp = optimizer.applyGradients(averagedGradientsAndVariables, None, optimizer.name)
+          Op.createWith(controlDependencies = Set(applyOp)) {
+            ControlFlow.group(accumulators.map(a => a.assign(Basic.zerosLike(a.value)).op).toSet, "Reset")
+          }
+        },
+        () => ControlFlow.noOp("SkipUpdate"),
+        name = "ApplyIfAccumulated")
+
+      // Create the op that applies the gradient updates to all variables.
+      val applyAll = {
+        iteration match {
+          case Some(i) =>
+            Op.createWith(colocationOps = Set[Op](i.op), controlDependencies = Set(applyUpdates)) {
+              i.assignAdd(Basic.constant(1, dataType = i.dataType), name).op
+            }
+          case None => ControlFlow.group(Set(applyUpdates), name)
+        }
+      }
+
+      // Add the created op to the graph train ops collection.
+      applyAll.graph.addToCollection(applyAll, Graph.Keys.TRAIN_OP)
+
+      applyAll
+    }
+  }
+
+  // The following methods are never called, because the updates are applied by the wrapped optimizer.
+
+  override protected def applyDense(gradient: Output, variable: Variable, iteration: Option[Variable]): Op = {
+    throw new UnsupportedOperationException(
+      "'GradientAccumulationOptimizer' applies its updates using the wrapped optimizer.")
+  }
+
+  override protected def applySparse(
+      gradient: OutputIndexedSlices, variable: Variable, iteration: Option[Variable]): Op = {
+    throw new UnsupportedOperationException(
+      "'GradientAccumulationOptimizer' applies its updates using the wrapped optimizer.")
+  }
+}
+
+object GradientAccumulationOptimizer {
+  def apply(
+      optimizer: Optimizer, numSteps: Int, name: String = "GradientAccumulationOptimizer"
+  ): GradientAccumulationOptimizer = {
+    new GradientAccumulationOptimizer(optimizer, numSteps, name)
+  }
+}
@@ -29,13 +29,16 @@ import org.platanios.tensorflow.api.ops.variables.Variable
   *                      [Sutskever et. al., 2013](http://proceedings.mlr.press/v28/sutskever13.pdf).
   * @param  useLocking   If `true`, the gradient descent updates will be protected by a lock. Otherwise, the behavior is
   *                      undefined, but may exhibit less contention.
+  * @param  groupUpdates If `true`, the dense updates of variables placed on the same device and having the same data
+  *                      type are applied using a single op.
   * @param  name         Name for this optimizer.
   *
   * @author Emmanouil Antonios Platanios
   */
 case class GradientDescent private[api](
     learningRate: Double, decay: Decay = NoDecay, momentum: Double = 0.0, useNesterov: Boolean = false,
-    useLocking: Boolean = false, name: String = "GradientDescentOptimizer") extends Optimizer {
+    useLocking: Boolean = false, override val groupUpdates: Boolean = false,
+    name: String = "GradientDescentOptimizer") extends Optimizer {
   private[this] var learningRateTensor: Output = _
   private[this] var momentumTensor    : Output = _
 
@@ -77,6 +80,22 @@ case class GradientDescent private[api](
       GradientDescent.resourceApplyDense(variable, getLearningRate(variable, iteration), gradient, useLocking)
   }
 
+  override protected def applyDenseGroup(
+      gradients: Seq[Output], variables: Seq[Variable], iteration: Option[Variable]): Op = {
+    if (momentum > 0.0f)
+      GradientDescent.resourceApplyMomentumDenseList(
+        variables = variables,
+        accumulators = variables.map(getSlot("momentum", _)),
+        stepSize = getLearningRate(variables.head, iteration),
+        gradients = gradients,
+        momentum = getMomentum(variables.head),
+        useLocking = useLocking,
+        useNesterov = useNesterov)
+    else
+      GradientDescent.resourceApplyDenseList(
+        variables, getLearningRate(variables.head, iteration), gradients, useLocking)
+  }
+
   override def applySparse(gradient: OutputIndexedSlices, variable: Variable, iteration: Option[Variable]): Op = {
     if (momentum > 0.0f)
       GradientDescent.resourceApplyMomentumSparse(
@@ -91,11 +110,6 @@ case class GradientDescent private[api](
     else
       variable.assignScatterSub(gradient.indices, gradient.values * getLearningRate(variable, iteration)).op
   }
-
-  override def applySparseDuplicateIndices(
-      gradient: OutputIndexedSlices, variable: Variable, iteration: Option[Variable]): Op = {
-    applySparse(gradient, variable, iteration)
-  }
 }
 
 private[api] object GradientDescent {
@@ -120,6 +134,28 @@ private[api] object GradientDescent {
         .build()
   }
 
+  /** Creates an op that updates the values of all of `variables` by subtracting `stepSize * gradients(i)` from each
+    * `variables(i)`. All variables must have the same data type.
+    *
+    * @param  variables  Variables whose values to update.
+    * @param  stepSize   Step size to use for the gradient descent update.
+    * @param  gradients  Gradients to apply, one for each variable.
+    * @param  useLocking If `true`, the subtractions will be protected by a lock. Otherwise, the behavior is undefined,
+    *                    but may exhibit less contention.
+    * @param  name       Name for the created op.
+    * @return Created op.
+    */
+  private[GradientDescent] def resourceApplyDenseList(
+      variables: Seq[Variable], stepSize: Output, gradients: Seq[Output], useLocking: Boolean = false,
+      name: String = "ResourceApplyGradientDescentList"): Op = {
+    Op.Builder(opType = "ResourceApplyGradientDescentList", name = name)
+        .addInputList(variables.map(_.handle))
+        .addInput(stepSize)
+        .addInputList(gradients)
+        .setAttribute("use_locking", useLocking)
+        .build()
+  }
+
   /** Creates an op that applies updates to the value of `variable` according to the momentum scheme.
     *
     * If `useNesterov = false`, the op computes:
@@ -155,6 +191,35 @@ private[api] object GradientDescent {
         .build()
   }
 
+  /** Creates an op that applies updates to the values of all of `variables` according to the momentum scheme. All
+    * variables must have the same data type.
+    *
+    * @param  variables    Variables whose values to update.
+    * @param  accumulators Momentum accumulator variables, one for each variable.
+    * @param  stepSize     Step size to use for the gradient descent update.
+    * @param  gradients    Gradients to apply, one for each variable.
+    * @param  momentum     Momentum value to use.
+    * @param  useNesterov  If `true`, Nesterov acceleration is used.
+    * @param  useLocking   If `true`, the updates will be protected by a lock. Otherwise, the behavior is undefined,
+    *                      but may exhibit less contention.
+    * @param  name         Name for the created op.
+    * @return Created op.
+    */
+  private[GradientDescent] def resourceApplyMomentumDenseList(
+      variables: Seq[Variable], accumulators: Seq[Variable], stepSize: Output, gradients: Seq[Output],
+      momentum: Output, useNesterov: Boolean = false, useLocking: Boolean = false,
+      name: String = "ResourceApplyMomentumList"): Op = {
+    Op.Builder(opType = "ResourceApplyMomentumList", name = name)
+        .addInputList(variables.map(_.handle))
+        .addInputList(accumulators.map(_.handle))
+        .addInput(stepSize)
+        .addInput(momentum)
+        .addInputList(gradients)
+        .setAttribute("use_locking", useLocking)
+        .setAttribute("use_nesterov", useNesterov)
+        .build()
+  }
+
   /** Creates an op that applies sparse updates to the value of `variable` according to the momentum scheme.
     *
     * If `useNesterov = false`, for rows that we have a gradient for, the op computes:
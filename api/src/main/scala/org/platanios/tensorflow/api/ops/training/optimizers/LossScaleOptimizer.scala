@@ -0,0 +1,185 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.ops.training.optimizers
+
+import org.platanios.tensorflow.api.Implicits._
+import org.platanios.tensorflow.api.core.{Graph, Shape}
+import org.platanios.tensorflow.api.ops._
+import org.platanios.tensorflow.api.ops.control_flow.ControlFlow
+import org.platanios.tensorflow.api.ops.training.{DynamicLossScale, LossScale, StaticLossScale}
+import org.platanios.tensorflow.api.ops.variables.{ConstantInitializer, Variable, VariableScope, ZerosInitializer}
+import org.platanios.tensorflow.api.types.{FLOAT32, INT64}
+
+/** Optimizer wrapper that applies loss scaling, for use in mixed-precision training.
+  *
+  * The loss is multiplied by the current loss scale before its gradients are computed, and the gradients are divided
+  * by it afterwards, so that the (unscaled) gradients returned by [[computeGradients]] can be processed as usual (e.g.,
+  * clipped) before being passed to [[applyGradients]]. Small gradient values that would otherwise underflow in half
+  * precision are thus preserved.
+  *
+  * The gradients are checked for overflow (i.e., for infinite or `NaN` values) when they are applied. If any of them
+  * overflows, the update of the wrapped optimizer is skipped for that step (its slots are not updated either), but
+  * `iteration` is still incremented. When using a [[DynamicLossScale]], the loss scale is also adapted after each step.
+  *
+  * @param  optimizer Wrapped optimizer, used to apply the unscaled gradients.
+  * @param  lossScale Loss scaling method to use.
+  * @param  name      Name for this optimizer.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class LossScaleOptimizer private[api](
+    val optimizer: Optimizer,
+    val lossScale: LossScale,
+    override val name: String = "LossScaleOptimizer"
+) extends Optimizer {
+  override val useLocking  : Boolean = optimizer.useLocking
+  override val groupUpdates: Boolean = optimizer.groupUpdates
+
+  private[this] var lossScaleVariable: Variable = _
+  private[this] var goodStepsVariable: Variable = _
+  private[this] var lossScaleValue   : Output   = _
+
+  /** Returns the current loss scale, creating the variables that hold the state of dynamic loss scaling, if needed. */
+  private[this] def currentLossScale(graph: Graph): Output = {
+    if (lossScaleValue == null) {
+      lossScaleValue = Op.createWith(graph = graph, controlDependencies = Set.empty[Op]) {
+        lossScale match {
+          case StaticLossScale(value) => Basic.constant(value, FLOAT32, name = s"$name/LossScale")
+          case DynamicLossScale(initialValue, _, _, _) =>
+            VariableScope.createWithVariableScope(name) {
+              lossScaleVariable = Variable.getVariable(
+                "LossScale", FLOAT32, Shape.scalar(), ConstantInitializer(initialValue), trainable = false)
+              goodStepsVariable = Variable.getVariable(
+                "GoodSteps", INT64, Shape.scalar(), ZerosInitializer, trainable = false)
+            }
+            lossScaleVariable.value
+        }
+      }
+    }
+    lossScaleValue
+  }
+
+  override def computeGradients(
+      loss: Output, lossGradients: Seq[OutputLike] = null, variables: Set[Variable] = null,
+      gradientsGatingMethod: Gradients.GatingMethod = Gradients.OpGating,
+      gradientsAggregationMethod: Gradients.AggregationMethod = Gradients.AddAggregationMethod,
+      colocateGradientsWithOps: Boolean = false): Seq[(OutputLike, Variable)] = {
+    val scale = currentLossScale(loss.graph)
+    val scaledLoss = Math.multiply(loss, Math.cast(scale, loss.dataType), name = s"$name/ScaledLoss")
+    val gradientsAndVariables = optimizer.computeGradients(
+      scaledLoss, lossGradients, variables, gradientsGatingMethod, gradientsAggregationMethod,
+      colocateGradientsWithOps)
+    Op.createWithNameScope(s"$name/Unscale") {
+      val inverseScale = Math.realDivide(1.0f, scale)
+      gradientsAndVariables.map {
+        case (null, variable) => (null, variable)
+        case (gradient: OutputIndexedSlices, variable) =>
+          val values = Math.multiply(gradient.values, Math.cast(inverseScale, gradient.dataType))
+          (OutputIndexedSlices(indices = gradient.indices, values = values, denseShape = gradient.denseShape), variable)
+        case (gradient: Output, variable) =>
+          (Math.multiply(gradient, Math.cast(inverseScale, gradient.dataType)), variable)
+        case gradientAndVariable => gradientAndVariable
+      }
+    }
+  }
+
+  override def applyGradients(
+      gradientsAndVariables: Seq[(OutputLike, Variable)], iteration: Option[Variable] = None,
+      name: String = this.name): Op = {
+    val gradients = gradientsAndVariables.map(_._1).filter(_ != null)
+    val variables = gradientsAndVariables.filter(_._1 != null).map(_._2)
+    if (variables.isEmpty)
+      throw new IllegalArgumentException(
+        s"No gradients were provided for any of the variables: ${gradientsAndVariables.map(_._2).mkString(", ")}.")
+
+    // The slots of the wrapped optimizer must be created outside the conditional that skips the overflowing updates.
+    optimizer.createSlotsForVariables(variables, optimizer.name)
+    val scale = currentLossScale(variables.head.graph)
+
+    Op.createWithNameScope(name) {
+      val allFinite = Op.createWithNameScope("AllFinite") {
+        Math.all(Basic.stack(gradients.map(g => {
+          val values = g match {
+            case o: OutputIndexedSlices => o.values
+            case o: SparseOutput => o.values
+            case o: Output => o
+          }
+          Math.all(Math.isFinite(values))
+        })))
+      }
+      val applyUpdates = ControlFlow.cond(
+        allFinite,
+        () => optimizer.applyGradients(gradientsAndVariables, None, optimizer.name),
+        () => ControlFlow.noOp("SkipUpdate"),
+        name = "ApplyIfFinite")
+      val updateOps = lossScale match {
+        case s: DynamicLossScale =>
+          Set(applyUpdates, Op.createWith(controlDependencies = Set(applyUpdates)) {
+            updateDynamicLossScale(s, scale, allFinite)
+          })
+        case _ => Set(applyUpdates)
+      }
+
+      // Create the op that applies the gradient updates to all variables.
+      val applyAll = {
+        iteration match {
+          case Some(i) =>
+            Op.createWith(colocationOps = Set[Op](i.op), controlDependencies = updateOps) {
+              i.assignAdd(Basic.constant(1, dataType = i.dataType), name).op
+            }
+          case None => ControlFlow.group(updateOps, name)
+        }
+      }
+
+      // Add the created op to the graph train ops collection.
+      applyAll.graph.addToCollection(applyAll, Graph.Keys.TRAIN_OP)
+
+      applyAll
+    }
+  }
+
+  /** Creates an op that updates the dynamic loss scale, given whether the gradients of the current step overflowed. */
+  private[this] def updateDynamicLossScale(lossScale: DynamicLossScale, scale: Output, allFinite: Output): Op = {
+    Op.createWithNameScope("UpdateLossScale") {
+      val goodSteps = Math.select(allFinite, goodStepsVariable.value + 1L, Basic.zerosLike(goodStepsVariable.value))
+      val increase = allFinite.logicalAnd(goodSteps >= lossScale.increaseEvery.toLong)
+      val decreasedScale = Math.maximum(Math.divide(scale, lossScale.factor), lossScale.minValue)
+      val newScale = Math.select(
+        increase, Math.multiply(scale, lossScale.factor), Math.select(allFinite, scale, decreasedScale))
+      val newGoodSteps = Math.select(increase, Basic.zerosLike(goodSteps), goodSteps)
+      ControlFlow.group(Set(
+        lossScaleVariable.assign(newScale).op,
+        goodStepsVariable.assign(newGoodSteps).op))
+    }
+  }
+
+  // The following methods are never called, because the updates are applied by the wrapped optimizer.
+
+  override protected def applyDense(gradient: Output, variable: Variable, iteration: Option[Variable]): Op = {
+    throw new UnsupportedOperationException("'LossScaleOptimizer' applies its updates using the wrapped optimizer.")
+  }
+
+  override protected def applySparse(
+      gradient: OutputIndexedSlices, variable: Variable, iteration: Option[Variable]): Op = {
+    throw new UnsupportedOperationException("'LossScaleOptimizer' applies its updates using the wrapped optimizer.")
+  }
+}
+
+object LossScaleOptimizer {
+  def apply(optimizer: Optimizer, lossScale: LossScale, name: String = "LossScaleOptimizer"): LossScaleOptimizer = {
+    new LossScaleOptimizer(optimizer, lossScale, name)
+  }
+}
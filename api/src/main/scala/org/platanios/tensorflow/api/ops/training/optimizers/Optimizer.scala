@@ -35,6 +35,12 @@ trait Optimizer {
   /** Boolean value indicating whether to apply use locks to prevent concurrent updates to variables. */
   val useLocking: Boolean
 
+  /** Boolean value indicating whether to group the dense updates of variables that are placed on the same device and
+    * have the same data type, so that they are applied using a single op (see [[applyDenseGroup]]), rather than using
+    * one op per variable. This reduces the op scheduling overhead when there are many small variables (e.g., the
+    * shards of partitioned variables). */
+  val groupUpdates: Boolean = false
+
   /** Some [[Optimizer]] subclasses use additional variables. For example, `MomentumOptimizer` and `AdaGradOptimizer`
     * use variables to accumulate updates. This map is where these variables are stored. */
   protected val slots = mutable.Map.empty[String, mutable.Map[Variable, Variable]]
@@ -140,33 +146,30 @@ trait Optimizer {
         s"No gradients were provided for any of the variables: ${gradientsAndVariables.map(_._2).mkString(", ")}.")
 
     // Create the slots needed by the variables.
-    Op.createWith(controlDependencies = Set.empty[Op]) {
-      val mappedVariables = variables.map(variable => {
-        if (variable.op.opType == "VarHandleOp") {
-          val v = variable.graph.trainableVariables.find(v => v.isInstanceOf[Variable] && v.handle.op == variable.op)
-          if (v.isEmpty)
-            throw new IllegalArgumentException(s"Got handle '$variable', but could not locate the source variable.")
-          v.get
-        } else {
-          variable
-        }
-      })
-      VariableScope.createWithVariableScope(name) {
-        createSlots(mappedVariables)
-      }
-    }
+    createSlotsForVariables(variables, name)
 
     Op.createWithNameScope(name) {
       prepare()
 
       // Collect the update ops for all variables.
       val updateOps = mutable.Set.empty[Op]
-      for ((g, v, p) <- gradientsAndVariables.map(p => (p._1, p._2, getVariableProcessor(p._2))).filter(_._1 != null)) {
+      val (groupedUpdates, individualUpdates) = gradientsAndVariables
+          .map(p => (p._1, p._2, getVariableProcessor(p._2)))
+          .filter(_._1 != null)
+          .partition(p => groupUpdates && p._1.isInstanceOf[Output] && p._3.isInstanceOf[ResourceVariableProcessor])
+      for ((g, v, p) <- individualUpdates) {
         // We colocate all ops created for variable application on the same device as the variable.
         Op.createWith(nameScope = s"${v.op.name}Update", colocationOps = Set[Op](v.op)) {
           updateOps.add(p.updateOp(this, g, iteration))
         }
       }
+      groupedUpdates.groupBy(p => (p._2.device, p._2.dataType)).values.foreach(group => {
+        // We colocate the op created for each group with all the variables in that group.
+        val variables = group.map(_._2)
+        Op.createWith(nameScope = "GroupedUpdate", colocationOps = variables.map(_.op).toSet) {
+          updateOps.add(applyDenseGroup(group.map(_._1.asInstanceOf[Output]), variables, iteration))
+        }
+      })
 
       // Create the op that applies the gradient updates to all variables.
       val applyUpdates = {
@@ -188,6 +191,32 @@ trait Optimizer {
     }
   }
 
+  /** Creates the slots needed by this optimizer for `variables`, outside of any control dependencies, using `name` as
+    * their variable scope. Slots that already exist are reused and so calling this method more than once is safe. This
+    * allows wrapper optimizers (e.g., [[LossScaleOptimizer]]) to create the slots before entering a control flow
+    * context in which the gradients are applied.
+    *
+    * @param  variables Variables for which to create slots.
+    * @param  name      Name used when applying the gradients (i.e., the variable scope of the slots).
+    */
+  private[optimizers] def createSlotsForVariables(variables: Seq[Variable], name: String): Unit = {
+    Op.createWith(controlDependencies = Set.empty[Op]) {
+      val mappedVariables = variables.map(variable => {
+        if (variable.op.opType == "VarHandleOp") {
+          val v = variable.graph.trainableVariables.find(v => v.isInstanceOf[Variable] && v.handle.op == variable.op)
+          if (v.isEmpty)
+            throw new IllegalArgumentException(s"Got handle '$variable', but could not locate the source variable.")
+          v.get
+        } else {
+          variable
+        }
+      })
+      VariableScope.createWithVariableScope(name) {
+        createSlots(mappedVariables)
+      }
+    }
+  }
+
   /** Supported data types for the loss function, the variables, and the gradients. Subclasses should override this
     * field allow other float types. */
   protected val supportedDataTypes: Set[DataType] = Set[DataType](FLOAT32, FLOAT64)
@@ -234,6 +263,20 @@ trait Optimizer {
     */
   protected def applyDense(gradient: Output, variable: Variable, iteration: Option[Variable]): Op
 
+  /** Applies the updates corresponding to the provided gradients, to the provided variables, which are all placed on
+    * the same device and have the same data type. This function is used when [[groupUpdates]] is `true` and, by
+    * default, it simply groups the ops created by [[applyDense]] for each variable. Optimizers that support applying
+    * their updates to many variables using a single op should override it.
+    *
+    * @param  gradients Gradient tensors.
+    * @param  variables Variables.
+    * @param  iteration Option containing current iteration in the optimization loop, if one has been provided.
+    * @return Created op that applies the provided gradients to the provided variables.
+    */
+  protected def applyDenseGroup(gradients: Seq[Output], variables: Seq[Variable], iteration: Option[Variable]): Op = {
+    ControlFlow.group(gradients.zip(variables).map(p => applyDense(p._1, p._2, iteration)).toSet)
+  }
+
   /** Applies the updates corresponding to the provided gradient, to the provided variable.
     *
     * The [[OutputIndexedSlices]] object specified by `gradient` in this function is by default pre-processed in
@@ -260,8 +303,9 @@ trait Optimizer {
     * correct behavior, so this is enforced here by reconstructing the [[OutputIndexedSlices]] to have only unique
     * indices, and then calling [[applySparse]].
     *
-    * Optimizers which deal correctly with repeated indices may instead override this method to avoid the induced
-    * overhead.
+    * The de-duplication happens on the device that produced the gradient, so that only its unique rows are sent to the
+    * device of the variable. Optimizers which deal correctly with repeated indices may instead override this method to
+    * avoid the induced overhead, but the update will then be applied to every row of the gradient separately.
     *
     * @param  gradient  Gradient tensor.
     * @param  variable  Variable.
@@ -364,12 +408,16 @@ private[optimizers] object Optimizer {
   /** Sums the values of the provided indexed slices associated with any non-unique indices and returns the resulting
     * de-duplicated version of the provided indexed slices.
     *
+    * The summation is performed by a single fused op that is colocated with the op producing the values of the indexed
+    * slices, rather than with the variable being updated. When the variable lives on a different device (e.g., on a
+    * parameter server), only the unique rows are thus sent to that device and scattered into the variable.
+    *
     * @param  input Indexed slices with potentially duplicate indices.
     * @return Indexed slices with de-duplicated indices and summed values slices associated with each unique index.
     */
   private[Optimizer] def deDuplicateOutputIndexedSlices(input: OutputIndexedSlices): OutputIndexedSlices = {
-    val (uniqueIndices, newIndexPositions) = Basic.unique(input.indices)
-    val summedValues = Math.unsortedSegmentSum(input.values, newIndexPositions, Basic.shape(uniqueIndices)(0))
-    OutputIndexedSlices(indices = uniqueIndices, values = summedValues, denseShape = input.denseShape)
+    Op.colocateWith(Set(input.values.op), ignoreExisting = true) {
+      Sparse.indexedSlicesUniqueSum(input, name = "DeDuplicate")
+    }
   }
 }
@@ -25,28 +25,36 @@ package object optimizers {
     type AdaDelta = optimizers.AdaDelta
     type AdaGrad = optimizers.AdaGrad
     type GradientDescent = optimizers.GradientDescent
+    type LossScaleOptimizer = optimizers.LossScaleOptimizer
+    type GradientAccumulationOptimizer = optimizers.GradientAccumulationOptimizer
+
+    val LossScaleOptimizer: optimizers.LossScaleOptimizer.type = optimizers.LossScaleOptimizer
+    val GradientAccumulationOptimizer: optimizers.GradientAccumulationOptimizer.type =
+      optimizers.GradientAccumulationOptimizer
 
     def adaGrad(
         learningRate: Double = 0.01, decay: Decay = NoDecay, initialAccumulatorValue: Double = 1e-8,
-        useLocking: Boolean = false, name: String = "AdaGradOptimizer"): AdaGrad = {
+        useLocking: Boolean = false, groupUpdates: Boolean = false, name: String = "AdaGradOptimizer"): AdaGrad = {
       AdaGrad(
         learningRate = learningRate, decay = decay, epsilon = initialAccumulatorValue, useLocking = useLocking,
-        name = name)
+        groupUpdates = groupUpdates, name = name)
     }
 
     def AdaDelta(
         learningRate: Double = 0.01, decay: Decay = NoDecay, rho: Double = 0.95, epsilon: Double = 1e-8,
-        useLocking: Boolean = false, name: String = "AdaDeltaOptimizer"): AdaDelta = {
+        useLocking: Boolean = false, groupUpdates: Boolean = false, name: String = "AdaDeltaOptimizer"): AdaDelta = {
       AdaDelta(
-        learningRate = learningRate, decay = decay, rho = rho, epsilon = epsilon, useLocking = useLocking, name = name)
+        learningRate = learningRate, decay = decay, rho = rho, epsilon = epsilon, useLocking = useLocking,
+        groupUpdates = groupUpdates, name = name)
     }
 
     def gradientDescent(
         learningRate: Double, decay: Decay = NoDecay, momentum: Double = 0.0, useNesterov: Boolean = false,
-        useLocking: Boolean = false, name: String = "GradientDescentOptimizer"): GradientDescent = {
+        useLocking: Boolean = false, groupUpdates: Boolean = false,
+        name: String = "GradientDescentOptimizer"): GradientDescent = {
       GradientDescent(
         learningRate = learningRate, decay = decay, momentum = momentum, useNesterov = useNesterov,
-        useLocking = useLocking, name = name)
+        useLocking = useLocking, groupUpdates = groupUpdates, name = name)
     }
   }
 }
@@ -19,5 +19,17 @@ package org.platanios.tensorflow.api.ops
   * @author Emmanouil Antonios Platanios
   */
 package object training {
-  private[ops] trait API extends optimizers.API
+  private[ops] trait API extends optimizers.API {
+    type GradientCompression = training.GradientCompression
+    val GradientCompression: training.GradientCompression.type = training.GradientCompression
+
+    type MixedPrecision = training.MixedPrecision
+    type LossScale = training.LossScale
+    type StaticLossScale = training.StaticLossScale
+    type DynamicLossScale = training.DynamicLossScale
+
+    val MixedPrecision  : training.MixedPrecision.type   = training.MixedPrecision
+    val StaticLossScale : training.StaticLossScale.type  = training.StaticLossScale
+    val DynamicLossScale: training.DynamicLossScale.type = training.DynamicLossScale
+  }
 }
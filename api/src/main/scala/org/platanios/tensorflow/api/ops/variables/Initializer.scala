@@ -22,7 +22,7 @@ import org.platanios.tensorflow.api.ops.variables.Variable.PartitionInformation
 import org.platanios.tensorflow.api.tensors.Tensor
 import org.platanios.tensorflow.api.types.DataType
 
-// TODO: [VARIABLE_INITIALIZERS] RandomUniform/Normal, TruncatedNormal, UniformUnitScaling, Orthogonal.
+// TODO: [VARIABLE_INITIALIZERS] UniformUnitScaling, Orthogonal.
 // TODO: [VARIABLE_INITIALIZERS] VarianceScaling, Glorot/Xavier Uniform and Normal.
 
 /** Base trait for all variable initializers.
@@ -116,23 +116,51 @@ case class DynamicConstantInitializer(value: Output) extends Initializer {
   }
 }
 
-/** Initializer that sets the value of the variable to a `value` drawn from a uniform distribution. */
+/** Initializer that sets the value of the variable to a `value` drawn from a uniform distribution.
+  *
+  * When `parallel` is `true`, the parallel counter-based kernel is used, which produces the same values regardless
+  * of the number of threads used to fill the variable.
+  */
 case class RandomUniformInitializer(
-    minValue: Tensor = 0.0, maxValue: Tensor = 1.0, seed: Option[Int] = None) extends Initializer {
+    minValue: Tensor = 0.0, maxValue: Tensor = 1.0, seed: Option[Int] = None,
+    parallel: Boolean = false) extends Initializer {
   @throws[ShapeMismatchException]
   override def initialValue(dataType: DataType, shape: Shape, partitionInfo: PartitionInformation): Output = {
     Random.randomUniform(
-      dataType, shape, minValue = minValue, maxValue = maxValue, seed = seed, name = "RandomUniformInitializer")
+      dataType, shape, minValue = minValue, maxValue = maxValue, seed = seed, parallel = parallel,
+      name = "RandomUniformInitializer")
   }
 }
 
-/** Initializer that sets the value of the variable to a `value` drawn from a Normal distribution. */
+/** Initializer that sets the value of the variable to a `value` drawn from a Normal distribution.
+  *
+  * When `parallel` is `true`, the parallel counter-based kernel is used, which produces the same values regardless
+  * of the number of threads used to fill the variable.
+  */
 case class RandomNormalInitializer(
-    mean: Tensor = 0.0, standardDeviation: Tensor = 1.0, seed: Option[Int] = None) extends Initializer {
+    mean: Tensor = 0.0, standardDeviation: Tensor = 1.0, seed: Option[Int] = None,
+    parallel: Boolean = false) extends Initializer {
   @throws[ShapeMismatchException]
   override def initialValue(dataType: DataType, shape: Shape, partitionInfo: PartitionInformation): Output = {
     Random.randomNormal(
-      dataType, shape, mean = mean, standardDeviation = standardDeviation, seed = seed,
+      dataType, shape, mean = mean, standardDeviation = standardDeviation, seed = seed, parallel = parallel,
       name = "RandomNormalInitializer")
   }
 }
+
+/** Initializer that sets the value of the variable to a `value` drawn from a truncated Normal distribution. Values
+  * more than two standard deviations away from the mean are dropped and re-picked.
+  *
+  * When `parallel` is `true`, the parallel counter-based kernel is used, which produces the same values regardless
+  * of the number of threads used to fill the variable.
+  */
+case class RandomTruncatedNormalInitializer(
+    mean: Tensor = 0.0, standardDeviation: Tensor = 1.0, seed: Option[Int] = None,
+    parallel: Boolean = false) extends Initializer {
+  @throws[ShapeMismatchException]
+  override def initialValue(dataType: DataType, shape: Shape, partitionInfo: PartitionInformation): Output = {
+    Random.randomTruncatedNormal(
+      dataType, shape, mean = mean, standardDeviation = standardDeviation, seed = seed, parallel = parallel,
+      name = "RandomTruncatedNormalInitializer")
+  }
+}
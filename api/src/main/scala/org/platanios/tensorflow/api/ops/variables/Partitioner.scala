@@ -27,3 +27,55 @@ import org.platanios.tensorflow.api.types.DataType
 trait Partitioner {
   def apply(dataType: DataType, shape: Shape): Array[Int]
 }
+
+/** Partitioner that splits the variable into `numShards` shards along axis `axis`.
+  *
+  * @param  numShards Number of shards.
+  * @param  axis      Axis along which to partition the variable.
+  */
+case class FixedSizePartitioner(numShards: Int, axis: Int = 0) extends Partitioner {
+  require(numShards > 0, s"The number of shards ($numShards) must be positive.")
+
+  override def apply(dataType: DataType, shape: Shape): Array[Int] = {
+    require(axis >= 0 && axis < shape.rank, s"Invalid axis $axis for a variable with shape '$shape'.")
+    val partitions = Array.fill(shape.rank)(1)
+    partitions(axis) = math.min(numShards, math.max(shape(axis), 1))
+    partitions
+  }
+}
+
+/** Partitioner that splits the variable along axis `axis` into as few shards as possible, while keeping the size of
+  * each shard below `maxShardBytes`. The shards thus have roughly equal byte sizes, irrespective of the shapes of the
+  * variables, which, combined with a size-aware placement strategy (e.g.,
+  * [[org.platanios.tensorflow.api.core.distributed.ReplicaDevicePlacer.GreedyLoadBalancingStrategy]]), spreads large
+  * variables (e.g., embeddings) evenly over the parameter servers.
+  *
+  * If a single slice along `axis` is larger than `maxShardBytes`, each shard contains a single slice.
+  *
+  * @param  maxShardBytes         Maximum size of each shard, in bytes.
+  * @param  axis                  Axis along which to partition the variable.
+  * @param  maxShards             Maximum number of shards.
+  * @param  bytesPerStringElement Number of bytes assumed for each element of string variables, whose size is unknown.
+  */
+case class VariableAxisSizePartitioner(
+    maxShardBytes: Long,
+    axis: Int = 0,
+    maxShards: Int = Int.MaxValue,
+    bytesPerStringElement: Int = 16
+) extends Partitioner {
+  require(maxShardBytes > 0, s"The maximum shard size ($maxShardBytes) must be positive.")
+  require(maxShards > 0, s"The maximum number of shards ($maxShards) must be positive.")
+
+  override def apply(dataType: DataType, shape: Shape): Array[Int] = {
+    require(axis >= 0 && axis < shape.rank, s"Invalid axis $axis for a variable with shape '$shape'.")
+    val partitions = Array.fill(shape.rank)(1)
+    if (shape(axis) > 0) {
+      val elementBytes = if (dataType.byteSize > 0) dataType.byteSize else bytesPerStringElement
+      val sliceBytes = shape.asArray.zipWithIndex.filter(_._2 != axis).map(_._1.toLong).product * elementBytes
+      val slicesPerShard = math.max(1L, maxShardBytes / math.max(sliceBytes, 1L))
+      val numShards = (shape(axis) + slicesPerShard - 1) / slicesPerShard
+      partitions(axis) = math.min(numShards, maxShards.toLong).toInt
+    }
+    partitions
+  }
+}
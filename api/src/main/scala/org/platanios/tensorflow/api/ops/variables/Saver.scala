@@ -18,12 +18,12 @@ package org.platanios.tensorflow.api.ops.variables
 import org.platanios.tensorflow.api.Implicits._
 import org.platanios.tensorflow.api.core.{DeviceSpecification, Graph, Shape}
 import org.platanios.tensorflow.api.core.client.Session
-import org.platanios.tensorflow.api.io.FileIO
-import org.platanios.tensorflow.api.ops.{Basic, Op, Output, Text}
+import org.platanios.tensorflow.api.io.{CheckpointReader, FileIO}
+import org.platanios.tensorflow.api.ops.{Basic, HashEmbeddingTable, Op, Output, Text}
 import org.platanios.tensorflow.api.ops.control_flow.ControlFlow
 import org.platanios.tensorflow.api.ops.variables.CheckpointStateProto.CheckpointState
 import org.platanios.tensorflow.api.tensors.Tensor
-import org.platanios.tensorflow.api.types.{DataType, INT32}
+import org.platanios.tensorflow.api.types.{DataType, INT32, STRING}
 import org.platanios.tensorflow.api.utilities.Proto
 import org.platanios.tensorflow.api.utilities.Proto.{Serializable => ProtoSerializable}
 
@@ -36,10 +36,13 @@ import org.tensorflow.util.SaverDef.CheckpointFormatVersion
 
 import java.nio.file.{Files, Path}
 import java.util.UUID
-import java.util.concurrent.TimeUnit
+import java.util.concurrent.{Executors, ThreadFactory, TimeUnit}
 
 import scala.collection.JavaConverters._
 import scala.collection.mutable
+import scala.concurrent.{Await, ExecutionContext, ExecutionContextExecutorService, Future}
+import scala.concurrent.duration.Duration
+import scala.util.Try
 
 /** A saver can save and restore variables and other saveable objects.
   *
@@ -92,17 +95,28 @@ import scala.collection.mutable
   * most recent checkpoint. That protocol buffer is stored in a file next to the checkpoint files, with default name
   * `"checkpoint"` (can be provided using the `checkpointStateFilename` argument of the `save` method).
   *
+  * Savers created with `asyncWriters > 0` can also save checkpoints asynchronously, using the `saveAsync` method. In
+  * that case, the session is only used to snapshot the saved tensors in host memory, and the checkpoint is then written
+  * in the background, while training proceeds.
+  *
+  * Savers created using an [[IncrementalSaverDefBuilder]] write delta checkpoints, which depend on older (base)
+  * checkpoints. Base checkpoints are kept for as long as any of the kept checkpoints depends on them, even if they are
+  * older than the `maxToKeep` most recent checkpoints.
+  *
   * @param  saverDef          [[SaverDef]] object containing all the properties of this saver.
   * @param  saveRelativePaths Boolean value which, if `true`, forces the saver to write relative paths to the checkpoint
   *                           state file. This is needed if the user wants to copy the checkpoint directory and restore
   *                           from the copied directory.
   * @param  padGlobalStep     Boolean value which, if `true`, forces the saver to pad the global step number in the
   *                           checkpoint file paths to some fixed width (`8` by default). This is turned off by default.
+  * @param  asyncSaveOps      Ops used for asynchronous saving, if supported by this saver.
   *
   * @author Emmanouil Antonios Platanios
   */
-class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, padGlobalStep: Boolean = false)
-    extends ProtoSerializable {
+class Saver private (
+    saverDef: SaverDef, saveRelativePaths: Boolean = false, padGlobalStep: Boolean = false,
+    asyncSaveOps: Option[Saver.AsyncSaveOps] = None
+) extends ProtoSerializable {
   val writerVersion: Saver.WriterVersion = saverDef.getVersion match {
     case CheckpointFormatVersion.V1 => Saver.V1
     case CheckpointFormatVersion.V2 => Saver.V2
@@ -115,6 +129,16 @@ class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, pad
   private[this] var nextCheckpointTime: Float                       =
     (System.currentTimeMillis() / 60000) + saverDef.getKeepCheckpointEveryNHours * 3600
 
+  /** Most recent asynchronous save, if any. */
+  private[this] var pendingAsyncSave: Option[Future[Option[Path]]] = None
+
+  /** Checkpoints that are no longer among the last checkpoints, but which have not been deleted yet, because some of
+    * the last checkpoints are deltas relative to them. */
+  private[this] val retainedBases: mutable.Set[Path] = mutable.LinkedHashSet.empty[Path]
+
+  /** Cached base checkpoints of the last checkpoints (`None` for checkpoints that are not deltas). */
+  private[this] val deltaBases: mutable.Map[Path, Option[Path]] = mutable.Map.empty[Path, Option[Path]]
+
   /** Saves the current value of the saveables this saver is responsible for.
     *
     * This method runs the ops responsible for saving variables. It requires a session in which the saver's graph was
@@ -142,37 +166,9 @@ class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, pad
       writeCheckpointState: Boolean = true): Option[Path] = {
     val absoluteSavePath = savePath.toAbsolutePath
     Saver.logger.info(s"Saving parameters to '$absoluteSavePath'.")
-    if (writerVersion != Saver.V2) {
-      Saver.logger.warn("===========================================================")
-      Saver.logger.warn("TensorFlow's V1 checkpoint format version has been deprecated.")
-      Saver.logger.warn("Consider switching to the more efficient V2 format:")
-      Saver.logger.warn("   `tf.Saver(writerVersion = tf.Saver.V2)`")
-      Saver.logger.warn("V2 is the default checkpoint format version now.")
-      Saver.logger.warn("===========================================================")
-    }
-
-    if (absoluteSavePath.getFileSystem.getPath(checkpointStateFilename).getNameCount > 1)
-      throw new IllegalArgumentException(
-        s"The 'checkpointStateFilename' must not contain any path components: $checkpointStateFilename.")
-    val checkpointFile = {
-      if (globalStep.isDefined) {
-        // Optionally zero-pads the step numbers so that they are sorted when listed.
-        if (padGlobalStep)
-          absoluteSavePath.resolveSibling(f"${absoluteSavePath.getFileName}-${globalStep.get}%08d")
-        else
-          absoluteSavePath.resolveSibling(s"${absoluteSavePath.getFileName}-${globalStep.get}")
-      } else if (absoluteSavePath.getFileName.toString == checkpointStateFilename && !saverDef.getSharded) {
-        // Guard against collision between the data file and the checkpoint state file.
-        throw new IllegalArgumentException(
-          s"The checkpoint state filename ('$checkpointStateFilename') " +
-              s"collides with the save path ('$absoluteSavePath').")
-      } else {
-        absoluteSavePath
-      }
-    }
+    val checkpointFile = this.checkpointFile(absoluteSavePath, globalStep, checkpointStateFilename)
 
     // Save checkpoint.
-    val savePathParent = absoluteSavePath.getParent
     val modelCheckpointPath = {
       try {
         val filenameTensor = session.graph.getOutputByName(saverDef.getFilenameTensorName)
@@ -183,14 +179,13 @@ class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, pad
             feeds = Map(filenameTensor -> (checkpointFile.toString: Tensor)),
             fetches = saveTensor).scalar.asInstanceOf[String])
         if (writeCheckpointState) {
-          maybeDeleteOldCheckpoints(modelCheckpointPath, metaGraphSuffix)
-          Saver.updateCheckpointStateFile(
-            savePathParent, modelCheckpointPath, lastCheckpoints.map(_._1), checkpointStateFilename, saveRelativePaths)
+          updateCheckpointState(
+            absoluteSavePath.getParent, modelCheckpointPath, checkpointStateFilename, metaGraphSuffix)
         }
         Some(modelCheckpointPath)
       } catch {
         case exception: Exception =>
-          if (!Files.isDirectory(savePathParent))
+          if (!Files.isDirectory(absoluteSavePath.getParent))
             throw new IllegalArgumentException(
               s"The parent directory of '$absoluteSavePath' does not exist, preventing the saver from running.")
           throw exception
@@ -198,15 +193,123 @@ class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, pad
     }
 
     // Save graph meta information.
-    if (writeMetaGraph) {
-      val metaGraphDef = session.graph.toMetaGraphDef(saverDef = saverDef, clearDevices = false)
-      val metaGraphFilename = Saver.metaGraphFilename(checkpointFile, metaGraphSuffix)
-      Proto.write(metaGraphFilename.getParent, metaGraphFilename.getFileName.toString, metaGraphDef)
-    }
+    if (writeMetaGraph)
+      writeMetaGraphDef(
+        session.graph.toMetaGraphDef(saverDef = saverDef, clearDevices = false), checkpointFile, metaGraphSuffix)
 
     modelCheckpointPath
   }
 
+  /** Saves the current value of the saveables this saver is responsible for, asynchronously.
+    *
+    * This method only uses the session to snapshot the values of the saved tensors in host memory, and returns right
+    * after, so that training can resume while the checkpoint is being written. The snapshot is then written in the
+    * background by `asyncWriters` parallel writers (i.e., one `SaveV2` op per shard), whose outputs are merged into a
+    * single checkpoint, exactly as for sharded savers. The checkpoint state file and the graph meta information file
+    * are also written in the background, once the checkpoint has been written.
+    *
+    * At most one asynchronous save is in flight at any time, so that at most one snapshot is kept in host memory. If a
+    * previous save has not completed yet when this method is called, this method waits for it first.
+    *
+    * The arguments of this method are the same as those of [[save]].
+    *
+    * @return Future that completes with the path of the newly created checkpoint file, or fails with the exception
+    *         that was thrown while writing it.
+    * @throws IllegalStateException If this saver was created without support for asynchronous saving.
+    */
+  @throws[IllegalStateException]
+  def saveAsync(
+      session: Session, savePath: Path, globalStep: Option[Int] = None, checkpointStateFilename: String = "checkpoint",
+      metaGraphSuffix: String = "meta", writeMetaGraph: Boolean = true,
+      writeCheckpointState: Boolean = true): Future[Option[Path]] = {
+    val ops = asyncSaveOps.getOrElse(throw new IllegalStateException(
+      "This saver does not support asynchronous saving. Create it with 'asyncWriters > 0' to enable it."))
+    val absoluteSavePath = savePath.toAbsolutePath
+    if (!Files.isDirectory(absoluteSavePath.getParent))
+      throw new IllegalArgumentException(
+        s"The parent directory of '$absoluteSavePath' does not exist, preventing the saver from running.")
+    val checkpointFile = this.checkpointFile(absoluteSavePath, globalStep, checkpointStateFilename)
+    // Wait for the previous save to complete, ignoring its result, which is reported through its own future.
+    pendingAsyncSave.foreach(save => Try(Await.ready(save, Duration.Inf)))
+    Saver.logger.info(s"Snapshotting parameters to save to '$absoluteSavePath'.")
+    val snapshots = session.run(fetches = ops.snapshots)
+    val metaGraphDef = {
+      if (writeMetaGraph)
+        Some(session.graph.toMetaGraphDef(saverDef = saverDef, clearDevices = false))
+      else
+        None
+    }
+    val save = Future {
+      Saver.logger.info(s"Saving parameters to '$absoluteSavePath'.")
+      // TODO: [SESSION] !!! Feed mappers for string inputs.
+      val feeds = ops.placeholders.zip(snapshots).toMap + (ops.filename -> (checkpointFile.toString: Tensor))
+      val modelCheckpointPath = absoluteSavePath.getFileSystem.getPath(
+        session.run(feeds = feeds, fetches = ops.save).scalar.asInstanceOf[String])
+      if (writeCheckpointState)
+        updateCheckpointState(absoluteSavePath.getParent, modelCheckpointPath, checkpointStateFilename, metaGraphSuffix)
+      metaGraphDef.foreach(writeMetaGraphDef(_, checkpointFile, metaGraphSuffix))
+      Option(modelCheckpointPath)
+    }(Saver.asyncSaveExecutionContext)
+    pendingAsyncSave = Some(save)
+    save
+  }
+
+  /** Returns `true` if this saver supports asynchronous saving (i.e., the `saveAsync` method). */
+  def supportsAsyncSave: Boolean = asyncSaveOps.isDefined
+
+  /** Returns the checkpoint file path corresponding to the provided save path and global step.
+    *
+    * @throws IllegalArgumentException If the checkpoint state filename contains path components or if it collides with
+    *                                  the save path.
+    */
+  @throws[IllegalArgumentException]
+  private[this] def checkpointFile(
+      absoluteSavePath: Path, globalStep: Option[Int], checkpointStateFilename: String): Path = {
+    if (writerVersion != Saver.V2) {
+      Saver.logger.warn("===========================================================")
+      Saver.logger.warn("TensorFlow's V1 checkpoint format version has been deprecated.")
+      Saver.logger.warn("Consider switching to the more efficient V2 format:")
+      Saver.logger.warn("   `tf.Saver(writerVersion = tf.Saver.V2)`")
+      Saver.logger.warn("V2 is the default checkpoint format version now.")
+      Saver.logger.warn("===========================================================")
+    }
+
+    if (absoluteSavePath.getFileSystem.getPath(checkpointStateFilename).getNameCount > 1)
+      throw new IllegalArgumentException(
+        s"The 'checkpointStateFilename' must not contain any path components: $checkpointStateFilename.")
+    if (globalStep.isDefined) {
+      // Optionally zero-pads the step numbers so that they are sorted when listed.
+      if (padGlobalStep)
+        absoluteSavePath.resolveSibling(f"${absoluteSavePath.getFileName}-${globalStep.get}%08d")
+      else
+        absoluteSavePath.resolveSibling(s"${absoluteSavePath.getFileName}-${globalStep.get}")
+    } else if (absoluteSavePath.getFileName.toString == checkpointStateFilename && !saverDef.getSharded) {
+      // Guard against collision between the data file and the checkpoint state file.
+      throw new IllegalArgumentException(
+        s"The checkpoint state filename ('$checkpointStateFilename') " +
+            s"collides with the save path ('$absoluteSavePath').")
+    } else {
+      absoluteSavePath
+    }
+  }
+
+  /** Records a newly saved checkpoint in the checkpoint state file, deleting old checkpoints, if necessary. This method
+    * is synchronized because asynchronous saves call it from a background thread. */
+  private[this] def updateCheckpointState(
+      directory: Path, modelCheckpointPath: Path, checkpointStateFilename: String,
+      metaGraphSuffix: String): Unit = synchronized {
+    maybeDeleteOldCheckpoints(modelCheckpointPath, metaGraphSuffix)
+    Saver.updateCheckpointStateFile(
+      directory, modelCheckpointPath, lastCheckpoints.map(_._1), checkpointStateFilename, saveRelativePaths)
+  }
+
+  /** Writes the graph meta information file corresponding to the provided checkpoint file. */
+  private[this] def writeMetaGraphDef(
+      metaGraphDef: MetaGraphDef, checkpointFile: Path, metaGraphSuffix: String): Unit = {
+    val metaGraphFilename = Saver.metaGraphFilename(checkpointFile, metaGraphSuffix)
+    Proto.write(metaGraphFilename.getParent, metaGraphFilename.getFileName.toString, metaGraphDef)
+  }
+
   /** Restores previously saved saveables.
     *
     * This method runs the ops responding for restoring variables. It requires a session in which the saver's graph was
@@ -228,9 +331,24 @@ class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, pad
     session.run(feeds = Map(filenameTensor -> Tensor(savePath.toString)), targets = restoreOp)
   }
 
+  /** Same as [[restore]], except that the variables are restored natively, reading the tensors of V2 checkpoints in
+    * parallel, and that the model is then made ready in the same native call, by running `localInitOp` (if
+    * `readyForLocalInitOp` passes) and evaluating `readyOp` once. Please refer to the documentation of
+    * `Session.recover` for details.
+    *
+    * @return Tuple containing the reason why the model is not ready for local initialization, if it is not, and the
+    *         reason why it is not ready, if it is not.
+    */
+  private[api] def recover(
+      session: Session, savePath: Path, readyForLocalInitOp: Option[Output], localInitOp: Option[Op],
+      readyOp: Option[Output]): (Option[String], Option[String]) = {
+    Saver.logger.info(s"Restoring parameters from '$savePath'.")
+    session.recover(saverDef, savePath, readyForLocalInitOp, localInitOp, readyOp)
+  }
+
   /** Returns the sequence of the latest and not-yet-deleted checkpoint filenames, sorted from oldest to newest. You can
     * pass any of the returned values to `restore`. */
-  def latestCheckpoints: Seq[Path] = lastCheckpoints.map(_._1)
+  def latestCheckpoints: Seq[Path] = synchronized(lastCheckpoints.map(_._1))
 
   /** Recovers the internal saver state (holding the last checkpoints) after a crash.
     *
@@ -241,7 +359,7 @@ class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, pad
     */
   def recoverLastCheckpoints(checkpoints: Seq[Path]): Unit = {
     val times = Saver.checkpointTimes(checkpoints, unit = TimeUnit.SECONDS, followSymbolicLinks = true)
-    lastCheckpoints = mutable.Queue(checkpoints.zip(times).sortBy(_._2): _*)
+    synchronized(lastCheckpoints = mutable.Queue(checkpoints.zip(times).sortBy(_._2): _*))
   }
 
   /** Deletes old checkpoints, if necessary.
@@ -275,16 +393,32 @@ class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, pad
               // Deprecated checkpoint format using an exact match on the checkpoint filename.
               FileIO.deleteMatchingPaths(checkpoint._1)
             case Saver.V2 =>
-              // The V2 format has a metadata file along with some data files.
-              val filename = checkpoint._1.getFileName
-              FileIO.deleteMatchingPaths(checkpoint._1.resolveSibling(s"$filename.index"))
-              FileIO.deleteMatchingPaths(checkpoint._1.resolveSibling(s"$filename.data-?????-of-?????"))
+              // Checkpoints are only deleted once none of the kept checkpoints is a delta relative to them.
+              retainedBases += checkpoint._1
+              deleteUnusedBases()
           }
         }
       }
     }
   }
 
+  /** Deletes the checkpoints that were removed from the last checkpoints, but were kept because some of the last
+    * checkpoints were deltas relative to them, once this is no longer the case. */
+  private[this] def deleteUnusedBases(): Unit = {
+    val checkpoints = lastCheckpoints.map(_._1)
+    deltaBases.retain((checkpoint, _) => checkpoints.contains(checkpoint))
+    val usedBases = checkpoints.flatMap(checkpoint => {
+      deltaBases.getOrElseUpdate(checkpoint, Try(CheckpointReader.deltaBase(checkpoint)).toOption.flatten)
+    }).toSet
+    retainedBases.filterNot(usedBases.contains).foreach(base => {
+      // The V2 format has a metadata file along with some data files.
+      val filename = base.getFileName
+      FileIO.deleteMatchingPaths(base.resolveSibling(s"$filename.index"))
+      FileIO.deleteMatchingPaths(base.resolveSibling(s"$filename.data-?????-of-?????"))
+      retainedBases -= base
+    })
+  }
+
   override def toProto: SaverDef = toProto(null)
 
   /** Alias for `toSaverDef`. */
@@ -318,6 +452,29 @@ class Saver private (saverDef: SaverDef, saveRelativePaths: Boolean = false, pad
 object Saver {
   private[Saver] val logger = Logger(LoggerFactory.getLogger("Variables / Saver"))
 
+  /** Ops used by savers that support asynchronous saving.
+    *
+    * @param  snapshots    Values of the saved tensors, which are fetched in order to snapshot them in host memory.
+    * @param  placeholders Placeholders through which the snapshots are fed to the writers, in the same order.
+    * @param  filename     Placeholder for the checkpoint prefix.
+    * @param  save         Scalar string tensor that writes all shards, merges them, and returns the checkpoint prefix.
+    */
+  private[variables] case class AsyncSaveOps(
+      snapshots: Seq[Output], placeholders: Seq[Output], filename: Output, save: Output)
+
+  /** Execution context used to write the checkpoints of asynchronous saves. It uses a single daemon thread, because the
+    * writes themselves are parallelized by the TensorFlow runtime, and because it serializes the updates of the
+    * checkpoint state files. */
+  private[Saver] lazy val asyncSaveExecutionContext: ExecutionContextExecutorService = {
+    ExecutionContext.fromExecutorService(Executors.newSingleThreadExecutor(new ThreadFactory {
+      override def newThread(runnable: Runnable): Thread = {
+        val thread = new Thread(runnable, "tensorflow-async-saver")
+        thread.setDaemon(true)
+        thread
+      }
+    }))
+  }
+
   /** Adds save/restore nodes to the graph and creates and returns a [[SaverDef]] proto.
     *
     * @param  saveables                 Objects that need to be saved and loaded. If `null`, then all saveable objects
@@ -347,6 +504,9 @@ object Saver {
     * @param  padGlobalStep             Boolean value which, if `true`, forces the saver to pad the global step number
     *                                   in the checkpoint file paths to some fixed width (`8` by default). This is
     *                                   turned off by default.
+    * @param  asyncWriters              Number of parallel writers to use for asynchronous saves (see
+    *                                   [[Saver.saveAsync]]). If `0`, asynchronous saving is not supported by the
+    *                                   created saver and no ops are added for it.
     * @param  name                      Optional name to use as a prefix when adding ops.
     * @return Created [[SaverDef]] objects.
     * @throws IllegalArgumentException  If no saveables are provided or obtained from the current graph and `allowEmpty`
@@ -357,11 +517,15 @@ object Saver {
       saveables: Set[Saveable] = null, reshape: Boolean = false, sharded: Boolean = false, maxToKeep: Int = 5,
       keepCheckpointEveryNHours: Float = 10000.0f, restoreSequentially: Boolean = false, filename: String = "model",
       builder: SaverDefBuilder = DefaultSaverDefBuilder, allowEmpty: Boolean = false, writerVersion: WriterVersion = V2,
-      saveRelativePaths: Boolean = false, padGlobalStep: Boolean = false, name: String = "Saver"): Saver = {
+      saveRelativePaths: Boolean = false, padGlobalStep: Boolean = false, asyncWriters: Int = 0,
+      name: String = "Saver"): Saver = {
+    if (asyncWriters < 0)
+      throw new IllegalArgumentException(s"'asyncWriters' (set to $asyncWriters) must be a non-negative integer.")
     val collectedSaveables: Set[Saveable] = {
       if (saveables == null) {
         // TODO: [VARIABLES] Use a better default for this.
-        Op.currentGraph.getCollection(Graph.Keys.GLOBAL_VARIABLES).map(new Saveable.VariableSaveable(_))
+        Op.currentGraph.getCollection(Graph.Keys.GLOBAL_VARIABLES).map(new Saveable.VariableSaveable(_): Saveable) ++
+            Op.currentGraph.getCollection(Graph.Keys.HASH_EMBEDDING_TABLES).map(new Saveable.HashEmbeddingSaveable(_))
       } else {
         saveables
       }
@@ -377,7 +541,13 @@ object Saver {
       restoreSequentially = restoreSequentially,
       filename = filename,
       name = name)
-    new Saver(saverDef, saveRelativePaths = saveRelativePaths, padGlobalStep = padGlobalStep)
+    val asyncSaveOps = {
+      if (asyncWriters > 0 && collectedSaveables.nonEmpty)
+        Some(builder.buildAsync(collectedSaveables, asyncWriters, name = s"${name}Async"))
+      else
+        None
+    }
+    new Saver(saverDef, saveRelativePaths = saveRelativePaths, padGlobalStep = padGlobalStep, asyncSaveOps)
   }
 
   /** Creates a saver from the provided [[SaverDef]] object.
@@ -1070,6 +1240,50 @@ trait SaverDefBuilder {
         .setVersion(checkpointFormatVersion)
         .build()
   }
+
+  /** Adds the ops used by savers that support asynchronous saving to the graph.
+    *
+    * The saved tensors are fed through placeholders placed on the CPU, and are split into (at most) `numberOfWriters`
+    * shards of roughly equal size, each of which is written by a separate `SaveV2` op. These ops are independent and
+    * are thus run in parallel by the TensorFlow runtime. Their outputs are finally merged into a single V2 checkpoint,
+    * in the same way as for sharded savers.
+    *
+    * @param  saveables       Objects that need to be saved.
+    * @param  numberOfWriters Number of parallel writers to use.
+    * @param  name            Name scope for the created ops.
+    * @return Created ops.
+    */
+  def buildAsync(saveables: Set[Saveable], numberOfWriters: Int, name: String = "SaverAsync"): Saver.AsyncSaveOps = {
+    SaverDefBuilder.checkSaveables(saveables)
+    val specifications = saveables.toSeq.flatMap(_.saveSpecifications)
+    Op.createWithNameScope(name) {
+      Op.createWith(device = "/device:CPU:0") {
+        val filename = Basic.placeholder(STRING, Shape.scalar(), name = "Filename")
+        val placeholders = specifications.map(s => Basic.placeholder(s.value.dataType, s.value.shape, "Snapshot"))
+        val shards = SaverDefBuilder.balancedShards(specifications.map(_.value), numberOfWriters)
+        // The shards are first written under a temporary prefix, similar to the sharded save ops.
+        val temporaryPrefix = Text.stringJoin(Seq(filename, s"_temp_${UUID.randomUUID().toString}/part": Output))
+        val (shardedPrefixes, shardedSaves) = shards.zipWithIndex.map { case (indices, shard) =>
+          val prefix = SaverDefBuilder.shardedFilenameOp(temporaryPrefix, shard, shards.length)
+          val save = SaverDefBuilder.saveV2Op(
+            prefix, indices.map(specifications(_).name), indices.map(placeholders(_)),
+            indices.map(specifications(_).saveSliceSpecification))
+          (prefix, save)
+        }.unzip
+        val mergeOp = Op.createWith(controlDependencies = shardedSaves.toSet) {
+          val concatenatedPrefixes = {
+            if (shardedPrefixes.length > 1)
+              Basic.concatenate(shardedPrefixes)
+            else
+              shardedPrefixes.head.reshape(Shape(1))
+          }
+          SaverDefBuilder.mergeV2Checkpoints(concatenatedPrefixes, filename, deleteOldDirectories = true)
+        }
+        val save = ControlFlow.withControlDependencies(Set(mergeOp), filename)
+        Saver.AsyncSaveOps(specifications.map(_.value), placeholders, filename, save)
+      }
+    }
+  }
 }
 
 /** Contains helper functions for saver builders. */
@@ -1085,6 +1299,26 @@ object SaverDefBuilder {
     saveables.groupBy(s => DeviceSpecification.fromString(s.device).toString).toSeq.sortBy(_._1)
   }
 
+  /** Splits the provided tensors into (at most) `numberOfShards` non-empty shards of roughly equal size in bytes, by
+    * greedily assigning the largest remaining tensor to the smallest shard. Tensors with unknown sizes are treated as
+    * scalars.
+    *
+    * @param  tensors        Tensors to split.
+    * @param  numberOfShards Maximum number of shards.
+    * @return Sequence containing the indices of the tensors in each shard, in increasing order.
+    */
+  private def balancedShards(tensors: Seq[Output], numberOfShards: Int): Seq[Seq[Int]] = {
+    val sizes = tensors.map(t => math.max(t.shape.numElements, 1L) * math.max(t.dataType.byteSize, 1))
+    val shards = Array.fill(math.min(numberOfShards, tensors.length))(mutable.ArrayBuffer.empty[Int])
+    val shardSizes = Array.fill(shards.length)(0L)
+    sizes.zipWithIndex.sortBy(-_._1).foreach { case (size, index) =>
+      val shard = shardSizes.indices.minBy(shardSizes(_))
+      shards(shard) += index
+      shardSizes(shard) += size
+    }
+    shards.map(_.sorted.toSeq).toSeq
+  }
+
   /** Checks that the provided saveable objects are valid. More specifically, this function checks if two or more
     * saveable objects have been provided for the same underlying producer. */
   private def checkSaveables(saveables: Set[Saveable]): Unit = {
@@ -1291,6 +1525,123 @@ object SaverDefBuilder {
         .build()
   }
 
+  /** Creates an op that saves tensors in the V2 checkpoint format, like [[saveV2Op]], but writes them as (at most)
+    * `numberOfWriters` shards in parallel, each using its own I/O thread. The shards are merged into a single
+    * checkpoint with one data file per shard. Tensors larger than `chunkSize` bytes are split along their first
+    * dimension and saved as slices, so that they can be spread across shards. The op logs the number of bytes written,
+    * the time spent, and the resulting throughput, for each shard.
+    *
+    * @param  prefix          String tensor containing a single element. That element corresponds to the prefix of the
+    *                         V2 checkpoint to which we write the tensors.
+    * @param  tensorNames     Names of the tensors to be saved.
+    * @param  tensors         Tensors to save.
+    * @param  slices          Slice specifications of the tensors to be saved (same as for [[saveV2Op]]).
+    * @param  numberOfWriters Maximum number of shards (and I/O threads) to use.
+    * @param  chunkSize       Maximum size (in bytes) of the pieces into which large tensors are split. If `0`, tensors
+    *                         are never split.
+    * @param  name            Name for the created op.
+    * @return Created op, whose outputs contain the number of bytes written by each shard and the time (in seconds)
+    *         spent writing each shard.
+    * @throws IllegalArgumentException If the length of `tensorNames` does not match the number of tensors in `tensors`,
+    *                                  and the number of strings in `slices`.
+    */
+  @throws[IllegalArgumentException]
+  private[variables] def parallelSaveV2Op(
+      prefix: Output, tensorNames: Seq[String], tensors: Seq[Output], slices: Seq[String], numberOfWriters: Int,
+      chunkSize: Long, name: String = "Save"): Op = {
+    if (tensorNames.length != tensors.length)
+      throw new IllegalArgumentException(
+        s"The number of tensor names provided (${tensorNames.length}) does not match the number of tensors in " +
+            s"'tensors' (${tensors.length}).")
+    if (tensorNames.length != slices.length)
+      throw new IllegalArgumentException(
+        s"The number of tensor names provided (${tensorNames.length}) does not match the number of slices in " +
+            s"'slices' (${slices.length}).")
+    Op.Builder(opType = "ParallelSaveV2", name = name)
+        .addInput(prefix)
+        .addInput(Tensor(tensorNames).reshape(Shape(tensorNames.length)).toOutput)
+        .addInput(Tensor(slices).reshape(Shape(slices.length)).toOutput)
+        .addInputList(tensors)
+        .setAttribute("dtypes", tensors.map(_.dataType).toArray)
+        .setAttribute("num_shards", numberOfWriters)
+        .setAttribute("chunk_size", chunkSize)
+        .build()
+  }
+
+  /** Creates an op that saves tensors in the V2 checkpoint format, like [[saveV2Op]], but only writes the rows that
+    * changed since the last full (i.e., base) checkpoint it wrote. Every `fullSaveInterval` saves, the op writes a new
+    * base checkpoint. All other saves write delta checkpoints, which must be restored using
+    * [[incrementalRestoreV2Op]].
+    *
+    * @param  prefix           String tensor containing a single element. That element corresponds to the prefix of
+    *                          the V2 checkpoint to which we write the tensors.
+    * @param  tensorNames      Names of the tensors to be saved.
+    * @param  tensors          Tensors to save.
+    * @param  slices           Slice specifications of the tensors to be saved (same as for [[saveV2Op]]).
+    * @param  fullSaveInterval Number of saves after which a new base checkpoint is written.
+    * @param  maxDirtyFraction Maximum fraction of changed rows for which a tensor is saved as a delta.
+    * @param  name             Name for the created op.
+    * @return Created op.
+    * @throws IllegalArgumentException If the length of `tensorNames` does not match the number of tensors in `tensors`,
+    *                                  and the number of strings in `slices`.
+    */
+  @throws[IllegalArgumentException]
+  private[variables] def incrementalSaveV2Op(
+      prefix: Output, tensorNames: Seq[String], tensors: Seq[Output], slices: Seq[String], fullSaveInterval: Int,
+      maxDirtyFraction: Float, name: String = "Save"): Op = {
+    if (tensorNames.length != tensors.length)
+      throw new IllegalArgumentException(
+        s"The number of tensor names provided (${tensorNames.length}) does not match the number of tensors in " +
+            s"'tensors' (${tensors.length}).")
+    if (tensorNames.length != slices.length)
+      throw new IllegalArgumentException(
+        s"The number of tensor names provided (${tensorNames.length}) does not match the number of slices in " +
+            s"'slices' (${slices.length}).")
+    Op.Builder(opType = "IncrementalSaveV2", name = name)
+        .addInput(prefix)
+        .addInput(Tensor(tensorNames).reshape(Shape(tensorNames.length)).toOutput)
+        .addInput(Tensor(slices).reshape(Shape(slices.length)).toOutput)
+        .addInputList(tensors)
+        .setAttribute("dtypes", tensors.map(_.dataType).toArray)
+        .setAttribute("full_save_interval", fullSaveInterval)
+        .setAttribute("max_dirty_fraction", maxDirtyFraction)
+        .build()
+  }
+
+  /** Creates an op that restores tensors from V2 checkpoint files, like [[restoreV2Op]], but also supports the delta
+    * checkpoints written by [[incrementalSaveV2Op]], which are merged with their base checkpoints. Unlike
+    * [[restoreV2Op]], the created op does not support V1 checkpoints.
+    *
+    * @param  prefix      String tensor containing a single element. That element corresponds to the prefix of the V2
+    *                     checkpoint from which we read the tensors.
+    * @param  tensorNames Names of the tensors to be restored.
+    * @param  slices      Slice specifications to use when restoring the tensors (same as for [[restoreV2Op]]).
+    * @param  dataTypes   Data types of the tensors being restored.
+    * @param  name        Name for the created op.
+    * @return Created op outputs.
+    * @throws IllegalArgumentException If the length of `tensorNames` does not match the number of string in `slices`,
+    *                                  and the number of data types in `dataTypes`.
+    */
+  @throws[IllegalArgumentException]
+  private[variables] def incrementalRestoreV2Op(
+      prefix: Output, tensorNames: Seq[String], slices: Seq[String], dataTypes: Seq[DataType],
+      name: String = "Restore"): Seq[Output] = {
+    if (tensorNames.length != slices.length)
+      throw new IllegalArgumentException(
+        s"The number of tensor names provided (${tensorNames.length}) does not match the number of slices in " +
+            s"'slices' (${slices.length}).")
+    if (tensorNames.length != dataTypes.length)
+      throw new IllegalArgumentException(
+        s"The number of tensor names provided (${tensorNames.length}) does not match the number of data types in " +
+            s"'dataTypes' (${dataTypes.length}).")
+    Op.Builder(opType = "IncrementalRestoreV2", name = name)
+        .addInput(prefix)
+        .addInput(Tensor(tensorNames).reshape(Shape(tensorNames.length)).toOutput)
+        .addInput(Tensor(slices).reshape(Shape(slices.length)).toOutput)
+        .setAttribute("dtypes", dataTypes.toArray)
+        .build().outputs.toSeq
+  }
+
   /** Creates an op that restores a tensor from V2 checkpoint files.
     *
     * For backward compatibility with the V1 format, the created op currently allows restoring from a V1 checkpoint as
@@ -1400,7 +1751,99 @@ object SaverDefBuilder {
 }
 
 /** The default saver builder. */
-private[variables] object DefaultSaverDefBuilder extends SaverDefBuilder
+private[api] object DefaultSaverDefBuilder extends SaverDefBuilder
+
+/** Saver builder that writes the tensors of each device using parallel writers.
+  *
+  * The default saver builder writes the tensors of each device sequentially, using a single `SaveV2` op. This builder
+  * instead splits them into (at most) `numberOfWriters` shards of roughly equal size, which are written in parallel,
+  * each using its own I/O thread, and are then merged into a single checkpoint with one data file per shard. Tensors
+  * larger than `chunkSize` bytes are split along their first dimension and saved as slices, so that a few very large
+  * tensors (e.g., embeddings) do not end up in a single shard. The resulting checkpoints are restored in the same way
+  * as all other V2 checkpoints.
+  *
+  * This is useful when saving to storage systems with low per-stream bandwidth and high aggregate bandwidth (e.g.,
+  * remote object stores). The number of bytes written, the time spent, and the resulting throughput, are logged for
+  * each shard.
+  *
+  * @param  numberOfWriters Maximum number of parallel writers (and data files) per device.
+  * @param  chunkSize       Maximum size (in bytes) of the pieces into which large tensors are split. If `0`, tensors
+  *                         are never split.
+  */
+case class ParallelSaverDefBuilder(numberOfWriters: Int = 8, chunkSize: Long = 64L * 1024L * 1024L)
+    extends SaverDefBuilder {
+  require(numberOfWriters > 0, s"'numberOfWriters' (set to $numberOfWriters) needs to be a positive integer.")
+  require(chunkSize >= 0, s"'chunkSize' (set to $chunkSize) needs to be a non-negative integer.")
+
+  override protected def save(prefix: Output, saveables: Set[Saveable], name: String): Op = {
+    if (saveables.nonEmpty) {
+      val (tensorNames, tensors, slices) =
+        saveables.flatMap(_.saveSpecifications)
+            .map(s => (s.name, s.value, s.saveSliceSpecification))
+            .toSeq.unzip3[String, Output, String]
+      SaverDefBuilder.parallelSaveV2Op(prefix, tensorNames, tensors, slices, numberOfWriters, chunkSize, name)
+    } else {
+      ControlFlow.noOp(name)
+    }
+  }
+}
+
+/** Saver builder that writes incremental (i.e., delta) checkpoints.
+  *
+  * Every `fullSaveInterval` saves, savers using this builder write a full (i.e., base) checkpoint. All other saves
+  * write delta checkpoints, which only contain the rows of each tensor that changed since the base checkpoint was
+  * written, along with the ranges of these rows. Changed rows are detected natively, by comparing fingerprints of all
+  * rows with the ones computed when the base checkpoint was written, and so any kind of update is tracked. Deltas are
+  * relative to the base checkpoint (and not to the previous delta), and so restoring a checkpoint reads at most two
+  * checkpoints. This greatly reduces the size of most checkpoints of models with large embedding tables of which only
+  * a small fraction of the rows is updated between saves. Tensors of which more than `maxDirtyFraction` of the rows
+  * changed (e.g., dense layer weights) are written in full in delta checkpoints.
+  *
+  * Delta checkpoints are restored by merging them with their base checkpoints, both by savers using this builder and by
+  * [[org.platanios.tensorflow.api.io.CheckpointReader]]. Savers keep base checkpoints for as long as any of the kept
+  * checkpoints depends on them. Note that the first checkpoint saved in each session is always a base checkpoint, and
+  * that sharded savers are not supported.
+  *
+  * @param  fullSaveInterval Number of saves after which a new base checkpoint is written. If `1`, all checkpoints are
+  *                          full checkpoints.
+  * @param  maxDirtyFraction Maximum fraction of changed rows for which a tensor is saved as a delta.
+  */
+case class IncrementalSaverDefBuilder(fullSaveInterval: Int = 10, maxDirtyFraction: Float = 0.5f)
+    extends SaverDefBuilder {
+  require(fullSaveInterval > 0, s"'fullSaveInterval' (set to $fullSaveInterval) needs to be a positive integer.")
+  require(maxDirtyFraction >= 0.0f && maxDirtyFraction <= 1.0f,
+    s"'maxDirtyFraction' (set to $maxDirtyFraction) needs to be in [0, 1].")
+
+  override protected def save(prefix: Output, saveables: Set[Saveable], name: String): Op = {
+    if (saveables.nonEmpty) {
+      val (tensorNames, tensors, slices) =
+        saveables.flatMap(_.saveSpecifications)
+            .map(s => (s.name, s.value, s.saveSliceSpecification))
+            .toSeq.unzip3[String, Output, String]
+      SaverDefBuilder.incrementalSaveV2Op(
+        prefix, tensorNames, tensors, slices, fullSaveInterval, maxDirtyFraction, name)
+    } else {
+      ControlFlow.noOp(name)
+    }
+  }
+
+  override protected def restore(prefix: Output, saveable: Saveable, name: String): Seq[Output] = {
+    val (tensorNames, slices, dataTypes) =
+      saveable.saveSpecifications
+          .map(s => (s.name, s.saveSliceSpecification, s.value.dataType))
+          .unzip3[String, String, DataType]
+    SaverDefBuilder.incrementalRestoreV2Op(prefix, tensorNames, slices, dataTypes, name)
+  }
+
+  /** Sharded checkpoints are first written under temporary prefixes, which delta checkpoints cannot refer to.
+    *
+    * @throws IllegalArgumentException Always.
+    */
+  @throws[IllegalArgumentException]
+  override protected def addShardedSaveOps(prefix: Output, saveablesByDevice: Seq[(String, Set[Saveable])]): Output = {
+    throw new IllegalArgumentException("Incremental savers cannot be sharded.")
+  }
+}
 
 /** Class used to describe tensor slices that need to be saved.
   *
@@ -1468,6 +1911,27 @@ private[variables] object Saveable {
     }
   }
 
+  /** Wrapper saveable object that allows the rows of hash embedding tables to be saved. */
+  class HashEmbeddingSaveable private(table: Output, exported: (Output, Output, Output, Output))
+      extends Saveable(Seq(
+        SaveSpecification(s"${table.op.name}-ids", exported._1, ""),
+        SaveSpecification(s"${table.op.name}-values", exported._2, ""),
+        SaveSpecification(s"${table.op.name}-accumulators", exported._3, ""),
+        SaveSpecification(s"${table.op.name}-last_steps", exported._4, ""))) {
+    def this(table: Output) = this(table, Op.colocateWith(Set(table.op))(HashEmbeddingTable.export(table)))
+
+    override val name: String = table.op.name
+
+    override val producerOps: Set[Op] = Set(table.op)
+
+    override private[api] def restore(restoredTensors: Seq[Output], restoredShapes: Seq[Output] = null): Op = {
+      Op.colocateWith(Set(table.op)) {
+        HashEmbeddingTable.importRows(
+          table, restoredTensors(0), restoredTensors(1), restoredTensors(2), restoredTensors(3))
+      }
+    }
+  }
+
   /** Wrapper saveable object that allows partitioned variables to be saved. */
   implicit class PartitionedVariableSaveable(variable: PartitionedVariable)
       extends Saveable(
@@ -26,8 +26,16 @@ import org.platanios.tensorflow.api.tensors.Tensor
 import org.platanios.tensorflow.api.types._
 import org.platanios.tensorflow.api.utilities.Proto.{Serializable => ProtoSerializable}
 
+import com.typesafe.scalalogging.Logger
+import org.slf4j.LoggerFactory
 import org.tensorflow.framework.{SaveSliceInfoDef, VariableDef}
 
+import java.util.concurrent.{Executors, ThreadFactory}
+import java.util.concurrent.atomic.AtomicInteger
+
+import scala.collection.mutable
+import scala.concurrent.{Await, ExecutionContext, Future}
+import scala.concurrent.duration.Duration
 import scala.language.postfixOps
 import scala.util.DynamicVariable
 
@@ -285,6 +293,8 @@ case class Variable private (
 
 /** Contains helper functions and classes for creating and dealing with [[Variable]] objects. */
 private[api] object Variable {
+  private[variables] val logger = Logger(LoggerFactory.getLogger("Variables / Variable"))
+
   implicit def variableToOutput(variable: Variable): Output = variable.toOutput
 
   /** Gets an existing variable with the specified name or creates a new one.
@@ -662,6 +672,74 @@ private[api] object Variable {
       ControlFlow.noOp(name)
   }
 
+  /** Initializes the provided variables by running their initializers concurrently in `session`, from a pool of
+    * `parallelism` threads, instead of running a single grouped initialization op.
+    *
+    * The variables are sorted by decreasing size (in bytes) and assigned to the threads using a longest-processing-time
+    * first schedule, so that the largest initializers start first and all threads finish at roughly the same time.
+    * Variables whose shape is not fully defined are scheduled last. Each thread runs its initializers in batches of at
+    * most `batchSize` ops per [[Session.run]] call, and progress is reported after every batch.
+    *
+    * This method does not create any ops and so it can also be used with frozen graphs (e.g., from the `initFunction`
+    * of a session scaffold). Variables that are restored from a checkpoint do not need to be passed to it.
+    *
+    * @param  session     Session in which to run the initializers.
+    * @param  variables   Set of variables to initialize.
+    * @param  parallelism Number of threads used to run the initializers.
+    * @param  batchSize   Maximum number of initializers run by each [[Session.run]] call.
+    * @param  progress    Callback invoked after each batch with the number of variables initialized so far and the
+    *                     total number of variables being initialized. Defaults to logging the progress.
+    */
+  def initializeConcurrently(
+      session: Session, variables: Set[Variable], parallelism: Int = Runtime.getRuntime.availableProcessors(),
+      batchSize: Int = 32, progress: (Int, Int) => Unit = logInitializationProgress): Unit = {
+    if (variables != null && variables.nonEmpty) {
+      require(parallelism > 0, s"'parallelism' ($parallelism) must be positive.")
+      require(batchSize > 0, s"'batchSize' ($batchSize) must be positive.")
+      def sizeOf(variable: Variable): Long = {
+        if (variable.shape.isFullyDefined)
+          variable.shape.numElements * math.max(variable.dataType.byteSize, 1)
+        else
+          0L
+      }
+      val sortedVariables = variables.toSeq.map(v => (v, sizeOf(v))).sortBy(-_._2)
+      val numThreads = math.min(parallelism, sortedVariables.size)
+      val schedules = Array.fill(numThreads)(mutable.ArrayBuffer.empty[Op])
+      val loads = Array.fill(numThreads)(0L)
+      sortedVariables.foreach(v => {
+        val thread = loads.indices.minBy(loads(_))
+        schedules(thread) += v._1.initializer
+        loads(thread) += math.max(v._2, 1L)
+      })
+      val numInitialized = new AtomicInteger(0)
+      val executor = Executors.newFixedThreadPool(numThreads, new ThreadFactory {
+        private[this] val threadCount = new AtomicInteger(0)
+
+        override def newThread(runnable: Runnable): Thread = {
+          val thread = new Thread(runnable, s"tensorflow-variable-initializer-${threadCount.getAndIncrement()}")
+          thread.setDaemon(true)
+          thread
+        }
+      })
+      val executionContext = ExecutionContext.fromExecutorService(executor)
+      try {
+        val futures = schedules.toSeq.map(schedule => Future {
+          schedule.grouped(batchSize).foreach(batch => {
+            session.run(targets = batch.toSet)
+            progress(numInitialized.addAndGet(batch.size), sortedVariables.size)
+          })
+        }(executionContext))
+        futures.foreach(Await.result(_, Duration.Inf))
+      } finally {
+        executionContext.shutdown()
+      }
+    }
+  }
+
+  private[variables] def logInitializationProgress(numInitialized: Int, numVariables: Int): Unit = {
+    logger.info(s"Initialized $numInitialized / $numVariables variables.")
+  }
+
   /** Creates an op that returns a tensor containing the names of all uninitialized variables in `variables`.
     *
     * If all variables have been initialized, then an empty tensor is returned.
@@ -16,6 +16,7 @@
 package org.platanios.tensorflow.api.ops
 
 import org.platanios.tensorflow.api.core.{Graph, Shape}
+import org.platanios.tensorflow.api.core.client.Session
 import org.platanios.tensorflow.api.ops.variables.Saver.{V2, WriterVersion}
 import org.platanios.tensorflow.api.tensors.Tensor
 import org.platanios.tensorflow.api.types.DataType
@@ -49,27 +50,53 @@ package object variables {
     def constantInitializer(value: Output): Initializer = variables.DynamicConstantInitializer(value)
 
     def randomUniformInitializer(
-        minValue: Tensor = 0.0, maxValue: Tensor = 1.0, seed: Option[Int] = None): Initializer = {
-      variables.RandomUniformInitializer(minValue = minValue, maxValue = maxValue, seed = seed)
+        minValue: Tensor = 0.0, maxValue: Tensor = 1.0, seed: Option[Int] = None,
+        parallel: Boolean = false): Initializer = {
+      variables.RandomUniformInitializer(minValue = minValue, maxValue = maxValue, seed = seed, parallel = parallel)
     }
 
     def randomNormalInitializer(
-        mean: Tensor = 0.0, standardDeviation: Tensor = 1.0, seed: Option[Int] = None): Initializer = {
-      variables.RandomNormalInitializer(mean = mean, standardDeviation = standardDeviation, seed = seed)
+        mean: Tensor = 0.0, standardDeviation: Tensor = 1.0, seed: Option[Int] = None,
+        parallel: Boolean = false): Initializer = {
+      variables.RandomNormalInitializer(
+        mean = mean, standardDeviation = standardDeviation, seed = seed, parallel = parallel)
+    }
+
+    def randomTruncatedNormalInitializer(
+        mean: Tensor = 0.0, standardDeviation: Tensor = 1.0, seed: Option[Int] = None,
+        parallel: Boolean = false): Initializer = {
+      variables.RandomTruncatedNormalInitializer(
+        mean = mean, standardDeviation = standardDeviation, seed = seed, parallel = parallel)
+    }
+
+    def fixedSizePartitioner(numShards: Int, axis: Int = 0): VariablePartitioner = {
+      variables.FixedSizePartitioner(numShards, axis)
+    }
+
+    def variableAxisSizePartitioner(
+        maxShardBytes: Long, axis: Int = 0, maxShards: Int = Int.MaxValue,
+        bytesPerStringElement: Int = 16): VariablePartitioner = {
+      variables.VariableAxisSizePartitioner(maxShardBytes, axis, maxShards, bytesPerStringElement)
     }
 
     type Saver = variables.Saver
     val Saver: variables.Saver.type = variables.Saver
 
+    type ParallelSaverDefBuilder = variables.ParallelSaverDefBuilder
+    val ParallelSaverDefBuilder: variables.ParallelSaverDefBuilder.type = variables.ParallelSaverDefBuilder
+
+    type IncrementalSaverDefBuilder = variables.IncrementalSaverDefBuilder
+    val IncrementalSaverDefBuilder: variables.IncrementalSaverDefBuilder.type = variables.IncrementalSaverDefBuilder
+
     def saver(
         saveables: Set[Saveable] = null, reshape: Boolean = false, sharded: Boolean = false, maxToKeep: Int = 5,
         keepCheckpointEveryNHours: Float = 10000.0f, restoreSequentially: Boolean = false, filename: String = "model",
         builder: SaverDefBuilder = DefaultSaverDefBuilder, allowEmpty: Boolean = false,
         writerVersion: WriterVersion = V2, saveRelativePaths: Boolean = false, padGlobalStep: Boolean = false,
-        name: String = "Saver"): Saver = {
+        asyncWriters: Int = 0, name: String = "Saver"): Saver = {
       Saver(
         saveables, reshape, sharded, maxToKeep, keepCheckpointEveryNHours, restoreSequentially, filename, builder,
-        allowEmpty, writerVersion, saveRelativePaths, padGlobalStep, name)
+        allowEmpty, writerVersion, saveRelativePaths, padGlobalStep, asyncWriters, name)
     }
 
     def variable(
@@ -127,5 +154,11 @@ package object variables {
         variableScope, reuse, dataType, initializer, regularizer, partitioner, cachingDevice, customGetter,
         isPure)(block)
     }
+
+    def initializeVariablesConcurrently(
+        session: Session, variables: Set[Variable], parallelism: Int = Runtime.getRuntime.availableProcessors(),
+        batchSize: Int = 32, progress: (Int, Int) => Unit = Variable.logInitializationProgress): Unit = {
+      Variable.initializeConcurrently(session, variables, parallelism, batchSize, progress)
+    }
   }
 }
@@ -32,6 +32,11 @@ package object api extends Implicits with Documentation {
   type Session = core.client.Session
   val Session: core.client.Session.type = core.client.Session
 
+  type SavedModel = core.client.SavedModel
+  val SavedModel: core.client.SavedModel.type = core.client.SavedModel
+
+  val Quantization: core.Quantization.type = core.Quantization
+
   type Shape = core.Shape
   val Shape: core.Shape.type = core.Shape
 
@@ -47,9 +52,59 @@ package object api extends Implicits with Documentation {
     new DynamicVariable[Context](Context())
   }
 
+  /** Executes `block` using a new asynchronous eager execution context, in which copies between devices return right
+    * away and are executed in order, in the background. All pending operations are waited for before returning, and
+    * their first error, if any, is thrown. */
+  def withAsyncEagerExecution[R](block: => R): R = withEagerExecutionContext(async = true)(block)
+
+  /** Executes `block` using a new eager execution context, which is closed afterwards.
+    *
+    * For example, this can be used to limit the number of threads used by the eager ops executed in `block`, when
+    * multiple contexts share the same host:
+    * {{{
+    *   withEagerExecutionContext(Some(SessionConfig(intraOpParallelismThreads = Some(4)))) {
+    *     ...
+    *   }
+    * }}}
+    *
+    * @param  config Optional configuration for the new context (e.g., specifying the sizes of its thread pools, its GPU
+    *                options, such as whether GPU memory is allocated on demand, or whether soft device placement is
+    *                allowed).
+    * @param  async  Boolean value indicating whether the new context executes copies between devices asynchronously.
+    *                In that case, all pending operations are waited for before returning, and their first error, if
+    *                any, is thrown.
+    * @param  block  Code to execute.
+    * @return Result of `block`.
+    */
+  def withEagerExecutionContext[R](config: Option[core.client.SessionConfig] = None, async: Boolean = false)(
+      block: => R
+  ): R = {
+    val context = Context(config, async)
+    try {
+      val result = tensorEagerExecutionContext.withValue(context)(block)
+      context.sync()
+      result
+    } finally {
+      context.close()
+    }
+  }
+
+  type ContextGroup = tensors.ContextGroup
+  val ContextGroup: tensors.ContextGroup.type = tensors.ContextGroup
+
+  /** Waits for all pending operations of the current eager execution context and throws the first error that any of
+    * them produced. This is a no-op for synchronous contexts. */
+  def syncEagerExecution(): Unit = tensorEagerExecutionContext.value.sync()
+
   type Tensor = tensors.Tensor
   val Tensor: tensors.Tensor.type = tensors.Tensor
 
+  type FusedFunction = tensors.FusedFunction
+  val FusedFunction: tensors.FusedFunction.type = tensors.FusedFunction
+
+  type GradientTape = tensors.GradientTape
+  val GradientTape: tensors.GradientTape.type = tensors.GradientTape
+
   implicit val opCreationContext: DynamicVariable[api.ops.OpCreationContext] = {
     new DynamicVariable[api.ops.OpCreationContext](api.ops.OpCreationContext(graph = api.core.defaultGraph))
   }
@@ -61,10 +116,12 @@ package object api extends Implicits with Documentation {
   type Output = ops.Output
   type OutputIndexedSlices = ops.OutputIndexedSlices
   type SparseOutput = ops.SparseOutput
+  type CSRSparseOutput = ops.CSRSparseOutput
 
   val Output             : ops.Output.type              = ops.Output
   val OutputIndexedSlices: ops.OutputIndexedSlices.type = ops.OutputIndexedSlices
   val SparseOutput       : ops.SparseOutput.type        = ops.SparseOutput
+  val CSRSparseOutput    : ops.CSRSparseOutput.type     = ops.CSRSparseOutput
 
   implicit val layerCreationContext: DynamicVariable[api.learn.layers.LayerCreationContext] = {
     new DynamicVariable[api.learn.layers.LayerCreationContext](api.learn.layers.LayerCreationContext())
@@ -143,6 +200,8 @@ package object api extends Implicits with Documentation {
     * @groupprio SummaryOps     260
     * @groupname CallbackOps    Ops / Callback
     * @groupprio CallbackOps    270
+    * @groupname CollectiveOps  Ops / Collective
+    * @groupprio CollectiveOps  280
     */
   object tf
       extends core.API
@@ -188,6 +247,8 @@ package object api extends Implicits with Documentation {
     * @groupprio SummaryOps     260
     * @groupname CallbackOps    Ops / Callback
     * @groupprio CallbackOps    270
+    * @groupname CollectiveOps  Ops / Collective
+    * @groupprio CollectiveOps  280
     */
   object tfi
       extends core.API
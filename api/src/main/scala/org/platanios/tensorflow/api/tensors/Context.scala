@@ -15,6 +15,7 @@
 
 package org.platanios.tensorflow.api.tensors
 
+import org.platanios.tensorflow.api.core.client.{AllocatorStatistics, SessionConfig}
 import org.platanios.tensorflow.api.utilities.Closeable
 import org.platanios.tensorflow.jni.{Tensor => NativeTensor}
 
@@ -24,20 +25,49 @@ import org.platanios.tensorflow.jni.{Tensor => NativeTensor}
   * eager execution of tensor ops (as opposed to symbolic execution which requires a computation graph to be constructed
   * beforehand).
   *
+  * In asynchronous contexts, copies between devices return right away and are executed in order, in the background.
+  * Using their outputs waits for them, and errors are reported when the outputs are used, or by [[sync]].
+  *
   * @param  nativeHandle Native handle (i.e., pointer) to the underlying native library TensorFlow context.
+  * @param  async        Boolean value indicating whether this context executes copies between devices asynchronously.
+  * @param  owned        Boolean value indicating whether this context owns its native context. Contexts that belong to
+  *                      a [[ContextGroup]] share the native context of the group and do not own it.
   *
   * @author Emmanouil Antonios Platanios
   */
-private[api] final case class Context private (private[api] var nativeHandle: Long) extends Closeable {
+private[api] final case class Context private (
+    private[api] var nativeHandle: Long,
+    async: Boolean,
+    owned: Boolean = true
+) extends Closeable {
   /** Lock for the native handle. */
   private[this] object NativeHandleLock
 
+  /** Waits for all pending operations of this context and throws the first error that any of them produced since the
+    * last call to this method. This is a no-op for synchronous contexts. */
+  def sync(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0)
+      NativeTensor.eagerSync(nativeHandle)
+  }
+
+  /** Returns the memory statistics of the allocators used by the devices of this context, one per allocator.
+    *
+    * @throws IllegalStateException If this context has already been closed.
+    */
+  @throws[IllegalStateException]
+  def allocatorStatistics: Seq[AllocatorStatistics] = NativeHandleLock.synchronized {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("This context has already been closed.")
+    AllocatorStatistics.fromNative(NativeTensor.eagerAllocatorStatistics(nativeHandle))
+  }
+
   /** Closes this [[Context]] and releases any resources associated with it. Note that a [[Context]] is not usable after
-    * it has been closed. */
+    * it has been closed. Contexts that do not own their native context are only detached from it. */
   override def close(): Unit = {
     NativeHandleLock.synchronized {
       if (nativeHandle != 0) {
-        NativeTensor.eagerDeleteContext(nativeHandle)
+        if (owned)
+          NativeTensor.eagerDeleteContext(nativeHandle)
         nativeHandle = 0
       }
     }
@@ -46,6 +76,29 @@ private[api] final case class Context private (private[api] var nativeHandle: Lo
 
 /** Contains helper functions for dealing with eager tensor op execution contexts. */
 private[api] object Context {
-  /** Creates a new eager tensor op execution context. */
-  def apply(): Context = Context(NativeTensor.eagerAllocateContext())
+  /** Creates a new eager tensor op execution context.
+    *
+    * @param  config Optional configuration for the new context (e.g., specifying the sizes of its thread pools, its GPU
+    *                options, or whether soft device placement is allowed). Only the options that are not specific to
+    *                graph execution are used.
+    * @param  async  Boolean value indicating whether the new context executes copies between devices asynchronously.
+    */
+  def apply(config: Option[SessionConfig] = None, async: Boolean = false): Context = {
+    val cpuAffinity = config.flatMap(_.cpuAffinity)
+    Context(NativeTensor.eagerAllocateContext(
+      config.map(_.configProto.toByteArray).orNull, async, cpuAffinity.map(_.nativeCPUs).orNull,
+      cpuAffinity.map(_.nativeNumaNode).getOrElse(-1)), async)
+  }
+
+  /** Creates a new eager tensor op execution context that is meant to be shared by many threads, through the contexts
+    * of a [[ContextGroup]]. The arguments are the same as those of [[apply]]. */
+  private[tensors] def shared(config: Option[SessionConfig], async: Boolean): Context = {
+    val cpuAffinity = config.flatMap(_.cpuAffinity)
+    Context(NativeTensor.eagerAllocateSharedContext(
+      config.map(_.configProto.toByteArray).orNull, async, cpuAffinity.map(_.nativeCPUs).orNull,
+      cpuAffinity.map(_.nativeNumaNode).getOrElse(-1)), async)
+  }
+
+  /** Creates a context that uses the native context of `context`, without owning it. */
+  private[tensors] def member(context: Context): Context = Context(context.nativeHandle, context.async, owned = false)
 }
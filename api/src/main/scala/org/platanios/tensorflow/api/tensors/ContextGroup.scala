@@ -0,0 +1,94 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.tensors
+
+import org.platanios.tensorflow.api.core.client.SessionConfig
+import org.platanios.tensorflow.api.utilities.Closeable
+
+import scala.util.DynamicVariable
+
+/** Group of eager execution contexts, one per thread, that share a single native context.
+  *
+  * Creating a separate context for each thread that executes eager ops duplicates the devices, thread pools, and
+  * kernel caches of the contexts, and so every thread instantiates the kernels it uses. The contexts of a group instead
+  * share all of these, and so each kernel is only instantiated once for the whole group. They are lightweight (i.e.,
+  * creating them does not create any native resources) and the only per-thread native state they use is that of
+  * asynchronous execution: in asynchronous groups, each thread gets its own executor, so that the copies of different
+  * threads are not serialized with each other, and syncing a context only waits for the operations of its own thread.
+  *
+  * For example:
+  * {{{
+  *   val group = ContextGroup(Some(SessionConfig(intraOpParallelismThreads = Some(8))))
+  *   val results = inputs.par.map(input => group(computeResult(input)))
+  *   group.close()
+  * }}}
+  *
+  * @param  sharedContext Context that owns the shared native context.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class ContextGroup private[tensors](private[this] val sharedContext: Context) extends Closeable {
+  /** Per-thread contexts, which share the native context of this group. */
+  private[this] val threadContexts: ThreadLocal[Context] = new ThreadLocal[Context] {
+    override def initialValue(): Context = Context.member(sharedContext)
+  }
+
+  /** Boolean value indicating whether the contexts of this group execute copies between devices asynchronously. */
+  def async: Boolean = sharedContext.async
+
+  /** Returns the context of the current thread.
+    *
+    * @throws IllegalStateException If this group has already been closed.
+    */
+  @throws[IllegalStateException]
+  private[api] def context: Context = {
+    if (sharedContext.nativeHandle == 0)
+      throw new IllegalStateException("This context group has already been closed.")
+    threadContexts.get()
+  }
+
+  /** Executes `block` using the context of the current thread. For asynchronous groups, all pending operations of the
+    * current thread are waited for before returning, and their first error, if any, is thrown.
+    *
+    * @throws IllegalStateException If this group has already been closed.
+    */
+  @throws[IllegalStateException]
+  def apply[R](block: => R)(implicit executionContext: DynamicVariable[Context]): R = {
+    val threadContext = context
+    val result = executionContext.withValue(threadContext)(block)
+    threadContext.sync()
+    result
+  }
+
+  /** Closes this group and releases its shared native context, after waiting for the pending operations of all of its
+    * threads. Note that the contexts of this group are not usable after it has been closed. */
+  override def close(): Unit = sharedContext.close()
+}
+
+/** Contains helper functions for creating eager execution context groups. */
+object ContextGroup {
+  /** Creates a new eager execution context group.
+    *
+    * @param  config Optional configuration for the shared native context (e.g., specifying the sizes of its thread
+    *                pools, or its GPU options). Only the options that are not specific to graph execution are used.
+    * @param  async  Boolean value indicating whether the contexts of the new group execute copies between devices
+    *                asynchronously.
+    * @return Created context group.
+    */
+  def apply(config: Option[SessionConfig] = None, async: Boolean = false): ContextGroup = {
+    new ContextGroup(Context.shared(config, async))
+  }
+}
@@ -0,0 +1,127 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.tensors
+
+import org.platanios.tensorflow.api.core.Shape
+import org.platanios.tensorflow.api.ops.{Function, InstantiatedFunction, Output}
+import org.platanios.tensorflow.api.types.DataType
+import org.platanios.tensorflow.jni.{Tensor => NativeTensor}
+
+import java.util.concurrent.atomic.AtomicLong
+
+import scala.collection.mutable
+import scala.util.DynamicVariable
+
+/** Eager function that fuses a chain of ops into a single native dispatch.
+  *
+  * The first time a fused function is called with some input signature (i.e., input data types and shapes), `function`
+  * is traced into a function graph, using symbolic placeholders for the inputs. The traced graph is then converted to a
+  * native TensorFlow function and registered with the eager execution context. That call, and all subsequent calls with
+  * the same input signature, execute the whole op chain as a single eager function call, instead of crossing the JNI
+  * boundary and dispatching a separate kernel for every op in the chain.
+  *
+  * For example:
+  * {{{
+  *   val normalize = FusedFunction("Normalize")(inputs => {
+  *     val centered = inputs(0) - inputs(1)
+  *     Seq(centered / inputs(2))
+  *   })
+  *   val normalized = normalize(Seq(features, mean, stdDev)).head
+  * }}}
+  *
+  * @param  name     Name prefix for the traced native functions.
+  * @param  function Function that creates the ops to fuse, given symbolic outputs that represent its inputs.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class FusedFunction private[tensors](val name: String, val function: Seq[Output] => Seq[Output]) {
+  /** Traced functions, keyed by their input signature. */
+  private[this] val instantiatedFunctions = {
+    mutable.HashMap.empty[Seq[(DataType, Shape)], InstantiatedFunction[Seq[Output], Seq[Output]]]
+  }
+
+  /** Pairs of eager execution context handles and function names, for the traced functions that have already been
+    * registered with the corresponding contexts. */
+  private[this] val registeredFunctions = mutable.HashSet.empty[(Long, String)]
+
+  /** Executes this fused function eagerly on `inputs`, tracing it first if it has not yet been called with the same
+    * input signature.
+    *
+    * @param  inputs Input tensors.
+    * @return Output tensors, in the same order as the outputs returned by `function`.
+    * @throws IllegalArgumentException If `function` uses symbolic outputs that do not depend on its inputs, but rather
+    *                                  belong to some other graph.
+    */
+  @throws[IllegalArgumentException]
+  def apply(inputs: Seq[Tensor])(implicit context: DynamicVariable[Context]): Seq[Tensor] = {
+    val contextHandle = context.value.nativeHandle
+    val instantiatedFunction = synchronized {
+      val signature = inputs.map(input => (input.dataType, input.shape))
+      val instantiatedFunction = instantiatedFunctions.getOrElseUpdate(signature, trace(signature))
+      if (!registeredFunctions.contains((contextHandle, instantiatedFunction.name))) {
+        NativeTensor.eagerAddFunction(contextHandle, instantiatedFunction.nativeHandle)
+        registeredFunctions += ((contextHandle, instantiatedFunction.name))
+      }
+      instantiatedFunction
+    }
+    val outputHandles = NativeTensor.eagerExecuteFunction(
+      contextHandle, instantiatedFunction.name, inputs.map(_.nativeHandle).toArray,
+      instantiatedFunction.outputDataTypes.length)
+    outputHandles.map(Tensor.fromNativeHandle)
+  }
+
+  /** Traces `function` for the provided input signature. */
+  @throws[IllegalArgumentException]
+  private[this] def trace(signature: Seq[(DataType, Shape)]): InstantiatedFunction[Seq[Output], Seq[Output]] = {
+    val instantiatedFunction = InstantiatedFunction(
+      s"${name}_${FusedFunction.nextId()}", function, signature.map(_._1), Some(signature.map(_._2)))(
+      FusedFunction.SeqArgType(signature.length), FusedFunction.SeqArgType(-1))
+    if (instantiatedFunction.extraInputs.nonEmpty) {
+      instantiatedFunction.close()
+      throw new IllegalArgumentException(
+        s"Fused function '$name' uses symbolic outputs that belong to other graphs. " +
+            "Fused functions can only use ops that depend on their inputs.")
+    }
+    instantiatedFunction
+  }
+}
+
+/** Contains helper functions for creating fused eager functions. */
+object FusedFunction {
+  /** Creates a new fused eager function.
+    *
+    * @param  name     Name prefix for the traced native functions.
+    * @param  function Function that creates the ops to fuse, given symbolic outputs that represent its inputs.
+    * @return Created fused function.
+    */
+  def apply(name: String)(function: Seq[Output] => Seq[Output]): FusedFunction = new FusedFunction(name, function)
+
+  /** Counter used to give unique names to the traced native functions, since all of them share the same namespace
+    * within each eager execution context. */
+  private[this] val idCounter: AtomicLong = new AtomicLong(0L)
+
+  private[FusedFunction] def nextId(): Long = idCounter.getAndIncrement()
+
+  /** Function argument type for sequences of outputs. `numOutputs` is only used when validating input arguments and
+    * so it may be set to any value for function outputs. */
+  private[FusedFunction] case class SeqArgType(override val numOutputs: Int) extends Function.ArgType[Seq[Output]] {
+    override def outputs(arg: Seq[Output]): Seq[Output] = arg
+    override def dataTypes(arg: Seq[Output]): Seq[DataType] = arg.map(_.dataType)
+    override def outputsDecoder(outputs: Seq[Output]): (Seq[Output], Seq[Output]) = {
+      if (numOutputs < 0) (outputs, Seq.empty) else outputs.splitAt(numOutputs)
+    }
+  }
+}
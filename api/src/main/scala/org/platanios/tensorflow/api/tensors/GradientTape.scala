@@ -0,0 +1,119 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.tensors
+
+import org.platanios.tensorflow.api.utilities.Closeable
+import org.platanios.tensorflow.jni.{EagerTape => NativeEagerTape}
+
+import scala.util.DynamicVariable
+
+/** Gradient tape for eager execution, which records the ops executed while it is recording and computes gradients with
+  * respect to the tensors it watches.
+  *
+  * Recording happens natively, as ops are executed through the generic native eager dispatcher, and so recording does
+  * not add any JNI crossings. Gradients are computed by replaying the recorded ops that the targets depend on into a
+  * graph, adding their gradients using the native gradient registry, and executing the result as a single eager
+  * function. These functions are cached per recorded computation structure and so, for example, tapes that record the
+  * same computation in every iteration of a training loop only build the gradient function once.
+  *
+  * For example:
+  * {{{
+  *   val tape = GradientTape()
+  *   tape.watch(weights)
+  *   val loss = tape.recording(computeLoss(weights, batch))
+  *   val weightsGradient = tape.gradient(Seq(loss), Seq(weights)).head
+  *   tape.close()
+  * }}}
+  *
+  * Note that only ops that are executed through the generic native eager dispatcher are recorded, and that the tape
+  * retains the watched tensors and the rest of the inputs of the recorded ops until it is closed.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class GradientTape private[tensors](private[this] var nativeHandle: Long) extends Closeable {
+  /** Lock for the native handle. */
+  private[this] object NativeHandleLock
+
+  /** Watches `tensor`, so that the ops that use it are recorded and gradients can be computed with respect to it. */
+  def watch(tensor: Tensor): Unit = NativeHandleLock.synchronized {
+    NativeEagerTape.watch(handle, tensor.nativeHandle)
+  }
+
+  /** Records the ops executed by the current thread while computing `block`, and returns its result. Tapes may be
+    * nested, in which case all of them record the ops. */
+  def recording[R](block: => R): R = {
+    val tapeHandle = NativeHandleLock.synchronized(handle)
+    NativeEagerTape.push(tapeHandle)
+    try {
+      block
+    } finally {
+      NativeEagerTape.pop(tapeHandle)
+    }
+  }
+
+  /** Computes the gradients of the sum of `targets` with respect to `sources`.
+    *
+    * @param  targets         Target tensors.
+    * @param  sources         Source tensors, which must have been watched or produced by recorded ops.
+    * @param  targetGradients Initial gradients of the targets, which default to tensors filled with ones. Its length
+    *                         must be equal to that of `targets`, if it is not empty, and its entries may be `null`, in
+    *                         which case the default is used for the corresponding targets.
+    * @return Gradients of the targets with respect to each source, or `None`, for sources that the targets do not
+    *         depend on.
+    * @throws IllegalArgumentException If the lengths of `targets` and `targetGradients` do not match, or if some
+    *                                  recorded op has no registered gradient.
+    */
+  @throws[IllegalArgumentException]
+  def gradient(targets: Seq[Tensor], sources: Seq[Tensor], targetGradients: Seq[Tensor] = Seq.empty)(implicit
+      context: DynamicVariable[Context]
+  ): Seq[Option[Tensor]] = NativeHandleLock.synchronized {
+    if (targetGradients.nonEmpty && targetGradients.length != targets.length)
+      throw new IllegalArgumentException(
+        s"Expected ${targets.length} target gradients, but got ${targetGradients.length}, instead.")
+    val targetGradientHandles = {
+      if (targetGradients.isEmpty)
+        Array.fill(targets.length)(0L)
+      else
+        targetGradients.map(g => if (g == null) 0L else g.nativeHandle).toArray
+    }
+    val gradientHandles = NativeEagerTape.gradient(
+      handle, context.value.nativeHandle, targets.map(_.nativeHandle).toArray, targetGradientHandles,
+      sources.map(_.nativeHandle).toArray)
+    gradientHandles.map(h => if (h == 0) None else Some(Tensor.fromNativeHandle(h))).toSeq
+  }
+
+  /** Returns the native handle of this tape, throwing an exception if it has already been closed. */
+  @throws[IllegalStateException]
+  private[this] def handle: Long = {
+    if (nativeHandle == 0)
+      throw new IllegalStateException("This gradient tape has already been closed.")
+    nativeHandle
+  }
+
+  /** Closes this tape and releases the tensors it retains. Note that a tape is not usable after it has been closed. */
+  override def close(): Unit = NativeHandleLock.synchronized {
+    if (nativeHandle != 0) {
+      NativeEagerTape.delete(nativeHandle)
+      nativeHandle = 0
+    }
+  }
+}
+
+/** Contains helper functions for creating gradient tapes. */
+object GradientTape {
+  /** Creates a new gradient tape, which does not record any ops until [[GradientTape.recording]] is used. */
+  def apply(): GradientTape = new GradientTape(NativeEagerTape.allocate())
+}
@@ -23,9 +23,9 @@ import org.platanios.tensorflow.api.ops.{Basic, Output}
 import org.platanios.tensorflow.api.tensors.ops.Basic.{BasicOps, stack}
 import org.platanios.tensorflow.api.tensors.ops.{Math, Random}
 import org.platanios.tensorflow.api.types._
-import org.platanios.tensorflow.api.utilities.{Closeable, Disposer}
+import org.platanios.tensorflow.api.utilities.{Closeable, Disposer, HandleTracker}
 import org.platanios.tensorflow.api.utilities.Proto.{Serializable => ProtoSerializable}
-import org.platanios.tensorflow.jni.{Tensor => NativeTensor}
+import org.platanios.tensorflow.jni.{TensorPoolStatistics, Tensor => NativeTensor}
 import org.platanios.tensorflow.jni.generated.tensors.{Sparse => NativeTensorOpsSparse}
 
 import com.google.protobuf.ByteString
@@ -35,10 +35,12 @@ import org.tensorflow.framework.TensorProto
 import shapeless.{Generic, HList, Lazy}
 
 import java.nio._
+import java.nio.channels.WritableByteChannel
 import java.nio.charset.Charset
 
 import scala.collection.{TraversableLike, breakOut}
 import scala.language.{higherKinds, postfixOps}
+import scala.reflect.ClassTag
 import scala.util.DynamicVariable
 
 /** Represents tensor-like objects.
@@ -153,6 +155,10 @@ class Tensor private[Tensor](private[api] var nativeHandle: Long)
   // potential memory leak.
   Disposer.add(this, () => this.close())
 
+  // Eager tensor handles are created by many native functions (e.g., by all eager ops) and so they are registered with
+  // the native handle tracker here, where they are all taken ownership of.
+  HandleTracker.trackEagerTensor(nativeHandle)
+
   /** Data type of this tensor. */
   override val dataType: DataType = DataType.fromCValue(NativeTensor.eagerDataType(nativeHandle))
 
@@ -194,6 +200,13 @@ class Tensor private[Tensor](private[api] var nativeHandle: Long)
     }
   }
 
+  /** Waits until this tensor has been computed, which is only necessary for tensors produced asynchronously (e.g., by
+    * copies in asynchronous contexts), and throws the error that its computation produced, if any. */
+  def await(): Unit = NativeHandleLock synchronized {
+    if (nativeHandle != 0)
+      NativeTensor.eagerAwait(nativeHandle)
+  }
+
   private[api] def resolve()(implicit context: DynamicVariable[Context]): Long = {
     if (device == "CPU:0") {
       NativeTensor.eagerResolve(nativeHandle)
@@ -208,30 +221,61 @@ class Tensor private[Tensor](private[api] var nativeHandle: Long)
     }
   }
 
-  private[api] def buffer(implicit context: DynamicVariable[Context]): ByteBuffer = {
-    val resolvedHandle = resolve()
-    val buffer = NativeTensor.buffer(resolvedHandle).order(ByteOrder.nativeOrder)
-    NativeHandleLock synchronized {
-      if (resolvedHandle != 0)
-        NativeTensor.delete(resolvedHandle)
+  /** Returns a buffer over the storage of this tensor, without resolving or copying it, if this tensor is placed in
+    * host memory and its storage can be viewed directly, and `null` otherwise. The buffer is only valid while this
+    * tensor has not been disposed. */
+  private[this] def hostBuffer: ByteBuffer = NativeHandleLock synchronized {
+    if (nativeHandle == 0) {
+      null
+    } else {
+      val buffer = NativeTensor.eagerHostBuffer(nativeHandle)
+      if (buffer == null) null else buffer.order(ByteOrder.nativeOrder)
+    }
+  }
+
+  /** Returns the handle of the host mirror of this tensor (i.e., a resolved copy of this tensor in host memory). The
+    * mirror is created natively the first time that it is requested and it is then reused until this tensor is
+    * disposed, and so reading multiple elements of a tensor that is placed on another device (e.g., on a GPU) only
+    * copies it to the host once. The mirror is owned by this tensor and must not be deleted. */
+  private[this] def hostMirror(implicit context: DynamicVariable[Context]): Long = NativeHandleLock synchronized {
+    NativeTensor.eagerHostMirror(nativeHandle, context.value.nativeHandle)
+  }
+
+  /** Cached host view of this tensor, created by [[hostView]]. */
+  private[this] var cachedHostView: ByteBuffer = _
+
+  /** Returns a view of this tensor in host memory, using the C API representation (e.g., for string tensors, an array
+    * of offsets followed by the encoded strings). The view is over the storage of this tensor, if it is placed in host
+    * memory and its storage can be viewed directly, and over its host mirror otherwise. It is created once and it is
+    * only valid while this tensor has not been disposed. Note that callers must only use absolute reads on the returned
+    * buffer, as it is shared. */
+  private[api] def hostView(implicit context: DynamicVariable[Context]): ByteBuffer = {
+    var view = NativeHandleLock synchronized cachedHostView
+    if (view == null) {
+      view = hostBuffer
+      if (view == null)
+        view = NativeTensor.buffer(hostMirror).order(ByteOrder.nativeOrder)
+      NativeHandleLock synchronized {
+        if (cachedHostView == null)
+          cachedHostView = view
+        view = cachedHostView
+      }
     }
-    buffer
+    view
+  }
+
+  private[api] def buffer(implicit context: DynamicVariable[Context]): ByteBuffer = {
+    hostView.duplicate().order(ByteOrder.nativeOrder)
   }
 
   private[api] def getElementAtFlattenedIndex(index: Int): dataType.ScalaType = {
-    val resolvedHandle = resolve()
-    val buffer = NativeTensor.buffer(resolvedHandle).order(ByteOrder.nativeOrder)
-    val value = dataType match {
+    val buffer = hostView
+    dataType match {
       case STRING =>
         val offset = INT64.byteSize * size.toInt + INT64.getElementFromBuffer(buffer, index * INT64.byteSize).toInt
         dataType.getElementFromBuffer(buffer, offset)
       case _ => dataType.getElementFromBuffer(buffer, index * dataType.byteSize)
     }
-    NativeHandleLock synchronized {
-      if (resolvedHandle != 0)
-        NativeTensor.delete(resolvedHandle)
-    }
-    value
   }
 
   @throws[InvalidShapeException]
@@ -243,40 +287,112 @@ class Tensor private[Tensor](private[api] var nativeHandle: Long)
   }
 
   def entriesIterator: Iterator[dataType.ScalaType] = new Iterator[dataType.ScalaType] {
-    private var resolvedHandle: Long = resolve()
-    private var i             : Int  = 0
-
-    private val buffer      : ByteBuffer = NativeTensor.buffer(resolvedHandle).order(ByteOrder.nativeOrder)
-    private val stringOffset: Int        = INT64.byteSize * Tensor.this.size.toInt
-
-    override def hasNext: Boolean = {
-      val hasNext = resolvedHandle != 0 && i < Tensor.this.size.toInt
-      if (!hasNext && resolvedHandle != 0) {
-        NativeHandleLock synchronized {
-          NativeTensor.delete(resolvedHandle)
-          resolvedHandle = 0
-        }
-      }
-      hasNext
-    }
+    private val buffer: ByteBuffer = hostView
+    private var i     : Int        = 0
+
+    // String tensors are decoded all at once, using a single native call.
+    private lazy val stringOffsets: Array[Long] = new Array[Long](Tensor.this.size.toInt + 1)
+    private lazy val stringBytes  : Array[Byte] = NativeTensor.decodeStrings(hostMirror, stringOffsets)
+
+    override def hasNext: Boolean = i < Tensor.this.size.toInt
 
     override def next(): dataType.ScalaType = {
       val nextElement = dataType match {
         case STRING =>
-          dataType.getElementFromBuffer(
-            buffer, stringOffset + INT64.getElementFromBuffer(buffer, i * INT64.byteSize).toInt)
+          val bytes = stringBytes
+          val start = stringOffsets(i).toInt
+          new String(bytes, start, stringOffsets(i + 1).toInt - start, Tensor.stringCharset)
+              .asInstanceOf[dataType.ScalaType]
         case _ =>
           dataType.getElementFromBuffer(buffer, i * dataType.byteSize)
-
       }
       i += 1
       nextElement
     }
   }
 
+  /** Copies the elements of this tensor to `array` (in row-major order), starting at index `offset`, using a single
+    * native bulk copy instead of reading the elements one at a time. If the element type of `array` does not match
+    * the data type of this tensor, the elements are converted natively while being copied (e.g., a [[FLOAT32]] tensor
+    * can be copied to an `Array[Double]`). Tensors that are not placed in host memory are copied through their host
+    * mirrors.
+    *
+    * @param  array  Array to copy the elements of this tensor to. Its elements must have a JVM primitive type.
+    * @param  offset Index of `array` at which to store the first element of this tensor.
+    * @throws IllegalArgumentException  If the elements of `array` do not have a JVM primitive type, or if this tensor
+    *                                   is not numeric or boolean.
+    * @throws IndexOutOfBoundsException If `array` cannot hold all elements of this tensor, starting at `offset`.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IndexOutOfBoundsException]
+  def copyToArray[T](array: Array[T], offset: Int = 0)(implicit
+      ev: SupportedType[T],
+      context: DynamicVariable[Context]
+  ): Unit = {
+    Tensor.checkArrayConversion(ev.dataType, dataType)
+    NativeHandleLock synchronized {
+      NativeTensor.eagerCopyToArray(nativeHandle, context.value.nativeHandle, array, ev.dataType.cValue, offset)
+    }
+  }
+
+  /** Returns a new array containing the elements of this tensor (in row-major order), converted to `T`, if necessary.
+    * This is equivalent to calling [[copyToArray]] with a new array. */
+  @throws[IllegalArgumentException]
+  def toArray[T](implicit
+      classTag: ClassTag[T],
+      ev: SupportedType[T],
+      context: DynamicVariable[Context]
+  ): Array[T] = {
+    val array = new Array[T](size.toInt)
+    copyToArray(array)
+    array
+  }
+
   def apply(indexers: Indexer*): Tensor = this.slice(indexers: _*)
 
-  def slice(indexers: Indexer*): Tensor = BasicOps(this).slice(indexers: _*)
+  /** Slices this tensor using the provided indexers.
+    *
+    * Slices along the leading axis alone (e.g., `tensor(2)`, `tensor(2 :: 5)`, or `tensor(2 :: 5, ---)`) are contiguous
+    * in memory and so they are returned as views that share the buffer of this tensor, without copying it, whenever
+    * possible. This makes, for example, mini-batching a large in-memory tensor by rows free. All other slices are
+    * computed using a `StridedSlice` op.
+    */
+  def slice(indexers: Indexer*): Tensor = {
+    val view = leadingAxisRange(indexers) match {
+      case Some((start, end, shrink)) => NativeHandleLock synchronized {
+        NativeTensor.eagerSliceView(nativeHandle, start, end, shrink)
+      }
+      case None => 0L
+    }
+    if (view != 0L) Tensor.fromNativeHandle(view) else BasicOps(this).slice(indexers: _*)
+  }
+
+  /** Returns the `[start, end)` range of the leading axis of this tensor that `indexers` select, along with a boolean
+    * value indicating whether that axis is removed, if `indexers` only slice the leading axis with unit step, and
+    * `None` otherwise (including when the indices are out of bounds, so that the corresponding error is reported by
+    * the `StridedSlice` op). */
+  private[this] def leadingAxisRange(indexers: Seq[Indexer]): Option[(Long, Long, Boolean)] = {
+    if (rank < 1 || indexers.isEmpty || !indexers.tail.forall(i => i == Ellipsis || i == Slice.::)) {
+      None
+    } else {
+      val n = shape(0)
+      indexers.head match {
+        case Index(index) if index >= -n && index < n =>
+          val start = Math.floorMod(index, n)
+          Some((start.toLong, start.toLong + 1, true))
+        case slice@Slice(start, _, 1, _) if n > 0 && start >= -n && start < n =>
+          val exclusiveEnd = slice.exclusiveEnd(n)
+          if (exclusiveEnd > n || exclusiveEnd < -n) {
+            None
+          } else {
+            val floorStart = Math.floorMod(start, n)
+            val floorEnd = if (exclusiveEnd < n) Math.floorMod(exclusiveEnd, n) else exclusiveEnd
+            if (floorEnd < floorStart) None else Some((floorStart.toLong, floorEnd.toLong, false))
+          }
+        case _ => None
+      }
+    }
+  }
 
   /** Returns a summary of the contents of this tensor.
     *
@@ -344,6 +460,63 @@ class Tensor private[Tensor](private[api] var nativeHandle: Long)
     */
   def toTensorProto: TensorProto = Tensor.makeProto(this)
 
+  /** Returns the number of bytes of the serialized [[TensorProto]] that represents this tensor. */
+  def tensorProtoSize(implicit context: DynamicVariable[Context]): Long = {
+    NativeHandleLock synchronized {
+      NativeTensor.eagerTensorProtoSize(nativeHandle, context.value.nativeHandle)
+    }
+  }
+
+  /** Serializes this tensor as a [[TensorProto]] into a sequence of direct buffers, each of which holds at most
+    * `chunkSize` bytes. The tensor contents are written natively, straight from the tensor buffer, and so, unlike
+    * [[toTensorProto]], this method supports tensors whose serialized size exceeds 2GB. The serialized message is the
+    * concatenation of the returned buffers and it can be parsed using [[Tensor.fromTensorProto]].
+    *
+    * @param  chunkSize Maximum number of bytes in each buffer.
+    * @return Buffers that contain the serialized message.
+    */
+  def toTensorProtoBuffers(chunkSize: Int = Tensor.TENSOR_PROTO_CHUNK_SIZE)(implicit
+      context: DynamicVariable[Context]
+  ): Seq[ByteBuffer] = {
+    require(chunkSize > 0, s"The chunk size ($chunkSize) must be positive.")
+    NativeHandleLock synchronized {
+      val size = NativeTensor.eagerTensorProtoSize(nativeHandle, context.value.nativeHandle)
+      (0L until size by chunkSize.toLong).map(offset => {
+        val buffer = ByteBuffer.allocateDirect(math.min(chunkSize.toLong, size - offset).toInt)
+        NativeTensor.eagerSerializeTensorProto(nativeHandle, context.value.nativeHandle, offset, buffer)
+        buffer
+      })
+    }
+  }
+
+  /** Serializes this tensor as a [[TensorProto]] and writes it to `channel`, using a single direct buffer of size
+    * `chunkSize` (or smaller, if the serialized message is smaller) to stream the message, and so supporting tensors
+    * whose serialized size exceeds 2GB.
+    *
+    * @param  channel   Channel to write the serialized message to.
+    * @param  chunkSize Size of the direct buffer used to stream the serialized message.
+    * @return Number of bytes written.
+    */
+  def writeTensorProto(channel: WritableByteChannel, chunkSize: Int = Tensor.TENSOR_PROTO_CHUNK_SIZE)(implicit
+      context: DynamicVariable[Context]
+  ): Long = {
+    require(chunkSize > 0, s"The chunk size ($chunkSize) must be positive.")
+    NativeHandleLock synchronized {
+      val size = NativeTensor.eagerTensorProtoSize(nativeHandle, context.value.nativeHandle)
+      val buffer = ByteBuffer.allocateDirect(math.max(math.min(chunkSize.toLong, size), 1L).toInt)
+      var offset = 0L
+      while (offset < size) {
+        val numWritten = NativeTensor.eagerSerializeTensorProto(
+          nativeHandle, context.value.nativeHandle, offset, buffer)
+        buffer.clear().limit(numWritten.toInt)
+        while (buffer.hasRemaining)
+          channel.write(buffer)
+        offset += numWritten
+      }
+      size
+    }
+  }
+
   override def equals(that: Any): Boolean = that match {
     case that: Tensor =>
       this.shape == that.shape &&
@@ -369,8 +542,11 @@ class Tensor private[Tensor](private[api] var nativeHandle: Long)
   override def close(): Unit = {
     NativeHandleLock.synchronized {
       if (nativeHandle != 0) {
-        NativeTensor.eagerDelete(nativeHandle)
+        // The handle is deleted by a native background thread (along with the host mirror of this tensor, if one has
+        // been created), so that threads disposing of tensors concurrently do not contend on the native locks.
+        NativeTensor.eagerDeleteDeferred(nativeHandle)
         nativeHandle = 0
+        cachedHostView = null
       }
     }
   }
@@ -379,6 +555,9 @@ class Tensor private[Tensor](private[api] var nativeHandle: Long)
 object Tensor {
   private[tensors] val logger = Logger(LoggerFactory.getLogger("Tensor"))
 
+  /** Default size of the buffers used when serializing tensors as [[TensorProto]]s natively (i.e., 64MB). */
+  val TENSOR_PROTO_CHUNK_SIZE: Int = 1 << 26
+
   private[api] def fromNativeHandle(nativeHandle: Long): Tensor = new Tensor(nativeHandle)
 
   private[api] def fromHostNativeHandle(nativeHandle: Long): Tensor = {
@@ -499,28 +678,11 @@ object Tensor {
     shape.assertFullyDefined()
     inferredDataType match {
       case STRING =>
-        val numStringBytes = value.toString.getBytes(Charset.forName("UTF-8")).length
-        val numEncodedBytes = NativeTensor.getEncodedStringSize(numStringBytes)
-        val numBytes = shape.numElements * (INT64.byteSize + numEncodedBytes)
-        val hostHandle = NativeTensor.allocate(STRING.cValue, shape.asArray.map(_.toLong), numBytes)
-        val buffer = NativeTensor.buffer(hostHandle).order(ByteOrder.nativeOrder)
-        val baseOffset = INT64.byteSize * shape.numElements.toInt
-        var index = 0
-        var i = 0
-        while (i < shape.numElements) {
-          val numEncodedBytes = STRING.putElementInBuffer(buffer, baseOffset + index, STRING.cast(value))
-          INT64.putElementInBuffer(buffer, i * INT64.byteSize, index.toLong)
-          index += numEncodedBytes
-          i += 1
-        }
-        synchronized {
-          val tensor = Tensor.fromHostNativeHandle(hostHandle)
-          NativeTensor.delete(hostHandle)
-          tensor
-        }
+        fromStringBytes(shape, Seq.fill(shape.numElements.toInt)(STRING.cast(value).getBytes(stringCharset)))
       case _ =>
         val numBytes = shape.numElements * inferredDataType.byteSize
-        val hostHandle = NativeTensor.allocate(inferredDataType.cValue, shape.asArray.map(_.toLong), numBytes)
+        val hostHandle = NativeTensor.allocate(
+          inferredDataType.cValue, shape.asArray.map(_.toLong), numBytes, pinned = false)
         val buffer = NativeTensor.buffer(hostHandle).order(ByteOrder.nativeOrder)
         var index = 0
         var i = 0
@@ -537,19 +699,100 @@ object Tensor {
     }
   }
 
+  /** Returns a new string tensor with shape `shape` containing `strings`, in row-major order.
+    *
+    * All strings are encoded using a single native call, irrespective of their number.
+    *
+    * @param  strings Tensor elements.
+    * @param  shape   Tensor shape. Defaults to a one-dimensional shape with as many elements as `strings`.
+    * @return Constructed tensor.
+    */
+  def fromStrings(strings: Seq[String], shape: Shape = null): Tensor = {
+    fromStringBytes(if (shape == null) Shape(strings.size) else shape, strings.map(_.getBytes(stringCharset)))
+  }
+
+  /** Character set used to convert between strings and the bytes of string tensor elements. */
+  private[tensors] val stringCharset: Charset = Charset.forName("ISO-8859-1")
+
+  private[api] def fromStringBytes(shape: Shape, strings: Seq[Array[Byte]]): Tensor = {
+    shape.assertFullyDefined()
+    val offsets = strings.scanLeft(0L)(_ + _.length).toArray
+    val bytes = new Array[Byte](offsets.last.toInt)
+    strings.zip(offsets).foreach(s => System.arraycopy(s._1, 0, bytes, s._2.toInt, s._1.length))
+    val hostHandle = NativeTensor.encodeStrings(shape.asArray.map(_.toLong), bytes, offsets)
+    val tensor = Tensor.fromHostNativeHandle(hostHandle)
+    NativeTensor.delete(hostHandle)
+    tensor
+  }
+
+  /** Data types that correspond to the element types of JVM primitive arrays. */
+  private[this] val primitiveArrayDataTypes: Set[DataType] = Set(BOOLEAN, FLOAT32, FLOAT64, INT8, INT16, INT32, INT64)
+
+  /** Checks that arrays with elements of type `arrayDataType` can be bulk-converted to and from tensors with data type
+    * `tensorDataType`. */
+  @throws[IllegalArgumentException]
+  private[tensors] def checkArrayConversion(arrayDataType: DataType, tensorDataType: DataType): Unit = {
+    if (!primitiveArrayDataTypes.contains(arrayDataType))
+      throw new IllegalArgumentException(
+        s"Arrays of '$arrayDataType' elements cannot be bulk-converted to or from tensors, because '$arrayDataType' " +
+            "does not correspond to a JVM primitive type.")
+    if (!primitiveArrayDataTypes.contains(tensorDataType) && tensorDataType != UINT8 && tensorDataType != UINT16)
+      throw new IllegalArgumentException(
+        s"'$tensorDataType' tensors cannot be bulk-converted to or from arrays. Only numeric and boolean tensors can.")
+  }
+
+  /** Creates a new tensor from the elements of a JVM primitive array (in row-major order), using a single native bulk
+    * copy instead of converting the elements one at a time. If `dataType` does not match the element type of `array`,
+    * the elements are converted natively while being copied (e.g., an `Array[Double]` can be used to create a
+    * [[FLOAT32]] tensor).
+    *
+    * @param  array    Array containing the tensor elements. Its elements must have a JVM primitive type.
+    * @param  shape    Tensor shape, which must be fully defined. Defaults to a vector containing all elements of
+    *                  `array`, starting at `offset`.
+    * @param  dataType Tensor data type, which must be numeric or boolean. Defaults to the data type of the elements of
+    *                  `array`.
+    * @param  offset   Index of the first element of `array` to use.
+    * @return Created tensor.
+    * @throws IllegalArgumentException  If the elements of `array` do not have a JVM primitive type, or if `dataType` is
+    *                                   not numeric or boolean.
+    * @throws IndexOutOfBoundsException If `array` does not contain enough elements for `shape`, starting at `offset`.
+    */
+  @throws[IllegalArgumentException]
+  @throws[IndexOutOfBoundsException]
+  def fromArray[T](array: Array[T], shape: Shape = null, dataType: DataType = null, offset: Int = 0)(implicit
+      ev: SupportedType[T]
+  ): Tensor = {
+    val inferredShape = if (shape == null) Shape(array.length - offset) else shape
+    val inferredDataType = if (dataType == null) ev.dataType else dataType
+    checkArrayConversion(ev.dataType, inferredDataType)
+    inferredShape.assertFullyDefined()
+    val hostHandle = NativeTensor.fromArray(
+      array, ev.dataType.cValue, offset, inferredDataType.cValue, inferredShape.asArray.map(_.toLong))
+    val tensor = Tensor.fromHostNativeHandle(hostHandle)
+    NativeTensor.delete(hostHandle)
+    tensor
+  }
+
   /** Allocates a new tensor without worrying about the values stored in it.
+    *
+    * If `pinned` is `true`, the tensor is backed by pinned (i.e., page-locked) host memory. Tensors that are filled in
+    * place and then fed to GPU ops are then copied to the GPUs using DMA, instead of first being staged through an
+    * internal pinned buffer, which saves a copy and a synchronous transfer. Pinned memory is expensive to allocate and
+    * it should be reused through the pinned buffer pool (see [[setBufferPoolCapacity]]). It requires the native library
+    * to be built with CUDA support and a visible GPU, and pageable memory is used otherwise.
     *
     * @param  dataType Tensor data type, which cannot be [[STRING]].
     * @param  shape    Tensor shape.
+    * @param  pinned   If `true`, the tensor is backed by pinned host memory.
     * @return Allocated tensor.
     * @throws IllegalArgumentException If `dataType` is [[STRING]], because the number of bytes required for a string
     *                                  tensor are not known until all its element values are known.
     */
   @throws[IllegalArgumentException]
-  private[api] def allocate(dataType: DataType, shape: Shape): Tensor = dataType match {
+  private[api] def allocate(dataType: DataType, shape: Shape, pinned: Boolean = false): Tensor = dataType match {
     case STRING =>
       if (shape.numElements == 0) {
-        val hostHandle = NativeTensor.allocate(dataType.cValue, Array[Long](0), 0)
+        val hostHandle = NativeTensor.allocate(dataType.cValue, Array[Long](0), 0, pinned = false)
         val tensor = Tensor.fromHostNativeHandle(hostHandle)
         NativeTensor.delete(hostHandle)
         tensor
@@ -560,26 +803,186 @@ object Tensor {
     case _ =>
       shape.assertFullyDefined()
       val numBytes = shape.numElements * dataType.byteSize
-      val hostHandle = NativeTensor.allocate(dataType.cValue, shape.asArray.map(_.toLong), numBytes)
+      val hostHandle = NativeTensor.allocate(dataType.cValue, shape.asArray.map(_.toLong), numBytes, pinned)
       val tensor = Tensor.fromHostNativeHandle(hostHandle)
       NativeTensor.delete(hostHandle)
       tensor
   }
 
+  /** Sets the maximum number of bytes that the native buffer pool used by [[allocate]] and [[fromBuffer]] may hold in
+    * unused buffers. Buffers of deleted tensors are reused by subsequent allocations of similar sizes, as long as this
+    * capacity is not exceeded. A capacity of zero (the default) disables pooling and releases all pooled buffers.
+    *
+    * @param  numBytes Pool capacity in bytes.
+    * @param  pinned   If `true`, the capacity of the pool of pinned host buffers is set, instead of that of the pool of
+    *                  pageable host buffers.
+    */
+  def setBufferPoolCapacity(numBytes: Long, pinned: Boolean = false): Unit = {
+    require(numBytes >= 0, s"The buffer pool capacity ($numBytes) must be non-negative.")
+    NativeTensor.setPoolCapacity(numBytes, pinned)
+  }
+
+  /** Returns the statistics of the native buffer pool of pinned host buffers, if `pinned` is `true`, or of pageable
+    * host buffers, otherwise. */
+  def bufferPoolStatistics(pinned: Boolean = false): TensorPoolStatistics = NativeTensor.poolStatistics(pinned)
+
+  /** Creates a new tensor from the contents of the provided byte buffer.
+    *
+    * If `buffer` is a direct buffer and `copy` is `false`, the native tensor adopts the buffer memory directly, without
+    * copying it. In that case, the buffer is kept alive for as long as the native tensor is alive and it must not be
+    * modified after this call. Buffers that do not satisfy the TensorFlow memory alignment requirements are always
+    * copied. If `pinned` is `true`, the contents of `buffer` are always copied into pinned host memory (see
+    * [[allocate]]).
+    *
+    * @param  dataType Tensor data type.
+    * @param  shape    Tensor shape.
+    * @param  numBytes Number of bytes of `buffer` to use for the tensor.
+    * @param  buffer   Byte buffer containing the tensor data.
+    * @param  copy     Boolean value indicating whether to copy the contents of direct buffers.
+    * @param  pinned   If `true`, the tensor is backed by pinned host memory.
+    * @return Created tensor.
+    */
   @throws[IllegalArgumentException]
-  def fromBuffer(dataType: DataType, shape: Shape, numBytes: Long, buffer: ByteBuffer): Tensor = this synchronized {
-    // TODO: May behave weirdly for direct byte buffers allocated on the Scala side.
-    val directBuffer = {
-      if (buffer.isDirect) {
-        buffer
+  def fromBuffer(
+      dataType: DataType, shape: Shape, numBytes: Long, buffer: ByteBuffer, copy: Boolean = true,
+      pinned: Boolean = false
+  ): Tensor = this synchronized {
+    val hostHandle = {
+      if (buffer.isDirect && (copy || pinned)) {
+        NativeTensor.fromBuffer(dataType.cValue, shape.asArray.map(_.toLong), numBytes, buffer, pinned)
+      } else if (pinned) {
+        val handle = NativeTensor.allocate(dataType.cValue, shape.asArray.map(_.toLong), numBytes, pinned)
+        val bufferCopy = buffer.duplicate()
+        NativeTensor.buffer(handle).put(bufferCopy.limit(numBytes.toInt).asInstanceOf[ByteBuffer])
+        handle
+      } else if (buffer.isDirect) {
+        NativeTensor.fromBufferNoCopy(dataType.cValue, shape.asArray.map(_.toLong), numBytes, buffer)
       } else {
+        // The direct copy is private to this method and so it can be safely adopted by the native tensor.
         val direct = ByteBuffer.allocateDirect(numBytes.toInt)
         val bufferCopy = buffer.duplicate()
         direct.put(bufferCopy.limit(numBytes.toInt).asInstanceOf[ByteBuffer])
+        NativeTensor.fromBufferNoCopy(dataType.cValue, shape.asArray.map(_.toLong), numBytes, direct)
+      }
+    }
+    val tensor = Tensor.fromHostNativeHandle(hostHandle)
+    NativeTensor.delete(hostHandle)
+    tensor
+  }
+
+  /** Creates a new floating-point tensor from unsigned bytes (e.g., image pixels), normalizing them in a single
+    * vectorized native pass. For each byte in channel `c` (i.e., the innermost dimension of `shape`), the corresponding
+    * tensor element is set to `byte * scale(c) + shift(c)`. This is equivalent to creating a [[UINT8]] tensor, casting
+    * it to `dataType`, and normalizing it using math ops, but it avoids the intermediate tensors and op executions.
+    *
+    * @param  buffer   Byte buffer containing the unsigned bytes. Non-direct buffers are first copied to a direct
+    *                  buffer.
+    * @param  shape    Tensor shape, which must be fully defined.
+    * @param  scale    Scale to apply to each channel, or a single scale to apply to all channels.
+    * @param  shift    Shift to apply to each channel (after scaling), or a single shift to apply to all channels.
+    * @param  dataType Tensor data type, which must be [[FLOAT32]] or [[FLOAT16]].
+    * @return Created tensor.
+    * @throws IllegalArgumentException If `dataType` is not [[FLOAT32]] or [[FLOAT16]], or if the sizes of `scale` or
+    *                                  `shift` do not match the number of channels.
+    */
+  @throws[IllegalArgumentException]
+  def fromNormalizedBytes(
+      buffer: ByteBuffer, shape: Shape, scale: Seq[Float], shift: Seq[Float] = Seq(0.0f), dataType: DataType = FLOAT32
+  ): Tensor = {
+    if (dataType != FLOAT32 && dataType != FLOAT16)
+      throw new IllegalArgumentException("Bytes can only be normalized into 'FLOAT32' or 'FLOAT16' tensors.")
+    shape.assertFullyDefined()
+    val directBuffer = {
+      if (buffer.isDirect) {
+        buffer
+      } else {
+        val direct = ByteBuffer.allocateDirect(shape.numElements.toInt)
+        direct.put(buffer.duplicate().limit(shape.numElements.toInt).asInstanceOf[ByteBuffer])
         direct
       }
     }
-    val hostHandle = NativeTensor.fromBuffer(dataType.cValue, shape.asArray.map(_.toLong), numBytes, directBuffer)
+    val hostHandle = NativeTensor.ingestUInt8(
+      directBuffer, dataType.cValue, shape.asArray.map(_.toLong), scale.toArray, shift.toArray)
+    val tensor = Tensor.fromHostNativeHandle(hostHandle)
+    NativeTensor.delete(hostHandle)
+    tensor
+  }
+
+  /** Packs the provided example tensors, which must all have the same data type and shape, into a new batch tensor
+    * (i.e., stacks them along a new leading axis).
+    *
+    * If all examples are placed in host memory (and they are not string tensors), they are copied into the batch
+    * tensor natively, using a single call, and in parallel for large batches, instead of using a `Pack` op. Otherwise,
+    * they are stacked using a `Pack` op.
+    *
+    * @param  examples Example tensors to pack.
+    * @return Batch tensor.
+    * @throws InvalidArgumentException If the examples do not all have the same data type and shape.
+    */
+  @throws[InvalidArgumentException]
+  def packBatch(examples: Seq[Tensor])(implicit context: DynamicVariable[Context]): Tensor = {
+    val hostHandle = NativeTensor.eagerPack(examples.map(_.nativeHandle).toArray)
+    if (hostHandle == 0L) {
+      stack(examples)
+    } else {
+      val tensor = Tensor.fromHostNativeHandle(hostHandle)
+      NativeTensor.delete(hostHandle)
+      tensor
+    }
+  }
+
+  /** Packs the contents of the provided byte buffers, which each contain one example with data type `dataType` and
+    * shape `shape`, into a new batch tensor with shape `[buffers.size] + shape`. The buffers are copied natively, using
+    * a single call, and in parallel for large batches.
+    *
+    * @param  dataType Example data type, which cannot be [[STRING]].
+    * @param  shape    Example shape, which must be fully defined.
+    * @param  buffers  Byte buffers containing the examples. Non-direct buffers are first copied to direct buffers.
+    * @return Batch tensor.
+    * @throws IllegalArgumentException If `dataType` is [[STRING]].
+    */
+  @throws[IllegalArgumentException]
+  def packBatch(dataType: DataType, shape: Shape, buffers: Seq[ByteBuffer]): Tensor = {
+    if (dataType == STRING)
+      throw new IllegalArgumentException("String examples cannot be packed from byte buffers.")
+    shape.assertFullyDefined()
+    val numBytes = shape.numElements * dataType.byteSize
+    val directBuffers = buffers.map(buffer => {
+      if (buffer.isDirect) {
+        buffer
+      } else {
+        val direct = ByteBuffer.allocateDirect(numBytes.toInt)
+        direct.put(buffer.duplicate().limit(numBytes.toInt).asInstanceOf[ByteBuffer])
+        direct
+      }
+    }).toArray
+    val hostHandle = NativeTensor.packBuffers(dataType.cValue, shape.asArray.map(_.toLong), numBytes, directBuffers)
+    val tensor = Tensor.fromHostNativeHandle(hostHandle)
+    NativeTensor.delete(hostHandle)
+    tensor
+  }
+
+  /** Parses the serialized [[TensorProto]] stored in the concatenation of `buffers` (from their positions to their
+    * limits) natively, copying numeric tensor contents straight into the new tensor buffer. This supports messages
+    * larger than 2GB, such as the ones produced by [[Tensor.toTensorProtoBuffers]] and [[Tensor.writeTensorProto]].
+    * Buffers that are not direct are first copied to direct buffers.
+    *
+    * @param  buffers Buffers that contain the serialized message.
+    * @return Parsed tensor.
+    * @throws InvalidArgumentException If the buffers do not contain a valid serialized [[TensorProto]].
+    */
+  @throws[InvalidArgumentException]
+  def fromTensorProto(buffers: Seq[ByteBuffer]): Tensor = {
+    val directBuffers = buffers.map(buffer => {
+      if (buffer.isDirect) {
+        buffer.slice()
+      } else {
+        val direct = ByteBuffer.allocateDirect(buffer.remaining())
+        direct.put(buffer.duplicate())
+        direct
+      }
+    }).toArray
+    val hostHandle = NativeTensor.parseTensorProto(directBuffers)
     val tensor = Tensor.fromHostNativeHandle(hostHandle)
     NativeTensor.delete(hostHandle)
     tensor
@@ -591,6 +994,21 @@ object Tensor {
   ): TensorProto = {
     val inferredDataType = if (dataType == null) value.dataType else dataType
     val inferredShape = if (shape == null) value.shape else shape
+    if (inferredDataType == value.dataType && inferredShape == value.shape && value.dataType != STRING) {
+      // The message is serialized natively, straight from the tensor buffer, and it is then parsed back, which avoids
+      // the cast and the intermediate copies of the tensor contents.
+      if (value.tensorProtoSize >= Int.MaxValue)
+        throw InvalidArgumentException(
+          "Cannot create protos for tensors whose content is larger than 2GB. Use 'toTensorProtoBuffers' instead.")
+      TensorProto.parseFrom(value.toTensorProtoBuffers(Int.MaxValue).head)
+    } else {
+      makeProtoFromEntries(value, inferredDataType, inferredShape)
+    }
+  }
+
+  private[this] def makeProtoFromEntries(value: Tensor, inferredDataType: DataType, inferredShape: Shape)(implicit
+      context: DynamicVariable[Context]
+  ): TensorProto = {
     val castedValue = value.cast(inferredDataType)
     val tensorProtoBuilder =
       TensorProto.newBuilder()
@@ -779,6 +1197,18 @@ final case class SparseTensor(indices: Tensor, values: Tensor, denseShape: Tenso
     *
     * @return [[TensorIndexedSlices]] that has the same value as this [[TensorLike]].
     */
+  /** Converts this rank-2 sparse tensor to the compressed sparse row (CSR) format.
+    *
+    * @return Sparse tensor in CSR format.
+    */
+  def toCSR(implicit context: DynamicVariable[Context]): CSRSparseTensor = {
+    val outputs = NativeTensorOpsSparse.sparseTensorToCSR(
+      context.value.nativeHandle, indices.nativeHandle, values.nativeHandle, denseShape.nativeHandle)
+    CSRSparseTensor(
+      Tensor.fromNativeHandle(outputs(0)), Tensor.fromNativeHandle(outputs(1)), Tensor.fromNativeHandle(outputs(2)),
+      denseShape)
+  }
+
   @throws[UnsupportedOperationException]
   override def toTensorIndexedSlices: TensorIndexedSlices = {
     throw new UnsupportedOperationException(s"Cannot convert sparse tensor '$this' to tensor indexed slices.")
@@ -790,6 +1220,50 @@ final case class SparseTensor(indices: Tensor, values: Tensor, denseShape: Tenso
   }
 }
 
+/** Represents a rank-2 sparse tensor in compressed sparse row (CSR) format.
+  *
+  * The non-zero entries of row `i` are stored in positions `rowPointers(i)` (inclusive) through `rowPointers(i + 1)`
+  * (exclusive) of `columnIndices` and `values`.
+  *
+  * @param  rowPointers   One-dimensional [[INT64]] tensor with shape `[denseShape(0) + 1]`.
+  * @param  columnIndices One-dimensional [[INT64]] tensor with shape `[N]`.
+  * @param  values        One-dimensional tensor with shape `[N]`.
+  * @param  denseShape    One-dimensional [[INT64]] tensor with shape `[2]`.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+final case class CSRSparseTensor(rowPointers: Tensor, columnIndices: Tensor, values: Tensor, denseShape: Tensor) {
+  require(rowPointers.dataType == INT64,
+          s"Row pointers cannot have '${rowPointers.dataType}' data type. They have to be 'INT64'.")
+  require(columnIndices.dataType == INT64,
+          s"Column indices cannot have '${columnIndices.dataType}' data type. They have to be 'INT64'.")
+  require(denseShape.dataType == INT64,
+          s"Dense shape cannot have '${denseShape.dataType}' data type. It has to be 'INT64'.")
+
+  Shape(columnIndices.shape.withRank(1)(0)).assertIsCompatibleWith(Shape(values.shape.withRank(1)(0)))
+  denseShape.shape.assertIsCompatibleWith(Shape(2))
+
+  /** Data type of this sparse tensor. */
+  val dataType: DataType = values.dataType
+
+  /** Multiplies this sparse tensor with the dense matrix `other`.
+    *
+    * @param  other    Dense matrix.
+    * @param  adjointA If `true`, this sparse tensor is transposed before the multiplication.
+    * @return Result as a new tensor.
+    */
+  def matmul(other: Tensor, adjointA: Boolean = false)(implicit context: DynamicVariable[Context]): Tensor = {
+    Tensor.fromNativeHandle(NativeTensorOpsSparse.cSRSparseDenseMatMul(
+      context.value.nativeHandle, rowPointers.nativeHandle, columnIndices.nativeHandle, values.nativeHandle,
+      denseShape.nativeHandle, other.nativeHandle, adjointA))
+  }
+
+  override def toString: String = {
+    s"CSRSparseTensor(rowPointers = $rowPointers, columnIndices = $columnIndices, values = $values, " +
+        s"denseShape = $denseShape)"
+  }
+}
+
 trait TensorConvertible[T] {
   // TODO: Add data type argument.
   /** Converts `value` to a dense tensor. */
@@ -0,0 +1,51 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+
+package org.platanios.tensorflow.api.tensors.ops
+
+import org.platanios.tensorflow.api.tensors.{Context, Tensor}
+import org.platanios.tensorflow.jni.generated.tensors.{Image => NativeTensorOpsImage}
+
+import scala.util.DynamicVariable
+
+/** Contains functions for executing ops related to processing image data.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+private[api] trait Image {
+  /** $OpDocImageDecodeCropAndResizeJpeg
+    *
+    * @group ImageOps
+    * @param  contents   `STRING` scalar or vector containing the JPEG-encoded images.
+    * @param  cropWindow [[INT32]] tensor with shape `[4]` or `[batchSize, 4]`, containing the crop window(s),
+    *                    represented as `[cropY, cropX, cropHeight, cropWidth]`. A single crop window is shared by all
+    *                    images.
+    * @param  size       [[INT32]] tensor with shape `[2]`, containing the new size of the images, represented as
+    *                    `[height, width]`.
+    * @param  channels   Number of color channels of the decoded images. Must be `1` (for grayscale images) or `3` (for
+    *                    RGB images).
+    * @return Result as a new [[FLOAT32]] tensor with shape `[height, width, channels]`, if `contents` is a scalar, or
+    *         `[batchSize, height, width, channels]`, if it is a vector.
+    */
+  def decodeCropAndResizeJpeg(
+      contents: Tensor, cropWindow: Tensor, size: Tensor, channels: Int = 3)(
+      implicit context: DynamicVariable[Context]): Tensor = {
+    Tensor.fromNativeHandle(NativeTensorOpsImage.decodeCropAndResizeJpeg(
+      context.value.nativeHandle, contents.nativeHandle, cropWindow.nativeHandle, size.nativeHandle, channels))
+  }
+}
+
+private[api] object Image extends Image
@@ -492,18 +492,25 @@ private[api] trait NN {
   /** $OpDocNNTopK
     *
     * @group NNOps
-    * @param  input  Input tensor whose last axis has size at least `k`.
-    * @param  k      Scalar [[INT32]] tensor containing the number of top elements to look for along the last axis of
-    *                `input`.
-    * @param  sorted If `true`, the resulting `k` elements will be sorted by their values in descending order.
+    * @param  input       Input tensor whose last axis has size at least `k`.
+    * @param  k           Scalar [[INT32]] tensor containing the number of top elements to look for along the last axis
+    *                     of `input`.
+    * @param  sorted      If `true`, the resulting `k` elements will be sorted by their values in descending order.
+    * @param  partialSort If `true`, a (CPU-only) kernel specialized for large last axes and small `k` (e.g., for
+    *                     vocabulary-sized logits) is used, which skips most elements using a vectorized threshold
+    *                     filter and only partially sorts the remaining candidates.
     * @return Tuple containing the created tensors: (i) `values`: the `k` largest elements along each last
     *         dimensional slice, and (ii) `indices`: the indices of `values` within the last axis of `input`.
     */
   def topK(
-      input: Tensor, k: Tensor = 1, sorted: Boolean = true)(
+      input: Tensor, k: Tensor = 1, sorted: Boolean = true, partialSort: Boolean = false)(
       implicit context: DynamicVariable[Context]): (Tensor, Tensor) = {
-    val outputs = NativeTensorOpsNN.topKV2(
-      context.value.nativeHandle, input.nativeHandle, k.nativeHandle, sorted)
+    val outputs = {
+      if (partialSort)
+        NativeTensorOpsNN.largeTopK(context.value.nativeHandle, input.nativeHandle, k.nativeHandle, sorted)
+      else
+        NativeTensorOpsNN.topKV2(context.value.nativeHandle, input.nativeHandle, k.nativeHandle, sorted)
+    }
     (Tensor.fromNativeHandle(outputs(0)), Tensor.fromNativeHandle(outputs(1)))
   }
 
@@ -513,13 +520,25 @@ private[api] trait NN {
     * @param  predictions [[FLOAT32]] tensor containing the predictions.
     * @param  targets     [[INT32]] or [[INT64]] tensor containing the targets.
     * @param  k           Scalar [[INT32]] or [[INT64]] tensor containing the number of top elements to look at.
+    * @param  partialSort If `true`, a (CPU-only) kernel specialized for large numbers of classes is used, which
+    *                     counts the predictions larger than each target using vectorized comparisons and stops as soon
+    *                     as `k` of them have been found.
     * @return Result as a new tensor.
     */
-  def inTopK(predictions: Tensor, targets: Tensor, k: Tensor)(implicit context: DynamicVariable[Context]): Tensor = {
+  def inTopK(
+      predictions: Tensor, targets: Tensor, k: Tensor, partialSort: Boolean = false)(
+      implicit context: DynamicVariable[Context]): Tensor = {
     val mostPreciseDataType = DataType.mostPrecise(targets.dataType, k.dataType)
-    Tensor.fromNativeHandle(NativeTensorOpsNN.inTopKV2(
-      context.value.nativeHandle, predictions.nativeHandle, targets.cast(mostPreciseDataType).nativeHandle,
-      k.cast(mostPreciseDataType).nativeHandle))
+    val castedTargets = targets.cast(mostPreciseDataType)
+    val castedK = k.cast(mostPreciseDataType)
+    Tensor.fromNativeHandle({
+      if (partialSort)
+        NativeTensorOpsNN.largeInTopK(
+          context.value.nativeHandle, predictions.nativeHandle, castedTargets.nativeHandle, castedK.nativeHandle)
+      else
+        NativeTensorOpsNN.inTopKV2(
+          context.value.nativeHandle, predictions.nativeHandle, castedTargets.nativeHandle, castedK.nativeHandle)
+    })
   }
 
   //region Convolution Ops
@@ -797,22 +816,28 @@ private[api] object NN extends NN {
     /** $OpDocNNTopK
       *
       * @group NNOps
-      * @param  k      Scalar [[INT32]] tensor containing the number of top elements to look for along the last axis of
-      *                `input`.
-      * @param  sorted If `true`, the resulting `k` elements will be sorted by their values in descending order.
+      * @param  k           Scalar [[INT32]] tensor containing the number of top elements to look for along the last
+      *                     axis of `input`.
+      * @param  sorted      If `true`, the resulting `k` elements will be sorted by their values in descending order.
+      * @param  partialSort If `true`, a (CPU-only) kernel specialized for large last axes and small `k` is used.
       * @return Tuple containing the created op outputs: (i) `values`: the `k` largest elements along each last
       *         dimensional slice, and (ii) `indices`: the indices of `values` within the last axis of `input`.
       */
-    def topK(k: Tensor = 1, sorted: Boolean = true): (Tensor, Tensor) = NN.topK(tensor, k, sorted)
+    def topK(k: Tensor = 1, sorted: Boolean = true, partialSort: Boolean = false): (Tensor, Tensor) = {
+      NN.topK(tensor, k, sorted, partialSort)
+    }
 
     /** $OpDocNNInTopK
       *
       * @group NNOps
-      * @param  targets [[INT32]] or [[INT64]] tensor containing the targets.
-      * @param  k       Scalar [[INT32]] or [[INT64]] tensor containing the number of top elements to look at.
+      * @param  targets     [[INT32]] or [[INT64]] tensor containing the targets.
+      * @param  k           Scalar [[INT32]] or [[INT64]] tensor containing the number of top elements to look at.
+      * @param  partialSort If `true`, a (CPU-only) kernel specialized for large numbers of classes is used.
       * @return Result as a new tensor.
       */
-    def inTopK(targets: Tensor, k: Tensor): Tensor = NN.inTopK(tensor, targets, k)
+    def inTopK(targets: Tensor, k: Tensor, partialSort: Boolean = false): Tensor = {
+      NN.inTopK(tensor, targets, k, partialSort)
+    }
 
     //region Convolution Ops
 
@@ -40,11 +40,14 @@ private[api] trait Random {
     *                  Defaults to `1`.
     * @param  seed     Optional random seed, used to generate a random seed pair for the random number generator, when
     *                  combined with the graph-level seed.
+    * @param  parallel If `true`, the values are generated by the parallel counter-based kernel, which splits the output
+    *                  into fixed-size chunks that are filled concurrently. Only supported for [[FLOAT32]] and
+    *                  [[FLOAT64]].
     * @return Result as a new tensor.
     */
   def randomUniform(
       dataType: DataType = FLOAT32, shape: Tensor = Shape.scalar(), minValue: Tensor = 0.0, maxValue: Tensor = 1.0,
-      seed: Option[Int] = None)(implicit context: DynamicVariable[Context]): Tensor = {
+      seed: Option[Int] = None, parallel: Boolean = false)(implicit context: DynamicVariable[Context]): Tensor = {
     val castedMinValue = Math.cast(minValue, dataType)
     val castedMaxValue = Math.cast(maxValue, dataType)
     val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
@@ -52,6 +55,10 @@ private[api] trait Random {
       Tensor.fromNativeHandle(NativeTensorOpsRandom.randomUniformInt(
         context.value.nativeHandle, shape.nativeHandle, castedMinValue.nativeHandle, castedMaxValue.nativeHandle,
         graphSeed.getOrElse(0).toLong, opSeed.getOrElse(0).toLong))
+    } else if (parallel) {
+      Tensor.fromNativeHandle(NativeTensorOpsRandom.parallelRandomUniform(
+        context.value.nativeHandle, shape.nativeHandle, castedMinValue.nativeHandle, castedMaxValue.nativeHandle,
+        graphSeed.getOrElse(0).toLong, opSeed.getOrElse(0).toLong))
     } else {
       val random = Tensor.fromNativeHandle(NativeTensorOpsRandom.randomUniform(
         context.value.nativeHandle, shape.nativeHandle, dataType.cValue, graphSeed.getOrElse(0).toLong,
@@ -71,18 +78,61 @@ private[api] trait Random {
     *                           `1`.
     * @param  seed              Optional random seed, used to generate a random seed pair for the random number
     *                           generator, when combined with the graph-level seed.
+    * @param  parallel          If `true`, the values are generated by the parallel counter-based kernel, which splits
+    *                           the output into fixed-size chunks that are filled concurrently. Only supported for
+    *                           [[FLOAT32]] and [[FLOAT64]].
     * @return Result as a new tensor.
     */
   def randomNormal(
       dataType: DataType = FLOAT32, shape: Tensor = Shape.scalar(), mean: Tensor = 0.0, standardDeviation: Tensor = 1.0,
-      seed: Option[Int] = None)(implicit context: DynamicVariable[Context]): Tensor = {
+      seed: Option[Int] = None, parallel: Boolean = false)(implicit context: DynamicVariable[Context]): Tensor = {
+    val castedMean = Math.cast(mean, dataType)
+    val castedStandardDeviation = Math.cast(standardDeviation, dataType)
+    val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
+    if (parallel) {
+      Tensor.fromNativeHandle(NativeTensorOpsRandom.parallelRandomNormal(
+        context.value.nativeHandle, shape.nativeHandle, castedMean.nativeHandle, castedStandardDeviation.nativeHandle,
+        graphSeed.getOrElse(0).toLong, opSeed.getOrElse(0).toLong))
+    } else {
+      val random = Tensor.fromNativeHandle(NativeTensorOpsRandom.randomStandardNormal(
+        context.value.nativeHandle, shape.nativeHandle, dataType.cValue, graphSeed.getOrElse(0).toLong,
+        opSeed.getOrElse(0).toLong))
+      Math.add(random * castedStandardDeviation, castedMean)
+    }
+  }
+
+  /** $OpDocRandomRandomTruncatedNormal
+    *
+    * @group RandomOps
+    * @param  dataType          Data type for the output tensor. Must be one of: [[FLOAT16]], [[FLOAT32]], or
+    *                           [[FLOAT64]].
+    * @param  shape             Rank-1 tensor containing the shape of the output tensor. Defaults to a scalar tensor.
+    * @param  mean              Scalar tensor containing the mean of the Normal distribution. Defaults to `0`.
+    * @param  standardDeviation Scalar tensor containing the standard deviation of the Normal distribution. Defaults to
+    *                           `1`.
+    * @param  seed              Optional random seed, used to generate a random seed pair for the random number
+    *                           generator, when combined with the graph-level seed.
+    * @param  parallel          If `true`, the values are generated by the parallel counter-based kernel, which splits
+    *                           the output into fixed-size chunks that are filled concurrently. Only supported for
+    *                           [[FLOAT32]] and [[FLOAT64]].
+    * @return Result as a new tensor.
+    */
+  def randomTruncatedNormal(
+      dataType: DataType = FLOAT32, shape: Tensor = Shape.scalar(), mean: Tensor = 0.0, standardDeviation: Tensor = 1.0,
+      seed: Option[Int] = None, parallel: Boolean = false)(implicit context: DynamicVariable[Context]): Tensor = {
     val castedMean = Math.cast(mean, dataType)
     val castedStandardDeviation = Math.cast(standardDeviation, dataType)
     val (graphSeed, opSeed) = Op.currentGraphRandomSeed(seed)
-    val random = Tensor.fromNativeHandle(NativeTensorOpsRandom.randomStandardNormal(
-      context.value.nativeHandle, shape.nativeHandle, dataType.cValue, graphSeed.getOrElse(0).toLong,
-      opSeed.getOrElse(0).toLong))
-    Math.add(random * castedStandardDeviation, castedMean)
+    if (parallel) {
+      Tensor.fromNativeHandle(NativeTensorOpsRandom.parallelTruncatedNormal(
+        context.value.nativeHandle, shape.nativeHandle, castedMean.nativeHandle, castedStandardDeviation.nativeHandle,
+        graphSeed.getOrElse(0).toLong, opSeed.getOrElse(0).toLong))
+    } else {
+      val random = Tensor.fromNativeHandle(NativeTensorOpsRandom.truncatedNormal(
+        context.value.nativeHandle, shape.nativeHandle, dataType.cValue, graphSeed.getOrElse(0).toLong,
+        opSeed.getOrElse(0).toLong))
+      Math.add(random * castedStandardDeviation, castedMean)
+    }
   }
 }
 
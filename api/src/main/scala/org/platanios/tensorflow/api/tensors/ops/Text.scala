@@ -0,0 +1,92 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+
+package org.platanios.tensorflow.api.tensors.ops
+
+import org.platanios.tensorflow.api.ops.Text.{FarmHash, StringHashFunction}
+import org.platanios.tensorflow.api.tensors.{Context, Tensor}
+import org.platanios.tensorflow.jni.generated.tensors.{Text => NativeTensorOpsText}
+
+import java.nio.charset.Charset
+
+import scala.util.DynamicVariable
+
+/** Contains functions for executing ops related to text.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+private[api] trait Text {
+  /** $OpDocTextTokenizeStrings
+    *
+    * @group TextOps
+    * @param  input     Input `STRING` tensor.
+    * @param  delimiter Delimiter bytes used for splitting. Each byte of `delimiter` is considered a potential split
+    *                   point. Defaults to the ASCII whitespace characters.
+    * @param  skipEmpty Boolean value indicating whether or not to skip empty tokens.
+    * @return Tuple containing the created tensors: (i) `values`: one-dimensional `STRING` tensor containing the
+    *         tokens of all elements of `input`, and (ii) `rowSplits`: one-dimensional [[INT64]] tensor containing the
+    *         row splits of `values`.
+    */
+  def tokenizeStrings(
+      input: Tensor, delimiter: String = " \t\n\r\u000b\f", skipEmpty: Boolean = true)(
+      implicit context: DynamicVariable[Context]): (Tensor, Tensor) = {
+    val outputs = NativeTensorOpsText.tokenizeStrings(
+      context.value.nativeHandle, input.nativeHandle, delimiter.getBytes(Charset.forName("UTF-8")), skipEmpty)
+    (Tensor.fromNativeHandle(outputs(0)), Tensor.fromNativeHandle(outputs(1)))
+  }
+
+  /** $OpDocTextStringToHashBucketBatch
+    *
+    * @group TextOps
+    * @param  input        `STRING` tensor containing the strings to assign to each bucket.
+    * @param  numBuckets   Number of buckets.
+    * @param  hashFunction Hash function to use.
+    * @return Result as a new tensor, which has the same shape as `input`.
+    */
+  def stringToHashBucketBatch(
+      input: Tensor, numBuckets: Int, hashFunction: StringHashFunction = FarmHash)(
+      implicit context: DynamicVariable[Context]): Tensor = {
+    Tensor.fromNativeHandle(NativeTensorOpsText.stringToHashBucketBatch(
+      context.value.nativeHandle, input.nativeHandle, numBuckets,
+      hashFunction.name.getBytes(Charset.forName("UTF-8"))))
+  }
+
+  /** $OpDocTextWordPieceTokenize
+    *
+    * @group TextOps
+    * @param  input           Input `STRING` tensor containing the words to split.
+    * @param  vocabularyFile  Vocabulary file, containing one sub-word unit per line. The ID of each unit is its
+    *                         (zero-based) line number.
+    * @param  suffixIndicator Prefix of the units that do not start a word.
+    * @param  unknownToken    Unit used to represent unknown words. It must be in the vocabulary.
+    * @param  maxBytesPerWord Maximum size (in bytes) of the words that are split. Longer words are represented by
+    *                         `unknownToken`.
+    * @return Tuple containing the created tensors: (i) `values`: one-dimensional [[INT64]] tensor containing the
+    *         vocabulary IDs of the units of all elements of `input`, and (ii) `rowSplits`: one-dimensional [[INT64]]
+    *         tensor containing the row splits of `values`.
+    */
+  def wordPieceTokenize(
+      input: Tensor, vocabularyFile: String, suffixIndicator: String = "##", unknownToken: String = "[UNK]",
+      maxBytesPerWord: Int = 100)(implicit context: DynamicVariable[Context]): (Tensor, Tensor) = {
+    val utf8 = Charset.forName("UTF-8")
+    val outputs = NativeTensorOpsText.wordPieceTokenize(
+      context.value.nativeHandle, input.nativeHandle, vocabularyFile.getBytes(utf8), suffixIndicator.getBytes(utf8),
+      unknownToken.getBytes(utf8), maxBytesPerWord)
+    (Tensor.fromNativeHandle(outputs(0)), Tensor.fromNativeHandle(outputs(1)))
+  }
+}
+
+private[api] object Text extends Text
@@ -38,7 +38,9 @@ package object ops {
 
   private[api] trait API
       extends Basic
+          with Image
           with Math
           with NN
           with Random
+          with Text
 }
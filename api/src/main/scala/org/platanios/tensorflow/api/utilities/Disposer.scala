@@ -19,7 +19,7 @@ import sun.misc.ThreadGroupUtils
 
 import java.lang.ref.{PhantomReference, Reference, ReferenceQueue}
 import java.security.{AccessController, PrivilegedAction}
-import java.util
+import java.util.concurrent.ConcurrentHashMap
 
 /** This class is used for registering and disposing the native data associated with Scala objects.
   *
@@ -29,14 +29,17 @@ import java.util
   * When the object becomes unreachable, the provided disposing function for that object will be called.
   */
 private[api] object Disposer {
-  private val queue  : ReferenceQueue[Any]                        = new ReferenceQueue[Any]
-  private val records: util.Hashtable[Reference[Any], () => Unit] = new util.Hashtable[Reference[Any], () => Unit]
+  private val queue  : ReferenceQueue[Any] = new ReferenceQueue[Any]
+
+  // A concurrent map is used so that threads registering objects concurrently (e.g., when creating many eager tensors)
+  // do not contend on a single monitor.
+  private val records: ConcurrentHashMap[Reference[Any], () => Unit] = new ConcurrentHashMap[Reference[Any], () => Unit]
 
   /** Performs the actual registration of the target object to be disposed.
     *
     * @param target Disposable object to register.
     */
-  def add(target: Any, disposer: () => Unit): Unit = synchronized {
+  def add(target: Any, disposer: () => Unit): Unit = {
     val reference = new PhantomReference(target, Disposer.queue)
     Disposer.records.put(reference, disposer)
   }
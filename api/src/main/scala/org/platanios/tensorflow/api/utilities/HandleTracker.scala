@@ -0,0 +1,123 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.api.utilities
+
+import org.platanios.tensorflow.jni.{HandleStatistics => NativeHandleStatistics, HandleTracker => NativeHandleTracker}
+
+/** Opt-in tracker of the live native handles (i.e., tensors, eager tensors, record readers, and buffered input
+  * streams), which can be used to find leaked handles and to monitor native memory use (e.g., in long-running
+  * servers, where the only other symptom of a leak is the growth of the resident memory of the process).
+  *
+  * Tracking is disabled by default, in which case it costs a single check per created handle. While it is enabled,
+  * the handles created by each thread are attributed to the allocation site tag set using [[withTag]] (or to the empty
+  * tag, by default), and statistics are kept per handle type and tag. Handles created while tracking was disabled are
+  * not tracked. For example:
+  * {{{
+  *   HandleTracker.enable()
+  *   HandleTracker.withTag("Preprocessing") {
+  *     ...
+  *   }
+  *   HandleTracker.snapshot().filter(_.liveCount > 0).foreach(println)
+  * }}}
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object HandleTracker {
+  @volatile private[this] var enabled: Boolean = false
+
+  private[this] val currentTag: ThreadLocal[String] = new ThreadLocal[String] {
+    override def initialValue(): String = ""
+  }
+
+  /** Returns `true` if tracking is enabled. */
+  def isEnabled: Boolean = enabled
+
+  /** Enables tracking. */
+  def enable(): Unit = synchronized {
+    NativeHandleTracker.setEnabled(true)
+    enabled = true
+  }
+
+  /** Disables tracking and clears all statistics. */
+  def disable(): Unit = synchronized {
+    enabled = false
+    NativeHandleTracker.setEnabled(false)
+  }
+
+  /** Attributes the native handles created by the current thread while executing `block` to the allocation site tag
+    * `tag`. Calls to this method can be nested, in which case the innermost tag is used. */
+  def withTag[R](tag: String)(block: => R): R = {
+    val previousTag = currentTag.get()
+    currentTag.set(tag)
+    NativeHandleTracker.setThreadTag(tag)
+    try {
+      block
+    } finally {
+      currentTag.set(previousTag)
+      NativeHandleTracker.setThreadTag(previousTag)
+    }
+  }
+
+  /** Returns the current statistics of the tracked handles, per handle type and allocation site tag, sorted by handle
+    * type and tag. */
+  def snapshot(): Seq[HandleStatistics] = HandleStatistics.fromNative(NativeHandleTracker.snapshot())
+
+  /** Returns the number of bytes held by the live tracked handles, which can be used to set budget alarms on native
+    * memory use. */
+  def liveBytes: Long = snapshot().map(_.liveBytes).sum
+
+  /** Tracks the eager tensor with handle `handle`, if tracking is enabled. */
+  private[api] def trackEagerTensor(handle: Long): Unit = {
+    if (enabled)
+      NativeHandleTracker.trackEagerTensor(handle)
+  }
+}
+
+/** Statistics of the tracked native handles of a single type and allocation site tag.
+  *
+  * @param  handleType  Handle type (e.g., `"Tensor"` or `"EagerTensor"`).
+  * @param  tag         Allocation site tag.
+  * @param  liveCount   Number of live handles.
+  * @param  liveBytes   Number of bytes held by the live handles, if known for this handle type (e.g., the size of
+  *                     tensors, or the buffer size of buffered input streams).
+  * @param  numCreated  Number of handles created since tracking was enabled.
+  * @param  numReleased Number of handles released since tracking was enabled.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class HandleStatistics(
+    handleType: String,
+    tag: String,
+    liveCount: Long,
+    liveBytes: Long,
+    numCreated: Long,
+    numReleased: Long) {
+  override def toString: String = {
+    s"HandleStatistics[type = $handleType, tag = $tag, live = $liveCount ($liveBytes B), created = $numCreated, " +
+        s"released = $numReleased]"
+  }
+}
+
+object HandleStatistics {
+  /** Unpacks the handle statistics returned by the native library. */
+  private[utilities] def fromNative(statistics: NativeHandleStatistics): Seq[HandleStatistics] = {
+    val n = NativeHandleStatistics.NumValues
+    statistics.handleTypes.indices.map(i => {
+      val values = statistics.statistics.slice(i * n, (i + 1) * n)
+      HandleStatistics(statistics.handleTypes(i), statistics.tags(i), values(0), values(1), values(2), values(3))
+    })
+  }
+}
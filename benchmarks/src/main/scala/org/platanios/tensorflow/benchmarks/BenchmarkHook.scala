@@ -0,0 +1,68 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.benchmarks
+
+import org.platanios.tensorflow.api.core.client.{Executable, Fetchable, Session}
+import org.platanios.tensorflow.api.learn.hooks.Hook
+import org.platanios.tensorflow.api.ops.{Op, Output}
+import org.platanios.tensorflow.api.tensors.Tensor
+
+/** Hook that measures the steps of an estimator training run, for benchmarking purposes.
+  *
+  * The first `warmUpSteps` steps are not measured. The latency of each step is measured from before to after its
+  * `Session.run()` call and the breakdown of the run time is obtained from [[Hook.SessionRunResult.timings]]. The peak
+  * native memory use is obtained from the session allocators after the last step (i.e., step `warmUpSteps + numSteps`).
+  *
+  * @param  warmUpSteps Number of warm-up steps that are not measured.
+  * @param  numSteps    Number of measured steps.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+class BenchmarkHook(val warmUpSteps: Int, val numSteps: Int) extends Hook {
+  private[this] val recorder  : StepRecorder = new StepRecorder(warmUpSteps)
+  private[this] var peakMemory: Long         = 0L
+
+  override def beforeSessionRun[F, E, R](runContext: Hook.SessionRunContext[F, E, R])(implicit
+      executableEv: Executable[E],
+      fetchableEv: Fetchable.Aux[F, R]
+  ): Option[Hook.SessionRunArgs[Seq[Output], Traversable[Op], Seq[Tensor]]] = {
+    recorder.stepStarted()
+    None
+  }
+
+  override def afterSessionRun[F, E, R](
+      runContext: Hook.SessionRunContext[F, E, R],
+      runResult: Hook.SessionRunResult[Seq[Output], Seq[Tensor]]
+  )(implicit
+      executableEv: Executable[E],
+      fetchableEv: Fetchable.Aux[F, R]
+  ): Unit = {
+    recorder.stepEnded(runResult.timings)
+    if (recorder.recordedSteps == warmUpSteps + numSteps)
+      peakMemory = BenchmarkResult.peakMemory(runContext.session.allocatorStatistics)
+  }
+
+  override def end(session: Session): Unit = {
+    if (peakMemory == 0L)
+      peakMemory = BenchmarkResult.peakMemory(session.allocatorStatistics)
+  }
+
+  /** Returns the result of the benchmark, for a workload named `workload` that processes `examplesPerStep` examples in
+    * each step. */
+  def result(workload: String, examplesPerStep: Int): BenchmarkResult = {
+    recorder.result(workload, examplesPerStep, peakMemory)
+  }
+}
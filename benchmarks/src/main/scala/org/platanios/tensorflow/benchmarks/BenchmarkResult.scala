@@ -0,0 +1,141 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.benchmarks
+
+import org.platanios.tensorflow.api.core.client.{AllocatorStatistics, RunTimings}
+
+import scala.collection.mutable.ArrayBuffer
+
+/** Result of running a benchmark workload.
+  *
+  * @param  workload        Name of the workload.
+  * @param  numSteps        Number of measured steps (i.e., excluding the warm-up steps).
+  * @param  examplesPerStep Number of examples processed in each step (i.e., the batch size).
+  * @param  totalTime       Wall time elapsed between the start of the first measured step and the end of the last one,
+  *                         in nanoseconds.
+  * @param  stepLatencies   Sorted latencies of the measured steps, in nanoseconds.
+  * @param  timings         Average breakdown of the `Session.run()` calls of the measured steps, if available.
+  * @param  peakMemory      Peak number of bytes in use by the native device allocators. Note that, as explained in
+  *                         [[AllocatorStatistics]], this covers the whole lifetime of the process.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class BenchmarkResult(
+    workload: String,
+    numSteps: Int,
+    examplesPerStep: Int,
+    totalTime: Long,
+    stepLatencies: Seq[Long],
+    timings: Option[RunTimings],
+    peakMemory: Long) {
+  /** Number of steps executed per second. */
+  def stepsPerSecond: Double = if (totalTime > 0) numSteps * 1e9 / totalTime else 0.0
+
+  /** Number of examples processed per second. */
+  def examplesPerSecond: Double = stepsPerSecond * examplesPerStep
+
+  /** Returns the `p`-th percentile of the step latencies (using the nearest-rank method), in nanoseconds. */
+  def latencyPercentile(p: Double): Long = {
+    if (stepLatencies.isEmpty) {
+      0L
+    } else {
+      val rank = math.ceil(p / 100.0 * stepLatencies.size).toInt
+      stepLatencies(math.min(math.max(rank, 1), stepLatencies.size) - 1)
+    }
+  }
+
+  /** Fraction of the `Session.run()` time spent outside of `TF_SessionRun` (i.e., marshalling values on the JVM and in
+    * the native library, and crossing the JNI boundary), if available. */
+  def jniTimeShare: Option[Double] = timings.filter(_.total > 0).map(t => t.overhead.toDouble / t.total)
+
+  override def toString: String = {
+    val jniShare = jniTimeShare.map(s => f"${100 * s}%.2f%%").getOrElse("N/A")
+    f"$workload: $numSteps steps, $stepsPerSecond%.2f steps/sec, $examplesPerSecond%.2f examples/sec, " +
+        f"p50 = ${latencyPercentile(50) / 1e6}%.3f ms, p99 = ${latencyPercentile(99) / 1e6}%.3f ms, " +
+        f"JNI time share = $jniShare, peak native memory = ${peakMemory / (1024.0 * 1024.0)}%.2f MiB" +
+        timings.map(t => s"\n  $t").getOrElse("")
+  }
+
+  /** Returns this result as a JSON object, so that results can be compared across releases. */
+  def toJson: String = {
+    val fields = Seq(
+      "workload" -> s""""$workload"""",
+      "steps" -> numSteps.toString,
+      "examples_per_step" -> examplesPerStep.toString,
+      "steps_per_sec" -> stepsPerSecond.toString,
+      "examples_per_sec" -> examplesPerSecond.toString,
+      "p50_latency_ns" -> latencyPercentile(50).toString,
+      "p99_latency_ns" -> latencyPercentile(99).toString,
+      "jni_time_share" -> jniTimeShare.map(_.toString).getOrElse("null"),
+      "peak_memory_bytes" -> peakMemory.toString) ++
+        timings.toSeq.flatMap(_.durations.map(d => s"timings_${d._1}_ns" -> d._2.toString))
+    fields.map(f => s""""${f._1}": ${f._2}""").mkString("{", ", ", "}")
+  }
+}
+
+object BenchmarkResult {
+  /** Returns the peak number of bytes in use, summed over the distinct allocators in `statistics`. */
+  private[benchmarks] def peakMemory(statistics: Seq[AllocatorStatistics]): Long = {
+    statistics.groupBy(_.allocator).values.map(_.map(_.peakBytesInUse).max).sum
+  }
+}
+
+/** Records the latencies and the run timings of the steps of a benchmark, skipping the first `warmUpSteps` ones.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+private[benchmarks] class StepRecorder(val warmUpSteps: Int) {
+  private[this] val latencies   : ArrayBuffer[Long] = ArrayBuffer.empty[Long]
+  private[this] var numSteps    : Int               = 0
+  private[this] var stepStart   : Long              = 0L
+  private[this] var firstStart  : Long              = 0L
+  private[this] var lastEnd     : Long              = 0L
+  private[this] var timingsSum  : RunTimings        = RunTimings.zero
+  private[this] var numTimedRuns: Long              = 0L
+
+  /** Number of steps recorded so far, including the warm-up steps. */
+  def recordedSteps: Int = numSteps
+
+  def stepStarted(): Unit = {
+    stepStart = System.nanoTime()
+    if (numSteps == warmUpSteps)
+      firstStart = stepStart
+  }
+
+  def stepEnded(timings: Option[RunTimings]): Unit = {
+    val stepEnd = System.nanoTime()
+    numSteps += 1
+    if (numSteps > warmUpSteps) {
+      latencies += stepEnd - stepStart
+      lastEnd = stepEnd
+      timings.foreach(t => {
+        timingsSum += t
+        numTimedRuns += 1
+      })
+    }
+  }
+
+  def result(workload: String, examplesPerStep: Int, peakMemory: Long): BenchmarkResult = {
+    BenchmarkResult(
+      workload = workload,
+      numSteps = latencies.size,
+      examplesPerStep = examplesPerStep,
+      totalTime = if (latencies.isEmpty) 0L else lastEnd - firstStart,
+      stepLatencies = latencies.sorted,
+      timings = if (numTimedRuns > 0) Some(timingsSum / numTimedRuns) else None,
+      peakMemory = peakMemory)
+  }
+}
@@ -0,0 +1,79 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.benchmarks
+
+import com.typesafe.scalalogging.Logger
+import org.slf4j.LoggerFactory
+
+import java.nio.charset.StandardCharsets
+import java.nio.file.{Files, Paths, StandardOpenOption}
+
+/** End-to-end throughput benchmarks for training and inference.
+  *
+  * Each workload is run for a fixed number of steps, after a number of warm-up steps, and the steps per second, the
+  * examples per second, the p50 and p99 step latencies, the share of the `Session.run()` time spent marshalling values
+  * and crossing the JNI boundary, and the peak native memory use are reported. The results can also be appended to a
+  * file as JSON lines, so that they can be compared across releases.
+  *
+  * Usage:
+  * {{{
+  *   Benchmarks --workload (mnist|cifar|ptb|inference) [--steps 1000] [--warmup 100] [--batch-size <size>]
+  *              [--data-dir <dir>] [--graph <file> --input <name> --output <name>] [--json-output <file>]
+  * }}}
+  *
+  * The `mnist`, `cifar`, and `ptb` workloads load their data from `--data-dir` (which defaults to `datasets/MNIST`,
+  * `datasets/CIFAR`, and `datasets/PTB`, respectively), and the `inference` workload uses the frozen graph in
+  * `--graph`, feeding the tensor named `--input` and fetching the one named `--output`.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object Benchmarks {
+  private[this] val logger = Logger(LoggerFactory.getLogger("Benchmarks"))
+
+  def main(args: Array[String]): Unit = {
+    require(args.length % 2 == 0, "Arguments must be provided as '--name value' pairs.")
+    val options = args.grouped(2).map(a => {
+      require(a(0).startsWith("--"), s"Invalid argument name '${a(0)}'.")
+      a(0).drop(2) -> a(1)
+    }).toMap
+    val steps = options.get("steps").map(_.toInt).getOrElse(1000)
+    val warmUpSteps = options.get("warmup").map(_.toInt).getOrElse(100)
+    val batchSize = options.get("batch-size").map(_.toInt)
+    def dataDir(default: String) = Paths.get(options.getOrElse("data-dir", default))
+    val workload = options.get("workload") match {
+      case Some("mnist") => MNISTTraining(dataDir("datasets/MNIST"), batchSize.getOrElse(256))
+      case Some("cifar") => CIFARTraining(dataDir("datasets/CIFAR"), batchSize.getOrElse(64))
+      case Some("ptb") => PTBTraining(dataDir("datasets/PTB"), batchSize.getOrElse(20))
+      case Some("inference") =>
+        def required(name: String) = options.getOrElse(name, throw new IllegalArgumentException(
+          s"Argument '--$name' is required for the 'inference' workload."))
+        FrozenGraphInference(
+          Paths.get(required("graph")), required("input"), required("output"), batchSize.getOrElse(128))
+      case w => throw new IllegalArgumentException(
+        s"Invalid workload '${w.getOrElse("")}'. Supported workloads are 'mnist', 'cifar', 'ptb', and 'inference'.")
+    }
+
+    logger.info(s"Running workload '${workload.name}' for $steps steps, after $warmUpSteps warm-up steps.")
+    val result = workload.run(warmUpSteps, steps)
+    logger.info(result.toString)
+    options.get("json-output").foreach(path => {
+      Files.write(
+        Paths.get(path), (result.toJson + "\n").getBytes(StandardCharsets.UTF_8),
+        StandardOpenOption.CREATE, StandardOpenOption.APPEND)
+      logger.info(s"Wrote the benchmark result to '$path'.")
+    })
+  }
+}
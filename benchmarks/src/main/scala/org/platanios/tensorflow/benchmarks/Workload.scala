@@ -0,0 +1,201 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.benchmarks
+
+import org.platanios.tensorflow.api._
+import org.platanios.tensorflow.api.config.{NoCheckpoints, NoSummaries}
+import org.platanios.tensorflow.api.core.client.Session
+import org.platanios.tensorflow.api.learn.layers.rnn.RNN
+import org.platanios.tensorflow.api.learn.layers.rnn.cell.{BasicLSTMCell, RNNCell}
+import org.platanios.tensorflow.api.ops.NN.SamePadding
+import org.platanios.tensorflow.data.image.{CIFARLoader, MNISTLoader}
+import org.platanios.tensorflow.data.text.PTBLoader
+
+import org.tensorflow.framework.GraphDef
+
+import java.nio.file.{Files, Path}
+
+/** Benchmark workload that executes a fixed number of steps, after a number of warm-up steps that are not measured.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+trait Workload {
+  /** Name of this workload. */
+  val name: String
+
+  /** Number of examples processed in each step. */
+  val batchSize: Int
+
+  /** Runs `warmUpSteps + numSteps` steps of this workload and returns the measurements of the last `numSteps`. */
+  def run(warmUpSteps: Int, numSteps: Int): BenchmarkResult
+}
+
+object Workload {
+  /** Returns a training configuration without checkpoints and summaries, so that only the training steps are
+    * measured. */
+  private[benchmarks] def configuration: tf.learn.Configuration = {
+    tf.learn.Configuration(checkpointConfig = NoCheckpoints, summaryConfig = NoSummaries)
+  }
+}
+
+/** Trains the MNIST multi-layer perceptron of the examples, with data loaded from `dataDir`.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class MNISTTraining(dataDir: Path, batchSize: Int = 256) extends Workload {
+  override val name: String = "MNIST-MLP"
+
+  override def run(warmUpSteps: Int, numSteps: Int): BenchmarkResult = {
+    val dataSet = MNISTLoader.load(dataDir)
+    val trainImages = tf.data.TensorSlicesDataset(dataSet.trainImages)
+    val trainLabels = tf.data.TensorSlicesDataset(dataSet.trainLabels)
+    val trainData = trainImages.zip(trainLabels).repeat().shuffle(10000).batch(batchSize).prefetch(10)
+    val input = tf.learn.Input(UINT8, Shape(-1, dataSet.trainImages.shape(1), dataSet.trainImages.shape(2)))
+    val trainInput = tf.learn.Input(UINT8, Shape(-1))
+    val layer = tf.learn.Flatten() >>
+        tf.learn.Cast(FLOAT32) >>
+        tf.learn.Linear(128, name = "Layer_0") >> tf.learn.ReLU(0.1f) >>
+        tf.learn.Linear(64, name = "Layer_1") >> tf.learn.ReLU(0.1f) >>
+        tf.learn.Linear(32, name = "Layer_2") >> tf.learn.ReLU(0.1f) >>
+        tf.learn.Linear(10, name = "OutputLayer")
+    val trainingInputLayer = tf.learn.Cast(INT64)
+    val loss = tf.learn.SparseSoftmaxCrossEntropy() >> tf.learn.Mean()
+    val optimizer = tf.learn.AdaGrad(0.1)
+    val model = tf.learn.Model(input, layer, trainInput, trainingInputLayer, loss, optimizer)
+    val hook = new BenchmarkHook(warmUpSteps, numSteps)
+    val estimator = tf.learn.InMemoryEstimator(model, Workload.configuration, trainHooks = Set(hook))
+    estimator.train(trainData, tf.learn.StopCriteria(maxSteps = Some(warmUpSteps + numSteps)))
+    hook.result(name, batchSize)
+  }
+}
+
+/** Trains the CIFAR-10 convolutional network of the examples, with data loaded from `dataDir`.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class CIFARTraining(dataDir: Path, batchSize: Int = 64) extends Workload {
+  override val name: String = "CIFAR-CNN"
+
+  override def run(warmUpSteps: Int, numSteps: Int): BenchmarkResult = {
+    val dataSet = CIFARLoader.load(dataDir, CIFARLoader.CIFAR_10)
+    val trainImages = tf.data.TensorSlicesDataset(dataSet.trainImages)
+    val trainLabels = tf.data.TensorSlicesDataset(dataSet.trainLabels)
+    val trainData = trainImages.zip(trainLabels).repeat().shuffle(10000).batch(batchSize).prefetch(10)
+    val input = tf.learn.Input(UINT8, Shape(
+      -1, dataSet.trainImages.shape(1), dataSet.trainImages.shape(2), dataSet.trainImages.shape(3)))
+    val trainInput = tf.learn.Input(UINT8, Shape(-1))
+    val layer = tf.learn.Cast(FLOAT32) >>
+        tf.learn.Conv2D(Shape(2, 2, 3, 16), 1, 1, SamePadding, name = "Conv2D_0") >>
+        tf.learn.AddBias(name = "Bias_0") >>
+        tf.learn.ReLU(0.1f) >>
+        tf.learn.MaxPool(Seq(1, 2, 2, 1), 1, 1, SamePadding, name = "MaxPool_0") >>
+        tf.learn.Conv2D(Shape(2, 2, 16, 32), 1, 1, SamePadding, name = "Conv2D_1") >>
+        tf.learn.AddBias(name = "Bias_1") >>
+        tf.learn.ReLU(0.1f) >>
+        tf.learn.MaxPool(Seq(1, 2, 2, 1), 1, 1, SamePadding, name = "MaxPool_1") >>
+        tf.learn.Flatten() >>
+        tf.learn.Linear(256, name = "Layer_2") >> tf.learn.ReLU(0.1f) >>
+        tf.learn.Linear(10, name = "OutputLayer")
+    val trainingInputLayer = tf.learn.Cast(INT64)
+    val loss = tf.learn.SparseSoftmaxCrossEntropy() >> tf.learn.Mean()
+    val optimizer = tf.learn.AdaGrad(0.1)
+    val model = tf.learn.Model(input, layer, trainInput, trainingInputLayer, loss, optimizer)
+    val hook = new BenchmarkHook(warmUpSteps, numSteps)
+    val estimator = tf.learn.InMemoryEstimator(model, Workload.configuration, trainHooks = Set(hook))
+    estimator.train(trainData, tf.learn.StopCriteria(maxSteps = Some(warmUpSteps + numSteps)))
+    hook.result(name, batchSize)
+  }
+}
+
+/** Trains the PTB LSTM language model of the examples, with data loaded from `dataDir`.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class PTBTraining(
+    dataDir: Path, batchSize: Int = 20, numUnrollSteps: Int = 20, vocabularySize: Int = 10000, numHidden: Int = 200
+) extends Workload {
+  override val name: String = "PTB-LSTM"
+
+  private[this] object RNNOutputLayer extends tf.learn.Layer[RNNCell.LSTMTuple, Output]("RNNOutputLayer") {
+    override val layerType: String = "RNNOutputLayer"
+
+    override def forward(
+        input: RNNCell.LSTMTuple, mode: tf.learn.Mode
+    ): tf.learn.LayerInstance[RNNCell.LSTMTuple, Output] = {
+      val weights = variable("OutputWeights", FLOAT32, Shape(numHidden, vocabularySize))
+      val bias = variable("OutputBias", FLOAT32, Shape(vocabularySize))
+      val output = tf.linear(tf.reshape(input.output, Shape(-1, numHidden)), weights.value, bias.value)
+      val reshapedOutput = tf.reshape(output, Shape(batchSize, numUnrollSteps, vocabularySize))
+      tf.learn.LayerInstance(input, reshapedOutput, trainableVariables = Set(weights, bias))
+    }
+  }
+
+  override def run(warmUpSteps: Int, numSteps: Int): BenchmarkResult = {
+    val dataSet = PTBLoader.load(dataDir)
+    val trainData = PTBLoader.tokensToBatchedTFDataset(dataSet.train, batchSize, numUnrollSteps, "TrainDataset")
+        .repeat()
+        .prefetch(10)
+    val input = tf.learn.Input(INT32, Shape(batchSize, numUnrollSteps))
+    val trainInput = tf.learn.Input(INT32, Shape(batchSize, numUnrollSteps))
+    val rnn = RNN(BasicLSTMCell(numHidden, forgetBias = 0.0f), timeMajor = false)
+    val layer = tf.learn.Embedding(vocabularySize, numHidden, FLOAT32) >> rnn >> RNNOutputLayer
+    val loss = tf.learn.SequenceLoss(averageAcrossTimeSteps = false, averageAcrossBatch = true) >> tf.learn.Sum()
+    val optimizer = tf.learn.GradientDescent(1.0)
+    val model = tf.learn.Model(input, layer, trainInput, loss, optimizer)
+    val hook = new BenchmarkHook(warmUpSteps, numSteps)
+    val estimator = tf.learn.InMemoryEstimator(model, Workload.configuration, trainHooks = Set(hook))
+    estimator.train(trainData, tf.learn.StopCriteria(maxSteps = Some(warmUpSteps + numSteps)))
+    hook.result(name, batchSize)
+  }
+}
+
+/** Runs batch inference using a frozen graph (i.e., a serialized `GraphDef` with all variables converted to constants)
+  * stored in `graphPath`.
+  *
+  * The input placeholder named `input` is fed with a batch of zeros of size `batchSize` and the tensor named `output`
+  * is fetched. All but the first dimension of the input placeholder shape must be known.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+case class FrozenGraphInference(graphPath: Path, input: String, output: String, batchSize: Int = 128)
+    extends Workload {
+  override val name: String = s"Inference-${graphPath.getFileName}"
+
+  override def run(warmUpSteps: Int, numSteps: Int): BenchmarkResult = {
+    val graph = Graph()
+    graph.importGraphDef(GraphDef.parseFrom(Files.readAllBytes(graphPath)))
+    val inputOutput = graph.getOutputByName(input)
+    val outputOutput = graph.getOutputByName(output)
+    require(inputOutput.shape.rank > 0, s"The shape of '$input' must have known, non-zero rank.")
+    val inputShape = Shape.fromSeq(batchSize +: inputOutput.shape.asArray.tail)
+    require(inputShape.isFullyDefined, s"The shape of '$input' (${inputOutput.shape}) must be known, except for the " +
+        "batch dimension.")
+    val batch = Tensor.zeros(inputOutput.dataType, inputShape)
+    val session = Session(graph)
+    val recorder = new StepRecorder(warmUpSteps)
+    try {
+      (0 until warmUpSteps + numSteps).foreach(_ => {
+        recorder.stepStarted()
+        session.run(feeds = Map(inputOutput -> batch), fetches = outputOutput)
+        recorder.stepEnded(Session.lastRunTimings())
+      })
+      recorder.result(name, batchSize, BenchmarkResult.peakMemory(session.allocatorStatistics))
+    } finally {
+      session.close()
+      graph.close()
+    }
+  }
+}
@@ -16,18 +16,13 @@
 package org.platanios.tensorflow.data.image
 
 import org.platanios.tensorflow.api._
+import org.platanios.tensorflow.api.io.FixedLengthRecordDecoder
 import org.platanios.tensorflow.data.Loader
 
 import com.typesafe.scalalogging.Logger
-import org.apache.commons.compress.archivers.tar.{TarArchiveEntry, TarArchiveInputStream}
 import org.slf4j.LoggerFactory
 
-import java.io.ByteArrayOutputStream
-import java.nio.{ByteBuffer, ByteOrder}
-import java.nio.file.{Files, Path}
-import java.util.zip.GZIPInputStream
-
-import scala.language.postfixOps
+import java.nio.file.Path
 
 /**
   * @author Emmanouil Antonios Platanios
@@ -78,50 +73,25 @@ object CIFARLoader extends Loader {
   private[this] def extractFiles(
       path: Path, datasetType: DatasetType = CIFAR_10, bufferSize: Int = 8192): CIFARDataset = {
     logger.info(s"Extracting data from file '$path'.")
-    val inputStream = new TarArchiveInputStream(new GZIPInputStream(Files.newInputStream(path)))
-    var dataset = CIFARDataset(datasetType, null, null, null, null)
-    var entry = inputStream.getNextTarEntry
-    while (entry != null) {
-      if (datasetType.trainFilenames.exists(entry.getName.endsWith(_))) {
-        val (images, labels) = readImagesAndLabels(inputStream, entry, datasetType, bufferSize)
-        val trainImages = {
-          if (dataset.trainImages == null)
-            images
-          else
-            tfi.concatenate(Seq(dataset.trainImages, images), axis = 0)
-        }
-        val trainLabels = {
-          if (dataset.trainLabels == null)
-            labels
-          else
-            tfi.concatenate(Seq(dataset.trainLabels, labels), axis = 0)
-        }
-        dataset = dataset.copy(trainImages = trainImages, trainLabels = trainLabels)
-      } else if (entry.getName.endsWith(datasetType.testFilename)) {
-        val (images, labels) = readImagesAndLabels(inputStream, entry, datasetType, bufferSize)
-        dataset = dataset.copy(testImages = images, testLabels = labels)
-      }
-      entry = inputStream.getNextTarEntry
-    }
-    inputStream.close()
-    dataset
-  }
-
-  private[this] def readImagesAndLabels(
-      inputStream: TarArchiveInputStream, entry: TarArchiveEntry,
-      datasetType: DatasetType = CIFAR_10, bufferSize: Int = 8192): (Tensor, Tensor) = {
-    val outputStream = new ByteArrayOutputStream()
-    val buffer = new Array[Byte](bufferSize)
-    Stream.continually(inputStream.read(buffer)).takeWhile(_ != -1).foreach(outputStream.write(buffer, 0, _))
-    val byteBuffer = ByteBuffer.wrap(outputStream.toByteArray).order(ByteOrder.BIG_ENDIAN)
-    outputStream.close()
-    val numSamples = entry.getSize.toInt / datasetType.entryByteSize
-    val combinedShape = Shape(numSamples, datasetType.entryByteSize)
-    val combined = Tensor.fromBuffer(UINT8, combinedShape, entry.getSize.toInt, byteBuffer)
-    datasetType match {
-      case CIFAR_10 => (combined(::, 1 ::).reshape(Shape(-1, 32, 32, 3)), combined(::, 0))
-      case CIFAR_100 => (combined(::, 2 ::).reshape(Shape(-1, 32, 32, 3)), combined(::, 0 :: 2))
+    // The images are stored in channels-first order and are decoded into channels-last order.
+    val numLabelBytes = datasetType.entryByteSize - 3072
+    val fields = Seq(
+      FixedLengthRecordDecoder.Field(numLabelBytes, Shape(3, 32, 32), permutation = Seq(1, 2, 0)),
+      datasetType match {
+        case CIFAR_10 => FixedLengthRecordDecoder.Field(0, Shape())
+        case CIFAR_100 => FixedLengthRecordDecoder.Field(0, Shape(2))
+      })
+    val entries = FixedLengthRecordDecoder.decode(
+      path, datasetType.trainFilenames :+ datasetType.testFilename, headerBytes = 0,
+      recordBytes = datasetType.entryByteSize, fields = fields, gzip = true)
+    val trainEntries = entries.init
+    val (trainImages, trainLabels) = {
+      if (trainEntries.size == 1)
+        (trainEntries.head(0), trainEntries.head(1))
+      else
+        (tfi.concatenate(trainEntries.map(_ (0)), axis = 0), tfi.concatenate(trainEntries.map(_ (1)), axis = 0))
     }
+    CIFARDataset(datasetType, trainImages, trainLabels, entries.last(0), entries.last(1))
   }
 }
 
@@ -16,13 +16,13 @@
 package org.platanios.tensorflow.data.image
 
 import org.platanios.tensorflow.api._
+import org.platanios.tensorflow.api.io.FixedLengthRecordDecoder
 import org.platanios.tensorflow.data.Loader
 
 import com.typesafe.scalalogging.Logger
 import org.slf4j.LoggerFactory
 
-import java.io.ByteArrayOutputStream
-import java.nio.{ByteBuffer, ByteOrder}
+import java.io.DataInputStream
 import java.nio.file.{Files, Path}
 import java.util.zip.GZIPInputStream
 
@@ -79,44 +79,32 @@ object MNISTLoader extends Loader {
 
   private[this] def extractImages(path: Path, bufferSize: Int = 8192): Tensor = {
     logger.info(s"Extracting images from file '$path'.")
-    val inputStream = new GZIPInputStream(Files.newInputStream(path))
-    val outputStream = new ByteArrayOutputStream()
-    val buffer = new Array[Byte](bufferSize)
-    Stream.continually(inputStream.read(buffer)).takeWhile(_ != -1).foreach(outputStream.write(buffer, 0, _))
-    val byteBuffer = ByteBuffer.wrap(outputStream.toByteArray).order(ByteOrder.BIG_ENDIAN)
-    outputStream.close()
-    inputStream.close()
-    val magicNumber = (byteBuffer.getInt & 0xffffffffL).toInt
-    if (magicNumber != 2051)
-      throw new IllegalStateException(s"Invalid magic number '$magicNumber' in MNIST image file '$path'.")
-    val numberOfImages = (byteBuffer.getInt & 0xffffffffL).toInt
-    val numberOfRows = (byteBuffer.getInt & 0xffffffffL).toInt
-    val numberOfColumns = (byteBuffer.getInt & 0xffffffffL).toInt
-    val numBytes = byteBuffer.limit() - 16
-    val tensor = Tensor.fromBuffer(UINT8, Shape(numberOfImages, numberOfRows, numberOfColumns), numBytes, byteBuffer)
-    outputStream.close()
-    inputStream.close()
-    tensor
+    val header = readHeader(path, 4)
+    if (header(0) != 2051)
+      throw new IllegalStateException(s"Invalid magic number '${header(0)}' in MNIST image file '$path'.")
+    val numberOfRows = header(2)
+    val numberOfColumns = header(3)
+    val field = FixedLengthRecordDecoder.Field(0, Shape(numberOfRows, numberOfColumns))
+    FixedLengthRecordDecoder.decode(path, 16, numberOfRows * numberOfColumns, Seq(field), gzip = true).head
   }
 
   private[this] def extractLabels(path: Path, bufferSize: Int = 8192): Tensor = {
     logger.info(s"Extracting labels from file '$path'.")
-    val inputStream = new GZIPInputStream(Files.newInputStream(path))
-    val outputStream = new ByteArrayOutputStream()
-    val buffer = new Array[Byte](bufferSize)
-    Stream.continually(inputStream.read(buffer)).takeWhile(_ != -1).foreach(outputStream.write(buffer, 0, _))
-    val byteBuffer = ByteBuffer.wrap(outputStream.toByteArray).order(ByteOrder.BIG_ENDIAN)
-    outputStream.close()
-    inputStream.close()
-    val magicNumber = (byteBuffer.getInt & 0xffffffffL).toInt
-    if (magicNumber != 2049)
-      throw new IllegalStateException(s"Invalid magic number '$magicNumber' in MNIST labels file '$path'.")
-    val numberOfLabels = (byteBuffer.getInt & 0xffffffffL).toInt
-    val numBytes = byteBuffer.limit() - 8
-    val tensor = Tensor.fromBuffer(UINT8, Shape(numberOfLabels), numBytes, byteBuffer)
-    outputStream.close()
-    inputStream.close()
-    tensor
+    val header = readHeader(path, 2)
+    if (header(0) != 2049)
+      throw new IllegalStateException(s"Invalid magic number '${header(0)}' in MNIST labels file '$path'.")
+    val field = FixedLengthRecordDecoder.Field(0, Shape())
+    FixedLengthRecordDecoder.decode(path, 8, 1, Seq(field), gzip = true).head
+  }
+
+  /** Reads the first `numIntegers` big-endian integers of the header of the GZIP-compressed file at `path`. */
+  private[this] def readHeader(path: Path, numIntegers: Int): Seq[Int] = {
+    val inputStream = new DataInputStream(new GZIPInputStream(Files.newInputStream(path)))
+    try {
+      Seq.fill(numIntegers)(inputStream.readInt())
+    } finally {
+      inputStream.close()
+    }
   }
 }
 
@@ -16,16 +16,13 @@
 package org.platanios.tensorflow.data.image
 
 import org.platanios.tensorflow.api._
+import org.platanios.tensorflow.api.io.FixedLengthRecordDecoder
 import org.platanios.tensorflow.data.Loader
 
 import com.typesafe.scalalogging.Logger
-import org.apache.commons.compress.archivers.tar._
 import org.slf4j.LoggerFactory
 
-import java.io.ByteArrayOutputStream
-import java.nio.{ByteBuffer, ByteOrder}
-import java.nio.file.{Files, Path}
-import java.util.zip.GZIPInputStream
+import java.nio.file.Path
 
 /**
   * @author Emmanouil Antonios Platanios
@@ -60,66 +57,24 @@ object STL10Loader extends Loader {
 
   private[this] def extractFiles(path: Path, bufferSize: Int = 8192, loadUnlabeled: Boolean = true): STL10Dataset = {
     logger.info(s"Extracting data from file '$path'.")
-    val inputStream = new TarArchiveInputStream(new GZIPInputStream(Files.newInputStream(path)))
-    var dataset = STL10Dataset(null, null, null, null, null)
-    var entry = inputStream.getNextTarEntry
-    while (entry != null) {
-      if (entry.getName == unlabeledImagesFilename) {
-        if (loadUnlabeled) {
-          // TODO: Make this more efficient.
-          // We have to split this tensor in two parts because its size exceeds the maximum allowed byte buffer size.
-          val halfShape = Shape(numUnlabeled / 2, imageChannels, imageHeight, imageWidth)
-          var outputStream = new ByteArrayOutputStream()
-          val buffer = new Array[Byte](bufferSize)
-          var numBytesRead = 0
-          Stream.continually(inputStream.read(buffer))
-              .takeWhile(_ => numBytesRead <= entry.getSize / 2)
-              .foreach(numBytes => {
-                outputStream.write(buffer, 0, numBytes)
-                numBytesRead += numBytes
-              })
-          var byteBuffer = ByteBuffer.wrap(outputStream.toByteArray).order(ByteOrder.BIG_ENDIAN)
-          outputStream.close()
-          val tensor1 =
-            Tensor.fromBuffer(UINT8, halfShape, byteBuffer.capacity(), byteBuffer).transpose(Tensor(0, 3, 2, 1))
-          outputStream = new ByteArrayOutputStream()
-          Stream.continually(inputStream.read(buffer)).takeWhile(_ != -1).foreach(outputStream.write(buffer, 0, _))
-          byteBuffer = ByteBuffer.wrap(outputStream.toByteArray).order(ByteOrder.BIG_ENDIAN)
-          outputStream.close()
-          val tensor2 =
-            Tensor.fromBuffer(UINT8, halfShape, byteBuffer.capacity(), byteBuffer).transpose(Tensor(0, 3, 2, 1))
-          dataset = dataset.copy(unlabeledImages = tfi.concatenate(Seq(tensor1, tensor2), axis = 0))
-        }
-      } else if (Set(
-        trainImagesFilename, trainLabelsFilename,
-        testImagesFilename, testLabelsFilename).contains(entry.getName)) {
-        val outputStream = new ByteArrayOutputStream(entry.getSize.toInt)
-        val buffer = new Array[Byte](bufferSize)
-        Stream.continually(inputStream.read(buffer)).takeWhile(_ != -1).foreach(outputStream.write(buffer, 0, _))
-        val byteBuffer = ByteBuffer.wrap(outputStream.toByteArray).order(ByteOrder.BIG_ENDIAN)
-        outputStream.close()
-        entry.getName match {
-          case name if name == trainImagesFilename =>
-            val shape = Shape(numTrain, imageChannels, imageHeight, imageWidth)
-            val tensor = Tensor.fromBuffer(UINT8, shape, entry.getSize, byteBuffer).transpose(Tensor(0, 3, 2, 1))
-            dataset = dataset.copy(trainImages = tensor)
-          case name if name == trainLabelsFilename =>
-            val tensor = Tensor.fromBuffer(UINT8, Shape(numTrain), entry.getSize, byteBuffer) - Tensor(UINT8, 1)
-            dataset = dataset.copy(trainLabels = tensor)
-          case name if name == testImagesFilename =>
-            val shape = Shape(numTest, imageChannels, imageHeight, imageWidth)
-            val tensor = Tensor.fromBuffer(UINT8, shape, entry.getSize, byteBuffer).transpose(Tensor(0, 3, 2, 1))
-            dataset = dataset.copy(testImages = tensor)
-          case name if name == testLabelsFilename =>
-            val tensor = Tensor.fromBuffer(UINT8, Shape(numTest), entry.getSize, byteBuffer) - Tensor(UINT8, 1)
-            dataset = dataset.copy(testLabels = tensor)
-          case _ => ()
-        }
-      }
-      entry = inputStream.getNextTarEntry
+    // The images are stored in (channels, height, width) order and are decoded into (width, height, channels) order.
+    // The labels are stored in [1, 10] and are decoded into [0, 9].
+    val imageFilenames = {
+      if (loadUnlabeled)
+        Seq(trainImagesFilename, testImagesFilename, unlabeledImagesFilename)
+      else
+        Seq(trainImagesFilename, testImagesFilename)
     }
-    inputStream.close()
-    dataset
+    val imageField = FixedLengthRecordDecoder.Field(
+      0, Shape(imageChannels, imageHeight, imageWidth), permutation = Seq(2, 1, 0))
+    val images = FixedLengthRecordDecoder.decode(
+      path, imageFilenames, headerBytes = 0, recordBytes = imageChannels * imageHeight * imageWidth,
+      fields = Seq(imageField), gzip = true).map(_.head)
+    val labelField = FixedLengthRecordDecoder.Field(0, Shape(), shift = -1.0f)
+    val labels = FixedLengthRecordDecoder.decode(
+      path, Seq(trainLabelsFilename, testLabelsFilename), headerBytes = 0, recordBytes = 1,
+      fields = Seq(labelField), gzip = true).map(_.head)
+    STL10Dataset(images(0), labels(0), images(1), labels(1), if (loadUnlabeled) images(2) else null)
   }
 }
 
@@ -16,22 +16,23 @@
 package org.platanios.tensorflow.data.text
 
 import org.platanios.tensorflow.api._
+import org.platanios.tensorflow.api.io.CorpusLoader
 import org.platanios.tensorflow.data.Loader
 
 import com.typesafe.scalalogging.Logger
 import org.apache.commons.compress.archivers.tar._
 import org.slf4j.LoggerFactory
 
-import java.io.{BufferedReader, InputStream, InputStreamReader}
-import java.nio.charset.StandardCharsets
 import java.nio.file.{Files, Path, Paths}
 import java.util.zip.GZIPInputStream
 
-import scala.collection.mutable
-
 /** Loader for the PTB raw data from
   * [Tomas Mikolov's website](http://www.fit.vutbr.cz/~imikolov/rnnlm/simple-examples.tgz).
   *
+  * The text files are extracted next to the downloaded archive and they are then loaded natively, using
+  * [[CorpusLoader]], which tokenizes them in parallel and returns their token IDs as contiguous `INT32` tensors. The
+  * end of each line is marked by an `<eos>` token.
+  *
   * @author Emmanouil Antonios Platanios
   */
 object PTBLoader extends Loader {
@@ -59,6 +60,15 @@ object PTBLoader extends Loader {
       batchSize: Int,
       numSteps: Int,
       name: String
+  ): tf.data.Dataset[(Tensor, Tensor), (Output, Output), (DataType, DataType), (Shape, Shape)] = {
+    tokensToBatchedTFDataset(Tensor(tokens.head, tokens.tail: _*), batchSize, numSteps, name)
+  }
+
+  def tokensToBatchedTFDataset(
+      tokens: Tensor,
+      batchSize: Int,
+      numSteps: Int,
+      name: String
   ): tf.data.Dataset[(Tensor, Tensor), (Output, Output), (DataType, DataType), (Shape, Shape)] = {
     tf.createWithNameScope(name) {
       tf.data.fromGenerator[(Tensor, Tensor), (Output, Output), (DataType, DataType), (Shape, Shape)](
@@ -69,12 +79,15 @@ object PTBLoader extends Loader {
   }
 
   def tokensToBatchIterable(tokens: Seq[Int], batchSize: Int, numSteps: Int): Iterable[(Tensor, Tensor)] = {
+    tokensToBatchIterable(Tensor(tokens.head, tokens.tail: _*), batchSize, numSteps)
+  }
+
+  def tokensToBatchIterable(tokens: Tensor, batchSize: Int, numSteps: Int): Iterable[(Tensor, Tensor)] = {
     new Iterable[(Tensor, Tensor)] {
       override def iterator: Iterator[(Tensor, Tensor)] = new Iterator[(Tensor, Tensor)] {
-        private val tokensTensor = Tensor(tokens.head, tokens.tail: _*)
-        private val numTokens    = tokens.size
+        private val numTokens    = tokens.shape(0)
         private val batchLength  = numTokens / batchSize
-        private val data         = tokensTensor(0 :: batchSize * batchLength).reshape(Shape(batchSize, batchLength))
+        private val data         = tokens(0 :: batchSize * batchLength).reshape(Shape(batchSize, batchLength))
         private val numEpochs    = (batchLength - 1) / numSteps
 
         if (numEpochs <= 0)
@@ -96,53 +109,36 @@ object PTBLoader extends Loader {
   }
 
   private[this] def extractData(path: Path, bufferSize: Int = 8192): PTBDataset = {
-    logger.info(s"Extracting data from file '$path'.")
-    val inputStream = new TarArchiveInputStream(new GZIPInputStream(Files.newInputStream(path)))
-    var trainTokens: Seq[String] = null
-    var validTokens: Seq[String] = null
-    var testTokens: Seq[String] = null
-    var entry = inputStream.getNextTarEntry
-    while (entry != null) {
-      entry.getName match {
-        case f if f == dataPath + trainFilename => trainTokens = readTokens(inputStream)
-        case f if f == dataPath + validFilename => validTokens = readTokens(inputStream)
-        case f if f == dataPath + testFilename => testTokens = readTokens(inputStream)
-        case _ => ()
+    val filenames = Seq(trainFilename, validFilename, testFilename)
+    val files = filenames.map(filename => path.resolveSibling(dataPath + filename).normalize())
+    if (!files.forall(Files.exists(_))) {
+      logger.info(s"Extracting data from file '$path'.")
+      val inputStream = new TarArchiveInputStream(new GZIPInputStream(Files.newInputStream(path), bufferSize))
+      var entry = inputStream.getNextTarEntry
+      while (entry != null) {
+        val index = filenames.indexWhere(filename => entry.getName == dataPath + filename)
+        if (index >= 0) {
+          Files.createDirectories(files(index).getParent)
+          Files.deleteIfExists(files(index))
+          Files.copy(inputStream, files(index))
+        }
+        entry = inputStream.getNextTarEntry
       }
-      entry = inputStream.getNextTarEntry
-    }
-    inputStream.close()
-    val vocabulary = buildVocabulary(trainTokens ++ validTokens ++ testTokens)
-    val trainIds = trainTokens.filter(vocabulary.contains).map(vocabulary)
-    val validIds = validTokens.filter(vocabulary.contains).map(vocabulary)
-    val testIds = testTokens.filter(vocabulary.contains).map(vocabulary)
-    PTBDataset(trainIds, validIds, testIds, for ((k, v) <- vocabulary) yield (v, k))
-  }
-
-  private[this] def readTokens(inputStream: InputStream): Seq[String] = {
-    val reader = new BufferedReader(new InputStreamReader(inputStream, StandardCharsets.UTF_8))
-    val tokens = mutable.ListBuffer.empty[String]
-    var line = reader.readLine()
-    while (line != null) {
-      tokens ++= line.replace("\n", "<eos>").split("\\s+").toSeq
-      line = reader.readLine()
+      inputStream.close()
     }
-    tokens
-  }
-
-  private[this] def buildVocabulary(tokens: Seq[String]): Map[String, Int] = {
-    val counts = tokens.groupBy(identity).mapValues(_.size)
-    val sorted = counts.toSeq.sortBy(-_._2)
-    sorted.map(_._1).zipWithIndex.toMap
+    val corpus = CorpusLoader.load(files, endOfLineToken = Some("<eos>"))
+    PTBDataset(corpus.fileIds(0), corpus.fileIds(1), corpus.fileIds(2), corpus.vocabulary)
   }
 
   def main(args: Array[String]): Unit = {
     val dataSet = PTBLoader.load(Paths.get(args(0)))
-    println(s"Number of tokens: ${dataSet.vocabulary.size}")
-    println(s"Number of train tokens: ${dataSet.train.size}")
-    println(s"Number of validation tokens: ${dataSet.validation.size}")
-    println(s"Number of test tokens: ${dataSet.test.size}")
+    println(s"Number of tokens: ${dataSet.vocabulary.shape(0)}")
+    println(s"Number of train tokens: ${dataSet.train.shape(0)}")
+    println(s"Number of validation tokens: ${dataSet.validation.shape(0)}")
+    println(s"Number of test tokens: ${dataSet.test.shape(0)}")
   }
 }
 
-case class PTBDataset(train: Seq[Int], validation: Seq[Int], test: Seq[Int], vocabulary: Map[Int, String])
+/** PTB dataset, where `train`, `validation`, and `test` are `INT32` tensors with token IDs and `vocabulary` is a
+  * `STRING` tensor containing the token with each ID, sorted by decreasing frequency. */
+case class PTBDataset(train: Tensor, validation: Tensor, test: Tensor, vocabulary: Tensor)
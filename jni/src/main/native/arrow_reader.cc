@@ -0,0 +1,101 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "arrow_reader.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensorflow/c/arrow_reader.h"
+#include "tensorflow/c/c_api.h"
+
+namespace {
+// Copies the provided Java string array to a vector of strings.
+std::vector<std::string> to_strings(JNIEnv* env, jobjectArray array) {
+  std::vector<std::string> strings;
+  const jsize length = env->GetArrayLength(array);
+  for (jsize i = 0; i < length; ++i) {
+    jstring string = static_cast<jstring>(env->GetObjectArrayElement(array, i));
+    const char* c_string = env->GetStringUTFChars(string, nullptr);
+    strings.emplace_back(c_string);
+    env->ReleaseStringUTFChars(string, c_string);
+    env->DeleteLocalRef(string);
+  }
+  return strings;
+}
+}  // namespace
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_newArrowReader(
+    JNIEnv* env, jobject object, jstring filename, jobjectArray columns, jobjectArray predicate_columns,
+    jdoubleArray predicate_mins, jdoubleArray predicate_maxs) {
+  const std::vector<std::string> c_columns = to_strings(env, columns);
+  const std::vector<std::string> c_predicate_columns = to_strings(env, predicate_columns);
+  const jsize num_predicates = static_cast<jsize>(c_predicate_columns.size());
+  std::vector<jdouble> mins(static_cast<size_t>(num_predicates));
+  std::vector<jdouble> maxs(static_cast<size_t>(num_predicates));
+  env->GetDoubleArrayRegion(predicate_mins, 0, num_predicates, mins.data());
+  env->GetDoubleArrayRegion(predicate_maxs, 0, num_predicates, maxs.data());
+  std::vector<tensorflow::ArrowRangePredicate> predicates;
+  for (jsize i = 0; i < num_predicates; ++i)
+    predicates.push_back({c_predicate_columns[i], static_cast<double>(mins[i]), static_cast<double>(maxs[i])});
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* reader = tensorflow::ArrowReader::New(std::string(c_filename), c_columns, predicates, status.get());
+  env->ReleaseStringUTFChars(filename, c_filename);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(reader);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_arrowReaderNumRecordBatches(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::ArrowReader, reader_handle, 0);
+  return static_cast<jlong>(reader->num_record_batches());
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_arrowReaderNumRows(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::ArrowReader, reader_handle, 0);
+  return static_cast<jlong>(reader->num_rows());
+}
+
+JNIEXPORT jintArray JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_arrowReaderDataTypes(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::ArrowReader, reader_handle, nullptr);
+  const std::vector<TF_DataType> dtypes = reader->dtypes();
+  std::vector<jint> c_dtypes(dtypes.begin(), dtypes.end());
+  jintArray dtypes_array = env->NewIntArray(static_cast<jsize>(c_dtypes.size()));
+  env->SetIntArrayRegion(dtypes_array, 0, static_cast<jsize>(c_dtypes.size()), c_dtypes.data());
+  return dtypes_array;
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_arrowReaderReadRecordBatch(
+    JNIEnv* env, jobject object, jlong reader_handle, jlong index) {
+  REQUIRE_HANDLE(reader, tensorflow::ArrowReader, reader_handle, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<TF_Tensor*> batch;
+  reader->ReadRecordBatch(static_cast<tensorflow::int64>(index), &batch, status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  if (batch.empty()) return nullptr;
+  return tensors_to_tensor_handles(env, batch);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_deleteArrowReader(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::ArrowReader, reader_handle, void());
+  delete reader;
+}
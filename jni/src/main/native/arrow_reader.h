@@ -0,0 +1,61 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_ArrowReader__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_ArrowReader__
+#define _Included_org_platanios_tensorflow_jni_ArrowReader__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_ArrowReader__
+ * Method:    newArrowReader
+ * Signature: (Ljava/lang/String;[Ljava/lang/String;[Ljava/lang/String;[D[D)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_newArrowReader
+  (JNIEnv *, jobject, jstring, jobjectArray, jobjectArray, jdoubleArray, jdoubleArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_ArrowReader__
+ * Method:    arrowReaderNumRecordBatches
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_arrowReaderNumRecordBatches
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_ArrowReader__
+ * Method:    arrowReaderNumRows
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_arrowReaderNumRows
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_ArrowReader__
+ * Method:    arrowReaderDataTypes
+ * Signature: (J)[I
+ */
+JNIEXPORT jintArray JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_arrowReaderDataTypes
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_ArrowReader__
+ * Method:    arrowReaderReadRecordBatch
+ * Signature: (JJ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_arrowReaderReadRecordBatch
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_ArrowReader__
+ * Method:    deleteArrowReader
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_ArrowReader_00024_deleteArrowReader
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,367 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+// Microbenchmarks for the hot paths of the JNI bindings. The JNI functions are linked into this executable and invoked
+// directly, using an embedded JVM, and so these benchmarks measure the cost of the native side of each call (i.e., the
+// marshalling of arguments and results over JNI and the corresponding TensorFlow C API calls), without the overhead of
+// the Scala API. The embedded JVM is created using the class path provided in the "TF_SCALA_BENCHMARK_CLASSPATH"
+// environment variable, which must contain the classes of the "jni" module and its dependencies (e.g., the output of
+// `sbt "export jni/runtime:fullClasspath"`).
+//
+// The results can be written in JSON format, for tracking regressions, using the standard Google Benchmark flags:
+//   tensorflow_jni_benchmarks --benchmark_out=results.json --benchmark_out_format=json
+
+#include <jni.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "record_reader.h"
+#include "session.h"
+#include "tensor.h"
+#include "tensor_math_ops.h"
+#include "tensorflow.h"
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/io/record_writer.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace {
+  JavaVM* jvm = nullptr;
+  JNIEnv* env = nullptr;
+
+  // Returns true if a JVM exception is pending, in which case it is cleared and the benchmark is marked as failed.
+  bool HandleException(benchmark::State& state) {
+    if (!env->ExceptionCheck()) return false;
+    env->ExceptionDescribe();
+    env->ExceptionClear();
+    state.SkipWithError("A JVM exception was thrown.");
+    return true;
+  }
+
+  jlongArray NewLongArray(const std::vector<jlong>& values) {
+    jlongArray array = env->NewLongArray(static_cast<jsize>(values.size()));
+    env->SetLongArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+    return array;
+  }
+
+  jintArray NewIntArray(const std::vector<jint>& values) {
+    jintArray array = env->NewIntArray(static_cast<jsize>(values.size()));
+    env->SetIntArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+    return array;
+  }
+
+  TF_Tensor* NewFloatTensor(const std::vector<int64_t>& shape, float value) {
+    int64_t num_elements = 1;
+    for (int64_t dim : shape) num_elements *= dim;
+    TF_Tensor* tensor = TF_AllocateTensor(
+        TF_FLOAT, shape.data(), static_cast<int>(shape.size()), static_cast<size_t>(num_elements) * sizeof(float));
+    float* data = static_cast<float*>(TF_TensorData(tensor));
+    for (int64_t i = 0; i < num_elements; ++i) data[i] = value;
+    return tensor;
+  }
+}  // namespace
+
+// Tensor allocation and deallocation, for tensor sizes ranging from a scalar to 4 MB.
+static void BM_TensorAllocateDelete(benchmark::State& state) {
+  const jlong num_bytes = state.range(0);
+  jlongArray shape = NewLongArray({num_bytes / static_cast<jlong>(sizeof(float))});
+  while (state.KeepRunning()) {
+    jlong handle = Java_org_platanios_tensorflow_jni_Tensor_00024_allocate(
+        env, nullptr, TF_FLOAT, shape, num_bytes, JNI_FALSE);
+    Java_org_platanios_tensorflow_jni_Tensor_00024_delete(env, nullptr, handle);
+  }
+  HandleException(state);
+  env->DeleteLocalRef(shape);
+}
+BENCHMARK(BM_TensorAllocateDelete)->Arg(4)->Arg(4 << 10)->Arg(4 << 20);
+
+// Tensor creation from a direct JVM buffer (which copies the buffer contents) and deallocation.
+static void BM_TensorFromBufferDelete(benchmark::State& state) {
+  const jlong num_bytes = state.range(0);
+  jlongArray shape = NewLongArray({num_bytes / static_cast<jlong>(sizeof(float))});
+  std::unique_ptr<char[]> data(new char[static_cast<size_t>(num_bytes)]());
+  jobject buffer = env->NewDirectByteBuffer(data.get(), num_bytes);
+  while (state.KeepRunning()) {
+    jlong handle = Java_org_platanios_tensorflow_jni_Tensor_00024_fromBuffer(
+        env, nullptr, TF_FLOAT, shape, num_bytes, buffer, JNI_FALSE);
+    Java_org_platanios_tensorflow_jni_Tensor_00024_delete(env, nullptr, handle);
+  }
+  HandleException(state);
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_bytes);
+  env->DeleteLocalRef(buffer);
+  env->DeleteLocalRef(shape);
+}
+BENCHMARK(BM_TensorFromBufferDelete)->Arg(4)->Arg(4 << 10)->Arg(4 << 20);
+
+// Session run of a small graph that feeds a number of scalar placeholders and fetches their sum, which mostly measures
+// the per-run and per-feed overhead.
+static void BM_SessionRun(benchmark::State& state) {
+  const int num_feeds = static_cast<int>(state.range(0));
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Graph* graph = TF_NewGraph();
+  std::vector<TF_Output> placeholders;
+  for (int i = 0; i < num_feeds; ++i) {
+    TF_OperationDescription* description = TF_NewOperation(
+        graph, "Placeholder", ("Placeholder_" + std::to_string(i)).c_str());
+    TF_SetAttrType(description, "dtype", TF_FLOAT);
+    placeholders.push_back({TF_FinishOperation(description, status.get()), 0});
+  }
+  TF_OperationDescription* description = TF_NewOperation(graph, "AddN", "Sum");
+  TF_AddInputList(description, placeholders.data(), num_feeds);
+  TF_Operation* sum = TF_FinishOperation(description, status.get());
+  if (TF_GetCode(status.get()) != TF_OK) {
+    state.SkipWithError(TF_Message(status.get()));
+    TF_DeleteGraph(graph);
+    return;
+  }
+
+  jlong session = Java_org_platanios_tensorflow_jni_Session_00024_allocate(
+      env, nullptr, reinterpret_cast<jlong>(graph), nullptr, nullptr, nullptr, -1);
+  if (HandleException(state)) {
+    TF_DeleteGraph(graph);
+    return;
+  }
+
+  std::vector<TF_Tensor*> inputs;
+  std::vector<jlong> input_tensor_handles, input_op_handles;
+  std::vector<jint> input_op_indices;
+  for (int i = 0; i < num_feeds; ++i) {
+    inputs.push_back(NewFloatTensor({}, 1.0f));
+    input_tensor_handles.push_back(reinterpret_cast<jlong>(inputs.back()));
+    input_op_handles.push_back(reinterpret_cast<jlong>(placeholders[i].oper));
+    input_op_indices.push_back(0);
+  }
+  jlongArray j_input_tensor_handles = NewLongArray(input_tensor_handles);
+  jlongArray j_input_op_handles = NewLongArray(input_op_handles);
+  jintArray j_input_op_indices = NewIntArray(input_op_indices);
+  jlongArray j_output_op_handles = NewLongArray({reinterpret_cast<jlong>(sum)});
+  jintArray j_output_op_indices = NewIntArray({0});
+  jlongArray j_target_op_handles = NewLongArray({});
+  jlongArray j_output_tensor_handles = env->NewLongArray(1);
+
+  while (state.KeepRunning()) {
+    Java_org_platanios_tensorflow_jni_Session_00024_run(
+        env, nullptr, session, nullptr, j_input_tensor_handles, j_input_op_handles, j_input_op_indices,
+        j_output_op_handles, j_output_op_indices, j_target_op_handles, JNI_FALSE, j_output_tensor_handles, nullptr);
+    if (HandleException(state)) break;
+    jlong output;
+    env->GetLongArrayRegion(j_output_tensor_handles, 0, 1, &output);
+    TF_DeleteTensor(reinterpret_cast<TF_Tensor*>(output));
+  }
+
+  env->DeleteLocalRef(j_output_tensor_handles);
+  env->DeleteLocalRef(j_target_op_handles);
+  env->DeleteLocalRef(j_output_op_indices);
+  env->DeleteLocalRef(j_output_op_handles);
+  env->DeleteLocalRef(j_input_op_indices);
+  env->DeleteLocalRef(j_input_op_handles);
+  env->DeleteLocalRef(j_input_tensor_handles);
+  for (TF_Tensor* input : inputs) TF_DeleteTensor(input);
+  Java_org_platanios_tensorflow_jni_Session_00024_delete(env, nullptr, session);
+  TF_DeleteGraph(graph);
+}
+BENCHMARK(BM_SessionRun)->Arg(1)->Arg(8)->Arg(64);
+
+// Eager dispatch of the generated "Math.add" op, on scalars (which measures the dispatch overhead) and on large
+// tensors with the provided number of elements.
+static void BM_EagerAdd(benchmark::State& state) {
+  const int64_t num_elements = state.range(0);
+  jlong context = Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocateContext(
+      env, nullptr, nullptr, JNI_FALSE, nullptr, -1);
+  if (HandleException(state)) return;
+  const std::vector<int64_t> shape = num_elements == 1 ? std::vector<int64_t>() : std::vector<int64_t>{num_elements};
+  TF_Tensor* x = NewFloatTensor(shape, 1.0f);
+  TF_Tensor* y = NewFloatTensor(shape, 2.0f);
+  jlong x_handle = Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocate(
+      env, nullptr, reinterpret_cast<jlong>(x));
+  jlong y_handle = Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocate(
+      env, nullptr, reinterpret_cast<jlong>(y));
+  while (state.KeepRunning()) {
+    jlong result = Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_add(
+        env, nullptr, context, x_handle, y_handle);
+    if (HandleException(state)) break;
+    Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDelete(env, nullptr, result);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_elements);
+  Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDelete(env, nullptr, y_handle);
+  Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDelete(env, nullptr, x_handle);
+  TF_DeleteTensor(y);
+  TF_DeleteTensor(x);
+  Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDeleteContext(env, nullptr, context);
+}
+BENCHMARK(BM_EagerAdd)->Arg(1)->Arg(1 << 20);
+
+// Reading records of the provided size from an uncompressed TFRecord file, including the copy of each record into a
+// JVM byte array.
+static void BM_RecordReaderWrapperGetNext(benchmark::State& state) {
+  const int64_t record_size = state.range(0);
+  const int num_records = 1024;
+  tensorflow::Env* tf_env = tensorflow::Env::Default();
+  std::string filename;
+  if (!tf_env->LocalTempFilename(&filename)) {
+    state.SkipWithError("Could not create a temporary file.");
+    return;
+  }
+  {
+    std::unique_ptr<tensorflow::WritableFile> file;
+    TF_CHECK_OK(tf_env->NewWritableFile(filename, &file));
+    tensorflow::io::RecordWriter writer(file.get());
+    const std::string record(static_cast<size_t>(record_size), 'x');
+    for (int i = 0; i < num_records; ++i) TF_CHECK_OK(writer.WriteRecord(record));
+    TF_CHECK_OK(writer.Close());
+    TF_CHECK_OK(file->Close());
+  }
+
+  jstring j_filename = env->NewStringUTF(filename.c_str());
+  jstring j_compression_type = env->NewStringUTF("");
+  jlong reader = 0;
+  int num_read = num_records;
+  while (state.KeepRunning()) {
+    if (num_read == num_records) {
+      // The file is reopened once all of its records have been read, which is not included in the measurements.
+      state.PauseTiming();
+      if (reader != 0)
+        Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteRecordReaderWrapper(env, nullptr, reader);
+      reader = Java_org_platanios_tensorflow_jni_RecordReader_00024_newRecordReaderWrapper(
+          env, nullptr, j_filename, j_compression_type, 0);
+      num_read = 0;
+      state.ResumeTiming();
+    }
+    jbyteArray record = Java_org_platanios_tensorflow_jni_RecordReader_00024_recordReaderWrapperReadNext(
+        env, nullptr, reader);
+    if (HandleException(state)) break;
+    env->DeleteLocalRef(record);
+    ++num_read;
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * record_size);
+  if (reader != 0)
+    Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteRecordReaderWrapper(env, nullptr, reader);
+  env->DeleteLocalRef(j_compression_type);
+  env->DeleteLocalRef(j_filename);
+  tf_env->DeleteFile(filename);
+}
+BENCHMARK(BM_RecordReaderWrapperGetNext)->Arg(100)->Arg(10000);
+
+// Encoding the provided number of 16-byte strings into a string tensor, and decoding them back.
+static void BM_StringTensorEncodeDecode(benchmark::State& state) {
+  const int64_t num_strings = state.range(0);
+  const int64_t string_size = 16;
+  std::vector<jlong> offsets;
+  for (int64_t i = 0; i <= num_strings; ++i) offsets.push_back(i * string_size);
+  std::vector<jbyte> bytes(static_cast<size_t>(num_strings * string_size), 'x');
+  jlongArray shape = NewLongArray({num_strings});
+  jbyteArray string_bytes = env->NewByteArray(static_cast<jsize>(bytes.size()));
+  env->SetByteArrayRegion(string_bytes, 0, static_cast<jsize>(bytes.size()), bytes.data());
+  jlongArray string_offsets = NewLongArray(offsets);
+  jlongArray decoded_offsets = env->NewLongArray(static_cast<jsize>(num_strings + 1));
+  while (state.KeepRunning()) {
+    jlong handle = Java_org_platanios_tensorflow_jni_Tensor_00024_encodeStrings(
+        env, nullptr, shape, string_bytes, string_offsets);
+    if (HandleException(state)) break;
+    jbyteArray decoded = Java_org_platanios_tensorflow_jni_Tensor_00024_decodeStrings(
+        env, nullptr, handle, decoded_offsets);
+    if (HandleException(state)) break;
+    env->DeleteLocalRef(decoded);
+    Java_org_platanios_tensorflow_jni_Tensor_00024_delete(env, nullptr, handle);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_strings);
+  env->DeleteLocalRef(decoded_offsets);
+  env->DeleteLocalRef(string_offsets);
+  env->DeleteLocalRef(string_bytes);
+  env->DeleteLocalRef(shape);
+}
+BENCHMARK(BM_StringTensorEncodeDecode)->Arg(1)->Arg(1024);
+
+// Round trip through the JVM callbacks registry, with the provided number of tensor handles, performed in the same way
+// as by the "JVMCallback" op kernel. The registered callback is the identity function, and so this measures the cost
+// of crossing into the JVM and back.
+static void BM_JVMCallbackRoundTrip(benchmark::State& state) {
+  const jsize num_handles = static_cast<jsize>(state.range(0));
+  jclass predef = env->FindClass("scala/Predef");
+  jmethodID conforms = env->GetStaticMethodID(predef, "$conforms", "()Lscala/Predef$$less$colon$less;");
+  jclass registry = env->FindClass("org/platanios/tensorflow/jni/ScalaCallbacksRegistry");
+  jmethodID register_method = env->GetStaticMethodID(registry, "register", "(Lscala/Function1;)I");
+  jmethodID deregister_method = env->GetStaticMethodID(registry, "deregister", "(I)V");
+  jmethodID call_method = env->GetStaticMethodID(registry, "call", "(I[J)[J");
+  if (HandleException(state)) return;
+  jobject identity = env->CallStaticObjectMethod(predef, conforms);
+  jint token = env->CallStaticIntMethod(registry, register_method, identity);
+  if (HandleException(state)) return;
+  std::vector<jlong> inputs(static_cast<size_t>(num_handles), 1);
+  std::vector<jlong> outputs(static_cast<size_t>(num_handles));
+  while (state.KeepRunning()) {
+    jlongArray j_inputs = env->NewLongArray(num_handles);
+    env->SetLongArrayRegion(j_inputs, 0, num_handles, inputs.data());
+    jlongArray j_outputs = static_cast<jlongArray>(env->CallStaticObjectMethod(
+        registry, call_method, token, j_inputs));
+    if (HandleException(state)) break;
+    env->GetLongArrayRegion(j_outputs, 0, num_handles, outputs.data());
+    env->DeleteLocalRef(j_outputs);
+    env->DeleteLocalRef(j_inputs);
+  }
+  env->CallStaticVoidMethod(registry, deregister_method, token);
+  env->DeleteLocalRef(identity);
+  env->DeleteLocalRef(registry);
+  env->DeleteLocalRef(predef);
+}
+BENCHMARK(BM_JVMCallbackRoundTrip)->Arg(1)->Arg(8);
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+  const char* class_path = getenv("TF_SCALA_BENCHMARK_CLASSPATH");
+  if (class_path == nullptr) {
+    fprintf(stderr, "The \"TF_SCALA_BENCHMARK_CLASSPATH\" environment variable must be set.\n");
+    return 1;
+  }
+  std::string class_path_option = std::string("-Djava.class.path=") + class_path;
+  JavaVMOption options[1];
+  options[0].optionString = const_cast<char*>(class_path_option.c_str());
+  JavaVMInitArgs args;
+  args.version = JNI_VERSION_1_6;
+  args.nOptions = 1;
+  args.options = options;
+  args.ignoreUnrecognized = JNI_FALSE;
+  if (JNI_CreateJavaVM(&jvm, reinterpret_cast<void**>(&env), &args) != JNI_OK) {
+    fprintf(stderr, "Could not create the JVM.\n");
+    return 1;
+  }
+
+  // The JNI functions are linked statically into this executable and so, the native method used by the JVM side to
+  // check whether the native library has been loaded is registered explicitly, which prevents it from trying to load
+  // the library from the class path.
+  jclass tensorflow = env->FindClass("org/platanios/tensorflow/jni/TensorFlow$");
+  JNINativeMethod version_method = {
+      const_cast<char*>("version"), const_cast<char*>("()Ljava/lang/String;"),
+      reinterpret_cast<void*>(Java_org_platanios_tensorflow_jni_TensorFlow_00024_version)};
+  if (tensorflow == nullptr || env->RegisterNatives(tensorflow, &version_method, 1) != JNI_OK ||
+      JNI_OnLoad(jvm, nullptr) == JNI_ERR) {
+    env->ExceptionDescribe();
+    fprintf(stderr, "Could not initialize the JNI bindings. Is the class path correct?\n");
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  jvm->DestroyJavaVM();
+  return 0;
+}
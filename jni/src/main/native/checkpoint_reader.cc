@@ -14,29 +14,144 @@
  */
 
 #include "checkpoint_reader.h"
+#include "jvm_cache.h"
 #include "utilities.h"
 
 #include <string.h>
+#include <algorithm>
 
+#include "tensorflow/c/c_api_internal.h"
 #include "tensorflow/c/c_eager_api.h"
 #include "tensorflow/c/checkpoint_reader.h"
+#include "tensorflow/core/framework/tensor_slice.h"
+
+namespace {
+  // Resolves the slice of the tensor named `name` that starts at `begin` and has size `size` (where sizes equal to
+  // `-1` denote the full extent of the corresponding dimension), and returns the tensor data type and slice shape.
+  // Returns false, with an exception pending, if the tensor does not exist or the slice is invalid.
+  bool resolve_tensor_slice(
+      JNIEnv* env, tensorflow::checkpoint::CheckpointReader* reader, const std::string& name, jlongArray begin,
+      jlongArray size, tensorflow::TensorSlice* slice, tensorflow::DataType* dtype,
+      tensorflow::TensorShape* slice_shape) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    tensorflow::TensorShape shape;
+    reader->GetTensorDtypeAndShape(name, dtype, &shape, status.get());
+    CHECK_STATUS(env, status.get(), false);
+    const jsize rank = env->GetArrayLength(begin);
+    if (rank != shape.dims() || env->GetArrayLength(size) != rank) {
+      throw_exception(
+        env, jvm_illegal_argument_exception, "Tensor '%s' has rank %d, but the provided slice has rank %d.",
+        name.c_str(), shape.dims(), rank);
+      return false;
+    }
+    ArrayBuffer<jlong> begin_buffer(rank);
+    ArrayBuffer<jlong> size_buffer(rank);
+    env->GetLongArrayRegion(begin, 0, rank, begin_buffer.data());
+    env->GetLongArrayRegion(size, 0, rank, size_buffer.data());
+    *slice = tensorflow::TensorSlice(rank);
+    for (jsize i = 0; i < rank; ++i) {
+      const tensorflow::int64 dim_size = shape.dim_size(i);
+      const tensorflow::int64 start = static_cast<tensorflow::int64>(begin_buffer[i]);
+      const tensorflow::int64 length = size_buffer[i] == -1 ? dim_size - start : size_buffer[i];
+      if (start < 0 || length < 0 || start + length > dim_size) {
+        throw_exception(
+          env, jvm_illegal_argument_exception, "Invalid slice [%lld, %lld + %lld) for dimension %d of size %lld.",
+          static_cast<long long>(start), static_cast<long long>(start), static_cast<long long>(length), i,
+          static_cast<long long>(dim_size));
+        return false;
+      }
+      // Slices are constructed full, so full extents are left as such, because the stored slices of V1 checkpoints are
+      // matched against them.
+      if (start != 0 || length != dim_size) {
+        slice->set_start(i, start);
+        slice->set_length(i, length);
+      }
+    }
+    tensorflow::Status s = slice->SliceTensorShape(shape, slice_shape);
+    if (!s.ok()) {
+      Set_TF_Status_from_Status(status.get(), s);
+      CHECK_STATUS(env, status.get(), false);
+    }
+    return true;
+  }
+}  // namespace
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_newCheckpointReader(
     JNIEnv* env, jobject object, jstring file_pattern) {
   const char* c_file_pattern = env->GetStringUTFChars(file_pattern, nullptr);
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
   auto* reader = new tensorflow::checkpoint::CheckpointReader(std::string(c_file_pattern), status.get());
-  CHECK_STATUS(env, status.get(), 0);
   env->ReleaseStringUTFChars(file_pattern, c_file_pattern);
+  if (TF_GetCode(status.get()) != TF_OK) {
+    delete reader;
+    CHECK_STATUS(env, status.get(), 0);
+  }
   return reinterpret_cast<jlong>(reader);
 }
 
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_deltaBase(
+    JNIEnv* env, jobject object, jstring prefix) {
+  const char* c_prefix = env->GetStringUTFChars(prefix, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::string base_prefix;
+  tensorflow::checkpoint::CheckpointReader::GetDeltaBase(std::string(c_prefix), &base_prefix, status.get());
+  env->ReleaseStringUTFChars(prefix, c_prefix);
+  CHECK_STATUS(env, status.get(), nullptr);
+  return base_prefix.empty() ? nullptr : env->NewStringUTF(base_prefix.c_str());
+}
+
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_debugString(
     JNIEnv* env, jobject object, jlong reader_handle) {
   REQUIRE_HANDLE(reader, tensorflow::checkpoint::CheckpointReader, reader_handle, nullptr);
   return env->NewStringUTF(reader->DebugString().c_str());
 }
 
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_variables(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::checkpoint::CheckpointReader, reader_handle, nullptr);
+  const auto& var_to_shape_map = reader->GetVariableToShapeMap();
+  const auto& var_to_data_type_map = reader->GetVariableToDataTypeMap();
+  std::vector<const std::string*> names;
+  names.reserve(var_to_shape_map.size());
+  size_t num_dims = 0;
+  for (const auto& entry : var_to_shape_map) {
+    names.push_back(&entry.first);
+    num_dims += static_cast<size_t>(entry.second.dims());
+  }
+  std::sort(names.begin(), names.end(), [](const std::string* a, const std::string* b) { return *a < *b; });
+
+  const jsize num_variables = static_cast<jsize>(names.size());
+  const JVMCache& cache = jvm_cache();
+  jobjectArray names_array = env->NewObjectArray(num_variables, cache.string_class, nullptr);
+  std::vector<jint> data_types(names.size());
+  std::vector<jint> shape_offsets(names.size() + 1);
+  std::vector<jlong> shapes;
+  shapes.reserve(num_dims);
+  for (jsize i = 0; i < num_variables; ++i) {
+    const std::string& name = *names[i];
+    jstring name_string = env->NewStringUTF(name.c_str());
+    env->SetObjectArrayElement(names_array, i, name_string);
+    env->DeleteLocalRef(name_string);
+    auto data_type = var_to_data_type_map.find(name);
+    data_types[i] = static_cast<jint>(
+      data_type == var_to_data_type_map.end() ? tensorflow::DT_INVALID : data_type->second);
+    shape_offsets[i] = static_cast<jint>(shapes.size());
+    const tensorflow::TensorShape& shape = var_to_shape_map.at(name);
+    for (int d = 0; d < shape.dims(); ++d) shapes.push_back(static_cast<jlong>(shape.dim_size(d)));
+  }
+  shape_offsets[names.size()] = static_cast<jint>(shapes.size());
+
+  jintArray data_types_array = env->NewIntArray(num_variables);
+  env->SetIntArrayRegion(data_types_array, 0, num_variables, data_types.data());
+  jintArray shape_offsets_array = env->NewIntArray(num_variables + 1);
+  env->SetIntArrayRegion(shape_offsets_array, 0, num_variables + 1, shape_offsets.data());
+  jlongArray shapes_array = env->NewLongArray(static_cast<jsize>(shapes.size()));
+  env->SetLongArrayRegion(shapes_array, 0, static_cast<jsize>(shapes.size()), shapes.data());
+  return env->CallStaticObjectMethod(
+    cache.checkpoint_variables_class, cache.checkpoint_variables_apply, names_array, data_types_array,
+    shape_offsets_array, shapes_array);
+}
+
 JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_hasTensor(
     JNIEnv* env, jobject object, jlong reader_handle, jstring name) {
   REQUIRE_HANDLE(reader, tensorflow::checkpoint::CheckpointReader, reader_handle, false);
@@ -53,11 +168,117 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
   std::unique_ptr<tensorflow::Tensor> tensor;
   reader->GetTensor(c_name, &tensor, status.get());
+  env->ReleaseStringUTFChars(name, c_name);
   CHECK_STATUS(env, status.get(), 0);
   TFE_TensorHandle* tfe_tensor = new TFE_TensorHandle(*tensor.get(), nullptr);
   return (jlong) tfe_tensor;
 }
 
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getMappedTensor(
+    JNIEnv* env, jobject object, jlong reader_handle, jstring name, jboolean copy_on_write) {
+  REQUIRE_HANDLE(reader, tensorflow::checkpoint::CheckpointReader, reader_handle, 0);
+  const char* c_name = env->GetStringUTFChars(name, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::unique_ptr<tensorflow::Tensor> tensor;
+  reader->GetMappedTensor(c_name, static_cast<bool>(copy_on_write), &tensor, status.get());
+  env->ReleaseStringUTFChars(name, c_name);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(new TFE_TensorHandle(*tensor.get(), nullptr));
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getTensors(
+    JNIEnv* env, jobject object, jlong reader_handle, jobjectArray names, jint num_threads,
+    jlong max_bytes_in_flight) {
+  REQUIRE_HANDLE(reader, tensorflow::checkpoint::CheckpointReader, reader_handle, nullptr);
+  const std::vector<std::string> cpp_names = to_string_vector(env, names);
+  std::vector<std::unique_ptr<tensorflow::Tensor>> tensors;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  reader->GetTensors(
+    cpp_names, static_cast<int>(num_threads), static_cast<tensorflow::int64>(max_bytes_in_flight), &tensors,
+    status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  const jsize num_tensors = static_cast<jsize>(tensors.size());
+  ArrayBuffer<jlong> handles(num_tensors);
+  for (jsize i = 0; i < num_tensors; ++i)
+    handles[i] = reinterpret_cast<jlong>(new TFE_TensorHandle(*tensors[i], nullptr));
+  jlongArray result = env->NewLongArray(num_tensors);
+  env->SetLongArrayRegion(result, 0, num_tensors, handles.data());
+  return result;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getTensorSlice(
+    JNIEnv* env, jobject object, jlong reader_handle, jstring name, jlongArray begin, jlongArray size) {
+  REQUIRE_HANDLE(reader, tensorflow::checkpoint::CheckpointReader, reader_handle, 0);
+  const char* c_name = env->GetStringUTFChars(name, nullptr);
+  std::string cpp_name(c_name);
+  env->ReleaseStringUTFChars(name, c_name);
+  tensorflow::TensorSlice slice;
+  tensorflow::DataType dtype;
+  tensorflow::TensorShape slice_shape;
+  if (!resolve_tensor_slice(env, reader, cpp_name, begin, size, &slice, &dtype, &slice_shape)) return 0;
+  // Only the slice is allocated and read, rather than the whole tensor.
+  tensorflow::Tensor tensor(dtype, slice_shape);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  reader->GetTensorSlice(cpp_name, slice, &tensor, status.get());
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(new TFE_TensorHandle(tensor, nullptr));
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getTensorSliceInto(
+    JNIEnv* env, jobject object, jlong reader_handle, jstring name, jlongArray begin, jlongArray size, jobject buffer,
+    jint offset) {
+  REQUIRE_HANDLE(reader, tensorflow::checkpoint::CheckpointReader, reader_handle, 0);
+  char* buffer_data = static_cast<char*>(env->GetDirectBufferAddress(buffer));
+  if (buffer_data == nullptr) {
+    throw_exception(env, jvm_illegal_argument_exception, "The provided buffer is not a direct buffer.");
+    return 0;
+  }
+  const char* c_name = env->GetStringUTFChars(name, nullptr);
+  std::string cpp_name(c_name);
+  env->ReleaseStringUTFChars(name, c_name);
+  tensorflow::TensorSlice slice;
+  tensorflow::DataType dtype;
+  tensorflow::TensorShape slice_shape;
+  if (!resolve_tensor_slice(env, reader, cpp_name, begin, size, &slice, &dtype, &slice_shape)) return 0;
+  const size_t element_size = tensorflow::DataTypeSize(dtype);
+  if (element_size == 0) {
+    throw_exception(
+      env, jvm_illegal_argument_exception, "Tensors of type %s cannot be read into buffers.",
+      tensorflow::DataTypeString(dtype).c_str());
+    return 0;
+  }
+  const jlong num_bytes = static_cast<jlong>(element_size) * static_cast<jlong>(slice_shape.num_elements());
+  if (offset < 0 || static_cast<jlong>(offset) + num_bytes > env->GetDirectBufferCapacity(buffer)) {
+    throw_exception(
+      env, jvm_illegal_argument_exception, "The slice requires %lld bytes, which do not fit in the provided buffer.",
+      static_cast<long long>(num_bytes));
+    return 0;
+  }
+  // The slice is read directly into the buffer, through a tensor that aliases its memory. The buffer memory is owned
+  // by the JVM and so the deallocator does nothing.
+  std::vector<int64_t> dims(slice_shape.dims());
+  for (int i = 0; i < slice_shape.dims(); ++i) dims[i] = static_cast<int64_t>(slice_shape.dim_size(i));
+  TF_Tensor* aliasing_tensor = TF_NewTensor(
+    static_cast<TF_DataType>(dtype), dims.data(), static_cast<int>(dims.size()), buffer_data + offset,
+    static_cast<size_t>(num_bytes), [](void* data, size_t length, void* arg) {}, nullptr);
+  tensorflow::Tensor tensor;
+  tensorflow::Status s = tensorflow::TF_TensorToTensor(aliasing_tensor, &tensor);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  if (s.ok()) {
+    reader->GetTensorSlice(cpp_name, slice, &tensor, status.get());
+    // Some TensorFlow versions copy unaligned data when creating tensors, in which case the slice needs to be copied
+    // back into the buffer.
+    tensorflow::StringPiece data = tensor.tensor_data();
+    if (TF_GetCode(status.get()) == TF_OK && data.data() != buffer_data + offset)
+      memcpy(buffer_data + offset, data.data(), data.size());
+  } else {
+    Set_TF_Status_from_Status(status.get(), s);
+  }
+  TF_DeleteTensor(aliasing_tensor);
+  CHECK_STATUS(env, status.get(), 0);
+  return num_bytes;
+}
+
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_delete(
     JNIEnv* env, jobject object, jlong reader_handle) {
   REQUIRE_HANDLE(reader, tensorflow::checkpoint::CheckpointReader, reader_handle, void());
@@ -15,6 +15,14 @@ extern "C" {
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_newCheckpointReader
   (JNIEnv *, jobject, jstring);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_CheckpointReader__
+ * Method:    deltaBase
+ * Signature: (Ljava/lang/String;)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_deltaBase
+  (JNIEnv *, jobject, jstring);
+
 /*
  * Class:     org_platanios_tensorflow_jni_CheckpointReader__
  * Method:    debugString
@@ -23,6 +31,14 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_debugString
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_CheckpointReader__
+ * Method:    variables
+ * Signature: (J)Lorg/platanios/tensorflow/jni/CheckpointVariables;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_variables
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     org_platanios_tensorflow_jni_CheckpointReader__
  * Method:    hasTensor
@@ -39,6 +55,38 @@ JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getTensor
   (JNIEnv *, jobject, jlong, jstring);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_CheckpointReader__
+ * Method:    getMappedTensor
+ * Signature: (JLjava/lang/String;Z)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getMappedTensor
+  (JNIEnv *, jobject, jlong, jstring, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_CheckpointReader__
+ * Method:    getTensors
+ * Signature: (J[Ljava/lang/String;IJ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getTensors
+  (JNIEnv *, jobject, jlong, jobjectArray, jint, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_CheckpointReader__
+ * Method:    getTensorSlice
+ * Signature: (JLjava/lang/String;[J[J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getTensorSlice
+  (JNIEnv *, jobject, jlong, jstring, jlongArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_CheckpointReader__
+ * Method:    getTensorSliceInto
+ * Signature: (JLjava/lang/String;[J[JLjava/nio/ByteBuffer;I)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CheckpointReader_00024_getTensorSliceInto
+  (JNIEnv *, jobject, jlong, jstring, jlongArray, jlongArray, jobject, jint);
+
 /*
  * Class:     org_platanios_tensorflow_jni_CheckpointReader__
  * Method:    delete
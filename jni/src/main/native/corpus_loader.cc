@@ -0,0 +1,52 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "corpus_loader.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/corpus_loader.h"
+
+namespace {
+  std::string to_string(JNIEnv* env, jstring string) {
+    const char* c_string = env->GetStringUTFChars(string, nullptr);
+    std::string result(c_string);
+    env->ReleaseStringUTFChars(string, c_string);
+    return result;
+  }
+}  // namespace
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_CorpusLoader_00024_loadCorpus(
+    JNIEnv* env, jobject object, jobjectArray filenames, jstring delimiters, jstring end_of_line_token,
+    jstring unknown_token, jlong min_count, jlong max_vocabulary_size, jlong chunk_size) {
+  tensorflow::CorpusLoaderOptions options;
+  options.delimiters = to_string(env, delimiters);
+  options.end_of_line_token = to_string(env, end_of_line_token);
+  options.unknown_token = to_string(env, unknown_token);
+  options.min_count = static_cast<tensorflow::int64>(min_count);
+  options.max_vocabulary_size = static_cast<tensorflow::int64>(max_vocabulary_size);
+  options.chunk_size = static_cast<tensorflow::int64>(chunk_size);
+  const std::vector<std::string> c_filenames = to_string_vector(env, filenames);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  tensorflow::Corpus corpus;
+  tensorflow::LoadCorpus(c_filenames, options, &corpus, status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  return tensors_to_tensor_handles(env, {corpus.ids, corpus.file_offsets, corpus.vocabulary, corpus.counts});
+}
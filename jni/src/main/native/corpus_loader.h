@@ -0,0 +1,21 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_CorpusLoader__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_CorpusLoader__
+#define _Included_org_platanios_tensorflow_jni_CorpusLoader__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_CorpusLoader__
+ * Method:    loadCorpus
+ * Signature: ([Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;JJJ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_CorpusLoader_00024_loadCorpus
+  (JNIEnv *, jobject, jobjectArray, jstring, jstring, jstring, jlong, jlong, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
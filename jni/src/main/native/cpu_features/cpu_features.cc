@@ -0,0 +1,77 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "cpu_features.h"
+
+// This file is compiled into its own small library (i.e., `tensorflow_cpu_features`), without any ISA-specific
+// compiler flags and without linking to TensorFlow, so that it can be loaded on any host in order to choose which
+// variant of the JNI bindings and the ops libraries to load.
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define TENSORFLOW_JNI_X86 1
+#endif
+
+namespace {
+#ifdef TENSORFLOW_JNI_X86
+  // CPUID leaf 1, register ECX.
+  const unsigned int kFma = 1u << 12;
+  const unsigned int kOsXSave = 1u << 27;
+  const unsigned int kAvx = 1u << 28;
+
+  // CPUID leaf 7 (sub-leaf 0), register EBX.
+  const unsigned int kAvx2 = 1u << 5;
+  const unsigned int kAvx512F = 1u << 16;
+  const unsigned int kAvx512DQ = 1u << 17;
+  const unsigned int kAvx512CD = 1u << 28;
+  const unsigned int kAvx512BW = 1u << 30;
+  const unsigned int kAvx512VL = 1u << 31;
+
+  // Register states of the XCR0 extended control register that must be enabled by the operating system (i.e., saved
+  // on context switches) in order for AVX and AVX-512 instructions to be usable.
+  const unsigned long long kXcr0Avx = 0x6;      // SSE and AVX (i.e., XMM and YMM) state.
+  const unsigned long long kXcr0Avx512 = 0xe6;  // AVX state, along with the opmask and ZMM state.
+
+  unsigned long long ReadXcr0() {
+    unsigned int eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+  }
+#endif
+
+  // Returns `2` if the host supports AVX-512 (i.e., the F, CD, BW, DQ, and VL extensions), `1` if it supports AVX2 and
+  // FMA, and `0` otherwise.
+  jint DetectIsaLevel() {
+#ifdef TENSORFLOW_JNI_X86
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+    if ((ecx & (kFma | kOsXSave | kAvx)) != (kFma | kOsXSave | kAvx)) return 0;
+    const unsigned long long xcr0 = ReadXcr0();
+    if ((xcr0 & kXcr0Avx) != kXcr0Avx || __get_cpuid_max(0, nullptr) < 7) return 0;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if ((ebx & kAvx2) == 0) return 0;
+    const unsigned int avx512 = kAvx512F | kAvx512DQ | kAvx512CD | kAvx512BW | kAvx512VL;
+    if ((ebx & avx512) == avx512 && (xcr0 & kXcr0Avx512) == kXcr0Avx512) return 2;
+    return 1;
+#else
+    return 0;
+#endif
+  }
+}  // namespace
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_CpuFeatures_00024_isaLevel(JNIEnv* env, jobject object) {
+  static const jint isa_level = DetectIsaLevel();
+  return isa_level;
+}
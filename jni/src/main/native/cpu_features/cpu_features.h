@@ -0,0 +1,21 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_CpuFeatures__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_CpuFeatures__
+#define _Included_org_platanios_tensorflow_jni_CpuFeatures__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_CpuFeatures__
+ * Method:    isaLevel
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_CpuFeatures_00024_isaLevel
+  (JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,87 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "csv_reader.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/csv_reader.h"
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CSVReader_00024_newCSVReader(
+    JNIEnv* env, jobject object, jstring filename, jbyte delimiter, jboolean use_quotes, jint skip_header_lines,
+    jintArray columns, jintArray data_types, jobjectArray defaults, jint block_size) {
+  const jsize num_columns = env->GetArrayLength(columns);
+  std::vector<int> c_columns(static_cast<size_t>(num_columns));
+  env->GetIntArrayRegion(columns, 0, num_columns, reinterpret_cast<jint*>(c_columns.data()));
+  std::vector<jint> c_data_types(static_cast<size_t>(env->GetArrayLength(data_types)));
+  env->GetIntArrayRegion(data_types, 0, env->GetArrayLength(data_types), c_data_types.data());
+  std::vector<TF_DataType> dtypes;
+  for (jint data_type : c_data_types) dtypes.push_back(static_cast<TF_DataType>(data_type));
+  // Null default values correspond to required columns.
+  std::vector<std::string> c_defaults;
+  std::vector<bool> has_defaults;
+  if (defaults != nullptr) {
+    const jsize num_defaults = env->GetArrayLength(defaults);
+    for (jsize i = 0; i < num_defaults; ++i) {
+      jstring default_value = static_cast<jstring>(env->GetObjectArrayElement(defaults, i));
+      has_defaults.push_back(default_value != nullptr);
+      if (default_value == nullptr) {
+        c_defaults.emplace_back();
+        continue;
+      }
+      const char* c_default_value = env->GetStringUTFChars(default_value, nullptr);
+      c_defaults.emplace_back(c_default_value);
+      env->ReleaseStringUTFChars(default_value, c_default_value);
+      env->DeleteLocalRef(default_value);
+    }
+  }
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* reader = tensorflow::CsvReader::New(
+      std::string(c_filename), static_cast<char>(delimiter), static_cast<bool>(use_quotes),
+      static_cast<int>(skip_header_lines), c_columns, dtypes, c_defaults, has_defaults,
+      static_cast<size_t>(block_size), status.get());
+  env->ReleaseStringUTFChars(filename, c_filename);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(reader);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_CSVReader_00024_csvReaderNextBatch(
+    JNIEnv* env, jobject object, jlong reader_handle, jint batch_size) {
+  REQUIRE_HANDLE(reader, tensorflow::CsvReader, reader_handle, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<TF_Tensor*> batch;
+  reader->NextBatch(static_cast<tensorflow::int64>(batch_size), &batch, status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  if (batch.empty()) return nullptr;
+  return tensors_to_tensor_handles(env, batch);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CSVReader_00024_csvReaderLineNumber(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::CsvReader, reader_handle, 0);
+  return static_cast<jlong>(reader->line_number());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_CSVReader_00024_deleteCSVReader(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::CsvReader, reader_handle, void());
+  delete reader;
+}
@@ -0,0 +1,45 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_CSVReader__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_CSVReader__
+#define _Included_org_platanios_tensorflow_jni_CSVReader__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_CSVReader__
+ * Method:    newCSVReader
+ * Signature: (Ljava/lang/String;BZI[I[I[Ljava/lang/String;I)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CSVReader_00024_newCSVReader
+  (JNIEnv *, jobject, jstring, jbyte, jboolean, jint, jintArray, jintArray, jobjectArray, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_CSVReader__
+ * Method:    csvReaderNextBatch
+ * Signature: (JI)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_CSVReader_00024_csvReaderNextBatch
+  (JNIEnv *, jobject, jlong, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_CSVReader__
+ * Method:    csvReaderLineNumber
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_CSVReader_00024_csvReaderLineNumber
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_CSVReader__
+ * Method:    deleteCSVReader
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_CSVReader_00024_deleteCSVReader
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,120 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "eager_dispatcher.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/eager_dispatcher.h"
+#include "tensorflow/c/eager_tape.h"
+#include "tensorflow/c/status_helper.h"
+
+namespace {
+  // Resolves the inputs and creates and executes the op with specification handle "spec_handle", storing its outputs
+  // in "outputs". Returns false, with an exception pending, if that fails.
+  bool dispatch(
+      JNIEnv* env, jlong context_handle, jlong spec_handle, jlongArray inputs, jintArray input_lengths,
+      jbyteArray attrs, std::unique_ptr<TFE_TensorHandle* []>* outputs, int* num_outputs) {
+    REQUIRE_HANDLE(context, TFE_Context, context_handle, false);
+    REQUIRE_HANDLE(spec, tensorflow::EagerOpSpec, spec_handle, false);
+
+    const jsize num_inputs = env->GetArrayLength(inputs);
+    ArrayBuffer<jlong> input_handles(num_inputs);
+    env->GetLongArrayRegion(inputs, 0, num_inputs, input_handles.data());
+    ArrayBuffer<TFE_TensorHandle*> input_tensors(num_inputs);
+    for (jsize i = 0; i < num_inputs; ++i) {
+      REQUIRE_TENSOR_HANDLE(input_tensor, input_handles[i], false);
+      input_tensors[i] = input_tensor;
+    }
+    const jsize num_input_lengths = env->GetArrayLength(input_lengths);
+    if (num_input_lengths != spec->num_inputs) {
+      throw_exception(
+          env, tf_invalid_argument_exception, "Expected %d input lengths for '%s' op, but got %d, instead.",
+          spec->num_inputs, spec->name, num_input_lengths);
+      return false;
+    }
+    ArrayBuffer<jint> c_input_lengths(num_input_lengths);
+    env->GetIntArrayRegion(input_lengths, 0, num_input_lengths, c_input_lengths.data());
+    const jsize attrs_size = attrs == nullptr ? 0 : env->GetArrayLength(attrs);
+    ArrayBuffer<jbyte> c_attrs(attrs_size);
+    if (attrs_size > 0) env->GetByteArrayRegion(attrs, 0, attrs_size, c_attrs.data());
+
+    TFE_Op* op = nullptr;
+    TF_Status* status = thread_local_status();
+    tensorflow::Set_TF_Status_from_Status(status, tensorflow::NewEagerOp(
+        context, *spec, input_tensors.data(), static_cast<int>(num_inputs),
+        reinterpret_cast<const tensorflow::int32*>(c_input_lengths.data()),
+        reinterpret_cast<const char*>(c_attrs.data()), static_cast<size_t>(attrs_size), &op, num_outputs));
+    CHECK_STATUS(env, status, false);
+    std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op_owner(op, TFE_DeleteOp);
+    outputs->reset(new TFE_TensorHandle* [*num_outputs]);
+    execute_eager_op(op, spec->name, outputs->get(), num_outputs, status);
+    CHECK_STATUS(env, status, false);
+    if (tensorflow::EagerTape::IsRecording())
+      tensorflow::EagerTape::RecordOpOnActiveTapes(
+          *spec, input_tensors.data(), static_cast<int>(num_inputs),
+          reinterpret_cast<const tensorflow::int32*>(c_input_lengths.data()),
+          reinterpret_cast<const char*>(c_attrs.data()), static_cast<size_t>(attrs_size), outputs->get(),
+          *num_outputs);
+    return true;
+  }
+}  // namespace
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_EagerDispatcher_00024_lookUpOp(
+    JNIEnv* env, jobject object, jstring op_name) {
+  const char* c_op_name = env->GetStringUTFChars(op_name, nullptr);
+  const tensorflow::EagerOpSpec* spec = tensorflow::EagerOpSpecRegistry::LookUp(c_op_name);
+  if (spec == nullptr)
+    throw_exception(env, tf_not_found_exception, "No eager dispatch specification was found for op '%s'.", c_op_name);
+  env->ReleaseStringUTFChars(op_name, c_op_name);
+  return reinterpret_cast<jlong>(spec);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_EagerDispatcher_00024_execute(
+    JNIEnv* env, jobject object, jlong context_handle, jlong spec_handle, jlongArray inputs, jintArray input_lengths,
+    jbyteArray attrs) {
+  std::unique_ptr<TFE_TensorHandle* []> outputs;
+  int num_outputs = 0;
+  if (!dispatch(env, context_handle, spec_handle, inputs, input_lengths, attrs, &outputs, &num_outputs))
+    return nullptr;
+  ArrayBuffer<jlong> output_handles(static_cast<jsize>(num_outputs));
+  for (int i = 0; i < num_outputs; ++i)
+    output_handles[i] = reinterpret_cast<jlong>(outputs[i]);
+  jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
+  env->SetLongArrayRegion(outputs_array, 0, static_cast<jsize>(num_outputs), output_handles.data());
+  return outputs_array;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_EagerDispatcher_00024_executeSingleOutput(
+    JNIEnv* env, jobject object, jlong context_handle, jlong spec_handle, jlongArray inputs, jintArray input_lengths,
+    jbyteArray attrs) {
+  std::unique_ptr<TFE_TensorHandle* []> outputs;
+  int num_outputs = 0;
+  if (!dispatch(env, context_handle, spec_handle, inputs, input_lengths, attrs, &outputs, &num_outputs))
+    return 0;
+  if (num_outputs != 1) {
+    for (int i = 0; i < num_outputs; ++i)
+      TFE_DeleteTensorHandle(outputs[i]);
+    throw_exception(
+        env, tf_invalid_argument_exception, "Expected a single output for '%s' op, but got %d, instead.",
+        reinterpret_cast<tensorflow::EagerOpSpec*>(spec_handle)->name, num_outputs);
+    return 0;
+  }
+  return reinterpret_cast<jlong>(outputs[0]);
+}
@@ -0,0 +1,37 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_EagerDispatcher__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_EagerDispatcher__
+#define _Included_org_platanios_tensorflow_jni_EagerDispatcher__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerDispatcher__
+ * Method:    lookUpOp
+ * Signature: (Ljava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_EagerDispatcher_00024_lookUpOp
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerDispatcher__
+ * Method:    execute
+ * Signature: (JJ[J[I[B)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_EagerDispatcher_00024_execute
+  (JNIEnv *, jobject, jlong, jlong, jlongArray, jintArray, jbyteArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerDispatcher__
+ * Method:    executeSingleOutput
+ * Signature: (JJ[J[I[B)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_EagerDispatcher_00024_executeSingleOutput
+  (JNIEnv *, jobject, jlong, jlong, jlongArray, jintArray, jbyteArray);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,108 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "eager_tape.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/eager_tape.h"
+#include "tensorflow/c/status_helper.h"
+
+namespace {
+  // Resolves the eager tensor handles stored in "array". Zero-valued handles are resolved to null if "allow_null" is
+  // true. Returns false, with an exception pending, if that fails.
+  bool require_tensor_handles(
+      JNIEnv* env, jlongArray array, bool allow_null, ArrayBuffer<TFE_TensorHandle*>* tensors) {
+    const jsize length = env->GetArrayLength(array);
+    ArrayBuffer<jlong> handles(length);
+    env->GetLongArrayRegion(array, 0, length, handles.data());
+    for (jsize i = 0; i < length; ++i) {
+      if (allow_null && handles[i] == 0) {
+        (*tensors)[i] = nullptr;
+        continue;
+      }
+      REQUIRE_TENSOR_HANDLE(tensor, handles[i], false);
+      (*tensors)[i] = tensor;
+    }
+    return true;
+  }
+}  // namespace
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_allocate(
+    JNIEnv* env, jobject object) {
+  return reinterpret_cast<jlong>(new tensorflow::EagerTape());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_delete(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(tape, tensorflow::EagerTape, handle, void());
+  delete tape;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_push(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(tape, tensorflow::EagerTape, handle, void());
+  tensorflow::EagerTape::Push(tape);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_pop(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(tape, tensorflow::EagerTape, handle, void());
+  tensorflow::EagerTape::Pop(tape);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_watch(
+    JNIEnv* env, jobject object, jlong handle, jlong tensor_handle) {
+  REQUIRE_HANDLE(tape, tensorflow::EagerTape, handle, void());
+  REQUIRE_TENSOR_HANDLE(tensor, tensor_handle, void());
+  tape->Watch(tensor);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_gradient(
+    JNIEnv* env, jobject object, jlong handle, jlong context_handle, jlongArray targets, jlongArray target_gradients,
+    jlongArray sources) {
+  REQUIRE_HANDLE(tape, tensorflow::EagerTape, handle, nullptr);
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
+  const jsize num_targets = env->GetArrayLength(targets);
+  if (env->GetArrayLength(target_gradients) != num_targets) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Expected %d target gradients, but got %d, instead.", num_targets,
+        env->GetArrayLength(target_gradients));
+    return nullptr;
+  }
+  const jsize num_sources = env->GetArrayLength(sources);
+  ArrayBuffer<TFE_TensorHandle*> c_targets(num_targets);
+  ArrayBuffer<TFE_TensorHandle*> c_target_gradients(num_targets);
+  ArrayBuffer<TFE_TensorHandle*> c_sources(num_sources);
+  if (!require_tensor_handles(env, targets, false, &c_targets) ||
+      !require_tensor_handles(env, target_gradients, true, &c_target_gradients) ||
+      !require_tensor_handles(env, sources, false, &c_sources))
+    return nullptr;
+  ArrayBuffer<TFE_TensorHandle*> gradients(num_sources);
+  TF_Status* status = thread_local_status();
+  tensorflow::Set_TF_Status_from_Status(status, tape->ComputeGradients(
+      context, c_targets.data(), c_target_gradients.data(), static_cast<int>(num_targets), c_sources.data(),
+      static_cast<int>(num_sources), gradients.data()));
+  CHECK_STATUS(env, status, nullptr);
+  ArrayBuffer<jlong> gradient_handles(num_sources);
+  for (jsize i = 0; i < num_sources; ++i)
+    gradient_handles[i] = reinterpret_cast<jlong>(gradients[i]);
+  jlongArray gradients_array = env->NewLongArray(num_sources);
+  env->SetLongArrayRegion(gradients_array, 0, num_sources, gradient_handles.data());
+  return gradients_array;
+}
@@ -0,0 +1,61 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_EagerTape__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_EagerTape__
+#define _Included_org_platanios_tensorflow_jni_EagerTape__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerTape__
+ * Method:    allocate
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_allocate
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerTape__
+ * Method:    delete
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_delete
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerTape__
+ * Method:    push
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_push
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerTape__
+ * Method:    pop
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_pop
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerTape__
+ * Method:    watch
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_watch
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EagerTape__
+ * Method:    gradient
+ * Signature: (JJ[J[J[J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_EagerTape_00024_gradient
+  (JNIEnv *, jobject, jlong, jlong, jlongArray, jlongArray, jlongArray);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
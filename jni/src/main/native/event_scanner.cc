@@ -0,0 +1,85 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "event_scanner.h"
+#include "jvm_cache.h"
+#include "utilities.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensorflow/c/event_scanner.h"
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_newEventScanner(
+    JNIEnv* env, jobject object, jobjectArray tags, jlong reservoir_size, jlong seed, jint num_threads) {
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* scanner = tensorflow::EventScanner::New(
+    to_string_vector(env, tags), static_cast<tensorflow::int64>(reservoir_size), static_cast<tensorflow::int64>(seed),
+    static_cast<int>(num_threads), status.get());
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(scanner);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_eventScannerScan(
+    JNIEnv* env, jobject object, jlong scanner_handle, jobjectArray filenames) {
+  REQUIRE_HANDLE(scanner, tensorflow::EventScanner, scanner_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  scanner->Scan(to_string_vector(env, filenames), status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_eventScannerTags(
+    JNIEnv* env, jobject object, jlong scanner_handle, jobjectArray filenames) {
+  REQUIRE_HANDLE(scanner, tensorflow::EventScanner, scanner_handle, nullptr);
+  const std::vector<std::string> tags = scanner->Tags(to_string_vector(env, filenames));
+  const jsize num_tags = static_cast<jsize>(tags.size());
+  jobjectArray tags_array = env->NewObjectArray(num_tags, jvm_cache().string_class, nullptr);
+  for (jsize i = 0; i < num_tags; ++i) {
+    jstring tag = env->NewStringUTF(tags[i].c_str());
+    env->SetObjectArrayElement(tags_array, i, tag);
+    env->DeleteLocalRef(tag);
+  }
+  return tags_array;
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_eventScannerScalars(
+    JNIEnv* env, jobject object, jlong scanner_handle, jobjectArray filenames, jstring tag, jlong min_step,
+    jlong max_step, jlong max_points) {
+  REQUIRE_HANDLE(scanner, tensorflow::EventScanner, scanner_handle, nullptr);
+  const char* c_tag = env->GetStringUTFChars(tag, nullptr);
+  const std::string tag_string(c_tag);
+  env->ReleaseStringUTFChars(tag, c_tag);
+  const tensorflow::EventScanner::Scalars scalars = scanner->Get(
+    to_string_vector(env, filenames), tag_string, static_cast<tensorflow::int64>(min_step),
+    static_cast<tensorflow::int64>(max_step), static_cast<tensorflow::int64>(max_points));
+  const jsize num_points = static_cast<jsize>(scalars.steps.size());
+  jlongArray steps = env->NewLongArray(num_points);
+  jdoubleArray wall_times = env->NewDoubleArray(num_points);
+  jdoubleArray values = env->NewDoubleArray(num_points);
+  ArrayBuffer<jlong> steps_buffer(num_points);
+  for (jsize i = 0; i < num_points; ++i) steps_buffer[i] = static_cast<jlong>(scalars.steps[i]);
+  env->SetLongArrayRegion(steps, 0, num_points, steps_buffer.data());
+  env->SetDoubleArrayRegion(wall_times, 0, num_points, scalars.wall_times.data());
+  env->SetDoubleArrayRegion(values, 0, num_points, scalars.values.data());
+  const JVMCache& cache = jvm_cache();
+  return env->CallStaticObjectMethod(cache.scalar_events_class, cache.scalar_events_apply, steps, wall_times, values);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_deleteEventScanner(
+    JNIEnv* env, jobject object, jlong scanner_handle) {
+  REQUIRE_HANDLE(scanner, tensorflow::EventScanner, scanner_handle, void());
+  delete scanner;
+}
@@ -0,0 +1,53 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_EventScanner__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_EventScanner__
+#define _Included_org_platanios_tensorflow_jni_EventScanner__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_EventScanner__
+ * Method:    newEventScanner
+ * Signature: ([Ljava/lang/String;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_newEventScanner
+  (JNIEnv *, jobject, jobjectArray, jlong, jlong, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EventScanner__
+ * Method:    eventScannerScan
+ * Signature: (J[Ljava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_eventScannerScan
+  (JNIEnv *, jobject, jlong, jobjectArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EventScanner__
+ * Method:    eventScannerTags
+ * Signature: (J[Ljava/lang/String;)[Ljava/lang/String;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_eventScannerTags
+  (JNIEnv *, jobject, jlong, jobjectArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EventScanner__
+ * Method:    eventScannerScalars
+ * Signature: (J[Ljava/lang/String;Ljava/lang/String;JJJ)Lorg/platanios/tensorflow/jni/ScalarEvents;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_eventScannerScalars
+  (JNIEnv *, jobject, jlong, jobjectArray, jstring, jlong, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_EventScanner__
+ * Method:    deleteEventScanner
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_EventScanner_00024_deleteEventScanner
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,135 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "example_parser.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/example_parser.h"
+#include "tensorflow/c/status_helper.h"
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_ExampleParser_00024_parseExamples(
+    JNIEnv* env, jobject object, jobject buffer, jlong offset, jlong length, jobjectArray dense_keys,
+    jintArray dense_data_types, jintArray dense_ranks, jlongArray dense_shapes, jlongArray dense_defaults,
+    jobjectArray sparse_keys, jintArray sparse_data_types) {
+  const char* data = static_cast<const char*>(env->GetDirectBufferAddress(buffer));
+  if (data == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "Only direct buffers can be parsed natively.");
+    return nullptr;
+  }
+  if (offset < 0 || length < 0 || offset + length > env->GetDirectBufferCapacity(buffer)) {
+    throw_exception(env, tf_invalid_argument_exception, "The requested range exceeds the provided buffer.");
+    return nullptr;
+  }
+
+  const jsize num_dense = env->GetArrayLength(dense_keys);
+  const jsize num_sparse = env->GetArrayLength(sparse_keys);
+  if (env->GetArrayLength(dense_data_types) != num_dense || env->GetArrayLength(dense_ranks) != num_dense ||
+      env->GetArrayLength(dense_defaults) != num_dense || env->GetArrayLength(sparse_data_types) != num_sparse) {
+    throw_exception(
+        env, jvm_illegal_argument_exception, "All dense and all sparse feature arrays must have the same length.");
+    return nullptr;
+  }
+  const std::vector<std::string> dense_names = to_string_vector(env, dense_keys);
+  const std::vector<std::string> sparse_names = to_string_vector(env, sparse_keys);
+  ArrayBuffer<jint> dense_types(num_dense);
+  ArrayBuffer<jint> ranks(num_dense);
+  ArrayBuffer<jlong> defaults(num_dense);
+  ArrayBuffer<jint> sparse_types(num_sparse);
+  env->GetIntArrayRegion(dense_data_types, 0, num_dense, dense_types.data());
+  env->GetIntArrayRegion(dense_ranks, 0, num_dense, ranks.data());
+  env->GetLongArrayRegion(dense_defaults, 0, num_dense, defaults.data());
+  env->GetIntArrayRegion(sparse_data_types, 0, num_sparse, sparse_types.data());
+  const jsize num_shape_elements = env->GetArrayLength(dense_shapes);
+  ArrayBuffer<jlong> shapes(num_shape_elements);
+  env->GetLongArrayRegion(dense_shapes, 0, num_shape_elements, shapes.data());
+
+  // The shapes of all dense features are packed one after the other, each taking as many elements as the feature rank.
+  // Similar to the ParseExample op, a dense feature whose first dimension is unknown has variable length and is padded
+  // using its (scalar) default value, while a zero default value handle denotes a required fixed-length feature.
+  tensorflow::example::FastParseExampleConfig config;
+  jsize position = 0;
+  for (jsize i = 0; i < num_dense; ++i) {
+    if (ranks[i] < 0 || position + ranks[i] > num_shape_elements) {
+      throw_exception(env, jvm_illegal_argument_exception, "The dense feature shapes do not match their ranks.");
+      return nullptr;
+    }
+    tensorflow::example::FastParseExampleConfig::Dense dense;
+    dense.feature_name = dense_names[i];
+    dense.dtype = static_cast<tensorflow::DataType>(dense_types[i]);
+    tensorflow::gtl::ArraySlice<tensorflow::int64> dims(
+        reinterpret_cast<const tensorflow::int64*>(shapes.data() + position), ranks[i]);
+    dense.shape = tensorflow::PartialTensorShape(dims);
+    dense.variable_length = ranks[i] > 0 && shapes[position] == -1;
+    dense.elements_per_stride = 1;
+    for (jsize d = dense.variable_length ? 1 : 0; d < ranks[i]; ++d) {
+      if (shapes[position + d] < 0) {
+        throw_exception(
+            env, jvm_illegal_argument_exception,
+            "Only the first dimension of the shape of dense feature '%s' may be unknown.", dense_names[i].c_str());
+        return nullptr;
+      }
+      dense.elements_per_stride *= shapes[position + d];
+    }
+    if (defaults[i] != 0) {
+      const TFE_TensorHandle* default_value = reinterpret_cast<TFE_TensorHandle*>(defaults[i]);
+      if (default_value->d != nullptr) {
+        throw_exception(
+            env, jvm_illegal_argument_exception,
+            "The default value of dense feature '%s' must be a host tensor.", dense_names[i].c_str());
+        return nullptr;
+      }
+      dense.default_value = default_value->t;
+    } else if (dense.variable_length) {
+      throw_exception(
+          env, jvm_illegal_argument_exception,
+          "Variable-length dense feature '%s' requires a (scalar) default value.", dense_names[i].c_str());
+      return nullptr;
+    } else {
+      dense.default_value = tensorflow::Tensor(dense.dtype, tensorflow::TensorShape({0}));
+    }
+    config.dense.push_back(dense);
+    position += ranks[i];
+  }
+  for (jsize i = 0; i < num_sparse; ++i)
+    config.sparse.push_back({sparse_names[i], static_cast<tensorflow::DataType>(sparse_types[i])});
+
+  tensorflow::example::Result result;
+  tensorflow::Status s = tensorflow::example::ParseLengthPrefixedExamples(
+      data + offset, static_cast<size_t>(length), config, &result);
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), nullptr);
+  }
+
+  // The handles are returned in the order: sparse indices, sparse values, sparse shapes, and dense values.
+  const jsize num_handles = 3 * num_sparse + num_dense;
+  ArrayBuffer<jlong> handles(num_handles);
+  for (jsize i = 0; i < num_sparse; ++i) {
+    handles[i] = reinterpret_cast<jlong>(new TFE_TensorHandle(result.sparse_indices[i], nullptr));
+    handles[num_sparse + i] = reinterpret_cast<jlong>(new TFE_TensorHandle(result.sparse_values[i], nullptr));
+    handles[2 * num_sparse + i] = reinterpret_cast<jlong>(new TFE_TensorHandle(result.sparse_shapes[i], nullptr));
+  }
+  for (jsize i = 0; i < num_dense; ++i)
+    handles[3 * num_sparse + i] = reinterpret_cast<jlong>(new TFE_TensorHandle(result.dense_values[i], nullptr));
+  jlongArray handles_array = env->NewLongArray(num_handles);
+  env->SetLongArrayRegion(handles_array, 0, num_handles, handles.data());
+  return handles_array;
+}
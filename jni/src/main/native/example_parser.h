@@ -0,0 +1,21 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_ExampleParser__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_ExampleParser__
+#define _Included_org_platanios_tensorflow_jni_ExampleParser__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_ExampleParser__
+ * Method:    parseExamples
+ * Signature: (Ljava/nio/ByteBuffer;JJ[Ljava/lang/String;[I[I[J[J[Ljava/lang/String;[I)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_ExampleParser_00024_parseExamples
+  (JNIEnv *, jobject, jobject, jlong, jlong, jobjectArray, jintArray, jintArray, jlongArray, jlongArray, jobjectArray, jintArray);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
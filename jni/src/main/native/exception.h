@@ -18,7 +18,9 @@
 
 #include <jni.h>
 #include <stdlib.h>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "tensorflow/c/c_api.h"
 
@@ -136,16 +138,52 @@ inline TF_Code tf_error_code(std::string jvm_name) {
   }
 }
 
+// Returns a global reference to the exception class with the provided name. Classes are only looked up the first time
+// they are requested (or when the library is loaded, for the exceptions listed above), because "FindClass" is slow and
+// takes locks. Returns a null pointer, with an exception pending, if the class cannot be found.
+inline jclass jvm_exception_class(JNIEnv *env, const char *clazz) {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, jclass> *classes = new std::unordered_map<std::string, jclass>();
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = classes->find(clazz);
+  if (it != classes->end()) return it->second;
+  jclass local_class = env->FindClass(clazz);
+  if (local_class == nullptr) return nullptr;
+  jclass global_class = static_cast<jclass>(env->NewGlobalRef(local_class));
+  env->DeleteLocalRef(local_class);
+  classes->emplace(clazz, global_class);
+  return global_class;
+}
+
+// Looks up and caches all exception classes that may be thrown by the native library. Returns false if any of them
+// cannot be found.
+inline bool cache_jvm_exception_classes(JNIEnv *env) {
+  const char *classes[] = {
+      tf_cancelled_exception, tf_unknown_exception, tf_invalid_argument_exception, tf_deadline_exceeded_exception,
+      tf_not_found_exception, tf_already_exists_exception, tf_permission_denied_exception,
+      tf_unauthenticated_exception, tf_resource_exhausted_exception, tf_failed_precondition_exception,
+      tf_aborted_exception, tf_out_of_range_exception, tf_unimplemented_exception, tf_internal_exception,
+      tf_unavailable_exception, tf_data_loss_exception, jvm_illegal_argument_exception, jvm_security_exception,
+      jvm_illegal_state_exception, jvm_null_pointer_exception, jvm_index_out_of_bounds_exception,
+      jvm_unsupported_operation_exception};
+  for (const char *clazz : classes)
+    if (jvm_exception_class(env, clazz) == nullptr) return false;
+  return true;
+}
+
 inline void throw_exception(JNIEnv *env, const char *clazz, const char *fmt, ...) {
   va_list args;
   va_start(args, fmt);
   // Using vsnprintf() instead of vasprintf() because the latter doesn't seem to be easily available on Windows
   const size_t max_msg_len = 512;
   char *message = static_cast<char *>(malloc(max_msg_len));
-  if (vsnprintf(message, max_msg_len, fmt, args) >= 0)
-    env->ThrowNew(env->FindClass(clazz), message);
-  else
-    env->ThrowNew(env->FindClass(clazz), "");
+  jclass exception_class = jvm_exception_class(env, clazz);
+  if (exception_class != nullptr) {
+    if (vsnprintf(message, max_msg_len, fmt, args) >= 0)
+      env->ThrowNew(exception_class, message);
+    else
+      env->ThrowNew(exception_class, "");
+  }
   free(message);
   va_end(args);
 }
@@ -155,7 +193,8 @@ inline void throw_exception(JNIEnv *env, const char *clazz, const char *fmt, ...
 inline bool throw_exception_if_not_ok(JNIEnv *env, const TF_Status *status) {
   const char *clazz = jvm_exception_class_name(TF_GetCode(status));
   if (clazz == nullptr) return true;
-  env->ThrowNew(env->FindClass(clazz), TF_Message(status));
+  jclass exception_class = jvm_exception_class(env, clazz);
+  if (exception_class != nullptr) env->ThrowNew(exception_class, TF_Message(status));
   return false;
 }
 
@@ -14,13 +14,30 @@
  */
 
 #include "file_io.h"
+#include "jvm_cache.h"
 #include "utilities.h"
 
 #include <string.h>
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <vector>
 
+#if defined(__linux__)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "tensorflow/c/async_writable_file.h"
+#include "tensorflow/c/block_cache.h"
+#include "tensorflow/c/file_lister.h"
+#include "tensorflow/c/handle_tracker.h"
+#include "tensorflow/c/native_executor.h"
 #include "tensorflow/c/status_helper.h"
 #include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/io/buffered_inputstream.h"
 #include "tensorflow/core/lib/io/inputstream_interface.h"
@@ -29,6 +46,219 @@
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/file_statistics.h"
 #include "tensorflow/core/platform/file_system.h"
+#include "tensorflow/core/platform/mutex.h"
+
+namespace {
+  // Returns a pointer to the `length` bytes starting at `offset` in the provided direct byte buffer, or throws an
+  // `IllegalArgumentException` and returns `nullptr` if that range is not valid.
+  char* require_direct_buffer_range(JNIEnv* env, jobject buffer, jint offset, jint length) {
+    char* data = static_cast<char*>(env->GetDirectBufferAddress(buffer));
+    if (data == nullptr) {
+      throw_exception(env, jvm_illegal_argument_exception, "The provided buffer is not a direct buffer.");
+      return nullptr;
+    }
+    const jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (offset < 0 || length < 0 || static_cast<jlong>(offset) + static_cast<jlong>(length) > capacity) {
+      throw_exception(
+        env, jvm_illegal_argument_exception,
+        "Invalid range [%d, %d + %d) for a buffer with capacity %lld.", offset, offset, length,
+        static_cast<long long>(capacity));
+      return nullptr;
+    }
+    return data + offset;
+  }
+
+  // Calls `fn` with the `length` bytes starting at `offset` in the provided array, or throws an
+  // `IllegalArgumentException` if that range is not valid. The array elements are not pinned while `fn` runs, because
+  // it may block on I/O, and so they may be copied.
+  template<typename F>
+  void with_byte_array_range(JNIEnv* env, jbyteArray array, jint offset, jint length, F fn) {
+    const jsize array_length = env->GetArrayLength(array);
+    if (offset < 0 || length < 0 || static_cast<jlong>(offset) + static_cast<jlong>(length) > array_length) {
+      throw_exception(
+        env, jvm_illegal_argument_exception,
+        "Invalid range [%d, %d + %d) for an array with length %d.", offset, offset, length, array_length);
+      return;
+    }
+    jbyte* elements = env->GetByteArrayElements(array, nullptr);
+    fn(tensorflow::StringPiece(reinterpret_cast<const char*>(elements) + offset, static_cast<size_t>(length)));
+    env->ReleaseByteArrayElements(array, elements, JNI_ABORT);
+  }
+
+  // Returns the number of leading bytes of `data` that form valid UTF-8 sequences, which is `size` if all of `data` is
+  // valid UTF-8. Overlong encodings, surrogates, and code points above U+10FFFF are rejected.
+  size_t valid_utf8_prefix_length(const char* data, size_t size) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    size_t i = 0;
+    while (i < size) {
+      const unsigned char c = bytes[i];
+      if (c < 0x80) {
+        ++i;
+        continue;
+      }
+      size_t length;
+      unsigned char min_second = 0x80;
+      unsigned char max_second = 0xBF;
+      if (c >= 0xC2 && c <= 0xDF) {
+        length = 2;
+      } else if (c >= 0xE0 && c <= 0xEF) {
+        length = 3;
+        if (c == 0xE0) min_second = 0xA0;
+        if (c == 0xED) max_second = 0x9F;
+      } else if (c >= 0xF0 && c <= 0xF4) {
+        length = 4;
+        if (c == 0xF0) min_second = 0x90;
+        if (c == 0xF4) max_second = 0x8F;
+      } else {
+        return i;
+      }
+      if (i + length > size || bytes[i + 1] < min_second || bytes[i + 1] > max_second) return i;
+      for (size_t j = 2; j < length; ++j)
+        if ((bytes[i + j] & 0xC0) != 0x80) return i;
+      i += length;
+    }
+    return size;
+  }
+
+  // Maximum number of file system requests that are issued concurrently.
+  const int kMaxConcurrentFileIORequests = 16;
+
+  // Runs `fn(i)` for all `i` in `[0, n)` on the native executor and waits for all calls to complete.
+  template<typename F>
+  void parallel_for(size_t n, F fn) {
+    tensorflow::NativeExecutor::Global()->ParallelFor(
+        tensorflow::NativeExecutor::kFileIO, static_cast<tensorflow::int64>(n), kMaxConcurrentFileIORequests,
+        [&fn](tensorflow::int64 i) { fn(static_cast<size_t>(i)); });
+  }
+
+  // Returns the local path of `uri`, or an empty string if `uri` does not refer to the local file system.
+  std::string local_path(const std::string& uri) {
+    tensorflow::StringPiece scheme, host, path;
+    tensorflow::io::ParseURI(uri, &scheme, &host, &path);
+    if (!scheme.empty() && scheme != "file") return std::string();
+    return path.ToString();
+  }
+
+  // Copies the file at `src` to `dst` in the kernel, without transferring its contents through user space, if both
+  // files are on the local file system and the platform supports it. Returns `false` if the copy was not attempted or
+  // is not supported for these files, in which case the caller should fall back to copying the file contents itself.
+  bool copy_local_file(const std::string& src, const std::string& dst, tensorflow::Status* status) {
+#if defined(__linux__) && defined(SYS_copy_file_range)
+    const std::string src_path = local_path(src);
+    const std::string dst_path = local_path(dst);
+    if (src_path.empty() || dst_path.empty()) return false;
+    int src_fd = open(src_path.c_str(), O_RDONLY);
+    if (src_fd < 0) return false;
+    off_t length = lseek(src_fd, 0, SEEK_END);
+    if (length < 0) {
+      close(src_fd);
+      return false;
+    }
+    loff_t src_offset = 0;
+    int dst_fd = open(dst_path.c_str(), O_WRONLY | O_CREAT, 0644);
+    if (dst_fd < 0) {
+      close(src_fd);
+      return false;
+    }
+    if (ftruncate(dst_fd, 0) != 0) {
+      close(dst_fd);
+      close(src_fd);
+      return false;
+    }
+    bool copied = true;
+    while (src_offset < length) {
+      ssize_t n = syscall(
+        SYS_copy_file_range, src_fd, &src_offset, dst_fd, nullptr, static_cast<size_t>(length - src_offset), 0);
+      if (n < 0) {
+        // Older kernels and some file system combinations do not support in-kernel copies.
+        if (src_offset == 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP)) {
+          copied = false;
+        } else {
+          *status = tensorflow::errors::Internal(
+            "Failed to copy '", src, "' to '", dst, "': ", strerror(errno));
+        }
+        break;
+      }
+      if (n == 0) break;
+    }
+    close(dst_fd);
+    close(src_fd);
+    return copied;
+#else
+    return false;
+#endif
+  }
+
+  // Copies the file at `src` to `dst` in chunks of `chunk_size` bytes. Chunks are read on a separate thread, while the
+  // previously read chunks are being written, and at most `kMaxPendingChunks` chunks are held in memory at any time.
+  tensorflow::Status copy_file_in_chunks(const std::string& src, const std::string& dst, size_t chunk_size) {
+    constexpr size_t kMaxPendingChunks = 4;
+    tensorflow::Env* env = tensorflow::Env::Default();
+    std::unique_ptr<tensorflow::RandomAccessFile> src_file;
+    TF_RETURN_IF_ERROR(env->NewRandomAccessFile(src, &src_file));
+    std::unique_ptr<tensorflow::WritableFile> dst_file;
+    TF_RETURN_IF_ERROR(env->NewWritableFile(dst, &dst_file));
+
+    tensorflow::mutex mu;
+    tensorflow::condition_variable cv;
+    std::deque<std::string> chunks;
+    bool done = false;
+    bool cancelled = false;
+    tensorflow::Status read_status;
+
+    std::unique_ptr<tensorflow::Thread> reader(env->StartThread(
+      tensorflow::ThreadOptions(), "copy_file_reader", [&]() {
+        tensorflow::uint64 offset = 0;
+        tensorflow::Status s;
+        while (true) {
+          std::string chunk(chunk_size, '\0');
+          tensorflow::StringPiece result;
+          s = src_file->Read(offset, chunk_size, &result, &chunk[0]);
+          if (!s.ok() && s.code() != tensorflow::error::OUT_OF_RANGE) break;
+          const bool end_of_file = !s.ok() || result.size() < chunk_size;
+          s = tensorflow::Status::OK();
+          if (result.data() != chunk.data()) memmove(&chunk[0], result.data(), result.size());
+          chunk.resize(result.size());
+          offset += result.size();
+          tensorflow::mutex_lock lock(mu);
+          while (!cancelled && chunks.size() >= kMaxPendingChunks) cv.wait(lock);
+          if (cancelled) break;
+          if (!chunk.empty()) chunks.push_back(std::move(chunk));
+          cv.notify_all();
+          if (end_of_file) break;
+        }
+        tensorflow::mutex_lock lock(mu);
+        read_status = s;
+        done = true;
+        cv.notify_all();
+      }));
+
+    tensorflow::Status write_status;
+    while (true) {
+      std::string chunk;
+      {
+        tensorflow::mutex_lock lock(mu);
+        while (chunks.empty() && !done) cv.wait(lock);
+        if (chunks.empty()) break;
+        chunk = std::move(chunks.front());
+        chunks.pop_front();
+        cv.notify_all();
+      }
+      write_status = dst_file->Append(chunk);
+      if (!write_status.ok()) {
+        tensorflow::mutex_lock lock(mu);
+        cancelled = true;
+        cv.notify_all();
+        break;
+      }
+    }
+    // Joins the reader thread.
+    reader.reset();
+    TF_RETURN_IF_ERROR(read_status);
+    TF_RETURN_IF_ERROR(write_status);
+    return dst_file->Close();
+  }
+}  // namespace
 
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_fileExists(
     JNIEnv* env, jobject object, jstring filename) {
@@ -69,6 +299,32 @@ JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readFil
   return env->NewStringUTF(file_content.c_str());
 }
 
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readFileInto(
+    JNIEnv* env, jobject object, jstring filename, jlong file_offset, jobject buffer, jint offset, jint length) {
+  char* data = require_direct_buffer_range(env, buffer, offset, length);
+  if (data == nullptr) return 0;
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  std::unique_ptr<tensorflow::RandomAccessFile> file;
+  tensorflow::Status s = tensorflow::NewCachedRandomAccessFile(std::string(c_filename), &file);
+  env->ReleaseStringUTFChars(filename, c_filename);
+  tensorflow::StringPiece result;
+  if (s.ok()) {
+    // The buffer is used as the scratch space of the read and so, for most file systems, the data is read directly into
+    // it. File systems that return data they already hold in memory (e.g., memory-mapped files) require a copy.
+    s = file->Read(static_cast<tensorflow::uint64>(file_offset), static_cast<size_t>(length), &result, data);
+    if (s.ok() || s.code() == tensorflow::error::OUT_OF_RANGE) {
+      if (result.data() != data) memmove(data, result.data(), result.size());
+      s = tensorflow::Status::OK();
+    }
+  }
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), 0);
+  }
+  return static_cast<jint>(result.size());
+}
+
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_writeStringToFile(
     JNIEnv* env, jobject object, jstring filename, jstring content) {
   const char* c_filename = env->GetStringUTFChars(filename, nullptr);
@@ -95,10 +351,11 @@ JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_ge
     Set_TF_Status_from_Status(status.get(), s);
     CHECK_STATUS(env, status.get(), nullptr);
   }
-  jclass string_class = env->FindClass("java/lang/String");
-  jobjectArray children_array = env->NewObjectArray(children.size(), string_class, NULL);
+  jobjectArray children_array = env->NewObjectArray(children.size(), jvm_cache().string_class, NULL);
   for (int i = 0; i < children.size(); ++i) {
-    env->SetObjectArrayElement(children_array, i, env->NewStringUTF(children[i].c_str()));
+    jstring child = env->NewStringUTF(children[i].c_str());
+    env->SetObjectArrayElement(children_array, i, child);
+    env->DeleteLocalRef(child);
   }
   return children_array;
 }
@@ -114,14 +371,73 @@ JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_ge
     Set_TF_Status_from_Status(status.get(), s);
     CHECK_STATUS(env, status.get(), nullptr);
   }
-  jclass string_class = env->FindClass("java/lang/String");
-  jobjectArray children_array = env->NewObjectArray(children.size(), string_class, NULL);
+  jobjectArray children_array = env->NewObjectArray(children.size(), jvm_cache().string_class, NULL);
   for (int i = 0; i < children.size(); ++i) {
-    env->SetObjectArrayElement(children_array, i, env->NewStringUTF(children[i].c_str()));
+    jstring child = env->NewStringUTF(children[i].c_str());
+    env->SetObjectArrayElement(children_array, i, child);
+    env->DeleteLocalRef(child);
   }
   return children_array;
 }
 
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_newFileLister(
+    JNIEnv* env, jobject object, jstring pattern, jint num_threads, jboolean recursive, jboolean with_statistics) {
+  const char* c_pattern = env->GetStringUTFChars(pattern, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* lister = tensorflow::io::FileLister::New(
+    std::string(c_pattern), static_cast<int>(num_threads), recursive == JNI_TRUE, with_statistics == JNI_TRUE,
+    status.get());
+  env->ReleaseStringUTFChars(pattern, c_pattern);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(lister);
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_fileListerNext(
+    JNIEnv* env, jobject object, jlong lister_handle, jint max_entries) {
+  REQUIRE_HANDLE(lister, tensorflow::io::FileLister, lister_handle, nullptr);
+  if (max_entries <= 0) {
+    throw_exception(env, jvm_illegal_argument_exception, "The maximum number of entries must be positive.");
+    return nullptr;
+  }
+  std::vector<tensorflow::io::FileLister::Entry> entries;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  if (!lister->Next(static_cast<size_t>(max_entries), &entries, status.get())) {
+    CHECK_STATUS(env, status.get(), nullptr);
+    return nullptr;
+  }
+  const jsize num_entries = static_cast<jsize>(entries.size());
+  const JVMCache& cache = jvm_cache();
+  jobjectArray paths = env->NewObjectArray(num_entries, cache.string_class, nullptr);
+  for (jsize i = 0; i < num_entries; ++i) {
+    jstring path = env->NewStringUTF(entries[i].path.c_str());
+    env->SetObjectArrayElement(paths, i, path);
+    env->DeleteLocalRef(path);
+  }
+  jlongArray lengths = env->NewLongArray(num_entries);
+  jlongArray last_modified_times = env->NewLongArray(num_entries);
+  jbooleanArray is_directory = env->NewBooleanArray(num_entries);
+  ArrayBuffer<jlong> lengths_buffer(num_entries);
+  ArrayBuffer<jlong> last_modified_times_buffer(num_entries);
+  ArrayBuffer<jboolean> is_directory_buffer(num_entries);
+  for (jsize i = 0; i < num_entries; ++i) {
+    const tensorflow::FileStatistics& statistics = entries[i].statistics;
+    lengths_buffer[i] = static_cast<jlong>(statistics.length);
+    last_modified_times_buffer[i] = static_cast<jlong>(statistics.mtime_nsec);
+    is_directory_buffer[i] = static_cast<jboolean>(statistics.is_directory);
+  }
+  env->SetLongArrayRegion(lengths, 0, num_entries, lengths_buffer.data());
+  env->SetLongArrayRegion(last_modified_times, 0, num_entries, last_modified_times_buffer.data());
+  env->SetBooleanArrayRegion(is_directory, 0, num_entries, is_directory_buffer.data());
+  return env->CallStaticObjectMethod(
+    cache.file_listing_class, cache.file_listing_apply, paths, lengths, last_modified_times, is_directory);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_deleteFileLister(
+    JNIEnv* env, jobject object, jlong lister_handle) {
+  REQUIRE_HANDLE(lister, tensorflow::io::FileLister, lister_handle, void());
+  delete lister;
+}
+
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_mkDir(
     JNIEnv* env, jobject object, jstring dirname) {
   const char* c_dirname = env->GetStringUTFChars(dirname, nullptr);
@@ -147,7 +463,11 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_mkDirs(
 }
 
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_copyFile(
-    JNIEnv* env, jobject object, jstring old_path, jstring new_path, jboolean overwrite) {
+    JNIEnv* env, jobject object, jstring old_path, jstring new_path, jboolean overwrite, jlong chunk_size) {
+  if (chunk_size <= 0) {
+    throw_exception(env, jvm_illegal_argument_exception, "The chunk size must be positive.");
+    return;
+  }
   const char* c_old_path = env->GetStringUTFChars(old_path, nullptr);
   const char* c_new_path = env->GetStringUTFChars(new_path, nullptr);
   std::string cpp_old_path = std::string(c_old_path);
@@ -160,17 +480,11 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_copyFile(
     env->ReleaseStringUTFChars(old_path, c_old_path);
     CHECK_STATUS(env, status.get(), void());
   }
-  std::string file_content;
-  tensorflow::Status s = tensorflow::ReadFileToString(tensorflow::Env::Default(), cpp_old_path, &file_content);
-  if (!s.ok()) {
-    Set_TF_Status_from_Status(status.get(), s);
-    env->ReleaseStringUTFChars(new_path, c_new_path);
-    env->ReleaseStringUTFChars(old_path, c_old_path);
-    CHECK_STATUS(env, status.get(), void());
-  }
-  s = tensorflow::WriteStringToFile(tensorflow::Env::Default(), cpp_new_path, file_content);
   env->ReleaseStringUTFChars(new_path, c_new_path);
   env->ReleaseStringUTFChars(old_path, c_old_path);
+  tensorflow::Status s;
+  if (!copy_local_file(cpp_old_path, cpp_new_path, &s) && s.ok())
+    s = copy_file_in_chunks(cpp_old_path, cpp_new_path, static_cast<size_t>(chunk_size));
   if (!s.ok()) {
     Set_TF_Status_from_Status(status.get(), s);
     CHECK_STATUS(env, status.get(), void());
@@ -239,28 +553,84 @@ JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_isDire
 JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_statistics(
     JNIEnv* env, jobject object, jstring path) {
   const char* c_path = env->GetStringUTFChars(path, nullptr);
-  tensorflow::FileStatistics* statistics = new tensorflow::FileStatistics();
-  tensorflow::Status s = tensorflow::Env::Default()->Stat(std::string(c_path), statistics);
+  tensorflow::FileStatistics statistics;
+  tensorflow::Status s = tensorflow::Env::Default()->Stat(std::string(c_path), &statistics);
   env->ReleaseStringUTFChars(path, c_path);
   if (!s.ok()) {
     std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
     Set_TF_Status_from_Status(status.get(), s);
     CHECK_STATUS(env, status.get(), nullptr);
   }
-  jclass file_statistics_class = env->FindClass("org/platanios/tensorflow/jni/FileStatistics");
-  jmethodID file_statistics_constructor = env->GetStaticMethodID(
-      file_statistics_class, "apply", "(JJZ)Lorg/platanios/tensorflow/jni/FileStatistics;");
+  const JVMCache& cache = jvm_cache();
   return env->CallStaticObjectMethod(
-    file_statistics_class, file_statistics_constructor,
-    static_cast<jlong>(statistics->length), static_cast<jlong>(statistics->mtime_nsec),
-    static_cast<jboolean>(statistics->is_directory));
+    cache.file_statistics_class, cache.file_statistics_apply,
+    static_cast<jlong>(statistics.length), static_cast<jlong>(statistics.mtime_nsec),
+    static_cast<jboolean>(statistics.is_directory));
+}
+
+JNIEXPORT jbooleanArray JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_existsMany(
+    JNIEnv* env, jobject object, jobjectArray paths) {
+  const std::vector<std::string> cpp_paths = to_string_vector(env, paths);
+  const jsize num_paths = static_cast<jsize>(cpp_paths.size());
+  ArrayBuffer<jboolean> exists(num_paths);
+  std::vector<tensorflow::Status> statuses(cpp_paths.size());
+  parallel_for(cpp_paths.size(), [&](size_t i) {
+    statuses[i] = tensorflow::Env::Default()->FileExists(cpp_paths[i]);
+  });
+  for (jsize i = 0; i < num_paths; ++i) {
+    const tensorflow::Status& s = statuses[i];
+    if (!s.ok() && !tensorflow::errors::IsNotFound(s)) {
+      std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+      Set_TF_Status_from_Status(status.get(), s);
+      CHECK_STATUS(env, status.get(), nullptr);
+    }
+    exists[i] = static_cast<jboolean>(s.ok());
+  }
+  jbooleanArray result = env->NewBooleanArray(num_paths);
+  env->SetBooleanArrayRegion(result, 0, num_paths, exists.data());
+  return result;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_statisticsMany(
+    JNIEnv* env, jobject object, jobjectArray paths, jlongArray lengths, jlongArray last_modified_times,
+    jbyteArray kinds) {
+  const std::vector<std::string> cpp_paths = to_string_vector(env, paths);
+  const jsize num_paths = static_cast<jsize>(cpp_paths.size());
+  if (env->GetArrayLength(lengths) < num_paths || env->GetArrayLength(last_modified_times) < num_paths ||
+      env->GetArrayLength(kinds) < num_paths) {
+    throw_exception(env, jvm_illegal_argument_exception, "The output arrays are shorter than the paths array.");
+    return;
+  }
+  std::vector<tensorflow::FileStatistics> statistics(cpp_paths.size());
+  std::vector<tensorflow::Status> statuses(cpp_paths.size());
+  parallel_for(cpp_paths.size(), [&](size_t i) {
+    statuses[i] = tensorflow::Env::Default()->Stat(cpp_paths[i], &statistics[i]);
+  });
+  ArrayBuffer<jlong> lengths_buffer(num_paths);
+  ArrayBuffer<jlong> last_modified_times_buffer(num_paths);
+  ArrayBuffer<jbyte> kinds_buffer(num_paths);
+  for (jsize i = 0; i < num_paths; ++i) {
+    const tensorflow::Status& s = statuses[i];
+    if (!s.ok() && !tensorflow::errors::IsNotFound(s)) {
+      std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+      Set_TF_Status_from_Status(status.get(), s);
+      CHECK_STATUS(env, status.get(), void());
+    }
+    lengths_buffer[i] = s.ok() ? static_cast<jlong>(statistics[i].length) : -1;
+    last_modified_times_buffer[i] = s.ok() ? static_cast<jlong>(statistics[i].mtime_nsec) : -1;
+    // 0 denotes missing paths, 1 files, and 2 directories.
+    kinds_buffer[i] = static_cast<jbyte>(!s.ok() ? 0 : statistics[i].is_directory ? 2 : 1);
+  }
+  env->SetLongArrayRegion(lengths, 0, num_paths, lengths_buffer.data());
+  env->SetLongArrayRegion(last_modified_times, 0, num_paths, last_modified_times_buffer.data());
+  env->SetByteArrayRegion(kinds, 0, num_paths, kinds_buffer.data());
 }
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_newBufferedInputStream(
     JNIEnv* env, jobject object, jstring filename, jlong buffer_size) {
   const char* c_filename = env->GetStringUTFChars(filename, nullptr);
   std::unique_ptr<tensorflow::RandomAccessFile> file;
-  tensorflow::Status s = tensorflow::Env::Default()->NewRandomAccessFile(std::string(c_filename), &file);
+  tensorflow::Status s = tensorflow::NewCachedRandomAccessFile(std::string(c_filename), &file);
   env->ReleaseStringUTFChars(filename, c_filename);
   if (!s.ok()) {
     std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
@@ -272,6 +642,9 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_newBuffer
   std::unique_ptr<tensorflow::io::BufferedInputStream> buffered_input_stream(
     new tensorflow::io::BufferedInputStream(input_stream.release(), static_cast<size_t>(buffer_size),
     true /* owns_input_stream */));
+  tensorflow::HandleTracker::Global()->Track(
+      tensorflow::HandleTracker::kBufferedInputStream, buffered_input_stream.get(),
+      static_cast<tensorflow::int64>(buffer_size));
   return reinterpret_cast<jlong>(buffered_input_stream.release());
 }
 
@@ -288,12 +661,85 @@ JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readFro
   return env->NewStringUTF(result.c_str());
 }
 
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readFromBufferedInputStreamInto(
+    JNIEnv* env, jobject object, jlong buffered_input_stream_handle, jobject buffer, jint offset, jint length) {
+  REQUIRE_HANDLE(buffered_input_stream, tensorflow::io::BufferedInputStream, buffered_input_stream_handle, 0);
+  char* data = require_direct_buffer_range(env, buffer, offset, length);
+  if (data == nullptr) return 0;
+  // The buffered input stream only supports reading into strings and so the data is copied once, from the string into
+  // the buffer. This still avoids the modified UTF-8 encoding and the allocation of a JVM string.
+  std::string result;
+  tensorflow::Status s = buffered_input_stream->ReadNBytes(static_cast<tensorflow::int64>(length), &result);
+  if (!s.ok() && s.code() != tensorflow::error::OUT_OF_RANGE) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), 0);
+  }
+  memcpy(data, result.data(), result.size());
+  return static_cast<jint>(result.size());
+}
+
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readLineAsStringFromBufferedInputStream(
     JNIEnv* env, jobject object, jlong buffered_input_stream_handle) {
   REQUIRE_HANDLE(buffered_input_stream, tensorflow::io::BufferedInputStream, buffered_input_stream_handle, 0);
   return env->NewStringUTF(buffered_input_stream->ReadLineAsString().c_str());
 }
 
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readLinesFromBufferedInputStream(
+    JNIEnv* env, jobject object, jlong buffered_input_stream_handle, jobject buffer, jint offset, jint length,
+    jintArray offsets, jboolean keep_new_lines, jboolean validate_utf8) {
+  REQUIRE_HANDLE(buffered_input_stream, tensorflow::io::BufferedInputStream, buffered_input_stream_handle, 0);
+  char* data = require_direct_buffer_range(env, buffer, offset, length);
+  if (data == nullptr) return 0;
+  const jsize max_lines = env->GetArrayLength(offsets) - 1;
+  if (max_lines < 0) {
+    throw_exception(env, jvm_illegal_argument_exception, "The offsets array must contain at least one element.");
+    return 0;
+  }
+  // The lines are read one at a time by the stream, but they are packed natively, and so reading a batch of lines only
+  // requires a single JNI call, instead of one call and one JVM string per line.
+  std::vector<jint> line_offsets;
+  line_offsets.reserve(static_cast<size_t>(max_lines) + 1);
+  line_offsets.push_back(offset);
+  jint size = 0;
+  tensorflow::Status s;
+  while (static_cast<jsize>(line_offsets.size()) <= max_lines) {
+    const tensorflow::int64 position = buffered_input_stream->Tell();
+    // An empty result marks the end of the file, since all other lines contain at least their new-line character.
+    std::string line = buffered_input_stream->ReadLineAsString();
+    if (line.empty()) break;
+    if (!keep_new_lines && line.back() == '\n') line.pop_back();
+    if (static_cast<jlong>(line.size()) > static_cast<jlong>(length - size)) {
+      // The line is read again by the next call, which must provide a larger buffer if this is the first line.
+      s = buffered_input_stream->Seek(position);
+      if (s.ok() && line_offsets.size() == 1) {
+        env->SetIntArrayRegion(offsets, 0, 1, line_offsets.data());
+        return -1;
+      }
+      break;
+    }
+    if (validate_utf8 == JNI_TRUE) {
+      const size_t valid_length = valid_utf8_prefix_length(line.data(), line.size());
+      if (valid_length != line.size()) {
+        s = tensorflow::errors::InvalidArgument(
+            "Invalid UTF-8 byte at position ", position + static_cast<tensorflow::int64>(valid_length),
+            " of the file.");
+        break;
+      }
+    }
+    memcpy(data + size, line.data(), line.size());
+    size += static_cast<jint>(line.size());
+    line_offsets.push_back(offset + size);
+  }
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), 0);
+  }
+  env->SetIntArrayRegion(offsets, 0, static_cast<jsize>(line_offsets.size()), line_offsets.data());
+  return static_cast<jint>(line_offsets.size() - 1);
+}
+
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_tellBufferedInputStream(
     JNIEnv* env, jobject object, jlong buffered_input_stream_handle) {
   REQUIRE_HANDLE(buffered_input_stream, tensorflow::io::BufferedInputStream, buffered_input_stream_handle, 0);
@@ -314,6 +760,7 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_seekBuffer
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_deleteBufferedInputStream(
     JNIEnv* env, jobject object, jlong buffered_input_stream_handle) {
   REQUIRE_HANDLE(buffered_input_stream, tensorflow::io::BufferedInputStream, buffered_input_stream_handle, void());
+  tensorflow::HandleTracker::Global()->Untrack(buffered_input_stream);
   delete buffered_input_stream;
 }
 
@@ -351,6 +798,31 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_appendToWr
   }
 }
 
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_appendBytesToWritableFile(
+    JNIEnv* env, jobject object, jlong file_handle, jbyteArray content, jint offset, jint length) {
+  REQUIRE_HANDLE(file, tensorflow::WritableFile, file_handle, void());
+  tensorflow::Status s;
+  with_byte_array_range(env, content, offset, length, [&](tensorflow::StringPiece data) { s = file->Append(data); });
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), void());
+  }
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_appendBufferToWritableFile(
+    JNIEnv* env, jobject object, jlong file_handle, jobject buffer, jint offset, jint length) {
+  REQUIRE_HANDLE(file, tensorflow::WritableFile, file_handle, void());
+  const char* data = require_direct_buffer_range(env, buffer, offset, length);
+  if (data == nullptr) return;
+  tensorflow::Status s = file->Append(tensorflow::StringPiece(data, static_cast<size_t>(length)));
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), void());
+  }
+}
+
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_flushWritableFile(
     JNIEnv* env, jobject object, jlong file_handle) {
   REQUIRE_HANDLE(file, tensorflow::WritableFile, file_handle, void());
@@ -362,14 +834,117 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_flushWrita
   }
 }
 
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_syncWritableFile(
+    JNIEnv* env, jobject object, jlong file_handle) {
+  REQUIRE_HANDLE(file, tensorflow::WritableFile, file_handle, void());
+  tensorflow::Status s = file->Sync();
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), void());
+  }
+}
+
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_deleteWritableFile(
     JNIEnv* env, jobject object, jlong file_handle) {
   REQUIRE_HANDLE(file, tensorflow::WritableFile, file_handle, void());
   tensorflow::Status s = file->Close();
+  // The file is deleted even if closing it failed, because its handle is not usable anymore.
+  delete file;
   if (!s.ok()) {
     std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
     Set_TF_Status_from_Status(status.get(), s);
     CHECK_STATUS(env, status.get(), void());
   }
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_newAsyncWritableFile(
+    JNIEnv* env, jobject object, jstring filename, jboolean append, jlong buffer_size) {
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* file = tensorflow::io::AsyncWritableFile::New(
+    std::string(c_filename), append == JNI_TRUE, static_cast<size_t>(buffer_size), status.get());
+  env->ReleaseStringUTFChars(filename, c_filename);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(file);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileAppendBytes(
+    JNIEnv* env, jobject object, jlong file_handle, jbyteArray content, jint offset, jint length) {
+  REQUIRE_HANDLE(file, tensorflow::io::AsyncWritableFile, file_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  with_byte_array_range(
+    env, content, offset, length, [&](tensorflow::StringPiece data) { file->Append(data, status.get()); });
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileAppendBuffer(
+    JNIEnv* env, jobject object, jlong file_handle, jobject buffer, jint offset, jint length) {
+  REQUIRE_HANDLE(file, tensorflow::io::AsyncWritableFile, file_handle, void());
+  const char* data = require_direct_buffer_range(env, buffer, offset, length);
+  if (data == nullptr) return;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  file->Append(tensorflow::StringPiece(data, static_cast<size_t>(length)), status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileFlush(
+    JNIEnv* env, jobject object, jlong file_handle) {
+  REQUIRE_HANDLE(file, tensorflow::io::AsyncWritableFile, file_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  file->Flush(status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileSync(
+    JNIEnv* env, jobject object, jlong file_handle) {
+  REQUIRE_HANDLE(file, tensorflow::io::AsyncWritableFile, file_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  file->Sync(status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileClose(
+    JNIEnv* env, jobject object, jlong file_handle) {
+  REQUIRE_HANDLE(file, tensorflow::io::AsyncWritableFile, file_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  file->Close(status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_deleteAsyncWritableFile(
+    JNIEnv* env, jobject object, jlong file_handle) {
+  REQUIRE_HANDLE(file, tensorflow::io::AsyncWritableFile, file_handle, void());
   delete file;
 }
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_enableBlockCache(
+    JNIEnv* env, jobject object, jstring directory, jlong capacity_bytes, jlong block_size) {
+  const char* c_directory = env->GetStringUTFChars(directory, nullptr);
+  tensorflow::Status s = tensorflow::BlockCache::Global()->Enable(
+      std::string(c_directory), static_cast<tensorflow::int64>(capacity_bytes),
+      static_cast<tensorflow::int64>(block_size));
+  env->ReleaseStringUTFChars(directory, c_directory);
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), void());
+  }
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_disableBlockCache(
+    JNIEnv* env, jobject object) {
+  tensorflow::BlockCache::Global()->Disable();
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_blockCacheStatistics(
+    JNIEnv* env, jobject object) {
+  const tensorflow::BlockCache::Statistics statistics = tensorflow::BlockCache::Global()->statistics();
+  const jlong values[] = {
+      statistics.hits, statistics.misses, statistics.bytes_saved, statistics.bytes_fetched, statistics.evictions,
+      statistics.cached_bytes, statistics.cached_blocks};
+  const jsize num_values = static_cast<jsize>(sizeof(values) / sizeof(values[0]));
+  jlongArray result = env->NewLongArray(num_values);
+  env->SetLongArrayRegion(result, 0, num_values, values);
+  return result;
+}
@@ -31,6 +31,14 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_deleteFile
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readFileToString
   (JNIEnv *, jobject, jstring);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    readFileInto
+ * Signature: (Ljava/lang/String;JLjava/nio/ByteBuffer;II)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readFileInto
+  (JNIEnv *, jobject, jstring, jlong, jobject, jint, jint);
+
 /*
  * Class:     org_platanios_tensorflow_jni_FileIO__
  * Method:    writeStringToFile
@@ -55,6 +63,30 @@ JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_ge
 JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_getMatchingFiles
   (JNIEnv *, jobject, jstring);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    newFileLister
+ * Signature: (Ljava/lang/String;IZZ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_newFileLister
+  (JNIEnv *, jobject, jstring, jint, jboolean, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    fileListerNext
+ * Signature: (JI)Lorg/platanios/tensorflow/jni/FileListing;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_fileListerNext
+  (JNIEnv *, jobject, jlong, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    deleteFileLister
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_deleteFileLister
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     org_platanios_tensorflow_jni_FileIO__
  * Method:    mkDir
@@ -74,10 +106,10 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_mkDirs
 /*
  * Class:     org_platanios_tensorflow_jni_FileIO__
  * Method:    copyFile
- * Signature: (Ljava/lang/String;Ljava/lang/String;B)V
+ * Signature: (Ljava/lang/String;Ljava/lang/String;ZJ)V
  */
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_copyFile
-  (JNIEnv *, jobject, jstring, jstring, jboolean);
+  (JNIEnv *, jobject, jstring, jstring, jboolean, jlong);
 
 /*
  * Class:     org_platanios_tensorflow_jni_FileIO__
@@ -111,6 +143,22 @@ JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_isDire
 JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_statistics
   (JNIEnv *, jobject, jstring);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    existsMany
+ * Signature: ([Ljava/lang/String;)[Z
+ */
+JNIEXPORT jbooleanArray JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_existsMany
+  (JNIEnv *, jobject, jobjectArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    statisticsMany
+ * Signature: ([Ljava/lang/String;[J[J[B)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_statisticsMany
+  (JNIEnv *, jobject, jobjectArray, jlongArray, jlongArray, jbyteArray);
+
 /*
  * Class:     org_platanios_tensorflow_jni_FileIO__
  * Method:    newBufferedInputStream
@@ -127,6 +175,22 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_newBuffer
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readFromBufferedInputStream
   (JNIEnv *, jobject, jlong, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    readFromBufferedInputStreamInto
+ * Signature: (JLjava/nio/ByteBuffer;II)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readFromBufferedInputStreamInto
+  (JNIEnv *, jobject, jlong, jobject, jint, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    readLinesFromBufferedInputStream
+ * Signature: (JLjava/nio/ByteBuffer;II[IZZ)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_readLinesFromBufferedInputStream
+  (JNIEnv *, jobject, jlong, jobject, jint, jint, jintArray, jboolean, jboolean);
+
 /*
  * Class:     org_platanios_tensorflow_jni_FileIO__
  * Method:    readLineAsStringFromBufferedInputStream
@@ -175,6 +239,22 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_newWritab
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_appendToWritableFile
   (JNIEnv *, jobject, jlong, jstring);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    appendBytesToWritableFile
+ * Signature: (J[BII)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_appendBytesToWritableFile
+  (JNIEnv *, jobject, jlong, jbyteArray, jint, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    appendBufferToWritableFile
+ * Signature: (JLjava/nio/ByteBuffer;II)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_appendBufferToWritableFile
+  (JNIEnv *, jobject, jlong, jobject, jint, jint);
+
 /*
  * Class:     org_platanios_tensorflow_jni_FileIO__
  * Method:    flushWritableFile
@@ -183,6 +263,14 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_appendToWr
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_flushWritableFile
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    syncWritableFile
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_syncWritableFile
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     org_platanios_tensorflow_jni_FileIO__
  * Method:    deleteWritableFile
@@ -191,6 +279,86 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_flushWrita
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_deleteWritableFile
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    newAsyncWritableFile
+ * Signature: (Ljava/lang/String;ZJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_newAsyncWritableFile
+  (JNIEnv *, jobject, jstring, jboolean, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    asyncWritableFileAppendBytes
+ * Signature: (J[BII)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileAppendBytes
+  (JNIEnv *, jobject, jlong, jbyteArray, jint, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    asyncWritableFileAppendBuffer
+ * Signature: (JLjava/nio/ByteBuffer;II)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileAppendBuffer
+  (JNIEnv *, jobject, jlong, jobject, jint, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    asyncWritableFileFlush
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileFlush
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    asyncWritableFileSync
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileSync
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    asyncWritableFileClose
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_asyncWritableFileClose
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    deleteAsyncWritableFile
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_deleteAsyncWritableFile
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    enableBlockCache
+ * Signature: (Ljava/lang/String;JJ)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_enableBlockCache
+  (JNIEnv *, jobject, jstring, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    disableBlockCache
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_disableBlockCache
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FileIO__
+ * Method:    blockCacheStatistics
+ * Signature: ()[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_FileIO_00024_blockCacheStatistics
+  (JNIEnv *, jobject);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,71 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "fixed_length_record_reader.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+#include <string>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/parallel_fixed_length_reader.h"
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_newParallelFixedLengthReader(
+    JNIEnv* env, jobject object, jstring filename, jlong header_bytes, jlong record_bytes, jlong footer_bytes,
+    jlong records_per_batch, jint num_threads, jint max_buffered_batches, jboolean use_direct_io) {
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* reader = tensorflow::ParallelFixedLengthReader::New(
+      std::string(c_filename), static_cast<tensorflow::int64>(header_bytes),
+      static_cast<tensorflow::int64>(record_bytes), static_cast<tensorflow::int64>(footer_bytes),
+      static_cast<tensorflow::int64>(records_per_batch), static_cast<int>(num_threads),
+      static_cast<int>(max_buffered_batches), static_cast<bool>(use_direct_io), status.get());
+  env->ReleaseStringUTFChars(filename, c_filename);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(reader);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_parallelFixedLengthReaderNumRecords(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::ParallelFixedLengthReader, reader_handle, 0);
+  return static_cast<jlong>(reader->num_records());
+}
+
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_parallelFixedLengthReaderDirectIO(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::ParallelFixedLengthReader, reader_handle, JNI_FALSE);
+  return static_cast<jboolean>(reader->direct_io());
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_parallelFixedLengthReaderNext(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::ParallelFixedLengthReader, reader_handle, 0);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Tensor* batch = reader->Next(status.get());
+  CHECK_STATUS(env, status.get(), 0);
+  if (batch == nullptr) return 0;
+  TFE_TensorHandle* tensor_handle = TFE_NewTensorHandle(batch, status.get());
+  TF_DeleteTensor(batch);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(tensor_handle);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_deleteParallelFixedLengthReader(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::ParallelFixedLengthReader, reader_handle, void());
+  delete reader;
+}
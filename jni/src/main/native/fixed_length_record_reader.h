@@ -0,0 +1,53 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_FixedLengthRecordReader__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_FixedLengthRecordReader__
+#define _Included_org_platanios_tensorflow_jni_FixedLengthRecordReader__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_FixedLengthRecordReader__
+ * Method:    newParallelFixedLengthReader
+ * Signature: (Ljava/lang/String;JJJJIIZ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_newParallelFixedLengthReader
+  (JNIEnv *, jobject, jstring, jlong, jlong, jlong, jlong, jint, jint, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FixedLengthRecordReader__
+ * Method:    parallelFixedLengthReaderNumRecords
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_parallelFixedLengthReaderNumRecords
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FixedLengthRecordReader__
+ * Method:    parallelFixedLengthReaderDirectIO
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_parallelFixedLengthReaderDirectIO
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FixedLengthRecordReader__
+ * Method:    parallelFixedLengthReaderNext
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_parallelFixedLengthReaderNext
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_FixedLengthRecordReader__
+ * Method:    deleteParallelFixedLengthReader
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_FixedLengthRecordReader_00024_deleteParallelFixedLengthReader
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -19,8 +19,11 @@
 
 #include <limits>
 #include <memory>
+#include <string>
 
 #include "tensorflow/c/c_api.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/platform/env.h"
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Function_00024_graphToFunction(
   JNIEnv* env, jobject object, jlong fn_body_graph_handle, jstring fn_name, jboolean append_hash_to_fn_name,
@@ -110,6 +113,26 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Function_00024_to
   return return_array;
 }
 
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Function_00024_toFunctionDefFile(
+    JNIEnv* env, jobject object, jlong function_handle, jstring filename) {
+  REQUIRE_HANDLE(function, TF_Function, function_handle, void());
+
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> buffer(TF_NewBuffer(), TF_DeleteBuffer);
+  TF_FunctionToFunctionDef(function, buffer.get(), status.get());
+  CHECK_STATUS(env, status.get(), void());
+
+  // The serialized function definition is written directly, so that it is not limited by the maximum size of a Java
+  // byte array.
+  const char *c_filename = env->GetStringUTFChars(filename, nullptr);
+  tensorflow::Status s = tensorflow::WriteStringToFile(
+      tensorflow::Env::Default(), std::string(c_filename),
+      tensorflow::StringPiece(static_cast<const char *>(buffer->data), buffer->length));
+  env->ReleaseStringUTFChars(filename, c_filename);
+  Set_TF_Status_from_Status(status.get(), s);
+  CHECK_STATUS(env, status.get(), void());
+}
+
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Function_00024_delete(
     JNIEnv* env, jobject object, jlong function_handle) {
   REQUIRE_HANDLE(function, TF_Function, function_handle, void());
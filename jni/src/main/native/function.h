@@ -31,6 +31,14 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Function_00024_copyToGr
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Function_00024_toFunctionDef
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Function__
+ * Method:    toFunctionDefFile
+ * Signature: (JLjava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Function_00024_toFunctionDefFile
+  (JNIEnv *, jobject, jlong, jstring);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Function__
  * Method:    delete
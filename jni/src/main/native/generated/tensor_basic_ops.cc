@@ -30,25 +30,23 @@
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_zerosLike(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ZerosLike", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ZerosLike", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ZerosLike", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -56,25 +54,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_onesLike(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "OnesLike", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "OnesLike", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "OnesLike", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -82,29 +78,27 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_fill(
     JNIEnv* env, jobject object, jlong context_handle, jlong dims, jlong value) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Fill", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Fill", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(dims_handle, TFE_TensorHandle, dims, 0);
-  TFE_OpAddInput(op.get(), dims_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(dims_handle, dims, 0);
+  TFE_OpAddInput(op.get(), dims_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(value_handle, TFE_TensorHandle, value, 0);
-  TFE_OpAddInput(op.get(), value_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(value_handle, value, 0);
+  TFE_OpAddInput(op.get(), value_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_value_handle, TFE_TensorHandle, value, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Fill", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -112,25 +106,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_rank(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Rank", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Rank", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Rank", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -138,27 +130,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_size(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Size", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Size", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Size", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -166,27 +156,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_shape(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Shape", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Shape", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Shape", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -194,33 +182,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_expandDims(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong dim) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ExpandDims", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ExpandDims", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(dim_handle, TFE_TensorHandle, dim, 0);
-  TFE_OpAddInput(op.get(), dim_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(dim_handle, dim, 0);
+  TFE_OpAddInput(op.get(), dim_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tdim_dim_handle, TFE_TensorHandle, dim, 0);
-  const TF_DataType attr_Tdim = TFE_TensorHandleDataType(attr_Tdim_dim_handle);
+  const TF_DataType attr_Tdim = TFE_TensorHandleDataType(dim_handle);
   TFE_OpSetAttrType(op.get(), "Tdim", attr_Tdim);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ExpandDims", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -228,18 +213,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_squeeze(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlongArray squeeze_dims) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Squeeze", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Squeeze", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int squeeze_dims_n = env->GetArrayLength(squeeze_dims);
@@ -251,11 +235,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
   TFE_OpSetAttrIntList(op.get(), "squeeze_dims", squeeze_dims_c_value.get(), squeeze_dims_n);
   env->ReleaseLongArrayElements(squeeze_dims, squeeze_dims_elems, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Squeeze", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -263,18 +246,18 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_pack(
     JNIEnv* env, jobject object, jlong context_handle, jlongArray values, jlong axis) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Pack", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Pack", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
   const int values_num_tensors = env->GetArrayLength(values);
   jlong *values_elems = env->GetLongArrayElements(values, nullptr);
   for (int i = 0; i < values_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, values_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), 0);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, values_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, 0);
   }
   env->ReleaseLongArrayElements(values, values_elems, JNI_ABORT);
 
@@ -289,11 +272,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 
   TFE_OpSetAttrInt(op.get(), "axis", static_cast<int64_t>(axis));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Pack", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -301,18 +283,18 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_parallelConcat(
     JNIEnv* env, jobject object, jlong context_handle, jlongArray values, jlongArray shape) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ParallelConcat", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ParallelConcat", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
   const int values_num_tensors = env->GetArrayLength(values);
   jlong *values_elems = env->GetLongArrayElements(values, nullptr);
   for (int i = 0; i < values_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, values_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), 0);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, values_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, 0);
   }
   env->ReleaseLongArrayElements(values, values_elems, JNI_ABORT);
 
@@ -338,14 +320,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
   }
   TFE_OpSetAttrShape(
       op.get(), "shape", shape_c_value.get(), static_cast<int>(shape_num_dims),
-      status.get());
-  CHECK_STATUS(env, status.get(), 0);
+      status);
+  CHECK_STATUS(env, status, 0);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ParallelConcat", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -353,29 +334,27 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_unpack(
     JNIEnv* env, jobject object, jlong context_handle, jlong value, jlong num, jlong axis) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Unpack", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "Unpack", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(value_handle, TFE_TensorHandle, value, nullptr);
-  TFE_OpAddInput(op.get(), value_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(value_handle, value, nullptr);
+  TFE_OpAddInput(op.get(), value_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_value_handle, TFE_TensorHandle, value, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrInt(op.get(), "num", static_cast<int64_t>(num));
 
   TFE_OpSetAttrInt(op.get(), "axis", static_cast<int64_t>(axis));
 
-  const int num_outputs = num;
+  int num_outputs = num;
   std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  execute_eager_op(op.get(), "Unpack", outputs.get(), &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -389,24 +368,24 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_concatV2(
     JNIEnv* env, jobject object, jlong context_handle, jlongArray values, jlong axis) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ConcatV2", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ConcatV2", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
   const int values_num_tensors = env->GetArrayLength(values);
   jlong *values_elems = env->GetLongArrayElements(values, nullptr);
   for (int i = 0; i < values_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, values_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), 0);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, values_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, 0);
   }
   env->ReleaseLongArrayElements(values, values_elems, JNI_ABORT);
 
-  REQUIRE_HANDLE(axis_handle, TFE_TensorHandle, axis, 0);
-  TFE_OpAddInput(op.get(), axis_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(axis_handle, axis, 0);
+  TFE_OpAddInput(op.get(), axis_handle, status);
+  CHECK_STATUS(env, status, 0);
 
   const int attr_N = env->GetArrayLength(values);
   TFE_OpSetAttrInt(op.get(), "N", static_cast<int64_t>(attr_N));
@@ -417,15 +396,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
   TFE_OpSetAttrType(op.get(), "T", attr_T);
   env->ReleaseLongArrayElements(values, values_attr_T_elems, JNI_ABORT);
 
-  REQUIRE_HANDLE(attr_Tidx_axis_handle, TFE_TensorHandle, axis, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_axis_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(axis_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ConcatV2", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -433,33 +410,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_concatOffset(
     JNIEnv* env, jobject object, jlong context_handle, jlong concat_dim, jlongArray shape) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ConcatOffset", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "ConcatOffset", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(concat_dim_handle, TFE_TensorHandle, concat_dim, nullptr);
-  TFE_OpAddInput(op.get(), concat_dim_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(concat_dim_handle, concat_dim, nullptr);
+  TFE_OpAddInput(op.get(), concat_dim_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
   const int shape_num_tensors = env->GetArrayLength(shape);
   jlong *shape_elems = env->GetLongArrayElements(shape, nullptr);
   for (int i = 0; i < shape_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, shape_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), nullptr);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, shape_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, nullptr);
   }
   env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
 
   const int attr_N = env->GetArrayLength(shape);
   TFE_OpSetAttrInt(op.get(), "N", static_cast<int64_t>(attr_N));
 
-  const int num_outputs = attr_N;
+  int num_outputs = attr_N;
   std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  execute_eager_op(op.get(), "ConcatOffset", outputs.get(), &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -473,31 +449,29 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_split(
     JNIEnv* env, jobject object, jlong context_handle, jlong split_dim, jlong value, jlong num_split) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Split", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "Split", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(split_dim_handle, TFE_TensorHandle, split_dim, nullptr);
-  TFE_OpAddInput(op.get(), split_dim_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(split_dim_handle, split_dim, nullptr);
+  TFE_OpAddInput(op.get(), split_dim_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(value_handle, TFE_TensorHandle, value, nullptr);
-  TFE_OpAddInput(op.get(), value_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(value_handle, value, nullptr);
+  TFE_OpAddInput(op.get(), value_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_value_handle, TFE_TensorHandle, value, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrInt(op.get(), "num_split", static_cast<int64_t>(num_split));
 
-  const int num_outputs = num_split;
+  int num_outputs = num_split;
   std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  execute_eager_op(op.get(), "Split", outputs.get(), &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -511,39 +485,36 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_splitV(
     JNIEnv* env, jobject object, jlong context_handle, jlong value, jlong size_splits, jlong split_dim, jlong num_split) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SplitV", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "SplitV", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(value_handle, TFE_TensorHandle, value, nullptr);
-  TFE_OpAddInput(op.get(), value_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(value_handle, value, nullptr);
+  TFE_OpAddInput(op.get(), value_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(size_splits_handle, TFE_TensorHandle, size_splits, nullptr);
-  TFE_OpAddInput(op.get(), size_splits_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(size_splits_handle, size_splits, nullptr);
+  TFE_OpAddInput(op.get(), size_splits_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(split_dim_handle, TFE_TensorHandle, split_dim, nullptr);
-  TFE_OpAddInput(op.get(), split_dim_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(split_dim_handle, split_dim, nullptr);
+  TFE_OpAddInput(op.get(), split_dim_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_value_handle, TFE_TensorHandle, value, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tlen_size_splits_handle, TFE_TensorHandle, size_splits, nullptr);
-  const TF_DataType attr_Tlen = TFE_TensorHandleDataType(attr_Tlen_size_splits_handle);
+  const TF_DataType attr_Tlen = TFE_TensorHandleDataType(size_splits_handle);
   TFE_OpSetAttrType(op.get(), "Tlen", attr_Tlen);
 
   TFE_OpSetAttrInt(op.get(), "num_split", static_cast<int64_t>(num_split));
 
-  const int num_outputs = num_split;
+  int num_outputs = num_split;
   std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  execute_eager_op(op.get(), "SplitV", outputs.get(), &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -557,33 +528,30 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_tile(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong multiples) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Tile", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Tile", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(multiples_handle, TFE_TensorHandle, multiples, 0);
-  TFE_OpAddInput(op.get(), multiples_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(multiples_handle, multiples, 0);
+  TFE_OpAddInput(op.get(), multiples_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tmultiples_multiples_handle, TFE_TensorHandle, multiples, 0);
-  const TF_DataType attr_Tmultiples = TFE_TensorHandleDataType(attr_Tmultiples_multiples_handle);
+  const TF_DataType attr_Tmultiples = TFE_TensorHandleDataType(multiples_handle);
   TFE_OpSetAttrType(op.get(), "Tmultiples", attr_Tmultiples);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Tile", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -591,33 +559,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_pad(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong paddings) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Pad", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Pad", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(paddings_handle, TFE_TensorHandle, paddings, 0);
-  TFE_OpAddInput(op.get(), paddings_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(paddings_handle, paddings, 0);
+  TFE_OpAddInput(op.get(), paddings_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tpaddings_paddings_handle, TFE_TensorHandle, paddings, 0);
-  const TF_DataType attr_Tpaddings = TFE_TensorHandleDataType(attr_Tpaddings_paddings_handle);
+  const TF_DataType attr_Tpaddings = TFE_TensorHandleDataType(paddings_handle);
   TFE_OpSetAttrType(op.get(), "Tpaddings", attr_Tpaddings);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Pad", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -625,37 +590,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_mirrorPad(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong paddings, jbyteArray mode) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MirrorPad", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MirrorPad", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(paddings_handle, TFE_TensorHandle, paddings, 0);
-  TFE_OpAddInput(op.get(), paddings_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(paddings_handle, paddings, 0);
+  TFE_OpAddInput(op.get(), paddings_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tpaddings_paddings_handle, TFE_TensorHandle, paddings, 0);
-  const TF_DataType attr_Tpaddings = TFE_TensorHandleDataType(attr_Tpaddings_paddings_handle);
+  const TF_DataType attr_Tpaddings = TFE_TensorHandleDataType(paddings_handle);
   TFE_OpSetAttrType(op.get(), "Tpaddings", attr_Tpaddings);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   jbyte *mode_c_value = env->GetByteArrayElements(mode, nullptr);
   TFE_OpSetAttrString(op.get(), "mode", reinterpret_cast<const char *>(mode_c_value));
   env->ReleaseByteArrayElements(mode, mode_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MirrorPad", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -663,33 +625,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_reshape(
     JNIEnv* env, jobject object, jlong context_handle, jlong tensor, jlong shape) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Reshape", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Reshape", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, tensor, 0);
-  TFE_OpAddInput(op.get(), tensor_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(tensor_handle, tensor, 0);
+  TFE_OpAddInput(op.get(), tensor_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(shape_handle, TFE_TensorHandle, shape, 0);
-  TFE_OpAddInput(op.get(), shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tshape_shape_handle, TFE_TensorHandle, shape, 0);
-  const TF_DataType attr_Tshape = TFE_TensorHandleDataType(attr_Tshape_shape_handle);
+  const TF_DataType attr_Tshape = TFE_TensorHandleDataType(shape_handle);
   TFE_OpSetAttrType(op.get(), "Tshape", attr_Tshape);
 
-  REQUIRE_HANDLE(attr_T_tensor_handle, TFE_TensorHandle, tensor, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_tensor_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(tensor_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Reshape", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -697,33 +656,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_transpose(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong perm) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Transpose", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Transpose", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(perm_handle, TFE_TensorHandle, perm, 0);
-  TFE_OpAddInput(op.get(), perm_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(perm_handle, perm, 0);
+  TFE_OpAddInput(op.get(), perm_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tperm_perm_handle, TFE_TensorHandle, perm, 0);
-  const TF_DataType attr_Tperm = TFE_TensorHandleDataType(attr_Tperm_perm_handle);
+  const TF_DataType attr_Tperm = TFE_TensorHandleDataType(perm_handle);
   TFE_OpSetAttrType(op.get(), "Tperm", attr_Tperm);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Transpose", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -731,25 +687,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_invertPermutation(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "InvertPermutation", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "InvertPermutation", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "InvertPermutation", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -757,33 +711,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_reverseV2(
     JNIEnv* env, jobject object, jlong context_handle, jlong tensor, jlong axis) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ReverseV2", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ReverseV2", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, tensor, 0);
-  TFE_OpAddInput(op.get(), tensor_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(tensor_handle, tensor, 0);
+  TFE_OpAddInput(op.get(), tensor_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(axis_handle, TFE_TensorHandle, axis, 0);
-  TFE_OpAddInput(op.get(), axis_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(axis_handle, axis, 0);
+  TFE_OpAddInput(op.get(), axis_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_tensor_handle, TFE_TensorHandle, tensor, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_tensor_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(tensor_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_axis_handle, TFE_TensorHandle, axis, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_axis_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(axis_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ReverseV2", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -791,37 +742,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_reverseSequence(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong seq_lengths, jlong seq_dim, jlong batch_dim) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ReverseSequence", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ReverseSequence", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(seq_lengths_handle, TFE_TensorHandle, seq_lengths, 0);
-  TFE_OpAddInput(op.get(), seq_lengths_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(seq_lengths_handle, seq_lengths, 0);
+  TFE_OpAddInput(op.get(), seq_lengths_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tlen_seq_lengths_handle, TFE_TensorHandle, seq_lengths, 0);
-  const TF_DataType attr_Tlen = TFE_TensorHandleDataType(attr_Tlen_seq_lengths_handle);
+  const TF_DataType attr_Tlen = TFE_TensorHandleDataType(seq_lengths_handle);
   TFE_OpSetAttrType(op.get(), "Tlen", attr_Tlen);
 
   TFE_OpSetAttrInt(op.get(), "seq_dim", static_cast<int64_t>(seq_dim));
 
   TFE_OpSetAttrInt(op.get(), "batch_dim", static_cast<int64_t>(batch_dim));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ReverseSequence", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -829,41 +777,37 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_spaceToBatchND(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong block_shape, jlong paddings) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SpaceToBatchND", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SpaceToBatchND", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(block_shape_handle, TFE_TensorHandle, block_shape, 0);
-  TFE_OpAddInput(op.get(), block_shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(block_shape_handle, block_shape, 0);
+  TFE_OpAddInput(op.get(), block_shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(paddings_handle, TFE_TensorHandle, paddings, 0);
-  TFE_OpAddInput(op.get(), paddings_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(paddings_handle, paddings, 0);
+  TFE_OpAddInput(op.get(), paddings_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tpaddings_paddings_handle, TFE_TensorHandle, paddings, 0);
-  const TF_DataType attr_Tpaddings = TFE_TensorHandleDataType(attr_Tpaddings_paddings_handle);
+  const TF_DataType attr_Tpaddings = TFE_TensorHandleDataType(paddings_handle);
   TFE_OpSetAttrType(op.get(), "Tpaddings", attr_Tpaddings);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tblock_shape_block_shape_handle, TFE_TensorHandle, block_shape, 0);
-  const TF_DataType attr_Tblock_shape = TFE_TensorHandleDataType(attr_Tblock_shape_block_shape_handle);
+  const TF_DataType attr_Tblock_shape = TFE_TensorHandleDataType(block_shape_handle);
   TFE_OpSetAttrType(op.get(), "Tblock_shape", attr_Tblock_shape);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SpaceToBatchND", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -871,41 +815,37 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_batchToSpaceND(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong block_shape, jlong crops) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "BatchToSpaceND", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "BatchToSpaceND", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(block_shape_handle, TFE_TensorHandle, block_shape, 0);
-  TFE_OpAddInput(op.get(), block_shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(block_shape_handle, block_shape, 0);
+  TFE_OpAddInput(op.get(), block_shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(crops_handle, TFE_TensorHandle, crops, 0);
-  TFE_OpAddInput(op.get(), crops_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(crops_handle, crops, 0);
+  TFE_OpAddInput(op.get(), crops_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tcrops_crops_handle, TFE_TensorHandle, crops, 0);
-  const TF_DataType attr_Tcrops = TFE_TensorHandleDataType(attr_Tcrops_crops_handle);
+  const TF_DataType attr_Tcrops = TFE_TensorHandleDataType(crops_handle);
   TFE_OpSetAttrType(op.get(), "Tcrops", attr_Tcrops);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tblock_shape_block_shape_handle, TFE_TensorHandle, block_shape, 0);
-  const TF_DataType attr_Tblock_shape = TFE_TensorHandleDataType(attr_Tblock_shape_block_shape_handle);
+  const TF_DataType attr_Tblock_shape = TFE_TensorHandleDataType(block_shape_handle);
   TFE_OpSetAttrType(op.get(), "Tblock_shape", attr_Tblock_shape);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "BatchToSpaceND", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -913,27 +853,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_spaceToDepth(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong block_size) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SpaceToDepth", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SpaceToDepth", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrInt(op.get(), "block_size", static_cast<int64_t>(block_size));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SpaceToDepth", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -941,27 +879,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_depthToSpace(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong block_size) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "DepthToSpace", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "DepthToSpace", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrInt(op.get(), "block_size", static_cast<int64_t>(block_size));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "DepthToSpace", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -969,21 +905,20 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_where(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Where", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Where", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Where", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -991,27 +926,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_unique(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jint out_idx) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Unique", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "Unique", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, nullptr);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, nullptr);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "out_idx", static_cast<TF_DataType>(out_idx));
 
-  const int num_outputs = 2;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "Unique", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1025,27 +958,25 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_uniqueWithCounts(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jint out_idx) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "UniqueWithCounts", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "UniqueWithCounts", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, nullptr);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, nullptr);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "out_idx", static_cast<TF_DataType>(out_idx));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "UniqueWithCounts", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1059,26 +990,24 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_listDiff(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y, jint out_idx) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ListDiff", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "ListDiff", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, nullptr);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, nullptr);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, nullptr);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, nullptr);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, nullptr);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1088,15 +1017,15 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
   TFE_OpSetAttrType(op.get(), "out_idx", static_cast<TF_DataType>(out_idx));
 
-  const int num_outputs = 2;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "ListDiff", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1110,41 +1039,37 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_gatherV2(
     JNIEnv* env, jobject object, jlong context_handle, jlong params, jlong indices, jlong axis) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "GatherV2", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "GatherV2", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(params_handle, TFE_TensorHandle, params, 0);
-  TFE_OpAddInput(op.get(), params_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(params_handle, params, 0);
+  TFE_OpAddInput(op.get(), params_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(indices_handle, TFE_TensorHandle, indices, 0);
-  TFE_OpAddInput(op.get(), indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, 0);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(axis_handle, TFE_TensorHandle, axis, 0);
-  TFE_OpAddInput(op.get(), axis_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(axis_handle, axis, 0);
+  TFE_OpAddInput(op.get(), axis_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tparams_params_handle, TFE_TensorHandle, params, 0);
-  const TF_DataType attr_Tparams = TFE_TensorHandleDataType(attr_Tparams_params_handle);
+  const TF_DataType attr_Tparams = TFE_TensorHandleDataType(params_handle);
   TFE_OpSetAttrType(op.get(), "Tparams", attr_Tparams);
 
-  REQUIRE_HANDLE(attr_Taxis_axis_handle, TFE_TensorHandle, axis, 0);
-  const TF_DataType attr_Taxis = TFE_TensorHandleDataType(attr_Taxis_axis_handle);
+  const TF_DataType attr_Taxis = TFE_TensorHandleDataType(axis_handle);
   TFE_OpSetAttrType(op.get(), "Taxis", attr_Taxis);
 
-  REQUIRE_HANDLE(attr_Tindices_indices_handle, TFE_TensorHandle, indices, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_indices_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(indices_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "GatherV2", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1152,33 +1077,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_gatherNd(
     JNIEnv* env, jobject object, jlong context_handle, jlong params, jlong indices) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "GatherNd", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "GatherNd", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(params_handle, TFE_TensorHandle, params, 0);
-  TFE_OpAddInput(op.get(), params_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(params_handle, params, 0);
+  TFE_OpAddInput(op.get(), params_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(indices_handle, TFE_TensorHandle, indices, 0);
-  TFE_OpAddInput(op.get(), indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, 0);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tparams_params_handle, TFE_TensorHandle, params, 0);
-  const TF_DataType attr_Tparams = TFE_TensorHandleDataType(attr_Tparams_params_handle);
+  const TF_DataType attr_Tparams = TFE_TensorHandleDataType(params_handle);
   TFE_OpSetAttrType(op.get(), "Tparams", attr_Tparams);
 
-  REQUIRE_HANDLE(attr_Tindices_indices_handle, TFE_TensorHandle, indices, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_indices_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(indices_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "GatherNd", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1186,34 +1108,31 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_scatterNd(
     JNIEnv* env, jobject object, jlong context_handle, jlong indices, jlong updates, jlong shape) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ScatterNd", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ScatterNd", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(indices_handle, TFE_TensorHandle, indices, 0);
-  TFE_OpAddInput(op.get(), indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, 0);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(updates_handle, TFE_TensorHandle, updates, 0);
-  TFE_OpAddInput(op.get(), updates_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(updates_handle, updates, 0);
+  TFE_OpAddInput(op.get(), updates_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(shape_handle, TFE_TensorHandle, shape, 0);
-  TFE_OpAddInput(op.get(), shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_updates_handle, TFE_TensorHandle, updates, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_updates_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(updates_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_indices_handle, TFE_TensorHandle, indices, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_indices_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(indices_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  REQUIRE_HANDLE(attr_Tindices_shape_handle, TFE_TensorHandle, shape, 0);
-  const TF_DataType attr_Tindices_shape = TFE_TensorHandleDataType(attr_Tindices_shape_handle);
+  const TF_DataType attr_Tindices_shape = TFE_TensorHandleDataType(shape_handle);
   if (attr_Tindices != attr_Tindices_shape) {
       std::stringstream error_msg;
       error_msg
@@ -1223,13 +1142,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_Tindices
           << "' of argument 'indices'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ScatterNd", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1237,34 +1156,31 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_slice(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong begin, jlong size) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Slice", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Slice", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(begin_handle, TFE_TensorHandle, begin, 0);
-  TFE_OpAddInput(op.get(), begin_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(begin_handle, begin, 0);
+  TFE_OpAddInput(op.get(), begin_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(size_handle, TFE_TensorHandle, size, 0);
-  TFE_OpAddInput(op.get(), size_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(size_handle, size, 0);
+  TFE_OpAddInput(op.get(), size_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Index_begin_handle, TFE_TensorHandle, begin, 0);
-  const TF_DataType attr_Index = TFE_TensorHandleDataType(attr_Index_begin_handle);
+  const TF_DataType attr_Index = TFE_TensorHandleDataType(begin_handle);
   TFE_OpSetAttrType(op.get(), "Index", attr_Index);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Index_size_handle, TFE_TensorHandle, size, 0);
-  const TF_DataType attr_Index_size = TFE_TensorHandleDataType(attr_Index_size_handle);
+  const TF_DataType attr_Index_size = TFE_TensorHandleDataType(size_handle);
   if (attr_Index != attr_Index_size) {
       std::stringstream error_msg;
       error_msg
@@ -1274,13 +1190,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_Index
           << "' of argument 'begin'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Slice", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1288,38 +1204,35 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_stridedSlice(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong begin, jlong end, jlong strides, jlong begin_mask, jlong end_mask, jlong ellipsis_mask, jlong new_axis_mask, jlong shrink_axis_mask) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "StridedSlice", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "StridedSlice", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(begin_handle, TFE_TensorHandle, begin, 0);
-  TFE_OpAddInput(op.get(), begin_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(begin_handle, begin, 0);
+  TFE_OpAddInput(op.get(), begin_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(end_handle, TFE_TensorHandle, end, 0);
-  TFE_OpAddInput(op.get(), end_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(end_handle, end, 0);
+  TFE_OpAddInput(op.get(), end_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(strides_handle, TFE_TensorHandle, strides, 0);
-  TFE_OpAddInput(op.get(), strides_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(strides_handle, strides, 0);
+  TFE_OpAddInput(op.get(), strides_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Index_begin_handle, TFE_TensorHandle, begin, 0);
-  const TF_DataType attr_Index = TFE_TensorHandleDataType(attr_Index_begin_handle);
+  const TF_DataType attr_Index = TFE_TensorHandleDataType(begin_handle);
   TFE_OpSetAttrType(op.get(), "Index", attr_Index);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Index_end_handle, TFE_TensorHandle, end, 0);
-  const TF_DataType attr_Index_end = TFE_TensorHandleDataType(attr_Index_end_handle);
+  const TF_DataType attr_Index_end = TFE_TensorHandleDataType(end_handle);
   if (attr_Index != attr_Index_end) {
       std::stringstream error_msg;
       error_msg
@@ -1329,10 +1242,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_Index
           << "' of argument 'begin'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_Index_strides_handle, TFE_TensorHandle, strides, 0);
-  const TF_DataType attr_Index_strides = TFE_TensorHandleDataType(attr_Index_strides_handle);
+  const TF_DataType attr_Index_strides = TFE_TensorHandleDataType(strides_handle);
   if (attr_Index != attr_Index_strides) {
       std::stringstream error_msg;
       error_msg
@@ -1342,6 +1255,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_Index
           << "' of argument 'begin'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrInt(op.get(), "begin_mask", static_cast<int64_t>(begin_mask));
@@ -1354,11 +1268,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 
   TFE_OpSetAttrInt(op.get(), "shrink_axis_mask", static_cast<int64_t>(shrink_axis_mask));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "StridedSlice", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1366,29 +1279,27 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_checkNumerics(
     JNIEnv* env, jobject object, jlong context_handle, jlong tensor, jbyteArray message) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "CheckNumerics", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "CheckNumerics", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, tensor, 0);
-  TFE_OpAddInput(op.get(), tensor_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(tensor_handle, tensor, 0);
+  TFE_OpAddInput(op.get(), tensor_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_tensor_handle, TFE_TensorHandle, tensor, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_tensor_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(tensor_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   jbyte *message_c_value = env->GetByteArrayElements(message, nullptr);
   TFE_OpSetAttrString(op.get(), "message", reinterpret_cast<const char *>(message_c_value));
   env->ReleaseByteArrayElements(message, message_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "CheckNumerics", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1396,42 +1307,40 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_editDistance(
     JNIEnv* env, jobject object, jlong context_handle, jlong hypothesis_indices, jlong hypothesis_values, jlong hypothesis_shape, jlong truth_indices, jlong truth_values, jlong truth_shape, jboolean normalize) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "EditDistance", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "EditDistance", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(hypothesis_indices_handle, TFE_TensorHandle, hypothesis_indices, 0);
-  TFE_OpAddInput(op.get(), hypothesis_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(hypothesis_indices_handle, hypothesis_indices, 0);
+  TFE_OpAddInput(op.get(), hypothesis_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(hypothesis_values_handle, TFE_TensorHandle, hypothesis_values, 0);
-  TFE_OpAddInput(op.get(), hypothesis_values_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(hypothesis_values_handle, hypothesis_values, 0);
+  TFE_OpAddInput(op.get(), hypothesis_values_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(hypothesis_shape_handle, TFE_TensorHandle, hypothesis_shape, 0);
-  TFE_OpAddInput(op.get(), hypothesis_shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(hypothesis_shape_handle, hypothesis_shape, 0);
+  TFE_OpAddInput(op.get(), hypothesis_shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(truth_indices_handle, TFE_TensorHandle, truth_indices, 0);
-  TFE_OpAddInput(op.get(), truth_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(truth_indices_handle, truth_indices, 0);
+  TFE_OpAddInput(op.get(), truth_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(truth_values_handle, TFE_TensorHandle, truth_values, 0);
-  TFE_OpAddInput(op.get(), truth_values_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(truth_values_handle, truth_values, 0);
+  TFE_OpAddInput(op.get(), truth_values_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(truth_shape_handle, TFE_TensorHandle, truth_shape, 0);
-  TFE_OpAddInput(op.get(), truth_shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(truth_shape_handle, truth_shape, 0);
+  TFE_OpAddInput(op.get(), truth_shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_hypothesis_values_handle, TFE_TensorHandle, hypothesis_values, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_hypothesis_values_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(hypothesis_values_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_truth_values_handle, TFE_TensorHandle, truth_values, 0);
-  const TF_DataType attr_T_truth_values = TFE_TensorHandleDataType(attr_T_truth_values_handle);
+  const TF_DataType attr_T_truth_values = TFE_TensorHandleDataType(truth_values_handle);
   if (attr_T != attr_T_truth_values) {
       std::stringstream error_msg;
       error_msg
@@ -1441,15 +1350,15 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_T
           << "' of argument 'hypothesis_values'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrBool(op.get(), "normalize", static_cast<unsigned char>(normalize));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "EditDistance", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1457,38 +1366,35 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_oneHot(
     JNIEnv* env, jobject object, jlong context_handle, jlong indices, jlong depth, jlong on_value, jlong off_value, jlong axis) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "OneHot", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "OneHot", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(indices_handle, TFE_TensorHandle, indices, 0);
-  TFE_OpAddInput(op.get(), indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, 0);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(depth_handle, TFE_TensorHandle, depth, 0);
-  TFE_OpAddInput(op.get(), depth_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(depth_handle, depth, 0);
+  TFE_OpAddInput(op.get(), depth_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(on_value_handle, TFE_TensorHandle, on_value, 0);
-  TFE_OpAddInput(op.get(), on_value_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(on_value_handle, on_value, 0);
+  TFE_OpAddInput(op.get(), on_value_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(off_value_handle, TFE_TensorHandle, off_value, 0);
-  TFE_OpAddInput(op.get(), off_value_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(off_value_handle, off_value, 0);
+  TFE_OpAddInput(op.get(), off_value_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_TI_indices_handle, TFE_TensorHandle, indices, 0);
-  const TF_DataType attr_TI = TFE_TensorHandleDataType(attr_TI_indices_handle);
+  const TF_DataType attr_TI = TFE_TensorHandleDataType(indices_handle);
   TFE_OpSetAttrType(op.get(), "TI", attr_TI);
 
-  REQUIRE_HANDLE(attr_T_on_value_handle, TFE_TensorHandle, on_value, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_on_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(on_value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_off_value_handle, TFE_TensorHandle, off_value, 0);
-  const TF_DataType attr_T_off_value = TFE_TensorHandleDataType(attr_T_off_value_handle);
+  const TF_DataType attr_T_off_value = TFE_TensorHandleDataType(off_value_handle);
   if (attr_T != attr_T_off_value) {
       std::stringstream error_msg;
       error_msg
@@ -1498,15 +1404,15 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_T
           << "' of argument 'on_value'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrInt(op.get(), "axis", static_cast<int64_t>(axis));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "OneHot", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1514,26 +1420,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_broadcastArgs(
     JNIEnv* env, jobject object, jlong context_handle, jlong s0, jlong s1) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "BroadcastArgs", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "BroadcastArgs", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(s0_handle, TFE_TensorHandle, s0, 0);
-  TFE_OpAddInput(op.get(), s0_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(s0_handle, s0, 0);
+  TFE_OpAddInput(op.get(), s0_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(s1_handle, TFE_TensorHandle, s1, 0);
-  TFE_OpAddInput(op.get(), s1_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(s1_handle, s1, 0);
+  TFE_OpAddInput(op.get(), s1_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_s0_handle, TFE_TensorHandle, s0, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_s0_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(s0_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_s1_handle, TFE_TensorHandle, s1, 0);
-  const TF_DataType attr_T_s1 = TFE_TensorHandleDataType(attr_T_s1_handle);
+  const TF_DataType attr_T_s1 = TFE_TensorHandleDataType(s1_handle);
   if (attr_T != attr_T_s1) {
       std::stringstream error_msg;
       error_msg
@@ -1543,13 +1447,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_T
           << "' of argument 's0'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "BroadcastArgs", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1557,25 +1461,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_stopGradient(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "StopGradient", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "StopGradient", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "StopGradient", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1583,29 +1485,27 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_preventGradient(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jbyteArray message) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "PreventGradient", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "PreventGradient", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   jbyte *message_c_value = env->GetByteArrayElements(message, nullptr);
   TFE_OpSetAttrString(op.get(), "message", reinterpret_cast<const char *>(message_c_value));
   env->ReleaseByteArrayElements(message, message_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "PreventGradient", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1613,25 +1513,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_identity(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Identity", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Identity", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Identity", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1639,21 +1537,20 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_identityN(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "IdentityN", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "IdentityN", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  const int num_outputs = input;
+  int num_outputs = input;
   std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  execute_eager_op(op.get(), "IdentityN", outputs.get(), &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1667,34 +1564,31 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_scatterNdNonAliasingAdd(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong indices, jlong updates) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ScatterNdNonAliasingAdd", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ScatterNdNonAliasingAdd", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(indices_handle, TFE_TensorHandle, indices, 0);
-  TFE_OpAddInput(op.get(), indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, 0);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(updates_handle, TFE_TensorHandle, updates, 0);
-  TFE_OpAddInput(op.get(), updates_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(updates_handle, updates, 0);
+  TFE_OpAddInput(op.get(), updates_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_indices_handle, TFE_TensorHandle, indices, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_indices_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(indices_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  REQUIRE_HANDLE(attr_T_updates_handle, TFE_TensorHandle, updates, 0);
-  const TF_DataType attr_T_updates = TFE_TensorHandleDataType(attr_T_updates_handle);
+  const TF_DataType attr_T_updates = TFE_TensorHandleDataType(updates_handle);
   if (attr_T != attr_T_updates) {
       std::stringstream error_msg;
       error_msg
@@ -1704,13 +1598,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ScatterNdNonAliasingAdd", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1718,34 +1612,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_quantizeAndDequantizeV3(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong input_min, jlong input_max, jlong num_bits, jboolean signed_input, jboolean range_given) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizeAndDequantizeV3", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "QuantizeAndDequantizeV3", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_min_handle, TFE_TensorHandle, input_min, 0);
-  TFE_OpAddInput(op.get(), input_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_min_handle, input_min, 0);
+  TFE_OpAddInput(op.get(), input_min_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_max_handle, TFE_TensorHandle, input_max, 0);
-  TFE_OpAddInput(op.get(), input_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_max_handle, input_max, 0);
+  TFE_OpAddInput(op.get(), input_max_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(num_bits_handle, TFE_TensorHandle, num_bits, 0);
-  TFE_OpAddInput(op.get(), num_bits_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(num_bits_handle, num_bits, 0);
+  TFE_OpAddInput(op.get(), num_bits_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_input_min_handle, TFE_TensorHandle, input_min, 0);
-  const TF_DataType attr_T_input_min = TFE_TensorHandleDataType(attr_T_input_min_handle);
+  const TF_DataType attr_T_input_min = TFE_TensorHandleDataType(input_min_handle);
   if (attr_T != attr_T_input_min) {
       std::stringstream error_msg;
       error_msg
@@ -1755,10 +1647,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_T_input_max_handle, TFE_TensorHandle, input_max, 0);
-  const TF_DataType attr_T_input_max = TFE_TensorHandleDataType(attr_T_input_max_handle);
+  const TF_DataType attr_T_input_max = TFE_TensorHandleDataType(input_max_handle);
   if (attr_T != attr_T_input_max) {
       std::stringstream error_msg;
       error_msg
@@ -1768,17 +1660,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrBool(op.get(), "signed_input", static_cast<unsigned char>(signed_input));
 
   TFE_OpSetAttrBool(op.get(), "range_given", static_cast<unsigned char>(range_given));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "QuantizeAndDequantizeV3", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1786,23 +1678,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_quantizeV2(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong min_range, jlong max_range, jint t, jbyteArray mode) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizeV2", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizeV2", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_range_handle, TFE_TensorHandle, min_range, nullptr);
-  TFE_OpAddInput(op.get(), min_range_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_range_handle, min_range, nullptr);
+  TFE_OpAddInput(op.get(), min_range_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_range_handle, TFE_TensorHandle, max_range, nullptr);
-  TFE_OpAddInput(op.get(), max_range_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_range_handle, max_range, nullptr);
+  TFE_OpAddInput(op.get(), max_range_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
   TFE_OpSetAttrType(op.get(), "T", static_cast<TF_DataType>(t));
 
@@ -1810,11 +1702,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
   TFE_OpSetAttrString(op.get(), "mode", reinterpret_cast<const char *>(mode_c_value));
   env->ReleaseByteArrayElements(mode, mode_c_value, JNI_ABORT);
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizeV2", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1828,37 +1719,35 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_dequantize(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong min_range, jlong max_range, jbyteArray mode) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Dequantize", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Dequantize", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(min_range_handle, TFE_TensorHandle, min_range, 0);
-  TFE_OpAddInput(op.get(), min_range_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(min_range_handle, min_range, 0);
+  TFE_OpAddInput(op.get(), min_range_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(max_range_handle, TFE_TensorHandle, max_range, 0);
-  TFE_OpAddInput(op.get(), max_range_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(max_range_handle, max_range, 0);
+  TFE_OpAddInput(op.get(), max_range_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   jbyte *mode_c_value = env->GetByteArrayElements(mode, nullptr);
   TFE_OpSetAttrString(op.get(), "mode", reinterpret_cast<const char *>(mode_c_value));
   env->ReleaseByteArrayElements(mode, mode_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Dequantize", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1866,40 +1755,40 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_quantizedConcat(
     JNIEnv* env, jobject object, jlong context_handle, jlong concat_dim, jlongArray values, jlongArray input_mins, jlongArray input_maxes) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedConcat", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedConcat", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(concat_dim_handle, TFE_TensorHandle, concat_dim, nullptr);
-  TFE_OpAddInput(op.get(), concat_dim_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(concat_dim_handle, concat_dim, nullptr);
+  TFE_OpAddInput(op.get(), concat_dim_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
   const int values_num_tensors = env->GetArrayLength(values);
   jlong *values_elems = env->GetLongArrayElements(values, nullptr);
   for (int i = 0; i < values_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, values_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), nullptr);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, values_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, nullptr);
   }
   env->ReleaseLongArrayElements(values, values_elems, JNI_ABORT);
 
   const int input_mins_num_tensors = env->GetArrayLength(input_mins);
   jlong *input_mins_elems = env->GetLongArrayElements(input_mins, nullptr);
   for (int i = 0; i < input_mins_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, input_mins_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), nullptr);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, input_mins_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, nullptr);
   }
   env->ReleaseLongArrayElements(input_mins, input_mins_elems, JNI_ABORT);
 
   const int input_maxes_num_tensors = env->GetArrayLength(input_maxes);
   jlong *input_maxes_elems = env->GetLongArrayElements(input_maxes, nullptr);
   for (int i = 0; i < input_maxes_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, input_maxes_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), nullptr);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, input_maxes_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, nullptr);
   }
   env->ReleaseLongArrayElements(input_maxes, input_maxes_elems, JNI_ABORT);
 
@@ -1922,6 +1811,7 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_N
           << "' of argument 'values'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
   const int attr_N_input_maxes = env->GetArrayLength(input_maxes);
@@ -1934,13 +1824,13 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_N
           << "' of argument 'values'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedConcat", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1954,41 +1844,38 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_quantizedReshape(
     JNIEnv* env, jobject object, jlong context_handle, jlong tensor, jlong shape, jlong input_min, jlong input_max) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedReshape", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedReshape", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, tensor, nullptr);
-  TFE_OpAddInput(op.get(), tensor_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(tensor_handle, tensor, nullptr);
+  TFE_OpAddInput(op.get(), tensor_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(shape_handle, TFE_TensorHandle, shape, nullptr);
-  TFE_OpAddInput(op.get(), shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, nullptr);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_min_handle, TFE_TensorHandle, input_min, nullptr);
-  TFE_OpAddInput(op.get(), input_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_min_handle, input_min, nullptr);
+  TFE_OpAddInput(op.get(), input_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_max_handle, TFE_TensorHandle, input_max, nullptr);
-  TFE_OpAddInput(op.get(), input_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_max_handle, input_max, nullptr);
+  TFE_OpAddInput(op.get(), input_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tshape_shape_handle, TFE_TensorHandle, shape, nullptr);
-  const TF_DataType attr_Tshape = TFE_TensorHandleDataType(attr_Tshape_shape_handle);
+  const TF_DataType attr_Tshape = TFE_TensorHandleDataType(shape_handle);
   TFE_OpSetAttrType(op.get(), "Tshape", attr_Tshape);
 
-  REQUIRE_HANDLE(attr_T_tensor_handle, TFE_TensorHandle, tensor, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_tensor_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(tensor_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedReshape", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -2002,26 +1889,25 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_quantizedInstanceNorm(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong x_min, jlong x_max, jboolean output_range_given, jfloat given_y_min, jfloat given_y_max, jfloat variance_epsilon, jfloat min_separation) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedInstanceNorm", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedInstanceNorm", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, nullptr);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, nullptr);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_min_handle, TFE_TensorHandle, x_min, nullptr);
-  TFE_OpAddInput(op.get(), x_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_min_handle, x_min, nullptr);
+  TFE_OpAddInput(op.get(), x_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_max_handle, TFE_TensorHandle, x_max, nullptr);
-  TFE_OpAddInput(op.get(), x_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_max_handle, x_max, nullptr);
+  TFE_OpAddInput(op.get(), x_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrBool(op.get(), "output_range_given", static_cast<unsigned char>(output_range_given));
@@ -2034,11 +1920,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 
   TFE_OpSetAttrFloat(op.get(), "min_separation", static_cast<float>(min_separation));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedInstanceNorm", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -2052,15 +1937,15 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_fakeQuantWithMinMaxArgs(
     JNIEnv* env, jobject object, jlong context_handle, jlong inputs, jfloat min, jfloat max, jlong num_bits, jboolean narrow_range) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FakeQuantWithMinMaxArgs", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "FakeQuantWithMinMaxArgs", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(inputs_handle, TFE_TensorHandle, inputs, 0);
-  TFE_OpAddInput(op.get(), inputs_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(inputs_handle, inputs, 0);
+  TFE_OpAddInput(op.get(), inputs_handle, status);
+  CHECK_STATUS(env, status, 0);
 
   TFE_OpSetAttrFloat(op.get(), "min", static_cast<float>(min));
 
@@ -2070,11 +1955,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 
   TFE_OpSetAttrBool(op.get(), "narrow_range", static_cast<unsigned char>(narrow_range));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "FakeQuantWithMinMaxArgs", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2082,33 +1966,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_fakeQuantWithMinMaxVars(
     JNIEnv* env, jobject object, jlong context_handle, jlong inputs, jlong min, jlong max, jlong num_bits, jboolean narrow_range) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FakeQuantWithMinMaxVars", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "FakeQuantWithMinMaxVars", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(inputs_handle, TFE_TensorHandle, inputs, 0);
-  TFE_OpAddInput(op.get(), inputs_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(inputs_handle, inputs, 0);
+  TFE_OpAddInput(op.get(), inputs_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(min_handle, TFE_TensorHandle, min, 0);
-  TFE_OpAddInput(op.get(), min_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(min_handle, min, 0);
+  TFE_OpAddInput(op.get(), min_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(max_handle, TFE_TensorHandle, max, 0);
-  TFE_OpAddInput(op.get(), max_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(max_handle, max, 0);
+  TFE_OpAddInput(op.get(), max_handle, status);
+  CHECK_STATUS(env, status, 0);
 
   TFE_OpSetAttrInt(op.get(), "num_bits", static_cast<int64_t>(num_bits));
 
   TFE_OpSetAttrBool(op.get(), "narrow_range", static_cast<unsigned char>(narrow_range));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "FakeQuantWithMinMaxVars", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2116,33 +1999,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basi
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Basic_00024_fakeQuantWithMinMaxVarsPerChannel(
     JNIEnv* env, jobject object, jlong context_handle, jlong inputs, jlong min, jlong max, jlong num_bits, jboolean narrow_range) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FakeQuantWithMinMaxVarsPerChannel", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "FakeQuantWithMinMaxVarsPerChannel", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(inputs_handle, TFE_TensorHandle, inputs, 0);
-  TFE_OpAddInput(op.get(), inputs_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(inputs_handle, inputs, 0);
+  TFE_OpAddInput(op.get(), inputs_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(min_handle, TFE_TensorHandle, min, 0);
-  TFE_OpAddInput(op.get(), min_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(min_handle, min, 0);
+  TFE_OpAddInput(op.get(), min_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(max_handle, TFE_TensorHandle, max, 0);
-  TFE_OpAddInput(op.get(), max_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(max_handle, max, 0);
+  TFE_OpAddInput(op.get(), max_handle, status);
+  CHECK_STATUS(env, status, 0);
 
   TFE_OpSetAttrInt(op.get(), "num_bits", static_cast<int64_t>(num_bits));
 
   TFE_OpSetAttrBool(op.get(), "narrow_range", static_cast<unsigned char>(narrow_range));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "FakeQuantWithMinMaxVarsPerChannel", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
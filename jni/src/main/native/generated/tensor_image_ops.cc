@@ -0,0 +1,59 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "tensor_image_ops.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <sstream>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_eager_api.h"
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Image_00024_decodeCropAndResizeJpeg(
+    JNIEnv* env, jobject object, jlong context_handle, jlong contents, jlong crop_window, jlong size, jlong channels) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "DecodeCropAndResizeJpeg", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(contents_handle, contents, 0);
+  TFE_OpAddInput(op.get(), contents_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(crop_window_handle, crop_window, 0);
+  TFE_OpAddInput(op.get(), crop_window_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(size_handle, size, 0);
+  TFE_OpAddInput(op.get(), size_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  TFE_OpSetAttrInt(op.get(), "channels", static_cast<int64_t>(channels));
+
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "DecodeCropAndResizeJpeg", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
+
+  return reinterpret_cast<jlong>(outputs[0]);
+}
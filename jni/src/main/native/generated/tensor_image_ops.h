@@ -0,0 +1,21 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_generated_tensors_Image__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_generated_tensors_Image__
+#define _Included_org_platanios_tensorflow_jni_generated_tensors_Image__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_generated_tensors_Image__
+ * Method:    decodeCropAndResizeJpeg
+ * Signature: (JJJJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Image_00024_decodeCropAndResizeJpeg
+  (JNIEnv *, jobject, jlong, jlong, jlong, jlong, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -30,30 +30,28 @@
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_select(
     JNIEnv* env, jobject object, jlong context_handle, jlong condition, jlong t, jlong e) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Select", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Select", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(condition_handle, TFE_TensorHandle, condition, 0);
-  TFE_OpAddInput(op.get(), condition_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(condition_handle, condition, 0);
+  TFE_OpAddInput(op.get(), condition_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(t_handle, TFE_TensorHandle, t, 0);
-  TFE_OpAddInput(op.get(), t_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(t_handle, t, 0);
+  TFE_OpAddInput(op.get(), t_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(e_handle, TFE_TensorHandle, e, 0);
-  TFE_OpAddInput(op.get(), e_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(e_handle, e, 0);
+  TFE_OpAddInput(op.get(), e_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_t_handle, TFE_TensorHandle, t, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_t_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(t_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_e_handle, TFE_TensorHandle, e, 0);
-  const TF_DataType attr_T_e = TFE_TensorHandleDataType(attr_T_e_handle);
+  const TF_DataType attr_T_e = TFE_TensorHandleDataType(e_handle);
   if (attr_T != attr_T_e) {
       std::stringstream error_msg;
       error_msg
@@ -63,13 +61,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Select", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -77,30 +75,28 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_range(
     JNIEnv* env, jobject object, jlong context_handle, jlong start, jlong limit, jlong delta) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Range", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Range", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(start_handle, TFE_TensorHandle, start, 0);
-  TFE_OpAddInput(op.get(), start_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(start_handle, start, 0);
+  TFE_OpAddInput(op.get(), start_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(limit_handle, TFE_TensorHandle, limit, 0);
-  TFE_OpAddInput(op.get(), limit_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(limit_handle, limit, 0);
+  TFE_OpAddInput(op.get(), limit_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(delta_handle, TFE_TensorHandle, delta, 0);
-  TFE_OpAddInput(op.get(), delta_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(delta_handle, delta, 0);
+  TFE_OpAddInput(op.get(), delta_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tidx_start_handle, TFE_TensorHandle, start, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_start_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(start_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
-  REQUIRE_HANDLE(attr_Tidx_limit_handle, TFE_TensorHandle, limit, 0);
-  const TF_DataType attr_Tidx_limit = TFE_TensorHandleDataType(attr_Tidx_limit_handle);
+  const TF_DataType attr_Tidx_limit = TFE_TensorHandleDataType(limit_handle);
   if (attr_Tidx != attr_Tidx_limit) {
       std::stringstream error_msg;
       error_msg
@@ -110,10 +106,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_Tidx
           << "' of argument 'start'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_Tidx_delta_handle, TFE_TensorHandle, delta, 0);
-  const TF_DataType attr_Tidx_delta = TFE_TensorHandleDataType(attr_Tidx_delta_handle);
+  const TF_DataType attr_Tidx_delta = TFE_TensorHandleDataType(delta_handle);
   if (attr_Tidx != attr_Tidx_delta) {
       std::stringstream error_msg;
       error_msg
@@ -123,13 +119,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_Tidx
           << "' of argument 'start'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Range", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -137,34 +133,31 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_linSpace(
     JNIEnv* env, jobject object, jlong context_handle, jlong start, jlong stop, jlong num) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "LinSpace", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "LinSpace", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(start_handle, TFE_TensorHandle, start, 0);
-  TFE_OpAddInput(op.get(), start_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(start_handle, start, 0);
+  TFE_OpAddInput(op.get(), start_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(stop_handle, TFE_TensorHandle, stop, 0);
-  TFE_OpAddInput(op.get(), stop_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(stop_handle, stop, 0);
+  TFE_OpAddInput(op.get(), stop_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(num_handle, TFE_TensorHandle, num, 0);
-  TFE_OpAddInput(op.get(), num_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(num_handle, num, 0);
+  TFE_OpAddInput(op.get(), num_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_start_handle, TFE_TensorHandle, start, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_start_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(start_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_num_handle, TFE_TensorHandle, num, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_num_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(num_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
-  REQUIRE_HANDLE(attr_T_stop_handle, TFE_TensorHandle, stop, 0);
-  const TF_DataType attr_T_stop = TFE_TensorHandleDataType(attr_T_stop_handle);
+  const TF_DataType attr_T_stop = TFE_TensorHandleDataType(stop_handle);
   if (attr_T != attr_T_stop) {
       std::stringstream error_msg;
       error_msg
@@ -174,13 +167,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'start'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "LinSpace", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -188,27 +181,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_cast(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jint dstT) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Cast", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Cast", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_SrcT_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_SrcT = TFE_TensorHandleDataType(attr_SrcT_x_handle);
+  const TF_DataType attr_SrcT = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "SrcT", attr_SrcT);
 
   TFE_OpSetAttrType(op.get(), "DstT", static_cast<TF_DataType>(dstT));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Cast", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -216,27 +207,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_bitcast(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jint _type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Bitcast", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Bitcast", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "type", static_cast<TF_DataType>(_type));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Bitcast", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -244,18 +233,18 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_addN(
     JNIEnv* env, jobject object, jlong context_handle, jlongArray inputs) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "AddN", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "AddN", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
   const int inputs_num_tensors = env->GetArrayLength(inputs);
   jlong *inputs_elems = env->GetLongArrayElements(inputs, nullptr);
   for (int i = 0; i < inputs_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, inputs_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), 0);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, inputs_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, 0);
   }
   env->ReleaseLongArrayElements(inputs, inputs_elems, JNI_ABORT);
 
@@ -268,11 +257,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
   TFE_OpSetAttrType(op.get(), "T", attr_T);
   env->ReleaseLongArrayElements(inputs, inputs_attr_T_elems, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "AddN", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -280,25 +268,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_abs(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Abs", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Abs", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Abs", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -306,27 +292,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_complexAbs(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jint tout) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ComplexAbs", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ComplexAbs", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "Tout", static_cast<TF_DataType>(tout));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ComplexAbs", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -334,25 +318,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_neg(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Neg", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Neg", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Neg", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -360,25 +342,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_reciprocal(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Reciprocal", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Reciprocal", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Reciprocal", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -386,25 +366,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_square(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Square", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Square", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Square", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -412,25 +390,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sqrt(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Sqrt", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Sqrt", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Sqrt", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -438,25 +414,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_rsqrt(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Rsqrt", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Rsqrt", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Rsqrt", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -464,25 +438,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_exp(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Exp", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Exp", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Exp", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -490,25 +462,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_expm1(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Expm1", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Expm1", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Expm1", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -516,25 +486,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_log(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Log", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Log", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Log", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -542,25 +510,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_log1p(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Log1p", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Log1p", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Log1p", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -568,25 +534,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sin(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Sin", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Sin", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Sin", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -594,25 +558,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_cos(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Cos", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Cos", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Cos", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -620,25 +582,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_tan(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Tan", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Tan", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Tan", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -646,25 +606,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_asin(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Asin", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Asin", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Asin", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -672,25 +630,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_acos(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Acos", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Acos", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Acos", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -698,25 +654,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_atan(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Atan", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Atan", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Atan", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -724,25 +678,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sinh(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Sinh", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Sinh", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Sinh", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -750,25 +702,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_cosh(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Cosh", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Cosh", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Cosh", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -776,25 +726,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_tanh(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Tanh", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Tanh", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Tanh", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -802,25 +750,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_asinh(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Asinh", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Asinh", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Asinh", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -828,25 +774,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_acosh(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Acosh", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Acosh", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Acosh", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -854,25 +798,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_atanh(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Atanh", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Atanh", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Atanh", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -880,25 +822,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_lgamma(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Lgamma", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Lgamma", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Lgamma", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -906,25 +846,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_digamma(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Digamma", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Digamma", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Digamma", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -932,25 +870,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_erf(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Erf", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Erf", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Erf", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -958,25 +894,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_erfc(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Erfc", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Erfc", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Erfc", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -984,25 +918,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sigmoid(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Sigmoid", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Sigmoid", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Sigmoid", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1010,25 +942,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sign(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Sign", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Sign", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Sign", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1036,25 +966,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_round(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Round", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Round", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Round", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1062,25 +990,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_rint(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Rint", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Rint", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Rint", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1088,25 +1014,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_floor(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Floor", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Floor", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Floor", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1114,25 +1038,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_ceil(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Ceil", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Ceil", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Ceil", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1140,25 +1062,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_isNan(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "IsNan", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "IsNan", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "IsNan", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1166,25 +1086,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_isInf(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "IsInf", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "IsInf", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "IsInf", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1192,25 +1110,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_isFinite(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "IsFinite", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "IsFinite", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "IsFinite", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1218,26 +1134,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_add(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Add", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Add", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1247,13 +1161,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Add", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1261,26 +1175,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sub(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Sub", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Sub", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1290,13 +1202,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Sub", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1304,26 +1216,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_mul(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Mul", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Mul", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1333,13 +1243,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Mul", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1347,26 +1257,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_div(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Div", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Div", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1376,13 +1284,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Div", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1390,26 +1298,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_floorDiv(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FloorDiv", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "FloorDiv", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1419,13 +1325,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "FloorDiv", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1433,26 +1339,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_truncateDiv(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "TruncateDiv", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "TruncateDiv", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1462,13 +1366,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "TruncateDiv", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1476,26 +1380,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_realDiv(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "RealDiv", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "RealDiv", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1505,13 +1407,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "RealDiv", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1519,26 +1421,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_squaredDifference(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SquaredDifference", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SquaredDifference", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1548,13 +1448,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SquaredDifference", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1562,26 +1462,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_mod(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Mod", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Mod", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1591,13 +1489,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Mod", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1605,26 +1503,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_floorMod(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FloorMod", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "FloorMod", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1634,13 +1530,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "FloorMod", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1648,26 +1544,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_truncateMod(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "TruncateMod", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "TruncateMod", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1677,13 +1571,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "TruncateMod", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1691,26 +1585,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_pow(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Pow", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Pow", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1720,13 +1612,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Pow", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1734,26 +1626,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_igammac(
     JNIEnv* env, jobject object, jlong context_handle, jlong a, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Igammac", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Igammac", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(a_handle, TFE_TensorHandle, a, 0);
-  TFE_OpAddInput(op.get(), a_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(a_handle, a, 0);
+  TFE_OpAddInput(op.get(), a_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_a_handle, TFE_TensorHandle, a, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_a_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(a_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T_x = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T_x = TFE_TensorHandleDataType(x_handle);
   if (attr_T != attr_T_x) {
       std::stringstream error_msg;
       error_msg
@@ -1763,13 +1653,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'a'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Igammac", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1777,26 +1667,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_igamma(
     JNIEnv* env, jobject object, jlong context_handle, jlong a, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Igamma", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Igamma", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(a_handle, TFE_TensorHandle, a, 0);
-  TFE_OpAddInput(op.get(), a_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(a_handle, a, 0);
+  TFE_OpAddInput(op.get(), a_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_a_handle, TFE_TensorHandle, a, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_a_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(a_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T_x = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T_x = TFE_TensorHandleDataType(x_handle);
   if (attr_T != attr_T_x) {
       std::stringstream error_msg;
       error_msg
@@ -1806,13 +1694,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'a'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Igamma", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1820,26 +1708,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_zeta(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong q) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Zeta", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Zeta", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(q_handle, TFE_TensorHandle, q, 0);
-  TFE_OpAddInput(op.get(), q_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(q_handle, q, 0);
+  TFE_OpAddInput(op.get(), q_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_q_handle, TFE_TensorHandle, q, 0);
-  const TF_DataType attr_T_q = TFE_TensorHandleDataType(attr_T_q_handle);
+  const TF_DataType attr_T_q = TFE_TensorHandleDataType(q_handle);
   if (attr_T != attr_T_q) {
       std::stringstream error_msg;
       error_msg
@@ -1849,13 +1735,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Zeta", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1863,26 +1749,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_polygamma(
     JNIEnv* env, jobject object, jlong context_handle, jlong a, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Polygamma", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Polygamma", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(a_handle, TFE_TensorHandle, a, 0);
-  TFE_OpAddInput(op.get(), a_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(a_handle, a, 0);
+  TFE_OpAddInput(op.get(), a_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_a_handle, TFE_TensorHandle, a, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_a_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(a_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T_x = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T_x = TFE_TensorHandleDataType(x_handle);
   if (attr_T != attr_T_x) {
       std::stringstream error_msg;
       error_msg
@@ -1892,13 +1776,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'a'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Polygamma", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1906,26 +1790,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_atan2(
     JNIEnv* env, jobject object, jlong context_handle, jlong y, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Atan2", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Atan2", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(y_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T_x = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T_x = TFE_TensorHandleDataType(x_handle);
   if (attr_T != attr_T_x) {
       std::stringstream error_msg;
       error_msg
@@ -1935,13 +1817,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'y'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Atan2", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1949,26 +1831,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_maximum(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Maximum", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Maximum", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -1978,13 +1858,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Maximum", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1992,26 +1872,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_minimum(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Minimum", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Minimum", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -2021,13 +1899,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Minimum", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2035,30 +1913,28 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_betainc(
     JNIEnv* env, jobject object, jlong context_handle, jlong a, jlong b, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Betainc", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Betainc", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(a_handle, TFE_TensorHandle, a, 0);
-  TFE_OpAddInput(op.get(), a_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(a_handle, a, 0);
+  TFE_OpAddInput(op.get(), a_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(b_handle, TFE_TensorHandle, b, 0);
-  TFE_OpAddInput(op.get(), b_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(b_handle, b, 0);
+  TFE_OpAddInput(op.get(), b_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_a_handle, TFE_TensorHandle, a, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_a_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(a_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_b_handle, TFE_TensorHandle, b, 0);
-  const TF_DataType attr_T_b = TFE_TensorHandleDataType(attr_T_b_handle);
+  const TF_DataType attr_T_b = TFE_TensorHandleDataType(b_handle);
   if (attr_T != attr_T_b) {
       std::stringstream error_msg;
       error_msg
@@ -2068,10 +1944,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'a'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T_x = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T_x = TFE_TensorHandleDataType(x_handle);
   if (attr_T != attr_T_x) {
       std::stringstream error_msg;
       error_msg
@@ -2081,13 +1957,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'a'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Betainc", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2095,21 +1971,20 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_logicalNot(
     JNIEnv* env, jobject object, jlong context_handle, jlong x) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "LogicalNot", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "LogicalNot", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "LogicalNot", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2117,25 +1992,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_logicalAnd(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "LogicalAnd", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "LogicalAnd", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "LogicalAnd", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2143,25 +2017,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_logicalOr(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "LogicalOr", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "LogicalOr", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "LogicalOr", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2169,26 +2042,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_equal(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Equal", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Equal", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -2198,13 +2069,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Equal", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2212,26 +2083,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_notEqual(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "NotEqual", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "NotEqual", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -2241,13 +2110,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "NotEqual", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2255,26 +2124,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_approximateEqual(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y, jfloat tolerance) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ApproximateEqual", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ApproximateEqual", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -2284,15 +2151,15 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrFloat(op.get(), "tolerance", static_cast<float>(tolerance));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ApproximateEqual", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2300,26 +2167,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_less(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Less", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Less", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -2329,13 +2194,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Less", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2343,26 +2208,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_lessEqual(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "LessEqual", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "LessEqual", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -2372,13 +2235,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "LessEqual", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2386,26 +2249,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_greater(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Greater", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Greater", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -2415,13 +2276,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Greater", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2429,26 +2290,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_greaterEqual(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "GreaterEqual", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "GreaterEqual", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -2458,13 +2317,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "GreaterEqual", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2472,35 +2331,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sum(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong reduction_indices, jboolean keep_dims) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Sum", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Sum", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  TFE_OpAddInput(op.get(), reduction_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(reduction_indices_handle, reduction_indices, 0);
+  TFE_OpAddInput(op.get(), reduction_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_reduction_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(reduction_indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "keep_dims", static_cast<unsigned char>(keep_dims));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Sum", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2508,35 +2364,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_mean(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong reduction_indices, jboolean keep_dims) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Mean", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Mean", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  TFE_OpAddInput(op.get(), reduction_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(reduction_indices_handle, reduction_indices, 0);
+  TFE_OpAddInput(op.get(), reduction_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_reduction_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(reduction_indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "keep_dims", static_cast<unsigned char>(keep_dims));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Mean", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2544,35 +2397,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_prod(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong reduction_indices, jboolean keep_dims) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Prod", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Prod", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  TFE_OpAddInput(op.get(), reduction_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(reduction_indices_handle, reduction_indices, 0);
+  TFE_OpAddInput(op.get(), reduction_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_reduction_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(reduction_indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "keep_dims", static_cast<unsigned char>(keep_dims));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Prod", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2580,35 +2430,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_min(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong reduction_indices, jboolean keep_dims) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Min", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Min", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  TFE_OpAddInput(op.get(), reduction_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(reduction_indices_handle, reduction_indices, 0);
+  TFE_OpAddInput(op.get(), reduction_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_reduction_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(reduction_indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "keep_dims", static_cast<unsigned char>(keep_dims));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Min", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2616,35 +2463,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_max(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong reduction_indices, jboolean keep_dims) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Max", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Max", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  TFE_OpAddInput(op.get(), reduction_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(reduction_indices_handle, reduction_indices, 0);
+  TFE_OpAddInput(op.get(), reduction_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_reduction_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(reduction_indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "keep_dims", static_cast<unsigned char>(keep_dims));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Max", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2652,31 +2496,29 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_all(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong reduction_indices, jboolean keep_dims) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "All", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "All", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  TFE_OpAddInput(op.get(), reduction_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(reduction_indices_handle, reduction_indices, 0);
+  TFE_OpAddInput(op.get(), reduction_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tidx_reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_reduction_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(reduction_indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "keep_dims", static_cast<unsigned char>(keep_dims));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "All", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2684,31 +2526,29 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_any(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong reduction_indices, jboolean keep_dims) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Any", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Any", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  TFE_OpAddInput(op.get(), reduction_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(reduction_indices_handle, reduction_indices, 0);
+  TFE_OpAddInput(op.get(), reduction_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tidx_reduction_indices_handle, TFE_TensorHandle, reduction_indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_reduction_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(reduction_indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "keep_dims", static_cast<unsigned char>(keep_dims));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Any", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2716,35 +2556,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_argMax(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong dimension, jint output_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ArgMax", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ArgMax", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(dimension_handle, TFE_TensorHandle, dimension, 0);
-  TFE_OpAddInput(op.get(), dimension_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(dimension_handle, dimension, 0);
+  TFE_OpAddInput(op.get(), dimension_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_dimension_handle, TFE_TensorHandle, dimension, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_dimension_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(dimension_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrType(op.get(), "output_type", static_cast<TF_DataType>(output_type));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ArgMax", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2752,35 +2589,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_argMin(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong dimension, jint output_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "ArgMin", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "ArgMin", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(dimension_handle, TFE_TensorHandle, dimension, 0);
-  TFE_OpAddInput(op.get(), dimension_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(dimension_handle, dimension, 0);
+  TFE_OpAddInput(op.get(), dimension_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_dimension_handle, TFE_TensorHandle, dimension, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_dimension_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(dimension_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrType(op.get(), "output_type", static_cast<TF_DataType>(output_type));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ArgMin", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2788,33 +2622,31 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_bincount(
     JNIEnv* env, jobject object, jlong context_handle, jlong arr, jlong size, jlong weights) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Bincount", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Bincount", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(arr_handle, TFE_TensorHandle, arr, 0);
-  TFE_OpAddInput(op.get(), arr_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(arr_handle, arr, 0);
+  TFE_OpAddInput(op.get(), arr_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(size_handle, TFE_TensorHandle, size, 0);
-  TFE_OpAddInput(op.get(), size_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(size_handle, size, 0);
+  TFE_OpAddInput(op.get(), size_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(weights_handle, TFE_TensorHandle, weights, 0);
-  TFE_OpAddInput(op.get(), weights_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(weights_handle, weights, 0);
+  TFE_OpAddInput(op.get(), weights_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_weights_handle, TFE_TensorHandle, weights, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_weights_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(weights_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Bincount", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2822,37 +2654,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_cumsum(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong axis, jboolean exclusive, jboolean reverse) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Cumsum", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Cumsum", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(axis_handle, TFE_TensorHandle, axis, 0);
-  TFE_OpAddInput(op.get(), axis_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(axis_handle, axis, 0);
+  TFE_OpAddInput(op.get(), axis_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_axis_handle, TFE_TensorHandle, axis, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_axis_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(axis_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "exclusive", static_cast<unsigned char>(exclusive));
 
   TFE_OpSetAttrBool(op.get(), "reverse", static_cast<unsigned char>(reverse));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Cumsum", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2860,37 +2689,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_cumprod(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong axis, jboolean exclusive, jboolean reverse) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Cumprod", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Cumprod", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(axis_handle, TFE_TensorHandle, axis, 0);
-  TFE_OpAddInput(op.get(), axis_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(axis_handle, axis, 0);
+  TFE_OpAddInput(op.get(), axis_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_axis_handle, TFE_TensorHandle, axis, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_axis_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(axis_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
   TFE_OpSetAttrBool(op.get(), "exclusive", static_cast<unsigned char>(exclusive));
 
   TFE_OpSetAttrBool(op.get(), "reverse", static_cast<unsigned char>(reverse));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Cumprod", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2898,33 +2724,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_segmentSum(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong segment_ids) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SegmentSum", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SegmentSum", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_segment_ids_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(segment_ids_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SegmentSum", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2932,33 +2755,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_segmentMean(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong segment_ids) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SegmentMean", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SegmentMean", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_segment_ids_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(segment_ids_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SegmentMean", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -2966,33 +2786,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_segmentProd(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong segment_ids) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SegmentProd", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SegmentProd", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_segment_ids_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(segment_ids_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SegmentProd", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3000,33 +2817,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_segmentMin(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong segment_ids) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SegmentMin", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SegmentMin", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_segment_ids_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(segment_ids_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SegmentMin", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3034,33 +2848,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_segmentMax(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong segment_ids) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SegmentMax", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SegmentMax", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_segment_ids_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(segment_ids_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SegmentMax", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3068,37 +2879,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_unsortedSegmentSum(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong segment_ids, jlong num_segments) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "UnsortedSegmentSum", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "UnsortedSegmentSum", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(num_segments_handle, TFE_TensorHandle, num_segments, 0);
-  TFE_OpAddInput(op.get(), num_segments_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(num_segments_handle, num_segments, 0);
+  TFE_OpAddInput(op.get(), num_segments_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_segment_ids_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(segment_ids_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "UnsortedSegmentSum", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3106,37 +2914,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_unsortedSegmentMax(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong segment_ids, jlong num_segments) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "UnsortedSegmentMax", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "UnsortedSegmentMax", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(num_segments_handle, TFE_TensorHandle, num_segments, 0);
-  TFE_OpAddInput(op.get(), num_segments_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(num_segments_handle, num_segments, 0);
+  TFE_OpAddInput(op.get(), num_segments_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_segment_ids_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(segment_ids_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "UnsortedSegmentMax", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3144,37 +2949,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sparseSegmentSum(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong indices, jlong segment_ids) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SparseSegmentSum", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SparseSegmentSum", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(indices_handle, TFE_TensorHandle, indices, 0);
-  TFE_OpAddInput(op.get(), indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, 0);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_indices_handle, TFE_TensorHandle, indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SparseSegmentSum", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3182,37 +2984,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sparseSegmentMean(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong indices, jlong segment_ids) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SparseSegmentMean", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SparseSegmentMean", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(indices_handle, TFE_TensorHandle, indices, 0);
-  TFE_OpAddInput(op.get(), indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, 0);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_indices_handle, TFE_TensorHandle, indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SparseSegmentMean", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3220,37 +3019,34 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sparseSegmentSqrtN(
     JNIEnv* env, jobject object, jlong context_handle, jlong data, jlong indices, jlong segment_ids) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SparseSegmentSqrtN", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SparseSegmentSqrtN", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(data_handle, TFE_TensorHandle, data, 0);
-  TFE_OpAddInput(op.get(), data_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(data_handle, data, 0);
+  TFE_OpAddInput(op.get(), data_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(indices_handle, TFE_TensorHandle, indices, 0);
-  TFE_OpAddInput(op.get(), indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, 0);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(segment_ids_handle, TFE_TensorHandle, segment_ids, 0);
-  TFE_OpAddInput(op.get(), segment_ids_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(segment_ids_handle, segment_ids, 0);
+  TFE_OpAddInput(op.get(), segment_ids_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_data_handle, TFE_TensorHandle, data, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_data_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(data_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tidx_indices_handle, TFE_TensorHandle, indices, 0);
-  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(attr_Tidx_indices_handle);
+  const TF_DataType attr_Tidx = TFE_TensorHandleDataType(indices_handle);
   TFE_OpSetAttrType(op.get(), "Tidx", attr_Tidx);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SparseSegmentSqrtN", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3258,25 +3054,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_diag(
     JNIEnv* env, jobject object, jlong context_handle, jlong diagonal) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Diag", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Diag", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(diagonal_handle, TFE_TensorHandle, diagonal, 0);
-  TFE_OpAddInput(op.get(), diagonal_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(diagonal_handle, diagonal, 0);
+  TFE_OpAddInput(op.get(), diagonal_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_diagonal_handle, TFE_TensorHandle, diagonal, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_diagonal_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(diagonal_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Diag", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3284,25 +3078,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_diagPart(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "DiagPart", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "DiagPart", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "DiagPart", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3310,25 +3102,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_matrixDiag(
     JNIEnv* env, jobject object, jlong context_handle, jlong diagonal) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MatrixDiag", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MatrixDiag", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(diagonal_handle, TFE_TensorHandle, diagonal, 0);
-  TFE_OpAddInput(op.get(), diagonal_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(diagonal_handle, diagonal, 0);
+  TFE_OpAddInput(op.get(), diagonal_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_diagonal_handle, TFE_TensorHandle, diagonal, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_diagonal_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(diagonal_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MatrixDiag", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3336,26 +3126,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_matrixSetDiag(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong diagonal) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MatrixSetDiag", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MatrixSetDiag", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(diagonal_handle, TFE_TensorHandle, diagonal, 0);
-  TFE_OpAddInput(op.get(), diagonal_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(diagonal_handle, diagonal, 0);
+  TFE_OpAddInput(op.get(), diagonal_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_diagonal_handle, TFE_TensorHandle, diagonal, 0);
-  const TF_DataType attr_T_diagonal = TFE_TensorHandleDataType(attr_T_diagonal_handle);
+  const TF_DataType attr_T_diagonal = TFE_TensorHandleDataType(diagonal_handle);
   if (attr_T != attr_T_diagonal) {
       std::stringstream error_msg;
       error_msg
@@ -3365,13 +3153,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MatrixSetDiag", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3379,25 +3167,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_matrixDiagPart(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MatrixDiagPart", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MatrixDiagPart", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MatrixDiagPart", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3405,33 +3191,31 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_matrixBandPart(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong num_lower, jlong num_upper) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MatrixBandPart", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MatrixBandPart", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(num_lower_handle, TFE_TensorHandle, num_lower, 0);
-  TFE_OpAddInput(op.get(), num_lower_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(num_lower_handle, num_lower, 0);
+  TFE_OpAddInput(op.get(), num_lower_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(num_upper_handle, TFE_TensorHandle, num_upper, 0);
-  TFE_OpAddInput(op.get(), num_upper_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(num_upper_handle, num_upper, 0);
+  TFE_OpAddInput(op.get(), num_upper_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MatrixBandPart", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3439,26 +3223,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_matMul(
     JNIEnv* env, jobject object, jlong context_handle, jlong a, jlong b, jboolean transpose_a, jboolean transpose_b) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MatMul", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MatMul", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(a_handle, TFE_TensorHandle, a, 0);
-  TFE_OpAddInput(op.get(), a_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(a_handle, a, 0);
+  TFE_OpAddInput(op.get(), a_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(b_handle, TFE_TensorHandle, b, 0);
-  TFE_OpAddInput(op.get(), b_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(b_handle, b, 0);
+  TFE_OpAddInput(op.get(), b_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_a_handle, TFE_TensorHandle, a, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_a_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(a_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_b_handle, TFE_TensorHandle, b, 0);
-  const TF_DataType attr_T_b = TFE_TensorHandleDataType(attr_T_b_handle);
+  const TF_DataType attr_T_b = TFE_TensorHandleDataType(b_handle);
   if (attr_T != attr_T_b) {
       std::stringstream error_msg;
       error_msg
@@ -3468,17 +3250,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'a'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrBool(op.get(), "transpose_a", static_cast<unsigned char>(transpose_a));
 
   TFE_OpSetAttrBool(op.get(), "transpose_b", static_cast<unsigned char>(transpose_b));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MatMul", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3486,26 +3268,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_batchMatMul(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y, jboolean adj_x, jboolean adj_y) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "BatchMatMul", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "BatchMatMul", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, 0);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, 0);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, 0);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, 0);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_y_handle, TFE_TensorHandle, y, 0);
-  const TF_DataType attr_T_y = TFE_TensorHandleDataType(attr_T_y_handle);
+  const TF_DataType attr_T_y = TFE_TensorHandleDataType(y_handle);
   if (attr_T != attr_T_y) {
       std::stringstream error_msg;
       error_msg
@@ -3515,17 +3295,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrBool(op.get(), "adj_x", static_cast<unsigned char>(adj_x));
 
   TFE_OpSetAttrBool(op.get(), "adj_y", static_cast<unsigned char>(adj_y));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "BatchMatMul", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3533,26 +3313,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_sparseMatMul(
     JNIEnv* env, jobject object, jlong context_handle, jlong a, jlong b, jboolean transpose_a, jboolean transpose_b, jboolean a_is_sparse, jboolean b_is_sparse) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SparseMatMul", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SparseMatMul", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(a_handle, TFE_TensorHandle, a, 0);
-  TFE_OpAddInput(op.get(), a_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(a_handle, a, 0);
+  TFE_OpAddInput(op.get(), a_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(b_handle, TFE_TensorHandle, b, 0);
-  TFE_OpAddInput(op.get(), b_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(b_handle, b, 0);
+  TFE_OpAddInput(op.get(), b_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_Tb_b_handle, TFE_TensorHandle, b, 0);
-  const TF_DataType attr_Tb = TFE_TensorHandleDataType(attr_Tb_b_handle);
+  const TF_DataType attr_Tb = TFE_TensorHandleDataType(b_handle);
   TFE_OpSetAttrType(op.get(), "Tb", attr_Tb);
 
-  REQUIRE_HANDLE(attr_Ta_a_handle, TFE_TensorHandle, a, 0);
-  const TF_DataType attr_Ta = TFE_TensorHandleDataType(attr_Ta_a_handle);
+  const TF_DataType attr_Ta = TFE_TensorHandleDataType(a_handle);
   TFE_OpSetAttrType(op.get(), "Ta", attr_Ta);
 
   TFE_OpSetAttrBool(op.get(), "transpose_a", static_cast<unsigned char>(transpose_a));
@@ -3563,11 +3341,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 
   TFE_OpSetAttrBool(op.get(), "b_is_sparse", static_cast<unsigned char>(b_is_sparse));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SparseMatMul", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3575,26 +3352,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_cross(
     JNIEnv* env, jobject object, jlong context_handle, jlong a, jlong b) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Cross", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Cross", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(a_handle, TFE_TensorHandle, a, 0);
-  TFE_OpAddInput(op.get(), a_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(a_handle, a, 0);
+  TFE_OpAddInput(op.get(), a_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(b_handle, TFE_TensorHandle, b, 0);
-  TFE_OpAddInput(op.get(), b_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(b_handle, b, 0);
+  TFE_OpAddInput(op.get(), b_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_a_handle, TFE_TensorHandle, a, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_a_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(a_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_b_handle, TFE_TensorHandle, b, 0);
-  const TF_DataType attr_T_b = TFE_TensorHandleDataType(attr_T_b_handle);
+  const TF_DataType attr_T_b = TFE_TensorHandleDataType(b_handle);
   if (attr_T != attr_T_b) {
       std::stringstream error_msg;
       error_msg
@@ -3604,13 +3379,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'a'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Cross", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3618,26 +3393,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_complex(
     JNIEnv* env, jobject object, jlong context_handle, jlong real, jlong imag, jint tout) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Complex", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Complex", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(real_handle, TFE_TensorHandle, real, 0);
-  TFE_OpAddInput(op.get(), real_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(real_handle, real, 0);
+  TFE_OpAddInput(op.get(), real_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(imag_handle, TFE_TensorHandle, imag, 0);
-  TFE_OpAddInput(op.get(), imag_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(imag_handle, imag, 0);
+  TFE_OpAddInput(op.get(), imag_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_real_handle, TFE_TensorHandle, real, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_real_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(real_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_imag_handle, TFE_TensorHandle, imag, 0);
-  const TF_DataType attr_T_imag = TFE_TensorHandleDataType(attr_T_imag_handle);
+  const TF_DataType attr_T_imag = TFE_TensorHandleDataType(imag_handle);
   if (attr_T != attr_T_imag) {
       std::stringstream error_msg;
       error_msg
@@ -3647,15 +3420,15 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'real'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrType(op.get(), "Tout", static_cast<TF_DataType>(tout));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Complex", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3663,27 +3436,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_real(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jint tout) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Real", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Real", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "Tout", static_cast<TF_DataType>(tout));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Real", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3691,27 +3462,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_imag(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jint tout) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Imag", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Imag", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "Tout", static_cast<TF_DataType>(tout));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Imag", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3719,27 +3488,25 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_angle(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jint tout) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Angle", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Angle", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "Tout", static_cast<TF_DataType>(tout));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Angle", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3747,25 +3514,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_conj(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Conj", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Conj", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Conj", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3773,18 +3538,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_bucketize(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jfloatArray boundaries) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Bucketize", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Bucketize", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int boundaries_n = env->GetArrayLength(boundaries);
@@ -3796,11 +3560,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
   TFE_OpSetAttrFloatList(op.get(), "boundaries", boundaries_c_value.get(), boundaries_n);
   env->ReleaseFloatArrayElements(boundaries, boundaries_elems, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Bucketize", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -3808,51 +3571,48 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_quantizedAdd(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y, jlong min_x, jlong max_x, jlong min_y, jlong max_y, jint toutput) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedAdd", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedAdd", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, nullptr);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, nullptr);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, nullptr);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, nullptr);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_x_handle, TFE_TensorHandle, min_x, nullptr);
-  TFE_OpAddInput(op.get(), min_x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_x_handle, min_x, nullptr);
+  TFE_OpAddInput(op.get(), min_x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_x_handle, TFE_TensorHandle, max_x, nullptr);
-  TFE_OpAddInput(op.get(), max_x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_x_handle, max_x, nullptr);
+  TFE_OpAddInput(op.get(), max_x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_y_handle, TFE_TensorHandle, min_y, nullptr);
-  TFE_OpAddInput(op.get(), min_y_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_y_handle, min_y, nullptr);
+  TFE_OpAddInput(op.get(), min_y_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_y_handle, TFE_TensorHandle, max_y, nullptr);
-  TFE_OpAddInput(op.get(), max_y_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_y_handle, max_y, nullptr);
+  TFE_OpAddInput(op.get(), max_y_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T2_y_handle, TFE_TensorHandle, y, nullptr);
-  const TF_DataType attr_T2 = TFE_TensorHandleDataType(attr_T2_y_handle);
+  const TF_DataType attr_T2 = TFE_TensorHandleDataType(y_handle);
   TFE_OpSetAttrType(op.get(), "T2", attr_T2);
 
-  REQUIRE_HANDLE(attr_T1_x_handle, TFE_TensorHandle, x, nullptr);
-  const TF_DataType attr_T1 = TFE_TensorHandleDataType(attr_T1_x_handle);
+  const TF_DataType attr_T1 = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T1", attr_T1);
 
   TFE_OpSetAttrType(op.get(), "Toutput", static_cast<TF_DataType>(toutput));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedAdd", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -3866,51 +3626,48 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_quantizedMul(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong y, jlong min_x, jlong max_x, jlong min_y, jlong max_y, jint toutput) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedMul", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedMul", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, nullptr);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, nullptr);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(y_handle, TFE_TensorHandle, y, nullptr);
-  TFE_OpAddInput(op.get(), y_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(y_handle, y, nullptr);
+  TFE_OpAddInput(op.get(), y_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_x_handle, TFE_TensorHandle, min_x, nullptr);
-  TFE_OpAddInput(op.get(), min_x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_x_handle, min_x, nullptr);
+  TFE_OpAddInput(op.get(), min_x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_x_handle, TFE_TensorHandle, max_x, nullptr);
-  TFE_OpAddInput(op.get(), max_x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_x_handle, max_x, nullptr);
+  TFE_OpAddInput(op.get(), max_x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_y_handle, TFE_TensorHandle, min_y, nullptr);
-  TFE_OpAddInput(op.get(), min_y_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_y_handle, min_y, nullptr);
+  TFE_OpAddInput(op.get(), min_y_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_y_handle, TFE_TensorHandle, max_y, nullptr);
-  TFE_OpAddInput(op.get(), max_y_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_y_handle, max_y, nullptr);
+  TFE_OpAddInput(op.get(), max_y_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T2_y_handle, TFE_TensorHandle, y, nullptr);
-  const TF_DataType attr_T2 = TFE_TensorHandleDataType(attr_T2_y_handle);
+  const TF_DataType attr_T2 = TFE_TensorHandleDataType(y_handle);
   TFE_OpSetAttrType(op.get(), "T2", attr_T2);
 
-  REQUIRE_HANDLE(attr_T1_x_handle, TFE_TensorHandle, x, nullptr);
-  const TF_DataType attr_T1 = TFE_TensorHandleDataType(attr_T1_x_handle);
+  const TF_DataType attr_T1 = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T1", attr_T1);
 
   TFE_OpSetAttrType(op.get(), "Toutput", static_cast<TF_DataType>(toutput));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedMul", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -3924,42 +3681,40 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_quantizedMatMul(
     JNIEnv* env, jobject object, jlong context_handle, jlong a, jlong b, jlong min_a, jlong max_a, jlong min_b, jlong max_b, jint toutput, jboolean transpose_a, jboolean transpose_b, jint tactivation) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedMatMul", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedMatMul", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(a_handle, TFE_TensorHandle, a, nullptr);
-  TFE_OpAddInput(op.get(), a_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(a_handle, a, nullptr);
+  TFE_OpAddInput(op.get(), a_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(b_handle, TFE_TensorHandle, b, nullptr);
-  TFE_OpAddInput(op.get(), b_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(b_handle, b, nullptr);
+  TFE_OpAddInput(op.get(), b_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_a_handle, TFE_TensorHandle, min_a, nullptr);
-  TFE_OpAddInput(op.get(), min_a_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_a_handle, min_a, nullptr);
+  TFE_OpAddInput(op.get(), min_a_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_a_handle, TFE_TensorHandle, max_a, nullptr);
-  TFE_OpAddInput(op.get(), max_a_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_a_handle, max_a, nullptr);
+  TFE_OpAddInput(op.get(), max_a_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_b_handle, TFE_TensorHandle, min_b, nullptr);
-  TFE_OpAddInput(op.get(), min_b_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_b_handle, min_b, nullptr);
+  TFE_OpAddInput(op.get(), min_b_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_b_handle, TFE_TensorHandle, max_b, nullptr);
-  TFE_OpAddInput(op.get(), max_b_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_b_handle, max_b, nullptr);
+  TFE_OpAddInput(op.get(), max_b_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T2_b_handle, TFE_TensorHandle, b, nullptr);
-  const TF_DataType attr_T2 = TFE_TensorHandleDataType(attr_T2_b_handle);
+  const TF_DataType attr_T2 = TFE_TensorHandleDataType(b_handle);
   TFE_OpSetAttrType(op.get(), "T2", attr_T2);
 
-  REQUIRE_HANDLE(attr_T1_a_handle, TFE_TensorHandle, a, nullptr);
-  const TF_DataType attr_T1 = TFE_TensorHandleDataType(attr_T1_a_handle);
+  const TF_DataType attr_T1 = TFE_TensorHandleDataType(a_handle);
   TFE_OpSetAttrType(op.get(), "T1", attr_T1);
 
   TFE_OpSetAttrType(op.get(), "Toutput", static_cast<TF_DataType>(toutput));
@@ -3970,11 +3725,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 
   TFE_OpSetAttrType(op.get(), "Tactivation", static_cast<TF_DataType>(tactivation));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedMatMul", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -3988,35 +3742,33 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_quantizeDownAndShrinkRange(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong input_min, jlong input_max, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizeDownAndShrinkRange", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizeDownAndShrinkRange", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_min_handle, TFE_TensorHandle, input_min, nullptr);
-  TFE_OpAddInput(op.get(), input_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_min_handle, input_min, nullptr);
+  TFE_OpAddInput(op.get(), input_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_max_handle, TFE_TensorHandle, input_max, nullptr);
-  TFE_OpAddInput(op.get(), input_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_max_handle, input_max, nullptr);
+  TFE_OpAddInput(op.get(), input_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tinput_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(attr_Tinput_input_handle);
+  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "Tinput", attr_Tinput);
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizeDownAndShrinkRange", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -4030,43 +3782,41 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_requantize(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong input_min, jlong input_max, jlong requested_output_min, jlong requested_output_max, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Requantize", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "Requantize", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_min_handle, TFE_TensorHandle, input_min, nullptr);
-  TFE_OpAddInput(op.get(), input_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_min_handle, input_min, nullptr);
+  TFE_OpAddInput(op.get(), input_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_max_handle, TFE_TensorHandle, input_max, nullptr);
-  TFE_OpAddInput(op.get(), input_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_max_handle, input_max, nullptr);
+  TFE_OpAddInput(op.get(), input_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(requested_output_min_handle, TFE_TensorHandle, requested_output_min, nullptr);
-  TFE_OpAddInput(op.get(), requested_output_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(requested_output_min_handle, requested_output_min, nullptr);
+  TFE_OpAddInput(op.get(), requested_output_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(requested_output_max_handle, TFE_TensorHandle, requested_output_max, nullptr);
-  TFE_OpAddInput(op.get(), requested_output_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(requested_output_max_handle, requested_output_max, nullptr);
+  TFE_OpAddInput(op.get(), requested_output_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tinput_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(attr_Tinput_input_handle);
+  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "Tinput", attr_Tinput);
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "Requantize", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -4080,33 +3830,31 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_requantizationRange(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong input_min, jlong input_max) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "RequantizationRange", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "RequantizationRange", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_min_handle, TFE_TensorHandle, input_min, nullptr);
-  TFE_OpAddInput(op.get(), input_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_min_handle, input_min, nullptr);
+  TFE_OpAddInput(op.get(), input_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_max_handle, TFE_TensorHandle, input_max, nullptr);
-  TFE_OpAddInput(op.get(), input_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_max_handle, input_max, nullptr);
+  TFE_OpAddInput(op.get(), input_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tinput_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(attr_Tinput_input_handle);
+  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "Tinput", attr_Tinput);
 
-  const int num_outputs = 2;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "RequantizationRange", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -4120,26 +3868,24 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math_00024_compareAndBitpack(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong threshold) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "CompareAndBitpack", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "CompareAndBitpack", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(threshold_handle, TFE_TensorHandle, threshold, 0);
-  TFE_OpAddInput(op.get(), threshold_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(threshold_handle, threshold, 0);
+  TFE_OpAddInput(op.get(), threshold_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_threshold_handle, TFE_TensorHandle, threshold, 0);
-  const TF_DataType attr_T_threshold = TFE_TensorHandleDataType(attr_T_threshold_handle);
+  const TF_DataType attr_T_threshold = TFE_TensorHandleDataType(threshold_handle);
   if (attr_T != attr_T_threshold) {
       std::stringstream error_msg;
       error_msg
@@ -4149,13 +3895,13 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Math
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "CompareAndBitpack", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
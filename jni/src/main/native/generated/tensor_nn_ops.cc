@@ -30,26 +30,24 @@
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_biasAdd(
     JNIEnv* env, jobject object, jlong context_handle, jlong value, jlong bias, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "BiasAdd", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "BiasAdd", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(value_handle, TFE_TensorHandle, value, 0);
-  TFE_OpAddInput(op.get(), value_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(value_handle, value, 0);
+  TFE_OpAddInput(op.get(), value_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(bias_handle, TFE_TensorHandle, bias, 0);
-  TFE_OpAddInput(op.get(), bias_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(bias_handle, bias, 0);
+  TFE_OpAddInput(op.get(), bias_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_value_handle, TFE_TensorHandle, value, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_bias_handle, TFE_TensorHandle, bias, 0);
-  const TF_DataType attr_T_bias = TFE_TensorHandleDataType(attr_T_bias_handle);
+  const TF_DataType attr_T_bias = TFE_TensorHandleDataType(bias_handle);
   if (attr_T != attr_T_bias) {
       std::stringstream error_msg;
       error_msg
@@ -59,17 +57,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'value'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   jbyte *data_format_c_value = env->GetByteArrayElements(data_format, nullptr);
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "BiasAdd", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -77,25 +75,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_relu(
     JNIEnv* env, jobject object, jlong context_handle, jlong features) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Relu", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Relu", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, 0);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, 0);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_features_handle, TFE_TensorHandle, features, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_features_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Relu", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -103,25 +99,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_relu6(
     JNIEnv* env, jobject object, jlong context_handle, jlong features) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Relu6", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Relu6", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, 0);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, 0);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_features_handle, TFE_TensorHandle, features, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_features_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Relu6", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -129,25 +123,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_elu(
     JNIEnv* env, jobject object, jlong context_handle, jlong features) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Elu", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Elu", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, 0);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, 0);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_features_handle, TFE_TensorHandle, features, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_features_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Elu", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -155,25 +147,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_selu(
     JNIEnv* env, jobject object, jlong context_handle, jlong features) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Selu", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Selu", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, 0);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, 0);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_features_handle, TFE_TensorHandle, features, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_features_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Selu", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -181,25 +171,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_softplus(
     JNIEnv* env, jobject object, jlong context_handle, jlong features) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Softplus", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Softplus", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, 0);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, 0);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_features_handle, TFE_TensorHandle, features, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_features_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Softplus", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -207,25 +195,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_softsign(
     JNIEnv* env, jobject object, jlong context_handle, jlong features) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Softsign", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Softsign", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, 0);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, 0);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_features_handle, TFE_TensorHandle, features, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_features_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Softsign", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -233,25 +219,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_softmax(
     JNIEnv* env, jobject object, jlong context_handle, jlong logits) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Softmax", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Softmax", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(logits_handle, TFE_TensorHandle, logits, 0);
-  TFE_OpAddInput(op.get(), logits_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(logits_handle, logits, 0);
+  TFE_OpAddInput(op.get(), logits_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_logits_handle, TFE_TensorHandle, logits, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_logits_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(logits_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Softmax", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -259,25 +243,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_logSoftmax(
     JNIEnv* env, jobject object, jlong context_handle, jlong logits) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "LogSoftmax", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "LogSoftmax", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(logits_handle, TFE_TensorHandle, logits, 0);
-  TFE_OpAddInput(op.get(), logits_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(logits_handle, logits, 0);
+  TFE_OpAddInput(op.get(), logits_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_logits_handle, TFE_TensorHandle, logits, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_logits_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(logits_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "LogSoftmax", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -285,25 +267,23 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_l2Loss(
     JNIEnv* env, jobject object, jlong context_handle, jlong t) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "L2Loss", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "L2Loss", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(t_handle, TFE_TensorHandle, t, 0);
-  TFE_OpAddInput(op.get(), t_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(t_handle, t, 0);
+  TFE_OpAddInput(op.get(), t_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_t_handle, TFE_TensorHandle, t, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_t_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(t_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "L2Loss", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -311,26 +291,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_softmaxCrossEntropyWithLogits(
     JNIEnv* env, jobject object, jlong context_handle, jlong features, jlong labels) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SoftmaxCrossEntropyWithLogits", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "SoftmaxCrossEntropyWithLogits", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, nullptr);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, nullptr);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(labels_handle, TFE_TensorHandle, labels, nullptr);
-  TFE_OpAddInput(op.get(), labels_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(labels_handle, labels, nullptr);
+  TFE_OpAddInput(op.get(), labels_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_features_handle, TFE_TensorHandle, features, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_features_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_labels_handle, TFE_TensorHandle, labels, nullptr);
-  const TF_DataType attr_T_labels = TFE_TensorHandleDataType(attr_T_labels_handle);
+  const TF_DataType attr_T_labels = TFE_TensorHandleDataType(labels_handle);
   if (attr_T != attr_T_labels) {
       std::stringstream error_msg;
       error_msg
@@ -340,13 +318,13 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_T
           << "' of argument 'features'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
-  const int num_outputs = 2;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "SoftmaxCrossEntropyWithLogits", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -360,33 +338,30 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_sparseSoftmaxCrossEntropyWithLogits(
     JNIEnv* env, jobject object, jlong context_handle, jlong features, jlong labels) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SparseSoftmaxCrossEntropyWithLogits", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "SparseSoftmaxCrossEntropyWithLogits", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, nullptr);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, nullptr);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(labels_handle, TFE_TensorHandle, labels, nullptr);
-  TFE_OpAddInput(op.get(), labels_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(labels_handle, labels, nullptr);
+  TFE_OpAddInput(op.get(), labels_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tlabels_labels_handle, TFE_TensorHandle, labels, nullptr);
-  const TF_DataType attr_Tlabels = TFE_TensorHandleDataType(attr_Tlabels_labels_handle);
+  const TF_DataType attr_Tlabels = TFE_TensorHandleDataType(labels_handle);
   TFE_OpSetAttrType(op.get(), "Tlabels", attr_Tlabels);
 
-  REQUIRE_HANDLE(attr_T_features_handle, TFE_TensorHandle, features, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_features_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  const int num_outputs = 2;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "SparseSoftmaxCrossEntropyWithLogits", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -400,31 +375,29 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_topKV2(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong k, jboolean sorted) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "TopKV2", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "TopKV2", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(k_handle, TFE_TensorHandle, k, nullptr);
-  TFE_OpAddInput(op.get(), k_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(k_handle, k, nullptr);
+  TFE_OpAddInput(op.get(), k_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrBool(op.get(), "sorted", static_cast<unsigned char>(sorted));
 
-  const int num_outputs = 2;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "TopKV2", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -438,30 +411,28 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_inTopKV2(
     JNIEnv* env, jobject object, jlong context_handle, jlong predictions, jlong targets, jlong k) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "InTopKV2", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "InTopKV2", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(predictions_handle, TFE_TensorHandle, predictions, 0);
-  TFE_OpAddInput(op.get(), predictions_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(predictions_handle, predictions, 0);
+  TFE_OpAddInput(op.get(), predictions_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(targets_handle, TFE_TensorHandle, targets, 0);
-  TFE_OpAddInput(op.get(), targets_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(targets_handle, targets, 0);
+  TFE_OpAddInput(op.get(), targets_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(k_handle, TFE_TensorHandle, k, 0);
-  TFE_OpAddInput(op.get(), k_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(k_handle, k, 0);
+  TFE_OpAddInput(op.get(), k_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_targets_handle, TFE_TensorHandle, targets, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_targets_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(targets_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_k_handle, TFE_TensorHandle, k, 0);
-  const TF_DataType attr_T_k = TFE_TensorHandleDataType(attr_T_k_handle);
+  const TF_DataType attr_T_k = TFE_TensorHandleDataType(k_handle);
   if (attr_T != attr_T_k) {
       std::stringstream error_msg;
       error_msg
@@ -471,13 +442,94 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'targets'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "InTopKV2", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
+
+  return reinterpret_cast<jlong>(outputs[0]);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_largeTopK(
+    JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong k, jboolean sorted) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "LargeTopK", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
+
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  REQUIRE_TENSOR_HANDLE(k_handle, k, nullptr);
+  TFE_OpAddInput(op.get(), k_handle, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
+  TFE_OpSetAttrType(op.get(), "T", attr_T);
+
+  TFE_OpSetAttrBool(op.get(), "sorted", static_cast<unsigned char>(sorted));
+
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "LargeTopK", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
+  jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
+  for (int i = 0; i < num_outputs; ++i) {
+    output_elems[i] = reinterpret_cast<jlong>(outputs[i]);
+  }
+  env->ReleaseLongArrayElements(outputs_array, output_elems, 0);
+  return outputs_array;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_largeInTopK(
+    JNIEnv* env, jobject object, jlong context_handle, jlong predictions, jlong targets, jlong k) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "LargeInTopK", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(predictions_handle, predictions, 0);
+  TFE_OpAddInput(op.get(), predictions_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(targets_handle, targets, 0);
+  TFE_OpAddInput(op.get(), targets_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(k_handle, k, 0);
+  TFE_OpAddInput(op.get(), k_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  const TF_DataType attr_T = TFE_TensorHandleDataType(targets_handle);
+  TFE_OpSetAttrType(op.get(), "T", attr_T);
+
+  const TF_DataType attr_T_k = TFE_TensorHandleDataType(k_handle);
+  if (attr_T != attr_T_k) {
+      std::stringstream error_msg;
+      error_msg
+          << "Argument 'k' of 'largeInTopK' op with data type '"
+          << attr_T_k
+          << "' must match data type '"
+          << attr_T
+          << "' of argument 'targets'";
+      throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
+  }
+
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "LargeInTopK", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -485,18 +537,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_avgPool(
     JNIEnv* env, jobject object, jlong context_handle, jlong value, jlongArray ksize, jlongArray strides, jbyteArray padding, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "AvgPool", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "AvgPool", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(value_handle, TFE_TensorHandle, value, 0);
-  TFE_OpAddInput(op.get(), value_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(value_handle, value, 0);
+  TFE_OpAddInput(op.get(), value_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_value_handle, TFE_TensorHandle, value, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -525,11 +576,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "AvgPool", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -537,18 +587,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_avgPool3D(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlongArray ksize, jlongArray strides, jbyteArray padding, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "AvgPool3D", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "AvgPool3D", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -577,11 +626,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "AvgPool3D", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -589,18 +637,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_maxPool(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlongArray ksize, jlongArray strides, jbyteArray padding, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MaxPool", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MaxPool", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -629,11 +676,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MaxPool", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -641,30 +687,28 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_maxPoolGrad(
     JNIEnv* env, jobject object, jlong context_handle, jlong orig_input, jlong orig_output, jlong grad, jlongArray ksize, jlongArray strides, jbyteArray padding, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MaxPoolGrad", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MaxPoolGrad", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(orig_input_handle, TFE_TensorHandle, orig_input, 0);
-  TFE_OpAddInput(op.get(), orig_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(orig_input_handle, orig_input, 0);
+  TFE_OpAddInput(op.get(), orig_input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(orig_output_handle, TFE_TensorHandle, orig_output, 0);
-  TFE_OpAddInput(op.get(), orig_output_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(orig_output_handle, orig_output, 0);
+  TFE_OpAddInput(op.get(), orig_output_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(grad_handle, TFE_TensorHandle, grad, 0);
-  TFE_OpAddInput(op.get(), grad_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(grad_handle, grad, 0);
+  TFE_OpAddInput(op.get(), grad_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_orig_input_handle, TFE_TensorHandle, orig_input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_orig_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(orig_input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_orig_output_handle, TFE_TensorHandle, orig_output, 0);
-  const TF_DataType attr_T_orig_output = TFE_TensorHandleDataType(attr_T_orig_output_handle);
+  const TF_DataType attr_T_orig_output = TFE_TensorHandleDataType(orig_output_handle);
   if (attr_T != attr_T_orig_output) {
       std::stringstream error_msg;
       error_msg
@@ -674,10 +718,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'orig_input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_T_grad_handle, TFE_TensorHandle, grad, 0);
-  const TF_DataType attr_T_grad = TFE_TensorHandleDataType(attr_T_grad_handle);
+  const TF_DataType attr_T_grad = TFE_TensorHandleDataType(grad_handle);
   if (attr_T != attr_T_grad) {
       std::stringstream error_msg;
       error_msg
@@ -687,6 +731,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'orig_input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -715,11 +760,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MaxPoolGrad", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -727,30 +771,28 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_maxPoolGradGrad(
     JNIEnv* env, jobject object, jlong context_handle, jlong orig_input, jlong orig_output, jlong grad, jlongArray ksize, jlongArray strides, jbyteArray padding, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MaxPoolGradGrad", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MaxPoolGradGrad", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(orig_input_handle, TFE_TensorHandle, orig_input, 0);
-  TFE_OpAddInput(op.get(), orig_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(orig_input_handle, orig_input, 0);
+  TFE_OpAddInput(op.get(), orig_input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(orig_output_handle, TFE_TensorHandle, orig_output, 0);
-  TFE_OpAddInput(op.get(), orig_output_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(orig_output_handle, orig_output, 0);
+  TFE_OpAddInput(op.get(), orig_output_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(grad_handle, TFE_TensorHandle, grad, 0);
-  TFE_OpAddInput(op.get(), grad_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(grad_handle, grad, 0);
+  TFE_OpAddInput(op.get(), grad_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_orig_input_handle, TFE_TensorHandle, orig_input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_orig_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(orig_input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_orig_output_handle, TFE_TensorHandle, orig_output, 0);
-  const TF_DataType attr_T_orig_output = TFE_TensorHandleDataType(attr_T_orig_output_handle);
+  const TF_DataType attr_T_orig_output = TFE_TensorHandleDataType(orig_output_handle);
   if (attr_T != attr_T_orig_output) {
       std::stringstream error_msg;
       error_msg
@@ -760,10 +802,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'orig_input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_T_grad_handle, TFE_TensorHandle, grad, 0);
-  const TF_DataType attr_T_grad = TFE_TensorHandleDataType(attr_T_grad_handle);
+  const TF_DataType attr_T_grad = TFE_TensorHandleDataType(grad_handle);
   if (attr_T != attr_T_grad) {
       std::stringstream error_msg;
       error_msg
@@ -773,6 +815,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'orig_input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -801,11 +844,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MaxPoolGradGrad", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -813,18 +855,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_maxPool3D(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlongArray ksize, jlongArray strides, jbyteArray padding, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MaxPool3D", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "MaxPool3D", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -853,11 +894,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "MaxPool3D", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -865,18 +905,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_maxPoolWithArgmax(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlongArray ksize, jlongArray strides, jbyteArray padding, jint targmax) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "MaxPoolWithArgmax", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "MaxPoolWithArgmax", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -903,11 +942,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 
   TFE_OpSetAttrType(op.get(), "Targmax", static_cast<TF_DataType>(targmax));
 
-  const int num_outputs = 2;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "MaxPoolWithArgmax", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -921,18 +959,17 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_fractionalAvgPool(
     JNIEnv* env, jobject object, jlong context_handle, jlong value, jfloatArray pooling_ratio, jboolean pseudo_random, jboolean overlapping, jboolean deterministic, jlong seed, jlong seed2) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FractionalAvgPool", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "FractionalAvgPool", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(value_handle, TFE_TensorHandle, value, nullptr);
-  TFE_OpAddInput(op.get(), value_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(value_handle, value, nullptr);
+  TFE_OpAddInput(op.get(), value_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_value_handle, TFE_TensorHandle, value, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int pooling_ratio_n = env->GetArrayLength(pooling_ratio);
@@ -954,11 +991,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 
   TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "FractionalAvgPool", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -972,18 +1008,17 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_fractionalMaxPool(
     JNIEnv* env, jobject object, jlong context_handle, jlong value, jfloatArray pooling_ratio, jboolean pseudo_random, jboolean overlapping, jboolean deterministic, jlong seed, jlong seed2) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FractionalMaxPool", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "FractionalMaxPool", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(value_handle, TFE_TensorHandle, value, nullptr);
-  TFE_OpAddInput(op.get(), value_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(value_handle, value, nullptr);
+  TFE_OpAddInput(op.get(), value_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_value_handle, TFE_TensorHandle, value, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_value_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(value_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int pooling_ratio_n = env->GetArrayLength(pooling_ratio);
@@ -1005,11 +1040,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 
   TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "FractionalMaxPool", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1023,26 +1057,24 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_conv2D(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong filter, jlongArray strides, jbyteArray padding, jboolean use_cudnn_on_gpu, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Conv2D", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Conv2D", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(filter_handle, TFE_TensorHandle, filter, 0);
-  TFE_OpAddInput(op.get(), filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(filter_handle, filter, 0);
+  TFE_OpAddInput(op.get(), filter_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_filter_handle, TFE_TensorHandle, filter, 0);
-  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(attr_T_filter_handle);
+  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(filter_handle);
   if (attr_T != attr_T_filter) {
       std::stringstream error_msg;
       error_msg
@@ -1052,6 +1084,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   const int strides_n = env->GetArrayLength(strides);
@@ -1073,11 +1106,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Conv2D", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1085,30 +1117,28 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_conv2DBackpropInput(
     JNIEnv* env, jobject object, jlong context_handle, jlong input_sizes, jlong filter, jlong out_backprop, jlongArray strides, jbyteArray padding, jboolean use_cudnn_on_gpu, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Conv2DBackpropInput", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Conv2DBackpropInput", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_sizes_handle, TFE_TensorHandle, input_sizes, 0);
-  TFE_OpAddInput(op.get(), input_sizes_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_sizes_handle, input_sizes, 0);
+  TFE_OpAddInput(op.get(), input_sizes_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(filter_handle, TFE_TensorHandle, filter, 0);
-  TFE_OpAddInput(op.get(), filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(filter_handle, filter, 0);
+  TFE_OpAddInput(op.get(), filter_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(out_backprop_handle, TFE_TensorHandle, out_backprop, 0);
-  TFE_OpAddInput(op.get(), out_backprop_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(out_backprop_handle, out_backprop, 0);
+  TFE_OpAddInput(op.get(), out_backprop_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_filter_handle, TFE_TensorHandle, filter, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_filter_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(filter_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_out_backprop_handle, TFE_TensorHandle, out_backprop, 0);
-  const TF_DataType attr_T_out_backprop = TFE_TensorHandleDataType(attr_T_out_backprop_handle);
+  const TF_DataType attr_T_out_backprop = TFE_TensorHandleDataType(out_backprop_handle);
   if (attr_T != attr_T_out_backprop) {
       std::stringstream error_msg;
       error_msg
@@ -1118,6 +1148,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'filter'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   const int strides_n = env->GetArrayLength(strides);
@@ -1139,11 +1170,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Conv2DBackpropInput", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1151,30 +1181,28 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_conv2DBackpropFilter(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong filter_sizes, jlong out_backprop, jlongArray strides, jbyteArray padding, jboolean use_cudnn_on_gpu, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Conv2DBackpropFilter", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Conv2DBackpropFilter", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(filter_sizes_handle, TFE_TensorHandle, filter_sizes, 0);
-  TFE_OpAddInput(op.get(), filter_sizes_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(filter_sizes_handle, filter_sizes, 0);
+  TFE_OpAddInput(op.get(), filter_sizes_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(out_backprop_handle, TFE_TensorHandle, out_backprop, 0);
-  TFE_OpAddInput(op.get(), out_backprop_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(out_backprop_handle, out_backprop, 0);
+  TFE_OpAddInput(op.get(), out_backprop_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_out_backprop_handle, TFE_TensorHandle, out_backprop, 0);
-  const TF_DataType attr_T_out_backprop = TFE_TensorHandleDataType(attr_T_out_backprop_handle);
+  const TF_DataType attr_T_out_backprop = TFE_TensorHandleDataType(out_backprop_handle);
   if (attr_T != attr_T_out_backprop) {
       std::stringstream error_msg;
       error_msg
@@ -1184,6 +1212,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   const int strides_n = env->GetArrayLength(strides);
@@ -1205,11 +1234,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Conv2DBackpropFilter", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1217,34 +1245,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_fusedResizeAndPadConv2D(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong size, jlong paddings, jlong filter, jbyteArray mode, jlongArray strides, jbyteArray padding, jboolean resize_align_corners) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FusedResizeAndPadConv2D", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "FusedResizeAndPadConv2D", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(size_handle, TFE_TensorHandle, size, 0);
-  TFE_OpAddInput(op.get(), size_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(size_handle, size, 0);
+  TFE_OpAddInput(op.get(), size_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(paddings_handle, TFE_TensorHandle, paddings, 0);
-  TFE_OpAddInput(op.get(), paddings_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(paddings_handle, paddings, 0);
+  TFE_OpAddInput(op.get(), paddings_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(filter_handle, TFE_TensorHandle, filter, 0);
-  TFE_OpAddInput(op.get(), filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(filter_handle, filter, 0);
+  TFE_OpAddInput(op.get(), filter_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_filter_handle, TFE_TensorHandle, filter, 0);
-  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(attr_T_filter_handle);
+  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(filter_handle);
   if (attr_T != attr_T_filter) {
       std::stringstream error_msg;
       error_msg
@@ -1254,6 +1280,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   jbyte *mode_c_value = env->GetByteArrayElements(mode, nullptr);
@@ -1275,11 +1302,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 
   TFE_OpSetAttrBool(op.get(), "resize_align_corners", static_cast<unsigned char>(resize_align_corners));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "FusedResizeAndPadConv2D", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1287,30 +1313,28 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_fusedPadConv2D(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong paddings, jlong filter, jbyteArray mode, jlongArray strides, jbyteArray padding) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FusedPadConv2D", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "FusedPadConv2D", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(paddings_handle, TFE_TensorHandle, paddings, 0);
-  TFE_OpAddInput(op.get(), paddings_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(paddings_handle, paddings, 0);
+  TFE_OpAddInput(op.get(), paddings_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(filter_handle, TFE_TensorHandle, filter, 0);
-  TFE_OpAddInput(op.get(), filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(filter_handle, filter, 0);
+  TFE_OpAddInput(op.get(), filter_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_filter_handle, TFE_TensorHandle, filter, 0);
-  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(attr_T_filter_handle);
+  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(filter_handle);
   if (attr_T != attr_T_filter) {
       std::stringstream error_msg;
       error_msg
@@ -1320,6 +1344,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   jbyte *mode_c_value = env->GetByteArrayElements(mode, nullptr);
@@ -1339,11 +1364,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "padding", reinterpret_cast<const char *>(padding_c_value));
   env->ReleaseByteArrayElements(padding, padding_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "FusedPadConv2D", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1351,26 +1375,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_depthwiseConv2dNative(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong filter, jlongArray strides, jbyteArray padding, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "DepthwiseConv2dNative", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "DepthwiseConv2dNative", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(filter_handle, TFE_TensorHandle, filter, 0);
-  TFE_OpAddInput(op.get(), filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(filter_handle, filter, 0);
+  TFE_OpAddInput(op.get(), filter_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_filter_handle, TFE_TensorHandle, filter, 0);
-  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(attr_T_filter_handle);
+  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(filter_handle);
   if (attr_T != attr_T_filter) {
       std::stringstream error_msg;
       error_msg
@@ -1380,6 +1402,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   const int strides_n = env->GetArrayLength(strides);
@@ -1399,11 +1422,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "DepthwiseConv2dNative", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1411,26 +1433,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_conv3D(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong filter, jlongArray strides, jbyteArray padding, jbyteArray data_format) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Conv3D", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Conv3D", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(filter_handle, TFE_TensorHandle, filter, 0);
-  TFE_OpAddInput(op.get(), filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(filter_handle, filter, 0);
+  TFE_OpAddInput(op.get(), filter_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_filter_handle, TFE_TensorHandle, filter, 0);
-  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(attr_T_filter_handle);
+  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(filter_handle);
   if (attr_T != attr_T_filter) {
       std::stringstream error_msg;
       error_msg
@@ -1440,6 +1460,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   const int strides_n = env->GetArrayLength(strides);
@@ -1459,11 +1480,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "data_format", reinterpret_cast<const char *>(data_format_c_value));
   env->ReleaseByteArrayElements(data_format, data_format_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Conv3D", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1471,26 +1491,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_dilation2D(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong filter, jlongArray strides, jlongArray rates, jbyteArray padding) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "Dilation2D", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "Dilation2D", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(filter_handle, TFE_TensorHandle, filter, 0);
-  TFE_OpAddInput(op.get(), filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(filter_handle, filter, 0);
+  TFE_OpAddInput(op.get(), filter_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_filter_handle, TFE_TensorHandle, filter, 0);
-  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(attr_T_filter_handle);
+  const TF_DataType attr_T_filter = TFE_TensorHandleDataType(filter_handle);
   if (attr_T != attr_T_filter) {
       std::stringstream error_msg;
       error_msg
@@ -1500,6 +1518,7 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 'input'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   const int strides_n = env->GetArrayLength(strides);
@@ -1524,11 +1543,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
   TFE_OpSetAttrString(op.get(), "padding", reinterpret_cast<const char *>(padding_c_value));
   env->ReleaseByteArrayElements(padding, padding_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "Dilation2D", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1536,18 +1554,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_lRN(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong depth_radius, jfloat bias, jfloat alpha, jfloat beta) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "LRN", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "LRN", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrInt(op.get(), "depth_radius", static_cast<int64_t>(depth_radius));
@@ -1558,11 +1575,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 
   TFE_OpSetAttrFloat(op.get(), "beta", static_cast<float>(beta));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "LRN", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1570,38 +1586,36 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_batchNormWithGlobalNormalization(
     JNIEnv* env, jobject object, jlong context_handle, jlong t, jlong m, jlong v, jlong beta, jlong gamma, jfloat variance_epsilon, jboolean scale_after_normalization) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "BatchNormWithGlobalNormalization", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "BatchNormWithGlobalNormalization", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(t_handle, TFE_TensorHandle, t, 0);
-  TFE_OpAddInput(op.get(), t_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(t_handle, t, 0);
+  TFE_OpAddInput(op.get(), t_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(m_handle, TFE_TensorHandle, m, 0);
-  TFE_OpAddInput(op.get(), m_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(m_handle, m, 0);
+  TFE_OpAddInput(op.get(), m_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(v_handle, TFE_TensorHandle, v, 0);
-  TFE_OpAddInput(op.get(), v_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(v_handle, v, 0);
+  TFE_OpAddInput(op.get(), v_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(beta_handle, TFE_TensorHandle, beta, 0);
-  TFE_OpAddInput(op.get(), beta_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(beta_handle, beta, 0);
+  TFE_OpAddInput(op.get(), beta_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(gamma_handle, TFE_TensorHandle, gamma, 0);
-  TFE_OpAddInput(op.get(), gamma_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(gamma_handle, gamma, 0);
+  TFE_OpAddInput(op.get(), gamma_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_t_handle, TFE_TensorHandle, t, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_t_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(t_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_m_handle, TFE_TensorHandle, m, 0);
-  const TF_DataType attr_T_m = TFE_TensorHandleDataType(attr_T_m_handle);
+  const TF_DataType attr_T_m = TFE_TensorHandleDataType(m_handle);
   if (attr_T != attr_T_m) {
       std::stringstream error_msg;
       error_msg
@@ -1611,10 +1625,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_T_v_handle, TFE_TensorHandle, v, 0);
-  const TF_DataType attr_T_v = TFE_TensorHandleDataType(attr_T_v_handle);
+  const TF_DataType attr_T_v = TFE_TensorHandleDataType(v_handle);
   if (attr_T != attr_T_v) {
       std::stringstream error_msg;
       error_msg
@@ -1624,10 +1638,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_T_beta_handle, TFE_TensorHandle, beta, 0);
-  const TF_DataType attr_T_beta = TFE_TensorHandleDataType(attr_T_beta_handle);
+  const TF_DataType attr_T_beta = TFE_TensorHandleDataType(beta_handle);
   if (attr_T != attr_T_beta) {
       std::stringstream error_msg;
       error_msg
@@ -1637,10 +1651,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_T_gamma_handle, TFE_TensorHandle, gamma, 0);
-  const TF_DataType attr_T_gamma = TFE_TensorHandleDataType(attr_T_gamma_handle);
+  const TF_DataType attr_T_gamma = TFE_TensorHandleDataType(gamma_handle);
   if (attr_T != attr_T_gamma) {
       std::stringstream error_msg;
       error_msg
@@ -1650,17 +1664,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
           << attr_T
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrFloat(op.get(), "variance_epsilon", static_cast<float>(variance_epsilon));
 
   TFE_OpSetAttrBool(op.get(), "scale_after_normalization", static_cast<unsigned char>(scale_after_normalization));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "BatchNormWithGlobalNormalization", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -1668,38 +1682,36 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_0
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_fusedBatchNorm(
     JNIEnv* env, jobject object, jlong context_handle, jlong x, jlong scale, jlong offset, jlong mean, jlong variance, jfloat epsilon, jbyteArray data_format, jboolean is_training) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "FusedBatchNorm", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "FusedBatchNorm", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(x_handle, TFE_TensorHandle, x, nullptr);
-  TFE_OpAddInput(op.get(), x_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(x_handle, x, nullptr);
+  TFE_OpAddInput(op.get(), x_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(scale_handle, TFE_TensorHandle, scale, nullptr);
-  TFE_OpAddInput(op.get(), scale_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(scale_handle, scale, nullptr);
+  TFE_OpAddInput(op.get(), scale_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(offset_handle, TFE_TensorHandle, offset, nullptr);
-  TFE_OpAddInput(op.get(), offset_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(offset_handle, offset, nullptr);
+  TFE_OpAddInput(op.get(), offset_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(mean_handle, TFE_TensorHandle, mean, nullptr);
-  TFE_OpAddInput(op.get(), mean_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(mean_handle, mean, nullptr);
+  TFE_OpAddInput(op.get(), mean_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(variance_handle, TFE_TensorHandle, variance, nullptr);
-  TFE_OpAddInput(op.get(), variance_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(variance_handle, variance, nullptr);
+  TFE_OpAddInput(op.get(), variance_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_x_handle, TFE_TensorHandle, x, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_x_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(x_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_T_scale_handle, TFE_TensorHandle, scale, nullptr);
-  const TF_DataType attr_T_scale = TFE_TensorHandleDataType(attr_T_scale_handle);
+  const TF_DataType attr_T_scale = TFE_TensorHandleDataType(scale_handle);
   if (attr_T != attr_T_scale) {
       std::stringstream error_msg;
       error_msg
@@ -1709,10 +1721,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
-  REQUIRE_HANDLE(attr_T_offset_handle, TFE_TensorHandle, offset, nullptr);
-  const TF_DataType attr_T_offset = TFE_TensorHandleDataType(attr_T_offset_handle);
+  const TF_DataType attr_T_offset = TFE_TensorHandleDataType(offset_handle);
   if (attr_T != attr_T_offset) {
       std::stringstream error_msg;
       error_msg
@@ -1722,10 +1734,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
-  REQUIRE_HANDLE(attr_T_mean_handle, TFE_TensorHandle, mean, nullptr);
-  const TF_DataType attr_T_mean = TFE_TensorHandleDataType(attr_T_mean_handle);
+  const TF_DataType attr_T_mean = TFE_TensorHandleDataType(mean_handle);
   if (attr_T != attr_T_mean) {
       std::stringstream error_msg;
       error_msg
@@ -1735,10 +1747,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
-  REQUIRE_HANDLE(attr_T_variance_handle, TFE_TensorHandle, variance, nullptr);
-  const TF_DataType attr_T_variance = TFE_TensorHandleDataType(attr_T_variance_handle);
+  const TF_DataType attr_T_variance = TFE_TensorHandleDataType(variance_handle);
   if (attr_T != attr_T_variance) {
       std::stringstream error_msg;
       error_msg
@@ -1748,6 +1760,7 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_T
           << "' of argument 'x'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
   TFE_OpSetAttrFloat(op.get(), "epsilon", static_cast<float>(epsilon));
@@ -1758,11 +1771,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 
   TFE_OpSetAttrBool(op.get(), "is_training", static_cast<unsigned char>(is_training));
 
-  const int num_outputs = 5;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[5];
+  int num_outputs = 5;
+  execute_eager_op(op.get(), "FusedBatchNorm", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1776,51 +1788,48 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_quantizedBiasAdd(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong bias, jlong min_input, jlong max_input, jlong min_bias, jlong max_bias, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedBiasAdd", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedBiasAdd", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(bias_handle, TFE_TensorHandle, bias, nullptr);
-  TFE_OpAddInput(op.get(), bias_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(bias_handle, bias, nullptr);
+  TFE_OpAddInput(op.get(), bias_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_input_handle, TFE_TensorHandle, min_input, nullptr);
-  TFE_OpAddInput(op.get(), min_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_input_handle, min_input, nullptr);
+  TFE_OpAddInput(op.get(), min_input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_input_handle, TFE_TensorHandle, max_input, nullptr);
-  TFE_OpAddInput(op.get(), max_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_input_handle, max_input, nullptr);
+  TFE_OpAddInput(op.get(), max_input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_bias_handle, TFE_TensorHandle, min_bias, nullptr);
-  TFE_OpAddInput(op.get(), min_bias_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_bias_handle, min_bias, nullptr);
+  TFE_OpAddInput(op.get(), min_bias_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_bias_handle, TFE_TensorHandle, max_bias, nullptr);
-  TFE_OpAddInput(op.get(), max_bias_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_bias_handle, max_bias, nullptr);
+  TFE_OpAddInput(op.get(), max_bias_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T2_bias_handle, TFE_TensorHandle, bias, nullptr);
-  const TF_DataType attr_T2 = TFE_TensorHandleDataType(attr_T2_bias_handle);
+  const TF_DataType attr_T2 = TFE_TensorHandleDataType(bias_handle);
   TFE_OpSetAttrType(op.get(), "T2", attr_T2);
 
-  REQUIRE_HANDLE(attr_T1_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_T1 = TFE_TensorHandleDataType(attr_T1_input_handle);
+  const TF_DataType attr_T1 = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T1", attr_T1);
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedBiasAdd", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1834,35 +1843,33 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_quantizedRelu(
     JNIEnv* env, jobject object, jlong context_handle, jlong features, jlong min_features, jlong max_features, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedRelu", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedRelu", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, nullptr);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, nullptr);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_features_handle, TFE_TensorHandle, min_features, nullptr);
-  TFE_OpAddInput(op.get(), min_features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_features_handle, min_features, nullptr);
+  TFE_OpAddInput(op.get(), min_features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_features_handle, TFE_TensorHandle, max_features, nullptr);
-  TFE_OpAddInput(op.get(), max_features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_features_handle, max_features, nullptr);
+  TFE_OpAddInput(op.get(), max_features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tinput_features_handle, TFE_TensorHandle, features, nullptr);
-  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(attr_Tinput_features_handle);
+  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "Tinput", attr_Tinput);
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedRelu", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1876,35 +1883,33 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_quantizedRelu6(
     JNIEnv* env, jobject object, jlong context_handle, jlong features, jlong min_features, jlong max_features, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedRelu6", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedRelu6", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, nullptr);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, nullptr);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_features_handle, TFE_TensorHandle, min_features, nullptr);
-  TFE_OpAddInput(op.get(), min_features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_features_handle, min_features, nullptr);
+  TFE_OpAddInput(op.get(), min_features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_features_handle, TFE_TensorHandle, max_features, nullptr);
-  TFE_OpAddInput(op.get(), max_features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_features_handle, max_features, nullptr);
+  TFE_OpAddInput(op.get(), max_features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tinput_features_handle, TFE_TensorHandle, features, nullptr);
-  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(attr_Tinput_features_handle);
+  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "Tinput", attr_Tinput);
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedRelu6", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1918,39 +1923,37 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_quantizedReluX(
     JNIEnv* env, jobject object, jlong context_handle, jlong features, jlong max_value, jlong min_features, jlong max_features, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedReluX", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedReluX", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(features_handle, TFE_TensorHandle, features, nullptr);
-  TFE_OpAddInput(op.get(), features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(features_handle, features, nullptr);
+  TFE_OpAddInput(op.get(), features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_value_handle, TFE_TensorHandle, max_value, nullptr);
-  TFE_OpAddInput(op.get(), max_value_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_value_handle, max_value, nullptr);
+  TFE_OpAddInput(op.get(), max_value_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_features_handle, TFE_TensorHandle, min_features, nullptr);
-  TFE_OpAddInput(op.get(), min_features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_features_handle, min_features, nullptr);
+  TFE_OpAddInput(op.get(), min_features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_features_handle, TFE_TensorHandle, max_features, nullptr);
-  TFE_OpAddInput(op.get(), max_features_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_features_handle, max_features, nullptr);
+  TFE_OpAddInput(op.get(), max_features_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tinput_features_handle, TFE_TensorHandle, features, nullptr);
-  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(attr_Tinput_features_handle);
+  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(features_handle);
   TFE_OpSetAttrType(op.get(), "Tinput", attr_Tinput);
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedReluX", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -1964,26 +1967,25 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_quantizedAvgPool(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong min_input, jlong max_input, jlongArray ksize, jlongArray strides, jbyteArray padding) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedAvgPool", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedAvgPool", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_input_handle, TFE_TensorHandle, min_input, nullptr);
-  TFE_OpAddInput(op.get(), min_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_input_handle, min_input, nullptr);
+  TFE_OpAddInput(op.get(), min_input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_input_handle, TFE_TensorHandle, max_input, nullptr);
-  TFE_OpAddInput(op.get(), max_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_input_handle, max_input, nullptr);
+  TFE_OpAddInput(op.get(), max_input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -2008,11 +2010,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
   TFE_OpSetAttrString(op.get(), "padding", reinterpret_cast<const char *>(padding_c_value));
   env->ReleaseByteArrayElements(padding, padding_c_value, JNI_ABORT);
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedAvgPool", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -2026,26 +2027,25 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_quantizedMaxPool(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong min_input, jlong max_input, jlongArray ksize, jlongArray strides, jbyteArray padding) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedMaxPool", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedMaxPool", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_input_handle, TFE_TensorHandle, min_input, nullptr);
-  TFE_OpAddInput(op.get(), min_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_input_handle, min_input, nullptr);
+  TFE_OpAddInput(op.get(), min_input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_input_handle, TFE_TensorHandle, max_input, nullptr);
-  TFE_OpAddInput(op.get(), max_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_input_handle, max_input, nullptr);
+  TFE_OpAddInput(op.get(), max_input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_T_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_input_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   const int ksize_n = env->GetArrayLength(ksize);
@@ -2070,11 +2070,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
   TFE_OpSetAttrString(op.get(), "padding", reinterpret_cast<const char *>(padding_c_value));
   env->ReleaseByteArrayElements(padding, padding_c_value, JNI_ABORT);
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedMaxPool", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -2088,42 +2087,40 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_quantizedConv2D(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong filter, jlong min_input, jlong max_input, jlong min_filter, jlong max_filter, jlongArray strides, jbyteArray padding, jint out_type) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedConv2D", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedConv2D", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(filter_handle, TFE_TensorHandle, filter, nullptr);
-  TFE_OpAddInput(op.get(), filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(filter_handle, filter, nullptr);
+  TFE_OpAddInput(op.get(), filter_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_input_handle, TFE_TensorHandle, min_input, nullptr);
-  TFE_OpAddInput(op.get(), min_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_input_handle, min_input, nullptr);
+  TFE_OpAddInput(op.get(), min_input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_input_handle, TFE_TensorHandle, max_input, nullptr);
-  TFE_OpAddInput(op.get(), max_input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_input_handle, max_input, nullptr);
+  TFE_OpAddInput(op.get(), max_input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(min_filter_handle, TFE_TensorHandle, min_filter, nullptr);
-  TFE_OpAddInput(op.get(), min_filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(min_filter_handle, min_filter, nullptr);
+  TFE_OpAddInput(op.get(), min_filter_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(max_filter_handle, TFE_TensorHandle, max_filter, nullptr);
-  TFE_OpAddInput(op.get(), max_filter_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(max_filter_handle, max_filter, nullptr);
+  TFE_OpAddInput(op.get(), max_filter_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tfilter_filter_handle, TFE_TensorHandle, filter, nullptr);
-  const TF_DataType attr_Tfilter = TFE_TensorHandleDataType(attr_Tfilter_filter_handle);
+  const TF_DataType attr_Tfilter = TFE_TensorHandleDataType(filter_handle);
   TFE_OpSetAttrType(op.get(), "Tfilter", attr_Tfilter);
 
-  REQUIRE_HANDLE(attr_Tinput_input_handle, TFE_TensorHandle, input, nullptr);
-  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(attr_Tinput_input_handle);
+  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(input_handle);
   TFE_OpSetAttrType(op.get(), "Tinput", attr_Tinput);
 
   const int strides_n = env->GetArrayLength(strides);
@@ -2141,11 +2138,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedConv2D", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -2159,78 +2155,76 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_quantizedBatchNormWithGlobalNormalization(
     JNIEnv* env, jobject object, jlong context_handle, jlong t, jlong t_min, jlong t_max, jlong m, jlong m_min, jlong m_max, jlong v, jlong v_min, jlong v_max, jlong beta, jlong beta_min, jlong beta_max, jlong gamma, jlong gamma_min, jlong gamma_max, jint out_type, jfloat variance_epsilon, jboolean scale_after_normalization) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "QuantizedBatchNormWithGlobalNormalization", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "QuantizedBatchNormWithGlobalNormalization", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(t_handle, TFE_TensorHandle, t, nullptr);
-  TFE_OpAddInput(op.get(), t_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(t_handle, t, nullptr);
+  TFE_OpAddInput(op.get(), t_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(t_min_handle, TFE_TensorHandle, t_min, nullptr);
-  TFE_OpAddInput(op.get(), t_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(t_min_handle, t_min, nullptr);
+  TFE_OpAddInput(op.get(), t_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(t_max_handle, TFE_TensorHandle, t_max, nullptr);
-  TFE_OpAddInput(op.get(), t_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(t_max_handle, t_max, nullptr);
+  TFE_OpAddInput(op.get(), t_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(m_handle, TFE_TensorHandle, m, nullptr);
-  TFE_OpAddInput(op.get(), m_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(m_handle, m, nullptr);
+  TFE_OpAddInput(op.get(), m_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(m_min_handle, TFE_TensorHandle, m_min, nullptr);
-  TFE_OpAddInput(op.get(), m_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(m_min_handle, m_min, nullptr);
+  TFE_OpAddInput(op.get(), m_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(m_max_handle, TFE_TensorHandle, m_max, nullptr);
-  TFE_OpAddInput(op.get(), m_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(m_max_handle, m_max, nullptr);
+  TFE_OpAddInput(op.get(), m_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(v_handle, TFE_TensorHandle, v, nullptr);
-  TFE_OpAddInput(op.get(), v_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(v_handle, v, nullptr);
+  TFE_OpAddInput(op.get(), v_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(v_min_handle, TFE_TensorHandle, v_min, nullptr);
-  TFE_OpAddInput(op.get(), v_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(v_min_handle, v_min, nullptr);
+  TFE_OpAddInput(op.get(), v_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(v_max_handle, TFE_TensorHandle, v_max, nullptr);
-  TFE_OpAddInput(op.get(), v_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(v_max_handle, v_max, nullptr);
+  TFE_OpAddInput(op.get(), v_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(beta_handle, TFE_TensorHandle, beta, nullptr);
-  TFE_OpAddInput(op.get(), beta_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(beta_handle, beta, nullptr);
+  TFE_OpAddInput(op.get(), beta_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(beta_min_handle, TFE_TensorHandle, beta_min, nullptr);
-  TFE_OpAddInput(op.get(), beta_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(beta_min_handle, beta_min, nullptr);
+  TFE_OpAddInput(op.get(), beta_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(beta_max_handle, TFE_TensorHandle, beta_max, nullptr);
-  TFE_OpAddInput(op.get(), beta_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(beta_max_handle, beta_max, nullptr);
+  TFE_OpAddInput(op.get(), beta_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(gamma_handle, TFE_TensorHandle, gamma, nullptr);
-  TFE_OpAddInput(op.get(), gamma_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(gamma_handle, gamma, nullptr);
+  TFE_OpAddInput(op.get(), gamma_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(gamma_min_handle, TFE_TensorHandle, gamma_min, nullptr);
-  TFE_OpAddInput(op.get(), gamma_min_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(gamma_min_handle, gamma_min, nullptr);
+  TFE_OpAddInput(op.get(), gamma_min_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(gamma_max_handle, TFE_TensorHandle, gamma_max, nullptr);
-  TFE_OpAddInput(op.get(), gamma_max_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(gamma_max_handle, gamma_max, nullptr);
+  TFE_OpAddInput(op.get(), gamma_max_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(attr_Tinput_t_handle, TFE_TensorHandle, t, nullptr);
-  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(attr_Tinput_t_handle);
+  const TF_DataType attr_Tinput = TFE_TensorHandleDataType(t_handle);
   TFE_OpSetAttrType(op.get(), "Tinput", attr_Tinput);
 
-  REQUIRE_HANDLE(attr_Tinput_m_handle, TFE_TensorHandle, m, nullptr);
-  const TF_DataType attr_Tinput_m = TFE_TensorHandleDataType(attr_Tinput_m_handle);
+  const TF_DataType attr_Tinput_m = TFE_TensorHandleDataType(m_handle);
   if (attr_Tinput != attr_Tinput_m) {
       std::stringstream error_msg;
       error_msg
@@ -2240,10 +2234,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_Tinput
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
-  REQUIRE_HANDLE(attr_Tinput_v_handle, TFE_TensorHandle, v, nullptr);
-  const TF_DataType attr_Tinput_v = TFE_TensorHandleDataType(attr_Tinput_v_handle);
+  const TF_DataType attr_Tinput_v = TFE_TensorHandleDataType(v_handle);
   if (attr_Tinput != attr_Tinput_v) {
       std::stringstream error_msg;
       error_msg
@@ -2253,10 +2247,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_Tinput
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
-  REQUIRE_HANDLE(attr_Tinput_beta_handle, TFE_TensorHandle, beta, nullptr);
-  const TF_DataType attr_Tinput_beta = TFE_TensorHandleDataType(attr_Tinput_beta_handle);
+  const TF_DataType attr_Tinput_beta = TFE_TensorHandleDataType(beta_handle);
   if (attr_Tinput != attr_Tinput_beta) {
       std::stringstream error_msg;
       error_msg
@@ -2266,10 +2260,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_Tinput
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
-  REQUIRE_HANDLE(attr_Tinput_gamma_handle, TFE_TensorHandle, gamma, nullptr);
-  const TF_DataType attr_Tinput_gamma = TFE_TensorHandleDataType(attr_Tinput_gamma_handle);
+  const TF_DataType attr_Tinput_gamma = TFE_TensorHandleDataType(gamma_handle);
   if (attr_Tinput != attr_Tinput_gamma) {
       std::stringstream error_msg;
       error_msg
@@ -2279,6 +2273,7 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
           << attr_Tinput
           << "' of argument 't'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return nullptr;
   }
 
   TFE_OpSetAttrType(op.get(), "out_type", static_cast<TF_DataType>(out_type));
@@ -2287,11 +2282,10 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 
   TFE_OpSetAttrBool(op.get(), "scale_after_normalization", static_cast<unsigned char>(scale_after_normalization));
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "QuantizedBatchNormWithGlobalNormalization", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -119,6 +119,22 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_inTopKV2
   (JNIEnv *, jobject, jlong, jlong, jlong, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_generated_tensors_NN__
+ * Method:    largeTopK
+ * Signature: (JJJZ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_largeTopK
+  (JNIEnv *, jobject, jlong, jlong, jlong, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_generated_tensors_NN__
+ * Method:    largeInTopK
+ * Signature: (JJJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_NN_00024_largeInTopK
+  (JNIEnv *, jobject, jlong, jlong, jlong, jlong);
+
 /*
  * Class:     org_platanios_tensorflow_jni_generated_tensors_NN__
  * Method:    avgPool
@@ -30,18 +30,17 @@
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Random_00024_randomUniform(
     JNIEnv* env, jobject object, jlong context_handle, jlong shape, jint dtype, jlong seed, jlong seed2) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "RandomUniform", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "RandomUniform", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(shape_handle, TFE_TensorHandle, shape, 0);
-  TFE_OpAddInput(op.get(), shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_shape_handle, TFE_TensorHandle, shape, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_shape_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(shape_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "dtype", static_cast<TF_DataType>(dtype));
@@ -50,11 +49,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Rand
 
   TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "RandomUniform", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -62,34 +60,31 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Rand
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Random_00024_randomUniformInt(
     JNIEnv* env, jobject object, jlong context_handle, jlong shape, jlong minval, jlong maxval, jlong seed, jlong seed2) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "RandomUniformInt", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "RandomUniformInt", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(shape_handle, TFE_TensorHandle, shape, 0);
-  TFE_OpAddInput(op.get(), shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(minval_handle, TFE_TensorHandle, minval, 0);
-  TFE_OpAddInput(op.get(), minval_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(minval_handle, minval, 0);
+  TFE_OpAddInput(op.get(), minval_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(maxval_handle, TFE_TensorHandle, maxval, 0);
-  TFE_OpAddInput(op.get(), maxval_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(maxval_handle, maxval, 0);
+  TFE_OpAddInput(op.get(), maxval_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_shape_handle, TFE_TensorHandle, shape, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_shape_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(shape_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tout_minval_handle, TFE_TensorHandle, minval, 0);
-  const TF_DataType attr_Tout = TFE_TensorHandleDataType(attr_Tout_minval_handle);
+  const TF_DataType attr_Tout = TFE_TensorHandleDataType(minval_handle);
   TFE_OpSetAttrType(op.get(), "Tout", attr_Tout);
 
-  REQUIRE_HANDLE(attr_Tout_maxval_handle, TFE_TensorHandle, maxval, 0);
-  const TF_DataType attr_Tout_maxval = TFE_TensorHandleDataType(attr_Tout_maxval_handle);
+  const TF_DataType attr_Tout_maxval = TFE_TensorHandleDataType(maxval_handle);
   if (attr_Tout != attr_Tout_maxval) {
       std::stringstream error_msg;
       error_msg
@@ -99,17 +94,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Rand
           << attr_Tout
           << "' of argument 'minval'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrInt(op.get(), "seed", static_cast<int64_t>(seed));
 
   TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "RandomUniformInt", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -117,18 +112,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Rand
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Random_00024_randomStandardNormal(
     JNIEnv* env, jobject object, jlong context_handle, jlong shape, jint dtype, jlong seed, jlong seed2) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "RandomStandardNormal", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "RandomStandardNormal", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(shape_handle, TFE_TensorHandle, shape, 0);
-  TFE_OpAddInput(op.get(), shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_shape_handle, TFE_TensorHandle, shape, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_shape_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(shape_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
   TFE_OpSetAttrType(op.get(), "dtype", static_cast<TF_DataType>(dtype));
@@ -137,11 +131,196 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Rand
 
   TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "RandomStandardNormal", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
+
+  return reinterpret_cast<jlong>(outputs[0]);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Random_00024_truncatedNormal(
+    JNIEnv* env, jobject object, jlong context_handle, jlong shape, jint dtype, jlong seed, jlong seed2) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "TruncatedNormal", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  const TF_DataType attr_T = TFE_TensorHandleDataType(shape_handle);
+  TFE_OpSetAttrType(op.get(), "T", attr_T);
+
+  TFE_OpSetAttrType(op.get(), "dtype", static_cast<TF_DataType>(dtype));
+
+  TFE_OpSetAttrInt(op.get(), "seed", static_cast<int64_t>(seed));
+
+  TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
+
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "TruncatedNormal", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
+
+  return reinterpret_cast<jlong>(outputs[0]);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Random_00024_parallelRandomUniform(
+    JNIEnv* env, jobject object, jlong context_handle, jlong shape, jlong minval, jlong maxval, jlong seed, jlong seed2) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "ParallelRandomUniform", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(minval_handle, minval, 0);
+  TFE_OpAddInput(op.get(), minval_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(maxval_handle, maxval, 0);
+  TFE_OpAddInput(op.get(), maxval_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  TFE_OpSetAttrInt(op.get(), "seed", static_cast<int64_t>(seed));
+
+  TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
+
+  const TF_DataType attr_dtype = TFE_TensorHandleDataType(minval_handle);
+  TFE_OpSetAttrType(op.get(), "dtype", attr_dtype);
+
+  const TF_DataType attr_dtype_maxval = TFE_TensorHandleDataType(maxval_handle);
+  if (attr_dtype != attr_dtype_maxval) {
+      std::stringstream error_msg;
+      error_msg
+          << "Argument 'maxval' of 'parallelRandomUniform' op with data type '"
+          << attr_dtype_maxval
+          << "' must match data type '"
+          << attr_dtype
+          << "' of argument 'minval'";
+      throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
+  }
+
+  const TF_DataType attr_T = TFE_TensorHandleDataType(shape_handle);
+  TFE_OpSetAttrType(op.get(), "T", attr_T);
+
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ParallelRandomUniform", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
+
+  return reinterpret_cast<jlong>(outputs[0]);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Random_00024_parallelRandomNormal(
+    JNIEnv* env, jobject object, jlong context_handle, jlong shape, jlong mean, jlong stddev, jlong seed, jlong seed2) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "ParallelRandomNormal", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(mean_handle, mean, 0);
+  TFE_OpAddInput(op.get(), mean_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(stddev_handle, stddev, 0);
+  TFE_OpAddInput(op.get(), stddev_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  TFE_OpSetAttrInt(op.get(), "seed", static_cast<int64_t>(seed));
+
+  TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
+
+  const TF_DataType attr_dtype = TFE_TensorHandleDataType(mean_handle);
+  TFE_OpSetAttrType(op.get(), "dtype", attr_dtype);
+
+  const TF_DataType attr_dtype_stddev = TFE_TensorHandleDataType(stddev_handle);
+  if (attr_dtype != attr_dtype_stddev) {
+      std::stringstream error_msg;
+      error_msg
+          << "Argument 'stddev' of 'parallelRandomNormal' op with data type '"
+          << attr_dtype_stddev
+          << "' must match data type '"
+          << attr_dtype
+          << "' of argument 'mean'";
+      throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
+  }
+
+  const TF_DataType attr_T = TFE_TensorHandleDataType(shape_handle);
+  TFE_OpSetAttrType(op.get(), "T", attr_T);
+
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ParallelRandomNormal", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
+
+  return reinterpret_cast<jlong>(outputs[0]);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Random_00024_parallelTruncatedNormal(
+    JNIEnv* env, jobject object, jlong context_handle, jlong shape, jlong mean, jlong stddev, jlong seed, jlong seed2) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "ParallelTruncatedNormal", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(shape_handle, shape, 0);
+  TFE_OpAddInput(op.get(), shape_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(mean_handle, mean, 0);
+  TFE_OpAddInput(op.get(), mean_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(stddev_handle, stddev, 0);
+  TFE_OpAddInput(op.get(), stddev_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  TFE_OpSetAttrInt(op.get(), "seed", static_cast<int64_t>(seed));
+
+  TFE_OpSetAttrInt(op.get(), "seed2", static_cast<int64_t>(seed2));
+
+  const TF_DataType attr_dtype = TFE_TensorHandleDataType(mean_handle);
+  TFE_OpSetAttrType(op.get(), "dtype", attr_dtype);
+
+  const TF_DataType attr_dtype_stddev = TFE_TensorHandleDataType(stddev_handle);
+  if (attr_dtype != attr_dtype_stddev) {
+      std::stringstream error_msg;
+      error_msg
+          << "Argument 'stddev' of 'parallelTruncatedNormal' op with data type '"
+          << attr_dtype_stddev
+          << "' must match data type '"
+          << attr_dtype
+          << "' of argument 'mean'";
+      throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
+  }
+
+  const TF_DataType attr_T = TFE_TensorHandleDataType(shape_handle);
+  TFE_OpSetAttrType(op.get(), "T", attr_T);
+
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "ParallelTruncatedNormal", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -30,38 +30,35 @@
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Sparse_00024_sparseToDense(
     JNIEnv* env, jobject object, jlong context_handle, jlong sparse_indices, jlong output_shape, jlong sparse_values, jlong default_value, jboolean validate_indices) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "SparseToDense", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "SparseToDense", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(sparse_indices_handle, TFE_TensorHandle, sparse_indices, 0);
-  TFE_OpAddInput(op.get(), sparse_indices_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(sparse_indices_handle, sparse_indices, 0);
+  TFE_OpAddInput(op.get(), sparse_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(output_shape_handle, TFE_TensorHandle, output_shape, 0);
-  TFE_OpAddInput(op.get(), output_shape_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(output_shape_handle, output_shape, 0);
+  TFE_OpAddInput(op.get(), output_shape_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(sparse_values_handle, TFE_TensorHandle, sparse_values, 0);
-  TFE_OpAddInput(op.get(), sparse_values_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(sparse_values_handle, sparse_values, 0);
+  TFE_OpAddInput(op.get(), sparse_values_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(default_value_handle, TFE_TensorHandle, default_value, 0);
-  TFE_OpAddInput(op.get(), default_value_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(default_value_handle, default_value, 0);
+  TFE_OpAddInput(op.get(), default_value_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(attr_T_sparse_values_handle, TFE_TensorHandle, sparse_values, 0);
-  const TF_DataType attr_T = TFE_TensorHandleDataType(attr_T_sparse_values_handle);
+  const TF_DataType attr_T = TFE_TensorHandleDataType(sparse_values_handle);
   TFE_OpSetAttrType(op.get(), "T", attr_T);
 
-  REQUIRE_HANDLE(attr_Tindices_sparse_indices_handle, TFE_TensorHandle, sparse_indices, 0);
-  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(attr_Tindices_sparse_indices_handle);
+  const TF_DataType attr_Tindices = TFE_TensorHandleDataType(sparse_indices_handle);
   TFE_OpSetAttrType(op.get(), "Tindices", attr_Tindices);
 
-  REQUIRE_HANDLE(attr_T_default_value_handle, TFE_TensorHandle, default_value, 0);
-  const TF_DataType attr_T_default_value = TFE_TensorHandleDataType(attr_T_default_value_handle);
+  const TF_DataType attr_T_default_value = TFE_TensorHandleDataType(default_value_handle);
   if (attr_T != attr_T_default_value) {
       std::stringstream error_msg;
       error_msg
@@ -71,10 +68,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Spar
           << attr_T
           << "' of argument 'sparse_values'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
-  REQUIRE_HANDLE(attr_Tindices_output_shape_handle, TFE_TensorHandle, output_shape, 0);
-  const TF_DataType attr_Tindices_output_shape = TFE_TensorHandleDataType(attr_Tindices_output_shape_handle);
+  const TF_DataType attr_Tindices_output_shape = TFE_TensorHandleDataType(output_shape_handle);
   if (attr_Tindices != attr_Tindices_output_shape) {
       std::stringstream error_msg;
       error_msg
@@ -84,15 +81,108 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Spar
           << attr_Tindices
           << "' of argument 'sparse_indices'";
       throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
   }
 
   TFE_OpSetAttrBool(op.get(), "validate_indices", static_cast<unsigned char>(validate_indices));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "SparseToDense", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
+
+  return reinterpret_cast<jlong>(outputs[0]);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Sparse_00024_sparseTensorToCSR(
+    JNIEnv* env, jobject object, jlong context_handle, jlong indices, jlong values, jlong dense_shape) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "SparseTensorToCSR", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
+
+  REQUIRE_TENSOR_HANDLE(indices_handle, indices, nullptr);
+  TFE_OpAddInput(op.get(), indices_handle, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  REQUIRE_TENSOR_HANDLE(values_handle, values, nullptr);
+  TFE_OpAddInput(op.get(), values_handle, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  REQUIRE_TENSOR_HANDLE(dense_shape_handle, dense_shape, nullptr);
+  TFE_OpAddInput(op.get(), dense_shape_handle, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  const TF_DataType attr_T = TFE_TensorHandleDataType(values_handle);
+  TFE_OpSetAttrType(op.get(), "T", attr_T);
+
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "SparseTensorToCSR", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
+  jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
+  for (int i = 0; i < num_outputs; ++i) {
+    output_elems[i] = reinterpret_cast<jlong>(outputs[i]);
+  }
+  env->ReleaseLongArrayElements(outputs_array, output_elems, 0);
+  return outputs_array;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Sparse_00024_cSRSparseDenseMatMul(
+    JNIEnv* env, jobject object, jlong context_handle, jlong row_pointers, jlong column_indices, jlong values, jlong dense_shape, jlong b, jboolean adjoint_a) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "CSRSparseDenseMatMul", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(row_pointers_handle, row_pointers, 0);
+  TFE_OpAddInput(op.get(), row_pointers_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(column_indices_handle, column_indices, 0);
+  TFE_OpAddInput(op.get(), column_indices_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(values_handle, values, 0);
+  TFE_OpAddInput(op.get(), values_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(dense_shape_handle, dense_shape, 0);
+  TFE_OpAddInput(op.get(), dense_shape_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(b_handle, b, 0);
+  TFE_OpAddInput(op.get(), b_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  const TF_DataType attr_T = TFE_TensorHandleDataType(values_handle);
+  TFE_OpSetAttrType(op.get(), "T", attr_T);
+
+  const TF_DataType attr_T_b = TFE_TensorHandleDataType(b_handle);
+  if (attr_T != attr_T_b) {
+      std::stringstream error_msg;
+      error_msg
+          << "Argument 'b' of 'cSRSparseDenseMatMul' op with data type '"
+          << attr_T_b
+          << "' must match data type '"
+          << attr_T
+          << "' of argument 'values'";
+      throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
+      return 0;
+  }
+
+  TFE_OpSetAttrBool(op.get(), "adjoint_a", static_cast<unsigned char>(adjoint_a));
+
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "CSRSparseDenseMatMul", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -15,6 +15,22 @@ extern "C" {
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Sparse_00024_sparseToDense
   (JNIEnv *, jobject, jlong, jlong, jlong, jlong, jlong, jboolean);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_generated_tensors_Sparse__
+ * Method:    sparseTensorToCSR
+ * Signature: (JJJJ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Sparse_00024_sparseTensorToCSR
+  (JNIEnv *, jobject, jlong, jlong, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_generated_tensors_Sparse__
+ * Method:    cSRSparseDenseMatMul
+ * Signature: (JJJJJJZ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Sparse_00024_cSRSparseDenseMatMul
+  (JNIEnv *, jobject, jlong, jlong, jlong, jlong, jlong, jlong, jboolean);
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,7 @@
 #include <cstring>
 #include <memory>
 #include <sstream>
+#include <string>
 
 #include "tensorflow/c/c_api.h"
 #include "tensorflow/c/c_eager_api.h"
@@ -30,18 +31,18 @@
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_stringJoin(
     JNIEnv* env, jobject object, jlong context_handle, jlongArray inputs, jbyteArray separator) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "StringJoin", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "StringJoin", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
   const int inputs_num_tensors = env->GetArrayLength(inputs);
   jlong *inputs_elems = env->GetLongArrayElements(inputs, nullptr);
   for (int i = 0; i < inputs_num_tensors; ++i) {
-    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, inputs_elems[i], 0);
-    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-    CHECK_STATUS(env, status.get(), 0);
+    REQUIRE_TENSOR_HANDLE(tensor_handle, inputs_elems[i], 0);
+    TFE_OpAddInput(op.get(), tensor_handle, status);
+    CHECK_STATUS(env, status, 0);
   }
   env->ReleaseLongArrayElements(inputs, inputs_elems, JNI_ABORT);
 
@@ -52,11 +53,10 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text
   TFE_OpSetAttrString(op.get(), "separator", reinterpret_cast<const char *>(separator_c_value));
   env->ReleaseByteArrayElements(separator, separator_c_value, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "StringJoin", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -64,25 +64,24 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_stringSplit(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong delimiter) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "StringSplit", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), nullptr);
+      TFE_NewOp(context, "StringSplit", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, nullptr);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  REQUIRE_HANDLE(delimiter_handle, TFE_TensorHandle, delimiter, nullptr);
-  TFE_OpAddInput(op.get(), delimiter_handle, status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  REQUIRE_TENSOR_HANDLE(delimiter_handle, delimiter, nullptr);
+  TFE_OpAddInput(op.get(), delimiter_handle, status);
+  CHECK_STATUS(env, status, nullptr);
 
-  const int num_outputs = 3;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), nullptr);
+  TFE_TensorHandle* outputs[3];
+  int num_outputs = 3;
+  execute_eager_op(op.get(), "StringSplit", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
 
   jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
   jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
@@ -96,23 +95,22 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_encodeBase64(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jboolean pad) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "EncodeBase64", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "EncodeBase64", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
   TFE_OpSetAttrBool(op.get(), "pad", static_cast<unsigned char>(pad));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "EncodeBase64", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -120,21 +118,20 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_decodeBase64(
     JNIEnv* env, jobject object, jlong context_handle, jlong input) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "DecodeBase64", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "DecodeBase64", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "DecodeBase64", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -142,23 +139,22 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_stringToHashBucket(
     JNIEnv* env, jobject object, jlong context_handle, jlong string_tensor, jlong num_buckets) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "StringToHashBucket", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "StringToHashBucket", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(string_tensor_handle, TFE_TensorHandle, string_tensor, 0);
-  TFE_OpAddInput(op.get(), string_tensor_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(string_tensor_handle, string_tensor, 0);
+  TFE_OpAddInput(op.get(), string_tensor_handle, status);
+  CHECK_STATUS(env, status, 0);
 
   TFE_OpSetAttrInt(op.get(), "num_buckets", static_cast<int64_t>(num_buckets));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "StringToHashBucket", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -166,23 +162,22 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_stringToHashBucketFast(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong num_buckets) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "StringToHashBucketFast", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "StringToHashBucketFast", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
   TFE_OpSetAttrInt(op.get(), "num_buckets", static_cast<int64_t>(num_buckets));
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "StringToHashBucketFast", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
@@ -190,15 +185,15 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_stringToHashBucketStrong(
     JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong num_buckets, jlongArray key) {
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_local_status();
 
   std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-      TFE_NewOp(context, "StringToHashBucketStrong", status.get()), TFE_DeleteOp);
-  CHECK_STATUS(env, status.get(), 0);
+      TFE_NewOp(context, "StringToHashBucketStrong", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
 
-  REQUIRE_HANDLE(input_handle, TFE_TensorHandle, input, 0);
-  TFE_OpAddInput(op.get(), input_handle, status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
 
   TFE_OpSetAttrInt(op.get(), "num_buckets", static_cast<int64_t>(num_buckets));
 
@@ -211,11 +206,121 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text
   TFE_OpSetAttrIntList(op.get(), "key", key_c_value.get(), key_n);
   env->ReleaseLongArrayElements(key, key_elems, JNI_ABORT);
 
-  const int num_outputs = 1;
-  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-  CHECK_STATUS(env, status.get(), 0);
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "StringToHashBucketStrong", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
 
   return reinterpret_cast<jlong>(outputs[0]);
 }
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_tokenizeStrings(
+    JNIEnv* env, jobject object, jlong context_handle, jlong input, jbyteArray delimiter, jboolean skip_empty) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "TokenizeStrings", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
+
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  const jsize delimiter_length = env->GetArrayLength(delimiter);
+  std::string delimiter_c_value(static_cast<size_t>(delimiter_length), '\0');
+  env->GetByteArrayRegion(delimiter, 0, delimiter_length, reinterpret_cast<jbyte*>(&delimiter_c_value[0]));
+  TFE_OpSetAttrString(op.get(), "delimiter", delimiter_c_value.c_str());
+
+  TFE_OpSetAttrBool(op.get(), "skip_empty", static_cast<unsigned char>(skip_empty));
+
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "TokenizeStrings", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
+  jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
+  for (int i = 0; i < num_outputs; ++i) {
+    output_elems[i] = reinterpret_cast<jlong>(outputs[i]);
+  }
+  env->ReleaseLongArrayElements(outputs_array, output_elems, 0);
+  return outputs_array;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_stringToHashBucketBatch(
+    JNIEnv* env, jobject object, jlong context_handle, jlong input, jlong num_buckets, jbyteArray hash_function) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "StringToHashBucketBatch", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, 0);
+
+  REQUIRE_TENSOR_HANDLE(input_handle, input, 0);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, 0);
+
+  TFE_OpSetAttrInt(op.get(), "num_buckets", static_cast<int64_t>(num_buckets));
+
+  const jsize hash_function_length = env->GetArrayLength(hash_function);
+  std::string hash_function_c_value(static_cast<size_t>(hash_function_length), '\0');
+  env->GetByteArrayRegion(
+      hash_function, 0, hash_function_length, reinterpret_cast<jbyte*>(&hash_function_c_value[0]));
+  TFE_OpSetAttrString(op.get(), "hash_function", hash_function_c_value.c_str());
+
+  TFE_TensorHandle* outputs[1];
+  int num_outputs = 1;
+  execute_eager_op(op.get(), "StringToHashBucketBatch", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, 0);
+
+  return reinterpret_cast<jlong>(outputs[0]);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_wordPieceTokenize(
+    JNIEnv* env, jobject object, jlong context_handle, jlong input, jbyteArray vocabulary_file,
+    jbyteArray suffix_indicator, jbyteArray unknown_token, jlong max_bytes_per_word) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
+  TF_Status* status = thread_local_status();
+
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, "WordPieceTokenize", status), TFE_DeleteOp);
+  CHECK_STATUS(env, status, nullptr);
+
+  REQUIRE_TENSOR_HANDLE(input_handle, input, nullptr);
+  TFE_OpAddInput(op.get(), input_handle, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  const jsize vocabulary_file_length = env->GetArrayLength(vocabulary_file);
+  std::string vocabulary_file_c_value(static_cast<size_t>(vocabulary_file_length), '\0');
+  env->GetByteArrayRegion(
+      vocabulary_file, 0, vocabulary_file_length, reinterpret_cast<jbyte*>(&vocabulary_file_c_value[0]));
+  TFE_OpSetAttrString(op.get(), "vocabulary_file", vocabulary_file_c_value.c_str());
+
+  const jsize suffix_indicator_length = env->GetArrayLength(suffix_indicator);
+  std::string suffix_indicator_c_value(static_cast<size_t>(suffix_indicator_length), '\0');
+  env->GetByteArrayRegion(
+      suffix_indicator, 0, suffix_indicator_length, reinterpret_cast<jbyte*>(&suffix_indicator_c_value[0]));
+  TFE_OpSetAttrString(op.get(), "suffix_indicator", suffix_indicator_c_value.c_str());
+
+  const jsize unknown_token_length = env->GetArrayLength(unknown_token);
+  std::string unknown_token_c_value(static_cast<size_t>(unknown_token_length), '\0');
+  env->GetByteArrayRegion(
+      unknown_token, 0, unknown_token_length, reinterpret_cast<jbyte*>(&unknown_token_c_value[0]));
+  TFE_OpSetAttrString(op.get(), "unknown_token", unknown_token_c_value.c_str());
+
+  TFE_OpSetAttrInt(op.get(), "max_bytes_per_word", static_cast<int64_t>(max_bytes_per_word));
+
+  TFE_TensorHandle* outputs[2];
+  int num_outputs = 2;
+  execute_eager_op(op.get(), "WordPieceTokenize", outputs, &num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
+  jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
+  for (int i = 0; i < num_outputs; ++i) {
+    output_elems[i] = reinterpret_cast<jlong>(outputs[i]);
+  }
+  env->ReleaseLongArrayElements(outputs_array, output_elems, 0);
+  return outputs_array;
+}
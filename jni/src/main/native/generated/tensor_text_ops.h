@@ -63,6 +63,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_stringToHashBucketStrong
   (JNIEnv *, jobject, jlong, jlong, jlong, jlongArray);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_generated_tensors_Text__
+ * Method:    tokenizeStrings
+ * Signature: (JJ[BZ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_tokenizeStrings
+  (JNIEnv *, jobject, jlong, jlong, jbyteArray, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_generated_tensors_Text__
+ * Method:    stringToHashBucketBatch
+ * Signature: (JJJ[B)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_stringToHashBucketBatch
+  (JNIEnv *, jobject, jlong, jlong, jlong, jbyteArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_generated_tensors_Text__
+ * Method:    wordPieceTokenize
+ * Signature: (JJ[B[B[BJ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_generated_tensors_Text_00024_wordPieceTokenize
+  (JNIEnv *, jobject, jlong, jlong, jbyteArray, jbyteArray, jbyteArray, jlong);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,13 +14,31 @@
  */
 
 #include "exception.h"
+#include "jvm_cache.h"
 #include "graph.h"
+#include "utilities.h"
 
+#include <cstring>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/c/graph_freezer.h"
+#include "tensorflow/c/graph_cost_estimator.h"
+#include "tensorflow/c/graph_optimizer.h"
+#include "tensorflow/c/graph_quantizer.h"
+#include "tensorflow/c/native_gradients.h"
+#include "tensorflow/c/optimized_graph_cache.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/graph/tensor_id.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/file_statistics.h"
 
 namespace {
   template<class T>
@@ -58,6 +76,167 @@ namespace {
     }
     return array;
   }
+
+  // Creates the import options used by "importGraphDef" and "importOps". The caller owns the returned options.
+  TF_ImportGraphDefOptions *new_import_graph_def_options(
+      JNIEnv *env, jstring name_prefix, jobjectArray input_map_key_ops, jintArray input_map_key_outputs,
+      jlongArray input_map_value_ops, jintArray input_map_value_outputs, jobjectArray control_dependency_map_key_ops,
+      jlongArray control_dependency_map_value_ops, jlongArray control_dependencies) {
+    TF_ImportGraphDefOptions *options = TF_NewImportGraphDefOptions();
+
+    // Handle the name prefix argument
+    const char *name_prefix_c_string = env->GetStringUTFChars(name_prefix, nullptr);
+    TF_ImportGraphDefOptionsSetPrefix(options, name_prefix_c_string);
+    env->ReleaseStringUTFChars(name_prefix, name_prefix_c_string);
+
+    // Handle the input map arguments
+    if (input_map_key_ops != nullptr) {
+      int input_map_length = env->GetArrayLength(input_map_key_ops);
+      if (input_map_length != env->GetArrayLength(input_map_key_outputs) ||
+            input_map_length != env->GetArrayLength(input_map_value_ops) ||
+            input_map_length != env->GetArrayLength(input_map_value_outputs))
+        throw_exception(env, tf_invalid_argument_exception, "All input map arguments must have the same length.");
+      jint *input_map_key_outputs_elements = env->GetIntArrayElements(input_map_key_outputs, 0);
+      jlong *input_map_value_ops_elements = env->GetLongArrayElements(input_map_value_ops, 0);
+      jint *input_map_value_outputs_elements = env->GetIntArrayElements(input_map_value_outputs, 0);
+      for (int i = 0; i < input_map_length; ++i) {
+        jstring input_map_key_op = reinterpret_cast<jstring>(env->GetObjectArrayElement(input_map_key_ops, i));
+        const char *input_map_key_op_c_string = env->GetStringUTFChars(input_map_key_op, nullptr);
+        int input_map_key_output = reinterpret_cast<int>(input_map_key_outputs_elements[i]);
+        TF_Operation *op = require_operation_handle(env, input_map_value_ops_elements[i]);
+        if (op == nullptr)
+          throw_exception(env, tf_invalid_argument_exception, "Provided input map destination op cannot be found.");
+        int output_index = reinterpret_cast<int>(input_map_value_outputs_elements[i]);
+        TF_Output output{op, output_index};
+        TF_ImportGraphDefOptionsAddInputMapping(options, input_map_key_op_c_string, input_map_key_output, output);
+        env->ReleaseStringUTFChars(input_map_key_op, input_map_key_op_c_string);
+      }
+      env->ReleaseIntArrayElements(input_map_key_outputs, input_map_key_outputs_elements, 0);
+      env->ReleaseLongArrayElements(input_map_value_ops, input_map_value_ops_elements, 0);
+      env->ReleaseIntArrayElements(input_map_value_outputs, input_map_value_outputs_elements, 0);
+    }
+
+    // Handle the control dependency map arguments
+    if (control_dependency_map_key_ops != nullptr) {
+      int control_dependency_map_length = env->GetArrayLength(control_dependency_map_key_ops);
+      if (control_dependency_map_length != env->GetArrayLength(control_dependency_map_value_ops))
+        throw_exception(
+          env, tf_invalid_argument_exception, "All control dependency map arguments must have the same length.");
+      jlong *control_dependency_map_value_ops_elements = env->GetLongArrayElements(control_dependency_map_value_ops, 0);
+      for (int i = 0; i < control_dependency_map_length; ++i) {
+        jstring control_dependency_map_key_op =
+          reinterpret_cast<jstring>(env->GetObjectArrayElement(control_dependency_map_key_ops, i));
+        const char *control_dependency_map_key_op_c_string =
+          env->GetStringUTFChars(control_dependency_map_key_op, nullptr);
+        TF_Operation *op = require_operation_handle(env, control_dependency_map_value_ops_elements[i]);
+        if (op == nullptr)
+          throw_exception(
+            env, tf_invalid_argument_exception, "Provided control dependency map destination op cannot be found.");
+        TF_ImportGraphDefOptionsRemapControlDependency(options, control_dependency_map_key_op_c_string, op);
+        env->ReleaseStringUTFChars(control_dependency_map_key_op, control_dependency_map_key_op_c_string);
+      }
+      env->ReleaseLongArrayElements(control_dependency_map_value_ops, control_dependency_map_value_ops_elements, 0);
+    }
+
+    // Handle the control dependencies argument
+    if (control_dependencies != nullptr) {
+      int control_dependencies_length = env->GetArrayLength(control_dependencies);
+      jlong *control_dependencies_elements = env->GetLongArrayElements(control_dependencies, 0);
+      for (int i = 0; i < control_dependencies_length; ++i) {
+        TF_Operation *op = require_operation_handle(env, control_dependencies_elements[i]);
+        if (op == nullptr)
+          throw_exception(env, tf_invalid_argument_exception, "Provided control dependency op cannot be found.");
+        TF_ImportGraphDefOptionsAddControlDependency(options, op);
+      }
+      env->ReleaseLongArrayElements(control_dependencies, control_dependencies_elements, 0);
+    }
+    return options;
+  }
+
+  // Imports the provided serialized graph definition into "g" and returns "true" if the import succeeded. The serialized
+  // graph definition is only read during this call and is not copied.
+  bool import_graph_def(
+      JNIEnv *env, TF_Graph *g, const void *data, size_t length, const TF_ImportGraphDefOptions *options) {
+    TF_Buffer buffer{data, length, nullptr};
+    TF_Status *status = TF_NewStatus();
+    TF_GraphImportGraphDef(g, &buffer, options, status);
+    bool ok = throw_exception_if_not_ok(env, status);
+    TF_DeleteStatus(status);
+    return ok;
+  }
+
+  bool import_graph_def(JNIEnv *env, TF_Graph *g, jbyteArray graph_def, const TF_ImportGraphDefOptions *options) {
+    static_assert(sizeof(jbyte) == 1, "unexpected size of the jbyte type");
+    jbyte *bytes = env->GetByteArrayElements(graph_def, nullptr);
+    bool ok = import_graph_def(env, g, bytes, static_cast<size_t>(env->GetArrayLength(graph_def)), options);
+
+    // Continue cleaning up resources even if an exception was thrown
+    env->ReleaseByteArrayElements(graph_def, bytes, JNI_ABORT);
+    return ok;
+  }
+
+  // Throws a Java exception if "s" is not OK, and returns "true" if it is.
+  bool throw_exception_if_not_ok(JNIEnv *env, const tensorflow::Status &s) {
+    if (s.ok()) return true;
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    return throw_exception_if_not_ok(env, status.get());
+  }
+
+  // Stores the graph definition of "g" in "graph_def" and returns "true", or throws a Java exception and returns
+  // "false" if it cannot be obtained.
+  bool to_graph_def(JNIEnv *env, TF_Graph *g, tensorflow::GraphDef *graph_def) {
+    std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> buffer(TF_NewBuffer(), TF_DeleteBuffer);
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    TF_GraphToGraphDef(g, buffer.get(), status.get());
+    if (!throw_exception_if_not_ok(env, status.get())) return false;
+    if (!graph_def->ParseFromArray(buffer->data, static_cast<int>(buffer->length))) {
+      throw_exception(env, tf_internal_exception, "Unable to parse the GraphDef of the graph.");
+      return false;
+    }
+    return true;
+  }
+
+  // Cache of memory-mapped serialized graph definition files, used by "importGraphDefFromFile". Entries are keyed by
+  // file path, modification time, and length, so that files that are modified after being cached are mapped anew.
+  class GraphDefFileCache {
+   public:
+    static GraphDefFileCache& Get() {
+      // The cache is intentionally leaked so that it can be used safely while the library is being unloaded.
+      static GraphDefFileCache* cache = new GraphDefFileCache();
+      return *cache;
+    }
+
+    // Returns the memory region holding the contents of the provided file, mapping the file if necessary. The returned
+    // region remains valid for as long as the caller holds on to it, even if the cache is cleared in the meantime.
+    tensorflow::Status Lookup(
+        const std::string& filename, std::shared_ptr<tensorflow::ReadOnlyMemoryRegion>* region) {
+      tensorflow::FileStatistics statistics;
+      TF_RETURN_IF_ERROR(tensorflow::Env::Default()->Stat(filename, &statistics));
+      std::string key =
+          filename + "@" + std::to_string(statistics.mtime_nsec) + ":" + std::to_string(statistics.length);
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = regions_.find(key);
+      if (it == regions_.end()) {
+        std::unique_ptr<tensorflow::ReadOnlyMemoryRegion> new_region;
+        TF_RETURN_IF_ERROR(tensorflow::Env::Default()->NewReadOnlyMemoryRegionFromFile(filename, &new_region));
+        it = regions_.emplace(key, std::shared_ptr<tensorflow::ReadOnlyMemoryRegion>(std::move(new_region))).first;
+      }
+      *region = it->second;
+      return tensorflow::Status::OK();
+    }
+
+    void Clear() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      regions_.clear();
+    }
+
+   private:
+    GraphDefFileCache() {}
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<tensorflow::ReadOnlyMemoryRegion>> regions_;
+  };
 }  // namespace
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_allocate(JNIEnv* env, jobject object) {
@@ -108,9 +287,9 @@ JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_add
   if (g == nullptr) return nullptr;
 
   // Convert the inputs to their C API equivalent data structures
-  jclass output_class = env->FindClass("org/platanios/tensorflow/jni/Output");
-  jfieldID output_op_handle_field_id = env->GetFieldID(output_class, "opHandle", "J");
-  jfieldID output_op_index_field_id = env->GetFieldID(output_class, "outputIndex", "I");
+  const JVMCache& cache = jvm_cache();
+  jfieldID output_op_handle_field_id = cache.output_op_handle_field;
+  jfieldID output_op_index_field_id = cache.output_output_index_field;
 
   int ny = env->GetArrayLength(y_array);
   std::unique_ptr<TF_Output[]> y = to_tf_output_array(
@@ -134,17 +313,44 @@ JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_add
   TF_DeleteStatus(status);
 
   // Construct the return gradients array
-  jmethodID output_class_constructor = env->GetStaticMethodID(
-      output_class, "apply", "(JI)Lorg/platanios/tensorflow/jni/Output;");
-  jobjectArray gradients_array = env->NewObjectArray(nx, output_class, NULL);
+  jobjectArray gradients_array = env->NewObjectArray(nx, cache.output_class, NULL);
   for (int i = 0; i < nx; ++i) {
-    env->SetObjectArrayElement(
-        gradients_array, i, env->CallStaticObjectMethod(
-            output_class, output_class_constructor, reinterpret_cast<jlong>(dy[i].oper), dy[i].index));
+    jobject gradient = env->CallStaticObjectMethod(
+        cache.output_class, cache.output_apply, reinterpret_cast<jlong>(dy[i].oper), dy[i].index);
+    env->SetObjectArrayElement(gradients_array, i, gradient);
+    env->DeleteLocalRef(gradient);
   }
   return gradients_array;
 }
 
+JNIEXPORT jbooleanArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_nativeGradientSupport(
+    JNIEnv* env, jobject object, jlong graph_handle, jlongArray op_handles) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return nullptr;
+
+  const int num_ops = env->GetArrayLength(op_handles);
+  std::vector<TF_Operation*> ops(static_cast<size_t>(num_ops));
+  jlong *op_handles_array = env->GetLongArrayElements(op_handles, nullptr);
+  for (int i = 0; i < num_ops; ++i) {
+    ops[i] = reinterpret_cast<TF_Operation*>(op_handles_array[i]);
+    if (ops[i] == nullptr) {
+      env->ReleaseLongArrayElements(op_handles, op_handles_array, JNI_ABORT);
+      throw_exception(env, tf_invalid_argument_exception, "Op handle %d is null.", i);
+      return nullptr;
+    }
+  }
+  env->ReleaseLongArrayElements(op_handles, op_handles_array, JNI_ABORT);
+
+  std::unique_ptr<bool[]> supported(new bool[num_ops]);
+  tensorflow::NativeGradientSupport(g, ops.data(), num_ops, supported.get());
+  jbooleanArray supported_array = env->NewBooleanArray(num_ops);
+  jboolean *supported_elements = env->GetBooleanArrayElements(supported_array, nullptr);
+  for (int i = 0; i < num_ops; ++i)
+    supported_elements[i] = static_cast<jboolean>(supported[i]);
+  env->ReleaseBooleanArrayElements(supported_array, supported_elements, 0);
+  return supported_array;
+}
+
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importGraphDef(
     JNIEnv* env, jobject object, jlong graph_handle, jbyteArray graph_def, jstring name_prefix,
     jobjectArray input_map_key_ops, jintArray input_map_key_outputs, jlongArray input_map_value_ops,
@@ -154,90 +360,428 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importGraph
   TF_Graph *g = require_graph_handle(env, graph_handle);
   if (g == nullptr) return;
 
-  TF_ImportGraphDefOptions *options = TF_NewImportGraphDefOptions();
+  TF_ImportGraphDefOptions *options = new_import_graph_def_options(
+    env, name_prefix, input_map_key_ops, input_map_key_outputs, input_map_value_ops, input_map_value_outputs,
+    control_dependency_map_key_ops, control_dependency_map_value_ops, control_dependencies);
+  import_graph_def(env, g, graph_def, options);
+  TF_DeleteImportGraphDefOptions(options);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importOps(
+    JNIEnv* env, jobject object, jlong graph_handle, jbyteArray graph_def, jstring name_prefix,
+    jobjectArray input_map_key_ops, jintArray input_map_key_outputs, jlongArray input_map_value_ops,
+    jintArray input_map_value_outputs,
+    jobjectArray control_dependency_map_key_ops, jlongArray control_dependency_map_value_ops,
+    jlongArray control_dependencies, jobjectArray op_names) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return nullptr;
+
+  TF_ImportGraphDefOptions *options = new_import_graph_def_options(
+    env, name_prefix, input_map_key_ops, input_map_key_outputs, input_map_value_ops, input_map_value_outputs,
+    control_dependency_map_key_ops, control_dependency_map_value_ops, control_dependencies);
+  bool imported = import_graph_def(env, g, graph_def, options);
+  TF_DeleteImportGraphDefOptions(options);
+  if (!imported) return nullptr;
 
-  // Handle the name prefix argument
+  // Look up the imported ops so that callers do not need a separate native call for each one of them.
   const char *name_prefix_c_string = env->GetStringUTFChars(name_prefix, nullptr);
-  TF_ImportGraphDefOptionsSetPrefix(options, name_prefix_c_string);
+  std::string prefix(name_prefix_c_string);
   env->ReleaseStringUTFChars(name_prefix, name_prefix_c_string);
+  const int num_ops = env->GetArrayLength(op_names);
+  jlongArray op_handles = env->NewLongArray(num_ops);
+  jlong *op_handles_elements = env->GetLongArrayElements(op_handles, nullptr);
+  for (int i = 0; i < num_ops; ++i) {
+    jstring op_name = reinterpret_cast<jstring>(env->GetObjectArrayElement(op_names, i));
+    const char *op_name_c_string = env->GetStringUTFChars(op_name, nullptr);
+    op_handles_elements[i] = reinterpret_cast<jlong>(TF_GraphOperationByName(g, (prefix + op_name_c_string).c_str()));
+    env->ReleaseStringUTFChars(op_name, op_name_c_string);
+    env->DeleteLocalRef(op_name);
+  }
+  env->ReleaseLongArrayElements(op_handles, op_handles_elements, 0);
+  return op_handles;
+}
 
-  // Handle the input map arguments
-  if (input_map_key_ops != nullptr) {
-    int input_map_length = env->GetArrayLength(input_map_key_ops);
-    if (input_map_length != env->GetArrayLength(input_map_key_outputs) ||
-          input_map_length != env->GetArrayLength(input_map_value_ops) ||
-          input_map_length != env->GetArrayLength(input_map_value_outputs))
-      throw_exception(env, tf_invalid_argument_exception, "All input map arguments must have the same length.");
-    jint *input_map_key_outputs_elements = env->GetIntArrayElements(input_map_key_outputs, 0);
-    jlong *input_map_value_ops_elements = env->GetLongArrayElements(input_map_value_ops, 0);
-    jint *input_map_value_outputs_elements = env->GetIntArrayElements(input_map_value_outputs, 0);
-    for (int i = 0; i < input_map_length; ++i) {
-      jstring input_map_key_op = reinterpret_cast<jstring>(env->GetObjectArrayElement(input_map_key_ops, i));
-      const char *input_map_key_op_c_string = env->GetStringUTFChars(input_map_key_op, nullptr);
-      int input_map_key_output = reinterpret_cast<int>(input_map_key_outputs_elements[i]);
-      TF_Operation *op = require_operation_handle(env, input_map_value_ops_elements[i]);
-      if (op == nullptr)
-        throw_exception(env, tf_invalid_argument_exception, "Provided input map destination op cannot be found.");
-      int output_index = reinterpret_cast<int>(input_map_value_outputs_elements[i]);
-      TF_Output output{op, output_index};
-      TF_ImportGraphDefOptionsAddInputMapping(options, input_map_key_op_c_string, input_map_key_output, output);
-      env->ReleaseStringUTFChars(input_map_key_op, input_map_key_op_c_string);
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importGraphDefFromBuffer(
+    JNIEnv* env, jobject object, jlong graph_handle, jobject graph_def, jstring name_prefix,
+    jobjectArray input_map_key_ops, jintArray input_map_key_outputs, jlongArray input_map_value_ops,
+    jintArray input_map_value_outputs,
+    jobjectArray control_dependency_map_key_ops, jlongArray control_dependency_map_value_ops,
+    jlongArray control_dependencies) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return;
+
+  void *data = env->GetDirectBufferAddress(graph_def);
+  if (data == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "The provided graph definition buffer must be direct.");
+    return;
+  }
+  size_t length = static_cast<size_t>(env->GetDirectBufferCapacity(graph_def));
+
+  TF_ImportGraphDefOptions *options = new_import_graph_def_options(
+    env, name_prefix, input_map_key_ops, input_map_key_outputs, input_map_value_ops, input_map_value_outputs,
+    control_dependency_map_key_ops, control_dependency_map_value_ops, control_dependencies);
+  import_graph_def(env, g, data, length, options);
+  TF_DeleteImportGraphDefOptions(options);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importGraphDefFromFile(
+    JNIEnv* env, jobject object, jlong graph_handle, jstring filename, jstring name_prefix,
+    jobjectArray input_map_key_ops, jintArray input_map_key_outputs, jlongArray input_map_value_ops,
+    jintArray input_map_value_outputs,
+    jobjectArray control_dependency_map_key_ops, jlongArray control_dependency_map_value_ops,
+    jlongArray control_dependencies) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return;
+
+  const char *filename_c_string = env->GetStringUTFChars(filename, nullptr);
+  std::string c_filename(filename_c_string);
+  env->ReleaseStringUTFChars(filename, filename_c_string);
+  std::shared_ptr<tensorflow::ReadOnlyMemoryRegion> region;
+  if (!throw_exception_if_not_ok(env, GraphDefFileCache::Get().Lookup(c_filename, &region))) return;
+
+  TF_ImportGraphDefOptions *options = new_import_graph_def_options(
+    env, name_prefix, input_map_key_ops, input_map_key_outputs, input_map_value_ops, input_map_value_outputs,
+    control_dependency_map_key_ops, control_dependency_map_value_ops, control_dependencies);
+  import_graph_def(env, g, region->data(), static_cast<size_t>(region->length()), options);
+  TF_DeleteImportGraphDefOptions(options);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importOptimizedGraphDef(
+    JNIEnv* env, jobject object, jlong graph_handle, jlong source_graph_handle, jbyteArray rewriter_config,
+    jobjectArray fetches, jstring name_prefix,
+    jobjectArray input_map_key_ops, jintArray input_map_key_outputs, jlongArray input_map_value_ops,
+    jintArray input_map_value_outputs,
+    jobjectArray control_dependency_map_key_ops, jlongArray control_dependency_map_value_ops,
+    jlongArray control_dependencies) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return;
+  TF_Graph *source_g = require_graph_handle(env, source_graph_handle);
+  if (source_g == nullptr) return;
+
+  // The source graph definition and the optimized one never leave native memory.
+  tensorflow::GraphDef source_graph_def;
+  if (!to_graph_def(env, source_g, &source_graph_def)) return;
+
+  tensorflow::RewriterConfig config;
+  if (rewriter_config != nullptr) {
+    jbyte *config_bytes = env->GetByteArrayElements(rewriter_config, nullptr);
+    bool parsed = config.ParseFromArray(config_bytes, static_cast<int>(env->GetArrayLength(rewriter_config)));
+    env->ReleaseByteArrayElements(rewriter_config, config_bytes, JNI_ABORT);
+    if (!parsed) {
+      throw_exception(env, tf_invalid_argument_exception, "Unable to parse the provided RewriterConfig.");
+      return;
     }
-    env->ReleaseIntArrayElements(input_map_key_outputs, input_map_key_outputs_elements, 0);
-    env->ReleaseLongArrayElements(input_map_value_ops, input_map_value_ops_elements, 0);
-    env->ReleaseIntArrayElements(input_map_value_outputs, input_map_value_outputs_elements, 0);
   }
 
-  // Handle the control dependency map arguments
-  if (control_dependency_map_key_ops != nullptr) {
-    int control_dependency_map_length = env->GetArrayLength(control_dependency_map_key_ops);
-    if (control_dependency_map_length != env->GetArrayLength(control_dependency_map_value_ops))
-      throw_exception(
-        env, tf_invalid_argument_exception, "All control dependency map arguments must have the same length.");
-     jlong *control_dependency_map_value_ops_elements = env->GetLongArrayElements(control_dependency_map_value_ops, 0);
-     for (int i = 0; i < control_dependency_map_length; ++i) {
-      jstring control_dependency_map_key_op =
-        reinterpret_cast<jstring>(env->GetObjectArrayElement(control_dependency_map_key_ops, i));
-      const char *control_dependency_map_key_op_c_string =
-        env->GetStringUTFChars(control_dependency_map_key_op, nullptr);
-      TF_Operation *op = require_operation_handle(env, control_dependency_map_value_ops_elements[i]);
+  const std::vector<std::string> fetch_names = to_string_vector(env, fetches);
+  tensorflow::GraphDef optimized_graph_def;
+  if (!throw_exception_if_not_ok(
+      env, tensorflow::OptimizedGraphCache::Global()->Optimize(
+          source_graph_def, config, fetch_names, &optimized_graph_def)))
+    return;
+  const std::string serialized_graph_def = optimized_graph_def.SerializeAsString();
+
+  TF_ImportGraphDefOptions *options = new_import_graph_def_options(
+    env, name_prefix, input_map_key_ops, input_map_key_outputs, input_map_value_ops, input_map_value_outputs,
+    control_dependency_map_key_ops, control_dependency_map_value_ops, control_dependencies);
+  import_graph_def(env, g, serialized_graph_def.data(), serialized_graph_def.size(), options);
+  TF_DeleteImportGraphDefOptions(options);
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_optimizeLayout(
+    JNIEnv* env, jobject object, jlong graph_handle, jobjectArray fetches) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return nullptr;
+
+  tensorflow::GraphDef graph_def;
+  if (!to_graph_def(env, g, &graph_def)) return nullptr;
+  const std::vector<std::string> fetch_names = to_string_vector(env, fetches);
+  tensorflow::GraphDef optimized_graph_def;
+  if (!throw_exception_if_not_ok(
+      env, tensorflow::OptimizeGraphLayout(graph_def, fetch_names, &optimized_graph_def)))
+    return nullptr;
+  const std::string serialized_graph_def = optimized_graph_def.SerializeAsString();
+  jbyteArray result = env->NewByteArray(static_cast<jsize>(serialized_graph_def.size()));
+  env->SetByteArrayRegion(
+      result, 0, static_cast<jsize>(serialized_graph_def.size()),
+      reinterpret_cast<const jbyte*>(serialized_graph_def.data()));
+  return result;
+}
+
+namespace {
+  // Reads the values of "variables" by evaluating their tensors in "session", using a single run.
+  tensorflow::Status read_frozen_variables(
+      TF_Graph* g, TF_Session* session, const std::vector<tensorflow::FrozenVariable>& variables,
+      std::vector<tensorflow::Tensor>* values) {
+    std::vector<TF_Output> outputs;
+    outputs.reserve(variables.size());
+    for (const tensorflow::FrozenVariable& variable : variables) {
+      const tensorflow::TensorId id = tensorflow::ParseTensorName(variable.tensor);
+      TF_Operation* op = TF_GraphOperationByName(g, id.first.ToString().c_str());
       if (op == nullptr)
-        throw_exception(
-          env, tf_invalid_argument_exception, "Provided control dependency map destination op cannot be found.");
-      TF_ImportGraphDefOptionsRemapControlDependency(options, control_dependency_map_key_op_c_string, op);
-      env->ReleaseStringUTFChars(control_dependency_map_key_op, control_dependency_map_key_op_c_string);
+        return tensorflow::errors::NotFound("Tensor '", variable.tensor, "' was not found in the graph.");
+      outputs.push_back({op, id.second});
     }
-    env->ReleaseLongArrayElements(control_dependency_map_value_ops, control_dependency_map_value_ops_elements, 0);
+    std::vector<TF_Tensor*> output_values(outputs.size(), nullptr);
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    TF_SessionRun(
+        session, nullptr, nullptr, nullptr, 0, outputs.data(), output_values.data(), static_cast<int>(outputs.size()),
+        nullptr, 0, nullptr, status.get());
+    tensorflow::Status s = tensorflow::StatusFromTF_Status(status.get());
+    values->clear();
+    values->reserve(output_values.size());
+    for (TF_Tensor* value : output_values) {
+      if (s.ok()) {
+        values->emplace_back();
+        s = tensorflow::TF_TensorToTensor(value, &values->back());
+      }
+      if (value != nullptr) TF_DeleteTensor(value);
+    }
+    return s;
   }
+}  // namespace
 
-  // Handle the control dependencies argument
-  if (control_dependencies != nullptr) {
-    int control_dependencies_length = env->GetArrayLength(control_dependencies);
-    jlong *control_dependencies_elements = env->GetLongArrayElements(control_dependencies, 0);
-    for (int i = 0; i < control_dependencies_length; ++i) {
-      TF_Operation *op = require_operation_handle(env, control_dependencies_elements[i]);
-      if (op == nullptr)
-        throw_exception(env, tf_invalid_argument_exception, "Provided control dependency op cannot be found.");
-      TF_ImportGraphDefOptionsAddControlDependency(options, op);
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_freezeAndPrune(
+    JNIEnv* env, jobject object, jlong graph_handle, jlong session_handle, jstring checkpoint_prefix,
+    jobjectArray fetches, jobjectArray feeds) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return nullptr;
+
+  // The whole graph definition and the values of the variables never leave native memory.
+  tensorflow::GraphDef graph_def;
+  if (!to_graph_def(env, g, &graph_def)) return nullptr;
+  const std::vector<std::string> fetch_names = to_string_vector(env, fetches);
+  const std::vector<std::string> feed_names = to_string_vector(env, feeds);
+  std::vector<tensorflow::FrozenVariable> variables;
+  if (!throw_exception_if_not_ok(
+      env, tensorflow::FindFrozenVariables(graph_def, fetch_names, feed_names, &variables)))
+    return nullptr;
+
+  std::vector<tensorflow::Tensor> values;
+  if (!variables.empty()) {
+    tensorflow::Status s;
+    if (checkpoint_prefix != nullptr) {
+      const char *c_checkpoint_prefix = env->GetStringUTFChars(checkpoint_prefix, nullptr);
+      s = tensorflow::ReadFrozenVariables(c_checkpoint_prefix, variables, &values);
+      env->ReleaseStringUTFChars(checkpoint_prefix, c_checkpoint_prefix);
+    } else if (session_handle != 0) {
+      s = read_frozen_variables(g, reinterpret_cast<TF_Session*>(session_handle), variables, &values);
+    } else {
+      s = tensorflow::errors::InvalidArgument(
+          "A session or a checkpoint is required in order to freeze the variables of the graph.");
     }
-    env->ReleaseLongArrayElements(control_dependencies, control_dependencies_elements, 0);
+    if (!throw_exception_if_not_ok(env, s)) return nullptr;
   }
 
-  // Call the C API "TF_GraphImportGraphDef" function and throw an exception if an error occurs
-  static_assert(sizeof(jbyte) == 1, "unexpected size of the jbyte type");
-  jbyte *bytes = env->GetByteArrayElements(graph_def, nullptr);
-  TF_Buffer *buffer = TF_NewBufferFromString(bytes, static_cast<size_t>(env->GetArrayLength(graph_def)));
-  TF_Status *status = TF_NewStatus();
-  TF_GraphImportGraphDef(g, buffer, options, status);
-  throw_exception_if_not_ok(env, status);
+  tensorflow::GraphDef frozen_graph_def;
+  if (!throw_exception_if_not_ok(
+      env, tensorflow::FreezeAndPruneGraph(graph_def, fetch_names, feed_names, variables, values, &frozen_graph_def)))
+    return nullptr;
+  const std::string serialized_graph_def = frozen_graph_def.SerializeAsString();
+  jbyteArray result = env->NewByteArray(static_cast<jsize>(serialized_graph_def.size()));
+  env->SetByteArrayRegion(
+      result, 0, static_cast<jsize>(serialized_graph_def.size()),
+      reinterpret_cast<const jbyte*>(serialized_graph_def.data()));
+  return result;
+}
 
-  // Continue cleaning up resources even if an exception was thrown
-  TF_DeleteStatus(status);
-  TF_DeleteBuffer(buffer);
-  env->ReleaseByteArrayElements(graph_def, bytes, JNI_ABORT);
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_quantizationCalibrationTensors(
+    JNIEnv* env, jobject object, jlong graph_handle) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return nullptr;
+
+  tensorflow::GraphDef graph_def;
+  if (!to_graph_def(env, g, &graph_def)) return nullptr;
+  std::vector<std::string> tensors;
+  if (!throw_exception_if_not_ok(env, tensorflow::FindQuantizationCalibrationTensors(graph_def, &tensors)))
+    return nullptr;
+  jobjectArray tensors_array = env->NewObjectArray(
+      static_cast<jsize>(tensors.size()), jvm_cache().string_class, nullptr);
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    jstring tensor = env->NewStringUTF(tensors[i].c_str());
+    env->SetObjectArrayElement(tensors_array, static_cast<jsize>(i), tensor);
+    env->DeleteLocalRef(tensor);
+  }
+  return tensors_array;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importQuantizedGraphDef(
+    JNIEnv* env, jobject object, jlong graph_handle, jlong source_graph_handle, jobjectArray range_tensors,
+    jfloatArray range_mins, jfloatArray range_maxs, jstring name_prefix,
+    jobjectArray input_map_key_ops, jintArray input_map_key_outputs, jlongArray input_map_value_ops,
+    jintArray input_map_value_outputs,
+    jobjectArray control_dependency_map_key_ops, jlongArray control_dependency_map_value_ops,
+    jlongArray control_dependencies) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return;
+  TF_Graph *source_g = require_graph_handle(env, source_graph_handle);
+  if (source_g == nullptr) return;
+
+  // The source graph definition and the quantized one never leave native memory.
+  tensorflow::GraphDef source_graph_def;
+  if (!to_graph_def(env, source_g, &source_graph_def)) return;
+
+  const std::vector<std::string> tensor_names = to_string_vector(env, range_tensors);
+  const jsize num_ranges = env->GetArrayLength(range_mins);
+  if (static_cast<size_t>(num_ranges) != tensor_names.size() || env->GetArrayLength(range_maxs) != num_ranges) {
+    throw_exception(env, tf_invalid_argument_exception, "Mismatched numbers of calibrated tensors and ranges.");
+    return;
+  }
+  std::vector<jfloat> mins(static_cast<size_t>(num_ranges));
+  std::vector<jfloat> maxs(static_cast<size_t>(num_ranges));
+  env->GetFloatArrayRegion(range_mins, 0, num_ranges, mins.data());
+  env->GetFloatArrayRegion(range_maxs, 0, num_ranges, maxs.data());
+  tensorflow::QuantizationRanges ranges;
+  for (jsize i = 0; i < num_ranges; ++i) ranges[tensor_names[i]] = std::make_pair(mins[i], maxs[i]);
+
+  tensorflow::GraphDef quantized_graph_def;
+  if (!throw_exception_if_not_ok(
+      env, tensorflow::QuantizeGraph(source_graph_def, ranges, &quantized_graph_def)))
+    return;
+  const std::string serialized_graph_def = quantized_graph_def.SerializeAsString();
+
+  TF_ImportGraphDefOptions *options = new_import_graph_def_options(
+    env, name_prefix, input_map_key_ops, input_map_key_outputs, input_map_value_ops, input_map_value_outputs,
+    control_dependency_map_key_ops, control_dependency_map_value_ops, control_dependencies);
+  import_graph_def(env, g, serialized_graph_def.data(), serialized_graph_def.size(), options);
   TF_DeleteImportGraphDefOptions(options);
 }
 
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_clearGraphDefFileCache(
+    JNIEnv* env, jobject object) {
+  GraphDefFileCache::Get().Clear();
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_enableOptimizedGraphCache(
+    JNIEnv* env, jobject object, jstring directory) {
+  const char* c_directory = env->GetStringUTFChars(directory, nullptr);
+  tensorflow::Status s = tensorflow::OptimizedGraphCache::Global()->Enable(std::string(c_directory));
+  env->ReleaseStringUTFChars(directory, c_directory);
+  throw_exception_if_not_ok(env, s);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_disableOptimizedGraphCache(
+    JNIEnv* env, jobject object) {
+  tensorflow::OptimizedGraphCache::Global()->Disable();
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_optimizedGraphCacheStatistics(
+    JNIEnv* env, jobject object) {
+  const tensorflow::OptimizedGraphCache::Statistics statistics =
+      tensorflow::OptimizedGraphCache::Global()->statistics();
+  const jlong values[] = {
+      statistics.hits, statistics.misses, statistics.failed_writes, statistics.optimization_micros};
+  const jsize num_values = static_cast<jsize>(sizeof(values) / sizeof(values[0]));
+  jlongArray result = env->NewLongArray(num_values);
+  env->SetLongArrayRegion(result, 0, num_values, values);
+  return result;
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_snapshot(
+    JNIEnv* env, jobject object, jlong graph_handle) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return nullptr;
+
+  // Walk the graph once, collecting the metadata of all ops in flat arrays.
+  std::vector<TF_Operation *> ops;
+  size_t pos = 0;
+  TF_Operation *op;
+  while ((op = TF_GraphNextOperation(g, &pos)) != nullptr)
+    ops.push_back(op);
+  const jsize num_ops = static_cast<jsize>(ops.size());
+
+  std::vector<jint> input_offsets{0};
+  std::vector<jlong> input_op_handles;
+  std::vector<jint> input_output_indices;
+  std::vector<jint> control_input_offsets{0};
+  std::vector<jlong> control_input_op_handles;
+  std::vector<jint> output_offsets{0};
+  std::vector<jint> output_data_types;
+  std::vector<jint> output_ranks;
+  std::vector<jint> output_shape_offsets;
+  std::vector<jlong> output_shapes;
+  std::vector<TF_Operation *> control_inputs;
+  std::vector<int64_t> dims;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  for (TF_Operation *op : ops) {
+    const int num_inputs = TF_OperationNumInputs(op);
+    for (int i = 0; i < num_inputs; ++i) {
+      TF_Output input = TF_OperationInput(TF_Input{op, i});
+      input_op_handles.push_back(reinterpret_cast<jlong>(input.oper));
+      input_output_indices.push_back(static_cast<jint>(input.index));
+    }
+    input_offsets.push_back(static_cast<jint>(input_op_handles.size()));
+
+    const int num_control_inputs = TF_OperationNumControlInputs(op);
+    control_inputs.resize(static_cast<size_t>(num_control_inputs));
+    TF_OperationGetControlInputs(op, control_inputs.data(), num_control_inputs);
+    for (TF_Operation *control_input : control_inputs)
+      control_input_op_handles.push_back(reinterpret_cast<jlong>(control_input));
+    control_input_offsets.push_back(static_cast<jint>(control_input_op_handles.size()));
+
+    const int num_outputs = TF_OperationNumOutputs(op);
+    for (int i = 0; i < num_outputs; ++i) {
+      TF_Output output{op, i};
+      output_data_types.push_back(static_cast<jint>(TF_OperationOutputType(output)));
+      output_shape_offsets.push_back(static_cast<jint>(output_shapes.size()));
+      const int num_dims = TF_GraphGetTensorNumDims(g, output, status.get());
+      if (TF_GetCode(status.get()) != TF_OK || num_dims < 0) {
+        output_ranks.push_back(-1);
+        continue;
+      }
+      dims.resize(static_cast<size_t>(num_dims));
+      TF_GraphGetTensorShape(g, output, dims.data(), num_dims, status.get());
+      if (TF_GetCode(status.get()) != TF_OK) {
+        output_ranks.push_back(-1);
+        continue;
+      }
+      output_ranks.push_back(static_cast<jint>(num_dims));
+      for (int64_t dim : dims)
+        output_shapes.push_back(static_cast<jlong>(dim));
+    }
+    output_offsets.push_back(static_cast<jint>(output_data_types.size()));
+  }
+
+  // Convert the collected metadata to Java arrays.
+  const JVMCache& cache = jvm_cache();
+  jclass string_class = cache.string_class;
+  jlongArray op_handles_array = env->NewLongArray(num_ops);
+  jobjectArray names_array = env->NewObjectArray(num_ops, string_class, nullptr);
+  jobjectArray op_types_array = env->NewObjectArray(num_ops, string_class, nullptr);
+  jobjectArray devices_array = env->NewObjectArray(num_ops, string_class, nullptr);
+  for (jsize i = 0; i < num_ops; ++i) {
+    jlong op_handle = reinterpret_cast<jlong>(ops[i]);
+    env->SetLongArrayRegion(op_handles_array, i, 1, &op_handle);
+    jstring name = env->NewStringUTF(TF_OperationName(ops[i]));
+    env->SetObjectArrayElement(names_array, i, name);
+    env->DeleteLocalRef(name);
+    jstring op_type = env->NewStringUTF(TF_OperationOpType(ops[i]));
+    env->SetObjectArrayElement(op_types_array, i, op_type);
+    env->DeleteLocalRef(op_type);
+    jstring device = env->NewStringUTF(TF_OperationDevice(ops[i]));
+    env->SetObjectArrayElement(devices_array, i, device);
+    env->DeleteLocalRef(device);
+  }
+
+  auto to_int_array = [env](const std::vector<jint>& values) {
+    jintArray array = env->NewIntArray(static_cast<jsize>(values.size()));
+    env->SetIntArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+    return array;
+  };
+  auto to_long_array = [env](const std::vector<jlong>& values) {
+    jlongArray array = env->NewLongArray(static_cast<jsize>(values.size()));
+    env->SetLongArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+    return array;
+  };
+
+  return env->CallStaticObjectMethod(
+      cache.graph_snapshot_class, cache.graph_snapshot_apply, op_handles_array, names_array, op_types_array, devices_array,
+      to_int_array(input_offsets), to_long_array(input_op_handles), to_int_array(input_output_indices),
+      to_int_array(control_input_offsets), to_long_array(control_input_op_handles), to_int_array(output_offsets),
+      to_int_array(output_data_types), to_int_array(output_ranks), to_int_array(output_shape_offsets),
+      to_long_array(output_shapes));
+}
+
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_toGraphDef(
     JNIEnv* env, jobject object, jlong graph_handle) {
   TF_Graph *g = require_graph_handle(env, graph_handle);
@@ -266,3 +810,143 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_toGra
   TF_DeleteBuffer(buf);
   return return_array;
 }
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_toGraphDefFile(
+    JNIEnv* env, jobject object, jlong graph_handle, jstring filename) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return;
+
+  std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> buffer(TF_NewBuffer(), TF_DeleteBuffer);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_GraphToGraphDef(g, buffer.get(), status.get());
+  if (!throw_exception_if_not_ok(env, status.get())) return;
+
+  const char *filename_c_string = env->GetStringUTFChars(filename, nullptr);
+  std::string c_filename(filename_c_string);
+  env->ReleaseStringUTFChars(filename, filename_c_string);
+  throw_exception_if_not_ok(env, tensorflow::WriteStringToFile(
+      tensorflow::Env::Default(), c_filename,
+      tensorflow::StringPiece(static_cast<const char *>(buffer->data), buffer->length)));
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_toGraphDefBuffer(
+    JNIEnv* env, jobject object, jlong graph_handle, jobject target) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return 0;
+
+  void *target_data = env->GetDirectBufferAddress(target);
+  if (target_data == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "The provided target buffer must be direct.");
+    return 0;
+  }
+  const size_t target_capacity = static_cast<size_t>(env->GetDirectBufferCapacity(target));
+
+  std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> buffer(TF_NewBuffer(), TF_DeleteBuffer);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_GraphToGraphDef(g, buffer.get(), status.get());
+  if (!throw_exception_if_not_ok(env, status.get())) return 0;
+
+  // Nothing is written if the target buffer is too small, so that the caller can retry with a large enough buffer.
+  if (buffer->length <= target_capacity)
+    std::memcpy(target_data, buffer->data, buffer->length);
+  return static_cast<jlong>(buffer->length);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_nodeDefsToFile(
+    JNIEnv* env, jobject object, jlong graph_handle, jlong start_position, jstring filename, jboolean append) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return 0;
+
+  const char *filename_c_string = env->GetStringUTFChars(filename, nullptr);
+  std::string c_filename(filename_c_string);
+  env->ReleaseStringUTFChars(filename, filename_c_string);
+  std::unique_ptr<tensorflow::WritableFile> file;
+  if (append == JNI_TRUE) {
+    if (!throw_exception_if_not_ok(env, tensorflow::Env::Default()->NewAppendableFile(c_filename, &file))) return 0;
+  } else {
+    if (!throw_exception_if_not_ok(env, tensorflow::Env::Default()->NewWritableFile(c_filename, &file))) return 0;
+  }
+
+  // Each op is written as a "node" field (i.e., field number 1, with the length-delimited wire type) of a "GraphDef"
+  // message. Because concatenated serialized protocol buffer messages are parsed as a single merged message, files
+  // holding the output of successive calls can be parsed as one "GraphDef" holding all of the written nodes.
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  size_t position = static_cast<size_t>(start_position);
+  TF_Operation *op;
+  while ((op = TF_GraphNextOperation(g, &position)) != nullptr) {
+    std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> node_def(TF_NewBuffer(), TF_DeleteBuffer);
+    TF_OperationToNodeDef(op, node_def.get(), status.get());
+    if (!throw_exception_if_not_ok(env, status.get())) return 0;
+    char header[11];
+    size_t header_length = 0;
+    header[header_length++] = 0x0A;
+    uint64_t length = static_cast<uint64_t>(node_def->length);
+    while (length >= 0x80) {
+      header[header_length++] = static_cast<char>((length & 0x7F) | 0x80);
+      length >>= 7;
+    }
+    header[header_length++] = static_cast<char>(length);
+    if (!throw_exception_if_not_ok(env, file->Append(tensorflow::StringPiece(header, header_length)))) return 0;
+    if (!throw_exception_if_not_ok(env, file->Append(tensorflow::StringPiece(
+        static_cast<const char *>(node_def->data), node_def->length)))) return 0;
+  }
+  if (!throw_exception_if_not_ok(env, file->Close())) return 0;
+  return static_cast<jlong>(position);
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_estimateCosts(
+    JNIEnv* env, jobject object, jlong graph_handle, jobjectArray fetches) {
+  TF_Graph *g = require_graph_handle(env, graph_handle);
+  if (g == nullptr) return nullptr;
+
+  tensorflow::GraphDef graph_def;
+  if (!to_graph_def(env, g, &graph_def)) return nullptr;
+  tensorflow::GraphCostReport report;
+  tensorflow::Status s = tensorflow::EstimateGraphCosts(graph_def, to_string_vector(env, fetches), &report);
+  if (!throw_exception_if_not_ok(env, s)) return nullptr;
+
+  const JVMCache& cache = jvm_cache();
+  auto to_string_array = [env, &cache](const std::vector<const std::string*>& values) {
+    jobjectArray array = env->NewObjectArray(static_cast<jsize>(values.size()), cache.string_class, nullptr);
+    for (size_t i = 0; i < values.size(); ++i) {
+      jstring value = env->NewStringUTF(values[i]->c_str());
+      env->SetObjectArrayElement(array, static_cast<jsize>(i), value);
+      env->DeleteLocalRef(value);
+    }
+    return array;
+  };
+  auto to_long_array = [env](const std::vector<jlong>& values) {
+    jlongArray array = env->NewLongArray(static_cast<jsize>(values.size()));
+    env->SetLongArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+    return array;
+  };
+
+  std::vector<const std::string*> device_names;
+  std::vector<jlong> device_execution_micros;
+  std::vector<jlong> device_peak_memory_bytes;
+  for (const auto& device : report.devices) {
+    device_names.push_back(&device.device);
+    device_execution_micros.push_back(static_cast<jlong>(device.execution_micros));
+    device_peak_memory_bytes.push_back(static_cast<jlong>(device.peak_memory_bytes));
+  }
+  std::vector<const std::string*> node_names;
+  std::vector<const std::string*> node_op_types;
+  std::vector<const std::string*> node_devices;
+  std::vector<jlong> node_execution_micros;
+  std::vector<jlong> node_compute_micros;
+  std::vector<jlong> node_memory_micros;
+  for (const auto& node : report.nodes) {
+    node_names.push_back(&node.name);
+    node_op_types.push_back(&node.op_type);
+    node_devices.push_back(&node.device);
+    node_execution_micros.push_back(static_cast<jlong>(node.execution_micros));
+    node_compute_micros.push_back(static_cast<jlong>(node.compute_micros));
+    node_memory_micros.push_back(static_cast<jlong>(node.memory_micros));
+  }
+
+  return env->CallStaticObjectMethod(
+      cache.graph_cost_report_class, cache.graph_cost_report_apply, static_cast<jlong>(report.execution_micros),
+      to_string_array(device_names), to_long_array(device_execution_micros), to_long_array(device_peak_memory_bytes),
+      to_string_array(node_names), to_string_array(node_op_types), to_string_array(node_devices),
+      to_long_array(node_execution_micros), to_long_array(node_compute_micros), to_long_array(node_memory_micros));
+}
@@ -47,6 +47,14 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_ops
 JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_addGradients
   (JNIEnv *, jobject, jlong, jobjectArray, jobjectArray, jobjectArray);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    nativeGradientSupport
+ * Signature: (J[J)[Z
+ */
+JNIEXPORT jbooleanArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_nativeGradientSupport
+  (JNIEnv *, jobject, jlong, jlongArray);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Graph__
  * Method:    importGraphDef
@@ -55,6 +63,102 @@ JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_add
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importGraphDef
   (JNIEnv *, jobject, jlong, jbyteArray, jstring, jobjectArray, jintArray, jlongArray, jintArray, jobjectArray, jlongArray, jlongArray);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    importOps
+ * Signature: (J[BLjava/lang/String;[Ljava/lang/String;[I[J[I[Ljava/lang/String;[J[J[Ljava/lang/String;)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importOps
+  (JNIEnv *, jobject, jlong, jbyteArray, jstring, jobjectArray, jintArray, jlongArray, jintArray, jobjectArray, jlongArray, jlongArray, jobjectArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    importGraphDefFromBuffer
+ * Signature: (JLjava/nio/ByteBuffer;Ljava/lang/String;[Ljava/lang/String;[I[J[I[Ljava/lang/String;[J[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importGraphDefFromBuffer
+  (JNIEnv *, jobject, jlong, jobject, jstring, jobjectArray, jintArray, jlongArray, jintArray, jobjectArray, jlongArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    importGraphDefFromFile
+ * Signature: (JLjava/lang/String;Ljava/lang/String;[Ljava/lang/String;[I[J[I[Ljava/lang/String;[J[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importGraphDefFromFile
+  (JNIEnv *, jobject, jlong, jstring, jstring, jobjectArray, jintArray, jlongArray, jintArray, jobjectArray, jlongArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    importOptimizedGraphDef
+ * Signature: (JJ[B[Ljava/lang/String;Ljava/lang/String;[Ljava/lang/String;[I[J[I[Ljava/lang/String;[J[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importOptimizedGraphDef
+  (JNIEnv *, jobject, jlong, jlong, jbyteArray, jobjectArray, jstring, jobjectArray, jintArray, jlongArray, jintArray, jobjectArray, jlongArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    freezeAndPrune
+ * Signature: (JJLjava/lang/String;[Ljava/lang/String;[Ljava/lang/String;)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_freezeAndPrune
+  (JNIEnv *, jobject, jlong, jlong, jstring, jobjectArray, jobjectArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    quantizationCalibrationTensors
+ * Signature: (J)[Ljava/lang/String;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_quantizationCalibrationTensors
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    importQuantizedGraphDef
+ * Signature: (JJ[Ljava/lang/String;[F[FLjava/lang/String;[Ljava/lang/String;[I[J[I[Ljava/lang/String;[J[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importQuantizedGraphDef
+  (JNIEnv *, jobject, jlong, jlong, jobjectArray, jfloatArray, jfloatArray, jstring, jobjectArray, jintArray, jlongArray, jintArray, jobjectArray, jlongArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    clearGraphDefFileCache
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_clearGraphDefFileCache
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    enableOptimizedGraphCache
+ * Signature: (Ljava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_enableOptimizedGraphCache
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    disableOptimizedGraphCache
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_disableOptimizedGraphCache
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    optimizedGraphCacheStatistics
+ * Signature: ()[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_optimizedGraphCacheStatistics
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    snapshot
+ * Signature: (J)Lorg/platanios/tensorflow/jni/GraphSnapshot;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_snapshot
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Graph__
  * Method:    toGraphDef
@@ -63,6 +167,46 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_importGraph
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_toGraphDef
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    toGraphDefFile
+ * Signature: (JLjava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_toGraphDefFile
+  (JNIEnv *, jobject, jlong, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    toGraphDefBuffer
+ * Signature: (JLjava/nio/ByteBuffer;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_toGraphDefBuffer
+  (JNIEnv *, jobject, jlong, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    nodeDefsToFile
+ * Signature: (JJLjava/lang/String;Z)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_nodeDefsToFile
+  (JNIEnv *, jobject, jlong, jlong, jstring, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    estimateCosts
+ * Signature: (J[Ljava/lang/String;)Lorg/platanios/tensorflow/jni/GraphCostReport;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_estimateCosts
+  (JNIEnv *, jobject, jlong, jobjectArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Graph__
+ * Method:    optimizeLayout
+ * Signature: (J[Ljava/lang/String;)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Graph_00024_optimizeLayout
+  (JNIEnv *, jobject, jlong, jobjectArray);
+
 #ifdef __cplusplus
 }
 #endif
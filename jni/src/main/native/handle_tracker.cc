@@ -0,0 +1,75 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "handle_tracker.h"
+#include "jvm_cache.h"
+#include "utilities.h"
+
+#include <vector>
+
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/handle_tracker.h"
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_HandleTracker_00024_setEnabled(
+    JNIEnv* env, jobject object, jboolean enabled) {
+  tensorflow::HandleTracker::Global()->SetEnabled(static_cast<bool>(enabled));
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_HandleTracker_00024_setThreadTag(
+    JNIEnv* env, jobject object, jstring tag) {
+  if (tag == nullptr) {
+    tensorflow::HandleTracker::SetThreadTag("");
+    return;
+  }
+  const char* c_tag = env->GetStringUTFChars(tag, nullptr);
+  tensorflow::HandleTracker::SetThreadTag(c_tag);
+  env->ReleaseStringUTFChars(tag, c_tag);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_HandleTracker_00024_trackEagerTensor(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(eager_tensor, TFE_TensorHandle, handle, void());
+  // Pending handles already have their final data type and shape, and so their size is known.
+  const tensorflow::int64 bytes = static_cast<tensorflow::int64>(eager_tensor->t.TotalBytes());
+  tensorflow::HandleTracker::Global()->Track(tensorflow::HandleTracker::kEagerTensor, eager_tensor, bytes);
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_HandleTracker_00024_snapshot(
+    JNIEnv* env, jobject object) {
+  const std::vector<tensorflow::HandleTracker::Statistics> snapshot = tensorflow::HandleTracker::Global()->Snapshot();
+  const JVMCache& cache = jvm_cache();
+  const jsize num_entries = static_cast<jsize>(snapshot.size());
+  jobjectArray types = env->NewObjectArray(num_entries, cache.string_class, nullptr);
+  jobjectArray tags = env->NewObjectArray(num_entries, cache.string_class, nullptr);
+  std::vector<jlong> values;
+  values.reserve(snapshot.size() * 4);
+  for (jsize i = 0; i < num_entries; ++i) {
+    jstring type = env->NewStringUTF(tensorflow::HandleTracker::TypeName(snapshot[i].type));
+    env->SetObjectArrayElement(types, i, type);
+    env->DeleteLocalRef(type);
+    jstring tag = env->NewStringUTF(snapshot[i].tag.c_str());
+    env->SetObjectArrayElement(tags, i, tag);
+    env->DeleteLocalRef(tag);
+    values.push_back(static_cast<jlong>(snapshot[i].live_count));
+    values.push_back(static_cast<jlong>(snapshot[i].live_bytes));
+    values.push_back(static_cast<jlong>(snapshot[i].num_created));
+    values.push_back(static_cast<jlong>(snapshot[i].num_released));
+  }
+  jlongArray values_array = env->NewLongArray(static_cast<jsize>(values.size()));
+  env->SetLongArrayRegion(values_array, 0, static_cast<jsize>(values.size()), values.data());
+  return env->CallStaticObjectMethod(
+      cache.handle_statistics_class, cache.handle_statistics_apply, types, tags, values_array);
+}
@@ -0,0 +1,45 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_HandleTracker__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_HandleTracker__
+#define _Included_org_platanios_tensorflow_jni_HandleTracker__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_HandleTracker__
+ * Method:    setEnabled
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_HandleTracker_00024_setEnabled
+  (JNIEnv *, jobject, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_HandleTracker__
+ * Method:    setThreadTag
+ * Signature: (Ljava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_HandleTracker_00024_setThreadTag
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_HandleTracker__
+ * Method:    trackEagerTensor
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_HandleTracker_00024_trackEagerTensor
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_HandleTracker__
+ * Method:    snapshot
+ * Signature: ()Lorg/platanios/tensorflow/jni/HandleStatistics;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_HandleTracker_00024_snapshot
+  (JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,41 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/allocator_statistics.h"
+
+#include <unordered_set>
+
+namespace tensorflow {
+
+void CollectAllocatorStats(
+    const std::vector<std::pair<string, Device*>>& devices,
+    std::vector<DeviceAllocatorStats>* stats) {
+  stats->clear();
+  std::unordered_set<Allocator*> seen;
+  for (const auto& device : devices) {
+    Allocator* allocator =
+        device.second == nullptr
+            ? cpu_allocator()
+            : device.second->GetAllocator(AllocatorAttributes());
+    if (allocator == nullptr || !seen.insert(allocator).second) continue;
+    DeviceAllocatorStats device_stats;
+    device_stats.device = device.first;
+    device_stats.allocator = allocator->Name();
+    allocator->GetStats(&device_stats.stats);
+    stats->push_back(device_stats);
+  }
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,46 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_ALLOCATOR_STATISTICS_H_
+#define TENSORFLOW_C_ALLOCATOR_STATISTICS_H_
+
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/common_runtime/device.h"
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Statistics of an allocator used by a device.
+struct DeviceAllocatorStats {
+  string device;
+  string allocator;
+  AllocatorStats stats;
+};
+
+// Collects the statistics of the device memory allocator of each device in
+// "devices", which pairs device names with devices. A null device stands for
+// the local CPU, whose memory is allocated by the process-wide CPU allocator.
+// Allocators that are shared by multiple devices are only reported once, for
+// the first one of them.
+void CollectAllocatorStats(
+    const std::vector<std::pair<string, Device*>>& devices,
+    std::vector<DeviceAllocatorStats>* stats);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_ALLOCATOR_STATISTICS_H_
@@ -0,0 +1,693 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/arrow_reader.h"
+
+#include <cstring>
+#include <unordered_map>
+
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/file_system.h"
+
+namespace tensorflow {
+
+namespace {
+
+constexpr char kArrowMagic[] = "ARROW1";
+constexpr size_t kArrowMagicSize = 6;
+
+// Type identifiers of the "Type" union of the Arrow schema.
+enum ArrowType : uint8 {
+  kArrowNull = 1,
+  kArrowInt = 2,
+  kArrowFloatingPoint = 3,
+  kArrowBinary = 4,
+  kArrowUtf8 = 5,
+  kArrowBool = 6,
+  kArrowStruct = 13,
+  kArrowUnion = 14,
+  kArrowFixedSizeList = 16,
+  kArrowLargeBinary = 19,
+  kArrowLargeUtf8 = 20,
+  kArrowRunEndEncoded = 22,
+  kArrowBinaryView = 23,
+  kArrowUtf8View = 24,
+  kArrowListView = 25,
+  kArrowLargeListView = 26,
+};
+
+// Type identifier of record batches in the "MessageHeader" union.
+constexpr uint8 kArrowRecordBatch = 3;
+
+// Sizes of the "Block", "FieldNode", and "Buffer" structs.
+constexpr size_t kBlockSize = 24;
+constexpr size_t kFieldNodeSize = 16;
+constexpr size_t kBufferSize = 16;
+
+Status Malformed() { return errors::DataLoss("Malformed Arrow metadata."); }
+
+template <typename T>
+bool ReadScalar(const char* data, size_t size, size_t pos, T* value) {
+  if (pos > size || sizeof(T) > size - pos) return false;
+  memcpy(value, data + pos, sizeof(T));
+  return true;
+}
+
+// Minimal read-only accessor for the tables of a FlatBuffers buffer, which is
+// all that is needed to read the metadata of Arrow IPC files. All accesses are
+// checked against the bounds of the buffer.
+class FlatTable {
+ public:
+  FlatTable() = default;
+
+  // Reads the root table of the buffer in [data, data + size).
+  static Status Root(const char* data, size_t size, FlatTable* root) {
+    uint32 offset;
+    if (!ReadScalar(data, size, 0, &offset)) return Malformed();
+    return At(data, size, offset, root);
+  }
+
+  bool Has(int field) const { return FieldOffset(field) != 0; }
+
+  template <typename T>
+  T Scalar(int field, T default_value) const {
+    const size_t offset = FieldOffset(field);
+    T value;
+    if (offset == 0 || !ReadScalar(data_, size_, pos_ + offset, &value))
+      return default_value;
+    return value;
+  }
+
+  Status Table(int field, FlatTable* table) const {
+    size_t pos;
+    TF_RETURN_IF_ERROR(Reference(field, &pos));
+    return At(data_, size_, pos, table);
+  }
+
+  // Returns the position of the first element and the length of the vector
+  // referenced by "field", which is empty if "field" is absent.
+  Status Vector(int field, size_t* pos, uint32* length) const {
+    *length = 0;
+    if (!Has(field)) return Status::OK();
+    size_t reference;
+    TF_RETURN_IF_ERROR(Reference(field, &reference));
+    if (!ReadScalar(data_, size_, reference, length)) return Malformed();
+    *pos = reference + sizeof(uint32);
+    return Status::OK();
+  }
+
+  Status String(int field, string* value) const {
+    size_t pos;
+    uint32 length;
+    TF_RETURN_IF_ERROR(Vector(field, &pos, &length));
+    if (length > 0 && (pos > size_ || length > size_ - pos))
+      return Malformed();
+    value->assign(length > 0 ? data_ + pos : "", length);
+    return Status::OK();
+  }
+
+  // Reads the "index"-th table of the vector of tables starting at "pos".
+  Status VectorTable(size_t pos, uint32 index, FlatTable* table) const {
+    const size_t element = pos + sizeof(uint32) * index;
+    uint32 offset;
+    if (!ReadScalar(data_, size_, element, &offset)) return Malformed();
+    return At(data_, size_, element + offset, table);
+  }
+
+  // Returns a pointer to the "index"-th struct of "struct_size" bytes of the
+  // vector of structs starting at "pos".
+  Status VectorStruct(size_t pos, uint32 index, size_t struct_size,
+                      const char** value) const {
+    const size_t element = pos + struct_size * index;
+    if (element > size_ || struct_size > size_ - element) return Malformed();
+    *value = data_ + element;
+    return Status::OK();
+  }
+
+ private:
+  FlatTable(const char* data, size_t size, size_t pos, size_t vtable,
+            uint16 vtable_size)
+      : data_(data),
+        size_(size),
+        pos_(pos),
+        vtable_(vtable),
+        vtable_size_(vtable_size) {}
+
+  static Status At(const char* data, size_t size, size_t pos,
+                   FlatTable* table) {
+    int32 vtable_offset;
+    if (!ReadScalar(data, size, pos, &vtable_offset)) return Malformed();
+    const int64 vtable = static_cast<int64>(pos) - vtable_offset;
+    uint16 vtable_size;
+    if (vtable < 0 || !ReadScalar(data, size, vtable, &vtable_size) ||
+        vtable + vtable_size > static_cast<int64>(size))
+      return Malformed();
+    *table = FlatTable(data, size, pos, static_cast<size_t>(vtable),
+                       vtable_size);
+    return Status::OK();
+  }
+
+  size_t FieldOffset(int field) const {
+    const size_t entry = 2 * sizeof(uint16) + sizeof(uint16) * field;
+    uint16 offset = 0;
+    if (entry + sizeof(uint16) > vtable_size_) return 0;
+    ReadScalar(data_, size_, vtable_ + entry, &offset);
+    return offset;
+  }
+
+  Status Reference(int field, size_t* pos) const {
+    const size_t offset = FieldOffset(field);
+    uint32 reference;
+    if (offset == 0 || !ReadScalar(data_, size_, pos_ + offset, &reference))
+      return Malformed();
+    *pos = pos_ + offset + reference;
+    return Status::OK();
+  }
+
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  size_t pos_ = 0;
+  size_t vtable_ = 0;
+  size_t vtable_size_ = 0;
+};
+
+// Counts the field nodes and buffers of "field" and of all of its children.
+Status CountNodesAndBuffers(const FlatTable& field, int64* num_nodes,
+                            int64* num_buffers) {
+  ++*num_nodes;
+  // Dictionary-encoded fields only store their indices in record batches.
+  if (field.Has(4)) {
+    *num_buffers += 2;
+    return Status::OK();
+  }
+  switch (field.Scalar<uint8>(2, 0)) {
+    case kArrowNull:
+    case kArrowRunEndEncoded:
+      break;
+    case kArrowStruct:
+    case kArrowFixedSizeList:
+      *num_buffers += 1;
+      break;
+    case kArrowBinary:
+    case kArrowUtf8:
+    case kArrowLargeBinary:
+    case kArrowLargeUtf8:
+      *num_buffers += 3;
+      break;
+    case kArrowListView:
+    case kArrowLargeListView:
+      *num_buffers += 3;
+      break;
+    case kArrowUnion: {
+      // Sparse unions only store their type identifiers, and dense unions
+      // also store value offsets.
+      FlatTable type;
+      TF_RETURN_IF_ERROR(field.Table(3, &type));
+      *num_buffers += type.Scalar<int16>(0, 0) == 0 ? 1 : 2;
+      break;
+    }
+    case kArrowBinaryView:
+    case kArrowUtf8View:
+      return errors::Unimplemented("View columns are not supported.");
+    default:
+      *num_buffers += 2;
+  }
+  size_t children;
+  uint32 num_children;
+  TF_RETURN_IF_ERROR(field.Vector(5, &children, &num_children));
+  for (uint32 i = 0; i < num_children; ++i) {
+    FlatTable child;
+    TF_RETURN_IF_ERROR(field.VectorTable(children, i, &child));
+    TF_RETURN_IF_ERROR(CountNodesAndBuffers(child, num_nodes, num_buffers));
+  }
+  return Status::OK();
+}
+
+// Resolves the data type and value width of a top-level field.
+Status ResolveType(const FlatTable& field, const string& name,
+                   TF_DataType* dtype, int* width, bool* is_signed) {
+  *is_signed = true;
+  if (field.Has(4))
+    return errors::Unimplemented("Dictionary-encoded column '", name,
+                                 "' is not supported.");
+  const uint8 type = field.Scalar<uint8>(2, 0);
+  FlatTable type_table;
+  if (type == kArrowInt || type == kArrowFloatingPoint)
+    TF_RETURN_IF_ERROR(field.Table(3, &type_table));
+  switch (type) {
+    case kArrowInt: {
+      const int32 bit_width = type_table.Scalar<int32>(0, 0);
+      *is_signed = type_table.Scalar<uint8>(1, 0) != 0;
+      *width = bit_width / 8;
+      if (*is_signed && bit_width == 8) *dtype = TF_INT8;
+      else if (*is_signed && bit_width == 16) *dtype = TF_INT16;
+      else if (*is_signed && bit_width == 32) *dtype = TF_INT32;
+      else if (*is_signed && bit_width == 64) *dtype = TF_INT64;
+      else if (!*is_signed && bit_width == 8) *dtype = TF_UINT8;
+      else if (!*is_signed && bit_width == 16) *dtype = TF_UINT16;
+      else
+        return errors::Unimplemented(
+            "Integer column '", name, "' with ", bit_width, "-bit ",
+            *is_signed ? "signed" : "unsigned", " values is not supported.");
+      return Status::OK();
+    }
+    case kArrowFloatingPoint: {
+      const int16 precision = type_table.Scalar<int16>(0, 0);
+      if (precision == 0) {
+        *dtype = TF_HALF;
+        *width = 2;
+      } else if (precision == 1) {
+        *dtype = TF_FLOAT;
+        *width = 4;
+      } else {
+        *dtype = TF_DOUBLE;
+        *width = 8;
+      }
+      return Status::OK();
+    }
+    case kArrowBool:
+      *dtype = TF_BOOL;
+      *width = 0;
+      return Status::OK();
+    case kArrowBinary:
+    case kArrowUtf8:
+      *dtype = TF_STRING;
+      *width = 4;
+      return Status::OK();
+    case kArrowLargeBinary:
+    case kArrowLargeUtf8:
+      *dtype = TF_STRING;
+      *width = 8;
+      return Status::OK();
+    default:
+      return errors::Unimplemented("Column '", name, "' has unsupported type ",
+                                   static_cast<int>(type), ".");
+  }
+}
+
+inline bool IsValid(const char* bitmap, int64 row) {
+  return bitmap == nullptr || ((bitmap[row >> 3] >> (row & 7)) & 1) != 0;
+}
+
+void DeleteFileReference(void* data, size_t length, void* arg) {
+  delete static_cast<std::shared_ptr<ReadOnlyMemoryRegion>*>(arg);
+}
+
+}  // namespace
+
+ArrowReader* ArrowReader::New(
+    const string& filename, const std::vector<string>& columns,
+    const std::vector<ArrowRangePredicate>& predicates, TF_Status* out_status) {
+  std::unique_ptr<ArrowReader> reader(new ArrowReader());
+  std::unique_ptr<ReadOnlyMemoryRegion> file;
+  Status status =
+      Env::Default()->NewReadOnlyMemoryRegionFromFile(filename, &file);
+  if (status.ok()) {
+    reader->file_.reset(file.release());
+    status = reader->Open(columns, predicates);
+  }
+  if (!status.ok()) {
+    errors::AppendToMessage(&status, "While reading Arrow file '", filename,
+                            "'.");
+    Set_TF_Status_from_Status(out_status, status);
+    return nullptr;
+  }
+  return reader.release();
+}
+
+ArrowReader::~ArrowReader() {}
+
+Status ArrowReader::Open(const std::vector<string>& columns,
+                         const std::vector<ArrowRangePredicate>& predicates) {
+  if (columns.empty())
+    return errors::InvalidArgument("At least one column must be projected.");
+  const char* data = static_cast<const char*>(file_->data());
+  const size_t size = static_cast<size_t>(file_->length());
+  if (size < 2 * kArrowMagicSize + sizeof(int32) ||
+      memcmp(data, kArrowMagic, kArrowMagicSize) != 0 ||
+      memcmp(data + size - kArrowMagicSize, kArrowMagic, kArrowMagicSize) != 0)
+    return errors::InvalidArgument("Not an Arrow IPC file.");
+
+  // The footer is followed by its length and by the trailing magic bytes.
+  const size_t footer_end = size - kArrowMagicSize - sizeof(int32);
+  int32 footer_length;
+  ReadScalar(data, size, footer_end, &footer_length);
+  if (footer_length <= 0 || static_cast<size_t>(footer_length) > footer_end)
+    return Malformed();
+  const char* footer_data = data + footer_end - footer_length;
+  FlatTable footer;
+  TF_RETURN_IF_ERROR(FlatTable::Root(footer_data, footer_length, &footer));
+  FlatTable schema;
+  TF_RETURN_IF_ERROR(footer.Table(1, &schema));
+  if (schema.Scalar<int16>(0, 0) != 0)
+    return errors::Unimplemented("Big-endian Arrow files are not supported.");
+
+  // Resolves the decoded columns, which are the projected columns followed by
+  // any other columns referenced by predicates.
+  size_t fields;
+  uint32 num_fields;
+  TF_RETURN_IF_ERROR(schema.Vector(1, &fields, &num_fields));
+  std::unordered_map<string, Column> schema_columns;
+  int64 num_nodes = 0;
+  int64 num_buffers = 0;
+  for (uint32 i = 0; i < num_fields; ++i) {
+    FlatTable field;
+    TF_RETURN_IF_ERROR(schema.VectorTable(fields, i, &field));
+    Column column;
+    TF_RETURN_IF_ERROR(field.String(0, &column.name));
+    column.node = num_nodes;
+    column.buffer = num_buffers;
+    TF_RETURN_IF_ERROR(CountNodesAndBuffers(field, &num_nodes, &num_buffers));
+    // Unsupported columns only fail if they are decoded.
+    column.dtype = static_cast<TF_DataType>(0);
+    Status type_status = ResolveType(field, column.name, &column.dtype,
+                                     &column.width, &column.is_signed);
+    if (!type_status.ok()) column.width = -1;
+    schema_columns.emplace(column.name, column);
+  }
+  auto add_column = [this, &schema_columns](const string& name,
+                                            int* index) -> Status {
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      if (columns_[i].name == name) {
+        *index = static_cast<int>(i);
+        return Status::OK();
+      }
+    }
+    auto it = schema_columns.find(name);
+    if (it == schema_columns.end())
+      return errors::NotFound("Column '", name, "' does not exist.");
+    if (it->second.width < 0)
+      return errors::Unimplemented("Column '", name,
+                                   "' has an unsupported type.");
+    *index = static_cast<int>(columns_.size());
+    columns_.push_back(it->second);
+    return Status::OK();
+  };
+  for (const string& name : columns) {
+    int index;
+    TF_RETURN_IF_ERROR(add_column(name, &index));
+    if (index < num_projected_)
+      return errors::InvalidArgument("Column '", name, "' is repeated.");
+    ++num_projected_;
+  }
+  for (const ArrowRangePredicate& predicate : predicates) {
+    int index;
+    TF_RETURN_IF_ERROR(add_column(predicate.column, &index));
+    if (columns_[index].dtype == TF_STRING || columns_[index].dtype == TF_HALF)
+      return errors::InvalidArgument("Predicate column '", predicate.column,
+                                     "' is not numeric.");
+    predicates_.emplace_back(index, predicate);
+  }
+
+  // Reads the metadata of all record batches.
+  size_t blocks;
+  uint32 num_blocks;
+  TF_RETURN_IF_ERROR(footer.Vector(3, &blocks, &num_blocks));
+  for (uint32 b = 0; b < num_blocks; ++b) {
+    const char* block;
+    TF_RETURN_IF_ERROR(footer.VectorStruct(blocks, b, kBlockSize, &block));
+    int64 offset;
+    int32 metadata_length;
+    memcpy(&offset, block, sizeof(offset));
+    memcpy(&metadata_length, block + 8, sizeof(metadata_length));
+    if (offset < 0 || metadata_length < 0 ||
+        static_cast<uint64>(offset) + metadata_length > size)
+      return Malformed();
+    // Messages start with an optional continuation marker and their length.
+    size_t message_pos = static_cast<size_t>(offset);
+    int32 prefix;
+    if (!ReadScalar(data, size, message_pos, &prefix)) return Malformed();
+    message_pos += sizeof(int32);
+    if (prefix == -1) {
+      if (!ReadScalar(data, size, message_pos, &prefix)) return Malformed();
+      message_pos += sizeof(int32);
+    }
+    if (prefix <= 0 || message_pos + prefix > size) return Malformed();
+    FlatTable message;
+    TF_RETURN_IF_ERROR(FlatTable::Root(data + message_pos, prefix, &message));
+    if (message.Scalar<uint8>(1, 0) != kArrowRecordBatch) return Malformed();
+    FlatTable header;
+    TF_RETURN_IF_ERROR(message.Table(2, &header));
+    if (header.Has(3))
+      return errors::Unimplemented(
+          "Compressed Arrow record batches are not supported.");
+    const uint64 body = static_cast<uint64>(offset) + metadata_length;
+
+    RecordBatch record_batch;
+    record_batch.length = header.Scalar<int64>(0, 0);
+    if (record_batch.length < 0) return Malformed();
+    size_t nodes;
+    uint32 batch_num_nodes;
+    TF_RETURN_IF_ERROR(header.Vector(1, &nodes, &batch_num_nodes));
+    size_t buffers;
+    uint32 batch_num_buffers;
+    TF_RETURN_IF_ERROR(header.Vector(2, &buffers, &batch_num_buffers));
+    if (batch_num_nodes != num_nodes || batch_num_buffers != num_buffers)
+      return Malformed();
+    for (const Column& column : columns_) {
+      Chunk chunk;
+      const char* node;
+      TF_RETURN_IF_ERROR(
+          header.VectorStruct(nodes, column.node, kFieldNodeSize, &node));
+      memcpy(&chunk.null_count, node + 8, sizeof(chunk.null_count));
+      const int num_column_buffers = column.dtype == TF_STRING ? 3 : 2;
+      for (int i = 0; i < num_column_buffers; ++i) {
+        const char* buffer;
+        TF_RETURN_IF_ERROR(header.VectorStruct(buffers, column.buffer + i,
+                                               kBufferSize, &buffer));
+        int64 buffer_offset;
+        int64 buffer_length;
+        memcpy(&buffer_offset, buffer, sizeof(buffer_offset));
+        memcpy(&buffer_length, buffer + 8, sizeof(buffer_length));
+        if (buffer_offset < 0 || buffer_length < 0 ||
+            body + buffer_offset + buffer_length > size)
+          return Malformed();
+        chunk.buffers[i].offset = body + buffer_offset;
+        chunk.buffers[i].length = static_cast<uint64>(buffer_length);
+      }
+      // Checks that the buffers are large enough for the record batch length.
+      const uint64 length = static_cast<uint64>(record_batch.length);
+      const uint64 bitmap_length = (length + 7) / 8;
+      uint64 values_length = column.width * length;
+      if (column.dtype == TF_BOOL) values_length = bitmap_length;
+      if (column.dtype == TF_STRING)
+        values_length = column.width * (length + 1);
+      if ((chunk.null_count > 0 && chunk.buffers[0].length < bitmap_length) ||
+          (length > 0 && chunk.buffers[1].length < values_length))
+        return errors::DataLoss("The buffers of column '", column.name,
+                                "' are too small.");
+      record_batch.chunks.push_back(chunk);
+    }
+    record_batches_.push_back(std::move(record_batch));
+  }
+  return Status::OK();
+}
+
+int64 ArrowReader::num_rows() const {
+  int64 num_rows = 0;
+  for (const RecordBatch& record_batch : record_batches_)
+    num_rows += record_batch.length;
+  return num_rows;
+}
+
+std::vector<TF_DataType> ArrowReader::dtypes() const {
+  std::vector<TF_DataType> dtypes;
+  for (int i = 0; i < num_projected_; ++i) dtypes.push_back(columns_[i].dtype);
+  return dtypes;
+}
+
+bool ArrowReader::NumericValue(int column, const RecordBatch& batch, int64 row,
+                               double* value) const {
+  const Column& c = columns_[column];
+  const Chunk& chunk = batch.chunks[column];
+  const char* base = static_cast<const char*>(file_->data());
+  const char* bitmap =
+      chunk.null_count > 0 ? base + chunk.buffers[0].offset : nullptr;
+  if (!IsValid(bitmap, row)) return false;
+  const char* values = base + chunk.buffers[1].offset;
+  switch (c.dtype) {
+    case TF_BOOL:
+      *value = IsValid(values, row) ? 1.0 : 0.0;
+      return true;
+#define ARROW_NUMERIC_VALUE(tf_type, type)           \
+  case tf_type: {                                    \
+    type v;                                          \
+    memcpy(&v, values + row * sizeof(v), sizeof(v)); \
+    *value = static_cast<double>(v);                 \
+    return true;                                     \
+  }
+    ARROW_NUMERIC_VALUE(TF_INT8, int8)
+    ARROW_NUMERIC_VALUE(TF_INT16, int16)
+    ARROW_NUMERIC_VALUE(TF_INT32, int32)
+    ARROW_NUMERIC_VALUE(TF_INT64, int64)
+    ARROW_NUMERIC_VALUE(TF_UINT8, uint8)
+    ARROW_NUMERIC_VALUE(TF_UINT16, uint16)
+    ARROW_NUMERIC_VALUE(TF_FLOAT, float)
+    ARROW_NUMERIC_VALUE(TF_DOUBLE, double)
+#undef ARROW_NUMERIC_VALUE
+    default:
+      return false;
+  }
+}
+
+Status ArrowReader::Decode(int column, const RecordBatch& batch,
+                           const std::vector<int64>* rows,
+                           TF_Tensor** tensor) const {
+  const Column& c = columns_[column];
+  const Chunk& chunk = batch.chunks[column];
+  const char* base = static_cast<const char*>(file_->data());
+  const char* bitmap =
+      chunk.null_count > 0 ? base + chunk.buffers[0].offset : nullptr;
+  const char* values = base + chunk.buffers[1].offset;
+  const int64_t num_rows = rows != nullptr ? rows->size() : batch.length;
+  auto row_at = [rows](int64 i) { return rows != nullptr ? (*rows)[i] : i; };
+
+  if (c.dtype == TF_STRING) {
+    // Value "i" spans [offsets[i], offsets[i + 1]) of the data buffer.
+    const char* string_data = base + chunk.buffers[2].offset;
+    std::vector<std::pair<uint64, uint64>> ranges(num_rows, {0, 0});
+    size_t size = num_rows * sizeof(uint64);
+    for (int64 i = 0; i < num_rows; ++i) {
+      const int64 row = row_at(i);
+      if (!IsValid(bitmap, row)) {
+        size += TF_StringEncodedSize(0);
+        continue;
+      }
+      uint64 start = 0;
+      uint64 end = 0;
+      if (c.width == 4) {
+        int32 offsets[2];
+        memcpy(offsets, values + row * sizeof(int32), sizeof(offsets));
+        if (offsets[0] < 0 || offsets[1] < offsets[0]) return Malformed();
+        start = offsets[0];
+        end = offsets[1];
+      } else {
+        int64 offsets[2];
+        memcpy(offsets, values + row * sizeof(int64), sizeof(offsets));
+        if (offsets[0] < 0 || offsets[1] < offsets[0]) return Malformed();
+        start = offsets[0];
+        end = offsets[1];
+      }
+      if (end > chunk.buffers[2].length)
+        return errors::DataLoss("The values of column '", c.name,
+                                "' are out of bounds.");
+      ranges[i] = {start, end};
+      size += TF_StringEncodedSize(end - start);
+    }
+    *tensor = TF_AllocateTensor(TF_STRING, &num_rows, 1, size);
+    char* data = static_cast<char*>(TF_TensorData(*tensor));
+    uint64* offsets = reinterpret_cast<uint64*>(data);
+    char* encoded = data + num_rows * sizeof(uint64);
+    char* dst = encoded;
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(
+        TF_NewStatus(), TF_DeleteStatus);
+    for (int64 i = 0; i < num_rows; ++i) {
+      offsets[i] = static_cast<uint64>(dst - encoded);
+      dst += TF_StringEncode(string_data + ranges[i].first,
+                             ranges[i].second - ranges[i].first, dst,
+                             data + size - dst, status.get());
+      if (TF_GetCode(status.get()) != TF_OK) {
+        TF_DeleteTensor(*tensor);
+        *tensor = nullptr;
+        return errors::Internal(TF_Message(status.get()));
+      }
+    }
+    return Status::OK();
+  }
+
+  if (c.dtype == TF_BOOL) {
+    *tensor = TF_AllocateTensor(TF_BOOL, &num_rows, 1, num_rows);
+    char* data = static_cast<char*>(TF_TensorData(*tensor));
+    for (int64 i = 0; i < num_rows; ++i) {
+      const int64 row = row_at(i);
+      data[i] = IsValid(bitmap, row) && IsValid(values, row) ? 1 : 0;
+    }
+    return Status::OK();
+  }
+
+  const size_t length = static_cast<size_t>(num_rows) * c.width;
+  if (rows == nullptr && bitmap == nullptr && length > 0 &&
+      reinterpret_cast<uintptr_t>(values) % Allocator::kAllocatorAlignment ==
+          0) {
+    // Kernels may assume that the tensor buffers are aligned, and so only
+    // aligned buffers are returned without being copied.
+    *tensor = TF_NewTensor(c.dtype, &num_rows, 1, const_cast<char*>(values),
+                           length, DeleteFileReference,
+                           new std::shared_ptr<ReadOnlyMemoryRegion>(file_));
+    return Status::OK();
+  }
+  *tensor = TF_AllocateTensor(c.dtype, &num_rows, 1, length);
+  char* data = static_cast<char*>(TF_TensorData(*tensor));
+  if (rows == nullptr && bitmap == nullptr) {
+    memcpy(data, values, length);
+    return Status::OK();
+  }
+  for (int64 i = 0; i < num_rows; ++i) {
+    const int64 row = row_at(i);
+    if (IsValid(bitmap, row))
+      memcpy(data + i * c.width, values + row * c.width, c.width);
+    else
+      memset(data + i * c.width, 0, c.width);
+  }
+  return Status::OK();
+}
+
+void ArrowReader::ReadRecordBatch(int64 index, std::vector<TF_Tensor*>* batch,
+                                  TF_Status* status) const {
+  batch->clear();
+  if (index < 0 || index >= num_record_batches()) {
+    Set_TF_Status_from_Status(
+        status, errors::OutOfRange("Record batch index ", index,
+                                   " is out of range for an Arrow file with ",
+                                   num_record_batches(), " record batches."));
+    return;
+  }
+  const RecordBatch& record_batch = record_batches_[index];
+  // The predicates are evaluated first, so that other columns are only
+  // decoded for the selected rows.
+  std::vector<int64> rows;
+  if (!predicates_.empty()) {
+    for (int64 row = 0; row < record_batch.length; ++row) {
+      bool selected = true;
+      for (const auto& predicate : predicates_) {
+        double value;
+        if (!NumericValue(predicate.first, record_batch, row, &value) ||
+            value < predicate.second.min || value > predicate.second.max) {
+          selected = false;
+          break;
+        }
+      }
+      if (selected) rows.push_back(row);
+    }
+    if (rows.empty()) return;
+  }
+  for (int c = 0; c < num_projected_; ++c) {
+    TF_Tensor* tensor = nullptr;
+    Status s = Decode(c, record_batch, predicates_.empty() ? nullptr : &rows,
+                      &tensor);
+    if (!s.ok()) {
+      for (TF_Tensor* t : *batch) TF_DeleteTensor(t);
+      batch->clear();
+      Set_TF_Status_from_Status(status, s);
+      return;
+    }
+    batch->push_back(tensor);
+  }
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,148 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_ARROW_READER_H_
+#define TENSORFLOW_C_ARROW_READER_H_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+class ReadOnlyMemoryRegion;
+
+// Row filter that keeps the rows whose value in a numeric column lies in
+// [min, max]. Rows with null values in that column are dropped.
+struct ArrowRangePredicate {
+  string column;
+  double min;
+  double max;
+};
+
+// Reads Arrow IPC files (i.e., Feather V2 files) by memory-mapping them and
+// decoding a projection of their top-level columns into one tensor per column
+// and record batch. The file metadata is parsed directly, without depending on
+// the Arrow or FlatBuffers libraries.
+//
+// Only the buffers of the projected columns and of the columns referenced by
+// predicates are ever touched. When no predicates are provided, fixed-width
+// columns without null values are returned as slices of the mapping, whenever
+// their start is suitably aligned, in which case no data is copied and the
+// mapping is kept alive for as long as any such tensor exists. The contents of
+// such tensors are read-only and must never be modified in place. Otherwise,
+// the rows that satisfy all predicates are gathered directly into the output
+// tensors.
+//
+// Supported column types are signed integers, 8-bit and 16-bit unsigned
+// integers, floating-point numbers, booleans, and (large) UTF-8 strings and
+// binary values. Null values are decoded as zeros or empty strings.
+// Compressed record batches are not supported. An instance of this class is
+// safe for concurrent access by multiple threads.
+class ArrowReader {
+ public:
+  static ArrowReader* New(const string& filename,
+                          const std::vector<string>& columns,
+                          const std::vector<ArrowRangePredicate>& predicates,
+                          TF_Status* out_status);
+
+  ~ArrowReader();
+
+  int64 num_record_batches() const {
+    return static_cast<int64>(record_batches_.size());
+  }
+
+  // Returns the total number of rows, before any predicates are applied.
+  int64 num_rows() const;
+
+  // Returns the data types of the projected columns.
+  std::vector<TF_DataType> dtypes() const;
+
+  // Returns the tensors of the projected columns for the rows of the
+  // "index"-th record batch that satisfy all predicates, which are then owned
+  // by the caller. Returns an empty batch if no rows satisfy them.
+  void ReadRecordBatch(int64 index, std::vector<TF_Tensor*>* batch,
+                       TF_Status* status) const;
+
+ private:
+  // Location of a buffer in the file.
+  struct Buffer {
+    uint64 offset = 0;
+    uint64 length = 0;
+  };
+
+  // Buffers of a column in a record batch. These are the validity bitmap, the
+  // values for fixed-width columns or the value offsets for variable-width
+  // columns, and the data of variable-width columns.
+  struct Chunk {
+    int64 null_count = 0;
+    Buffer buffers[3];
+  };
+
+  struct RecordBatch {
+    int64 length = 0;
+    // Chunks of the decoded columns, in the order of "columns_".
+    std::vector<Chunk> chunks;
+  };
+
+  // Top-level column that is decoded, because it is either projected or
+  // referenced by a predicate.
+  struct Column {
+    string name;
+    TF_DataType dtype;
+    // Width of each value in bytes, or of each value offset for
+    // variable-width columns. Zero for boolean columns.
+    int width;
+    bool is_signed;
+    // Flattened indices of the column's first field node and buffer in the
+    // record batches.
+    int64 node;
+    int64 buffer;
+  };
+
+  ArrowReader() = default;
+
+  // Parses the footer and the metadata of all record batches.
+  Status Open(const std::vector<string>& columns,
+              const std::vector<ArrowRangePredicate>& predicates);
+
+  // Returns the value of row "row" of the "column"-th decoded column, which
+  // must be numeric, and whether that value is valid (i.e., not null).
+  bool NumericValue(int column, const RecordBatch& batch, int64 row,
+                    double* value) const;
+
+  // Decodes the "column"-th decoded column of "batch" into a tensor, for the
+  // rows in "rows", or for all rows if "rows" is null.
+  Status Decode(int column, const RecordBatch& batch,
+                const std::vector<int64>* rows, TF_Tensor** tensor) const;
+
+  std::shared_ptr<ReadOnlyMemoryRegion> file_;
+  std::vector<Column> columns_;
+  // Number of leading entries of "columns_" that are projected.
+  int num_projected_ = 0;
+  // Predicates, with their columns resolved to indices into "columns_".
+  std::vector<std::pair<int, ArrowRangePredicate>> predicates_;
+  std::vector<RecordBatch> record_batches_;
+  TF_DISALLOW_COPY_AND_ASSIGN(ArrowReader);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_ARROW_READER_H_
@@ -0,0 +1,252 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/async_eager_executor.h"
+
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+
+namespace tensorflow {
+
+namespace {
+
+struct PendingTensorHandle {
+  string device_name;
+  bool done = false;
+  Status status;
+};
+
+// Handles that are pending, or whose operations failed, across all contexts.
+struct PendingTensorHandles {
+  mutex mu;
+  condition_variable cv;
+  std::unordered_map<TFE_TensorHandle*, PendingTensorHandle> handles
+      GUARDED_BY(mu);
+  // Number of entries in "handles", which is read without holding "mu", so
+  // that handles are not looked up at all when no handles are pending.
+  std::atomic<int64> size{0};
+};
+
+PendingTensorHandles* GetPendingTensorHandles() {
+  static PendingTensorHandles* pending = new PendingTensorHandles();
+  return pending;
+}
+
+// Executors of a context that is shared by many threads, one per thread.
+struct PerThreadAsyncEagerExecutors {
+  std::vector<string> device_names;
+  std::unordered_map<std::thread::id, std::unique_ptr<AsyncEagerExecutor>>
+      executors;
+};
+
+struct AsyncEagerExecutors {
+  mutex mu;
+  std::unordered_map<TFE_Context*, std::unique_ptr<AsyncEagerExecutor>>
+      executors GUARDED_BY(mu);
+  std::unordered_map<TFE_Context*, PerThreadAsyncEagerExecutors>
+      per_thread_executors GUARDED_BY(mu);
+};
+
+AsyncEagerExecutors* GetAsyncEagerExecutors() {
+  static AsyncEagerExecutors* executors = new AsyncEagerExecutors();
+  return executors;
+}
+
+// Marks "handle" as not pending anymore. The status of failed operations is
+// kept until the handle is forgotten, so that it can be reported when the
+// handle is used.
+void CompleteTensorHandle(TFE_TensorHandle* handle, const Status& status) {
+  PendingTensorHandles* pending = GetPendingTensorHandles();
+  {
+    mutex_lock l(pending->mu);
+    if (status.ok()) {
+      pending->handles.erase(handle);
+      pending->size.store(pending->handles.size(), std::memory_order_release);
+    } else {
+      PendingTensorHandle& entry = pending->handles[handle];
+      entry.done = true;
+      entry.status = status;
+    }
+  }
+  pending->cv.notify_all();
+}
+
+}  // namespace
+
+AsyncEagerExecutor::AsyncEagerExecutor(std::vector<string> device_names)
+    : device_names_(std::move(device_names)) {
+  thread_.reset(Env::Default()->StartThread(
+      ThreadOptions(), "async_eager_executor", [this]() { Run(); }));
+}
+
+AsyncEagerExecutor::~AsyncEagerExecutor() {
+  {
+    mutex_lock l(mu_);
+    stopping_ = true;
+  }
+  cv_.notify_all();
+  // The thread runs all enqueued operations before exiting.
+  thread_.reset();
+}
+
+void AsyncEagerExecutor::Enqueue(TFE_TensorHandle* output,
+                                 const string& device_name,
+                                 std::function<Status()> fn) {
+  PendingTensorHandles* pending = GetPendingTensorHandles();
+  {
+    mutex_lock l(pending->mu);
+    PendingTensorHandle& entry = pending->handles[output];
+    entry.device_name = device_name;
+    pending->size.store(pending->handles.size(), std::memory_order_release);
+  }
+  {
+    mutex_lock l(mu_);
+    ++num_pending_;
+    queue_.push_back([this, output, fn]() {
+      const Status s = fn();
+      CompleteTensorHandle(output, s);
+      {
+        mutex_lock l(mu_);
+        if (!s.ok() && status_.ok()) status_ = s;
+        --num_pending_;
+      }
+      cv_.notify_all();
+    });
+  }
+  cv_.notify_all();
+}
+
+Status AsyncEagerExecutor::Sync() {
+  mutex_lock l(mu_);
+  while (num_pending_ > 0) cv_.wait(l);
+  Status s = status_;
+  status_ = Status::OK();
+  return s;
+}
+
+string AsyncEagerExecutor::FullDeviceName(const string& name) const {
+  for (const string& device_name : device_names_) {
+    const StringPiece full_name(device_name);
+    if (device_name == name ||
+        full_name.ends_with(strings::StrCat("/device:", name)) ||
+        full_name.ends_with(strings::StrCat("/", name))) {
+      return device_name;
+    }
+  }
+  return "";
+}
+
+void AsyncEagerExecutor::Run() {
+  while (true) {
+    std::function<void()> fn;
+    {
+      mutex_lock l(mu_);
+      while (queue_.empty() && !stopping_) cv_.wait(l);
+      if (queue_.empty()) return;
+      fn = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    fn();
+  }
+}
+
+void AsyncEagerExecutor::Register(TFE_Context* context,
+                                  AsyncEagerExecutor* executor) {
+  AsyncEagerExecutors* executors = GetAsyncEagerExecutors();
+  mutex_lock l(executors->mu);
+  executors->executors[context].reset(executor);
+}
+
+void AsyncEagerExecutor::RegisterPerThread(TFE_Context* context,
+                                           std::vector<string> device_names) {
+  AsyncEagerExecutors* executors = GetAsyncEagerExecutors();
+  mutex_lock l(executors->mu);
+  PerThreadAsyncEagerExecutors& per_thread =
+      executors->per_thread_executors[context];
+  per_thread.device_names = std::move(device_names);
+  per_thread.executors.clear();
+}
+
+AsyncEagerExecutor* AsyncEagerExecutor::ForContext(TFE_Context* context) {
+  AsyncEagerExecutors* executors = GetAsyncEagerExecutors();
+  mutex_lock l(executors->mu);
+  auto it = executors->executors.find(context);
+  if (it != executors->executors.end()) return it->second.get();
+  auto per_thread_it = executors->per_thread_executors.find(context);
+  if (per_thread_it == executors->per_thread_executors.end()) return nullptr;
+  PerThreadAsyncEagerExecutors& per_thread = per_thread_it->second;
+  std::unique_ptr<AsyncEagerExecutor>& executor =
+      per_thread.executors[std::this_thread::get_id()];
+  if (executor == nullptr)
+    executor.reset(new AsyncEagerExecutor(per_thread.device_names));
+  return executor.get();
+}
+
+void AsyncEagerExecutor::Unregister(TFE_Context* context) {
+  std::vector<std::unique_ptr<AsyncEagerExecutor>> to_delete;
+  {
+    AsyncEagerExecutors* executors = GetAsyncEagerExecutors();
+    mutex_lock l(executors->mu);
+    auto it = executors->executors.find(context);
+    if (it != executors->executors.end()) {
+      to_delete.push_back(std::move(it->second));
+      executors->executors.erase(it);
+    }
+    auto per_thread_it = executors->per_thread_executors.find(context);
+    if (per_thread_it != executors->per_thread_executors.end()) {
+      for (auto& executor : per_thread_it->second.executors)
+        to_delete.push_back(std::move(executor.second));
+      executors->per_thread_executors.erase(per_thread_it);
+    }
+  }
+  for (const auto& executor : to_delete) executor->Sync().IgnoreError();
+}
+
+Status AwaitTensorHandle(TFE_TensorHandle* handle) {
+  PendingTensorHandles* pending = GetPendingTensorHandles();
+  if (pending->size.load(std::memory_order_acquire) == 0) return Status::OK();
+  mutex_lock l(pending->mu);
+  auto it = pending->handles.find(handle);
+  while (it != pending->handles.end() && !it->second.done) {
+    pending->cv.wait(l);
+    it = pending->handles.find(handle);
+  }
+  return it == pending->handles.end() ? Status::OK() : it->second.status;
+}
+
+bool PendingTensorHandleDevice(TFE_TensorHandle* handle, string* device_name) {
+  PendingTensorHandles* pending = GetPendingTensorHandles();
+  if (pending->size.load(std::memory_order_acquire) == 0) return false;
+  mutex_lock l(pending->mu);
+  auto it = pending->handles.find(handle);
+  if (it == pending->handles.end() || it->second.done) return false;
+  *device_name = it->second.device_name;
+  return true;
+}
+
+void ForgetTensorHandle(TFE_TensorHandle* handle) {
+  AwaitTensorHandle(handle).IgnoreError();
+  PendingTensorHandles* pending = GetPendingTensorHandles();
+  if (pending->size.load(std::memory_order_acquire) == 0) return;
+  mutex_lock l(pending->mu);
+  pending->handles.erase(handle);
+  pending->size.store(pending->handles.size(), std::memory_order_release);
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,111 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_ASYNC_EAGER_EXECUTOR_H_
+#define TENSORFLOW_C_ASYNC_EAGER_EXECUTOR_H_
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Executes the blocking operations of an asynchronous eager context (i.e.,
+// copies between devices) in order, on a dedicated thread. The handles of the
+// outputs of enqueued operations are created, and can be returned, right away.
+// They have the data type and shape of their final value, but they are
+// "pending" until the operations that fill them in have run. Pending handles
+// must be waited for, using "AwaitTensorHandle", before their value is used.
+class AsyncEagerExecutor {
+ public:
+  // "device_names" are the names of the devices of the context.
+  explicit AsyncEagerExecutor(std::vector<string> device_names);
+
+  // Waits for all enqueued operations to run.
+  ~AsyncEagerExecutor();
+
+  // Enqueues "fn", which fills in "output". "output" is pending until "fn"
+  // has run and must not be deleted before then.
+  void Enqueue(TFE_TensorHandle* output, const string& device_name,
+               std::function<Status()> fn);
+
+  // Waits for all enqueued operations to run and returns the first error that
+  // any of them produced since the last call to this function.
+  Status Sync();
+
+  // Returns the full name of the context device that "name" (e.g., "GPU:0")
+  // refers to, or an empty string if there is no such device.
+  string FullDeviceName(const string& name) const;
+
+  // Registers the executor of "context", taking ownership of it.
+  static void Register(TFE_Context* context, AsyncEagerExecutor* executor);
+
+  // Registers per-thread executors for "context", which is shared by many
+  // threads (e.g., by the contexts of a context group). Each thread that uses
+  // "context" gets its own executor, created when it is first needed, so that
+  // the operations of different threads are not serialized with each other.
+  // "device_names" are the names of the devices of the context.
+  static void RegisterPerThread(TFE_Context* context,
+                                std::vector<string> device_names);
+
+  // Returns the executor of "context" (for the calling thread, if "context"
+  // has per-thread executors), or nullptr if it executes operations
+  // synchronously.
+  static AsyncEagerExecutor* ForContext(TFE_Context* context);
+
+  // Unregisters and deletes the executors of "context", if any, after waiting
+  // for all of their enqueued operations to run.
+  static void Unregister(TFE_Context* context);
+
+ private:
+  void Run();
+
+  const std::vector<string> device_names_;
+  mutex mu_;
+  condition_variable cv_;
+  std::deque<std::function<void()>> queue_ GUARDED_BY(mu_);
+  int64 num_pending_ GUARDED_BY(mu_) = 0;
+  bool stopping_ GUARDED_BY(mu_) = false;
+  Status status_ GUARDED_BY(mu_);
+  std::unique_ptr<Thread> thread_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(AsyncEagerExecutor);
+};
+
+// Blocks until "handle" is not pending anymore, if it is pending, and returns
+// the status of the operation that filled it in. This is cheap for handles
+// that were not produced asynchronously.
+Status AwaitTensorHandle(TFE_TensorHandle* handle);
+
+// Sets "device_name" to the full name of the device that "handle" will be
+// placed on and returns true, if "handle" is pending. Returns false otherwise.
+bool PendingTensorHandleDevice(TFE_TensorHandle* handle, string* device_name);
+
+// Waits for "handle", which is about to be deleted, and forgets its status.
+void ForgetTensorHandle(TFE_TensorHandle* handle);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_ASYNC_EAGER_EXECUTOR_H_
@@ -0,0 +1,140 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/async_writable_file.h"
+
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace io {
+
+namespace {
+
+// Maximum number of full buffers waiting to be written before appends block.
+constexpr size_t kMaxPendingBuffers = 4;
+
+}  // namespace
+
+AsyncWritableFile::AsyncWritableFile() {}
+
+AsyncWritableFile* AsyncWritableFile::New(const string& filename, bool append, size_t buffer_size,
+                                          TF_Status* out_status) {
+  std::unique_ptr<WritableFile> file;
+  Status s = append ? Env::Default()->NewAppendableFile(filename, &file)
+                    : Env::Default()->NewWritableFile(filename, &file);
+  if (!s.ok()) {
+    Set_TF_Status_from_Status(out_status, s);
+    return nullptr;
+  }
+  AsyncWritableFile* async_file = new AsyncWritableFile;
+  async_file->buffer_size_ = buffer_size > 0 ? buffer_size : 1;
+  async_file->buffer_.reserve(async_file->buffer_size_);
+  async_file->file_ = std::move(file);
+  async_file->write_thread_.reset(Env::Default()->StartThread(
+      ThreadOptions(), "tf_scala_async_write", [async_file]() { async_file->WriteLoop(); }));
+  return async_file;
+}
+
+AsyncWritableFile::~AsyncWritableFile() {
+  mutex_lock l(mu_);
+  Close(&l).IgnoreError();
+}
+
+void AsyncWritableFile::WriteLoop() {
+  mutex_lock l(mu_);
+  while (true) {
+    while (pending_.empty() && !closed_) cv_.wait(l);
+    if (pending_.empty()) break;
+    string buffer = std::move(pending_.front());
+    pending_.pop_front();
+    writing_ = true;
+    // Appends may be waiting for space in the queue.
+    cv_.notify_all();
+    // Once an error has occurred, the remaining buffers are discarded.
+    if (status_.ok()) {
+      mu_.unlock();
+      Status s = file_->Append(buffer);
+      mu_.lock();
+      status_.Update(s);
+    }
+    writing_ = false;
+    cv_.notify_all();
+  }
+}
+
+void AsyncWritableFile::Submit(mutex_lock* lock) {
+  if (buffer_.empty()) return;
+  while (pending_.size() >= kMaxPendingBuffers && status_.ok()) cv_.wait(*lock);
+  pending_.push_back(std::move(buffer_));
+  buffer_ = string();
+  buffer_.reserve(buffer_size_);
+  cv_.notify_all();
+}
+
+Status AsyncWritableFile::Drain(mutex_lock* lock) {
+  Submit(lock);
+  while ((!pending_.empty() || writing_) && status_.ok()) cv_.wait(*lock);
+  return status_;
+}
+
+Status AsyncWritableFile::Close(mutex_lock* lock) {
+  if (closed_) return errors::FailedPrecondition("File is closed.");
+  // Appends are rejected from this point on, while the remaining buffers are being written. The background thread
+  // exits once there are no more buffers to write.
+  closed_ = true;
+  Status s = Drain(lock);
+  cv_.notify_all();
+  // Joining the background thread requires releasing the lock, because the thread acquires it before exiting.
+  mu_.unlock();
+  write_thread_.reset();
+  mu_.lock();
+  pending_.clear();
+  Status close_status = file_->Close();
+  return s.ok() ? close_status : s;
+}
+
+void AsyncWritableFile::Append(StringPiece data, TF_Status* status) {
+  mutex_lock l(mu_);
+  Status s = closed_ ? errors::FailedPrecondition("File is closed.") : status_;
+  if (s.ok()) {
+    buffer_.append(data.data(), data.size());
+    if (buffer_.size() >= buffer_size_) Submit(&l);
+  }
+  Set_TF_Status_from_Status(status, s);
+}
+
+void AsyncWritableFile::Flush(TF_Status* status) {
+  mutex_lock l(mu_);
+  Status s = closed_ ? errors::FailedPrecondition("File is closed.") : Drain(&l);
+  if (s.ok()) s = file_->Flush();
+  Set_TF_Status_from_Status(status, s);
+}
+
+void AsyncWritableFile::Sync(TF_Status* status) {
+  mutex_lock l(mu_);
+  Status s = closed_ ? errors::FailedPrecondition("File is closed.") : Drain(&l);
+  if (s.ok()) s = file_->Sync();
+  Set_TF_Status_from_Status(status, s);
+}
+
+void AsyncWritableFile::Close(TF_Status* status) {
+  mutex_lock l(mu_);
+  Set_TF_Status_from_Status(status, Close(&l));
+}
+
+}  // namespace io
+}  // namespace tensorflow
@@ -0,0 +1,99 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LIB_IO_ASYNC_WRITABLE_FILE_H_
+#define TENSORFLOW_LIB_IO_ASYNC_WRITABLE_FILE_H_
+
+#include <deque>
+#include <memory>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+class Thread;
+class WritableFile;
+
+namespace io {
+
+// A writable file that coalesces appends into buffers of "buffer_size" bytes,
+// which are written to the underlying file by a background thread. Appends
+// only block when several buffers are already waiting to be written. The first
+// error encountered while writing is reported by all subsequent calls. An
+// instance of this class is safe for concurrent access by multiple threads.
+class AsyncWritableFile {
+ public:
+  // Creates a file for "filename", truncating it unless "append" is true.
+  static AsyncWritableFile* New(const string& filename, bool append, size_t buffer_size, TF_Status* out_status);
+
+  // Closes the file, ignoring any errors.
+  ~AsyncWritableFile();
+
+  void Append(StringPiece data, TF_Status* status);
+
+  // Waits until all appended data has been written to the file and then
+  // flushes it.
+  void Flush(TF_Status* status);
+
+  // Waits until all appended data has been written to the file and then syncs
+  // it to persistent storage.
+  void Sync(TF_Status* status);
+
+  // Waits until all appended data has been written and closes the file.
+  // Subsequent calls fail.
+  void Close(TF_Status* status);
+
+ private:
+  AsyncWritableFile();
+
+  // Body of the background write thread.
+  void WriteLoop();
+
+  // Hands the current buffer over to the background thread, waiting for space
+  // in the queue if necessary. "lock" must hold "mu_".
+  void Submit(mutex_lock* lock);
+  // Submits the current buffer and waits until all submitted buffers have been
+  // written. "lock" must hold "mu_".
+  Status Drain(mutex_lock* lock);
+  // Drains the buffers, stops the background thread, and closes the file.
+  // "lock" must hold "mu_", which is temporarily released.
+  Status Close(mutex_lock* lock);
+
+  size_t buffer_size_;
+  std::unique_ptr<WritableFile> file_;
+
+  mutex mu_;
+  condition_variable cv_;
+  string buffer_ GUARDED_BY(mu_);
+  std::deque<string> pending_ GUARDED_BY(mu_);
+  // Set while the background thread is writing a buffer it has removed from
+  // "pending_".
+  bool writing_ GUARDED_BY(mu_) = false;
+  Status status_ GUARDED_BY(mu_);
+  bool closed_ GUARDED_BY(mu_) = false;
+  std::unique_ptr<Thread> write_thread_;
+  TF_DISALLOW_COPY_AND_ASSIGN(AsyncWritableFile);
+};
+
+}  // namespace io
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_LIB_IO_ASYNC_WRITABLE_FILE_H_
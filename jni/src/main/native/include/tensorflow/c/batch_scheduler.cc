@@ -0,0 +1,281 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/batch_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Returns true if tensors of type "dtype" can be concatenated and split by
+// copying their buffers.
+bool CanBatch(TF_DataType dtype) {
+  return dtype != TF_STRING && dtype != TF_RESOURCE && dtype != TF_VARIANT;
+}
+
+std::vector<int64_t> Dims(const TF_Tensor* tensor) {
+  std::vector<int64_t> dims(static_cast<size_t>(TF_NumDims(tensor)));
+  for (size_t i = 0; i < dims.size(); ++i)
+    dims[i] = TF_Dim(tensor, static_cast<int>(i));
+  return dims;
+}
+
+Status StatusFromTFStatus(const TF_Status* status) {
+  if (TF_GetCode(status) == TF_OK) return Status::OK();
+  return Status(static_cast<error::Code>(TF_GetCode(status)),
+                TF_Message(status));
+}
+
+// Returns the bucket of the queue depth histogram for "depth".
+int QueueDepthBucket(size_t depth) {
+  int bucket = 0;
+  while (depth > 0 && bucket < BatchScheduler::kNumQueueDepthBuckets - 1) {
+    depth >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+}  // namespace
+
+constexpr int BatchScheduler::kNumQueueDepthBuckets;
+
+BatchScheduler::BatchScheduler(int num_inputs, int num_outputs,
+                               RunFunction run, int max_batch_size,
+                               int64 batch_timeout_micros, int max_queue_size,
+                               int num_batch_threads)
+    : num_inputs_(num_inputs),
+      num_outputs_(num_outputs),
+      run_(std::move(run)),
+      max_batch_size_(std::max(max_batch_size, 1)),
+      batch_timeout_micros_(std::max(batch_timeout_micros, int64{0})),
+      max_queue_size_(std::max(max_queue_size, 1)) {
+  statistics_.batch_size_histogram.resize(max_batch_size_ + 2, 0);
+  statistics_.queue_depth_histogram.resize(kNumQueueDepthBuckets, 0);
+  for (int i = 0; i < std::max(num_batch_threads, 1); ++i) {
+    batch_threads_.emplace_back(
+        Env::Default()->StartThread(ThreadOptions(), "tf_scala_batch_scheduler",
+                                    [this]() { BatchLoop(); }));
+  }
+}
+
+BatchScheduler::~BatchScheduler() {
+  {
+    mutex_lock l(mu_);
+    stopping_ = true;
+    cv_.notify_all();
+  }
+  // Deleting the threads joins them.
+  batch_threads_.clear();
+  std::deque<Request> remaining;
+  {
+    mutex_lock l(mu_);
+    remaining.swap(queue_);
+    queued_rows_ = 0;
+  }
+  const Status cancelled = errors::Cancelled(
+      "The batch scheduler was deleted before the request was run.");
+  for (Request& request : remaining) {
+    for (TF_Tensor* input : request.inputs) TF_DeleteTensor(input);
+    request.done(cancelled, {});
+  }
+}
+
+Status BatchScheduler::Schedule(std::vector<TF_Tensor*> inputs,
+                                DoneCallback done) {
+  if (static_cast<int>(inputs.size()) != num_inputs_ || num_inputs_ == 0)
+    return errors::InvalidArgument("Expected ", num_inputs_,
+                                   " inputs, but got ", inputs.size(), ".");
+  const int64 num_rows = TF_NumDims(inputs[0]) > 0 ? TF_Dim(inputs[0], 0) : 0;
+  for (TF_Tensor* input : inputs) {
+    if (TF_NumDims(input) == 0 || TF_Dim(input, 0) != num_rows || num_rows == 0)
+      return errors::InvalidArgument(
+          "All inputs of a batched request must have the same non-zero "
+          "leading dimension size.");
+    if (!CanBatch(TF_TensorType(input)))
+      return errors::InvalidArgument(
+          "Inputs of type ", TF_TensorType(input), " cannot be batched.");
+  }
+  mutex_lock l(mu_);
+  if (stopping_)
+    return errors::FailedPrecondition("The batch scheduler is being deleted.");
+  if (static_cast<int>(queue_.size()) >= max_queue_size_) {
+    ++statistics_.num_rejected;
+    return errors::ResourceExhausted("The batch scheduler queue is full (",
+                                     max_queue_size_, " requests).");
+  }
+  ++statistics_.num_requests;
+  ++statistics_.queue_depth_histogram[QueueDepthBucket(queue_.size())];
+  queue_.push_back(Request{std::move(inputs), std::move(done), num_rows,
+                           Env::Default()->NowMicros()});
+  queued_rows_ += num_rows;
+  statistics_.peak_queue_depth = std::max(
+      statistics_.peak_queue_depth, static_cast<int64>(queue_.size()));
+  cv_.notify_all();
+  return Status::OK();
+}
+
+BatchScheduler::Statistics BatchScheduler::GetStatistics() {
+  mutex_lock l(mu_);
+  Statistics statistics = statistics_;
+  statistics.queue_depth = static_cast<int64>(queue_.size());
+  return statistics;
+}
+
+void BatchScheduler::BatchLoop() {
+  while (true) {
+    std::vector<Request> batch;
+    {
+      mutex_lock l(mu_);
+      while (!stopping_ && queue_.empty()) cv_.wait(l);
+      // Waits for more requests, until either the batch is full or the
+      // oldest request has waited for "batch_timeout_micros".
+      while (!stopping_ && !queue_.empty() && queued_rows_ < max_batch_size_) {
+        const uint64 deadline =
+            queue_.front().schedule_micros + batch_timeout_micros_;
+        const uint64 now = Env::Default()->NowMicros();
+        if (now >= deadline) break;
+        cv_.wait_for(l, std::chrono::microseconds(deadline - now));
+      }
+      if (stopping_) return;
+      // Another batch thread may have emptied the queue in the meantime.
+      if (queue_.empty()) continue;
+      int64 num_rows = 0;
+      while (!queue_.empty() &&
+             (batch.empty() ||
+              num_rows + queue_.front().num_rows <= max_batch_size_)) {
+        num_rows += queue_.front().num_rows;
+        queued_rows_ -= queue_.front().num_rows;
+        batch.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      }
+      ++statistics_.num_batches;
+      ++statistics_.batch_size_histogram[std::min(
+          num_rows, static_cast<int64>(max_batch_size_ + 1))];
+      // The remaining requests are picked up by the other batch threads.
+      if (!queue_.empty()) cv_.notify_all();
+    }
+    RunBatch(&batch);
+  }
+}
+
+void BatchScheduler::RunBatch(std::vector<Request>* batch) {
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(
+      TF_NewStatus(), TF_DeleteStatus);
+  std::vector<TF_Tensor*> outputs(num_outputs_, nullptr);
+
+  // Single requests are run as they are, without copying their values.
+  if (batch->size() == 1) {
+    Request& request = batch->front();
+    run_(request.inputs.data(), outputs.data(), status.get());
+    for (TF_Tensor* input : request.inputs) TF_DeleteTensor(input);
+    request.done(StatusFromTFStatus(status.get()), outputs);
+    return;
+  }
+
+  int64 num_rows = 0;
+  for (const Request& request : *batch) num_rows += request.num_rows;
+
+  // Concatenates the inputs of all requests along their leading dimension.
+  Status batch_status;
+  std::vector<TF_Tensor*> inputs(num_inputs_, nullptr);
+  for (int i = 0; i < num_inputs_ && batch_status.ok(); ++i) {
+    const TF_Tensor* first = batch->front().inputs[i];
+    std::vector<int64_t> dims = Dims(first);
+    for (const Request& request : *batch) {
+      std::vector<int64_t> request_dims = Dims(request.inputs[i]);
+      if (TF_TensorType(request.inputs[i]) != TF_TensorType(first) ||
+          request_dims.size() != dims.size() ||
+          !std::equal(dims.begin() + 1, dims.end(), request_dims.begin() + 1)) {
+        batch_status = errors::InvalidArgument(
+            "The values of input ", i,
+            " of batched requests must have the same data type and the same "
+            "shape, except for their leading dimension.");
+        break;
+      }
+    }
+    if (!batch_status.ok()) break;
+    const size_t row_bytes =
+        TF_TensorByteSize(first) / static_cast<size_t>(dims[0]);
+    dims[0] = num_rows;
+    inputs[i] = TF_AllocateTensor(TF_TensorType(first), dims.data(),
+                                  static_cast<int>(dims.size()),
+                                  row_bytes * static_cast<size_t>(num_rows));
+    char* data = static_cast<char*>(TF_TensorData(inputs[i]));
+    for (const Request& request : *batch) {
+      const size_t num_bytes = TF_TensorByteSize(request.inputs[i]);
+      memcpy(data, TF_TensorData(request.inputs[i]), num_bytes);
+      data += num_bytes;
+    }
+  }
+  for (Request& request : *batch)
+    for (TF_Tensor* input : request.inputs) TF_DeleteTensor(input);
+
+  if (batch_status.ok()) {
+    run_(inputs.data(), outputs.data(), status.get());
+    batch_status = StatusFromTFStatus(status.get());
+  }
+  for (TF_Tensor* input : inputs)
+    if (input != nullptr) TF_DeleteTensor(input);
+
+  // Splits the outputs along their leading dimension.
+  std::vector<std::vector<TF_Tensor*>> request_outputs(batch->size());
+  for (int i = 0; i < num_outputs_ && batch_status.ok(); ++i) {
+    TF_Tensor* output = outputs[i];
+    if (TF_NumDims(output) == 0 || TF_Dim(output, 0) != num_rows ||
+        !CanBatch(TF_TensorType(output))) {
+      batch_status = errors::InvalidArgument(
+          "Output ", i, " cannot be split into the outputs of the batched "
+          "requests, because its leading dimension size does not match the "
+          "number of batched rows or because its data type is not supported.");
+      break;
+    }
+    std::vector<int64_t> dims = Dims(output);
+    const size_t row_bytes =
+        TF_TensorByteSize(output) / static_cast<size_t>(num_rows);
+    const char* data = static_cast<const char*>(TF_TensorData(output));
+    for (size_t r = 0; r < batch->size(); ++r) {
+      dims[0] = (*batch)[r].num_rows;
+      const size_t num_bytes = row_bytes * static_cast<size_t>(dims[0]);
+      TF_Tensor* split = TF_AllocateTensor(TF_TensorType(output), dims.data(),
+                                           static_cast<int>(dims.size()),
+                                           num_bytes);
+      memcpy(TF_TensorData(split), data, num_bytes);
+      data += num_bytes;
+      request_outputs[r].push_back(split);
+    }
+  }
+  if (TF_GetCode(status.get()) == TF_OK)
+    for (TF_Tensor* output : outputs)
+      if (output != nullptr) TF_DeleteTensor(output);
+
+  for (size_t r = 0; r < batch->size(); ++r) {
+    if (batch_status.ok()) {
+      (*batch)[r].done(batch_status, request_outputs[r]);
+    } else {
+      for (TF_Tensor* split : request_outputs[r]) TF_DeleteTensor(split);
+      (*batch)[r].done(batch_status, {});
+    }
+  }
+}
+
+}  // namespace tensorflow
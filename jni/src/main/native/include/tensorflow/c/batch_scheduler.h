@@ -0,0 +1,130 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_BATCH_SCHEDULER_H_
+#define TENSORFLOW_C_BATCH_SCHEDULER_H_
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+class Thread;
+
+// Dynamically batches requests for the same step (e.g., concurrent inference
+// requests against a session callable). Requests are queued and batch threads
+// combine them into batches of up to "max_batch_size" rows (i.e., elements of
+// the leading dimension of their inputs), waiting for at most
+// "batch_timeout_micros" after the oldest queued request was scheduled for
+// more requests to arrive. The inputs of the requests in a batch are
+// concatenated along their leading dimension, the step is run once, and its
+// outputs are split back along their leading dimension and handed to the
+// requests' completion callbacks. Requests with more than "max_batch_size"
+// rows are run on their own. An instance of this class is safe for concurrent
+// access by multiple threads.
+class BatchScheduler {
+ public:
+  // Runs the step, given its input values, storing its output values in
+  // "outputs" (whose ownership passes to the caller) and its status in
+  // "status".
+  typedef std::function<void(TF_Tensor* const* inputs, TF_Tensor** outputs,
+                             TF_Status* status)>
+      RunFunction;
+
+  // Completion callback of a request, which is passed the output values of
+  // the request (whose ownership passes to the callback), if "status" is OK.
+  typedef std::function<void(const Status& status,
+                             const std::vector<TF_Tensor*>& outputs)>
+      DoneCallback;
+
+  // Number of buckets of the queue depth histogram. Bucket "i" counts the
+  // requests that found between "2^(i-1)" (or 0, for "i = 0") and "2^i - 1"
+  // other requests in the queue when they were scheduled.
+  static constexpr int kNumQueueDepthBuckets = 32;
+
+  struct Statistics {
+    int64 num_requests = 0;
+    int64 num_rejected = 0;
+    int64 num_batches = 0;
+    int64 queue_depth = 0;
+    int64 peak_queue_depth = 0;
+    // Element "i" counts the batches that contained "i" rows. Batches with
+    // more than "max_batch_size" rows are counted in the last element.
+    std::vector<int64> batch_size_histogram;
+    std::vector<int64> queue_depth_histogram;
+  };
+
+  BatchScheduler(int num_inputs, int num_outputs, RunFunction run,
+                 int max_batch_size, int64 batch_timeout_micros,
+                 int max_queue_size, int num_batch_threads);
+
+  // Stops the batch threads, after they have run the batches that they have
+  // already formed, and fails all requests that are still queued.
+  ~BatchScheduler();
+
+  // Schedules a request with input values "inputs", whose ownership passes to
+  // this scheduler. All inputs must have the same (non-zero) leading
+  // dimension size, which is the number of rows of the request. Returns an
+  // error (in which case "done" is never called and the caller keeps
+  // ownership of the inputs) if the request is invalid or if the queue is
+  // full.
+  Status Schedule(std::vector<TF_Tensor*> inputs, DoneCallback done);
+
+  Statistics GetStatistics();
+
+ private:
+  struct Request {
+    std::vector<TF_Tensor*> inputs;
+    DoneCallback done;
+    int64 num_rows;
+    uint64 schedule_micros;
+  };
+
+  // Body of the batch threads.
+  void BatchLoop();
+
+  // Runs "batch" and completes all of its requests.
+  void RunBatch(std::vector<Request>* batch);
+
+  const int num_inputs_;
+  const int num_outputs_;
+  const RunFunction run_;
+  const int max_batch_size_;
+  const int64 batch_timeout_micros_;
+  const int max_queue_size_;
+
+  mutex mu_;
+  condition_variable cv_;
+  bool stopping_ GUARDED_BY(mu_) = false;
+  std::deque<Request> queue_ GUARDED_BY(mu_);
+  int64 queued_rows_ GUARDED_BY(mu_) = 0;
+  Statistics statistics_ GUARDED_BY(mu_);
+  std::vector<std::unique_ptr<Thread>> batch_threads_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(BatchScheduler);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_BATCH_SCHEDULER_H_
@@ -0,0 +1,273 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/block_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "tensorflow/c/metrics_exporter.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/hash/hash.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/lib/strings/stringprintf.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/logging.h"
+
+namespace tensorflow {
+namespace {
+
+const char kBlockSuffix[] = ".block";
+const char kTemporarySuffix[] = ".tmp-";
+
+// Blocks are named after the fingerprint of their file, the block size, and their index, so that blocks cached with a
+// different block size are never confused with each other.
+string BlockName(uint64 fingerprint, int64 block_size, uint64 block) {
+  return strings::Printf("%016llx-%lld-%llu%s", static_cast<unsigned long long>(fingerprint),
+                         static_cast<long long>(block_size), static_cast<unsigned long long>(block), kBlockSuffix);
+}
+
+// Random access file that reads the first "length" bytes of a remote file through the block cache. The file is
+// assumed to be immutable (which is the case for objects stored in GCS or S3), and so reads past its length fail with
+// an "OutOfRange" error, as they do for all file systems.
+class BlockCachingRandomAccessFile : public RandomAccessFile {
+ public:
+  BlockCachingRandomAccessFile(std::unique_ptr<RandomAccessFile>&& file, uint64 fingerprint, uint64 length)
+      : file_(std::move(file)), fingerprint_(fingerprint), length_(length) {}
+
+  Status Read(uint64 offset, size_t n, StringPiece* result, char* scratch) const override {
+    BlockCache* cache = BlockCache::Global();
+    if (!cache->enabled()) return file_->Read(offset, n, result, scratch);
+    const size_t available = offset < length_ ? static_cast<size_t>(std::min<uint64>(n, length_ - offset)) : 0;
+    *result = StringPiece();
+    if (available > 0) TF_RETURN_IF_ERROR(cache->Read(file_.get(), fingerprint_, length_, offset, available, scratch));
+    *result = StringPiece(scratch, available);
+    if (available < n) return errors::OutOfRange("Read less bytes than requested.");
+    return Status::OK();
+  }
+
+ private:
+  const std::unique_ptr<RandomAccessFile> file_;
+  const uint64 fingerprint_;
+  const uint64 length_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(BlockCachingRandomAccessFile);
+};
+
+}  // namespace
+
+BlockCache* BlockCache::Global() {
+  static BlockCache* cache = new BlockCache();
+  return cache;
+}
+
+Status BlockCache::Enable(const string& directory, int64 capacity_bytes, int64 block_size) {
+  if (capacity_bytes <= 0)
+    return errors::InvalidArgument("The block cache capacity (", capacity_bytes, ") must be positive.");
+  if (block_size <= 0) return errors::InvalidArgument("The block size (", block_size, ") must be positive.");
+  Env* env = Env::Default();
+  TF_RETURN_IF_ERROR(env->RecursivelyCreateDir(directory));
+  std::vector<string> children;
+  TF_RETURN_IF_ERROR(env->GetChildren(directory, &children));
+
+  // Blocks cached by previous processes are reused (in an arbitrary order), while partially written blocks are removed.
+  std::list<Entry> entries;
+  for (const string& child : children) {
+    const string path = io::JoinPath(directory, child);
+    uint64 size;
+    if (child.find(kTemporarySuffix) != string::npos) {
+      env->DeleteFile(path).IgnoreError();
+    } else if (StringPiece(child).ends_with(kBlockSuffix) && env->GetFileSize(path, &size).ok()) {
+      entries.push_back({child, static_cast<int64>(size)});
+    }
+  }
+
+  std::vector<string> evicted;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    directory_ = directory;
+    capacity_bytes_ = capacity_bytes;
+    block_size_ = block_size;
+    cached_bytes_ = 0;
+    entries_ = std::move(entries);
+    index_.clear();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      cached_bytes_ += it->size;
+      index_[it->name] = it;
+    }
+    evicted = EvictLocked();
+    hits_ = 0;
+    misses_ = 0;
+    bytes_saved_ = 0;
+    bytes_fetched_ = 0;
+    evictions_ = 0;
+    enabled_.store(true, std::memory_order_release);
+  }
+  for (const string& name : evicted) env->DeleteFile(io::JoinPath(directory, name)).IgnoreError();
+  return Status::OK();
+}
+
+void BlockCache::Disable() {
+  std::lock_guard<std::mutex> lock(mu_);
+  enabled_.store(false, std::memory_order_release);
+}
+
+BlockCache::Statistics BlockCache::statistics() {
+  Statistics statistics;
+  statistics.hits = hits_.load();
+  statistics.misses = misses_.load();
+  statistics.bytes_saved = bytes_saved_.load();
+  statistics.bytes_fetched = bytes_fetched_.load();
+  statistics.evictions = evictions_.load();
+  std::lock_guard<std::mutex> lock(mu_);
+  statistics.cached_bytes = cached_bytes_;
+  statistics.cached_blocks = static_cast<int64>(entries_.size());
+  return statistics;
+}
+
+Status BlockCache::Read(
+    RandomAccessFile* file, uint64 fingerprint, uint64 length, uint64 offset, size_t n, char* scratch) {
+  uint64 block_size;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    block_size = static_cast<uint64>(block_size_);
+  }
+  const uint64 end = offset + n;
+  uint64 position = offset;
+  while (position < end) {
+    const uint64 block = position / block_size;
+    const uint64 block_start = block * block_size;
+    const size_t block_length = static_cast<size_t>(std::min(block_size, length - block_start));
+    const size_t count = static_cast<size_t>(std::min(end, block_start + block_length) - position);
+    const string name = BlockName(fingerprint, static_cast<int64>(block_size), block);
+    char* destination = scratch + (position - offset);
+    if (ReadCached(name, position - block_start, count, destination)) {
+      ++hits_;
+      bytes_saved_ += static_cast<int64>(count);
+      jni_metrics::RecordBlockCacheHit(count);
+    } else {
+      // Whole blocks are always fetched, so that they can be cached, even if only part of them is requested.
+      std::unique_ptr<char[]> buffer(new char[block_length]);
+      StringPiece contents;
+      TF_RETURN_IF_ERROR(file->Read(block_start, block_length, &contents, buffer.get()));
+      memcpy(destination, contents.data() + (position - block_start), count);
+      ++misses_;
+      bytes_fetched_ += static_cast<int64>(block_length);
+      jni_metrics::RecordBlockCacheMiss(block_length);
+      Insert(name, contents);
+    }
+    position += count;
+  }
+  return Status::OK();
+}
+
+bool BlockCache::ReadCached(const string& name, uint64 offset, size_t n, char* scratch) {
+  string path;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = index_.find(name);
+    if (it == index_.end()) return false;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    path = io::JoinPath(directory_, name);
+  }
+  // The block is read without holding the lock. If it is evicted concurrently, the read either still succeeds (since
+  // open files remain readable after being deleted) or fails and the block is fetched again.
+  std::unique_ptr<RandomAccessFile> file;
+  StringPiece result;
+  Status s = Env::Default()->NewRandomAccessFile(path, &file);
+  if (s.ok()) s = file->Read(offset, n, &result, scratch);
+  if (!s.ok() || result.size() != n) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = index_.find(name);
+    if (it != index_.end()) {
+      cached_bytes_ -= it->second->size;
+      entries_.erase(it->second);
+      index_.erase(it);
+    }
+    return false;
+  }
+  if (result.data() != scratch) memmove(scratch, result.data(), n);
+  return true;
+}
+
+void BlockCache::Insert(const string& name, StringPiece contents) {
+  static std::atomic<uint64> next_temporary_id{0};
+  string directory;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (!enabled() || index_.count(name) > 0 || static_cast<int64>(contents.size()) > capacity_bytes_) return;
+    directory = directory_;
+  }
+
+  // Blocks are written to temporary files first, so that partially written blocks are never read.
+  Env* env = Env::Default();
+  const string path = io::JoinPath(directory, name);
+  const string temporary_path = strings::StrCat(path, kTemporarySuffix, env->NowMicros(), "-", next_temporary_id++);
+  Status s = WriteStringToFile(env, temporary_path, contents);
+  if (s.ok()) s = env->RenameFile(temporary_path, path);
+  if (!s.ok()) {
+    LOG(WARNING) << "Failed to cache block '" << path << "': " << s;
+    env->DeleteFile(temporary_path).IgnoreError();
+    return;
+  }
+
+  std::vector<string> evicted;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (directory != directory_) {
+      // The cache was reconfigured while the block was being written.
+      evicted.push_back(name);
+    } else if (index_.count(name) == 0) {
+      entries_.push_front({name, static_cast<int64>(contents.size())});
+      index_[name] = entries_.begin();
+      cached_bytes_ += static_cast<int64>(contents.size());
+      evicted = EvictLocked();
+    }
+  }
+  for (const string& evicted_name : evicted) env->DeleteFile(io::JoinPath(directory, evicted_name)).IgnoreError();
+}
+
+std::vector<string> BlockCache::EvictLocked() {
+  std::vector<string> evicted;
+  while (cached_bytes_ > capacity_bytes_ && !entries_.empty()) {
+    const Entry& entry = entries_.back();
+    cached_bytes_ -= entry.size;
+    evicted.push_back(entry.name);
+    index_.erase(entry.name);
+    entries_.pop_back();
+    ++evictions_;
+  }
+  return evicted;
+}
+
+Status NewCachedRandomAccessFile(const string& filename, std::unique_ptr<RandomAccessFile>* result) {
+  Env* env = Env::Default();
+  TF_RETURN_IF_ERROR(env->NewRandomAccessFile(filename, result));
+  if (!BlockCache::Global()->enabled()) return Status::OK();
+  StringPiece scheme, host, path;
+  io::ParseURI(filename, &scheme, &host, &path);
+  if (scheme.empty() || scheme == "file") return Status::OK();
+  // Files whose statistics cannot be obtained are read directly from their file system.
+  FileStatistics statistics;
+  if (!env->Stat(filename, &statistics).ok() || statistics.is_directory || statistics.length < 0) return Status::OK();
+  const string key = strings::StrCat(filename, "\n", statistics.length, "\n", statistics.mtime_nsec);
+  result->reset(new BlockCachingRandomAccessFile(
+      std::move(*result), Hash64(key.data(), key.size()), static_cast<uint64>(statistics.length)));
+  return Status::OK();
+}
+
+}  // namespace tensorflow
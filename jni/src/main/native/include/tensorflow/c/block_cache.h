@@ -0,0 +1,118 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_BLOCK_CACHE_H_
+#define TENSORFLOW_C_BLOCK_CACHE_H_
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/platform/file_system.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Process-wide cache of fixed-size blocks of remote files (i.e., files whose scheme is neither empty nor "file"), which
+// is stored in a local directory (e.g., on a local SSD) and is shared by all the JNI readers. Blocks are identified by
+// the name, the size, and the modification time of their file, and so modified files are never read from stale blocks.
+// Blocks are evicted in least recently used order, once the cached blocks take up more than the cache capacity. Blocks
+// that already exist in the cache directory when the cache is enabled are reused, and so the cache also persists across
+// processes. All methods are safe for concurrent use.
+class BlockCache {
+ public:
+  struct Statistics {
+    int64 hits = 0;
+    int64 misses = 0;
+    // Number of bytes read from the cache, instead of from the remote file systems.
+    int64 bytes_saved = 0;
+    // Number of bytes read from the remote file systems, due to misses.
+    int64 bytes_fetched = 0;
+    int64 evictions = 0;
+    int64 cached_bytes = 0;
+    int64 cached_blocks = 0;
+  };
+
+  // Returns the process-wide cache, which is initially disabled.
+  static BlockCache* Global();
+
+  // Enables the cache, storing at most "capacity_bytes" bytes of blocks of "block_size" bytes in "directory", which is
+  // created if it does not exist. If the cache is already enabled, it is reconfigured and its statistics are reset.
+  Status Enable(const string& directory, int64 capacity_bytes, int64 block_size);
+
+  // Disables the cache. Blocks are kept in the cache directory, and files that are already open read through to their
+  // file systems from now on.
+  void Disable();
+
+  bool enabled() const { return enabled_.load(std::memory_order_acquire); }
+
+  Statistics statistics();
+
+  // Reads "n" bytes starting at "offset" (which must all lie within the "length" bytes of the file) into "scratch",
+  // using the cached blocks of the file with fingerprint "fingerprint" whenever possible, and reading and caching the
+  // missing blocks from "file" otherwise.
+  Status Read(RandomAccessFile* file, uint64 fingerprint, uint64 length, uint64 offset, size_t n, char* scratch);
+
+ private:
+  struct Entry {
+    string name;
+    int64 size;
+  };
+
+  BlockCache() = default;
+
+  // Copies "n" bytes of the cached block "name", starting at "offset", into "scratch", and returns "false" if the block
+  // is not cached (or if its file cannot be read).
+  bool ReadCached(const string& name, uint64 offset, size_t n, char* scratch);
+
+  // Writes "contents" as the cached block "name", and evicts the least recently used blocks if necessary.
+  void Insert(const string& name, StringPiece contents);
+
+  // Removes the least recently used blocks until the cached blocks fit in the capacity, and returns their names. Must
+  // be called while holding "mu_".
+  std::vector<string> EvictLocked();
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<int64> hits_{0};
+  std::atomic<int64> misses_{0};
+  std::atomic<int64> bytes_saved_{0};
+  std::atomic<int64> bytes_fetched_{0};
+  std::atomic<int64> evictions_{0};
+
+  std::mutex mu_;
+  string directory_;
+  int64 capacity_bytes_ = 0;
+  int64 block_size_ = 0;
+  int64 cached_bytes_ = 0;
+  // Cached blocks, in most recently used order, and an index of them by name.
+  std::list<Entry> entries_;
+  std::unordered_map<string, std::list<Entry>::iterator> index_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(BlockCache);
+};
+
+// Opens "filename" for random access, in the same way as "Env::NewRandomAccessFile", except that reads of remote files
+// go through the process-wide block cache, if it is enabled. All JNI readers open their files through this function.
+Status NewCachedRandomAccessFile(const string& filename, std::unique_ptr<RandomAccessFile>* result);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_BLOCK_CACHE_H_
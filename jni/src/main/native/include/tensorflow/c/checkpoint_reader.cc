@@ -15,11 +15,25 @@ limitations under the License.
 
 #include "checkpoint_reader.h"
 
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <unordered_set>
 
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/core/threadpool.h"
 #include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/lib/io/path.h"
 #include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/util/saved_tensor_slice_util.h"
 
@@ -29,9 +43,80 @@ namespace checkpoint {
 
 class TensorSliceReader;
 
+namespace {
+
+// Keys used by delta checkpoints, which must match the ones used by the
+// "IncrementalSaveV2" op. A delta checkpoint stores the basename of its base
+// checkpoint under "kDeltaBaseKey". Each tensor that is stored as a delta is
+// stored as the [num_ranges, 2] tensor of the (start, length) pairs of its
+// changed row ranges, under "kDeltaRangesPrefix + name", and the tensor of
+// the changed rows, under "kDeltaRowsPrefix + name".
+const char* const kDeltaBaseKey = "_DELTA_BASE_";
+const char* const kDeltaKeysPrefix = "_DELTA_";
+const char* const kDeltaRangesPrefix = "_DELTA_RANGES_/";
+const char* const kDeltaRowsPrefix = "_DELTA_ROWS_/";
+
+// Copies the elements of "slice", along dimensions "dim" and higher, from
+// "source" (a row-major array with shape "shape") to "*target", and advances
+// "*target" past the copied bytes.
+void CopySliceBytes(const char* source, const TensorShape& shape,
+                    const TensorSlice& slice, int dim, int64 element_bytes,
+                    char** target) {
+  if (dim >= shape.dims()) {
+    memcpy(*target, source, element_bytes);
+    *target += element_bytes;
+    return;
+  }
+  int64 stride = element_bytes;
+  for (int d = dim + 1; d < shape.dims(); ++d) stride *= shape.dim_size(d);
+  const int64 start = slice.start(dim);
+  const int64 length =
+      slice.IsFullAt(dim) ? shape.dim_size(dim) : slice.length(dim);
+  if (dim == shape.dims() - 1) {
+    memcpy(*target, source + start * stride, length * stride);
+    *target += length * stride;
+    return;
+  }
+  for (int64 i = start; i < start + length; ++i) {
+    CopySliceBytes(source + i * stride, shape, slice, dim + 1, element_bytes,
+                   target);
+  }
+}
+
+// Reads the prefix of the base checkpoint of the delta checkpoint read by
+// "reader" into "base_prefix", or clears it if this is not a delta checkpoint.
+Status ReadDeltaBase(BundleReader* reader, const string& prefix,
+                     string* base_prefix) {
+  base_prefix->clear();
+  if (!reader->Contains(kDeltaBaseKey)) return Status::OK();
+  Tensor base(DT_STRING, TensorShape({}));
+  TF_RETURN_IF_ERROR(reader->Lookup(kDeltaBaseKey, &base));
+  *base_prefix = io::JoinPath(io::Dirname(prefix), base.scalar<string>()());
+  return Status::OK();
+}
+
+}  // namespace
+
+// A memory mapping of a whole data file, which is unmapped once the reader and
+// all tensors aliasing it have been deleted.
+struct CheckpointReader::MappedDataFile {
+  MappedDataFile(char* data, size_t length) : data(data), length(length) {}
+  ~MappedDataFile() {
+    if (length > 0) munmap(data, length);
+  }
+
+  char* const data;
+  const size_t length;
+};
+
 CheckpointReader::CheckpointReader(const string& filename,
                                    TF_Status* out_status)
-    : reader_(nullptr), v2_reader_(nullptr), var_to_shape_map_ptr_(nullptr) {
+    : prefix_(filename),
+      reader_(nullptr),
+      v2_reader_(nullptr),
+      base_reader_(nullptr),
+      var_to_shape_map_ptr_(nullptr),
+      var_to_data_type_map_ptr_(nullptr) {
   // Depending on whether this is a V2 ckpt, initializes "reader_" or
   // "v2_reader_".
   std::vector<string> v2_path;
@@ -43,7 +128,17 @@ CheckpointReader::CheckpointReader(const string& filename,
       Set_TF_Status_from_Status(out_status, v2_reader_->status());
       return;
     }
-    var_to_shape_map_ptr_ = BuildV2VarToShapeMap();
+    string base_prefix;
+    Status status = ReadDeltaBase(v2_reader_, filename, &base_prefix);
+    if (!status.ok()) {
+      Set_TF_Status_from_Status(out_status, status);
+      return;
+    }
+    if (!base_prefix.empty()) {
+      base_reader_ = new CheckpointReader(base_prefix, out_status);
+      if (TF_GetCode(out_status) != TF_OK) return;
+    }
+    var_to_shape_map_ptr_ = BuildV2VarToShapeMap(&var_to_data_type_map_ptr_);
   } else {
     reader_ = new TensorSliceReader(filename);
     if (!reader_->status().ok()) {
@@ -52,19 +147,31 @@ CheckpointReader::CheckpointReader(const string& filename,
     }
     var_to_shape_map_ptr_ =
         new TensorSliceReader::VarToShapeMap(reader_->GetVariableToShapeMap());
+    var_to_data_type_map_ptr_ = new VarToDataTypeMap;
+    for (const auto& entry : *var_to_shape_map_ptr_) {
+      DataType dtype;
+      if (reader_->HasTensor(entry.first, nullptr, &dtype)) {
+        (*var_to_data_type_map_ptr_)[entry.first] = dtype;
+      }
+    }
   }
 }
 
 CheckpointReader::~CheckpointReader() {
   delete var_to_shape_map_ptr_;
+  delete var_to_data_type_map_ptr_;
   delete reader_;
   delete v2_reader_;
+  delete base_reader_;
 }
 
 bool CheckpointReader::HasTensor(const string& name) const {
   if (reader_ != nullptr) {
     return reader_->HasTensor(name, nullptr, nullptr);
   }
+  if (base_reader_ != nullptr) {
+    return var_to_shape_map_ptr_->count(name) > 0;
+  }
   return v2_reader_->Contains(name);
 }
 
@@ -74,6 +181,12 @@ CheckpointReader::GetVariableToShapeMap() const {
   return *var_to_shape_map_ptr_;
 }
 
+const CheckpointReader::VarToDataTypeMap&
+CheckpointReader::GetVariableToDataTypeMap() const {
+  CHECK(var_to_data_type_map_ptr_);
+  return *var_to_data_type_map_ptr_;
+}
+
 const string CheckpointReader::DebugString() const {
   if (reader_ != nullptr) return reader_->DebugString();
   return v2_reader_->DebugString();
@@ -85,6 +198,13 @@ void CheckpointReader::GetTensor(
   Status status;
   if (reader_ != nullptr) {
     status = reader_->GetTensor(name, out_tensor);
+  } else if (IsDelta(name)) {
+    base_reader_->GetTensor(name, out_tensor, out_status);
+    if (TF_GetCode(out_status) != TF_OK) return;
+    const TensorShape shape = (*out_tensor)->shape();
+    status = ApplyDelta(name, shape, TensorSlice(shape.dims()),
+                        out_tensor->get());
+    if (!status.ok()) out_tensor->reset();
   } else {
     tensorflow::DataType dtype;
     tensorflow::TensorShape shape;
@@ -100,7 +220,432 @@ void CheckpointReader::GetTensor(
   }
 }
 
-TensorSliceReader::VarToShapeMap* CheckpointReader::BuildV2VarToShapeMap() {
+void CheckpointReader::GetTensorDtypeAndShape(const string& name,
+                                              DataType* dtype,
+                                              TensorShape* shape,
+                                              TF_Status* out_status) const {
+  Status status;
+  if (reader_ != nullptr) {
+    if (!reader_->HasTensor(name, shape, dtype)) {
+      status = errors::NotFound("Tensor '", name, "' not found in checkpoint.");
+    }
+  } else if (IsDelta(name)) {
+    base_reader_->GetTensorDtypeAndShape(name, dtype, shape, out_status);
+    return;
+  } else {
+    status = v2_reader_->LookupDtypeAndShape(name, dtype, shape);
+  }
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+  }
+}
+
+void CheckpointReader::GetTensorSlice(const string& name,
+                                      const TensorSlice& slice,
+                                      Tensor* out_tensor,
+                                      TF_Status* out_status) const {
+  Status status;
+  if (reader_ != nullptr) {
+    bool copied = false;
+    switch (out_tensor->dtype()) {
+#define HANDLE_TYPE(T)                                                   \
+  case DataTypeToEnum<T>::value:                                         \
+    copied = reader_->CopySliceData(name, slice,                         \
+                                    out_tensor->flat<T>().data());       \
+    break;
+      HANDLE_TYPE(float);
+      HANDLE_TYPE(double);
+      HANDLE_TYPE(int32);
+      HANDLE_TYPE(int64);
+      HANDLE_TYPE(int16);
+      HANDLE_TYPE(int8);
+      HANDLE_TYPE(uint8);
+      HANDLE_TYPE(bool);
+      HANDLE_TYPE(complex64);
+#undef HANDLE_TYPE
+      default:
+        status = errors::Unimplemented(
+            "Reading slices of V1 checkpoint tensors of type ",
+            DataTypeString(out_tensor->dtype()), " is not supported.");
+    }
+    if (status.ok() && !copied) {
+      status = errors::NotFound("Slice ", slice.DebugString(), " of tensor '",
+                                name, "' not found in checkpoint.");
+    }
+  } else if (IsDelta(name)) {
+    base_reader_->GetTensorSlice(name, slice, out_tensor, out_status);
+    if (TF_GetCode(out_status) != TF_OK) return;
+    status = ApplyDelta(name, var_to_shape_map_ptr_->at(name), slice,
+                        out_tensor);
+  } else {
+    status = v2_reader_->LookupSlice(name, slice, out_tensor);
+  }
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+  }
+}
+
+void CheckpointReader::GetTensors(
+    const std::vector<string>& names, int num_threads,
+    int64 max_bytes_in_flight,
+    std::vector<std::unique_ptr<Tensor>>* out_tensors,
+    TF_Status* out_status) const {
+  if (base_reader_ == nullptr) {
+    GetStoredTensors(names, num_threads, max_bytes_in_flight, out_tensors,
+                     out_status);
+    return;
+  }
+
+  // The tensors that are stored as deltas are read from the base checkpoint
+  // and are then patched, and all other tensors are read from this checkpoint.
+  std::vector<size_t> delta_indices;
+  std::vector<size_t> stored_indices;
+  std::vector<string> delta_names;
+  std::vector<string> stored_names;
+  for (size_t i = 0; i < names.size(); ++i) {
+    if (IsDelta(names[i])) {
+      delta_indices.push_back(i);
+      delta_names.push_back(names[i]);
+    } else {
+      stored_indices.push_back(i);
+      stored_names.push_back(names[i]);
+    }
+  }
+  std::vector<std::unique_ptr<Tensor>> delta_tensors;
+  std::vector<std::unique_ptr<Tensor>> stored_tensors;
+  out_tensors->clear();
+  base_reader_->GetTensors(delta_names, num_threads, max_bytes_in_flight,
+                           &delta_tensors, out_status);
+  if (TF_GetCode(out_status) != TF_OK) return;
+  GetStoredTensors(stored_names, num_threads, max_bytes_in_flight,
+                   &stored_tensors, out_status);
+  if (TF_GetCode(out_status) != TF_OK) return;
+  out_tensors->resize(names.size());
+  for (size_t i = 0; i < delta_indices.size(); ++i) {
+    const TensorShape shape = delta_tensors[i]->shape();
+    Status status = ApplyDelta(delta_names[i], shape,
+                               TensorSlice(shape.dims()),
+                               delta_tensors[i].get());
+    if (!status.ok()) {
+      Set_TF_Status_from_Status(out_status, status);
+      out_tensors->clear();
+      return;
+    }
+    (*out_tensors)[delta_indices[i]] = std::move(delta_tensors[i]);
+  }
+  for (size_t i = 0; i < stored_indices.size(); ++i) {
+    (*out_tensors)[stored_indices[i]] = std::move(stored_tensors[i]);
+  }
+}
+
+void CheckpointReader::GetStoredTensors(
+    const std::vector<string>& names, int num_threads,
+    int64 max_bytes_in_flight,
+    std::vector<std::unique_ptr<Tensor>>* out_tensors,
+    TF_Status* out_status) const {
+  out_tensors->clear();
+  out_tensors->resize(names.size());
+  if (reader_ != nullptr || num_threads <= 1 || names.size() <= 1) {
+    for (size_t i = 0; i < names.size(); ++i) {
+      GetTensor(names[i], &(*out_tensors)[i], out_status);
+      if (TF_GetCode(out_status) != TF_OK) {
+        out_tensors->clear();
+        return;
+      }
+    }
+    return;
+  }
+
+  // Looks up the metadata of all tensors, so that they can be read in the
+  // order in which they are stored and so that their sizes are known.
+  struct PendingRead {
+    size_t index;
+    DataType dtype;
+    TensorShape shape;
+    int32 shard_id;
+    int64 offset;
+  };
+  std::vector<PendingRead> reads(names.size());
+  for (size_t i = 0; i < names.size(); ++i) {
+    PendingRead& read = reads[i];
+    read.index = i;
+    Status status =
+        v2_reader_->LookupDtypeAndShape(names[i], &read.dtype, &read.shape);
+    if (!status.ok()) {
+      Set_TF_Status_from_Status(out_status, status);
+      out_tensors->clear();
+      return;
+    }
+    read.shard_id = 0;
+    read.offset = 0;
+    v2_reader_->Seek(names[i]);
+    if (v2_reader_->Valid() && v2_reader_->key() == names[i]) {
+      BundleEntryProto entry;
+      if (entry.ParseFromArray(v2_reader_->value().data(),
+                               v2_reader_->value().size())) {
+        read.shard_id = entry.shard_id();
+        read.offset = entry.offset();
+      }
+    }
+  }
+  std::sort(reads.begin(), reads.end(),
+            [](const PendingRead& a, const PendingRead& b) {
+              return a.shard_id != b.shard_id ? a.shard_id < b.shard_id
+                                              : a.offset < b.offset;
+            });
+
+  // Each thread uses its own reader, because readers are not thread-safe.
+  const int num_workers =
+      static_cast<int>(std::min(static_cast<size_t>(num_threads), names.size()));
+  mutex mu;
+  condition_variable cv;
+  size_t next_read = 0;
+  int64 bytes_in_flight = 0;
+  Status status;
+  {
+    thread::ThreadPool pool(Env::Default(), "tf_scala_checkpoint_restore",
+                            num_workers);
+    for (int w = 0; w < num_workers; ++w) {
+      pool.Schedule([&]() {
+        BundleReader reader(Env::Default(), prefix_);
+        {
+          mutex_lock l(mu);
+          status.Update(reader.status());
+        }
+        while (true) {
+          const PendingRead* read;
+          int64 num_bytes;
+          {
+            mutex_lock l(mu);
+            if (!status.ok() || next_read >= reads.size()) return;
+            read = &reads[next_read++];
+            num_bytes = read->shape.num_elements() *
+                        std::max(DataTypeSize(read->dtype), 1);
+            while (bytes_in_flight > 0 &&
+                   bytes_in_flight + num_bytes > max_bytes_in_flight) {
+              cv.wait(l);
+            }
+            bytes_in_flight += num_bytes;
+          }
+          std::unique_ptr<Tensor> tensor(new Tensor(read->dtype, read->shape));
+          Status s = reader.Lookup(names[read->index], tensor.get());
+          if (s.ok()) (*out_tensors)[read->index] = std::move(tensor);
+          mutex_lock l(mu);
+          status.Update(s);
+          bytes_in_flight -= num_bytes;
+          cv.notify_all();
+        }
+      });
+    }
+    // The thread pool destructor waits for all reads to complete.
+  }
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+    out_tensors->clear();
+  }
+}
+
+void CheckpointReader::GetMappedTensor(
+    const string& name, bool copy_on_write,
+    std::unique_ptr<tensorflow::Tensor>* out_tensor,
+    TF_Status* out_status) const {
+  StringPiece scheme, host, path;
+  io::ParseURI(prefix_, &scheme, &host, &path);
+  if (reader_ != nullptr || (!scheme.empty() && scheme != "file") ||
+      IsDelta(name)) {
+    GetTensor(name, out_tensor, out_status);
+    return;
+  }
+  v2_reader_->Seek(name);
+  BundleEntryProto entry;
+  if (!v2_reader_->Valid() || v2_reader_->key() != name ||
+      !entry.ParseFromArray(v2_reader_->value().data(),
+                            v2_reader_->value().size())) {
+    GetTensor(name, out_tensor, out_status);
+    return;
+  }
+  const TensorShape shape(entry.shape());
+  const int64 num_bytes = shape.num_elements() * DataTypeSize(entry.dtype());
+  if (entry.dtype() == DT_STRING || DataTypeSize(entry.dtype()) == 0 ||
+      entry.slices_size() > 0 || entry.size() != num_bytes) {
+    GetTensor(name, out_tensor, out_status);
+    return;
+  }
+  std::shared_ptr<MappedDataFile> mapped_file;
+  Status status =
+      GetMappedDataFile(entry.shard_id(), copy_on_write, &mapped_file);
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+    return;
+  }
+  if (entry.offset() < 0 ||
+      static_cast<uint64>(entry.offset() + num_bytes) > mapped_file->length) {
+    Set_TF_Status_from_Status(
+        out_status,
+        errors::DataLoss("Tensor \"", name, "\" lies outside its data file."));
+    return;
+  }
+  char* data = mapped_file->data + entry.offset();
+  if (reinterpret_cast<intptr_t>(data) % Allocator::kAllocatorAlignment != 0) {
+    GetTensor(name, out_tensor, out_status);
+    return;
+  }
+
+  // Each tensor keeps the mapping alive through its own reference to it.
+  std::vector<int64_t> dims(shape.dims());
+  for (int i = 0; i < shape.dims(); ++i) dims[i] = shape.dim_size(i);
+  TF_Tensor* aliasing_tensor = TF_NewTensor(
+      static_cast<TF_DataType>(entry.dtype()), dims.data(),
+      static_cast<int>(dims.size()), data, static_cast<size_t>(num_bytes),
+      [](void* data, size_t length, void* arg) {
+        delete static_cast<std::shared_ptr<MappedDataFile>*>(arg);
+      },
+      new std::shared_ptr<MappedDataFile>(mapped_file));
+  out_tensor->reset(new Tensor);
+  status = TF_TensorToTensor(aliasing_tensor, out_tensor->get());
+  TF_DeleteTensor(aliasing_tensor);
+  if (!status.ok()) {
+    out_tensor->reset();
+    Set_TF_Status_from_Status(out_status, status);
+  }
+}
+
+Status CheckpointReader::GetMappedDataFile(
+    int32 shard_id, bool copy_on_write,
+    std::shared_ptr<MappedDataFile>* mapped_file) const {
+  mutex_lock l(mapped_data_files_mu_);
+  auto& cached = mapped_data_files_[std::make_pair(shard_id, copy_on_write)];
+  if (cached != nullptr) {
+    *mapped_file = cached;
+    return Status::OK();
+  }
+  BundleHeaderProto header;
+  v2_reader_->Seek(kHeaderEntryKey);
+  if (!v2_reader_->Valid() ||
+      !header.ParseFromArray(v2_reader_->value().data(),
+                             v2_reader_->value().size())) {
+    return errors::DataLoss("Unable to read the header of checkpoint \"",
+                            prefix_, "\".");
+  }
+  StringPiece scheme, host, prefix_path;
+  io::ParseURI(prefix_, &scheme, &host, &prefix_path);
+  const string filename =
+      DataFilename(prefix_path, shard_id, header.num_shards());
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return errors::NotFound("Unable to open checkpoint data file \"",
+                            filename, "\".");
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    return errors::Internal("Unable to stat checkpoint data file \"",
+                            filename, "\".");
+  }
+  const size_t length = static_cast<size_t>(file_stat.st_size);
+  void* data = nullptr;
+  if (length > 0) {
+    data = copy_on_write
+               ? mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                      fd, 0)
+               : mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  // The mapping remains valid after the file descriptor is closed.
+  close(fd);
+  if (data == MAP_FAILED) {
+    return errors::ResourceExhausted(
+        "Unable to memory-map checkpoint data file \"", filename, "\".");
+  }
+  cached = std::make_shared<MappedDataFile>(static_cast<char*>(data), length);
+  *mapped_file = cached;
+  return Status::OK();
+}
+
+void CheckpointReader::GetDeltaBase(const string& prefix, string* base_prefix,
+                                    TF_Status* out_status) {
+  BundleReader reader(Env::Default(), prefix);
+  Status status = reader.status();
+  if (status.ok()) status = ReadDeltaBase(&reader, prefix, base_prefix);
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+  }
+}
+
+bool CheckpointReader::IsDelta(const string& name) const {
+  return base_reader_ != nullptr && !v2_reader_->Contains(name) &&
+         v2_reader_->Contains(kDeltaRowsPrefix + name);
+}
+
+Status CheckpointReader::ApplyDelta(const string& name,
+                                    const TensorShape& full_shape,
+                                    const TensorSlice& slice,
+                                    Tensor* value) const {
+  const string ranges_key = kDeltaRangesPrefix + name;
+  const string rows_key = kDeltaRowsPrefix + name;
+  DataType ranges_dtype;
+  DataType rows_dtype;
+  TensorShape ranges_shape;
+  TensorShape rows_shape;
+  TF_RETURN_IF_ERROR(v2_reader_->LookupDtypeAndShape(ranges_key, &ranges_dtype,
+                                                     &ranges_shape));
+  TF_RETURN_IF_ERROR(
+      v2_reader_->LookupDtypeAndShape(rows_key, &rows_dtype, &rows_shape));
+  bool valid = full_shape.dims() >= 1 && ranges_dtype == DT_INT64 &&
+               ranges_shape.dims() == 2 && ranges_shape.dim_size(1) == 2 &&
+               rows_dtype == value->dtype() &&
+               rows_shape.dims() == full_shape.dims();
+  for (int d = 1; valid && d < full_shape.dims(); ++d) {
+    valid = rows_shape.dim_size(d) == full_shape.dim_size(d);
+  }
+  if (!valid) {
+    return errors::DataLoss("Invalid delta of tensor \"", name, "\".");
+  }
+  Tensor ranges(DT_INT64, ranges_shape);
+  Tensor rows(rows_dtype, rows_shape);
+  TF_RETURN_IF_ERROR(v2_reader_->Lookup(ranges_key, &ranges));
+  TF_RETURN_IF_ERROR(v2_reader_->Lookup(rows_key, &rows));
+
+  const int64 num_rows = full_shape.dim_size(0);
+  const int64 element_bytes = DataTypeSize(value->dtype());
+  const int64 row_bytes =
+      num_rows > 0 ? full_shape.num_elements() / num_rows * element_bytes : 0;
+  const int64 slice_start = slice.start(0);
+  const int64 slice_limit =
+      slice.IsFullAt(0) ? num_rows : slice_start + slice.length(0);
+  const int64 slice_row_bytes =
+      value->dim_size(0) > 0 ? value->TotalBytes() / value->dim_size(0) : 0;
+  const auto ranges_matrix = ranges.matrix<int64>();
+  const char* rows_data = rows.tensor_data().data();
+  char* value_data = const_cast<char*>(value->tensor_data().data());
+  int64 row_offset = 0;
+  for (int64 r = 0; r < ranges_shape.dim_size(0); ++r) {
+    const int64 start = ranges_matrix(r, 0);
+    const int64 length = ranges_matrix(r, 1);
+    if (start < 0 || length < 0 || start + length > num_rows ||
+        row_offset + length > rows_shape.dim_size(0)) {
+      return errors::DataLoss("Invalid delta row range of tensor \"", name,
+                              "\".");
+    }
+    const int64 begin = std::max(start, slice_start);
+    const int64 end = std::min(start + length, slice_limit);
+    if (begin < end) {
+      const char* source = rows_data + (row_offset + begin - start) * row_bytes;
+      char* target = value_data + (begin - slice_start) * slice_row_bytes;
+      if (slice_row_bytes == row_bytes) {
+        memcpy(target, source, (end - begin) * row_bytes);
+      } else {
+        for (int64 row = begin; row < end; ++row, source += row_bytes) {
+          CopySliceBytes(source, full_shape, slice, 1, element_bytes, &target);
+        }
+      }
+    }
+    row_offset += length;
+  }
+  return Status::OK();
+}
+
+TensorSliceReader::VarToShapeMap* CheckpointReader::BuildV2VarToShapeMap(
+    VarToDataTypeMap** var_to_data_type_map) {
   CHECK(v2_reader_ != nullptr);
   CHECK(v2_reader_->status().ok());
 
@@ -125,6 +670,7 @@ TensorSliceReader::VarToShapeMap* CheckpointReader::BuildV2VarToShapeMap() {
   // Second pass: adds the entries, ignoring the filtered keys.
   TensorSliceReader::VarToShapeMap* var_to_shape_map =
       new TensorSliceReader::VarToShapeMap;
+  *var_to_data_type_map = new VarToDataTypeMap;
   v2_reader_->Seek(kHeaderEntryKey);
   for (v2_reader_->Next(); v2_reader_->Valid(); v2_reader_->Next()) {
     if (filtered_keys.count(v2_reader_->key().ToString()) > 0) continue;
@@ -133,6 +679,33 @@ TensorSliceReader::VarToShapeMap* CheckpointReader::BuildV2VarToShapeMap() {
         << entry.InitializationErrorString();
     (*var_to_shape_map)[v2_reader_->key().ToString()] =
         TensorShape(entry.shape());
+    (**var_to_data_type_map)[v2_reader_->key().ToString()] = entry.dtype();
+  }
+
+  // For delta checkpoints, replaces the delta entries with the shapes and data
+  // types of the corresponding base checkpoint tensors.
+  if (base_reader_ != nullptr) {
+    const auto& base_shapes = base_reader_->GetVariableToShapeMap();
+    const auto& base_dtypes = base_reader_->GetVariableToDataTypeMap();
+    const size_t rows_prefix_length = strlen(kDeltaRowsPrefix);
+    std::vector<string> delta_keys;
+    for (const auto& entry : *var_to_shape_map) {
+      if (StringPiece(entry.first).starts_with(kDeltaKeysPrefix)) {
+        delta_keys.push_back(entry.first);
+      }
+    }
+    for (const string& key : delta_keys) {
+      var_to_shape_map->erase(key);
+      (*var_to_data_type_map)->erase(key);
+      if (!StringPiece(key).starts_with(kDeltaRowsPrefix)) continue;
+      const string name = key.substr(rows_prefix_length);
+      auto shape = base_shapes.find(name);
+      auto dtype = base_dtypes.find(name);
+      if (shape != base_shapes.end() && dtype != base_dtypes.end()) {
+        (*var_to_shape_map)[name] = shape->second;
+        (**var_to_data_type_map)[name] = dtype->second;
+      }
+    }
   }
   return var_to_shape_map;  // Owned by caller.
 }
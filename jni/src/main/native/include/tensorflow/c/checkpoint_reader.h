@@ -18,8 +18,15 @@ limitations under the License.
 
 #include "status_helper.h"
 
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/tensor_slice.h"
 #include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/util/tensor_bundle/tensor_bundle.h"
 #include "tensorflow/core/util/tensor_slice_reader.h"
@@ -36,8 +43,15 @@ class TensorSliceReader;
 //
 // The class currently only interacts with single-slice (i.e., non-partitioned)
 // variables.
+//
+// Delta checkpoints (written by the "IncrementalSaveV2" op) are transparently
+// merged with their base checkpoints: the tensors that were saved as deltas
+// are read from the base checkpoint and their changed rows are then
+// overwritten with the ones stored in the delta checkpoint.
 class CheckpointReader {
  public:
+  typedef std::unordered_map<string, DataType> VarToDataTypeMap;
+
   CheckpointReader(const string& filepattern, TF_Status* out_status);
   ~CheckpointReader();
 
@@ -48,21 +62,109 @@ class CheckpointReader {
   // tensor are combined into a single entry.
   const TensorSliceReader::VarToShapeMap& GetVariableToShapeMap() const;
 
+  // Returns a map from variable names to their data types. Slices of a
+  // partitioned tensor are combined into a single entry.
+  const VarToDataTypeMap& GetVariableToDataTypeMap() const;
+
   // Attempts to look up the tensor named "name" and stores the found result in
   // "out_tensor".
   void GetTensor(const string& name,
                  std::unique_ptr<tensorflow::Tensor>* out_tensor,
                  TF_Status* out_status) const;
 
+  // Looks up the data type and (full) shape of the tensor named "name".
+  void GetTensorDtypeAndShape(const string& name, DataType* dtype,
+                              TensorShape* shape, TF_Status* out_status) const;
+
+  // Reads only the slice "slice" of the tensor named "name" into
+  // "out_tensor", which must already be allocated with the tensor data type
+  // and the slice shape (e.g., as computed by TensorSlice::SliceTensorShape).
+  // The stored slices of partitioned tensors are combined as necessary.
+  void GetTensorSlice(const string& name, const TensorSlice& slice,
+                      Tensor* out_tensor, TF_Status* out_status) const;
+
+  // Looks up the tensors named "names" and stores them in "out_tensors", in
+  // the same order. For V2 checkpoints, the tensors are read concurrently by
+  // "num_threads" threads, in the order in which they are stored in the data
+  // shards, and reads only start while the total size of the tensors being
+  // read is below "max_bytes_in_flight" (a single tensor is always allowed to
+  // be read, regardless of its size). V1 checkpoints are read serially.
+  void GetTensors(const std::vector<string>& names, int num_threads,
+                  int64 max_bytes_in_flight,
+                  std::vector<std::unique_ptr<Tensor>>* out_tensors,
+                  TF_Status* out_status) const;
+
+  // Attempts to look up the tensor named "name" and stores a tensor that
+  // aliases a memory mapping of the data file holding it in "out_tensor".
+  // Mappings are shared by all tensors read from the same data file, and,
+  // because they are backed by the page cache, by all processes that map the
+  // same checkpoint. If "copy_on_write" is true, the mapping is private and
+  // writable, and pages are only copied when written to. Otherwise, the
+  // mapping is read-only and writing to the returned tensor crashes the
+  // process. The data of mapped tensors is not checksummed.
+  //
+  // Falls back to "GetTensor" for V1 checkpoints, checkpoints that are not
+  // stored on the local file system, string tensors, partitioned tensors, and
+  // tensors that are not suitably aligned in the data file (see
+  // "BundleWriter::Options::data_alignment").
+  void GetMappedTensor(const string& name, bool copy_on_write,
+                       std::unique_ptr<tensorflow::Tensor>* out_tensor,
+                       TF_Status* out_status) const;
+
+  // Stores the prefix of the base checkpoint of the V2 checkpoint "prefix" in
+  // "base_prefix", if it is a delta checkpoint, and an empty string otherwise.
+  // Only the index file of the checkpoint is read.
+  static void GetDeltaBase(const string& prefix, string* base_prefix,
+                           TF_Status* out_status);
+
  private:
+  struct MappedDataFile;
+
+  // Returns true if the tensor named "name" is stored as a delta relative to
+  // the base checkpoint.
+  bool IsDelta(const string& name) const;
+
+  // Overwrites the rows of "value" (which holds the slice "slice" of the
+  // tensor named "name", with shape "full_shape") that are stored in this
+  // delta checkpoint.
+  Status ApplyDelta(const string& name, const TensorShape& full_shape,
+                    const TensorSlice& slice, Tensor* value) const;
+
+  // Same as "GetTensors", except that it ignores the base checkpoint of delta
+  // checkpoints, and so it must only be used for tensors that are not stored
+  // as deltas.
+  void GetStoredTensors(const std::vector<string>& names, int num_threads,
+                        int64 max_bytes_in_flight,
+                        std::vector<std::unique_ptr<Tensor>>* out_tensors,
+                        TF_Status* out_status) const;
+
+  // Returns the mapping of data shard "shard_id", creating it if necessary.
+  Status GetMappedDataFile(int32 shard_id, bool copy_on_write,
+                           std::shared_ptr<MappedDataFile>* mapped_file) const;
+
   // Uses "v2_reader_" to build a "var name -> shape" map; owned by caller.
+  // Also builds the "var name -> data type" map in "var_to_data_type_map",
+  // which is owned by the caller too.
   // REQUIRES: "v2_reader_ != nullptr && v2_reader_.status().ok()".
-  TensorSliceReader::VarToShapeMap* BuildV2VarToShapeMap();
+  TensorSliceReader::VarToShapeMap* BuildV2VarToShapeMap(
+      VarToDataTypeMap** var_to_data_type_map);
+
+  // Prefix of the checkpoint, used to open additional readers for concurrent
+  // reads.
+  const string prefix_;
 
   // Invariant: exactly one of "reader_" and "v2_reader_" is non-nullptr.
+  // "base_reader_" is only non-nullptr for delta checkpoints.
   TensorSliceReader* reader_;                               // Owned.
   BundleReader* v2_reader_;                                 // Owned.
+  CheckpointReader* base_reader_;                           // Owned.
   TensorSliceReader::VarToShapeMap* var_to_shape_map_ptr_;  // Owned.
+  VarToDataTypeMap* var_to_data_type_map_ptr_;              // Owned.
+
+  // Memory mappings of the data shards, keyed by shard ID and mapping mode.
+  mutable mutex mapped_data_files_mu_;
+  mutable std::map<std::pair<int32, bool>, std::shared_ptr<MappedDataFile>>
+      mapped_data_files_ GUARDED_BY(mapped_data_files_mu_);
 
   TF_DISALLOW_COPY_AND_ASSIGN(CheckpointReader);
 };
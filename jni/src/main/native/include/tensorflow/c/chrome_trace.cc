@@ -0,0 +1,177 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/chrome_trace.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/lib/strings/stringprintf.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Escapes "s" so that it can be used within a JSON string.
+string JsonEscape(const string& s) {
+  string escaped;
+  escaped.reserve(s.size());
+  for (const char c : s) {
+    switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          strings::StrAppend(&escaped, strings::Printf("\\u%04x", c));
+        } else {
+          escaped += c;
+        }
+    }
+  }
+  return escaped;
+}
+
+// Parses a timeline label of the form "node_name = OpType(input, ...)" into
+// the op type and the (data) input tensor names.
+void ParseTimelineLabel(const string& label, string* op_type,
+                        std::vector<string>* inputs) {
+  *op_type = "Unknown";
+  inputs->clear();
+  const size_t start = label.find(" = ");
+  if (start == string::npos) return;
+  const size_t open = label.find('(', start + 3);
+  *op_type = label.substr(start + 3,
+                          open == string::npos ? open : open - start - 3);
+  if (open == string::npos) return;
+  const size_t close = label.rfind(')');
+  if (close == string::npos || close < open) return;
+  size_t begin = open + 1;
+  while (begin < close) {
+    size_t end = label.find(", ", begin);
+    if (end == string::npos || end > close) end = close;
+    string input = label.substr(begin, end - begin);
+    // Control inputs do not transfer tensors.
+    if (!input.empty() && input[0] != '^') {
+      if (input.find(':') == string::npos) input += ":0";
+      inputs->push_back(input);
+    }
+    begin = end + 2;
+  }
+}
+
+struct Producer {
+  int pid;
+  uint32 tid;
+  int64 end_micros;
+};
+
+}  // namespace
+
+string StepStatsToChromeTrace(const StepStats& step_stats, bool show_memory) {
+  std::vector<string> events;
+  std::unordered_map<string, Producer> producers;
+
+  // Devices are emitted as processes, named after the devices.
+  for (int pid = 0; pid < step_stats.dev_stats_size(); ++pid) {
+    events.push_back(strings::Printf(
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":"
+        "\"%s\"}}",
+        pid, JsonEscape(step_stats.dev_stats(pid).device()).c_str()));
+    for (const NodeExecStats& node : step_stats.dev_stats(pid).node_stats()) {
+      const int64 end_micros =
+          node.all_start_micros() + node.all_end_rel_micros();
+      for (const NodeOutput& output : node.output()) {
+        producers[strings::StrCat(node.node_name(), ":", output.slot())] =
+            Producer{pid, node.thread_id(), end_micros};
+      }
+      producers.emplace(strings::StrCat(node.node_name(), ":0"),
+                        Producer{pid, node.thread_id(), end_micros});
+    }
+  }
+
+  int64 flow_id = 0;
+  string op_type;
+  std::vector<string> inputs;
+  for (int pid = 0; pid < step_stats.dev_stats_size(); ++pid) {
+    for (const NodeExecStats& node : step_stats.dev_stats(pid).node_stats()) {
+      ParseTimelineLabel(node.timeline_label(), &op_type, &inputs);
+      const long long start_micros =
+          static_cast<long long>(node.all_start_micros());
+      events.push_back(strings::Printf(
+          "{\"name\":\"%s\",\"cat\":\"Op\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,"
+          "\"ts\":%lld,\"dur\":%lld,\"args\":{\"name\":\"%s\","
+          "\"label\":\"%s\"}}",
+          JsonEscape(op_type).c_str(), pid, node.thread_id(), start_micros,
+          static_cast<long long>(node.all_end_rel_micros()),
+          JsonEscape(node.node_name()).c_str(),
+          JsonEscape(node.timeline_label()).c_str()));
+
+      // Tensor transfers between devices.
+      for (const string& input : inputs) {
+        const auto producer = producers.find(input);
+        if (producer == producers.end() || producer->second.pid == pid)
+          continue;
+        const string name = JsonEscape(input);
+        events.push_back(strings::Printf(
+            "{\"name\":\"%s\",\"cat\":\"DataFlow\",\"ph\":\"s\",\"id\":%lld,"
+            "\"pid\":%d,\"tid\":%u,\"ts\":%lld}",
+            name.c_str(), static_cast<long long>(flow_id), producer->second.pid,
+            producer->second.tid,
+            static_cast<long long>(producer->second.end_micros)));
+        events.push_back(strings::Printf(
+            "{\"name\":\"%s\",\"cat\":\"DataFlow\",\"ph\":\"t\",\"id\":%lld,"
+            "\"pid\":%d,\"tid\":%u,\"ts\":%lld}",
+            name.c_str(), static_cast<long long>(flow_id), pid,
+            node.thread_id(), start_micros));
+        ++flow_id;
+      }
+
+      // Memory in use by each allocator, right after the op has run.
+      if (show_memory) {
+        for (const AllocatorMemoryUsed& memory : node.memory()) {
+          events.push_back(strings::Printf(
+              "{\"name\":\"%s\",\"cat\":\"Memory\",\"ph\":\"C\",\"pid\":%d,"
+              "\"ts\":%lld,\"args\":{\"allocator_bytes_in_use\":%lld,"
+              "\"op_bytes\":%lld}}",
+              JsonEscape(memory.allocator_name()).c_str(), pid,
+              static_cast<long long>(node.all_start_micros() +
+                                     node.all_end_rel_micros()),
+              static_cast<long long>(memory.allocator_bytes_in_use()),
+              static_cast<long long>(memory.total_bytes())));
+        }
+      }
+    }
+  }
+
+  string trace = "{\"traceEvents\":[";
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (i > 0) trace += ",\n";
+    trace += events[i];
+  }
+  trace += "]}\n";
+  return trace;
+}
+
+Status WriteChromeTrace(const StepStats& step_stats, const string& filename,
+                        bool show_memory) {
+  return WriteStringToFile(Env::Default(), filename,
+                           StepStatsToChromeTrace(step_stats, show_memory));
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,41 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_CHROME_TRACE_H_
+#define TENSORFLOW_C_CHROME_TRACE_H_
+
+#include "tensorflow/core/framework/step_stats.pb.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Converts the execution statistics of a session step into a JSON document
+// in the Chrome trace event format, which can be viewed using
+// "chrome://tracing". Devices are shown as processes and the threads that
+// executed ops on them as threads. Tensors that are consumed on a different
+// device than the one that produced them are shown as flow arrows between the
+// producing and the consuming ops. If "show_memory" is true, the memory in use
+// by each allocator is also shown, as counters.
+string StepStatsToChromeTrace(const StepStats& step_stats, bool show_memory);
+
+// Writes the output of "StepStatsToChromeTrace" to "filename", which may use
+// any file system supported by TensorFlow.
+Status WriteChromeTrace(const StepStats& step_stats, const string& filename,
+                        bool show_memory);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_CHROME_TRACE_H_
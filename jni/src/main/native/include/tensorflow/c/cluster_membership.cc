@@ -0,0 +1,138 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/cluster_membership.h"
+
+#include <unordered_set>
+
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+
+namespace tensorflow {
+namespace {
+
+// Returns the address of task "task_index" of job "job_name" in "cluster", or an empty string if there is no such task.
+string TaskAddress(const ClusterDef& cluster, const string& job_name, int32 task_index) {
+  for (const JobDef& job : cluster.job()) {
+    if (job.name() != job_name) continue;
+    auto task = job.tasks().find(task_index);
+    return task == job.tasks().end() ? string() : task->second;
+  }
+  return string();
+}
+
+}  // namespace
+
+ClusterMembership* ClusterMembership::Global() {
+  static ClusterMembership* membership = new ClusterMembership;
+  return membership;
+}
+
+void ClusterMembership::Register(const string& target, const ServerDef& server_def) {
+  mutex_lock l(mu_);
+  if (memberships_.count(target) > 0) return;
+  Membership& membership = memberships_[target];
+  membership.job_name = server_def.job_name();
+  membership.task_index = server_def.task_index();
+  membership.address = TaskAddress(server_def.cluster(), server_def.job_name(), server_def.task_index());
+  membership.cluster = server_def.cluster();
+}
+
+void ClusterMembership::Unregister(const string& target) {
+  mutex_lock l(mu_);
+  memberships_.erase(target);
+}
+
+Status ClusterMembership::SetCluster(Membership* membership, const ClusterDef& cluster, int64* version) {
+  std::unordered_set<string> job_names;
+  for (const JobDef& job : cluster.job()) {
+    if (job.name().empty()) return errors::InvalidArgument("The cluster contains a job with an empty name.");
+    if (!job_names.insert(job.name()).second)
+      return errors::InvalidArgument("The cluster contains job '", job.name(), "' more than once.");
+    for (const auto& task : job.tasks()) {
+      if (task.first < 0 || task.second.empty())
+        return errors::InvalidArgument(
+            "Task ", task.first, " of job '", job.name(), "' must have a non-negative index and a non-empty address.");
+    }
+  }
+  const string address = TaskAddress(cluster, membership->job_name, membership->task_index);
+  if (address != membership->address)
+    return errors::InvalidArgument(
+        "The cluster must contain the task of the server itself (i.e., task ", membership->task_index, " of job '",
+        membership->job_name, "', at address '", membership->address, "'), but ",
+        address.empty() ? string("it does not") : strings::StrCat("its address is '", address, "'"), ".");
+  membership->cluster = cluster;
+  *version = ++membership->version;
+  return Status::OK();
+}
+
+Status ClusterMembership::Update(const string& target, const ClusterDef& cluster, int64* version) {
+  mutex_lock l(mu_);
+  auto membership = memberships_.find(target);
+  if (membership == memberships_.end()) return errors::NotFound("No server with target '", target, "' was found.");
+  return SetCluster(&membership->second, cluster, version);
+}
+
+Status ClusterMembership::AddTask(const string& target, const string& job_name, int32 task_index,
+                                  const string& address, int64* version) {
+  mutex_lock l(mu_);
+  auto membership = memberships_.find(target);
+  if (membership == memberships_.end()) return errors::NotFound("No server with target '", target, "' was found.");
+  ClusterDef cluster = membership->second.cluster;
+  JobDef* job = nullptr;
+  for (JobDef& existing_job : *cluster.mutable_job())
+    if (existing_job.name() == job_name) job = &existing_job;
+  if (job == nullptr) {
+    job = cluster.add_job();
+    job->set_name(job_name);
+  }
+  (*job->mutable_tasks())[task_index] = address;
+  return SetCluster(&membership->second, cluster, version);
+}
+
+Status ClusterMembership::RemoveTask(const string& target, const string& job_name, int32 task_index, int64* version) {
+  mutex_lock l(mu_);
+  auto membership = memberships_.find(target);
+  if (membership == memberships_.end()) return errors::NotFound("No server with target '", target, "' was found.");
+  ClusterDef cluster;
+  bool removed = false;
+  for (const JobDef& job : membership->second.cluster.job()) {
+    JobDef* updated_job = cluster.add_job();
+    *updated_job = job;
+    if (job.name() == job_name) removed = updated_job->mutable_tasks()->erase(task_index) > 0;
+    if (updated_job->tasks().empty()) cluster.mutable_job()->RemoveLast();
+  }
+  if (!removed) return errors::NotFound("Task ", task_index, " of job '", job_name, "' is not part of the cluster.");
+  return SetCluster(&membership->second, cluster, version);
+}
+
+Status ClusterMembership::Get(const string& target, ClusterDef* cluster, int64* version) {
+  mutex_lock l(mu_);
+  auto membership = memberships_.find(target);
+  if (membership == memberships_.end()) return errors::NotFound("No server with target '", target, "' was found.");
+  *cluster = membership->second.cluster;
+  *version = membership->second.version;
+  return Status::OK();
+}
+
+bool ClusterMembership::Apply(const string& target, ConfigProto* config) {
+  mutex_lock l(mu_);
+  auto membership = memberships_.find(target);
+  if (membership == memberships_.end() || membership->second.version == 0) return false;
+  *config->mutable_cluster_def() = membership->second.cluster;
+  return true;
+}
+
+}  // namespace tensorflow
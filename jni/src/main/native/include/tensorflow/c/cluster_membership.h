@@ -0,0 +1,98 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_CLUSTER_MEMBERSHIP_H_
+#define TENSORFLOW_C_CLUSTER_MEMBERSHIP_H_
+
+#include <unordered_map>
+
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/protobuf/cluster.pb.h"
+#include "tensorflow/core/protobuf/config.pb.h"
+#include "tensorflow/core/protobuf/tensorflow_server.pb.h"
+
+namespace tensorflow {
+
+// Process-wide registry of the current cluster membership of the servers created through the JNI bindings, keyed by
+// their session targets.
+//
+// The cluster in the "ServerDef" of a server is fixed for its whole lifetime, but the master of a server creates a
+// separate worker cache (whose channels are established lazily, when first used) for each session whose configuration
+// includes a "cluster_def". Once the cluster of a server has been updated, the sessions created on its target are
+// configured with the current cluster, and so workers can be added and removed without restarting any servers. The
+// servers of the added workers must be created with a cluster that includes them. Sessions that were created before
+// an update keep using the cluster they were created with, and they can use the membership version to detect that
+// they must be recreated. All methods are safe for concurrent use.
+class ClusterMembership {
+ public:
+  // Returns the process-wide registry.
+  static ClusterMembership* Global();
+
+  // Registers the server with target "target", whose initial cluster is "server_def.cluster()", with version 0.
+  // Registering a server that is already registered (e.g., a detached server that is reattached) keeps its current
+  // cluster.
+  void Register(const string& target, const ServerDef& server_def);
+
+  // Unregisters the server with target "target".
+  void Unregister(const string& target);
+
+  // Replaces the cluster of the server with target "target" by "cluster", which must still contain the task of the
+  // server itself, with the same address, and stores the new version of its membership in "version".
+  Status Update(const string& target, const ClusterDef& cluster, int64* version);
+
+  // Adds task "task_index" of job "job_name", at "address", to the cluster of the server with target "target", or
+  // changes its address, if it already exists. The job is created if it does not exist.
+  Status AddTask(const string& target, const string& job_name, int32 task_index, const string& address,
+                 int64* version);
+
+  // Removes task "task_index" of job "job_name" from the cluster of the server with target "target". Jobs that are
+  // left without tasks are removed.
+  Status RemoveTask(const string& target, const string& job_name, int32 task_index, int64* version);
+
+  // Stores the current cluster of the server with target "target" in "cluster", and its version in "version".
+  Status Get(const string& target, ClusterDef* cluster, int64* version);
+
+  // Sets the cluster of "config" to the current cluster of the server with target "target", if that has been updated
+  // since the server was created, and returns "true" if it did.
+  bool Apply(const string& target, ConfigProto* config);
+
+ private:
+  struct Membership {
+    // Job name, task index, and address of the server itself.
+    string job_name;
+    int32 task_index;
+    string address;
+    ClusterDef cluster;
+    int64 version = 0;
+  };
+
+  ClusterMembership() = default;
+
+  // Validates "cluster" as a new cluster for "membership" and, if valid, makes it its current cluster. Requires "mu_"
+  // to be held.
+  Status SetCluster(Membership* membership, const ClusterDef& cluster, int64* version);
+
+  mutex mu_;
+  std::unordered_map<string, Membership> memberships_ GUARDED_BY(mu_);
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ClusterMembership);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_CLUSTER_MEMBERSHIP_H_
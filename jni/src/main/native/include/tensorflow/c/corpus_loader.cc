@@ -0,0 +1,316 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/corpus_loader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "delimiter_matcher.h"
+#include "tensorflow/c/native_executor.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/lib/hash/hash.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/file_system.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Number of shards of the concurrent token count map, each of which is protected by its own mutex.
+const int kNumCountShards = 64;
+
+// Number of bytes read at a time past the end of a chunk, while looking for the end of its last token.
+const int64 kOverhangReadSize = 4096;
+
+struct StringPieceHash {
+  size_t operator()(StringPiece piece) const { return static_cast<size_t>(Hash64(piece.data(), piece.size())); }
+};
+
+// Range of a file that is tokenized by a single task. A chunk owns the tokens that start in its range (and so the last
+// one may end past the range) along with the newlines in its range.
+struct Chunk {
+  size_t file;
+  int64 start;
+  int64 limit;
+  // Distinct tokens of the chunk, indexed by their local IDs, and their number of occurrences in the chunk.
+  std::vector<string> tokens;
+  std::vector<int64> counts;
+  // Local ID of each token of the chunk, in order.
+  std::vector<int32> ids;
+  // Vocabulary ID of each distinct token of the chunk, or -1 for dropped tokens.
+  std::vector<int32> vocabulary_ids;
+  int64 num_kept = 0;
+  int64 offset = 0;
+};
+
+// Concurrent map from tokens to their number of occurrences, which is sharded by token hash.
+class TokenCounts {
+ public:
+  // Adds the counts of the tokens of a chunk, locking each shard only once.
+  void Add(const std::vector<string>& tokens, const std::vector<int64>& counts) {
+    std::vector<std::vector<size_t>> indices(kNumCountShards);
+    for (size_t i = 0; i < tokens.size(); ++i) indices[ShardOf(tokens[i])].push_back(i);
+    for (int s = 0; s < kNumCountShards; ++s) {
+      if (indices[s].empty()) continue;
+      std::lock_guard<std::mutex> lock(shards_[s].mu);
+      for (size_t i : indices[s]) shards_[s].counts[tokens[i]] += counts[i];
+    }
+  }
+
+  // Moves the counts of all tokens that occur at least "min_count" times to "entries", and returns the total count of
+  // the remaining tokens. Must not be called concurrently with "Add".
+  int64 Extract(int64 min_count, std::vector<std::pair<string, int64>>* entries) {
+    int64 dropped_count = 0;
+    for (int s = 0; s < kNumCountShards; ++s) {
+      for (auto& entry : shards_[s].counts) {
+        if (entry.second >= min_count)
+          entries->emplace_back(std::move(entry.first), entry.second);
+        else
+          dropped_count += entry.second;
+      }
+      shards_[s].counts.clear();
+    }
+    return dropped_count;
+  }
+
+ private:
+  static int ShardOf(const string& token) {
+    return static_cast<int>(Hash64(token.data(), token.size()) % kNumCountShards);
+  }
+
+  struct Shard {
+    std::mutex mu;
+    std::unordered_map<string, int64> counts;
+  };
+
+  Shard shards_[kNumCountShards];
+};
+
+// Appends up to "n" bytes of "file", starting at "offset", to "buffer", stopping early at the end of the file.
+Status AppendRange(RandomAccessFile* file, int64 offset, int64 n, string* buffer) {
+  const size_t size = buffer->size();
+  buffer->resize(size + static_cast<size_t>(n));
+  char* scratch = &(*buffer)[size];
+  StringPiece result;
+  Status status = file->Read(static_cast<uint64>(offset), static_cast<size_t>(n), &result, scratch);
+  if (!status.ok() && !errors::IsOutOfRange(status)) return status;
+  if (result.data() != scratch) std::memmove(scratch, result.data(), result.size());
+  buffer->resize(size + result.size());
+  return Status::OK();
+}
+
+Status TokenizeChunk(RandomAccessFile* file, int64 file_size, const DelimiterMatcher& matcher,
+                     const string& end_of_line_token, Chunk* chunk) {
+  // The byte before the chunk determines whether its first token started in the previous chunk.
+  const int64 read_start = std::max<int64>(chunk->start - 1, 0);
+  string buffer;
+  TF_RETURN_IF_ERROR(AppendRange(file, read_start, chunk->limit - read_start, &buffer));
+  int64 scan_start = chunk->limit - read_start;
+  while (true) {
+    const int64 size = static_cast<int64>(buffer.size());
+    if (matcher.Find(buffer.data(), size, std::min(scan_start, size)) < size) break;
+    const int64 read_end = read_start + size;
+    if (read_end >= file_size) break;
+    TF_RETURN_IF_ERROR(
+        AppendRange(file, read_end, std::min(kOverhangReadSize, file_size - read_end), &buffer));
+    if (static_cast<int64>(buffer.size()) == size) break;
+    scan_start = size;
+  }
+
+  const char* data = buffer.data();
+  const int64 size = static_cast<int64>(buffer.size());
+  const int64 limit = std::min(chunk->limit - read_start, size);
+  int64 i = chunk->start - read_start;
+  if (i > 0 && !matcher.IsDelimiter(data[i - 1])) i = matcher.Find(data, size, i);
+  std::unordered_map<StringPiece, int32, StringPieceHash> local_ids;
+  auto add = [chunk, &local_ids](StringPiece token) {
+    const auto inserted = local_ids.emplace(token, static_cast<int32>(chunk->tokens.size()));
+    if (inserted.second) {
+      chunk->tokens.emplace_back(token.data(), token.size());
+      chunk->counts.push_back(0);
+    }
+    ++chunk->counts[inserted.first->second];
+    chunk->ids.push_back(inserted.first->second);
+  };
+  while (i < limit) {
+    if (matcher.IsDelimiter(data[i])) {
+      if (data[i] == '\n' && !end_of_line_token.empty()) add(end_of_line_token);
+      ++i;
+      continue;
+    }
+    const int64 end = matcher.Find(data, size, i);
+    add(StringPiece(data + i, end - i));
+    i = end;
+  }
+  return Status::OK();
+}
+
+// Sorts the vocabulary by decreasing count, breaking ties lexicographically, so that it does not depend on the number
+// of threads, and applies the size limit and the unknown token.
+void BuildVocabulary(const CorpusLoaderOptions& options, int64 dropped_count,
+                     std::vector<std::pair<string, int64>>* entries) {
+  std::sort(entries->begin(), entries->end(),
+            [](const std::pair<string, int64>& a, const std::pair<string, int64>& b) {
+              return a.second != b.second ? a.second > b.second : a.first < b.first;
+            });
+  const int64 max_size = options.max_vocabulary_size;
+  auto truncate = [entries, &dropped_count](int64 size) {
+    while (static_cast<int64>(entries->size()) > size) {
+      dropped_count += entries->back().second;
+      entries->pop_back();
+    }
+  };
+  if (max_size > 0) truncate(max_size);
+  if (options.unknown_token.empty()) return;
+  for (auto& entry : *entries) {
+    if (entry.first == options.unknown_token) {
+      entry.second += dropped_count;
+      return;
+    }
+  }
+  if (max_size > 0) truncate(max_size - 1);
+  entries->emplace_back(options.unknown_token, dropped_count);
+}
+
+Status LoadCorpusInternal(const std::vector<string>& filenames, const CorpusLoaderOptions& options, Corpus* corpus) {
+  if (options.chunk_size <= 0)
+    return errors::InvalidArgument("The chunk size (", options.chunk_size, ") must be positive.");
+  Env* env = Env::Default();
+  std::vector<std::unique_ptr<RandomAccessFile>> files(filenames.size());
+  std::vector<int64> file_sizes(filenames.size());
+  std::vector<Chunk> chunks;
+  for (size_t f = 0; f < filenames.size(); ++f) {
+    uint64 file_size;
+    TF_RETURN_IF_ERROR(env->GetFileSize(filenames[f], &file_size));
+    TF_RETURN_IF_ERROR(env->NewRandomAccessFile(filenames[f], &files[f]));
+    const int64 size = static_cast<int64>(file_size);
+    file_sizes[f] = size;
+    for (int64 start = 0; start < size; start += options.chunk_size) {
+      Chunk chunk;
+      chunk.file = f;
+      chunk.start = start;
+      chunk.limit = std::min(start + options.chunk_size, size);
+      chunks.push_back(std::move(chunk));
+    }
+  }
+
+  NativeExecutor* executor = NativeExecutor::Global();
+  const int64 num_chunks = static_cast<int64>(chunks.size());
+  const DelimiterMatcher matcher(options.delimiters + "\n");
+  TokenCounts token_counts;
+  std::vector<Status> statuses(chunks.size());
+  executor->ParallelFor(NativeExecutor::kCorpusLoading, num_chunks, executor->NumThreads(), [&](int64 c) {
+    Chunk& chunk = chunks[c];
+    Status status =
+        TokenizeChunk(files[chunk.file].get(), file_sizes[chunk.file], matcher, options.end_of_line_token, &chunk);
+    if (status.ok()) token_counts.Add(chunk.tokens, chunk.counts);
+    std::vector<int64>().swap(chunk.counts);
+    statuses[c] = status;
+  });
+  for (const Status& status : statuses) TF_RETURN_IF_ERROR(status);
+
+  std::vector<std::pair<string, int64>> entries;
+  const int64 dropped_count = token_counts.Extract(options.min_count, &entries);
+  BuildVocabulary(options, dropped_count, &entries);
+  if (entries.size() > static_cast<size_t>(kint32max))
+    return errors::ResourceExhausted("The vocabulary has ", entries.size(), " tokens, which is more than the ",
+                                     kint32max, " supported.");
+  std::unordered_map<StringPiece, int32, StringPieceHash> vocabulary_ids;
+  for (size_t i = 0; i < entries.size(); ++i) vocabulary_ids.emplace(entries[i].first, static_cast<int32>(i));
+  int32 unknown_id = -1;
+  if (!options.unknown_token.empty()) unknown_id = vocabulary_ids[options.unknown_token];
+
+  executor->ParallelFor(NativeExecutor::kCorpusLoading, num_chunks, executor->NumThreads(), [&](int64 c) {
+    Chunk& chunk = chunks[c];
+    chunk.vocabulary_ids.resize(chunk.tokens.size());
+    for (size_t i = 0; i < chunk.tokens.size(); ++i) {
+      const auto it = vocabulary_ids.find(chunk.tokens[i]);
+      chunk.vocabulary_ids[i] = it == vocabulary_ids.end() ? unknown_id : it->second;
+    }
+    std::vector<string>().swap(chunk.tokens);
+    for (int32 id : chunk.ids)
+      if (chunk.vocabulary_ids[id] >= 0) ++chunk.num_kept;
+  });
+
+  const int64 num_files = static_cast<int64>(filenames.size());
+  const int64_t num_offsets = num_files + 1;
+  corpus->file_offsets = TF_AllocateTensor(TF_INT64, &num_offsets, 1, num_offsets * sizeof(int64));
+  int64* file_offsets = static_cast<int64*>(TF_TensorData(corpus->file_offsets));
+  int64_t num_tokens = 0;
+  size_t next_file = 0;
+  for (Chunk& chunk : chunks) {
+    while (next_file <= chunk.file) file_offsets[next_file++] = num_tokens;
+    chunk.offset = num_tokens;
+    num_tokens += chunk.num_kept;
+  }
+  while (next_file <= filenames.size()) file_offsets[next_file++] = num_tokens;
+
+  corpus->ids = TF_AllocateTensor(TF_INT32, &num_tokens, 1, num_tokens * sizeof(int32));
+  int32* ids = static_cast<int32*>(TF_TensorData(corpus->ids));
+  executor->ParallelFor(NativeExecutor::kCorpusLoading, num_chunks, executor->NumThreads(), [&](int64 c) {
+    Chunk& chunk = chunks[c];
+    int32* output = ids + chunk.offset;
+    for (int32 id : chunk.ids) {
+      const int32 vocabulary_id = chunk.vocabulary_ids[id];
+      if (vocabulary_id >= 0) *output++ = vocabulary_id;
+    }
+    std::vector<int32>().swap(chunk.ids);
+  });
+
+  const int64_t vocabulary_size = static_cast<int64_t>(entries.size());
+  corpus->counts = TF_AllocateTensor(TF_INT64, &vocabulary_size, 1, vocabulary_size * sizeof(int64));
+  int64* counts = static_cast<int64*>(TF_TensorData(corpus->counts));
+  size_t encoded_size = entries.size() * sizeof(uint64);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    counts[i] = entries[i].second;
+    encoded_size += TF_StringEncodedSize(entries[i].first.size());
+  }
+  corpus->vocabulary = TF_AllocateTensor(TF_STRING, &vocabulary_size, 1, encoded_size);
+  char* data = static_cast<char*>(TF_TensorData(corpus->vocabulary));
+  uint64* offsets = reinterpret_cast<uint64*>(data);
+  char* values = data + entries.size() * sizeof(uint64);
+  char* destination = values;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  for (size_t i = 0; i < entries.size() && TF_GetCode(status.get()) == TF_OK; ++i) {
+    offsets[i] = static_cast<uint64>(destination - values);
+    destination += TF_StringEncode(
+        entries[i].first.data(), entries[i].first.size(), destination, data + encoded_size - destination,
+        status.get());
+  }
+  return StatusFromTF_Status(status.get());
+}
+
+}  // namespace
+
+void LoadCorpus(const std::vector<string>& filenames, const CorpusLoaderOptions& options, Corpus* corpus,
+                TF_Status* status) {
+  const Status s = LoadCorpusInternal(filenames, options, corpus);
+  if (!s.ok()) {
+    for (TF_Tensor** tensor : {&corpus->ids, &corpus->file_offsets, &corpus->vocabulary, &corpus->counts}) {
+      if (*tensor != nullptr) TF_DeleteTensor(*tensor);
+      *tensor = nullptr;
+    }
+  }
+  Set_TF_Status_from_Status(status, s);
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,69 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_CORPUS_LOADER_H_
+#define TENSORFLOW_C_CORPUS_LOADER_H_
+
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+struct CorpusLoaderOptions {
+  // Bytes that separate tokens. A newline always separates tokens, even if it is not included.
+  string delimiters = " \t\r\n\v\f";
+  // Token appended at the end of each line, or none if empty.
+  string end_of_line_token;
+  // Token to which out-of-vocabulary tokens are mapped. If empty, out-of-vocabulary tokens are dropped.
+  string unknown_token;
+  // Minimum number of occurrences of the tokens included in the vocabulary.
+  int64 min_count = 1;
+  // Maximum size of the vocabulary (including the unknown token, if any), or unbounded if non-positive.
+  int64 max_vocabulary_size = 0;
+  // Number of bytes of each chunk that is tokenized by a single thread.
+  int64 chunk_size = 16 * 1024 * 1024;
+};
+
+// Vocabulary and token IDs of a text corpus, which are owned by the caller.
+struct Corpus {
+  // Rank-1 TF_INT32 tensor with the IDs of the tokens of all files, in order.
+  TF_Tensor* ids = nullptr;
+  // Rank-1 TF_INT64 tensor with the offsets in "ids" at which the tokens of each file start, followed by the total
+  // number of tokens.
+  TF_Tensor* file_offsets = nullptr;
+  // Rank-1 TF_STRING tensor with the vocabulary, where the ID of each token is its index.
+  TF_Tensor* vocabulary = nullptr;
+  // Rank-1 TF_INT64 tensor with the number of occurrences of each vocabulary token. The count of the unknown token
+  // includes the occurrences of all out-of-vocabulary tokens.
+  TF_Tensor* counts = nullptr;
+};
+
+// Loads a text corpus (e.g., for language modeling) from "filenames", building its vocabulary and converting its tokens
+// to IDs, without materializing the tokens themselves.
+//
+// The files are read in chunks of "options.chunk_size" bytes, which are tokenized in parallel on the native executor,
+// using SIMD instructions to find the delimiters, when those are available. Each chunk counts its distinct tokens in a
+// local hash map and then merges the counts into a sharded, concurrent hash map, while it only keeps the local IDs of
+// its tokens. The vocabulary is sorted by decreasing count (breaking ties lexicographically), and the local IDs are
+// finally translated to vocabulary IDs, in parallel, directly into the output tensor.
+void LoadCorpus(const std::vector<string>& filenames, const CorpusLoaderOptions& options, Corpus* corpus,
+                TF_Status* status);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_CORPUS_LOADER_H_
@@ -0,0 +1,429 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/csv_reader.h"
+
+#include <cstring>
+#include <unordered_set>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "tensorflow/c/block_cache.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/strings/numbers.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/file_system.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Returns a pointer to the first byte in [begin, end) that is equal to "a" or
+// to "b", or "end" if there is no such byte. Blocks of 16 bytes are compared
+// at once when SSE2 instructions are available.
+inline const char* FindEither(const char* begin, const char* end, char a,
+                              char b) {
+#ifdef __SSE2__
+  const __m128i a_block = _mm_set1_epi8(a);
+  const __m128i b_block = _mm_set1_epi8(b);
+  while (end - begin >= 16) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    const int mask = _mm_movemask_epi8(_mm_or_si128(
+        _mm_cmpeq_epi8(block, a_block), _mm_cmpeq_epi8(block, b_block)));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+    begin += 16;
+  }
+#endif
+  for (; begin < end; ++begin) {
+    if (*begin == a || *begin == b) return begin;
+  }
+  return end;
+}
+
+// Parses "field" as a number of type "dtype" and stores it in "value".
+// Returns false if "field" is not a valid number of that type.
+bool ParseNumber(TF_DataType dtype, StringPiece field, void* value) {
+  switch (dtype) {
+    case TF_INT32:
+      return strings::safe_strto32(field, static_cast<int32*>(value));
+    case TF_INT64:
+      return strings::safe_strto64(field, static_cast<int64*>(value));
+    case TF_FLOAT:
+    case TF_DOUBLE: {
+      // The floating-point parsers require null-terminated strings.
+      char buffer[128];
+      if (field.size() >= sizeof(buffer)) return false;
+      memcpy(buffer, field.data(), field.size());
+      buffer[field.size()] = '\0';
+      if (dtype == TF_FLOAT)
+        return strings::safe_strtof(buffer, static_cast<float*>(value));
+      return strings::safe_strtod(buffer, static_cast<double*>(value));
+    }
+    default:
+      return false;
+  }
+}
+
+const char* DataTypeName(TF_DataType dtype) {
+  switch (dtype) {
+    case TF_INT32:
+      return "int32";
+    case TF_INT64:
+      return "int64";
+    case TF_FLOAT:
+      return "float";
+    case TF_DOUBLE:
+      return "double";
+    default:
+      return "string";
+  }
+}
+
+}  // namespace
+
+CsvReader* CsvReader::New(const string& filename, char delimiter,
+                          bool use_quotes, int skip_header_lines,
+                          const std::vector<int>& columns,
+                          const std::vector<TF_DataType>& dtypes,
+                          const std::vector<string>& defaults,
+                          const std::vector<bool>& has_defaults,
+                          size_t block_size, TF_Status* out_status) {
+  Status status;
+  if (columns.empty()) {
+    status = errors::InvalidArgument("At least one column must be projected.");
+  } else if (dtypes.size() != columns.size()) {
+    status = errors::InvalidArgument(
+        "The number of data types (", dtypes.size(),
+        ") must match the number of columns (", columns.size(), ").");
+  } else if ((!defaults.empty() && defaults.size() != columns.size()) ||
+             has_defaults.size() != defaults.size()) {
+    status = errors::InvalidArgument(
+        "There must be either no defaults or one per column.");
+  } else if (delimiter == '\n' || delimiter == '\r' ||
+             (use_quotes && delimiter == '"')) {
+    status = errors::InvalidArgument("Invalid delimiter '",
+                                     string(1, delimiter), "'.");
+  } else if (block_size == 0) {
+    status = errors::InvalidArgument("The block size must be positive.");
+  }
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+    return nullptr;
+  }
+
+  std::unique_ptr<RandomAccessFile> file;
+  status = NewCachedRandomAccessFile(filename, &file);
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+    return nullptr;
+  }
+  std::unique_ptr<CsvReader> reader(
+      new CsvReader(std::move(file), delimiter, use_quotes, block_size));
+  std::unordered_set<int> seen;
+  for (size_t i = 0; i < columns.size() && status.ok(); ++i) {
+    if (columns[i] < 0 || !seen.insert(columns[i]).second) {
+      status = errors::InvalidArgument("Column index ", columns[i],
+                                       " is negative or repeated.");
+      break;
+    }
+    if (dtypes[i] != TF_INT32 && dtypes[i] != TF_INT64 &&
+        dtypes[i] != TF_FLOAT && dtypes[i] != TF_DOUBLE &&
+        dtypes[i] != TF_STRING) {
+      status = errors::InvalidArgument("Unsupported data type ", dtypes[i],
+                                       " for column ", columns[i], ".");
+      break;
+    }
+    if (static_cast<size_t>(columns[i]) >= reader->slots_.size())
+      reader->slots_.resize(columns[i] + 1, -1);
+    reader->slots_[columns[i]] = static_cast<int>(i);
+    Column column;
+    column.dtype = dtypes[i];
+    column.has_default = !defaults.empty() && has_defaults[i];
+    if (column.has_default && dtypes[i] == TF_STRING) {
+      column.default_string = defaults[i];
+    } else if (column.has_default &&
+               !ParseNumber(dtypes[i], defaults[i], column.default_value)) {
+      status = errors::InvalidArgument(
+          "The default value '", defaults[i], "' of column ", columns[i],
+          " is not a valid ", DataTypeName(dtypes[i]), ".");
+    }
+    reader->columns_.push_back(std::move(column));
+  }
+  if (status.ok()) status = reader->SkipLines(skip_header_lines);
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+    return nullptr;
+  }
+  return reader.release();
+}
+
+CsvReader::CsvReader(std::unique_ptr<RandomAccessFile> file, char delimiter,
+                     bool use_quotes, size_t block_size)
+    : file_(std::move(file)),
+      delimiter_(delimiter),
+      use_quotes_(use_quotes),
+      buffer_(block_size, '\0') {}
+
+CsvReader::~CsvReader() {
+  for (Column& column : columns_) {
+    if (column.tensor != nullptr) TF_DeleteTensor(column.tensor);
+  }
+}
+
+Status CsvReader::Refill() {
+  if (pos_ > 0) {
+    memmove(&buffer_[0], buffer_.data() + pos_, limit_ - pos_);
+    limit_ -= pos_;
+    pos_ = 0;
+  }
+  // Records that do not fit in the buffer make it grow.
+  if (limit_ == buffer_.size()) buffer_.resize(2 * buffer_.size());
+  char* scratch = &buffer_[limit_];
+  StringPiece result;
+  Status status =
+      file_->Read(file_offset_, buffer_.size() - limit_, &result, scratch);
+  if (result.data() != scratch) memmove(scratch, result.data(), result.size());
+  limit_ += result.size();
+  file_offset_ += result.size();
+  if (errors::IsOutOfRange(status) || (status.ok() && result.empty())) {
+    eof_ = true;
+    return Status::OK();
+  }
+  return status;
+}
+
+Status CsvReader::SkipLines(int num_lines) {
+  while (num_lines > 0) {
+    const char* begin = buffer_.data() + pos_;
+    const void* newline = memchr(begin, '\n', limit_ - pos_);
+    if (newline != nullptr) {
+      pos_ += static_cast<const char*>(newline) - begin + 1;
+      ++line_number_;
+      --num_lines;
+    } else if (eof_) {
+      pos_ = limit_;
+      return Status::OK();
+    } else {
+      TF_RETURN_IF_ERROR(Refill());
+    }
+  }
+  return Status::OK();
+}
+
+Status CsvReader::Decode(int column, int64 row, StringPiece field) {
+  Column& output = columns_[slots_[column]];
+  if (output.dtype == TF_STRING) {
+    if (field.empty() && output.has_default)
+      output.strings[row] = output.default_string;
+    else
+      output.strings[row].assign(field.data(), field.size());
+    return Status::OK();
+  }
+  const size_t size = TF_DataTypeSize(output.dtype);
+  char* value = static_cast<char*>(TF_TensorData(output.tensor)) + row * size;
+  if (field.empty()) {
+    if (!output.has_default)
+      return errors::InvalidArgument("Field ", column, " of line ",
+                                     line_number_ + 1,
+                                     " is empty and has no default value.");
+    memcpy(value, output.default_value, size);
+    return Status::OK();
+  }
+  if (!ParseNumber(output.dtype, field, value))
+    return errors::InvalidArgument("Field ", column, " of line ",
+                                   line_number_ + 1, " is not a valid ",
+                                   DataTypeName(output.dtype), ": '", field,
+                                   "'.");
+  return Status::OK();
+}
+
+Status CsvReader::ParseRecord(int64 row, ParseResult* result,
+                              size_t* record_end) {
+  const char* begin = buffer_.data() + pos_;
+  const char* end = buffer_.data() + limit_;
+  *result = ParseResult::kNeedMoreData;
+  if (begin == end) return Status::OK();
+  if (*begin == '\n' || *begin == '\r') {
+    const char* newline = *begin == '\n' ? begin : begin + 1;
+    if (newline == end) return Status::OK();
+    if (*newline == '\n') {
+      *result = ParseResult::kEmptyLine;
+      *record_end = newline + 1 - buffer_.data();
+      return Status::OK();
+    }
+  }
+  const int num_columns = static_cast<int>(slots_.size());
+  int column = 0;
+  const char* p = begin;
+  while (true) {
+    const bool projected = column < num_columns && slots_[column] >= 0;
+    StringPiece field;
+    const char* field_end;
+    if (use_quotes_ && *p == '"') {
+      const char* quote = p + 1;
+      bool escaped = false;
+      while (true) {
+        quote = static_cast<const char*>(memchr(quote, '"', end - quote));
+        // A quote at the end of the buffer may be the first of an escaped
+        // pair, and so more data is needed to tell.
+        if (quote == nullptr || quote + 1 == end) return Status::OK();
+        if (quote[1] != '"') break;
+        escaped = true;
+        quote += 2;
+      }
+      field_end = quote + 1;
+      if (*field_end == '\r') {
+        if (field_end + 1 == end) return Status::OK();
+        ++field_end;
+      }
+      if (*field_end != delimiter_ && *field_end != '\n')
+        return errors::InvalidArgument(
+            "Quoted field ", column, " of line ", line_number_ + 1,
+            " is not followed by a delimiter or a newline.");
+      field = StringPiece(p + 1, quote - p - 1);
+      if (projected && escaped) {
+        unescaped_.clear();
+        for (size_t i = 0; i < field.size(); ++i) {
+          unescaped_.push_back(field[i]);
+          if (field[i] == '"') ++i;
+        }
+        field = unescaped_;
+      }
+    } else {
+      field_end = FindEither(p, end, delimiter_, '\n');
+      if (field_end == end) return Status::OK();
+      field = StringPiece(p, field_end - p);
+      if (*field_end == '\n' && field.ends_with("\r")) field.remove_suffix(1);
+    }
+    if (projected) TF_RETURN_IF_ERROR(Decode(column, row, field));
+    ++column;
+    if (*field_end == '\n') {
+      *record_end = field_end + 1 - buffer_.data();
+      break;
+    }
+    p = field_end + 1;
+    if (p == end) return Status::OK();
+    if (column >= num_columns && !use_quotes_) {
+      // The remaining fields are not projected and cannot contain newlines.
+      const void* newline = memchr(p, '\n', end - p);
+      if (newline == nullptr) return Status::OK();
+      *record_end = static_cast<const char*>(newline) + 1 - buffer_.data();
+      break;
+    }
+  }
+  if (column < num_columns)
+    return errors::InvalidArgument("Line ", line_number_ + 1, " has ", column,
+                                   " fields, but at least ", num_columns,
+                                   " are required.");
+  *result = ParseResult::kRecord;
+  return Status::OK();
+}
+
+void CsvReader::NextBatch(int64 batch_size, std::vector<TF_Tensor*>* batch,
+                          TF_Status* status) {
+  batch->clear();
+  if (batch_size <= 0) {
+    Set_TF_Status_from_Status(
+        status, errors::InvalidArgument("The batch size must be positive."));
+    return;
+  }
+  const int64_t dims = batch_size;
+  for (Column& column : columns_) {
+    if (column.dtype == TF_STRING) {
+      column.strings.resize(batch_size);
+    } else {
+      const size_t size = batch_size * TF_DataTypeSize(column.dtype);
+      column.tensor = TF_AllocateTensor(column.dtype, &dims, 1, size);
+    }
+  }
+  int64 rows = 0;
+  bool terminated = false;
+  Status s;
+  while (rows < batch_size && s.ok()) {
+    ParseResult result;
+    size_t record_end;
+    s = ParseRecord(rows, &result, &record_end);
+    if (!s.ok()) break;
+    if (result == ParseResult::kNeedMoreData) {
+      if (!eof_) {
+        s = Refill();
+      } else if (pos_ == limit_) {
+        break;
+      } else if (terminated) {
+        s = errors::DataLoss("Unterminated quoted field at the end of line ",
+                             line_number_ + 1, ".");
+      } else {
+        // Terminates the last record, which is not followed by a newline.
+        if (limit_ == buffer_.size()) buffer_.resize(buffer_.size() + 1);
+        buffer_[limit_++] = '\n';
+        terminated = true;
+      }
+      continue;
+    }
+    pos_ = record_end;
+    ++line_number_;
+    if (result == ParseResult::kRecord) ++rows;
+  }
+  if (s.ok() && rows > 0) {
+    const int64_t num_rows = rows;
+    for (Column& column : columns_) {
+      if (column.dtype == TF_STRING) {
+        size_t size = rows * sizeof(uint64);
+        for (int64 i = 0; i < rows; ++i)
+          size += TF_StringEncodedSize(column.strings[i].size());
+        TF_Tensor* tensor = TF_AllocateTensor(TF_STRING, &num_rows, 1, size);
+        char* data = static_cast<char*>(TF_TensorData(tensor));
+        uint64* offsets = reinterpret_cast<uint64*>(data);
+        char* values = data + rows * sizeof(uint64);
+        char* dst = values;
+        for (int64 i = 0; i < rows && TF_GetCode(status) == TF_OK; ++i) {
+          offsets[i] = static_cast<uint64>(dst - values);
+          dst += TF_StringEncode(column.strings[i].data(),
+                                 column.strings[i].size(), dst,
+                                 data + size - dst, status);
+        }
+        batch->push_back(tensor);
+      } else if (rows < batch_size) {
+        const size_t size = rows * TF_DataTypeSize(column.dtype);
+        TF_Tensor* tensor = TF_AllocateTensor(column.dtype, &num_rows, 1, size);
+        memcpy(TF_TensorData(tensor), TF_TensorData(column.tensor), size);
+        TF_DeleteTensor(column.tensor);
+        batch->push_back(tensor);
+      } else {
+        batch->push_back(column.tensor);
+      }
+      column.tensor = nullptr;
+      column.strings.clear();
+    }
+    if (TF_GetCode(status) != TF_OK) {
+      for (TF_Tensor* tensor : *batch) TF_DeleteTensor(tensor);
+      batch->clear();
+    }
+    return;
+  }
+  for (Column& column : columns_) {
+    if (column.tensor != nullptr) TF_DeleteTensor(column.tensor);
+    column.tensor = nullptr;
+    column.strings.clear();
+  }
+  Set_TF_Status_from_Status(status, s);
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,121 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_CSV_READER_H_
+#define TENSORFLOW_C_CSV_READER_H_
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+class RandomAccessFile;
+
+// Reads delimiter-separated text files (e.g., CSV or TSV files) in large
+// blocks and parses a projection of their columns directly into batch
+// tensors. Each returned batch contains one rank-1 tensor per projected
+// column, in the order in which the columns were requested. Columns that are
+// not projected are skipped over without being decoded.
+//
+// Delimiters and newlines are located using SIMD comparisons over the read
+// blocks, when those are available. Fields may be enclosed in double quotes,
+// in which case they may contain delimiters, newlines, and escaped (i.e.,
+// doubled) double quotes. Trailing carriage returns are stripped and empty
+// lines are skipped. Records with fewer fields than the largest projected
+// column index are reported as errors. An instance of this class is not safe
+// for concurrent access by multiple threads.
+class CsvReader {
+ public:
+  // Supported column data types are TF_FLOAT, TF_DOUBLE, TF_INT32, TF_INT64,
+  // and TF_STRING. "defaults" contains, for each projected column, the value
+  // used for empty fields, encoded as text, or is empty if all columns are
+  // required. "has_defaults" marks which of those defaults are set.
+  static CsvReader* New(const string& filename, char delimiter, bool use_quotes,
+                        int skip_header_lines, const std::vector<int>& columns,
+                        const std::vector<TF_DataType>& dtypes,
+                        const std::vector<string>& defaults,
+                        const std::vector<bool>& has_defaults,
+                        size_t block_size, TF_Status* out_status);
+
+  ~CsvReader();
+
+  // Returns the tensors of the next batch of at most "batch_size" records,
+  // which are then owned by the caller. Returns an empty batch once the end of
+  // the file has been reached.
+  void NextBatch(int64 batch_size, std::vector<TF_Tensor*>* batch,
+                 TF_Status* status);
+
+  // Returns the number of lines consumed so far, including header lines.
+  int64 line_number() const { return line_number_; }
+
+ private:
+  // Projected column and its decoding state for the batch being read.
+  struct Column {
+    TF_DataType dtype;
+    bool has_default = false;
+    // Decoded default value, for numeric columns.
+    char default_value[8];
+    string default_string;
+    // Batch tensor being filled, for numeric columns.
+    TF_Tensor* tensor = nullptr;
+    // Values of the batch being read, for string columns.
+    std::vector<string> strings;
+  };
+
+  enum class ParseResult { kRecord, kEmptyLine, kNeedMoreData };
+
+  CsvReader(std::unique_ptr<RandomAccessFile> file, char delimiter,
+            bool use_quotes, size_t block_size);
+
+  // Makes room at the end of the buffer and reads more data into it, moving
+  // the unconsumed data to its front. Sets "eof_" once the file is exhausted.
+  Status Refill();
+
+  // Parses the record that starts at "pos_" into row "row" of the outputs,
+  // without consuming it.
+  Status ParseRecord(int64 row, ParseResult* result, size_t* record_end);
+
+  // Decodes "field" into row "row" of the "slot"-th projected column.
+  Status Decode(int slot, int64 row, StringPiece field);
+
+  // Skips the header lines.
+  Status SkipLines(int num_lines);
+
+  std::unique_ptr<RandomAccessFile> file_;
+  const char delimiter_;
+  const bool use_quotes_;
+  uint64 file_offset_ = 0;
+  bool eof_ = false;
+  string buffer_;
+  size_t pos_ = 0;
+  size_t limit_ = 0;
+  int64 line_number_ = 0;
+  // Maps each column index to its projected slot, or to -1 if not projected.
+  std::vector<int> slots_;
+  std::vector<Column> columns_;
+  // Scratch space for unescaped quoted fields.
+  string unescaped_;
+  TF_DISALLOW_COPY_AND_ASSIGN(CsvReader);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_CSV_READER_H_
@@ -0,0 +1,231 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/dataset_iterator.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+namespace tensorflow {
+namespace {
+
+// Minimum number of elements returned between autotuning adjustments, so that
+// the effect of each adjustment is observed before the next one.
+const int64 kMinElementsBetweenAdjustments = 16;
+
+int64 ElementBytes(const std::vector<TF_Tensor*>& element) {
+  int64 bytes = 0;
+  for (TF_Tensor* tensor : element)
+    bytes += static_cast<int64>(TF_TensorByteSize(tensor));
+  return bytes;
+}
+
+}  // namespace
+
+DatasetIterator::DatasetIterator() {}
+
+DatasetIterator* DatasetIterator::New(TF_Session* session,
+                                      std::vector<TF_Output> outputs,
+                                      const DatasetIteratorOptions& options,
+                                      TF_Status* out_status) {
+  Status s;
+  if (options.prefetch_size < 0)
+    s = errors::InvalidArgument("The prefetch size must be non-negative.");
+  else if (options.num_threads < 1)
+    s = errors::InvalidArgument("The number of threads must be positive.");
+  else if (options.autotune && (options.max_prefetch_size < 1 ||
+                                options.max_threads < 1 ||
+                                options.max_buffered_bytes < 0))
+    s = errors::InvalidArgument(
+        "The autotuning limits must be positive (or zero, for the maximum "
+        "number of buffered bytes).");
+  Set_TF_Status_from_Status(out_status, s);
+  if (!s.ok()) return nullptr;
+  DatasetIterator* iterator = new DatasetIterator;
+  iterator->session_ = session;
+  iterator->outputs_ = std::move(outputs);
+  iterator->options_ = options;
+  mutex_lock l(iterator->mu_);
+  iterator->prefetch_size_ = options.prefetch_size;
+  int num_threads = options.num_threads;
+  if (options.autotune) {
+    // Autotuning always starts from a small buffer, which it then grows.
+    iterator->prefetch_size_ = std::max(
+        1, std::min(options.prefetch_size, options.max_prefetch_size));
+    num_threads = std::min(num_threads, options.max_threads);
+  }
+  if (iterator->prefetch_size_ > 0)
+    for (int i = 0; i < num_threads; ++i) iterator->StartThread();
+  return iterator;
+}
+
+DatasetIterator::~DatasetIterator() {
+  std::vector<std::unique_ptr<Thread>> threads;
+  {
+    mutex_lock l(mu_);
+    cancelled_ = true;
+    threads.swap(threads_);
+  }
+  space_available_.notify_all();
+  // Joins the prefetching threads.
+  threads.clear();
+  for (std::vector<TF_Tensor*>& element : buffer_)
+    for (TF_Tensor* tensor : element) TF_DeleteTensor(tensor);
+}
+
+void DatasetIterator::StartThread() {
+  threads_.emplace_back(Env::Default()->StartThread(
+      ThreadOptions(), "tf_scala_dataset_prefetch",
+      [this]() { PrefetchLoop(); }));
+  statistics_.num_threads = static_cast<int>(threads_.size());
+}
+
+Status DatasetIterator::RunGetNext(std::vector<TF_Tensor*>* element) {
+  element->assign(outputs_.size(), nullptr);
+  TF_Status status;
+  TF_SessionRun(session_, nullptr, nullptr, nullptr, 0, outputs_.data(),
+                element->data(), static_cast<int>(outputs_.size()), nullptr,
+                0, nullptr, &status);
+  if (!status.status.ok()) element->clear();
+  return status.status;
+}
+
+void DatasetIterator::PrefetchLoop() {
+  while (true) {
+    {
+      mutex_lock l(mu_);
+      // Elements being produced count against the prefetch size, so that the
+      // buffer never exceeds it.
+      while (!cancelled_ && status_.ok() &&
+             static_cast<int>(buffer_.size()) + running_runs_ >=
+                 prefetch_size_)
+        space_available_.wait(l);
+      if (cancelled_ || !status_.ok()) return;
+      ++running_runs_;
+    }
+    // The op is run without holding the lock, so that the consumer can keep
+    // draining the buffer.
+    const uint64 start_micros = Env::Default()->NowMicros();
+    std::vector<TF_Tensor*> element;
+    Status s = RunGetNext(&element);
+    const uint64 end_micros = Env::Default()->NowMicros();
+    {
+      mutex_lock l(mu_);
+      --running_runs_;
+      statistics_.producer_micros +=
+          static_cast<int64>(end_micros - start_micros);
+      if (s.ok()) {
+        const int64 bytes = ElementBytes(element);
+        statistics_.buffered_bytes += bytes;
+        statistics_.peak_buffered_bytes = std::max(
+            statistics_.peak_buffered_bytes, statistics_.buffered_bytes);
+        ++statistics_.elements_produced;
+        buffer_.push_back(std::move(element));
+      } else if (status_.ok()) {
+        status_ = s;
+      }
+    }
+    // The consumer may also be waiting for the other threads to stop.
+    elements_available_.notify_all();
+    if (!s.ok()) {
+      space_available_.notify_all();
+      return;
+    }
+  }
+}
+
+void DatasetIterator::Autotune(bool buffer_limited) {
+  if (elements_since_adjustment_ < kMinElementsBetweenAdjustments) return;
+  const int num_threads = static_cast<int>(threads_.size());
+  if (!buffer_limited && num_threads < options_.max_threads) {
+    // All threads were busy producing elements while the consumer waited, and
+    // so producing is slower than consuming. The buffer must also have room
+    // for the new thread.
+    StartThread();
+    prefetch_size_ = std::max(prefetch_size_, num_threads + 1);
+  } else if (prefetch_size_ < options_.max_prefetch_size) {
+    int new_prefetch_size =
+        std::min(2 * prefetch_size_, options_.max_prefetch_size);
+    if (options_.max_buffered_bytes > 0 && statistics_.elements_produced > 0) {
+      const int64 element_bytes = std::max<int64>(
+          1, statistics_.buffered_bytes > 0
+                 ? statistics_.buffered_bytes /
+                       std::max<int64>(1, buffer_.size())
+                 : statistics_.peak_buffered_bytes);
+      new_prefetch_size = static_cast<int>(std::min<int64>(
+          new_prefetch_size, options_.max_buffered_bytes / element_bytes));
+    }
+    if (new_prefetch_size <= prefetch_size_) return;
+    prefetch_size_ = new_prefetch_size;
+  } else {
+    return;
+  }
+  elements_since_adjustment_ = 0;
+  space_available_.notify_all();
+}
+
+void DatasetIterator::GetNext(std::vector<TF_Tensor*>* element,
+                              TF_Status* status) {
+  mutex_lock l(mu_);
+  if (threads_.empty()) {
+    if (status_.ok()) {
+      status_ = RunGetNext(element);
+      if (status_.ok()) ++statistics_.elements_produced;
+    }
+    Set_TF_Status_from_Status(status, status_);
+    return;
+  }
+  if (buffer_.empty() && (status_.ok() || running_runs_ > 0)) {
+    // If the buffer is empty and the prefetch size still prevents threads from
+    // producing elements, then the prefetch size is the bottleneck.
+    const bool buffer_limited = running_runs_ >= prefetch_size_;
+    const uint64 start_micros = Env::Default()->NowMicros();
+    while (buffer_.empty() && (status_.ok() || running_runs_ > 0))
+      elements_available_.wait(l);
+    ++statistics_.consumer_waits;
+    statistics_.consumer_wait_micros +=
+        static_cast<int64>(Env::Default()->NowMicros() - start_micros);
+    if (options_.autotune && status_.ok()) Autotune(buffer_limited);
+  }
+  if (!buffer_.empty()) {
+    *element = std::move(buffer_.front());
+    buffer_.pop_front();
+    statistics_.buffered_bytes -= ElementBytes(*element);
+    ++elements_since_adjustment_;
+    Set_TF_Status_from_Status(status, Status::OK());
+  } else {
+    Set_TF_Status_from_Status(status, status_);
+  }
+  space_available_.notify_one();
+}
+
+int64 DatasetIterator::buffered_elements() const {
+  mutex_lock l(mu_);
+  return static_cast<int64>(buffer_.size());
+}
+
+DatasetIteratorStatistics DatasetIterator::statistics() const {
+  mutex_lock l(mu_);
+  DatasetIteratorStatistics statistics = statistics_;
+  statistics.prefetch_size = prefetch_size_;
+  statistics.buffered_elements = static_cast<int64>(buffer_.size());
+  return statistics;
+}
+
+}  // namespace tensorflow
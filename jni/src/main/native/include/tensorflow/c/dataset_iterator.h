@@ -0,0 +1,139 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_DATASET_ITERATOR_H_
+#define TENSORFLOW_C_DATASET_ITERATOR_H_
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+struct DatasetIteratorOptions {
+  // Number of elements produced ahead of time, or 0 if each element is
+  // produced when it is requested. When autotuning, this is the initial value.
+  int prefetch_size = 0;
+  // Number of threads that produce elements ahead of time, when
+  // "prefetch_size" is positive. When autotuning, this is the initial value.
+  // Note that, with more than one thread, elements may be produced out of
+  // order.
+  int num_threads = 1;
+  // If true, "prefetch_size" and "num_threads" are adjusted at runtime,
+  // whenever the consumer has to wait for an element, within the following
+  // limits.
+  bool autotune = false;
+  int max_prefetch_size = 64;
+  int max_threads = 1;
+  // Maximum number of bytes of buffered elements, or 0 for no limit.
+  int64 max_buffered_bytes = 0;
+};
+
+struct DatasetIteratorStatistics {
+  int prefetch_size = 0;
+  int num_threads = 0;
+  int64 elements_produced = 0;
+  int64 buffered_elements = 0;
+  int64 buffered_bytes = 0;
+  int64 peak_buffered_bytes = 0;
+  // Number of times, and total time, that the consumer waited for elements.
+  int64 consumer_waits = 0;
+  int64 consumer_wait_micros = 0;
+  // Total time spent producing elements, across all threads.
+  int64 producer_micros = 0;
+};
+
+// Produces the elements of an initialized dataset iterator by running the op
+// that gets its next element directly in a session, so that no session run
+// has to cross the JNI boundary for each element. If the prefetch size is
+// positive, up to that many elements are produced ahead of time on dedicated
+// threads and buffered natively.
+class DatasetIterator {
+ public:
+  // "session" is not owned and must outlive the iterator. "outputs" are the
+  // outputs of the "IteratorGetNext" op of the iterator.
+  static DatasetIterator* New(TF_Session* session,
+                              std::vector<TF_Output> outputs,
+                              const DatasetIteratorOptions& options,
+                              TF_Status* out_status);
+
+  // Stops the prefetching threads, waiting for the elements they are
+  // producing, if any, and deletes all buffered elements.
+  ~DatasetIterator();
+
+  // Waits for the next element and moves its tensors into "element", which
+  // then owns them. Populates status with OUT_OF_RANGE once the iterator is
+  // exhausted. Errors, including OUT_OF_RANGE, are only reported after all
+  // elements produced before them have been returned, and are then reported by
+  // all subsequent calls.
+  void GetNext(std::vector<TF_Tensor*>* element, TF_Status* status);
+
+  // Number of elements currently buffered.
+  int64 buffered_elements() const;
+
+  // Returns a snapshot of the statistics of this iterator, which include the
+  // current (possibly autotuned) prefetch size and number of threads.
+  DatasetIteratorStatistics statistics() const;
+
+ private:
+  DatasetIterator();
+
+  // Runs the "IteratorGetNext" op once.
+  Status RunGetNext(std::vector<TF_Tensor*>* element);
+
+  // Body of the prefetching threads.
+  void PrefetchLoop();
+
+  // Starts one more prefetching thread.
+  void StartThread() EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Called whenever the consumer had to wait for an element. Adds a thread,
+  // unless "buffer_limited" is true (i.e., the prefetch size kept the threads
+  // from producing more elements) or the maximum number of threads has been
+  // reached, and otherwise grows the buffer, within the autotuning limits.
+  void Autotune(bool buffer_limited) EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  TF_Session* session_;  // Not owned
+  std::vector<TF_Output> outputs_;
+  DatasetIteratorOptions options_;
+
+  mutable mutex mu_;
+  condition_variable elements_available_;
+  condition_variable space_available_;
+  std::deque<std::vector<TF_Tensor*>> buffer_ GUARDED_BY(mu_);
+  // Status of the failed run that stopped the iterator.
+  Status status_ GUARDED_BY(mu_);
+  bool cancelled_ GUARDED_BY(mu_) = false;
+  int prefetch_size_ GUARDED_BY(mu_) = 0;
+  // Number of runs that are in progress on the prefetching threads.
+  int running_runs_ GUARDED_BY(mu_) = 0;
+  // Number of elements returned since the last autotuning adjustment.
+  int64 elements_since_adjustment_ GUARDED_BY(mu_) = 0;
+  DatasetIteratorStatistics statistics_ GUARDED_BY(mu_);
+  std::vector<std::unique_ptr<Thread>> threads_ GUARDED_BY(mu_);
+  TF_DISALLOW_COPY_AND_ASSIGN(DatasetIterator);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_DATASET_ITERATOR_H_
@@ -0,0 +1,86 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/deferred_release.h"
+
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+
+DeferredRelease::DeferredRelease() : head_(nullptr), idle_(false), num_scheduled_(0) {}
+
+DeferredRelease* DeferredRelease::Global() {
+  static DeferredRelease* deferred_release = [] {
+    DeferredRelease* instance = new DeferredRelease();
+    instance->release_thread_.reset(Env::Default()->StartThread(
+        ThreadOptions(), "tf_scala_deferred_release", [instance]() { instance->ReleaseLoop(); }));
+    return instance;
+  }();
+  return deferred_release;
+}
+
+void DeferredRelease::Schedule(ReleaseFunction release, void* object) {
+  Node* node = new Node{release, object, head_.load(std::memory_order_relaxed)};
+  while (!head_.compare_exchange_weak(node->next, node)) {}
+  num_scheduled_.fetch_add(1);
+  // The background thread checks the stack again after marking itself as idle, and so it is only missed here if it
+  // has already observed this node.
+  if (idle_.load()) {
+    mutex_lock l(mu_);
+    cv_.notify_all();
+  }
+}
+
+void DeferredRelease::Flush() {
+  const int64 target = num_scheduled_.load();
+  mutex_lock l(mu_);
+  cv_.notify_all();
+  while (num_released_ < target) cv_.wait(l);
+}
+
+void DeferredRelease::ReleaseLoop() {
+  while (true) {
+    Node* batch = head_.exchange(nullptr);
+    if (batch == nullptr) {
+      mutex_lock l(mu_);
+      idle_.store(true);
+      while (head_.load() == nullptr) cv_.wait(l);
+      idle_.store(false);
+      continue;
+    }
+    // The stack holds the most recently scheduled release first, and so the batch is reversed in order to execute the
+    // releases in the order in which they were scheduled.
+    Node* reversed = nullptr;
+    while (batch != nullptr) {
+      Node* next = batch->next;
+      batch->next = reversed;
+      reversed = batch;
+      batch = next;
+    }
+    int64 num_released = 0;
+    while (reversed != nullptr) {
+      Node* next = reversed->next;
+      reversed->release(reversed->object);
+      delete reversed;
+      reversed = next;
+      ++num_released;
+    }
+    mutex_lock l(mu_);
+    num_released_ += num_released;
+    cv_.notify_all();
+  }
+}
+
+}  // namespace tensorflow
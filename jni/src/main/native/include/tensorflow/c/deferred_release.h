@@ -0,0 +1,80 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_DEFERRED_RELEASE_H_
+#define TENSORFLOW_C_DEFERRED_RELEASE_H_
+
+#include <atomic>
+#include <memory>
+
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+class Thread;
+
+// Releases native objects (e.g., tensors) on a background thread, so that the
+// threads that dispose them do not contend on the locks taken by the release
+// functions. Releases are pushed onto a lock-free multiple-producer stack,
+// which the background thread drains in batches, executing them in the order
+// in which they were scheduled. The background thread is only woken up when
+// it is idle, and so scheduling a release usually amounts to a single
+// compare-and-swap. An instance of this class is safe for concurrent access by
+// multiple threads.
+class DeferredRelease {
+ public:
+  typedef void (*ReleaseFunction)(void* object);
+
+  // Returns the process-wide instance, starting its background thread the
+  // first time that it is called. The instance is never destroyed, so that
+  // objects can still be released during shutdown.
+  static DeferredRelease* Global();
+
+  // Schedules "object" to be released by calling "release" on it.
+  void Schedule(ReleaseFunction release, void* object);
+
+  // Waits until all releases scheduled before this call have been executed.
+  void Flush();
+
+ private:
+  struct Node {
+    ReleaseFunction release;
+    void* object;
+    Node* next;
+  };
+
+  DeferredRelease();
+
+  // Body of the background release thread.
+  void ReleaseLoop();
+
+  std::atomic<Node*> head_;
+  std::atomic<bool> idle_;
+  std::atomic<int64> num_scheduled_;
+
+  mutex mu_;
+  condition_variable cv_;
+  int64 num_released_ GUARDED_BY(mu_) = 0;
+  std::unique_ptr<Thread> release_thread_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(DeferredRelease);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_DEFERRED_RELEASE_H_
@@ -0,0 +1,471 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/eager_dispatcher.h"
+
+#include <string.h>
+#include <memory>
+#include <unordered_map>
+
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/gtl/inlined_vector.h"
+#include "tensorflow/core/platform/mutex.h"
+
+namespace tensorflow {
+
+namespace {
+
+struct EagerOpSpecs {
+  mutex mu;
+  std::unordered_map<string, const EagerOpSpec*> specs GUARDED_BY(mu);
+};
+
+EagerOpSpecs* GlobalEagerOpSpecs() {
+  static EagerOpSpecs* specs = new EagerOpSpecs();
+  return specs;
+}
+
+// Reads values from packed attributes, failing if there are not enough bytes
+// left.
+class PackedAttrReader {
+ public:
+  PackedAttrReader(const char* data, size_t size) : data_(data), size_(size) {}
+
+  size_t remaining() const { return size_ - position_; }
+
+  template <typename T>
+  Status Read(T* value) {
+    const char* bytes;
+    TF_RETURN_IF_ERROR(ReadBytes(sizeof(T), &bytes));
+    memcpy(value, bytes, sizeof(T));
+    return Status::OK();
+  }
+
+  // Reads a length (i.e., a non-negative int32).
+  Status ReadLength(int32* length) {
+    TF_RETURN_IF_ERROR(Read(length));
+    if (*length < 0)
+      return errors::InvalidArgument("Invalid packed attribute length ", *length, ".");
+    return Status::OK();
+  }
+
+  Status ReadBytes(size_t num_bytes, const char** bytes) {
+    if (num_bytes > remaining())
+      return errors::InvalidArgument("The packed attributes are truncated.");
+    *bytes = data_ + position_;
+    position_ += num_bytes;
+    return Status::OK();
+  }
+
+  Status ReadString(string* value) {
+    int32 length;
+    TF_RETURN_IF_ERROR(ReadLength(&length));
+    const char* bytes;
+    TF_RETURN_IF_ERROR(ReadBytes(static_cast<size_t>(length), &bytes));
+    value->assign(bytes, static_cast<size_t>(length));
+    return Status::OK();
+  }
+
+  // Reads a shape, setting "*rank" to -1 if its rank is unknown.
+  Status ReadShape(gtl::InlinedVector<int64_t, 4>* dims, int32* rank) {
+    TF_RETURN_IF_ERROR(Read(rank));
+    if (*rank < -1) return errors::InvalidArgument("Invalid packed shape rank ", *rank, ".");
+    dims->resize(*rank < 0 ? 0 : static_cast<size_t>(*rank));
+    for (int64_t& dim : *dims) {
+      int64 value;
+      TF_RETURN_IF_ERROR(Read(&value));
+      dim = static_cast<int64_t>(value);
+    }
+    return Status::OK();
+  }
+
+  // Reads a list of values that are packed as "Packed" and converted to "T".
+  template <typename Packed, typename T>
+  Status ReadList(std::vector<T>* values) {
+    int32 length;
+    TF_RETURN_IF_ERROR(ReadLength(&length));
+    values->resize(static_cast<size_t>(length));
+    for (T& value : *values) {
+      Packed packed;
+      TF_RETURN_IF_ERROR(Read(&packed));
+      value = static_cast<T>(packed);
+    }
+    return Status::OK();
+  }
+
+ private:
+  const char* data_;
+  const size_t size_;
+  size_t position_ = 0;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(PackedAttrReader);
+};
+
+Status StatusFromTFStatus(const TF_Status* status) {
+  if (TF_GetCode(status) == TF_OK) return Status::OK();
+  return Status(static_cast<error::Code>(TF_GetCode(status)), TF_Message(status));
+}
+
+string DataTypeName(TF_DataType data_type) {
+  return DataTypeString(static_cast<DataType>(data_type));
+}
+
+// Value of an attribute that has been set, which is either a data type or a
+// length, for inferred attributes, or the value of an int attribute or the
+// length of a list attribute, for the parameters.
+struct AttrValueRecord {
+  const char* attr;
+  int64 value;
+  // Index of the input that the value was inferred from, or -1.
+  int32 input;
+};
+
+const AttrValueRecord* FindAttrValue(
+    const gtl::InlinedVector<AttrValueRecord, 8>& values, const char* attr) {
+  for (const AttrValueRecord& value : values)
+    if (strcmp(value.attr, attr) == 0) return &value;
+  return nullptr;
+}
+
+// Infers the attributes of "spec" from the inputs and sets them on "op".
+Status SetInferredAttrs(
+    TFE_Op* op, const EagerOpSpec& spec, TFE_TensorHandle* const* inputs, const int32* input_lengths,
+    const gtl::InlinedVector<int32, 8>& input_offsets, gtl::InlinedVector<AttrValueRecord, 8>* values) {
+  for (int32 i = 0; i < spec.num_inferences; ++i) {
+    const EagerAttrInference& inference = spec.inferences[i];
+    const EagerOpInput& input = spec.inputs[inference.input];
+    TFE_TensorHandle* const* tensors = inputs + input_offsets[inference.input];
+    const int32 num_tensors = input_lengths[inference.input];
+    const AttrValueRecord* inferred = FindAttrValue(*values, inference.attr);
+    switch (inference.kind) {
+      case kEagerInferType: {
+        if (num_tensors == 0) {
+          if (inferred != nullptr) break;
+          return errors::InvalidArgument(
+              "Cannot infer attribute '", inference.attr, "' of '", spec.name, "' op from the empty list argument '",
+              input.name, "'.");
+        }
+        const TF_DataType data_type = inferred == nullptr
+            ? TFE_TensorHandleDataType(tensors[0]) : static_cast<TF_DataType>(inferred->value);
+        for (int32 j = 0; j < num_tensors; ++j) {
+          const TF_DataType tensor_data_type = TFE_TensorHandleDataType(tensors[j]);
+          if (tensor_data_type != data_type)
+            return errors::InvalidArgument(
+                "Argument '", input.name, "' of '", spec.name, "' op with data type '", DataTypeName(tensor_data_type),
+                "' must match data type '", DataTypeName(data_type), "' of argument '",
+                spec.inputs[inferred == nullptr ? inference.input : inferred->input].name, "'.");
+        }
+        if (inferred == nullptr) {
+          TFE_OpSetAttrType(op, inference.attr, data_type);
+          values->push_back({inference.attr, static_cast<int64>(data_type), inference.input});
+        }
+        break;
+      }
+      case kEagerInferTypeList: {
+        // The consistency of inferred data type lists is validated when executing the op.
+        if (inferred != nullptr) break;
+        std::unique_ptr<TF_DataType[]> data_types(new TF_DataType[num_tensors]);
+        for (int32 j = 0; j < num_tensors; ++j)
+          data_types[j] = TFE_TensorHandleDataType(tensors[j]);
+        TFE_OpSetAttrTypeList(op, inference.attr, data_types.get(), num_tensors);
+        values->push_back({inference.attr, static_cast<int64>(num_tensors), inference.input});
+        break;
+      }
+      case kEagerInferNumber: {
+        if (inferred != nullptr) {
+          if (inferred->value != num_tensors)
+            return errors::InvalidArgument(
+                "List argument '", input.name, "' of '", spec.name, "' op with length '", num_tensors,
+                "' must match length '", inferred->value, "' of argument '", spec.inputs[inferred->input].name,
+                "'.");
+          break;
+        }
+        TFE_OpSetAttrInt(op, inference.attr, static_cast<int64_t>(num_tensors));
+        values->push_back({inference.attr, static_cast<int64>(num_tensors), inference.input});
+        break;
+      }
+    }
+  }
+  return Status::OK();
+}
+
+// Overloads that set attributes on eager ops and on graph op descriptions, so that packed attributes can be unpacked
+// onto either of them.
+void SetAttrString(TFE_Op* op, const char* attr, const string& value) {
+  TFE_OpSetAttrString(op, attr, value.c_str());
+}
+void SetAttrString(TF_OperationDescription* desc, const char* attr, const string& value) {
+  TF_SetAttrString(desc, attr, value.data(), value.size());
+}
+void SetAttrInt(TFE_Op* op, const char* attr, int64_t value) { TFE_OpSetAttrInt(op, attr, value); }
+void SetAttrInt(TF_OperationDescription* desc, const char* attr, int64_t value) { TF_SetAttrInt(desc, attr, value); }
+void SetAttrFloat(TFE_Op* op, const char* attr, float value) { TFE_OpSetAttrFloat(op, attr, value); }
+void SetAttrFloat(TF_OperationDescription* desc, const char* attr, float value) { TF_SetAttrFloat(desc, attr, value); }
+void SetAttrBool(TFE_Op* op, const char* attr, unsigned char value) { TFE_OpSetAttrBool(op, attr, value); }
+void SetAttrBool(TF_OperationDescription* desc, const char* attr, unsigned char value) {
+  TF_SetAttrBool(desc, attr, value);
+}
+void SetAttrType(TFE_Op* op, const char* attr, TF_DataType value) { TFE_OpSetAttrType(op, attr, value); }
+void SetAttrType(TF_OperationDescription* desc, const char* attr, TF_DataType value) {
+  TF_SetAttrType(desc, attr, value);
+}
+void SetAttrShape(TFE_Op* op, const char* attr, const int64_t* dims, int rank, TF_Status* status) {
+  TFE_OpSetAttrShape(op, attr, dims, rank, status);
+}
+void SetAttrShape(TF_OperationDescription* desc, const char* attr, const int64_t* dims, int rank, TF_Status* status) {
+  TF_SetAttrShape(desc, attr, dims, rank);
+}
+void SetAttrStringList(TFE_Op* op, const char* attr, const std::vector<string>& values) {
+  std::vector<const char*> c_values(values.size());
+  for (size_t i = 0; i < values.size(); ++i)
+    c_values[i] = values[i].c_str();
+  TFE_OpSetAttrStringList(op, attr, c_values.data(), static_cast<int>(values.size()));
+}
+void SetAttrStringList(TF_OperationDescription* desc, const char* attr, const std::vector<string>& values) {
+  std::vector<const void*> c_values(values.size());
+  std::vector<size_t> lengths(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    c_values[i] = values[i].data();
+    lengths[i] = values[i].size();
+  }
+  TF_SetAttrStringList(desc, attr, c_values.data(), lengths.data(), static_cast<int>(values.size()));
+}
+void SetAttrIntList(TFE_Op* op, const char* attr, const int64_t* values, int num_values) {
+  TFE_OpSetAttrIntList(op, attr, values, num_values);
+}
+void SetAttrIntList(TF_OperationDescription* desc, const char* attr, const int64_t* values, int num_values) {
+  TF_SetAttrIntList(desc, attr, values, num_values);
+}
+void SetAttrFloatList(TFE_Op* op, const char* attr, const float* values, int num_values) {
+  TFE_OpSetAttrFloatList(op, attr, values, num_values);
+}
+void SetAttrFloatList(TF_OperationDescription* desc, const char* attr, const float* values, int num_values) {
+  TF_SetAttrFloatList(desc, attr, values, num_values);
+}
+void SetAttrBoolList(TFE_Op* op, const char* attr, const unsigned char* values, int num_values) {
+  TFE_OpSetAttrBoolList(op, attr, values, num_values);
+}
+void SetAttrBoolList(TF_OperationDescription* desc, const char* attr, const unsigned char* values, int num_values) {
+  TF_SetAttrBoolList(desc, attr, values, num_values);
+}
+void SetAttrTypeList(TFE_Op* op, const char* attr, const TF_DataType* values, int num_values) {
+  TFE_OpSetAttrTypeList(op, attr, values, num_values);
+}
+void SetAttrTypeList(TF_OperationDescription* desc, const char* attr, const TF_DataType* values, int num_values) {
+  TF_SetAttrTypeList(desc, attr, values, num_values);
+}
+void SetAttrShapeList(
+    TFE_Op* op, const char* attr, const int64_t** dims, const int* ranks, int num_shapes, TF_Status* status) {
+  TFE_OpSetAttrShapeList(op, attr, dims, ranks, num_shapes, status);
+}
+void SetAttrShapeList(
+    TF_OperationDescription* desc, const char* attr, const int64_t** dims, const int* ranks, int num_shapes,
+    TF_Status* status) {
+  TF_SetAttrShapeList(desc, attr, dims, ranks, num_shapes);
+}
+
+// Unpacks the parameters (i.e., the attributes that are not inferred) of "spec" from "reader" and sets them on "op",
+// which is either an eager op or a graph op description.
+template <typename Op>
+Status SetParameterAttrs(
+    Op* op, const EagerOpSpec& spec, PackedAttrReader* reader, gtl::InlinedVector<AttrValueRecord, 8>* values,
+    TF_Status* status) {
+  for (int32 i = 0; i < spec.num_parameters; ++i) {
+    const char* attr = spec.parameters[i].attr;
+    int64 length = 0;
+    switch (spec.parameters[i].type) {
+      case kEagerAttrString: {
+        string value;
+        TF_RETURN_IF_ERROR(reader->ReadString(&value));
+        SetAttrString(op, attr, value);
+        break;
+      }
+      case kEagerAttrInt: {
+        int64 value;
+        TF_RETURN_IF_ERROR(reader->Read(&value));
+        SetAttrInt(op, attr, static_cast<int64_t>(value));
+        length = value;
+        break;
+      }
+      case kEagerAttrFloat: {
+        float value;
+        TF_RETURN_IF_ERROR(reader->Read(&value));
+        SetAttrFloat(op, attr, value);
+        break;
+      }
+      case kEagerAttrBool: {
+        int8 value;
+        TF_RETURN_IF_ERROR(reader->Read(&value));
+        SetAttrBool(op, attr, static_cast<unsigned char>(value != 0));
+        break;
+      }
+      case kEagerAttrType: {
+        int32 value;
+        TF_RETURN_IF_ERROR(reader->Read(&value));
+        SetAttrType(op, attr, static_cast<TF_DataType>(value));
+        break;
+      }
+      case kEagerAttrShape: {
+        gtl::InlinedVector<int64_t, 4> dims;
+        int32 rank;
+        TF_RETURN_IF_ERROR(reader->ReadShape(&dims, &rank));
+        SetAttrShape(op, attr, dims.data(), static_cast<int>(rank), status);
+        TF_RETURN_IF_ERROR(StatusFromTFStatus(status));
+        break;
+      }
+      case kEagerAttrStringList: {
+        int32 num_values;
+        TF_RETURN_IF_ERROR(reader->ReadLength(&num_values));
+        std::vector<string> strings(static_cast<size_t>(num_values));
+        for (int32 j = 0; j < num_values; ++j)
+          TF_RETURN_IF_ERROR(reader->ReadString(&strings[j]));
+        SetAttrStringList(op, attr, strings);
+        length = num_values;
+        break;
+      }
+      case kEagerAttrIntList: {
+        std::vector<int64_t> list;
+        TF_RETURN_IF_ERROR((reader->ReadList<int64, int64_t>(&list)));
+        SetAttrIntList(op, attr, list.data(), static_cast<int>(list.size()));
+        length = static_cast<int64>(list.size());
+        break;
+      }
+      case kEagerAttrFloatList: {
+        std::vector<float> list;
+        TF_RETURN_IF_ERROR((reader->ReadList<float, float>(&list)));
+        SetAttrFloatList(op, attr, list.data(), static_cast<int>(list.size()));
+        length = static_cast<int64>(list.size());
+        break;
+      }
+      case kEagerAttrBoolList: {
+        std::vector<unsigned char> list;
+        TF_RETURN_IF_ERROR((reader->ReadList<int8, unsigned char>(&list)));
+        SetAttrBoolList(op, attr, list.data(), static_cast<int>(list.size()));
+        length = static_cast<int64>(list.size());
+        break;
+      }
+      case kEagerAttrTypeList: {
+        std::vector<TF_DataType> list;
+        TF_RETURN_IF_ERROR((reader->ReadList<int32, TF_DataType>(&list)));
+        SetAttrTypeList(op, attr, list.data(), static_cast<int>(list.size()));
+        length = static_cast<int64>(list.size());
+        break;
+      }
+      case kEagerAttrShapeList: {
+        int32 num_shapes;
+        TF_RETURN_IF_ERROR(reader->ReadLength(&num_shapes));
+        std::vector<gtl::InlinedVector<int64_t, 4>> dims(static_cast<size_t>(num_shapes));
+        std::vector<const int64_t*> shapes(static_cast<size_t>(num_shapes));
+        std::vector<int> ranks(static_cast<size_t>(num_shapes));
+        for (int32 j = 0; j < num_shapes; ++j) {
+          int32 rank;
+          TF_RETURN_IF_ERROR(reader->ReadShape(&dims[j], &rank));
+          shapes[j] = dims[j].data();
+          ranks[j] = static_cast<int>(rank);
+        }
+        SetAttrShapeList(op, attr, shapes.data(), ranks.data(), num_shapes, status);
+        TF_RETURN_IF_ERROR(StatusFromTFStatus(status));
+        length = num_shapes;
+        break;
+      }
+      default:
+        return errors::InvalidArgument("Invalid type for attribute '", attr, "' of '", spec.name, "' op.");
+    }
+    values->push_back({attr, length, -1});
+  }
+  if (reader->remaining() != 0)
+    return errors::InvalidArgument(
+        "The packed attributes of '", spec.name, "' op have ", reader->remaining(), " unused trailing bytes.");
+  return Status::OK();
+}
+
+}  // namespace
+
+void EagerOpSpecRegistry::Register(const EagerOpSpec* specs, int num_specs) {
+  EagerOpSpecs* registry = GlobalEagerOpSpecs();
+  mutex_lock lock(registry->mu);
+  for (int i = 0; i < num_specs; ++i)
+    registry->specs[specs[i].name] = &specs[i];
+}
+
+const EagerOpSpec* EagerOpSpecRegistry::LookUp(const string& name) {
+  EagerOpSpecs* registry = GlobalEagerOpSpecs();
+  mutex_lock lock(registry->mu);
+  auto it = registry->specs.find(name);
+  return it == registry->specs.end() ? nullptr : it->second;
+}
+
+Status NewEagerOp(TFE_Context* context, const EagerOpSpec& spec,
+                  TFE_TensorHandle* const* inputs, int num_inputs,
+                  const int32* input_lengths, const char* attrs,
+                  size_t attrs_size, TFE_Op** op, int* num_outputs) {
+  gtl::InlinedVector<int32, 8> input_offsets(static_cast<size_t>(spec.num_inputs));
+  int32 num_tensors = 0;
+  for (int32 i = 0; i < spec.num_inputs; ++i) {
+    const int32 length = input_lengths[i];
+    if (length < 0 || (!spec.inputs[i].is_list && length != 1))
+      return errors::InvalidArgument(
+          "Invalid number of tensors (", length, ") for argument '", spec.inputs[i].name, "' of '", spec.name,
+          "' op.");
+    input_offsets[i] = num_tensors;
+    num_tensors += length;
+  }
+  if (num_tensors != num_inputs)
+    return errors::InvalidArgument(
+        "Expected ", num_tensors, " input tensors for '", spec.name, "' op, but got ", num_inputs, ", instead.");
+
+  // The status is owned by the current thread, so that no status is allocated per dispatch.
+  static thread_local std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> thread_status(
+      TF_NewStatus(), TF_DeleteStatus);
+  TF_Status* status = thread_status.get();
+  TF_SetStatus(status, TF_OK, "");
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> new_op(TFE_NewOp(context, spec.name, status), TFE_DeleteOp);
+  TF_RETURN_IF_ERROR(StatusFromTFStatus(status));
+  for (int i = 0; i < num_inputs; ++i) {
+    TFE_OpAddInput(new_op.get(), inputs[i], status);
+    TF_RETURN_IF_ERROR(StatusFromTFStatus(status));
+  }
+
+  gtl::InlinedVector<AttrValueRecord, 8> values;
+  TF_RETURN_IF_ERROR(SetInferredAttrs(new_op.get(), spec, inputs, input_lengths, input_offsets, &values));
+  PackedAttrReader reader(attrs, attrs_size);
+  TF_RETURN_IF_ERROR(SetParameterAttrs(new_op.get(), spec, &reader, &values, status));
+
+  int64 count = spec.num_fixed_outputs;
+  for (int32 i = 0; i < spec.num_output_length_attrs; ++i) {
+    const AttrValueRecord* value = FindAttrValue(values, spec.output_length_attrs[i]);
+    if (value == nullptr)
+      return errors::Internal(
+          "Attribute '", spec.output_length_attrs[i], "' of '", spec.name, "' op, which determines its number of "
+          "outputs, has not been set.");
+    count += value->value;
+  }
+  if (count < 0)
+    return errors::InvalidArgument("Invalid number of outputs (", count, ") for '", spec.name, "' op.");
+  *num_outputs = static_cast<int>(count);
+  *op = new_op.release();
+  return Status::OK();
+}
+
+Status SetPackedAttrs(TF_OperationDescription* desc, const EagerOpSpec& spec,
+                      const char* attrs, size_t attrs_size) {
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  gtl::InlinedVector<AttrValueRecord, 8> values;
+  PackedAttrReader reader(attrs, attrs_size);
+  return SetParameterAttrs(desc, spec, &reader, &values, status.get());
+}
+
+}  // namespace tensorflow
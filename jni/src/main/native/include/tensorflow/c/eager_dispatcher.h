@@ -0,0 +1,151 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_EAGER_DISPATCHER_H_
+#define TENSORFLOW_C_EAGER_DISPATCHER_H_
+
+#include <stddef.h>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Types of the attributes that are provided to the generic eager dispatcher,
+// in packed form. The values are packed in native byte order, one after the
+// other, as follows:
+//   - string: int32 length followed by the bytes.
+//   - int: int64. float: float. bool: int8. type: int32.
+//   - shape: int32 rank (-1 for unknown rank) followed by rank int64 sizes.
+//   - list(T): int32 number of values followed by the values, packed as T.
+enum EagerAttrType : int32 {
+  kEagerAttrString = 0,
+  kEagerAttrInt = 1,
+  kEagerAttrFloat = 2,
+  kEagerAttrBool = 3,
+  kEagerAttrType = 4,
+  kEagerAttrShape = 5,
+  kEagerAttrStringList = 6,
+  kEagerAttrIntList = 7,
+  kEagerAttrFloatList = 8,
+  kEagerAttrBoolList = 9,
+  kEagerAttrTypeList = 10,
+  kEagerAttrShapeList = 11,
+};
+
+// Ways in which attributes are inferred from the op inputs.
+enum EagerAttrInferenceKind : int32 {
+  // Data type of a tensor input, or of all tensors of a list input.
+  kEagerInferType = 0,
+  // Data types of the tensors of a list input.
+  kEagerInferTypeList = 1,
+  // Number of tensors of a list input.
+  kEagerInferNumber = 2,
+};
+
+// Input argument of an op.
+struct EagerOpInput {
+  const char* name;
+  bool is_list;
+};
+
+// Attribute that is inferred from an input. When the same attribute is
+// inferred from multiple inputs, the values inferred from all but the first
+// one are checked for consistency.
+struct EagerAttrInference {
+  const char* attr;
+  EagerAttrInferenceKind kind;
+  int32 input;
+};
+
+// Attribute whose value is provided by the caller, in packed form.
+struct EagerAttrParameter {
+  const char* attr;
+  EagerAttrType type;
+};
+
+// Precomputed specification of how to build an op from its inputs and
+// packed attributes, which is generated along with the op bindings. All
+// arrays may be null if they are empty.
+struct EagerOpSpec {
+  const char* name;
+  int32 num_inputs;
+  const EagerOpInput* inputs;
+  int32 num_inferences;
+  const EagerAttrInference* inferences;
+  int32 num_parameters;
+  const EagerAttrParameter* parameters;
+  // Number of outputs that are single tensors.
+  int32 num_fixed_outputs;
+  // Attributes whose values are the lengths of the list outputs (i.e., int
+  // attributes, or list(type) attributes whose lengths are used).
+  int32 num_output_length_attrs;
+  const char* const* output_length_attrs;
+};
+
+// Registry of the op specifications, keyed by op name. Op specifications are
+// registered at load time, using "REGISTER_EAGER_OP_SPECS", and looking them
+// up is safe for concurrent use.
+class EagerOpSpecRegistry {
+ public:
+  // Registers the "num_specs" specifications in "specs", which must have
+  // static storage duration.
+  static void Register(const EagerOpSpec* specs, int num_specs);
+
+  // Returns the specification of the op named "name", or null if there is
+  // none.
+  static const EagerOpSpec* LookUp(const string& name);
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(EagerOpSpecRegistry);
+};
+
+namespace eager_dispatcher_internal {
+struct Registrar {
+  Registrar(const EagerOpSpec* specs, int num_specs) {
+    EagerOpSpecRegistry::Register(specs, num_specs);
+  }
+};
+}  // namespace eager_dispatcher_internal
+
+#define REGISTER_EAGER_OP_SPECS(specs)                                      \
+  static ::tensorflow::eager_dispatcher_internal::Registrar                 \
+      eager_op_specs_registrar_##specs(specs, sizeof(specs) / sizeof(specs[0]))
+
+// Creates the op specified by "spec" in "context", adding the "num_inputs"
+// tensors in "inputs" as its inputs and setting all of its attributes, which
+// are either inferred from the inputs or unpacked from the "attrs_size" bytes
+// in "attrs". Input i of the op is made up of the next "input_lengths[i]"
+// tensors (which must be 1 for inputs that are not lists). On success, "*op"
+// is set to the created op and "*num_outputs" to its number of outputs.
+Status NewEagerOp(TFE_Context* context, const EagerOpSpec& spec,
+                  TFE_TensorHandle* const* inputs, int num_inputs,
+                  const int32* input_lengths, const char* attrs,
+                  size_t attrs_size, TFE_Op** op, int* num_outputs);
+
+// Sets the attributes of "spec" that are provided in packed form (i.e., the
+// ones that are not inferred from the inputs) on the graph op description
+// "desc", unpacking them from the "attrs_size" bytes in "attrs". This allows
+// ops that were executed eagerly to be added to graphs. The attributes that
+// are inferred from the inputs are set when the inputs are added to "desc".
+Status SetPackedAttrs(TF_OperationDescription* desc, const EagerOpSpec& spec,
+                      const char* attrs, size_t attrs_size);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_EAGER_DISPATCHER_H_
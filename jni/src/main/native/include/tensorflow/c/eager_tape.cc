@@ -0,0 +1,399 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/eager_tape.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <unordered_set>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Tapes that are recording on the current thread.
+std::vector<EagerTape*>& ActiveTapes() {
+  static thread_local std::vector<EagerTape*> tapes;
+  return tapes;
+}
+
+// All live tapes, which need to be notified when tensor handles are deleted.
+struct LiveTapes {
+  mutex mu;
+  std::unordered_set<EagerTape*> tapes GUARDED_BY(mu);
+  std::atomic<int> count{0};
+};
+
+LiveTapes* GlobalLiveTapes() {
+  static LiveTapes* tapes = new LiveTapes();
+  return tapes;
+}
+
+// Gradient function that has been added to an eager context.
+struct GradientFunction {
+  string name;
+  // Index of the source, among the sources that the targets depend on, that
+  // each function output is the gradient of.
+  std::vector<int32> sources;
+};
+
+// Gradient functions keyed by context and tape structure.
+struct GradientFunctions {
+  mutex mu;
+  std::unordered_map<string, GradientFunction> functions GUARDED_BY(mu);
+  int64 counter GUARDED_BY(mu) = 0;
+};
+
+GradientFunctions* GlobalGradientFunctions() {
+  static GradientFunctions* functions = new GradientFunctions();
+  return functions;
+}
+
+}  // namespace
+
+EagerTape::EagerTape() {
+  LiveTapes* live_tapes = GlobalLiveTapes();
+  mutex_lock l(live_tapes->mu);
+  live_tapes->tapes.insert(this);
+  live_tapes->count.fetch_add(1);
+}
+
+EagerTape::~EagerTape() {
+  {
+    LiveTapes* live_tapes = GlobalLiveTapes();
+    mutex_lock l(live_tapes->mu);
+    live_tapes->tapes.erase(this);
+    live_tapes->count.fetch_sub(1);
+  }
+  for (TFE_TensorHandle* tensor : retained_)
+    TFE_DeleteTensorHandle(tensor);
+}
+
+int64 EagerTape::Lookup(TFE_TensorHandle* tensor) const {
+  auto it = tensor_ids_.find(tensor);
+  return it == tensor_ids_.end() ? -1 : it->second;
+}
+
+int64 EagerTape::LookupOrRetain(TFE_TensorHandle* tensor, bool recorded) {
+  const int64 id = Lookup(tensor);
+  if (id >= 0) return id;
+  // The retained handle shares the buffer of the original tensor.
+  retained_.push_back(new TFE_TensorHandle(tensor->t, tensor->d));
+  tensors_.push_back({-1, static_cast<int32>(retained_.size() - 1), recorded});
+  const int64 new_id = static_cast<int64>(tensors_.size() - 1);
+  tensor_ids_[tensor] = new_id;
+  return new_id;
+}
+
+void EagerTape::Watch(TFE_TensorHandle* tensor) {
+  mutex_lock l(mu_);
+  const int64 id = Lookup(tensor);
+  if (id >= 0)
+    tensors_[id].recorded = true;
+  else
+    LookupOrRetain(tensor, true);
+}
+
+void EagerTape::RecordOp(const EagerOpSpec& spec, TFE_TensorHandle* const* inputs, int num_inputs,
+                         const int32* input_lengths, const char* attrs, size_t attrs_size,
+                         TFE_TensorHandle* const* outputs, int num_outputs) {
+  mutex_lock l(mu_);
+  bool any_input_recorded = false;
+  for (int i = 0; i < num_inputs && !any_input_recorded; ++i) {
+    const int64 id = Lookup(inputs[i]);
+    any_input_recorded = id >= 0 && tensors_[id].recorded;
+  }
+  if (!any_input_recorded) return;
+  TapeOp op;
+  op.spec = &spec;
+  op.inputs_offset = static_cast<int32>(input_ids_.size());
+  op.num_inputs = num_inputs;
+  for (int i = 0; i < num_inputs; ++i)
+    input_ids_.push_back(LookupOrRetain(inputs[i], false));
+  op.input_lengths_offset = static_cast<int32>(input_lengths_.size());
+  input_lengths_.insert(input_lengths_.end(), input_lengths, input_lengths + spec.num_inputs);
+  op.attrs_offset = static_cast<int64>(attrs_.size());
+  op.attrs_size = static_cast<int64>(attrs_size);
+  attrs_.append(attrs, attrs_size);
+  op.first_output = static_cast<int64>(tensors_.size());
+  op.num_outputs = num_outputs;
+  const int32 op_index = static_cast<int32>(ops_.size());
+  for (int i = 0; i < num_outputs; ++i) {
+    tensors_.push_back({op_index, i, true});
+    tensor_ids_[outputs[i]] = op.first_output + i;
+  }
+  ops_.push_back(op);
+}
+
+void EagerTape::Forget(TFE_TensorHandle* tensor) {
+  mutex_lock l(mu_);
+  tensor_ids_.erase(tensor);
+}
+
+Status EagerTape::ComputeGradients(TFE_Context* context, TFE_TensorHandle* const* targets,
+                                   TFE_TensorHandle* const* target_gradients, int num_targets,
+                                   TFE_TensorHandle* const* sources, int num_sources,
+                                   TFE_TensorHandle** gradients) {
+  std::fill(gradients, gradients + num_sources, nullptr);
+  mutex_lock l(mu_);
+
+  // Find the recorded ops and tensors that the targets depend on, by traversing the tape backwards from them.
+  std::vector<bool> needed_ops(ops_.size(), false);
+  std::vector<bool> reached(tensors_.size(), false);
+  std::vector<int64> stack;
+  std::vector<int32> used_targets;
+  for (int i = 0; i < num_targets; ++i) {
+    const int64 id = Lookup(targets[i]);
+    if (id < 0) continue;
+    used_targets.push_back(i);
+    if (!reached[id]) {
+      reached[id] = true;
+      stack.push_back(id);
+    }
+  }
+  while (!stack.empty()) {
+    const TapeTensor& tensor = tensors_[stack.back()];
+    stack.pop_back();
+    if (tensor.op < 0 || needed_ops[tensor.op]) continue;
+    needed_ops[tensor.op] = true;
+    const TapeOp& op = ops_[tensor.op];
+    for (int32 i = 0; i < op.num_inputs; ++i) {
+      const int64 input = input_ids_[op.inputs_offset + i];
+      if (!reached[input]) {
+        reached[input] = true;
+        stack.push_back(input);
+      }
+    }
+  }
+  std::vector<int32> used_sources;
+  for (int i = 0; i < num_sources; ++i) {
+    const int64 id = Lookup(sources[i]);
+    if (id >= 0 && reached[id]) used_sources.push_back(i);
+  }
+  if (used_targets.empty() || used_sources.empty()) return Status::OK();
+
+  // Assign indices to the needed ops and to the tensors that are not produced by them (which become the function
+  // inputs), and compute a key that identifies the structure of the computation.
+  std::unordered_map<int32, int32> op_indices;
+  std::unordered_map<int64, int32> external_indices;
+  std::vector<int64> externals;
+  auto external_index = [&](int64 id) {
+    auto it = external_indices.find(id);
+    if (it != external_indices.end()) return it->second;
+    const int32 index = static_cast<int32>(externals.size());
+    external_indices[id] = index;
+    externals.push_back(id);
+    return index;
+  };
+  string key = strings::StrCat(reinterpret_cast<uintptr_t>(context), ";");
+  auto append_reference = [&](int64 id) {
+    const TapeTensor& tensor = tensors_[id];
+    if (tensor.op >= 0)
+      strings::StrAppend(&key, "o", op_indices.at(tensor.op), ":", tensor.index, ",");
+    else
+      strings::StrAppend(&key, "e", external_index(id), ",");
+  };
+  std::vector<int32> graph_ops;
+  for (int32 i = 0; i < static_cast<int32>(ops_.size()); ++i) {
+    if (!needed_ops[i]) continue;
+    const TapeOp& op = ops_[i];
+    op_indices[i] = static_cast<int32>(graph_ops.size());
+    graph_ops.push_back(i);
+    strings::StrAppend(&key, op.spec->name, "(");
+    for (int32 j = 0; j < op.num_inputs; ++j)
+      append_reference(input_ids_[op.inputs_offset + j]);
+    for (int32 j = 0; j < op.spec->num_inputs; ++j)
+      strings::StrAppend(&key, input_lengths_[op.input_lengths_offset + j], ",");
+    strings::StrAppend(&key, "[", op.attrs_size, "]");
+    key.append(attrs_, static_cast<size_t>(op.attrs_offset), static_cast<size_t>(op.attrs_size));
+    key.append(")");
+  }
+  for (int32 i : used_targets) {
+    strings::StrAppend(&key, "t");
+    append_reference(Lookup(targets[i]));
+    if (target_gradients != nullptr && target_gradients[i] != nullptr) key.append("g");
+  }
+  for (int32 i : used_sources) {
+    strings::StrAppend(&key, "s");
+    append_reference(Lookup(sources[i]));
+  }
+  for (int64 id : externals)
+    strings::StrAppend(&key, "e", TFE_TensorHandleDataType(retained_[tensors_[id].index]), ",");
+
+  GradientFunctions* functions = GlobalGradientFunctions();
+  GradientFunction function;
+  bool cached;
+  {
+    mutex_lock functions_lock(functions->mu);
+    auto it = functions->functions.find(key);
+    cached = it != functions->functions.end();
+    if (cached)
+      function = it->second;
+    else
+      function.name = strings::StrCat("EagerTapeGradient_", functions->counter++);
+  }
+
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  if (!cached) {
+    // Replay the needed ops into a graph and add the gradient ops to it.
+    std::unique_ptr<TF_Graph, decltype(&TF_DeleteGraph)> graph(TF_NewGraph(), TF_DeleteGraph);
+    std::vector<TF_Output> function_inputs;
+    for (size_t i = 0; i < externals.size(); ++i) {
+      TF_OperationDescription* desc = TF_NewOperation(graph.get(), "Placeholder", strings::StrCat("input_", i).c_str());
+      TF_SetAttrType(desc, "dtype", TFE_TensorHandleDataType(retained_[tensors_[externals[i]].index]));
+      TF_Operation* placeholder = TF_FinishOperation(desc, status.get());
+      TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+      function_inputs.push_back({placeholder, 0});
+    }
+    std::vector<TF_Operation*> replayed_ops;
+    auto graph_output = [&](int64 id) -> TF_Output {
+      const TapeTensor& tensor = tensors_[id];
+      if (tensor.op >= 0) return {replayed_ops[op_indices.at(tensor.op)], tensor.index};
+      return function_inputs[external_indices.at(id)];
+    };
+    for (int32 i : graph_ops) {
+      const TapeOp& op = ops_[i];
+      TF_OperationDescription* desc = TF_NewOperation(
+          graph.get(), op.spec->name, strings::StrCat("op_", replayed_ops.size()).c_str());
+      int32 offset = op.inputs_offset;
+      for (int32 j = 0; j < op.spec->num_inputs; ++j) {
+        const int32 length = input_lengths_[op.input_lengths_offset + j];
+        if (op.spec->inputs[j].is_list) {
+          std::vector<TF_Output> list;
+          for (int32 k = 0; k < length; ++k)
+            list.push_back(graph_output(input_ids_[offset + k]));
+          TF_AddInputList(desc, list.data(), static_cast<int>(length));
+        } else {
+          TF_AddInput(desc, graph_output(input_ids_[offset]));
+        }
+        offset += length;
+      }
+      const Status attrs_status = SetPackedAttrs(
+          desc, *op.spec, attrs_.data() + op.attrs_offset, static_cast<size_t>(op.attrs_size));
+      // The description is finished even if its attributes could not be set, since that is the only way to free it.
+      TF_Operation* replayed_op = TF_FinishOperation(desc, status.get());
+      TF_RETURN_IF_ERROR(attrs_status);
+      TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+      replayed_ops.push_back(replayed_op);
+    }
+    std::vector<TF_Output> ys;
+    std::vector<TF_Output> dxs;
+    for (int32 i : used_targets) {
+      const TF_Output y = graph_output(Lookup(targets[i]));
+      ys.push_back(y);
+      TF_OperationDescription* desc;
+      if (target_gradients != nullptr && target_gradients[i] != nullptr) {
+        desc = TF_NewOperation(graph.get(), "Placeholder", strings::StrCat("target_gradient_", ys.size()).c_str());
+        TF_SetAttrType(desc, "dtype", TF_OperationOutputType(y));
+      } else {
+        desc = TF_NewOperation(graph.get(), "OnesLike", strings::StrCat("target_gradient_", ys.size()).c_str());
+        TF_AddInput(desc, y);
+      }
+      TF_Operation* dx = TF_FinishOperation(desc, status.get());
+      TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+      dxs.push_back({dx, 0});
+      if (target_gradients != nullptr && target_gradients[i] != nullptr) function_inputs.push_back({dx, 0});
+    }
+    std::vector<TF_Output> xs;
+    for (int32 i : used_sources)
+      xs.push_back(graph_output(Lookup(sources[i])));
+    std::vector<TF_Output> dys(xs.size());
+    TF_AddGradients(graph.get(), ys.data(), static_cast<int>(ys.size()), xs.data(), static_cast<int>(xs.size()),
+                    dxs.data(), status.get(), dys.data());
+    TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+
+    // Function outputs cannot be function inputs and so, an identity op is added for each gradient.
+    std::vector<TF_Output> function_outputs;
+    for (size_t i = 0; i < dys.size(); ++i) {
+      if (dys[i].oper == nullptr) continue;
+      TF_OperationDescription* desc = TF_NewOperation(
+          graph.get(), "Identity", strings::StrCat("gradient_", i).c_str());
+      TF_AddInput(desc, dys[i]);
+      TF_Operation* identity = TF_FinishOperation(desc, status.get());
+      TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+      function_outputs.push_back({identity, 0});
+      function.sources.push_back(static_cast<int32>(i));
+    }
+    std::unique_ptr<TF_Function, decltype(&TF_DeleteFunction)> graph_function(
+        TF_GraphToFunction(
+            graph.get(), function.name.c_str(), 0, -1, nullptr, static_cast<int>(function_inputs.size()),
+            function_inputs.data(), static_cast<int>(function_outputs.size()), function_outputs.data(), nullptr,
+            nullptr, "Gradients computed from an eager gradient tape.", status.get()),
+        TF_DeleteFunction);
+    TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+    std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> function_def(TF_NewBuffer(), TF_DeleteBuffer);
+    TF_FunctionToFunctionDef(graph_function.get(), function_def.get(), status.get());
+    TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+    TFE_ContextAddFunctionDef(
+        context, static_cast<const char*>(function_def->data), function_def->length, status.get());
+    TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+    mutex_lock functions_lock(functions->mu);
+    functions->functions[key] = function;
+  }
+
+  // Execute the gradient function, feeding it the retained tensors and the provided target gradients.
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
+      TFE_NewOp(context, function.name.c_str(), status.get()), TFE_DeleteOp);
+  TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+  for (int64 id : externals) {
+    TFE_OpAddInput(op.get(), retained_[tensors_[id].index], status.get());
+    TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+  }
+  for (int32 i : used_targets) {
+    if (target_gradients == nullptr || target_gradients[i] == nullptr) continue;
+    TFE_OpAddInput(op.get(), target_gradients[i], status.get());
+    TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+  }
+  std::vector<TFE_TensorHandle*> results(function.sources.size());
+  int num_results = static_cast<int>(results.size());
+  TFE_Execute(op.get(), results.data(), &num_results, status.get());
+  TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+  for (int i = 0; i < num_results; ++i)
+    gradients[used_sources[function.sources[i]]] = results[i];
+  return Status::OK();
+}
+
+void EagerTape::Push(EagerTape* tape) { ActiveTapes().push_back(tape); }
+
+void EagerTape::Pop(EagerTape* tape) {
+  std::vector<EagerTape*>& tapes = ActiveTapes();
+  auto it = std::find(tapes.rbegin(), tapes.rend(), tape);
+  if (it != tapes.rend()) tapes.erase(std::next(it).base());
+}
+
+bool EagerTape::IsRecording() { return !ActiveTapes().empty(); }
+
+void EagerTape::RecordOpOnActiveTapes(const EagerOpSpec& spec, TFE_TensorHandle* const* inputs, int num_inputs,
+                                      const int32* input_lengths, const char* attrs, size_t attrs_size,
+                                      TFE_TensorHandle* const* outputs, int num_outputs) {
+  for (EagerTape* tape : ActiveTapes())
+    tape->RecordOp(spec, inputs, num_inputs, input_lengths, attrs, attrs_size, outputs, num_outputs);
+}
+
+void EagerTape::ForgetOnLiveTapes(TFE_TensorHandle* tensor) {
+  LiveTapes* live_tapes = GlobalLiveTapes();
+  if (live_tapes->count.load() == 0) return;
+  mutex_lock l(live_tapes->mu);
+  for (EagerTape* tape : live_tapes->tapes)
+    tape->Forget(tensor);
+}
+
+}  // namespace tensorflow
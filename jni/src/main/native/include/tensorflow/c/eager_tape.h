@@ -0,0 +1,149 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_EAGER_TAPE_H_
+#define TENSORFLOW_C_EAGER_TAPE_H_
+
+#include <stddef.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/eager_dispatcher.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Gradient tape that records the eager ops executed through the generic eager
+// dispatcher, so that gradients can be computed without constructing graphs
+// by hand.
+//
+// Tensors are identified by their handles. A tensor is recorded when it is
+// watched, or when it is produced by a recorded op, and an op is recorded
+// when at least one of its inputs is recorded. The ops are stored compactly,
+// in a few arenas that hold their specifications, input tensor identifiers,
+// and packed attributes. The other (i.e., constant) inputs of recorded ops,
+// and the watched tensors, are retained by the tape, by sharing their buffers,
+// so that their handles can be deleted while the tape is alive.
+//
+// Gradients are computed by replaying the part of the tape that the targets
+// depend on into a graph, adding the gradient ops using the C++ gradient
+// registry (i.e., "TF_AddGradients"), and executing the resulting graph as a
+// single eager function. The functions are cached per context and tape
+// structure, so that tapes that record the same computation (e.g., in every
+// iteration of a training loop) reuse the same function.
+class EagerTape {
+ public:
+  EagerTape();
+  ~EagerTape();
+
+  // Watches "tensor", so that the ops that use it are recorded and gradients
+  // can be computed with respect to it.
+  void Watch(TFE_TensorHandle* tensor);
+
+  // Records the op with specification "spec" and the provided inputs, input
+  // lengths, and packed attributes (as provided to "NewEagerOp"), which
+  // produced "outputs", if any of its inputs is recorded.
+  void RecordOp(const EagerOpSpec& spec, TFE_TensorHandle* const* inputs,
+                int num_inputs, const int32* input_lengths, const char* attrs,
+                size_t attrs_size, TFE_TensorHandle* const* outputs,
+                int num_outputs);
+
+  // Stops identifying any tensor by "tensor", which is about to be deleted.
+  void Forget(TFE_TensorHandle* tensor);
+
+  // Computes the gradients of the sum of "targets" with respect to "sources"
+  // and stores them in "gradients", which must have room for "num_sources"
+  // handles. "target_gradients" may be null, or contain null entries, in which
+  // case the corresponding initial gradients are tensors filled with ones.
+  // The gradients of sources that the targets do not depend on are null.
+  Status ComputeGradients(TFE_Context* context, TFE_TensorHandle* const* targets,
+                          TFE_TensorHandle* const* target_gradients,
+                          int num_targets, TFE_TensorHandle* const* sources,
+                          int num_sources, TFE_TensorHandle** gradients);
+
+  // Starts recording the ops executed by the current thread on "tape", in
+  // addition to any other tapes that are already recording on it.
+  static void Push(EagerTape* tape);
+
+  // Stops recording the ops executed by the current thread on "tape".
+  static void Pop(EagerTape* tape);
+
+  // Returns true if any tape is recording on the current thread.
+  static bool IsRecording();
+
+  // Calls "RecordOp" on all tapes that are recording on the current thread.
+  static void RecordOpOnActiveTapes(
+      const EagerOpSpec& spec, TFE_TensorHandle* const* inputs, int num_inputs,
+      const int32* input_lengths, const char* attrs, size_t attrs_size,
+      TFE_TensorHandle* const* outputs, int num_outputs);
+
+  // Calls "Forget" on all live tapes, on all threads. This is cheap when no
+  // tapes are alive.
+  static void ForgetOnLiveTapes(TFE_TensorHandle* tensor);
+
+ private:
+  // Tensor recorded by the tape. Tensors that are not produced by recorded
+  // ops (i.e., watched and constant tensors) are retained by the tape.
+  struct TapeTensor {
+    // Index of the recorded op that produced the tensor, or -1.
+    int32 op;
+    // Output index of the tensor in the op that produced it, or the index of
+    // the retained tensor, for tensors that are not produced by recorded ops.
+    int32 index;
+    // True if the tensor is watched or produced by a recorded op.
+    bool recorded;
+  };
+
+  // Op recorded by the tape. All offsets refer to the tape arenas.
+  struct TapeOp {
+    const EagerOpSpec* spec;
+    int32 inputs_offset;
+    int32 num_inputs;
+    int32 input_lengths_offset;
+    int64 attrs_offset;
+    int64 attrs_size;
+    // Identifier of the first output tensor, with the rest following it.
+    int64 first_output;
+    int32 num_outputs;
+  };
+
+  // Returns the identifier of "tensor", or -1 if it is not known to the tape.
+  int64 Lookup(TFE_TensorHandle* tensor) const EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Returns the identifier of "tensor", retaining it as a new tape tensor
+  // (which is recorded if "recorded" is true) if it is not known to the tape.
+  int64 LookupOrRetain(TFE_TensorHandle* tensor, bool recorded)
+      EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  mutable mutex mu_;
+  std::vector<TapeTensor> tensors_ GUARDED_BY(mu_);
+  std::unordered_map<TFE_TensorHandle*, int64> tensor_ids_ GUARDED_BY(mu_);
+  std::vector<TFE_TensorHandle*> retained_ GUARDED_BY(mu_);
+  std::vector<TapeOp> ops_ GUARDED_BY(mu_);
+  std::vector<int64> input_ids_ GUARDED_BY(mu_);
+  std::vector<int32> input_lengths_ GUARDED_BY(mu_);
+  string attrs_ GUARDED_BY(mu_);
+
+  TF_DISALLOW_COPY_AND_ASSIGN(EagerTape);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_EAGER_TAPE_H_
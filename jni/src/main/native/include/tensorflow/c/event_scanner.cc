@@ -0,0 +1,221 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/event_scanner.h"
+
+#include <string.h>
+
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/framework/summary.pb.h"
+#include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/framework/types.pb.h"
+#include "tensorflow/core/lib/core/blocking_counter.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/threadpool.h"
+#include "tensorflow/core/lib/io/record_reader.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/util/event.pb.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Returns true if "value" is a scalar summary value (i.e., either a simple value or a scalar floating point tensor),
+// in which case its value is stored in "result".
+bool ScalarValue(const Summary::Value& value, double* result) {
+  if (value.value_case() == Summary::Value::kSimpleValue) {
+    *result = value.simple_value();
+    return true;
+  }
+  if (value.value_case() != Summary::Value::kTensor) return false;
+  const TensorProto& tensor = value.tensor();
+  if (tensor.tensor_shape().dim_size() != 0) return false;
+  switch (tensor.dtype()) {
+    case DT_FLOAT:
+      if (tensor.float_val_size() == 1) {
+        *result = tensor.float_val(0);
+        return true;
+      }
+      if (tensor.tensor_content().size() == sizeof(float)) {
+        float content;
+        memcpy(&content, tensor.tensor_content().data(), sizeof(float));
+        *result = content;
+        return true;
+      }
+      return false;
+    case DT_DOUBLE:
+      if (tensor.double_val_size() == 1) {
+        *result = tensor.double_val(0);
+        return true;
+      }
+      if (tensor.tensor_content().size() == sizeof(double)) {
+        memcpy(result, tensor.tensor_content().data(), sizeof(double));
+        return true;
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+EventScanner::EventScanner(const std::vector<string>& tags, int64 reservoir_size, int64 seed, int num_threads)
+    : tags_(tags.begin(), tags.end()),
+      reservoir_size_(reservoir_size),
+      seed_(seed),
+      thread_pool_(new thread::ThreadPool(Env::Default(), "tf_scala_event_scanner", num_threads)) {}
+
+EventScanner::~EventScanner() {}
+
+EventScanner* EventScanner::New(const std::vector<string>& tags, int64 reservoir_size, int64 seed, int num_threads,
+                                TF_Status* out_status) {
+  if (num_threads <= 0) {
+    Set_TF_Status_from_Status(out_status, errors::InvalidArgument("The number of threads must be positive."));
+    return nullptr;
+  }
+  if (reservoir_size < 0) {
+    Set_TF_Status_from_Status(out_status, errors::InvalidArgument("The reservoir size must be non-negative."));
+    return nullptr;
+  }
+  return new EventScanner(tags, reservoir_size, seed, num_threads);
+}
+
+void EventScanner::Add(Reservoir* reservoir, int64 step, double wall_time, double value) const {
+  Scalars& scalars = reservoir->scalars;
+  const int64 size = static_cast<int64>(scalars.steps.size());
+  if (reservoir_size_ == 0 || size < reservoir_size_) {
+    scalars.steps.push_back(step);
+    scalars.wall_times.push_back(wall_time);
+    scalars.values.push_back(value);
+  } else {
+    // Each value is kept with probability "reservoir_size / num_seen", replacing a uniformly sampled value, while the
+    // remaining values keep their order. Otherwise, it replaces the last value.
+    std::uniform_int_distribution<int64> distribution(0, reservoir->num_seen - 1);
+    const int64 r = distribution(reservoir->random);
+    if (r < reservoir_size_) {
+      scalars.steps.erase(scalars.steps.begin() + r);
+      scalars.wall_times.erase(scalars.wall_times.begin() + r);
+      scalars.values.erase(scalars.values.begin() + r);
+      scalars.steps.push_back(step);
+      scalars.wall_times.push_back(wall_time);
+      scalars.values.push_back(value);
+    } else {
+      scalars.steps.back() = step;
+      scalars.wall_times.back() = wall_time;
+      scalars.values.back() = value;
+    }
+  }
+  ++reservoir->num_seen;
+}
+
+EventScanner::FileState* EventScanner::GetFileState(const string& filename) {
+  mutex_lock l(mu_);
+  std::unique_ptr<FileState>& state = files_[filename];
+  if (state == nullptr) state.reset(new FileState());
+  return state.get();
+}
+
+void EventScanner::Scan(const std::vector<string>& filenames, TF_Status* status) {
+  std::vector<FileState*> states;
+  states.reserve(filenames.size());
+  for (const string& filename : filenames) states.push_back(GetFileState(filename));
+  mutex mu;
+  Status scan_status;
+  BlockingCounter counter(static_cast<int>(filenames.size()));
+  for (size_t i = 0; i < filenames.size(); ++i) {
+    thread_pool_->Schedule([this, &filenames, &states, &mu, &scan_status, &counter, i]() {
+      const Status file_status = ScanFile(filenames[i], states[i]);
+      if (!file_status.ok()) {
+        mutex_lock l(mu);
+        scan_status.Update(file_status);
+      }
+      counter.DecrementCount();
+    });
+  }
+  counter.Wait();
+  Set_TF_Status_from_Status(status, scan_status);
+}
+
+Status EventScanner::ScanFile(const string& filename, FileState* state) {
+  // Concurrent scans of the same file are serialized, so that each record is read exactly once.
+  mutex_lock l(state->mu);
+  std::unique_ptr<RandomAccessFile> file;
+  TF_RETURN_IF_ERROR(Env::Default()->NewRandomAccessFile(filename, &file));
+  io::RecordReader reader(file.get());
+  string record;
+  Event event;
+  while (true) {
+    const Status status = reader.ReadRecord(&state->offset, &record);
+    // The offset is only advanced for complete records, and so truncated records are read again by the next scan.
+    if (errors::IsOutOfRange(status) || errors::IsDataLoss(status)) return Status::OK();
+    TF_RETURN_IF_ERROR(status);
+    if (!event.ParseFromString(record)) return errors::DataLoss("Could not parse an event in '", filename, "'.");
+    if (!event.has_summary()) continue;
+    for (const Summary::Value& value : event.summary().value()) {
+      double scalar;
+      if (!tags_.empty() && tags_.find(value.tag()) == tags_.end()) continue;
+      if (!ScalarValue(value, &scalar)) continue;
+      auto it = state->reservoirs.find(value.tag());
+      if (it == state->reservoirs.end()) it = state->reservoirs.emplace(value.tag(), Reservoir(seed_)).first;
+      Add(&it->second, event.step(), event.wall_time(), scalar);
+    }
+  }
+}
+
+std::vector<string> EventScanner::Tags(const std::vector<string>& filenames) {
+  std::set<string> tags;
+  for (const string& filename : filenames) {
+    FileState* state = GetFileState(filename);
+    mutex_lock l(state->mu);
+    for (const auto& reservoir : state->reservoirs) tags.insert(reservoir.first);
+  }
+  return std::vector<string>(tags.begin(), tags.end());
+}
+
+EventScanner::Scalars EventScanner::Get(const std::vector<string>& filenames, const string& tag, int64 min_step,
+                                        int64 max_step, int64 max_points) {
+  Scalars result;
+  for (const string& filename : filenames) {
+    FileState* state = GetFileState(filename);
+    mutex_lock l(state->mu);
+    auto it = state->reservoirs.find(tag);
+    if (it == state->reservoirs.end()) continue;
+    const Scalars& scalars = it->second.scalars;
+    for (size_t i = 0; i < scalars.steps.size(); ++i) {
+      if (scalars.steps[i] < min_step || scalars.steps[i] > max_step) continue;
+      result.steps.push_back(scalars.steps[i]);
+      result.wall_times.push_back(scalars.wall_times[i]);
+      result.values.push_back(scalars.values[i]);
+    }
+  }
+  const int64 num_points = static_cast<int64>(result.steps.size());
+  if (max_points > 0 && num_points > max_points) {
+    // Values are downsampled in place, which is safe because each selected index is never smaller than the position it
+    // is moved to.
+    for (int64 i = 0; i < max_points; ++i) {
+      const int64 index = max_points == 1 ? num_points - 1 : i * (num_points - 1) / (max_points - 1);
+      result.steps[i] = result.steps[index];
+      result.wall_times[i] = result.wall_times[index];
+      result.values[i] = result.values[index];
+    }
+    result.steps.resize(max_points);
+    result.wall_times.resize(max_points);
+    result.values.resize(max_points);
+  }
+  return result;
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,127 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_EVENT_SCANNER_H_
+#define TENSORFLOW_C_EVENT_SCANNER_H_
+
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+namespace thread {
+class ThreadPool;
+}  // namespace thread
+
+// Scans TensorFlow event files for scalar summaries, without materializing
+// the events on the JVM. Files are scanned in parallel on a thread pool and
+// each one is scanned incrementally: repeated scans only read the records that
+// were appended since the previous scan, which makes polling log directories
+// that are still being written to cheap. Records are parsed natively, only the
+// scalar summary values whose tags pass the tag filter are kept, and they are
+// stored as packed arrays per file and tag. If a reservoir size is provided,
+// the values of each file and tag are reservoir sampled (in the same way as
+// by the "Reservoir" class of the Scala API), which bounds the memory used
+// for long runs. An instance of this class is safe for concurrent access by
+// multiple threads.
+class EventScanner {
+ public:
+  // Scalar summary values of a single tag, stored as packed arrays.
+  struct Scalars {
+    std::vector<int64> steps;
+    std::vector<double> wall_times;
+    std::vector<double> values;
+  };
+
+  // Creates a scanner that keeps the scalar summaries with tags in "tags", or
+  // all scalar summaries if "tags" is empty. If "reservoir_size" is positive,
+  // at most that many values are kept per file and tag, sampled uniformly
+  // using random number generators seeded with "seed", and always keeping the
+  // last value.
+  static EventScanner* New(const std::vector<string>& tags, int64 reservoir_size, int64 seed, int num_threads,
+                           TF_Status* out_status);
+
+  ~EventScanner();
+
+  // Reads the records that were appended to "filenames" since they were last
+  // scanned (or all of their records, for files that are scanned for the
+  // first time). Truncated records at the end of a file (e.g., because the
+  // file is still being written to) are left for the next scan.
+  void Scan(const std::vector<string>& filenames, TF_Status* status);
+
+  // Returns the sorted tags of the scalar summaries found in "filenames".
+  std::vector<string> Tags(const std::vector<string>& filenames);
+
+  // Returns the scalar summaries with tag "tag" found in "filenames", in the
+  // order of the files and, within each file, in the order in which they were
+  // written, keeping only the ones with steps in "[min_step, max_step]". If
+  // "max_points" is positive and more values are found, they are downsampled
+  // to "max_points" evenly spaced values, always keeping the first and the
+  // last one.
+  Scalars Get(const std::vector<string>& filenames, const string& tag, int64 min_step, int64 max_step,
+              int64 max_points);
+
+ private:
+  // Reservoir of the scalar summary values of a single file and tag.
+  struct Reservoir {
+    explicit Reservoir(int64 seed) : random(static_cast<std::mt19937_64::result_type>(seed)) {}
+
+    Scalars scalars;
+    // Number of values added to the reservoir, including the ones that were
+    // not kept.
+    int64 num_seen = 0;
+    std::mt19937_64 random;
+  };
+
+  struct FileState {
+    mutex mu;
+    // Offset of the first record that has not been read yet.
+    uint64 offset GUARDED_BY(mu) = 0;
+    std::map<string, Reservoir> reservoirs GUARDED_BY(mu);
+  };
+
+  EventScanner(const std::vector<string>& tags, int64 reservoir_size, int64 seed, int num_threads);
+
+  // Adds a value to "reservoir", sampling it if the reservoir is full.
+  void Add(Reservoir* reservoir, int64 step, double wall_time, double value) const;
+
+  // Returns the state of "filename", creating it if necessary.
+  FileState* GetFileState(const string& filename);
+  Status ScanFile(const string& filename, FileState* state);
+
+  const std::set<string> tags_;
+  const int64 reservoir_size_;
+  const int64 seed_;
+  std::unique_ptr<thread::ThreadPool> thread_pool_;
+
+  mutex mu_;
+  std::unordered_map<string, std::unique_ptr<FileState>> files_ GUARDED_BY(mu_);
+  TF_DISALLOW_COPY_AND_ASSIGN(EventScanner);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_EVENT_SCANNER_H_
@@ -0,0 +1,62 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/example_parser.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "tensorflow/core/lib/core/coding.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/threadpool.h"
+#include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace example {
+
+namespace {
+  // Returns the thread pool used for parsing, which is created on first use and lives for the lifetime of the process.
+  thread::ThreadPool* ParserThreadPool() {
+    static thread::ThreadPool* pool = new thread::ThreadPool(
+        Env::Default(), "example_parser", std::max(1, port::NumSchedulableCPUs()));
+    return pool;
+  }
+}  // namespace
+
+Status ParseLengthPrefixedExamples(
+    const char* data, size_t size, const FastParseExampleConfig& config, Result* result) {
+  // The fast parser operates on strings and so each serialized example is copied exactly once, directly from the
+  // provided buffer. Byte features are then parsed without any intermediate proto objects.
+  std::vector<string> serialized;
+  const char* position = data;
+  const char* limit = data + size;
+  while (position < limit) {
+    uint32 length = 0;
+    const char* start = core::GetVarint32Ptr(position, limit, &length);
+    if (start == nullptr)
+      return errors::InvalidArgument("Invalid length prefix for example ", serialized.size(), ".");
+    if (length > static_cast<size_t>(limit - start))
+      return errors::InvalidArgument(
+          "Example ", serialized.size(), " has length ", length, ", which exceeds the remaining ", limit - start,
+          " bytes of the buffer.");
+    serialized.emplace_back(start, length);
+    position = start + length;
+  }
+  return FastParseExample(config, serialized, {}, ParserThreadPool(), result);
+}
+
+}  // namespace example
+}  // namespace tensorflow
@@ -0,0 +1,38 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_EXAMPLE_PARSER_H_
+#define TENSORFLOW_C_EXAMPLE_PARSER_H_
+
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/util/example_proto_fast_parsing.h"
+
+namespace tensorflow {
+namespace example {
+
+// Parses a batch of serialized Example protos that are stored one after the
+// other in "data", each one prefixed by its size encoded as a varint32 (i.e.,
+// the format written by "writeDelimitedTo" of the protobuf Java API), and
+// converts them into "result", according to "config". The output is the same
+// as that of the ParseExample op. Parsing is performed in parallel over the
+// examples, using a thread pool that is shared among all calls.
+Status ParseLengthPrefixedExamples(const char* data, size_t size,
+                                   const FastParseExampleConfig& config,
+                                   Result* result);
+
+}  // namespace example
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_EXAMPLE_PARSER_H_
@@ -0,0 +1,172 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/file_lister.h"
+
+#include <string.h>
+
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/threadpool.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace io {
+
+namespace {
+
+bool HasWildcard(const string& component) {
+  return strpbrk(component.c_str(), "*?[\\") != nullptr;
+}
+
+}  // namespace
+
+FileLister::FileLister(bool recursive, bool with_statistics)
+    : recursive_(recursive), with_statistics_(with_statistics) {}
+
+FileLister* FileLister::New(const string& pattern, int num_threads, bool recursive, bool with_statistics,
+                            TF_Status* out_status) {
+  if (num_threads <= 0) {
+    Set_TF_Status_from_Status(out_status, errors::InvalidArgument("The number of threads must be positive."));
+    return nullptr;
+  }
+  // The fixed prefix of the pattern ends at the last separator before the first wildcard. If there are no wildcards,
+  // it ends at the last separator, and so the pattern base name is checked for existence.
+  const size_t wildcard = pattern.find_first_of("*?[\\");
+  const size_t separator = pattern.rfind('/', wildcard == string::npos ? string::npos : wildcard);
+  string base_dir = separator == string::npos ? "." : pattern.substr(0, separator);
+  if (base_dir.empty()) base_dir = "/";
+  FileLister* lister = new FileLister(recursive, with_statistics);
+  const string remaining = separator == string::npos ? pattern : pattern.substr(separator + 1);
+  size_t start = 0;
+  while (start <= remaining.size()) {
+    size_t end = remaining.find('/', start);
+    if (end == string::npos) end = remaining.size();
+    if (end > start) lister->components_.push_back(remaining.substr(start, end - start));
+    start = end + 1;
+  }
+  lister->thread_pool_.reset(new thread::ThreadPool(Env::Default(), "tf_scala_file_lister", num_threads));
+  if (lister->components_.empty()) {
+    // The pattern names a directory (e.g., it ends with a separator).
+    lister->Match(base_dir, 0);
+  } else {
+    lister->Schedule(base_dir, 0);
+  }
+  return lister;
+}
+
+FileLister::~FileLister() {
+  {
+    mutex_lock lock(mu_);
+    cancelled_ = true;
+    while (num_pending_ > 0) cv_.wait(lock);
+  }
+  // Joins the thread pool threads.
+  thread_pool_.reset();
+}
+
+bool FileLister::Next(size_t max_entries, std::vector<Entry>* entries, TF_Status* status) {
+  mutex_lock lock(mu_);
+  while (entries_.empty() && num_pending_ > 0 && status_.ok()) cv_.wait(lock);
+  if (!status_.ok()) {
+    Set_TF_Status_from_Status(status, status_);
+    return false;
+  }
+  if (entries_.empty()) return false;
+  while (!entries_.empty() && entries->size() < max_entries) {
+    entries->push_back(std::move(entries_.front()));
+    entries_.pop_front();
+  }
+  return true;
+}
+
+void FileLister::Schedule(const string& dir, size_t component) {
+  {
+    mutex_lock lock(mu_);
+    if (cancelled_ || !status_.ok()) return;
+    ++num_pending_;
+  }
+  thread_pool_->Schedule([this, dir, component]() {
+    List(dir, component);
+    mutex_lock lock(mu_);
+    --num_pending_;
+    cv_.notify_all();
+  });
+}
+
+void FileLister::List(const string& dir, size_t component) {
+  Env* env = Env::Default();
+  if (component < components_.size() && !HasWildcard(components_[component])) {
+    // Listing the directory is not necessary when the pattern component is a plain name, which matters for large
+    // directories on remote file systems.
+    const string path = JoinPath(dir, components_[component]);
+    if (env->FileExists(path).ok()) Match(path, component);
+    return;
+  }
+  std::vector<string> children;
+  Status s = env->GetChildren(dir, &children);
+  if (!s.ok()) {
+    // Directories that are reached while matching may be files, or may have been removed since they were found, and
+    // those errors are not reported. The same holds for directories that are listed recursively.
+    if (component > 0 && (errors::IsNotFound(s) || errors::IsFailedPrecondition(s))) return;
+    Fail(s);
+    return;
+  }
+  for (const string& child : children) {
+    {
+      mutex_lock lock(mu_);
+      if (cancelled_ || !status_.ok()) return;
+    }
+    if (component >= components_.size() || env->MatchPath(child, components_[component]))
+      Match(JoinPath(dir, child), component);
+  }
+}
+
+void FileLister::Match(const string& path, size_t component) {
+  if (component + 1 < components_.size()) {
+    Schedule(path, component + 1);
+    return;
+  }
+  Entry entry;
+  entry.path = path;
+  bool is_directory = false;
+  if (with_statistics_) {
+    Status s = Env::Default()->Stat(path, &entry.statistics);
+    // The path may have been removed after it was listed.
+    if (!s.ok()) return;
+    is_directory = entry.statistics.is_directory;
+  } else if (recursive_) {
+    is_directory = Env::Default()->IsDirectory(path).ok();
+  }
+  Emit(std::move(entry));
+  if (recursive_ && is_directory) Schedule(path, components_.size());
+}
+
+void FileLister::Emit(Entry entry) {
+  mutex_lock lock(mu_);
+  if (cancelled_) return;
+  entries_.push_back(std::move(entry));
+  cv_.notify_all();
+}
+
+void FileLister::Fail(const Status& status) {
+  mutex_lock lock(mu_);
+  status_.Update(status);
+  cv_.notify_all();
+}
+
+}  // namespace io
+}  // namespace tensorflow
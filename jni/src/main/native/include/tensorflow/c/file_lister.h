@@ -0,0 +1,99 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LIB_IO_FILE_LISTER_H_
+#define TENSORFLOW_LIB_IO_FILE_LISTER_H_
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/file_statistics.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+namespace thread {
+class ThreadPool;
+}  // namespace thread
+
+namespace io {
+
+// Expands a path pattern (e.g., "gs://bucket/data/*/part-*"), using the same
+// rules as Env::GetMatchingPaths, by listing the directories it spans in
+// parallel on a thread pool. Matching paths are made available as soon as they
+// are found, in no particular order, and can be consumed in batches while the
+// remaining directories are being listed. If "recursive" is true, the matching
+// directories are also listed recursively and all of their descendants are
+// returned. An instance of this class is safe for concurrent access by
+// multiple threads.
+class FileLister {
+ public:
+  struct Entry {
+    string path;
+    // Only populated if the lister was created with "with_statistics" set.
+    FileStatistics statistics;
+  };
+
+  static FileLister* New(const string& pattern, int num_threads, bool recursive, bool with_statistics,
+                         TF_Status* out_status);
+
+  // Cancels any pending directory listings and waits for them to complete.
+  ~FileLister();
+
+  // Moves up to "max_entries" matching paths into "entries", blocking until at
+  // least one is available. Returns false once all matching paths have been
+  // returned, or if an error occurred while listing (in which case "status" is
+  // set).
+  bool Next(size_t max_entries, std::vector<Entry>* entries, TF_Status* status);
+
+ private:
+  FileLister(bool recursive, bool with_statistics);
+
+  // Schedules the listing of "dir", matching its children against pattern
+  // component "component". All children match if "component" is past the last
+  // pattern component (i.e., while listing recursively).
+  void Schedule(const string& dir, size_t component);
+  void List(const string& dir, size_t component);
+  // Handles a path that matches pattern component "component".
+  void Match(const string& path, size_t component);
+  void Emit(Entry entry);
+  void Fail(const Status& status);
+
+  const bool recursive_;
+  const bool with_statistics_;
+  // Pattern components that follow the fixed (i.e., wildcard-free) prefix.
+  std::vector<string> components_;
+  std::unique_ptr<thread::ThreadPool> thread_pool_;
+
+  mutex mu_;
+  condition_variable cv_;
+  std::deque<Entry> entries_ GUARDED_BY(mu_);
+  // Number of scheduled listings that have not completed yet.
+  int64 num_pending_ GUARDED_BY(mu_) = 0;
+  Status status_ GUARDED_BY(mu_);
+  bool cancelled_ GUARDED_BY(mu_) = false;
+  TF_DISALLOW_COPY_AND_ASSIGN(FileLister);
+};
+
+}  // namespace io
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_LIB_IO_FILE_LISTER_H_
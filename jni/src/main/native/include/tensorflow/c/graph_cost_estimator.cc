@@ -0,0 +1,95 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/graph_cost_estimator.h"
+
+#include <unordered_map>
+
+#include "tensorflow/core/grappler/clusters/utils.h"
+#include "tensorflow/core/grappler/clusters/virtual_cluster.h"
+#include "tensorflow/core/grappler/costs/op_level_cost_estimator.h"
+#include "tensorflow/core/grappler/costs/virtual_scheduler.h"
+#include "tensorflow/core/grappler/grappler_item.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Virtual scheduler that exposes the final state of each device, which
+// includes its peak memory usage.
+class ReportingVirtualScheduler : public grappler::VirtualScheduler {
+ public:
+  using grappler::VirtualScheduler::VirtualScheduler;
+  using grappler::VirtualScheduler::GetDeviceStates;
+};
+
+int64 ToMicros(const grappler::Costs::Duration& duration) {
+  return static_cast<int64>(duration.asMicroSeconds().count());
+}
+
+}  // namespace
+
+Status EstimateGraphCosts(const GraphDef& graph_def,
+                          const std::vector<string>& fetches,
+                          GraphCostReport* report) {
+  if (fetches.empty())
+    return errors::InvalidArgument(
+        "At least one fetch is required in order to estimate graph costs.");
+  grappler::GrapplerItem item;
+  item.id = "tf_scala_estimate_graph_costs";
+  item.graph = graph_def;
+  item.fetch = fetches;
+
+  std::unordered_map<string, DeviceProperties> devices;
+  devices["/job:localhost/replica:0/task:0/cpu:0"] =
+      grappler::GetLocalCPUInfo();
+  grappler::VirtualCluster cluster(devices);
+  TF_RETURN_IF_ERROR(cluster.Provision());
+
+  ReportingVirtualScheduler scheduler(&item, /*use_static_shapes=*/true,
+                                      &cluster);
+  TF_RETURN_IF_ERROR(scheduler.Init());
+  grappler::OpLevelCostEstimator estimator;
+  report->nodes.clear();
+  bool more_nodes;
+  do {
+    const grappler::OpContext op_context = scheduler.GetCurrNode();
+    const grappler::Costs node_costs = estimator.PredictCosts(op_context);
+    GraphCostReport::NodeCost node;
+    node.name = op_context.name;
+    node.op_type = op_context.op_info.op();
+    node.device = op_context.device_name;
+    node.execution_micros = ToMicros(node_costs.execution_time);
+    node.compute_micros = ToMicros(node_costs.compute_time);
+    node.memory_micros = ToMicros(node_costs.memory_time);
+    report->nodes.push_back(node);
+    more_nodes = scheduler.MarkCurrNodeExecuted(node_costs);
+  } while (more_nodes);
+
+  report->execution_micros = ToMicros(scheduler.Summary().execution_time);
+  report->devices.clear();
+  for (const auto& device_state : *scheduler.GetDeviceStates()) {
+    GraphCostReport::DeviceCost device;
+    device.device = device_state.first;
+    device.execution_micros =
+        ToMicros(device_state.second.device_costs.execution_time);
+    device.peak_memory_bytes = device_state.second.max_memory_usage;
+    report->devices.push_back(device);
+  }
+  return Status::OK();
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,67 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_GRAPH_COST_ESTIMATOR_H_
+#define TENSORFLOW_C_GRAPH_COST_ESTIMATOR_H_
+
+#include <vector>
+
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Analytical estimate of the cost of running a graph once.
+struct GraphCostReport {
+  struct DeviceCost {
+    string device;
+    // Time at which the last op executed on the device finishes.
+    int64 execution_micros = 0;
+    // Peak memory used by the outputs of the ops executed on the device.
+    int64 peak_memory_bytes = 0;
+  };
+
+  struct NodeCost {
+    string name;
+    string op_type;
+    string device;
+    int64 execution_micros = 0;
+    int64 compute_micros = 0;
+    int64 memory_micros = 0;
+  };
+
+  // Overall execution time of the graph.
+  int64 execution_micros = 0;
+  std::vector<DeviceCost> devices;
+  // Costs of the nodes, in the order in which they are scheduled.
+  std::vector<NodeCost> nodes;
+};
+
+// Estimates the cost of computing "fetches" (i.e., node names) using
+// "graph_def", without running it. The ops are scheduled on a virtual cluster
+// consisting of the local CPU (unless they are explicitly placed on other
+// devices), and the cost of each op is predicted analytically, from the
+// statically inferred shapes of its inputs and outputs. Ops whose costs cannot
+// be predicted (e.g., because their shapes are unknown) are assigned default
+// costs, and so the estimates are only as good as the static shape
+// information in the graph.
+Status EstimateGraphCosts(const GraphDef& graph_def,
+                          const std::vector<string>& fetches,
+                          GraphCostReport* report);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_GRAPH_COST_ESTIMATOR_H_
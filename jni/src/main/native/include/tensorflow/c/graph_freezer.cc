@@ -0,0 +1,270 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/graph_freezer.h"
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "tensorflow/c/checkpoint_reader.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/framework/attr_value.pb.h"
+#include "tensorflow/core/framework/node_def.pb.h"
+#include "tensorflow/core/framework/node_def_util.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/graph/tensor_id.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Nodes of a graph that are needed in order to compute a set of fetches.
+struct Reachability {
+  std::unordered_map<string, const NodeDef*> nodes;
+  std::unordered_set<string> kept;
+  std::unordered_set<string> fed;
+};
+
+// Returns "true" for ops that are only needed for training (e.g., savers,
+// summaries, asserts, and variable updates) and which can thus be dropped
+// when they are only reachable through control inputs.
+bool IsTrainingOnly(const string& op) {
+  static const std::unordered_set<string>* ops = new std::unordered_set<string>({
+      "Assert", "Print", "Save", "SaveV2", "SaveSlices", "Restore", "RestoreV2",
+      "RestoreSlice", "MergeV2Checkpoints", "MergeSummary", "Assign",
+      "AssignAdd", "AssignSub", "AssignVariableOp", "AssignAddVariableOp",
+      "AssignSubVariableOp"});
+  return ops->count(op) > 0 || StringPiece(op).ends_with("Summary") ||
+         StringPiece(op).ends_with("SummaryV2") ||
+         StringPiece(op).starts_with("Apply") ||
+         StringPiece(op).starts_with("ResourceApply") ||
+         StringPiece(op).starts_with("SparseApply") ||
+         StringPiece(op).starts_with("ResourceSparseApply");
+}
+
+// Returns the name of the node producing "input", which may be a data input
+// or a control input.
+string ProducerName(const string& input) {
+  if (!input.empty() && input[0] == '^') return input.substr(1);
+  return ParseTensorName(input).first.ToString();
+}
+
+Status FindReachableNodes(const GraphDef& graph_def,
+                          const std::vector<string>& fetches,
+                          const std::vector<string>& feeds,
+                          Reachability* reachability) {
+  for (const NodeDef& node : graph_def.node())
+    reachability->nodes[node.name()] = &node;
+  for (const string& feed : feeds) {
+    const TensorId id = ParseTensorName(feed);
+    const string name = id.first.ToString();
+    if (reachability->nodes.count(name) == 0)
+      return errors::InvalidArgument("Feed '", feed, "' was not found in the graph.");
+    if (id.second != 0)
+      return errors::InvalidArgument(
+          "Only the first output of a node can be fed in a frozen graph, but "
+          "feed '", feed, "' was provided.");
+    reachability->fed.insert(name);
+  }
+  std::deque<string> queue;
+  for (const string& fetch : fetches) {
+    const string name = ProducerName(fetch);
+    if (reachability->nodes.count(name) == 0)
+      return errors::InvalidArgument("Fetch '", fetch, "' was not found in the graph.");
+    if (reachability->kept.insert(name).second) queue.push_back(name);
+  }
+  while (!queue.empty()) {
+    const string name = queue.front();
+    queue.pop_front();
+    if (reachability->fed.count(name) > 0) continue;
+    for (const string& input : reachability->nodes[name]->input()) {
+      const string producer = ProducerName(input);
+      auto it = reachability->nodes.find(producer);
+      if (it == reachability->nodes.end())
+        return errors::InvalidArgument("Input '", input, "' of node '", name, "' was not found in the graph.");
+      if (input[0] == '^' && IsTrainingOnly(it->second->op())) continue;
+      if (reachability->kept.insert(producer).second) queue.push_back(producer);
+    }
+  }
+  return Status::OK();
+}
+
+string StringAttr(const NodeDef& node, const string& name) {
+  auto it = node.attr().find(name);
+  return it == node.attr().end() ? "" : it->second.s();
+}
+
+// Removes the control inputs and colocation constraints of "node" that refer
+// to nodes that are not kept.
+void RemoveDroppedReferences(const Reachability& reachability, NodeDef* node) {
+  auto* inputs = node->mutable_input();
+  for (int i = inputs->size() - 1; i >= 0; --i) {
+    const string& input = inputs->Get(i);
+    if (input[0] == '^' && reachability.kept.count(input.substr(1)) == 0) inputs->DeleteSubrange(i, 1);
+  }
+  auto class_attr = node->mutable_attr()->find("_class");
+  if (class_attr == node->mutable_attr()->end()) return;
+  AttrValue::ListValue locations;
+  for (const string& location : class_attr->second.list().s()) {
+    if (!StringPiece(location).starts_with("loc:@") || reachability.kept.count(location.substr(5)) > 0)
+      locations.add_s(location);
+  }
+  if (locations.s_size() == 0)
+    node->mutable_attr()->erase(class_attr);
+  else
+    *class_attr->second.mutable_list() = locations;
+}
+
+}  // namespace
+
+Status FindFrozenVariables(const GraphDef& graph_def, const std::vector<string>& fetches,
+                           const std::vector<string>& feeds, std::vector<FrozenVariable>* variables) {
+  Reachability reachability;
+  TF_RETURN_IF_ERROR(FindReachableNodes(graph_def, fetches, feeds, &reachability));
+  // Index the kept consumers of the data outputs of all nodes, and the readers of all resource variables.
+  std::unordered_map<string, std::vector<const NodeDef*>> consumers;
+  std::unordered_map<string, string> readers;
+  for (const NodeDef& node : graph_def.node()) {
+    if (node.op() == "ReadVariableOp" && node.input_size() > 0)
+      readers.emplace(ProducerName(node.input(0)), strings::StrCat(node.name(), ":0"));
+    if (reachability.kept.count(node.name()) == 0 || reachability.fed.count(node.name()) > 0) continue;
+    for (const string& input : node.input()) {
+      if (input[0] != '^') consumers[ProducerName(input)].push_back(&node);
+    }
+  }
+  variables->clear();
+  for (const NodeDef& node : graph_def.node()) {
+    if (reachability.kept.count(node.name()) == 0 || reachability.fed.count(node.name()) > 0) continue;
+    if (node.op() == "VarHandleOp") {
+      for (const NodeDef* consumer : consumers[node.name()]) {
+        if (consumer->op() != "ReadVariableOp" && consumer->op() != "ResourceGather")
+          return errors::FailedPrecondition(
+              "Variable '", node.name(), "' is used by node '", consumer->name(), "' (of type '", consumer->op(),
+              "'), which cannot be frozen.");
+      }
+      // The variable value is obtained using any of its readers, even if it is not needed for the fetches.
+      auto reader = readers.find(node.name());
+      if (reader == readers.end())
+        return errors::FailedPrecondition("Variable '", node.name(), "' has no 'ReadVariableOp' node.");
+      const string shared_name = StringAttr(node, "shared_name");
+      variables->push_back({node.name(), shared_name.empty() ? node.name() : shared_name, reader->second});
+    } else if (node.op() == "VariableV2" || node.op() == "Variable") {
+      for (const NodeDef* consumer : consumers[node.name()]) {
+        if (IsTrainingOnly(consumer->op()) || StringPiece(consumer->op()).starts_with("Scatter"))
+          return errors::FailedPrecondition(
+              "Variable '", node.name(), "' is updated by node '", consumer->name(), "' (of type '", consumer->op(),
+              "'), which cannot be frozen.");
+      }
+      variables->push_back({node.name(), node.name(), strings::StrCat(node.name(), ":0")});
+    }
+  }
+  return Status::OK();
+}
+
+Status ReadFrozenVariables(const string& checkpoint_prefix, const std::vector<FrozenVariable>& variables,
+                           std::vector<Tensor>* values) {
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  checkpoint::CheckpointReader reader(checkpoint_prefix, status.get());
+  TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+  values->clear();
+  values->reserve(variables.size());
+  for (const FrozenVariable& variable : variables) {
+    std::unique_ptr<Tensor> value;
+    reader.GetTensor(variable.checkpoint_key, &value, status.get());
+    TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+    values->push_back(*value);
+  }
+  return Status::OK();
+}
+
+Status FreezeAndPruneGraph(const GraphDef& graph_def, const std::vector<string>& fetches,
+                           const std::vector<string>& feeds, const std::vector<FrozenVariable>& variables,
+                           const std::vector<Tensor>& values, GraphDef* frozen_graph_def) {
+  if (variables.size() != values.size())
+    return errors::InvalidArgument(
+        "The number of variable values (", values.size(), ") does not match the number of variables (",
+        variables.size(), ").");
+  Reachability reachability;
+  TF_RETURN_IF_ERROR(FindReachableNodes(graph_def, fetches, feeds, &reachability));
+  std::unordered_map<string, const Tensor*> variable_values;
+  for (size_t i = 0; i < variables.size(); ++i)
+    variable_values[variables[i].node] = &values[i];
+
+  frozen_graph_def->Clear();
+  *frozen_graph_def->mutable_versions() = graph_def.versions();
+  *frozen_graph_def->mutable_library() = graph_def.library();
+  for (const NodeDef& node : graph_def.node()) {
+    if (reachability.kept.count(node.name()) == 0) continue;
+    NodeDef* frozen = frozen_graph_def->add_node();
+    auto value = variable_values.find(node.name());
+    if (reachability.fed.count(node.name()) > 0) {
+      const OpDef* op_def;
+      TF_RETURN_IF_ERROR(OpRegistry::Global()->LookUpOpDef(node.op(), &op_def));
+      DataTypeVector input_types;
+      DataTypeVector output_types;
+      TF_RETURN_IF_ERROR(InOutTypesForNode(node, *op_def, &input_types, &output_types));
+      if (output_types.empty())
+        return errors::InvalidArgument("Fed node '", node.name(), "' has no outputs.");
+      frozen->set_name(node.name());
+      frozen->set_op("Placeholder");
+      frozen->set_device(node.device());
+      (*frozen->mutable_attr())["dtype"].set_type(output_types[0]);
+      auto shapes = node.attr().find("_output_shapes");
+      if (shapes != node.attr().end() && shapes->second.list().shape_size() > 0)
+        *(*frozen->mutable_attr())["shape"].mutable_shape() = shapes->second.list().shape(0);
+    } else if (value != variable_values.end()) {
+      frozen->set_name(node.name());
+      frozen->set_op("Const");
+      frozen->set_device(node.device());
+      (*frozen->mutable_attr())["dtype"].set_type(value->second->dtype());
+      value->second->AsProtoTensorContent((*frozen->mutable_attr())["value"].mutable_tensor());
+    } else if (node.op() == "ReadVariableOp") {
+      *frozen = node;
+      frozen->set_op("Identity");
+      frozen->mutable_attr()->clear();
+      (*frozen->mutable_attr())["T"] = node.attr().at("dtype");
+    } else if (node.op() == "ResourceGather") {
+      *frozen = node;
+      frozen->set_op("Gather");
+      frozen->mutable_attr()->clear();
+      (*frozen->mutable_attr())["Tparams"] = node.attr().at("dtype");
+      (*frozen->mutable_attr())["Tindices"] = node.attr().at("Tindices");
+      auto validate_indices = node.attr().find("validate_indices");
+      if (validate_indices != node.attr().end())
+        (*frozen->mutable_attr())["validate_indices"] = validate_indices->second;
+    } else if (node.op() == "CheckNumerics" || node.op() == "Print") {
+      frozen->set_name(node.name());
+      frozen->set_op("Identity");
+      frozen->set_device(node.device());
+      for (const string& input : node.input()) {
+        if (input[0] == '^' || frozen->input_size() == 0) frozen->add_input(input);
+      }
+      (*frozen->mutable_attr())["T"] = node.attr().at("T");
+    } else {
+      *frozen = node;
+    }
+    RemoveDroppedReferences(reachability, frozen);
+  }
+  return Status::OK();
+}
+
+}  // namespace tensorflow
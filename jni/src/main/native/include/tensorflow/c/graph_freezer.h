@@ -0,0 +1,77 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_GRAPH_FREEZER_H_
+#define TENSORFLOW_C_GRAPH_FREEZER_H_
+
+#include <vector>
+
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Variable whose value is embedded in a frozen graph.
+struct FrozenVariable {
+  // Name of the "VarHandleOp" or "VariableV2" node of the variable.
+  string node;
+  // Name under which the variable value is stored in checkpoints.
+  string checkpoint_key;
+  // Name of a tensor that evaluates to the variable value in a session.
+  string tensor;
+};
+
+// Stores in "variables" the variables that must be frozen in order to compute
+// "fetches" (node or tensor names) in "graph_def", given that the tensors
+// "feeds" are fed. Only the nodes reachable from "fetches", through data and
+// control inputs, are considered, and the inputs of fed nodes are not
+// followed.
+Status FindFrozenVariables(const GraphDef& graph_def,
+                           const std::vector<string>& fetches,
+                           const std::vector<string>& feeds,
+                           std::vector<FrozenVariable>* variables);
+
+// Reads the values of "variables" from the checkpoint with prefix
+// "checkpoint_prefix".
+Status ReadFrozenVariables(const string& checkpoint_prefix,
+                           const std::vector<FrozenVariable>& variables,
+                           std::vector<Tensor>* values);
+
+// Stores in "frozen_graph_def" a serving version of "graph_def" that only
+// computes "fetches", given that "feeds" are fed:
+//   - Only the nodes reachable from "fetches" are kept, and the fed nodes are
+//     replaced by placeholders (which requires that only their first outputs
+//     are fed).
+//   - The "variables" found by "FindFrozenVariables" are replaced by constants
+//     holding "values". "ReadVariableOp" nodes become "Identity" nodes and
+//     "ResourceGather" nodes become "Gather" nodes.
+//   - Training-only nodes (i.e., savers, summaries, asserts, and prints) that
+//     are only reachable through control inputs are dropped, and the
+//     "CheckNumerics" and "Print" nodes that are reachable through data inputs
+//     are replaced by "Identity" nodes.
+//   - Control inputs and colocation constraints that refer to dropped nodes
+//     are removed.
+Status FreezeAndPruneGraph(const GraphDef& graph_def,
+                           const std::vector<string>& fetches,
+                           const std::vector<string>& feeds,
+                           const std::vector<FrozenVariable>& variables,
+                           const std::vector<Tensor>& values,
+                           GraphDef* frozen_graph_def);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_GRAPH_FREEZER_H_
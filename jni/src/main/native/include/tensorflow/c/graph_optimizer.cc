@@ -0,0 +1,67 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/graph_optimizer.h"
+
+#include <unordered_map>
+
+#include "tensorflow/core/grappler/clusters/utils.h"
+#include "tensorflow/core/grappler/clusters/virtual_cluster.h"
+#include "tensorflow/core/grappler/grappler_item.h"
+#include "tensorflow/core/grappler/optimizers/layout_optimizer.h"
+#include "tensorflow/core/grappler/optimizers/meta_optimizer.h"
+
+namespace tensorflow {
+
+Status OptimizeGraph(const GraphDef& graph_def, const RewriterConfig& config,
+                     const std::vector<string>& fetches,
+                     GraphDef* optimized_graph) {
+  grappler::GrapplerItem item;
+  item.id = "tf_scala_optimize_graph";
+  item.graph = graph_def;
+  item.fetch = fetches;
+
+  std::unordered_map<string, DeviceProperties> devices;
+  devices["/job:localhost/replica:0/task:0/cpu:0"] =
+      grappler::GetLocalCPUInfo();
+  grappler::VirtualCluster cluster(devices);
+  TF_RETURN_IF_ERROR(cluster.Provision());
+  return grappler::RunMetaOptimizer(item, config, nullptr, &cluster,
+                                    optimized_graph);
+}
+
+Status OptimizeGraphLayout(const GraphDef& graph_def,
+                           const std::vector<string>& fetches,
+                           GraphDef* optimized_graph) {
+  grappler::GrapplerItem item;
+  item.id = "tf_scala_optimize_graph_layout";
+  item.graph = graph_def;
+  item.fetch = fetches;
+
+  std::unordered_map<string, DeviceProperties> devices;
+  devices["/job:localhost/replica:0/task:0/cpu:0"] =
+      grappler::GetLocalCPUInfo();
+  devices["/job:localhost/replica:0/task:0/gpu:0"] =
+      grappler::GetLocalGPUInfo(0);
+  grappler::VirtualCluster cluster(devices);
+  TF_RETURN_IF_ERROR(cluster.Provision());
+  grappler::LayoutOptimizer optimizer;
+  // Otherwise, the optimizer counts the GPUs of the local machine and does
+  // nothing if there are none.
+  optimizer.set_num_gpus(1);
+  return optimizer.Optimize(&cluster, item, optimized_graph);
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,53 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_GRAPH_OPTIMIZER_H_
+#define TENSORFLOW_C_GRAPH_OPTIMIZER_H_
+
+#include <vector>
+
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/protobuf/rewriter_config.pb.h"
+
+namespace tensorflow {
+
+// Runs the Grappler meta-optimizer on "graph_def", using the optimizers
+// enabled in "config", and stores the optimized graph in "optimized_graph".
+// "fetches" are the names of the nodes whose outputs must be preserved (e.g.,
+// the output nodes of a serving signature). Nodes that are not needed in
+// order to compute them may be pruned. The optimizations are performed
+// offline, for a virtual cluster consisting of the local CPU, so that they
+// need not be repeated when creating sessions for the optimized graph.
+Status OptimizeGraph(const GraphDef& graph_def, const RewriterConfig& config,
+                     const std::vector<string>& fetches,
+                     GraphDef* optimized_graph);
+
+// Runs only the Grappler layout optimizer on "graph_def" and stores the
+// result in "optimized_graph". The optimizer converts the convolution-related
+// ops that are placed on GPUs (e.g., convolutions, pooling, and fused batch
+// normalization) from the NHWC to the NCHW data format, and inserts
+// transposes only at the boundaries of the converted subgraphs. It is run for
+// a virtual cluster consisting of the local CPU and a GPU, whether or not the
+// local machine has one, so that the changes that the optimizer would make
+// when running on GPUs can be previewed anywhere.
+Status OptimizeGraphLayout(const GraphDef& graph_def,
+                           const std::vector<string>& fetches,
+                           GraphDef* optimized_graph);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_GRAPH_OPTIMIZER_H_
@@ -0,0 +1,505 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/graph_quantizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+#include "tensorflow/core/framework/attr_value.pb.h"
+#include "tensorflow/core/framework/node_def.pb.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/graph/tensor_id.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Minimum width of the quantization ranges, which avoids dividing by zero for
+// constant tensors.
+const float kMinRangeWidth = 1e-6f;
+
+// Chain of float nodes that is replaced by quantized ops: a "MatMul" or a
+// "Conv2D" node with constant weights, optionally followed by a "BiasAdd"
+// node with a constant bias, and then optionally by a "Relu" or a "Relu6"
+// node. Each node of the chain is the only consumer of the previous one.
+struct QuantizableChain {
+  const NodeDef* op = nullptr;
+  const NodeDef* weights = nullptr;
+  const NodeDef* bias_add = nullptr;
+  const NodeDef* bias = nullptr;
+  const NodeDef* activation = nullptr;
+};
+
+// Index of the nodes of a graph and of the consumers of their outputs.
+class GraphIndex {
+ public:
+  explicit GraphIndex(const GraphDef& graph_def) {
+    for (const NodeDef& node : graph_def.node()) {
+      nodes_[node.name()] = &node;
+      for (const string& input : node.input()) {
+        if (!input.empty() && input[0] == '^') {
+          ++num_consumers_[input.substr(1)];
+          continue;
+        }
+        const TensorId id = ParseTensorName(input);
+        const string producer = id.first.ToString();
+        ++num_consumers_[producer];
+        if (id.second == 0) first_output_consumers_[producer] = &node;
+      }
+    }
+  }
+
+  const NodeDef* node(const string& name) const {
+    auto it = nodes_.find(name);
+    return it == nodes_.end() ? nullptr : it->second;
+  }
+
+  // Returns the node producing the float tensor "input", if it is the first
+  // output of a constant node, or "nullptr", otherwise.
+  const NodeDef* FloatConstant(const string& input) const {
+    if (input.empty() || input[0] == '^') return nullptr;
+    const TensorId id = ParseTensorName(input);
+    if (id.second != 0) return nullptr;
+    const NodeDef* n = node(id.first.ToString());
+    if (n == nullptr || n->op() != "Const") return nullptr;
+    auto dtype = n->attr().find("dtype");
+    if (dtype == n->attr().end() || dtype->second.type() != DT_FLOAT)
+      return nullptr;
+    return n;
+  }
+
+  // Returns the only consumer of the node named "name", if that node has
+  // exactly one consumer, which consumes its first output, or "nullptr",
+  // otherwise.
+  const NodeDef* OnlyConsumer(const string& name) const {
+    if (num_consumers(name) != 1) return nullptr;
+    auto it = first_output_consumers_.find(name);
+    return it == first_output_consumers_.end() ? nullptr : it->second;
+  }
+
+  int num_consumers(const string& name) const {
+    auto it = num_consumers_.find(name);
+    return it == num_consumers_.end() ? 0 : it->second;
+  }
+
+ private:
+  std::unordered_map<string, const NodeDef*> nodes_;
+  std::unordered_map<string, int> num_consumers_;
+  std::unordered_map<string, const NodeDef*> first_output_consumers_;
+};
+
+bool HasAttr(const NodeDef& node, const string& name, DataType type) {
+  auto it = node.attr().find(name);
+  return it != node.attr().end() && it->second.type() == type;
+}
+
+bool HasStringAttrOrNone(const NodeDef& node, const string& name,
+                         const string& value) {
+  auto it = node.attr().find(name);
+  return it == node.attr().end() || it->second.s() == value;
+}
+
+// Returns "true" if "node" is a float "MatMul" node, or a float "Conv2D"
+// node that is supported by "QuantizedConv2D" (i.e., in the "NHWC" format and
+// without dilations).
+bool IsQuantizableOp(const NodeDef& node) {
+  if (!HasAttr(node, "T", DT_FLOAT) || node.input_size() < 2) return false;
+  if (node.op() == "MatMul") return true;
+  if (node.op() != "Conv2D") return false;
+  if (!HasStringAttrOrNone(node, "data_format", "NHWC")) return false;
+  auto dilations = node.attr().find("dilations");
+  if (dilations != node.attr().end()) {
+    for (int64 d : dilations->second.list().i())
+      if (d != 1) return false;
+  }
+  return true;
+}
+
+// Finds all quantizable chains of "graph_def".
+std::vector<QuantizableChain> FindChains(const GraphDef& graph_def,
+                                         const GraphIndex& index) {
+  std::vector<QuantizableChain> chains;
+  for (const NodeDef& node : graph_def.node()) {
+    if (!IsQuantizableOp(node)) continue;
+    if (node.input(0).empty() || node.input(0)[0] == '^') continue;
+    QuantizableChain chain;
+    chain.op = &node;
+    chain.weights = index.FloatConstant(node.input(1));
+    if (chain.weights == nullptr) continue;
+    const NodeDef* last = &node;
+    const NodeDef* next = index.OnlyConsumer(last->name());
+    if (next != nullptr && next->op() == "BiasAdd" &&
+        HasAttr(*next, "T", DT_FLOAT) && next->input_size() >= 2 &&
+        HasStringAttrOrNone(*next, "data_format", "NHWC")) {
+      const NodeDef* bias = index.FloatConstant(next->input(1));
+      if (bias != nullptr && ParseTensorName(next->input(0)).first ==
+                                 StringPiece(last->name())) {
+        chain.bias_add = next;
+        chain.bias = bias;
+        last = next;
+        next = index.OnlyConsumer(last->name());
+      }
+    }
+    if (next != nullptr && (next->op() == "Relu" || next->op() == "Relu6") &&
+        HasAttr(*next, "T", DT_FLOAT))
+      chain.activation = next;
+    chains.push_back(chain);
+  }
+  return chains;
+}
+
+string OutputName(const string& node, int index) {
+  return strings::StrCat(node, ":", index);
+}
+
+// Returns the name of the float tensor consumed as "input".
+string InputTensorName(const string& input) {
+  const TensorId id = ParseTensorName(input);
+  return OutputName(id.first.ToString(), id.second);
+}
+
+Status GetRange(const QuantizationRanges& ranges, const string& tensor,
+                float* min, float* max) {
+  auto it = ranges.find(tensor);
+  if (it == ranges.end())
+    return errors::InvalidArgument("No calibrated range for tensor '", tensor,
+                                   "'.");
+  // Quantized ranges must contain zero, so that zero padding and ReLUs are
+  // exact.
+  *min = std::min(it->second.first, 0.0f);
+  *max = std::max(it->second.second, 0.0f);
+  if (*max - *min < kMinRangeWidth) *max = *min + kMinRangeWidth;
+  return Status::OK();
+}
+
+// Builder of the nodes of the quantized graph.
+class QuantizedGraphBuilder {
+ public:
+  QuantizedGraphBuilder(GraphDef* graph_def,
+                        const std::unordered_set<string>* existing_names)
+      : graph_def_(graph_def), existing_names_(existing_names) {}
+
+  Status AddNode(const string& name, const string& op, const string& device,
+                 NodeDef** node) {
+    if (existing_names_->count(name) > 0 || !added_names_.insert(name).second)
+      return errors::InvalidArgument("Cannot add node '", name,
+                                     "' to the quantized graph, because a "
+                                     "node with the same name exists.");
+    *node = graph_def_->add_node();
+    (*node)->set_name(name);
+    (*node)->set_op(op);
+    if (!device.empty()) (*node)->set_device(device);
+    return Status::OK();
+  }
+
+  Status AddFloatConstant(const string& name, float value,
+                          const string& device) {
+    NodeDef* node;
+    TF_RETURN_IF_ERROR(AddNode(name, "Const", device, &node));
+    Tensor tensor(DT_FLOAT, TensorShape({}));
+    tensor.scalar<float>()() = value;
+    SetType(node, "dtype", DT_FLOAT);
+    tensor.AsProtoTensorContent(
+        (*node->mutable_attr())["value"].mutable_tensor());
+    return Status::OK();
+  }
+
+  // Adds constant nodes named "name/min" and "name/max" containing a range.
+  Status AddRange(const string& name, float min, float max,
+                  const string& device) {
+    TF_RETURN_IF_ERROR(
+        AddFloatConstant(strings::StrCat(name, "/min"), min, device));
+    return AddFloatConstant(strings::StrCat(name, "/max"), max, device);
+  }
+
+  // Adds a constant node named "name" containing the eight-bit quantized
+  // value of the float constant "node", along with constant nodes named
+  // "name/min" and "name/max" containing its range.
+  Status AddQuantizedConstant(const string& name, const NodeDef& node,
+                              const string& device) {
+    Tensor value;
+    if (!value.FromProto(node.attr().at("value").tensor()))
+      return errors::InvalidArgument("Invalid value for constant node '",
+                                     node.name(), "'.");
+    const auto flat = value.flat<float>();
+    float min = 0.0f;
+    float max = 0.0f;
+    for (int64 i = 0; i < flat.size(); ++i) {
+      min = std::min(min, flat(i));
+      max = std::max(max, flat(i));
+    }
+    if (max - min < kMinRangeWidth) max = min + kMinRangeWidth;
+
+    // This matches the "MIN_FIRST" mode of the "QuantizeV2" op.
+    Tensor quantized(DT_QUINT8, value.shape());
+    auto quantized_flat = quantized.flat<quint8>();
+    const float range_scale = 255.0f / (max - min);
+    const float offset = std::round(min * range_scale);
+    for (int64 i = 0; i < flat.size(); ++i) {
+      const float q = std::round(flat(i) * range_scale) - offset;
+      quantized_flat(i) =
+          static_cast<uint8>(std::min(255.0f, std::max(0.0f, q)));
+    }
+
+    NodeDef* quantized_node;
+    TF_RETURN_IF_ERROR(AddNode(name, "Const", device, &quantized_node));
+    SetType(quantized_node, "dtype", DT_QUINT8);
+    quantized.AsProtoTensorContent(
+        (*quantized_node->mutable_attr())["value"].mutable_tensor());
+    return AddRange(name, min, max, device);
+  }
+
+  static void SetType(NodeDef* node, const string& name, DataType type) {
+    (*node->mutable_attr())[name].set_type(type);
+  }
+
+ private:
+  GraphDef* graph_def_;
+  const std::unordered_set<string>* existing_names_;
+  std::unordered_set<string> added_names_;
+};
+
+// Eight-bit quantized version of a float tensor, represented by the names of
+// the three tensors containing its quantized value and its range.
+struct QuantizedTensor {
+  string value;
+  string min;
+  string max;
+};
+
+QuantizedTensor QuantizedOutputs(const string& node) {
+  return {OutputName(node, 0), OutputName(node, 1), OutputName(node, 2)};
+}
+
+}  // namespace
+
+Status FindQuantizationCalibrationTensors(const GraphDef& graph_def,
+                                          std::vector<string>* tensors) {
+  const GraphIndex index(graph_def);
+  std::unordered_set<string> added;
+  auto add = [tensors, &added](const string& tensor) {
+    if (added.insert(tensor).second) tensors->push_back(tensor);
+  };
+  for (const QuantizableChain& chain : FindChains(graph_def, index)) {
+    add(InputTensorName(chain.op->input(0)));
+    add(OutputName(chain.op->name(), 0));
+    if (chain.bias_add != nullptr) add(OutputName(chain.bias_add->name(), 0));
+  }
+  return Status::OK();
+}
+
+Status QuantizeGraph(const GraphDef& graph_def,
+                     const QuantizationRanges& ranges,
+                     GraphDef* quantized_graph) {
+  const GraphIndex index(graph_def);
+  const std::vector<QuantizableChain> chains = FindChains(graph_def, index);
+
+  // Nodes that are replaced, mapped to the quantized versions of their
+  // outputs, so that consecutive quantized chains are connected directly.
+  std::unordered_map<string, QuantizedTensor> quantized_outputs;
+  std::unordered_set<string> removed;
+  std::unordered_map<string, int> removed_constant_consumers;
+  for (const QuantizableChain& chain : chains) {
+    const string& op = chain.op->name();
+    quantized_outputs[op] =
+        QuantizedOutputs(strings::StrCat(op, "/eightbit/requantize"));
+    removed.insert(op);
+    ++removed_constant_consumers[chain.weights->name()];
+    if (chain.bias_add != nullptr) {
+      const string& bias_add = chain.bias_add->name();
+      quantized_outputs[bias_add] =
+          QuantizedOutputs(strings::StrCat(bias_add, "/eightbit/requantize"));
+      removed.insert(bias_add);
+      ++removed_constant_consumers[chain.bias->name()];
+    }
+    if (chain.activation != nullptr) {
+      const string& activation = chain.activation->name();
+      quantized_outputs[activation] =
+          QuantizedOutputs(strings::StrCat(activation, "/eightbit"));
+      removed.insert(activation);
+    }
+  }
+  // Constants that are only used by replaced nodes are removed as well.
+  for (const auto& constant : removed_constant_consumers) {
+    if (index.num_consumers(constant.first) == constant.second)
+      removed.insert(constant.first);
+  }
+
+  std::unordered_set<string> existing_names;
+  *quantized_graph = graph_def;
+  quantized_graph->clear_node();
+  for (const NodeDef& node : graph_def.node()) {
+    existing_names.insert(node.name());
+    if (removed.count(node.name()) == 0) *quantized_graph->add_node() = node;
+  }
+  // The names of the replaced nodes are reused by their "Dequantize" nodes.
+  for (const string& name : removed) existing_names.erase(name);
+
+  QuantizedGraphBuilder builder(quantized_graph, &existing_names);
+  NodeDef* node;
+
+  // Adds a "Dequantize" node named "name", which replaces the node with that
+  // name, and has the same control inputs.
+  auto add_dequantize = [&builder, &node, &quantized_outputs](
+                            const NodeDef& original) {
+    const QuantizedTensor& q = quantized_outputs.at(original.name());
+    TF_RETURN_IF_ERROR(builder.AddNode(original.name(), "Dequantize",
+                                       original.device(), &node));
+    node->add_input(q.value);
+    node->add_input(q.min);
+    node->add_input(q.max);
+    for (const string& input : original.input())
+      if (!input.empty() && input[0] == '^') node->add_input(input);
+    QuantizedGraphBuilder::SetType(node, "T", DT_QUINT8);
+    (*node->mutable_attr())["mode"].set_s("MIN_FIRST");
+    return Status::OK();
+  };
+
+  // Adds a "Requantize" node named "name" that converts the 32-bit outputs of
+  // "accumulator" to eight bits, using the calibrated range of "tensor".
+  auto add_requantize = [&builder, &node, &ranges](
+                            const string& name, const string& accumulator,
+                            const string& tensor, const string& device) {
+    float min;
+    float max;
+    TF_RETURN_IF_ERROR(GetRange(ranges, tensor, &min, &max));
+    TF_RETURN_IF_ERROR(builder.AddRange(name, min, max, device));
+    TF_RETURN_IF_ERROR(builder.AddNode(name, "Requantize", device, &node));
+    const QuantizedTensor q = QuantizedOutputs(accumulator);
+    node->add_input(q.value);
+    node->add_input(q.min);
+    node->add_input(q.max);
+    node->add_input(strings::StrCat(name, "/min"));
+    node->add_input(strings::StrCat(name, "/max"));
+    QuantizedGraphBuilder::SetType(node, "Tinput", DT_QINT32);
+    QuantizedGraphBuilder::SetType(node, "out_type", DT_QUINT8);
+    return Status::OK();
+  };
+
+  for (const QuantizableChain& chain : chains) {
+    const NodeDef& op = *chain.op;
+    const string& device = op.device();
+    const string prefix = strings::StrCat(op.name(), "/eightbit");
+
+    // Quantize the input, unless it is produced by another quantized chain.
+    QuantizedTensor input;
+    const TensorId input_id = ParseTensorName(op.input(0));
+    auto producer = quantized_outputs.find(input_id.first.ToString());
+    if (input_id.second == 0 && producer != quantized_outputs.end()) {
+      input = producer->second;
+    } else {
+      const string input_name = strings::StrCat(prefix, "/input");
+      float min;
+      float max;
+      TF_RETURN_IF_ERROR(
+          GetRange(ranges, InputTensorName(op.input(0)), &min, &max));
+      TF_RETURN_IF_ERROR(builder.AddRange(input_name, min, max, device));
+      TF_RETURN_IF_ERROR(
+          builder.AddNode(input_name, "QuantizeV2", device, &node));
+      node->add_input(op.input(0));
+      node->add_input(strings::StrCat(input_name, "/min"));
+      node->add_input(strings::StrCat(input_name, "/max"));
+      QuantizedGraphBuilder::SetType(node, "T", DT_QUINT8);
+      (*node->mutable_attr())["mode"].set_s("MIN_FIRST");
+      input = QuantizedOutputs(input_name);
+    }
+
+    // Compute the op using eight-bit inputs and a 32-bit accumulator.
+    const string weights = strings::StrCat(prefix, "/weights");
+    TF_RETURN_IF_ERROR(
+        builder.AddQuantizedConstant(weights, *chain.weights, device));
+    const bool is_matmul = op.op() == "MatMul";
+    TF_RETURN_IF_ERROR(builder.AddNode(
+        prefix, is_matmul ? "QuantizedMatMul" : "QuantizedConv2D", device,
+        &node));
+    node->add_input(input.value);
+    node->add_input(weights);
+    node->add_input(input.min);
+    node->add_input(input.max);
+    node->add_input(strings::StrCat(weights, "/min"));
+    node->add_input(strings::StrCat(weights, "/max"));
+    for (const string& op_input : op.input())
+      if (!op_input.empty() && op_input[0] == '^') node->add_input(op_input);
+    if (is_matmul) {
+      QuantizedGraphBuilder::SetType(node, "T1", DT_QUINT8);
+      QuantizedGraphBuilder::SetType(node, "T2", DT_QUINT8);
+      QuantizedGraphBuilder::SetType(node, "Toutput", DT_QINT32);
+      for (const char* attr : {"transpose_a", "transpose_b"}) {
+        auto it = op.attr().find(attr);
+        if (it != op.attr().end()) (*node->mutable_attr())[attr] = it->second;
+      }
+    } else {
+      QuantizedGraphBuilder::SetType(node, "Tinput", DT_QUINT8);
+      QuantizedGraphBuilder::SetType(node, "Tfilter", DT_QUINT8);
+      QuantizedGraphBuilder::SetType(node, "out_type", DT_QINT32);
+      (*node->mutable_attr())["strides"] = op.attr().at("strides");
+      (*node->mutable_attr())["padding"] = op.attr().at("padding");
+    }
+    TF_RETURN_IF_ERROR(add_requantize(strings::StrCat(prefix, "/requantize"),
+                                      prefix, OutputName(op.name(), 0),
+                                      device));
+    TF_RETURN_IF_ERROR(add_dequantize(op));
+
+    if (chain.bias_add != nullptr) {
+      const NodeDef& bias_add = *chain.bias_add;
+      const string& bias_device = bias_add.device();
+      const string bias_prefix = strings::StrCat(bias_add.name(), "/eightbit");
+      const string bias = strings::StrCat(bias_prefix, "/bias");
+      const QuantizedTensor& bias_input = quantized_outputs.at(op.name());
+      TF_RETURN_IF_ERROR(
+          builder.AddQuantizedConstant(bias, *chain.bias, bias_device));
+      TF_RETURN_IF_ERROR(builder.AddNode(bias_prefix, "QuantizedBiasAdd",
+                                         bias_device, &node));
+      node->add_input(bias_input.value);
+      node->add_input(bias);
+      node->add_input(bias_input.min);
+      node->add_input(bias_input.max);
+      node->add_input(strings::StrCat(bias, "/min"));
+      node->add_input(strings::StrCat(bias, "/max"));
+      QuantizedGraphBuilder::SetType(node, "T1", DT_QUINT8);
+      QuantizedGraphBuilder::SetType(node, "T2", DT_QUINT8);
+      QuantizedGraphBuilder::SetType(node, "out_type", DT_QINT32);
+      TF_RETURN_IF_ERROR(add_requantize(
+          strings::StrCat(bias_prefix, "/requantize"), bias_prefix,
+          OutputName(bias_add.name(), 0), bias_device));
+      TF_RETURN_IF_ERROR(add_dequantize(bias_add));
+    }
+
+    if (chain.activation != nullptr) {
+      const NodeDef& activation = *chain.activation;
+      const QuantizedTensor& activation_input = quantized_outputs.at(
+          chain.bias_add != nullptr ? chain.bias_add->name() : op.name());
+      TF_RETURN_IF_ERROR(builder.AddNode(
+          strings::StrCat(activation.name(), "/eightbit"),
+          activation.op() == "Relu" ? "QuantizedRelu" : "QuantizedRelu6",
+          activation.device(), &node));
+      node->add_input(activation_input.value);
+      node->add_input(activation_input.min);
+      node->add_input(activation_input.max);
+      QuantizedGraphBuilder::SetType(node, "Tinput", DT_QUINT8);
+      QuantizedGraphBuilder::SetType(node, "out_type", DT_QUINT8);
+      TF_RETURN_IF_ERROR(add_dequantize(activation));
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,61 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_GRAPH_QUANTIZER_H_
+#define TENSORFLOW_C_GRAPH_QUANTIZER_H_
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Calibrated ranges of float tensors, keyed by tensor name (e.g., "conv:0").
+typedef std::unordered_map<string, std::pair<float, float>>
+    QuantizationRanges;
+
+// Stores in "tensors" the names of the float tensors of "graph_def" whose
+// ranges must be calibrated in order to quantize it using "QuantizeGraph".
+// These are the inputs and outputs of the "MatMul" and "Conv2D" nodes with
+// constant weights, and the outputs of the "BiasAdd" nodes with constant
+// biases that follow them.
+Status FindQuantizationCalibrationTensors(const GraphDef& graph_def,
+                                          std::vector<string>* tensors);
+
+// Rewrites "graph_def", which must be frozen, so that its "MatMul" and
+// "Conv2D" nodes with constant weights, along with any "BiasAdd", "Relu" and
+// "Relu6" nodes that directly follow them, are computed using eight-bit
+// quantized ops, and stores the result in "quantized_graph".
+//
+// The weights and biases are quantized offline, and the activations are
+// quantized using the calibrated "ranges", which must contain the ranges of
+// all tensors returned by "FindQuantizationCalibrationTensors". Since the
+// output ranges of the 32-bit accumulators are known, each quantized op is
+// fused with a "Requantize" op that uses a constant range, rather than with a
+// "RequantizationRange" op that computes the range of each batch. Consecutive
+// quantized ops exchange their eight-bit outputs directly, and a "Dequantize"
+// node replaces each rewritten node, under the same name, so that the
+// rewritten graph can be fed and fetched in the same way as the original one.
+Status QuantizeGraph(const GraphDef& graph_def,
+                     const QuantizationRanges& ranges,
+                     GraphDef* quantized_graph);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_GRAPH_QUANTIZER_H_
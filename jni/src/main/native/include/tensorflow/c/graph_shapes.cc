@@ -0,0 +1,81 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "graph_shapes.h"
+
+#include "c_api_internal.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Returns the inference context of the op that produces "output", or sets an
+// error in "status" and returns null, if "output" is not a valid output.
+shape_inference::InferenceContext* OutputContext(TF_Graph* graph, const TF_Output& output, TF_Status* status)
+    EXCLUSIVE_LOCKS_REQUIRED(graph->mu) {
+  const Node* node = &output.oper->node;
+  if (output.index < 0 || output.index >= node->num_outputs()) {
+    status->status = errors::OutOfRange(
+        "Invalid output index ", output.index, " for op '", node->name(), "', which has ", node->num_outputs(),
+        " outputs.");
+    return nullptr;
+  }
+  shape_inference::InferenceContext* ic = graph->refiner.GetContext(node);
+  if (ic == nullptr)
+    status->status = errors::InvalidArgument("Op '", node->name(), "' was not found in the shape refiner.");
+  return ic;
+}
+
+}  // namespace
+
+void GetTensorShapes(TF_Graph* graph, const TF_Output* outputs, int num_outputs, std::vector<int64>* shapes,
+                     TF_Status* status) {
+  mutex_lock l(graph->mu);
+  for (int i = 0; i < num_outputs; ++i) {
+    shape_inference::InferenceContext* ic = OutputContext(graph, outputs[i], status);
+    if (ic == nullptr) return;
+    shape_inference::ShapeHandle shape = ic->output(outputs[i].index);
+    if (!ic->RankKnown(shape)) {
+      shapes->push_back(-1);
+      continue;
+    }
+    const int32 rank = ic->Rank(shape);
+    shapes->push_back(rank);
+    for (int32 d = 0; d < rank; ++d)
+      shapes->push_back(ic->Value(ic->Dim(shape, d)));
+  }
+}
+
+void SetTensorShapes(TF_Graph* graph, const TF_Output* outputs, int num_outputs, const int* ranks, const int64* dims,
+                     TF_Status* status) {
+  mutex_lock l(graph->mu);
+  for (int i = 0; i < num_outputs; ++i) {
+    shape_inference::InferenceContext* ic = OutputContext(graph, outputs[i], status);
+    if (ic == nullptr) return;
+    shape_inference::ShapeHandle shape = ic->UnknownShape();
+    if (ranks[i] >= 0) {
+      std::vector<shape_inference::DimensionHandle> dim_handles;
+      dim_handles.reserve(static_cast<size_t>(ranks[i]));
+      for (int d = 0; d < ranks[i]; ++d)
+        dim_handles.push_back(dims[d] == -1 ? ic->UnknownDim() : ic->MakeDim(dims[d]));
+      shape = ic->MakeShape(dim_handles);
+      dims += ranks[i];
+    }
+    status->status = graph->refiner.SetShape(&outputs[i].oper->node, outputs[i].index, shape);
+    if (!status->status.ok()) return;
+  }
+}
+
+}  // namespace tensorflow
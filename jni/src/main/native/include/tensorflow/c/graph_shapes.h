@@ -0,0 +1,44 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_GRAPH_SHAPES_H_
+#define TENSORFLOW_C_GRAPH_SHAPES_H_
+
+#include <vector>
+
+#include "c_api.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Same as calling "TF_GraphGetTensorShape" for each of the "num_outputs"
+// outputs in "outputs", which must all belong to "graph", but holding the
+// graph lock only once. The shapes are appended to "shapes", packed such that
+// each shape is represented by its rank (-1 if unknown), followed by its
+// dimensions (-1 for unknown dimensions), if its rank is known.
+void GetTensorShapes(TF_Graph* graph, const TF_Output* outputs, int num_outputs,
+                     std::vector<int64>* shapes, TF_Status* status);
+
+// Same as calling "TF_GraphSetTensorShape" for each of the "num_outputs"
+// outputs in "outputs", which must all belong to "graph", but holding the
+// graph lock only once. "ranks[i]" is the rank of the shape of "outputs[i]"
+// (-1 if unknown) and its dimensions are stored consecutively in "dims", after
+// those of the previous outputs. Stops at the first shape that cannot be set.
+void SetTensorShapes(TF_Graph* graph, const TF_Output* outputs, int num_outputs,
+                     const int* ranks, const int64* dims, TF_Status* status);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_GRAPH_SHAPES_H_
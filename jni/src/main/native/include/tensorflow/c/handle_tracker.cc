@@ -0,0 +1,97 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/handle_tracker.h"
+
+namespace tensorflow {
+
+namespace {
+
+string* ThreadTag() {
+  static thread_local string tag;
+  return &tag;
+}
+
+}  // namespace
+
+HandleTracker* HandleTracker::Global() {
+  static HandleTracker* tracker = new HandleTracker();
+  return tracker;
+}
+
+const char* HandleTracker::TypeName(Type type) {
+  switch (type) {
+    case kTensor:
+      return "Tensor";
+    case kEagerTensor:
+      return "EagerTensor";
+    case kRecordReader:
+      return "RecordReader";
+    case kBufferedInputStream:
+      return "BufferedInputStream";
+    default:
+      return "Unknown";
+  }
+}
+
+void HandleTracker::SetThreadTag(const string& tag) { *ThreadTag() = tag; }
+
+void HandleTracker::SetEnabled(bool enabled) {
+  mutex_lock l(mu_);
+  enabled_.store(enabled, std::memory_order_relaxed);
+  if (!enabled) {
+    live_.clear();
+    statistics_.clear();
+  }
+}
+
+void HandleTracker::TrackSlow(Type type, const void* handle, int64 bytes) {
+  const string& tag = *ThreadTag();
+  mutex_lock l(mu_);
+  // Tracking may have been disabled since "enabled()" was checked.
+  if (!enabled() || live_.find(handle) != live_.end()) return;
+  auto it = statistics_.find(std::make_pair(static_cast<int>(type), tag));
+  if (it == statistics_.end()) {
+    it = statistics_.emplace(std::make_pair(static_cast<int>(type), tag), Statistics()).first;
+    it->second.type = type;
+    it->second.tag = tag;
+  }
+  Statistics* statistics = &it->second;
+  ++statistics->live_count;
+  statistics->live_bytes += bytes;
+  ++statistics->num_created;
+  live_.emplace(handle, Entry{statistics, bytes});
+}
+
+void HandleTracker::UntrackSlow(const void* handle) {
+  mutex_lock l(mu_);
+  auto it = live_.find(handle);
+  if (it == live_.end()) return;
+  Statistics* statistics = it->second.statistics;
+  --statistics->live_count;
+  statistics->live_bytes -= it->second.bytes;
+  ++statistics->num_released;
+  live_.erase(it);
+}
+
+std::vector<HandleTracker::Statistics> HandleTracker::Snapshot() {
+  mutex_lock l(mu_);
+  std::vector<Statistics> result;
+  result.reserve(statistics_.size());
+  for (const auto& statistics : statistics_) result.push_back(statistics.second);
+  return result;
+}
+
+}  // namespace tensorflow
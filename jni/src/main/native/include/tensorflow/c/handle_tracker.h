@@ -0,0 +1,108 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_HANDLE_TRACKER_H_
+#define TENSORFLOW_C_HANDLE_TRACKER_H_
+
+#include <atomic>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Opt-in registry of the live native handles that were handed out by the JNI
+// library, used to find handles that are never deleted (i.e., leaks). While
+// tracking is disabled (the default), tracking a handle only costs an atomic
+// load. While it is enabled, each tracked handle is recorded along with its
+// size in bytes and with the allocation site tag of the thread that created
+// it (see "SetThreadTag"), and statistics are kept per handle type and tag.
+// Handles that were created while tracking was disabled are ignored when they
+// are released. An instance of this class is safe for concurrent access by
+// multiple threads.
+class HandleTracker {
+ public:
+  enum Type { kTensor = 0, kEagerTensor, kRecordReader, kBufferedInputStream, kNumTypes };
+
+  // Statistics of the handles of a single type and tag.
+  struct Statistics {
+    Type type;
+    string tag;
+    int64 live_count = 0;
+    int64 live_bytes = 0;
+    // Number of handles created and released since tracking was enabled.
+    int64 num_created = 0;
+    int64 num_released = 0;
+  };
+
+  // Returns the process-wide instance, which is never destroyed.
+  static HandleTracker* Global();
+
+  static const char* TypeName(Type type);
+
+  // Sets the allocation site tag of the handles created by the current thread.
+  static void SetThreadTag(const string& tag);
+
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Enables or disables tracking. All statistics are cleared when tracking is
+  // disabled.
+  void SetEnabled(bool enabled);
+
+  // Records that "handle" of type "type", which holds "bytes" bytes, has been
+  // created. Handles that are already being tracked are ignored.
+  void Track(Type type, const void* handle, int64 bytes) {
+    if (enabled()) TrackSlow(type, handle, bytes);
+  }
+
+  // Records that "handle" has been released.
+  void Untrack(const void* handle) {
+    if (enabled()) UntrackSlow(handle);
+  }
+
+  // Returns the current statistics, sorted by handle type and tag.
+  std::vector<Statistics> Snapshot();
+
+ private:
+  struct Entry {
+    Statistics* statistics;
+    int64 bytes;
+  };
+
+  HandleTracker() : enabled_(false) {}
+
+  void TrackSlow(Type type, const void* handle, int64 bytes);
+  void UntrackSlow(const void* handle);
+
+  std::atomic<bool> enabled_;
+
+  mutex mu_;
+  std::unordered_map<const void*, Entry> live_ GUARDED_BY(mu_);
+  // Statistics per handle type and tag. The entries of a map are never moved
+  // and so live handles point to the statistics that they count towards.
+  std::map<std::pair<int, string>, Statistics> statistics_ GUARDED_BY(mu_);
+
+  TF_DISALLOW_COPY_AND_ASSIGN(HandleTracker);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_HANDLE_TRACKER_H_
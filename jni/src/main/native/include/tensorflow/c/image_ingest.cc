@@ -0,0 +1,85 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/image_ingest.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace tensorflow {
+
+namespace {
+
+// Minimum number of elements processed per block. Blocks span a whole number
+// of channel groups, so that the inner loops index the scale and shift vectors
+// without modular arithmetic and can be vectorized by the compiler (e.g., into
+// AVX2 or NEON instructions, depending on the target architecture).
+constexpr int64 kMinBlockSize = 256;
+
+// Scale and shift vectors repeated to span a whole block.
+struct BlockCoefficients {
+  BlockCoefficients(int64 num_channels, const float* scale,
+                    const float* shift) {
+    const int64 num_groups = (kMinBlockSize + num_channels - 1) / num_channels;
+    size = num_groups * num_channels;
+    block_scale.resize(size);
+    block_shift.resize(size);
+    for (int64 i = 0; i < size; ++i) {
+      block_scale[i] = scale[i % num_channels];
+      block_shift[i] = shift[i % num_channels];
+    }
+  }
+
+  int64 size;
+  std::vector<float> block_scale;
+  std::vector<float> block_shift;
+};
+
+inline void IngestBlock(const uint8* __restrict src, int64 n,
+                        const float* __restrict scale,
+                        const float* __restrict shift,
+                        float* __restrict dst) {
+  for (int64 i = 0; i < n; ++i)
+    dst[i] = static_cast<float>(src[i]) * scale[i] + shift[i];
+}
+
+}  // namespace
+
+void IngestUInt8(const uint8* src, int64 n, int64 num_channels,
+                 const float* scale, const float* shift, float* dst) {
+  const BlockCoefficients coefficients(num_channels, scale, shift);
+  for (int64 start = 0; start < n; start += coefficients.size) {
+    IngestBlock(src + start, std::min(coefficients.size, n - start),
+                coefficients.block_scale.data(),
+                coefficients.block_shift.data(), dst + start);
+  }
+}
+
+void IngestUInt8(const uint8* src, int64 n, int64 num_channels,
+                 const float* scale, const float* shift, Eigen::half* dst) {
+  const BlockCoefficients coefficients(num_channels, scale, shift);
+  // Each block is first computed in single precision, in a buffer that stays
+  // in the L1 cache, and then narrowed to half precision.
+  std::vector<float> block(coefficients.size);
+  for (int64 start = 0; start < n; start += coefficients.size) {
+    const int64 size = std::min(coefficients.size, n - start);
+    IngestBlock(src + start, size, coefficients.block_scale.data(),
+                coefficients.block_shift.data(), block.data());
+    for (int64 i = 0; i < size; ++i)
+      dst[start + i] = Eigen::half(block[i]);
+  }
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,39 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_IMAGE_INGEST_H_
+#define TENSORFLOW_C_IMAGE_INGEST_H_
+
+#include "tensorflow/core/framework/numeric_types.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Converts "n" bytes (e.g., image pixels) whose channels are interleaved (i.e.,
+// the channel is the innermost dimension) to floating-point values, computing
+// "src[i] * scale[c] + shift[c]" for each element "i" of channel "c", in a
+// single pass. "scale" and "shift" must contain "num_channels" values each.
+// This fuses the cast and the normalization that would otherwise be executed
+// as separate ops, with intermediate tensors.
+void IngestUInt8(const uint8* src, int64 n, int64 num_channels,
+                 const float* scale, const float* shift, float* dst);
+
+// Same as above, but producing half-precision values.
+void IngestUInt8(const uint8* src, int64 n, int64 num_channels,
+                 const float* scale, const float* shift, Eigen::half* dst);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_IMAGE_INGEST_H_
@@ -0,0 +1,308 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/mapped_cache.h"
+
+#include <cstring>
+#include <utility>
+
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/lib/core/coding.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace {
+
+const uint32 kIndexMagic = 0x4d435346;  // "FSCM" in little-endian order.
+const uint32 kIndexVersion = 1;
+
+string IndexFilename(const string& prefix) {
+  return strings::StrCat(prefix, ".index");
+}
+
+string ColumnFilename(const string& prefix, int component) {
+  return strings::StrCat(prefix, ".column-", component);
+}
+
+void DeleteColumnReference(void* data, size_t length, void* arg) {
+  delete static_cast<std::shared_ptr<ReadOnlyMemoryRegion>*>(arg);
+}
+
+}  // namespace
+
+MappedCacheWriter::MappedCacheWriter(const string& prefix) : prefix_(prefix) {}
+
+MappedCacheWriter* MappedCacheWriter::New(const string& prefix,
+                                          TF_Status* out_status) {
+  Status status = Env::Default()->FileExists(IndexFilename(prefix));
+  if (status.ok()) {
+    status = errors::AlreadyExists("A dataset cache already exists for '",
+                                   prefix, "'.");
+  } else if (errors::IsNotFound(status)) {
+    status = Status::OK();
+  }
+  Set_TF_Status_from_Status(out_status, status);
+  if (!status.ok()) return nullptr;
+  return new MappedCacheWriter(prefix);
+}
+
+MappedCacheWriter::~MappedCacheWriter() {
+  // Column files of unfinished caches are closed, but the cache is left
+  // incomplete (i.e., without an index file).
+  for (std::unique_ptr<WritableFile>& column : columns_) column->Close();
+}
+
+Status MappedCacheWriter::CreateColumns(
+    const std::vector<TF_Tensor*>& element) {
+  for (size_t i = 0; i < element.size(); ++i) {
+    const TF_DataType dtype = TF_TensorType(element[i]);
+    if (dtype == TF_STRING || dtype == TF_RESOURCE || dtype == TF_VARIANT)
+      return errors::Unimplemented(
+          "Dataset caches do not support components with data type ", dtype,
+          ".");
+    std::unique_ptr<WritableFile> column;
+    TF_RETURN_IF_ERROR(Env::Default()->NewWritableFile(
+        ColumnFilename(prefix_, static_cast<int>(i)), &column));
+    dtypes_.push_back(dtype);
+    columns_.push_back(std::move(column));
+  }
+  return Status::OK();
+}
+
+void MappedCacheWriter::Append(const std::vector<TF_Tensor*>& element,
+                               TF_Status* status) {
+  Status s;
+  if (finished_) {
+    s = errors::FailedPrecondition("The dataset cache has been finished.");
+  } else if (num_elements_ == 0 && columns_.empty()) {
+    s = CreateColumns(element);
+  }
+  if (s.ok() && element.size() != dtypes_.size())
+    s = errors::InvalidArgument("Expected ", dtypes_.size(),
+                                " element components, but got ",
+                                element.size(), ".");
+  for (size_t i = 0; s.ok() && i < element.size(); ++i) {
+    if (TF_TensorType(element[i]) != dtypes_[i])
+      s = errors::InvalidArgument("Expected data type ", dtypes_[i],
+                                  " for element component ", i, ", but got ",
+                                  TF_TensorType(element[i]), ".");
+  }
+  for (size_t i = 0; s.ok() && i < element.size(); ++i) {
+    s = columns_[i]->Append(
+        StringPiece(static_cast<const char*>(TF_TensorData(element[i])),
+                    TF_TensorByteSize(element[i])));
+  }
+  if (s.ok()) {
+    for (TF_Tensor* tensor : element) {
+      const int rank = TF_NumDims(tensor);
+      core::PutVarint32(&shapes_, static_cast<uint32>(rank));
+      for (int d = 0; d < rank; ++d)
+        core::PutVarint64(&shapes_, static_cast<uint64>(TF_Dim(tensor, d)));
+    }
+    ++num_elements_;
+  }
+  Set_TF_Status_from_Status(status, s);
+}
+
+void MappedCacheWriter::Finish(TF_Status* status) {
+  Status s;
+  if (finished_)
+    s = errors::FailedPrecondition("The dataset cache has been finished.");
+  for (size_t i = 0; s.ok() && i < columns_.size(); ++i)
+    s = columns_[i]->Close();
+  if (s.ok()) {
+    columns_.clear();
+    // The index is written to a temporary file first, so that a complete index
+    // file only ever exists for a complete cache.
+    string index;
+    core::PutFixed32(&index, kIndexMagic);
+    core::PutFixed32(&index, kIndexVersion);
+    core::PutVarint32(&index, static_cast<uint32>(dtypes_.size()));
+    for (TF_DataType dtype : dtypes_)
+      core::PutVarint32(&index, static_cast<uint32>(dtype));
+    core::PutVarint64(&index, static_cast<uint64>(num_elements_));
+    index.append(shapes_);
+    const string index_filename = IndexFilename(prefix_);
+    const string temp_filename = strings::StrCat(index_filename, ".tmp");
+    s = WriteStringToFile(Env::Default(), temp_filename, index);
+    if (s.ok()) s = Env::Default()->RenameFile(temp_filename, index_filename);
+  }
+  if (s.ok()) finished_ = true;
+  Set_TF_Status_from_Status(status, s);
+}
+
+MappedCacheReader::MappedCacheReader() {}
+
+MappedCacheReader::~MappedCacheReader() {}
+
+bool MappedCacheReader::Exists(const string& prefix) {
+  return Env::Default()->FileExists(IndexFilename(prefix)).ok();
+}
+
+MappedCacheReader* MappedCacheReader::New(const string& prefix,
+                                          TF_Status* out_status) {
+  std::unique_ptr<MappedCacheReader> reader(new MappedCacheReader);
+  const string index_filename = IndexFilename(prefix);
+  string index_contents;
+  Status s = ReadFileToString(Env::Default(), index_filename, &index_contents);
+  StringPiece index(index_contents);
+  const Status corrupted =
+      errors::DataLoss("Corrupted dataset cache index '", index_filename, "'.");
+  uint32 num_components = 0;
+  uint64 num_elements = 0;
+  if (s.ok()) {
+    if (index.size() < 8 || core::DecodeFixed32(index.data()) != kIndexMagic ||
+        core::DecodeFixed32(index.data() + 4) != kIndexVersion) {
+      s = corrupted;
+    } else {
+      index.remove_prefix(8);
+      if (!core::GetVarint32(&index, &num_components)) s = corrupted;
+    }
+  }
+  for (uint32 i = 0; s.ok() && i < num_components; ++i) {
+    uint32 dtype;
+    if (!core::GetVarint32(&index, &dtype))
+      s = corrupted;
+    else
+      reader->dtypes_.push_back(static_cast<TF_DataType>(dtype));
+  }
+  if (s.ok() && !core::GetVarint64(&index, &num_elements)) s = corrupted;
+
+  // Decode the element shapes and compute the column offsets.
+  std::vector<uint64> column_sizes(num_components, 0);
+  for (uint64 e = 0; s.ok() && e < num_elements; ++e) {
+    std::vector<std::vector<int64_t>> shapes(num_components);
+    std::vector<uint64> offsets(num_components);
+    std::vector<uint64> sizes(num_components);
+    for (uint32 c = 0; s.ok() && c < num_components; ++c) {
+      uint32 rank;
+      if (!core::GetVarint32(&index, &rank)) {
+        s = corrupted;
+        break;
+      }
+      uint64 size = TF_DataTypeSize(reader->dtypes_[c]);
+      for (uint32 d = 0; s.ok() && d < rank; ++d) {
+        uint64 dim;
+        if (!core::GetVarint64(&index, &dim)) s = corrupted;
+        shapes[c].push_back(static_cast<int64_t>(dim));
+        size *= dim;
+      }
+      offsets[c] = column_sizes[c];
+      sizes[c] = size;
+      column_sizes[c] += size;
+    }
+    reader->shapes_.push_back(std::move(shapes));
+    reader->offsets_.push_back(std::move(offsets));
+    reader->sizes_.push_back(std::move(sizes));
+  }
+  if (s.ok() && !index.empty()) s = corrupted;
+
+  // Map the column files.
+  for (uint32 c = 0; s.ok() && c < num_components; ++c) {
+    const string column_filename = ColumnFilename(prefix, static_cast<int>(c));
+    uint64 file_size;
+    s = Env::Default()->GetFileSize(column_filename, &file_size);
+    if (s.ok() && file_size != column_sizes[c])
+      s = errors::DataLoss("Expected ", column_sizes[c], " bytes in '",
+                           column_filename, "', but found ", file_size, ".");
+    std::unique_ptr<ReadOnlyMemoryRegion> column;
+    // Empty files cannot be mapped, but no tensor ever refers to their data.
+    if (s.ok() && file_size > 0)
+      s = Env::Default()->NewReadOnlyMemoryRegionFromFile(column_filename,
+                                                          &column);
+    if (s.ok()) reader->columns_.emplace_back(column.release());
+  }
+  Set_TF_Status_from_Status(out_status, s);
+  if (!s.ok()) return nullptr;
+  return reader.release();
+}
+
+TF_Tensor* MappedCacheReader::Slice(int component, uint64 offset,
+                                    uint64 length,
+                                    const std::vector<int64_t>& dims) const {
+  const TF_DataType dtype = dtypes_[component];
+  const int num_dims = static_cast<int>(dims.size());
+  const std::shared_ptr<ReadOnlyMemoryRegion>& column = columns_[component];
+  if (length == 0 || column == nullptr)
+    return TF_AllocateTensor(dtype, dims.data(), num_dims, 0);
+  const char* data = static_cast<const char*>(column->data()) + offset;
+  // Kernels may assume that the tensor buffers are aligned, and so unaligned
+  // slices are copied.
+  if (reinterpret_cast<uintptr_t>(data) % Allocator::kAllocatorAlignment != 0) {
+    TF_Tensor* tensor = TF_AllocateTensor(dtype, dims.data(), num_dims,
+                                          static_cast<size_t>(length));
+    std::memcpy(TF_TensorData(tensor), data, static_cast<size_t>(length));
+    return tensor;
+  }
+  return TF_NewTensor(dtype, dims.data(), num_dims, const_cast<char*>(data),
+                      static_cast<size_t>(length), DeleteColumnReference,
+                      new std::shared_ptr<ReadOnlyMemoryRegion>(column));
+}
+
+void MappedCacheReader::Element(int64 index, std::vector<TF_Tensor*>* element,
+                                TF_Status* status) const {
+  element->clear();
+  if (index < 0 || index >= num_elements()) {
+    Set_TF_Status_from_Status(
+        status, errors::OutOfRange("Element index ", index,
+                                   " is out of range for a dataset cache with ",
+                                   num_elements(), " elements."));
+    return;
+  }
+  for (int c = 0; c < num_components(); ++c)
+    element->push_back(Slice(c, offsets_[index][c], sizes_[index][c],
+                             shapes_[index][c]));
+  Set_TF_Status_from_Status(status, Status::OK());
+}
+
+void MappedCacheReader::Batch(int64 start, int64 count,
+                              std::vector<TF_Tensor*>* batch,
+                              TF_Status* status) const {
+  batch->clear();
+  Status s;
+  if (count <= 0) {
+    s = errors::InvalidArgument("The batch size must be positive.");
+  } else if (start < 0 || start + count > num_elements()) {
+    s = errors::OutOfRange("Batch [", start, ", ", start + count,
+                           ") is out of range for a dataset cache with ",
+                           num_elements(), " elements.");
+  }
+  for (int64 e = start + 1; s.ok() && e < start + count; ++e) {
+    if (shapes_[e] != shapes_[start])
+      s = errors::InvalidArgument(
+          "All elements of a batch must have the same shapes, but element ",
+          e, " has different shapes than element ", start, ".");
+  }
+  if (!s.ok()) {
+    Set_TF_Status_from_Status(status, s);
+    return;
+  }
+  // Consecutive elements are stored contiguously in each column, and so each
+  // component of the batch is a single slice.
+  for (int c = 0; c < num_components(); ++c) {
+    std::vector<int64_t> dims(1, static_cast<int64_t>(count));
+    dims.insert(dims.end(), shapes_[start][c].begin(),
+                shapes_[start][c].end());
+    batch->push_back(Slice(c, offsets_[start][c],
+                           sizes_[start][c] * static_cast<uint64>(count),
+                           dims));
+  }
+  Set_TF_Status_from_Status(status, Status::OK());
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,118 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_MAPPED_CACHE_H_
+#define TENSORFLOW_C_MAPPED_CACHE_H_
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+class ReadOnlyMemoryRegion;
+class WritableFile;
+
+// A dataset cache consists of one column file per element component, named
+// "<prefix>.column-<i>", which contains the contents of that component for all
+// elements, stored contiguously and in order, and of an index file, named
+// "<prefix>.index", which contains the data types of the components and the
+// shapes of all cached elements. The index file is written last, and so its
+// existence marks a complete cache. String components are not supported.
+
+// Writes a dataset cache one element at a time. The cache only becomes
+// readable once "Finish" has been called.
+class MappedCacheWriter {
+ public:
+  static MappedCacheWriter* New(const string& prefix, TF_Status* out_status);
+
+  ~MappedCacheWriter();
+
+  // Appends an element to the cache. The tensors are not owned. All elements
+  // must have the same number of components, with the same data types.
+  void Append(const std::vector<TF_Tensor*>& element, TF_Status* status);
+
+  // Closes the column files and writes the index file.
+  void Finish(TF_Status* status);
+
+ private:
+  explicit MappedCacheWriter(const string& prefix);
+
+  // Creates the column files, once the number of components is known.
+  Status CreateColumns(const std::vector<TF_Tensor*>& element);
+
+  const string prefix_;
+  bool finished_ = false;
+  int64 num_elements_ = 0;
+  std::vector<TF_DataType> dtypes_;
+  std::vector<std::unique_ptr<WritableFile>> columns_;
+  // Encoded shapes of the cached elements, in the format of the index file.
+  string shapes_;
+  TF_DISALLOW_COPY_AND_ASSIGN(MappedCacheWriter);
+};
+
+// Reads a complete dataset cache by memory-mapping its column files. The
+// returned tensors are slices of those mappings whenever their start is
+// suitably aligned, in which case no data is copied and the mappings are kept
+// alive for as long as any such tensor exists. The contents of such tensors
+// are read-only and must never be modified in place. An instance of this
+// class is safe for concurrent access by multiple threads.
+class MappedCacheReader {
+ public:
+  static MappedCacheReader* New(const string& prefix, TF_Status* out_status);
+
+  ~MappedCacheReader();
+
+  // Returns "true" if a complete cache exists for "prefix".
+  static bool Exists(const string& prefix);
+
+  int64 num_elements() const { return static_cast<int64>(offsets_.size()); }
+  int num_components() const { return static_cast<int>(dtypes_.size()); }
+
+  // Returns the tensors of the "index"-th cached element, which are then owned
+  // by the caller.
+  void Element(int64 index, std::vector<TF_Tensor*>* element,
+               TF_Status* status) const;
+
+  // Returns the tensors of the batch of "count" cached elements starting at
+  // "start", which are stacked along a new leading dimension and are then
+  // owned by the caller. All elements in the batch must have the same shapes.
+  void Batch(int64 start, int64 count, std::vector<TF_Tensor*>* batch,
+             TF_Status* status) const;
+
+ private:
+  MappedCacheReader();
+
+  // Returns a tensor over "length" bytes of the "component"-th column,
+  // starting at "offset".
+  TF_Tensor* Slice(int component, uint64 offset, uint64 length,
+                   const std::vector<int64_t>& dims) const;
+
+  std::vector<TF_DataType> dtypes_;
+  std::vector<std::shared_ptr<ReadOnlyMemoryRegion>> columns_;
+  // Per element and component shapes and column offsets.
+  std::vector<std::vector<std::vector<int64_t>>> shapes_;
+  std::vector<std::vector<uint64>> offsets_;
+  std::vector<std::vector<uint64>> sizes_;
+  TF_DISALLOW_COPY_AND_ASSIGN(MappedCacheReader);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_MAPPED_CACHE_H_
@@ -0,0 +1,359 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/metrics_exporter.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cfloat>
+#include <cstring>
+#include <vector>
+
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/monitoring/collection_registry.h"
+#include "tensorflow/core/lib/monitoring/counter.h"
+#include "tensorflow/core/lib/monitoring/sampler.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+
+namespace tensorflow {
+
+namespace {
+
+#ifdef MSG_NOSIGNAL
+const int kSendFlags = MSG_NOSIGNAL;
+#else
+const int kSendFlags = 0;
+#endif
+
+// Interval at which the serving thread checks whether the exporter is being stopped.
+const int kPollIntervalMillis = 100;
+
+// Maximum size of the HTTP requests that are read, and maximum time to wait for them.
+const size_t kMaxRequestSize = 8192;
+const int kRequestTimeoutMillis = 1000;
+
+// Cells of the JNI metrics, which are created the first time they are used. The cells are cached because looking them
+// up requires locking their metric.
+monitoring::CounterCell* SessionRunsCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/session_runs", "Number of session runs executed through the JNI bindings.")->GetCell();
+  return cell;
+}
+
+monitoring::SamplerCell* SessionRunLatencyCell() {
+  static monitoring::SamplerCell* cell = [] {
+    // Exponential buckets, from 10 microseconds to about 3 minutes.
+    std::vector<double> bucket_limits;
+    for (double limit = 10.0; limit < 2e8; limit *= 2.0) bucket_limits.push_back(limit);
+    return monitoring::Sampler<0>::New(
+        {"/tensorflow/jni/session_run_latency",
+         "Latency of the session runs executed through the JNI bindings, in microseconds."},
+        bucket_limits)->GetCell();
+  }();
+  return cell;
+}
+
+monitoring::CounterCell* EagerDispatchesCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/eager_dispatches", "Number of eager ops dispatched through the JNI bindings.")->GetCell();
+  return cell;
+}
+
+monitoring::CounterCell* RecordReaderBytesCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/record_reader_bytes", "Number of record bytes read through the JNI record readers.")->GetCell();
+  return cell;
+}
+
+monitoring::CounterCell* BlockCacheHitsCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/block_cache_hits", "Number of remote file blocks read from the local block cache.")->GetCell();
+  return cell;
+}
+
+monitoring::CounterCell* BlockCacheMissesCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/block_cache_misses", "Number of remote file blocks fetched on block cache misses.")->GetCell();
+  return cell;
+}
+
+monitoring::CounterCell* BlockCacheBytesSavedCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/block_cache_bytes_saved",
+      "Number of bytes read from the local block cache instead of from remote file systems.")->GetCell();
+  return cell;
+}
+
+monitoring::CounterCell* BlockCacheBytesFetchedCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/block_cache_bytes_fetched",
+      "Number of bytes fetched from remote file systems due to block cache misses.")->GetCell();
+  return cell;
+}
+
+monitoring::CounterCell* OptimizedGraphCacheHitsCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/optimized_graph_cache_hits",
+      "Number of optimized graphs read from the persistent optimized graph cache.")->GetCell();
+  return cell;
+}
+
+monitoring::CounterCell* OptimizedGraphCacheMissesCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/optimized_graph_cache_misses",
+      "Number of graphs optimized on persistent optimized graph cache misses.")->GetCell();
+  return cell;
+}
+
+monitoring::CounterCell* OptimizedGraphCacheMissMicrosCell() {
+  static monitoring::CounterCell* cell = monitoring::Counter<0>::New(
+      "/tensorflow/jni/optimized_graph_cache_miss_micros",
+      "Time spent optimizing graphs on persistent optimized graph cache misses, in microseconds.")->GetCell();
+  return cell;
+}
+
+// Converts a metric or label name to a valid OpenMetrics name, by replacing all invalid characters with underscores
+// and dropping leading underscores (e.g., "/tensorflow/core/graph_runs" becomes "tensorflow_core_graph_runs").
+string SanitizeName(const string& name) {
+  string sanitized;
+  sanitized.reserve(name.size());
+  for (char c : name) {
+    const bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    if (valid || !sanitized.empty()) sanitized.push_back(valid ? c : '_');
+  }
+  if (sanitized.empty() || (sanitized[0] >= '0' && sanitized[0] <= '9')) sanitized.insert(0, "_");
+  return sanitized;
+}
+
+// Escapes backslashes, double quotes (if "quotes" is true), and line feeds.
+string Escape(const string& value, bool quotes) {
+  string escaped;
+  escaped.reserve(value.size());
+  for (char c : value) {
+    if (c == '\\') {
+      escaped.append("\\\\");
+    } else if (c == '\n') {
+      escaped.append("\\n");
+    } else if (c == '"' && quotes) {
+      escaped.append("\\\"");
+    } else {
+      escaped.push_back(c);
+    }
+  }
+  return escaped;
+}
+
+// Formats the labels of a point, along with an extra label (if "extra_name" is not empty), as "{name="value",...}".
+string FormatLabels(const monitoring::Point& point, const string& extra_name = "", const string& extra_value = "") {
+  string labels;
+  for (const auto& label : point.labels) {
+    strings::StrAppend(
+        &labels, labels.empty() ? "{" : ",", SanitizeName(label.name), "=\"", Escape(label.value, true), "\"");
+  }
+  if (!extra_name.empty())
+    strings::StrAppend(&labels, labels.empty() ? "{" : ",", extra_name, "=\"", extra_value, "\"");
+  if (!labels.empty()) labels.push_back('}');
+  return labels;
+}
+
+string FormatDouble(double value) {
+  if (value >= DBL_MAX) return "+Inf";
+  if (value <= -DBL_MAX) return "-Inf";
+  return strings::StrCat(value);
+}
+
+void AppendHistogram(const string& name, const monitoring::Point& point, string* output) {
+  const HistogramProto& histogram = point.histogram_value;
+  double cumulative_count = 0.0;
+  bool has_infinite_bucket = false;
+  for (int i = 0; i < histogram.bucket_size() && i < histogram.bucket_limit_size(); ++i) {
+    cumulative_count += histogram.bucket(i);
+    has_infinite_bucket = histogram.bucket_limit(i) >= DBL_MAX;
+    strings::StrAppend(
+        output, name, "_bucket", FormatLabels(point, "le", FormatDouble(histogram.bucket_limit(i))), " ",
+        FormatDouble(cumulative_count), "\n");
+  }
+  if (!has_infinite_bucket)
+    strings::StrAppend(output, name, "_bucket", FormatLabels(point, "le", "+Inf"), " ", histogram.num(), "\n");
+  strings::StrAppend(output, name, "_sum", FormatLabels(point), " ", FormatDouble(histogram.sum()), "\n");
+  strings::StrAppend(output, name, "_count", FormatLabels(point), " ", histogram.num(), "\n");
+}
+
+// Writes all of "data" to "connection", returning false if the connection was closed.
+bool SendAll(int connection, const string& data) {
+  size_t sent = 0;
+  while (sent < data.size()) {
+    const ssize_t n = send(connection, data.data() + sent, data.size() - sent, kSendFlags);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    sent += static_cast<size_t>(n);
+  }
+  return true;
+}
+
+}  // namespace
+
+namespace jni_metrics {
+
+void RecordSessionRun(uint64 duration_micros) {
+  SessionRunsCell()->IncrementBy(1);
+  SessionRunLatencyCell()->Add(static_cast<double>(duration_micros));
+}
+
+void RecordEagerDispatch() { EagerDispatchesCell()->IncrementBy(1); }
+
+void RecordRecordReaderBytes(uint64 num_bytes) { RecordReaderBytesCell()->IncrementBy(static_cast<int64>(num_bytes)); }
+
+void RecordBlockCacheHit(uint64 num_bytes) {
+  BlockCacheHitsCell()->IncrementBy(1);
+  BlockCacheBytesSavedCell()->IncrementBy(static_cast<int64>(num_bytes));
+}
+
+void RecordBlockCacheMiss(uint64 num_bytes) {
+  BlockCacheMissesCell()->IncrementBy(1);
+  BlockCacheBytesFetchedCell()->IncrementBy(static_cast<int64>(num_bytes));
+}
+
+void RecordOptimizedGraphCacheHit() { OptimizedGraphCacheHitsCell()->IncrementBy(1); }
+
+void RecordOptimizedGraphCacheMiss(uint64 optimization_micros) {
+  OptimizedGraphCacheMissesCell()->IncrementBy(1);
+  OptimizedGraphCacheMissMicrosCell()->IncrementBy(static_cast<int64>(optimization_micros));
+}
+
+}  // namespace jni_metrics
+
+string CollectOpenMetrics(const string& prefix) {
+  monitoring::CollectionRegistry::CollectMetricsOptions options;
+  options.collect_metric_descriptors = true;
+  std::unique_ptr<monitoring::CollectedMetrics> metrics = monitoring::CollectionRegistry::Default()->CollectMetrics(
+      options);
+  string output;
+  for (const auto& point_set : metrics->point_set_map) {
+    if (point_set.first.compare(0, prefix.size(), prefix) != 0) continue;
+    auto descriptor = metrics->metric_descriptor_map.find(point_set.first);
+    if (descriptor == metrics->metric_descriptor_map.end()) continue;
+    const bool histogram = descriptor->second->value_type == monitoring::ValueType::kHistogram;
+    const bool counter = !histogram && descriptor->second->metric_kind == monitoring::MetricKind::kCumulative;
+    string name = SanitizeName(point_set.first);
+    // The samples of counters are named after their metric family with a "_total" suffix, and so that suffix is not
+    // repeated if the metric name already ends with it.
+    if (counter && name.size() > 6 && name.compare(name.size() - 6, 6, "_total") == 0) name.resize(name.size() - 6);
+    strings::StrAppend(
+        &output, "# TYPE ", name, histogram ? " histogram\n" : counter ? " counter\n" : " gauge\n");
+    if (!descriptor->second->description.empty())
+      strings::StrAppend(&output, "# HELP ", name, " ", Escape(descriptor->second->description, false), "\n");
+    for (const auto& point : point_set.second->points) {
+      if (histogram) {
+        AppendHistogram(name, *point, &output);
+      } else {
+        strings::StrAppend(
+            &output, name, counter ? "_total" : "", FormatLabels(*point), " ", point->int64_value, "\n");
+      }
+    }
+  }
+  output.append("# EOF\n");
+  return output;
+}
+
+Status MetricsHttpExporter::Start(const string& host, int port, const string& prefix,
+                                  std::unique_ptr<MetricsHttpExporter>* exporter) {
+  if (port < 0 || port > 65535) return errors::InvalidArgument("Invalid port ", port, ".");
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(static_cast<uint16_t>(port));
+  if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1)
+    return errors::InvalidArgument("Invalid IPv4 address '", host, "'.");
+  const int s = socket(AF_INET, SOCK_STREAM, 0);
+  if (s < 0) return errors::Internal("Failed to create a socket: ", strerror(errno), ".");
+  const int reuse = 1;
+  setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  if (bind(s, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(s, 16) != 0) {
+    const Status status = errors::Unavailable("Failed to listen on ", host, ":", port, ": ", strerror(errno), ".");
+    close(s);
+    return status;
+  }
+  socklen_t address_size = sizeof(address);
+  getsockname(s, reinterpret_cast<sockaddr*>(&address), &address_size);
+  exporter->reset(new MetricsHttpExporter(s, ntohs(address.sin_port), prefix));
+  return Status::OK();
+}
+
+MetricsHttpExporter::MetricsHttpExporter(int socket, int port, const string& prefix)
+    : socket_(socket), port_(port), prefix_(prefix), stopping_(false) {
+  thread_.reset(Env::Default()->StartThread(
+      ThreadOptions(), "tf_scala_metrics_exporter", [this]() { ServeLoop(); }));
+}
+
+MetricsHttpExporter::~MetricsHttpExporter() {
+  stopping_.store(true);
+  // Destroying the thread joins it, and the serving loop exits within one poll interval.
+  thread_.reset();
+  close(socket_);
+}
+
+void MetricsHttpExporter::ServeLoop() {
+  while (!stopping_.load()) {
+    pollfd descriptor = {socket_, POLLIN, 0};
+    if (poll(&descriptor, 1, kPollIntervalMillis) <= 0) continue;
+    const int connection = accept(socket_, nullptr, nullptr);
+    if (connection < 0) continue;
+#ifdef SO_NOSIGPIPE
+    const int no_sigpipe = 1;
+    setsockopt(connection, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+    Respond(connection);
+    close(connection);
+  }
+}
+
+void MetricsHttpExporter::Respond(int connection) {
+  // Only the request line is needed, and so the request is read until the end of its headers (or until it gets too
+  // large or too slow).
+  string request;
+  char buffer[1024];
+  while (request.size() < kMaxRequestSize && request.find("\r\n\r\n") == string::npos) {
+    pollfd descriptor = {connection, POLLIN, 0};
+    if (poll(&descriptor, 1, kRequestTimeoutMillis) <= 0) return;
+    const ssize_t n = recv(connection, buffer, sizeof(buffer), 0);
+    if (n <= 0) return;
+    request.append(buffer, static_cast<size_t>(n));
+  }
+  const bool metrics_request =
+      request.compare(0, 13, "GET /metrics ") == 0 || request.compare(0, 13, "GET /metrics?") == 0;
+  string body;
+  string status;
+  string content_type;
+  if (metrics_request) {
+    body = CollectOpenMetrics(prefix_);
+    status = "200 OK";
+    content_type = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+  } else {
+    body = "Metrics are served at '/metrics'.\n";
+    status = "404 Not Found";
+    content_type = "text/plain; charset=utf-8";
+  }
+  SendAll(connection, strings::StrCat(
+      "HTTP/1.1 ", status, "\r\nContent-Type: ", content_type, "\r\nContent-Length: ", body.size(),
+      "\r\nConnection: close\r\n\r\n", body));
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,118 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_METRICS_EXPORTER_H_
+#define TENSORFLOW_C_METRICS_EXPORTER_H_
+
+#include <atomic>
+#include <memory>
+
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Metrics of the JNI bindings, which are registered in the process-wide
+// monitoring registry (under the "/tensorflow/jni/" prefix), along with the
+// metrics of the TensorFlow runtime. All functions are safe for concurrent use
+// and cheap enough to be called on every operation.
+namespace jni_metrics {
+
+// Records a session run that took "duration_micros" microseconds.
+void RecordSessionRun(uint64 duration_micros);
+
+// Records an eager op dispatch.
+void RecordEagerDispatch();
+
+// Records "num_bytes" bytes read by the record readers.
+void RecordRecordReaderBytes(uint64 num_bytes);
+
+// Records a block cache hit that served "num_bytes" bytes from the local cache.
+void RecordBlockCacheHit(uint64 num_bytes);
+
+// Records a block cache miss that fetched "num_bytes" bytes from a remote file
+// system.
+void RecordBlockCacheMiss(uint64 num_bytes);
+
+// Records an optimized graph read from the persistent optimized graph cache.
+void RecordOptimizedGraphCacheHit();
+
+// Records an optimized graph cache miss, for which the graph was optimized in
+// "optimization_micros" microseconds.
+void RecordOptimizedGraphCacheMiss(uint64 optimization_micros);
+
+// Records the duration of a session run, from its construction to its
+// destruction.
+class ScopedSessionRunTimer {
+ public:
+  ScopedSessionRunTimer() : start_micros_(Env::Default()->NowMicros()) {}
+  ~ScopedSessionRunTimer() {
+    RecordSessionRun(Env::Default()->NowMicros() - start_micros_);
+  }
+
+ private:
+  const uint64 start_micros_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ScopedSessionRunTimer);
+};
+
+}  // namespace jni_metrics
+
+// Formats the points of the metrics in the process-wide monitoring registry
+// whose names start with "prefix" in the OpenMetrics text format. Metric names
+// are converted to valid OpenMetrics names (e.g., "/tensorflow/core/graph_runs"
+// becomes "tensorflow_core_graph_runs"), integer-valued cumulative metrics are
+// exported as counters, integer-valued gauges as gauges, and histogram-valued
+// metrics as histograms.
+string CollectOpenMetrics(const string& prefix);
+
+// Serves the metrics returned by "CollectOpenMetrics" over HTTP, on a
+// background thread, so that they can be scraped (e.g., by Prometheus). The
+// metrics are served for "GET /metrics" requests, one request at a time, and
+// the connection is closed after each response. Destroying the exporter stops
+// it.
+class MetricsHttpExporter {
+ public:
+  // Starts an exporter that listens on "port" (or on an ephemeral port, if
+  // "port" is 0) of the IPv4 address "host" (e.g., "0.0.0.0" for all
+  // interfaces) and serves the metrics whose names start with "prefix".
+  static Status Start(const string& host, int port, const string& prefix,
+                      std::unique_ptr<MetricsHttpExporter>* exporter);
+
+  ~MetricsHttpExporter();
+
+  // Returns the port that this exporter listens on.
+  int port() const { return port_; }
+
+ private:
+  MetricsHttpExporter(int socket, int port, const string& prefix);
+
+  void ServeLoop();
+  void Respond(int connection);
+
+  const int socket_;
+  const int port_;
+  const string prefix_;
+  std::atomic<bool> stopping_;
+  std::unique_ptr<Thread> thread_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(MetricsHttpExporter);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_METRICS_EXPORTER_H_
@@ -0,0 +1,153 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/native_event_recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "tensorflow/core/platform/mutex.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Number of events that each ring buffer can hold. This must be a power of two.
+const uint64 kRingCapacity = 2048;
+
+// Single-producer single-consumer ring buffer of the events of one thread.
+struct EventRing {
+  NativeEvent events[kRingCapacity];
+  // Index of the next event to drain, which is only advanced by the consumer.
+  std::atomic<uint64> head{0};
+  // Index of the next event to record, which is only advanced by the producer.
+  std::atomic<uint64> tail{0};
+  // Set when the owning thread exits, after which the ring is released once it has been drained.
+  std::atomic<bool> orphaned{false};
+};
+
+struct EventRings {
+  mutex mu;
+  std::vector<EventRing*> rings GUARDED_BY(mu);
+  // Serializes the consumers.
+  mutex drain_mu;
+  std::atomic<int64> num_dropped{0};
+};
+
+EventRings& event_rings() {
+  static EventRings* rings = new EventRings;
+  return *rings;
+}
+
+// Marks the ring of the current thread as orphaned when the thread exits.
+struct EventRingOwner {
+  EventRing* ring = nullptr;
+  ~EventRingOwner() {
+    if (ring != nullptr) ring->orphaned.store(true, std::memory_order_release);
+  }
+};
+
+EventRing* ThreadEventRing() {
+  static thread_local EventRingOwner owner;
+  if (owner.ring == nullptr) {
+    owner.ring = new EventRing;
+    EventRings& rings = event_rings();
+    mutex_lock l(rings.mu);
+    rings.rings.push_back(owner.ring);
+  }
+  return owner.ring;
+}
+
+int64 CurrentThreadId() {
+#ifdef __linux__
+  return static_cast<int64>(syscall(SYS_gettid));
+#else
+  return static_cast<int64>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+}
+
+}  // namespace
+
+std::atomic<bool> NativeEventRecorder::enabled_{false};
+
+void NativeEventRecorder::SetEnabled(bool enabled) { enabled_.store(enabled); }
+
+int64 NativeEventRecorder::NowNanos() {
+  static const int64 offset_nanos = [] {
+    const int64 system_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const int64 steady_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return system_nanos - steady_nanos;
+  }();
+  return offset_nanos + std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void NativeEventRecorder::Record(const NativeEvent& event) {
+  EventRing* ring = ThreadEventRing();
+  const uint64 tail = ring->tail.load(std::memory_order_relaxed);
+  if (tail - ring->head.load(std::memory_order_acquire) >= kRingCapacity) {
+    event_rings().num_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  static thread_local const int64 thread_id = CurrentThreadId();
+  NativeEvent& slot = ring->events[tail & (kRingCapacity - 1)];
+  slot = event;
+  slot.thread_id = thread_id;
+  ring->tail.store(tail + 1, std::memory_order_release);
+}
+
+int64 NativeEventRecorder::Drain(NativeEvent* events, int64 max_events) {
+  EventRings& rings = event_rings();
+  mutex_lock drain_lock(rings.drain_mu);
+  std::vector<EventRing*> snapshot;
+  {
+    mutex_lock l(rings.mu);
+    snapshot = rings.rings;
+  }
+  int64 num_events = 0;
+  std::vector<EventRing*> released;
+  for (EventRing* ring : snapshot) {
+    // The orphaned flag is read before the tail, so that a ring that is found empty after its thread exited is
+    // guaranteed to stay empty.
+    const bool orphaned = ring->orphaned.load(std::memory_order_acquire);
+    uint64 head = ring->head.load(std::memory_order_relaxed);
+    const uint64 tail = ring->tail.load(std::memory_order_acquire);
+    while (head < tail && num_events < max_events) events[num_events++] = ring->events[head++ & (kRingCapacity - 1)];
+    ring->head.store(head, std::memory_order_release);
+    if (orphaned && head == tail) released.push_back(ring);
+  }
+  if (!released.empty()) {
+    mutex_lock l(rings.mu);
+    for (EventRing* ring : released) {
+      rings.rings.erase(std::find(rings.rings.begin(), rings.rings.end(), ring));
+      delete ring;
+    }
+  }
+  return num_events;
+}
+
+int64 NativeEventRecorder::NumDropped() { return event_rings().num_dropped.load(std::memory_order_relaxed); }
+
+}  // namespace tensorflow
@@ -0,0 +1,130 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_NATIVE_EVENT_RECORDER_H_
+#define TENSORFLOW_C_NATIVE_EVENT_RECORDER_H_
+
+#include <atomic>
+
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Kinds of the native events that are recorded.
+enum NativeEventKind : int32 {
+  kNativeEventSessionRun = 0,
+  kNativeEventEagerExecute = 1,
+  kNativeEventRecordRead = 2,
+};
+
+// Native event (e.g., a session run), as stored in the event buffers. The
+// layout of this struct is part of the interface with the JVM, which reads the
+// drained events directly (in native byte order).
+struct NativeEvent {
+  // Start time, in nanoseconds since the epoch, and duration, in nanoseconds.
+  int64 start_nanos;
+  int64 duration_nanos;
+  // Address of a string with static storage duration that names the event
+  // (e.g., the op name), or 0.
+  int64 name;
+  // Number of bytes processed (e.g., record bytes read), or 0.
+  int64 num_bytes;
+  // Identifier of the native thread that recorded the event (i.e., its OS
+  // thread identifier, on Linux).
+  int64 thread_id;
+  int32 kind;
+  // Number of inputs (e.g., feeds) and outputs (e.g., fetches), or 0.
+  int32 num_inputs;
+  int32 num_outputs;
+  int32 padding;
+};
+
+// Records native events into per-thread ring buffers, from which they are
+// drained by a single consumer (e.g., a JVM thread that emits them as JDK
+// Flight Recorder events). Each ring has a single producer (its thread) and a
+// single consumer, and so recording an event is lock-free and only takes a
+// few atomic loads and stores. Events recorded while a ring is full are
+// dropped and counted. Recording is disabled by default, in which case the
+// instrumented code only pays for one relaxed atomic load.
+class NativeEventRecorder {
+ public:
+  static bool Enabled() { return enabled_.load(std::memory_order_relaxed); }
+  static void SetEnabled(bool enabled);
+
+  // Returns the current time, in nanoseconds since the epoch, using a
+  // monotonic clock that is aligned to the system clock once, when the
+  // process starts using it.
+  static int64 NowNanos();
+
+  // Records "event" in the ring buffer of the current thread.
+  static void Record(const NativeEvent& event);
+
+  // Moves up to "max_events" of the recorded events (of all threads) to
+  // "events" and returns their number. Rings of threads that have exited are
+  // released once they have been drained. Only one thread may drain events at
+  // a time.
+  static int64 Drain(NativeEvent* events, int64 max_events);
+
+  // Returns the total number of events that have been dropped because their
+  // ring buffer was full.
+  static int64 NumDropped();
+
+ private:
+  static std::atomic<bool> enabled_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(NativeEventRecorder);
+};
+
+// Records a native event spanning the lifetime of this object, if recording
+// is enabled when it is constructed.
+class ScopedNativeEvent {
+ public:
+  ScopedNativeEvent(NativeEventKind kind, const char* name)
+      : active_(NativeEventRecorder::Enabled()) {
+    if (active_) {
+      event_ = NativeEvent();
+      event_.kind = kind;
+      event_.name = reinterpret_cast<int64>(name);
+      event_.start_nanos = NativeEventRecorder::NowNanos();
+    }
+  }
+
+  ~ScopedNativeEvent() {
+    if (active_) {
+      event_.duration_nanos =
+          NativeEventRecorder::NowNanos() - event_.start_nanos;
+      NativeEventRecorder::Record(event_);
+    }
+  }
+
+  // Returns true if this event is being recorded, so that callers can skip
+  // computing its metadata otherwise.
+  bool active() const { return active_; }
+
+  void set_num_bytes(int64 num_bytes) { event_.num_bytes = num_bytes; }
+  void set_num_inputs(int32 num_inputs) { event_.num_inputs = num_inputs; }
+  void set_num_outputs(int32 num_outputs) { event_.num_outputs = num_outputs; }
+
+ private:
+  const bool active_;
+  NativeEvent event_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ScopedNativeEvent);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_NATIVE_EVENT_RECORDER_H_
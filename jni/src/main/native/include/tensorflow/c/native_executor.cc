@@ -0,0 +1,218 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/native_executor.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/ThreadPool"
+#include "tensorflow/core/lib/core/blocking_counter.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/logging.h"
+
+namespace tensorflow {
+namespace {
+
+std::atomic<JavaVM*> java_vm{nullptr};
+
+// Number of threads of the executor, or "0" to use the default, and whether the executor has been created, after which
+// the number of threads cannot change anymore.
+std::mutex num_threads_mu;
+int32 num_threads = 0;
+bool created = false;
+
+// Eigen thread environment that attaches its threads to the JVM, as daemon threads, for their whole lifetime.
+struct JvmThreadEnvironment {
+  struct Task {
+    std::function<void()> f;
+  };
+
+  class EnvThread {
+   public:
+    explicit EnvThread(std::function<void()> f) : thread_(&EnvThread::Run, std::move(f)) {}
+    ~EnvThread() { thread_.join(); }
+    void OnCancel() {}
+
+   private:
+    static void Run(std::function<void()> f) {
+      static std::atomic<int> next_index{0};
+      const std::string name = "tf_scala_executor_" + std::to_string(next_index++);
+      JavaVM* jvm = java_vm.load();
+      JNIEnv* env = nullptr;
+      if (jvm != nullptr) {
+        JavaVMAttachArgs args = {JNI_VERSION_1_6, const_cast<char*>(name.c_str()), nullptr};
+        if (jvm->AttachCurrentThreadAsDaemon(reinterpret_cast<void**>(&env), &args) != JNI_OK) {
+          LOG(WARNING) << "Unable to attach native executor thread '" << name << "' to the JVM.";
+          env = nullptr;
+        }
+      }
+      f();
+      if (env != nullptr) jvm->DetachCurrentThread();
+    }
+
+    std::thread thread_;
+  };
+
+  EnvThread* CreateThread(std::function<void()> f) { return new EnvThread(std::move(f)); }
+  Task CreateTask(std::function<void()> f) { return Task{std::move(f)}; }
+  void ExecuteTask(const Task& t) { t.f(); }
+};
+
+}  // namespace
+
+class NativeExecutor::Pool : public Eigen::NonBlockingThreadPoolTempl<JvmThreadEnvironment> {
+ public:
+  explicit Pool(int num_threads) : Eigen::NonBlockingThreadPoolTempl<JvmThreadEnvironment>(num_threads) {}
+};
+
+void NativeExecutor::SetJavaVM(JavaVM* jvm) {
+  java_vm.store(jvm);
+}
+
+Status NativeExecutor::SetNumThreads(int32 value) {
+  if (value <= 0) return errors::InvalidArgument("The number of threads must be positive.");
+  std::lock_guard<std::mutex> lock(num_threads_mu);
+  if (created && value != num_threads)
+    return errors::FailedPrecondition(
+        "The native executor has already been created with ", num_threads, " threads.");
+  num_threads = value;
+  return Status::OK();
+}
+
+NativeExecutor* NativeExecutor::Global() {
+  static NativeExecutor* executor = []() {
+    std::lock_guard<std::mutex> lock(num_threads_mu);
+    if (num_threads == 0) num_threads = std::max(port::NumSchedulableCPUs(), 16);
+    created = true;
+    return new NativeExecutor(num_threads);
+  }();
+  return executor;
+}
+
+NativeExecutor::NativeExecutor(int32 num_threads) : num_threads_(num_threads), pool_(new Pool(num_threads)) {}
+
+NativeExecutor::~NativeExecutor() {}
+
+int32 NativeExecutor::Limit(int priority) const {
+  switch (priority) {
+    case kLow: return std::max(1, num_threads_ / 2);
+    case kNormal: return std::max(1, num_threads_ - num_threads_ / 4);
+    default: return num_threads_;
+  }
+}
+
+bool NativeExecutor::CanStart(int priority) const {
+  // Each priority level limits the number of threads that are occupied by its tasks together with the tasks of all
+  // lower priority levels.
+  int32 active = 0;
+  for (int p = kLow; p < kNumPriorities; ++p) {
+    active += active_[p];
+    if (p >= priority && active >= Limit(p)) return false;
+  }
+  return true;
+}
+
+void NativeExecutor::Start(Task task, int priority) {
+  ++active_[priority];
+  counters_[task.subsystem].active_tasks++;
+  // The Eigen pool runs tasks inline when the queue of the target thread is full, which would deadlock here, but that
+  // cannot happen since the priority limits never let more tasks start than there are threads.
+  pool_->Schedule([this, task, priority]() { Run(task, priority); });
+}
+
+void NativeExecutor::Run(const Task& task, int priority) {
+  Counters& counters = counters_[task.subsystem];
+  const uint64 start_micros = Env::Default()->NowMicros();
+  task.fn();
+  counters.busy_micros += static_cast<int64>(Env::Default()->NowMicros() - start_micros);
+  counters.completed_tasks++;
+  counters.active_tasks--;
+  std::lock_guard<std::mutex> lock(mu_);
+  --active_[priority];
+  for (int p = kHigh; p >= kLow; --p) {
+    while (!queued_[p].empty() && CanStart(p)) {
+      Task next = std::move(queued_[p].front());
+      queued_[p].pop_front();
+      counters_[next.subsystem].queued_tasks--;
+      Start(std::move(next), p);
+    }
+  }
+}
+
+void NativeExecutor::Schedule(Subsystem subsystem, std::function<void()> fn) {
+  Counters& counters = counters_[subsystem];
+  counters.scheduled_tasks++;
+  const int priority = counters.priority.load();
+  std::lock_guard<std::mutex> lock(mu_);
+  // Tasks of the same priority start in the order in which they were scheduled.
+  if (queued_[priority].empty() && CanStart(priority)) {
+    Start(Task{subsystem, std::move(fn)}, priority);
+  } else {
+    counters.queued_tasks++;
+    queued_[priority].push_back(Task{subsystem, std::move(fn)});
+  }
+}
+
+void NativeExecutor::ParallelFor(
+    Subsystem subsystem, int64 n, int32 max_parallelism, const std::function<void(int64)>& fn) {
+  if (n <= 0) return;
+  if (n == 1 || max_parallelism <= 1) {
+    for (int64 i = 0; i < n; ++i) fn(i);
+    return;
+  }
+  // Calls are claimed using a shared index, and so tasks that start after all calls have been claimed return
+  // immediately, which allows the caller to return without waiting for them.
+  struct State {
+    State(int64 n, const std::function<void(int64)>& fn) : fn(fn), counter(static_cast<int>(n)) {}
+    const std::function<void(int64)> fn;
+    std::atomic<int64> next{0};
+    BlockingCounter counter;
+  };
+  std::shared_ptr<State> state = std::make_shared<State>(n, fn);
+  auto work = [state, n]() {
+    for (int64 i = state->next++; i < n; i = state->next++) {
+      state->fn(i);
+      state->counter.DecrementCount();
+    }
+  };
+  const int64 num_tasks = std::min<int64>(n, std::min(max_parallelism, num_threads_)) - 1;
+  for (int64 i = 0; i < num_tasks; ++i) Schedule(subsystem, work);
+  work();
+  state->counter.Wait();
+}
+
+void NativeExecutor::SetPriority(Subsystem subsystem, Priority priority) {
+  counters_[subsystem].priority.store(priority);
+}
+
+std::vector<NativeExecutor::Statistics> NativeExecutor::statistics() {
+  std::vector<Statistics> statistics(kNumSubsystems);
+  for (int s = 0; s < kNumSubsystems; ++s) {
+    const Counters& counters = counters_[s];
+    statistics[s].priority = static_cast<Priority>(counters.priority.load());
+    statistics[s].scheduled_tasks = counters.scheduled_tasks.load();
+    statistics[s].completed_tasks = counters.completed_tasks.load();
+    statistics[s].active_tasks = counters.active_tasks.load();
+    statistics[s].queued_tasks = counters.queued_tasks.load();
+    statistics[s].busy_micros = counters.busy_micros.load();
+  }
+  return statistics;
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,155 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_NATIVE_EXECUTOR_H_
+#define TENSORFLOW_C_NATIVE_EXECUTOR_H_
+
+#include <jni.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Process-wide executor for the background work of the JNI bindings, so that their features share a single set of
+// threads instead of each one creating its own. It is built on the work-stealing Eigen "NonBlockingThreadPool", and its
+// threads are attached to the JVM (as daemon threads) when they start, so that tasks can call into the JVM without
+// attaching the thread themselves.
+//
+// Each task is scheduled on behalf of a subsystem, which determines its priority and the counters that it updates.
+// Priorities are enforced when tasks start: tasks of lower priority may only occupy part of the threads, and so the
+// remaining threads stay available for tasks of higher priority. Tasks that cannot start yet are queued, and they are
+// started, highest priority first, as running tasks complete. All methods are safe for concurrent use.
+class NativeExecutor {
+ public:
+  enum Subsystem {
+    // File system requests issued concurrently by "FileIO" (e.g., batched stats and copies).
+    kFileIO = 0,
+    // Copies that pack large batches of tensors.
+    kTensorPacking = 1,
+    // Asynchronous callable runs, along with the delivery of their results to their JVM callbacks.
+    kSessionCallbacks = 2,
+    // Tokenization of the text corpora loaded by "LoadCorpus".
+    kCorpusLoading = 3,
+    kNumSubsystems = 4,
+  };
+
+  enum Priority {
+    // May occupy up to half of the threads.
+    kLow = 0,
+    // May occupy all threads except for a quarter of them, which are reserved for high priority tasks.
+    kNormal = 1,
+    // May occupy all threads.
+    kHigh = 2,
+    kNumPriorities = 3,
+  };
+
+  struct Statistics {
+    Priority priority = kNormal;
+    int64 scheduled_tasks = 0;
+    int64 completed_tasks = 0;
+    // Number of tasks that are currently running, and number of tasks that are waiting for their priority to allow
+    // them to start.
+    int64 active_tasks = 0;
+    int64 queued_tasks = 0;
+    // Sum of the durations of all completed tasks, in microseconds. Dividing it by the elapsed time gives the average
+    // number of threads occupied by the subsystem.
+    int64 busy_micros = 0;
+  };
+
+  // Sets the JVM that the executor threads attach to. It must be called before the executor is first used (i.e., when
+  // the JNI library is loaded), as threads that have already started are not attached.
+  static void SetJavaVM(JavaVM* jvm);
+
+  // Sets the number of executor threads, which defaults to the larger of the number of schedulable CPUs and 16, since
+  // file system tasks spend most of their time blocked. Returns a "FailedPrecondition" error if the executor has
+  // already been created.
+  static Status SetNumThreads(int32 num_threads);
+
+  // Returns the process-wide executor, creating it on first use.
+  static NativeExecutor* Global();
+
+  ~NativeExecutor();
+
+  int32 NumThreads() const { return num_threads_; }
+
+  // Schedules "fn" to run on an executor thread on behalf of "subsystem".
+  void Schedule(Subsystem subsystem, std::function<void()> fn);
+
+  // Runs "fn(i)" for all "i" in "[0, n)", on up to "max_parallelism" threads, and waits for all calls to complete. The
+  // calling thread runs calls as well, and so this makes progress even if no executor threads are available to
+  // "subsystem" (e.g., when it is called from an executor task).
+  void ParallelFor(Subsystem subsystem, int64 n, int32 max_parallelism, const std::function<void(int64)>& fn);
+
+  void SetPriority(Subsystem subsystem, Priority priority);
+
+  // Returns the statistics of all subsystems, indexed by subsystem.
+  std::vector<Statistics> statistics();
+
+ private:
+  class Pool;
+
+  struct Task {
+    Subsystem subsystem;
+    std::function<void()> fn;
+  };
+
+  struct Counters {
+    std::atomic<int> priority{kNormal};
+    std::atomic<int64> scheduled_tasks{0};
+    std::atomic<int64> completed_tasks{0};
+    std::atomic<int64> active_tasks{0};
+    std::atomic<int64> queued_tasks{0};
+    std::atomic<int64> busy_micros{0};
+  };
+
+  explicit NativeExecutor(int32 num_threads);
+
+  // Returns the number of threads that tasks of priority "priority" (along with tasks of lower priorities) may occupy.
+  int32 Limit(int priority) const;
+
+  // Returns "true" if a task of priority "priority" may start now. Requires "mu_" to be held.
+  bool CanStart(int priority) const;
+
+  // Hands "task" to the thread pool, after recording that it is running with priority "priority". Requires "mu_" to be
+  // held.
+  void Start(Task task, int priority);
+
+  // Runs "task" on an executor thread and then starts the queued tasks that its completion allows to start.
+  void Run(const Task& task, int priority);
+
+  const int32 num_threads_;
+  std::unique_ptr<Pool> pool_;
+  Counters counters_[kNumSubsystems];
+
+  std::mutex mu_;
+  // Number of running tasks of each priority, and queued tasks of each priority.
+  int32 active_[kNumPriorities] = {};
+  std::deque<Task> queued_[kNumPriorities];
+
+  TF_DISALLOW_COPY_AND_ASSIGN(NativeExecutor);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_NATIVE_EXECUTOR_H_
@@ -0,0 +1,69 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "native_gradients.h"
+
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "c_api_internal.h"
+
+namespace tensorflow {
+
+class Scope;
+class Operation;
+class Output;
+
+namespace ops {
+
+// Declaration of the C++ gradient registry that matches the one in
+// "tensorflow/cc/framework/grad_op_registry.h", which is not part of the
+// headers shipped with the native library.
+typedef std::function<Status(const Scope&, const Operation&, const std::vector<Output>&, std::vector<Output>*)>
+    GradFunc;
+
+class GradOpRegistry {
+ public:
+  bool Register(const string& op, GradFunc func);
+  Status Lookup(const string& op, GradFunc* func) const;
+  static GradOpRegistry* Global();
+};
+
+}  // namespace ops
+
+bool HasNativeGradient(const string& op_type) {
+  static std::mutex mutex;
+  static std::unordered_map<string, bool> cache;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = cache.find(op_type);
+  if (it != cache.end()) return it->second;
+  ops::GradFunc function;
+  bool has_gradient = ops::GradOpRegistry::Global()->Lookup(op_type, &function).ok() && function != nullptr;
+  cache.emplace(op_type, has_gradient);
+  return has_gradient;
+}
+
+void NativeGradientSupport(TF_Graph* graph, TF_Operation* const* ops, int num_ops, bool* supported) {
+  mutex_lock l(graph->mu);
+  for (int i = 0; i < num_ops; ++i) {
+    const Node& node = ops[i]->node;
+    const AttrValue* xla_compile = node.attrs().Find("_XlaCompile");
+    supported[i] = (xla_compile == nullptr || !xla_compile->b()) && HasNativeGradient(node.type_string());
+  }
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,40 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_NATIVE_GRADIENTS_H_
+#define TENSORFLOW_C_NATIVE_GRADIENTS_H_
+
+#include "c_api.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Returns true if a gradient function for ops of type "op_type" is registered
+// in the C++ gradient registry (i.e., the one used by "TF_AddGradients"). Ops
+// registered as having no gradient are reported as not supported. The results
+// are cached per op type, since the registry is only populated at load time.
+bool HasNativeGradient(const string& op_type);
+
+// Stores in "supported[i]" whether the gradient of "ops[i]", which must belong
+// to "graph", can be built by "TF_AddGradients". That is the case when its op
+// type has a C++ gradient function and it is not marked for XLA compilation
+// (whose gradients need the "_XlaCompile" and "_XlaScope" attributes that
+// "TF_AddGradients" does not set).
+void NativeGradientSupport(TF_Graph* graph, TF_Operation* const* ops,
+                           int num_ops, bool* supported);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_NATIVE_GRADIENTS_H_
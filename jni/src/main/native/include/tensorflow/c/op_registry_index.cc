@@ -0,0 +1,83 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "op_registry_index.h"
+
+#include <mutex>
+
+#include "tensorflow/core/framework/op.h"
+
+namespace tensorflow {
+
+namespace {
+
+struct OpListCache {
+  std::mutex mu;
+  int64 version = 0;
+  std::shared_ptr<const string> snapshot;
+};
+
+OpListCache& op_list_cache() {
+  static OpListCache* cache = new OpListCache();
+  return *cache;
+}
+
+}  // namespace
+
+Status LookUpRegisteredOpDef(const string& op_type, const OpDef** op_def) {
+  return OpRegistry::Global()->LookUpOpDef(op_type, op_def);
+}
+
+Status LookUpOpSignature(const string& op_type, OpSignature* signature) {
+  const OpDef* op_def = nullptr;
+  TF_RETURN_IF_ERROR(LookUpRegisteredOpDef(op_type, &op_def));
+  for (const OpDef::ArgDef& arg : op_def->input_arg()) {
+    signature->input_arg_names.push_back(arg.name());
+    signature->input_arg_types.push_back(arg.type());
+  }
+  for (const OpDef::ArgDef& arg : op_def->output_arg()) {
+    signature->output_arg_names.push_back(arg.name());
+    signature->output_arg_types.push_back(arg.type());
+  }
+  for (const OpDef::AttrDef& attr : op_def->attr()) {
+    signature->attr_names.push_back(attr.name());
+    signature->attr_types.push_back(attr.type());
+  }
+  signature->is_stateful = op_def->is_stateful();
+  return Status::OK();
+}
+
+std::shared_ptr<const string> OpListSnapshot(int64* version) {
+  OpListCache& cache = op_list_cache();
+  std::lock_guard<std::mutex> lock(cache.mu);
+  if (cache.snapshot == nullptr) {
+    OpList op_list;
+    OpRegistry::Global()->Export(true, &op_list);
+    auto serialized = std::make_shared<string>();
+    op_list.SerializeToString(serialized.get());
+    cache.snapshot = serialized;
+  }
+  *version = cache.version;
+  return cache.snapshot;
+}
+
+void InvalidateOpListSnapshot() {
+  OpListCache& cache = op_list_cache();
+  std::lock_guard<std::mutex> lock(cache.mu);
+  cache.snapshot.reset();
+  ++cache.version;
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,61 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_OP_REGISTRY_INDEX_H_
+#define TENSORFLOW_C_OP_REGISTRY_INDEX_H_
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/core/framework/op_def.pb.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Argument and attribute signature of a registered op.
+struct OpSignature {
+  std::vector<string> input_arg_names;
+  // Data types of the input arguments, or "DT_INVALID" for arguments whose
+  // types are determined by attributes.
+  std::vector<int> input_arg_types;
+  std::vector<string> output_arg_names;
+  std::vector<int> output_arg_types;
+  std::vector<string> attr_names;
+  // Attribute types (e.g., "type", "list(int)", or "shape").
+  std::vector<string> attr_types;
+  bool is_stateful = false;
+};
+
+// Looks up the definition of the op of type "op_type" in the global op
+// registry, which is indexed by op type, without exporting the whole registry.
+Status LookUpRegisteredOpDef(const string& op_type, const OpDef** op_def);
+
+// Looks up the signature of the op of type "op_type" in the global op registry.
+Status LookUpOpSignature(const string& op_type, OpSignature* signature);
+
+// Returns the serialized "OpList" of all registered ops, along with its
+// version in "version". The serialized list is computed once and cached, until
+// it is invalidated by "InvalidateOpListSnapshot", which increments the
+// version. The returned snapshot remains valid even after it is invalidated.
+std::shared_ptr<const string> OpListSnapshot(int64* version);
+
+// Invalidates the cached snapshot returned by "OpListSnapshot". Must be called
+// whenever new ops are registered (e.g., after loading an op library).
+void InvalidateOpListSnapshot();
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_OP_REGISTRY_INDEX_H_
@@ -0,0 +1,144 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/optimized_graph_cache.h"
+
+#include <algorithm>
+
+#include "tensorflow/c/graph_optimizer.h"
+#include "tensorflow/c/metrics_exporter.h"
+#include "tensorflow/core/grappler/clusters/utils.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/lib/strings/stringprintf.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/protobuf.h"
+#include "tensorflow/core/public/version.h"
+
+namespace tensorflow {
+namespace {
+
+const char kGraphSuffix[] = ".graph";
+const char kTemporarySuffix[] = ".tmp-";
+
+// Serializes "message" with deterministic map ordering, so that equal messages always produce the same fingerprint.
+string SerializeDeterministically(const protobuf::Message& message) {
+  string serialized;
+  message.ByteSizeLong();
+  {
+    protobuf::io::StringOutputStream stream(&serialized);
+    protobuf::io::CodedOutputStream output(&stream);
+    output.SetSerializationDeterministic(true);
+    message.SerializeWithCachedSizes(&output);
+  }
+  return serialized;
+}
+
+// Appends "part" to "key", prefixed by its length, so that different sequences of parts never produce the same key.
+void AppendKeyPart(string* key, const string& part) { strings::StrAppend(key, part.size(), ":", part); }
+
+// Optimized graphs are named after the fingerprint of everything that determines the result of the optimizations.
+string GraphName(const GraphDef& graph_def, const RewriterConfig& config, const std::vector<string>& fetches) {
+  std::vector<string> sorted_fetches(fetches);
+  std::sort(sorted_fetches.begin(), sorted_fetches.end());
+  string key;
+  AppendKeyPart(&key, TF_VERSION_STRING);
+  AppendKeyPart(&key, tf_git_version());
+  AppendKeyPart(&key, SerializeDeterministically(grappler::GetLocalCPUInfo()));
+  AppendKeyPart(&key, SerializeDeterministically(config));
+  for (const string& fetch : sorted_fetches) AppendKeyPart(&key, fetch);
+  AppendKeyPart(&key, SerializeDeterministically(graph_def));
+  const Fprint128 fingerprint = Fingerprint128(key);
+  return strings::Printf("%016llx%016llx%s", static_cast<unsigned long long>(fingerprint.high64),
+                         static_cast<unsigned long long>(fingerprint.low64), kGraphSuffix);
+}
+
+}  // namespace
+
+OptimizedGraphCache* OptimizedGraphCache::Global() {
+  static OptimizedGraphCache* cache = new OptimizedGraphCache();
+  return cache;
+}
+
+Status OptimizedGraphCache::Enable(const string& directory) {
+  TF_RETURN_IF_ERROR(Env::Default()->RecursivelyCreateDir(directory));
+  std::lock_guard<std::mutex> lock(mu_);
+  directory_ = directory;
+  hits_ = 0;
+  misses_ = 0;
+  failed_writes_ = 0;
+  optimization_micros_ = 0;
+  enabled_.store(true, std::memory_order_release);
+  return Status::OK();
+}
+
+void OptimizedGraphCache::Disable() {
+  std::lock_guard<std::mutex> lock(mu_);
+  enabled_.store(false, std::memory_order_release);
+}
+
+OptimizedGraphCache::Statistics OptimizedGraphCache::statistics() {
+  Statistics statistics;
+  statistics.hits = hits_.load();
+  statistics.misses = misses_.load();
+  statistics.failed_writes = failed_writes_.load();
+  statistics.optimization_micros = optimization_micros_.load();
+  return statistics;
+}
+
+Status OptimizedGraphCache::Optimize(const GraphDef& graph_def, const RewriterConfig& config,
+                                     const std::vector<string>& fetches, GraphDef* optimized_graph) {
+  bool enabled;
+  string directory;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    enabled = this->enabled();
+    directory = directory_;
+  }
+  if (!enabled) return OptimizeGraph(graph_def, config, fetches, optimized_graph);
+
+  Env* env = Env::Default();
+  const string path = io::JoinPath(directory, GraphName(graph_def, config, fetches));
+  string contents;
+  if (ReadFileToString(env, path, &contents).ok() && optimized_graph->ParseFromString(contents)) {
+    ++hits_;
+    jni_metrics::RecordOptimizedGraphCacheHit();
+    return Status::OK();
+  }
+
+  const uint64 start_micros = env->NowMicros();
+  TF_RETURN_IF_ERROR(OptimizeGraph(graph_def, config, fetches, optimized_graph));
+  const uint64 duration_micros = env->NowMicros() - start_micros;
+  ++misses_;
+  optimization_micros_ += static_cast<int64>(duration_micros);
+  jni_metrics::RecordOptimizedGraphCacheMiss(duration_micros);
+
+  // Graphs are written to temporary files first, so that partially written graphs are never read, including by other
+  // processes that share the cache directory.
+  static std::atomic<uint64> next_temporary_id{0};
+  const string temporary_path = strings::StrCat(path, kTemporarySuffix, env->NowMicros(), "-", next_temporary_id++);
+  Status s = WriteStringToFile(env, temporary_path, optimized_graph->SerializeAsString());
+  if (s.ok()) s = env->RenameFile(temporary_path, path);
+  if (!s.ok()) {
+    LOG(WARNING) << "Failed to cache optimized graph '" << path << "': " << s;
+    env->DeleteFile(temporary_path).IgnoreError();
+    ++failed_writes_;
+  }
+  return Status::OK();
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,86 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_OPTIMIZED_GRAPH_CACHE_H_
+#define TENSORFLOW_C_OPTIMIZED_GRAPH_CACHE_H_
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/protobuf/rewriter_config.pb.h"
+
+namespace tensorflow {
+
+// Process-wide persistent cache of the graphs optimized by "OptimizeGraph", which is stored in a directory of any file
+// system supported by TensorFlow (ideally a local one) and is shared by all processes that use the same directory, so
+// that a new process (e.g., an autoscaled serving replica) does not have to run the Grappler optimizations again. Each
+// optimized graph is stored in its own file, named after a fingerprint of everything that determines the result of the
+// optimizations: the TensorFlow version, the properties of the local CPU (which is the device that the graphs are
+// optimized for), the rewriter configuration, the fetches, and the graph itself. Stale entries are thus never used,
+// and they are never removed either. Files that cannot be read or parsed are treated as misses and are overwritten.
+// All methods are safe for concurrent use.
+class OptimizedGraphCache {
+ public:
+  struct Statistics {
+    int64 hits = 0;
+    int64 misses = 0;
+    // Number of optimized graphs that could not be written to the cache (which is not an error for the optimization).
+    int64 failed_writes = 0;
+    // Time spent optimizing graphs on misses, in microseconds.
+    int64 optimization_micros = 0;
+  };
+
+  // Returns the process-wide cache, which is initially disabled.
+  static OptimizedGraphCache* Global();
+
+  // Enables the cache, storing the optimized graphs in "directory", which is created if it does not exist. If the
+  // cache is already enabled, it is moved to "directory" and its statistics are reset.
+  Status Enable(const string& directory);
+
+  // Disables the cache. The optimized graphs are kept in the cache directory.
+  void Disable();
+
+  bool enabled() const { return enabled_.load(std::memory_order_acquire); }
+
+  Statistics statistics();
+
+  // Same as "OptimizeGraph", except that the optimized graph is read from the cache, if it is enabled and contains it,
+  // and is written to the cache after being optimized, otherwise.
+  Status Optimize(const GraphDef& graph_def, const RewriterConfig& config, const std::vector<string>& fetches,
+                  GraphDef* optimized_graph);
+
+ private:
+  OptimizedGraphCache() = default;
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<int64> hits_{0};
+  std::atomic<int64> misses_{0};
+  std::atomic<int64> failed_writes_{0};
+  std::atomic<int64> optimization_micros_{0};
+
+  std::mutex mu_;
+  string directory_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(OptimizedGraphCache);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_OPTIMIZED_GRAPH_CACHE_H_
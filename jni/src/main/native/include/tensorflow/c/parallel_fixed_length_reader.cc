@@ -0,0 +1,245 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/parallel_fixed_length_reader.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "tensorflow/c/block_cache.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/platform/file_system.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Opens "filename" for direct I/O, returning -1 if that is not supported for
+// it (e.g., because it is not a local file, or because its file system does
+// not support direct I/O).
+int OpenDirect(const string& filename) {
+#if defined(__linux__) && defined(O_DIRECT)
+  StringPiece scheme, host, path;
+  io::ParseURI(filename, &scheme, &host, &path);
+  if (!scheme.empty() && scheme != "file") return -1;
+  return open(path.ToString().c_str(), O_RDONLY | O_DIRECT);
+#else
+  return -1;
+#endif
+}
+
+struct FreeDeleter {
+  void operator()(char* data) const { free(data); }
+};
+
+}  // namespace
+
+constexpr size_t ParallelFixedLengthReader::kDirectIoAlignment;
+
+ParallelFixedLengthReader* ParallelFixedLengthReader::New(
+    const string& filename, int64 header_bytes, int64 record_bytes,
+    int64 footer_bytes, int64 records_per_batch, int num_threads,
+    int max_buffered_batches, bool use_direct_io, TF_Status* out_status) {
+  Status status;
+  if (header_bytes < 0 || footer_bytes < 0)
+    status = errors::InvalidArgument(
+        "The header and footer sizes must be non-negative.");
+  else if (record_bytes <= 0 || records_per_batch <= 0)
+    status = errors::InvalidArgument(
+        "The record size and the number of records per batch must be "
+        "positive.");
+  else if (num_threads <= 0 || max_buffered_batches <= 0)
+    status = errors::InvalidArgument(
+        "The number of threads and of buffered batches must be positive.");
+  uint64 file_size = 0;
+  if (status.ok()) status = Env::Default()->GetFileSize(filename, &file_size);
+  if (status.ok() &&
+      static_cast<int64>(file_size) < header_bytes + footer_bytes)
+    status = errors::InvalidArgument(
+        "File '", filename, "' (", file_size,
+        " bytes) is smaller than its header and footer.");
+  std::unique_ptr<ParallelFixedLengthReader> reader(
+      new ParallelFixedLengthReader());
+  if (status.ok()) {
+    reader->filename_ = filename;
+    reader->header_bytes_ = header_bytes;
+    reader->record_bytes_ = record_bytes;
+    reader->records_per_batch_ = records_per_batch;
+    reader->num_records_ =
+        (static_cast<int64>(file_size) - header_bytes - footer_bytes) /
+        record_bytes;
+    reader->num_batches_ =
+        (reader->num_records_ + records_per_batch - 1) / records_per_batch;
+    reader->max_buffered_batches_ = max_buffered_batches;
+    if (use_direct_io) reader->fd_ = OpenDirect(filename);
+    if (reader->fd_ < 0)
+      status = NewCachedRandomAccessFile(filename, &reader->file_);
+  }
+  if (!status.ok()) {
+    Set_TF_Status_from_Status(out_status, status);
+    return nullptr;
+  }
+  const int threads = static_cast<int>(
+      std::min<int64>(num_threads, std::max<int64>(1, reader->num_batches_)));
+  for (int i = 0; i < threads; ++i) {
+    ParallelFixedLengthReader* r = reader.get();
+    reader->threads_.emplace_back(Env::Default()->StartThread(
+        ThreadOptions(), "tf_scala_fixed_length_reader",
+        [r]() { r->ReadLoop(); }));
+  }
+  return reader.release();
+}
+
+ParallelFixedLengthReader::~ParallelFixedLengthReader() {
+  {
+    mutex_lock l(mu_);
+    cancelled_ = true;
+  }
+  space_available_.notify_all();
+  // Joins the reading threads.
+  threads_.clear();
+  for (auto& batch : batches_) TF_DeleteTensor(batch.second);
+#if defined(__linux__)
+  if (fd_ >= 0) close(fd_);
+#endif
+}
+
+void ParallelFixedLengthReader::ReadLoop() {
+  // Direct I/O requests cover the batch extended to the alignment on both
+  // sides, and so the scratch buffer is two alignment units larger.
+  std::unique_ptr<char, FreeDeleter> scratch;
+  if (fd_ >= 0) {
+    void* data = nullptr;
+    const size_t size =
+        records_per_batch_ * record_bytes_ + 2 * kDirectIoAlignment;
+    if (posix_memalign(&data, kDirectIoAlignment, size) != 0) {
+      mutex_lock l(mu_);
+      status_.Update(
+          errors::ResourceExhausted("Failed to allocate ", size, " bytes."));
+      batch_available_.notify_all();
+      return;
+    }
+    scratch.reset(static_cast<char*>(data));
+  }
+  while (true) {
+    int64 index;
+    {
+      mutex_lock l(mu_);
+      while (!cancelled_ && status_.ok() && next_to_read_ < num_batches_ &&
+             next_to_read_ >= next_to_return_ + max_buffered_batches_)
+        space_available_.wait(l);
+      if (cancelled_ || !status_.ok() || next_to_read_ >= num_batches_) return;
+      index = next_to_read_++;
+    }
+    TF_Tensor* batch = nullptr;
+    const Status s = ReadBatch(index, scratch.get(), &batch);
+    mutex_lock l(mu_);
+    if (s.ok()) {
+      batches_[index] = batch;
+    } else {
+      status_.Update(s);
+    }
+    batch_available_.notify_all();
+  }
+}
+
+Status ParallelFixedLengthReader::ReadDirect(uint64 offset, size_t length,
+                                             char* data, char* scratch) {
+#if defined(__linux__)
+  const uint64 aligned_offset = offset - offset % kDirectIoAlignment;
+  const uint64 end = offset + length;
+  const size_t aligned_length =
+      (end - aligned_offset + kDirectIoAlignment - 1) / kDirectIoAlignment *
+      kDirectIoAlignment;
+  size_t read = 0;
+  while (aligned_offset + read < end) {
+    const ssize_t r = pread(fd_, scratch + read, aligned_length - read,
+                            static_cast<off_t>(aligned_offset + read));
+    if (r < 0 && errno == EINTR) continue;
+    if (r < 0)
+      return errors::Internal("Failed to read '", filename_, "' at offset ",
+                              aligned_offset + read, ": ", strerror(errno));
+    // Reads past the end of the file, within its last block, are short.
+    if (r == 0) break;
+    read += static_cast<size_t>(r);
+  }
+  if (aligned_offset + read < end)
+    return errors::OutOfRange("Unexpected end of file '", filename_, "'.");
+  memcpy(data, scratch + (offset - aligned_offset), length);
+  return Status::OK();
+#else
+  return errors::Unimplemented("Direct I/O is not supported.");
+#endif
+}
+
+Status ParallelFixedLengthReader::ReadBatch(int64 index, char* scratch,
+                                            TF_Tensor** batch) {
+  const int64 first = index * records_per_batch_;
+  const int64 num_records =
+      std::min(records_per_batch_, num_records_ - first);
+  const int64_t dims[] = {num_records, record_bytes_};
+  const size_t length = static_cast<size_t>(num_records * record_bytes_);
+  const uint64 offset =
+      static_cast<uint64>(header_bytes_ + first * record_bytes_);
+  *batch = TF_AllocateTensor(TF_UINT8, dims, 2, length);
+  char* data = static_cast<char*>(TF_TensorData(*batch));
+  Status s;
+  if (fd_ >= 0) {
+    s = ReadDirect(offset, length, data, scratch);
+  } else {
+    StringPiece result;
+    s = file_->Read(offset, length, &result, data);
+    if (s.ok() && result.size() != length)
+      s = errors::OutOfRange("Unexpected end of file '", filename_, "'.");
+    if (s.ok() && result.data() != data)
+      memcpy(data, result.data(), length);
+  }
+  if (!s.ok()) {
+    TF_DeleteTensor(*batch);
+    *batch = nullptr;
+  }
+  return s;
+}
+
+TF_Tensor* ParallelFixedLengthReader::Next(TF_Status* status) {
+  mutex_lock l(mu_);
+  while (true) {
+    if (next_to_return_ >= num_batches_) return nullptr;
+    auto it = batches_.find(next_to_return_);
+    if (it != batches_.end()) {
+      TF_Tensor* batch = it->second;
+      batches_.erase(it);
+      ++next_to_return_;
+      space_available_.notify_all();
+      return batch;
+    }
+    if (!status_.ok()) {
+      Set_TF_Status_from_Status(status, status_);
+      return nullptr;
+    }
+    batch_available_.wait(l);
+  }
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,106 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_PARALLEL_FIXED_LENGTH_READER_H_
+#define TENSORFLOW_C_PARALLEL_FIXED_LENGTH_READER_H_
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+class RandomAccessFile;
+
+// Reads a file that consists of a fixed-size header, followed by fixed-length
+// records, followed by a fixed-size footer, using multiple threads. The
+// records are split into batches of contiguous byte ranges, which are read
+// concurrently and returned in order, each as a single "UINT8" tensor with
+// shape "[num_records, record_bytes]".
+//
+// For local files, and where supported, the batches are read with "O_DIRECT"
+// requests that bypass the page cache, extended to the direct I/O alignment.
+// Otherwise, they are read through the file system of the file.
+class ParallelFixedLengthReader {
+ public:
+  // Size, in bytes, to which the offsets, lengths, and buffers of direct I/O
+  // requests are aligned.
+  static constexpr size_t kDirectIoAlignment = 4096;
+
+  static ParallelFixedLengthReader* New(
+      const string& filename, int64 header_bytes, int64 record_bytes,
+      int64 footer_bytes, int64 records_per_batch, int num_threads,
+      int max_buffered_batches, bool use_direct_io, TF_Status* out_status);
+
+  ~ParallelFixedLengthReader();
+
+  int64 num_records() const { return num_records_; }
+  int64 num_batches() const { return num_batches_; }
+
+  // Returns "true" if the batches are read using direct I/O.
+  bool direct_io() const { return fd_ >= 0; }
+
+  // Returns the next batch, which is then owned by the caller, or null once
+  // all batches have been returned.
+  TF_Tensor* Next(TF_Status* status);
+
+ private:
+  ParallelFixedLengthReader() = default;
+
+  // Reads batches until all of them have been read or the reader is deleted.
+  void ReadLoop();
+
+  // Reads the "index"-th batch into a newly allocated tensor.
+  Status ReadBatch(int64 index, char* scratch, TF_Tensor** batch);
+
+  // Reads "length" bytes at "offset" into "data", using direct I/O requests
+  // aligned into "scratch".
+  Status ReadDirect(uint64 offset, size_t length, char* data, char* scratch);
+
+  string filename_;
+  std::unique_ptr<RandomAccessFile> file_;
+  int fd_ = -1;
+  int64 header_bytes_ = 0;
+  int64 record_bytes_ = 0;
+  int64 records_per_batch_ = 0;
+  int64 num_records_ = 0;
+  int64 num_batches_ = 0;
+  int max_buffered_batches_ = 0;
+
+  mutex mu_;
+  condition_variable batch_available_;
+  condition_variable space_available_;
+  // Index of the next batch to start reading.
+  int64 next_to_read_ GUARDED_BY(mu_) = 0;
+  // Index of the next batch to return.
+  int64 next_to_return_ GUARDED_BY(mu_) = 0;
+  std::map<int64, TF_Tensor*> batches_ GUARDED_BY(mu_);
+  Status status_ GUARDED_BY(mu_);
+  bool cancelled_ GUARDED_BY(mu_) = false;
+  std::vector<std::unique_ptr<Thread>> threads_;
+  TF_DISALLOW_COPY_AND_ASSIGN(ParallelFixedLengthReader);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_PARALLEL_FIXED_LENGTH_READER_H_
@@ -0,0 +1,82 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/pinned_host_memory.h"
+
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/mem.h"
+
+#if defined(TENSORFLOW_WITH_CUDA)
+#include "tensorflow/core/common_runtime/gpu/gpu_init.h"
+#include "tensorflow/core/platform/stream_executor.h"
+#endif
+
+namespace tensorflow {
+namespace {
+
+#if defined(TENSORFLOW_WITH_CUDA)
+
+namespace gpu = ::perftools::gputools;
+
+// Returns the StreamExecutor of the first CUDA device, or "nullptr" if no CUDA device is visible. The executor is
+// created once and is shared with the GPU devices of all sessions, as it is owned by the GPU machine manager.
+gpu::StreamExecutor* PinnedHostMemoryExecutor() {
+  static gpu::StreamExecutor* executor = []() -> gpu::StreamExecutor* {
+    if (!ValidateGPUMachineManager().ok()) return nullptr;
+    gpu::Platform* platform = GPUMachineManager();
+    if (platform == nullptr || platform->VisibleDeviceCount() <= 0) return nullptr;
+    auto result = platform->ExecutorForDevice(0);
+    if (!result.ok()) {
+      LOG(WARNING) << "Unable to obtain the CUDA executor used for pinned host memory: " << result.status();
+      return nullptr;
+    }
+    return result.ValueOrDie();
+  }();
+  return executor;
+}
+
+#endif
+
+}  // namespace
+
+bool PinnedHostMemoryAvailable() {
+#if defined(TENSORFLOW_WITH_CUDA)
+  return PinnedHostMemoryExecutor() != nullptr;
+#else
+  return false;
+#endif
+}
+
+void* AllocatePinnedHostMemory(size_t num_bytes) {
+#if defined(TENSORFLOW_WITH_CUDA)
+  // Page-locked allocations are page aligned, which satisfies the Eigen alignment requirements.
+  if (PinnedHostMemoryAvailable()) return PinnedHostMemoryExecutor()->HostMemoryAllocate(num_bytes);
+#endif
+  return port::AlignedMalloc(num_bytes, Allocator::kAllocatorAlignment);
+}
+
+void FreePinnedHostMemory(void* data) {
+  if (data == nullptr) return;
+#if defined(TENSORFLOW_WITH_CUDA)
+  if (PinnedHostMemoryAvailable()) {
+    PinnedHostMemoryExecutor()->HostMemoryDeallocate(data);
+    return;
+  }
+#endif
+  port::AlignedFree(data);
+}
+
+}  // namespace tensorflow
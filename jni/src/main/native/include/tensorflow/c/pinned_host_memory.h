@@ -0,0 +1,39 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_PINNED_HOST_MEMORY_H_
+#define TENSORFLOW_C_PINNED_HOST_MEMORY_H_
+
+#include <cstddef>
+
+namespace tensorflow {
+
+// Returns "true" if host memory allocated using "AllocatePinnedHostMemory" is actually page-locked. This requires the
+// JNI library to be built with the "TENSORFLOW_WITH_CUDA" CMake option and a CUDA device to be visible to the process.
+// Page-locked memory is allocated through the StreamExecutor of the first CUDA device (i.e., in the same way as the
+// "cuda_host_bfc" allocator of the TensorFlow runtime), and it is registered as portable, and so the GPU devices copy
+// tensors backed by it using DMA, without staging them through their own pinned buffers.
+bool PinnedHostMemoryAvailable();
+
+// Allocates "num_bytes" bytes of page-locked host memory, aligned for Eigen, or of ordinary (i.e., pageable) aligned
+// host memory if page-locked memory is not available. Returns "nullptr" if the allocation fails.
+void* AllocatePinnedHostMemory(size_t num_bytes);
+
+// Frees memory allocated using "AllocatePinnedHostMemory".
+void FreePinnedHostMemory(void* data);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_PINNED_HOST_MEMORY_H_
@@ -16,6 +16,7 @@ limitations under the License.
 #include "python_api.h"
 
 #include "c_api_internal.h"
+#include "tensorflow/core/framework/node_def_util.h"
 
 namespace tensorflow {
 
@@ -24,6 +25,44 @@ void UpdateEdge(TF_Graph* graph, TF_Output new_src, TF_Input dst, TF_Status* sta
   status->status = graph->graph.UpdateEdge(&new_src.oper->node, new_src.index, &dst.oper->node, dst.index);
 }
 
+void UpdateEdges(TF_Graph* graph, const TF_Output* new_srcs, const TF_Input* dsts, int num_edges, TF_Status* status) {
+  mutex_lock l(graph->mu);
+  for (int i = 0; i < num_edges && status->status.ok(); ++i)
+    status->status = graph->graph.UpdateEdge(&new_srcs[i].oper->node, new_srcs[i].index, &dsts[i].oper->node,
+                                             dsts[i].index);
+}
+
+void FinishOperations(TF_Graph* graph, TF_OperationDescription** descs, int num_descs, TF_Operation** ops,
+                      TF_Status* status) {
+  mutex_lock l(graph->mu);
+  for (int i = 0; i < num_descs; ++i) {
+    TF_OperationDescription* desc = descs[i];
+    Node* node = nullptr;
+    if (!status->status.ok()) {
+      // Skip the descriptions that follow a failed one.
+    } else if (graph->name_map.count(desc->node_builder.node_name())) {
+      status->status = errors::InvalidArgument(
+          "Duplicate node name in graph: '", desc->node_builder.node_name(), "'");
+    } else {
+      if (!desc->colocation_constraints.empty())
+        desc->node_builder.Attr(
+            kColocationAttrName,
+            std::vector<string>(desc->colocation_constraints.begin(), desc->colocation_constraints.end()));
+      status->status = desc->node_builder.Finalize(&graph->graph, &node);
+      if (status->status.ok())
+        status->status = graph->refiner.AddNode(node);
+      if (status->status.ok()) {
+        graph->name_map[node->name()] = node;
+      } else if (node != nullptr) {
+        graph->graph.RemoveNode(node);
+        node = nullptr;
+      }
+    }
+    delete desc;
+    ops[i] = reinterpret_cast<TF_Operation*>(node);
+  }
+}
+
 void AddControlInput(TF_Graph* graph, TF_Operation* op, TF_Operation* input) {
   mutex_lock l(graph->mu);
   graph->graph.AddControlEdge(&input->node, &op->node);
@@ -25,6 +25,18 @@ namespace tensorflow {
 
 void UpdateEdge(TF_Graph* graph, TF_Output new_src, TF_Input dst, TF_Status* status);
 
+// Same as "UpdateEdge", but for "num_edges" edges at once, while holding the
+// graph lock only once. Stops at the first edge that cannot be updated.
+void UpdateEdges(TF_Graph* graph, const TF_Output* new_srcs, const TF_Input* dsts, int num_edges, TF_Status* status);
+
+// Same as calling "TF_FinishOperation" on each of the "num_descs" descriptions
+// in "descs", which must all belong to "graph", but holding the graph lock only
+// once. The resulting ops are stored in "ops". Stops at the first description
+// that cannot be finished, in which case the corresponding and all following
+// entries of "ops" are set to null. All descriptions are deleted.
+void FinishOperations(TF_Graph* graph, TF_OperationDescription** descs, int num_descs, TF_Operation** ops,
+                      TF_Status* status);
+
 void AddControlInput(TF_Graph* graph, TF_Operation* op, TF_Operation* input);
 
 void ClearControlInputs(TF_Graph* graph, TF_Operation* op);
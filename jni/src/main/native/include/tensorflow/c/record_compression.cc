@@ -0,0 +1,686 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/record_compression.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <utility>
+
+#if defined(TENSORFLOW_WITH_ZSTD)
+#include <zstd.h>
+#include <zstd_errors.h>
+#endif
+
+#if defined(TENSORFLOW_WITH_LZ4)
+#include <lz4frame.h>
+#endif
+
+#include "tensorflow/core/lib/core/coding.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/threadpool.h"
+#include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+
+namespace tensorflow {
+namespace io {
+
+const char kZstdCompression[] = "ZSTD";
+const char kLz4Compression[] = "LZ4";
+
+namespace {
+
+// Number of uncompressed bytes in each frame written by the compressing files. Frames are compressed and decompressed
+// independently, and so they are the unit of parallelism.
+const size_t kFrameBytes = 4 << 20;
+
+// Number of compressed bytes read from the underlying file at a time.
+const size_t kReadBytes = 1 << 20;
+
+// Frames that cannot be delimited within this many compressed bytes are decompressed sequentially, as a stream.
+const size_t kMaxFrameBytes = 64 << 20;
+
+// Number of decompressed bytes before the current read position that are kept, so that short backward reads (e.g.,
+// those of "RandomAccessInputStream::SkipNBytes") do not restart the decompression.
+const uint64 kHistoryBytes = 16 << 20;
+
+int NumCompressionThreads() { return std::max(1, std::min(port::NumSchedulableCPUs(), 8)); }
+
+// Streaming decoder, which decodes a sequence of concatenated frames.
+class StreamDecoder {
+ public:
+  virtual ~StreamDecoder() {}
+
+  // Decodes all of "input", which continues the previously decoded input, and appends the result to "output".
+  virtual Status Decode(StringPiece input, string* output) = 0;
+
+  // Returns "true" if the decoded input ends at a frame boundary.
+  virtual bool AtFrameBoundary() const = 0;
+};
+
+// Frame compression codec. All methods are safe for concurrent use.
+class Codec {
+ public:
+  virtual ~Codec() {}
+
+  // Sets "*size" to the compressed size of the frame at the start of "data", or to 0 if "data" does not contain a
+  // complete frame.
+  virtual Status FrameSize(StringPiece data, size_t* size) const = 0;
+
+  virtual Status NewDecoder(std::unique_ptr<StreamDecoder>* decoder) const = 0;
+
+  // Compresses "input" into a single frame.
+  virtual Status Compress(StringPiece input, string* output) const = 0;
+};
+
+#if defined(TENSORFLOW_WITH_ZSTD)
+
+const int kZstdLevel = 3;
+
+class ZstdDecoder : public StreamDecoder {
+ public:
+  ZstdDecoder() : stream_(ZSTD_createDStream()) {}
+  ~ZstdDecoder() override { ZSTD_freeDStream(stream_); }
+
+  Status Init() {
+    if (stream_ == nullptr) return errors::ResourceExhausted("Failed to create a ZSTD decompression stream.");
+    const size_t result = ZSTD_initDStream(stream_);
+    if (ZSTD_isError(result)) return errors::Internal("Failed to initialize ZSTD: ", ZSTD_getErrorName(result));
+    return Status::OK();
+  }
+
+  Status Decode(StringPiece input, string* output) override {
+    ZSTD_inBuffer in = {input.data(), input.size(), 0};
+    const size_t capacity = ZSTD_DStreamOutSize();
+    bool output_full;
+    do {
+      // Decoding continues while the output buffer is filled, since the decoder may hold back decoded data otherwise.
+      const size_t start = output->size();
+      output->resize(start + capacity);
+      ZSTD_outBuffer out = {&(*output)[start], capacity, 0};
+      const size_t result = ZSTD_decompressStream(stream_, &out, &in);
+      output->resize(start + out.pos);
+      if (ZSTD_isError(result)) return errors::DataLoss("Failed to decompress ZSTD data: ", ZSTD_getErrorName(result));
+      remaining_ = result;
+      output_full = out.pos == capacity;
+    } while (in.pos < in.size || output_full);
+    return Status::OK();
+  }
+
+  bool AtFrameBoundary() const override { return remaining_ == 0; }
+
+ private:
+  ZSTD_DStream* stream_;
+  size_t remaining_ = 0;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ZstdDecoder);
+};
+
+class ZstdCodec : public Codec {
+ public:
+  Status FrameSize(StringPiece data, size_t* size) const override {
+    *size = 0;
+    if (data.empty()) return Status::OK();
+    const size_t result = ZSTD_findFrameCompressedSize(data.data(), data.size());
+    if (!ZSTD_isError(result)) {
+      *size = result;
+    } else if (ZSTD_getErrorCode(result) != ZSTD_error_srcSize_wrong) {
+      return errors::DataLoss("Invalid ZSTD frame: ", ZSTD_getErrorName(result));
+    }
+    return Status::OK();
+  }
+
+  Status NewDecoder(std::unique_ptr<StreamDecoder>* decoder) const override {
+    std::unique_ptr<ZstdDecoder> zstd_decoder(new ZstdDecoder());
+    TF_RETURN_IF_ERROR(zstd_decoder->Init());
+    decoder->reset(zstd_decoder.release());
+    return Status::OK();
+  }
+
+  Status Compress(StringPiece input, string* output) const override {
+    output->resize(ZSTD_compressBound(input.size()));
+    const size_t result = ZSTD_compress(&(*output)[0], output->size(), input.data(), input.size(), kZstdLevel);
+    if (ZSTD_isError(result)) return errors::Internal("Failed to compress ZSTD data: ", ZSTD_getErrorName(result));
+    output->resize(result);
+    return Status::OK();
+  }
+};
+
+#endif  // TENSORFLOW_WITH_ZSTD
+
+#if defined(TENSORFLOW_WITH_LZ4)
+
+const uint32 kLz4Magic = 0x184D2204;
+const uint32 kLz4SkippableMagic = 0x184D2A50;
+const uint32 kLz4SkippableMagicMask = 0xFFFFFFF0;
+const size_t kLz4OutputBytes = 256 << 10;
+
+class Lz4Decoder : public StreamDecoder {
+ public:
+  Lz4Decoder() {}
+  ~Lz4Decoder() override {
+    if (context_ != nullptr) LZ4F_freeDecompressionContext(context_);
+  }
+
+  Status Init() {
+    const size_t result = LZ4F_createDecompressionContext(&context_, LZ4F_VERSION);
+    if (LZ4F_isError(result)) return errors::Internal("Failed to initialize LZ4: ", LZ4F_getErrorName(result));
+    return Status::OK();
+  }
+
+  Status Decode(StringPiece input, string* output) override {
+    const char* source = input.data();
+    size_t remaining = input.size();
+    bool output_full;
+    do {
+      const size_t start = output->size();
+      output->resize(start + kLz4OutputBytes);
+      size_t destination_size = kLz4OutputBytes;
+      size_t source_size = remaining;
+      const size_t result =
+          LZ4F_decompress(context_, &(*output)[start], &destination_size, source, &source_size, nullptr);
+      output->resize(start + destination_size);
+      if (LZ4F_isError(result)) return errors::DataLoss("Failed to decompress LZ4 data: ", LZ4F_getErrorName(result));
+      source += source_size;
+      remaining -= source_size;
+      hint_ = result;
+      output_full = destination_size == kLz4OutputBytes;
+      if (source_size == 0 && destination_size == 0) break;
+    } while (remaining > 0 || output_full);
+    return Status::OK();
+  }
+
+  // LZ4 returns a zero hint once a frame has been fully decoded.
+  bool AtFrameBoundary() const override { return hint_ == 0; }
+
+ private:
+  LZ4F_dctx* context_ = nullptr;
+  size_t hint_ = 0;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(Lz4Decoder);
+};
+
+class Lz4Codec : public Codec {
+ public:
+  // LZ4 does not provide a function that finds the size of a frame, and so the frame and block headers are parsed
+  // here (see the LZ4 frame format description).
+  Status FrameSize(StringPiece data, size_t* size) const override {
+    *size = 0;
+    if (data.size() < 4) return Status::OK();
+    const uint32 magic = core::DecodeFixed32(data.data());
+    if ((magic & kLz4SkippableMagicMask) == kLz4SkippableMagic) {
+      if (data.size() < 8) return Status::OK();
+      const size_t frame_size = 8 + static_cast<size_t>(core::DecodeFixed32(data.data() + 4));
+      if (frame_size <= data.size()) *size = frame_size;
+      return Status::OK();
+    }
+    if (magic != kLz4Magic) return errors::DataLoss("Invalid LZ4 frame magic number: ", magic, ".");
+    // The frame header consists of the magic number, the frame descriptor, and the header checksum.
+    if (data.size() < 7) return Status::OK();
+    const uint8 flags = static_cast<uint8>(data[4]);
+    const bool block_checksums = (flags & 0x10) != 0;
+    const bool content_checksum = (flags & 0x04) != 0;
+    size_t position = 7 + ((flags & 0x08) != 0 ? 8 : 0) + ((flags & 0x01) != 0 ? 4 : 0);
+    while (true) {
+      if (position + 4 > data.size()) return Status::OK();
+      const uint32 block_size = core::DecodeFixed32(data.data() + position);
+      position += 4;
+      // The end mark is a zero block size.
+      if (block_size == 0) break;
+      position += (block_size & 0x7FFFFFFF) + (block_checksums ? 4 : 0);
+    }
+    position += content_checksum ? 4 : 0;
+    if (position <= data.size()) *size = position;
+    return Status::OK();
+  }
+
+  Status NewDecoder(std::unique_ptr<StreamDecoder>* decoder) const override {
+    std::unique_ptr<Lz4Decoder> lz4_decoder(new Lz4Decoder());
+    TF_RETURN_IF_ERROR(lz4_decoder->Init());
+    decoder->reset(lz4_decoder.release());
+    return Status::OK();
+  }
+
+  Status Compress(StringPiece input, string* output) const override {
+    LZ4F_preferences_t preferences;
+    memset(&preferences, 0, sizeof(preferences));
+    preferences.frameInfo.contentSize = input.size();
+    output->resize(LZ4F_compressFrameBound(input.size(), &preferences));
+    const size_t result =
+        LZ4F_compressFrame(&(*output)[0], output->size(), input.data(), input.size(), &preferences);
+    if (LZ4F_isError(result)) return errors::Internal("Failed to compress LZ4 data: ", LZ4F_getErrorName(result));
+    output->resize(result);
+    return Status::OK();
+  }
+};
+
+#endif  // TENSORFLOW_WITH_LZ4
+
+Status GetCodec(const string& compression_type, const Codec** codec) {
+  if (compression_type == kZstdCompression) {
+#if defined(TENSORFLOW_WITH_ZSTD)
+    static const Codec* zstd_codec = new ZstdCodec();
+    *codec = zstd_codec;
+    return Status::OK();
+#else
+    return errors::Unimplemented(
+        "The JNI library was built without ZSTD support (see the 'TENSORFLOW_WITH_ZSTD' CMake option).");
+#endif
+  }
+  if (compression_type == kLz4Compression) {
+#if defined(TENSORFLOW_WITH_LZ4)
+    static const Codec* lz4_codec = new Lz4Codec();
+    *codec = lz4_codec;
+    return Status::OK();
+#else
+    return errors::Unimplemented(
+        "The JNI library was built without LZ4 support (see the 'TENSORFLOW_WITH_LZ4' CMake option).");
+#endif
+  }
+  return errors::InvalidArgument("Unsupported frame compression type '", compression_type, "'.");
+}
+
+// Decompresses a frame compressed file ahead of the reads. A decoding thread reads the compressed file sequentially and
+// splits it into frames, which are decompressed on a thread pool into a bounded sequence of chunks, in file order.
+class StreamReader {
+ public:
+  StreamReader(const Codec* codec, RandomAccessFile* file)
+      : codec_(codec), file_(file), max_pending_chunks_(2 * NumCompressionThreads()),
+        pool_(new thread::ThreadPool(Env::Default(), "tf_scala_record_decompress", NumCompressionThreads())) {}
+
+  ~StreamReader() {
+    Stop();
+    // Waits for the frames that are being decompressed.
+    pool_.reset();
+  }
+
+  Status Read(uint64 offset, size_t n, StringPiece* result, char* scratch) {
+    mutex_lock l(read_mu_);
+    const uint64 window_start = history_.empty() ? decoded_end_ : history_.front().first;
+    if (thread_ == nullptr || failed_ || offset < window_start) Restart();
+    size_t copied = 0;
+    Status s;
+    while (copied < n) {
+      const uint64 position = offset + copied;
+      if (position >= decoded_end_) {
+        if (end_of_stream_) break;
+        std::shared_ptr<Chunk> chunk;
+        s = Next(&chunk);
+        if (errors::IsOutOfRange(s)) {
+          end_of_stream_ = true;
+          s = Status::OK();
+          continue;
+        }
+        if (!s.ok()) {
+          failed_ = true;
+          break;
+        }
+        history_.emplace_back(decoded_end_, chunk);
+        decoded_end_ += chunk->data.size();
+        while (history_.size() > 1 &&
+               history_.front().first + history_.front().second->data.size() + kHistoryBytes <= position)
+          history_.pop_front();
+        continue;
+      }
+      for (const auto& entry : history_) {
+        const uint64 chunk_end = entry.first + entry.second->data.size();
+        if (position >= entry.first && position < chunk_end) {
+          const size_t count = static_cast<size_t>(std::min<uint64>(n - copied, chunk_end - position));
+          memcpy(scratch + copied, entry.second->data.data() + (position - entry.first), count);
+          copied += count;
+          break;
+        }
+      }
+    }
+    *result = StringPiece(scratch, copied);
+    if (!s.ok()) return s;
+    if (copied < n) return errors::OutOfRange("Read less bytes than requested.");
+    return Status::OK();
+  }
+
+ private:
+  struct Chunk {
+    bool done = false;
+    Status status;
+    string data;
+  };
+
+  // Stops the decoding thread and restarts the decompression from the start of the file.
+  void Restart() {
+    Stop();
+    {
+      mutex_lock l(mu_);
+      pending_.clear();
+      finished_ = false;
+      cancelled_ = false;
+    }
+    history_.clear();
+    decoded_end_ = 0;
+    end_of_stream_ = false;
+    failed_ = false;
+    thread_.reset(Env::Default()->StartThread(ThreadOptions(), "tf_scala_record_decode", [this]() { DecodeLoop(); }));
+  }
+
+  void Stop() {
+    {
+      mutex_lock l(mu_);
+      cancelled_ = true;
+    }
+    cv_.notify_all();
+    // Joins the decoding thread.
+    thread_.reset();
+  }
+
+  // Waits for the next chunk to be decompressed and returns its status, or returns an "OutOfRange" error once all
+  // chunks have been returned.
+  Status Next(std::shared_ptr<Chunk>* chunk) {
+    mutex_lock l(mu_);
+    while (!(!pending_.empty() && pending_.front()->done) && !(pending_.empty() && finished_))
+      cv_.wait(l);
+    if (pending_.empty()) return errors::OutOfRange("Reached the end of the decompressed stream.");
+    *chunk = std::move(pending_.front());
+    pending_.pop_front();
+    cv_.notify_all();
+    return (*chunk)->status;
+  }
+
+  // Appends "chunk" to the pending chunks, waiting for space. Returns "false" if the decoding thread is cancelled.
+  bool Push(const std::shared_ptr<Chunk>& chunk) {
+    mutex_lock l(mu_);
+    while (!cancelled_ && static_cast<int>(pending_.size()) >= max_pending_chunks_)
+      cv_.wait(l);
+    if (cancelled_) return false;
+    pending_.push_back(chunk);
+    cv_.notify_all();
+    return true;
+  }
+
+  void Finish(const Status& status) {
+    if (!status.ok()) {
+      std::shared_ptr<Chunk> chunk(new Chunk());
+      chunk->status = status;
+      chunk->done = true;
+      if (!Push(chunk)) return;
+    }
+    mutex_lock l(mu_);
+    finished_ = true;
+    cv_.notify_all();
+  }
+
+  void DecodeFrame(const std::shared_ptr<string>& frame, const std::shared_ptr<Chunk>& chunk) {
+    std::unique_ptr<StreamDecoder> decoder;
+    Status s = codec_->NewDecoder(&decoder);
+    string data;
+    if (s.ok()) s = decoder->Decode(*frame, &data);
+    if (s.ok() && !decoder->AtFrameBoundary()) s = errors::DataLoss("Truncated compressed frame.");
+    {
+      mutex_lock l(mu_);
+      chunk->data = std::move(data);
+      chunk->status = s;
+      chunk->done = true;
+    }
+    cv_.notify_all();
+  }
+
+  void DecodeLoop() {
+    std::unique_ptr<char[]> scratch(new char[kReadBytes]);
+    uint64 compressed_offset = 0;
+    string buffer;
+    bool end_of_file = false;
+    // Set once the frames become too large to be delimited, after which the rest of the file is decoded as a stream.
+    std::unique_ptr<StreamDecoder> stream_decoder;
+    while (true) {
+      Status s;
+      if (stream_decoder == nullptr) {
+        size_t frame_size = 0;
+        s = codec_->FrameSize(buffer, &frame_size);
+        if (s.ok() && frame_size > 0) {
+          std::shared_ptr<Chunk> chunk(new Chunk());
+          if (!Push(chunk)) return;
+          std::shared_ptr<string> frame(new string(buffer, 0, frame_size));
+          buffer.erase(0, frame_size);
+          pool_->Schedule([this, frame, chunk]() { DecodeFrame(frame, chunk); });
+          continue;
+        }
+        if (s.ok() && !end_of_file && buffer.size() >= kMaxFrameBytes) s = codec_->NewDecoder(&stream_decoder);
+      }
+      if (s.ok() && stream_decoder != nullptr && !buffer.empty()) {
+        std::shared_ptr<Chunk> chunk(new Chunk());
+        s = stream_decoder->Decode(buffer, &chunk->data);
+        buffer.clear();
+        chunk->done = true;
+        if (s.ok() && !Push(chunk)) return;
+      }
+      if (s.ok() && end_of_file) {
+        const bool truncated = stream_decoder != nullptr ? !stream_decoder->AtFrameBoundary() : !buffer.empty();
+        if (!truncated) {
+          Finish(Status::OK());
+          return;
+        }
+        s = errors::DataLoss("The compressed file is truncated.");
+      }
+      if (s.ok()) {
+        StringPiece data;
+        s = file_->Read(compressed_offset, kReadBytes, &data, scratch.get());
+        if (errors::IsOutOfRange(s) || (s.ok() && data.empty())) {
+          end_of_file = true;
+          s = Status::OK();
+        }
+        buffer.append(data.data(), data.size());
+        compressed_offset += data.size();
+      }
+      if (!s.ok()) {
+        Finish(s);
+        return;
+      }
+    }
+  }
+
+  const Codec* const codec_;
+  RandomAccessFile* const file_;
+  const int max_pending_chunks_;
+
+  mutex mu_;
+  condition_variable cv_;
+  std::deque<std::shared_ptr<Chunk>> pending_ GUARDED_BY(mu_);
+  bool finished_ GUARDED_BY(mu_) = false;
+  bool cancelled_ GUARDED_BY(mu_) = false;
+
+  // Serializes the reads, and guards the read state below.
+  mutex read_mu_;
+  // Recently returned chunks, along with their offsets in the decompressed file.
+  std::deque<std::pair<uint64, std::shared_ptr<Chunk>>> history_;
+  uint64 decoded_end_ = 0;
+  bool end_of_stream_ = false;
+  bool failed_ = false;
+
+  std::unique_ptr<thread::ThreadPool> pool_;
+  std::unique_ptr<Thread> thread_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(StreamReader);
+};
+
+class DecompressingRandomAccessFile : public RandomAccessFile {
+ public:
+  DecompressingRandomAccessFile(const Codec* codec, std::unique_ptr<RandomAccessFile>&& file)
+      : file_(std::move(file)), reader_(new StreamReader(codec, file_.get())) {}
+
+  ~DecompressingRandomAccessFile() override {
+    // The reader must be destroyed before the file that it reads.
+    reader_.reset();
+  }
+
+  Status Read(uint64 offset, size_t n, StringPiece* result, char* scratch) const override {
+    return reader_->Read(offset, n, result, scratch);
+  }
+
+ private:
+  std::unique_ptr<RandomAccessFile> file_;
+  std::unique_ptr<StreamReader> reader_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(DecompressingRandomAccessFile);
+};
+
+// Compresses every "kFrameBytes" appended bytes into a separate frame, on a thread pool, and appends the compressed
+// frames to the underlying file, in order. Errors are sticky and are reported by all subsequent calls.
+class CompressingWritableFile : public WritableFile {
+ public:
+  CompressingWritableFile(const Codec* codec, std::unique_ptr<WritableFile>&& file)
+      : codec_(codec), file_(std::move(file)), max_pending_frames_(2 * NumCompressionThreads()),
+        pool_(new thread::ThreadPool(Env::Default(), "tf_scala_record_compress", NumCompressionThreads())) {}
+
+  ~CompressingWritableFile() override {
+    // Waits for the frames that are being compressed.
+    pool_.reset();
+  }
+
+  Status Append(const StringPiece& data) override {
+    TF_RETURN_IF_ERROR(status_);
+    StringPiece remaining = data;
+    while (!remaining.empty()) {
+      const size_t count = std::min(remaining.size(), kFrameBytes - buffer_.size());
+      buffer_.append(remaining.data(), count);
+      remaining.remove_prefix(count);
+      if (buffer_.size() == kFrameBytes) CompressBuffer();
+    }
+    return WriteCompressedFrames(false);
+  }
+
+  Status Flush() override {
+    TF_RETURN_IF_ERROR(status_);
+    CompressBuffer();
+    TF_RETURN_IF_ERROR(WriteCompressedFrames(true));
+    return file_->Flush();
+  }
+
+  Status Sync() override {
+    TF_RETURN_IF_ERROR(Flush());
+    return file_->Sync();
+  }
+
+  Status Close() override {
+    Status s = status_;
+    if (s.ok()) {
+      CompressBuffer();
+      s = WriteCompressedFrames(true);
+    }
+    Status close_status = file_->Close();
+    return s.ok() ? close_status : s;
+  }
+
+ private:
+  struct Frame {
+    bool done = false;
+    Status status;
+    string data;
+  };
+
+  // Schedules the compression of the buffered data into a new frame.
+  void CompressBuffer() {
+    if (buffer_.empty()) return;
+    std::shared_ptr<string> input(new string());
+    input->swap(buffer_);
+    buffer_.reserve(kFrameBytes);
+    std::shared_ptr<Frame> frame(new Frame());
+    {
+      mutex_lock l(mu_);
+      frames_.push_back(frame);
+    }
+    pool_->Schedule([this, input, frame]() {
+      string data;
+      Status s = codec_->Compress(*input, &data);
+      {
+        mutex_lock l(mu_);
+        frame->data = std::move(data);
+        frame->status = s;
+        frame->done = true;
+      }
+      cv_.notify_all();
+    });
+  }
+
+  // Appends the compressed frames to the file, in order. If "all" is true, this waits for all frames to be compressed.
+  // Otherwise, it only waits while too many frames are being compressed.
+  Status WriteCompressedFrames(bool all) {
+    while (true) {
+      std::shared_ptr<Frame> frame;
+      {
+        mutex_lock l(mu_);
+        if (frames_.empty()) return Status::OK();
+        const bool wait = all || static_cast<int>(frames_.size()) > max_pending_frames_;
+        while (wait && !frames_.front()->done)
+          cv_.wait(l);
+        if (!frames_.front()->done) return Status::OK();
+        frame = std::move(frames_.front());
+        frames_.pop_front();
+      }
+      status_ = frame->status;
+      if (status_.ok()) status_ = file_->Append(frame->data);
+      TF_RETURN_IF_ERROR(status_);
+    }
+  }
+
+  const Codec* const codec_;
+  std::unique_ptr<WritableFile> file_;
+  const int max_pending_frames_;
+  string buffer_;
+  Status status_;
+
+  mutex mu_;
+  condition_variable cv_;
+  std::deque<std::shared_ptr<Frame>> frames_ GUARDED_BY(mu_);
+
+  std::unique_ptr<thread::ThreadPool> pool_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(CompressingWritableFile);
+};
+
+}  // namespace
+
+bool IsFrameCompressionType(const string& compression_type) {
+  return compression_type == kZstdCompression || compression_type == kLz4Compression;
+}
+
+RecordReaderOptions CreateRecordReaderOptions(const string& compression_type) {
+  return RecordReaderOptions::CreateRecordReaderOptions(
+      IsFrameCompressionType(compression_type) ? "" : compression_type);
+}
+
+RecordWriterOptions CreateRecordWriterOptions(const string& compression_type) {
+  return RecordWriterOptions::CreateRecordWriterOptions(
+      IsFrameCompressionType(compression_type) ? "" : compression_type);
+}
+
+Status WrapDecompressingFile(const string& compression_type, std::unique_ptr<RandomAccessFile>* file) {
+  if (!IsFrameCompressionType(compression_type)) return Status::OK();
+  const Codec* codec;
+  TF_RETURN_IF_ERROR(GetCodec(compression_type, &codec));
+  file->reset(new DecompressingRandomAccessFile(codec, std::move(*file)));
+  return Status::OK();
+}
+
+Status WrapCompressingFile(const string& compression_type, std::unique_ptr<WritableFile>* file) {
+  if (!IsFrameCompressionType(compression_type)) return Status::OK();
+  const Codec* codec;
+  TF_RETURN_IF_ERROR(GetCodec(compression_type, &codec));
+  file->reset(new CompressingWritableFile(codec, std::move(*file)));
+  return Status::OK();
+}
+
+}  // namespace io
+}  // namespace tensorflow
@@ -0,0 +1,63 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_RECORD_COMPRESSION_H_
+#define TENSORFLOW_C_RECORD_COMPRESSION_H_
+
+#include <memory>
+
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/io/record_reader.h"
+#include "tensorflow/core/lib/io/record_writer.h"
+#include "tensorflow/core/platform/file_system.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+namespace io {
+
+// Compression types of record files that are supported by the JNI record readers and writers, in addition to those
+// supported by TensorFlow (i.e., "", "ZLIB", and "GZIP"). Files compressed with them consist of a sequence of standard
+// ZSTD or LZ4 frames (and so they can also be decompressed by the command line tools) that contain the uncompressed
+// record file. The writers compress every 4 MiB of records into a separate frame, on a thread pool, and the readers
+// decompress the frames of a file in parallel, on a thread pool, ahead of the records being read. Frames that are too
+// large to be decompressed in parallel (e.g., files compressed into a single frame by the command line tools) are
+// decompressed sequentially. Record offsets refer to the uncompressed file, as is the case for "ZLIB" and "GZIP".
+//
+// Support for these types requires the JNI library to be built with the "TENSORFLOW_WITH_ZSTD" and the
+// "TENSORFLOW_WITH_LZ4" CMake options, and the readers and writers fail with an "Unimplemented" error otherwise.
+extern const char kZstdCompression[];
+extern const char kLz4Compression[];
+
+// Returns "true" if "compression_type" is one of the frame compression types above.
+bool IsFrameCompressionType(const string& compression_type);
+
+// Returns the options of the TensorFlow record readers and writers for "compression_type", which disable compression
+// for the frame compression types, since the files themselves are then wrapped using the functions below.
+RecordReaderOptions CreateRecordReaderOptions(const string& compression_type);
+RecordWriterOptions CreateRecordWriterOptions(const string& compression_type);
+
+// If "compression_type" is a frame compression type, replaces "*file" with a file that owns it and that returns its
+// decompressed contents. The returned file is optimized for sequential reads, and reading from earlier offsets than
+// those recently read restarts the decompression from the start of the file. Otherwise, "*file" is left unchanged.
+Status WrapDecompressingFile(const string& compression_type, std::unique_ptr<RandomAccessFile>* file);
+
+// If "compression_type" is a frame compression type, replaces "*file" with a file that owns it and that compresses
+// the data appended to it. Flushing the returned file ends the current frame. Otherwise, "*file" is left unchanged.
+Status WrapCompressingFile(const string& compression_type, std::unique_ptr<WritableFile>* file);
+
+}  // namespace io
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_RECORD_COMPRESSION_H_
@@ -0,0 +1,340 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/record_decoder.h"
+
+#include <string.h>
+
+#include <memory>
+
+#include "tensorflow/c/block_cache.h"
+
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/io/random_inputstream.h"
+#include "tensorflow/core/lib/io/zlib_compression_options.h"
+#include "tensorflow/core/lib/io/zlib_inputstream.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace io {
+
+namespace {
+
+constexpr int64 kTarBlockBytes = 512;
+// Approximate number of bytes that are read from the file at once.
+constexpr int64 kChunkBytes = 4 << 20;
+constexpr size_t kZlibBufferBytes = 256 << 10;
+
+// Precomputed information used to decode a single field.
+struct FieldDecoder {
+  const FixedLengthRecordField* field;
+  TensorShape decoded_shape;
+  int64 num_elements;
+  // Stride, in the decoded field, of each dimension of the stored field.
+  std::vector<int64> decoded_strides;
+  bool identity;
+};
+
+Status NewFieldDecoder(const FixedLengthRecordField& field, int64 record_bytes,
+                       FieldDecoder* decoder) {
+  if (field.dtype != DT_UINT8 && field.dtype != DT_FLOAT) {
+    return errors::InvalidArgument("Records cannot be decoded as ",
+                                   DataTypeString(field.dtype), ".");
+  }
+  if (field.dtype == DT_UINT8 && field.scale != 1.0f) {
+    return errors::InvalidArgument(
+        "The scale of fields decoded as uint8 must be 1.");
+  }
+  const int rank = static_cast<int>(field.shape.size());
+  if (!field.permutation.empty() &&
+      static_cast<int>(field.permutation.size()) != rank) {
+    return errors::InvalidArgument("The field permutation has ",
+                                   field.permutation.size(),
+                                   " elements, but the field has rank ", rank,
+                                   ".");
+  }
+  decoder->field = &field;
+  decoder->num_elements = 1;
+  for (int64 size : field.shape) {
+    if (size < 0) {
+      return errors::InvalidArgument("Field sizes must be non-negative.");
+    }
+    decoder->num_elements *= size;
+  }
+  if (field.offset < 0 || field.offset + decoder->num_elements > record_bytes) {
+    return errors::InvalidArgument("The field at offset ", field.offset,
+                                   " with ", decoder->num_elements,
+                                   " elements does not fit in records of ",
+                                   record_bytes, " bytes.");
+  }
+  std::vector<int> permutation(field.permutation);
+  if (permutation.empty()) {
+    for (int i = 0; i < rank; ++i) permutation.push_back(i);
+  }
+  std::vector<bool> seen(rank, false);
+  decoder->identity = true;
+  for (int i = 0; i < rank; ++i) {
+    const int p = permutation[i];
+    if (p < 0 || p >= rank || seen[p]) {
+      return errors::InvalidArgument("Invalid field permutation.");
+    }
+    seen[p] = true;
+    decoder->identity = decoder->identity && p == i;
+    decoder->decoded_shape.AddDim(field.shape[p]);
+  }
+  decoder->decoded_strides.assign(rank, 1);
+  int64 stride = 1;
+  for (int i = rank - 1; i >= 0; --i) {
+    decoder->decoded_strides[permutation[i]] = stride;
+    stride *= field.shape[permutation[i]];
+  }
+  return Status::OK();
+}
+
+inline uint8 DecodeByte(uint8 value, float scale, uint8 shift, uint8*) {
+  return static_cast<uint8>(value + shift);
+}
+
+inline float DecodeByte(uint8 value, float scale, float shift, float*) {
+  return static_cast<float>(value) * scale + shift;
+}
+
+// Decodes the field of a single record starting at "data" into "output".
+template <typename T, typename S>
+void DecodeField(const FieldDecoder& decoder, const uint8* data, S shift,
+                 T* output) {
+  const float scale = decoder.field->scale;
+  if (decoder.identity) {
+    // This loop is simple enough to be vectorized by the compiler.
+    for (int64 i = 0; i < decoder.num_elements; ++i) {
+      output[i] = DecodeByte(data[i], scale, shift, output);
+    }
+    return;
+  }
+  // The stored elements are visited in order, while keeping track of their
+  // offset in the decoded field.
+  const std::vector<int64>& shape = decoder.field->shape;
+  const int rank = static_cast<int>(shape.size());
+  std::vector<int64> index(rank, 0);
+  int64 offset = 0;
+  const int64 inner_size = shape[rank - 1];
+  const int64 inner_stride = decoder.decoded_strides[rank - 1];
+  for (int64 i = 0; i < decoder.num_elements; i += inner_size) {
+    const uint8* row = data + i;
+    for (int64 j = 0; j < inner_size; ++j) {
+      output[offset + j * inner_stride] = DecodeByte(row[j], scale, shift, output);
+    }
+    for (int d = rank - 2; d >= 0; --d) {
+      offset += decoder.decoded_strides[d];
+      if (++index[d] < shape[d]) break;
+      offset -= decoder.decoded_strides[d] * shape[d];
+      index[d] = 0;
+    }
+  }
+}
+
+// Reads "num_records" records from "input" and decodes them into "outputs".
+Status DecodeRecords(InputStreamInterface* input, int64 num_records,
+                     int64 record_bytes,
+                     const std::vector<FieldDecoder>& decoders,
+                     std::vector<Tensor>* outputs) {
+  outputs->clear();
+  for (const FieldDecoder& decoder : decoders) {
+    TensorShape shape({num_records});
+    shape.AppendShape(decoder.decoded_shape);
+    outputs->emplace_back(decoder.field->dtype, shape);
+  }
+  const int64 records_per_chunk = std::max(kChunkBytes / record_bytes, int64{1});
+  string chunk;
+  for (int64 r = 0; r < num_records; r += records_per_chunk) {
+    const int64 n = std::min(records_per_chunk, num_records - r);
+    TF_RETURN_IF_ERROR(input->ReadNBytes(n * record_bytes, &chunk));
+    const uint8* data = reinterpret_cast<const uint8*>(chunk.data());
+    for (size_t f = 0; f < decoders.size(); ++f) {
+      const FieldDecoder& decoder = decoders[f];
+      const uint8* field_data = data + decoder.field->offset;
+      if (decoder.field->dtype == DT_UINT8) {
+        uint8* output = (*outputs)[f].flat<uint8>().data() + r * decoder.num_elements;
+        const uint8 shift = static_cast<uint8>(static_cast<int>(decoder.field->shift));
+        for (int64 i = 0; i < n; ++i) {
+          DecodeField(decoder, field_data + i * record_bytes, shift,
+                      output + i * decoder.num_elements);
+        }
+      } else {
+        float* output = (*outputs)[f].flat<float>().data() + r * decoder.num_elements;
+        for (int64 i = 0; i < n; ++i) {
+          DecodeField(decoder, field_data + i * record_bytes,
+                      decoder.field->shift, output + i * decoder.num_elements);
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+// Returns the number of records in a stream of "stream_bytes" bytes.
+Status NumRecords(const string& name, int64 stream_bytes, int64 header_bytes,
+                  int64 record_bytes, int64* num_records) {
+  if (stream_bytes < header_bytes ||
+      (stream_bytes - header_bytes) % record_bytes != 0) {
+    return errors::DataLoss("'", name, "' has ", stream_bytes,
+                            " bytes, which is not a header of ", header_bytes,
+                            " bytes followed by records of ", record_bytes,
+                            " bytes.");
+  }
+  *num_records = (stream_bytes - header_bytes) / record_bytes;
+  return Status::OK();
+}
+
+// Parses a null-terminated or full-width octal tar header field.
+int64 ParseOctal(const char* data, size_t length) {
+  int64 value = 0;
+  for (size_t i = 0; i < length && data[i] != '\0'; ++i) {
+    if (data[i] >= '0' && data[i] <= '7') value = value * 8 + (data[i] - '0');
+  }
+  return value;
+}
+
+bool EndsWith(const string& value, const string& suffix) {
+  return value.size() >= suffix.size() &&
+         value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+Status DecodeTarEntries(InputStreamInterface* input,
+                        const std::vector<string>& tar_entries,
+                        int64 header_bytes, int64 record_bytes,
+                        const std::vector<FieldDecoder>& decoders,
+                        std::vector<std::vector<Tensor>>* outputs) {
+  outputs->assign(tar_entries.size(), std::vector<Tensor>());
+  std::vector<bool> found(tar_entries.size(), false);
+  size_t num_found = 0;
+  string header;
+  string long_name;
+  while (num_found < tar_entries.size()) {
+    Status s = input->ReadNBytes(kTarBlockBytes, &header);
+    if (errors::IsOutOfRange(s)) break;
+    TF_RETURN_IF_ERROR(s);
+    // The archive ends with zero blocks.
+    if (header[0] == '\0') break;
+    string name = long_name.empty()
+                      ? string(header.data(), strnlen(header.data(), 100))
+                      : long_name;
+    long_name.clear();
+    if (memcmp(header.data() + 257, "ustar", 5) == 0 && header[345] != '\0') {
+      name = string(header.data() + 345, strnlen(header.data() + 345, 155)) + "/" + name;
+    }
+    const int64 size = ParseOctal(header.data() + 124, 12);
+    const int64 padded_size = (size + kTarBlockBytes - 1) / kTarBlockBytes * kTarBlockBytes;
+    const char type_flag = header[156];
+    if (type_flag == 'L') {
+      // GNU long name entries hold the name of the next entry.
+      TF_RETURN_IF_ERROR(input->ReadNBytes(size, &long_name));
+      long_name.resize(strnlen(long_name.data(), long_name.size()));
+      TF_RETURN_IF_ERROR(input->SkipNBytes(padded_size - size));
+      continue;
+    }
+    size_t index = tar_entries.size();
+    if (type_flag == '0' || type_flag == '\0') {
+      for (size_t i = 0; i < tar_entries.size(); ++i) {
+        if (!found[i] && EndsWith(name, tar_entries[i])) {
+          index = i;
+          break;
+        }
+      }
+    }
+    if (index == tar_entries.size()) {
+      TF_RETURN_IF_ERROR(input->SkipNBytes(padded_size));
+      continue;
+    }
+    int64 num_records;
+    TF_RETURN_IF_ERROR(NumRecords(name, size, header_bytes, record_bytes, &num_records));
+    TF_RETURN_IF_ERROR(input->SkipNBytes(header_bytes));
+    TF_RETURN_IF_ERROR(DecodeRecords(input, num_records, record_bytes, decoders,
+                                     &(*outputs)[index]));
+    TF_RETURN_IF_ERROR(input->SkipNBytes(padded_size - size));
+    found[index] = true;
+    ++num_found;
+  }
+  for (size_t i = 0; i < tar_entries.size(); ++i) {
+    if (!found[i]) {
+      return errors::NotFound("No entry named '", tar_entries[i],
+                              "' was found in the archive.");
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status DecodeFixedLengthRecords(
+    const string& filename, bool gzip, const std::vector<string>& tar_entries,
+    int64 header_bytes, int64 record_bytes,
+    const std::vector<FixedLengthRecordField>& fields,
+    std::vector<std::vector<Tensor>>* outputs) {
+  if (record_bytes <= 0 || header_bytes < 0) {
+    return errors::InvalidArgument(
+        "The record size must be positive and the header size must be "
+        "non-negative.");
+  }
+  std::vector<FieldDecoder> decoders(fields.size());
+  for (size_t i = 0; i < fields.size(); ++i) {
+    TF_RETURN_IF_ERROR(NewFieldDecoder(fields[i], record_bytes, &decoders[i]));
+  }
+  Env* env = Env::Default();
+  std::unique_ptr<RandomAccessFile> file;
+  TF_RETURN_IF_ERROR(NewCachedRandomAccessFile(filename, &file));
+  RandomAccessInputStream file_stream(file.get());
+  std::unique_ptr<ZlibInputStream> zlib_stream;
+  InputStreamInterface* input = &file_stream;
+  if (gzip) {
+    zlib_stream.reset(new ZlibInputStream(&file_stream, kZlibBufferBytes,
+                                          kZlibBufferBytes,
+                                          ZlibCompressionOptions::GZIP()));
+    input = zlib_stream.get();
+  }
+  if (!tar_entries.empty()) {
+    return DecodeTarEntries(input, tar_entries, header_bytes, record_bytes,
+                            decoders, outputs);
+  }
+
+  // The number of records follows from the size of the (uncompressed) file,
+  // which gzip stores, modulo 2^32, in its last four bytes.
+  uint64 file_size;
+  TF_RETURN_IF_ERROR(env->GetFileSize(filename, &file_size));
+  int64 stream_bytes = static_cast<int64>(file_size);
+  if (gzip) {
+    if (file_size < 4) {
+      return errors::DataLoss("'", filename, "' is not a gzip file.");
+    }
+    char scratch[4];
+    StringPiece trailer;
+    TF_RETURN_IF_ERROR(file->Read(file_size - 4, 4, &trailer, scratch));
+    const uint8* bytes = reinterpret_cast<const uint8*>(trailer.data());
+    stream_bytes = static_cast<int64>(bytes[0]) |
+                   (static_cast<int64>(bytes[1]) << 8) |
+                   (static_cast<int64>(bytes[2]) << 16) |
+                   (static_cast<int64>(bytes[3]) << 24);
+  }
+  int64 num_records;
+  TF_RETURN_IF_ERROR(NumRecords(filename, stream_bytes, header_bytes,
+                                record_bytes, &num_records));
+  outputs->assign(1, std::vector<Tensor>());
+  TF_RETURN_IF_ERROR(input->SkipNBytes(header_bytes));
+  return DecodeRecords(input, num_records, record_bytes, decoders,
+                       &(*outputs)[0]);
+}
+
+}  // namespace io
+}  // namespace tensorflow
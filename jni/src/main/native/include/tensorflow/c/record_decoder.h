@@ -0,0 +1,69 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LIB_IO_RECORD_DECODER_H_
+#define TENSORFLOW_LIB_IO_RECORD_DECODER_H_
+
+#include <vector>
+
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+namespace io {
+
+// A field of fixed-length records, consisting of the bytes of each record that
+// start at "offset" and hold a tensor (of unsigned bytes) with shape "shape",
+// in row-major order.
+struct FixedLengthRecordField {
+  int64 offset = 0;
+  std::vector<int64> shape;
+  // Permutation of the dimensions of "shape" in the decoded tensors (i.e.,
+  // dimension "i" of a decoded field is dimension "permutation[i]" of the
+  // stored one). Empty for the identity permutation.
+  std::vector<int> permutation;
+  // Data type of the decoded tensors, which must be DT_UINT8 or DT_FLOAT.
+  // Bytes are decoded as "byte * scale + shift". For DT_UINT8, "scale" must
+  // be 1 and "shift" is added modulo 256.
+  DataType dtype = DT_UINT8;
+  float scale = 1.0f;
+  float shift = 0.0f;
+};
+
+// Decodes the fixed-length records stored in "filename", after skipping its
+// first "header_bytes" bytes, into tensors with shape "[num_records] ++
+// permuted field shape", one for each field in "fields", and stores them in
+// "outputs". The file is streamed in chunks and the records are decoded
+// directly into the output tensors, which are allocated once. If "gzip" is
+// true, the file is decompressed while it is being streamed.
+//
+// If "tar_entries" is not empty, the file is treated as a (possibly
+// compressed) tar archive and the records are decoded from the entries whose
+// names end with each of "tar_entries" instead, in a single pass over the
+// archive. In that case, "outputs" contains one vector of tensors (one for
+// each field) for each of "tar_entries", in the same order. Otherwise, it
+// contains a single vector of tensors.
+Status DecodeFixedLengthRecords(
+    const string& filename, bool gzip, const std::vector<string>& tar_entries,
+    int64 header_bytes, int64 record_bytes,
+    const std::vector<FixedLengthRecordField>& fields,
+    std::vector<std::vector<Tensor>>* outputs);
+
+}  // namespace io
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_LIB_IO_RECORD_DECODER_H_
@@ -15,9 +15,21 @@ limitations under the License.
 
 #include "tensorflow/c/record_reader.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "tensorflow/c/block_cache.h"
+#include "tensorflow/c/record_compression.h"
 #include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/coding.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/raw_coding.h"
 #include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/lib/core/threadpool.h"
+#include "tensorflow/core/lib/hash/crc32c.h"
+#include "tensorflow/core/lib/io/buffered_inputstream.h"
 #include "tensorflow/core/lib/io/record_reader.h"
+#include "tensorflow/core/lib/strings/strcat.h"
 #include "tensorflow/core/lib/io/zlib_compression_options.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/types.h"
@@ -34,17 +46,18 @@ RecordReaderWrapper* RecordReaderWrapper::New(const string& filename, uint64 sta
                                               const string& compression_type_string,
                                               TF_Status* out_status) {
   std::unique_ptr<RandomAccessFile> file;
-  Status s = Env::Default()->NewRandomAccessFile(filename, &file);
+  Status s = NewCachedRandomAccessFile(filename, &file);
+  if (s.ok()) s = WrapDecompressingFile(compression_type_string, &file);
   if (!s.ok()) {
     Set_TF_Status_from_Status(out_status, s);
     return nullptr;
   }
   RecordReaderWrapper* reader = new RecordReaderWrapper;
   reader->offset_ = start_offset;
+  reader->record_offset_ = start_offset;
   reader->file_ = file.release();
 
-  RecordReaderOptions options =
-      RecordReaderOptions::CreateRecordReaderOptions(compression_type_string);
+  RecordReaderOptions options = CreateRecordReaderOptions(compression_type_string);
 
   reader->reader_ = new RecordReader(reader->file_, options);
   return reader;
@@ -61,6 +74,7 @@ void RecordReaderWrapper::GetNext(TF_Status* status) {
                               errors::FailedPrecondition("Reader is closed."));
     return;
   }
+  record_offset_ = offset_;
   Status s = reader_->ReadRecord(&offset_, &record_);
   Set_TF_Status_from_Status(status, s);
 }
@@ -72,5 +86,425 @@ void RecordReaderWrapper::Close() {
   reader_ = nullptr;
 }
 
+PrefetchingRecordReaderWrapper::PrefetchingRecordReaderWrapper() {}
+
+PrefetchingRecordReaderWrapper* PrefetchingRecordReaderWrapper::New(
+    const string& filename, uint64 start_offset, const string& compression_type_string,
+    int64 max_buffered_records, int64 max_buffered_bytes, TF_Status* out_status) {
+  if (max_buffered_records <= 0 || max_buffered_bytes <= 0) {
+    Set_TF_Status_from_Status(
+        out_status, errors::InvalidArgument("The read-ahead limits must be positive."));
+    return nullptr;
+  }
+  std::unique_ptr<RandomAccessFile> file;
+  Status s = NewCachedRandomAccessFile(filename, &file);
+  if (s.ok()) s = WrapDecompressingFile(compression_type_string, &file);
+  if (!s.ok()) {
+    Set_TF_Status_from_Status(out_status, s);
+    return nullptr;
+  }
+  PrefetchingRecordReaderWrapper* reader = new PrefetchingRecordReaderWrapper;
+  reader->file_ = file.release();
+  reader->reader_ = new RecordReader(reader->file_, CreateRecordReaderOptions(compression_type_string));
+  reader->max_buffered_records_ = max_buffered_records;
+  reader->max_buffered_bytes_ = max_buffered_bytes;
+  reader->offset_ = start_offset;
+  reader->record_offset_ = start_offset;
+  reader->read_offset_ = start_offset;
+  reader->thread_.reset(Env::Default()->StartThread(
+      ThreadOptions(), "tf_scala_record_prefetch", [reader]() { reader->ReadLoop(); }));
+  return reader;
+}
+
+PrefetchingRecordReaderWrapper::~PrefetchingRecordReaderWrapper() {
+  {
+    mutex_lock l(mu_);
+    cancelled_ = true;
+  }
+  space_available_.notify_all();
+  // Joins the I/O thread.
+  thread_.reset();
+  delete reader_;
+  delete file_;
+}
+
+void PrefetchingRecordReaderWrapper::ReadLoop() {
+  while (true) {
+    uint64 offset;
+    {
+      mutex_lock l(mu_);
+      // Wait until there is space in the buffer and no failed read is pending.
+      while (!cancelled_ && (!read_status_.ok() || static_cast<int64>(buffer_.size()) >= max_buffered_records_ ||
+                             buffered_bytes_ >= max_buffered_bytes_))
+        space_available_.wait(l);
+      if (cancelled_) return;
+      offset = read_offset_;
+    }
+    // The file is read without holding the lock, so that the consumer can keep draining the buffer. The offset is
+    // only advanced by successful reads.
+    string record;
+    Status s = reader_->ReadRecord(&offset, &record);
+    {
+      mutex_lock l(mu_);
+      if (s.ok()) {
+        buffered_bytes_ += record.size();
+        buffer_.emplace_back(std::move(record), offset);
+        read_offset_ = offset;
+      } else {
+        read_status_ = s;
+      }
+    }
+    records_available_.notify_one();
+  }
+}
+
+void PrefetchingRecordReaderWrapper::GetNext(TF_Status* status) {
+  mutex_lock l(mu_);
+  if (buffer_.empty() && read_status_.ok()) {
+    const uint64 start_micros = Env::Default()->NowMicros();
+    while (buffer_.empty() && read_status_.ok())
+      records_available_.wait(l);
+    stall_time_micros_ += Env::Default()->NowMicros() - start_micros;
+  }
+  if (!buffer_.empty()) {
+    record_offset_ = offset_;
+    record_ = std::move(buffer_.front().first);
+    offset_ = buffer_.front().second;
+    buffered_bytes_ -= record_.size();
+    buffer_.pop_front();
+    Set_TF_Status_from_Status(status, Status::OK());
+  } else {
+    // Report the failed read and let the I/O thread retry it.
+    Set_TF_Status_from_Status(status, read_status_);
+    read_status_ = Status::OK();
+  }
+  space_available_.notify_one();
+}
+
+void PrefetchingRecordReaderWrapper::Unread() {
+  mutex_lock l(mu_);
+  buffered_bytes_ += record_.size();
+  buffer_.emplace_front(std::move(record_), offset_);
+  record_.clear();
+  offset_ = record_offset_;
+}
+
+int64 PrefetchingRecordReaderWrapper::stall_time_micros() const {
+  mutex_lock l(mu_);
+  return stall_time_micros_;
+}
+
+int64 PrefetchingRecordReaderWrapper::buffered_records() const {
+  mutex_lock l(mu_);
+  return static_cast<int64>(buffer_.size());
+}
+
+int64 PrefetchingRecordReaderWrapper::buffered_bytes() const {
+  mutex_lock l(mu_);
+  return buffered_bytes_;
+}
+
+InterleavedRecordReaderWrapper::InterleavedRecordReaderWrapper() {}
+
+InterleavedRecordReaderWrapper* InterleavedRecordReaderWrapper::New(
+    const std::vector<string>& file_patterns, const string& compression_type_string,
+    int cycle_length, bool deterministic, int64 max_buffered_records_per_file,
+    TF_Status* out_status) {
+  if (cycle_length <= 0 || max_buffered_records_per_file <= 0) {
+    Set_TF_Status_from_Status(
+        out_status, errors::InvalidArgument("The cycle length and the read-ahead limit must be positive."));
+    return nullptr;
+  }
+  std::vector<string> filenames;
+  for (const string& file_pattern : file_patterns) {
+    std::vector<string> matching_filenames;
+    Status s = Env::Default()->GetMatchingPaths(file_pattern, &matching_filenames);
+    if (!s.ok()) {
+      Set_TF_Status_from_Status(out_status, s);
+      return nullptr;
+    }
+    std::sort(matching_filenames.begin(), matching_filenames.end());
+    filenames.insert(filenames.end(), matching_filenames.begin(), matching_filenames.end());
+  }
+  InterleavedRecordReaderWrapper* reader = new InterleavedRecordReaderWrapper;
+  reader->filenames_ = std::move(filenames);
+  reader->compression_type_string_ = compression_type_string;
+  reader->deterministic_ = deterministic;
+  reader->max_buffered_records_per_file_ = max_buffered_records_per_file;
+  const int num_slots = static_cast<int>(
+      std::max<size_t>(1, std::min(static_cast<size_t>(cycle_length), reader->filenames_.size())));
+  reader->slots_.resize(static_cast<size_t>(num_slots));
+  reader->thread_pool_.reset(new thread::ThreadPool(Env::Default(), "tf_scala_record_interleave", num_slots));
+  for (int i = 0; i < num_slots; ++i)
+    reader->thread_pool_->Schedule([reader, i]() { reader->ReadSlot(i); });
+  return reader;
+}
+
+InterleavedRecordReaderWrapper::~InterleavedRecordReaderWrapper() {
+  {
+    mutex_lock l(mu_);
+    cancelled_ = true;
+  }
+  space_available_.notify_all();
+  // Waits for the slot tasks to complete.
+  thread_pool_.reset();
+}
+
+void InterleavedRecordReaderWrapper::ReadSlot(int slot_index) {
+  const size_t num_slots = slots_.size();
+  for (size_t file_index = slot_index; file_index < filenames_.size(); file_index += num_slots) {
+    std::unique_ptr<RandomAccessFile> file;
+    Status s = NewCachedRandomAccessFile(filenames_[file_index], &file);
+    if (s.ok()) s = WrapDecompressingFile(compression_type_string_, &file);
+    if (s.ok()) {
+      RecordReader reader(file.get(), CreateRecordReaderOptions(compression_type_string_));
+      uint64 offset = 0;
+      while (true) {
+        {
+          mutex_lock l(mu_);
+          Slot& slot = slots_[slot_index];
+          while (!cancelled_ && static_cast<int64>(slot.buffer.size()) >= max_buffered_records_per_file_)
+            space_available_.wait(l);
+          if (cancelled_) return;
+        }
+        // The file is read without holding the lock, so that the other slots and the consumer can make progress.
+        string record;
+        s = reader.ReadRecord(&offset, &record);
+        if (!s.ok()) break;
+        {
+          mutex_lock l(mu_);
+          slots_[slot_index].buffer.emplace_back(Status::OK(), std::move(record));
+        }
+        records_available_.notify_all();
+      }
+    }
+    if (!s.ok() && !errors::IsOutOfRange(s)) {
+      mutex_lock l(mu_);
+      slots_[slot_index].buffer.emplace_back(
+          Status(s.code(), strings::StrCat("Failed to read '", filenames_[file_index], "': ", s.error_message())),
+          string());
+    }
+  }
+  {
+    mutex_lock l(mu_);
+    slots_[slot_index].done = true;
+  }
+  records_available_.notify_all();
+}
+
+int InterleavedRecordReaderWrapper::NextReadySlot(bool* all_done) {
+  const int num_slots = static_cast<int>(slots_.size());
+  *all_done = true;
+  for (int i = 0; i < num_slots; ++i) {
+    const int slot_index = (next_slot_ + i) % num_slots;
+    const Slot& slot = slots_[slot_index];
+    if (slot.done && slot.buffer.empty()) continue;
+    *all_done = false;
+    if (!slot.buffer.empty()) return slot_index;
+    if (deterministic_) return -1;
+  }
+  return -1;
+}
+
+void InterleavedRecordReaderWrapper::GetNext(TF_Status* status) {
+  if (unread_) {
+    unread_ = false;
+    Set_TF_Status_from_Status(status, Status::OK());
+    return;
+  }
+  mutex_lock l(mu_);
+  bool all_done;
+  int slot_index;
+  while ((slot_index = NextReadySlot(&all_done)) < 0 && !all_done)
+    records_available_.wait(l);
+  if (all_done) {
+    Set_TF_Status_from_Status(status, errors::OutOfRange("All files have been read."));
+    return;
+  }
+  next_slot_ = (slot_index + 1) % static_cast<int>(slots_.size());
+  Slot& slot = slots_[slot_index];
+  Set_TF_Status_from_Status(status, slot.buffer.front().first);
+  record_ = std::move(slot.buffer.front().second);
+  slot.buffer.pop_front();
+  space_available_.notify_all();
+}
+
+namespace {
+
+constexpr char kRecordIndexMagic[] = "TFRINDEX";
+constexpr size_t kRecordIndexMagicSize = 8;
+
+Status BuildRecordIndex(const string& filename, const string& index_filename, uint64* num_records) {
+  uint64 file_size;
+  TF_RETURN_IF_ERROR(Env::Default()->GetFileSize(filename, &file_size));
+  std::unique_ptr<RandomAccessFile> file;
+  TF_RETURN_IF_ERROR(NewCachedRandomAccessFile(filename, &file));
+
+  // Only the record headers are decoded and the record contents are skipped.
+  const uint64 header_size = IndexedRecordReaderWrapper::kHeaderSize;
+  const uint64 footer_size = IndexedRecordReaderWrapper::kFooterSize;
+  BufferedInputStream input(file.get(), 256 * 1024);
+  std::vector<uint64> offsets{0};
+  uint64 offset = 0;
+  string header;
+  while (offset + header_size <= file_size) {
+    TF_RETURN_IF_ERROR(input.ReadNBytes(header_size, &header));
+    const uint64 length = core::DecodeFixed64(header.data());
+    const uint32 masked_crc = core::DecodeFixed32(header.data() + sizeof(uint64));
+    if (crc32c::Unmask(masked_crc) != crc32c::Value(header.data(), sizeof(uint64)))
+      return errors::DataLoss("Corrupted record header at offset ", offset, " in '", filename, "'.");
+    const uint64 next_offset = offset + header_size + length + footer_size;
+    if (next_offset > file_size) break;
+    TF_RETURN_IF_ERROR(input.SkipNBytes(length + footer_size));
+    offsets.push_back(next_offset);
+    offset = next_offset;
+  }
+
+  string index(kRecordIndexMagic, kRecordIndexMagicSize);
+  core::PutFixed64(&index, offsets.size() - 1);
+  for (uint64 record_offset : offsets)
+    core::PutFixed64(&index, record_offset);
+  TF_RETURN_IF_ERROR(WriteStringToFile(Env::Default(), index_filename, index));
+  *num_records = offsets.size() - 1;
+  return Status::OK();
+}
+
+}  // namespace
+
+Status BuildRecordIndices(const std::vector<string>& filenames,
+                          const std::vector<string>& index_filenames,
+                          int num_threads, std::vector<uint64>* num_records) {
+  if (filenames.size() != index_filenames.size())
+    return errors::InvalidArgument("The number of files and index files must match.");
+  num_records->assign(filenames.size(), 0);
+  std::vector<Status> statuses(filenames.size());
+  {
+    // The thread pool destructor waits for all scheduled files to be indexed.
+    thread::ThreadPool pool(
+        Env::Default(), "tf_scala_record_index",
+        std::max(1, std::min(num_threads, static_cast<int>(filenames.size()))));
+    for (size_t i = 0; i < filenames.size(); ++i)
+      pool.Schedule([&filenames, &index_filenames, &statuses, num_records, i]() {
+        statuses[i] = BuildRecordIndex(filenames[i], index_filenames[i], &(*num_records)[i]);
+      });
+  }
+  for (const Status& status : statuses)
+    TF_RETURN_IF_ERROR(status);
+  return Status::OK();
+}
+
+constexpr uint64 IndexedRecordReaderWrapper::kHeaderSize;
+constexpr uint64 IndexedRecordReaderWrapper::kFooterSize;
+
+IndexedRecordReaderWrapper::IndexedRecordReaderWrapper() {}
+
+IndexedRecordReaderWrapper* IndexedRecordReaderWrapper::New(const string& filename,
+                                                            const string& index_filename,
+                                                            bool verify_checksums,
+                                                            TF_Status* out_status) {
+  string index;
+  Status s = ReadFileToString(Env::Default(), index_filename, &index);
+  if (s.ok() && (index.size() < kRecordIndexMagicSize + sizeof(uint64) ||
+                 index.compare(0, kRecordIndexMagicSize, kRecordIndexMagic) != 0))
+    s = errors::DataLoss("'", index_filename, "' is not a record index file.");
+  uint64 num_records = 0;
+  if (s.ok()) {
+    num_records = core::DecodeFixed64(index.data() + kRecordIndexMagicSize);
+    if (index.size() != kRecordIndexMagicSize + sizeof(uint64) * (num_records + 2))
+      s = errors::DataLoss("The record index file '", index_filename, "' is truncated.");
+  }
+  std::unique_ptr<RandomAccessFile> file;
+  if (s.ok()) s = NewCachedRandomAccessFile(filename, &file);
+  if (!s.ok()) {
+    Set_TF_Status_from_Status(out_status, s);
+    return nullptr;
+  }
+  IndexedRecordReaderWrapper* reader = new IndexedRecordReaderWrapper;
+  reader->file_ = file.release();
+  reader->verify_checksums_ = verify_checksums;
+  reader->offsets_.resize(num_records + 1);
+  const char* offsets_data = index.data() + kRecordIndexMagicSize + sizeof(uint64);
+  for (uint64 i = 0; i <= num_records; ++i)
+    reader->offsets_[i] = core::DecodeFixed64(offsets_data + i * sizeof(uint64));
+  return reader;
+}
+
+IndexedRecordReaderWrapper::~IndexedRecordReaderWrapper() {
+  delete file_;
+}
+
+Status IndexedRecordReaderWrapper::Read(uint64 index, char* dst) const {
+  if (index >= num_records())
+    return errors::OutOfRange("Record index ", index, " is out of range for a file with ", num_records(),
+                              " records.");
+  const uint64 length = record_length(index);
+  StringPiece result;
+  TF_RETURN_IF_ERROR(file_->Read(offsets_[index] + kHeaderSize, length, &result, dst));
+  if (result.size() != length)
+    return errors::DataLoss("Truncated record at offset ", offsets_[index], ".");
+  // "RandomAccessFile::Read" may return data that is not stored in the provided buffer.
+  if (result.data() != dst)
+    memmove(dst, result.data(), length);
+  if (verify_checksums_) {
+    char footer[kFooterSize];
+    TF_RETURN_IF_ERROR(file_->Read(offsets_[index] + kHeaderSize + length, kFooterSize, &result, footer));
+    if (result.size() != kFooterSize ||
+        crc32c::Unmask(core::DecodeFixed32(result.data())) != crc32c::Value(dst, length))
+      return errors::DataLoss("Corrupted record at offset ", offsets_[index], ".");
+  }
+  return Status::OK();
+}
+
+MappedRecordReaderWrapper::MappedRecordReaderWrapper() {}
+
+MappedRecordReaderWrapper* MappedRecordReaderWrapper::New(const string& filename, uint64 start_offset,
+                                                          bool verify_checksums, TF_Status* out_status) {
+  std::unique_ptr<ReadOnlyMemoryRegion> region;
+  Status s = Env::Default()->NewReadOnlyMemoryRegionFromFile(filename, &region);
+  if (!s.ok()) {
+    Set_TF_Status_from_Status(out_status, s);
+    return nullptr;
+  }
+  MappedRecordReaderWrapper* reader = new MappedRecordReaderWrapper;
+  reader->region_ = std::move(region);
+  reader->offset_ = start_offset;
+  reader->verify_checksums_ = verify_checksums;
+  return reader;
+}
+
+MappedRecordReaderWrapper::~MappedRecordReaderWrapper() {}
+
+void MappedRecordReaderWrapper::GetNext(const char** data, uint64* length, TF_Status* status) {
+  const uint64 header_size = IndexedRecordReaderWrapper::kHeaderSize;
+  const uint64 footer_size = IndexedRecordReaderWrapper::kFooterSize;
+  const char* region_data = static_cast<const char*>(region_->data());
+  const uint64 region_length = region_->length();
+  if (offset_ + header_size > region_length) {
+    Set_TF_Status_from_Status(status, errors::OutOfRange("End of file reached."));
+    return;
+  }
+  const char* header = region_data + offset_;
+  const uint64 record_length = core::DecodeFixed64(header);
+  if (crc32c::Unmask(core::DecodeFixed32(header + sizeof(uint64))) != crc32c::Value(header, sizeof(uint64))) {
+    Set_TF_Status_from_Status(status, errors::DataLoss("Corrupted record header at offset ", offset_, "."));
+    return;
+  }
+  if (record_length > region_length - offset_ - header_size ||
+      region_length - offset_ - header_size - record_length < footer_size) {
+    Set_TF_Status_from_Status(status, errors::OutOfRange("The last record is only partially written."));
+    return;
+  }
+  const char* record_data = header + header_size;
+  if (verify_checksums_ &&
+      crc32c::Unmask(core::DecodeFixed32(record_data + record_length)) != crc32c::Value(record_data, record_length)) {
+    Set_TF_Status_from_Status(status, errors::DataLoss("Corrupted record at offset ", offset_, "."));
+    return;
+  }
+  *data = record_data;
+  *length = record_length;
+  offset_ += header_size + record_length + footer_size;
+  Set_TF_Status_from_Status(status, Status::OK());
+}
+
 }  // namespace io
 }  // namespace tensorflow
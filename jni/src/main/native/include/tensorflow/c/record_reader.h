@@ -16,14 +16,28 @@ limitations under the License.
 #ifndef TENSORFLOW_LIB_IO_RECORD_READER_WRAPPER_H_
 #define TENSORFLOW_LIB_IO_RECORD_READER_WRAPPER_H_
 
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/core/stringpiece.h"
 #include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
 #include "tensorflow/core/platform/types.h"
 
 namespace tensorflow {
 
 class RandomAccessFile;
+class ReadOnlyMemoryRegion;
+class Thread;
+
+namespace thread {
+class ThreadPool;
+}  // namespace thread
 
 namespace io {
 
@@ -50,9 +64,13 @@ class RecordReaderWrapper {
 
   // Return the current record contents. Only valid after the preceding call
   // to GetNext() returned true
-  string record() const { return record_; }
+  const string& record() const { return record_; }
   // Return the current offset in the file.
   uint64 offset() const { return offset_; }
+  // Push the current record back, so that it is returned again by the next
+  // call to GetNext(). Only valid after the preceding call to GetNext()
+  // returned true
+  void Unread() { offset_ = record_offset_; }
 
   // Close the underlying file and release its resources.
   void Close();
@@ -61,12 +79,236 @@ class RecordReaderWrapper {
   RecordReaderWrapper();
 
   uint64 offset_;
+  uint64 record_offset_;
   RandomAccessFile* file_;    // Owned
   io::RecordReader* reader_;  // Owned
   string record_;
   TF_DISALLOW_COPY_AND_ASSIGN(RecordReaderWrapper);
 };
 
+// A variant of RecordReaderWrapper that reads records ahead of time, on a
+// dedicated I/O thread, into a bounded buffer. This hides the latency of
+// reading from remote file systems (e.g., GCS or HDFS) from the consumer. An
+// instance of this class is not safe for concurrent access by multiple consumer
+// threads.
+class PrefetchingRecordReaderWrapper {
+ public:
+  // The I/O thread stops reading ahead once either "max_buffered_records"
+  // records or "max_buffered_bytes" bytes are buffered.
+  static PrefetchingRecordReaderWrapper* New(
+      const string& filename, uint64 start_offset, const string& compression_type_string,
+      int64 max_buffered_records, int64 max_buffered_bytes, TF_Status* out_status);
+
+  ~PrefetchingRecordReaderWrapper();
+
+  // Waits for the next record to become available. Populates status with the
+  // same codes as RecordReaderWrapper::GetNext(). Failed reads (e.g., reaching
+  // the end of the file) are retried by the next call, starting from the same
+  // offset.
+  void GetNext(TF_Status* status);
+
+  // Return the current record contents. Only valid after the preceding call
+  // to GetNext() returned true
+  const string& record() const { return record_; }
+  // Return the offset in the file right after the current record.
+  uint64 offset() const { return offset_; }
+  // Push the current record back, so that it is returned again by the next
+  // call to GetNext(). Only valid after the preceding call to GetNext()
+  // returned true
+  void Unread();
+
+  // Total time (in microseconds) that GetNext() spent waiting for records.
+  int64 stall_time_micros() const;
+  // Number of records and bytes currently buffered.
+  int64 buffered_records() const;
+  int64 buffered_bytes() const;
+
+ private:
+  PrefetchingRecordReaderWrapper();
+
+  // Body of the I/O thread.
+  void ReadLoop();
+
+  RandomAccessFile* file_;    // Owned
+  io::RecordReader* reader_;  // Owned
+  int64 max_buffered_records_;
+  int64 max_buffered_bytes_;
+  string record_;
+  uint64 offset_;
+  uint64 record_offset_;
+
+  mutable mutex mu_;
+  condition_variable records_available_;
+  condition_variable space_available_;
+  // Buffered records, along with the offsets right after them.
+  std::deque<std::pair<string, uint64>> buffer_ GUARDED_BY(mu_);
+  int64 buffered_bytes_ GUARDED_BY(mu_) = 0;
+  // Offset from which the I/O thread reads the next record.
+  uint64 read_offset_ GUARDED_BY(mu_);
+  // Status of the last failed read, which is reported once the buffer drains.
+  Status read_status_ GUARDED_BY(mu_);
+  bool cancelled_ GUARDED_BY(mu_) = false;
+  int64 stall_time_micros_ GUARDED_BY(mu_) = 0;
+  std::unique_ptr<Thread> thread_;
+  TF_DISALLOW_COPY_AND_ASSIGN(PrefetchingRecordReaderWrapper);
+};
+
+// Reader that interleaves the records of multiple files, reading up to
+// "cycle_length" of them concurrently on a thread pool. Each file is read ahead
+// of time into its own bounded buffer. In deterministic mode, the records are
+// returned in round-robin order over the files being read, with file "i" being
+// read by slot "i % cycle_length", and so the order only depends on the file
+// contents. Otherwise, records are returned as soon as they become available,
+// from whichever file has them. An instance of this class is not safe for
+// concurrent access by multiple consumer threads.
+class InterleavedRecordReaderWrapper {
+ public:
+  // The file patterns are expanded using Env::GetMatchingPaths() and the
+  // matching files of each pattern are sorted by name.
+  static InterleavedRecordReaderWrapper* New(
+      const std::vector<string>& file_patterns, const string& compression_type_string,
+      int cycle_length, bool deterministic, int64 max_buffered_records_per_file,
+      TF_Status* out_status);
+
+  ~InterleavedRecordReaderWrapper();
+
+  // Waits for the next record to become available. Populates status with
+  // OUT_OF_RANGE once all files have been read, or with the error that
+  // occurred while reading a file (in which case the rest of that file is
+  // skipped).
+  void GetNext(TF_Status* status);
+
+  // Return the current record contents. Only valid after the preceding call
+  // to GetNext() returned true
+  const string& record() const { return record_; }
+
+  // Push the current record back, so that it is returned again by the next
+  // call to GetNext(). Only valid after the preceding call to GetNext()
+  // returned true
+  void Unread() { unread_ = true; }
+
+  // Number of files being read.
+  int64 num_files() const { return static_cast<int64>(filenames_.size()); }
+
+ private:
+  struct Slot {
+    // Records read ahead of time, along with the errors that occurred while
+    // reading files (stored with an empty record), in the order they occurred.
+    std::deque<std::pair<Status, string>> buffer;
+    // Set once the slot has read all of its files.
+    bool done = false;
+  };
+
+  InterleavedRecordReaderWrapper();
+
+  // Body of the thread pool task that reads the files of slot "slot_index".
+  void ReadSlot(int slot_index);
+
+  // Returns the index of the next slot that has a record or error available,
+  // or -1 if none does. Sets "*all_done" if all slots are done and drained.
+  int NextReadySlot(bool* all_done) EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  std::vector<string> filenames_;
+  string compression_type_string_;
+  bool deterministic_;
+  int64 max_buffered_records_per_file_;
+  string record_;
+  bool unread_ = false;
+
+  mutex mu_;
+  condition_variable records_available_;
+  condition_variable space_available_;
+  std::vector<Slot> slots_ GUARDED_BY(mu_);
+  // Slot from which the next record is returned in deterministic mode, and
+  // from which the search for an available record starts otherwise.
+  int next_slot_ GUARDED_BY(mu_) = 0;
+  bool cancelled_ GUARDED_BY(mu_) = false;
+  std::unique_ptr<thread::ThreadPool> thread_pool_;
+  TF_DISALLOW_COPY_AND_ASSIGN(InterleavedRecordReaderWrapper);
+};
+
+// Scans the uncompressed TFRecord files "filenames" and writes an index of
+// their record offsets to "index_filenames" (one per file), using up to
+// "num_threads" threads. Partially written records at the end of a file are
+// not indexed. The number of records indexed for each file is stored in
+// "num_records".
+//
+// An index is stored as the 8-byte magic string "TFRINDEX", followed by the
+// number of records N and then N + 1 offsets, namely the offsets at which the
+// records start, followed by the offset right after the last record, all
+// encoded as little-endian 64-bit integers.
+Status BuildRecordIndices(const std::vector<string>& filenames,
+                          const std::vector<string>& index_filenames,
+                          int num_threads, std::vector<uint64>* num_records);
+
+// Reader providing random access to the records of an uncompressed TFRecord
+// file, using the index built for it by BuildRecordIndices(). Reads do not
+// modify the state of the reader and so an instance of this class is safe for
+// concurrent access by multiple threads.
+class IndexedRecordReaderWrapper {
+ public:
+  static IndexedRecordReaderWrapper* New(const string& filename,
+                                         const string& index_filename,
+                                         bool verify_checksums,
+                                         TF_Status* out_status);
+
+  ~IndexedRecordReaderWrapper();
+
+  // Number of records in the file.
+  uint64 num_records() const { return offsets_.size() - 1; }
+
+  // Length (in bytes) of the contents of record "index".
+  uint64 record_length(uint64 index) const {
+    return offsets_[index + 1] - offsets_[index] - kHeaderSize - kFooterSize;
+  }
+
+  // Reads the contents of record "index" into "dst", which must have space
+  // for at least record_length(index) bytes.
+  Status Read(uint64 index, char* dst) const;
+
+  static constexpr uint64 kHeaderSize = sizeof(uint64) + sizeof(uint32);
+  static constexpr uint64 kFooterSize = sizeof(uint32);
+
+ private:
+  IndexedRecordReaderWrapper();
+
+  RandomAccessFile* file_;  // Owned
+  std::vector<uint64> offsets_;
+  bool verify_checksums_;
+  TF_DISALLOW_COPY_AND_ASSIGN(IndexedRecordReaderWrapper);
+};
+
+// Reader for uncompressed TFRecord files that memory-maps the file and returns
+// pointers to the records inside the mapping, rather than copying them. This
+// is only efficient for local files, for which Env::NewReadOnlyMemoryRegion()
+// is backed by "mmap". An instance of this class is not safe for concurrent
+// access by multiple threads.
+class MappedRecordReaderWrapper {
+ public:
+  static MappedRecordReaderWrapper* New(const string& filename, uint64 start_offset,
+                                        bool verify_checksums, TF_Status* out_status);
+
+  ~MappedRecordReaderWrapper();
+
+  // Gets the next record, at "offset()". Populates status with OK on success,
+  // OUT_OF_RANGE for end of file (including when the last record is only
+  // partially written), or DATA_LOSS for corrupted records. On success, the
+  // record contents are stored at "*data" and remain valid until the reader is
+  // deleted.
+  void GetNext(const char** data, uint64* length, TF_Status* status);
+
+  // Return the current offset in the file.
+  uint64 offset() const { return offset_; }
+
+ private:
+  MappedRecordReaderWrapper();
+
+  std::unique_ptr<ReadOnlyMemoryRegion> region_;
+  uint64 offset_;
+  bool verify_checksums_;
+  TF_DISALLOW_COPY_AND_ASSIGN(MappedRecordReaderWrapper);
+};
+
 }  // namespace io
 }  // namespace tensorflow
 
@@ -0,0 +1,142 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/record_writer.h"
+
+#include "tensorflow/c/record_compression.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/lib/io/record_writer.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace io {
+
+RecordWriterWrapper::RecordWriterWrapper() {}
+
+RecordWriterWrapper* RecordWriterWrapper::New(const string& filename, const string& compression_type_string,
+                                              bool append, int64 flush_interval_millis, TF_Status* out_status) {
+  std::unique_ptr<WritableFile> file;
+  Status s = append ? Env::Default()->NewAppendableFile(filename, &file)
+                    : Env::Default()->NewWritableFile(filename, &file);
+  if (s.ok()) s = WrapCompressingFile(compression_type_string, &file);
+  if (!s.ok()) {
+    Set_TF_Status_from_Status(out_status, s);
+    return nullptr;
+  }
+  RecordWriterWrapper* writer = new RecordWriterWrapper;
+  writer->flush_interval_millis_ = flush_interval_millis;
+  writer->writer_.reset(new RecordWriter(file.get(), CreateRecordWriterOptions(compression_type_string)));
+  writer->file_ = std::move(file);
+  if (flush_interval_millis > 0)
+    writer->flush_thread_.reset(Env::Default()->StartThread(
+        ThreadOptions(), "tf_scala_record_flush", [writer]() { writer->FlushLoop(); }));
+  return writer;
+}
+
+RecordWriterWrapper::~RecordWriterWrapper() {
+  {
+    mutex_lock l(mu_);
+    cancelled_ = true;
+  }
+  cancelled_cv_.notify_all();
+  // Joins the flush thread.
+  flush_thread_.reset();
+  mutex_lock l(mu_);
+  CloseLocked().IgnoreError();
+}
+
+void RecordWriterWrapper::FlushLoop() {
+  mutex_lock l(mu_);
+  while (!cancelled_) {
+    WaitForMilliseconds(&l, &cancelled_cv_, flush_interval_millis_);
+    if (!cancelled_ && dirty_ && writer_ != nullptr) {
+      Status s = FlushLocked();
+      if (!s.ok() && background_status_.ok()) background_status_ = s;
+    }
+  }
+}
+
+Status RecordWriterWrapper::FlushLocked() {
+  TF_RETURN_IF_ERROR(writer_->Flush());
+  TF_RETURN_IF_ERROR(file_->Flush());
+  dirty_ = false;
+  return Status::OK();
+}
+
+Status RecordWriterWrapper::CloseLocked() {
+  if (writer_ == nullptr) return Status::OK();
+  Status s = writer_->Close();
+  writer_.reset();
+  Status file_status = file_->Close();
+  file_.reset();
+  return s.ok() ? file_status : s;
+}
+
+void RecordWriterWrapper::Write(StringPiece record, TF_Status* status) {
+  mutex_lock l(mu_);
+  Status s = background_status_;
+  background_status_ = Status::OK();
+  if (s.ok() && writer_ == nullptr) s = errors::FailedPrecondition("Writer is closed.");
+  if (s.ok()) s = writer_->WriteRecord(record);
+  if (s.ok()) dirty_ = true;
+  Set_TF_Status_from_Status(status, s);
+}
+
+void RecordWriterWrapper::WriteBatch(const char* data, size_t length, int64 num_records, TF_Status* status) {
+  mutex_lock l(mu_);
+  Status s = background_status_;
+  background_status_ = Status::OK();
+  if (s.ok() && writer_ == nullptr) s = errors::FailedPrecondition("Writer is closed.");
+  size_t position = 0;
+  for (int64 i = 0; s.ok() && i < num_records; ++i) {
+    if (position + 4 > length) {
+      s = errors::InvalidArgument("The batch buffer is too small for ", num_records, " records.");
+      break;
+    }
+    uint32 record_length = 0;
+    for (int j = 0; j < 4; ++j)
+      record_length |= static_cast<uint32>(static_cast<unsigned char>(data[position++])) << (8 * j);
+    if (record_length > length - position) {
+      s = errors::InvalidArgument("Record ", i, " extends past the end of the batch buffer.");
+      break;
+    }
+    s = writer_->WriteRecord(StringPiece(data + position, record_length));
+    position += record_length;
+    dirty_ = true;
+  }
+  Set_TF_Status_from_Status(status, s);
+}
+
+void RecordWriterWrapper::Flush(TF_Status* status) {
+  mutex_lock l(mu_);
+  Status s = background_status_;
+  background_status_ = Status::OK();
+  if (s.ok() && writer_ == nullptr) s = errors::FailedPrecondition("Writer is closed.");
+  if (s.ok()) s = FlushLocked();
+  Set_TF_Status_from_Status(status, s);
+}
+
+void RecordWriterWrapper::Close(TF_Status* status) {
+  mutex_lock l(mu_);
+  Status s = background_status_;
+  background_status_ = Status::OK();
+  Status close_status = CloseLocked();
+  Set_TF_Status_from_Status(status, s.ok() ? close_status : s);
+}
+
+}  // namespace io
+}  // namespace tensorflow
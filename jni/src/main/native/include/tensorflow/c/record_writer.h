@@ -0,0 +1,93 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LIB_IO_RECORD_WRITER_WRAPPER_H_
+#define TENSORFLOW_LIB_IO_RECORD_WRITER_WRAPPER_H_
+
+#include <memory>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+class Thread;
+class WritableFile;
+
+namespace io {
+
+class RecordWriter;
+
+// A wrapper around io::RecordWriter that is more easily used from within
+// Scala. Records can be written in batches and, optionally, flushed
+// periodically by a background thread. An instance of this class is safe for
+// concurrent access by multiple threads.
+class RecordWriterWrapper {
+ public:
+  // Creates a writer for "filename", truncating it unless "append" is true. If
+  // "flush_interval_millis" is positive, a background thread flushes the
+  // written records at that interval.
+  static RecordWriterWrapper* New(const string& filename, const string& compression_type_string,
+                                  bool append, int64 flush_interval_millis, TF_Status* out_status);
+
+  ~RecordWriterWrapper();
+
+  // Writes a single record.
+  void Write(StringPiece record, TF_Status* status);
+
+  // Writes "num_records" records stored in "data", each one encoded as its
+  // length (a little-endian 32-bit integer) followed by its contents.
+  void WriteBatch(const char* data, size_t length, int64 num_records, TF_Status* status);
+
+  // Flushes the written records to the file.
+  void Flush(TF_Status* status);
+
+  // Flushes the written records and closes the file. Subsequent writes fail.
+  void Close(TF_Status* status);
+
+ private:
+  RecordWriterWrapper();
+
+  // Body of the background flush thread.
+  void FlushLoop();
+
+  Status FlushLocked() EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  Status CloseLocked() EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  int64 flush_interval_millis_;
+
+  mutex mu_;
+  condition_variable cancelled_cv_;
+  std::unique_ptr<WritableFile> file_ GUARDED_BY(mu_);
+  std::unique_ptr<RecordWriter> writer_ GUARDED_BY(mu_);
+  // Set when records have been written since the last flush.
+  bool dirty_ GUARDED_BY(mu_) = false;
+  // Error that occurred while flushing in the background, which is reported by
+  // the next call.
+  Status background_status_ GUARDED_BY(mu_);
+  bool cancelled_ GUARDED_BY(mu_) = false;
+  std::unique_ptr<Thread> flush_thread_;
+  TF_DISALLOW_COPY_AND_ASSIGN(RecordWriterWrapper);
+};
+
+}  // namespace io
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_LIB_IO_RECORD_WRITER_WRAPPER_H_
@@ -0,0 +1,215 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/session_recovery.h"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/c/native_executor.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/framework/node_def_util.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/graph/tensor_id.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/util/tensor_bundle/tensor_bundle.h"
+
+namespace tensorflow {
+namespace {
+
+// Tensor read from a checkpoint, which is fed as output "output" of the "RestoreV2" op that would otherwise read it.
+struct RestoredTensor {
+  string output;
+  string key;
+  DataType dtype;
+  Tensor value;
+};
+
+// Stores the value of the constant that produces "input" in "value", and returns "false" if it is not a constant.
+bool ConstantValue(const std::unordered_map<string, const NodeDef*>& nodes, const string& input, Tensor* value) {
+  const TensorId id = ParseTensorName(input);
+  auto node = nodes.find(id.first.ToString());
+  if (node == nodes.end() || node->second->op() != "Const" || id.second != 0) return false;
+  auto attr = node->second->attr().find("value");
+  return attr != node->second->attr().end() && value->FromProto(attr->second.tensor());
+}
+
+// Collects the tensors read by the "RestoreV2" ops that "restore_op" depends on. Returns "false" if the restore op
+// depends on any restore ops whose tensors cannot be read as a whole (e.g., ops that restore partitioned variables).
+bool FindRestoredTensors(const GraphDef& graph_def, const string& restore_op, std::vector<RestoredTensor>* tensors) {
+  std::unordered_map<string, const NodeDef*> nodes;
+  for (const NodeDef& node : graph_def.node()) nodes[node.name()] = &node;
+  std::unordered_set<string> visited{restore_op};
+  std::vector<string> stack{restore_op};
+  while (!stack.empty()) {
+    auto node = nodes.find(stack.back());
+    stack.pop_back();
+    if (node == nodes.end()) return false;
+    const NodeDef& node_def = *node->second;
+    if (node_def.op() == "Restore" || node_def.op() == "RestoreSlice") return false;
+    if (node_def.op() == "RestoreV2") {
+      Tensor names;
+      Tensor slices;
+      DataTypeVector dtypes;
+      if (node_def.input_size() != 3 || !ConstantValue(nodes, node_def.input(1), &names) ||
+          !ConstantValue(nodes, node_def.input(2), &slices) || !GetNodeAttr(node_def, "dtypes", &dtypes).ok() ||
+          names.dtype() != DT_STRING || slices.dtype() != DT_STRING ||
+          names.NumElements() != static_cast<int64>(dtypes.size()) || slices.NumElements() != names.NumElements())
+        return false;
+      for (int64 i = 0; i < names.NumElements(); ++i) {
+        if (!slices.flat<string>()(i).empty()) return false;
+        tensors->push_back({strings::StrCat(node_def.name(), ":", i), names.flat<string>()(i), dtypes[i], Tensor()});
+      }
+      continue;
+    }
+    for (const string& input : node_def.input()) {
+      const string name = ParseTensorName(input).first.ToString();
+      if (visited.insert(name).second) stack.push_back(name);
+    }
+  }
+  return true;
+}
+
+// Reads the values of "tensors" from the V2 checkpoint with prefix "prefix", using one bundle reader per thread.
+Status ReadRestoredTensors(const string& prefix, std::vector<RestoredTensor>* tensors) {
+  NativeExecutor* executor = NativeExecutor::Global();
+  const int64 num_tensors = static_cast<int64>(tensors->size());
+  const int32 num_readers = static_cast<int32>(std::min<int64>(num_tensors, executor->NumThreads()));
+  std::vector<Status> statuses(num_readers);
+  executor->ParallelFor(NativeExecutor::kFileIO, num_readers, num_readers, [&](int64 r) {
+    BundleReader reader(Env::Default(), prefix);
+    Status s = reader.status();
+    for (int64 i = r; s.ok() && i < num_tensors; i += num_readers) {
+      RestoredTensor& tensor = (*tensors)[i];
+      s = reader.Lookup(tensor.key, &tensor.value);
+      if (s.ok() && tensor.value.dtype() != tensor.dtype)
+        s = errors::InvalidArgument(
+            "Tensor '", tensor.key, "' has type ", DataTypeString(tensor.value.dtype()), " in checkpoint '", prefix,
+            "', but the graph restores it as ", DataTypeString(tensor.dtype), ".");
+    }
+    statuses[r] = s;
+  });
+  for (const Status& s : statuses) TF_RETURN_IF_ERROR(s);
+  return Status::OK();
+}
+
+Status ResolveOutput(TF_Graph* graph, const string& name, TF_Output* output) {
+  const TensorId id = ParseTensorName(name);
+  TF_Operation* op = TF_GraphOperationByName(graph, id.first.ToString().c_str());
+  if (op == nullptr) return errors::NotFound("Tensor '", name, "' was not found in the graph.");
+  *output = {op, id.second};
+  return Status::OK();
+}
+
+// Runs "session", feeding "feeds", running "target" (unless it is empty) and fetching "fetch" into "value" (unless it
+// is empty).
+Status Run(TF_Session* session, const std::vector<std::pair<string, Tensor>>& feeds, const string& target,
+           const string& fetch, Tensor* value) {
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<TF_Output> inputs;
+  std::vector<TF_Tensor*> input_values;
+  Status s;
+  for (const std::pair<string, Tensor>& feed : feeds) {
+    TF_Output input;
+    s = ResolveOutput(session->graph, feed.first, &input);
+    if (!s.ok()) break;
+    TF_Tensor* input_value = TF_TensorFromTensor(feed.second, status.get());
+    s = StatusFromTF_Status(status.get());
+    if (!s.ok()) break;
+    inputs.push_back(input);
+    input_values.push_back(input_value);
+  }
+  TF_Output output;
+  if (s.ok() && !fetch.empty()) s = ResolveOutput(session->graph, fetch, &output);
+  TF_Operation* target_op = nullptr;
+  if (s.ok() && !target.empty()) {
+    target_op = TF_GraphOperationByName(session->graph, target.c_str());
+    if (target_op == nullptr) s = errors::NotFound("Op '", target, "' was not found in the graph.");
+  }
+  if (!s.ok()) {
+    for (TF_Tensor* input_value : input_values) TF_DeleteTensor(input_value);
+    return s;
+  }
+  TF_Tensor* output_value = nullptr;
+  // "TF_SessionRun" takes ownership of the input tensors.
+  TF_SessionRun(
+      session, nullptr, inputs.data(), input_values.data(), static_cast<int>(inputs.size()),
+      fetch.empty() ? nullptr : &output, fetch.empty() ? nullptr : &output_value, fetch.empty() ? 0 : 1,
+      target_op == nullptr ? nullptr : &target_op, target_op == nullptr ? 0 : 1, nullptr, status.get());
+  TF_RETURN_IF_ERROR(StatusFromTF_Status(status.get()));
+  if (output_value != nullptr) {
+    s = TF_TensorToTensor(output_value, value);
+    TF_DeleteTensor(output_value);
+  }
+  return s;
+}
+
+// Evaluates the string tensor "ready_tensor", which lists the reasons why the model is not ready, and returns those
+// reasons, or an empty string if the model is ready, as "SessionManager.isReady" does in the Scala API.
+string NotReadyMessage(TF_Session* session, const string& ready_tensor) {
+  if (ready_tensor.empty()) return "";
+  Tensor value;
+  const Status s = Run(session, {}, "", ready_tensor, &value);
+  if (!s.ok())
+    return strings::StrCat("An exception was thrown while checking if the model is ready: ", s.error_message(), ".");
+  if (value.NumElements() == 0) return "";
+  const auto reasons = value.flat<string>();
+  return strings::StrCat(
+      "Variables not initialized: ",
+      str_util::Join(std::vector<string>(reasons.data(), reasons.data() + reasons.size()), ", "), ".");
+}
+
+}  // namespace
+
+Status RecoverSession(TF_Session* session, const SessionRecoveryOptions& options, SessionRecoveryResult* result) {
+  GraphDef graph_def;
+  {
+    mutex_lock l(session->graph->mu);
+    session->graph->graph.ToGraphDef(&graph_def);
+  }
+
+  std::vector<std::pair<string, Tensor>> feeds;
+  Tensor filename(DT_STRING, TensorShape({}));
+  filename.scalar<string>()() = options.checkpoint_prefix;
+  feeds.emplace_back(options.filename_tensor, filename);
+  std::vector<RestoredTensor> tensors;
+  if (FindRestoredTensors(graph_def, options.restore_op, &tensors)) {
+    TF_RETURN_IF_ERROR(ReadRestoredTensors(options.checkpoint_prefix, &tensors));
+    for (RestoredTensor& tensor : tensors) feeds.emplace_back(tensor.output, std::move(tensor.value));
+    tensors.clear();
+  }
+  TF_RETURN_IF_ERROR(Run(session, feeds, options.restore_op, "", nullptr));
+  feeds.clear();
+
+  result->not_ready_for_local_init_message.clear();
+  result->not_ready_message.clear();
+  if (!options.local_init_op.empty()) {
+    result->not_ready_for_local_init_message = NotReadyMessage(session, options.ready_for_local_init_tensor);
+    if (!result->not_ready_for_local_init_message.empty()) return Status::OK();
+    TF_RETURN_IF_ERROR(Run(session, {}, options.local_init_op, "", nullptr));
+  }
+  result->not_ready_message = NotReadyMessage(session, options.ready_tensor);
+  return Status::OK();
+}
+
+}  // namespace tensorflow
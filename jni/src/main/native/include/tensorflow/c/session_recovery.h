@@ -0,0 +1,60 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_SESSION_RECOVERY_H_
+#define TENSORFLOW_C_SESSION_RECOVERY_H_
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+struct SessionRecoveryOptions {
+  // Prefix of the checkpoint to restore.
+  string checkpoint_prefix;
+  // Name of the restore op of the saver, and of the string tensor that holds the checkpoint prefix it restores from.
+  string restore_op;
+  string filename_tensor;
+  // Name of the string tensor that reports why the model is not ready for local initialization, or empty, if there is
+  // none, and name of the local initialization op, or empty, if there is none.
+  string ready_for_local_init_tensor;
+  string local_init_op;
+  // Name of the string tensor that reports why the model is not ready, or empty, if the model is not checked.
+  string ready_tensor;
+};
+
+struct SessionRecoveryResult {
+  // Reasons why the model is not ready for local initialization, and why it is not ready, which are empty if it is.
+  // The model is not checked for readiness unless it was ready for local initialization.
+  string not_ready_for_local_init_message;
+  string not_ready_message;
+};
+
+// Restores the variables of the graph of "session" from a checkpoint and makes sure that the model is ready, in a
+// single native call, which is what a preempted worker needs to do in order to resume training.
+//
+// If the restore op only restores whole tensors from a V2 checkpoint, using "RestoreV2" ops with constant tensor names
+// (which is the case for the savers created by the Scala API, unless they save partitioned variables), the tensors are
+// read in parallel on the native executor, using one bundle reader per thread, and are fed to the assignments of the
+// restore op, which is then run without executing any of its "RestoreV2" ops. This holds all restored values in host
+// memory at once. Otherwise, the restore op is run as is. The local initialization op is then run, if the model is
+// ready for it, and the ready tensor is evaluated once. Errors are only returned for failed restorations, while failed
+// readiness checks are reported in "result".
+Status RecoverSession(TF_Session* session, const SessionRecoveryOptions& options, SessionRecoveryResult* result);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_SESSION_RECOVERY_H_
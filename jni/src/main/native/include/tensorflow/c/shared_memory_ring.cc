@@ -0,0 +1,422 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/shared_memory_ring.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace {
+
+const uint32 kRingMagic = 0x52534654;  // "TFSR" in little-endian order.
+const uint32 kRingVersion = 1;
+
+// Number of polls of a slot before waiting threads start sleeping between
+// polls, and duration of those sleeps.
+const int kNumSpinPolls = 1024;
+const int64 kPollSleepMicros = 50;
+
+uint64 RoundUp(uint64 value, uint64 alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+struct ComponentHeader {
+  int32 dtype;
+  int32 num_dims;
+  int64_t dims[SharedMemoryRing::kMaxDims];
+  uint64 offset;
+  uint64 num_bytes;
+};
+
+// Header of each slot, which is followed by the slot data. The sequence
+// number of slot "i" is "i + k * num_slots" while the slot is free for the
+// "k"-th write into it, and "i + k * num_slots + 1" once that write has been
+// committed (i.e., while the written element can be read or is being read).
+struct SlotHeader {
+  std::atomic<uint64> sequence;
+  uint32 num_components;
+  ComponentHeader components[SharedMemoryRing::kMaxComponents];
+};
+
+// Header of the ring, at the start of the shared memory object. The write and
+// read positions are the sequence numbers of the next slots to claim and read,
+// respectively, and are kept on separate cache lines.
+struct RingHeader {
+  std::atomic<uint32> magic;
+  uint32 version;
+  uint32 num_slots;
+  uint64 slot_size;
+  uint64 slot_stride;
+  alignas(64) std::atomic<uint64> write_position;
+  alignas(64) std::atomic<uint64> read_position;
+};
+
+const uint64 kSlotDataOffset =
+    RoundUp(sizeof(SlotHeader), SharedMemoryRing::kAlignment);
+const uint64 kSlotsOffset =
+    RoundUp(sizeof(RingHeader), SharedMemoryRing::kAlignment);
+
+bool CanShare(TF_DataType dtype) {
+  return dtype != TF_STRING && dtype != TF_RESOURCE && dtype != TF_VARIANT;
+}
+
+Status ErrnoStatus(const string& context) {
+  return errors::Internal(context, ": ", strerror(errno), ".");
+}
+
+// Polls "ready" until it returns true or "timeout_micros" elapse (never, if
+// negative). Returns "false" if the wait timed out.
+template <typename Predicate>
+bool WaitUntil(int64 timeout_micros, Predicate ready) {
+  Env* env = Env::Default();
+  const uint64 start_micros = timeout_micros > 0 ? env->NowMicros() : 0;
+  for (int poll = 0;; ++poll) {
+    if (ready()) return true;
+    if (timeout_micros == 0) return false;
+    if (timeout_micros > 0 &&
+        env->NowMicros() - start_micros >= static_cast<uint64>(timeout_micros))
+      return false;
+    if (poll < kNumSpinPolls)
+      std::this_thread::yield();
+    else
+      env->SleepForMicroseconds(kPollSleepMicros);
+  }
+}
+
+}  // namespace
+
+constexpr int SharedMemoryRing::kMaxComponents;
+constexpr int SharedMemoryRing::kMaxDims;
+constexpr uint64 SharedMemoryRing::kAlignment;
+
+// Memory mapping of a ring, which is unmapped once the ring and all tensors
+// over its slots have been deleted.
+struct SharedMemoryRing::Mapping {
+  char* data = nullptr;
+  size_t size = 0;
+
+  RingHeader* header() const { return reinterpret_cast<RingHeader*>(data); }
+
+  SlotHeader* slot(uint64 sequence) const {
+    const RingHeader* h = header();
+    return reinterpret_cast<SlotHeader*>(
+        data + kSlotsOffset + (sequence % h->num_slots) * h->slot_stride);
+  }
+
+  char* slot_data(uint64 sequence) const {
+    return reinterpret_cast<char*>(slot(sequence)) + kSlotDataOffset;
+  }
+
+  ~Mapping() {
+    if (data != nullptr) munmap(data, size);
+  }
+};
+
+namespace {
+
+// Lease on a read slot, which is shared by the tensors of its element and
+// recycles the slot once they have all been deallocated.
+struct SlotLease {
+  std::shared_ptr<SharedMemoryRing::Mapping> mapping;
+  uint64 sequence;
+
+  ~SlotLease() {
+    mapping->slot(sequence)->sequence.store(
+        sequence + mapping->header()->num_slots, std::memory_order_release);
+  }
+};
+
+void DeleteSlotLease(void* data, size_t length, void* arg) {
+  delete static_cast<std::shared_ptr<SlotLease>*>(arg);
+}
+
+Status MapRing(int fd, size_t size,
+               std::shared_ptr<SharedMemoryRing::Mapping>* mapping) {
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) return ErrnoStatus("Failed to map the shared memory");
+  mapping->reset(new SharedMemoryRing::Mapping());
+  (*mapping)->data = static_cast<char*>(data);
+  (*mapping)->size = size;
+  return Status::OK();
+}
+
+}  // namespace
+
+SharedMemoryRing::SharedMemoryRing(std::shared_ptr<Mapping> mapping,
+                                   const string& name, bool owner)
+    : mapping_(std::move(mapping)), name_(name), owner_(owner) {}
+
+SharedMemoryRing* SharedMemoryRing::Create(const string& name, int num_slots,
+                                           uint64 slot_size,
+                                           TF_Status* status) {
+  if (num_slots <= 0 || slot_size == 0) {
+    Set_TF_Status_from_Status(
+        status, errors::InvalidArgument(
+                    "The number of slots and the slot size must be positive."));
+    return nullptr;
+  }
+  const uint64 slot_stride = kSlotDataOffset + RoundUp(slot_size, kAlignment);
+  const size_t size =
+      static_cast<size_t>(kSlotsOffset + num_slots * slot_stride);
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    Set_TF_Status_from_Status(
+        status, errno == EEXIST
+                    ? errors::AlreadyExists("A shared memory object named '",
+                                            name, "' already exists.")
+                    : ErrnoStatus("Failed to create shared memory object '" +
+                                  name + "'"));
+    return nullptr;
+  }
+  Status s;
+  std::shared_ptr<Mapping> mapping;
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    s = ErrnoStatus("Failed to size shared memory object '" + name + "'");
+  if (s.ok()) s = MapRing(fd, size, &mapping);
+  close(fd);
+  if (!s.ok()) {
+    shm_unlink(name.c_str());
+    Set_TF_Status_from_Status(status, s);
+    return nullptr;
+  }
+
+  // The shared memory object is zero-filled and so only the non-zero fields
+  // are initialized. The magic number is published last, which marks the
+  // ring as ready to be opened.
+  RingHeader* header = mapping->header();
+  header->version = kRingVersion;
+  header->num_slots = static_cast<uint32>(num_slots);
+  header->slot_size = slot_size;
+  header->slot_stride = slot_stride;
+  for (uint64 i = 0; i < static_cast<uint64>(num_slots); ++i)
+    mapping->slot(i)->sequence.store(i, std::memory_order_relaxed);
+  header->magic.store(kRingMagic, std::memory_order_release);
+  Set_TF_Status_from_Status(status, Status::OK());
+  return new SharedMemoryRing(std::move(mapping), name, true);
+}
+
+SharedMemoryRing* SharedMemoryRing::Open(const string& name,
+                                         TF_Status* status) {
+  const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+  if (fd < 0) {
+    Set_TF_Status_from_Status(
+        status,
+        errno == ENOENT
+            ? errors::NotFound("No shared memory ring named '", name,
+                               "' exists.")
+            : ErrnoStatus("Failed to open shared memory object '" + name +
+                          "'"));
+    return nullptr;
+  }
+  Status s;
+  std::shared_ptr<Mapping> mapping;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    s = ErrnoStatus("Failed to stat shared memory object '" + name + "'");
+  } else if (static_cast<uint64>(file_stat.st_size) < kSlotsOffset) {
+    s = errors::Unavailable("The shared memory ring '", name,
+                            "' has not been initialized yet.");
+  } else {
+    s = MapRing(fd, static_cast<size_t>(file_stat.st_size), &mapping);
+  }
+  close(fd);
+  if (s.ok()) {
+    const RingHeader* header = mapping->header();
+    if (header->magic.load(std::memory_order_acquire) != kRingMagic) {
+      s = errors::Unavailable("The shared memory ring '", name,
+                              "' has not been initialized yet.");
+    } else if (header->version != kRingVersion) {
+      s = errors::FailedPrecondition("The shared memory ring '", name,
+                                     "' has unsupported version ",
+                                     header->version, ".");
+    } else if (kSlotsOffset + header->num_slots * header->slot_stride >
+               mapping->size) {
+      s = errors::DataLoss("The shared memory ring '", name,
+                           "' is truncated.");
+    }
+  }
+  Set_TF_Status_from_Status(status, s);
+  if (!s.ok()) return nullptr;
+  return new SharedMemoryRing(std::move(mapping), name, false);
+}
+
+SharedMemoryRing::~SharedMemoryRing() {
+  if (owner_) shm_unlink(name_.c_str());
+}
+
+int SharedMemoryRing::num_slots() const {
+  return static_cast<int>(mapping_->header()->num_slots);
+}
+
+uint64 SharedMemoryRing::slot_size() const {
+  return mapping_->header()->slot_size;
+}
+
+bool SharedMemoryRing::Claim(int64 timeout_micros, uint64* sequence,
+                             char** data, TF_Status* status) {
+  RingHeader* header = mapping_->header();
+  uint64 position = header->write_position.load(std::memory_order_relaxed);
+  const bool claimed = WaitUntil(timeout_micros, [&]() {
+    while (true) {
+      const uint64 slot_sequence =
+          mapping_->slot(position)->sequence.load(std::memory_order_acquire);
+      const int64 difference = static_cast<int64>(slot_sequence - position);
+      if (difference == 0) {
+        if (header->write_position.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed))
+          return true;
+      } else if (difference < 0) {
+        // The slot still holds an element from the previous lap.
+        return false;
+      } else {
+        position = header->write_position.load(std::memory_order_relaxed);
+      }
+    }
+  });
+  Set_TF_Status_from_Status(status, Status::OK());
+  if (!claimed) return false;
+  *sequence = position;
+  *data = mapping_->slot_data(position);
+  return true;
+}
+
+void SharedMemoryRing::Commit(uint64 sequence,
+                              const std::vector<Component>& components,
+                              TF_Status* status) {
+  SlotHeader* slot = mapping_->slot(sequence);
+  Status s;
+  if (components.size() > static_cast<size_t>(kMaxComponents))
+    s = errors::InvalidArgument("Elements can have at most ", kMaxComponents,
+                                " components.");
+  uint64 offset = 0;
+  for (size_t i = 0; s.ok() && i < components.size(); ++i) {
+    const Component& component = components[i];
+    if (!CanShare(component.dtype)) {
+      s = errors::InvalidArgument("Components of data type ", component.dtype,
+                                  " cannot be shared.");
+    } else if (component.dims.size() > static_cast<size_t>(kMaxDims)) {
+      s = errors::InvalidArgument("Components can have at most ", kMaxDims,
+                                  " dimensions.");
+    } else if (offset + component.num_bytes > slot_size()) {
+      s = errors::InvalidArgument("The element does not fit in a slot of ",
+                                  slot_size(), " bytes.");
+    }
+    if (!s.ok()) break;
+    ComponentHeader& header = slot->components[i];
+    header.dtype = static_cast<int32>(component.dtype);
+    header.num_dims = static_cast<int32>(component.dims.size());
+    std::copy(component.dims.begin(), component.dims.end(), header.dims);
+    header.offset = offset;
+    header.num_bytes = component.num_bytes;
+    offset = RoundUp(offset + component.num_bytes, kAlignment);
+  }
+  // Claimed slots must always be published, because readers wait for them in
+  // order, and so invalid elements are published as empty elements.
+  slot->num_components = s.ok() ? static_cast<uint32>(components.size()) : 0;
+  slot->sequence.store(sequence + 1, std::memory_order_release);
+  Set_TF_Status_from_Status(status, s);
+}
+
+bool SharedMemoryRing::Write(const std::vector<TF_Tensor*>& element,
+                             int64 timeout_micros, TF_Status* status) {
+  std::vector<Component> components;
+  uint64 num_bytes = 0;
+  for (TF_Tensor* tensor : element) {
+    Component component;
+    component.dtype = TF_TensorType(tensor);
+    component.num_bytes = TF_TensorByteSize(tensor);
+    for (int d = 0; d < TF_NumDims(tensor); ++d)
+      component.dims.push_back(TF_Dim(tensor, d));
+    num_bytes = RoundUp(num_bytes, kAlignment) + component.num_bytes;
+    components.push_back(std::move(component));
+  }
+  // Invalid elements are rejected before claiming a slot.
+  if (num_bytes > slot_size() ||
+      components.size() > static_cast<size_t>(kMaxComponents)) {
+    Set_TF_Status_from_Status(
+        status,
+        errors::InvalidArgument("The element (", components.size(),
+                                " components of ", num_bytes,
+                                " bytes) does not fit in a slot of ",
+                                slot_size(), " bytes."));
+    return false;
+  }
+  uint64 sequence;
+  char* data;
+  if (!Claim(timeout_micros, &sequence, &data, status)) return false;
+  uint64 offset = 0;
+  for (size_t i = 0; i < element.size(); ++i) {
+    std::memcpy(data + offset, TF_TensorData(element[i]),
+                components[i].num_bytes);
+    offset = RoundUp(offset + components[i].num_bytes, kAlignment);
+  }
+  Commit(sequence, components, status);
+  return TF_GetCode(status) == TF_OK;
+}
+
+bool SharedMemoryRing::Read(int64 timeout_micros,
+                            std::vector<TF_Tensor*>* element,
+                            TF_Status* status) {
+  element->clear();
+  RingHeader* header = mapping_->header();
+  uint64 position = header->read_position.load(std::memory_order_relaxed);
+  const bool read = WaitUntil(timeout_micros, [&]() {
+    while (true) {
+      const uint64 slot_sequence =
+          mapping_->slot(position)->sequence.load(std::memory_order_acquire);
+      const int64 difference =
+          static_cast<int64>(slot_sequence - (position + 1));
+      if (difference == 0) {
+        if (header->read_position.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed))
+          return true;
+      } else if (difference < 0) {
+        // The slot has not been committed yet.
+        return false;
+      } else {
+        position = header->read_position.load(std::memory_order_relaxed);
+      }
+    }
+  });
+  Set_TF_Status_from_Status(status, Status::OK());
+  if (!read) return false;
+
+  const SlotHeader* slot = mapping_->slot(position);
+  char* data = mapping_->slot_data(position);
+  std::shared_ptr<SlotLease> lease(new SlotLease{mapping_, position});
+  for (uint32 i = 0; i < slot->num_components; ++i) {
+    const ComponentHeader& component = slot->components[i];
+    element->push_back(TF_NewTensor(
+        static_cast<TF_DataType>(component.dtype), component.dims,
+        component.num_dims, data + component.offset,
+        static_cast<size_t>(component.num_bytes), DeleteSlotLease,
+        new std::shared_ptr<SlotLease>(lease)));
+  }
+  return true;
+}
+
+}  // namespace tensorflow
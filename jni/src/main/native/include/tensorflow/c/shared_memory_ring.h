@@ -0,0 +1,114 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_SHARED_MEMORY_RING_H_
+#define TENSORFLOW_C_SHARED_MEMORY_RING_H_
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// A shared memory ring is a named POSIX shared memory object (created using
+// "shm_open") that contains a bounded queue of fixed-size slots, each of which
+// holds one element (i.e., a list of up to "kMaxComponents" numeric tensors).
+// It is used to move elements between processes (e.g., from preprocessing
+// processes to a trainer) without any copies on the consumer side: read
+// elements are tensors over the slot memory, and a slot is recycled once all
+// tensors of its element have been deallocated. Producers either copy
+// existing tensors into a slot ("Write"), or write their values directly into
+// a claimed slot and then commit it ("Claim" and "Commit"). Any number of
+// producers and consumers, in any number of processes, may use the same ring
+// concurrently. Slots held by a process that crashes are never recycled.
+class SharedMemoryRing {
+ public:
+  static constexpr int kMaxComponents = 8;
+  static constexpr int kMaxDims = 8;
+
+  // Alignment of the components within a slot. Component "i" starts at the
+  // first multiple of "kAlignment" after the end of component "i - 1" (or at
+  // offset 0, for "i = 0").
+  static constexpr uint64 kAlignment = 64;
+
+  // Shape and data type of a component written into a claimed slot.
+  struct Component {
+    TF_DataType dtype;
+    std::vector<int64_t> dims;
+    uint64 num_bytes;
+  };
+
+  // Creates a new ring named "name" (e.g., "/tf_scala_batches"), with
+  // "num_slots" slots of "slot_size" bytes each. Fails if a ring (or any other
+  // shared memory object) named "name" already exists. The name is unlinked
+  // when the created ring is deleted, but the shared memory stays alive until
+  // all processes have closed it and all read tensors have been deallocated.
+  static SharedMemoryRing* Create(const string& name, int num_slots,
+                                  uint64 slot_size, TF_Status* status);
+
+  // Opens an existing ring named "name".
+  static SharedMemoryRing* Open(const string& name, TF_Status* status);
+
+  ~SharedMemoryRing();
+
+  int num_slots() const;
+  uint64 slot_size() const;
+
+  // Claims the next free slot, waiting for at most "timeout_micros" (or
+  // forever, if negative) for one to become free. Returns "false" if the wait
+  // timed out. Otherwise, "sequence" is set to the sequence number of the
+  // claimed slot and "data" to the start of its data, which must then be
+  // filled and committed using "Commit". Claimed slots are read in the order
+  // in which they were claimed and so they must always be committed.
+  bool Claim(int64 timeout_micros, uint64* sequence, char** data,
+             TF_Status* status);
+
+  // Publishes the slot with sequence number "sequence", which contains the
+  // components described by "components". If the components are invalid, the
+  // slot is published as an empty element and an error is returned.
+  void Commit(uint64 sequence, const std::vector<Component>& components,
+              TF_Status* status);
+
+  // Copies "element" (whose tensors are not owned) into the next free slot,
+  // waiting as in "Claim". Returns "false" if the wait timed out.
+  bool Write(const std::vector<TF_Tensor*>& element, int64 timeout_micros,
+             TF_Status* status);
+
+  // Reads the next element, waiting for at most "timeout_micros" (or forever,
+  // if negative) for one to be published. Returns "false" if the wait timed
+  // out. Otherwise, "element" is set to tensors over the slot of the element,
+  // which are then owned by the caller.
+  bool Read(int64 timeout_micros, std::vector<TF_Tensor*>* element,
+            TF_Status* status);
+
+  struct Mapping;
+
+ private:
+  SharedMemoryRing(std::shared_ptr<Mapping> mapping, const string& name,
+                   bool owner);
+
+  const std::shared_ptr<Mapping> mapping_;
+  const string name_;
+  // Indicates whether this instance created the ring and unlinks its name.
+  const bool owner_;
+  TF_DISALLOW_COPY_AND_ASSIGN(SharedMemoryRing);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_SHARED_MEMORY_RING_H_
@@ -0,0 +1,172 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/shared_thread_pools.h"
+
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+
+struct SharedThreadPoolRegistry::Pool {
+  string name;
+  int32 num_threads = 0;
+  // Set once a session may have created the pool, after which its size cannot change anymore.
+  bool created = false;
+  // Guarded by the registry lock.
+  int64 num_sessions = 0;
+  std::atomic<int64> active_steps{0};
+  std::atomic<int64> peak_active_steps{0};
+  std::atomic<int64> total_steps{0};
+  std::atomic<int64> step_micros{0};
+};
+
+SharedThreadPoolRegistry* SharedThreadPoolRegistry::Global() {
+  static SharedThreadPoolRegistry* registry = new SharedThreadPoolRegistry();
+  return registry;
+}
+
+Status SharedThreadPoolRegistry::Register(const string& name, int32 num_threads) {
+  if (name.empty()) return errors::InvalidArgument("The name of a shared thread pool cannot be empty.");
+  if (num_threads <= 0)
+    return errors::InvalidArgument("The number of threads (", num_threads, ") of pool '", name, "' must be positive.");
+  std::lock_guard<std::mutex> lock(mu_);
+  std::unique_ptr<Pool>& pool = pools_[name];
+  if (pool == nullptr) {
+    pool.reset(new Pool());
+    pool->name = name;
+  } else if (pool->created && pool->num_threads != num_threads) {
+    return errors::FailedPrecondition(
+        "Pool '", name, "' has already been created with ", pool->num_threads, " threads, and cannot be resized to ",
+        num_threads, " threads.");
+  }
+  pool->num_threads = num_threads;
+  return Status::OK();
+}
+
+Status SharedThreadPoolRegistry::ResolveConfig(ConfigProto* config) {
+  std::lock_guard<std::mutex> lock(mu_);
+  for (int i = 0; i < config->session_inter_op_thread_pool_size(); ++i) {
+    ThreadPoolOptionProto* options = config->mutable_session_inter_op_thread_pool(i);
+    if (options->global_name().empty()) continue;
+    std::unique_ptr<Pool>& pool = pools_[options->global_name()];
+    if (pool == nullptr) {
+      pool.reset(new Pool());
+      pool->name = options->global_name();
+      // This is the same default that TensorFlow uses for pools with no explicit size.
+      pool->num_threads = options->num_threads() > 0
+                          ? options->num_threads()
+                          : config->inter_op_parallelism_threads() > 0 ? config->inter_op_parallelism_threads()
+                                                                        : port::NumSchedulableCPUs();
+    } else if (options->num_threads() != 0 && options->num_threads() != pool->num_threads) {
+      return errors::InvalidArgument(
+          "Pool '", pool->name, "' is registered with ", pool->num_threads, " threads, but ", options->num_threads(),
+          " threads were requested for it.");
+    }
+    options->set_num_threads(pool->num_threads);
+    pool->created = true;
+  }
+  return Status::OK();
+}
+
+void SharedThreadPoolRegistry::AttachSession(const void* session, const ConfigProto& config) {
+  std::vector<Pool*> session_pools;
+  bool uses_named_pools = false;
+  std::lock_guard<std::mutex> lock(mu_);
+  for (const ThreadPoolOptionProto& options : config.session_inter_op_thread_pool()) {
+    auto it = options.global_name().empty() ? pools_.end() : pools_.find(options.global_name());
+    Pool* pool = it == pools_.end() ? nullptr : it->second.get();
+    if (pool != nullptr) {
+      ++pool->num_sessions;
+      uses_named_pools = true;
+    }
+    session_pools.push_back(pool);
+  }
+  if (!uses_named_pools) return;
+  sessions_[session] = std::move(session_pools);
+  ++num_attached_sessions_;
+}
+
+void SharedThreadPoolRegistry::DetachSession(const void* session) {
+  if (num_attached_sessions_.load(std::memory_order_relaxed) == 0) return;
+  std::lock_guard<std::mutex> lock(mu_);
+  auto it = sessions_.find(session);
+  if (it == sessions_.end()) return;
+  for (Pool* pool : it->second)
+    if (pool != nullptr) --pool->num_sessions;
+  sessions_.erase(it);
+  --num_attached_sessions_;
+}
+
+std::vector<SharedThreadPoolRegistry::Statistics> SharedThreadPoolRegistry::statistics() {
+  std::vector<Statistics> statistics;
+  std::lock_guard<std::mutex> lock(mu_);
+  for (const auto& entry : pools_) {
+    const Pool& pool = *entry.second;
+    Statistics pool_statistics;
+    pool_statistics.name = pool.name;
+    pool_statistics.num_threads = pool.num_threads;
+    pool_statistics.num_sessions = pool.num_sessions;
+    pool_statistics.active_steps = pool.active_steps.load();
+    pool_statistics.peak_active_steps = pool.peak_active_steps.load();
+    pool_statistics.total_steps = pool.total_steps.load();
+    pool_statistics.step_micros = pool.step_micros.load();
+    statistics.push_back(pool_statistics);
+  }
+  return statistics;
+}
+
+SharedThreadPoolRegistry::Pool* SharedThreadPoolRegistry::FindPool(const void* session, int32 pool_index) {
+  std::lock_guard<std::mutex> lock(mu_);
+  auto it = sessions_.find(session);
+  if (it == sessions_.end() || pool_index < 0 || pool_index >= static_cast<int32>(it->second.size())) return nullptr;
+  return it->second[pool_index];
+}
+
+SharedThreadPoolRegistry::ScopedStep::ScopedStep(const void* session, int32 pool_index) {
+  Start(session, pool_index);
+}
+
+SharedThreadPoolRegistry::ScopedStep::ScopedStep(
+    const void* session, const void* run_options, size_t run_options_length) {
+  // The run options are only parsed for the sessions that use named pools.
+  if (Global()->num_attached_sessions_.load(std::memory_order_relaxed) == 0) return;
+  RunOptions options;
+  if (run_options_length > 0 && !options.ParseFromArray(run_options, static_cast<int>(run_options_length))) return;
+  Start(session, options.inter_op_thread_pool());
+}
+
+SharedThreadPoolRegistry::ScopedStep::~ScopedStep() {
+  if (pool_ == nullptr) return;
+  pool_->step_micros += static_cast<int64>(Env::Default()->NowMicros() - start_micros_);
+  ++pool_->total_steps;
+  --pool_->active_steps;
+}
+
+void SharedThreadPoolRegistry::ScopedStep::Start(const void* session, int32 pool_index) {
+  SharedThreadPoolRegistry* registry = Global();
+  if (registry->num_attached_sessions_.load(std::memory_order_relaxed) == 0) return;
+  pool_ = registry->FindPool(session, pool_index);
+  if (pool_ == nullptr) return;
+  const int64 active_steps = ++pool_->active_steps;
+  int64 peak_active_steps = pool_->peak_active_steps.load();
+  while (active_steps > peak_active_steps &&
+         !pool_->peak_active_steps.compare_exchange_weak(peak_active_steps, active_steps)) {
+  }
+  start_micros_ = Env::Default()->NowMicros();
+}
+
+}  // namespace tensorflow
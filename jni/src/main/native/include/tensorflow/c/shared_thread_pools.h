@@ -0,0 +1,120 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_SHARED_THREAD_POOLS_H_
+#define TENSORFLOW_C_SHARED_THREAD_POOLS_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/protobuf/config.pb.h"
+
+namespace tensorflow {
+
+// Process-wide registry of the named inter-op thread pools that are shared by sessions (i.e., the entries of
+// "ConfigProto.session_inter_op_thread_pool" that have a "global_name"). TensorFlow creates each named pool once, the
+// first time that a session uses it, and shares it with all later sessions that use the same name, for the lifetime of
+// the process. The registry fixes the size of each pool explicitly, so that sessions configured by different parts of
+// an application agree on it, and it keeps track of the sessions that use each pool and of the steps that they run on
+// it. All methods are safe for concurrent use.
+class SharedThreadPoolRegistry {
+ public:
+  // Registered pool, along with its usage counters.
+  struct Pool;
+
+  struct Statistics {
+    string name;
+    int32 num_threads = 0;
+    // Number of live sessions that use the pool.
+    int64 num_sessions = 0;
+    // Number of steps currently running on the pool, and maximum number of steps that were running at the same time.
+    int64 active_steps = 0;
+    int64 peak_active_steps = 0;
+    int64 total_steps = 0;
+    // Sum of the durations of all completed steps, in microseconds. Dividing it by the elapsed time gives the average
+    // number of steps running concurrently on the pool.
+    int64 step_micros = 0;
+  };
+
+  // Returns the process-wide registry.
+  static SharedThreadPoolRegistry* Global();
+
+  // Registers pool "name" with "num_threads" threads. Registering a pool again changes its size, unless the pool has
+  // already been created by a session, in which case its size cannot change anymore and a "FailedPrecondition" error
+  // is returned.
+  Status Register(const string& name, int32 num_threads);
+
+  // Sets the number of threads of the named pools of "config" to their registered sizes. Pools that are not registered
+  // are registered with the number of threads requested by "config" (or with the number of schedulable CPUs, if that
+  // is zero). Returns an "InvalidArgument" error if "config" requests a different non-zero size for a registered pool.
+  Status ResolveConfig(ConfigProto* config);
+
+  // Records that "session" has been created using "config" (which must have been resolved using "ResolveConfig"), and
+  // that it uses the named pools of "config". Sessions that use no named pools are ignored.
+  void AttachSession(const void* session, const ConfigProto& config);
+
+  // Records that "session" has been deleted.
+  void DetachSession(const void* session);
+
+  // Returns the statistics of all registered pools, ordered by name.
+  std::vector<Statistics> statistics();
+
+  // Records a step of "session" that runs on its inter-op thread pool with index "pool_index" (i.e., the value of
+  // "RunOptions.inter_op_thread_pool"), for as long as it is alive. Steps of sessions that use no named pools are
+  // ignored, and are cheap to record.
+  class ScopedStep {
+   public:
+    ScopedStep(const void* session, int32 pool_index);
+    // Obtains the pool index from the serialized "RunOptions" of the step, which may be empty.
+    ScopedStep(const void* session, const void* run_options, size_t run_options_length);
+    ~ScopedStep();
+
+   private:
+    void Start(const void* session, int32 pool_index);
+
+    Pool* pool_ = nullptr;
+    uint64 start_micros_ = 0;
+
+    TF_DISALLOW_COPY_AND_ASSIGN(ScopedStep);
+  };
+
+ private:
+  SharedThreadPoolRegistry() = default;
+
+  // Returns the pool with index "pool_index" of "session", or "nullptr" if that pool is not a named pool.
+  Pool* FindPool(const void* session, int32 pool_index);
+
+  // Number of attached sessions, which allows steps of other sessions to skip the lookup.
+  std::atomic<int64> num_attached_sessions_{0};
+
+  std::mutex mu_;
+  // Pools are never removed, since TensorFlow never deletes named pools, and so pointers to them remain valid.
+  std::map<string, std::unique_ptr<Pool>> pools_;
+  // Pools of each attached session, by pool index, with "nullptr" for pools that are not named pools.
+  std::unordered_map<const void*, std::vector<Pool*>> sessions_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(SharedThreadPoolRegistry);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_SHARED_THREAD_POOLS_H_
@@ -0,0 +1,220 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/step_stats_aggregator.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/lib/strings/stringprintf.h"
+
+namespace tensorflow {
+
+namespace {
+
+// Extracts the op type from a timeline label of the form
+// "node_name = OpType(inputs)".
+string OpTypeFromTimelineLabel(const string& label) {
+  const size_t start = label.find(" = ");
+  if (start == string::npos) return "Unknown";
+  const size_t end = label.find('(', start + 3);
+  return label.substr(start + 3, end == string::npos ? end : end - start - 3);
+}
+
+}  // namespace
+
+StepStatsAggregator::StepStatsAggregator(int64 sampling_period)
+    : sampling_period_(std::max<int64>(sampling_period, 1)) {}
+
+bool StepStatsAggregator::ShouldSample() {
+  mutex_lock l(mu_);
+  return num_calls_++ % sampling_period_ == 0;
+}
+
+void StepStatsAggregator::AddStep(const StepStats& step_stats) {
+  mutex_lock l(mu_);
+  ++num_steps_;
+  for (const DeviceStepStats& device_stats : step_stats.dev_stats()) {
+    for (const NodeExecStats& node : device_stats.node_stats()) {
+      Stats& stats = node_stats_[node.node_name()];
+      const int64 micros = node.all_end_rel_micros();
+      if (stats.count == 0) {
+        stats.op_type = OpTypeFromTimelineLabel(node.timeline_label());
+        stats.device = device_stats.device();
+        stats.first_micros = micros;
+        stats.min_micros = micros;
+      }
+      ++stats.count;
+      stats.total_micros += micros;
+      stats.min_micros = std::min(stats.min_micros, micros);
+      int64 peak_bytes = 0;
+      for (const AllocatorMemoryUsed& memory : node.memory()) {
+        stats.total_bytes += memory.total_bytes();
+        peak_bytes = std::max<int64>(peak_bytes, memory.peak_bytes());
+      }
+      stats.peak_bytes = std::max(stats.peak_bytes, peak_bytes);
+    }
+  }
+}
+
+bool StepStatsAggregator::ShouldCollectPartitionGraphs(const void* step) {
+  mutex_lock l(mu_);
+  return partitioned_steps_.insert(step).second;
+}
+
+void StepStatsAggregator::AddPartitionGraph(const GraphDef& graph) {
+  std::map<string, int> function_sizes;
+  for (const FunctionDef& function : graph.library().function())
+    function_sizes[function.signature().name()] = function.node_def_size();
+  mutex_lock l(mu_);
+  for (const NodeDef& node : graph.node()) {
+    if (node.op() != "_XlaLaunch") continue;
+    Cluster& cluster = clusters_[node.name()];
+    const auto function = node.attr().find("function");
+    if (function != node.attr().end()) {
+      cluster.function = function->second.func().name();
+      cluster.num_ops = function_sizes[cluster.function];
+    }
+  }
+}
+
+void StepStatsAggregator::Reset() {
+  mutex_lock l(mu_);
+  num_steps_ = 0;
+  node_stats_.clear();
+  partitioned_steps_.clear();
+  clusters_.clear();
+}
+
+int64 StepStatsAggregator::NumSteps() const {
+  mutex_lock l(mu_);
+  return num_steps_;
+}
+
+string StepStatsAggregator::Summary(bool by_node, int max_rows) const {
+  mutex_lock l(mu_);
+  std::vector<std::pair<string, Stats>> rows;
+  if (by_node) {
+    rows.assign(node_stats_.begin(), node_stats_.end());
+  } else {
+    std::map<string, Stats> type_stats;
+    for (const auto& node : node_stats_) {
+      Stats& stats = type_stats[node.second.op_type];
+      stats.op_type = node.second.op_type;
+      stats.count += node.second.count;
+      stats.total_micros += node.second.total_micros;
+      stats.total_bytes += node.second.total_bytes;
+      stats.peak_bytes = std::max(stats.peak_bytes, node.second.peak_bytes);
+    }
+    rows.assign(type_stats.begin(), type_stats.end());
+  }
+  std::sort(rows.begin(), rows.end(),
+            [](const std::pair<string, Stats>& a,
+               const std::pair<string, Stats>& b) {
+              return a.second.total_micros > b.second.total_micros;
+            });
+  if (max_rows > 0 && rows.size() > static_cast<size_t>(max_rows))
+    rows.resize(static_cast<size_t>(max_rows));
+
+  int64 total_micros = 0;
+  for (const auto& node : node_stats_) total_micros += node.second.total_micros;
+
+  string summary = strings::Printf(
+      "Profiled %lld steps with a total execution time of %.3f ms.\n",
+      static_cast<long long>(num_steps_), total_micros / 1000.0);
+  if (by_node) {
+    strings::StrAppend(
+        &summary, strings::Printf("%-40s %-20s %-30s ", "Node", "Op Type",
+                                  "Device"));
+  } else {
+    strings::StrAppend(&summary, strings::Printf("%-20s ", "Op Type"));
+  }
+  strings::StrAppend(
+      &summary,
+      strings::Printf("%10s %12s %12s %8s %14s %14s\n", "Calls", "Total (ms)",
+                      "Mean (us)", "%", "Mean (bytes)", "Peak (bytes)"));
+  for (const auto& row : rows) {
+    const Stats& stats = row.second;
+    if (by_node) {
+      strings::StrAppend(
+          &summary,
+          strings::Printf("%-40s %-20s %-30s ", row.first.c_str(),
+                          stats.op_type.c_str(), stats.device.c_str()));
+    } else {
+      strings::StrAppend(&summary,
+                         strings::Printf("%-20s ", row.first.c_str()));
+    }
+    strings::StrAppend(
+        &summary,
+        strings::Printf(
+            "%10lld %12.3f %12.1f %8.2f %14lld %14lld\n",
+            static_cast<long long>(stats.count), stats.total_micros / 1000.0,
+            static_cast<double>(stats.total_micros) / stats.count,
+            total_micros > 0 ? 100.0 * stats.total_micros / total_micros : 0.0,
+            static_cast<long long>(stats.total_bytes / stats.count),
+            static_cast<long long>(stats.peak_bytes)));
+  }
+  return summary;
+}
+
+string StepStatsAggregator::JitSummary() const {
+  mutex_lock l(mu_);
+  string rows;
+  int64 num_clusters = 0;
+  int64 num_executions = 0;
+  int64 compile_micros = 0;
+  for (const auto& node : node_stats_) {
+    const Stats& stats = node.second;
+    if (stats.op_type != "_XlaLaunch") continue;
+    const auto cluster = clusters_.find(node.first);
+    const int64 cluster_compile_micros = stats.first_micros - stats.min_micros;
+    ++num_clusters;
+    num_executions += stats.count;
+    compile_micros += cluster_compile_micros;
+    strings::StrAppend(
+        &rows,
+        strings::Printf(
+            "%-30s %-30s %8s %10lld %14.3f %14.3f %14.3f\n",
+            node.first.c_str(),
+            cluster == clusters_.end() ? "?" : cluster->second.function.c_str(),
+            cluster == clusters_.end()
+                ? "?"
+                : strings::StrCat(cluster->second.num_ops).c_str(),
+            static_cast<long long>(stats.count), stats.first_micros / 1000.0,
+            static_cast<double>(stats.total_micros) / stats.count / 1000.0,
+            cluster_compile_micros / 1000.0));
+  }
+  string summary = strings::Printf(
+      "Profiled %lld steps that executed %lld XLA clusters, %lld times in "
+      "total, with an estimated compilation time of %.3f ms and %lld "
+      "compilation cache hits (%.1f%%).\n",
+      static_cast<long long>(num_steps_), static_cast<long long>(num_clusters),
+      static_cast<long long>(num_executions), compile_micros / 1000.0,
+      static_cast<long long>(num_executions - num_clusters),
+      num_executions > 0
+          ? 100.0 * (num_executions - num_clusters) / num_executions
+          : 0.0);
+  if (num_clusters == 0) return summary;
+  strings::StrAppend(
+      &summary,
+      strings::Printf("%-30s %-30s %8s %10s %14s %14s %14s\n", "Cluster",
+                      "Function", "Ops", "Executions", "First (ms)",
+                      "Mean (ms)", "Compile (ms)"));
+  strings::StrAppend(&summary, rows);
+  return summary;
+}
+
+}  // namespace tensorflow
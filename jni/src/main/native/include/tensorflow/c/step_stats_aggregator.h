@@ -0,0 +1,108 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_STEP_STATS_AGGREGATOR_H_
+#define TENSORFLOW_C_STEP_STATS_AGGREGATOR_H_
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/framework/step_stats.pb.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Aggregates the per-node execution statistics of session steps (i.e., the
+// "StepStats" of their run metadata) over many steps, so that they can be
+// profiled without handing the run metadata of every step to the client.
+// Only every "sampling_period"-th step is traced, which allows keeping
+// profiling enabled at a low cost. This class is thread-safe.
+class StepStatsAggregator {
+ public:
+  explicit StepStatsAggregator(int64 sampling_period);
+
+  // Returns true if the next step should be traced and its statistics added
+  // using "AddStep".
+  bool ShouldSample();
+
+  // Adds the statistics of a traced step.
+  void AddStep(const StepStats& step_stats);
+
+  // Returns true if the partition graphs of the next traced step of "step"
+  // (e.g., a callable) should also be collected and added using
+  // "AddPartitionGraph". They are only needed once for each step, in order to
+  // find the XLA clusters that it executes.
+  bool ShouldCollectPartitionGraphs(const void* step);
+
+  // Records the XLA clusters (i.e., "_XlaLaunch" nodes) of a partition graph.
+  void AddPartitionGraph(const GraphDef& graph);
+
+  // Discards all statistics added so far.
+  void Reset();
+
+  // Returns the number of steps whose statistics have been added so far.
+  int64 NumSteps() const;
+
+  // Returns a table summarizing the statistics added so far, with one row for
+  // each node (if "by_node" is true) or for each op type (otherwise), sorted
+  // in descending order of total execution time. At most "max_rows" rows are
+  // included, unless "max_rows" is not positive.
+  string Summary(bool by_node, int max_rows) const;
+
+  // Returns a table summarizing the XLA clusters executed by the steps added
+  // so far, along with their execution statistics. XLA compiles a cluster the
+  // first time it is executed with some input shapes and caches the result,
+  // and so the compilation time of each cluster is estimated as the difference
+  // between its first and its fastest execution time, and its executions
+  // after the first are counted as compilation cache hits (assuming that its
+  // input shapes do not change).
+  string JitSummary() const;
+
+ private:
+  struct Stats {
+    string op_type;
+    string device;
+    int64 count = 0;
+    int64 total_micros = 0;
+    int64 total_bytes = 0;
+    int64 peak_bytes = 0;
+    int64 first_micros = 0;
+    int64 min_micros = 0;
+  };
+
+  struct Cluster {
+    string function;
+    int num_ops = 0;
+  };
+
+  const int64 sampling_period_;
+  mutable mutex mu_;
+  int64 num_calls_ GUARDED_BY(mu_) = 0;
+  int64 num_steps_ GUARDED_BY(mu_) = 0;
+  std::map<string, Stats> node_stats_ GUARDED_BY(mu_);
+  std::set<const void*> partitioned_steps_ GUARDED_BY(mu_);
+  std::map<string, Cluster> clusters_ GUARDED_BY(mu_);
+
+  TF_DISALLOW_COPY_AND_ASSIGN(StepStatsAggregator);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_STEP_STATS_AGGREGATOR_H_
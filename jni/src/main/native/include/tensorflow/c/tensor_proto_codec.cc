@@ -0,0 +1,312 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/tensor_proto_codec.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <memory>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/framework/tensor_shape.pb.h"
+#include "tensorflow/core/lib/core/coding.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+namespace tensorflow {
+namespace {
+
+// TensorProto field numbers.
+const uint32 kDtypeField = 1;
+const uint32 kTensorShapeField = 2;
+const uint32 kVersionNumberField = 3;
+const uint32 kTensorContentField = 4;
+
+const uint32 kVarintWireType = 0;
+const uint32 kLengthDelimitedWireType = 2;
+
+uint32 Tag(uint32 field, uint32 wire_type) { return (field << 3) | wire_type; }
+
+// Serialization of a tensor, which consists of an encoded prefix, followed by
+// the (not owned) contents of the tensor buffer.
+struct Serialization {
+  string prefix;
+  const char* content = nullptr;
+  uint64 content_size = 0;
+
+  uint64 size() const { return prefix.size() + content_size; }
+};
+
+Status Serialize(const TF_Tensor* tensor, Serialization* serialization) {
+  const TF_DataType dtype = TF_TensorType(tensor);
+  if (dtype == TF_RESOURCE || dtype == TF_VARIANT)
+    return errors::Unimplemented("Tensors of data type ", dtype,
+                                 " cannot be serialized.");
+  if (dtype == TF_STRING) {
+    Tensor t;
+    TF_RETURN_IF_ERROR(TF_TensorToTensor(tensor, &t));
+    TensorProto proto;
+    t.AsProtoField(&proto);
+    if (proto.ByteSizeLong() > static_cast<size_t>(INT_MAX))
+      return errors::InvalidArgument(
+          "Cannot serialize string tensors whose serialization is larger "
+          "than 2GB.");
+    proto.SerializeToString(&serialization->prefix);
+    return Status::OK();
+  }
+  TensorShapeProto shape;
+  for (int d = 0; d < TF_NumDims(tensor); ++d)
+    shape.add_dim()->set_size(TF_Dim(tensor, d));
+  string& prefix = serialization->prefix;
+  if (dtype != 0) {
+    core::PutVarint32(&prefix, Tag(kDtypeField, kVarintWireType));
+    core::PutVarint64(&prefix, static_cast<uint64>(dtype));
+  }
+  core::PutVarint32(&prefix, Tag(kTensorShapeField, kLengthDelimitedWireType));
+  core::PutVarint64(&prefix, shape.ByteSizeLong());
+  shape.AppendToString(&prefix);
+  serialization->content = static_cast<const char*>(TF_TensorData(tensor));
+  serialization->content_size = TF_TensorByteSize(tensor);
+  if (serialization->content_size > 0) {
+    core::PutVarint32(&prefix,
+                      Tag(kTensorContentField, kLengthDelimitedWireType));
+    core::PutVarint64(&prefix, serialization->content_size);
+  }
+  return Status::OK();
+}
+
+// Sequential reader over a serialization that is split across chunks.
+class ChunkedInput {
+ public:
+  explicit ChunkedInput(const std::vector<StringPiece>& chunks)
+      : chunks_(chunks) {
+    SkipEmptyChunks();
+  }
+
+  bool AtEnd() const { return chunk_ >= chunks_.size(); }
+
+  bool ReadVarint64(uint64* value) {
+    *value = 0;
+    for (int shift = 0; shift < 64 && !AtEnd(); shift += 7) {
+      const uint8 byte = static_cast<uint8>(chunks_[chunk_][position_]);
+      Advance(1);
+      *value |= static_cast<uint64>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+  }
+
+  // Copies the next "n" bytes to "dst", or skips them, if "dst" is null.
+  bool Read(uint64 n, char* dst) {
+    while (n > 0) {
+      if (AtEnd()) return false;
+      const uint64 available = chunks_[chunk_].size() - position_;
+      const uint64 count = std::min(n, available);
+      if (dst != nullptr) {
+        std::memcpy(dst, chunks_[chunk_].data() + position_,
+                    static_cast<size_t>(count));
+        dst += count;
+      }
+      Advance(count);
+      n -= count;
+    }
+    return true;
+  }
+
+ private:
+  void Advance(uint64 n) {
+    position_ += n;
+    if (position_ == chunks_[chunk_].size()) {
+      ++chunk_;
+      position_ = 0;
+      SkipEmptyChunks();
+    }
+  }
+
+  void SkipEmptyChunks() {
+    while (chunk_ < chunks_.size() && chunks_[chunk_].empty()) ++chunk_;
+  }
+
+  const std::vector<StringPiece>& chunks_;
+  size_t chunk_ = 0;
+  uint64 position_ = 0;
+};
+
+// Parses protos that use fields other than "dtype", "tensor_shape",
+// "version_number", and "tensor_content", using "Tensor::FromProto".
+Status ParseTensorProtoFallback(const std::vector<StringPiece>& chunks,
+                                TF_Tensor** tensor) {
+  uint64 size = 0;
+  for (const StringPiece& chunk : chunks) size += chunk.size();
+  if (size > static_cast<uint64>(INT_MAX))
+    return errors::InvalidArgument(
+        "Cannot parse TensorProtos larger than 2GB, unless their values are "
+        "stored in the 'tensor_content' field.");
+  string serialized;
+  serialized.reserve(static_cast<size_t>(size));
+  for (const StringPiece& chunk : chunks)
+    serialized.append(chunk.data(), chunk.size());
+  google::protobuf::io::CodedInputStream input(
+      reinterpret_cast<const uint8*>(serialized.data()),
+      static_cast<int>(serialized.size()));
+  input.SetTotalBytesLimit(INT_MAX, INT_MAX);
+  TensorProto proto;
+  if (!proto.ParseFromCodedStream(&input))
+    return errors::InvalidArgument("Unable to parse the TensorProto.");
+  Tensor t;
+  if (!t.FromProto(proto))
+    return errors::InvalidArgument("Invalid TensorProto: ",
+                                   proto.ShortDebugString().substr(0, 256));
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(
+      TF_NewStatus(), TF_DeleteStatus);
+  *tensor = TF_TensorFromTensor(t, status.get());
+  if (TF_GetCode(status.get()) != TF_OK)
+    return Status(static_cast<error::Code>(TF_GetCode(status.get())),
+                  TF_Message(status.get()));
+  return Status::OK();
+}
+
+}  // namespace
+
+Status TensorProtoSize(const TF_Tensor* tensor, uint64* size) {
+  Serialization serialization;
+  TF_RETURN_IF_ERROR(Serialize(tensor, &serialization));
+  *size = serialization.size();
+  return Status::OK();
+}
+
+Status SerializeTensorProto(const TF_Tensor* tensor, uint64 offset, char* dst,
+                            uint64 capacity, uint64* num_written) {
+  Serialization serialization;
+  TF_RETURN_IF_ERROR(Serialize(tensor, &serialization));
+  *num_written = 0;
+  const uint64 prefix_size = serialization.prefix.size();
+  if (offset < prefix_size) {
+    const uint64 count = std::min(capacity, prefix_size - offset);
+    std::memcpy(dst, serialization.prefix.data() + offset,
+                static_cast<size_t>(count));
+    *num_written += count;
+  }
+  const uint64 content_offset =
+      std::max(offset, prefix_size) - prefix_size;
+  if (content_offset < serialization.content_size) {
+    const uint64 count =
+        std::min(capacity - *num_written,
+                 serialization.content_size - content_offset);
+    std::memcpy(dst + *num_written, serialization.content + content_offset,
+                static_cast<size_t>(count));
+    *num_written += count;
+  }
+  return Status::OK();
+}
+
+Status ParseTensorProto(const std::vector<StringPiece>& chunks,
+                        TF_Tensor** tensor) {
+  *tensor = nullptr;
+  ChunkedInput input(chunks);
+  TF_DataType dtype = static_cast<TF_DataType>(0);
+  std::vector<int64_t> dims;
+  bool has_shape = false;
+  bool has_content = false;
+  string early_content;
+  std::unique_ptr<TF_Tensor, decltype(&TF_DeleteTensor)> result(
+      nullptr, TF_DeleteTensor);
+  while (!input.AtEnd()) {
+    uint64 tag;
+    if (!input.ReadVarint64(&tag))
+      return errors::InvalidArgument("Unable to parse the TensorProto.");
+    const uint32 field = static_cast<uint32>(tag >> 3);
+    const uint32 wire_type = static_cast<uint32>(tag & 7);
+    uint64 value;
+    if (field == kDtypeField && wire_type == kVarintWireType) {
+      if (!input.ReadVarint64(&value))
+        return errors::InvalidArgument("Unable to parse the TensorProto.");
+      dtype = static_cast<TF_DataType>(value);
+    } else if (field == kVersionNumberField && wire_type == kVarintWireType) {
+      if (!input.ReadVarint64(&value))
+        return errors::InvalidArgument("Unable to parse the TensorProto.");
+    } else if (field == kTensorShapeField &&
+               wire_type == kLengthDelimitedWireType) {
+      string serialized_shape;
+      TensorShapeProto shape;
+      if (!input.ReadVarint64(&value) || value > static_cast<uint64>(INT_MAX))
+        return errors::InvalidArgument("Unable to parse the TensorProto.");
+      serialized_shape.resize(static_cast<size_t>(value));
+      if (!input.Read(value, &serialized_shape[0]) ||
+          !shape.ParseFromString(serialized_shape))
+        return errors::InvalidArgument("Unable to parse the TensorProto.");
+      if (shape.unknown_rank())
+        return errors::InvalidArgument(
+            "TensorProtos must have shapes with known rank.");
+      has_shape = true;
+      dims.clear();
+      for (const TensorShapeProto::Dim& dim : shape.dim())
+        dims.push_back(static_cast<int64_t>(dim.size()));
+    } else if (field == kTensorContentField &&
+               wire_type == kLengthDelimitedWireType) {
+      if (!input.ReadVarint64(&value))
+        return errors::InvalidArgument("Unable to parse the TensorProto.");
+      has_content = true;
+      // The content is normally preceded by the data type and the shape, in
+      // which case it is copied directly into the tensor buffer.
+      if (dtype != 0 && has_shape) {
+        result.reset(TF_AllocateTensor(dtype, dims.data(),
+                                       static_cast<int>(dims.size()),
+                                       static_cast<size_t>(value)));
+        if (!input.Read(value, static_cast<char*>(TF_TensorData(result.get()))))
+          return errors::InvalidArgument("Unable to parse the TensorProto.");
+      } else {
+        early_content.resize(static_cast<size_t>(value));
+        if (!input.Read(value, &early_content[0]))
+          return errors::InvalidArgument("Unable to parse the TensorProto.");
+      }
+    } else {
+      return ParseTensorProtoFallback(chunks, tensor);
+    }
+  }
+  if (dtype == 0 || dtype == TF_STRING || dtype == TF_RESOURCE ||
+      dtype == TF_VARIANT)
+    return ParseTensorProtoFallback(chunks, tensor);
+  int64 num_elements = 1;
+  for (int64_t dim : dims) num_elements *= dim;
+  const uint64 num_bytes =
+      static_cast<uint64>(num_elements) * TF_DataTypeSize(dtype);
+  if (!has_content) {
+    // Tensors without any values are encoded without a "tensor_content".
+    if (num_elements != 0) return ParseTensorProtoFallback(chunks, tensor);
+    result.reset(TF_AllocateTensor(dtype, dims.data(),
+                                   static_cast<int>(dims.size()), 0));
+  } else if (result == nullptr) {
+    result.reset(TF_AllocateTensor(dtype, dims.data(),
+                                   static_cast<int>(dims.size()),
+                                   early_content.size()));
+    std::memcpy(TF_TensorData(result.get()), early_content.data(),
+                early_content.size());
+  }
+  if (TF_TensorByteSize(result.get()) != num_bytes ||
+      TF_NumDims(result.get()) != static_cast<int>(dims.size()))
+    return errors::InvalidArgument(
+        "The size of the 'tensor_content' field of the TensorProto (",
+        TF_TensorByteSize(result.get()),
+        " bytes) does not match its data type and shape (", num_bytes,
+        " bytes).");
+  *tensor = result.release();
+  return Status::OK();
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,59 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_TENSOR_PROTO_CODEC_H_
+#define TENSORFLOW_C_TENSOR_PROTO_CODEC_H_
+
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Streaming TensorProto serialization and parsing, which avoids materializing
+// the serialized proto (or a proto object) for numeric tensors, and which is
+// therefore not subject to the 2GB protobuf message size limit.
+//
+// Numeric tensors are serialized in the same way as by
+// "Tensor::AsProtoTensorContent" (i.e., with their contents in the
+// "tensor_content" field), which is encoded directly from the tensor buffer.
+// String tensors are serialized as by "Tensor::AsProtoField" and are subject to
+// the protobuf size limit.
+
+// Sets "size" to the size of the serialization of "tensor", in bytes.
+Status TensorProtoSize(const TF_Tensor* tensor, uint64* size);
+
+// Writes bytes "[offset, offset + capacity)" of the serialization of "tensor"
+// (or fewer, if the serialization ends earlier) to "dst", and sets
+// "num_written" to the number of bytes written. This allows serializing large
+// tensors in chunks, into buffers of bounded size.
+Status SerializeTensorProto(const TF_Tensor* tensor, uint64 offset, char* dst,
+                            uint64 capacity, uint64* num_written);
+
+// Parses a TensorProto whose serialization is split across "chunks" (in
+// order) and sets "tensor" to the parsed tensor, which is then owned by the
+// caller. The "tensor_content" field is copied from the chunks directly into
+// the tensor buffer. Protos that use the typed value fields (e.g.,
+// "float_val") are parsed using "Tensor::FromProto" and are subject to the
+// protobuf size limit.
+Status ParseTensorProto(const std::vector<StringPiece>& chunks,
+                        TF_Tensor** tensor);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_TENSOR_PROTO_CODEC_H_
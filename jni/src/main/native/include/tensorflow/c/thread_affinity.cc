@@ -0,0 +1,123 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/c/thread_affinity.h"
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/strings/numbers.h"
+#include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace {
+
+// Parses a Linux CPU list (e.g., "0-23,48-71").
+Status ParseCpuList(string cpu_list, std::vector<int>* cpus) {
+  str_util::StripTrailingWhitespace(&cpu_list);
+  for (const string& range :
+       str_util::Split(cpu_list, ',', str_util::SkipEmpty())) {
+    const std::vector<string> bounds = str_util::Split(range, '-');
+    int32 first, last;
+    if (bounds.size() > 2 || !strings::safe_strto32(bounds[0], &first) ||
+        !strings::safe_strto32(bounds.back(), &last) || first > last) {
+      return errors::InvalidArgument("Invalid CPU list: '", cpu_list, "'.");
+    }
+    for (int cpu = first; cpu <= last; ++cpu) cpus->push_back(cpu);
+  }
+  return Status::OK();
+}
+
+#ifdef __linux__
+Status GetCurrentThreadAffinity(std::vector<int>* cpus) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+    return errors::Internal("Failed to get the CPU affinity of the thread.");
+  }
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpu_set)) cpus->push_back(cpu);
+  }
+  return Status::OK();
+}
+#endif
+
+}  // namespace
+
+Status ResolveCpuSet(const std::vector<int>& cpus, int numa_node,
+                     std::vector<int>* resolved) {
+  resolved->assign(cpus.begin(), cpus.end());
+  if (numa_node >= 0) {
+    string cpu_list;
+    const Status s = ReadFileToString(
+        Env::Default(),
+        strings::StrCat("/sys/devices/system/node/node", numa_node,
+                        "/cpulist"),
+        &cpu_list);
+    if (!s.ok()) {
+      return errors::InvalidArgument("Failed to find the CPUs of NUMA node ",
+                                     numa_node, ": ", s.error_message());
+    }
+    TF_RETURN_IF_ERROR(ParseCpuList(cpu_list, resolved));
+  }
+  std::sort(resolved->begin(), resolved->end());
+  resolved->erase(std::unique(resolved->begin(), resolved->end()),
+                  resolved->end());
+  return Status::OK();
+}
+
+Status SetCurrentThreadAffinity(const std::vector<int>& cpus) {
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return errors::InvalidArgument("Invalid CPU index: ", cpu, ".");
+    }
+    CPU_SET(cpu, &cpu_set);
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+    return errors::InvalidArgument(
+        "Failed to set the CPU affinity of the thread. Please make sure that "
+        "the requested CPUs exist and are available to this process.");
+  }
+  return Status::OK();
+#else
+  return errors::Unimplemented(
+      "Setting thread CPU affinities is only supported on Linux.");
+#endif
+}
+
+ScopedThreadAffinity::ScopedThreadAffinity(const std::vector<int>& cpus) {
+  if (cpus.empty()) return;
+#ifdef __linux__
+  status_ = GetCurrentThreadAffinity(&original_cpus_);
+  if (!status_.ok()) return;
+#endif
+  status_ = SetCurrentThreadAffinity(cpus);
+  restore_ = status_.ok();
+}
+
+ScopedThreadAffinity::~ScopedThreadAffinity() {
+  if (restore_) SetCurrentThreadAffinity(original_cpus_).IgnoreError();
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,57 @@
+/* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_C_THREAD_AFFINITY_H_
+#define TENSORFLOW_C_THREAD_AFFINITY_H_
+
+#include <vector>
+
+#include "tensorflow/core/lib/core/status.h"
+
+namespace tensorflow {
+
+// Resolves a CPU set, given as a list of CPU indices and/or a NUMA node (which
+// stands for all the CPUs of that node, and is ignored if negative), into a
+// sorted list of unique CPU indices.
+Status ResolveCpuSet(const std::vector<int>& cpus, int numa_node,
+                     std::vector<int>* resolved);
+
+// Sets the CPU affinity of the calling thread to "cpus".
+Status SetCurrentThreadAffinity(const std::vector<int>& cpus);
+
+// Restricts the calling thread to a CPU set for the lifetime of this object
+// and restores its original affinity afterwards. Threads started by the
+// calling thread in the meantime inherit the restricted affinity, which is
+// used to pin the thread pools that sessions and contexts create when they
+// are constructed. An empty CPU set leaves the affinity unchanged.
+class ScopedThreadAffinity {
+ public:
+  explicit ScopedThreadAffinity(const std::vector<int>& cpus);
+  ~ScopedThreadAffinity();
+
+  const Status& status() const { return status_; }
+
+ private:
+  Status status_;
+  bool restore_ = false;
+  std::vector<int> original_cpus_;
+
+  ScopedThreadAffinity(const ScopedThreadAffinity&) = delete;
+  void operator=(const ScopedThreadAffinity&) = delete;
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_C_THREAD_AFFINITY_H_
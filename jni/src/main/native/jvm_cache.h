@@ -0,0 +1,236 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#ifndef TENSORFLOW_JNI_JVM_CACHE_H_
+#define TENSORFLOW_JNI_JVM_CACHE_H_
+
+#include <jni.h>
+
+// Global class references and method/field IDs that are used by the native library. They are all looked up once, when
+// the library is loaded (i.e., in "JNI_OnLoad"), because "FindClass" is slow, takes locks, and cannot see application
+// classes when called from natively attached threads.
+struct JVMCache {
+  jclass string_class = nullptr;
+  jclass byte_buffer_class = nullptr;
+  jclass byte_array_class = nullptr;
+
+  jclass output_class = nullptr;
+  jfieldID output_op_handle_field = nullptr;
+  jfieldID output_output_index_field = nullptr;
+  jmethodID output_apply = nullptr;
+
+  jclass file_statistics_class = nullptr;
+  jmethodID file_statistics_apply = nullptr;
+
+  jclass file_listing_class = nullptr;
+  jmethodID file_listing_apply = nullptr;
+
+  jclass checkpoint_variables_class = nullptr;
+  jmethodID checkpoint_variables_apply = nullptr;
+
+  jclass graph_snapshot_class = nullptr;
+  jmethodID graph_snapshot_apply = nullptr;
+
+  jclass op_signature_class = nullptr;
+  jmethodID op_signature_apply = nullptr;
+
+  jclass graph_cost_report_class = nullptr;
+  jmethodID graph_cost_report_apply = nullptr;
+
+  jclass collected_metrics_class = nullptr;
+  jmethodID collected_metrics_apply = nullptr;
+
+  jclass allocator_statistics_class = nullptr;
+  jmethodID allocator_statistics_apply = nullptr;
+
+  jclass tensor_pool_statistics_class = nullptr;
+  jmethodID tensor_pool_statistics_apply = nullptr;
+
+  jclass shared_thread_pool_statistics_class = nullptr;
+  jmethodID shared_thread_pool_statistics_apply = nullptr;
+
+  jclass record_reader_statistics_class = nullptr;
+  jmethodID record_reader_statistics_apply = nullptr;
+
+  jclass scalar_events_class = nullptr;
+  jmethodID scalar_events_apply = nullptr;
+
+  jclass handle_statistics_class = nullptr;
+  jmethodID handle_statistics_apply = nullptr;
+
+  jclass callbacks_registry_class = nullptr;
+  jmethodID callbacks_registry_call = nullptr;
+  jmethodID callbacks_registry_call_async = nullptr;
+  jmethodID callbacks_registry_call_batch = nullptr;
+  jmethodID callbacks_registry_call_buffers = nullptr;
+
+  jclass async_run_callback_class = nullptr;
+  jmethodID async_run_callback_on_success = nullptr;
+  jmethodID async_run_callback_on_failure = nullptr;
+};
+
+// Returns the cache shared by all translation units of the native library.
+inline JVMCache& jvm_cache() {
+  static JVMCache cache;
+  return cache;
+}
+
+namespace {
+  inline jclass cache_class(JNIEnv* env, const char* name) {
+    jclass local_class = env->FindClass(name);
+    if (local_class == nullptr) return nullptr;
+    jclass global_class = static_cast<jclass>(env->NewGlobalRef(local_class));
+    env->DeleteLocalRef(local_class);
+    return global_class;
+  }
+}  // namespace
+
+// Populates the cache. Returns false, with an exception pending, if any of the classes or members cannot be found.
+inline bool initialize_jvm_cache(JNIEnv* env) {
+  JVMCache& cache = jvm_cache();
+
+  cache.string_class = cache_class(env, "java/lang/String");
+  if (cache.string_class == nullptr) return false;
+  cache.byte_buffer_class = cache_class(env, "java/nio/ByteBuffer");
+  if (cache.byte_buffer_class == nullptr) return false;
+  cache.byte_array_class = cache_class(env, "[B");
+  if (cache.byte_array_class == nullptr) return false;
+
+  cache.output_class = cache_class(env, "org/platanios/tensorflow/jni/Output");
+  if (cache.output_class == nullptr) return false;
+  cache.output_op_handle_field = env->GetFieldID(cache.output_class, "opHandle", "J");
+  if (cache.output_op_handle_field == nullptr) return false;
+  cache.output_output_index_field = env->GetFieldID(cache.output_class, "outputIndex", "I");
+  if (cache.output_output_index_field == nullptr) return false;
+  cache.output_apply = env->GetStaticMethodID(
+      cache.output_class, "apply", "(JI)Lorg/platanios/tensorflow/jni/Output;");
+  if (cache.output_apply == nullptr) return false;
+
+  cache.file_statistics_class = cache_class(env, "org/platanios/tensorflow/jni/FileStatistics");
+  if (cache.file_statistics_class == nullptr) return false;
+  cache.file_statistics_apply = env->GetStaticMethodID(
+      cache.file_statistics_class, "apply", "(JJZ)Lorg/platanios/tensorflow/jni/FileStatistics;");
+  if (cache.file_statistics_apply == nullptr) return false;
+
+  cache.file_listing_class = cache_class(env, "org/platanios/tensorflow/jni/FileListing");
+  if (cache.file_listing_class == nullptr) return false;
+  cache.file_listing_apply = env->GetStaticMethodID(
+      cache.file_listing_class, "apply", "([Ljava/lang/String;[J[J[Z)Lorg/platanios/tensorflow/jni/FileListing;");
+  if (cache.file_listing_apply == nullptr) return false;
+
+  cache.checkpoint_variables_class = cache_class(env, "org/platanios/tensorflow/jni/CheckpointVariables");
+  if (cache.checkpoint_variables_class == nullptr) return false;
+  cache.checkpoint_variables_apply = env->GetStaticMethodID(
+      cache.checkpoint_variables_class, "apply",
+      "([Ljava/lang/String;[I[I[J)Lorg/platanios/tensorflow/jni/CheckpointVariables;");
+  if (cache.checkpoint_variables_apply == nullptr) return false;
+
+  cache.graph_snapshot_class = cache_class(env, "org/platanios/tensorflow/jni/GraphSnapshot");
+  if (cache.graph_snapshot_class == nullptr) return false;
+  cache.graph_snapshot_apply = env->GetStaticMethodID(
+      cache.graph_snapshot_class, "apply",
+      "([J[Ljava/lang/String;[Ljava/lang/String;[Ljava/lang/String;[I[J[I[I[J[I[I[I[I[J)"
+      "Lorg/platanios/tensorflow/jni/GraphSnapshot;");
+  if (cache.graph_snapshot_apply == nullptr) return false;
+
+  cache.op_signature_class = cache_class(env, "org/platanios/tensorflow/jni/OpSignature");
+  if (cache.op_signature_class == nullptr) return false;
+  cache.op_signature_apply = env->GetStaticMethodID(
+      cache.op_signature_class, "apply",
+      "([Ljava/lang/String;[I[Ljava/lang/String;[I[Ljava/lang/String;[Ljava/lang/String;Z)"
+      "Lorg/platanios/tensorflow/jni/OpSignature;");
+  if (cache.op_signature_apply == nullptr) return false;
+
+  cache.graph_cost_report_class = cache_class(env, "org/platanios/tensorflow/jni/GraphCostReport");
+  if (cache.graph_cost_report_class == nullptr) return false;
+  cache.graph_cost_report_apply = env->GetStaticMethodID(
+      cache.graph_cost_report_class, "apply",
+      "(J[Ljava/lang/String;[J[J[Ljava/lang/String;[Ljava/lang/String;[Ljava/lang/String;[J[J[J)"
+      "Lorg/platanios/tensorflow/jni/GraphCostReport;");
+  if (cache.graph_cost_report_apply == nullptr) return false;
+
+  cache.collected_metrics_class = cache_class(env, "org/platanios/tensorflow/jni/CollectedMetrics");
+  if (cache.collected_metrics_class == nullptr) return false;
+  cache.collected_metrics_apply = env->GetStaticMethodID(
+      cache.collected_metrics_class, "apply",
+      "([Ljava/lang/String;[Ljava/lang/String;[J[[B[J)Lorg/platanios/tensorflow/jni/CollectedMetrics;");
+  if (cache.collected_metrics_apply == nullptr) return false;
+
+  cache.allocator_statistics_class = cache_class(env, "org/platanios/tensorflow/jni/AllocatorStatistics");
+  if (cache.allocator_statistics_class == nullptr) return false;
+  cache.allocator_statistics_apply = env->GetStaticMethodID(
+      cache.allocator_statistics_class, "apply",
+      "([Ljava/lang/String;[Ljava/lang/String;[J)Lorg/platanios/tensorflow/jni/AllocatorStatistics;");
+  if (cache.allocator_statistics_apply == nullptr) return false;
+
+  cache.tensor_pool_statistics_class = cache_class(env, "org/platanios/tensorflow/jni/TensorPoolStatistics");
+  if (cache.tensor_pool_statistics_class == nullptr) return false;
+  cache.tensor_pool_statistics_apply = env->GetStaticMethodID(
+      cache.tensor_pool_statistics_class, "apply", "(JJJJ)Lorg/platanios/tensorflow/jni/TensorPoolStatistics;");
+  if (cache.tensor_pool_statistics_apply == nullptr) return false;
+
+  cache.shared_thread_pool_statistics_class = cache_class(
+      env, "org/platanios/tensorflow/jni/SharedThreadPoolStatistics");
+  if (cache.shared_thread_pool_statistics_class == nullptr) return false;
+  cache.shared_thread_pool_statistics_apply = env->GetStaticMethodID(
+      cache.shared_thread_pool_statistics_class, "apply",
+      "([Ljava/lang/String;[J)Lorg/platanios/tensorflow/jni/SharedThreadPoolStatistics;");
+  if (cache.shared_thread_pool_statistics_apply == nullptr) return false;
+
+  cache.record_reader_statistics_class = cache_class(env, "org/platanios/tensorflow/jni/RecordReaderStatistics");
+  if (cache.record_reader_statistics_class == nullptr) return false;
+  cache.record_reader_statistics_apply = env->GetStaticMethodID(
+      cache.record_reader_statistics_class, "apply", "(JJJ)Lorg/platanios/tensorflow/jni/RecordReaderStatistics;");
+  if (cache.record_reader_statistics_apply == nullptr) return false;
+
+  cache.scalar_events_class = cache_class(env, "org/platanios/tensorflow/jni/ScalarEvents");
+  if (cache.scalar_events_class == nullptr) return false;
+  cache.scalar_events_apply = env->GetStaticMethodID(
+      cache.scalar_events_class, "apply", "([J[D[D)Lorg/platanios/tensorflow/jni/ScalarEvents;");
+  if (cache.scalar_events_apply == nullptr) return false;
+
+  cache.handle_statistics_class = cache_class(env, "org/platanios/tensorflow/jni/HandleStatistics");
+  if (cache.handle_statistics_class == nullptr) return false;
+  cache.handle_statistics_apply = env->GetStaticMethodID(
+      cache.handle_statistics_class, "apply",
+      "([Ljava/lang/String;[Ljava/lang/String;[J)Lorg/platanios/tensorflow/jni/HandleStatistics;");
+  if (cache.handle_statistics_apply == nullptr) return false;
+
+  cache.callbacks_registry_class = cache_class(env, "org/platanios/tensorflow/jni/ScalaCallbacksRegistry");
+  if (cache.callbacks_registry_class == nullptr) return false;
+  cache.callbacks_registry_call = env->GetStaticMethodID(cache.callbacks_registry_class, "call", "(I[J)[J");
+  if (cache.callbacks_registry_call == nullptr) return false;
+  cache.callbacks_registry_call_async = env->GetStaticMethodID(
+      cache.callbacks_registry_class, "callAsync", "(I[JJJ)V");
+  if (cache.callbacks_registry_call_async == nullptr) return false;
+  cache.callbacks_registry_call_batch = env->GetStaticMethodID(
+      cache.callbacks_registry_class, "callBatch", "(I[JI)[J");
+  if (cache.callbacks_registry_call_batch == nullptr) return false;
+  cache.callbacks_registry_call_buffers = env->GetStaticMethodID(
+      cache.callbacks_registry_class, "callBuffers", "(I[Ljava/nio/ByteBuffer;[I[J[I[Ljava/nio/ByteBuffer;)V");
+  if (cache.callbacks_registry_call_buffers == nullptr) return false;
+
+  cache.async_run_callback_class = cache_class(env, "org/platanios/tensorflow/jni/AsyncRunCallback");
+  if (cache.async_run_callback_class == nullptr) return false;
+  cache.async_run_callback_on_success = env->GetMethodID(cache.async_run_callback_class, "onSuccess", "([J[B)V");
+  if (cache.async_run_callback_on_success == nullptr) return false;
+  cache.async_run_callback_on_failure = env->GetMethodID(
+      cache.async_run_callback_class, "onFailure", "(ILjava/lang/String;)V");
+  if (cache.async_run_callback_on_failure == nullptr) return false;
+
+  return true;
+}
+
+#endif  // TENSORFLOW_JNI_JVM_CACHE_H_
@@ -0,0 +1,128 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "mapped_cache.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/mapped_cache.h"
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_newMappedCacheWriter(
+    JNIEnv* env, jobject object, jstring prefix) {
+  const char* c_prefix = env->GetStringUTFChars(prefix, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* writer = tensorflow::MappedCacheWriter::New(std::string(c_prefix), status.get());
+  env->ReleaseStringUTFChars(prefix, c_prefix);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(writer);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheWriterAppend(
+    JNIEnv* env, jobject object, jlong writer_handle, jlongArray tensor_handles) {
+  REQUIRE_HANDLE(writer, tensorflow::MappedCacheWriter, writer_handle, void());
+  const jsize num_tensors = env->GetArrayLength(tensor_handles);
+  std::unique_ptr<jlong[]> handles(new jlong[num_tensors]);
+  env->GetLongArrayRegion(tensor_handles, 0, num_tensors, handles.get());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  // The resolved tensors share the buffers of the eager tensors, for all data types that the cache supports.
+  std::vector<TF_Tensor*> element;
+  for (jsize i = 0; i < num_tensors && TF_GetCode(status.get()) == TF_OK; ++i) {
+    TFE_TensorHandle* tensor_handle = reinterpret_cast<TFE_TensorHandle*>(handles[i]);
+    if (tensor_handle == nullptr) {
+      for (TF_Tensor* tensor : element) TF_DeleteTensor(tensor);
+      throw_exception(env, jvm_null_pointer_exception, "Tensor handle %d is null.", i);
+      return;
+    }
+    if (!await_tensor_handle(env, tensor_handle)) {
+      for (TF_Tensor* tensor : element) TF_DeleteTensor(tensor);
+      return;
+    }
+    TF_Tensor* tensor = TFE_TensorHandleResolve(tensor_handle, status.get());
+    if (TF_GetCode(status.get()) == TF_OK) element.push_back(tensor);
+  }
+  if (TF_GetCode(status.get()) == TF_OK) writer->Append(element, status.get());
+  for (TF_Tensor* tensor : element) TF_DeleteTensor(tensor);
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheWriterFinish(
+    JNIEnv* env, jobject object, jlong writer_handle) {
+  REQUIRE_HANDLE(writer, tensorflow::MappedCacheWriter, writer_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  writer->Finish(status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_deleteMappedCacheWriter(
+    JNIEnv* env, jobject object, jlong writer_handle) {
+  REQUIRE_HANDLE(writer, tensorflow::MappedCacheWriter, writer_handle, void());
+  delete writer;
+}
+
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheExists(
+    JNIEnv* env, jobject object, jstring prefix) {
+  const char* c_prefix = env->GetStringUTFChars(prefix, nullptr);
+  const bool exists = tensorflow::MappedCacheReader::Exists(std::string(c_prefix));
+  env->ReleaseStringUTFChars(prefix, c_prefix);
+  return static_cast<jboolean>(exists);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_newMappedCacheReader(
+    JNIEnv* env, jobject object, jstring prefix) {
+  const char* c_prefix = env->GetStringUTFChars(prefix, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* reader = tensorflow::MappedCacheReader::New(std::string(c_prefix), status.get());
+  env->ReleaseStringUTFChars(prefix, c_prefix);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(reader);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheReaderNumElements(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::MappedCacheReader, reader_handle, 0);
+  return static_cast<jlong>(reader->num_elements());
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheReaderElement(
+    JNIEnv* env, jobject object, jlong reader_handle, jlong index) {
+  REQUIRE_HANDLE(reader, tensorflow::MappedCacheReader, reader_handle, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<TF_Tensor*> element;
+  reader->Element(static_cast<tensorflow::int64>(index), &element, status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  return tensors_to_tensor_handles(env, element);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheReaderBatch(
+    JNIEnv* env, jobject object, jlong reader_handle, jlong start, jlong count) {
+  REQUIRE_HANDLE(reader, tensorflow::MappedCacheReader, reader_handle, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<TF_Tensor*> batch;
+  reader->Batch(
+      static_cast<tensorflow::int64>(start), static_cast<tensorflow::int64>(count), &batch, status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  return tensors_to_tensor_handles(env, batch);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_deleteMappedCacheReader(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::MappedCacheReader, reader_handle, void());
+  delete reader;
+}
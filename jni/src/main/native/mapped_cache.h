@@ -0,0 +1,93 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_MappedCache__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_MappedCache__
+#define _Included_org_platanios_tensorflow_jni_MappedCache__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    newMappedCacheWriter
+ * Signature: (Ljava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_newMappedCacheWriter
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    mappedCacheWriterAppend
+ * Signature: (J[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheWriterAppend
+  (JNIEnv *, jobject, jlong, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    mappedCacheWriterFinish
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheWriterFinish
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    deleteMappedCacheWriter
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_deleteMappedCacheWriter
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    mappedCacheExists
+ * Signature: (Ljava/lang/String;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheExists
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    newMappedCacheReader
+ * Signature: (Ljava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_newMappedCacheReader
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    mappedCacheReaderNumElements
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheReaderNumElements
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    mappedCacheReaderElement
+ * Signature: (JJ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheReaderElement
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    mappedCacheReaderBatch
+ * Signature: (JJJ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_mappedCacheReaderBatch
+  (JNIEnv *, jobject, jlong, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_MappedCache__
+ * Method:    deleteMappedCacheReader
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_MappedCache_00024_deleteMappedCacheReader
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,72 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "monitoring.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+#include <string>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/metrics_exporter.h"
+#include "tensorflow/c/status_helper.h"
+
+namespace {
+  // Returns a copy of the provided Java string, or an empty string if it is null.
+  std::string to_string(JNIEnv* env, jstring string) {
+    if (string == nullptr) return std::string();
+    const char* c_string = env->GetStringUTFChars(string, nullptr);
+    std::string result(c_string);
+    env->ReleaseStringUTFChars(string, c_string);
+    return result;
+  }
+}  // namespace
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_collectMetrics(
+    JNIEnv* env, jobject object, jstring prefix) {
+  return collected_metrics_to_java(env, to_string(env, prefix));
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_collectOpenMetrics(
+    JNIEnv* env, jobject object, jstring prefix) {
+  const std::string metrics = tensorflow::CollectOpenMetrics(to_string(env, prefix));
+  jbyteArray metrics_array = env->NewByteArray(static_cast<jsize>(metrics.size()));
+  env->SetByteArrayRegion(
+      metrics_array, 0, static_cast<jsize>(metrics.size()), reinterpret_cast<const jbyte*>(metrics.data()));
+  return metrics_array;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_startMetricsHttpExporter(
+    JNIEnv* env, jobject object, jstring host, jint port, jstring prefix) {
+  std::unique_ptr<tensorflow::MetricsHttpExporter> exporter;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  tensorflow::Set_TF_Status_from_Status(status.get(), tensorflow::MetricsHttpExporter::Start(
+      to_string(env, host), static_cast<int>(port), to_string(env, prefix), &exporter));
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(exporter.release());
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_metricsHttpExporterPort(
+    JNIEnv* env, jobject object, jlong exporter_handle) {
+  REQUIRE_HANDLE(exporter, tensorflow::MetricsHttpExporter, exporter_handle, 0);
+  return static_cast<jint>(exporter->port());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_deleteMetricsHttpExporter(
+    JNIEnv* env, jobject object, jlong exporter_handle) {
+  REQUIRE_HANDLE(exporter, tensorflow::MetricsHttpExporter, exporter_handle, void());
+  delete exporter;
+}
@@ -0,0 +1,53 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_Monitoring__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_Monitoring__
+#define _Included_org_platanios_tensorflow_jni_Monitoring__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_Monitoring__
+ * Method:    collectMetrics
+ * Signature: (Ljava/lang/String;)Lorg/platanios/tensorflow/jni/CollectedMetrics;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_collectMetrics
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Monitoring__
+ * Method:    collectOpenMetrics
+ * Signature: (Ljava/lang/String;)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_collectOpenMetrics
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Monitoring__
+ * Method:    startMetricsHttpExporter
+ * Signature: (Ljava/lang/String;ILjava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_startMetricsHttpExporter
+  (JNIEnv *, jobject, jstring, jint, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Monitoring__
+ * Method:    metricsHttpExporterPort
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_metricsHttpExporterPort
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Monitoring__
+ * Method:    deleteMetricsHttpExporter
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Monitoring_00024_deleteMetricsHttpExporter
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,53 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "native_events.h"
+#include "exception.h"
+
+#include "tensorflow/c/native_event_recorder.h"
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_setEnabled(
+    JNIEnv* env, jobject object, jboolean enabled) {
+  tensorflow::NativeEventRecorder::SetEnabled(enabled == JNI_TRUE);
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_eventSize(
+    JNIEnv* env, jobject object) {
+  return static_cast<jint>(sizeof(tensorflow::NativeEvent));
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_drain(
+    JNIEnv* env, jobject object, jobject buffer) {
+  void* buffer_data = env->GetDirectBufferAddress(buffer);
+  if (buffer_data == nullptr) {
+    throw_exception(env, jvm_illegal_argument_exception, "The provided buffer is not a direct buffer.");
+    return 0;
+  }
+  // Direct buffers allocated by the JVM are aligned to at least 8 bytes, which is all that the events require.
+  const jlong max_events = env->GetDirectBufferCapacity(buffer) / static_cast<jlong>(sizeof(tensorflow::NativeEvent));
+  return static_cast<jint>(tensorflow::NativeEventRecorder::Drain(
+      static_cast<tensorflow::NativeEvent*>(buffer_data), static_cast<tensorflow::int64>(max_events)));
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_numDropped(
+    JNIEnv* env, jobject object) {
+  return static_cast<jlong>(tensorflow::NativeEventRecorder::NumDropped());
+}
+
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_eventName(
+    JNIEnv* env, jobject object, jlong name) {
+  if (name == 0) return nullptr;
+  return env->NewStringUTF(reinterpret_cast<const char*>(name));
+}
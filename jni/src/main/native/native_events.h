@@ -0,0 +1,53 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_NativeEvents__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_NativeEvents__
+#define _Included_org_platanios_tensorflow_jni_NativeEvents__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeEvents__
+ * Method:    setEnabled
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_setEnabled
+  (JNIEnv *, jobject, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeEvents__
+ * Method:    eventSize
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_eventSize
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeEvents__
+ * Method:    drain
+ * Signature: (Ljava/nio/ByteBuffer;)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_drain
+  (JNIEnv *, jobject, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeEvents__
+ * Method:    numDropped
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_numDropped
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeEvents__
+ * Method:    eventName
+ * Signature: (J)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_NativeEvents_00024_eventName
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
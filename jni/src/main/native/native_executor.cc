@@ -0,0 +1,64 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "native_executor.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/native_executor.h"
+#include "tensorflow/c/status_helper.h"
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_NativeExecutor_00024_setNumThreads(
+    JNIEnv* env, jobject object, jint num_threads) {
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  Set_TF_Status_from_Status(status.get(), tensorflow::NativeExecutor::SetNumThreads(static_cast<int>(num_threads)));
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_NativeExecutor_00024_numThreads(
+    JNIEnv* env, jobject object) {
+  return static_cast<jint>(tensorflow::NativeExecutor::Global()->NumThreads());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_NativeExecutor_00024_setPriority(
+    JNIEnv* env, jobject object, jint subsystem, jint priority) {
+  if (subsystem < 0 || subsystem >= tensorflow::NativeExecutor::kNumSubsystems) {
+    throw_exception(env, tf_invalid_argument_exception, "Invalid native executor subsystem: %d.", subsystem);
+    return;
+  }
+  if (priority < 0 || priority >= tensorflow::NativeExecutor::kNumPriorities) {
+    throw_exception(env, tf_invalid_argument_exception, "Invalid native executor priority: %d.", priority);
+    return;
+  }
+  tensorflow::NativeExecutor::Global()->SetPriority(
+      static_cast<tensorflow::NativeExecutor::Subsystem>(subsystem),
+      static_cast<tensorflow::NativeExecutor::Priority>(priority));
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_NativeExecutor_00024_statistics(
+    JNIEnv* env, jobject object) {
+  std::vector<jlong> values;
+  for (const tensorflow::NativeExecutor::Statistics& s : tensorflow::NativeExecutor::Global()->statistics()) {
+    values.insert(values.end(), {
+        static_cast<jlong>(s.priority), s.scheduled_tasks, s.completed_tasks, s.active_tasks, s.queued_tasks,
+        s.busy_micros});
+  }
+  jlongArray values_array = env->NewLongArray(static_cast<jsize>(values.size()));
+  env->SetLongArrayRegion(values_array, 0, static_cast<jsize>(values.size()), values.data());
+  return values_array;
+}
@@ -0,0 +1,45 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_NativeExecutor__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_NativeExecutor__
+#define _Included_org_platanios_tensorflow_jni_NativeExecutor__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeExecutor__
+ * Method:    setNumThreads
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_NativeExecutor_00024_setNumThreads
+  (JNIEnv *, jobject, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeExecutor__
+ * Method:    numThreads
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_NativeExecutor_00024_numThreads
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeExecutor__
+ * Method:    setPriority
+ * Signature: (II)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_NativeExecutor_00024_setPriority
+  (JNIEnv *, jobject, jint, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_NativeExecutor__
+ * Method:    statistics
+ * Signature: ()[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_NativeExecutor_00024_statistics
+  (JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
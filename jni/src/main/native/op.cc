@@ -14,6 +14,7 @@
  */
 
 #include "exception.h"
+#include "jvm_cache.h"
 #include "op.h"
 
 #include <cstring>
@@ -21,8 +22,12 @@
 #include <string.h>
 #include <stdint.h>
 #include <iostream>
+#include <vector>
 
 #include "tensorflow/c/c_api.h"
+#include "tensorflow/c/graph_shapes.h"
+#include "tensorflow/c/op_registry_index.h"
+#include "tensorflow/c/python_api.h"
 
 namespace {
 template <class T>
@@ -113,6 +118,28 @@ const char* attrTypeToString(TF_AttrType type, char is_list) {
     return ("List[" + typeName + "]").c_str();
   return typeName.c_str();
 }
+
+// Converts the op handles and output indices in the provided Java arrays to "TF_Output"s, returning false, with an
+// exception pending, if the arrays have different lengths or any of the op handles is invalid.
+bool to_outputs(JNIEnv* env, jlongArray op_handles, jintArray output_indices, std::vector<TF_Output>* outputs) {
+  const jsize num_outputs = env->GetArrayLength(op_handles);
+  if (env->GetArrayLength(output_indices) != num_outputs) {
+    throw_exception(env, tf_invalid_argument_exception, "op handles and output indices must have the same length");
+    return false;
+  }
+  outputs->resize(static_cast<size_t>(num_outputs));
+  jlong* handles = env->GetLongArrayElements(op_handles, nullptr);
+  jint* indices = env->GetIntArrayElements(output_indices, nullptr);
+  bool valid = true;
+  for (jsize i = 0; i < num_outputs && valid; ++i) {
+    (*outputs)[i].oper = require_operation_handle(env, handles[i]);
+    (*outputs)[i].index = static_cast<int>(indices[i]);
+    valid = (*outputs)[i].oper != nullptr;
+  }
+  env->ReleaseIntArrayElements(output_indices, indices, JNI_ABORT);
+  env->ReleaseLongArrayElements(op_handles, handles, JNI_ABORT);
+  return valid;
+}
 }  // namespace
 
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Op_00024_name(JNIEnv* env,
@@ -198,11 +225,9 @@ JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Op_00024_input(JNIEn
   }
 
   TF_Output output = TF_OperationInput(TF_Input{op, input_index});
-  jclass outputClass = env->FindClass("org/platanios/tensorflow/jni/Output");
-  jmethodID outputClassConstructor = env->GetStaticMethodID(
-    outputClass, "apply", "(JI)Lorg/platanios/tensorflow/jni/Output;");
+  const JVMCache& cache = jvm_cache();
   return env->CallStaticObjectMethod(
-    outputClass, outputClassConstructor, reinterpret_cast<jlong>(output.oper), output.index);
+    cache.output_class, cache.output_apply, reinterpret_cast<jlong>(output.oper), output.index);
 }
 
 JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_controlInputs(JNIEnv* env,
@@ -252,14 +277,13 @@ JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_consum
   int numConsumers = TF_OperationOutputNumConsumers(output);
   std::unique_ptr<TF_Input[]> consumers(new TF_Input[numConsumers]);
   TF_OperationOutputConsumers(output, consumers.get(), numConsumers);
-  jclass outputClass = env->FindClass("org/platanios/tensorflow/jni/Output");
-  jmethodID outputClassConstructor = env->GetStaticMethodID(
-    outputClass, "apply", "(JI)Lorg/platanios/tensorflow/jni/Output;");
-  jobjectArray ret = env->NewObjectArray(numConsumers, outputClass, NULL);
+  const JVMCache& cache = jvm_cache();
+  jobjectArray ret = env->NewObjectArray(numConsumers, cache.output_class, NULL);
   for (int i = 0; i < numConsumers; ++i) {
-    env->SetObjectArrayElement(
-      ret, i, env->CallStaticObjectMethod(
-        outputClass, outputClassConstructor, reinterpret_cast<jlong>(consumers[i].oper), consumers[i].index));
+    jobject consumer = env->CallStaticObjectMethod(
+      cache.output_class, cache.output_apply, reinterpret_cast<jlong>(consumers[i].oper), consumers[i].index);
+    env->SetObjectArrayElement(ret, i, consumer);
+    env->DeleteLocalRef(consumer);
   }
   return ret;
 }
@@ -367,10 +391,57 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Op_00024_setShape(
   }
   TF_Status *status = TF_NewStatus();
   TF_GraphSetTensorShape(graph, output, dims.get(), num_dims, status);
-  if (!throw_exception_if_not_ok(env, status)) {
-    TF_DeleteStatus(status);
+  throw_exception_if_not_ok(env, status);
+  TF_DeleteStatus(status);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_shapes(
+    JNIEnv* env, jobject object, jlong graph_handle, jlongArray op_handles, jintArray output_indices) {
+  TF_Graph* graph = require_graph_handle(env, graph_handle);
+  if (graph == nullptr) return nullptr;
+  std::vector<TF_Output> outputs;
+  if (!to_outputs(env, op_handles, output_indices, &outputs)) return nullptr;
+  std::vector<tensorflow::int64> shapes;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  tensorflow::GetTensorShapes(graph, outputs.data(), static_cast<int>(outputs.size()), &shapes, status.get());
+  if (!throw_exception_if_not_ok(env, status.get())) return nullptr;
+  static_assert(sizeof(jlong) == sizeof(tensorflow::int64), "Java long is not compatible with the TensorFlow int64");
+  jlongArray ret = env->NewLongArray(static_cast<jsize>(shapes.size()));
+  env->SetLongArrayRegion(ret, 0, static_cast<jsize>(shapes.size()), reinterpret_cast<const jlong*>(shapes.data()));
+  return ret;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Op_00024_setShapes(
+    JNIEnv* env, jobject object, jlong graph_handle, jlongArray op_handles, jintArray output_indices,
+    jintArray ranks, jlongArray dims) {
+  TF_Graph* graph = require_graph_handle(env, graph_handle);
+  if (graph == nullptr) return;
+  std::vector<TF_Output> outputs;
+  if (!to_outputs(env, op_handles, output_indices, &outputs)) return;
+  if (env->GetArrayLength(ranks) != static_cast<jsize>(outputs.size())) {
+    throw_exception(env, tf_invalid_argument_exception, "there must be one rank per output");
+    return;
+  }
+  std::vector<int> c_ranks(outputs.size());
+  std::vector<tensorflow::int64> c_dims(static_cast<size_t>(env->GetArrayLength(dims)));
+  jint* rank_elems = env->GetIntArrayElements(ranks, nullptr);
+  size_t num_dims = 0;
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    c_ranks[i] = static_cast<int>(rank_elems[i]);
+    if (c_ranks[i] > 0) num_dims += static_cast<size_t>(c_ranks[i]);
+  }
+  env->ReleaseIntArrayElements(ranks, rank_elems, JNI_ABORT);
+  if (num_dims != c_dims.size()) {
+    throw_exception(env, tf_invalid_argument_exception,
+                    "expected %d dimensions in total, but got %d", static_cast<int>(num_dims),
+                    static_cast<int>(c_dims.size()));
     return;
   }
+  env->GetLongArrayRegion(dims, 0, static_cast<jsize>(c_dims.size()), reinterpret_cast<jlong*>(c_dims.data()));
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  tensorflow::SetTensorShapes(
+      graph, outputs.data(), static_cast<int>(outputs.size()), c_ranks.data(), c_dims.data(), status.get());
+  throw_exception_if_not_ok(env, status.get());
 }
 
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Op_00024_getAttrString(
@@ -446,7 +517,7 @@ JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_getAtt
   TF_DeleteStatus(status);
 
   jobjectArray ret;
-  ret = env->NewObjectArray(list_size, env->FindClass("java/lang/String"), env->NewStringUTF(""));
+  ret = env->NewObjectArray(list_size, jvm_cache().string_class, env->NewStringUTF(""));
   for (int i = 0; i < list_size; i++) {
     char *value = new char[attrValueLengths[i] + 1];
     strncpy(value, reinterpret_cast<const char *>(attrValuePointers[i]), attrValueLengths[i]);
@@ -628,14 +699,66 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_getAttrS
 }
 
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_allOps(JNIEnv* env, jobject object) {
-  TF_Buffer* opListBuffer = TF_GetAllOpList();
-  jbyteArray ret = env->NewByteArray(opListBuffer->length);
-  jbyte* cpy = env->GetByteArrayElements(ret, nullptr);
-  std::memcpy(cpy, opListBuffer->data, opListBuffer->length);
-  env->ReleaseByteArrayElements(ret, cpy, 0);
+  // The serialized op list is cached natively, so that it is only computed again after new ops get registered.
+  tensorflow::int64 version;
+  std::shared_ptr<const tensorflow::string> op_list = tensorflow::OpListSnapshot(&version);
+  jbyteArray ret = env->NewByteArray(static_cast<jsize>(op_list->size()));
+  env->SetByteArrayRegion(
+      ret, 0, static_cast<jsize>(op_list->size()), reinterpret_cast<const jbyte*>(op_list->data()));
   return ret;
 }
 
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Op_00024_allOpsVersion(JNIEnv* env, jobject object) {
+  tensorflow::int64 version;
+  tensorflow::OpListSnapshot(&version);
+  return static_cast<jlong>(version);
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_opDef(
+    JNIEnv* env, jobject object, jstring op_type) {
+  const char* c_op_type = env->GetStringUTFChars(op_type, nullptr);
+  const tensorflow::OpDef* op_def = nullptr;
+  tensorflow::Status status = tensorflow::LookUpRegisteredOpDef(c_op_type, &op_def);
+  env->ReleaseStringUTFChars(op_type, c_op_type);
+  if (!status.ok()) return nullptr;
+  tensorflow::string serialized;
+  op_def->SerializeToString(&serialized);
+  jbyteArray ret = env->NewByteArray(static_cast<jsize>(serialized.size()));
+  env->SetByteArrayRegion(
+      ret, 0, static_cast<jsize>(serialized.size()), reinterpret_cast<const jbyte*>(serialized.data()));
+  return ret;
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Op_00024_opSignature(
+    JNIEnv* env, jobject object, jstring op_type) {
+  const char* c_op_type = env->GetStringUTFChars(op_type, nullptr);
+  tensorflow::OpSignature signature;
+  tensorflow::Status status = tensorflow::LookUpOpSignature(c_op_type, &signature);
+  env->ReleaseStringUTFChars(op_type, c_op_type);
+  if (!status.ok()) return nullptr;
+  const JVMCache& cache = jvm_cache();
+  auto to_string_array = [env, &cache](const std::vector<tensorflow::string>& values) {
+    jobjectArray array = env->NewObjectArray(static_cast<jsize>(values.size()), cache.string_class, nullptr);
+    for (size_t i = 0; i < values.size(); ++i) {
+      jstring value = env->NewStringUTF(values[i].c_str());
+      env->SetObjectArrayElement(array, static_cast<jsize>(i), value);
+      env->DeleteLocalRef(value);
+    }
+    return array;
+  };
+  auto to_int_array = [env](const std::vector<int>& values) {
+    std::vector<jint> jvalues(values.begin(), values.end());
+    jintArray array = env->NewIntArray(static_cast<jsize>(jvalues.size()));
+    env->SetIntArrayRegion(array, 0, static_cast<jsize>(jvalues.size()), jvalues.data());
+    return array;
+  };
+  return env->CallStaticObjectMethod(
+      cache.op_signature_class, cache.op_signature_apply, to_string_array(signature.input_arg_names),
+      to_int_array(signature.input_arg_types), to_string_array(signature.output_arg_names),
+      to_int_array(signature.output_arg_types), to_string_array(signature.attr_names),
+      to_string_array(signature.attr_types), static_cast<jboolean>(signature.is_stateful));
+}
+
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Op_00024_allocate(
     JNIEnv* env, jobject object, jlong graph_handle, jstring type, jstring name) {
   if (graph_handle == 0) {
@@ -668,6 +791,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Op_00024_finish(
   return 0;
 }
 
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_finishAll(
+    JNIEnv* env, jobject object, jlong graph_handle, jlongArray handles) {
+  TF_Graph* graph = require_graph_handle(env, graph_handle);
+  if (graph == nullptr) return nullptr;
+  const int num_descs = env->GetArrayLength(handles);
+  std::vector<TF_OperationDescription*> descs(static_cast<size_t>(num_descs));
+  jlong* desc_handles = env->GetLongArrayElements(handles, nullptr);
+  for (int i = 0; i < num_descs; ++i)
+    descs[i] = reinterpret_cast<TF_OperationDescription*>(desc_handles[i]);
+  env->ReleaseLongArrayElements(handles, desc_handles, JNI_ABORT);
+  std::vector<TF_Operation*> ops(static_cast<size_t>(num_descs));
+  TF_Status* status = TF_NewStatus();
+  tensorflow::FinishOperations(graph, descs.data(), num_descs, ops.data(), status);
+  if (!throw_exception_if_not_ok(env, status)) {
+    TF_DeleteStatus(status);
+    return nullptr;
+  }
+  TF_DeleteStatus(status);
+  jlongArray ret = env->NewLongArray(num_descs);
+  jlong* op_handles = env->GetLongArrayElements(ret, nullptr);
+  for (int i = 0; i < num_descs; ++i)
+    op_handles[i] = reinterpret_cast<jlong>(ops[i]);
+  env->ReleaseLongArrayElements(ret, op_handles, 0);
+  return ret;
+}
+
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Op_00024_addInput(
     JNIEnv* env, jobject object, jlong handle, jlong op_handle, jint index) {
   TF_Output out;
@@ -135,6 +135,22 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_shape
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Op_00024_setShape
         (JNIEnv *, jobject, jlong, jlong, jint, jlongArray, jint);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Op__
+ * Method:    shapes
+ * Signature: (J[J[I)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_shapes
+  (JNIEnv *, jobject, jlong, jlongArray, jintArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Op__
+ * Method:    setShapes
+ * Signature: (J[J[I[I[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Op_00024_setShapes
+  (JNIEnv *, jobject, jlong, jlongArray, jintArray, jintArray, jlongArray);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Op__
  * Method:    getAttrString
@@ -238,6 +254,30 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_getAttrS
  */
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_allOps
   (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Op__
+ * Method:    allOpsVersion
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Op_00024_allOpsVersion
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Op__
+ * Method:    opDef
+ * Signature: (Ljava/lang/String;)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_opDef
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Op__
+ * Method:    opSignature
+ * Signature: (Ljava/lang/String;)Lorg/platanios/tensorflow/jni/OpSignature;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Op_00024_opSignature
+  (JNIEnv *, jobject, jstring);
   
 /*
  * Class:     org_platanios_tensorflow_jni_Op__
@@ -255,6 +295,14 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Op_00024_allocate
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Op_00024_finish
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Op__
+ * Method:    finishAll
+ * Signature: (J[J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Op_00024_finishAll
+  (JNIEnv *, jobject, jlong, jlongArray);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Op__
  * Method:    addInput
@@ -0,0 +1,400 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Per-element cost estimate of a beam search step, in cycles, which is used to shard the batch over threads. It
+  // accounts for the exponential of the log-softmax normalizer and for the top-k selection.
+  const int64 kElementCost = 20;
+
+  // Beam search candidate, consisting of a score and of a flat index into the '[beam_width, vocab_size]' candidates
+  // of a batch entry.
+  template <typename T>
+  using Candidate = std::pair<T, int64>;
+
+  // Orders candidates by decreasing score, breaking ties by increasing index, which is the same order as the one used
+  // by the 'TopKV2' op.
+  template <typename T>
+  struct CandidateComparator {
+    bool operator()(const Candidate<T>& a, const Candidate<T>& b) const {
+      return a.first > b.first || (a.first == b.first && a.second < b.second);
+    }
+  };
+
+  // Returns the length penalty of a sequence with the provided length, as defined in "Google's Neural Machine
+  // Translation System: Bridging the Gap between Human and Machine Translation" (Wu et al., 2016).
+  template <typename T>
+  inline T LengthPenalty(int32 length, float weight) {
+    if (weight == 0.0f) return static_cast<T>(1);
+    return static_cast<T>(std::pow((5.0 + length) / 6.0, static_cast<double>(weight)));
+  }
+
+  // Returns the log-normalizer (i.e., the log-sum-exp) of a row of logits with 'n' elements.
+  template <typename T>
+  inline T LogNormalizer(const T* row, int64 n) {
+    const T max = *std::max_element(row, row + n);
+    if (!std::isfinite(max)) return max;
+    T sum = static_cast<T>(0);
+    for (int64 i = 0; i < n; ++i) sum += std::exp(row[i] - max);
+    return max + std::log(sum);
+  }
+}  // namespace
+
+// Kernel that performs a single step of beam search decoding. For each batch entry, it computes the log-softmax of the
+// logits of all beams, adds the log-probabilities of the beams, applies the length penalty, selects the top
+// 'beam_width' candidates using a heap, and gathers the log-probabilities, the finished flags, the sequence lengths,
+// and the decoder states of their parent beams, all in a single pass over the logits. Batch entries are processed in
+// parallel.
+template <typename T>
+class BeamSearchStepOp : public OpKernel {
+ public:
+  explicit BeamSearchStepOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("length_penalty_weight", &length_penalty_weight_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& logits = ctx->input(0);
+    const Tensor& log_probabilities = ctx->input(1);
+    const Tensor& finished = ctx->input(2);
+    const Tensor& sequence_lengths = ctx->input(3);
+    const Tensor& end_token_tensor = ctx->input(4);
+    OpInputList states;
+    OP_REQUIRES_OK(ctx, ctx->input_list("states", &states));
+
+    OP_REQUIRES(ctx, logits.dims() == 3,
+                errors::InvalidArgument("'logits' must have rank 3, but has shape ", logits.shape().DebugString(),
+                                        "."));
+    const int64 batch_size = logits.dim_size(0);
+    const int64 beam_width = logits.dim_size(1);
+    const int64 vocab_size = logits.dim_size(2);
+    const TensorShape beam_shape({batch_size, beam_width});
+    OP_REQUIRES(ctx, vocab_size > 0, errors::InvalidArgument("'logits' must have a non-empty vocabulary dimension."));
+    OP_REQUIRES(ctx, log_probabilities.shape() == beam_shape,
+                errors::InvalidArgument("'log_probabilities' must have shape ", beam_shape.DebugString(),
+                                        ", but has shape ", log_probabilities.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, finished.shape() == beam_shape,
+                errors::InvalidArgument("'finished' must have shape ", beam_shape.DebugString(), ", but has shape ",
+                                        finished.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, sequence_lengths.shape() == beam_shape,
+                errors::InvalidArgument("'sequence_lengths' must have shape ", beam_shape.DebugString(),
+                                        ", but has shape ", sequence_lengths.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsScalar(end_token_tensor.shape()),
+                errors::InvalidArgument("'end_token' must be a scalar, but has shape ",
+                                        end_token_tensor.shape().DebugString(), "."));
+    for (int i = 0; i < states.size(); ++i) {
+      OP_REQUIRES(ctx, states[i].dims() >= 1 && states[i].dim_size(0) == batch_size * beam_width,
+                  errors::InvalidArgument("State ", i, " must have first dimension equal to ", batch_size * beam_width,
+                                          " (i.e., batch size times beam width), but has shape ",
+                                          states[i].shape().DebugString(), "."));
+      OP_REQUIRES(ctx, DataTypeCanUseMemcpy(states[i].dtype()),
+                  errors::InvalidArgument("State ", i, " has unsupported data type ",
+                                          DataTypeString(states[i].dtype()), "."));
+    }
+
+    Tensor* scores;
+    Tensor* predicted_ids;
+    Tensor* parent_ids;
+    Tensor* next_log_probabilities;
+    Tensor* next_finished;
+    Tensor* next_sequence_lengths;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, beam_shape, &scores));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, beam_shape, &predicted_ids));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(2, beam_shape, &parent_ids));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(3, beam_shape, &next_log_probabilities));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(4, beam_shape, &next_finished));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(5, beam_shape, &next_sequence_lengths));
+    OpOutputList next_states;
+    OP_REQUIRES_OK(ctx, ctx->output_list("next_states", &next_states));
+    std::vector<const char*> states_data(states.size());
+    std::vector<char*> next_states_data(states.size());
+    std::vector<int64> states_row_bytes(states.size());
+    for (int i = 0; i < states.size(); ++i) {
+      Tensor* next_state;
+      OP_REQUIRES_OK(ctx, next_states.allocate(i, states[i].shape(), &next_state));
+      const int64 row_size = batch_size * beam_width == 0 ? 0 : states[i].NumElements() / (batch_size * beam_width);
+      states_data[i] = states[i].tensor_data().data();
+      next_states_data[i] = const_cast<char*>(next_state->tensor_data().data());
+      states_row_bytes[i] = row_size * DataTypeSize(states[i].dtype());
+    }
+    if (batch_size == 0 || beam_width == 0) return;
+
+    const T* logits_data = logits.flat<T>().data();
+    const T* log_probabilities_data = log_probabilities.flat<T>().data();
+    const bool* finished_data = finished.flat<bool>().data();
+    const int32* sequence_lengths_data = sequence_lengths.flat<int32>().data();
+    const int32 end_token = end_token_tensor.scalar<int32>()();
+    const bool end_token_valid = end_token >= 0 && end_token < vocab_size;
+    const float length_penalty_weight = length_penalty_weight_;
+    T* scores_data = scores->flat<T>().data();
+    int32* predicted_ids_data = predicted_ids->flat<int32>().data();
+    int32* parent_ids_data = parent_ids->flat<int32>().data();
+    T* next_log_probabilities_data = next_log_probabilities->flat<T>().data();
+    bool* next_finished_data = next_finished->flat<bool>().data();
+    int32* next_sequence_lengths_data = next_sequence_lengths->flat<int32>().data();
+
+    auto work = [&](int64 start, int64 limit) {
+      const CandidateComparator<T> comparator;
+      const T negative_infinity = -std::numeric_limits<T>::infinity();
+      std::vector<Candidate<T>> heap;
+      std::vector<T> normalizers(beam_width);
+      std::vector<T> penalties(beam_width);
+      std::vector<T> end_penalties(beam_width);
+      heap.reserve(beam_width);
+      for (int64 b = start; b < limit; ++b) {
+        const int64 offset = b * beam_width;
+        // Candidates are scanned in order of increasing flat index and so, a candidate whose score is equal to the
+        // worst score in the heap can never replace it. The heap front always contains the worst candidate.
+        heap.clear();
+        auto push = [&heap, &comparator, beam_width](T score, int64 index) {
+          if (static_cast<int64>(heap.size()) < beam_width) {
+            heap.emplace_back(score, index);
+            std::push_heap(heap.begin(), heap.end(), comparator);
+          } else if (score > heap.front().first) {
+            std::pop_heap(heap.begin(), heap.end(), comparator);
+            heap.back() = Candidate<T>(score, index);
+            std::push_heap(heap.begin(), heap.end(), comparator);
+          }
+        };
+        for (int64 k = 0; k < beam_width; ++k) {
+          const T* row = logits_data + (offset + k) * vocab_size;
+          const T log_probability = log_probabilities_data[offset + k];
+          const int32 length = sequence_lengths_data[offset + k];
+          const int64 base = k * vocab_size;
+          if (finished_data[offset + k]) {
+            // Finished beams can only be extended by the end token, which keeps their log-probability and length.
+            end_penalties[k] = LengthPenalty<T>(length, length_penalty_weight);
+            for (int64 v = 0; v < vocab_size; ++v)
+              push(v == end_token ? log_probability / end_penalties[k] : negative_infinity, base + v);
+          } else {
+            normalizers[k] = LogNormalizer(row, vocab_size);
+            penalties[k] = LengthPenalty<T>(length + 1, length_penalty_weight);
+            end_penalties[k] = LengthPenalty<T>(length, length_penalty_weight);
+            const T shift = log_probability - normalizers[k];
+            const T inverse_penalty = static_cast<T>(1) / penalties[k];
+            for (int64 v = 0; v < vocab_size; ++v) {
+              const T total = row[v] + shift;
+              push(v == end_token ? total / end_penalties[k] : total * inverse_penalty, base + v);
+            }
+          }
+        }
+        std::sort_heap(heap.begin(), heap.end(), comparator);
+        for (int64 k = 0; k < beam_width; ++k) {
+          const int64 index = heap[k].second;
+          const int64 parent = index / vocab_size;
+          const int32 id = static_cast<int32>(index % vocab_size);
+          const bool parent_finished = finished_data[offset + parent];
+          const bool is_end = end_token_valid && id == end_token;
+          const T parent_log_probability = log_probabilities_data[offset + parent];
+          scores_data[offset + k] = heap[k].first;
+          predicted_ids_data[offset + k] = id;
+          parent_ids_data[offset + k] = static_cast<int32>(parent);
+          if (parent_finished) {
+            next_log_probabilities_data[offset + k] = is_end ? parent_log_probability : negative_infinity;
+          } else {
+            const T* row = logits_data + (offset + parent) * vocab_size;
+            next_log_probabilities_data[offset + k] = parent_log_probability + row[id] - normalizers[parent];
+          }
+          next_finished_data[offset + k] = parent_finished || is_end;
+          next_sequence_lengths_data[offset + k] =
+              sequence_lengths_data[offset + parent] + (parent_finished || is_end ? 0 : 1);
+          for (size_t i = 0; i < states_data.size(); ++i) {
+            const int64 row_bytes = states_row_bytes[i];
+            std::memcpy(next_states_data[i] + (offset + k) * row_bytes,
+                        states_data[i] + (offset + parent) * row_bytes, row_bytes);
+          }
+        }
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, batch_size, beam_width * vocab_size * kElementCost,
+          work);
+  }
+
+ private:
+  float length_penalty_weight_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(BeamSearchStepOp);
+};
+
+// Kernel that reconstructs the full beams from the token IDs and the parent beam indices produced by a sequence of beam
+// search steps, by following the parent indices backwards from the last step. Batch entries are processed in parallel.
+class BeamSearchGatherTreeOp : public OpKernel {
+ public:
+  explicit BeamSearchGatherTreeOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& step_ids = ctx->input(0);
+    const Tensor& parent_ids = ctx->input(1);
+    OP_REQUIRES(ctx, step_ids.dims() == 3,
+                errors::InvalidArgument("'step_ids' must have rank 3, but has shape ", step_ids.shape().DebugString(),
+                                        "."));
+    OP_REQUIRES(ctx, parent_ids.shape() == step_ids.shape(),
+                errors::InvalidArgument("'parent_ids' must have shape ", step_ids.shape().DebugString(),
+                                        ", but has shape ", parent_ids.shape().DebugString(), "."));
+    const int64 batch_size = step_ids.dim_size(0);
+    const int64 max_time = step_ids.dim_size(1);
+    const int64 beam_width = step_ids.dim_size(2);
+
+    Tensor* beams;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, step_ids.shape(), &beams));
+    if (step_ids.NumElements() == 0) return;
+    const int32* step_ids_data = step_ids.flat<int32>().data();
+    const int32* parent_ids_data = parent_ids.flat<int32>().data();
+    int32* beams_data = beams->flat<int32>().data();
+    auto work = [=](int64 start, int64 limit) {
+      for (int64 b = start; b < limit; ++b) {
+        const int64 offset = b * max_time * beam_width;
+        for (int64 k = 0; k < beam_width; ++k) {
+          int64 beam = k;
+          for (int64 t = max_time - 1; t >= 0; --t) {
+            const int64 index = offset + t * beam_width + beam;
+            beams_data[offset + t * beam_width + k] = step_ids_data[index];
+            beam = parent_ids_data[index];
+            // Invalid parent indices (e.g., ones produced by padding) terminate the beam.
+            if (beam < 0 || beam >= beam_width) {
+              for (int64 s = t - 1; s >= 0; --s) beams_data[offset + s * beam_width + k] = -1;
+              break;
+            }
+          }
+        }
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, batch_size, max_time * beam_width, work);
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(BeamSearchGatherTreeOp);
+};
+
+REGISTER_OP("BeamSearchStep")
+    .Input("logits: T")
+    .Input("log_probabilities: T")
+    .Input("finished: bool")
+    .Input("sequence_lengths: int32")
+    .Input("end_token: int32")
+    .Input("states: state_types")
+    .Output("scores: T")
+    .Output("predicted_ids: int32")
+    .Output("parent_ids: int32")
+    .Output("next_log_probabilities: T")
+    .Output("next_finished: bool")
+    .Output("next_sequence_lengths: int32")
+    .Output("next_states: state_types")
+    .Attr("T: {float, double}")
+    .Attr("state_types: list(type) >= 0")
+    .Attr("length_penalty_weight: float = 0.0")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle logits;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 3, &logits));
+      ShapeHandle beam_shape;
+      TF_RETURN_IF_ERROR(c->Subshape(logits, 0, 2, &beam_shape));
+      for (int i = 1; i < 4; ++i) {
+        ShapeHandle input;
+        TF_RETURN_IF_ERROR(c->WithRank(c->input(i), 2, &input));
+        TF_RETURN_IF_ERROR(c->Merge(beam_shape, input, &beam_shape));
+      }
+      ShapeHandle end_token;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(4), 0, &end_token));
+      for (int i = 0; i < 6; ++i) c->set_output(i, beam_shape);
+      for (int i = 5; i < c->num_inputs(); ++i) c->set_output(i + 1, c->input(i));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Performs a single step of beam search decoding.
+
+For each batch entry, this op computes the log-softmax of the logits of all beams, adds to it the log-probabilities of
+the beams, divides the resulting log-probabilities by the length penalty of the extended sequences, selects the top
+'beam_width' candidates (breaking ties by lower beam index and then by lower token ID), and gathers the finished flags,
+the sequence lengths, and the states of their parent beams. Finished beams can only be extended by 'end_token', which
+keeps their log-probability and length unchanged. The whole step is performed in a single pass over the logits, rather
+than by a long chain of small ops.
+
+The length penalty of a sequence with length 'l' is equal to '((5 + l) / 6) ^ length_penalty_weight'.
+
+logits: Tensor with shape '[batch_size, beam_width, vocab_size]', containing the logits of the next token.
+log_probabilities: Tensor with shape '[batch_size, beam_width]', containing the log-probabilities of the beams.
+finished: Tensor with shape '[batch_size, beam_width]', specifying which beams have finished.
+sequence_lengths: Tensor with shape '[batch_size, beam_width]', containing the lengths of the beams.
+end_token: Scalar containing the end token ID.
+states: Decoder states, each with first dimension equal to 'batch_size * beam_width' (i.e., with the beams of each
+  batch entry stored in consecutive rows).
+scores: Tensor with shape '[batch_size, beam_width]', containing the (length-penalized) scores of the selected beams,
+  sorted in descending order.
+predicted_ids: Tensor with shape '[batch_size, beam_width]', containing the token IDs of the selected beams.
+parent_ids: Tensor with shape '[batch_size, beam_width]', containing the indices of the parent beams.
+next_log_probabilities: Tensor with shape '[batch_size, beam_width]', containing the log-probabilities of the selected
+  beams.
+next_finished: Tensor with shape '[batch_size, beam_width]', specifying which of the selected beams have finished.
+next_sequence_lengths: Tensor with shape '[batch_size, beam_width]', containing the lengths of the selected beams.
+next_states: Decoder states gathered from the parent beams, with the same shapes as 'states'.
+length_penalty_weight: Length penalty weight, where '0' means no length penalty.
+)doc");
+
+REGISTER_OP("BeamSearchGatherTree")
+    .Input("step_ids: int32")
+    .Input("parent_ids: int32")
+    .Output("beams: int32")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle step_ids;
+      ShapeHandle parent_ids;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 3, &step_ids));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 3, &parent_ids));
+      ShapeHandle beams;
+      TF_RETURN_IF_ERROR(c->Merge(step_ids, parent_ids, &beams));
+      c->set_output(0, beams);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Reconstructs the full beams from the outputs of a sequence of beam search steps.
+
+Each beam is reconstructed by following the parent beam indices backwards, starting from the last step. If an invalid
+parent index is encountered, the remaining (i.e., earlier) steps of the beam are set to '-1'.
+
+step_ids: Tensor with shape '[batch_size, max_time, beam_width]', containing the token IDs selected at each step.
+parent_ids: Tensor with shape '[batch_size, max_time, beam_width]', containing the parent beam indices selected at
+  each step.
+beams: Tensor with shape '[batch_size, max_time, beam_width]', containing the token IDs of the reconstructed beams.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("BeamSearchStep").Device(DEVICE_CPU).TypeConstraint<float>("T"), BeamSearchStepOp<float>);
+REGISTER_KERNEL_BUILDER(Name("BeamSearchStep").Device(DEVICE_CPU).TypeConstraint<double>("T"),
+                        BeamSearchStepOp<double>);
+REGISTER_KERNEL_BUILDER(Name("BeamSearchGatherTree").Device(DEVICE_CPU), BeamSearchGatherTreeOp);
+
+}  // namespace tensorflow
@@ -0,0 +1,251 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cmath>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/random/philox_random.h"
+#include "tensorflow/core/lib/random/simple_philox.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/guarded_philox_random.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Expected number of times that a candidate with probability `p` appears in `num_sampled` samples, or, if the
+  // samples are unique, in the samples drawn during `num_tries` tries.
+  float ExpectedCount(float p, int64 num_sampled, int64 num_tries, bool unique) {
+    if (unique) return static_cast<float>(-std::expm1(static_cast<double>(num_tries) * std::log1p(-p)));
+    return p * num_sampled;
+  }
+}  // namespace
+
+// Kernel that samples candidates from a unigram distribution over `[0, range_max)` whose (unnormalized) weights are
+// stored in a memory-mapped file, as a little-endian `float32` array with `range_max` elements. The weights are raised
+// to the power of `distortion` and an alias table (i.e., Walker's alias method) is then built once, so that each sample
+// is drawn in constant time. The mapped weights are used directly when computing the expected counts, and so they are
+// never copied in memory. This makes the sampler suitable for output vocabularies with millions of classes.
+class MappedUnigramCandidateSamplerOp : public OpKernel {
+ public:
+  explicit MappedUnigramCandidateSamplerOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    string distribution_file;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("num_true", &num_true_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("num_sampled", &num_sampled_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("unique", &unique_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("range_max", &range_max_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("distribution_file", &distribution_file));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("distortion", &distortion_));
+    OP_REQUIRES(ctx, range_max_ > 0, errors::InvalidArgument("'range_max' must be positive."));
+    OP_REQUIRES(ctx, !unique_ || num_sampled_ <= range_max_,
+                errors::InvalidArgument("'num_sampled' (", num_sampled_, ") cannot be larger than 'range_max' (",
+                                        range_max_, ") when sampling unique candidates."));
+    OP_REQUIRES(ctx, port::kLittleEndian,
+                errors::Unimplemented("Mapped unigram distributions require a little-endian platform."));
+    OP_REQUIRES_OK(ctx, ctx->env()->NewReadOnlyMemoryRegionFromFile(distribution_file, &region_));
+    OP_REQUIRES(ctx, region_->length() == range_max_ * sizeof(float),
+                errors::InvalidArgument("File '", distribution_file, "' contains ", region_->length(),
+                                        " bytes, but a distribution over ", range_max_, " classes requires ",
+                                        range_max_ * sizeof(float), " bytes."));
+    weights_ = static_cast<const float*>(region_->data());
+    OP_REQUIRES_OK(ctx, BuildAliasTable());
+    OP_REQUIRES_OK(ctx, generator_.Init(ctx));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& true_classes = ctx->input(0);
+    OP_REQUIRES(ctx, true_classes.dims() == 2,
+                errors::InvalidArgument("'true_classes' must be a matrix, but it has shape ",
+                                        true_classes.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, true_classes.dim_size(1) == num_true_,
+                errors::InvalidArgument("'true_classes' must have ", num_true_, " columns, but it has ",
+                                        true_classes.dim_size(1), "."));
+    const int64 batch_size = true_classes.dim_size(0);
+
+    Tensor* sampled_candidates = nullptr;
+    Tensor* true_expected_count = nullptr;
+    Tensor* sampled_expected_count = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({num_sampled_}), &sampled_candidates));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, true_classes.shape(), &true_expected_count));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(2, TensorShape({num_sampled_}), &sampled_expected_count));
+    auto sampled = sampled_candidates->vec<int64>();
+
+    // Rejection sampling of unique candidates may require more than 'num_sampled' tries, and so the reserved samples
+    // are only an estimate. The generator state is advanced by enough samples for the results to not overlap with
+    // those of other invocations in most cases, which is the same trade-off made by the TensorFlow candidate samplers.
+    random::PhiloxRandom philox = generator_.ReserveSamples128(static_cast<int64>(num_sampled_) * (unique_ ? 4 : 2));
+    random::SimplePhilox random(&philox);
+    int64 num_tries = 0;
+    if (unique_) {
+      std::unordered_set<int64> seen(num_sampled_);
+      for (int64 i = 0; i < num_sampled_;) {
+        const int64 candidate = Sample(&random);
+        ++num_tries;
+        if (seen.insert(candidate).second) sampled(i++) = candidate;
+      }
+    } else {
+      for (int64 i = 0; i < num_sampled_; ++i) sampled(i) = Sample(&random);
+      num_tries = num_sampled_;
+    }
+
+    auto true_classes_matrix = true_classes.matrix<int64>();
+    auto true_expected_count_matrix = true_expected_count->matrix<float>();
+    for (int64 i = 0; i < batch_size; ++i) {
+      for (int64 j = 0; j < num_true_; ++j) {
+        const int64 true_class = true_classes_matrix(i, j);
+        OP_REQUIRES(ctx, true_class >= 0 && true_class < range_max_,
+                    errors::InvalidArgument("True class ", true_class, " is not in [0, ", range_max_, ")."));
+        true_expected_count_matrix(i, j) = ExpectedCount(Probability(true_class), num_sampled_, num_tries, unique_);
+      }
+    }
+    auto sampled_expected_count_vec = sampled_expected_count->vec<float>();
+    for (int64 i = 0; i < num_sampled_; ++i)
+      sampled_expected_count_vec(i) = ExpectedCount(Probability(sampled(i)), num_sampled_, num_tries, unique_);
+  }
+
+ private:
+  // Builds the alias table of the distorted distribution using Vose's algorithm, in linear time.
+  Status BuildAliasTable() {
+    std::vector<double> scaled(range_max_);
+    total_weight_ = 0.0;
+    for (int64 i = 0; i < range_max_; ++i) {
+      if (!(weights_[i] >= 0.0f))
+        return errors::InvalidArgument("Class ", i, " has invalid weight ", weights_[i], ".");
+      scaled[i] = DistortedWeight(i);
+      total_weight_ += scaled[i];
+    }
+    if (!(total_weight_ > 0.0)) return errors::InvalidArgument("The distribution weights must not all be zero.");
+    for (int64 i = 0; i < range_max_; ++i) scaled[i] *= range_max_ / total_weight_;
+    alias_probabilities_.resize(range_max_);
+    aliases_.resize(range_max_);
+    std::vector<int64> small;
+    std::vector<int64> large;
+    for (int64 i = 0; i < range_max_; ++i) (scaled[i] < 1.0 ? small : large).push_back(i);
+    while (!small.empty() && !large.empty()) {
+      const int64 s = small.back();
+      const int64 l = large.back();
+      small.pop_back();
+      alias_probabilities_[s] = static_cast<float>(scaled[s]);
+      aliases_[s] = l;
+      scaled[l] -= 1.0 - scaled[s];
+      if (scaled[l] < 1.0) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    // Any remaining entries only differ from 1 due to rounding errors.
+    for (const int64 i : large) alias_probabilities_[i] = 1.0f;
+    for (const int64 i : small) alias_probabilities_[i] = 1.0f;
+    return Status::OK();
+  }
+
+  inline double DistortedWeight(int64 candidate) const {
+    const double weight = static_cast<double>(weights_[candidate]);
+    return distortion_ == 1.0f ? weight : std::pow(weight, static_cast<double>(distortion_));
+  }
+
+  inline float Probability(int64 candidate) const {
+    return static_cast<float>(DistortedWeight(candidate) / total_weight_);
+  }
+
+  inline int64 Sample(random::SimplePhilox* random) const {
+    const int64 bucket = static_cast<int64>(random->Uniform64(static_cast<uint64>(range_max_)));
+    return random->RandFloat() < alias_probabilities_[bucket] ? bucket : aliases_[bucket];
+  }
+
+  int32 num_true_;
+  int32 num_sampled_;
+  bool unique_;
+  int64 range_max_;
+  float distortion_;
+  std::unique_ptr<ReadOnlyMemoryRegion> region_;
+  const float* weights_ = nullptr;
+  double total_weight_ = 0.0;
+  std::vector<float> alias_probabilities_;
+  std::vector<int64> aliases_;
+  GuardedPhiloxRandom generator_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(MappedUnigramCandidateSamplerOp);
+};
+
+REGISTER_OP("MappedUnigramCandidateSampler")
+    .Input("true_classes: int64")
+    .Output("sampled_candidates: int64")
+    .Output("true_expected_count: float")
+    .Output("sampled_expected_count: float")
+    .Attr("num_true: int >= 1")
+    .Attr("num_sampled: int >= 1")
+    .Attr("unique: bool")
+    .Attr("range_max: int >= 1")
+    .Attr("distribution_file: string")
+    .Attr("distortion: float = 1.0")
+    .Attr("seed: int = 0")
+    .Attr("seed2: int = 0")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      int32 num_true;
+      int32 num_sampled;
+      TF_RETURN_IF_ERROR(c->GetAttr("num_true", &num_true));
+      TF_RETURN_IF_ERROR(c->GetAttr("num_sampled", &num_sampled));
+      ShapeHandle true_classes;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &true_classes));
+      TF_RETURN_IF_ERROR(c->WithValue(c->Dim(true_classes, 1), num_true, nullptr));
+      c->set_output(0, c->Vector(num_sampled));
+      c->set_output(1, c->Matrix(c->Dim(true_classes, 0), num_true));
+      c->set_output(2, c->Vector(num_sampled));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Generates labels for candidate sampling with a unigram distribution that is stored in a memory-mapped file.
+
+The file contains the (unnormalized) weights of the classes in `[0, range_max)`, as a little-endian `float32` array,
+and it is memory-mapped rather than read, so that it is shared across processes and does not need to be parsed. Each
+weight is raised to the power of `distortion` before being normalized, and the candidates are sampled in constant time
+per sample using an alias table.
+
+If `unique = true`, then the candidates are sampled without replacement. Otherwise, they are sampled with replacement.
+The expected counts are computed in the same way as for the other TensorFlow candidate samplers.
+
+true_classes: Matrix, shaped `[batch_size, num_true]`, containing the target classes.
+sampled_candidates: Vector, shaped `[num_sampled]`, containing the sampled candidates.
+true_expected_count: Matrix, shaped `[batch_size, num_true]`, containing the expected number of times that each true
+  class occurs in `sampled_candidates`.
+sampled_expected_count: Vector, shaped `[num_sampled]`, containing the expected number of times that each sampled
+  candidate occurs in `sampled_candidates`.
+num_true: Number of target classes per training example.
+num_sampled: Number of candidates to sample.
+unique: If `true`, the candidates are sampled without replacement.
+range_max: Number of classes of the distribution.
+distribution_file: Path to the file containing the class weights.
+distortion: Power to which the class weights are raised before they are normalized.
+seed: If either `seed` or `seed2` are set to be non-zero, the random number generator is seeded by the given seed.
+  Otherwise, it is seeded by a random seed.
+seed2: Second seed to avoid seed collision.
+)doc");
+
+REGISTER_KERNEL_BUILDER(
+    Name("MappedUnigramCandidateSampler").Device(DEVICE_CPU), MappedUnigramCandidateSamplerOp);
+}  // namespace tensorflow
@@ -0,0 +1,645 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <string.h>
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/tensor_slice.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/blocking_counter.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/threadpool.h"
+#include "tensorflow/core/lib/hash/hash.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/lib/random/random.h"
+#include "tensorflow/core/lib/strings/stringprintf.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/util/saved_tensor_slice_util.h"
+#include "tensorflow/core/util/tensor_bundle/tensor_bundle.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::DimensionHandle;
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Piece of a saved tensor that is written by a single shard writer. Tensors larger than the chunk size are split
+  // along their first dimension into several pieces, which are stored as slices of the full tensor.
+  struct WriteItem {
+    int index;                   // Index of the saved tensor.
+    bool is_slice;               // Whether this piece is added as a slice of 'full_shape'.
+    TensorShape full_shape;      // Shape of the full tensor, if this piece is a slice.
+    TensorSlice slice;           // Slice of the full tensor that this piece covers, if it is a slice.
+    Tensor value;                // Value of this piece.
+    int64 bytes;                 // Size of this piece in bytes.
+  };
+
+  // Returns the pieces of the saved tensor with index 'index', split so that (if possible) no piece is larger than
+  // 'chunk_size' bytes. String tensors, scalars, and tensors that are already slices of a partitioned tensor are not
+  // split.
+  Status SplitIntoItems(int index, const Tensor& tensor, const string& shape_and_slice, int64 chunk_size,
+                        std::vector<WriteItem>* items) {
+    if (!shape_and_slice.empty()) {
+      WriteItem item{index, true, TensorShape(), TensorSlice(), tensor, static_cast<int64>(tensor.TotalBytes())};
+      TensorShape slice_shape;
+      TF_RETURN_IF_ERROR(checkpoint::ParseShapeAndSlice(shape_and_slice, &item.full_shape, &item.slice, &slice_shape));
+      if (slice_shape != tensor.shape())
+        return errors::InvalidArgument("Slice specification '", shape_and_slice, "' of tensor ", index,
+                                       " does not match its shape, ", tensor.shape().DebugString(), ".");
+      items->push_back(std::move(item));
+      return Status::OK();
+    }
+    const int64 bytes = tensor.TotalBytes();
+    const int64 rows = tensor.dims() > 0 ? tensor.dim_size(0) : 0;
+    if (chunk_size <= 0 || bytes <= chunk_size || tensor.dtype() == DT_STRING || rows < 2) {
+      items->push_back(WriteItem{index, false, TensorShape(), TensorSlice(), tensor, bytes});
+      return Status::OK();
+    }
+    const int64 row_bytes = bytes / rows;
+    const int64 rows_per_piece = std::max(int64{1}, chunk_size / std::max(int64{1}, row_bytes));
+    for (int64 start = 0; start < rows; start += rows_per_piece) {
+      const int64 limit = std::min(rows, start + rows_per_piece);
+      TensorSlice slice(tensor.dims());
+      slice.set_start(0, start);
+      slice.set_length(0, limit - start);
+      Tensor piece = tensor.Slice(start, limit);
+      items->push_back(WriteItem{index, true, tensor.shape(), slice, piece, static_cast<int64>(piece.TotalBytes())});
+    }
+    return Status::OK();
+  }
+
+  // Keys used by delta checkpoints. A delta checkpoint stores the basename of its base checkpoint (which is always a
+  // full checkpoint in the same directory) under 'kDeltaBaseKey'. Tensors of which only some rows changed since the
+  // base checkpoint was written are stored as the '[num_ranges, 2]' tensor of the (start, length) pairs of the changed
+  // row ranges, under 'kDeltaRangesPrefix + name', and the '[num_changed_rows, ...]' tensor of the changed rows, under
+  // 'kDeltaRowsPrefix + name'. All other tensors are stored in full, under their own names. These keys must match the
+  // ones used by 'CheckpointReader'.
+  const char* const kDeltaBaseKey = "_DELTA_BASE_";
+  const char* const kDeltaRangesPrefix = "_DELTA_RANGES_/";
+  const char* const kDeltaRowsPrefix = "_DELTA_ROWS_/";
+
+  // Copies the elements of 'slice', along dimensions 'dim' and higher, from 'source' (a row-major array with shape
+  // 'shape') to '*target', and advances '*target' past the copied bytes.
+  void CopySliceBytes(const char* source, const TensorShape& shape, const TensorSlice& slice, int dim,
+                      int64 element_bytes, char** target) {
+    if (dim >= shape.dims()) {
+      memcpy(*target, source, element_bytes);
+      *target += element_bytes;
+      return;
+    }
+    int64 stride = element_bytes;
+    for (int d = dim + 1; d < shape.dims(); ++d) stride *= shape.dim_size(d);
+    const int64 start = slice.start(dim);
+    const int64 length = slice.IsFullAt(dim) ? shape.dim_size(dim) : slice.length(dim);
+    if (dim == shape.dims() - 1) {
+      memcpy(*target, source + start * stride, length * stride);
+      *target += length * stride;
+      return;
+    }
+    for (int64 i = start; i < start + length; ++i)
+      CopySliceBytes(source + i * stride, shape, slice, dim + 1, element_bytes, target);
+  }
+
+  // Overwrites the rows of 'value' (which holds the slice 'slice' of a tensor with shape 'full_shape') that are stored
+  // in the delta checkpoint read by 'reader' for the tensor named 'name'.
+  Status ApplyDelta(BundleReader* reader, const string& name, const TensorShape& full_shape, const TensorSlice& slice,
+                    Tensor* value) {
+    TensorShape ranges_shape;
+    TensorShape rows_shape;
+    DataType ranges_dtype;
+    DataType rows_dtype;
+    TF_RETURN_IF_ERROR(reader->LookupDtypeAndShape(kDeltaRangesPrefix + name, &ranges_dtype, &ranges_shape));
+    TF_RETURN_IF_ERROR(reader->LookupDtypeAndShape(kDeltaRowsPrefix + name, &rows_dtype, &rows_shape));
+    if (full_shape.dims() < 1 || ranges_dtype != DT_INT64 || ranges_shape.dims() != 2 ||
+        ranges_shape.dim_size(1) != 2 || rows_dtype != value->dtype() || rows_shape.dims() != full_shape.dims())
+      return errors::DataLoss("Invalid delta of tensor '", name, "'.");
+    Tensor ranges(DT_INT64, ranges_shape);
+    Tensor rows(rows_dtype, rows_shape);
+    TF_RETURN_IF_ERROR(reader->Lookup(kDeltaRangesPrefix + name, &ranges));
+    TF_RETURN_IF_ERROR(reader->Lookup(kDeltaRowsPrefix + name, &rows));
+    for (int d = 1; d < full_shape.dims(); ++d)
+      if (rows_shape.dim_size(d) != full_shape.dim_size(d))
+        return errors::DataLoss("Invalid delta of tensor '", name, "'.");
+    const int64 num_rows = full_shape.dim_size(0);
+    const int64 element_bytes = DataTypeSize(value->dtype());
+    const int64 row_bytes = num_rows > 0 ? full_shape.num_elements() / num_rows * element_bytes : 0;
+    const int64 slice_start = slice.start(0);
+    const int64 slice_limit = slice.IsFullAt(0) ? num_rows : slice_start + slice.length(0);
+    const int64 slice_row_bytes = value->dim_size(0) > 0 ? value->TotalBytes() / value->dim_size(0) : 0;
+    const auto ranges_matrix = ranges.matrix<int64>();
+    const char* rows_data = rows.tensor_data().data();
+    char* value_data = const_cast<char*>(value->tensor_data().data());
+    int64 row_offset = 0;
+    for (int64 r = 0; r < ranges_shape.dim_size(0); ++r) {
+      const int64 start = ranges_matrix(r, 0);
+      const int64 length = ranges_matrix(r, 1);
+      if (start < 0 || length < 0 || start + length > num_rows || row_offset + length > rows_shape.dim_size(0))
+        return errors::DataLoss("Invalid delta row range [", start, ", ", start + length, ") of tensor '", name, "'.");
+      const int64 begin = std::max(start, slice_start);
+      const int64 end = std::min(start + length, slice_limit);
+      if (begin < end) {
+        const char* source = rows_data + (row_offset + begin - start) * row_bytes;
+        char* target = value_data + (begin - slice_start) * slice_row_bytes;
+        if (slice_row_bytes == row_bytes) {
+          memcpy(target, source, (end - begin) * row_bytes);
+        } else {
+          for (int64 row = begin; row < end; ++row, source += row_bytes)
+            CopySliceBytes(source, full_shape, slice, 1, element_bytes, &target);
+        }
+      }
+      row_offset += length;
+    }
+    return Status::OK();
+  }
+}  // namespace
+
+// Saves tensors in the V2 checkpoint format, like 'SaveV2', but writes them as several bundles (one per shard), in
+// parallel, each using its own I/O thread. The bundles are finally merged into a single checkpoint with one data file
+// per shard. This is useful for storage systems with low per-stream bandwidth and high aggregate bandwidth (e.g.,
+// remote object stores), where a single sequential writer cannot saturate the available bandwidth.
+//
+// Large tensors are split into chunks of at most 'chunk_size' bytes, which are saved as slices of the full tensor, so
+// that the shards are balanced even when a few tensors dominate the checkpoint size. Restoring such tensors using
+// 'RestoreV2' reassembles them transparently.
+class ParallelSaveV2Op : public OpKernel {
+ public:
+  explicit ParallelSaveV2Op(OpKernelConstruction* context) : OpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("num_shards", &num_shards_));
+    OP_REQUIRES_OK(context, context->GetAttr("chunk_size", &chunk_size_));
+    thread_pool_.reset(new thread::ThreadPool(context->env(), "parallel_save", num_shards_));
+  }
+
+  void Compute(OpKernelContext* context) override {
+    const Tensor& prefix = context->input(0);
+    const Tensor& tensor_names = context->input(1);
+    const Tensor& shape_and_slices = context->input(2);
+    OP_REQUIRES(context, TensorShapeUtils::IsScalar(prefix.shape()),
+                errors::InvalidArgument("'prefix' must be a scalar, but has shape ", prefix.shape().DebugString(),
+                                        "."));
+    const int num_tensors = static_cast<int>(tensor_names.NumElements());
+    OP_REQUIRES(context, shape_and_slices.NumElements() == num_tensors,
+                errors::InvalidArgument("Expected ", num_tensors, " shape and slice specifications, but got ",
+                                        shape_and_slices.NumElements(), "."));
+    OP_REQUIRES(context, context->num_inputs() == num_tensors + 3,
+                errors::InvalidArgument("Expected ", num_tensors, " tensors to save, but got ",
+                                        context->num_inputs() - 3, "."));
+    const string& prefix_string = prefix.scalar<string>()();
+    const auto names_flat = tensor_names.flat<string>();
+    const auto slices_flat = shape_and_slices.flat<string>();
+
+    // Split the tensors into pieces and assign them to shards greedily, largest piece first, to the shard with the
+    // fewest bytes assigned so far.
+    std::vector<WriteItem> items;
+    for (int i = 0; i < num_tensors; ++i)
+      OP_REQUIRES_OK(context, SplitIntoItems(i, context->input(i + 3), slices_flat(i), chunk_size_, &items));
+    std::sort(items.begin(), items.end(), [](const WriteItem& a, const WriteItem& b) { return a.bytes > b.bytes; });
+    const int num_shards = std::max(1, std::min(num_shards_, static_cast<int>(items.size())));
+    std::vector<std::vector<const WriteItem*>> shard_items(num_shards);
+    std::vector<int64> shard_bytes(num_shards, 0);
+    for (const WriteItem& item : items) {
+      const int shard = static_cast<int>(
+          std::min_element(shard_bytes.begin(), shard_bytes.end()) - shard_bytes.begin());
+      shard_items[shard].push_back(&item);
+      shard_bytes[shard] += item.bytes;
+    }
+
+    // Write each shard to its own temporary bundle, in parallel.
+    Env* env = context->env();
+    const string temporary_directory = strings::Printf(
+        "%s_temp_%016llx", prefix_string.c_str(), static_cast<unsigned long long>(random::New64()));
+    std::vector<string> shard_prefixes(num_shards);
+    std::vector<Status> shard_statuses(num_shards);
+    std::vector<double> shard_seconds(num_shards, 0.0);
+    BlockingCounter counter(num_shards);
+    for (int s = 0; s < num_shards; ++s) {
+      shard_prefixes[s] = io::JoinPath(temporary_directory, strings::Printf("part-%05d-of-%05d", s, num_shards));
+      thread_pool_->Schedule([&, s]() {
+        const uint64 start_micros = env->NowMicros();
+        shard_statuses[s] = WriteShard(env, shard_prefixes[s], shard_items[s], names_flat);
+        shard_seconds[s] = (env->NowMicros() - start_micros) / 1e6;
+        counter.DecrementCount();
+      });
+    }
+    counter.Wait();
+    for (int s = 0; s < num_shards; ++s)
+      OP_REQUIRES_OK(context, shard_statuses[s]);
+
+    // Merge the shards into the final checkpoint and remove the (now empty) temporary directory.
+    const uint64 merge_start_micros = env->NowMicros();
+    OP_REQUIRES_OK(context, MergeBundles(env, shard_prefixes, prefix_string));
+    env->DeleteDir(temporary_directory).IgnoreError();
+    const double merge_seconds = (env->NowMicros() - merge_start_micros) / 1e6;
+
+    Tensor* bytes_output = nullptr;
+    Tensor* seconds_output = nullptr;
+    OP_REQUIRES_OK(context, context->allocate_output(0, TensorShape({num_shards}), &bytes_output));
+    OP_REQUIRES_OK(context, context->allocate_output(1, TensorShape({num_shards}), &seconds_output));
+    auto bytes_flat = bytes_output->flat<int64>();
+    auto seconds_flat = seconds_output->flat<float>();
+    int64 total_bytes = 0;
+    double max_seconds = 0.0;
+    for (int s = 0; s < num_shards; ++s) {
+      bytes_flat(s) = shard_bytes[s];
+      seconds_flat(s) = static_cast<float>(shard_seconds[s]);
+      total_bytes += shard_bytes[s];
+      max_seconds = std::max(max_seconds, shard_seconds[s]);
+      LOG(INFO) << "Checkpoint shard " << s << " of " << num_shards << ": " << shard_bytes[s] << " bytes in "
+                << shard_seconds[s] << " seconds (" << Throughput(shard_bytes[s], shard_seconds[s]) << " MB/s).";
+    }
+    LOG(INFO) << "Saved checkpoint '" << prefix_string << "': " << total_bytes << " bytes in " << num_shards
+              << " shards, in " << max_seconds + merge_seconds << " seconds ("
+              << Throughput(total_bytes, max_seconds) << " MB/s aggregate).";
+  }
+
+ private:
+  int num_shards_;
+  int64 chunk_size_;
+  std::unique_ptr<thread::ThreadPool> thread_pool_;
+
+  // Writes the provided pieces as a bundle with the provided prefix.
+  static Status WriteShard(Env* env, const string& prefix, const std::vector<const WriteItem*>& items,
+                           const TTypes<string>::ConstFlat& names) {
+    BundleWriter writer(env, prefix);
+    TF_RETURN_IF_ERROR(writer.status());
+    for (const WriteItem* item : items) {
+      const string& name = names(item->index);
+      if (item->is_slice)
+        TF_RETURN_IF_ERROR(writer.AddSlice(name, item->full_shape, item->slice, item->value));
+      else
+        TF_RETURN_IF_ERROR(writer.Add(name, item->value));
+    }
+    return writer.Finish();
+  }
+
+  static double Throughput(int64 bytes, double seconds) {
+    return seconds > 0.0 ? bytes / seconds / (1 << 20) : 0.0;
+  }
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ParallelSaveV2Op);
+};
+
+REGISTER_OP("ParallelSaveV2")
+    .Input("prefix: string")
+    .Input("tensor_names: string")
+    .Input("shape_and_slices: string")
+    .Input("tensors: dtypes")
+    .Output("shard_bytes: int64")
+    .Output("shard_seconds: float")
+    .Attr("dtypes: list(type)")
+    .Attr("num_shards: int >= 1 = 8")
+    .Attr("chunk_size: int >= 0 = 67108864")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      DimensionHandle unused_dim;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 0, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithValue(c->Dim(c->input(1), 0), c->num_inputs() - 3, &unused_dim));
+      TF_RETURN_IF_ERROR(c->WithValue(c->Dim(c->input(2), 0), c->num_inputs() - 3, &unused_dim));
+      c->set_output(0, c->Vector(InferenceContext::kUnknownDim));
+      c->set_output(1, c->Vector(InferenceContext::kUnknownDim));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Saves tensors in the V2 checkpoint format, writing several shards in parallel.
+
+The tensors are split into (at most) 'num_shards' shards of roughly equal size, each of which is written by its own I/O
+thread, and the shards are then merged into a single checkpoint with one data file per shard. Tensors larger than
+'chunk_size' bytes are split along their first dimension and saved as slices, so that they can be spread across shards.
+The resulting checkpoint can be restored using 'RestoreV2'.
+
+prefix: Prefix of the V2 checkpoint to which the tensors are written.
+tensor_names: Names of the tensors to save.
+shape_and_slices: Slice specifications of the tensors to save. Empty strings indicate that the tensors are saved in full.
+tensors: Tensors to save.
+shard_bytes: Number of bytes written by each shard.
+shard_seconds: Time (in seconds) spent writing each shard.
+num_shards: Maximum number of shards (and I/O threads) to use.
+chunk_size: Maximum size (in bytes) of the pieces into which large tensors are split. If 0, tensors are never split.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("ParallelSaveV2").Device(DEVICE_CPU), ParallelSaveV2Op);
+
+// Saves tensors in the V2 checkpoint format, like 'SaveV2', but only writes the rows that changed since the last full
+// (i.e., base) checkpoint, for tensors of which only a few rows are updated between saves (e.g., embedding tables that
+// are updated using sparse gradients).
+//
+// The kernel keeps a 64-bit fingerprint of each row of each tracked tensor, computed when the last base checkpoint was
+// written. Every 'full_save_interval' saves, a new base checkpoint is written. All other saves write delta checkpoints
+// that contain the ranges of rows whose fingerprints differ from the ones of the base checkpoint, along with the rows
+// themselves. Deltas are cumulative (i.e., relative to the base checkpoint and not to the previous delta), so that
+// restoring any checkpoint requires reading at most two checkpoints. Tensors that are slices of partitioned tensors,
+// string tensors, scalars, and tensors of which more than 'max_dirty_fraction' of the rows changed, are written in
+// full. A base checkpoint is also written whenever the previous base checkpoint no longer exists, or when the
+// checkpoint directory changes.
+class IncrementalSaveV2Op : public OpKernel {
+ public:
+  explicit IncrementalSaveV2Op(OpKernelConstruction* context) : OpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("full_save_interval", &full_save_interval_));
+    OP_REQUIRES_OK(context, context->GetAttr("max_dirty_fraction", &max_dirty_fraction_));
+  }
+
+  void Compute(OpKernelContext* context) override {
+    const Tensor& prefix = context->input(0);
+    const Tensor& tensor_names = context->input(1);
+    const Tensor& shape_and_slices = context->input(2);
+    OP_REQUIRES(context, TensorShapeUtils::IsScalar(prefix.shape()),
+                errors::InvalidArgument("'prefix' must be a scalar, but has shape ", prefix.shape().DebugString(),
+                                        "."));
+    const int num_tensors = static_cast<int>(tensor_names.NumElements());
+    OP_REQUIRES(context, shape_and_slices.NumElements() == num_tensors,
+                errors::InvalidArgument("Expected ", num_tensors, " shape and slice specifications, but got ",
+                                        shape_and_slices.NumElements(), "."));
+    OP_REQUIRES(context, context->num_inputs() == num_tensors + 3,
+                errors::InvalidArgument("Expected ", num_tensors, " tensors to save, but got ",
+                                        context->num_inputs() - 3, "."));
+    const string& prefix_string = prefix.scalar<string>()();
+    const auto names_flat = tensor_names.flat<string>();
+    const auto slices_flat = shape_and_slices.flat<string>();
+    Env* env = context->env();
+
+    mutex_lock l(mu_);
+    const bool full = base_prefix_.empty() || saves_since_base_ + 1 >= full_save_interval_ ||
+                      io::Dirname(base_prefix_) != io::Dirname(prefix_string) ||
+                      !env->FileExists(MetaFilename(base_prefix_)).ok();
+    BundleWriter writer(env, prefix_string);
+    OP_REQUIRES_OK(context, writer.status());
+    if (!full) {
+      Tensor base(DT_STRING, TensorShape({}));
+      base.scalar<string>()() = io::Basename(base_prefix_).ToString();
+      OP_REQUIRES_OK(context, writer.Add(kDeltaBaseKey, base));
+    }
+    std::unordered_map<string, TrackedTensor> tracked_tensors;
+    int64 total_rows = 0;
+    int64 dirty_rows = 0;
+    for (int i = 0; i < num_tensors; ++i) {
+      const string& name = names_flat(i);
+      const Tensor& tensor = context->input(i + 3);
+      if (!slices_flat(i).empty()) {
+        TensorShape shape;
+        TensorSlice slice;
+        TensorShape slice_shape;
+        OP_REQUIRES_OK(context, checkpoint::ParseShapeAndSlice(slices_flat(i), &shape, &slice, &slice_shape));
+        OP_REQUIRES(context, slice_shape == tensor.shape(),
+                    errors::InvalidArgument("Slice specification '", slices_flat(i), "' of tensor '", name,
+                                            "' does not match its shape, ", tensor.shape().DebugString(), "."));
+        OP_REQUIRES_OK(context, writer.AddSlice(name, shape, slice, tensor));
+        continue;
+      }
+      if (tensor.dims() < 1 || tensor.dtype() == DT_STRING) {
+        OP_REQUIRES_OK(context, writer.Add(name, tensor));
+        continue;
+      }
+      TrackedTensor current{tensor.dtype(), tensor.shape(), Fingerprints(context, tensor)};
+      auto previous = tracked_tensors_.find(name);
+      if (full || previous == tracked_tensors_.end() || previous->second.dtype != current.dtype ||
+          previous->second.shape != current.shape) {
+        OP_REQUIRES_OK(context, writer.Add(name, tensor));
+      } else {
+        // Collect the maximal ranges of rows whose fingerprints changed.
+        const std::vector<uint64>& base_fingerprints = previous->second.fingerprints;
+        std::vector<std::pair<int64, int64>> ranges;
+        int64 num_dirty = 0;
+        const int64 num_rows = tensor.dim_size(0);
+        for (int64 row = 0; row < num_rows; ++row) {
+          if (current.fingerprints[row] == base_fingerprints[row]) continue;
+          if (!ranges.empty() && ranges.back().first + ranges.back().second == row)
+            ++ranges.back().second;
+          else
+            ranges.emplace_back(row, 1);
+          ++num_dirty;
+        }
+        total_rows += num_rows;
+        dirty_rows += num_dirty;
+        if (num_dirty > max_dirty_fraction_ * num_rows) {
+          OP_REQUIRES_OK(context, writer.Add(name, tensor));
+        } else {
+          Tensor ranges_tensor(DT_INT64, TensorShape({static_cast<int64>(ranges.size()), 2}));
+          TensorShape rows_shape = tensor.shape();
+          rows_shape.set_dim(0, num_dirty);
+          Tensor rows_tensor(tensor.dtype(), rows_shape);
+          auto ranges_matrix = ranges_tensor.matrix<int64>();
+          const int64 row_bytes = num_rows > 0 ? tensor.TotalBytes() / num_rows : 0;
+          const char* source = tensor.tensor_data().data();
+          char* target = const_cast<char*>(rows_tensor.tensor_data().data());
+          for (size_t r = 0; r < ranges.size(); ++r) {
+            ranges_matrix(r, 0) = ranges[r].first;
+            ranges_matrix(r, 1) = ranges[r].second;
+            memcpy(target, source + ranges[r].first * row_bytes, ranges[r].second * row_bytes);
+            target += ranges[r].second * row_bytes;
+          }
+          OP_REQUIRES_OK(context, writer.Add(kDeltaRangesPrefix + name, ranges_tensor));
+          OP_REQUIRES_OK(context, writer.Add(kDeltaRowsPrefix + name, rows_tensor));
+        }
+      }
+      if (full) tracked_tensors.emplace(name, std::move(current));
+    }
+    OP_REQUIRES_OK(context, writer.Finish());
+
+    if (full) {
+      base_prefix_ = prefix_string;
+      saves_since_base_ = 0;
+      tracked_tensors_ = std::move(tracked_tensors);
+      LOG(INFO) << "Saved base checkpoint '" << prefix_string << "'.";
+    } else {
+      ++saves_since_base_;
+      LOG(INFO) << "Saved delta checkpoint '" << prefix_string << "' (relative to '" << base_prefix_ << "'): "
+                << dirty_rows << " of " << total_rows << " tracked rows changed.";
+    }
+  }
+
+ private:
+  struct TrackedTensor {
+    DataType dtype;
+    TensorShape shape;
+    std::vector<uint64> fingerprints;
+  };
+
+  int full_save_interval_;
+  float max_dirty_fraction_;
+
+  mutex mu_;
+  string base_prefix_ GUARDED_BY(mu_);
+  int saves_since_base_ GUARDED_BY(mu_) = 0;
+  std::unordered_map<string, TrackedTensor> tracked_tensors_ GUARDED_BY(mu_);
+
+  // Returns the fingerprints of the rows (i.e., slices along the first dimension) of 'tensor', computed in parallel.
+  static std::vector<uint64> Fingerprints(OpKernelContext* context, const Tensor& tensor) {
+    const int64 num_rows = tensor.dim_size(0);
+    const int64 row_bytes = num_rows > 0 ? tensor.TotalBytes() / num_rows : 0;
+    const char* data = tensor.tensor_data().data();
+    std::vector<uint64> fingerprints(num_rows);
+    auto worker_threads = context->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads->num_threads, worker_threads->workers, num_rows, row_bytes, [&](int64 start, int64 limit) {
+      for (int64 row = start; row < limit; ++row)
+        fingerprints[row] = Hash64(data + row * row_bytes, row_bytes);
+    });
+    return fingerprints;
+  }
+
+  TF_DISALLOW_COPY_AND_ASSIGN(IncrementalSaveV2Op);
+};
+
+REGISTER_OP("IncrementalSaveV2")
+    .Input("prefix: string")
+    .Input("tensor_names: string")
+    .Input("shape_and_slices: string")
+    .Input("tensors: dtypes")
+    .Attr("dtypes: list(type)")
+    .Attr("full_save_interval: int >= 1 = 10")
+    .Attr("max_dirty_fraction: float = 0.5")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      DimensionHandle unused_dim;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 0, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithValue(c->Dim(c->input(1), 0), c->num_inputs() - 3, &unused_dim));
+      TF_RETURN_IF_ERROR(c->WithValue(c->Dim(c->input(2), 0), c->num_inputs() - 3, &unused_dim));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Saves tensors in the V2 checkpoint format, only writing the rows that changed since the last base checkpoint.
+
+Every 'full_save_interval' saves, this op writes a full (i.e., base) checkpoint, like 'SaveV2'. All other saves write
+delta checkpoints, which only contain the rows of each tensor that changed since the base checkpoint was written (as
+detected using row fingerprints), and refer to the base checkpoint, which must be kept. Delta checkpoints must be
+restored using 'IncrementalRestoreV2' (or a 'CheckpointReader'), which merges them with their base checkpoints.
+
+prefix: Prefix of the V2 checkpoint to which the tensors are written.
+tensor_names: Names of the tensors to save.
+shape_and_slices: Slice specifications of the tensors to save. Empty strings indicate that the tensors are saved in
+  full.
+tensors: Tensors to save.
+full_save_interval: Number of saves after which a new base checkpoint is written. If 1, all checkpoints are full.
+max_dirty_fraction: Maximum fraction of changed rows for which a tensor is saved as a delta. Tensors with more changed
+  rows are saved in full.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("IncrementalSaveV2").Device(DEVICE_CPU), IncrementalSaveV2Op);
+
+// Restores tensors from V2 checkpoints, like 'RestoreV2', but also supports delta checkpoints written by
+// 'IncrementalSaveV2', which are merged with their base checkpoints.
+class IncrementalRestoreV2Op : public OpKernel {
+ public:
+  explicit IncrementalRestoreV2Op(OpKernelConstruction* context) : OpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("dtypes", &dtypes_));
+  }
+
+  void Compute(OpKernelContext* context) override {
+    const Tensor& prefix = context->input(0);
+    const Tensor& tensor_names = context->input(1);
+    const Tensor& shape_and_slices = context->input(2);
+    OP_REQUIRES(context, TensorShapeUtils::IsScalar(prefix.shape()),
+                errors::InvalidArgument("'prefix' must be a scalar, but has shape ", prefix.shape().DebugString(),
+                                        "."));
+    const int num_tensors = static_cast<int>(tensor_names.NumElements());
+    OP_REQUIRES(context, shape_and_slices.NumElements() == num_tensors && dtypes_.size() == num_tensors,
+                errors::InvalidArgument("Expected ", num_tensors, " shape and slice specifications and data types, ",
+                                        "but got ", shape_and_slices.NumElements(), " and ", dtypes_.size(), "."));
+    const string& prefix_string = prefix.scalar<string>()();
+    const auto names_flat = tensor_names.flat<string>();
+    const auto slices_flat = shape_and_slices.flat<string>();
+    Env* env = context->env();
+
+    BundleReader reader(env, prefix_string);
+    OP_REQUIRES_OK(context, reader.status());
+    std::unique_ptr<BundleReader> base_reader;
+    if (reader.Contains(kDeltaBaseKey)) {
+      Tensor base(DT_STRING, TensorShape({}));
+      OP_REQUIRES_OK(context, reader.Lookup(kDeltaBaseKey, &base));
+      base_reader.reset(new BundleReader(env, io::JoinPath(io::Dirname(prefix_string), base.scalar<string>()())));
+      OP_REQUIRES_OK(context, base_reader->status());
+    }
+    for (int i = 0; i < num_tensors; ++i) {
+      const string& name = names_flat(i);
+      const bool patched = base_reader != nullptr && !reader.Contains(name) &&
+                           reader.Contains(kDeltaRowsPrefix + name);
+      BundleReader* source = patched ? base_reader.get() : &reader;
+      DataType dtype;
+      TensorShape shape;
+      OP_REQUIRES_OK(context, source->LookupDtypeAndShape(name, &dtype, &shape));
+      OP_REQUIRES(context, dtype == dtypes_[i],
+                  errors::InvalidArgument("Expected tensor '", name, "' to have data type ",
+                                          DataTypeString(dtypes_[i]), ", but it has data type ",
+                                          DataTypeString(dtype), "."));
+      Tensor* value = nullptr;
+      TensorSlice slice(shape.dims());
+      if (slices_flat(i).empty()) {
+        OP_REQUIRES_OK(context, context->allocate_output(i, shape, &value));
+        OP_REQUIRES_OK(context, source->Lookup(name, value));
+      } else {
+        TensorShape slice_shape;
+        OP_REQUIRES_OK(context, checkpoint::ParseShapeAndSlice(slices_flat(i), &shape, &slice, &slice_shape));
+        OP_REQUIRES_OK(context, context->allocate_output(i, slice_shape, &value));
+        OP_REQUIRES_OK(context, source->LookupSlice(name, slice, value));
+      }
+      if (patched) OP_REQUIRES_OK(context, ApplyDelta(&reader, name, shape, slice, value));
+    }
+  }
+
+ private:
+  DataTypeVector dtypes_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(IncrementalRestoreV2Op);
+};
+
+REGISTER_OP("IncrementalRestoreV2")
+    .Input("prefix: string")
+    .Input("tensor_names: string")
+    .Input("shape_and_slices: string")
+    .Output("tensors: dtypes")
+    .Attr("dtypes: list(type)")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 0, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &unused));
+      for (int i = 0; i < c->num_outputs(); ++i) c->set_output(i, c->UnknownShape());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Restores tensors from V2 checkpoints, merging delta checkpoints with their base checkpoints.
+
+Full checkpoints are restored like using 'RestoreV2'. For delta checkpoints written by 'IncrementalSaveV2', the tensors
+that were saved as deltas are read from the base checkpoint and their changed rows are then overwritten with the ones
+stored in the delta checkpoint. Only V2 checkpoints are supported.
+
+prefix: Prefix of the V2 checkpoint from which the tensors are restored.
+tensor_names: Names of the tensors to restore.
+shape_and_slices: Slice specifications of the tensors to restore. Empty strings indicate that the tensors are restored
+  in full.
+tensors: Restored tensors.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("IncrementalRestoreV2").Device(DEVICE_CPU), IncrementalRestoreV2Op);
+
+}  // namespace tensorflow
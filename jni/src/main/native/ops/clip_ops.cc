@@ -0,0 +1,175 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Tensors with at least this many elements are processed using all intra-op threads. Smaller tensors are processed
+  // by single threads, with many tensors being processed in parallel.
+  const int64 kParallelThreshold = 1 << 16;
+
+  // Per-element cost estimate of both passes, in cycles, which is used to shard the small tensors over threads.
+  const int64 kElementCost = 4;
+
+  // Calls `fn(i, multi_threaded)` for each index `i` in `[0, sizes.size())`, where `sizes` contains the numbers of
+  // elements of the tensors to process. Large tensors are processed one after the other, with `multi_threaded` set to
+  // `true`, while small tensors are processed in parallel over the CPU worker threads.
+  template <typename Fn>
+  void ForEachTensor(OpKernelContext* ctx, const std::vector<int64>& sizes, const Fn& fn) {
+    std::vector<int> small;
+    int64 small_elements = 0;
+    for (int i = 0; i < sizes.size(); ++i) {
+      if (sizes[i] >= kParallelThreshold) {
+        fn(i, true);
+      } else {
+        small.push_back(i);
+        small_elements += sizes[i];
+      }
+    }
+    if (!small.empty()) {
+      const DeviceBase::CpuWorkerThreads* worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+      const int64 cost_per_tensor = std::max<int64>(1, small_elements / small.size()) * kElementCost;
+      Shard(worker_threads->num_threads, worker_threads->workers, small.size(), cost_per_tensor,
+            [&fn, &small](int64 start, int64 limit) {
+              for (int64 index = start; index < limit; ++index) fn(small[index], false);
+            });
+    }
+  }
+}  // namespace
+
+// Kernel that clips a list of `N` tensors by the ratio of `clip_norm` to their global norm, using two passes over all
+// tensors, instead of two ops per tensor and a reduction over their norms. The first pass computes the sum of squares
+// of each tensor and the second one scales the tensors, in-place whenever their buffers can be forwarded to the
+// outputs. Both passes are vectorized Eigen expressions over the flattened tensors.
+template <typename T>
+class ClipByGlobalNormListOp : public OpKernel {
+ public:
+  explicit ClipByGlobalNormListOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("N", &n_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& clip_norm_tensor = ctx->input(n_);
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsScalar(clip_norm_tensor.shape()),
+        errors::InvalidArgument("'clip_norm' must be a scalar, but it has shape ",
+                                clip_norm_tensor.shape().DebugString(), "."));
+    const T clip_norm = clip_norm_tensor.scalar<T>()();
+
+    std::vector<int64> sizes(n_);
+    for (int i = 0; i < n_; ++i) sizes[i] = ctx->input(i).NumElements();
+
+    // First pass: compute the sum of squares of each tensor.
+    std::vector<T> sums_of_squares(n_, T(0));
+    ForEachTensor(ctx, sizes, [ctx, &sums_of_squares](int i, bool multi_threaded) {
+      typename TTypes<T>::ConstFlat values = ctx->input(i).template flat<T>();
+      Eigen::Tensor<T, 0, Eigen::RowMajor> sum;
+      if (multi_threaded) {
+        sum.device(ctx->eigen_device<CPUDevice>()) = values.square().sum();
+      } else {
+        sum = values.square().sum();
+      }
+      sums_of_squares[i] = sum();
+    });
+    T sum_of_squares = T(0);
+    for (const T& s : sums_of_squares) sum_of_squares += s;
+    const T global_norm = std::sqrt(sum_of_squares);
+
+    Tensor* global_norm_tensor = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(n_, TensorShape({}), &global_norm_tensor));
+    global_norm_tensor->scalar<T>()() = global_norm;
+
+    // Second pass: scale the tensors. This matches the non-fused implementation, which multiplies by
+    // `clip_norm * min(1 / global_norm, 1 / clip_norm)`, and thus also produces `NaN` values for non-finite norms.
+    const T scale = clip_norm * std::min(T(1) / global_norm, T(1) / clip_norm);
+    std::vector<Tensor*> outputs(n_, nullptr);
+    for (int i = 0; i < n_; ++i)
+      OP_REQUIRES_OK(ctx, ctx->forward_input_or_allocate_output({i}, i, ctx->input(i).shape(), &outputs[i]));
+    ForEachTensor(ctx, sizes, [ctx, &outputs, scale](int i, bool multi_threaded) {
+      const Tensor& input = ctx->input(i);
+      const bool in_place = outputs[i]->tensor_data().data() == input.tensor_data().data();
+      if (in_place && scale == T(1)) return;
+      typename TTypes<T>::Flat output = outputs[i]->template flat<T>();
+      typename TTypes<T>::ConstFlat values = input.template flat<T>();
+      if (multi_threaded) {
+        output.device(ctx->eigen_device<CPUDevice>()) = values * values.constant(scale);
+      } else {
+        output = values * values.constant(scale);
+      }
+    });
+  }
+
+ private:
+  int n_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ClipByGlobalNormListOp);
+};
+
+REGISTER_OP("ClipByGlobalNormList")
+    .Input("t: N * T")
+    .Input("clip_norm: T")
+    .Output("output: N * T")
+    .Output("global_norm: T")
+    .Attr("N: int >= 1")
+    .Attr("T: {float, double}")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(c->num_inputs() - 1), 0, &unused));
+      for (int i = 0; i < c->num_inputs() - 1; ++i) c->set_output(i, c->input(i));
+      c->set_output(c->num_outputs() - 1, c->Scalar());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Clips the values of the tensors in 't' by the ratio of 'clip_norm' to their global norm, in a single op.
+
+global_norm = sqrt(sum([l2norm(t)**2 for t in t_list]))
+output[i] = t[i] * clip_norm / max(global_norm, clip_norm)
+
+t: Tensors to clip.
+clip_norm: Maximum clipping value. Must be a scalar.
+output: Clipped tensors.
+global_norm: Global norm of all tensors in 't'.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T)                                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("ClipByGlobalNormList").Device(DEVICE_CPU).TypeConstraint<T>("T"),                        \
+      ClipByGlobalNormListOp<T>);
+
+REGISTER_CPU_KERNELS(float);
+REGISTER_CPU_KERNELS(double);
+#undef REGISTER_CPU_KERNELS
+}  // namespace tensorflow
@@ -0,0 +1,78 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_DELIMITER_MATCHER_H_
+#define TENSORFLOW_DELIMITER_MATCHER_H_
+
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Finds the positions of delimiter bytes in strings. It is used by the text ops (in the op library) and by the corpus
+// loader (in the JNI library). Both libraries compile this header, and so all of its methods are defined inline.
+class DelimiterMatcher {
+ public:
+  // Maximum number of distinct delimiter bytes that are matched using SIMD instructions. Larger delimiter sets are
+  // matched one byte at a time, using a lookup table.
+  static const int kMaxSimdDelimiters = 8;
+
+  explicit DelimiterMatcher(const std::string& delimiters) : is_delimiter_(256, false) {
+    for (const char c : delimiters) {
+      if (is_delimiter_[static_cast<uint8>(c)]) continue;
+      is_delimiter_[static_cast<uint8>(c)] = true;
+      delimiters_.push_back(c);
+    }
+  }
+
+  bool IsDelimiter(char c) const { return is_delimiter_[static_cast<uint8>(c)]; }
+
+  // Returns the position of the first delimiter in 'data[start, size)', or 'size' if there is none.
+  int64 Find(const char* data, int64 size, int64 start) const {
+    int64 i = start;
+#if defined(__SSE2__)
+    const int num_delimiters = static_cast<int>(delimiters_.size());
+    if (num_delimiters <= kMaxSimdDelimiters) {
+      __m128i broadcast_delimiters[kMaxSimdDelimiters];
+      for (int d = 0; d < num_delimiters; ++d) broadcast_delimiters[d] = _mm_set1_epi8(delimiters_[d]);
+      for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i matches = _mm_setzero_si128();
+        for (int d = 0; d < num_delimiters; ++d)
+          matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, broadcast_delimiters[d]));
+        const int mask = _mm_movemask_epi8(matches);
+        if (mask != 0) return i + __builtin_ctz(static_cast<unsigned int>(mask));
+      }
+    }
+#endif
+    for (; i < size; ++i)
+      if (is_delimiter_[static_cast<uint8>(data[i])]) return i;
+    return size;
+  }
+
+ private:
+  std::vector<bool> is_delimiter_;
+  std::vector<char> delimiters_;
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_DELIMITER_MATCHER_H_
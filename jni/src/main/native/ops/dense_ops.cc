@@ -0,0 +1,293 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include "lstm_ops.h"
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+
+namespace tensorflow {
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+
+namespace {
+  using shape_inference::DimensionHandle;
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Activation functions supported by the fused dense kernels.
+  enum class Activation { NONE, RELU, RELU6, ELU, TANH, SIGMOID };
+
+  Status ParseActivation(const string& name, Activation* activation) {
+    if (name == "none") *activation = Activation::NONE;
+    else if (name == "relu") *activation = Activation::RELU;
+    else if (name == "relu6") *activation = Activation::RELU6;
+    else if (name == "elu") *activation = Activation::ELU;
+    else if (name == "tanh") *activation = Activation::TANH;
+    else if (name == "sigmoid") *activation = Activation::SIGMOID;
+    else return errors::InvalidArgument("Unsupported activation '", name, "'.");
+    return Status::OK();
+  }
+
+  // Shape function for `FusedDense`, whose output is shaped `[batch_size, num_units]`.
+  Status FusedDenseShapeFn(InferenceContext* c) {
+    ShapeHandle x, w, b;
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &x));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &w));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &b));
+    DimensionHandle unused;
+    TF_RETURN_IF_ERROR(c->Merge(c->Dim(x, 1), c->Dim(w, 0), &unused));
+    DimensionHandle num_units;
+    TF_RETURN_IF_ERROR(c->Merge(c->Dim(w, 1), c->Dim(b, 0), &num_units));
+    c->set_output(0, c->Matrix(c->Dim(x, 0), num_units));
+    return Status::OK();
+  }
+
+  // Shape function for `FusedDenseGrad`, whose outputs are shaped as the corresponding forward step inputs.
+  Status FusedDenseGradShapeFn(InferenceContext* c) {
+    ShapeHandle x, w;
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &x));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &w));
+    c->set_output(0, x);
+    c->set_output(1, w);
+    c->set_output(2, c->Vector(c->Dim(w, 1)));
+    return Status::OK();
+  }
+}  // namespace
+
+// Kernel that computes `activation(x * w + b)`. The matrix multiplication is an Eigen contraction evaluated on the
+// (multi-threaded) CPU device, and the bias addition and the activation are then applied together, in place, in a
+// single pass over the product. This avoids materializing the product and the biased product as separate tensors.
+template <typename T>
+class FusedDenseOp : public OpKernel {
+ public:
+  explicit FusedDenseOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    string activation;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("activation", &activation));
+    OP_REQUIRES_OK(ctx, ParseActivation(activation, &activation_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& x = ctx->input(0);
+    const Tensor& w = ctx->input(1);
+    const Tensor& b = ctx->input(2);
+    OP_REQUIRES(ctx, TensorShapeUtils::IsMatrix(x.shape()),
+                errors::InvalidArgument("'x' must be a matrix, but it has shape ", x.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsMatrix(w.shape()),
+                errors::InvalidArgument("'w' must be a matrix, but it has shape ", w.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsVector(b.shape()),
+                errors::InvalidArgument("'b' must be a vector, but it has shape ", b.shape().DebugString(), "."));
+    const int64 batch_size = x.dim_size(0);
+    const int64 num_units = w.dim_size(1);
+    OP_REQUIRES(ctx, x.dim_size(1) == w.dim_size(0),
+                errors::InvalidArgument("x.dims(1) = ", x.dim_size(1), " must match w.dims(0) = ", w.dim_size(0),
+                                        "."));
+    OP_REQUIRES(ctx, b.dim_size(0) == num_units,
+                errors::InvalidArgument("b.dims(0) = ", b.dim_size(0), " must match w.dims(1) = ", num_units, "."));
+
+    Tensor* output = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({batch_size, num_units}), &output));
+    if (output->NumElements() == 0) return;
+
+    const CPUDevice& d = ctx->eigen_device<CPUDevice>();
+    typename TTypes<T>::Matrix y = output->matrix<T>();
+    if (x.dim_size(1) == 0)
+      y.device(d) = y.constant(T(0));
+    else
+      functor::TensorBlasGemm<CPUDevice, T, false>::compute(ctx, d, false, false, x.matrix<T>(), w.matrix<T>(), y);
+
+    Eigen::array<Eigen::DenseIndex, 2> b_shape({1, num_units});
+    Eigen::array<Eigen::DenseIndex, 2> broadcast_shape({batch_size, 1});
+    auto z = y + b.vec<T>().reshape(b_shape).broadcast(broadcast_shape);
+    switch (activation_) {
+      case Activation::NONE:
+        y.device(d) = z;
+        break;
+      case Activation::RELU:
+        y.device(d) = z.cwiseMax(T(0));
+        break;
+      case Activation::RELU6:
+        y.device(d) = z.cwiseMax(T(0)).cwiseMin(T(6));
+        break;
+      case Activation::ELU:
+        y.device(d) = (z < T(0)).select(z.exp() - y.constant(T(1)), z);
+        break;
+      case Activation::TANH:
+        y.device(d) = z.tanh();
+        break;
+      case Activation::SIGMOID:
+        y.device(d) = z.sigmoid();
+        break;
+    }
+  }
+
+ private:
+  Activation activation_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(FusedDenseOp);
+};
+
+// Kernel that computes the gradients of `FusedDense`. The gradient with respect to the pre-activation product is
+// computed from the forward step output in a single element-wise pass, and it is then reduced to obtain the bias
+// gradient and multiplied with the forward step inputs to obtain the remaining gradients.
+template <typename T>
+class FusedDenseGradOp : public OpKernel {
+ public:
+  explicit FusedDenseGradOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    string activation;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("activation", &activation));
+    OP_REQUIRES_OK(ctx, ParseActivation(activation, &activation_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& x = ctx->input(0);
+    const Tensor& w = ctx->input(1);
+    const Tensor& y = ctx->input(2);
+    const Tensor& y_grad = ctx->input(3);
+    OP_REQUIRES(ctx, TensorShapeUtils::IsMatrix(x.shape()),
+                errors::InvalidArgument("'x' must be a matrix, but it has shape ", x.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsMatrix(w.shape()),
+                errors::InvalidArgument("'w' must be a matrix, but it has shape ", w.shape().DebugString(), "."));
+    const int64 batch_size = x.dim_size(0);
+    const int64 input_size = x.dim_size(1);
+    const int64 num_units = w.dim_size(1);
+    const TensorShape y_shape({batch_size, num_units});
+    OP_REQUIRES(ctx, y.shape() == y_shape,
+                errors::InvalidArgument("'y' must have shape ", y_shape.DebugString(), ", but it has shape ",
+                                        y.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, y_grad.shape() == y_shape,
+                errors::InvalidArgument("'y_grad' must have shape ", y_shape.DebugString(), ", but it has shape ",
+                                        y_grad.shape().DebugString(), "."));
+
+    Tensor* x_grad = nullptr;
+    Tensor* w_grad = nullptr;
+    Tensor* b_grad = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, x.shape(), &x_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, w.shape(), &w_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(2, TensorShape({num_units}), &b_grad));
+
+    const CPUDevice& d = ctx->eigen_device<CPUDevice>();
+    if (batch_size == 0 || num_units == 0) {
+      x_grad->matrix<T>().device(d) = x_grad->matrix<T>().constant(T(0));
+      w_grad->matrix<T>().device(d) = w_grad->matrix<T>().constant(T(0));
+      b_grad->vec<T>().device(d) = b_grad->vec<T>().constant(T(0));
+      return;
+    }
+
+    Tensor z_grad_tensor;
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(DataTypeToEnum<T>::v(), y_shape, &z_grad_tensor));
+    typename TTypes<T>::Matrix z_grad = z_grad_tensor.matrix<T>();
+    typename TTypes<T>::ConstMatrix a = y.matrix<T>();
+    typename TTypes<T>::ConstMatrix g = y_grad.matrix<T>();
+    switch (activation_) {
+      case Activation::NONE:
+        z_grad.device(d) = g;
+        break;
+      case Activation::RELU:
+        z_grad.device(d) = (a > T(0)).select(g, g.constant(T(0)));
+        break;
+      case Activation::RELU6:
+        z_grad.device(d) = (a > T(0)).select((a < T(6)).select(g, g.constant(T(0))), g.constant(T(0)));
+        break;
+      case Activation::ELU:
+        z_grad.device(d) = (a < T(0)).select(g * (a + a.constant(T(1))), g);
+        break;
+      case Activation::TANH:
+        z_grad.device(d) = g * (a.constant(T(1)) - a.square());
+        break;
+      case Activation::SIGMOID:
+        z_grad.device(d) = g * a * (a.constant(T(1)) - a);
+        break;
+    }
+
+    typename TTypes<T>::ConstMatrix const_z_grad(z_grad.data(), z_grad.dimensions());
+    Eigen::array<Eigen::DenseIndex, 1> batch_axis({0});
+    b_grad->vec<T>().device(d) = const_z_grad.sum(batch_axis);
+    if (input_size == 0) return;
+    functor::TensorBlasGemm<CPUDevice, T, false>::compute(
+        ctx, d, false, true, const_z_grad, w.matrix<T>(), x_grad->matrix<T>());
+    functor::TensorBlasGemm<CPUDevice, T, false>::compute(
+        ctx, d, true, false, x.matrix<T>(), const_z_grad, w_grad->matrix<T>());
+  }
+
+ private:
+  Activation activation_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(FusedDenseGradOp);
+};
+
+REGISTER_OP("FusedDense")
+    .Input("x: T")
+    .Input("w: T")
+    .Input("b: T")
+    .Output("y: T")
+    .Attr("activation: {'none', 'relu', 'relu6', 'elu', 'tanh', 'sigmoid'} = 'none'")
+    .Attr("T: {float, double}")
+    .SetShapeFn(FusedDenseShapeFn)
+    .Doc(R"doc(
+Computes `activation(x * w + b)` for a dense (i.e., fully-connected) layer, in a single kernel.
+
+x: The input to the layer, shaped `[batch_size, input_size]`.
+w: The weight matrix, shaped `[input_size, num_units]`.
+b: The bias vector, shaped `[num_units]`.
+y: The output of the layer, shaped `[batch_size, num_units]`.
+activation: Activation function applied to the biased product.
+)doc");
+
+REGISTER_OP("FusedDenseGrad")
+    .Input("x: T")
+    .Input("w: T")
+    .Input("y: T")
+    .Input("y_grad: T")
+    .Output("x_grad: T")
+    .Output("w_grad: T")
+    .Output("b_grad: T")
+    .Attr("activation: {'none', 'relu', 'relu6', 'elu', 'tanh', 'sigmoid'} = 'none'")
+    .Attr("T: {float, double}")
+    .SetShapeFn(FusedDenseGradShapeFn)
+    .Doc(R"doc(
+Computes the gradients of a dense layer (i.e., of `FusedDense`), in a single kernel.
+
+x: The input to the layer, shaped `[batch_size, input_size]`.
+w: The weight matrix, shaped `[input_size, num_units]`.
+y: The output of the layer, as computed by the forward step.
+y_grad: The gradient of the loss with respect to `y`.
+x_grad: The gradient of the loss with respect to `x`.
+w_grad: The gradient of the loss with respect to `w`.
+b_grad: The gradient of the loss with respect to `b`.
+activation: Activation function applied to the biased product in the forward step.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T)                                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("FusedDense").Device(DEVICE_CPU).TypeConstraint<T>("T"),                                  \
+      FusedDenseOp<T>);                                                                               \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("FusedDenseGrad").Device(DEVICE_CPU).TypeConstraint<T>("T"),                              \
+      FusedDenseGradOp<T>);
+
+REGISTER_CPU_KERNELS(float);
+REGISTER_CPU_KERNELS(double);
+#undef REGISTER_CPU_KERNELS
+}  // namespace tensorflow
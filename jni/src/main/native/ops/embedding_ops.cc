@@ -0,0 +1,519 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "third_party/eigen3/Eigen/Core"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  enum class Combiner { kSum, kMean, kSqrtN };
+  enum class PartitionStrategy { kMod, kDiv };
+
+  Status GetCombiner(OpKernelConstruction* ctx, Combiner* combiner) {
+    string name;
+    TF_RETURN_IF_ERROR(ctx->GetAttr("combiner", &name));
+    if (name == "sum") {
+      *combiner = Combiner::kSum;
+    } else if (name == "mean") {
+      *combiner = Combiner::kMean;
+    } else if (name == "sqrtn") {
+      *combiner = Combiner::kSqrtN;
+    } else {
+      return errors::InvalidArgument("Invalid combiner: '", name, "'.");
+    }
+    return Status::OK();
+  }
+
+  Status GetPartitionStrategy(OpKernelConstruction* ctx, PartitionStrategy* strategy) {
+    string name;
+    TF_RETURN_IF_ERROR(ctx->GetAttr("partition_strategy", &name));
+    if (name == "mod") {
+      *strategy = PartitionStrategy::kMod;
+    } else if (name == "div") {
+      *strategy = PartitionStrategy::kDiv;
+    } else {
+      return errors::InvalidArgument("Invalid partition strategy: '", name, "'.");
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  using Row = Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1>>;
+
+  template <typename T>
+  using ConstRow = Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>;
+
+  // Parsed and validated inputs that are common to the sparse embedding lookup op and its gradient ops. This struct
+  // maps each looked up id to its partition and to its row within that partition (following the same partitioning
+  // strategies as the `embeddingLookup` function of the Scala API), and computes the row ranges of each segment.
+  template <typename T, typename Tidx>
+  struct SparseEmbeddingLookupInputs {
+    OpInputList params;
+    const Tensor* weights = nullptr;
+    TensorShape row_shape;
+    int64 row_size = 0;
+    int64 num_entries = 0;
+    int64 num_segments = 0;
+    std::vector<int32> partitions;
+    std::vector<int64> rows;
+    std::vector<int64> segment_starts;
+
+    Status Parse(OpKernelContext* ctx, PartitionStrategy strategy) {
+      TF_RETURN_IF_ERROR(ctx->input_list("params", &params));
+      const Tensor* ids;
+      const Tensor* segment_ids;
+      TF_RETURN_IF_ERROR(ctx->input("ids", &ids));
+      TF_RETURN_IF_ERROR(ctx->input("segment_ids", &segment_ids));
+      TF_RETURN_IF_ERROR(ctx->input("weights", &weights));
+
+      // Validate the parameter partitions.
+      const int num_partitions = params.size();
+      int64 total_rows = 0;
+      for (int p = 0; p < num_partitions; ++p) {
+        if (params[p].dims() < 1)
+          return errors::InvalidArgument("'params' tensors must have rank at least 1, but partition ", p, " has shape ",
+                                         params[p].shape().DebugString(), ".");
+        TensorShape partition_row_shape = params[p].shape();
+        partition_row_shape.RemoveDim(0);
+        if (p == 0) {
+          row_shape = partition_row_shape;
+        } else if (partition_row_shape != row_shape) {
+          return errors::InvalidArgument("All 'params' tensors must have the same shape, except for their first ",
+                                         "dimension, but partition 0 has shape ", params[0].shape().DebugString(),
+                                         " and partition ", p, " has shape ", params[p].shape().DebugString(), ".");
+        }
+        total_rows += params[p].dim_size(0);
+      }
+      row_size = row_shape.num_elements();
+
+      // Validate the ids, the segment ids, and the weights.
+      if (!TensorShapeUtils::IsVector(ids->shape()))
+        return errors::InvalidArgument("'ids' must be a vector, but has shape ", ids->shape().DebugString(), ".");
+      num_entries = ids->NumElements();
+      if (!TensorShapeUtils::IsVector(segment_ids->shape()) || segment_ids->NumElements() != num_entries)
+        return errors::InvalidArgument("'segment_ids' must be a vector with the same size as 'ids' (", num_entries,
+                                       "), but has shape ", segment_ids->shape().DebugString(), ".");
+      if (!TensorShapeUtils::IsVector(weights->shape()) ||
+          (weights->NumElements() != 0 && weights->NumElements() != num_entries))
+        return errors::InvalidArgument("'weights' must be either an empty vector or a vector with the same size as ",
+                                       "'ids' (", num_entries, "), but has shape ", weights->shape().DebugString(),
+                                       ".");
+
+      // Map the ids to partitions and rows.
+      const auto ids_flat = ids->flat<Tidx>();
+      const int64 ids_per_partition = total_rows / num_partitions;
+      const int64 extras = total_rows % num_partitions;
+      const int64 threshold = extras * (ids_per_partition + 1);
+      partitions.resize(num_entries);
+      rows.resize(num_entries);
+      for (int64 i = 0; i < num_entries; ++i) {
+        const int64 id = static_cast<int64>(ids_flat(i));
+        int64 partition = -1;
+        int64 row = -1;
+        if (id >= 0) {
+          if (strategy == PartitionStrategy::kMod) {
+            partition = id % num_partitions;
+            row = id / num_partitions;
+          } else if (id < threshold) {
+            partition = id / (ids_per_partition + 1);
+            row = id % (ids_per_partition + 1);
+          } else if (ids_per_partition > 0) {
+            partition = extras + (id - threshold) / ids_per_partition;
+            row = (id - threshold) % ids_per_partition;
+          }
+        }
+        if (partition < 0 || partition >= num_partitions || row >= params[partition].dim_size(0))
+          return errors::InvalidArgument("'ids(", i, ")' = ", id, " is not in [0, ", total_rows, ").");
+        partitions[i] = static_cast<int32>(partition);
+        rows[i] = row;
+      }
+
+      // Compute the segment ranges, where segment 's' consists of the entries in
+      // '[segment_starts[s], segment_starts[s + 1])'.
+      const auto segment_ids_flat = segment_ids->flat<int32>();
+      num_segments = num_entries > 0 ? static_cast<int64>(segment_ids_flat(num_entries - 1)) + 1 : 0;
+      segment_starts.assign(num_segments + 1, num_entries);
+      int64 segment = 0;
+      int32 previous_segment_id = 0;
+      for (int64 i = 0; i < num_entries; ++i) {
+        const int32 segment_id = segment_ids_flat(i);
+        if (segment_id < previous_segment_id || segment_id >= num_segments)
+          return errors::InvalidArgument("'segment_ids' must be non-negative and sorted in non-decreasing order, but ",
+                                         "'segment_ids(", i, ")' = ", segment_id, ".");
+        while (segment <= segment_id) segment_starts[segment++] = i;
+        previous_segment_id = segment_id;
+      }
+      return Status::OK();
+    }
+
+    inline T weight(int64 i) const {
+      return weights->NumElements() == 0 ? T(1) : weights->flat<T>()(i);
+    }
+
+    inline const T* row(int64 i) const {
+      return params[partitions[i]].template flat<T>().data() + rows[i] * row_size;
+    }
+
+    // Returns the total weight of segment 's', as used by the combiner, which is either the sum of the weights of its
+    // entries or the sum of their squares.
+    inline T total_weight(Combiner combiner, int64 s) const {
+      T total = T(0);
+      for (int64 i = segment_starts[s]; i < segment_starts[s + 1]; ++i) {
+        const T w = weight(i);
+        total += combiner == Combiner::kSqrtN ? w * w : w;
+      }
+      return total;
+    }
+
+    // Returns the factor by which the weighted sum of the embeddings in segment 's' is scaled by the combiner. Segments
+    // with zero total weight are not scaled.
+    inline T scale(Combiner combiner, int64 s) const {
+      if (combiner == Combiner::kSum) return T(1);
+      const T total = total_weight(combiner, s);
+      if (total == T(0)) return T(1);
+      return combiner == Combiner::kMean ? T(1) / total : T(1) / std::sqrt(total);
+    }
+
+    // Cost estimate for processing one segment, in cycles, which is used for sharding the work over threads.
+    inline int64 segment_cost() const {
+      return (num_segments > 0 ? std::max(num_entries / num_segments, int64{1}) : 1) * (row_size + 1) * 2;
+    }
+  };
+}  // namespace
+
+// Looks up the embeddings of a batch of sparse ids in a (possibly partitioned) embedding map and combines them, in a
+// single pass over the ids. The embeddings of each segment are accumulated directly into the corresponding output row,
+// using vectorized (Eigen) operations, and so no intermediate tensor is materialized. Segments are processed in
+// parallel over the CPU worker threads.
+template <typename T, typename Tidx>
+class SparseEmbeddingLookupOp : public OpKernel {
+ public:
+  explicit SparseEmbeddingLookupOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, GetCombiner(ctx, &combiner_));
+    OP_REQUIRES_OK(ctx, GetPartitionStrategy(ctx, &partition_strategy_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    SparseEmbeddingLookupInputs<T, Tidx> inputs;
+    OP_REQUIRES_OK(ctx, inputs.Parse(ctx, partition_strategy_));
+
+    TensorShape output_shape = inputs.row_shape;
+    output_shape.InsertDim(0, inputs.num_segments);
+    Tensor* output = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, output_shape, &output));
+    if (output_shape.num_elements() == 0) return;
+
+    const int64 row_size = inputs.row_size;
+    T* output_data = output->flat<T>().data();
+    const Combiner combiner = combiner_;
+    auto work = [&inputs, combiner, row_size, output_data](int64 start, int64 limit) {
+      for (int64 s = start; s < limit; ++s) {
+        Row<T> output_row(output_data + s * row_size, row_size);
+        output_row.setZero();
+        for (int64 i = inputs.segment_starts[s]; i < inputs.segment_starts[s + 1]; ++i)
+          output_row.noalias() += inputs.weight(i) * ConstRow<T>(inputs.row(i), row_size);
+        const T scale = inputs.scale(combiner, s);
+        if (scale != T(1)) output_row *= scale;
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, inputs.num_segments, inputs.segment_cost(), work);
+  }
+
+ private:
+  Combiner combiner_;
+  PartitionStrategy partition_strategy_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(SparseEmbeddingLookupOp);
+};
+
+// Computes the gradient of the sparse embedding lookup op with respect to each one of the parameter partitions, as
+// indexed slices (i.e., one row for each looked up id that falls in that partition, along with its row index within
+// the partition).
+template <typename T, typename Tidx>
+class SparseEmbeddingLookupGradOp : public OpKernel {
+ public:
+  explicit SparseEmbeddingLookupGradOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, GetCombiner(ctx, &combiner_));
+    OP_REQUIRES_OK(ctx, GetPartitionStrategy(ctx, &partition_strategy_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    SparseEmbeddingLookupInputs<T, Tidx> inputs;
+    OP_REQUIRES_OK(ctx, inputs.Parse(ctx, partition_strategy_));
+    const Tensor& grad = ctx->input(0);
+    OP_REQUIRES(ctx, grad.dims() >= 1 && grad.dim_size(0) == inputs.num_segments &&
+                     grad.NumElements() == inputs.num_segments * inputs.row_size,
+                errors::InvalidArgument("'grad' must have shape [", inputs.num_segments, "] + ",
+                                        inputs.row_shape.DebugString(), ", but has shape ",
+                                        grad.shape().DebugString(), "."));
+
+    // Compute the position of each entry within the gradient of its partition.
+    const int num_partitions = inputs.params.size();
+    std::vector<int64> positions(inputs.num_entries);
+    std::vector<int64> counts(num_partitions, 0);
+    for (int64 i = 0; i < inputs.num_entries; ++i) positions[i] = counts[inputs.partitions[i]]++;
+
+    OpOutputList values;
+    OpOutputList indices;
+    OP_REQUIRES_OK(ctx, ctx->output_list("values", &values));
+    OP_REQUIRES_OK(ctx, ctx->output_list("indices", &indices));
+    std::vector<T*> values_data(num_partitions);
+    std::vector<Tidx*> indices_data(num_partitions);
+    for (int p = 0; p < num_partitions; ++p) {
+      TensorShape values_shape = inputs.row_shape;
+      values_shape.InsertDim(0, counts[p]);
+      Tensor* values_p = nullptr;
+      Tensor* indices_p = nullptr;
+      OP_REQUIRES_OK(ctx, values.allocate(p, values_shape, &values_p));
+      OP_REQUIRES_OK(ctx, indices.allocate(p, TensorShape({counts[p]}), &indices_p));
+      values_data[p] = values_p->flat<T>().data();
+      indices_data[p] = indices_p->flat<Tidx>().data();
+    }
+    if (inputs.num_entries == 0) return;
+
+    const int64 row_size = inputs.row_size;
+    const T* grad_data = grad.flat<T>().data();
+    const Combiner combiner = combiner_;
+    auto work = [&](int64 start, int64 limit) {
+      for (int64 s = start; s < limit; ++s) {
+        const T scale = inputs.scale(combiner, s);
+        const ConstRow<T> grad_row(grad_data + s * row_size, row_size);
+        for (int64 i = inputs.segment_starts[s]; i < inputs.segment_starts[s + 1]; ++i) {
+          const int32 p = inputs.partitions[i];
+          indices_data[p][positions[i]] = static_cast<Tidx>(inputs.rows[i]);
+          Row<T>(values_data[p] + positions[i] * row_size, row_size).noalias() = (inputs.weight(i) * scale) * grad_row;
+        }
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, inputs.num_segments, inputs.segment_cost(), work);
+  }
+
+ private:
+  Combiner combiner_;
+  PartitionStrategy partition_strategy_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(SparseEmbeddingLookupGradOp);
+};
+
+// Computes the gradient of the sparse embedding lookup op with respect to its weights.
+template <typename T, typename Tidx>
+class SparseEmbeddingLookupWeightsGradOp : public OpKernel {
+ public:
+  explicit SparseEmbeddingLookupWeightsGradOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, GetCombiner(ctx, &combiner_));
+    OP_REQUIRES_OK(ctx, GetPartitionStrategy(ctx, &partition_strategy_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    SparseEmbeddingLookupInputs<T, Tidx> inputs;
+    OP_REQUIRES_OK(ctx, inputs.Parse(ctx, partition_strategy_));
+    const Tensor& grad = ctx->input(0);
+    const Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->input("output", &output));
+    OP_REQUIRES(ctx, grad.shape() == output->shape() && grad.dims() >= 1 &&
+                     grad.dim_size(0) == inputs.num_segments &&
+                     grad.NumElements() == inputs.num_segments * inputs.row_size,
+                errors::InvalidArgument("'grad' and 'output' must have shape [", inputs.num_segments, "] + ",
+                                        inputs.row_shape.DebugString(), ", but have shapes ",
+                                        grad.shape().DebugString(), " and ", output->shape().DebugString(), "."));
+
+    Tensor* weights_grad = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, inputs.weights->shape(), &weights_grad));
+    if (weights_grad->NumElements() == 0) return;
+
+    // With 'total' denoting the total weight of a segment and 'output' its combined embedding, the gradient with
+    // respect to the weight of each entry with embedding 'row' is:
+    //   - sum:   dot(grad, row)
+    //   - mean:  (dot(grad, row) - dot(grad, output)) / total
+    //   - sqrtn: dot(grad, row) / sqrt(total) - dot(grad, output) * weight / total
+    const int64 row_size = inputs.row_size;
+    const T* grad_data = grad.flat<T>().data();
+    const T* output_data = output->flat<T>().data();
+    auto weights_grad_flat = weights_grad->flat<T>();
+    const Combiner combiner = combiner_;
+    auto work = [&](int64 start, int64 limit) {
+      for (int64 s = start; s < limit; ++s) {
+        const ConstRow<T> grad_row(grad_data + s * row_size, row_size);
+        const T total = combiner == Combiner::kSum ? T(0) : inputs.total_weight(combiner, s);
+        const T grad_output = total == T(0) ? T(0) : grad_row.dot(ConstRow<T>(output_data + s * row_size, row_size));
+        for (int64 i = inputs.segment_starts[s]; i < inputs.segment_starts[s + 1]; ++i) {
+          const T grad_row_dot = grad_row.dot(ConstRow<T>(inputs.row(i), row_size));
+          if (total == T(0))
+            weights_grad_flat(i) = grad_row_dot;
+          else if (combiner == Combiner::kMean)
+            weights_grad_flat(i) = (grad_row_dot - grad_output) / total;
+          else
+            weights_grad_flat(i) = grad_row_dot / std::sqrt(total) - grad_output * inputs.weight(i) / total;
+        }
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, inputs.num_segments, 2 * inputs.segment_cost(), work);
+  }
+
+ private:
+  Combiner combiner_;
+  PartitionStrategy partition_strategy_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(SparseEmbeddingLookupWeightsGradOp);
+};
+
+REGISTER_OP("SparseEmbeddingLookup")
+    .Input("params: N * T")
+    .Input("ids: Tidx")
+    .Input("segment_ids: int32")
+    .Input("weights: T")
+    .Output("output: T")
+    .Attr("N: int >= 1")
+    .Attr("T: {float, double}")
+    .Attr("Tidx: {int32, int64} = DT_INT64")
+    .Attr("combiner: {'sum', 'mean', 'sqrtn'} = 'sqrtn'")
+    .Attr("partition_strategy: {'mod', 'div'} = 'mod'")
+    .SetShapeFn([](InferenceContext* c) {
+      std::vector<ShapeHandle> params;
+      TF_RETURN_IF_ERROR(c->input("params", &params));
+      ShapeHandle row_shape;
+      TF_RETURN_IF_ERROR(c->Subshape(params[0], 1, &row_shape));
+      ShapeHandle output;
+      TF_RETURN_IF_ERROR(c->Concatenate(c->Vector(InferenceContext::kUnknownDim), row_shape, &output));
+      c->set_output(0, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Looks up and combines the embeddings of a batch of sparse ids, in a single op.
+
+Each id in 'ids' is looked up in the embedding map that 'params' is a partitioning of, along its first dimension,
+according to 'partition_strategy'. The looked up embeddings are then multiplied by the corresponding 'weights' and
+combined over each segment (i.e., over all ids with the same segment id), using 'combiner'. Row 's' of 'output' is
+thus equal to the combined embeddings of the ids with segment id 's', or to zeros if there are no such ids.
+
+params: Embedding map partitions, with the same shape except for their first dimension.
+ids: Vector containing the ids to look up.
+segment_ids: Vector containing the segment id of each id, sorted in non-decreasing order.
+weights: Vector containing the weight of each id, or an empty vector, in which case all weights are equal to 1.
+output: Tensor with shape `[max(segment_ids) + 1] + params[0].shape[1:]`.
+combiner: Combination method. 'sum' computes the weighted sum of the embeddings, 'mean' divides the weighted sum by
+  the total weight, and 'sqrtn' divides the weighted sum by the square root of the sum of the squares of the weights.
+  Segments with zero total weight are not divided.
+partition_strategy: Partitioning strategy for the ids. With 'mod', each id is assigned to the partition
+  `id % N`. With 'div', ids are assigned to partitions in a contiguous manner.
+)doc");
+
+REGISTER_OP("SparseEmbeddingLookupGrad")
+    .Input("grad: T")
+    .Input("params: N * T")
+    .Input("ids: Tidx")
+    .Input("segment_ids: int32")
+    .Input("weights: T")
+    .Output("values: N * T")
+    .Output("indices: N * Tidx")
+    .Attr("N: int >= 1")
+    .Attr("T: {float, double}")
+    .Attr("Tidx: {int32, int64} = DT_INT64")
+    .Attr("combiner: {'sum', 'mean', 'sqrtn'} = 'sqrtn'")
+    .Attr("partition_strategy: {'mod', 'div'} = 'mod'")
+    .SetShapeFn([](InferenceContext* c) {
+      std::vector<ShapeHandle> params;
+      TF_RETURN_IF_ERROR(c->input("params", &params));
+      const int num_partitions = params.size();
+      for (int p = 0; p < num_partitions; ++p) {
+        ShapeHandle row_shape;
+        TF_RETURN_IF_ERROR(c->Subshape(params[p], 1, &row_shape));
+        ShapeHandle values;
+        TF_RETURN_IF_ERROR(c->Concatenate(c->Vector(InferenceContext::kUnknownDim), row_shape, &values));
+        c->set_output(p, values);
+        c->set_output(num_partitions + p, c->Vector(InferenceContext::kUnknownDim));
+      }
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Computes the gradient of 'SparseEmbeddingLookup' with respect to each one of the 'params' partitions.
+
+The gradient with respect to partition 'p' is returned as indexed slices, formed by 'values[p]' and 'indices[p]'.
+Indices may be repeated, in which case the corresponding values must be summed.
+
+grad: Gradient with respect to the output of the 'SparseEmbeddingLookup' op.
+values: Gradient values, one row for each id that falls in each partition.
+indices: Row indices within each partition, one for each row of the corresponding 'values'.
+)doc");
+
+REGISTER_OP("SparseEmbeddingLookupWeightsGrad")
+    .Input("grad: T")
+    .Input("params: N * T")
+    .Input("ids: Tidx")
+    .Input("segment_ids: int32")
+    .Input("weights: T")
+    .Input("output: T")
+    .Output("weights_grad: T")
+    .Attr("N: int >= 1")
+    .Attr("T: {float, double}")
+    .Attr("Tidx: {int32, int64} = DT_INT64")
+    .Attr("combiner: {'sum', 'mean', 'sqrtn'} = 'sqrtn'")
+    .Attr("partition_strategy: {'mod', 'div'} = 'mod'")
+    .SetShapeFn([](InferenceContext* c) {
+      std::vector<ShapeHandle> weights;
+      TF_RETURN_IF_ERROR(c->input("weights", &weights));
+      ShapeHandle weights_grad;
+      TF_RETURN_IF_ERROR(c->WithRank(weights[0], 1, &weights_grad));
+      c->set_output(0, weights_grad);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Computes the gradient of 'SparseEmbeddingLookup' with respect to its weights.
+
+grad: Gradient with respect to the output of the 'SparseEmbeddingLookup' op.
+output: Output of the 'SparseEmbeddingLookup' op.
+weights_grad: Gradient with respect to the weights. It is empty if 'weights' is empty.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T, Tidx)                                                                 \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("SparseEmbeddingLookup").Device(DEVICE_CPU).TypeConstraint<T>("T")                        \
+          .TypeConstraint<Tidx>("Tidx"),                                                              \
+      SparseEmbeddingLookupOp<T, Tidx>);                                                              \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("SparseEmbeddingLookupGrad").Device(DEVICE_CPU).TypeConstraint<T>("T")                    \
+          .TypeConstraint<Tidx>("Tidx"),                                                              \
+      SparseEmbeddingLookupGradOp<T, Tidx>);                                                          \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("SparseEmbeddingLookupWeightsGrad").Device(DEVICE_CPU).TypeConstraint<T>("T")             \
+          .TypeConstraint<Tidx>("Tidx"),                                                              \
+      SparseEmbeddingLookupWeightsGradOp<T, Tidx>);
+
+REGISTER_CPU_KERNELS(float, int32);
+REGISTER_CPU_KERNELS(float, int64);
+REGISTER_CPU_KERNELS(double, int32);
+REGISTER_CPU_KERNELS(double, int64);
+#undef REGISTER_CPU_KERNELS
+}  // namespace tensorflow
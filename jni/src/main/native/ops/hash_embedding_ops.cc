@@ -0,0 +1,622 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/resource_mgr.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // SplitMix64 finalizer, used to derive the initial values of the rows from their keys.
+  inline uint64 Mix(uint64 z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
+  // Configuration of a hash embedding table, which is obtained from the attributes of the op that creates it.
+  struct HashEmbeddingConfig {
+    int64 embedding_dim;
+    float initializer_range;
+    int64 seed;
+    int64 min_frequency;
+    int64 ttl_steps;
+    bool adagrad;
+    float learning_rate;
+    float initial_accumulator_value;
+
+    Status Init(OpKernelConstruction* ctx) {
+      string optimizer;
+      TF_RETURN_IF_ERROR(ctx->GetAttr("embedding_dim", &embedding_dim));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("initializer_range", &initializer_range));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("seed", &seed));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("min_frequency", &min_frequency));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("ttl_steps", &ttl_steps));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("optimizer", &optimizer));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("learning_rate", &learning_rate));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("initial_accumulator_value", &initial_accumulator_value));
+      adagrad = optimizer == "adagrad";
+      return Status::OK();
+    }
+
+    bool operator==(const HashEmbeddingConfig& other) const {
+      return embedding_dim == other.embedding_dim && initializer_range == other.initializer_range &&
+             seed == other.seed && min_frequency == other.min_frequency && ttl_steps == other.ttl_steps &&
+             adagrad == other.adagrad && learning_rate == other.learning_rate &&
+             initial_accumulator_value == other.initial_accumulator_value;
+    }
+  };
+}  // namespace
+
+// Growable embedding table keyed by arbitrary 64-bit ids, which creates the row of an id the first time that it is
+// looked up, rather than requiring a fixed vocabulary.
+//
+// The rows are stored contiguously (with evicted rows being reused), and a hash map maps each id to its row. Ids are
+// only admitted into the table once they have been looked up 'min_frequency' times, and until then they are looked up
+// as zero rows and only their lookup counts are tracked. The initial value of each row is a deterministic function of
+// its id and of the table seed, and so it does not depend on the order in which ids are first seen, or on how the ids
+// are partitioned across tables. Each row also tracks the last step in which it was accessed, so that rows that have
+// not been accessed for 'ttl_steps' steps can be evicted.
+//
+// The table is updated by its own sparse SGD or Adagrad update kernel, which only touches the rows of the provided ids.
+class HashEmbeddingTable : public ResourceBase {
+ public:
+  explicit HashEmbeddingTable(const HashEmbeddingConfig& config) : config_(config) {}
+
+  mutex* mu() { return &mu_; }
+  const HashEmbeddingConfig& config() const { return config_; }
+  int64 dim() const { return config_.embedding_dim; }
+  int64 size() const { return static_cast<int64>(rows_.size()); }
+
+  // Returns the row of 'id', or -1 if it is not in the table. If 'create' is true, the lookup is counted and the row
+  // is created once the id has been looked up 'min_frequency' times. Requires 'mu()' to be locked.
+  int64 FindRow(int64 id, int64 step, bool create) {
+    const auto it = rows_.find(id);
+    if (it != rows_.end()) {
+      if (create) last_steps_[it->second] = std::max(last_steps_[it->second], step);
+      return it->second;
+    }
+    if (!create) return -1;
+    if (config_.min_frequency > 1) {
+      std::pair<int64, int64>& candidate = candidates_[id];
+      candidate.second = std::max(candidate.second, step);
+      if (++candidate.first < config_.min_frequency) return -1;
+      candidates_.erase(id);
+    }
+    const int64 row = AllocateRow(id, step);
+    InitializeRow(id, row);
+    return row;
+  }
+
+  float* values(int64 row) { return values_.data() + row * dim(); }
+  float* accumulators(int64 row) { return accumulators_.data() + row * dim(); }
+  int64 last_step(int64 row) const { return last_steps_[row]; }
+
+  // Evicts all rows (and candidate ids) that have not been accessed since 'step - ttl_steps'. Returns the number of
+  // evicted rows. Requires 'mu()' to be locked.
+  int64 Evict(int64 step) {
+    if (config_.ttl_steps <= 0) return 0;
+    const int64 min_step = step - config_.ttl_steps;
+    int64 num_evicted = 0;
+    for (auto it = rows_.begin(); it != rows_.end();) {
+      if (last_steps_[it->second] < min_step) {
+        free_rows_.push_back(it->second);
+        it = rows_.erase(it);
+        ++num_evicted;
+      } else {
+        ++it;
+      }
+    }
+    for (auto it = candidates_.begin(); it != candidates_.end();)
+      it = it->second.second < min_step ? candidates_.erase(it) : std::next(it);
+    return num_evicted;
+  }
+
+  // Returns the ids and rows of all entries of this table. Requires 'mu()' to be locked.
+  std::vector<std::pair<int64, int64>> Entries() const {
+    return std::vector<std::pair<int64, int64>>(rows_.begin(), rows_.end());
+  }
+
+  // Removes all entries from this table. Requires 'mu()' to be locked.
+  void Clear() {
+    rows_.clear();
+    candidates_.clear();
+    free_rows_.clear();
+    values_.clear();
+    accumulators_.clear();
+    last_steps_.clear();
+  }
+
+  // Inserts an entry for 'id' (which must not be in this table) and returns its row, whose values are left
+  // uninitialized. Requires 'mu()' to be locked.
+  int64 AllocateRow(int64 id, int64 step) {
+    int64 row;
+    if (free_rows_.empty()) {
+      row = static_cast<int64>(last_steps_.size());
+      values_.resize((row + 1) * dim());
+      if (config_.adagrad) accumulators_.resize((row + 1) * dim());
+      last_steps_.push_back(step);
+    } else {
+      row = free_rows_.back();
+      free_rows_.pop_back();
+      last_steps_[row] = step;
+    }
+    rows_[id] = row;
+    return row;
+  }
+
+  string DebugString() override { return strings::StrCat("HashEmbeddingTable[", size(), ", ", dim(), "]"); }
+
+ private:
+  // Sets the values of 'row' to uniformly distributed values in '[-initializer_range, initializer_range]', which are
+  // derived from 'id' and the table seed, and resets its accumulators.
+  void InitializeRow(int64 id, int64 row) {
+    float* row_values = values(row);
+    uint64 state = Mix(static_cast<uint64>(id) ^ Mix(static_cast<uint64>(config_.seed)));
+    for (int64 j = 0; j < dim(); ++j) {
+      state += 0x9e3779b97f4a7c15ULL;
+      const float uniform = static_cast<float>(Mix(state) >> 40) * (1.0f / 16777216.0f);
+      row_values[j] = (2.0f * uniform - 1.0f) * config_.initializer_range;
+    }
+    if (config_.adagrad) std::fill_n(accumulators(row), dim(), config_.initial_accumulator_value);
+  }
+
+  mutex mu_;
+  const HashEmbeddingConfig config_;
+  std::unordered_map<int64, int64> rows_;
+  // Lookup counts and last access steps of the ids that have not been admitted into the table yet.
+  std::unordered_map<int64, std::pair<int64, int64>> candidates_;
+  std::vector<int64> free_rows_;
+  std::vector<float> values_;
+  std::vector<float> accumulators_;
+  std::vector<int64> last_steps_;
+
+  ~HashEmbeddingTable() override {}
+  TF_DISALLOW_COPY_AND_ASSIGN(HashEmbeddingTable);
+};
+
+namespace {
+  Status GetScalarStep(OpKernelContext* ctx, int64* step) {
+    const Tensor* tensor;
+    TF_RETURN_IF_ERROR(ctx->input("step", &tensor));
+    if (!TensorShapeUtils::IsScalar(tensor->shape()))
+      return errors::InvalidArgument("'step' must be a scalar, but has shape ", tensor->shape().DebugString(), ".");
+    *step = tensor->scalar<int64>()();
+    return Status::OK();
+  }
+
+  // Checks that 'values' has shape 'ids.shape + [dim]'.
+  Status CheckValuesShape(const Tensor& ids, const Tensor& values, int64 dim, const string& name) {
+    TensorShape expected_shape = ids.shape();
+    expected_shape.AddDim(dim);
+    if (values.shape() != expected_shape)
+      return errors::InvalidArgument("'", name, "' must have shape ", expected_shape.DebugString(), ", but has shape ",
+                                     values.shape().DebugString(), ".");
+    return Status::OK();
+  }
+}  // namespace
+
+// Kernel that creates a hash embedding table resource and outputs a handle to it.
+class HashEmbeddingTableOp : public OpKernel {
+ public:
+  explicit HashEmbeddingTableOp(OpKernelConstruction* ctx) : OpKernel(ctx), table_handle_set_(false) {
+    OP_REQUIRES_OK(ctx, config_.Init(ctx));
+  }
+
+  ~HashEmbeddingTableOp() override {
+    // If the table object was not shared, delete it.
+    if (table_handle_set_ && cinfo_.resource_is_private_to_kernel()) {
+      TF_CHECK_OK(cinfo_.resource_manager()->template Delete<HashEmbeddingTable>(cinfo_.container(), cinfo_.name()));
+    }
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    mutex_lock l(mu_);
+    if (!table_handle_set_) {
+      OP_REQUIRES_OK(ctx, cinfo_.Init(ctx->resource_manager(), def()));
+      HashEmbeddingTable* table;
+      const HashEmbeddingConfig config = config_;
+      OP_REQUIRES_OK(ctx, cinfo_.resource_manager()->template LookupOrCreate<HashEmbeddingTable>(
+          cinfo_.container(), cinfo_.name(), &table, [config](HashEmbeddingTable** ret) {
+            *ret = new HashEmbeddingTable(config);
+            return Status::OK();
+          }));
+      core::ScopedUnref unref(table);
+      OP_REQUIRES(ctx, table->config() == config_,
+                  errors::InvalidArgument("Shared hash embedding table '", cinfo_.name(),
+                                          "' was created with a different configuration."));
+      table_handle_set_ = true;
+    }
+    Tensor* handle;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &handle));
+    handle->scalar<ResourceHandle>()() = MakeResourceHandle<HashEmbeddingTable>(
+        ctx, cinfo_.container(), cinfo_.name());
+  }
+
+ private:
+  mutex mu_;
+  HashEmbeddingConfig config_;
+  ContainerInfo cinfo_ GUARDED_BY(mu_);
+  bool table_handle_set_ GUARDED_BY(mu_);
+
+  TF_DISALLOW_COPY_AND_ASSIGN(HashEmbeddingTableOp);
+};
+
+// Kernel that looks up the rows of a batch of ids, creating the rows of the admitted ids that are not in the table.
+class HashEmbeddingLookupOp : public OpKernel {
+ public:
+  explicit HashEmbeddingLookupOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("create_missing", &create_missing_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    HashEmbeddingTable* table;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &table));
+    core::ScopedUnref unref(table);
+    const Tensor& ids = ctx->input(1);
+    int64 step;
+    OP_REQUIRES_OK(ctx, GetScalarStep(ctx, &step));
+    const int64 dim = table->dim();
+    TensorShape output_shape = ids.shape();
+    output_shape.AddDim(dim);
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, output_shape, &output));
+    const auto ids_flat = ids.flat<int64>();
+    float* output_data = output->flat<float>().data();
+    mutex_lock l(*table->mu());
+    for (int64 i = 0; i < ids_flat.size(); ++i) {
+      const int64 row = table->FindRow(ids_flat(i), step, create_missing_);
+      if (row < 0)
+        std::fill_n(output_data + i * dim, dim, 0.0f);
+      else
+        std::memcpy(output_data + i * dim, table->values(row), dim * sizeof(float));
+    }
+  }
+
+ private:
+  bool create_missing_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(HashEmbeddingLookupOp);
+};
+
+// Kernel that applies a sparse SGD or Adagrad update to the rows of a batch of ids. Ids that are not in the table
+// (e.g., because they have not been admitted yet) are skipped, and duplicate ids are updated once per occurrence.
+class HashEmbeddingApplyGradientOp : public OpKernel {
+ public:
+  explicit HashEmbeddingApplyGradientOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    HashEmbeddingTable* table;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &table));
+    core::ScopedUnref unref(table);
+    const Tensor& ids = ctx->input(1);
+    const Tensor& gradients = ctx->input(2);
+    const int64 dim = table->dim();
+    OP_REQUIRES_OK(ctx, CheckValuesShape(ids, gradients, dim, "gradients"));
+    const HashEmbeddingConfig& config = table->config();
+    const auto ids_flat = ids.flat<int64>();
+    const float* gradients_data = gradients.flat<float>().data();
+    mutex_lock l(*table->mu());
+    for (int64 i = 0; i < ids_flat.size(); ++i) {
+      const int64 row = table->FindRow(ids_flat(i), 0, false);
+      if (row < 0) continue;
+      float* values = table->values(row);
+      const float* gradient = gradients_data + i * dim;
+      if (config.adagrad) {
+        float* accumulators = table->accumulators(row);
+        for (int64 j = 0; j < dim; ++j) {
+          accumulators[j] += gradient[j] * gradient[j];
+          values[j] -= config.learning_rate * gradient[j] / std::sqrt(accumulators[j]);
+        }
+      } else {
+        for (int64 j = 0; j < dim; ++j) values[j] -= config.learning_rate * gradient[j];
+      }
+    }
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(HashEmbeddingApplyGradientOp);
+};
+
+// Kernel that evicts the rows of a hash embedding table that have expired.
+class HashEmbeddingEvictOp : public OpKernel {
+ public:
+  explicit HashEmbeddingEvictOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    HashEmbeddingTable* table;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &table));
+    core::ScopedUnref unref(table);
+    int64 step;
+    OP_REQUIRES_OK(ctx, GetScalarStep(ctx, &step));
+    Tensor* num_evicted;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &num_evicted));
+    mutex_lock l(*table->mu());
+    num_evicted->scalar<int64>()() = table->Evict(step);
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(HashEmbeddingEvictOp);
+};
+
+// Kernel that outputs the number of rows of a hash embedding table.
+class HashEmbeddingSizeOp : public OpKernel {
+ public:
+  explicit HashEmbeddingSizeOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    HashEmbeddingTable* table;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &table));
+    core::ScopedUnref unref(table);
+    Tensor* size;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &size));
+    mutex_lock l(*table->mu());
+    size->scalar<int64>()() = table->size();
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(HashEmbeddingSizeOp);
+};
+
+// Kernel that exports all rows of a hash embedding table, which is used to save it in checkpoints.
+class HashEmbeddingExportOp : public OpKernel {
+ public:
+  explicit HashEmbeddingExportOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    HashEmbeddingTable* table;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &table));
+    core::ScopedUnref unref(table);
+    mutex_lock l(*table->mu());
+    const std::vector<std::pair<int64, int64>> entries = table->Entries();
+    const int64 size = static_cast<int64>(entries.size());
+    const int64 dim = table->dim();
+    const int64 accumulators_dim = table->config().adagrad ? dim : 0;
+    Tensor* ids;
+    Tensor* values;
+    Tensor* accumulators;
+    Tensor* last_steps;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({size}), &ids));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, TensorShape({size, dim}), &values));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(2, TensorShape({size, accumulators_dim}), &accumulators));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(3, TensorShape({size}), &last_steps));
+    auto ids_flat = ids->flat<int64>();
+    auto last_steps_flat = last_steps->flat<int64>();
+    float* values_data = values->flat<float>().data();
+    float* accumulators_data = accumulators->flat<float>().data();
+    for (int64 i = 0; i < size; ++i) {
+      const int64 row = entries[i].second;
+      ids_flat(i) = entries[i].first;
+      last_steps_flat(i) = table->last_step(row);
+      std::memcpy(values_data + i * dim, table->values(row), dim * sizeof(float));
+      if (accumulators_dim > 0)
+        std::memcpy(accumulators_data + i * dim, table->accumulators(row), dim * sizeof(float));
+    }
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(HashEmbeddingExportOp);
+};
+
+// Kernel that replaces all rows of a hash embedding table, which is used to restore it from checkpoints.
+class HashEmbeddingImportOp : public OpKernel {
+ public:
+  explicit HashEmbeddingImportOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    HashEmbeddingTable* table;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &table));
+    core::ScopedUnref unref(table);
+    const Tensor& ids = ctx->input(1);
+    const Tensor& values = ctx->input(2);
+    const Tensor& accumulators = ctx->input(3);
+    const Tensor& last_steps = ctx->input(4);
+    const int64 dim = table->dim();
+    const bool adagrad = table->config().adagrad;
+    OP_REQUIRES(ctx, TensorShapeUtils::IsVector(ids.shape()),
+                errors::InvalidArgument("'ids' must be a vector, but has shape ", ids.shape().DebugString(), "."));
+    OP_REQUIRES_OK(ctx, CheckValuesShape(ids, values, dim, "values"));
+    OP_REQUIRES_OK(ctx, CheckValuesShape(ids, accumulators, adagrad ? dim : 0, "accumulators"));
+    OP_REQUIRES(ctx, last_steps.shape() == ids.shape(),
+                errors::InvalidArgument("'last_steps' must have shape ", ids.shape().DebugString(),
+                                        ", but has shape ", last_steps.shape().DebugString(), "."));
+    const auto ids_flat = ids.flat<int64>();
+    const auto last_steps_flat = last_steps.flat<int64>();
+    const float* values_data = values.flat<float>().data();
+    const float* accumulators_data = accumulators.flat<float>().data();
+    mutex_lock l(*table->mu());
+    table->Clear();
+    for (int64 i = 0; i < ids_flat.size(); ++i) {
+      int64 row = table->FindRow(ids_flat(i), 0, false);
+      if (row < 0) row = table->AllocateRow(ids_flat(i), last_steps_flat(i));
+      std::memcpy(table->values(row), values_data + i * dim, dim * sizeof(float));
+      if (adagrad) std::memcpy(table->accumulators(row), accumulators_data + i * dim, dim * sizeof(float));
+    }
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(HashEmbeddingImportOp);
+};
+
+REGISTER_OP("HashEmbeddingTable")
+    .Output("table_handle: resource")
+    .Attr("container: string = ''")
+    .Attr("shared_name: string = ''")
+    .Attr("embedding_dim: int >= 1")
+    .Attr("initializer_range: float = 0.05")
+    .Attr("seed: int = 0")
+    .Attr("min_frequency: int >= 1 = 1")
+    .Attr("ttl_steps: int >= 0 = 0")
+    .Attr("optimizer: {'sgd', 'adagrad'} = 'sgd'")
+    .Attr("learning_rate: float = 0.01")
+    .Attr("initial_accumulator_value: float = 0.1")
+    .SetIsStateful()
+    .SetShapeFn(shape_inference::ScalarShape)
+    .Doc(R"doc(
+Creates a growable embedding table, keyed by arbitrary 64-bit ids, whose rows are created on first lookup.
+
+Each id is admitted into the table once it has been looked up `min_frequency` times, and its row is then initialized
+with uniformly distributed values in `[-initializer_range, initializer_range]`, which are a deterministic function of
+the id and of `seed`. If `ttl_steps` is positive, rows that have not been accessed for `ttl_steps` steps are removed by
+the 'HashEmbeddingEvict' op. The rows are updated by the 'HashEmbeddingApplyGradient' op, using either SGD or Adagrad.
+
+table_handle: Handle to a hash embedding table.
+container: If non-empty, this table is placed in the given container. Otherwise, a default container is used.
+shared_name: If non-empty, this table is shared under the given name across multiple sessions.
+embedding_dim: Size of each embedding.
+initializer_range: Range of the uniformly distributed initial values of the rows.
+seed: Seed used to derive the initial values of the rows from their ids.
+min_frequency: Number of lookups after which an id is admitted into the table.
+ttl_steps: Number of steps after which rows that have not been accessed are evicted. If zero, rows are never evicted.
+optimizer: Update rule used by 'HashEmbeddingApplyGradient'.
+learning_rate: Learning rate used by 'HashEmbeddingApplyGradient'.
+initial_accumulator_value: Initial value of the Adagrad accumulators.
+)doc");
+
+REGISTER_OP("HashEmbeddingLookup")
+    .Input("table_handle: resource")
+    .Input("ids: int64")
+    .Input("step: int64")
+    .Input("sinks: num_sinks * float")
+    .Output("embeddings: float")
+    .Attr("num_sinks: int >= 0 = 0")
+    .Attr("create_missing: bool = true")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 0, &unused));
+      ShapeHandle output;
+      TF_RETURN_IF_ERROR(c->Concatenate(c->input(1), c->Vector(InferenceContext::kUnknownDim), &output));
+      c->set_output(0, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Looks up the rows of `ids` in a hash embedding table.
+
+If `create_missing` is true, the lookups are counted towards the admission of the ids, the rows of the admitted ids
+that are not in the table are created, and `step` is recorded as the last access step of the rows. Ids that are not in
+the table are looked up as zero rows.
+
+table_handle: Handle to a hash embedding table.
+ids: Ids to look up.
+step: Scalar containing the current step.
+sinks: Scalars that are ignored by the lookup. Their gradients depend on the table update, which allows optimizers that
+  only update variables to also update the table.
+embeddings: Embeddings with shape `ids.shape + [embedding_dim]`.
+create_missing: Whether to count the lookups and to create missing rows (e.g., set to false for inference).
+)doc");
+
+REGISTER_OP("HashEmbeddingApplyGradient")
+    .Input("table_handle: resource")
+    .Input("ids: int64")
+    .Input("gradients: float")
+    .Doc(R"doc(
+Applies a sparse update to the rows of `ids` in a hash embedding table, using the optimizer of the table.
+
+Ids that are not in the table are skipped, and duplicate ids are updated once for each occurrence.
+
+table_handle: Handle to a hash embedding table.
+ids: Ids whose rows to update.
+gradients: Gradients with shape `ids.shape + [embedding_dim]`.
+)doc");
+
+REGISTER_OP("HashEmbeddingEvict")
+    .Input("table_handle: resource")
+    .Input("step: int64")
+    .Output("num_evicted: int64")
+    .SetShapeFn(shape_inference::ScalarShape)
+    .Doc(R"doc(
+Evicts the rows of a hash embedding table that have not been accessed since `step - ttl_steps`.
+
+table_handle: Handle to a hash embedding table.
+step: Scalar containing the current step.
+num_evicted: Number of evicted rows.
+)doc");
+
+REGISTER_OP("HashEmbeddingSize")
+    .Input("table_handle: resource")
+    .Output("size: int64")
+    .SetShapeFn(shape_inference::ScalarShape)
+    .Doc(R"doc(
+Computes the number of rows of a hash embedding table.
+
+table_handle: Handle to a hash embedding table.
+size: Number of rows.
+)doc");
+
+REGISTER_OP("HashEmbeddingExport")
+    .Input("table_handle: resource")
+    .Output("ids: int64")
+    .Output("values: float")
+    .Output("accumulators: float")
+    .Output("last_steps: int64")
+    .SetShapeFn([](InferenceContext* c) {
+      c->set_output(0, c->Vector(InferenceContext::kUnknownDim));
+      c->set_output(1, c->Matrix(InferenceContext::kUnknownDim, InferenceContext::kUnknownDim));
+      c->set_output(2, c->Matrix(InferenceContext::kUnknownDim, InferenceContext::kUnknownDim));
+      c->set_output(3, c->Vector(InferenceContext::kUnknownDim));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Exports all rows of a hash embedding table.
+
+table_handle: Handle to a hash embedding table.
+ids: Ids of the rows.
+values: Values of the rows, with shape `[size, embedding_dim]`.
+accumulators: Adagrad accumulators of the rows, with shape `[size, embedding_dim]`, or `[size, 0]` for SGD tables.
+last_steps: Last access steps of the rows.
+)doc");
+
+REGISTER_OP("HashEmbeddingImport")
+    .Input("table_handle: resource")
+    .Input("ids: int64")
+    .Input("values: float")
+    .Input("accumulators: float")
+    .Input("last_steps: int64")
+    .Doc(R"doc(
+Replaces all rows of a hash embedding table with the provided rows (e.g., exported using 'HashEmbeddingExport').
+
+table_handle: Handle to a hash embedding table.
+ids: Ids of the rows.
+values: Values of the rows, with shape `[size, embedding_dim]`.
+accumulators: Adagrad accumulators of the rows, with shape `[size, embedding_dim]`, or `[size, 0]` for SGD tables.
+last_steps: Last access steps of the rows.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("HashEmbeddingTable").Device(DEVICE_CPU), HashEmbeddingTableOp);
+REGISTER_KERNEL_BUILDER(Name("HashEmbeddingLookup").Device(DEVICE_CPU), HashEmbeddingLookupOp);
+REGISTER_KERNEL_BUILDER(Name("HashEmbeddingApplyGradient").Device(DEVICE_CPU), HashEmbeddingApplyGradientOp);
+REGISTER_KERNEL_BUILDER(Name("HashEmbeddingEvict").Device(DEVICE_CPU), HashEmbeddingEvictOp);
+REGISTER_KERNEL_BUILDER(Name("HashEmbeddingSize").Device(DEVICE_CPU), HashEmbeddingSizeOp);
+REGISTER_KERNEL_BUILDER(Name("HashEmbeddingExport").Device(DEVICE_CPU), HashEmbeddingExportOp);
+REGISTER_KERNEL_BUILDER(Name("HashEmbeddingImport").Device(DEVICE_CPU), HashEmbeddingImportOp);
+}  // namespace tensorflow
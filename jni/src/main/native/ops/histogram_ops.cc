@@ -0,0 +1,268 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#if GOOGLE_CUDA
+#define EIGEN_USE_GPU
+#endif  // GOOGLE_CUDA
+
+#include "histogram_ops.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/common_shape_fns.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/register_types.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/summary.pb.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+typedef Eigen::GpuDevice GPUDevice;
+
+namespace functor {
+const std::vector<double>& DefaultHistogramBucketLimits() {
+  static const std::vector<double>* limits = []() {
+    std::vector<double> positive;
+    double v = 1.0e-12;
+    while (v < 1.0e20) {
+      positive.push_back(v);
+      v *= 1.1;
+    }
+    positive.push_back(DBL_MAX);
+    std::vector<double>* result = new std::vector<double>();
+    for (auto it = positive.rbegin(); it != positive.rend(); ++it) result->push_back(-*it);
+    result->push_back(0.0);
+    result->insert(result->end(), positive.begin(), positive.end());
+    return result;
+  }();
+  return *limits;
+}
+
+namespace {
+  // Chunks of values are accumulated into separate histograms, which are merged at the end, and so each chunk should
+  // be large compared to the number of buckets.
+  const int64 kMinChunkSize = 1 << 16;
+
+  // Per-value cost estimate, in cycles, which is dominated by the binary search over the bucket limits.
+  const int64 kValueCost = 40;
+}  // namespace
+
+template <typename T>
+struct HistogramBuckets<CPUDevice, T> {
+  void operator()(OpKernelContext* ctx, const CPUDevice& d, typename TTypes<T>::ConstFlat values,
+                  const std::vector<double>& limits, typename TTypes<double>::Vec output) {
+    const int64 size = values.size();
+    const size_t histogram_size = kNumHistogramStatistics + limits.size();
+    const DeviceBase::CpuWorkerThreads* worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+    const int64 num_chunks =
+        std::max<int64>(1, std::min<int64>(worker_threads->num_threads, size / kMinChunkSize));
+    std::vector<std::vector<double>> partial(num_chunks, std::vector<double>(histogram_size, 0.0));
+    for (std::vector<double>& histogram : partial) {
+      histogram[kHistogramMin] = DBL_MAX;
+      histogram[kHistogramMax] = -DBL_MAX;
+    }
+    const T* data = values.data();
+    auto work = [data, size, num_chunks, &limits, &partial](int64 start, int64 limit) {
+      for (int64 chunk = start; chunk < limit; ++chunk) {
+        double* histogram = partial[chunk].data();
+        double* counts = histogram + kNumHistogramStatistics;
+        for (int64 i = chunk * size / num_chunks; i < (chunk + 1) * size / num_chunks; ++i) {
+          const double value = static_cast<double>(data[i]);
+          if (!std::isfinite(value)) {
+            histogram[kHistogramNumNonFinite] += 1.0;
+            continue;
+          }
+          // The last limit is `DBL_MAX`, and so only `DBL_MAX` itself can be past the last bucket.
+          const size_t bucket = std::upper_bound(limits.begin(), limits.end(), value) - limits.begin();
+          counts[std::min(bucket, limits.size() - 1)] += 1.0;
+          histogram[kHistogramMin] = std::min(histogram[kHistogramMin], value);
+          histogram[kHistogramMax] = std::max(histogram[kHistogramMax], value);
+          histogram[kHistogramNum] += 1.0;
+          histogram[kHistogramSum] += value;
+          histogram[kHistogramSumSquares] += value * value;
+        }
+      }
+    };
+    Shard(worker_threads->num_threads, worker_threads->workers, num_chunks, (size / num_chunks + 1) * kValueCost,
+          work);
+
+    std::vector<double>& result = partial[0];
+    for (int64 chunk = 1; chunk < num_chunks; ++chunk) {
+      const std::vector<double>& histogram = partial[chunk];
+      result[kHistogramMin] = std::min(result[kHistogramMin], histogram[kHistogramMin]);
+      result[kHistogramMax] = std::max(result[kHistogramMax], histogram[kHistogramMax]);
+      for (size_t i = kHistogramNum; i < histogram_size; ++i) result[i] += histogram[i];
+    }
+    std::copy(result.begin(), result.end(), output.data());
+  }
+};
+}  // namespace functor
+
+// Kernel that computes a compact histogram of a tensor, with the bucket limits of the default TensorFlow histograms,
+// on the device of the tensor. Its output is a few kilobytes, regardless of the size of the tensor, and so, together
+// with "HistogramSummaryFromBuckets", it avoids copying large tensors (e.g., weights on GPUs) to the host for
+// "HistogramSummary".
+template <typename Device, typename T>
+class HistogramBucketsOp : public OpKernel {
+ public:
+  explicit HistogramBucketsOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& values = ctx->input(0);
+    const std::vector<double>& limits = functor::DefaultHistogramBucketLimits();
+    Tensor* output = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(
+        0, TensorShape({static_cast<int64>(functor::kNumHistogramStatistics + limits.size())}), &output));
+    functor::HistogramBuckets<Device, T>()(
+        ctx, ctx->eigen_device<Device>(), values.flat<T>(), limits, output->vec<double>());
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(HistogramBucketsOp);
+};
+
+// Kernel that encodes a compact histogram computed by "HistogramBuckets" as a "Summary" protocol buffer, in the same
+// way as "HistogramSummary" does (i.e., merging runs of empty buckets).
+class HistogramSummaryFromBucketsOp : public OpKernel {
+ public:
+  explicit HistogramSummaryFromBucketsOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& tag = ctx->input(0);
+    const Tensor& histogram = ctx->input(1);
+    OP_REQUIRES(ctx, TensorShapeUtils::IsScalar(tag.shape()),
+                errors::InvalidArgument("'tag' must be a scalar, but has shape ", tag.shape().DebugString(), "."));
+    const std::vector<double>& limits = functor::DefaultHistogramBucketLimits();
+    const int64 histogram_size = static_cast<int64>(functor::kNumHistogramStatistics + limits.size());
+    OP_REQUIRES(ctx, TensorShapeUtils::IsVector(histogram.shape()) && histogram.NumElements() == histogram_size,
+                errors::InvalidArgument("'histogram' must be a vector with ", histogram_size,
+                                        " elements, but has shape ", histogram.shape().DebugString(), "."));
+    const double* values = histogram.vec<double>().data();
+    const string& tag_value = tag.scalar<string>()();
+    OP_REQUIRES(ctx, values[functor::kHistogramNumNonFinite] == 0.0,
+                errors::InvalidArgument("Non-finite values in summary histogram for: ", tag_value));
+
+    Summary summary;
+    Summary::Value* summary_value = summary.add_value();
+    summary_value->set_tag(tag_value);
+    HistogramProto* proto = summary_value->mutable_histo();
+    const bool empty = values[functor::kHistogramNum] == 0.0;
+    proto->set_min(empty ? DBL_MAX : values[functor::kHistogramMin]);
+    proto->set_max(empty ? -DBL_MAX : values[functor::kHistogramMax]);
+    proto->set_num(values[functor::kHistogramNum]);
+    proto->set_sum(values[functor::kHistogramSum]);
+    proto->set_sum_squares(values[functor::kHistogramSumSquares]);
+    const double* counts = values + functor::kNumHistogramStatistics;
+    for (size_t i = 0; i < limits.size();) {
+      double end = limits[i];
+      double count = counts[i];
+      ++i;
+      if (count <= 0.0) {
+        while (i < limits.size() && counts[i] <= 0.0) {
+          end = limits[i];
+          count = counts[i];
+          ++i;
+        }
+      }
+      proto->add_bucket_limit(end);
+      proto->add_bucket(count);
+    }
+
+    Tensor* output = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &output));
+    OP_REQUIRES(ctx, summary.SerializeToString(&output->scalar<string>()()),
+                errors::Internal("Unable to serialize the histogram summary."));
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(HistogramSummaryFromBucketsOp);
+};
+
+REGISTER_OP("HistogramBuckets")
+    .Input("values: T")
+    .Output("histogram: double")
+    .Attr("T: realnumbertypes = DT_FLOAT")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      c->set_output(0, c->Vector(static_cast<int64>(
+          functor::kNumHistogramStatistics + functor::DefaultHistogramBucketLimits().size())));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Computes a compact histogram of 'values', with the bucket limits of the default TensorFlow histograms.
+
+The histogram is computed in a single pass over 'values', on their device, and its size does not depend on the size of
+'values'. It can be converted to a summary using 'HistogramSummaryFromBuckets'.
+
+values: Values to use to build the histogram.
+histogram: Minimum, maximum, number, sum, sum of squares, and number of non-finite values (which are not included in the
+  other statistics), followed by the count of each bucket.
+)doc");
+
+REGISTER_OP("HistogramSummaryFromBuckets")
+    .Input("tag: string")
+    .Input("histogram: double")
+    .Output("summary: string")
+    .SetShapeFn(shape_inference::ScalarShape)
+    .Doc(R"doc(
+Outputs a 'Summary' protocol buffer with a histogram, given a compact histogram computed by 'HistogramBuckets'.
+
+The output is the same as that of 'HistogramSummary' for the values of the compact histogram. This op reports an
+'InvalidArgument' error if any of these values are not finite.
+
+tag: Scalar. Tag to use for the 'Summary.Value'.
+histogram: Compact histogram computed by 'HistogramBuckets'.
+summary: Scalar. Serialized 'Summary' protocol buffer.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T)                                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("HistogramBuckets").Device(DEVICE_CPU).TypeConstraint<T>("T"),                               \
+      HistogramBucketsOp<CPUDevice, T>);
+
+TF_CALL_REAL_NUMBER_TYPES(REGISTER_CPU_KERNELS);
+#undef REGISTER_CPU_KERNELS
+
+REGISTER_KERNEL_BUILDER(Name("HistogramSummaryFromBuckets").Device(DEVICE_CPU), HistogramSummaryFromBucketsOp);
+
+#if GOOGLE_CUDA
+// The GPU functors are instantiated in `histogram_ops_gpu.cu.cc`, which is compiled by NVCC.
+namespace functor {
+extern template struct HistogramBuckets<GPUDevice, float>;
+extern template struct HistogramBuckets<GPUDevice, double>;
+}  // namespace functor
+
+#define REGISTER_GPU_KERNELS(T)                                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("HistogramBuckets").Device(DEVICE_GPU).TypeConstraint<T>("T"),                               \
+      HistogramBucketsOp<GPUDevice, T>);
+
+REGISTER_GPU_KERNELS(float);
+REGISTER_GPU_KERNELS(double);
+#undef REGISTER_GPU_KERNELS
+#endif  // GOOGLE_CUDA
+}  // namespace tensorflow
@@ -0,0 +1,59 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_HISTOGRAM_OPS_H_
+#define TENSORFLOW_HISTOGRAM_OPS_H_
+
+#include <vector>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+namespace functor {
+
+// Layout of the compact histograms computed by `HistogramBuckets`: the statistics below, followed by the count of each
+// bucket, as doubles.
+enum HistogramStatistic {
+  kHistogramMin = 0,
+  kHistogramMax = 1,
+  kHistogramNum = 2,
+  kHistogramSum = 3,
+  kHistogramSumSquares = 4,
+  // Number of non-finite values, which are not added to the histogram.
+  kHistogramNumNonFinite = 5,
+  kNumHistogramStatistics = 6,
+};
+
+// Returns the bucket limits of the default TensorFlow histograms (i.e., those of "tensorflow::histogram::Histogram"),
+// which grow exponentially by 10% from 1e-12 to 1e20, on both sides of zero.
+const std::vector<double>& DefaultHistogramBucketLimits();
+
+// Computes the compact histogram of `values` in a single pass over them, with one bucket per limit in `limits` (which
+// are on the host), and writes it to `output`. Value `v` is counted in the first bucket whose limit is greater than
+// `v`, which is the same as for "tensorflow::histogram::Histogram". It is specialized for CPUs (in
+// `histogram_ops.cc`) and for GPUs (in `histogram_ops_gpu.cu.cc`).
+template <typename Device, typename T>
+struct HistogramBuckets {
+  void operator()(OpKernelContext* ctx, const Device& d, typename TTypes<T>::ConstFlat values,
+                  const std::vector<double>& limits, typename TTypes<double>::Vec output);
+};
+
+}  // namespace functor
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_HISTOGRAM_OPS_H_
@@ -0,0 +1,154 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#if GOOGLE_CUDA
+
+#define EIGEN_USE_GPU
+
+#include "histogram_ops.h"
+
+#include <algorithm>
+#include <cfloat>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/util/cuda_kernel_helper.h"
+
+namespace tensorflow {
+namespace functor {
+
+typedef Eigen::GpuDevice GPUDevice;
+
+namespace {
+  __device__ __forceinline__ void HistogramAtomicMin(double* address, double value) {
+    unsigned long long int* address_as_ull = reinterpret_cast<unsigned long long int*>(address);
+    unsigned long long int old = *address_as_ull, assumed;
+    while (value < __longlong_as_double(old)) {
+      assumed = old;
+      old = atomicCAS(address_as_ull, assumed, __double_as_longlong(value));
+      if (assumed == old) break;
+    }
+  }
+
+  __device__ __forceinline__ void HistogramAtomicMax(double* address, double value) {
+    unsigned long long int* address_as_ull = reinterpret_cast<unsigned long long int*>(address);
+    unsigned long long int old = *address_as_ull, assumed;
+    while (value > __longlong_as_double(old)) {
+      assumed = old;
+      old = atomicCAS(address_as_ull, assumed, __double_as_longlong(value));
+      if (assumed == old) break;
+    }
+  }
+
+  __global__ void HistogramInitKernel(int size, double* output) {
+    CUDA_1D_KERNEL_LOOP(i, size) {
+      output[i] = i == kHistogramMin ? DBL_MAX : (i == kHistogramMax ? -DBL_MAX : 0.0);
+    }
+  }
+
+  // Each block keeps its own bucket counts and the bucket limits in shared memory, and so the values are read once and
+  // the global histogram is only updated once per non-empty bucket and block.
+  template <typename T>
+  __global__ void HistogramBucketsKernel(
+      const T* values, int64 size, const double* limits, int num_limits, double* output) {
+    extern __shared__ double shared_limits[];
+    unsigned int* shared_counts = reinterpret_cast<unsigned int*>(shared_limits + num_limits);
+    __shared__ double block_statistics[kNumHistogramStatistics];
+    for (int i = threadIdx.x; i < num_limits; i += blockDim.x) {
+      shared_limits[i] = limits[i];
+      shared_counts[i] = 0;
+    }
+    if (threadIdx.x == 0) {
+      for (int i = 0; i < kNumHistogramStatistics; ++i) block_statistics[i] = 0.0;
+      block_statistics[kHistogramMin] = DBL_MAX;
+      block_statistics[kHistogramMax] = -DBL_MAX;
+    }
+    __syncthreads();
+
+    double min = DBL_MAX, max = -DBL_MAX, num = 0.0, sum = 0.0, sum_squares = 0.0, num_non_finite = 0.0;
+    const int64 stride = static_cast<int64>(blockDim.x) * gridDim.x;
+    for (int64 i = static_cast<int64>(blockIdx.x) * blockDim.x + threadIdx.x; i < size; i += stride) {
+      const double value = static_cast<double>(ldg(values + i));
+      if (!isfinite(value)) {
+        num_non_finite += 1.0;
+        continue;
+      }
+      int low = 0, high = num_limits - 1;
+      while (low < high) {
+        const int middle = (low + high) / 2;
+        if (shared_limits[middle] <= value) low = middle + 1; else high = middle;
+      }
+      atomicAdd(shared_counts + low, 1u);
+      min = fmin(min, value);
+      max = fmax(max, value);
+      num += 1.0;
+      sum += value;
+      sum_squares += value * value;
+    }
+    HistogramAtomicMin(block_statistics + kHistogramMin, min);
+    HistogramAtomicMax(block_statistics + kHistogramMax, max);
+    CudaAtomicAdd(block_statistics + kHistogramNum, num);
+    CudaAtomicAdd(block_statistics + kHistogramSum, sum);
+    CudaAtomicAdd(block_statistics + kHistogramSumSquares, sum_squares);
+    CudaAtomicAdd(block_statistics + kHistogramNumNonFinite, num_non_finite);
+    __syncthreads();
+
+    double* counts = output + kNumHistogramStatistics;
+    for (int i = threadIdx.x; i < num_limits; i += blockDim.x)
+      if (shared_counts[i] > 0)
+        CudaAtomicAdd(counts + i, static_cast<double>(shared_counts[i]));
+    if (threadIdx.x == 0) {
+      HistogramAtomicMin(output + kHistogramMin, block_statistics[kHistogramMin]);
+      HistogramAtomicMax(output + kHistogramMax, block_statistics[kHistogramMax]);
+      for (int i = kHistogramNum; i < kNumHistogramStatistics; ++i)
+        CudaAtomicAdd(output + i, block_statistics[i]);
+    }
+  }
+}  // namespace
+
+template <typename T>
+struct HistogramBuckets<GPUDevice, T> {
+  void operator()(OpKernelContext* ctx, const GPUDevice& d, typename TTypes<T>::ConstFlat values,
+                  const std::vector<double>& limits, typename TTypes<double>::Vec output) {
+    const int num_limits = static_cast<int>(limits.size());
+    Tensor device_limits;
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(DT_DOUBLE, TensorShape({num_limits}), &device_limits));
+    d.memcpyHostToDevice(device_limits.flat<double>().data(), limits.data(), num_limits * sizeof(double));
+
+    CudaLaunchConfig init_config = GetCudaLaunchConfig(static_cast<int>(output.size()), d);
+    HistogramInitKernel<<<init_config.block_count, init_config.thread_per_block, 0, d.stream()>>>(
+        static_cast<int>(output.size()), output.data());
+    if (values.size() == 0) return;
+
+    // The number of blocks is bounded by the number of multiprocessors, because every block merges its whole bucket
+    // counts into the output.
+    const int threads_per_block = 256;
+    const int64 max_blocks = (values.size() + threads_per_block - 1) / threads_per_block;
+    const int num_blocks = static_cast<int>(std::min<int64>(max_blocks, 2 * d.getNumCudaMultiProcessors()));
+    const size_t shared_memory_size = num_limits * (sizeof(double) + sizeof(unsigned int));
+    HistogramBucketsKernel<T><<<num_blocks, threads_per_block, shared_memory_size, d.stream()>>>(
+        values.data(), values.size(), device_limits.flat<double>().data(), num_limits, output.data());
+  }
+};
+
+template struct HistogramBuckets<GPUDevice, float>;
+template struct HistogramBuckets<GPUDevice, double>;
+
+}  // namespace functor
+}  // namespace tensorflow
+
+#endif  // GOOGLE_CUDA
@@ -0,0 +1,307 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// The kernels in this file use libjpeg-turbo directly, and so they are only built when the op library is built with
+// JPEG support (i.e., using the 'TENSORFLOW_WITH_JPEG' CMake option).
+#if TENSORFLOW_WITH_JPEG
+
+#include <algorithm>
+#include <cmath>
+#include <csetjmp>
+#include <cstdio>
+#include <vector>
+
+#include <jpeglib.h>
+
+#if !defined(LIBJPEG_TURBO_VERSION)
+#error "The JPEG kernels require libjpeg-turbo 1.5 or newer."
+#endif
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::DimensionHandle;
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Per-output-pixel cost estimate of decoding and resizing an image, in cycles, which is used to shard the batch over
+  // threads.
+  const int64 kPixelCost = 1000;
+
+  // libjpeg error manager that jumps back to the decoding function on errors, instead of exiting the process.
+  struct JpegErrorManager {
+    jpeg_error_mgr manager;
+    std::jmp_buf jump_buffer;
+    char message[JMSG_LENGTH_MAX];
+  };
+
+  void JpegErrorExit(j_common_ptr info) {
+    JpegErrorManager* error_manager = reinterpret_cast<JpegErrorManager*>(info->err);
+    (*info->err->format_message)(info, error_manager->message);
+    std::longjmp(error_manager->jump_buffer, 1);
+  }
+
+  // Warnings (e.g., for premature ends of the data) are ignored, similar to the 'DecodeJpeg' op.
+  void JpegOutputMessage(j_common_ptr info) {}
+
+  // Returns the numerator of the smallest DCT-domain scaling factor (out of 'numerator / 8', for 'numerator' in
+  // '[1, 8]') for which a 'height' x 'width' crop window is scaled to at least 'target_height' x 'target_width' pixels,
+  // so that the scaled image only ever needs to be shrunk further.
+  int ScaleNumerator(int64 height, int64 width, int64 target_height, int64 target_width) {
+    for (int numerator = 1; numerator < 8; ++numerator)
+      if (height * numerator / 8 >= target_height && width * numerator / 8 >= target_width) return numerator;
+    return 8;
+  }
+
+  // Decodes the crop window '[y, y + h) x [x, x + w)' (where 'crop_window' is '[y, x, h, w]') of the JPEG image in
+  // 'contents' and resizes it to 'height' x 'width' pixels, using bilinear interpolation, writing the result to
+  // 'output'. Only the rows of the crop window (and, horizontally, the iMCU columns that overlap with it) are decoded,
+  // and they are decoded at the smallest DCT-domain scale that does not require upsampling them. 'rows' is a scratch
+  // buffer for the decoded rows.
+  Status DecodeCropAndResize(const string& contents, const int32* crop_window, int64 height, int64 width,
+                             int channels, std::vector<uint8>* rows, float* output) {
+    jpeg_decompress_struct info;
+    JpegErrorManager error_manager;
+    info.err = jpeg_std_error(&error_manager.manager);
+    error_manager.manager.error_exit = JpegErrorExit;
+    error_manager.manager.output_message = JpegOutputMessage;
+    if (setjmp(error_manager.jump_buffer)) {
+      jpeg_destroy_decompress(&info);
+      return errors::InvalidArgument("Failed to decode JPEG image: ", error_manager.message);
+    }
+    jpeg_create_decompress(&info);
+    jpeg_mem_src(&info, reinterpret_cast<unsigned char*>(const_cast<char*>(contents.data())),
+                 static_cast<unsigned long>(contents.size()));
+    jpeg_read_header(&info, TRUE);
+
+    const int64 crop_y = crop_window[0];
+    const int64 crop_x = crop_window[1];
+    const int64 crop_height = crop_window[2];
+    const int64 crop_width = crop_window[3];
+    if (crop_y < 0 || crop_x < 0 || crop_height <= 0 || crop_width <= 0 ||
+        crop_y + crop_height > static_cast<int64>(info.image_height) ||
+        crop_x + crop_width > static_cast<int64>(info.image_width)) {
+      const int64 image_height = static_cast<int64>(info.image_height);
+      const int64 image_width = static_cast<int64>(info.image_width);
+      jpeg_destroy_decompress(&info);
+      return errors::InvalidArgument("Invalid crop window [", crop_y, ", ", crop_x, ", ", crop_height, ", ",
+                                     crop_width, "] for a ", image_height, "x", image_width, " JPEG image.");
+    }
+
+    const int scale = ScaleNumerator(crop_height, crop_width, height, width);
+    info.scale_num = static_cast<unsigned int>(scale);
+    info.scale_denom = 8;
+    info.out_color_space = channels == 1 ? JCS_GRAYSCALE : JCS_RGB;
+    info.dct_method = JDCT_ISLOW;
+    jpeg_start_decompress(&info);
+
+    // Crop window in the coordinates of the scaled image, along with the rows and columns that need to be decoded.
+    const float scaled_y = static_cast<float>(crop_y * scale) / 8.0f;
+    const float scaled_x = static_cast<float>(crop_x * scale) / 8.0f;
+    const float scaled_height = static_cast<float>(crop_height * scale) / 8.0f;
+    const float scaled_width = static_cast<float>(crop_width * scale) / 8.0f;
+    const int64 first_row = static_cast<int64>(std::floor(scaled_y));
+    const int64 end_row = std::min(static_cast<int64>(std::ceil(scaled_y + scaled_height)),
+                                   static_cast<int64>(info.output_height));
+    JDIMENSION first_column = static_cast<JDIMENSION>(std::floor(scaled_x));
+    JDIMENSION num_columns = static_cast<JDIMENSION>(
+        std::min(static_cast<int64>(std::ceil(scaled_x + scaled_width)), static_cast<int64>(info.output_width)) -
+        static_cast<int64>(first_column));
+    jpeg_crop_scanline(&info, &first_column, &num_columns);
+    if (first_row > 0) jpeg_skip_scanlines(&info, static_cast<JDIMENSION>(first_row));
+
+    const int64 num_rows = end_row - first_row;
+    const int64 row_size = static_cast<int64>(num_columns) * channels;
+    rows->resize(static_cast<size_t>(num_rows * row_size));
+    while (static_cast<int64>(info.output_scanline) < end_row) {
+      JSAMPROW row = rows->data() + (static_cast<int64>(info.output_scanline) - first_row) * row_size;
+      jpeg_read_scanlines(&info, &row, 1);
+    }
+    jpeg_abort_decompress(&info);
+    jpeg_destroy_decompress(&info);
+
+    // Bilinear resizing of the crop window, with the same semantics as the 'ResizeBilinear' op (with
+    // 'align_corners = false').
+    const float offset_y = scaled_y - static_cast<float>(first_row);
+    const float offset_x = scaled_x - static_cast<float>(first_column);
+    const float height_scale = scaled_height / static_cast<float>(height);
+    const float width_scale = scaled_width / static_cast<float>(width);
+    std::vector<int64> left(width);
+    std::vector<int64> right(width);
+    std::vector<float> x_lerp(width);
+    for (int64 x = 0; x < width; ++x) {
+      const float in_x = offset_x + x * width_scale;
+      const int64 in_left = std::min(static_cast<int64>(in_x), static_cast<int64>(num_columns) - 1);
+      left[x] = in_left * channels;
+      right[x] = std::min(in_left + 1, static_cast<int64>(num_columns) - 1) * channels;
+      x_lerp[x] = in_x - static_cast<float>(in_left);
+    }
+    const uint8* data = rows->data();
+    for (int64 y = 0; y < height; ++y) {
+      const float in_y = offset_y + y * height_scale;
+      const int64 top = std::min(static_cast<int64>(in_y), num_rows - 1);
+      const int64 bottom = std::min(top + 1, num_rows - 1);
+      const float y_lerp = in_y - static_cast<float>(top);
+      const uint8* top_row = data + top * row_size;
+      const uint8* bottom_row = data + bottom * row_size;
+      for (int64 x = 0; x < width; ++x) {
+        for (int c = 0; c < channels; ++c) {
+          const float top_left = top_row[left[x] + c];
+          const float top_right = top_row[right[x] + c];
+          const float bottom_left = bottom_row[left[x] + c];
+          const float bottom_right = bottom_row[right[x] + c];
+          const float top_value = top_left + (top_right - top_left) * x_lerp[x];
+          const float bottom_value = bottom_left + (bottom_right - bottom_left) * x_lerp[x];
+          *output++ = top_value + (bottom_value - top_value) * y_lerp;
+        }
+      }
+    }
+    return Status::OK();
+  }
+}  // namespace
+
+// Kernel that decodes, crops, and resizes a batch of JPEG images, writing each image directly to its slot in the
+// output batch. The images are processed in parallel.
+class DecodeCropAndResizeJpegOp : public OpKernel {
+ public:
+  explicit DecodeCropAndResizeJpegOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("channels", &channels_));
+    OP_REQUIRES(ctx, channels_ == 1 || channels_ == 3,
+                errors::InvalidArgument("'channels' must be 1 or 3, but it was ", channels_, "."));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& contents = ctx->input(0);
+    const Tensor& crop_window = ctx->input(1);
+    const Tensor& size = ctx->input(2);
+    OP_REQUIRES(ctx, contents.dims() <= 1,
+                errors::InvalidArgument("'contents' must be a scalar or a vector, but has shape ",
+                                        contents.shape().DebugString(), "."));
+    const int64 batch_size = contents.NumElements();
+    const bool shared_crop_window = crop_window.dims() == 1;
+    OP_REQUIRES(ctx, (shared_crop_window && crop_window.dim_size(0) == 4) ||
+                     (crop_window.dims() == 2 && crop_window.dim_size(0) == batch_size &&
+                      crop_window.dim_size(1) == 4),
+                errors::InvalidArgument("'crop_window' must have shape [4] or [", batch_size, ", 4], but has shape ",
+                                        crop_window.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsVector(size.shape()) && size.NumElements() == 2,
+                errors::InvalidArgument("'size' must have shape [2], but has shape ", size.shape().DebugString(),
+                                        "."));
+    const int64 height = size.vec<int32>()(0);
+    const int64 width = size.vec<int32>()(1);
+    OP_REQUIRES(ctx, height > 0 && width > 0,
+                errors::InvalidArgument("'size' must be positive, but it was [", height, ", ", width, "]."));
+
+    TensorShape output_shape({height, width, channels_});
+    if (contents.dims() == 1) output_shape.InsertDim(0, batch_size);
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, output_shape, &output));
+    if (batch_size == 0) return;
+
+    const auto contents_flat = contents.flat<string>();
+    const int32* crop_window_data = crop_window.flat<int32>().data();
+    float* output_data = output->flat<float>().data();
+    const int channels = channels_;
+    const int64 image_size = height * width * channels;
+    mutex status_mutex;
+    Status status;
+    auto work = [&](int64 start, int64 limit) {
+      std::vector<uint8> rows;
+      for (int64 i = start; i < limit; ++i) {
+        const int32* window = crop_window_data + (shared_crop_window ? 0 : 4 * i);
+        const Status image_status =
+            DecodeCropAndResize(contents_flat(i), window, height, width, channels, &rows, output_data + i * image_size);
+        if (!image_status.ok()) {
+          mutex_lock lock(status_mutex);
+          status.Update(image_status);
+          return;
+        }
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, batch_size, height * width * kPixelCost, work);
+    OP_REQUIRES_OK(ctx, status);
+  }
+
+ private:
+  int channels_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(DecodeCropAndResizeJpegOp);
+};
+
+REGISTER_OP("DecodeCropAndResizeJpeg")
+    .Input("contents: string")
+    .Input("crop_window: int32")
+    .Input("size: int32")
+    .Output("images: float")
+    .Attr("channels: int = 3")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle contents;
+      TF_RETURN_IF_ERROR(c->WithRankAtMost(c->input(0), 1, &contents));
+      ShapeHandle crop_window;
+      TF_RETURN_IF_ERROR(c->WithRankAtLeast(c->input(1), 1, &crop_window));
+      TF_RETURN_IF_ERROR(c->WithRankAtMost(crop_window, 2, &crop_window));
+      ShapeHandle size;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &size));
+      DimensionHandle unused;
+      TF_RETURN_IF_ERROR(c->WithValue(c->Dim(size, 0), 2, &unused));
+      int32 channels;
+      TF_RETURN_IF_ERROR(c->GetAttr("channels", &channels));
+      ShapeHandle image_size;
+      TF_RETURN_IF_ERROR(c->MakeShapeFromShapeTensor(2, &image_size));
+      ShapeHandle output;
+      TF_RETURN_IF_ERROR(c->Concatenate(image_size, c->Vector(channels), &output));
+      if (c->RankKnown(contents) && c->Rank(contents) == 1)
+        TF_RETURN_IF_ERROR(c->Concatenate(c->Vector(c->Dim(contents, 0)), output, &output));
+      else if (!c->RankKnown(contents))
+        output = c->UnknownShape();
+      c->set_output(0, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Decodes, crops, and resizes JPEG-encoded images.
+
+This op computes the same result as decoding each image in 'contents' using the 'DecodeJpeg' op, cropping it using
+'crop_window', and resizing the crop to 'size' using the 'ResizeBilinear' op, up to JPEG decoding differences.
+However, it never decodes the full-resolution image. Each image is decoded at the smallest DCT-domain scale (out of
+1/8, 2/8, ..., 8/8) at which its crop window is at least as large as 'size', only the rows that overlap with the crop
+window are decoded, and, within them, only the iMCU columns that overlap with it. The images are processed in parallel
+and each one is written directly to its slot in the output batch.
+
+contents: 0-D or 1-D. The JPEG-encoded images.
+crop_window: 1-D with shape [4] or 2-D with shape [batch_size, 4]. Crop window(s), represented as
+  [crop_y, crop_x, crop_height, crop_width]. A 1-D crop window is shared by all images.
+size: 1-D with shape [2], containing the new size of the images, represented as [height, width].
+images: 3-D with shape [height, width, channels] (if 'contents' is 0-D) or 4-D with shape
+  [batch_size, height, width, channels] (if 'contents' is 1-D). The resized images.
+channels: Number of color channels of the decoded images. Must be 1 (for grayscale images) or 3 (for RGB images).
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("DecodeCropAndResizeJpeg").Device(DEVICE_CPU), DecodeCropAndResizeJpegOp);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_WITH_JPEG
@@ -27,7 +27,9 @@ limitations under the License.
 #include "tensorflow/core/framework/common_shape_fns.h"
 #include "tensorflow/core/lib/core/coding.h"
 #include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
 
 namespace {
 // Copy of the C Eager API struct due to the circular dependency issue.
@@ -49,6 +51,25 @@ const tensorflow::Tensor* TFE_Local_TensorHandleUnderlyingTensorInHostMemory(
 }
 
 namespace tensorflow {
+namespace {
+  // Shape function for JVM callback ops that sets the output shapes to the ones provided in their "output_shapes"
+  // attribute, or to unknown shapes, if that attribute is empty.
+  Status OutputShapesShapeFn(shape_inference::InferenceContext* c) {
+    std::vector<PartialTensorShape> output_shapes;
+    TF_RETURN_IF_ERROR(c->GetAttr("output_shapes", &output_shapes));
+    if (output_shapes.empty()) return shape_inference::UnknownShape(c);
+    if (static_cast<int>(output_shapes.size()) != c->num_outputs())
+      return errors::InvalidArgument(
+          "Expected ", c->num_outputs(), " output shapes, but got ", output_shapes.size(), ".");
+    for (int i = 0; i < c->num_outputs(); ++i) {
+      shape_inference::ShapeHandle output_shape;
+      TF_RETURN_IF_ERROR(c->MakeShapeFromPartialTensorShape(output_shapes[i], &output_shape));
+      c->set_output(i, output_shape);
+    }
+    return Status::OK();
+  }
+}  // namespace
+
 REGISTER_OP("JVMCallback")
     .Input("input: Tin")
     .Output("output: Tout")
@@ -59,7 +80,8 @@ REGISTER_OP("JVMCallback")
     .Attr("Tin: list(type) >= 0")
     .Attr("Tout: list(type) >=0")
     .SetIsStateful()
-    .SetShapeFn(shape_inference::UnknownShape)
+    .Attr("output_shapes: list(shape) >= 0 = []")
+    .SetShapeFn(OutputShapesShapeFn)
     .Doc(R"doc(
 Invokes a JVM callback function, `f` to compute `f(input)->output`.
 
@@ -79,6 +101,165 @@ output: Output tensors from the op.
 Tin: Data types of the inputs to the op.
 Tout: Data types of the outputs from the op.
       The length of the list specifies the number of outputs.
+output_shapes: Optional (possibly partially-known) shapes of the outputs from
+  the op. If empty, the output shapes are unknown.
+)doc");
+
+REGISTER_OP("JVMBufferCallback")
+    .Input("input: Tin")
+    .Output("output: Tout")
+    .Attr("id: int")
+    .Attr("jvm_pointer: string")
+    .Attr("registry_pointer: string")
+    .Attr("registry_call_pointer: string")
+    .Attr("Tin: list(type) >= 0")
+    .Attr("Tout: list(type) >= 0")
+    .Attr("output_shapes: list(shape) >= 0")
+    .SetIsStateful()
+    .SetShapeFn(OutputShapesShapeFn)
+    .Doc(R"doc(
+Invokes a JVM callback function, `f`, that computes `f(input)->output` over the
+memory of the input and output tensors.
+
+Unlike `JVMCallback`, no tensor handles are created for the inputs and outputs.
+Instead, the inputs are passed to the JVM as direct byte buffers over the
+existing tensor memory, along with their data types and shapes, and the outputs
+are allocated by this op, with shapes `output_shapes`, and are passed to the JVM
+as direct byte buffers that the callback function must fill in. String tensors
+are not supported.
+
+This operation is considered stateful. For a stateless version, see
+`JVMBufferCallbackStateless`.
+
+id: A unique ID representing a registered JVM callback function
+  in this address space.
+jvm_pointer: A pointer to an existing JVM instance represented as a
+  string. This is the JVM that will be used when invoking this JVM
+  callback.
+registry_pointer: Pointer to the JVM callbacks registry class.
+registry_call_pointer: Pointer to the JVM callbacks registry class
+  'callBuffers' method.
+input: List of tensors that will provide input to the op.
+output: Output tensors from the op.
+Tin: Data types of the inputs to the op.
+Tout: Data types of the outputs from the op.
+      The length of the list specifies the number of outputs.
+output_shapes: Fully-defined shapes of the outputs from the op.
+)doc");
+
+REGISTER_OP("JVMBufferCallbackStateless")
+    .Input("input: Tin")
+    .Output("output: Tout")
+    .Attr("id: int")
+    .Attr("jvm_pointer: string")
+    .Attr("registry_pointer: string")
+    .Attr("registry_call_pointer: string")
+    .Attr("Tin: list(type) >= 0")
+    .Attr("Tout: list(type) >= 0")
+    .Attr("output_shapes: list(shape) >= 0")
+    .SetShapeFn(OutputShapesShapeFn)
+    .Doc(R"doc(
+A stateless version of `JVMBufferCallback`.
+)doc");
+
+REGISTER_OP("JVMAsyncCallback")
+    .Input("input: Tin")
+    .Output("output: Tout")
+    .Attr("id: int")
+    .Attr("jvm_pointer: string")
+    .Attr("registry_pointer: string")
+    .Attr("registry_call_pointer: string")
+    .Attr("Tin: list(type) >= 0")
+    .Attr("Tout: list(type) >= 0")
+    .SetIsStateful()
+    .Attr("output_shapes: list(shape) >= 0 = []")
+    .SetShapeFn(OutputShapesShapeFn)
+    .Doc(R"doc(
+Invokes a JVM callback function, `f`, to compute `f(input)->output`
+asynchronously.
+
+Unlike `JVMCallback`, this op does not block the TensorFlow thread that executes
+it while the JVM callback function runs. Instead, the function is dispatched to
+a JVM executor and the op completes once the future that it returns resolves.
+
+This operation is considered stateful. For a stateless version, see
+`JVMAsyncCallbackStateless`.
+
+id: A unique ID representing a registered JVM asynchronous callback
+  function in this address space.
+jvm_pointer: A pointer to an existing JVM instance represented as a
+  string. This is the JVM that will be used when invoking this JVM
+  callback.
+registry_pointer: Pointer to the JVM callbacks registry class.
+registry_call_pointer: Pointer to the JVM callbacks registry class
+  'callAsync' method.
+input: List of tensors that will provide input to the op.
+output: Output tensors from the op.
+Tin: Data types of the inputs to the op.
+Tout: Data types of the outputs from the op.
+      The length of the list specifies the number of outputs.
+output_shapes: Optional (possibly partially-known) shapes of the outputs from
+  the op. If empty, the output shapes are unknown.
+)doc");
+
+REGISTER_OP("JVMAsyncCallbackStateless")
+    .Input("input: Tin")
+    .Output("output: Tout")
+    .Attr("id: int")
+    .Attr("jvm_pointer: string")
+    .Attr("registry_pointer: string")
+    .Attr("registry_call_pointer: string")
+    .Attr("Tin: list(type) >= 0")
+    .Attr("Tout: list(type) >= 0")
+    .Attr("output_shapes: list(shape) >= 0 = []")
+    .SetShapeFn(OutputShapesShapeFn)
+    .Doc(R"doc(
+A stateless version of `JVMAsyncCallback`.
+)doc");
+
+REGISTER_OP("JVMBatchCallback")
+    .Input("input: Tin")
+    .Output("output: Tout")
+    .Attr("id: int")
+    .Attr("jvm_pointer: string")
+    .Attr("registry_pointer: string")
+    .Attr("registry_call_pointer: string")
+    .Attr("Tin: list(type) >= 0")
+    .Attr("Tout: list(type) >= 0")
+    .Attr("max_batch_size: int >= 1 = 32")
+    .Attr("batch_timeout_micros: int >= 0 = 1000")
+    .SetIsStateful()
+    .Attr("output_shapes: list(shape) >= 0 = []")
+    .SetShapeFn(OutputShapesShapeFn)
+    .Doc(R"doc(
+Invokes a JVM callback function, `f`, to compute `f(inputs)->outputs` over
+batches of the inputs of concurrent executions of this op.
+
+The inputs of concurrent executions are collected until `max_batch_size` of
+them are pending, or until `batch_timeout_micros` microseconds have passed
+since the first of them arrived, and the JVM callback function is invoked once
+for the whole batch. Its outputs are then scattered back to the corresponding
+executions. This amortizes the cost of calling into the JVM over many
+executions (e.g., concurrent requests in serving graphs).
+
+id: A unique ID representing a registered JVM batch callback function
+  in this address space.
+jvm_pointer: A pointer to an existing JVM instance represented as a
+  string. This is the JVM that will be used when invoking this JVM
+  callback.
+registry_pointer: Pointer to the JVM callbacks registry class.
+registry_call_pointer: Pointer to the JVM callbacks registry class
+  'callBatch' method.
+input: List of tensors that will provide input to the op.
+output: Output tensors from the op.
+Tin: Data types of the inputs to the op.
+Tout: Data types of the outputs from the op.
+      The length of the list specifies the number of outputs.
+max_batch_size: Maximum number of executions to batch together.
+batch_timeout_micros: Maximum number of microseconds that an execution
+  waits for other executions to batch with.
+output_shapes: Optional (possibly partially-known) shapes of the outputs from
+  the op. If empty, the output shapes are unknown.
 )doc");
 
 REGISTER_OP("JVMCallbackStateless")
@@ -90,7 +271,8 @@ REGISTER_OP("JVMCallbackStateless")
     .Attr("registry_call_pointer: string")
     .Attr("Tin: list(type) >= 0")
     .Attr("Tout: list(type) >= 0")
-    .SetShapeFn(shape_inference::UnknownShape)
+    .Attr("output_shapes: list(shape) >= 0 = []")
+    .SetShapeFn(OutputShapesShapeFn)
     .Doc(R"doc(
 A stateless version of `JVMCallback`.
 )doc");
@@ -119,18 +301,51 @@ namespace {
       static_assert(sizeof(jlong) >= sizeof(TFE_TensorHandle*), "Cannot package C object pointers as a Java long");
       if (outputs_array[i] == 0) {
         status->status = errors::InvalidArgument("One of the op output tensors has been disposed already.");
-        return;
+        break;
       }
       auto* h = reinterpret_cast<TFE_TensorHandle*>(outputs_array[i]);
-      if (h == nullptr) {
-        status->status = errors::InvalidArgument("Could not obtain tensor handle to one of the outputs.");
-        return;
-      }
       const Tensor* t = TFE_Local_TensorHandleUnderlyingTensorInHostMemory(h, status);
-      if (!status->status.ok()) return;
+      if (!status->status.ok()) break;
       call->outputs.push_back(*t);
     }
-    call->env->ReleaseLongArrayElements(call_outputs, outputs_array, 0);
+    call->env->ReleaseLongArrayElements(call_outputs, outputs_array, JNI_ABORT);
+  }
+
+  // Converts the pending JVM exception, if any, to a TensorFlow status, and clears it.
+  Status ExceptionToStatus(JNIEnv* env) {
+    jthrowable exc(env->ExceptionOccurred());
+    if (!exc) return Status::OK();
+    // The exception must be cleared before any other JNI calls are made, and especially before this thread, which
+    // stays attached, makes its next call into the JVM.
+    env->ExceptionClear();
+    // Get the exception string representation to use as the error message.
+    // The method IDs are looked up once, since "Throwable" and "Class" are never unloaded. This library is loaded
+    // by TensorFlow rather than by the JVM, and so it cannot share the cache initialized in "JNI_OnLoad".
+    static jmethodID toString = env->GetMethodID(
+        env->FindClass("java/lang/Throwable"), "toString", "()Ljava/lang/String;");
+    jstring exc_string = (jstring) env->CallObjectMethod(exc, toString);
+    const char* c_exc_string = env->GetStringUTFChars(exc_string, 0);
+    std::string tf_exc_string(c_exc_string);
+    env->ReleaseStringUTFChars(exc_string, c_exc_string);
+    // Get the exception class name and convert it to a TensorFlow error code.
+    jclass excObjCls(env->GetObjectClass(exc));
+    static jmethodID getName = env->GetMethodID(
+        env->FindClass("java/lang/Class"), "getName", "()Ljava/lang/String;");
+    jstring clsName(static_cast<jstring>(env->CallObjectMethod(excObjCls, getName)));
+    const char* clsNameCString = env->GetStringUTFChars(clsName, 0);
+    std::string clsNameCppString(clsNameCString);
+    int error_code = tf_error_code(clsNameCppString);
+    env->ReleaseStringUTFChars(clsName, clsNameCString);
+    return tensorflow::Status((tensorflow::error::Code) error_code, tf_exc_string);
+  }
+
+  // Checks that the "index"-th output returned by the JVM function with ID "id" is compatible with its declared shape
+  // (i.e., with the "index"-th element of the "output_shapes" op attribute), if any.
+  Status CheckOutputShape(const std::vector<PartialTensorShape>& output_shapes, int id, int index, const Tensor& t) {
+    if (output_shapes.empty() || output_shapes[index].IsCompatibleWith(t.shape())) return Status::OK();
+    return errors::InvalidArgument(
+        index, "-th value returned by ", id, " has shape ", t.shape().DebugString(), ", but expects shape ",
+        output_shapes[index].DebugString());
   }
 
   // Calls the registered JVM function through the registry.
@@ -138,39 +353,24 @@ namespace {
     // Prepare the call arguments.
     jlongArray call_inputs = MakeInputs(call);
 
-    // Invoke the registry 'call' method.
+    // Invoke the registry 'call' (or 'callBatch') method.
     if (call->registry != nullptr && call->call_method_id != nullptr) {
-      auto outputs = (jlongArray) call->env->CallStaticObjectMethod(
-          call->registry, call->call_method_id, call->id, call_inputs);
-      jthrowable exc(call->env->ExceptionOccurred());
-      if (exc) {
-        // Get the exception string representation to use as the error message.
-        jclass throwableCls(call->env->FindClass("java/lang/Throwable"));
-        jmethodID toString = call->env->GetMethodID(throwableCls, "toString", "()Ljava/lang/String;");
-        jstring exc_string = (jstring) call->env->CallObjectMethod(exc, toString);
-        const char* c_exc_string = call->env->GetStringUTFChars(exc_string, 0);
-        tensorflow::StringPiece tf_exc_string(c_exc_string);
-        call->env->ReleaseStringUTFChars(exc_string, c_exc_string);
-        // Get the exception class name and convert it to a TensorFlow error code.
-        jclass excObjCls(call->env->GetObjectClass(exc));
-        jclass classCls(call->env->FindClass("java/lang/Class"));
-        jmethodID getName(call->env->GetMethodID(classCls, "getName", "()Ljava/lang/String;"));
-        jstring clsName(static_cast<jstring>(call->env->CallObjectMethod(excObjCls, getName)));
-        const char* clsNameCString = call->env->GetStringUTFChars(clsName, 0);
-        std::string clsNameCppString(clsNameCString);
-        int error_code = tf_error_code(clsNameCppString);
-        call->env->ReleaseStringUTFChars(clsName, clsNameCString);
-        return tensorflow::Status((tensorflow::error::Code) error_code, tf_exc_string);
-      }
+      auto outputs = call->batch_size > 0
+          ? (jlongArray) call->env->CallStaticObjectMethod(
+              call->registry, call->call_method_id, call->id, call_inputs, static_cast<jint>(call->batch_size))
+          : (jlongArray) call->env->CallStaticObjectMethod(
+              call->registry, call->call_method_id, call->id, call_inputs);
+      Status exception_status = ExceptionToStatus(call->env);
+      if (!exception_status.ok()) return exception_status;
 
       if (outputs == nullptr) {
         return errors::Unknown("Failed to run JVM callback function.");
       }
 
       // Process the return values and convert them back to TensorFlow tensors.
-      auto* status = new TF_Status;
-      ProcessOutputs(call, outputs, status);
-      return status->status;
+      TF_Status status;
+      ProcessOutputs(call, outputs, &status);
+      return status.status;
     } else {
       return errors::Unknown("Failed to run JVM callback function. Could not find registry class or its 'call' method.");
     }
@@ -184,32 +384,25 @@ public:
     std::string jvm_pointer;
     OP_REQUIRES_OK(ctx, ctx->GetAttr("jvm_pointer", &jvm_pointer));
     jvm_ = pointerFromString<JavaVM*>(jvm_pointer);
-    JNIEnv* env;
-    int jvmEnvStatus = jvm_->GetEnv((void **) &env, JNI_VERSION_1_6);
-    if (jvmEnvStatus != JNI_OK) {
-      jint status = jvm_->AttachCurrentThread((void**) &env, nullptr);
-      assert(status == JNI_OK);
-    }
     std::string registry_pointer;
     OP_REQUIRES_OK(ctx, ctx->GetAttr("registry_pointer", &registry_pointer));
     registry_ = pointerFromString<jclass>(registry_pointer);
     std::string registry_call_pointer;
     OP_REQUIRES_OK(ctx, ctx->GetAttr("registry_call_pointer", &registry_call_pointer));
     call_method_id_ = pointerFromString<jmethodID>(registry_call_pointer);
-    if (jvmEnvStatus != JNI_OK) {
-      jint status = jvm_->DetachCurrentThread();
-      assert(status == JNI_OK);
-    }
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("output_shapes", &output_shapes_));
   }
 
   void Compute(OpKernelContext* ctx) override {
-    JNIEnv* env;
-    int jvmEnvStatus = jvm_->GetEnv((void**) &env, JNI_VERSION_1_6);
-    if (jvmEnvStatus != JNI_OK) {
-      jint status = jvm_->AttachCurrentThread((void**) &env, nullptr);
-      assert(status == JNI_OK);
-    }
+    // TensorFlow worker threads are attached to the JVM the first time they run a callback and stay attached until they
+    // exit, because attaching and detaching on every invocation dominates the cost of small callbacks.
+    JNIEnv* env = attach_current_thread(jvm_);
+    OP_REQUIRES(ctx, env != nullptr, errors::Internal("Unable to attach the current thread to the JVM."));
 
+    // Local references are only freed when native methods return to the JVM, which never happens on attached
+    // TensorFlow threads, and so all references created by the call are scoped by a local frame.
+    OP_REQUIRES(ctx, env->PushLocalFrame(kCallLocalFrameCapacity) == 0,
+                errors::ResourceExhausted("Unable to allocate JNI local references for the JVM callback."));
     JVMCall call;
     call.env = env;
     call.registry = registry_;
@@ -220,10 +413,7 @@ public:
     }
 
     Status s = CallJVMFunction(&call);
-    if (jvmEnvStatus != JNI_OK) {
-      jint status = jvm_->DetachCurrentThread();
-      assert(status == JNI_OK);
-    }
+    env->PopLocalFrame(nullptr);
 
     OP_REQUIRES_OK(ctx, s);
 
@@ -238,19 +428,416 @@ public:
           errors::InvalidArgument(i, "-th value returned by ", id_, " is ",
                                   DataTypeString(t.dtype()), ", but expects ",
                                   DataTypeString(output_type(i))));
+      OP_REQUIRES_OK(ctx, CheckOutputShape(output_shapes_, id_, static_cast<int>(i), t));
       ctx->set_output(i, t);
     }
   }
 
 private:
+  // Number of local references that are guaranteed to be available to each callback invocation.
+  static constexpr jint kCallLocalFrameCapacity = 16;
+
   int id_;
   JavaVM* jvm_;
   jclass registry_;
   jmethodID call_method_id_;
+  std::vector<PartialTensorShape> output_shapes_;
 
   TF_DISALLOW_COPY_AND_ASSIGN(JVMCallbackOp);
 };
 
+namespace {
+  // Execution of a "JVMAsyncCallback" op that is pending on the JVM.
+  struct JVMAsyncCall {
+    OpKernelContext* ctx;
+    AsyncOpKernel::DoneCallback done;
+    int id;
+    // Owned by the op kernel, which outlives its pending executions.
+    const std::vector<PartialTensorShape>* output_shapes;
+  };
+
+  // Completes the pending asynchronous call identified by "call_handle" and deletes it. This function is invoked by the
+  // JVM, through "ScalaCallbacksRegistry.completeAsync", exactly once for each call. Its address is passed to the JVM
+  // along with each call, because this library is loaded by TensorFlow and so it cannot register JVM native methods.
+  // "exception_class_name" and "message" are null if the call succeeded.
+  void CompleteJVMAsyncCall(
+      JNIEnv* env, jlong call_handle, jlongArray outputs, jstring exception_class_name, jstring message) {
+    std::unique_ptr<JVMAsyncCall> call(reinterpret_cast<JVMAsyncCall*>(call_handle));
+    OpKernelContext* ctx = call->ctx;
+    if (exception_class_name != nullptr) {
+      const char* c_class_name = env->GetStringUTFChars(exception_class_name, nullptr);
+      const int error_code = tf_error_code(c_class_name);
+      env->ReleaseStringUTFChars(exception_class_name, c_class_name);
+      std::string error_message;
+      if (message != nullptr) {
+        const char* c_message = env->GetStringUTFChars(message, nullptr);
+        error_message = c_message;
+        env->ReleaseStringUTFChars(message, c_message);
+      }
+      ctx->SetStatus(Status(static_cast<error::Code>(error_code), error_message));
+      call->done();
+      return;
+    }
+    JVMCall jvm_call;
+    jvm_call.env = env;
+    TF_Status status;
+    if (outputs == nullptr)
+      status.status = errors::Unknown("Failed to run JVM callback function.");
+    else
+      ProcessOutputs(&jvm_call, outputs, &status);
+    if (status.status.ok() && static_cast<int32>(jvm_call.outputs.size()) != ctx->num_outputs())
+      status.status = errors::InvalidArgument(
+          call->id, " returns ", jvm_call.outputs.size(), " values, but expects to see ", ctx->num_outputs(),
+          " values.");
+    for (size_t i = 0; status.status.ok() && i < jvm_call.outputs.size(); ++i) {
+      const auto& t = jvm_call.outputs[i];
+      if (t.dtype() != ctx->expected_output_dtype(i))
+        status.status = errors::InvalidArgument(
+            i, "-th value returned by ", call->id, " is ", DataTypeString(t.dtype()), ", but expects ",
+            DataTypeString(ctx->expected_output_dtype(i)));
+      else
+        status.status = CheckOutputShape(*call->output_shapes, call->id, static_cast<int>(i), t);
+      if (status.status.ok()) ctx->set_output(i, t);
+    }
+    if (!status.status.ok()) ctx->SetStatus(status.status);
+    call->done();
+  }
+}  // namespace
+
+class JVMAsyncCallbackOp : public AsyncOpKernel {
+public:
+  explicit JVMAsyncCallbackOp(OpKernelConstruction* ctx) : AsyncOpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("id", &id_));
+    std::string jvm_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("jvm_pointer", &jvm_pointer));
+    jvm_ = pointerFromString<JavaVM*>(jvm_pointer);
+    std::string registry_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("registry_pointer", &registry_pointer));
+    registry_ = pointerFromString<jclass>(registry_pointer);
+    std::string registry_call_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("registry_call_pointer", &registry_call_pointer));
+    call_method_id_ = pointerFromString<jmethodID>(registry_call_pointer);
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("output_shapes", &output_shapes_));
+  }
+
+  void ComputeAsync(OpKernelContext* ctx, DoneCallback done) override {
+    OP_REQUIRES_ASYNC(ctx, registry_ != nullptr && call_method_id_ != nullptr,
+                      errors::Unknown("Failed to run JVM callback function. Could not find registry class or its "
+                                      "'callAsync' method."), done);
+    JNIEnv* env = attach_current_thread(jvm_);
+    OP_REQUIRES_ASYNC(ctx, env != nullptr, errors::Internal("Unable to attach the current thread to the JVM."), done);
+    // All references created by the call are scoped by a local frame (see "JVMCallbackOp::Compute").
+    OP_REQUIRES_ASYNC(ctx, env->PushLocalFrame(kCallLocalFrameCapacity) == 0,
+                      errors::ResourceExhausted("Unable to allocate JNI local references for the JVM callback."), done);
+    JVMCall call;
+    call.env = env;
+    for (int i = 0; i < ctx->num_inputs(); ++i) {
+      call.inputs.push_back(ctx->input(i));
+    }
+    jlongArray call_inputs = MakeInputs(&call);
+    auto* async_call = new JVMAsyncCall{ctx, std::move(done), id_, &output_shapes_};
+    // The registry never throws once it has accepted the call, in which case the call is completed by the JVM.
+    // Otherwise, the call is completed here.
+    env->CallStaticVoidMethod(
+        registry_, call_method_id_, id_, call_inputs, reinterpret_cast<jlong>(&CompleteJVMAsyncCall),
+        reinterpret_cast<jlong>(async_call));
+    Status s = ExceptionToStatus(env);
+    env->PopLocalFrame(nullptr);
+    if (!s.ok()) {
+      std::unique_ptr<JVMAsyncCall> failed_call(async_call);
+      ctx->SetStatus(s);
+      failed_call->done();
+    }
+  }
+
+private:
+  // Number of local references that are guaranteed to be available to each callback invocation.
+  static constexpr jint kCallLocalFrameCapacity = 16;
+
+  int id_;
+  JavaVM* jvm_;
+  jclass registry_;
+  jmethodID call_method_id_;
+  std::vector<PartialTensorShape> output_shapes_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(JVMAsyncCallbackOp);
+};
+
+// Collects the inputs of concurrent executions of a "JVMBatchCallback" op and invokes the JVM callback function once for
+// each batch of them. Batchers are shared with the timer closures that flush them, and so they may outlive their op.
+class JVMCallBatcher : public std::enable_shared_from_this<JVMCallBatcher> {
+public:
+  JVMCallBatcher(JavaVM* jvm, jclass registry, jmethodID call_method_id, int id, int max_batch_size,
+                 int64 batch_timeout_micros, std::vector<PartialTensorShape> output_shapes)
+      : jvm_(jvm), registry_(registry), call_method_id_(call_method_id), id_(id), max_batch_size_(max_batch_size),
+        batch_timeout_micros_(batch_timeout_micros), output_shapes_(std::move(output_shapes)) {}
+
+  // Adds an execution to the current batch, flushing it if it is full. "done" is invoked once the execution completes.
+  void Add(OpKernelContext* ctx, AsyncOpKernel::DoneCallback done) {
+    std::vector<PendingCall> batch;
+    {
+      mutex_lock l(mu_);
+      pending_.push_back({ctx, std::move(done)});
+      if (static_cast<int>(pending_.size()) < max_batch_size_ && batch_timeout_micros_ > 0) {
+        if (pending_.size() == 1) {
+          std::shared_ptr<JVMCallBatcher> self = shared_from_this();
+          const int64 batch_id = batch_id_;
+          Env::Default()->SchedClosureAfter(batch_timeout_micros_, [self, batch_id]() { self->FlushBatch(batch_id); });
+        }
+        return;
+      }
+      batch.swap(pending_);
+      ++batch_id_;
+    }
+    Flush(&batch);
+  }
+
+private:
+  struct PendingCall {
+    OpKernelContext* ctx;
+    AsyncOpKernel::DoneCallback done;
+  };
+
+  // Flushes the batch with ID "batch_id", unless it has already been flushed because it was full.
+  void FlushBatch(int64 batch_id) {
+    std::vector<PendingCall> batch;
+    {
+      mutex_lock l(mu_);
+      if (batch_id != batch_id_ || pending_.empty()) return;
+      batch.swap(pending_);
+      ++batch_id_;
+    }
+    Flush(&batch);
+  }
+
+  // Invokes the JVM callback function for "batch", scatters its outputs, and completes all executions in the batch.
+  void Flush(std::vector<PendingCall>* batch) {
+    Status s = Call(batch);
+    for (PendingCall& call : *batch) {
+      if (!s.ok()) call.ctx->SetStatus(s);
+      call.done();
+    }
+  }
+
+  Status Call(std::vector<PendingCall>* batch) {
+    const int batch_size = static_cast<int>(batch->size());
+    OpKernelContext* first_ctx = batch->front().ctx;
+    const int num_inputs = first_ctx->num_inputs();
+    const int num_outputs = first_ctx->num_outputs();
+    JNIEnv* env = attach_current_thread(jvm_);
+    if (env == nullptr) return errors::Internal("Unable to attach the current thread to the JVM.");
+    // All references created by the call are scoped by a local frame (see "JVMCallbackOp::Compute").
+    if (env->PushLocalFrame(kCallLocalFrameCapacity) != 0)
+      return errors::ResourceExhausted("Unable to allocate JNI local references for the JVM callback.");
+    JVMCall call;
+    call.env = env;
+    call.registry = registry_;
+    call.call_method_id = call_method_id_;
+    call.id = id_;
+    call.batch_size = batch_size;
+    call.inputs.reserve(static_cast<size_t>(batch_size * num_inputs));
+    for (const PendingCall& pending : *batch)
+      for (int i = 0; i < num_inputs; ++i)
+        call.inputs.push_back(pending.ctx->input(i));
+    Status s = CallJVMFunction(&call);
+    env->PopLocalFrame(nullptr);
+    if (!s.ok()) return s;
+    if (static_cast<int>(call.outputs.size()) != batch_size * num_outputs)
+      return errors::InvalidArgument(
+          id_, " returns ", call.outputs.size(), " values for a batch of ", batch_size, " executions, but expects to see ",
+          batch_size * num_outputs, " values.");
+    for (int b = 0; b < batch_size; ++b) {
+      OpKernelContext* ctx = (*batch)[b].ctx;
+      for (int i = 0; i < num_outputs; ++i) {
+        const Tensor& t = call.outputs[b * num_outputs + i];
+        if (t.dtype() != ctx->expected_output_dtype(i))
+          return errors::InvalidArgument(
+              i, "-th value returned by ", id_, " is ", DataTypeString(t.dtype()), ", but expects ",
+              DataTypeString(ctx->expected_output_dtype(i)));
+        TF_RETURN_IF_ERROR(CheckOutputShape(output_shapes_, id_, i, t));
+        ctx->set_output(i, t);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Number of local references that are guaranteed to be available to each callback invocation.
+  static constexpr jint kCallLocalFrameCapacity = 16;
+
+  JavaVM* const jvm_;
+  const jclass registry_;
+  const jmethodID call_method_id_;
+  const int id_;
+  const int max_batch_size_;
+  const int64 batch_timeout_micros_;
+  const std::vector<PartialTensorShape> output_shapes_;
+
+  mutex mu_;
+  std::vector<PendingCall> pending_ GUARDED_BY(mu_);
+  int64 batch_id_ GUARDED_BY(mu_) = 0;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(JVMCallBatcher);
+};
+
+class JVMBatchCallbackOp : public AsyncOpKernel {
+public:
+  explicit JVMBatchCallbackOp(OpKernelConstruction* ctx) : AsyncOpKernel(ctx) {
+    int id;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("id", &id));
+    std::string jvm_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("jvm_pointer", &jvm_pointer));
+    std::string registry_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("registry_pointer", &registry_pointer));
+    std::string registry_call_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("registry_call_pointer", &registry_call_pointer));
+    int max_batch_size;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("max_batch_size", &max_batch_size));
+    int batch_timeout_micros;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("batch_timeout_micros", &batch_timeout_micros));
+    std::vector<PartialTensorShape> output_shapes;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("output_shapes", &output_shapes));
+    batcher_ = std::make_shared<JVMCallBatcher>(
+        pointerFromString<JavaVM*>(jvm_pointer), pointerFromString<jclass>(registry_pointer),
+        pointerFromString<jmethodID>(registry_call_pointer), id, max_batch_size, batch_timeout_micros,
+        std::move(output_shapes));
+  }
+
+  void ComputeAsync(OpKernelContext* ctx, DoneCallback done) override {
+    batcher_->Add(ctx, std::move(done));
+  }
+
+private:
+  std::shared_ptr<JVMCallBatcher> batcher_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(JVMBatchCallbackOp);
+};
+
+class JVMBufferCallbackOp : public OpKernel {
+public:
+  explicit JVMBufferCallbackOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("id", &id_));
+    std::string jvm_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("jvm_pointer", &jvm_pointer));
+    jvm_ = pointerFromString<JavaVM*>(jvm_pointer);
+    std::string registry_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("registry_pointer", &registry_pointer));
+    registry_ = pointerFromString<jclass>(registry_pointer);
+    std::string registry_call_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("registry_call_pointer", &registry_call_pointer));
+    call_method_id_ = pointerFromString<jmethodID>(registry_call_pointer);
+    std::vector<PartialTensorShape> output_shapes;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("output_shapes", &output_shapes));
+    OP_REQUIRES(ctx, static_cast<int>(output_shapes.size()) == ctx->num_outputs(),
+                errors::InvalidArgument("Expected ", ctx->num_outputs(), " output shapes, but got ",
+                                        output_shapes.size(), "."));
+    output_shapes_.resize(output_shapes.size());
+    for (size_t i = 0; i < output_shapes.size(); ++i) {
+      OP_REQUIRES(ctx, output_shapes[i].AsTensorShape(&output_shapes_[i]),
+                  errors::InvalidArgument("The shape of output ", i, " (", output_shapes[i].DebugString(),
+                                          ") is not fully defined."));
+      OP_REQUIRES(ctx, DataTypeSize(output_type(i)) > 0,
+                  errors::InvalidArgument("Outputs of type ", DataTypeString(output_type(i)), " are not supported."));
+    }
+    for (int i = 0; i < ctx->num_inputs(); ++i) {
+      OP_REQUIRES(ctx, DataTypeSize(ctx->input_type(i)) > 0,
+                  errors::InvalidArgument("Inputs of type ", DataTypeString(ctx->input_type(i)),
+                                          " are not supported."));
+    }
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    // Outputs are allocated before calling into the JVM, so that the callback can write them in place.
+    const int num_inputs = ctx->num_inputs();
+    const int num_outputs = ctx->num_outputs();
+    std::vector<Tensor*> outputs(static_cast<size_t>(num_outputs));
+    for (int i = 0; i < num_outputs; ++i)
+      OP_REQUIRES_OK(ctx, ctx->allocate_output(i, output_shapes_[i], &outputs[i]));
+
+    JNIEnv* env = attach_current_thread(jvm_);
+    OP_REQUIRES(ctx, env != nullptr, errors::Internal("Unable to attach the current thread to the JVM."));
+    // All references created by the call are scoped by a local frame (see "JVMCallbackOp::Compute").
+    OP_REQUIRES(ctx, env->PushLocalFrame(2 * (num_inputs + num_outputs) + kCallLocalFrameCapacity) == 0,
+                errors::ResourceExhausted("Unable to allocate JNI local references for the JVM callback."));
+    Status s = Call(env, ctx, outputs);
+    env->PopLocalFrame(nullptr);
+    OP_REQUIRES_OK(ctx, s);
+  }
+
+private:
+  // Number of local references, in addition to the ones created for the buffers, that are guaranteed to be available
+  // to each callback invocation.
+  static constexpr jint kCallLocalFrameCapacity = 16;
+
+  // Creates a direct byte buffer over the memory of "tensor". Empty tensors may not have any memory, and so they are
+  // represented by empty buffers over a dummy address, because JNI does not support null addresses.
+  static jobject NewTensorBuffer(JNIEnv* env, const Tensor& tensor) {
+    static char empty_buffer_data;
+    tensorflow::StringPiece data = tensor.tensor_data();
+    if (data.size() == 0) return env->NewDirectByteBuffer(&empty_buffer_data, 0);
+    return env->NewDirectByteBuffer(const_cast<char*>(data.data()), static_cast<jlong>(data.size()));
+  }
+
+  Status Call(JNIEnv* env, OpKernelContext* ctx, const std::vector<Tensor*>& outputs) {
+    if (registry_ == nullptr || call_method_id_ == nullptr)
+      return errors::Unknown("Failed to run JVM callback function. Could not find registry class or its method.");
+    const jsize num_inputs = static_cast<jsize>(ctx->num_inputs());
+    const jsize num_outputs = static_cast<jsize>(outputs.size());
+    static jclass byte_buffer_class = static_cast<jclass>(
+        env->NewGlobalRef(env->FindClass("java/nio/ByteBuffer")));
+    jobjectArray input_buffers = env->NewObjectArray(num_inputs, byte_buffer_class, nullptr);
+    jintArray input_data_types = env->NewIntArray(num_inputs);
+    jintArray input_ranks = env->NewIntArray(num_inputs);
+    jsize num_dims = 0;
+    for (jsize i = 0; i < num_inputs; ++i)
+      num_dims += static_cast<jsize>(ctx->input(i).dims());
+    jlongArray input_shapes = env->NewLongArray(num_dims);
+    if (input_buffers == nullptr || input_data_types == nullptr || input_ranks == nullptr || input_shapes == nullptr)
+      return ExceptionToStatus(env);
+
+    // The primitive arrays are filled in place, so that no native memory is allocated per call.
+    jint* data_types = static_cast<jint*>(env->GetPrimitiveArrayCritical(input_data_types, nullptr));
+    jint* ranks = static_cast<jint*>(env->GetPrimitiveArrayCritical(input_ranks, nullptr));
+    jlong* shapes = static_cast<jlong*>(env->GetPrimitiveArrayCritical(input_shapes, nullptr));
+    jsize dim = 0;
+    for (jsize i = 0; i < num_inputs; ++i) {
+      const Tensor& input = ctx->input(i);
+      data_types[i] = static_cast<jint>(input.dtype());
+      ranks[i] = static_cast<jint>(input.dims());
+      for (int d = 0; d < input.dims(); ++d)
+        shapes[dim++] = static_cast<jlong>(input.dim_size(d));
+    }
+    env->ReleasePrimitiveArrayCritical(input_shapes, shapes, 0);
+    env->ReleasePrimitiveArrayCritical(input_ranks, ranks, 0);
+    env->ReleasePrimitiveArrayCritical(input_data_types, data_types, 0);
+    for (jsize i = 0; i < num_inputs; ++i) {
+      jobject buffer = NewTensorBuffer(env, ctx->input(i));
+      if (buffer == nullptr) return ExceptionToStatus(env);
+      env->SetObjectArrayElement(input_buffers, i, buffer);
+      env->DeleteLocalRef(buffer);
+    }
+    jobjectArray output_buffers = env->NewObjectArray(num_outputs, byte_buffer_class, nullptr);
+    if (output_buffers == nullptr) return ExceptionToStatus(env);
+    for (jsize i = 0; i < num_outputs; ++i) {
+      jobject buffer = NewTensorBuffer(env, *outputs[i]);
+      if (buffer == nullptr) return ExceptionToStatus(env);
+      env->SetObjectArrayElement(output_buffers, i, buffer);
+      env->DeleteLocalRef(buffer);
+    }
+
+    env->CallStaticVoidMethod(
+        registry_, call_method_id_, id_, input_buffers, input_data_types, input_shapes, input_ranks, output_buffers);
+    return ExceptionToStatus(env);
+  }
+
+  int id_;
+  JavaVM* jvm_;
+  jclass registry_;
+  jmethodID call_method_id_;
+  std::vector<TensorShape> output_shapes_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(JVMBufferCallbackOp);
+};
+
 namespace kernel_factory {
 struct KernelRegistration {
   KernelRegistration(const KernelDef& d, StringPiece c,
@@ -266,6 +853,32 @@ auto jvmCallbackOpInitializer = []{
   if (reg->find(strings::StrCat("JVMCallback:", DeviceTypeString(DEVICE_CPU), ":")) == reg->end()) {
     REGISTER_KERNEL_BUILDER(Name("JVMCallback").Device(DEVICE_CPU), JVMCallbackOp);
     REGISTER_KERNEL_BUILDER(Name("JVMCallbackStateless").Device(DEVICE_CPU), JVMCallbackOp);
+    REGISTER_KERNEL_BUILDER(Name("JVMAsyncCallback").Device(DEVICE_CPU), JVMAsyncCallbackOp);
+    REGISTER_KERNEL_BUILDER(Name("JVMAsyncCallbackStateless").Device(DEVICE_CPU), JVMAsyncCallbackOp);
+    REGISTER_KERNEL_BUILDER(Name("JVMBatchCallback").Device(DEVICE_CPU), JVMBatchCallbackOp);
+    REGISTER_KERNEL_BUILDER(Name("JVMBufferCallback").Device(DEVICE_CPU), JVMBufferCallbackOp);
+    REGISTER_KERNEL_BUILDER(Name("JVMBufferCallbackStateless").Device(DEVICE_CPU), JVMBufferCallbackOp);
+
+    // JVM callbacks always operate on host memory. Registering them for GPUs with host memory inputs and outputs lets
+    // callbacks be placed within GPU subgraphs, where the executor inserts explicit (and overlappable) device-to-host
+    // and host-to-device copies for their inputs and outputs, instead of the placer splitting the subgraphs around them.
+    // These registrations are inert in TensorFlow builds without GPU support.
+    REGISTER_KERNEL_BUILDER(
+        Name("JVMCallback").Device(DEVICE_GPU).HostMemory("input").HostMemory("output"), JVMCallbackOp);
+    REGISTER_KERNEL_BUILDER(
+        Name("JVMCallbackStateless").Device(DEVICE_GPU).HostMemory("input").HostMemory("output"), JVMCallbackOp);
+    REGISTER_KERNEL_BUILDER(
+        Name("JVMAsyncCallback").Device(DEVICE_GPU).HostMemory("input").HostMemory("output"), JVMAsyncCallbackOp);
+    REGISTER_KERNEL_BUILDER(
+        Name("JVMAsyncCallbackStateless").Device(DEVICE_GPU).HostMemory("input").HostMemory("output"),
+        JVMAsyncCallbackOp);
+    REGISTER_KERNEL_BUILDER(
+        Name("JVMBatchCallback").Device(DEVICE_GPU).HostMemory("input").HostMemory("output"), JVMBatchCallbackOp);
+    REGISTER_KERNEL_BUILDER(
+        Name("JVMBufferCallback").Device(DEVICE_GPU).HostMemory("input").HostMemory("output"), JVMBufferCallbackOp);
+    REGISTER_KERNEL_BUILDER(
+        Name("JVMBufferCallbackStateless").Device(DEVICE_GPU).HostMemory("input").HostMemory("output"),
+        JVMBufferCallbackOp);
   }
   return 0;
 }();
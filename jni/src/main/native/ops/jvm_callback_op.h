@@ -36,6 +36,10 @@ struct JVMCall {
   // Passed to the JVM to call the function registered with this ID.
   int id;
 
+  // Number of examples in the inputs of a batched call (in which case the inputs and outputs are flattened over the
+  // examples), or 0 for unbatched calls.
+  int batch_size = 0;
+
   // Inputs and outputs of this function invocation.
   std::vector<tensorflow::Tensor> inputs;
   std::vector<tensorflow::Tensor> outputs;
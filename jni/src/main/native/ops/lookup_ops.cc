@@ -0,0 +1,1041 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "tensorflow/core/framework/lookup_interface.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/resource_mgr.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/hash/hash.h"
+#include "tensorflow/core/lib/io/inputbuffer.h"
+#include "tensorflow/core/lib/strings/numbers.h"
+#include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mem.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/prefetch.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Number of slots per bucket. The tags of a bucket are compared against the tag of a key using a single SIMD
+  // instruction, and four buckets share each cache line.
+  const int kBucketSize = 16;
+
+  // Alignment of the bucket tags, in bytes, which is the size of a cache line.
+  const int kCacheLineSize = 64;
+
+  // Number of keys whose buckets are prefetched together, before probing the table for any of them.
+  const int kLookupBatchSize = 16;
+
+  // Per-key cost estimate of a lookup, in cycles, which is used to shard large batches of keys over threads.
+  const int64 kLookupCost = 100;
+
+  inline uint64 HashKey(int64 key) {
+    // Finalizer of the 64-bit MurmurHash3 hash function.
+    uint64 h = static_cast<uint64>(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  inline uint64 HashKey(const string& key) { return Hash64(key.data(), key.size()); }
+
+  // Returns a bit mask with bit 'i' set if and only if 'tags[i] == tag', for each slot 'i' of a bucket.
+  inline uint32 MatchTags(const uint8* tags, uint8 tag) {
+#ifdef __SSE2__
+    const __m128i bucket_tags = _mm_load_si128(reinterpret_cast<const __m128i*>(tags));
+    return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(bucket_tags, _mm_set1_epi8(static_cast<char>(tag)))));
+#else
+    uint32 mask = 0;
+    for (int i = 0; i < kBucketSize; ++i)
+      if (tags[i] == tag) mask |= 1U << i;
+    return mask;
+#endif
+  }
+
+  // Deleter for memory allocated using 'port::AlignedMalloc'.
+  struct AlignedDeleter {
+    void operator()(void* ptr) const { port::AlignedFree(ptr); }
+  };
+}  // namespace
+
+// Immutable hash table whose lookups are lock-free, meant for tables that are looked up concurrently by many sessions
+// (e.g., vocabulary tables used by serving models).
+//
+// The table uses open addressing over buckets of 16 slots. Each slot has a one-byte tag, which is zero for empty slots
+// and which otherwise contains 7 bits of the hash of the key stored in that slot. The tags of each bucket are stored
+// contiguously and are aligned so that a bucket never spans two cache lines, and a lookup compares the tag of the key
+// against all tags of a bucket at once (using SSE2, when available). A key is stored in the first bucket along its
+// linear probing sequence that has an empty slot, and so a lookup stops at the first bucket that contains either the
+// key, or an empty slot. Lookups are also batched, with the buckets of a batch of keys being prefetched before they
+// are probed.
+//
+// The table is populated once, by importing its keys and values (e.g., using the 'LookupTableImportV2' op), after
+// which it is marked as initialized. Lookups only need to check that flag and, since the table is never modified after
+// that, they need no locking.
+template <class K, class V>
+class LockFreeHashTable : public lookup::LookupInterface {
+ public:
+  typedef K key_type;
+  typedef V value_type;
+
+  LockFreeHashTable() : initialized_(false) {}
+
+  size_t size() const override { return initialized_.load(std::memory_order_acquire) ? size_ : 0; }
+
+  Status Find(OpKernelContext* ctx, const Tensor& keys, Tensor* values, const Tensor& default_value) override {
+    if (!initialized_.load(std::memory_order_acquire))
+      return errors::FailedPrecondition("Table not initialized.");
+    const V default_val = default_value.flat<V>()(0);
+    const auto keys_flat = keys.flat<K>();
+    auto values_flat = values->flat<V>();
+    auto work = [this, &keys_flat, &values_flat, &default_val](int64 start, int64 limit) {
+      uint64 hashes[kLookupBatchSize];
+      for (int64 batch_start = start; batch_start < limit; batch_start += kLookupBatchSize) {
+        const int64 batch_size = std::min(limit - batch_start, static_cast<int64>(kLookupBatchSize));
+        for (int64 i = 0; i < batch_size; ++i) {
+          hashes[i] = HashKey(keys_flat(batch_start + i));
+          const uint64 bucket = hashes[i] & bucket_mask_;
+          port::prefetch<port::PREFETCH_HINT_T0>(tags_.get() + bucket * kBucketSize);
+          port::prefetch<port::PREFETCH_HINT_T0>(&keys_[bucket * kBucketSize]);
+        }
+        for (int64 i = 0; i < batch_size; ++i) {
+          const int64 slot = FindSlot(keys_flat(batch_start + i), hashes[i]);
+          values_flat(batch_start + i) = slot < 0 ? default_val : values_[slot];
+        }
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, keys_flat.size(), kLookupCost, work);
+    return Status::OK();
+  }
+
+  Status Insert(OpKernelContext* ctx, const Tensor& keys, const Tensor& values) override {
+    return errors::Unimplemented("Insert is not supported by the lock-free hash table, which is immutable.");
+  }
+
+  Status ExportValues(OpKernelContext* ctx) override {
+    mutex_lock l(mu_);
+    const int64 size = initialized_.load(std::memory_order_acquire) ? size_ : 0;
+    Tensor* keys;
+    Tensor* values;
+    TF_RETURN_IF_ERROR(ctx->allocate_output("keys", TensorShape({size}), &keys));
+    TF_RETURN_IF_ERROR(ctx->allocate_output("values", TensorShape({size}), &values));
+    auto keys_flat = keys->flat<K>();
+    auto values_flat = values->flat<V>();
+    int64 i = 0;
+    for (int64 slot = 0; i < size; ++slot) {
+      if (tags_.get()[slot] == 0) continue;
+      keys_flat(i) = keys_[slot];
+      values_flat(i) = values_[slot];
+      ++i;
+    }
+    return Status::OK();
+  }
+
+  // Initializes the table with the provided keys and values. The table can only be initialized once.
+  Status ImportValues(OpKernelContext* ctx, const Tensor& keys, const Tensor& values) override {
+    mutex_lock l(mu_);
+    if (initialized_.load(std::memory_order_acquire))
+      return errors::FailedPrecondition("Table already initialized.");
+    const auto keys_flat = keys.flat<K>();
+    const auto values_flat = values.flat<V>();
+    const int64 num_keys = keys_flat.size();
+
+    // Use the smallest power-of-two number of buckets that keeps the load factor at most 3/4.
+    int64 num_buckets = 1;
+    while (num_buckets * kBucketSize * 3 < num_keys * 4) num_buckets *= 2;
+    const int64 num_slots = num_buckets * kBucketSize;
+    bucket_mask_ = static_cast<uint64>(num_buckets - 1);
+    tags_.reset(static_cast<uint8*>(port::AlignedMalloc(num_slots, kCacheLineSize)));
+    if (tags_ == nullptr) return errors::ResourceExhausted("Could not allocate a table with ", num_slots, " slots.");
+    std::memset(tags_.get(), 0, num_slots);
+    keys_.assign(num_slots, K());
+    values_.assign(num_slots, V());
+
+    size_ = 0;
+    for (int64 i = 0; i < num_keys; ++i) {
+      const K& key = keys_flat(i);
+      const uint64 hash = HashKey(key);
+      const int64 existing_slot = FindSlot(key, hash);
+      if (existing_slot >= 0) {
+        if (values_[existing_slot] != values_flat(i))
+          return errors::FailedPrecondition("The lock-free hash table has different values for the same key.");
+        continue;
+      }
+      const uint8 tag = Tag(hash);
+      for (uint64 bucket = hash & bucket_mask_;; bucket = (bucket + 1) & bucket_mask_) {
+        uint8* bucket_tags = tags_.get() + bucket * kBucketSize;
+        const uint32 empty = MatchTags(bucket_tags, 0);
+        if (empty == 0) continue;
+        const int64 slot = bucket * kBucketSize + __builtin_ctz(empty);
+        tags_.get()[slot] = tag;
+        keys_[slot] = key;
+        values_[slot] = values_flat(i);
+        break;
+      }
+      ++size_;
+    }
+    initialized_.store(true, std::memory_order_release);
+    return Status::OK();
+  }
+
+  DataType key_dtype() const override { return DataTypeToEnum<K>::v(); }
+  DataType value_dtype() const override { return DataTypeToEnum<V>::v(); }
+  TensorShape key_shape() const override { return TensorShape(); }
+  TensorShape value_shape() const override { return TensorShape(); }
+
+ private:
+  // Returns the (non-zero) tag of a key with the provided hash.
+  static inline uint8 Tag(uint64 hash) { return static_cast<uint8>(0x80 | (hash >> 57)); }
+
+  // Returns the slot that contains 'key', or -1, if the table does not contain it.
+  inline int64 FindSlot(const K& key, uint64 hash) const {
+    const uint8 tag = Tag(hash);
+    for (uint64 bucket = hash & bucket_mask_;; bucket = (bucket + 1) & bucket_mask_) {
+      const uint8* bucket_tags = tags_.get() + bucket * kBucketSize;
+      for (uint32 matches = MatchTags(bucket_tags, tag); matches != 0; matches &= matches - 1) {
+        const int64 slot = bucket * kBucketSize + __builtin_ctz(matches);
+        if (keys_[slot] == key) return slot;
+      }
+      if (MatchTags(bucket_tags, 0) != 0) return -1;
+    }
+  }
+
+  // Serializes the table initialization and export. Lookups do not use it, because they fail until the table is
+  // initialized and the table is never modified after that.
+  mutex mu_;
+  std::atomic<bool> initialized_;
+  int64 size_ = 0;
+  uint64 bucket_mask_ = 0;
+  std::unique_ptr<uint8, AlignedDeleter> tags_;
+  std::vector<K> keys_;
+  std::vector<V> values_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(LockFreeHashTable);
+};
+
+// Kernel that creates a lookup table resource of type 'Table' and outputs a handle to it.
+template <class Table>
+class LookupTableOp : public OpKernel {
+ public:
+  typedef typename Table::key_type K;
+  typedef typename Table::value_type V;
+
+  explicit LookupTableOp(OpKernelConstruction* ctx) : OpKernel(ctx), table_handle_set_(false) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("use_node_name_sharing", &use_node_name_sharing_));
+  }
+
+  ~LookupTableOp() override {
+    // If the table object was not shared, delete it.
+    if (table_handle_set_ && cinfo_.resource_is_private_to_kernel()) {
+      TF_CHECK_OK(cinfo_.resource_manager()->template Delete<lookup::LookupInterface>(cinfo_.container(),
+                                                                                    cinfo_.name()));
+    }
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    mutex_lock l(mu_);
+    if (!table_handle_set_) {
+      OP_REQUIRES_OK(ctx, cinfo_.Init(ctx->resource_manager(), def(), use_node_name_sharing_));
+      lookup::LookupInterface* table;
+      OP_REQUIRES_OK(ctx, cinfo_.resource_manager()->template LookupOrCreate<lookup::LookupInterface>(
+          cinfo_.container(), cinfo_.name(), &table, [](lookup::LookupInterface** ret) {
+            *ret = new Table();
+            return Status::OK();
+          }));
+      core::ScopedUnref unref(table);
+      OP_REQUIRES(ctx, dynamic_cast<Table*>(table) != nullptr,
+                  errors::InvalidArgument("Conflicting table types for key/value data types ",
+                                          DataTypeString(table->key_dtype()), "->",
+                                          DataTypeString(table->value_dtype()), " and ",
+                                          DataTypeString(DataTypeToEnum<K>::v()), "->",
+                                          DataTypeString(DataTypeToEnum<V>::v()), "."));
+      table_handle_set_ = true;
+    }
+    Tensor* handle;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &handle));
+    handle->scalar<ResourceHandle>()() = MakeResourceHandle<lookup::LookupInterface>(
+        ctx, cinfo_.container(), cinfo_.name());
+  }
+
+ private:
+  mutex mu_;
+  ContainerInfo cinfo_ GUARDED_BY(mu_);
+  bool table_handle_set_ GUARDED_BY(mu_);
+  bool use_node_name_sharing_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(LookupTableOp);
+};
+
+namespace {
+  // Parses 'field' into element 'i' of 'tensor', based on the data type of 'tensor'.
+  Status ParseField(const string& field, int64 i, Tensor* tensor) {
+    bool parsed = true;
+    switch (tensor->dtype()) {
+      case DT_STRING: tensor->flat<string>()(i) = field; break;
+      case DT_INT32: parsed = strings::safe_strto32(field, &tensor->flat<int32>()(i)); break;
+      case DT_INT64: parsed = strings::safe_strto64(field, &tensor->flat<int64>()(i)); break;
+      case DT_FLOAT: parsed = strings::safe_strtof(field.c_str(), &tensor->flat<float>()(i)); break;
+      case DT_DOUBLE: parsed = strings::safe_strtod(field.c_str(), &tensor->flat<double>()(i)); break;
+      default: return errors::InvalidArgument("Data type ", DataTypeString(tensor->dtype()), " is not supported.");
+    }
+    if (!parsed)
+      return errors::InvalidArgument("Field '", field, "' is not a valid ", DataTypeString(tensor->dtype()), ".");
+    return Status::OK();
+  }
+
+  // Extracts the field with index 'index' from a line of a text file, into element 'i' of 'tensor'.
+  Status ExtractField(const string& line, const std::vector<string>& columns, int64 line_number, int64 index,
+                      int64 i, Tensor* tensor) {
+    if (index == -1) {
+      if (tensor->dtype() != DT_INT64)
+        return errors::InvalidArgument("The line number can only be used for INT64 fields, but the data type is ",
+                                       DataTypeString(tensor->dtype()), ".");
+      tensor->flat<int64>()(i) = line_number;
+      return Status::OK();
+    }
+    if (index == -2) return ParseField(line, i, tensor);
+    if (index >= columns.size())
+      return errors::InvalidArgument("Invalid line ", line_number, ", which has ", columns.size(),
+                                     " columns, while column ", index, " was requested.");
+    return ParseField(columns[index], i, tensor);
+  }
+
+  // Attributes of the ops that extract keys and values from the lines of text files.
+  struct TextFileAttributes {
+    int64 key_index;
+    int64 value_index;
+    int64 vocab_size;
+    string delimiter;
+
+    Status Init(OpKernelConstruction* ctx) {
+      TF_RETURN_IF_ERROR(ctx->GetAttr("key_index", &key_index));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("value_index", &value_index));
+      TF_RETURN_IF_ERROR(ctx->GetAttr("vocab_size", &vocab_size));
+      return ctx->GetAttr("delimiter", &delimiter);
+    }
+
+    // Reads the keys and values contained in the text file 'path' into newly allocated tensors.
+    Status Read(OpKernelContext* ctx, const string& path, DataType key_dtype, DataType value_dtype, Tensor* keys,
+                Tensor* values) const {
+      std::unique_ptr<RandomAccessFile> file;
+      TF_RETURN_IF_ERROR(ctx->env()->NewRandomAccessFile(path, &file));
+      io::InputBuffer input_buffer(file.get(), 1 << 20);
+      std::vector<string> lines;
+      string line;
+      while (vocab_size < 0 || lines.size() < vocab_size) {
+        const Status status = input_buffer.ReadLine(&line);
+        if (errors::IsOutOfRange(status)) break;
+        TF_RETURN_IF_ERROR(status);
+        lines.push_back(line);
+      }
+      if (vocab_size >= 0 && lines.size() != vocab_size)
+        return errors::InvalidArgument("Invalid vocabulary size in '", path, "': expected ", vocab_size,
+                                       " lines, but the file only has ", lines.size(), " lines.");
+      const int64 num_lines = lines.size();
+      TF_RETURN_IF_ERROR(ctx->allocate_temp(key_dtype, TensorShape({num_lines}), keys));
+      TF_RETURN_IF_ERROR(ctx->allocate_temp(value_dtype, TensorShape({num_lines}), values));
+      const bool split = key_index >= 0 || value_index >= 0;
+      std::vector<string> columns;
+      for (int64 i = 0; i < num_lines; ++i) {
+        if (split) columns = str_util::Split(lines[i], delimiter);
+        TF_RETURN_IF_ERROR(ExtractField(lines[i], columns, i, key_index, i, keys));
+        TF_RETURN_IF_ERROR(ExtractField(lines[i], columns, i, value_index, i, values));
+      }
+      return Status::OK();
+    }
+  };
+
+  Status GetScalarString(OpKernelContext* ctx, const string& name, string* value) {
+    const Tensor* tensor;
+    TF_RETURN_IF_ERROR(ctx->input(name, &tensor));
+    if (!TensorShapeUtils::IsScalar(tensor->shape()))
+      return errors::InvalidArgument("'", name, "' must be a scalar, but has shape ", tensor->shape().DebugString(),
+                                     ".");
+    *value = tensor->scalar<string>()();
+    return Status::OK();
+  }
+}  // namespace
+
+// Kernel that reads keys and values from a text file and imports them into a lookup table. Unlike the
+// 'InitializeTableFromTextFileV2' op, which only supports the lookup tables of the TensorFlow kernels library, this op
+// supports any lookup table that implements 'ImportValues'.
+class LookupTableImportFromTextFileOp : public OpKernel {
+ public:
+  explicit LookupTableImportFromTextFileOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, attributes_.Init(ctx));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    lookup::LookupInterface* table;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &table));
+    core::ScopedUnref unref(table);
+    string filename;
+    OP_REQUIRES_OK(ctx, GetScalarString(ctx, "filename", &filename));
+    Tensor keys;
+    Tensor values;
+    OP_REQUIRES_OK(ctx, attributes_.Read(ctx, filename, table->key_dtype(), table->value_dtype(), &keys, &values));
+    OP_REQUIRES_OK(ctx, table->CheckKeyAndValueTensorsForImport(keys, values));
+    OP_REQUIRES_OK(ctx, table->ImportValues(ctx, keys, values));
+  }
+
+ private:
+  TextFileAttributes attributes_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(LookupTableImportFromTextFileOp);
+};
+
+namespace {
+  // Header of the memory-mapped hash table files. The header is followed by the following sections, each of which
+  // starts at an offset that is a multiple of 64 bytes:
+  //   - displacements: 'uint32' displacement of each bucket of the perfect hash function.
+  //   - occupied:      'uint64' bit mask words marking the occupied slots.
+  //   - values:        'int64' value of each slot.
+  //   - keys:          'int64' key of each slot, for integer keys, or the 'uint64' offset of the key of each slot in
+  //                    the key data section, followed by the size of that section, for string keys.
+  //   - key data:      Concatenated string keys (only for string keys).
+  // All integers are stored in little-endian byte order.
+  struct MappedHashTableHeader {
+    char magic[8];
+    uint32 version;
+    uint32 key_dtype;
+    uint64 num_keys;
+    uint64 num_slots;
+    uint64 num_buckets;
+    uint64 seed;
+    uint64 key_data_size;
+    uint64 reserved;
+  };
+
+  static_assert(sizeof(MappedHashTableHeader) == kCacheLineSize, "Invalid mapped hash table header size.");
+
+  const char kMappedHashTableMagic[8] = {'T', 'F', 'M', 'H', 'T', 'A', 'B', 'L'};
+  const uint32 kMappedHashTableVersion = 1;
+
+  // Maximum number of displacements tried for each bucket, and maximum number of hash seeds tried, when building the
+  // perfect hash function of a table.
+  const uint32 kMaxDisplacements = 1 << 20;
+  const uint64 kMaxSeeds = 16;
+
+  inline uint64 AlignToCacheLine(uint64 size) { return (size + kCacheLineSize - 1) / kCacheLineSize * kCacheLineSize; }
+
+  // Offsets of the sections of a mapped hash table file.
+  struct MappedHashTableLayout {
+    uint64 displacements;
+    uint64 occupied;
+    uint64 values;
+    uint64 keys;
+    uint64 key_data;
+    uint64 file_size;
+
+    MappedHashTableLayout(const MappedHashTableHeader& header, bool string_keys) {
+      displacements = sizeof(MappedHashTableHeader);
+      occupied = displacements + AlignToCacheLine(sizeof(uint32) * header.num_buckets);
+      values = occupied + AlignToCacheLine(sizeof(uint64) * ((header.num_slots + 63) / 64));
+      keys = values + AlignToCacheLine(sizeof(int64) * header.num_slots);
+      key_data = keys + AlignToCacheLine(sizeof(uint64) * (header.num_slots + (string_keys ? 1 : 0)));
+      file_size = key_data + (string_keys ? AlignToCacheLine(header.key_data_size) : 0);
+    }
+  };
+
+  inline uint64 MappedKeyHash(int64 key, uint64 seed) {
+    return Hash64(reinterpret_cast<const char*>(&key), sizeof(int64), seed);
+  }
+
+  inline uint64 MappedKeyHash(const string& key, uint64 seed) { return Hash64(key.data(), key.size(), seed); }
+
+  // The perfect hash function assigns each key to a bucket using the upper 32 bits of its hash, and then to a slot
+  // using its whole hash along with the displacement of its bucket (i.e., the "hash and displace" scheme).
+  inline uint64 MappedBucket(uint64 hash, uint64 num_buckets) { return (hash >> 32) % num_buckets; }
+
+  inline uint64 MappedSlot(uint64 hash, uint32 displacement, uint64 num_slots) {
+    return HashKey(static_cast<int64>(hash + displacement * 0x9e3779b97f4a7c15ULL)) % num_slots;
+  }
+
+  // Appends 'data' to 'file', followed by zeros up to the next multiple of 64 bytes.
+  Status AppendAligned(WritableFile* file, StringPiece data) {
+    static const char kZeros[kCacheLineSize] = {};
+    TF_RETURN_IF_ERROR(file->Append(data));
+    const uint64 padding = AlignToCacheLine(data.size()) - data.size();
+    return file->Append(StringPiece(kZeros, padding));
+  }
+
+  template <class T>
+  Status AppendAligned(WritableFile* file, const std::vector<T>& data) {
+    return AppendAligned(file, StringPiece(reinterpret_cast<const char*>(data.data()), sizeof(T) * data.size()));
+  }
+
+  // Accessors for the keys section of mapped hash tables, which depends on the key data type.
+  template <class K>
+  struct MappedKeys;
+
+  template <>
+  struct MappedKeys<int64> {
+    static const bool kStringKeys = false;
+    const int64* keys = nullptr;
+
+    Status Init(const char* data, const MappedHashTableHeader& header, const MappedHashTableLayout& layout) {
+      keys = reinterpret_cast<const int64*>(data + layout.keys);
+      return Status::OK();
+    }
+
+    inline const void* address(uint64 slot) const { return keys + slot; }
+    inline bool equals(uint64 slot, int64 key) const { return keys[slot] == key; }
+    inline int64 get(uint64 slot) const { return keys[slot]; }
+
+    static uint64 DataSize(const std::vector<int64>& keys) { return 0; }
+
+    static Status Write(WritableFile* file, const std::vector<int64>& keys, const std::vector<int64>& slot_keys) {
+      std::vector<int64> slot_key_values(slot_keys.size(), 0);
+      for (size_t slot = 0; slot < slot_keys.size(); ++slot)
+        if (slot_keys[slot] >= 0) slot_key_values[slot] = keys[slot_keys[slot]];
+      return AppendAligned(file, slot_key_values);
+    }
+  };
+
+  template <>
+  struct MappedKeys<string> {
+    static const bool kStringKeys = true;
+    const uint64* offsets = nullptr;
+    const char* key_data = nullptr;
+    uint64 key_data_size = 0;
+
+    Status Init(const char* data, const MappedHashTableHeader& header, const MappedHashTableLayout& layout) {
+      offsets = reinterpret_cast<const uint64*>(data + layout.keys);
+      key_data = data + layout.key_data;
+      key_data_size = header.key_data_size;
+      if (offsets[header.num_slots] != key_data_size)
+        return errors::DataLoss("Corrupted mapped hash table key offsets.");
+      return Status::OK();
+    }
+
+    inline const void* address(uint64 slot) const { return offsets + slot; }
+
+    inline bool equals(uint64 slot, const string& key) const {
+      const uint64 begin = offsets[slot];
+      const uint64 end = offsets[slot + 1];
+      return begin <= end && end <= key_data_size && end - begin == key.size() &&
+             std::memcmp(key_data + begin, key.data(), key.size()) == 0;
+    }
+
+    inline string get(uint64 slot) const { return string(key_data + offsets[slot], offsets[slot + 1] - offsets[slot]); }
+
+    static uint64 DataSize(const std::vector<string>& keys) {
+      uint64 size = 0;
+      for (const string& key : keys) size += key.size();
+      return size;
+    }
+
+    static Status Write(WritableFile* file, const std::vector<string>& keys, const std::vector<int64>& slot_keys) {
+      std::vector<uint64> slot_offsets(slot_keys.size() + 1, 0);
+      string data;
+      data.reserve(DataSize(keys));
+      for (size_t slot = 0; slot < slot_keys.size(); ++slot) {
+        if (slot_keys[slot] >= 0) data.append(keys[slot_keys[slot]]);
+        slot_offsets[slot + 1] = data.size();
+      }
+      TF_RETURN_IF_ERROR(AppendAligned(file, slot_offsets));
+      return AppendAligned(file, data);
+    }
+  };
+
+  // Builds a mapped hash table containing the provided keys and values and writes it to 'filename'. The table file is
+  // first written to a temporary file, which is then renamed, so that readers never observe partially written tables.
+  template <class K>
+  Status WriteMappedHashTable(Env* env, const string& filename, const Tensor& keys_tensor,
+                              const Tensor& values_tensor) {
+    if (!port::kLittleEndian) return errors::Unimplemented("Mapped hash tables require a little-endian platform.");
+
+    // Remove duplicate keys.
+    const auto keys_flat = keys_tensor.flat<K>();
+    const auto values_flat = values_tensor.flat<int64>();
+    std::vector<K> keys;
+    std::vector<int64> values;
+    std::unordered_map<K, uint64> indices;
+    indices.reserve(keys_flat.size());
+    for (int64 i = 0; i < keys_flat.size(); ++i) {
+      const auto inserted = indices.emplace(keys_flat(i), keys.size());
+      if (inserted.second) {
+        keys.push_back(keys_flat(i));
+        values.push_back(values_flat(i));
+      } else if (values[inserted.first->second] != values_flat(i)) {
+        return errors::FailedPrecondition("The mapped hash table has different values for the same key.");
+      }
+    }
+    indices.clear();
+
+    MappedHashTableHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kMappedHashTableMagic, sizeof(kMappedHashTableMagic));
+    header.version = kMappedHashTableVersion;
+    header.key_dtype = static_cast<uint32>(DataTypeToEnum<K>::v());
+    header.num_keys = keys.size();
+    header.num_slots = std::max(header.num_keys + header.num_keys / 8, uint64{1});
+    header.num_buckets = std::max((header.num_keys + 3) / 4, uint64{1});
+
+    // Build the perfect hash function, by placing the keys of the largest buckets first and searching for a
+    // displacement for each bucket that places all of its keys in empty slots.
+    std::vector<uint32> displacements(header.num_buckets);
+    std::vector<int64> slot_keys(header.num_slots);
+    std::vector<uint64> hashes(header.num_keys);
+    std::vector<uint64> bucket_starts(header.num_buckets + 1);
+    std::vector<uint64> bucket_keys(header.num_keys);
+    std::vector<uint64> buckets(header.num_buckets);
+    std::vector<uint64> bucket_slots;
+    bool built = false;
+    for (uint64 seed = 0; seed < kMaxSeeds && !built; ++seed) {
+      header.seed = seed;
+      std::fill(bucket_starts.begin(), bucket_starts.end(), 0);
+      for (uint64 k = 0; k < header.num_keys; ++k) {
+        hashes[k] = MappedKeyHash(keys[k], seed);
+        ++bucket_starts[MappedBucket(hashes[k], header.num_buckets) + 1];
+      }
+      for (uint64 b = 0; b < header.num_buckets; ++b) bucket_starts[b + 1] += bucket_starts[b];
+      std::vector<uint64> positions(bucket_starts.begin(), bucket_starts.end() - 1);
+      for (uint64 k = 0; k < header.num_keys; ++k)
+        bucket_keys[positions[MappedBucket(hashes[k], header.num_buckets)]++] = k;
+      for (uint64 b = 0; b < header.num_buckets; ++b) buckets[b] = b;
+      std::stable_sort(buckets.begin(), buckets.end(), [&bucket_starts](uint64 b1, uint64 b2) {
+        return bucket_starts[b1 + 1] - bucket_starts[b1] > bucket_starts[b2 + 1] - bucket_starts[b2];
+      });
+      std::fill(slot_keys.begin(), slot_keys.end(), -1);
+      built = true;
+      for (const uint64 b : buckets) {
+        if (bucket_starts[b + 1] == bucket_starts[b]) break;
+        bool placed = false;
+        for (uint32 d = 0; d < kMaxDisplacements && !placed; ++d) {
+          bucket_slots.clear();
+          placed = true;
+          for (uint64 i = bucket_starts[b]; i < bucket_starts[b + 1] && placed; ++i) {
+            const uint64 slot = MappedSlot(hashes[bucket_keys[i]], d, header.num_slots);
+            placed = slot_keys[slot] < 0 &&
+                     std::find(bucket_slots.begin(), bucket_slots.end(), slot) == bucket_slots.end();
+            bucket_slots.push_back(slot);
+          }
+          if (placed) {
+            for (uint64 i = bucket_starts[b]; i < bucket_starts[b + 1]; ++i)
+              slot_keys[bucket_slots[i - bucket_starts[b]]] = bucket_keys[i];
+            displacements[b] = d;
+          }
+        }
+        if (!placed) {
+          built = false;
+          break;
+        }
+      }
+    }
+    if (!built)
+      return errors::Internal("Could not build a perfect hash function for a table with ", header.num_keys,
+                              " keys.");
+
+    // Lay out the slots.
+    std::vector<uint64> occupied((header.num_slots + 63) / 64, 0);
+    std::vector<int64> slot_values(header.num_slots, 0);
+    for (uint64 slot = 0; slot < header.num_slots; ++slot) {
+      if (slot_keys[slot] < 0) continue;
+      occupied[slot / 64] |= uint64{1} << (slot % 64);
+      slot_values[slot] = values[slot_keys[slot]];
+    }
+
+    // Write the table file.
+    header.key_data_size = MappedKeys<K>::DataSize(keys);
+    const string temporary_filename = strings::StrCat(filename, ".tmp");
+    std::unique_ptr<WritableFile> file;
+    TF_RETURN_IF_ERROR(env->NewWritableFile(temporary_filename, &file));
+    TF_RETURN_IF_ERROR(file->Append(StringPiece(reinterpret_cast<const char*>(&header), sizeof(header))));
+    TF_RETURN_IF_ERROR(AppendAligned(file.get(), displacements));
+    TF_RETURN_IF_ERROR(AppendAligned(file.get(), occupied));
+    TF_RETURN_IF_ERROR(AppendAligned(file.get(), slot_values));
+    TF_RETURN_IF_ERROR(MappedKeys<K>::Write(file.get(), keys, slot_keys));
+    TF_RETURN_IF_ERROR(file->Close());
+    return env->RenameFile(temporary_filename, filename);
+  }
+}  // namespace
+
+// Base class of the mapped hash tables, which is used to load tables without knowing their key type.
+class MappedHashTableBase : public lookup::LookupInterface {
+ public:
+  // Maps the table file 'filename' into memory. The table can only be initialized once.
+  virtual Status Load(Env* env, const string& filename) = 0;
+};
+
+// Immutable hash table from keys to 'int64' values, which is memory-mapped from a file built using the
+// 'BuildMappedHashTable' op, rather than being constructed in memory.
+//
+// The table uses a perfect hash function and so each lookup reads exactly one bucket displacement and one slot, with
+// the displacements and slots of a batch of keys being prefetched in two stages. Since the file is mapped read-only,
+// loading a table only has the cost of validating its header, and the pages of the table are loaded lazily and are
+// shared by all processes that map the same file (e.g., multiple serving processes using the same vocabulary).
+template <class K>
+class MappedHashTable : public MappedHashTableBase {
+ public:
+  typedef K key_type;
+  typedef int64 value_type;
+
+  MappedHashTable() : initialized_(false) {}
+
+  size_t size() const override { return initialized_.load(std::memory_order_acquire) ? header_.num_keys : 0; }
+
+  Status Find(OpKernelContext* ctx, const Tensor& keys, Tensor* values, const Tensor& default_value) override {
+    if (!initialized_.load(std::memory_order_acquire))
+      return errors::FailedPrecondition("Table not initialized.");
+    const int64 default_val = default_value.flat<int64>()(0);
+    const auto keys_flat = keys.flat<K>();
+    auto values_flat = values->flat<int64>();
+    auto work = [this, &keys_flat, &values_flat, &default_val](int64 start, int64 limit) {
+      uint64 buckets[kLookupBatchSize];
+      uint64 hashes[kLookupBatchSize];
+      uint64 slots[kLookupBatchSize];
+      for (int64 batch_start = start; batch_start < limit; batch_start += kLookupBatchSize) {
+        const int64 batch_size = std::min(limit - batch_start, static_cast<int64>(kLookupBatchSize));
+        for (int64 i = 0; i < batch_size; ++i) {
+          hashes[i] = MappedKeyHash(keys_flat(batch_start + i), header_.seed);
+          buckets[i] = MappedBucket(hashes[i], header_.num_buckets);
+          port::prefetch<port::PREFETCH_HINT_T0>(displacements_ + buckets[i]);
+        }
+        for (int64 i = 0; i < batch_size; ++i) {
+          slots[i] = MappedSlot(hashes[i], displacements_[buckets[i]], header_.num_slots);
+          port::prefetch<port::PREFETCH_HINT_T0>(occupied_ + slots[i] / 64);
+          port::prefetch<port::PREFETCH_HINT_T0>(values_ + slots[i]);
+          port::prefetch<port::PREFETCH_HINT_T0>(keys_.address(slots[i]));
+        }
+        for (int64 i = 0; i < batch_size; ++i) {
+          const uint64 slot = slots[i];
+          const bool found = Occupied(slot) && keys_.equals(slot, keys_flat(batch_start + i));
+          values_flat(batch_start + i) = found ? values_[slot] : default_val;
+        }
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, keys_flat.size(), kLookupCost, work);
+    return Status::OK();
+  }
+
+  Status Insert(OpKernelContext* ctx, const Tensor& keys, const Tensor& values) override {
+    return errors::Unimplemented("Insert is not supported by the mapped hash table, which is immutable.");
+  }
+
+  Status ExportValues(OpKernelContext* ctx) override {
+    mutex_lock l(mu_);
+    const int64 size = initialized_.load(std::memory_order_acquire) ? header_.num_keys : 0;
+    Tensor* keys;
+    Tensor* values;
+    TF_RETURN_IF_ERROR(ctx->allocate_output("keys", TensorShape({size}), &keys));
+    TF_RETURN_IF_ERROR(ctx->allocate_output("values", TensorShape({size}), &values));
+    auto keys_flat = keys->flat<K>();
+    auto values_flat = values->flat<int64>();
+    int64 i = 0;
+    for (uint64 slot = 0; i < size && slot < header_.num_slots; ++slot) {
+      if (!Occupied(slot)) continue;
+      keys_flat(i) = keys_.get(slot);
+      values_flat(i) = values_[slot];
+      ++i;
+    }
+    if (i < size) return errors::DataLoss("Corrupted mapped hash table occupancy bit mask.");
+    return Status::OK();
+  }
+
+  Status ImportValues(OpKernelContext* ctx, const Tensor& keys, const Tensor& values) override {
+    return errors::Unimplemented(
+        "Import is not supported by the mapped hash table. Mapped hash tables are built using the "
+        "'BuildMappedHashTable' op and initialized using the 'InitializeMappedHashTable' op.");
+  }
+
+  Status Load(Env* env, const string& filename) override {
+    mutex_lock l(mu_);
+    if (initialized_.load(std::memory_order_acquire))
+      return errors::FailedPrecondition("Table already initialized.");
+    if (!port::kLittleEndian) return errors::Unimplemented("Mapped hash tables require a little-endian platform.");
+    std::unique_ptr<ReadOnlyMemoryRegion> region;
+    TF_RETURN_IF_ERROR(env->NewReadOnlyMemoryRegionFromFile(filename, &region));
+    if (region->length() < sizeof(MappedHashTableHeader))
+      return errors::DataLoss("File '", filename, "' is too small to be a mapped hash table.");
+    const char* data = static_cast<const char*>(region->data());
+    MappedHashTableHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kMappedHashTableMagic, sizeof(kMappedHashTableMagic)) != 0)
+      return errors::DataLoss("File '", filename, "' is not a mapped hash table.");
+    if (header.version != kMappedHashTableVersion)
+      return errors::DataLoss("Unsupported mapped hash table version ", header.version, " in file '", filename, "'.");
+    if (header.key_dtype != static_cast<uint32>(key_dtype()))
+      return errors::InvalidArgument(
+          "The mapped hash table in file '", filename, "' has keys of type ",
+          DataTypeString(static_cast<DataType>(header.key_dtype)), ", but the table expects keys of type ",
+          DataTypeString(key_dtype()), ".");
+    if (header.num_slots == 0 || header.num_buckets == 0 || header.num_keys > header.num_slots)
+      return errors::DataLoss("Corrupted mapped hash table header in file '", filename, "'.");
+    const MappedHashTableLayout layout(header, MappedKeys<K>::kStringKeys);
+    if (region->length() < layout.file_size)
+      return errors::DataLoss("The mapped hash table in file '", filename, "' is truncated.");
+    TF_RETURN_IF_ERROR(keys_.Init(data, header, layout));
+    header_ = header;
+    displacements_ = reinterpret_cast<const uint32*>(data + layout.displacements);
+    occupied_ = reinterpret_cast<const uint64*>(data + layout.occupied);
+    values_ = reinterpret_cast<const int64*>(data + layout.values);
+    region_ = std::move(region);
+    initialized_.store(true, std::memory_order_release);
+    return Status::OK();
+  }
+
+  DataType key_dtype() const override { return DataTypeToEnum<K>::v(); }
+  DataType value_dtype() const override { return DT_INT64; }
+  TensorShape key_shape() const override { return TensorShape(); }
+  TensorShape value_shape() const override { return TensorShape(); }
+
+ private:
+  inline bool Occupied(uint64 slot) const { return (occupied_[slot / 64] >> (slot % 64)) & 1; }
+
+  // Serializes the table initialization and export. Lookups do not use it, because they fail until the table is
+  // initialized and the table is never modified after that.
+  mutex mu_;
+  std::atomic<bool> initialized_;
+  std::unique_ptr<ReadOnlyMemoryRegion> region_;
+  MappedHashTableHeader header_;
+  const uint32* displacements_ = nullptr;
+  const uint64* occupied_ = nullptr;
+  const int64* values_ = nullptr;
+  MappedKeys<K> keys_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(MappedHashTable);
+};
+
+// Kernel that maps a table file into a mapped hash table.
+class InitializeMappedHashTableOp : public OpKernel {
+ public:
+  explicit InitializeMappedHashTableOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    lookup::LookupInterface* table;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &table));
+    core::ScopedUnref unref(table);
+    MappedHashTableBase* mapped_table = dynamic_cast<MappedHashTableBase*>(table);
+    OP_REQUIRES(ctx, mapped_table != nullptr,
+                errors::InvalidArgument("The provided table is not a mapped hash table."));
+    string filename;
+    OP_REQUIRES_OK(ctx, GetScalarString(ctx, "filename", &filename));
+    OP_REQUIRES_OK(ctx, mapped_table->Load(ctx->env(), filename));
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(InitializeMappedHashTableOp);
+};
+
+// Kernel that reads keys and values from a text file and writes a mapped hash table file containing them.
+class BuildMappedHashTableOp : public OpKernel {
+ public:
+  explicit BuildMappedHashTableOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, attributes_.Init(ctx));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("key_dtype", &key_dtype_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    string filename;
+    string output_filename;
+    OP_REQUIRES_OK(ctx, GetScalarString(ctx, "filename", &filename));
+    OP_REQUIRES_OK(ctx, GetScalarString(ctx, "output_filename", &output_filename));
+    Tensor keys;
+    Tensor values;
+    OP_REQUIRES_OK(ctx, attributes_.Read(ctx, filename, key_dtype_, DT_INT64, &keys, &values));
+    if (key_dtype_ == DT_STRING)
+      OP_REQUIRES_OK(ctx, WriteMappedHashTable<string>(ctx->env(), output_filename, keys, values));
+    else
+      OP_REQUIRES_OK(ctx, WriteMappedHashTable<int64>(ctx->env(), output_filename, keys, values));
+  }
+
+ private:
+  TextFileAttributes attributes_;
+  DataType key_dtype_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(BuildMappedHashTableOp);
+};
+
+REGISTER_OP("LockFreeHashTable")
+    .Output("table_handle: resource")
+    .Attr("container: string = ''")
+    .Attr("shared_name: string = ''")
+    .Attr("use_node_name_sharing: bool = false")
+    .Attr("key_dtype: type")
+    .Attr("value_dtype: type")
+    .SetIsStateful()
+    .SetShapeFn(shape_inference::ScalarShape)
+    .Doc(R"doc(
+Creates an immutable hash table with lock-free lookups.
+
+The table must be initialized by importing its keys and values into it (e.g., using the 'LookupTableImportV2' or the
+'LookupTableImportFromTextFile' ops). After initialization, the table can be looked up concurrently, without any
+locking, using the 'LookupTableFindV2' op.
+
+table_handle: Handle to a table.
+container: If non-empty, this table is placed in the given container. Otherwise, a default container is used.
+shared_name: If non-empty, this table is shared under the given name across multiple sessions.
+use_node_name_sharing: If true and shared_name is empty, the table is shared using the node name.
+key_dtype: Type of the table keys.
+value_dtype: Type of the table values.
+)doc");
+
+REGISTER_OP("LookupTableImportFromTextFile")
+    .Input("table_handle: resource")
+    .Input("filename: string")
+    .Attr("key_index: int >= -2")
+    .Attr("value_index: int >= -2")
+    .Attr("vocab_size: int >= -1 = -1")
+    .Attr("delimiter: string = '\t'")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle handle;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 0, &handle));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 0, &handle));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Imports the keys and values of a text file into a table.
+
+It extracts a key and a value from each line of the file, in the same way as 'InitializeTableFromTextFileV2'. The
+extracted field is the line number (starting at zero) for an index of -1, the whole line for an index of -2, and the
+corresponding column of the line, split by 'delimiter', for a non-negative index.
+
+table_handle: Handle to a table which will be initialized.
+filename: Filename of a vocabulary text file.
+key_index: Column index in a line to get the table 'key' values from.
+value_index: Column index that represents information of a line to get the table 'value' values from.
+vocab_size: Number of elements of the file, use -1 if unknown.
+delimiter: Delimiter to separate fields in a line.
+)doc");
+
+REGISTER_OP("MappedHashTable")
+    .Output("table_handle: resource")
+    .Attr("container: string = ''")
+    .Attr("shared_name: string = ''")
+    .Attr("use_node_name_sharing: bool = false")
+    .Attr("key_dtype: {int64, string}")
+    .SetIsStateful()
+    .SetShapeFn(shape_inference::ScalarShape)
+    .Doc(R"doc(
+Creates an immutable hash table from keys to 'int64' values, which is memory-mapped from a file.
+
+The table must be initialized using the 'InitializeMappedHashTable' op, with a file built using the
+'BuildMappedHashTable' op. After initialization, the table can be looked up concurrently, without any locking, using
+the 'LookupTableFindV2' op.
+
+table_handle: Handle to a table.
+container: If non-empty, this table is placed in the given container. Otherwise, a default container is used.
+shared_name: If non-empty, this table is shared under the given name across multiple sessions.
+use_node_name_sharing: If true and shared_name is empty, the table is shared using the node name.
+key_dtype: Type of the table keys.
+)doc");
+
+REGISTER_OP("InitializeMappedHashTable")
+    .Input("table_handle: resource")
+    .Input("filename: string")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle handle;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 0, &handle));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 0, &handle));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Initializes a mapped hash table by memory-mapping a table file into it.
+
+table_handle: Handle to a mapped hash table which will be initialized.
+filename: Filename of a table file built using the 'BuildMappedHashTable' op.
+)doc");
+
+REGISTER_OP("BuildMappedHashTable")
+    .Input("filename: string")
+    .Input("output_filename: string")
+    .Attr("key_index: int >= -2")
+    .Attr("value_index: int >= -2 = -1")
+    .Attr("vocab_size: int >= -1 = -1")
+    .Attr("delimiter: string = '\t'")
+    .Attr("key_dtype: {int64, string}")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle handle;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 0, &handle));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 0, &handle));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Builds a mapped hash table file from the keys and values of a text file.
+
+It extracts a key and an 'int64' value from each line of the file, in the same way as 'LookupTableImportFromTextFile',
+computes a perfect hash function for the keys, and writes a table file that can be memory-mapped using the
+'InitializeMappedHashTable' op. The file is written to a temporary file first, which is then renamed to
+'output_filename'.
+
+filename: Filename of a vocabulary text file.
+output_filename: Filename of the table file to write.
+key_index: Column index in a line to get the table 'key' values from.
+value_index: Column index that represents information of a line to get the table 'value' values from.
+vocab_size: Number of elements of the file, use -1 if unknown.
+delimiter: Delimiter to separate fields in a line.
+key_dtype: Type of the table keys.
+)doc");
+
+#define REGISTER_KERNEL(K, V)                                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("LockFreeHashTable").Device(DEVICE_CPU).TypeConstraint<K>("key_dtype")                    \
+          .TypeConstraint<V>("value_dtype"),                                                          \
+      LookupTableOp<LockFreeHashTable<K, V>>);
+
+REGISTER_KERNEL(int64, int32);
+REGISTER_KERNEL(int64, int64);
+REGISTER_KERNEL(int64, float);
+REGISTER_KERNEL(int64, double);
+REGISTER_KERNEL(int64, string);
+REGISTER_KERNEL(string, int32);
+REGISTER_KERNEL(string, int64);
+REGISTER_KERNEL(string, float);
+REGISTER_KERNEL(string, double);
+REGISTER_KERNEL(string, string);
+#undef REGISTER_KERNEL
+
+REGISTER_KERNEL_BUILDER(Name("LookupTableImportFromTextFile").Device(DEVICE_CPU), LookupTableImportFromTextFileOp);
+
+REGISTER_KERNEL_BUILDER(Name("MappedHashTable").Device(DEVICE_CPU).TypeConstraint<int64>("key_dtype"),
+                        LookupTableOp<MappedHashTable<int64>>);
+REGISTER_KERNEL_BUILDER(Name("MappedHashTable").Device(DEVICE_CPU).TypeConstraint<string>("key_dtype"),
+                        LookupTableOp<MappedHashTable<string>>);
+REGISTER_KERNEL_BUILDER(Name("InitializeMappedHashTable").Device(DEVICE_CPU), InitializeMappedHashTableOp);
+REGISTER_KERNEL_BUILDER(Name("BuildMappedHashTable").Device(DEVICE_CPU), BuildMappedHashTableOp);
+}  // namespace tensorflow
@@ -0,0 +1,452 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#if GOOGLE_CUDA
+#define EIGEN_USE_GPU
+#endif  // GOOGLE_CUDA
+
+#include "lstm_ops.h"
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/register_types.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+
+#if GOOGLE_CUDA
+#include "tensorflow/core/platform/stream_executor.h"
+#endif  // GOOGLE_CUDA
+
+namespace tensorflow {
+namespace {
+  using shape_inference::DimensionHandle;
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Shape function for `FusedLSTMBlockCell`, whose outputs are all shaped `[batch_size, cell_size]`.
+  Status FusedLSTMBlockCellShapeFn(InferenceContext* c) {
+    ShapeHandle x, cs_prev;
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &x));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &cs_prev));
+    DimensionHandle batch_size = c->Dim(x, 0);
+    DimensionHandle cell_size = c->Dim(cs_prev, 1);
+    ShapeHandle output = c->Matrix(batch_size, cell_size);
+    for (int i = 0; i < c->num_outputs(); ++i) c->set_output(i, output);
+    return Status::OK();
+  }
+
+  // Shape function for `FusedLSTMBlockCellGrad`, whose outputs are shaped as the corresponding forward step inputs.
+  Status FusedLSTMBlockCellGradShapeFn(InferenceContext* c) {
+    ShapeHandle x, cs_prev, h_prev, w, wci, wcf, wco, b;
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &x));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &cs_prev));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 2, &h_prev));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(3), 2, &w));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(4), 1, &wci));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(5), 1, &wcf));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(6), 1, &wco));
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(7), 1, &b));
+    c->set_output(0, x);
+    c->set_output(1, cs_prev);
+    c->set_output(2, h_prev);
+    c->set_output(3, w);
+    c->set_output(4, wci);
+    c->set_output(5, wcf);
+    c->set_output(6, wco);
+    c->set_output(7, b);
+    return Status::OK();
+  }
+}  // namespace
+
+REGISTER_OP("FusedLSTMBlockCell")
+    .Input("x: T")
+    .Input("cs_prev: T")
+    .Input("h_prev: T")
+    .Input("w: T")
+    .Input("wci: T")
+    .Input("wcf: T")
+    .Input("wco: T")
+    .Input("b: T")
+    .Output("i: T")
+    .Output("cs: T")
+    .Output("f: T")
+    .Output("o: T")
+    .Output("ci: T")
+    .Output("co: T")
+    .Output("h: T")
+    .Attr("forget_bias: float = 1.0")
+    .Attr("cell_clip: float = -1.0")
+    .Attr("use_peephole: bool = false")
+    .Attr("T: {float, double}")
+    .SetShapeFn(FusedLSTMBlockCellShapeFn)
+    .Doc(R"doc(
+Computes one step of an LSTM cell in a single kernel.
+
+This is equivalent to (using `tanh` activations):
+
+```
+xh = [x, h_prev]
+[i, ci, f, o] = xh * w + b
+f = f + forget_bias
+
+if not use_peephole:
+  wci = wcf = wco = 0
+
+i = sigmoid(cs_prev * wci + i)
+f = sigmoid(cs_prev * wcf + f)
+ci = tanh(ci)
+
+cs = ci .* i + cs_prev .* f
+cs = clip(cs, cell_clip)
+
+o = sigmoid(cs * wco + o)
+co = tanh(cs)
+h = co .* o
+```
+
+x: The input to the LSTM cell, shaped `[batch_size, input_size]`.
+cs_prev: Value of the cell state at the previous time step.
+h_prev: Output of the previous cell at the previous time step.
+w: The weight matrix, shaped `[input_size + cell_size, 4 * cell_size]`.
+wci: The weight vector for the input gate peep-hole connection.
+wcf: The weight vector for the forget gate peep-hole connection.
+wco: The weight vector for the output gate peep-hole connection.
+b: The bias vector, shaped `[4 * cell_size]`.
+i: The input gate.
+cs: The cell state before the tanh.
+f: The forget gate.
+o: The output gate.
+ci: The cell input.
+co: The cell after the tanh.
+h: The output h vector.
+forget_bias: The forget gate bias.
+cell_clip: Value to clip the cell state to. It is disabled if it is not positive.
+use_peephole: Whether to use peep-hole connections.
+)doc");
+
+REGISTER_OP("FusedLSTMBlockCellGrad")
+    .Input("x: T")
+    .Input("cs_prev: T")
+    .Input("h_prev: T")
+    .Input("w: T")
+    .Input("wci: T")
+    .Input("wcf: T")
+    .Input("wco: T")
+    .Input("b: T")
+    .Input("i: T")
+    .Input("cs: T")
+    .Input("f: T")
+    .Input("o: T")
+    .Input("ci: T")
+    .Input("co: T")
+    .Input("cs_grad: T")
+    .Input("h_grad: T")
+    .Output("x_grad: T")
+    .Output("cs_prev_grad: T")
+    .Output("h_prev_grad: T")
+    .Output("w_grad: T")
+    .Output("wci_grad: T")
+    .Output("wcf_grad: T")
+    .Output("wco_grad: T")
+    .Output("b_grad: T")
+    .Attr("use_peephole: bool = false")
+    .Attr("T: {float, double}")
+    .SetShapeFn(FusedLSTMBlockCellGradShapeFn)
+    .Doc(R"doc(
+Computes the gradients of one step of an LSTM cell (i.e., of `FusedLSTMBlockCell`), in a single kernel.
+
+x: The input to the LSTM cell, shaped `[batch_size, input_size]`.
+cs_prev: Value of the cell state at the previous time step.
+h_prev: Output of the previous cell at the previous time step.
+w: The weight matrix, shaped `[input_size + cell_size, 4 * cell_size]`.
+wci: The weight vector for the input gate peep-hole connection.
+wcf: The weight vector for the forget gate peep-hole connection.
+wco: The weight vector for the output gate peep-hole connection.
+b: The bias vector, shaped `[4 * cell_size]`.
+i: The input gate, as computed by the forward step.
+cs: The cell state before the tanh, as computed by the forward step.
+f: The forget gate, as computed by the forward step.
+o: The output gate, as computed by the forward step.
+ci: The cell input, as computed by the forward step.
+co: The cell after the tanh, as computed by the forward step.
+cs_grad: The gradient with respect to `cs`.
+h_grad: The gradient with respect to `h`.
+x_grad: The gradient with respect to `x`.
+cs_prev_grad: The gradient with respect to `cs_prev`.
+h_prev_grad: The gradient with respect to `h_prev`.
+w_grad: The gradient with respect to `w`.
+wci_grad: The gradient with respect to `wci`.
+wcf_grad: The gradient with respect to `wcf`.
+wco_grad: The gradient with respect to `wco`.
+b_grad: The gradient with respect to `b`.
+use_peephole: Whether the forward step used peep-hole connections.
+)doc");
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+typedef Eigen::GpuDevice GPUDevice;
+
+#if GOOGLE_CUDA
+namespace {
+  template <typename T>
+  perftools::gputools::DeviceMemory<T> AsDeviceMemory(const T* cuda_memory) {
+    perftools::gputools::DeviceMemoryBase wrapped(const_cast<T*>(cuda_memory));
+    perftools::gputools::DeviceMemory<T> typed(wrapped);
+    return typed;
+  }
+}  // namespace
+
+namespace functor {
+template <typename T>
+void TensorCuBlasGemm<T>::operator()(
+    OpKernelContext* ctx, bool transa, bool transb, uint64 m, uint64 n, uint64 k, T alpha, const T* a, int lda,
+    const T* b, int ldb, T beta, T* c, int ldc) {
+  perftools::gputools::blas::Transpose trans[] = {
+      perftools::gputools::blas::Transpose::kNoTranspose, perftools::gputools::blas::Transpose::kTranspose};
+  auto a_ptr = AsDeviceMemory(a);
+  auto b_ptr = AsDeviceMemory(b);
+  auto c_ptr = AsDeviceMemory(c);
+  bool blas_launch_status = ctx->op_device_context()->stream()->ThenBlasGemm(
+      trans[transa], trans[transb], m, n, k, alpha, a_ptr, lda, b_ptr, ldb, beta, &c_ptr, ldc).ok();
+  OP_REQUIRES(ctx, blas_launch_status, errors::Aborted("cuBLAS GEMM launch failed."));
+}
+
+template struct TensorCuBlasGemm<float>;
+}  // namespace functor
+#endif  // GOOGLE_CUDA
+
+namespace {
+  // Checks that the inputs of a fused LSTM cell step have consistent shapes, and returns their sizes.
+  Status ValidateLSTMBlockCellInputs(
+      const Tensor& x, const Tensor& cs_prev, const Tensor& h_prev, const Tensor& w, const Tensor& wci,
+      const Tensor& wcf, const Tensor& wco, const Tensor& b, int64* batch_size, int64* input_size,
+      int64* cell_size) {
+    if (x.dims() != 2)
+      return errors::InvalidArgument("'x' must be rank-2, but its shape is: ", x.shape().DebugString(), ".");
+    if (cs_prev.dims() != 2)
+      return errors::InvalidArgument(
+          "'cs_prev' must be rank-2, but its shape is: ", cs_prev.shape().DebugString(), ".");
+    *batch_size = x.dim_size(0);
+    *input_size = x.dim_size(1);
+    *cell_size = cs_prev.dim_size(1);
+    const TensorShape state_shape({*batch_size, *cell_size});
+    if (cs_prev.shape() != state_shape)
+      return errors::InvalidArgument(
+          "'cs_prev' must be shaped ", state_shape.DebugString(), ", but is shaped ", cs_prev.shape().DebugString(),
+          ".");
+    if (h_prev.shape() != state_shape)
+      return errors::InvalidArgument(
+          "'h_prev' must be shaped ", state_shape.DebugString(), ", but is shaped ", h_prev.shape().DebugString(),
+          ".");
+    const TensorShape w_shape({*input_size + *cell_size, *cell_size * 4});
+    if (w.shape() != w_shape)
+      return errors::InvalidArgument(
+          "'w' must be shaped ", w_shape.DebugString(), ", but is shaped ", w.shape().DebugString(), ".");
+    const TensorShape peephole_shape({*cell_size});
+    if (wci.shape() != peephole_shape || wcf.shape() != peephole_shape || wco.shape() != peephole_shape)
+      return errors::InvalidArgument(
+          "'wci', 'wcf', and 'wco' must be shaped ", peephole_shape.DebugString(), ", but are shaped ",
+          wci.shape().DebugString(), ", ", wcf.shape().DebugString(), ", and ", wco.shape().DebugString(), ".");
+    const TensorShape b_shape({*cell_size * 4});
+    if (b.shape() != b_shape)
+      return errors::InvalidArgument(
+          "'b' must be shaped ", b_shape.DebugString(), ", but is shaped ", b.shape().DebugString(), ".");
+    return Status::OK();
+  }
+}  // namespace
+
+template <typename Device, typename T, bool USE_CUBLAS>
+class FusedLSTMBlockCellOp : public OpKernel {
+ public:
+  explicit FusedLSTMBlockCellOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("forget_bias", &forget_bias_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("cell_clip", &cell_clip_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("use_peephole", &use_peephole_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& x = ctx->input(0);
+    const Tensor& cs_prev = ctx->input(1);
+    const Tensor& h_prev = ctx->input(2);
+    const Tensor& w = ctx->input(3);
+    const Tensor& wci = ctx->input(4);
+    const Tensor& wcf = ctx->input(5);
+    const Tensor& wco = ctx->input(6);
+    const Tensor& b = ctx->input(7);
+
+    int64 batch_size, input_size, cell_size;
+    OP_REQUIRES_OK(ctx, ValidateLSTMBlockCellInputs(
+        x, cs_prev, h_prev, w, wci, wcf, wco, b, &batch_size, &input_size, &cell_size));
+
+    const TensorShape state_shape({batch_size, cell_size});
+    Tensor* i = nullptr;
+    Tensor* cs = nullptr;
+    Tensor* f = nullptr;
+    Tensor* o = nullptr;
+    Tensor* ci = nullptr;
+    Tensor* co = nullptr;
+    Tensor* h = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, state_shape, &i));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, state_shape, &cs));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(2, state_shape, &f));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(3, state_shape, &o));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(4, state_shape, &ci));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(5, state_shape, &co));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(6, state_shape, &h));
+
+    Tensor xh;
+    Tensor icfo;
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(
+        DataTypeToEnum<T>::v(), TensorShape({batch_size, input_size + cell_size}), &xh));
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(
+        DataTypeToEnum<T>::v(), TensorShape({batch_size, cell_size * 4}), &icfo));
+
+    const Device& device = ctx->eigen_device<Device>();
+    functor::LSTMBlockCellFprop<Device, T, USE_CUBLAS>(batch_size, input_size, cell_size)(
+        ctx, device, forget_bias_, cell_clip_, use_peephole_, x.matrix<T>(), cs_prev.matrix<T>(),
+        h_prev.matrix<T>(), w.matrix<T>(), wci.vec<T>(), wcf.vec<T>(), wco.vec<T>(), b.vec<T>(), xh.matrix<T>(),
+        i->matrix<T>(), cs->matrix<T>(), f->matrix<T>(), o->matrix<T>(), ci->matrix<T>(), co->matrix<T>(),
+        icfo.matrix<T>(), h->matrix<T>());
+  }
+
+ private:
+  float forget_bias_;
+  float cell_clip_;
+  bool use_peephole_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(FusedLSTMBlockCellOp);
+};
+
+template <typename Device, typename T, bool USE_CUBLAS>
+class FusedLSTMBlockCellGradOp : public OpKernel {
+ public:
+  explicit FusedLSTMBlockCellGradOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("use_peephole", &use_peephole_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& x = ctx->input(0);
+    const Tensor& cs_prev = ctx->input(1);
+    const Tensor& h_prev = ctx->input(2);
+    const Tensor& w = ctx->input(3);
+    const Tensor& wci = ctx->input(4);
+    const Tensor& wcf = ctx->input(5);
+    const Tensor& wco = ctx->input(6);
+    const Tensor& b = ctx->input(7);
+    const Tensor& i = ctx->input(8);
+    const Tensor& cs = ctx->input(9);
+    const Tensor& f = ctx->input(10);
+    const Tensor& o = ctx->input(11);
+    const Tensor& ci = ctx->input(12);
+    const Tensor& co = ctx->input(13);
+    const Tensor& cs_grad = ctx->input(14);
+    const Tensor& h_grad = ctx->input(15);
+
+    int64 batch_size, input_size, cell_size;
+    OP_REQUIRES_OK(ctx, ValidateLSTMBlockCellInputs(
+        x, cs_prev, h_prev, w, wci, wcf, wco, b, &batch_size, &input_size, &cell_size));
+
+    const TensorShape state_shape({batch_size, cell_size});
+    const Tensor* activations[] = {&i, &cs, &f, &o, &ci, &co, &cs_grad, &h_grad};
+    const char* activation_names[] = {"i", "cs", "f", "o", "ci", "co", "cs_grad", "h_grad"};
+    for (int index = 0; index < 8; ++index) {
+      OP_REQUIRES(
+          ctx, activations[index]->shape() == state_shape,
+          errors::InvalidArgument(
+              "'", activation_names[index], "' must be shaped ", state_shape.DebugString(), ", but is shaped ",
+              activations[index]->shape().DebugString(), "."));
+    }
+
+    Tensor* x_grad = nullptr;
+    Tensor* cs_prev_grad = nullptr;
+    Tensor* h_prev_grad = nullptr;
+    Tensor* w_grad = nullptr;
+    Tensor* wci_grad = nullptr;
+    Tensor* wcf_grad = nullptr;
+    Tensor* wco_grad = nullptr;
+    Tensor* b_grad = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, x.shape(), &x_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, state_shape, &cs_prev_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(2, state_shape, &h_prev_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(3, w.shape(), &w_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(4, wci.shape(), &wci_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(5, wcf.shape(), &wcf_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(6, wco.shape(), &wco_grad));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(7, b.shape(), &b_grad));
+
+    const DataType data_type = DataTypeToEnum<T>::v();
+    Tensor do_, dcs, dci, df, di, dicfo, xh, xh_grad;
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(data_type, state_shape, &do_));
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(data_type, state_shape, &dcs));
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(data_type, state_shape, &dci));
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(data_type, state_shape, &df));
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(data_type, state_shape, &di));
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(data_type, TensorShape({batch_size, cell_size * 4}), &dicfo));
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(data_type, TensorShape({batch_size, input_size + cell_size}), &xh));
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(data_type, TensorShape({batch_size, input_size + cell_size}), &xh_grad));
+
+    const Device& device = ctx->eigen_device<Device>();
+    functor::LSTMBlockCellBprop<Device, T, USE_CUBLAS>(batch_size, input_size, cell_size)(
+        ctx, device, use_peephole_, x.matrix<T>(), cs_prev.matrix<T>(), h_prev.matrix<T>(), w.matrix<T>(),
+        wci.vec<T>(), wcf.vec<T>(), wco.vec<T>(), i.matrix<T>(), cs.matrix<T>(), f.matrix<T>(), o.matrix<T>(),
+        ci.matrix<T>(), co.matrix<T>(), cs_grad.matrix<T>(), h_grad.matrix<T>(), do_.matrix<T>(), dcs.matrix<T>(),
+        dci.matrix<T>(), df.matrix<T>(), di.matrix<T>(), dicfo.matrix<T>(), xh.matrix<T>(), xh_grad.matrix<T>(),
+        x_grad->matrix<T>(), cs_prev_grad->matrix<T>(), h_prev_grad->matrix<T>(), w_grad->matrix<T>(),
+        wci_grad->vec<T>(), wcf_grad->vec<T>(), wco_grad->vec<T>(), b_grad->vec<T>());
+  }
+
+ private:
+  bool use_peephole_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(FusedLSTMBlockCellGradOp);
+};
+
+#define REGISTER_CPU_KERNELS(T)                                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("FusedLSTMBlockCell").Device(DEVICE_CPU).TypeConstraint<T>("T"),                             \
+      FusedLSTMBlockCellOp<CPUDevice, T, false>);                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("FusedLSTMBlockCellGrad").Device(DEVICE_CPU).TypeConstraint<T>("T"),                         \
+      FusedLSTMBlockCellGradOp<CPUDevice, T, false>);
+
+REGISTER_CPU_KERNELS(float);
+REGISTER_CPU_KERNELS(double);
+#undef REGISTER_CPU_KERNELS
+
+#if GOOGLE_CUDA
+// The GPU functors are instantiated in `lstm_ops_gpu.cu.cc`, which is compiled by NVCC.
+namespace functor {
+extern template struct LSTMBlockCellFprop<GPUDevice, float, true>;
+extern template struct LSTMBlockCellBprop<GPUDevice, float, true>;
+}  // namespace functor
+
+#define REGISTER_GPU_KERNELS(T)                                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("FusedLSTMBlockCell").Device(DEVICE_GPU).TypeConstraint<T>("T"),                             \
+      FusedLSTMBlockCellOp<GPUDevice, T, true>);                                                        \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("FusedLSTMBlockCellGrad").Device(DEVICE_GPU).TypeConstraint<T>("T"),                         \
+      FusedLSTMBlockCellGradOp<GPUDevice, T, true>);
+
+REGISTER_GPU_KERNELS(float);
+#undef REGISTER_GPU_KERNELS
+#endif  // GOOGLE_CUDA
+}  // namespace tensorflow
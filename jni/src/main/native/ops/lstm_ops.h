@@ -0,0 +1,241 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LSTM_OPS_H_
+#define TENSORFLOW_LSTM_OPS_H_
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+namespace functor {
+
+// Column-major (i.e., BLAS-style) matrix multiplication, `c = alpha * op(a) * op(b) + beta * c`, launched on the
+// stream of the GPU device of `ctx`. It is only defined in builds with CUDA support.
+template <typename T>
+struct TensorCuBlasGemm {
+  void operator()(OpKernelContext* ctx, bool transa, bool transb, uint64 m, uint64 n, uint64 k, T alpha, const T* a,
+                  int lda, const T* b, int ldb, T beta, T* c, int ldc);
+};
+
+// Row-major matrix multiplication, `c = op(a) * op(b)`, computed either using cuBLAS, or using an Eigen contraction on
+// device `d` (which is multi-threaded and vectorized for CPUs).
+template <typename Device, typename T, bool USE_CUBLAS>
+struct TensorBlasGemm;
+
+template <typename Device, typename T>
+struct TensorBlasGemm<Device, T, /* USE_CUBLAS= */ true> {
+  static void compute(OpKernelContext* ctx, const Device& d, bool transa, bool transb,
+                      typename TTypes<T>::ConstMatrix a, typename TTypes<T>::ConstMatrix b,
+                      typename TTypes<T>::Matrix c) {
+    const uint64 m = c.dimension(0);
+    const uint64 n = c.dimension(1);
+    const uint64 k = transa ? a.dimension(0) : a.dimension(1);
+    // The row-major product `c = op(a) * op(b)` is the column-major product `c^T = op(b)^T * op(a)^T`.
+    TensorCuBlasGemm<T>()(ctx, transb, transa, n, m, k, T(1), b.data(), transb ? k : n, a.data(), transa ? m : k,
+                          T(0), c.data(), n);
+  }
+};
+
+template <typename Device, typename T>
+struct TensorBlasGemm<Device, T, /* USE_CUBLAS= */ false> {
+  static void compute(OpKernelContext* ctx, const Device& d, bool transa, bool transb,
+                      typename TTypes<T>::ConstMatrix a, typename TTypes<T>::ConstMatrix b,
+                      typename TTypes<T>::Matrix c) {
+    Eigen::array<Eigen::IndexPair<Eigen::DenseIndex>, 1> contract_pairs;
+    contract_pairs[0] = Eigen::IndexPair<Eigen::DenseIndex>(transa ? 0 : 1, transb ? 1 : 0);
+    c.device(d) = a.contract(b, contract_pairs);
+  }
+};
+
+// Shapes of the tensors of a fused LSTM cell step, with helpers for addressing the blocks of the gate matrices. The
+// gates are laid out as `[i, ci, f, o]` (i.e., input gate, cell input, forget gate, and output gate) along the second
+// axis, which is the same layout as for the kernels and biases of the unfused basic LSTM cell.
+struct LSTMBlockCell {
+  LSTMBlockCell(const int batch_size, const int input_size, const int cell_size)
+      : batch_size_(batch_size), input_size_(input_size), cell_size_(cell_size) {}
+
+  int batch_size() const { return batch_size_; }
+  int input_size() const { return input_size_; }
+  int cell_size() const { return cell_size_; }
+
+  inline Eigen::array<Eigen::DenseIndex, 2> icfo_i_offsets() const { return {0, 0}; }
+  inline Eigen::array<Eigen::DenseIndex, 2> icfo_c_offsets() const { return {0, cell_size_}; }
+  inline Eigen::array<Eigen::DenseIndex, 2> icfo_f_offsets() const { return {0, cell_size_ * 2}; }
+  inline Eigen::array<Eigen::DenseIndex, 2> icfo_o_offsets() const { return {0, cell_size_ * 3}; }
+  inline Eigen::array<Eigen::DenseIndex, 2> cell_extents() const { return {batch_size_, cell_size_}; }
+  inline Eigen::array<Eigen::DenseIndex, 2> xh_x_offsets() const { return {0, 0}; }
+  inline Eigen::array<Eigen::DenseIndex, 2> xh_x_extents() const { return {batch_size_, input_size_}; }
+  inline Eigen::array<Eigen::DenseIndex, 2> xh_h_offsets() const { return {0, input_size_}; }
+  inline Eigen::array<Eigen::DenseIndex, 2> xh_h_extents() const { return {batch_size_, cell_size_}; }
+
+ protected:
+  const int batch_size_;
+  const int input_size_;
+  const int cell_size_;
+};
+
+// Forward step of a fused LSTM cell. All element-wise computations are Eigen expressions evaluated on device `d`, and
+// so the same implementation is instantiated for CPUs (in `lstm_ops.cc`) and for GPUs (in `lstm_ops_gpu.cu.cc`).
+template <typename Device, typename T, bool USE_CUBLAS>
+struct LSTMBlockCellFprop : public LSTMBlockCell {
+  LSTMBlockCellFprop(const int batch_size, const int input_size, const int cell_size)
+      : LSTMBlockCell(batch_size, input_size, cell_size) {}
+
+  void operator()(
+      OpKernelContext* ctx, const Device& d, const float forget_bias, const float cell_clip, bool use_peephole,
+      typename TTypes<T>::ConstMatrix x, typename TTypes<T>::ConstMatrix cs_prev,
+      typename TTypes<T>::ConstMatrix h_prev, typename TTypes<T>::ConstMatrix w, typename TTypes<T>::ConstVec wci,
+      typename TTypes<T>::ConstVec wcf, typename TTypes<T>::ConstVec wco, typename TTypes<T>::ConstVec b,
+      typename TTypes<T>::Matrix xh, typename TTypes<T>::Matrix i, typename TTypes<T>::Matrix cs,
+      typename TTypes<T>::Matrix f, typename TTypes<T>::Matrix o, typename TTypes<T>::Matrix ci,
+      typename TTypes<T>::Matrix co, typename TTypes<T>::Matrix icfo, typename TTypes<T>::Matrix h) {
+    // Concatenate the inputs with the previous outputs and multiply them with the kernel of all gates at once.
+    xh.slice(xh_x_offsets(), xh_x_extents()).device(d) = x;
+    xh.slice(xh_h_offsets(), xh_h_extents()).device(d) = h_prev;
+    typename TTypes<T>::ConstMatrix const_xh(xh.data(), xh.dimensions());
+    TensorBlasGemm<Device, T, USE_CUBLAS>::compute(ctx, d, false, false, const_xh, w, icfo);
+
+    // Add the biases.
+    Eigen::array<Eigen::DenseIndex, 2> b_shape({1, b.dimensions()[0]});
+    Eigen::array<Eigen::DenseIndex, 2> broadcast_shape({batch_size_, 1});
+    icfo.device(d) += b.reshape(b_shape).broadcast(broadcast_shape);
+
+    Eigen::array<Eigen::DenseIndex, 2> p_shape({1, cell_size_});
+    Eigen::array<Eigen::DenseIndex, 2> p_broadcast_shape({batch_size_, 1});
+
+    // Input gate.
+    if (use_peephole) {
+      auto i_peep = cs_prev * wci.reshape(p_shape).broadcast(p_broadcast_shape);
+      i.device(d) = (icfo.slice(icfo_i_offsets(), cell_extents()) + i_peep).sigmoid();
+    } else {
+      i.device(d) = icfo.slice(icfo_i_offsets(), cell_extents()).sigmoid();
+    }
+
+    // Cell input.
+    ci.device(d) = icfo.slice(icfo_c_offsets(), cell_extents()).tanh();
+
+    // Forget gate (with the forget bias).
+    if (use_peephole) {
+      auto f_peep = cs_prev * wcf.reshape(p_shape).broadcast(p_broadcast_shape);
+      f.device(d) = (icfo.slice(icfo_f_offsets(), cell_extents()) + f.constant(T(forget_bias)) + f_peep).sigmoid();
+    } else {
+      f.device(d) = (icfo.slice(icfo_f_offsets(), cell_extents()) + f.constant(T(forget_bias))).sigmoid();
+    }
+
+    // Cell state, optionally clipped.
+    cs.device(d) = i * ci + f * cs_prev;
+    if (cell_clip > 0.0f) cs.device(d) = cs.cwiseMin(T(cell_clip)).cwiseMax(T(-cell_clip));
+
+    // Cell output.
+    co.device(d) = cs.tanh();
+
+    // Output gate.
+    if (use_peephole) {
+      auto o_peep = cs * wco.reshape(p_shape).broadcast(p_broadcast_shape);
+      o.device(d) = (icfo.slice(icfo_o_offsets(), cell_extents()) + o_peep).sigmoid();
+    } else {
+      o.device(d) = icfo.slice(icfo_o_offsets(), cell_extents()).sigmoid();
+    }
+
+    // Cell output.
+    h.device(d) = o * co;
+  }
+};
+
+// Backward step of a fused LSTM cell, which computes the gradients with respect to all inputs of the forward step
+// using the activations saved by it. Note that, as for the unfused cells, cell clipping is treated as the identity.
+template <typename Device, typename T, bool USE_CUBLAS>
+struct LSTMBlockCellBprop : public LSTMBlockCell {
+  LSTMBlockCellBprop(const int batch_size, const int input_size, const int cell_size)
+      : LSTMBlockCell(batch_size, input_size, cell_size) {}
+
+  void operator()(
+      OpKernelContext* ctx, const Device& d, bool use_peephole, typename TTypes<T>::ConstMatrix x,
+      typename TTypes<T>::ConstMatrix cs_prev, typename TTypes<T>::ConstMatrix h_prev,
+      typename TTypes<T>::ConstMatrix w, typename TTypes<T>::ConstVec wci, typename TTypes<T>::ConstVec wcf,
+      typename TTypes<T>::ConstVec wco, typename TTypes<T>::ConstMatrix i, typename TTypes<T>::ConstMatrix cs,
+      typename TTypes<T>::ConstMatrix f, typename TTypes<T>::ConstMatrix o, typename TTypes<T>::ConstMatrix ci,
+      typename TTypes<T>::ConstMatrix co, typename TTypes<T>::ConstMatrix cs_grad,
+      typename TTypes<T>::ConstMatrix h_grad, typename TTypes<T>::Matrix do_, typename TTypes<T>::Matrix dcs,
+      typename TTypes<T>::Matrix dci, typename TTypes<T>::Matrix df, typename TTypes<T>::Matrix di,
+      typename TTypes<T>::Matrix dicfo, typename TTypes<T>::Matrix xh, typename TTypes<T>::Matrix xh_grad,
+      typename TTypes<T>::Matrix x_grad, typename TTypes<T>::Matrix cs_prev_grad,
+      typename TTypes<T>::Matrix h_prev_grad, typename TTypes<T>::Matrix w_grad, typename TTypes<T>::Vec wci_grad,
+      typename TTypes<T>::Vec wcf_grad, typename TTypes<T>::Vec wco_grad, typename TTypes<T>::Vec b_grad) {
+    // Output gate.
+    do_.device(d) = o * (o.constant(T(1)) - o) * h_grad * co;
+
+    // Cell state.
+    dcs.device(d) = (co.constant(T(1)) - co * co) * h_grad * o + cs_grad;
+
+    Eigen::array<Eigen::DenseIndex, 2> p_shape({1, cell_size_});
+    Eigen::array<Eigen::DenseIndex, 2> p_broadcast_shape({batch_size_, 1});
+    if (use_peephole) dcs.device(d) = dcs + do_ * wco.reshape(p_shape).broadcast(p_broadcast_shape);
+
+    // Cell input.
+    dci.device(d) = (ci.constant(T(1)) - ci * ci) * dcs * i;
+
+    // Forget gate.
+    df.device(d) = f * (f.constant(T(1)) - f) * dcs * cs_prev;
+
+    // Input gate.
+    di.device(d) = i * (i.constant(T(1)) - i) * dcs * ci;
+
+    dicfo.slice(icfo_i_offsets(), cell_extents()).device(d) = di;
+    dicfo.slice(icfo_c_offsets(), cell_extents()).device(d) = dci;
+    dicfo.slice(icfo_f_offsets(), cell_extents()).device(d) = df;
+    dicfo.slice(icfo_o_offsets(), cell_extents()).device(d) = do_;
+
+    // Previous cell state.
+    cs_prev_grad.device(d) = dcs * f;
+    if (use_peephole) {
+      cs_prev_grad.device(d) = cs_prev_grad + di * wci.reshape(p_shape).broadcast(p_broadcast_shape) +
+                               df * wcf.reshape(p_shape).broadcast(p_broadcast_shape);
+    }
+
+    // Peep-hole weights.
+    Eigen::array<Eigen::DenseIndex, 1> batch_axis({0});
+    if (use_peephole) {
+      wci_grad.device(d) = (di * cs_prev).sum(batch_axis);
+      wcf_grad.device(d) = (df * cs_prev).sum(batch_axis);
+      wco_grad.device(d) = (do_ * cs).sum(batch_axis);
+    } else {
+      wci_grad.device(d) = wci_grad.constant(T(0));
+      wcf_grad.device(d) = wcf_grad.constant(T(0));
+      wco_grad.device(d) = wco_grad.constant(T(0));
+    }
+
+    // Inputs and previous outputs, through the kernel.
+    typename TTypes<T>::ConstMatrix const_dicfo(dicfo.data(), dicfo.dimensions());
+    TensorBlasGemm<Device, T, USE_CUBLAS>::compute(ctx, d, false, true, const_dicfo, w, xh_grad);
+    x_grad.device(d) = xh_grad.slice(xh_x_offsets(), xh_x_extents());
+    h_prev_grad.device(d) = xh_grad.slice(xh_h_offsets(), xh_h_extents());
+
+    // Kernel and biases.
+    xh.slice(xh_x_offsets(), xh_x_extents()).device(d) = x;
+    xh.slice(xh_h_offsets(), xh_h_extents()).device(d) = h_prev;
+    typename TTypes<T>::ConstMatrix const_xh(xh.data(), xh.dimensions());
+    TensorBlasGemm<Device, T, USE_CUBLAS>::compute(ctx, d, true, false, const_xh, const_dicfo, w_grad);
+    b_grad.device(d) = dicfo.sum(batch_axis);
+  }
+};
+
+}  // namespace functor
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_LSTM_OPS_H_
@@ -0,0 +1,591 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "third_party/eigen3/Eigen/Core"
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/resource_mgr.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/refcount.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  typedef Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1>> StateVector;
+
+  // Batches with at least this many elements are accumulated in parallel, using one partial accumulator per shard.
+  const int64 kParallelUpdateThreshold = 1 << 15;
+
+  // Minimum number of elements processed by each shard of a parallel update.
+  const int64 kMinElementsPerShard = 1 << 13;
+
+  // Parallel updates are only used when the partial accumulators are small compared to the batch, since each one of
+  // them needs to be cleared and added to the accumulator state.
+  const int64 kMaxStateSizeToElementsRatio = 4;
+}  // namespace
+
+// Resource that holds the accumulated statistics of a streaming metric (e.g., the weighted sum and count of a mean, or
+// the cells of a confusion matrix), as a dense array of doubles with a fixed shape.
+//
+// Each metric updates its accumulator using a single kernel, which reduces the batch of values it is given (without
+// holding the lock of the accumulator) and then adds the result to the accumulator state. The state can be read, reset,
+// or read and reset atomically, which is cheap compared to re-running the initializers of metric variables.
+class MetricAccumulator : public ResourceBase {
+ public:
+  explicit MetricAccumulator(const TensorShape& shape) : shape_(shape), state_(shape.num_elements(), 0.0) {}
+
+  mutex* mu() { return &mu_; }
+  const TensorShape& shape() const { return shape_; }
+  double* state() { return state_.data(); }
+  int64 size() const { return state_.size(); }
+
+  // Copies the current state into 'output', which must have the shape of this accumulator.
+  void Read(Tensor* output) {
+    std::memcpy(output->flat<double>().data(), state_.data(), state_.size() * sizeof(double));
+  }
+
+  void Reset() { std::fill(state_.begin(), state_.end(), 0.0); }
+
+  string DebugString() override { return strings::StrCat("MetricAccumulator", shape_.DebugString()); }
+
+ private:
+  mutex mu_;
+  const TensorShape shape_;
+  std::vector<double> state_;
+
+  ~MetricAccumulator() override {}
+  TF_DISALLOW_COPY_AND_ASSIGN(MetricAccumulator);
+};
+
+namespace {
+  // Looks up the metric accumulator referenced by input 'index', checking that its state has 'rank' dimensions.
+  Status LookupAccumulator(OpKernelContext* ctx, int index, int rank, MetricAccumulator** accumulator) {
+    TF_RETURN_IF_ERROR(LookupResource(ctx, HandleFromInput(ctx, index), accumulator));
+    if ((*accumulator)->shape().dims() != rank) {
+      const string shape = (*accumulator)->shape().DebugString();
+      (*accumulator)->Unref();
+      return errors::InvalidArgument("Expected a metric accumulator with rank ", rank, ", but its shape is ", shape,
+                                     ".");
+    }
+    return Status::OK();
+  }
+
+  // Returns the flattened 'weights' input, which is either empty (meaning that all weights are equal to 1), or has
+  // 'num_elements' elements.
+  Status GetWeights(OpKernelContext* ctx, int64 num_elements, const Tensor** weights) {
+    TF_RETURN_IF_ERROR(ctx->input("weights", weights));
+    const int64 num_weights = (*weights)->NumElements();
+    if (num_weights != 0 && num_weights != num_elements)
+      return errors::InvalidArgument("'weights' must either be empty or have ", num_elements,
+                                     " elements, but has shape ", (*weights)->shape().DebugString(), ".");
+    return Status::OK();
+  }
+
+  // Accumulates 'num_elements' elements into a state of size 'state_size', by calling 'accumulate(partial, start,
+  // limit)' for ranges of elements. For large batches, the ranges are processed in parallel and accumulated into
+  // separate partial states, which are summed using vectorized additions. Returns the accumulated batch statistics in
+  // 'batch_state'.
+  template <typename Accumulate>
+  void AccumulateBatch(OpKernelContext* ctx, int64 num_elements, int64 state_size, const Accumulate& accumulate,
+                       std::vector<double>* batch_state) {
+    batch_state->assign(state_size, 0.0);
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    const int64 num_shards = std::min(static_cast<int64>(worker_threads.num_threads),
+                                      num_elements / kMinElementsPerShard);
+    if (num_elements < kParallelUpdateThreshold || num_shards < 2 ||
+        state_size * kMaxStateSizeToElementsRatio > num_elements) {
+      accumulate(batch_state->data(), 0, num_elements);
+      return;
+    }
+    std::vector<std::vector<double>> partials(num_shards);
+    const int64 shard_size = (num_elements + num_shards - 1) / num_shards;
+    auto work = [&partials, &accumulate, num_elements, state_size, shard_size](int64 start, int64 limit) {
+      for (int64 s = start; s < limit; ++s) {
+        partials[s].assign(state_size, 0.0);
+        accumulate(partials[s].data(), s * shard_size, std::min(num_elements, (s + 1) * shard_size));
+      }
+    };
+    Shard(worker_threads.num_threads, worker_threads.workers, num_shards, shard_size * 10, work);
+    StateVector result(batch_state->data(), state_size);
+    for (const std::vector<double>& partial : partials)
+      result += Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(partial.data(), state_size);
+  }
+
+  // Adds 'batch_state' to the state of 'accumulator', which must be locked.
+  inline void AddToState(MetricAccumulator* accumulator, const std::vector<double>& batch_state) {
+    StateVector(accumulator->state(), accumulator->size()) +=
+        Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, 1>>(batch_state.data(), batch_state.size());
+  }
+
+  // Computes the area under the ROC curve from a state that contains the weighted histograms of the predictions of the
+  // positive examples (first row) and of the negative examples (second row), over 'num_buckets' prediction buckets.
+  // Predictions that fall into the same bucket are treated as ties (i.e., they contribute half of their area).
+  double AUCFromHistograms(const double* state, int64 num_buckets) {
+    const double* positives = state;
+    const double* negatives = state + num_buckets;
+    double area = 0.0;
+    double positives_above = 0.0;
+    double negatives_total = 0.0;
+    for (int64 b = num_buckets - 1; b >= 0; --b) {
+      area += negatives[b] * (positives_above + 0.5 * positives[b]);
+      positives_above += positives[b];
+      negatives_total += negatives[b];
+    }
+    const double denominator = positives_above * negatives_total;
+    return denominator > 0.0 ? area / denominator : 0.0;
+  }
+}  // namespace
+
+// Kernel that creates a metric accumulator resource and outputs a handle to it.
+class MetricAccumulatorOp : public OpKernel {
+ public:
+  explicit MetricAccumulatorOp(OpKernelConstruction* ctx) : OpKernel(ctx), accumulator_handle_set_(false) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("shape", &shape_));
+  }
+
+  ~MetricAccumulatorOp() override {
+    // If the accumulator object was not shared, delete it.
+    if (accumulator_handle_set_ && cinfo_.resource_is_private_to_kernel()) {
+      TF_CHECK_OK(cinfo_.resource_manager()->template Delete<MetricAccumulator>(cinfo_.container(), cinfo_.name()));
+    }
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    mutex_lock l(mu_);
+    if (!accumulator_handle_set_) {
+      OP_REQUIRES_OK(ctx, cinfo_.Init(ctx->resource_manager(), def()));
+      MetricAccumulator* accumulator;
+      const TensorShape shape = shape_;
+      OP_REQUIRES_OK(ctx, cinfo_.resource_manager()->template LookupOrCreate<MetricAccumulator>(
+          cinfo_.container(), cinfo_.name(), &accumulator, [shape](MetricAccumulator** ret) {
+            *ret = new MetricAccumulator(shape);
+            return Status::OK();
+          }));
+      core::ScopedUnref unref(accumulator);
+      OP_REQUIRES(ctx, accumulator->shape() == shape_,
+                  errors::InvalidArgument("Shared metric accumulator '", cinfo_.name(), "' has shape ",
+                                          accumulator->shape().DebugString(), ", but shape ", shape_.DebugString(),
+                                          " was requested."));
+      accumulator_handle_set_ = true;
+    }
+    Tensor* handle;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &handle));
+    handle->scalar<ResourceHandle>()() = MakeResourceHandle<MetricAccumulator>(ctx, cinfo_.container(), cinfo_.name());
+  }
+
+ private:
+  TensorShape shape_;
+  mutex mu_;
+  ContainerInfo cinfo_ GUARDED_BY(mu_);
+  bool accumulator_handle_set_ GUARDED_BY(mu_);
+
+  TF_DISALLOW_COPY_AND_ASSIGN(MetricAccumulatorOp);
+};
+
+// Kernel that reads the state of a metric accumulator and, if 'reset' is true, also resets it, atomically.
+template <bool reset>
+class MetricAccumulatorReadOp : public OpKernel {
+ public:
+  explicit MetricAccumulatorReadOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    MetricAccumulator* accumulator;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &accumulator));
+    core::ScopedUnref unref(accumulator);
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, accumulator->shape(), &output));
+    mutex_lock l(*accumulator->mu());
+    accumulator->Read(output);
+    if (reset) accumulator->Reset();
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(MetricAccumulatorReadOp);
+};
+
+// Kernel that resets the state of a metric accumulator to zeros.
+class MetricAccumulatorResetOp : public OpKernel {
+ public:
+  explicit MetricAccumulatorResetOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    MetricAccumulator* accumulator;
+    OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, 0), &accumulator));
+    core::ScopedUnref unref(accumulator);
+    mutex_lock l(*accumulator->mu());
+    accumulator->Reset();
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(MetricAccumulatorResetOp);
+};
+
+// Kernel that adds the weighted sum and the total weight of a batch of values to a mean accumulator (whose state is
+// '[total, count]'), and outputs the updated mean. The sums are computed using vectorized and multi-threaded Eigen
+// reductions.
+template <typename T>
+class MeanAccumulatorUpdateOp : public OpKernel {
+ public:
+  explicit MeanAccumulatorUpdateOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    MetricAccumulator* accumulator;
+    OP_REQUIRES_OK(ctx, LookupAccumulator(ctx, 0, 1, &accumulator));
+    core::ScopedUnref unref(accumulator);
+    OP_REQUIRES(ctx, accumulator->size() == 2,
+                errors::InvalidArgument("Expected a mean accumulator with shape [2], but its shape is ",
+                                        accumulator->shape().DebugString(), "."));
+    const Tensor& values = ctx->input(1);
+    const Tensor* weights;
+    OP_REQUIRES_OK(ctx, GetWeights(ctx, values.NumElements(), &weights));
+
+    const CPUDevice& device = ctx->eigen_device<CPUDevice>();
+    const auto values_flat = values.flat<T>();
+    Eigen::Tensor<double, 0, Eigen::RowMajor> total;
+    double count;
+    if (weights->NumElements() == 0) {
+      total.device(device) = values_flat.template cast<double>().sum();
+      count = static_cast<double>(values.NumElements());
+    } else {
+      const auto weights_flat = weights->flat<T>();
+      Eigen::Tensor<double, 0, Eigen::RowMajor> weights_sum;
+      total.device(device) = (values_flat.template cast<double>() * weights_flat.template cast<double>()).sum();
+      weights_sum.device(device) = weights_flat.template cast<double>().sum();
+      count = weights_sum();
+    }
+
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &output));
+    mutex_lock l(*accumulator->mu());
+    double* state = accumulator->state();
+    state[0] += total();
+    state[1] += count;
+    output->scalar<double>()() = state[1] > 0.0 ? state[0] / state[1] : 0.0;
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(MeanAccumulatorUpdateOp);
+};
+
+// Kernel that adds the (weighted) counts of a batch of target/prediction pairs to a confusion matrix accumulator, and
+// outputs the updated confusion matrix. The targets and the predictions are validated before the accumulator is
+// modified, and the counts are accumulated directly into cells, instead of building a sparse tensor and converting it
+// to a dense one.
+template <typename Tidx, typename T>
+class ConfusionMatrixAccumulatorUpdateOp : public OpKernel {
+ public:
+  explicit ConfusionMatrixAccumulatorUpdateOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    MetricAccumulator* accumulator;
+    OP_REQUIRES_OK(ctx, LookupAccumulator(ctx, 0, 2, &accumulator));
+    core::ScopedUnref unref(accumulator);
+    const int64 num_classes = accumulator->shape().dim_size(0);
+    OP_REQUIRES(ctx, accumulator->shape().dim_size(1) == num_classes,
+                errors::InvalidArgument("Expected a square confusion matrix accumulator, but its shape is ",
+                                        accumulator->shape().DebugString(), "."));
+    const Tensor& targets = ctx->input(1);
+    const Tensor& predictions = ctx->input(2);
+    OP_REQUIRES(ctx, targets.NumElements() == predictions.NumElements(),
+                errors::InvalidArgument("'targets' and 'predictions' must have the same number of elements, but ",
+                                        "their shapes are ", targets.shape().DebugString(), " and ",
+                                        predictions.shape().DebugString(), "."));
+    const int64 num_elements = targets.NumElements();
+    const Tensor* weights;
+    OP_REQUIRES_OK(ctx, GetWeights(ctx, num_elements, &weights));
+
+    const Tidx* targets_data = targets.flat<Tidx>().data();
+    const Tidx* predictions_data = predictions.flat<Tidx>().data();
+    const T* weights_data = weights->NumElements() == 0 ? nullptr : weights->flat<T>().data();
+    std::atomic<bool> out_of_range(false);
+    auto accumulate = [targets_data, predictions_data, weights_data, num_classes, &out_of_range](
+        double* partial, int64 start, int64 limit) {
+      for (int64 i = start; i < limit; ++i) {
+        const Tidx target = targets_data[i];
+        const Tidx prediction = predictions_data[i];
+        if (target < 0 || target >= num_classes || prediction < 0 || prediction >= num_classes) {
+          out_of_range.store(true, std::memory_order_relaxed);
+          return;
+        }
+        partial[target * num_classes + prediction] += weights_data == nullptr ? 1.0 : weights_data[i];
+      }
+    };
+    std::vector<double> batch_state;
+    AccumulateBatch(ctx, num_elements, accumulator->size(), accumulate, &batch_state);
+    OP_REQUIRES(ctx, !out_of_range.load(),
+                errors::InvalidArgument("All 'targets' and 'predictions' must be in [0, ", num_classes, ")."));
+
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, accumulator->shape(), &output));
+    mutex_lock l(*accumulator->mu());
+    AddToState(accumulator, batch_state);
+    accumulator->Read(output);
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(ConfusionMatrixAccumulatorUpdateOp);
+};
+
+// Kernel that adds the (weighted) histograms of the predictions of a batch of positive and negative examples to an AUC
+// accumulator, whose state has shape '[2, num_buckets]', and outputs the updated area under the ROC curve. The bucket
+// of each prediction is computed using a vectorized Eigen expression, and the histograms are then accumulated in a
+// single pass over the batch.
+template <typename T>
+class AUCAccumulatorUpdateOp : public OpKernel {
+ public:
+  explicit AUCAccumulatorUpdateOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    MetricAccumulator* accumulator;
+    OP_REQUIRES_OK(ctx, LookupAccumulator(ctx, 0, 2, &accumulator));
+    core::ScopedUnref unref(accumulator);
+    OP_REQUIRES(ctx, accumulator->shape().dim_size(0) == 2 && accumulator->shape().dim_size(1) > 0,
+                errors::InvalidArgument("Expected an AUC accumulator with shape [2, num_buckets], but its shape is ",
+                                        accumulator->shape().DebugString(), "."));
+    const int64 num_buckets = accumulator->shape().dim_size(1);
+    const Tensor& predictions = ctx->input(1);
+    const Tensor& targets = ctx->input(2);
+    OP_REQUIRES(ctx, targets.NumElements() == predictions.NumElements(),
+                errors::InvalidArgument("'targets' and 'predictions' must have the same number of elements, but ",
+                                        "their shapes are ", targets.shape().DebugString(), " and ",
+                                        predictions.shape().DebugString(), "."));
+    const int64 num_elements = predictions.NumElements();
+    const Tensor* weights;
+    OP_REQUIRES_OK(ctx, GetWeights(ctx, num_elements, &weights));
+
+    // Compute the bucket of each prediction. Predictions outside [0, 1] are clipped to the first or the last bucket.
+    Tensor buckets;
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(DT_INT32, TensorShape({num_elements}), &buckets));
+    const T max_bucket = static_cast<T>(num_buckets - 1);
+    buckets.flat<int32>().device(ctx->eigen_device<CPUDevice>()) =
+        (predictions.flat<T>() * static_cast<T>(num_buckets)).floor().cwiseMax(T(0)).cwiseMin(max_bucket)
+            .template cast<int32>();
+
+    const int32* buckets_data = buckets.flat<int32>().data();
+    const bool* targets_data = targets.flat<bool>().data();
+    const T* weights_data = weights->NumElements() == 0 ? nullptr : weights->flat<T>().data();
+    auto accumulate = [buckets_data, targets_data, weights_data, num_buckets](
+        double* partial, int64 start, int64 limit) {
+      for (int64 i = start; i < limit; ++i) {
+        const int64 row = targets_data[i] ? 0 : num_buckets;
+        partial[row + buckets_data[i]] += weights_data == nullptr ? 1.0 : weights_data[i];
+      }
+    };
+    std::vector<double> batch_state;
+    AccumulateBatch(ctx, num_elements, accumulator->size(), accumulate, &batch_state);
+
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &output));
+    mutex_lock l(*accumulator->mu());
+    AddToState(accumulator, batch_state);
+    output->scalar<double>()() = AUCFromHistograms(accumulator->state(), num_buckets);
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(AUCAccumulatorUpdateOp);
+};
+
+namespace {
+  Status HandleShapeFn(InferenceContext* c, int num_inputs) {
+    ShapeHandle unused;
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 0, &unused));
+    for (int i = 1; i < num_inputs; ++i)
+      TF_RETURN_IF_ERROR(c->WithRankAtLeast(c->input(i), 0, &unused));
+    return Status::OK();
+  }
+}  // namespace
+
+REGISTER_OP("MetricAccumulator")
+    .Output("handle: resource")
+    .Attr("shape: shape")
+    .Attr("container: string = ''")
+    .Attr("shared_name: string = ''")
+    .SetIsStateful()
+    .SetShapeFn(shape_inference::ScalarShape)
+    .Doc(R"doc(
+Creates a metric accumulator, which holds the accumulated statistics of a streaming metric as an array of doubles.
+
+The accumulator state is initialized to zeros. It is updated using the metric-specific update ops (e.g.,
+'MeanAccumulatorUpdate'), and it can be read and reset using the 'MetricAccumulatorRead',
+'MetricAccumulatorReadAndReset', and 'MetricAccumulatorReset' ops.
+
+handle: Handle to the accumulator.
+shape: Shape of the accumulator state.
+container: If non-empty, this accumulator is placed in the given container. Otherwise, a default container is used.
+shared_name: If non-empty, this accumulator is shared under the given name across multiple sessions.
+)doc");
+
+REGISTER_OP("MetricAccumulatorRead")
+    .Input("handle: resource")
+    .Output("state: double")
+    .SetShapeFn([](InferenceContext* c) {
+      TF_RETURN_IF_ERROR(HandleShapeFn(c, 1));
+      c->set_output(0, c->UnknownShape());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Reads the state of a metric accumulator.
+
+handle: Handle to the accumulator.
+state: Current accumulator state.
+)doc");
+
+REGISTER_OP("MetricAccumulatorReadAndReset")
+    .Input("handle: resource")
+    .Output("state: double")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      TF_RETURN_IF_ERROR(HandleShapeFn(c, 1));
+      c->set_output(0, c->UnknownShape());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Reads the state of a metric accumulator and resets it to zeros, atomically.
+
+handle: Handle to the accumulator.
+state: Accumulator state, before it was reset.
+)doc");
+
+REGISTER_OP("MetricAccumulatorReset")
+    .Input("handle: resource")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) { return HandleShapeFn(c, 1); })
+    .Doc(R"doc(
+Resets the state of a metric accumulator to zeros.
+
+handle: Handle to the accumulator.
+)doc");
+
+REGISTER_OP("MeanAccumulatorUpdate")
+    .Input("handle: resource")
+    .Input("values: T")
+    .Input("weights: T")
+    .Output("value: double")
+    .Attr("T: {float, double}")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      TF_RETURN_IF_ERROR(HandleShapeFn(c, 3));
+      return shape_inference::ScalarShape(c);
+    })
+    .Doc(R"doc(
+Updates a mean accumulator, whose state has shape '[2]' and contains the weighted sum of the values and their total
+weight, and returns the updated mean.
+
+handle: Handle to the accumulator.
+values: Values to add to the mean.
+weights: Weights of the values, which must either have as many elements as 'values', or be empty, in which case all
+  weights are equal to 1.
+value: Updated mean, which is 0 if the total weight is not positive.
+)doc");
+
+REGISTER_OP("ConfusionMatrixAccumulatorUpdate")
+    .Input("handle: resource")
+    .Input("targets: Tidx")
+    .Input("predictions: Tidx")
+    .Input("weights: T")
+    .Output("confusion_matrix: double")
+    .Attr("Tidx: {int32, int64}")
+    .Attr("T: {float, double}")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      TF_RETURN_IF_ERROR(HandleShapeFn(c, 4));
+      c->set_output(0, c->Matrix(InferenceContext::kUnknownDim, InferenceContext::kUnknownDim));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Updates a confusion matrix accumulator, whose state has shape '[num_classes, num_classes]', and returns the updated
+confusion matrix. The rows of the confusion matrix correspond to the targets and its columns to the predictions.
+
+handle: Handle to the accumulator.
+targets: Target labels, which must be in '[0, num_classes)'.
+predictions: Predicted labels, which must be in '[0, num_classes)' and have as many elements as 'targets'.
+weights: Weights of the target/prediction pairs, which must either have as many elements as 'targets', or be empty, in
+  which case all weights are equal to 1.
+confusion_matrix: Updated confusion matrix.
+)doc");
+
+REGISTER_OP("AUCAccumulatorUpdate")
+    .Input("handle: resource")
+    .Input("predictions: T")
+    .Input("targets: bool")
+    .Input("weights: T")
+    .Output("auc: double")
+    .Attr("T: {float, double}")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      TF_RETURN_IF_ERROR(HandleShapeFn(c, 4));
+      return shape_inference::ScalarShape(c);
+    })
+    .Doc(R"doc(
+Updates an AUC accumulator, whose state has shape '[2, num_buckets]' and contains the weighted histograms of the
+predictions of the positive examples (first row) and of the negative examples (second row), and returns the updated
+area under the ROC curve.
+
+Prediction 'p' falls into bucket 'floor(p * num_buckets)', clipped to '[0, num_buckets)'.
+
+handle: Handle to the accumulator.
+predictions: Predicted probabilities of the positive class.
+targets: Target labels, which must have as many elements as 'predictions'.
+weights: Weights of the examples, which must either have as many elements as 'predictions', or be empty, in which case
+  all weights are equal to 1.
+auc: Updated area under the ROC curve, which is 0 if there are no positive or no negative examples.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("MetricAccumulator").Device(DEVICE_CPU), MetricAccumulatorOp);
+REGISTER_KERNEL_BUILDER(Name("MetricAccumulatorRead").Device(DEVICE_CPU), MetricAccumulatorReadOp<false>);
+REGISTER_KERNEL_BUILDER(Name("MetricAccumulatorReadAndReset").Device(DEVICE_CPU), MetricAccumulatorReadOp<true>);
+REGISTER_KERNEL_BUILDER(Name("MetricAccumulatorReset").Device(DEVICE_CPU), MetricAccumulatorResetOp);
+
+#define REGISTER_KERNELS(T)                                                                                   \
+  REGISTER_KERNEL_BUILDER(Name("MeanAccumulatorUpdate").Device(DEVICE_CPU).TypeConstraint<T>("T"),           \
+                          MeanAccumulatorUpdateOp<T>);                                                        \
+  REGISTER_KERNEL_BUILDER(Name("AUCAccumulatorUpdate").Device(DEVICE_CPU).TypeConstraint<T>("T"),            \
+                          AUCAccumulatorUpdateOp<T>);                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                                    \
+      Name("ConfusionMatrixAccumulatorUpdate").Device(DEVICE_CPU).TypeConstraint<int32>("Tidx")               \
+          .TypeConstraint<T>("T"),                                                                            \
+      ConfusionMatrixAccumulatorUpdateOp<int32, T>);                                                          \
+  REGISTER_KERNEL_BUILDER(                                                                                    \
+      Name("ConfusionMatrixAccumulatorUpdate").Device(DEVICE_CPU).TypeConstraint<int64>("Tidx")               \
+          .TypeConstraint<T>("T"),                                                                            \
+      ConfusionMatrixAccumulatorUpdateOp<int64, T>);
+
+REGISTER_KERNELS(float);
+REGISTER_KERNELS(double);
+#undef REGISTER_KERNELS
+
+}  // namespace tensorflow
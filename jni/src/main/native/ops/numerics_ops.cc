@@ -0,0 +1,144 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  // Tensors are checked in blocks of at most this many elements, so that large tensors are checked by many threads and
+  // small tensors are checked together by single threads.
+  const int64 kBlockSize = 1 << 16;
+
+  // Per-element cost estimate of the check, in cycles, which is used to shard the blocks over threads.
+  const int64 kElementCost = 2;
+
+  // Returns "true" if any of the elements in "[start, limit)" of "tensor" is "NaN" (or infinite, unless "ignore_inf" is
+  // "true").
+  template <typename T>
+  bool HasNonFinite(const Tensor& tensor, int64 start, int64 limit, bool ignore_inf) {
+    const T* data = tensor.flat<T>().data();
+    if (ignore_inf) {
+      for (int64 i = start; i < limit; ++i)
+        if (Eigen::numext::isnan(data[i])) return true;
+    } else {
+      for (int64 i = start; i < limit; ++i)
+        if (!Eigen::numext::isfinite(data[i])) return true;
+    }
+    return false;
+  }
+}  // namespace
+
+// Kernel that checks whether all elements of a list of `N` tensors are finite, and outputs a single boolean along with
+// the index of the first tensor that contains non-finite values. This replaces fetching the tensors themselves (or an
+// `IsNan` op and a reduction per tensor), which matters when monitoring many large tensors, such as gradients. The
+// tensors are split in blocks that are checked in parallel, and the remaining blocks of tensors that are already known
+// to contain non-finite values are skipped.
+class AllFiniteOp : public OpKernel {
+ public:
+  explicit AllFiniteOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("ignore_inf", &ignore_inf_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    OpInputList inputs;
+    OP_REQUIRES_OK(ctx, ctx->input_list("t", &inputs));
+    const int n = inputs.size();
+
+    struct Block {
+      int tensor;
+      int64 start;
+      int64 limit;
+    };
+    std::vector<Block> blocks;
+    for (int i = 0; i < n; ++i) {
+      const int64 size = inputs[i].NumElements();
+      for (int64 start = 0; start < size; start += kBlockSize)
+        blocks.push_back({i, start, std::min(size, start + kBlockSize)});
+    }
+
+    std::unique_ptr<std::atomic<bool>[]> non_finite(new std::atomic<bool>[n]);
+    for (int i = 0; i < n; ++i) non_finite[i] = false;
+    auto check = [this, &inputs, &blocks, &non_finite](int64 start, int64 limit) {
+      for (int64 b = start; b < limit; ++b) {
+        const Block& block = blocks[b];
+        if (non_finite[block.tensor].load(std::memory_order_relaxed)) continue;
+        const Tensor& tensor = inputs[block.tensor];
+        bool found = false;
+        switch (tensor.dtype()) {
+          case DT_HALF: found = HasNonFinite<Eigen::half>(tensor, block.start, block.limit, ignore_inf_); break;
+          case DT_FLOAT: found = HasNonFinite<float>(tensor, block.start, block.limit, ignore_inf_); break;
+          case DT_DOUBLE: found = HasNonFinite<double>(tensor, block.start, block.limit, ignore_inf_); break;
+          default: break;
+        }
+        if (found) non_finite[block.tensor].store(true, std::memory_order_relaxed);
+      }
+    };
+    const DeviceBase::CpuWorkerThreads* worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads->num_threads, worker_threads->workers, static_cast<int64>(blocks.size()),
+          kBlockSize * kElementCost, check);
+
+    int32 index = -1;
+    for (int i = 0; i < n && index < 0; ++i)
+      if (non_finite[i].load()) index = i;
+
+    Tensor* all_finite = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &all_finite));
+    all_finite->scalar<bool>()() = index < 0;
+    Tensor* non_finite_index = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, TensorShape({}), &non_finite_index));
+    non_finite_index->scalar<int32>()() = index;
+  }
+
+ private:
+  bool ignore_inf_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(AllFiniteOp);
+};
+
+REGISTER_OP("AllFinite")
+    .Input("t: T")
+    .Output("all_finite: bool")
+    .Output("non_finite_index: int32")
+    .Attr("T: list({half, float, double}) >= 1")
+    .Attr("ignore_inf: bool = false")
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      c->set_output(0, c->Scalar());
+      c->set_output(1, c->Scalar());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Checks whether all elements of all tensors in 't' are finite, in a single op.
+
+t: Tensors to check.
+ignore_inf: If true, only 'NaN' values are considered non-finite.
+all_finite: 'true' if no tensor in 't' contains non-finite values.
+non_finite_index: Index of the first tensor in 't' that contains non-finite values, or '-1' if 'all_finite' is 'true'.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("AllFinite").Device(DEVICE_CPU), AllFiniteOp);
+}  // namespace tensorflow
@@ -0,0 +1,294 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "tensorflow/core/framework/common_shape_fns.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/random/philox_random.h"
+#include "tensorflow/core/lib/random/random.h"
+#include "tensorflow/core/lib/random/random_distributions.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using random::PhiloxRandom;
+
+  // The output is split into chunks of 'kChunkSize' elements, independently of the number of threads, and chunk 'i'
+  // is generated using the Philox stream that starts after skipping 'i * kChunkSkip' samples of the generator. This
+  // makes the output deterministic (given the seeds) and lets the chunks be generated in any order. 'kChunkSkip' is
+  // large enough for rejection sampling to (practically) never overlap with the stream of the next chunk.
+  const int64 kChunkSize = 8192;
+  const uint64 kChunkSkip = 1ULL << 32;
+
+  // Per-element cost estimate of generating random values, in cycles, which is used to shard the chunks over threads.
+  const int64 kElementCost = 20;
+
+  // Smallest uniform value used in the Box-Muller transform, in order to avoid computing 'log(0)'.
+  const double kBoxMullerEpsilon = 1.0e-7;
+
+  // Truncated normal values are resampled if they are more than this many standard deviations away from the mean.
+  const double kTruncationBound = 2.0;
+
+  enum RandomDistribution { kUniform, kNormal, kTruncatedNormal };
+
+  // Fills 'output[0, size)' with uniform values in '[0, 1)'.
+  void FillUniform(PhiloxRandom* generator, float* output, int64 size) {
+    for (int64 i = 0; i < size; i += PhiloxRandom::kResultElementCount) {
+      const PhiloxRandom::ResultType sample = (*generator)();
+      const int64 count = std::min(static_cast<int64>(PhiloxRandom::kResultElementCount), size - i);
+      for (int64 j = 0; j < count; ++j) output[i + j] = random::Uint32ToFloat(sample[j]);
+    }
+  }
+
+  void FillUniform(PhiloxRandom* generator, double* output, int64 size) {
+    for (int64 i = 0; i < size; i += PhiloxRandom::kResultElementCount / 2) {
+      const PhiloxRandom::ResultType sample = (*generator)();
+      const int64 count = std::min(static_cast<int64>(PhiloxRandom::kResultElementCount / 2), size - i);
+      for (int64 j = 0; j < count; ++j) output[i + j] = random::Uint64ToDouble(sample[2 * j], sample[2 * j + 1]);
+    }
+  }
+
+  // Fills 'output[0, size)' with standard normal values, using the Box-Muller transform. The transform is applied to
+  // whole arrays of uniform values at once, so that the logarithms, square roots, sines, and cosines are computed
+  // using Eigen's vectorized implementations. 'scratch' must have room for at least 'size + 1' values.
+  template <typename T>
+  void FillStandardNormal(PhiloxRandom* generator, T* output, int64 size, T* scratch) {
+    typedef Eigen::Array<T, Eigen::Dynamic, 1> Array;
+    const int64 half_size = (size + 1) / 2;
+    FillUniform(generator, scratch, 2 * half_size);
+    Eigen::Map<Array> radius(scratch, half_size);
+    Eigen::Map<Array> angle(scratch + half_size, half_size);
+    radius = (static_cast<T>(-2) * radius.max(static_cast<T>(kBoxMullerEpsilon)).log()).sqrt();
+    angle *= static_cast<T>(2 * M_PI);
+    Eigen::Map<Array>(output, half_size) = radius * angle.sin();
+    Eigen::Map<Array>(output + half_size, size - half_size) = (radius * angle.cos()).head(size - half_size);
+  }
+
+  // Fills 'output[0, size)' with standard normal values that are at most 'kTruncationBound' away from zero, by
+  // generating batches of standard normal values and keeping the ones within the bound. 'scratch' must have room for
+  // at least '2 * kChunkSize + 1' values.
+  template <typename T>
+  void FillTruncatedStandardNormal(PhiloxRandom* generator, T* output, int64 size, T* scratch) {
+    T* batch = scratch + kChunkSize + 1;
+    const T bound = static_cast<T>(kTruncationBound);
+    int64 filled = 0;
+    while (filled < size) {
+      FillStandardNormal(generator, batch, kChunkSize, scratch);
+      for (int64 i = 0; i < kChunkSize && filled < size; ++i)
+        if (std::abs(batch[i]) <= bound) output[filled++] = batch[i];
+    }
+  }
+}  // namespace
+
+// Kernel that fills a tensor with random values, generating chunks of it in parallel using counter-based (i.e.,
+// Philox) random number generators, along with an affine transformation (i.e., 'value * scale + shift') of the
+// generated values.
+template <typename T, RandomDistribution D>
+class ParallelRandomOp : public OpKernel {
+ public:
+  explicit ParallelRandomOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("seed", &seed_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("seed2", &seed2_));
+    if (seed_ == 0 && seed2_ == 0) {
+      // Same as for the TensorFlow random ops, if no seed is provided, the op is seeded non-deterministically.
+      seed_ = static_cast<int64>(random::New64());
+      seed2_ = static_cast<int64>(random::New64());
+    }
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& shape_tensor = ctx->input(0);
+    OP_REQUIRES(ctx, TensorShapeUtils::IsVector(shape_tensor.shape()),
+                errors::InvalidArgument("'shape' must be a vector, but has shape ",
+                                        shape_tensor.shape().DebugString(), "."));
+    TensorShape shape;
+    if (shape_tensor.dtype() == DT_INT32)
+      OP_REQUIRES_OK(ctx, TensorShapeUtils::MakeShape(shape_tensor.vec<int32>(), &shape));
+    else
+      OP_REQUIRES_OK(ctx, TensorShapeUtils::MakeShape(shape_tensor.vec<int64>(), &shape));
+    const Tensor& first_parameter = ctx->input(1);
+    const Tensor& second_parameter = ctx->input(2);
+    OP_REQUIRES(ctx, TensorShapeUtils::IsScalar(first_parameter.shape()) &&
+                     TensorShapeUtils::IsScalar(second_parameter.shape()),
+                errors::InvalidArgument("The distribution parameters must be scalars, but have shapes ",
+                                        first_parameter.shape().DebugString(), " and ",
+                                        second_parameter.shape().DebugString(), "."));
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, shape, &output));
+    const int64 size = shape.num_elements();
+    if (size == 0) return;
+
+    // The uniform distribution is parameterized by '[minval, maxval)' and the normal distributions by their mean and
+    // standard deviation, which are both converted to a scale and a shift for the standard distributions.
+    T scale;
+    T shift;
+    if (D == kUniform) {
+      scale = second_parameter.scalar<T>()() - first_parameter.scalar<T>()();
+      shift = first_parameter.scalar<T>()();
+    } else {
+      scale = second_parameter.scalar<T>()();
+      shift = first_parameter.scalar<T>()();
+    }
+
+    T* output_data = output->flat<T>().data();
+    const uint64 seed = static_cast<uint64>(seed_);
+    const uint64 seed2 = static_cast<uint64>(seed2_);
+    const int64 num_chunks = (size + kChunkSize - 1) / kChunkSize;
+    auto work = [output_data, size, seed, seed2, scale, shift](int64 start, int64 limit) {
+      typedef Eigen::Array<T, Eigen::Dynamic, 1> Array;
+      std::vector<T> scratch(2 * kChunkSize + 1);
+      for (int64 chunk = start; chunk < limit; ++chunk) {
+        PhiloxRandom generator(seed, seed2);
+        generator.Skip(static_cast<uint64>(chunk) * kChunkSkip);
+        T* chunk_data = output_data + chunk * kChunkSize;
+        const int64 chunk_size = std::min(kChunkSize, size - chunk * kChunkSize);
+        switch (D) {
+          case kUniform:
+            FillUniform(&generator, chunk_data, chunk_size);
+            break;
+          case kNormal:
+            FillStandardNormal(&generator, chunk_data, chunk_size, scratch.data());
+            break;
+          case kTruncatedNormal:
+            FillTruncatedStandardNormal(&generator, chunk_data, chunk_size, scratch.data());
+            break;
+        }
+        Eigen::Map<Array> values(chunk_data, chunk_size);
+        values = values * scale + shift;
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, num_chunks, kChunkSize * kElementCost, work);
+  }
+
+ private:
+  int64 seed_;
+  int64 seed2_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ParallelRandomOp);
+};
+
+REGISTER_OP("ParallelRandomUniform")
+    .Input("shape: T")
+    .Input("minval: dtype")
+    .Input("maxval: dtype")
+    .Output("output: dtype")
+    .Attr("seed: int = 0")
+    .Attr("seed2: int = 0")
+    .Attr("dtype: {float, double}")
+    .Attr("T: {int32, int64}")
+    .SetIsStateful()
+    .SetShapeFn(shape_inference::RandomShape)
+    .Doc(R"doc(
+Outputs random values from a uniform distribution.
+
+This op computes values that follow the same distribution as those of the 'RandomUniform' op (after scaling them to
+'[minval, maxval)'), but it generates them in parallel. The output is split into fixed-size chunks, each of which is
+generated using its own Philox counter range, and so the generated values do not depend on the number of threads.
+
+shape: The shape of the output tensor.
+minval: 0-D. Inclusive lower bound on the generated values.
+maxval: 0-D. Exclusive upper bound on the generated values.
+output: A tensor of the specified shape filled with uniform random values.
+seed: If either 'seed' or 'seed2' are set to be non-zero, the random number generator is seeded by the given seed.
+  Otherwise, it is seeded by a random seed.
+seed2: A second seed to avoid seed collision.
+dtype: The type of the output.
+)doc");
+
+REGISTER_OP("ParallelRandomNormal")
+    .Input("shape: T")
+    .Input("mean: dtype")
+    .Input("stddev: dtype")
+    .Output("output: dtype")
+    .Attr("seed: int = 0")
+    .Attr("seed2: int = 0")
+    .Attr("dtype: {float, double}")
+    .Attr("T: {int32, int64}")
+    .SetIsStateful()
+    .SetShapeFn(shape_inference::RandomShape)
+    .Doc(R"doc(
+Outputs random values from a normal distribution.
+
+This op computes values that follow the same distribution as those of the 'RandomStandardNormal' op (after scaling and
+shifting them using 'stddev' and 'mean'), but it generates them in parallel, using a Box-Muller transform that is
+vectorized over whole arrays of uniform values. The output is split into fixed-size chunks, each of which is generated
+using its own Philox counter range, and so the generated values do not depend on the number of threads.
+
+shape: The shape of the output tensor.
+mean: 0-D. Mean of the normal distribution.
+stddev: 0-D. Standard deviation of the normal distribution.
+output: A tensor of the specified shape filled with normal random values.
+seed: If either 'seed' or 'seed2' are set to be non-zero, the random number generator is seeded by the given seed.
+  Otherwise, it is seeded by a random seed.
+seed2: A second seed to avoid seed collision.
+dtype: The type of the output.
+)doc");
+
+REGISTER_OP("ParallelTruncatedNormal")
+    .Input("shape: T")
+    .Input("mean: dtype")
+    .Input("stddev: dtype")
+    .Output("output: dtype")
+    .Attr("seed: int = 0")
+    .Attr("seed2: int = 0")
+    .Attr("dtype: {float, double}")
+    .Attr("T: {int32, int64}")
+    .SetIsStateful()
+    .SetShapeFn(shape_inference::RandomShape)
+    .Doc(R"doc(
+Outputs random values from a truncated normal distribution.
+
+This op computes values that follow the same distribution as those of the 'TruncatedNormal' op (after scaling and
+shifting them using 'stddev' and 'mean'). That is, values that are more than 2 standard deviations away from the mean
+are dropped and re-picked. It generates them in parallel, using a Box-Muller transform that is vectorized over whole
+arrays of uniform values. The output is split into fixed-size chunks, each of which is generated using its own Philox
+counter range, and so the generated values do not depend on the number of threads.
+
+shape: The shape of the output tensor.
+mean: 0-D. Mean of the normal distribution.
+stddev: 0-D. Standard deviation of the normal distribution.
+output: A tensor of the specified shape filled with truncated normal random values.
+seed: If either 'seed' or 'seed2' are set to be non-zero, the random number generator is seeded by the given seed.
+  Otherwise, it is seeded by a random seed.
+seed2: A second seed to avoid seed collision.
+dtype: The type of the output.
+)doc");
+
+#define REGISTER_KERNEL(T)                                                                                            \
+  REGISTER_KERNEL_BUILDER(Name("ParallelRandomUniform").Device(DEVICE_CPU).TypeConstraint<T>("dtype"),              \
+                          ParallelRandomOp<T, kUniform>);                                                             \
+  REGISTER_KERNEL_BUILDER(Name("ParallelRandomNormal").Device(DEVICE_CPU).TypeConstraint<T>("dtype"),               \
+                          ParallelRandomOp<T, kNormal>);                                                              \
+  REGISTER_KERNEL_BUILDER(Name("ParallelTruncatedNormal").Device(DEVICE_CPU).TypeConstraint<T>("dtype"),            \
+                          ParallelRandomOp<T, kTruncatedNormal>);
+
+REGISTER_KERNEL(float);
+REGISTER_KERNEL(double);
+#undef REGISTER_KERNEL
+
+}  // namespace tensorflow
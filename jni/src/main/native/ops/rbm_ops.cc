@@ -0,0 +1,183 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#if GOOGLE_CUDA
+#define EIGEN_USE_GPU
+#endif  // GOOGLE_CUDA
+
+#include "rbm_ops.h"
+
+#include <algorithm>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/random/random_distributions.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/guarded_philox_random.h"
+
+namespace tensorflow {
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+typedef Eigen::GpuDevice GPUDevice;
+
+namespace functor {
+template <typename T>
+struct RBMSampleBernoulli<CPUDevice, T> {
+  void operator()(const CPUDevice& d, random::PhiloxRandom generator, typename TTypes<T>::Flat x) {
+    const int64 size = x.size();
+    T* data = x.data();
+    auto work = [generator, size, data](Eigen::Index start, Eigen::Index limit) {
+      random::PhiloxRandom local_generator = generator;
+      local_generator.Skip(static_cast<uint64>(start));
+      for (Eigen::Index sample = start; sample < limit; ++sample) {
+        const random::PhiloxRandom::ResultType uniforms = local_generator();
+        const int64 offset = sample * random::PhiloxRandom::kResultElementCount;
+        const int64 count = std::min<int64>(random::PhiloxRandom::kResultElementCount, size - offset);
+        for (int64 i = 0; i < count; ++i)
+          data[offset + i] = static_cast<T>(random::Uint32ToFloat(uniforms[i])) < data[offset + i] ? T(1) : T(0);
+      }
+    };
+    const Eigen::TensorOpCost cost(
+        random::PhiloxRandom::kResultElementCount * sizeof(T), random::PhiloxRandom::kResultElementCount * sizeof(T),
+        random::PhiloxRandom::kElementCost + random::PhiloxRandom::kResultElementCount);
+    d.parallelFor(RBMNumPhiloxSamples(size), cost, work);
+  }
+};
+}  // namespace functor
+
+// Kernel that runs a whole Gibbs sampling chain of a binary RBM (e.g., for contrastive divergence), instead of a matrix
+// multiplication, a bias addition, a sigmoid, a random uniform op, and a comparison per half step. The random numbers
+// are drawn from a counter-based (i.e., Philox) generator right where the units are sampled, and so the only memory
+// traffic besides the matrix multiplications is one pass over the hidden and one over the visible units per half step.
+template <typename Device, typename T, bool USE_CUBLAS>
+class RBMGibbsChainOp : public OpKernel {
+ public:
+  explicit RBMGibbsChainOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("num_steps", &num_steps_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("mean_field", &mean_field_));
+    OP_REQUIRES_OK(ctx, generator_.Init(ctx));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& v0 = ctx->input(0);
+    const Tensor& visible_bias = ctx->input(1);
+    const Tensor& hidden_bias = ctx->input(2);
+    const Tensor& w = ctx->input(3);
+    OP_REQUIRES(ctx, v0.dims() == 2,
+                errors::InvalidArgument("'v' must be rank-2, but its shape is: ", v0.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsVector(visible_bias.shape()) &&
+                     TensorShapeUtils::IsVector(hidden_bias.shape()),
+                errors::InvalidArgument("'visible_bias' and 'hidden_bias' must be vectors, but are shaped ",
+                                        visible_bias.shape().DebugString(), " and ",
+                                        hidden_bias.shape().DebugString(), "."));
+    const int64 batch_size = v0.dim_size(0);
+    const int64 num_visible = v0.dim_size(1);
+    const int64 num_hidden = hidden_bias.dim_size(0);
+    OP_REQUIRES(ctx, visible_bias.dim_size(0) == num_visible,
+                errors::InvalidArgument("'visible_bias' must have ", num_visible, " elements, but has ",
+                                        visible_bias.dim_size(0), "."));
+    const TensorShape w_shape({num_visible, num_hidden});
+    OP_REQUIRES(ctx, w.shape() == w_shape,
+                errors::InvalidArgument("'weights' must be shaped ", w_shape.DebugString(), ", but is shaped ",
+                                        w.shape().DebugString(), "."));
+
+    Tensor* v = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, v0.shape(), &v));
+    if (v0.NumElements() == 0) return;
+    Tensor h;
+    OP_REQUIRES_OK(ctx, ctx->allocate_temp(DataTypeToEnum<T>::v(), TensorShape({batch_size, num_hidden}), &h));
+
+    const int64 samples_per_step =
+        functor::RBMNumPhiloxSamples(h.NumElements()) + functor::RBMNumPhiloxSamples(v->NumElements());
+    random::PhiloxRandom generator = generator_.ReserveSamples128(mean_field_ ? 0 : num_steps_ * samples_per_step);
+    functor::RBMGibbsChain<Device, T, USE_CUBLAS>()(
+        ctx, ctx->eigen_device<Device>(), num_steps_, mean_field_, generator, v0.matrix<T>(), visible_bias.vec<T>(),
+        hidden_bias.vec<T>(), w.matrix<T>(), h.matrix<T>(), v->matrix<T>());
+  }
+
+ private:
+  int num_steps_;
+  bool mean_field_;
+  GuardedPhiloxRandom generator_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(RBMGibbsChainOp);
+};
+
+REGISTER_OP("RBMGibbsChain")
+    .Input("v: T")
+    .Input("visible_bias: T")
+    .Input("hidden_bias: T")
+    .Input("weights: T")
+    .Output("v_sample: T")
+    .Attr("num_steps: int >= 1")
+    .Attr("mean_field: bool = false")
+    .Attr("seed: int = 0")
+    .Attr("seed2: int = 0")
+    .Attr("T: {float, double}")
+    .SetIsStateful()
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      shape_inference::ShapeHandle v;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &v));
+      c->set_output(0, v);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Runs a block Gibbs sampling chain of a binary restricted Boltzmann machine, in a single op.
+
+Each of the 'num_steps' steps computes 'h = sample(sigmoid(v * weights + hidden_bias))' and then
+'v = sample(sigmoid(h * transpose(weights) + visible_bias))', where 'sample' draws a binary value that is '1' with the
+provided probability.
+
+v: Initial visible units, shaped '[batch_size, num_visible]'.
+visible_bias: Visible unit biases, shaped '[num_visible]'.
+hidden_bias: Hidden unit biases, shaped '[num_hidden]'.
+weights: Weights, shaped '[num_visible, num_hidden]'.
+v_sample: Visible units after the last step.
+num_steps: Number of Gibbs sampling steps (i.e., 'k' for CD-k).
+mean_field: If true, the unit probabilities are used instead of samples.
+seed: If either 'seed' or 'seed2' are set to be non-zero, the random number generator is seeded by the given seed.
+  Otherwise, it is seeded by a random seed.
+seed2: A second seed to avoid seed collision.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T)                                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("RBMGibbsChain").Device(DEVICE_CPU).TypeConstraint<T>("T"),                                  \
+      RBMGibbsChainOp<CPUDevice, T, false>);
+
+REGISTER_CPU_KERNELS(float);
+REGISTER_CPU_KERNELS(double);
+#undef REGISTER_CPU_KERNELS
+
+#if GOOGLE_CUDA
+// The GPU functors are instantiated in `rbm_ops_gpu.cu.cc`, which is compiled by NVCC, while the matrix
+// multiplications use the cuBLAS functor of the fused LSTM cells.
+namespace functor {
+extern template struct RBMSampleBernoulli<GPUDevice, float>;
+extern template struct RBMGibbsChain<GPUDevice, float, true>;
+}  // namespace functor
+
+REGISTER_KERNEL_BUILDER(
+    Name("RBMGibbsChain").Device(DEVICE_GPU).TypeConstraint<float>("T"), RBMGibbsChainOp<GPUDevice, float, true>);
+#endif  // GOOGLE_CUDA
+}  // namespace tensorflow
@@ -0,0 +1,85 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_RBM_OPS_H_
+#define TENSORFLOW_RBM_OPS_H_
+
+#include "lstm_ops.h"
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/lib/random/philox_random.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+namespace functor {
+
+// Replaces each probability `x[i]` by a sample of a Bernoulli distribution with that probability (i.e., `1` or `0`).
+// Element `i` is compared to uniform value `i` of the Philox stream that starts at `generator`, and so the samples do
+// not depend on the number of threads. It is specialized for CPUs (in `rbm_ops.cc`) and for GPUs (in
+// `rbm_ops_gpu.cu.cc`).
+template <typename Device, typename T>
+struct RBMSampleBernoulli {
+  void operator()(const Device& d, random::PhiloxRandom generator, typename TTypes<T>::Flat x);
+};
+
+// Returns the number of 128-bit Philox samples used by `RBMSampleBernoulli` for `size` elements.
+inline int64 RBMNumPhiloxSamples(int64 size) {
+  return (size + random::PhiloxRandom::kResultElementCount - 1) / random::PhiloxRandom::kResultElementCount;
+}
+
+// Runs `num_steps` steps of block Gibbs sampling for a binary RBM, starting at visible units `v0`, and writes the final
+// visible units to `v`. Each step computes the hidden unit probabilities given the visible units and the visible unit
+// probabilities given the hidden units, sampling both unless `mean_field` is `true`. Each step consumes
+// `RBMNumPhiloxSamples(h.size()) + RBMNumPhiloxSamples(v.size())` samples of the Philox stream starting at
+// `generator`. The intermediate units never leave the device, and the matrix multiplications are launched through
+// cuBLAS or computed using Eigen contractions, in the same way as for the fused LSTM cells.
+template <typename Device, typename T, bool USE_CUBLAS>
+struct RBMGibbsChain {
+  void operator()(
+      OpKernelContext* ctx, const Device& d, int num_steps, bool mean_field, random::PhiloxRandom generator,
+      typename TTypes<T>::ConstMatrix v0, typename TTypes<T>::ConstVec visible_bias,
+      typename TTypes<T>::ConstVec hidden_bias, typename TTypes<T>::ConstMatrix w, typename TTypes<T>::Matrix h,
+      typename TTypes<T>::Matrix v) {
+    const Eigen::DenseIndex batch_size = v.dimension(0);
+    const Eigen::array<Eigen::DenseIndex, 2> vb_shape({1, visible_bias.dimension(0)});
+    const Eigen::array<Eigen::DenseIndex, 2> hb_shape({1, hidden_bias.dimension(0)});
+    const Eigen::array<Eigen::DenseIndex, 2> broadcast_shape({batch_size, 1});
+    const int64 h_samples = RBMNumPhiloxSamples(h.size());
+    const int64 v_samples = RBMNumPhiloxSamples(v.size());
+    for (int step = 0; step < num_steps; ++step) {
+      typename TTypes<T>::ConstMatrix v_prev(step == 0 ? v0.data() : v.data(), v.dimensions());
+      TensorBlasGemm<Device, T, USE_CUBLAS>::compute(ctx, d, false, false, v_prev, w, h);
+      h.device(d) = (h + hidden_bias.reshape(hb_shape).broadcast(broadcast_shape)).sigmoid();
+      if (!mean_field) {
+        RBMSampleBernoulli<Device, T>()(d, generator, typename TTypes<T>::Flat(h.data(), h.size()));
+        generator.Skip(h_samples);
+      }
+      typename TTypes<T>::ConstMatrix const_h(h.data(), h.dimensions());
+      TensorBlasGemm<Device, T, USE_CUBLAS>::compute(ctx, d, false, true, const_h, w, v);
+      v.device(d) = (v + visible_bias.reshape(vb_shape).broadcast(broadcast_shape)).sigmoid();
+      if (!mean_field) {
+        RBMSampleBernoulli<Device, T>()(d, generator, typename TTypes<T>::Flat(v.data(), v.size()));
+        generator.Skip(v_samples);
+      }
+    }
+  }
+};
+
+}  // namespace functor
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_RBM_OPS_H_
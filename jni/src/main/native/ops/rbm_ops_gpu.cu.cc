@@ -0,0 +1,65 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#if GOOGLE_CUDA
+
+#define EIGEN_USE_GPU
+
+#include "rbm_ops.h"
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/lib/random/random_distributions.h"
+#include "tensorflow/core/util/cuda_kernel_helper.h"
+
+namespace tensorflow {
+namespace functor {
+
+typedef Eigen::GpuDevice GPUDevice;
+
+namespace {
+  // Each thread draws one 128-bit Philox sample at a time and uses it for the next four elements, so that the uniform
+  // values stay in registers.
+  template <typename T>
+  __global__ void RBMSampleBernoulliKernel(random::PhiloxRandom generator, int64 size, int num_samples, T* data) {
+    CUDA_1D_KERNEL_LOOP(sample, num_samples) {
+      random::PhiloxRandom local_generator = generator;
+      local_generator.Skip(static_cast<uint64>(sample));
+      const random::PhiloxRandom::ResultType uniforms = local_generator();
+      const int64 offset = static_cast<int64>(sample) * random::PhiloxRandom::kResultElementCount;
+      for (int i = 0; i < random::PhiloxRandom::kResultElementCount && offset + i < size; ++i)
+        data[offset + i] = static_cast<T>(random::Uint32ToFloat(uniforms[i])) < data[offset + i] ? T(1) : T(0);
+    }
+  }
+}  // namespace
+
+template <typename T>
+struct RBMSampleBernoulli<GPUDevice, T> {
+  void operator()(const GPUDevice& d, random::PhiloxRandom generator, typename TTypes<T>::Flat x) {
+    const int num_samples = static_cast<int>(RBMNumPhiloxSamples(x.size()));
+    CudaLaunchConfig config = GetCudaLaunchConfig(num_samples, d);
+    RBMSampleBernoulliKernel<T><<<config.block_count, config.thread_per_block, 0, d.stream()>>>(
+        generator, x.size(), num_samples, x.data());
+  }
+};
+
+// The sigmoids of the Gibbs steps are Eigen expressions, which NVCC compiles into CUDA kernels, while the matrix
+// multiplications are launched through cuBLAS.
+template struct RBMSampleBernoulli<GPUDevice, float>;
+template struct RBMGibbsChain<GPUDevice, float, true>;
+
+}  // namespace functor
+}  // namespace tensorflow
+
+#endif  // GOOGLE_CUDA
@@ -0,0 +1,522 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+#include "third_party/eigen3/Eigen/Core"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::DimensionHandle;
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Validates the shape of a rank-2 `dense_shape` tensor and returns its number of rows and columns.
+  Status GetMatrixDimensions(const Tensor& dense_shape, int64* num_rows, int64* num_columns) {
+    if (!TensorShapeUtils::IsVector(dense_shape.shape()) || dense_shape.NumElements() != 2)
+      return errors::InvalidArgument("'dense_shape' must be a vector with 2 elements, but it has shape ",
+                                     dense_shape.shape().DebugString(), ".");
+    const auto dense_shape_vec = dense_shape.vec<int64>();
+    *num_rows = dense_shape_vec(0);
+    *num_columns = dense_shape_vec(1);
+    if (*num_rows < 0 || *num_columns < 0)
+      return errors::InvalidArgument("'dense_shape' must be non-negative, but it is [", *num_rows, ", ", *num_columns,
+                                     "].");
+    return Status::OK();
+  }
+}  // namespace
+
+// Kernel that converts a rank-2 sparse tensor in coordinate (COO) format to the compressed sparse row (CSR) format,
+// using a stable counting sort over the row indices. The COO indices are not required to be ordered, but if they are
+// ordered lexicographically, then the column indices within each row of the result are ordered as well.
+template <typename T>
+class SparseTensorToCSROp : public OpKernel {
+ public:
+  explicit SparseTensorToCSROp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& indices = ctx->input(0);
+    const Tensor& values = ctx->input(1);
+    int64 num_rows;
+    int64 num_columns;
+    OP_REQUIRES_OK(ctx, GetMatrixDimensions(ctx->input(2), &num_rows, &num_columns));
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsMatrix(indices.shape()) && indices.dim_size(1) == 2,
+        errors::InvalidArgument("'indices' must be a matrix with 2 columns, but it has shape ",
+                                indices.shape().DebugString(), "."));
+    const int64 nnz = indices.dim_size(0);
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsVector(values.shape()) && values.NumElements() == nnz,
+        errors::InvalidArgument("'values' must be a vector with ", nnz, " elements, but it has shape ",
+                                values.shape().DebugString(), "."));
+
+    const auto indices_mat = indices.matrix<int64>();
+    const auto values_vec = values.vec<T>();
+
+    Tensor* row_pointers = nullptr;
+    Tensor* column_indices = nullptr;
+    Tensor* csr_values = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({num_rows + 1}), &row_pointers));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, TensorShape({nnz}), &column_indices));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(2, TensorShape({nnz}), &csr_values));
+    auto row_pointers_vec = row_pointers->vec<int64>();
+    auto column_indices_vec = column_indices->vec<int64>();
+    auto csr_values_vec = csr_values->vec<T>();
+
+    // Count the number of non-zero entries in each row, while validating the indices.
+    row_pointers_vec.setZero();
+    for (int64 i = 0; i < nnz; ++i) {
+      const int64 row = indices_mat(i, 0);
+      const int64 column = indices_mat(i, 1);
+      OP_REQUIRES(
+          ctx, row >= 0 && row < num_rows && column >= 0 && column < num_columns,
+          errors::InvalidArgument("Index [", row, ", ", column, "] at position ", i, " is out of bounds for a ",
+                                  num_rows, " x ", num_columns, " sparse tensor."));
+      ++row_pointers_vec(row + 1);
+    }
+    for (int64 row = 0; row < num_rows; ++row) row_pointers_vec(row + 1) += row_pointers_vec(row);
+
+    // Scatter the entries to their rows, preserving their relative order within each row.
+    std::vector<int64> offsets(row_pointers_vec.data(), row_pointers_vec.data() + num_rows);
+    for (int64 i = 0; i < nnz; ++i) {
+      const int64 position = offsets[indices_mat(i, 0)]++;
+      column_indices_vec(position) = indices_mat(i, 1);
+      csr_values_vec(position) = values_vec(i);
+    }
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(SparseTensorToCSROp);
+};
+
+// Kernel that multiplies a rank-2 sparse tensor in compressed sparse row (CSR) format with a dense matrix. Rows of the
+// output are sharded over the CPU worker threads, and each output row is accumulated in place as a sequence of
+// vectorized `axpy` updates over rows of the dense matrix, so that the dense operand is read contiguously and no
+// scatter into the output is needed. When `adjoint_a` is set, the output columns are sharded instead, so that each
+// thread owns a disjoint slice of every output row.
+template <typename T>
+class CSRSparseDenseMatMulOp : public OpKernel {
+ public:
+  explicit CSRSparseDenseMatMulOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("adjoint_a", &adjoint_a_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& row_pointers = ctx->input(0);
+    const Tensor& column_indices = ctx->input(1);
+    const Tensor& values = ctx->input(2);
+    const Tensor& b = ctx->input(4);
+    int64 num_rows;
+    int64 num_columns;
+    OP_REQUIRES_OK(ctx, GetMatrixDimensions(ctx->input(3), &num_rows, &num_columns));
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsVector(row_pointers.shape()) && row_pointers.NumElements() == num_rows + 1,
+        errors::InvalidArgument("'row_pointers' must be a vector with ", num_rows + 1, " elements, but it has shape ",
+                                row_pointers.shape().DebugString(), "."));
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsVector(column_indices.shape()),
+        errors::InvalidArgument("'column_indices' must be a vector, but it has shape ",
+                                column_indices.shape().DebugString(), "."));
+    const int64 nnz = column_indices.NumElements();
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsVector(values.shape()) && values.NumElements() == nnz,
+        errors::InvalidArgument("'values' must be a vector with ", nnz, " elements, but it has shape ",
+                                values.shape().DebugString(), "."));
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsMatrix(b.shape()),
+        errors::InvalidArgument("'b' must be a matrix, but it has shape ", b.shape().DebugString(), "."));
+    const int64 inner_dim = adjoint_a_ ? num_rows : num_columns;
+    const int64 output_rows = adjoint_a_ ? num_columns : num_rows;
+    OP_REQUIRES(
+        ctx, b.dim_size(0) == inner_dim,
+        errors::InvalidArgument("Cannot multiply a ", num_rows, " x ", num_columns, " sparse matrix",
+                                adjoint_a_ ? " (adjoint)" : "", " with a dense matrix with shape ",
+                                b.shape().DebugString(), "."));
+
+    const auto row_pointers_vec = row_pointers.vec<int64>();
+    const auto column_indices_vec = column_indices.vec<int64>();
+    OP_REQUIRES(
+        ctx, row_pointers_vec(0) == 0 && row_pointers_vec(num_rows) == nnz,
+        errors::InvalidArgument("'row_pointers' must start at 0 and end at the number of non-zero entries (", nnz,
+                                ")."));
+    for (int64 row = 0; row < num_rows; ++row)
+      OP_REQUIRES(
+          ctx, row_pointers_vec(row) <= row_pointers_vec(row + 1),
+          errors::InvalidArgument("'row_pointers' must be non-decreasing, but it decreases at row ", row, "."));
+    for (int64 i = 0; i < nnz; ++i)
+      OP_REQUIRES(
+          ctx, column_indices_vec(i) >= 0 && column_indices_vec(i) < num_columns,
+          errors::InvalidArgument("Column index ", column_indices_vec(i), " at position ", i,
+                                  " is out of bounds for a sparse matrix with ", num_columns, " columns."));
+
+    const int64 n = b.dim_size(1);
+    Tensor* output = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({output_rows, n}), &output));
+    if (output->NumElements() == 0) return;
+
+    typedef Eigen::Map<Eigen::Array<T, 1, Eigen::Dynamic>> RowMap;
+    typedef Eigen::Map<const Eigen::Array<T, 1, Eigen::Dynamic>> ConstRowMap;
+    const int64* pointers = row_pointers_vec.data();
+    const int64* columns = column_indices_vec.data();
+    const T* a_values = values.vec<T>().data();
+    const T* b_data = b.matrix<T>().data();
+    T* output_data = output->matrix<T>().data();
+
+    const DeviceBase::CpuWorkerThreads* worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+    if (!adjoint_a_) {
+      const int64 cost_per_row = std::max<int64>(1, nnz / std::max<int64>(1, num_rows)) * n * 2;
+      Shard(worker_threads->num_threads, worker_threads->workers, num_rows, cost_per_row,
+            [=](int64 start, int64 limit) {
+              for (int64 row = start; row < limit; ++row) {
+                RowMap output_row(output_data + row * n, n);
+                output_row.setZero();
+                for (int64 i = pointers[row]; i < pointers[row + 1]; ++i)
+                  output_row += a_values[i] * ConstRowMap(b_data + columns[i] * n, n);
+              }
+            });
+    } else {
+      std::fill_n(output_data, output->NumElements(), T(0));
+      const int64 cost_per_column = std::max<int64>(1, nnz) * 2;
+      Shard(worker_threads->num_threads, worker_threads->workers, n, cost_per_column,
+            [=](int64 start, int64 limit) {
+              const int64 width = limit - start;
+              for (int64 row = 0; row < num_rows; ++row) {
+                ConstRowMap b_row(b_data + row * n + start, width);
+                for (int64 i = pointers[row]; i < pointers[row + 1]; ++i)
+                  RowMap(output_data + columns[i] * n + start, width) += a_values[i] * b_row;
+              }
+            });
+    }
+  }
+
+ private:
+  bool adjoint_a_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(CSRSparseDenseMatMulOp);
+};
+
+// Kernel that sums the slices of `values` that correspond to the same index in `indices` (i.e., that de-duplicates a
+// set of indexed slices). The slice positions are first grouped by index, in ascending index order, and the sums are
+// then computed in parallel over the unique indices, so that each output slice is accumulated in place by one thread.
+// Small inputs are grouped by sorting the positions by index, which does not allocate any hash table nodes, while
+// larger inputs are grouped using a hash table, which takes linear time, and only the unique indices are then sorted.
+template <typename T, typename Tindices>
+class IndexedSlicesUniqueSumOp : public OpKernel {
+ public:
+  explicit IndexedSlicesUniqueSumOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& indices = ctx->input(0);
+    const Tensor& values = ctx->input(1);
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsVector(indices.shape()),
+        errors::InvalidArgument("'indices' must be a vector, but it has shape ", indices.shape().DebugString(), "."));
+    const int64 n = indices.NumElements();
+    OP_REQUIRES(
+        ctx, values.dims() >= 1 && values.dim_size(0) == n,
+        errors::InvalidArgument("'values' must have ", n, " slices (i.e., as many as 'indices'), but it has shape ",
+                                values.shape().DebugString(), "."));
+    TensorShape slice_shape = values.shape();
+    slice_shape.RemoveDim(0);
+    const int64 slice_size = slice_shape.num_elements();
+
+    const auto indices_vec = indices.vec<Tindices>();
+    std::vector<Tindices> unique_indices;
+    std::vector<int64> positions(n);
+    std::vector<int64> offsets;
+    if (n < kMinHashedSize)
+      GroupBySorting(indices_vec, &unique_indices, &positions, &offsets);
+    else
+      GroupByHashing(indices_vec, &unique_indices, &positions, &offsets);
+    const int64 num_unique = static_cast<int64>(unique_indices.size());
+
+    Tensor* unique_indices_output = nullptr;
+    Tensor* summed_values = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({num_unique}), &unique_indices_output));
+    TensorShape summed_values_shape = slice_shape;
+    summed_values_shape.InsertDim(0, num_unique);
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, summed_values_shape, &summed_values));
+    std::copy(unique_indices.begin(), unique_indices.end(), unique_indices_output->vec<Tindices>().data());
+    if (summed_values->NumElements() == 0) return;
+
+    typedef Eigen::Map<Eigen::Array<T, Eigen::Dynamic, 1>> SliceMap;
+    typedef Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>> ConstSliceMap;
+    const T* values_data = values.flat<T>().data();
+    T* summed_values_data = summed_values->flat<T>().data();
+    const int64* positions_data = positions.data();
+    const int64* offsets_data = offsets.data();
+    const DeviceBase::CpuWorkerThreads* worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+    const int64 cost_per_unique_index = std::max<int64>(1, n / num_unique) * slice_size;
+    Shard(worker_threads->num_threads, worker_threads->workers, num_unique, cost_per_unique_index,
+          [=](int64 start, int64 limit) {
+            for (int64 u = start; u < limit; ++u) {
+              SliceMap sum(summed_values_data + u * slice_size, slice_size);
+              sum = ConstSliceMap(values_data + positions_data[offsets_data[u]] * slice_size, slice_size);
+              for (int64 i = offsets_data[u] + 1; i < offsets_data[u + 1]; ++i)
+                sum += ConstSliceMap(values_data + positions_data[i] * slice_size, slice_size);
+            }
+          });
+  }
+
+ private:
+  // Inputs with fewer slices than this are grouped by sorting, rather than by hashing.
+  static const int64 kMinHashedSize = 4096;
+
+  typedef typename TTypes<Tindices>::ConstVec ConstIndicesVec;
+
+  // Groups the positions of the slices by sorting them by index (and position, for equal indices). `offsets` receives
+  // the offset of the positions of each unique index in `positions`, followed by the total number of positions.
+  static void GroupBySorting(const ConstIndicesVec& indices, std::vector<Tindices>* unique_indices,
+                             std::vector<int64>* positions, std::vector<int64>* offsets) {
+    const int64 n = indices.size();
+    std::iota(positions->begin(), positions->end(), 0);
+    std::stable_sort(positions->begin(), positions->end(),
+                     [&indices](int64 a, int64 b) { return indices(a) < indices(b); });
+    for (int64 i = 0; i < n; ++i) {
+      const Tindices index = indices((*positions)[i]);
+      if (i == 0 || index != unique_indices->back()) {
+        unique_indices->push_back(index);
+        offsets->push_back(i);
+      }
+    }
+    offsets->push_back(n);
+  }
+
+  // Groups the positions of the slices by assigning segments to the indices in order of first appearance using a hash
+  // table, then sorting the unique indices, and finally placing the positions by the rank of their index, using a
+  // counting sort. The result is the same as that of `GroupBySorting`.
+  static void GroupByHashing(const ConstIndicesVec& indices, std::vector<Tindices>* unique_indices,
+                             std::vector<int64>* positions, std::vector<int64>* offsets) {
+    const int64 n = indices.size();
+    std::unordered_map<Tindices, int64> segments;
+    std::vector<int64> segment_ids(n);
+    for (int64 i = 0; i < n; ++i) {
+      auto segment = segments.emplace(indices(i), static_cast<int64>(segments.size()));
+      segment_ids[i] = segment.first->second;
+    }
+    const int64 num_unique = static_cast<int64>(segments.size());
+    unique_indices->resize(num_unique);
+    for (const auto& segment : segments) (*unique_indices)[segment.second] = segment.first;
+    std::vector<int64> order(num_unique);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [unique_indices](int64 a, int64 b) { return (*unique_indices)[a] < (*unique_indices)[b]; });
+    std::vector<int64> ranks(num_unique);
+    std::vector<Tindices> sorted_unique_indices(num_unique);
+    for (int64 r = 0; r < num_unique; ++r) {
+      ranks[order[r]] = r;
+      sorted_unique_indices[r] = (*unique_indices)[order[r]];
+    }
+    unique_indices->swap(sorted_unique_indices);
+    offsets->assign(num_unique + 1, 0);
+    for (int64 i = 0; i < n; ++i) ++(*offsets)[ranks[segment_ids[i]] + 1];
+    for (int64 r = 0; r < num_unique; ++r) (*offsets)[r + 1] += (*offsets)[r];
+    std::vector<int64> cursors(offsets->begin(), offsets->end() - 1);
+    for (int64 i = 0; i < n; ++i) (*positions)[cursors[ranks[segment_ids[i]]]++] = i;
+  }
+
+  TF_DISALLOW_COPY_AND_ASSIGN(IndexedSlicesUniqueSumOp);
+};
+
+REGISTER_OP("SparseTensorToCSR")
+    .Input("indices: int64")
+    .Input("values: T")
+    .Input("dense_shape: int64")
+    .Output("row_pointers: int64")
+    .Output("column_indices: int64")
+    .Output("csr_values: T")
+    .Attr("T: {float, double, int32, int64}")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle indices;
+      ShapeHandle values;
+      ShapeHandle dense_shape;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &indices));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &values));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &dense_shape));
+      ShapeHandle matrix_shape;
+      TF_RETURN_IF_ERROR(c->MakeShapeFromShapeTensor(2, &matrix_shape));
+      TF_RETURN_IF_ERROR(c->WithRank(matrix_shape, 2, &matrix_shape));
+      DimensionHandle num_row_pointers;
+      TF_RETURN_IF_ERROR(c->Add(c->Dim(matrix_shape, 0), 1, &num_row_pointers));
+      DimensionHandle nnz = c->Dim(indices, 0);
+      TF_RETURN_IF_ERROR(c->Merge(nnz, c->Dim(values, 0), &nnz));
+      c->set_output(0, c->Vector(num_row_pointers));
+      c->set_output(1, c->Vector(nnz));
+      c->set_output(2, c->Vector(nnz));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Converts a rank-2 sparse tensor from the coordinate (COO) format to the compressed sparse row (CSR) format.
+
+The entries of each row keep their relative order. The indices do not need to be ordered, but if they are ordered
+lexicographically, then the column indices within each row of the result are ordered as well.
+
+indices: 2-D. The `[nnz, 2]` indices of the non-zero entries of the sparse tensor.
+values: 1-D. The `[nnz]` values of the non-zero entries of the sparse tensor.
+dense_shape: 1-D. The `[2]` shape of the sparse tensor.
+row_pointers: 1-D. The `[dense_shape[0] + 1]` offsets of each row in `column_indices` and `csr_values`.
+column_indices: 1-D. The `[nnz]` column indices of the non-zero entries, grouped by row.
+csr_values: 1-D. The `[nnz]` values of the non-zero entries, grouped by row.
+)doc");
+
+REGISTER_OP("CSRSparseDenseMatMul")
+    .Input("row_pointers: int64")
+    .Input("column_indices: int64")
+    .Input("values: T")
+    .Input("dense_shape: int64")
+    .Input("b: T")
+    .Output("product: T")
+    .Attr("T: {float, double}")
+    .Attr("adjoint_a: bool = false")
+    .SetShapeFn([](InferenceContext* c) {
+      bool adjoint_a;
+      TF_RETURN_IF_ERROR(c->GetAttr("adjoint_a", &adjoint_a));
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(3), 1, &unused));
+      ShapeHandle a_shape;
+      TF_RETURN_IF_ERROR(c->MakeShapeFromShapeTensor(3, &a_shape));
+      TF_RETURN_IF_ERROR(c->WithRank(a_shape, 2, &a_shape));
+      ShapeHandle b_shape;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(4), 2, &b_shape));
+      DimensionHandle output_rows = c->Dim(a_shape, adjoint_a ? 1 : 0);
+      DimensionHandle inner_dim = c->Dim(a_shape, adjoint_a ? 0 : 1);
+      DimensionHandle unused_dim;
+      TF_RETURN_IF_ERROR(c->Merge(inner_dim, c->Dim(b_shape, 0), &unused_dim));
+      c->set_output(0, c->Matrix(output_rows, c->Dim(b_shape, 1)));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Multiplies a rank-2 sparse tensor in compressed sparse row (CSR) format with a dense matrix.
+
+The work is split over rows of the output, or over its columns when `adjoint_a` is `true`, and each thread
+accumulates rows of `b` scaled by the non-zero entries of `a` into its part of the output.
+
+row_pointers: 1-D. The `[dense_shape[0] + 1]` offsets of each row of `a` in `column_indices` and `values`.
+column_indices: 1-D. The `[nnz]` column indices of the non-zero entries of `a`, grouped by row.
+values: 1-D. The `[nnz]` values of the non-zero entries of `a`, grouped by row.
+dense_shape: 1-D. The `[2]` shape of `a`.
+b: 2-D. The dense matrix.
+product: 2-D. The product of `a` (or its adjoint) and `b`.
+adjoint_a: If `true`, `a` is transposed before the multiplication.
+)doc");
+
+REGISTER_OP("IndexedSlicesUniqueSum")
+    .Input("indices: Tindices")
+    .Input("values: T")
+    .Output("unique_indices: Tindices")
+    .Output("summed_values: T")
+    .Attr("T: {half, float, double}")
+    .Attr("Tindices: {int32, int64}")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle indices;
+      ShapeHandle values;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 1, &indices));
+      TF_RETURN_IF_ERROR(c->WithRankAtLeast(c->input(1), 1, &values));
+      DimensionHandle unused;
+      TF_RETURN_IF_ERROR(c->Merge(c->Dim(indices, 0), c->Dim(values, 0), &unused));
+      ShapeHandle slice_shape;
+      TF_RETURN_IF_ERROR(c->Subshape(values, 1, &slice_shape));
+      ShapeHandle summed_values;
+      TF_RETURN_IF_ERROR(c->Concatenate(c->Vector(c->UnknownDim()), slice_shape, &summed_values));
+      c->set_output(0, c->Vector(c->UnknownDim()));
+      c->set_output(1, summed_values);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Sums the slices of indexed slices that correspond to the same index.
+
+This fuses `Unique` and `UnsortedSegmentSum`. Small inputs are grouped by sorting, and larger ones using a hash table.
+The slices of each unique index are then summed in parallel. On GPU devices, all tensors are kept in host memory.
+
+indices: 1-D. The `[n]` indices of the slices, which may contain duplicates.
+values: The `[n, ...]` slices.
+unique_indices: 1-D. The `[u]` unique indices, in ascending order.
+summed_values: The `[u, ...]` sums of the slices of each unique index.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T)                                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("SparseTensorToCSR").Device(DEVICE_CPU).TypeConstraint<T>("T"),                           \
+      SparseTensorToCSROp<T>);
+
+REGISTER_CPU_KERNELS(float);
+REGISTER_CPU_KERNELS(double);
+REGISTER_CPU_KERNELS(int32);
+REGISTER_CPU_KERNELS(int64);
+#undef REGISTER_CPU_KERNELS
+
+#define REGISTER_CPU_KERNELS(T)                                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("CSRSparseDenseMatMul").Device(DEVICE_CPU).TypeConstraint<T>("T"),                        \
+      CSRSparseDenseMatMulOp<T>);
+
+REGISTER_CPU_KERNELS(float);
+REGISTER_CPU_KERNELS(double);
+#undef REGISTER_CPU_KERNELS
+
+#define REGISTER_KERNELS(T, Tindices)                                                                 \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("IndexedSlicesUniqueSum")                                                                  \
+          .Device(DEVICE_CPU)                                                                         \
+          .TypeConstraint<T>("T")                                                                     \
+          .TypeConstraint<Tindices>("Tindices"),                                                      \
+      IndexedSlicesUniqueSumOp<T, Tindices>);
+
+#if GOOGLE_CUDA
+// The GPU kernels run on the host, so that sparse gradients of variables placed on GPUs can be de-duplicated as well.
+#define REGISTER_GPU_KERNELS(T, Tindices)                                                             \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("IndexedSlicesUniqueSum")                                                                  \
+          .Device(DEVICE_GPU)                                                                         \
+          .TypeConstraint<T>("T")                                                                     \
+          .TypeConstraint<Tindices>("Tindices")                                                       \
+          .HostMemory("indices")                                                                      \
+          .HostMemory("values")                                                                       \
+          .HostMemory("unique_indices")                                                               \
+          .HostMemory("summed_values"),                                                               \
+      IndexedSlicesUniqueSumOp<T, Tindices>);
+#else
+#define REGISTER_GPU_KERNELS(T, Tindices)
+#endif  // GOOGLE_CUDA
+
+#define REGISTER_ALL_KERNELS(T)                                                                       \
+  REGISTER_KERNELS(T, int32);                                                                         \
+  REGISTER_KERNELS(T, int64);                                                                         \
+  REGISTER_GPU_KERNELS(T, int32);                                                                     \
+  REGISTER_GPU_KERNELS(T, int64);
+
+REGISTER_ALL_KERNELS(Eigen::half);
+REGISTER_ALL_KERNELS(float);
+REGISTER_ALL_KERNELS(double);
+#undef REGISTER_ALL_KERNELS
+#undef REGISTER_GPU_KERNELS
+#undef REGISTER_KERNELS
+}  // namespace tensorflow
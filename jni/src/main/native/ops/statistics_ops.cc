@@ -0,0 +1,180 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "third_party/eigen3/Eigen/Core"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Minimum number of rows and maximum number of row blocks. The row blocks only depend on the input shape, and the
+  // partial moments of the blocks are always merged in the same order, so that the results do not depend on the number
+  // of threads used.
+  const int64 kMinBlockRows = 256;
+  const int64 kMaxBlocks = 256;
+
+  // Number of columns processed together by each shard.
+  const int64 kBlockColumns = 1024;
+}  // namespace
+
+// Kernel that computes the mean and the (biased) variance of each column of a matrix in a single pass over its
+// elements, using Welford's algorithm. The matrix is split into blocks of rows and columns, which are processed in
+// parallel over the CPU worker threads, with each row update being a vectorized Eigen expression over the columns of
+// the block. The partial moments of the row blocks are then merged using the pairwise update of Chan et al.
+template <typename T>
+class WelfordMomentsOp : public OpKernel {
+ public:
+  explicit WelfordMomentsOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& input = ctx->input(0);
+    OP_REQUIRES(
+        ctx, TensorShapeUtils::IsMatrix(input.shape()),
+        errors::InvalidArgument("'input' must be a matrix, but it has shape ", input.shape().DebugString(), "."));
+    const int64 num_rows = input.dim_size(0);
+    const int64 num_columns = input.dim_size(1);
+
+    Tensor* mean = nullptr;
+    Tensor* variance = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({num_columns}), &mean));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, TensorShape({num_columns}), &variance));
+    if (num_columns == 0) return;
+    if (num_rows == 0) {
+      mean->vec<T>().setConstant(std::numeric_limits<T>::quiet_NaN());
+      variance->vec<T>().setConstant(std::numeric_limits<T>::quiet_NaN());
+      return;
+    }
+
+    typedef Eigen::Array<T, 1, Eigen::Dynamic> Row;
+    typedef Eigen::Map<Row> RowMap;
+    typedef Eigen::Map<const Row> ConstRowMap;
+
+    const int64 block_rows = std::max(kMinBlockRows, (num_rows + kMaxBlocks - 1) / kMaxBlocks);
+    const int64 num_row_blocks = (num_rows + block_rows - 1) / block_rows;
+    const int64 num_column_blocks = (num_columns + kBlockColumns - 1) / kBlockColumns;
+
+    // Partial means and sums of squared deviations of each row block.
+    std::vector<T> block_means(num_row_blocks * num_columns);
+    std::vector<T> block_m2s(num_row_blocks * num_columns);
+    const T* data = input.matrix<T>().data();
+    T* means_data = block_means.data();
+    T* m2s_data = block_m2s.data();
+
+    const DeviceBase::CpuWorkerThreads* worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+    const int64 cost_per_block = block_rows * std::min(num_columns, kBlockColumns) * 5;
+    Shard(worker_threads->num_threads, worker_threads->workers, num_row_blocks * num_column_blocks, cost_per_block,
+          [=](int64 start, int64 limit) {
+            Row delta;
+            for (int64 index = start; index < limit; ++index) {
+              const int64 row_block = index / num_column_blocks;
+              const int64 column_start = (index % num_column_blocks) * kBlockColumns;
+              const int64 width = std::min(kBlockColumns, num_columns - column_start);
+              const int64 row_start = row_block * block_rows;
+              const int64 row_limit = std::min(num_rows, row_start + block_rows);
+              RowMap block_mean(means_data + row_block * num_columns + column_start, width);
+              RowMap block_m2(m2s_data + row_block * num_columns + column_start, width);
+              block_mean.setZero();
+              block_m2.setZero();
+              for (int64 row = row_start; row < row_limit; ++row) {
+                ConstRowMap x(data + row * num_columns + column_start, width);
+                const T inverse_count = T(1) / static_cast<T>(row - row_start + 1);
+                delta = x - block_mean;
+                block_mean += delta * inverse_count;
+                block_m2 += delta * (x - block_mean);
+              }
+            }
+          });
+
+    // Merge the partial moments of the row blocks, in order, in parallel over the column blocks.
+    T* mean_data = mean->vec<T>().data();
+    T* variance_data = variance->vec<T>().data();
+    Shard(worker_threads->num_threads, worker_threads->workers, num_column_blocks, num_row_blocks * kBlockColumns * 8,
+          [=](int64 start, int64 limit) {
+            Row delta;
+            for (int64 column_block = start; column_block < limit; ++column_block) {
+              const int64 column_start = column_block * kBlockColumns;
+              const int64 width = std::min(kBlockColumns, num_columns - column_start);
+              RowMap merged_mean(mean_data + column_start, width);
+              RowMap merged_m2(variance_data + column_start, width);
+              merged_mean = ConstRowMap(means_data + column_start, width);
+              merged_m2 = ConstRowMap(m2s_data + column_start, width);
+              T count = static_cast<T>(std::min(block_rows, num_rows));
+              for (int64 row_block = 1; row_block < num_row_blocks; ++row_block) {
+                const T block_count = static_cast<T>(
+                    std::min(block_rows, num_rows - row_block * block_rows));
+                const T total_count = count + block_count;
+                ConstRowMap block_mean(means_data + row_block * num_columns + column_start, width);
+                ConstRowMap block_m2(m2s_data + row_block * num_columns + column_start, width);
+                delta = block_mean - merged_mean;
+                merged_mean += delta * (block_count / total_count);
+                merged_m2 += block_m2 + delta.square() * (count * block_count / total_count);
+                count = total_count;
+              }
+              merged_m2 /= count;
+            }
+          });
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(WelfordMomentsOp);
+};
+
+REGISTER_OP("WelfordMoments")
+    .Input("input: T")
+    .Output("mean: T")
+    .Output("variance: T")
+    .Attr("T: {float, double}")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle input;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &input));
+      c->set_output(0, c->Vector(c->Dim(input, 1)));
+      c->set_output(1, c->Vector(c->Dim(input, 1)));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Computes the mean and variance of each column of a matrix in a single pass, using Welford's algorithm.
+
+The variance is the sample variance (i.e., it is not an unbiased variance estimate). The results do not depend on the
+number of threads used to compute them.
+
+input: 2-D. The `[N, C]` matrix whose columns are reduced.
+mean: 1-D. The `[C]` mean of each column of `input`.
+variance: 1-D. The `[C]` variance of each column of `input`.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T)                                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("WelfordMoments").Device(DEVICE_CPU).TypeConstraint<T>("T"),                              \
+      WelfordMomentsOp<T>);
+
+REGISTER_CPU_KERNELS(float);
+REGISTER_CPU_KERNELS(double);
+#undef REGISTER_CPU_KERNELS
+}  // namespace tensorflow
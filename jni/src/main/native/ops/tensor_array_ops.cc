@@ -0,0 +1,780 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#if GOOGLE_CUDA
+#define EIGEN_USE_GPU
+#endif  // GOOGLE_CUDA
+
+#include "tensor_array_ops.h"
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/common_shape_fns.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/partial_tensor_shape.h"
+#include "tensorflow/core/framework/register_types.h"
+#include "tensorflow/core/framework/resource_mgr.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/refcount.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+
+namespace tensorflow {
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+typedef Eigen::GpuDevice GPUDevice;
+
+// Tensor array with a fixed number of elements that all have the same shape, which are stored in a single buffer with
+// shape `[size, element_shape...]`, instead of in separate tensors, as in the "TensorArrayV3" resource. Writes copy
+// their value in place, while reads and gathers of ranges of elements return slices of the buffer whenever these are
+// aligned, and so stacking all elements (e.g., the per-step outputs of a dynamic RNN) copies nothing. The buffer is
+// allocated as soon as the element shape is fully known, which is either on the first op that uses the array (if its
+// `element_shape` attribute is fully defined) or on its first write. Unstacking a whole tensor into an empty array
+// adopts the buffer of that tensor instead of copying it.
+//
+// Because reads may share the buffer, elements are written once and cannot be written after they have been read. The
+// gradient arrays are the exception to the first rule: their buffer is initialized to zeros and writes to the same
+// element are added up (but still not after that element has been read).
+class ContiguousTensorArray : public ResourceBase {
+ public:
+  ContiguousTensorArray(
+      const string& name, DataType dtype, int32 size, const PartialTensorShape& element_shape, bool accumulate)
+      : name_(name), dtype_(dtype), size_(size), element_shape_(element_shape), accumulate_(accumulate),
+        written_(size, accumulate), read_(size, false) {}
+
+  mutex* mu() { return &mu_; }
+  DataType dtype() const { return dtype_; }
+  int32 size() const { return size_; }
+
+  string DebugString() override {
+    return strings::StrCat(
+        "ContiguousTensorArray[", size_, "] of ", DataTypeString(dtype_), "/", element_shape_.DebugString());
+  }
+
+  // Returns the shape of the elements of the gradient array of this array, which must be fully known by now.
+  Status GradientElementShape(TensorShape* shape) EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    TF_RETURN_IF_ERROR(CheckNotClosed());
+    if (allocated_) {
+      *shape = buffer_element_shape_;
+    } else if (!element_shape_.AsTensorShape(shape)) {
+      return errors::FailedPrecondition(
+          "Could not create the gradient of tensor array '", name_, "', because its element shape is unknown and ",
+          "none of its elements has been written.");
+    }
+    return Status::OK();
+  }
+
+  template <typename Device, typename T>
+  Status Write(
+      OpKernelContext* ctx, int32 index, const TensorShape& shape, typename TTypes<T>::UnalignedConstFlat value)
+      EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    TF_RETURN_IF_ERROR(CheckUsable(DataTypeToEnum<T>::v()));
+    TF_RETURN_IF_ERROR(CheckIndex(index));
+    TF_RETURN_IF_ERROR((Allocate<Device, T>(ctx, shape)));
+    if (read_[index])
+      return errors::FailedPrecondition(
+          "Could not write to element ", index, " of tensor array '", name_, "', because it has already been read.");
+    typename TTypes<T>::UnalignedFlat element = buffer_.Slice(index, index + 1).unaligned_flat<T>();
+    if (!accumulate_) {
+      if (written_[index])
+        return errors::FailedPrecondition(
+            "Could not write to element ", index, " of tensor array '", name_, "', because it has already been ",
+            "written.");
+      functor::ContiguousTensorArrayCopy<Device, T>()(ctx->eigen_device<Device>(), value, element);
+    } else {
+      functor::ContiguousTensorArrayAccumulate<Device, T>()(ctx->eigen_device<Device>(), value, element);
+    }
+    written_[index] = true;
+    return Status::OK();
+  }
+
+  template <typename Device, typename T>
+  Status Scatter(OpKernelContext* ctx, typename TTypes<int32>::ConstVec indices, const Tensor& value)
+      EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    TF_RETURN_IF_ERROR(CheckUsable(DataTypeToEnum<T>::v()));
+    const int64 num_indices = indices.size();
+    if (value.dims() < 1 || value.dim_size(0) != num_indices)
+      return errors::InvalidArgument(
+          "Expected the value to scatter to have shape [", num_indices, ", ...], but got ",
+          value.shape().DebugString(), ".");
+    TensorShape element_shape = value.shape();
+    element_shape.RemoveDim(0);
+    if (!allocated_ && !accumulate_ && num_indices == size_ && IsRange(indices, 0) &&
+        IsAligned(value.tensor_data().data())) {
+      // The whole array is written at once (e.g., it is unstacked), and so it can share the buffer of the value.
+      if (!element_shape_.IsCompatibleWith(element_shape))
+        return ElementShapeError(element_shape);
+      buffer_ = value;
+      buffer_element_shape_ = element_shape;
+      allocated_ = true;
+      written_.assign(size_, true);
+      return Status::OK();
+    }
+    for (int64 i = 0; i < num_indices; ++i) {
+      const Tensor row = value.Slice(i, i + 1);
+      TF_RETURN_IF_ERROR((Write<Device, T>(ctx, indices(i), element_shape, row.unaligned_flat<T>())));
+    }
+    return Status::OK();
+  }
+
+  template <typename Device, typename T>
+  Status Read(OpKernelContext* ctx, int32 index, Tensor* value) EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    TF_RETURN_IF_ERROR(CheckUsable(DataTypeToEnum<T>::v()));
+    TF_RETURN_IF_ERROR(CheckIndex(index));
+    TF_RETURN_IF_ERROR((Allocate<Device, T>(ctx)));
+    TF_RETURN_IF_ERROR(CheckWritten(index));
+    read_[index] = true;
+    const Tensor element = buffer_.Slice(index, index + 1);
+    if (IsElementAligned(index)) {
+      if (!value->CopyFrom(element, buffer_element_shape_))
+        return errors::Internal("Could not reshape element ", index, " of tensor array '", name_, "'.");
+      return Status::OK();
+    }
+    TF_RETURN_IF_ERROR(ctx->allocate_temp(dtype_, buffer_element_shape_, value));
+    functor::ContiguousTensorArrayCopy<Device, T>()(
+        ctx->eigen_device<Device>(), element.unaligned_flat<T>(), value->unaligned_flat<T>());
+    return Status::OK();
+  }
+
+  template <typename Device, typename T>
+  Status Gather(OpKernelContext* ctx, typename TTypes<int32>::ConstVec indices, Tensor* value)
+      EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    TF_RETURN_IF_ERROR(CheckUsable(DataTypeToEnum<T>::v()));
+    const int64 num_indices = indices.size();
+    for (int64 i = 0; i < num_indices; ++i) TF_RETURN_IF_ERROR(CheckIndex(indices(i)));
+    TF_RETURN_IF_ERROR((Allocate<Device, T>(ctx)));
+    if (!allocated_) {
+      if (num_indices > 0) return CheckWritten(indices(0));
+      return errors::FailedPrecondition(
+          "Could not gather zero elements of tensor array '", name_, "', because its element shape is unknown.");
+    }
+    for (int64 i = 0; i < num_indices; ++i) TF_RETURN_IF_ERROR(CheckWritten(indices(i)));
+    for (int64 i = 0; i < num_indices; ++i) read_[indices(i)] = true;
+    if (num_indices > 0 && IsRange(indices, indices(0)) && IsElementAligned(indices(0))) {
+      // The gathered elements are contiguous in the buffer (e.g., when stacking the whole array).
+      *value = buffer_.Slice(indices(0), indices(0) + num_indices);
+      return Status::OK();
+    }
+    TensorShape value_shape = buffer_element_shape_;
+    value_shape.InsertDim(0, num_indices);
+    TF_RETURN_IF_ERROR(ctx->allocate_temp(dtype_, value_shape, value));
+    for (int64 i = 0; i < num_indices; ++i) {
+      const Tensor element = buffer_.Slice(indices(i), indices(i) + 1);
+      functor::ContiguousTensorArrayCopy<Device, T>()(
+          ctx->eigen_device<Device>(), element.unaligned_flat<T>(), value->Slice(i, i + 1).unaligned_flat<T>());
+    }
+    return Status::OK();
+  }
+
+  // Releases the buffer of this array. Later ops that use the array fail, except for the creation of its gradient.
+  void Close() EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    closed_ = true;
+    buffer_ = Tensor();
+  }
+
+ private:
+  // Allocates the buffer for elements with shape `shape`, unless it has already been allocated, in which case it
+  // checks that `shape` is the shape of its elements.
+  template <typename Device, typename T>
+  Status Allocate(OpKernelContext* ctx, const TensorShape& shape) EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (allocated_) {
+      if (shape != buffer_element_shape_) return ElementShapeError(shape);
+      return Status::OK();
+    }
+    if (!element_shape_.IsCompatibleWith(shape)) return ElementShapeError(shape);
+    TensorShape buffer_shape = shape;
+    buffer_shape.InsertDim(0, size_);
+    PersistentTensor unused;
+    Tensor* buffer;
+    AllocatorAttributes attr;
+    attr.set_gpu_compatible(true);
+    TF_RETURN_IF_ERROR(ctx->allocate_persistent(dtype_, buffer_shape, &unused, &buffer, attr));
+    if (accumulate_) functor::ContiguousTensorArraySetZero<Device, T>()(ctx->eigen_device<Device>(), buffer->flat<T>());
+    buffer_ = *buffer;
+    buffer_element_shape_ = shape;
+    allocated_ = true;
+    return Status::OK();
+  }
+
+  // Allocates the buffer if the element shape is fully known, and does nothing otherwise.
+  template <typename Device, typename T>
+  Status Allocate(OpKernelContext* ctx) EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    TensorShape shape;
+    if (allocated_ || !element_shape_.AsTensorShape(&shape)) return Status::OK();
+    return Allocate<Device, T>(ctx, shape);
+  }
+
+  Status CheckUsable(DataType dtype) const EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    TF_RETURN_IF_ERROR(CheckNotClosed());
+    if (dtype != dtype_)
+      return errors::InvalidArgument(
+          "Tensor array '", name_, "' has data type ", DataTypeString(dtype_), ", but the op uses ",
+          DataTypeString(dtype), ".");
+    return Status::OK();
+  }
+
+  Status CheckNotClosed() const EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (closed_) return errors::FailedPrecondition("Tensor array '", name_, "' has already been closed.");
+    return Status::OK();
+  }
+
+  Status CheckIndex(int32 index) const {
+    if (index < 0 || index >= size_)
+      return errors::InvalidArgument(
+          "Index ", index, " is out of range for tensor array '", name_, "', which has size ", size_, ".");
+    return Status::OK();
+  }
+
+  Status CheckWritten(int32 index) const EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (!written_[index])
+      return errors::FailedPrecondition(
+          "Could not read element ", index, " of tensor array '", name_, "', because it has not been written.");
+    return Status::OK();
+  }
+
+  Status ElementShapeError(const TensorShape& shape) const EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return errors::InvalidArgument(
+        "Tensor array '", name_, "' has element shape ",
+        allocated_ ? buffer_element_shape_.DebugString() : element_shape_.DebugString(), ", but got an element with ",
+        "shape ", shape.DebugString(), ".");
+  }
+
+  static bool IsRange(typename TTypes<int32>::ConstVec indices, int32 start) {
+    for (int64 i = 0; i < indices.size(); ++i)
+      if (indices(i) != start + i) return false;
+    return true;
+  }
+
+  static bool IsAligned(const void* data) {
+    return reinterpret_cast<uintptr_t>(data) % EIGEN_MAX_ALIGN_BYTES == 0;
+  }
+
+  // Returns `true` if the slice of the buffer that starts at element `index` is aligned, in which case it can be
+  // shared with the kernels that consume it.
+  bool IsElementAligned(int32 index) const EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    const int64 element_bytes = buffer_element_shape_.num_elements() * DataTypeSize(dtype_);
+    return index == 0 || (index * element_bytes) % EIGEN_MAX_ALIGN_BYTES == 0;
+  }
+
+  const string name_;
+  const DataType dtype_;
+  const int32 size_;
+  mutex mu_;
+  PartialTensorShape element_shape_ GUARDED_BY(mu_);
+  const bool accumulate_;
+  bool allocated_ GUARDED_BY(mu_) = false;
+  bool closed_ GUARDED_BY(mu_) = false;
+  Tensor buffer_ GUARDED_BY(mu_);
+  TensorShape buffer_element_shape_ GUARDED_BY(mu_);
+  std::vector<bool> written_ GUARDED_BY(mu_);
+  std::vector<bool> read_ GUARDED_BY(mu_);
+
+  ~ContiguousTensorArray() override {}
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArray);
+};
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Used to make the names of the tensor arrays unique, because they may be created in while loops.
+  std::atomic<int64> contiguous_tensor_array_counter(0);
+
+  Status LookupContiguousTensorArray(OpKernelContext* ctx, ContiguousTensorArray** array) {
+    return LookupResource(ctx, HandleFromInput(ctx, 0), array);
+  }
+
+  Status CheckScalarInput(OpKernelContext* ctx, int index, const string& name) {
+    if (!TensorShapeUtils::IsScalar(ctx->input(index).shape()))
+      return errors::InvalidArgument(
+          "'", name, "' must be a scalar, but got shape ", ctx->input(index).shape().DebugString(), ".");
+    return Status::OK();
+  }
+
+  Status CheckVectorInput(OpKernelContext* ctx, int index, const string& name) {
+    if (!TensorShapeUtils::IsVector(ctx->input(index).shape()))
+      return errors::InvalidArgument(
+          "'", name, "' must be a vector, but got shape ", ctx->input(index).shape().DebugString(), ".");
+    return Status::OK();
+  }
+}  // namespace
+
+class ContiguousTensorArrayOp : public OpKernel {
+ public:
+  explicit ContiguousTensorArrayOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("dtype", &dtype_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("element_shape", &element_shape_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("tensor_array_name", &tensor_array_name_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    OP_REQUIRES_OK(ctx, CheckScalarInput(ctx, 0, "size"));
+    const int32 size = ctx->input(0).scalar<int32>()();
+    OP_REQUIRES(ctx, size >= 0, errors::InvalidArgument("The tensor array size must be non-negative, but got ", size));
+    const string name = strings::StrCat(
+        tensor_array_name_.empty() ? this->name() : tensor_array_name_, "_",
+        contiguous_tensor_array_counter.fetch_add(1));
+    const ResourceHandle handle = MakePerStepResourceHandle<ContiguousTensorArray>(ctx, name);
+    OP_REQUIRES_OK(
+        ctx, CreateResource(ctx, handle, new ContiguousTensorArray(name, dtype_, size, element_shape_, false)));
+    Tensor* handle_output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &handle_output));
+    handle_output->scalar<ResourceHandle>()() = handle;
+    Tensor* flow;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, TensorShape({}), &flow));
+    flow->scalar<float>()() = 0.0f;
+  }
+
+ private:
+  DataType dtype_;
+  PartialTensorShape element_shape_;
+  string tensor_array_name_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArrayOp);
+};
+
+template <typename Device, typename T>
+class ContiguousTensorArrayWriteOp : public OpKernel {
+ public:
+  explicit ContiguousTensorArrayWriteOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    OP_REQUIRES_OK(ctx, CheckScalarInput(ctx, 1, "index"));
+    ContiguousTensorArray* array;
+    OP_REQUIRES_OK(ctx, LookupContiguousTensorArray(ctx, &array));
+    core::ScopedUnref unref(array);
+    const Tensor& value = ctx->input(2);
+    {
+      mutex_lock lock(*array->mu());
+      OP_REQUIRES_OK(ctx, (array->Write<Device, T>(
+          ctx, ctx->input(1).scalar<int32>()(), value.shape(), value.unaligned_flat<T>())));
+    }
+    ctx->set_output(0, ctx->input(3));
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArrayWriteOp);
+};
+
+template <typename Device, typename T>
+class ContiguousTensorArrayScatterOp : public OpKernel {
+ public:
+  explicit ContiguousTensorArrayScatterOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    OP_REQUIRES_OK(ctx, CheckVectorInput(ctx, 1, "indices"));
+    ContiguousTensorArray* array;
+    OP_REQUIRES_OK(ctx, LookupContiguousTensorArray(ctx, &array));
+    core::ScopedUnref unref(array);
+    {
+      mutex_lock lock(*array->mu());
+      OP_REQUIRES_OK(ctx, (array->Scatter<Device, T>(ctx, ctx->input(1).vec<int32>(), ctx->input(2))));
+    }
+    ctx->set_output(0, ctx->input(3));
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArrayScatterOp);
+};
+
+template <typename Device, typename T>
+class ContiguousTensorArrayReadOp : public OpKernel {
+ public:
+  explicit ContiguousTensorArrayReadOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    OP_REQUIRES_OK(ctx, CheckScalarInput(ctx, 1, "index"));
+    ContiguousTensorArray* array;
+    OP_REQUIRES_OK(ctx, LookupContiguousTensorArray(ctx, &array));
+    core::ScopedUnref unref(array);
+    Tensor value;
+    {
+      mutex_lock lock(*array->mu());
+      OP_REQUIRES_OK(ctx, (array->Read<Device, T>(ctx, ctx->input(1).scalar<int32>()(), &value)));
+    }
+    ctx->set_output(0, value);
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArrayReadOp);
+};
+
+template <typename Device, typename T>
+class ContiguousTensorArrayGatherOp : public OpKernel {
+ public:
+  explicit ContiguousTensorArrayGatherOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    OP_REQUIRES_OK(ctx, CheckVectorInput(ctx, 1, "indices"));
+    ContiguousTensorArray* array;
+    OP_REQUIRES_OK(ctx, LookupContiguousTensorArray(ctx, &array));
+    core::ScopedUnref unref(array);
+    Tensor value;
+    {
+      mutex_lock lock(*array->mu());
+      OP_REQUIRES_OK(ctx, (array->Gather<Device, T>(ctx, ctx->input(1).vec<int32>(), &value)));
+    }
+    ctx->set_output(0, value);
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArrayGatherOp);
+};
+
+class ContiguousTensorArraySizeOp : public OpKernel {
+ public:
+  explicit ContiguousTensorArraySizeOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    ContiguousTensorArray* array;
+    OP_REQUIRES_OK(ctx, LookupContiguousTensorArray(ctx, &array));
+    core::ScopedUnref unref(array);
+    Tensor* size;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &size));
+    size->scalar<int32>()() = array->size();
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArraySizeOp);
+};
+
+class ContiguousTensorArrayGradOp : public OpKernel {
+ public:
+  explicit ContiguousTensorArrayGradOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("source", &source_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    ContiguousTensorArray* array;
+    OP_REQUIRES_OK(ctx, LookupContiguousTensorArray(ctx, &array));
+    core::ScopedUnref unref(array);
+    TensorShape element_shape;
+    {
+      mutex_lock lock(*array->mu());
+      OP_REQUIRES_OK(ctx, array->GradientElementShape(&element_shape));
+    }
+
+    // The gradient array lives in the same container as the forward array and its name is derived from the name of the
+    // forward array and the gradient source, so that all gradient ops of the same `gradients()` call share it.
+    const ResourceHandle& handle = HandleFromInput(ctx, 0);
+    const string name = strings::StrCat(handle.name(), "@", source_);
+    ContiguousTensorArray* gradient;
+    std::function<Status(ContiguousTensorArray**)> creator = [&](ContiguousTensorArray** result) {
+      *result = new ContiguousTensorArray(
+          name, array->dtype(), array->size(), PartialTensorShape(element_shape.dim_sizes()), true);
+      return Status::OK();
+    };
+    OP_REQUIRES_OK(ctx, ctx->resource_manager()->LookupOrCreate(handle.container(), name, &gradient, creator));
+    gradient->Unref();
+
+    Tensor* gradient_handle;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &gradient_handle));
+    gradient_handle->scalar<ResourceHandle>()() =
+        MakeResourceHandle<ContiguousTensorArray>(ctx, handle.container(), name);
+    ctx->set_output(1, ctx->input(1));
+  }
+
+ private:
+  string source_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArrayGradOp);
+};
+
+class ContiguousTensorArrayCloseOp : public OpKernel {
+ public:
+  explicit ContiguousTensorArrayCloseOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    ContiguousTensorArray* array;
+    OP_REQUIRES_OK(ctx, LookupContiguousTensorArray(ctx, &array));
+    core::ScopedUnref unref(array);
+    mutex_lock lock(*array->mu());
+    array->Close();
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(ContiguousTensorArrayCloseOp);
+};
+
+REGISTER_OP("ContiguousTensorArray")
+    .Input("size: int32")
+    .Attr("dtype: type")
+    .Attr("element_shape: shape = { unknown_rank: true }")
+    .Attr("tensor_array_name: string = ''")
+    .Output("handle: resource")
+    .Output("flow: float")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 0, &unused));
+      c->set_output(0, c->Scalar());
+      c->set_output(1, c->Scalar());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Creates a tensor array whose elements are stored in a single, contiguous buffer.
+
+Unlike 'TensorArrayV3', the size of this tensor array is fixed and all of its elements must have the same shape. The
+buffer has shape '[size, element_shape...]' and it is allocated as soon as the element shape is fully known (i.e., on
+the first op that uses the array, if 'element_shape' is fully defined, and on its first write otherwise). Writes copy
+their value into the buffer, while reads and gathers of contiguous elements (e.g., stacking the whole array) return
+slices of the buffer, without copying it, whenever these slices are aligned. Elements can only be written once and not
+after they have been read.
+
+size: Size of the tensor array.
+handle: Handle to the tensor array.
+flow: Scalar used to control gradient flow.
+dtype: Data type of the elements of the tensor array.
+element_shape: Expected shape of the elements of the tensor array, if known.
+tensor_array_name: Overrides the name used for the tensor array resource. Defaults to the name of the op. Either way,
+  the name is made unique.
+)doc");
+
+REGISTER_OP("ContiguousTensorArrayWrite")
+    .Input("handle: resource")
+    .Input("index: int32")
+    .Input("value: T")
+    .Input("flow_in: float")
+    .Output("flow_out: float")
+    .Attr("T: type")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 0, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(3), 0, &unused));
+      c->set_output(0, c->Scalar());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Copies an element into a contiguous tensor array.
+
+handle: Handle to the tensor array.
+index: Position of the element.
+value: Element to write.
+flow_in: Input flow of the tensor array, used to enforce proper chaining of operations.
+flow_out: Output flow of the tensor array, used to enforce proper chaining of operations.
+)doc");
+
+REGISTER_OP("ContiguousTensorArrayScatter")
+    .Input("handle: resource")
+    .Input("indices: int32")
+    .Input("value: T")
+    .Input("flow_in: float")
+    .Output("flow_out: float")
+    .Attr("T: type")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithRankAtLeast(c->input(2), 1, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(3), 0, &unused));
+      c->set_output(0, c->Scalar());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Scatters the rows of a tensor into elements of a contiguous tensor array.
+
+When the rows are written to all elements of an array that has not been written yet, and in order (e.g., when
+unstacking a tensor), the array uses the buffer of 'value' instead of copying it.
+
+handle: Handle to the tensor array.
+indices: Positions of the elements to which the rows of 'value' are written.
+value: Tensor whose rows are written to the tensor array.
+flow_in: Input flow of the tensor array, used to enforce proper chaining of operations.
+flow_out: Output flow of the tensor array, used to enforce proper chaining of operations.
+)doc");
+
+REGISTER_OP("ContiguousTensorArrayRead")
+    .Input("handle: resource")
+    .Input("index: int32")
+    .Input("flow_in: float")
+    .Output("value: dtype")
+    .Attr("dtype: type")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 0, &unused));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 0, &unused));
+      return shape_inference::UnknownShape(c);
+    })
+    .Doc(R"doc(
+Reads an element from a contiguous tensor array, without copying it if its slice of the buffer is aligned.
+
+handle: Handle to the tensor array.
+index: Position of the element.
+flow_in: Input flow of the tensor array, used to enforce proper chaining of operations.
+value: Element at position 'index'.
+)doc");
+
+REGISTER_OP("ContiguousTensorArrayGather")
+    .Input("handle: resource")
+    .Input("indices: int32")
+    .Input("flow_in: float")
+    .Output("value: dtype")
+    .Attr("dtype: type")
+    .Attr("element_shape: shape = { unknown_rank: true }")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle indices;
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &indices));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 0, &unused));
+      PartialTensorShape element_shape;
+      TF_RETURN_IF_ERROR(c->GetAttr("element_shape", &element_shape));
+      ShapeHandle element_shape_handle;
+      TF_RETURN_IF_ERROR(c->MakeShapeFromPartialTensorShape(element_shape, &element_shape_handle));
+      ShapeHandle output;
+      TF_RETURN_IF_ERROR(c->Concatenate(c->Vector(c->Dim(indices, 0)), element_shape_handle, &output));
+      c->set_output(0, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Gathers elements from a contiguous tensor array into a tensor.
+
+If 'indices' is a range of consecutive positions (e.g., '[0, 1, ..., size - 1]', when stacking the whole array) and the
+first one of them is aligned in the buffer, then the output is a slice of the buffer and nothing is copied.
+
+handle: Handle to the tensor array.
+indices: Positions of the elements to gather.
+flow_in: Input flow of the tensor array, used to enforce proper chaining of operations.
+value: Gathered elements, stacked along a new first axis.
+element_shape: Expected shape of the elements of the tensor array, if known. If it is not fully defined, then gathering
+  zero elements from an array that has not been written fails.
+)doc");
+
+REGISTER_OP("ContiguousTensorArraySize")
+    .Input("handle: resource")
+    .Input("flow_in: float")
+    .Output("size: int32")
+    .SetShapeFn([](InferenceContext* c) {
+      c->set_output(0, c->Scalar());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Returns the size of a contiguous tensor array.
+
+handle: Handle to the tensor array.
+flow_in: Input flow of the tensor array, used to enforce proper chaining of operations.
+size: Size of the tensor array.
+)doc");
+
+REGISTER_OP("ContiguousTensorArrayGrad")
+    .Input("handle: resource")
+    .Input("flow_in: float")
+    .Output("grad_handle: resource")
+    .Output("flow_out: float")
+    .Attr("source: string")
+    .SetIsStateful()
+    .SetShapeFn([](InferenceContext* c) {
+      c->set_output(0, c->Scalar());
+      c->set_output(1, c->Scalar());
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Creates (or looks up) the contiguous tensor array that stores the gradients of the elements of a contiguous tensor
+array.
+
+The gradient array has the same size and element shape as the forward array, which must be known by now (and so
+'flow_in' must depend on the writes to the forward array). Its buffer is initialized to zeros and multiple writes to
+the same element are added up.
+
+handle: Handle to the forward tensor array.
+flow_in: Input flow of the forward tensor array, used to enforce proper chaining of operations.
+grad_handle: Handle to the gradient tensor array.
+flow_out: Output flow, used to enforce proper chaining of operations.
+source: Gradient source string (e.g., "Gradients"), used to give each gradient computation its own gradient array.
+)doc");
+
+REGISTER_OP("ContiguousTensorArrayClose")
+    .Input("handle: resource")
+    .SetShapeFn([](InferenceContext* c) { return Status::OK(); })
+    .Doc(R"doc(
+Releases the buffer of a contiguous tensor array. Later ops that use the array fail, except for the creation of its
+gradient array.
+
+handle: Handle to the tensor array.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T)                                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("ContiguousTensorArrayWrite").Device(DEVICE_CPU).TypeConstraint<T>("T"),                     \
+      ContiguousTensorArrayWriteOp<CPUDevice, T>);                                                      \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("ContiguousTensorArrayScatter").Device(DEVICE_CPU).TypeConstraint<T>("T"),                   \
+      ContiguousTensorArrayScatterOp<CPUDevice, T>);                                                    \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("ContiguousTensorArrayRead").Device(DEVICE_CPU).TypeConstraint<T>("dtype"),                  \
+      ContiguousTensorArrayReadOp<CPUDevice, T>);                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("ContiguousTensorArrayGather").Device(DEVICE_CPU).TypeConstraint<T>("dtype"),                \
+      ContiguousTensorArrayGatherOp<CPUDevice, T>);
+
+TF_CALL_NUMBER_TYPES(REGISTER_CPU_KERNELS);
+#undef REGISTER_CPU_KERNELS
+
+REGISTER_KERNEL_BUILDER(Name("ContiguousTensorArray").Device(DEVICE_CPU), ContiguousTensorArrayOp);
+REGISTER_KERNEL_BUILDER(Name("ContiguousTensorArraySize").Device(DEVICE_CPU), ContiguousTensorArraySizeOp);
+REGISTER_KERNEL_BUILDER(Name("ContiguousTensorArrayGrad").Device(DEVICE_CPU), ContiguousTensorArrayGradOp);
+REGISTER_KERNEL_BUILDER(Name("ContiguousTensorArrayClose").Device(DEVICE_CPU), ContiguousTensorArrayCloseOp);
+
+#if GOOGLE_CUDA
+// The GPU functors are instantiated in `tensor_array_ops_gpu.cu.cc`, which is compiled by NVCC.
+namespace functor {
+#define DECLARE_GPU_FUNCTORS(T)                                                                         \
+  extern template struct ContiguousTensorArrayCopy<GPUDevice, T>;                                       \
+  extern template struct ContiguousTensorArrayAccumulate<GPUDevice, T>;                                 \
+  extern template struct ContiguousTensorArraySetZero<GPUDevice, T>;
+
+TF_CALL_GPU_NUMBER_TYPES(DECLARE_GPU_FUNCTORS);
+#undef DECLARE_GPU_FUNCTORS
+}  // namespace functor
+
+// The indices and the size are kept in host memory, because the kernels use them to address the buffer.
+#define REGISTER_GPU_KERNELS(T)                                                                         \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("ContiguousTensorArrayWrite").Device(DEVICE_GPU).TypeConstraint<T>("T").HostMemory("index"), \
+      ContiguousTensorArrayWriteOp<GPUDevice, T>);                                                      \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("ContiguousTensorArrayScatter").Device(DEVICE_GPU).TypeConstraint<T>("T")                    \
+          .HostMemory("indices"),                                                                       \
+      ContiguousTensorArrayScatterOp<GPUDevice, T>);                                                    \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("ContiguousTensorArrayRead").Device(DEVICE_GPU).TypeConstraint<T>("dtype")                   \
+          .HostMemory("index"),                                                                         \
+      ContiguousTensorArrayReadOp<GPUDevice, T>);                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                              \
+      Name("ContiguousTensorArrayGather").Device(DEVICE_GPU).TypeConstraint<T>("dtype")                 \
+          .HostMemory("indices"),                                                                       \
+      ContiguousTensorArrayGatherOp<GPUDevice, T>);
+
+TF_CALL_GPU_NUMBER_TYPES(REGISTER_GPU_KERNELS);
+#undef REGISTER_GPU_KERNELS
+
+REGISTER_KERNEL_BUILDER(
+    Name("ContiguousTensorArray").Device(DEVICE_GPU).HostMemory("size").HostMemory("flow"), ContiguousTensorArrayOp);
+REGISTER_KERNEL_BUILDER(
+    Name("ContiguousTensorArraySize").Device(DEVICE_GPU).HostMemory("size"), ContiguousTensorArraySizeOp);
+REGISTER_KERNEL_BUILDER(Name("ContiguousTensorArrayGrad").Device(DEVICE_GPU), ContiguousTensorArrayGradOp);
+REGISTER_KERNEL_BUILDER(Name("ContiguousTensorArrayClose").Device(DEVICE_GPU), ContiguousTensorArrayCloseOp);
+#endif  // GOOGLE_CUDA
+}  // namespace tensorflow
@@ -0,0 +1,55 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_TENSOR_ARRAY_OPS_H_
+#define TENSORFLOW_TENSOR_ARRAY_OPS_H_
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+namespace functor {
+
+// Copies `src` into `dst`, which is an element (or a range of elements) of the buffer of a contiguous tensor array. The
+// elements are not necessarily aligned, and so both maps are unaligned. It is instantiated for GPUs in
+// `tensor_array_ops_gpu.cu.cc`.
+template <typename Device, typename T>
+struct ContiguousTensorArrayCopy {
+  void operator()(const Device& d, typename TTypes<T>::UnalignedConstFlat src, typename TTypes<T>::UnalignedFlat dst) {
+    dst.device(d) = src;
+  }
+};
+
+// Adds `src` to `dst`, which is how the gradient tensor arrays aggregate multiple writes to the same element.
+template <typename Device, typename T>
+struct ContiguousTensorArrayAccumulate {
+  void operator()(const Device& d, typename TTypes<T>::UnalignedConstFlat src, typename TTypes<T>::UnalignedFlat dst) {
+    dst.device(d) += src;
+  }
+};
+
+// Sets all elements of `dst` to zero, which is the initial value of the buffers of the gradient tensor arrays.
+template <typename Device, typename T>
+struct ContiguousTensorArraySetZero {
+  void operator()(const Device& d, typename TTypes<T>::Flat dst) {
+    dst.device(d) = dst.constant(T(0));
+  }
+};
+
+}  // namespace functor
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_TENSOR_ARRAY_OPS_H_
@@ -0,0 +1,112 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_TENSOR_PRODUCER_H_
+#define TENSORFLOW_TENSOR_PRODUCER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/framework/cancellation.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Bounded buffer of elements (i.e., lists of tensors) that JVM threads push directly (through the JNI library) and
+// that the `TensorProducerDequeue` op pops (in the op library). Producers block while the buffer is full, which
+// provides back-pressure, and the op blocks while it is empty. The tensors are pushed without being copied.
+//
+// The producer is created and deleted by the JNI library, and its address is passed to the op as an attribute. Both
+// libraries compile this header, and so all of its methods are defined inline and only use standard library
+// synchronization primitives, so that both libraries agree on the layout and behavior of the producer.
+class TensorProducer {
+ public:
+  explicit TensorProducer(int64 capacity) : capacity_(capacity) {}
+
+  int64 capacity() const { return capacity_; }
+
+  int64 size() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return static_cast<int64>(elements_.size());
+  }
+
+  // Pushes `element`, waiting for at most `timeout_micros` microseconds (or forever, if it is negative) for the buffer
+  // to have space for it. Returns `false` if the timeout expired, and an error if the producer is closed.
+  bool Push(std::vector<Tensor>&& element, int64 timeout_micros, Status* status) {
+    std::unique_lock<std::mutex> lock(mu_);
+    const auto has_space = [this]() { return closed_ || static_cast<int64>(elements_.size()) < capacity_; };
+    if (timeout_micros < 0) {
+      not_full_.wait(lock, has_space);
+    } else if (!not_full_.wait_for(lock, std::chrono::microseconds(timeout_micros), has_space)) {
+      return false;
+    }
+    if (closed_) {
+      *status = errors::Cancelled("The tensor producer is closed.");
+      return false;
+    }
+    elements_.push_back(std::move(element));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  // Pops the next element, waiting for one to be pushed. Returns an `OutOfRange` error if the producer is closed and
+  // has no more elements, and a `Cancelled` error if `cancellation_manager` is cancelled while waiting.
+  Status Pop(CancellationManager* cancellation_manager, std::vector<Tensor>* element) {
+    std::unique_lock<std::mutex> lock(mu_);
+    while (elements_.empty() && !closed_) {
+      // The wait is bounded, so that step cancellations (e.g., due to session closes or run timeouts) are observed.
+      not_empty_.wait_for(lock, std::chrono::milliseconds(kCancellationPollMillis));
+      if (cancellation_manager != nullptr && cancellation_manager->IsCancelled())
+        return errors::Cancelled("Dequeue from the tensor producer was cancelled.");
+    }
+    if (elements_.empty()) return errors::OutOfRange("The tensor producer is closed and has no more elements.");
+    *element = std::move(elements_.front());
+    elements_.pop_front();
+    not_full_.notify_one();
+    return Status::OK();
+  }
+
+  // Closes this producer. Pending and future pushes fail, and pops fail once the remaining elements are consumed.
+  void Close() {
+    std::lock_guard<std::mutex> lock(mu_);
+    closed_ = true;
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+
+ private:
+  static constexpr int64 kCancellationPollMillis = 100;
+
+  const int64 capacity_;
+  std::mutex mu_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  std::deque<std::vector<Tensor>> elements_;
+  bool closed_ = false;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(TensorProducer);
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_TENSOR_PRODUCER_H_
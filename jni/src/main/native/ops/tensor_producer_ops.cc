@@ -0,0 +1,107 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensor_producer.h"
+
+#include "utilities.h"
+
+#include <vector>
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+
+namespace tensorflow {
+
+// Kernel that pops the next element of a `TensorProducer` that is filled directly by JVM threads, and outputs its
+// tensors without copying them.
+class TensorProducerDequeueOp : public OpKernel {
+ public:
+  explicit TensorProducerDequeueOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    std::string producer_pointer;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("producer_pointer", &producer_pointer));
+    producer_ = pointerFromString<TensorProducer*>(producer_pointer);
+    OP_REQUIRES(ctx, producer_ != nullptr, errors::InvalidArgument("The tensor producer pointer is null."));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("component_types", &component_types_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("shapes", &shapes_));
+    OP_REQUIRES(ctx, shapes_.empty() || shapes_.size() == component_types_.size(),
+                errors::InvalidArgument("Expected ", component_types_.size(), " shapes, but got ", shapes_.size(),
+                                        "."));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    std::vector<Tensor> element;
+    OP_REQUIRES_OK(ctx, producer_->Pop(ctx->cancellation_manager(), &element));
+    OP_REQUIRES(ctx, element.size() == component_types_.size(),
+                errors::InvalidArgument("Expected an element with ", component_types_.size(),
+                                        " components, but got one with ", element.size(), " components."));
+    for (size_t i = 0; i < element.size(); ++i) {
+      OP_REQUIRES(ctx, element[i].dtype() == component_types_[i],
+                  errors::InvalidArgument("Expected component ", i, " to have data type ",
+                                          DataTypeString(component_types_[i]), ", but it has data type ",
+                                          DataTypeString(element[i].dtype()), "."));
+      OP_REQUIRES(ctx, shapes_.empty() || shapes_[i].IsCompatibleWith(element[i].shape()),
+                  errors::InvalidArgument("Expected component ", i, " to have a shape compatible with ",
+                                          shapes_[i].DebugString(), ", but it has shape ",
+                                          element[i].shape().DebugString(), "."));
+      ctx->set_output(static_cast<int>(i), element[i]);
+    }
+  }
+
+ private:
+  TensorProducer* producer_;
+  DataTypeVector component_types_;
+  std::vector<PartialTensorShape> shapes_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(TensorProducerDequeueOp);
+};
+
+REGISTER_OP("TensorProducerDequeue")
+    .Output("components: component_types")
+    .Attr("producer_pointer: string")
+    .Attr("component_types: list(type) >= 1")
+    .Attr("shapes: list(shape) >= 0 = []")
+    .SetIsStateful()
+    .SetShapeFn([](shape_inference::InferenceContext* c) {
+      std::vector<PartialTensorShape> shapes;
+      TF_RETURN_IF_ERROR(c->GetAttr("shapes", &shapes));
+      if (shapes.empty()) return shape_inference::UnknownShape(c);
+      if (static_cast<int>(shapes.size()) != c->num_outputs())
+        return errors::InvalidArgument("Expected ", c->num_outputs(), " shapes, but got ", shapes.size(), ".");
+      for (int i = 0; i < c->num_outputs(); ++i) {
+        shape_inference::ShapeHandle shape;
+        TF_RETURN_IF_ERROR(c->MakeShapeFromPartialTensorShape(shapes[i], &shape));
+        c->set_output(i, shape);
+      }
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Dequeues the next element of a tensor producer that is filled directly by JVM threads.
+
+The op blocks until an element is available. Once the producer has been closed and all of its elements have been
+dequeued, the op fails with an `OutOfRange` error, in the same way as queue dequeue ops.
+
+components: The components of the dequeued element.
+producer_pointer: A pointer to the tensor producer, represented as a string.
+component_types: The data types of the element components.
+shapes: Optional (possibly partially-known) shapes of the element components. If empty, the shapes are unknown.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("TensorProducerDequeue").Device(DEVICE_CPU), TensorProducerDequeueOp);
+}  // namespace tensorflow
@@ -0,0 +1,467 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "delimiter_matcher.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "tensorflow/core/framework/common_shape_fns.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/stringpiece.h"
+#include "tensorflow/core/lib/hash/hash.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::DimensionHandle;
+  using shape_inference::InferenceContext;
+
+  // Per-byte cost estimates, in cycles, which are used to shard the strings over threads.
+  const int64 kTokenizeByteCost = 2;
+  const int64 kHashByteCost = 1;
+  const int64 kWordPieceByteCost = 50;
+
+  // Returns the average size (in bytes) of the strings in 'strings', which is used as the per-string cost estimate.
+  int64 AverageSize(const TTypes<string>::ConstFlat& strings) {
+    if (strings.size() == 0) return 0;
+    int64 total_size = 0;
+    for (int64 i = 0; i < strings.size(); ++i) total_size += strings(i).size();
+    return total_size / strings.size() + 1;
+  }
+
+  // Appends the tokens of 'input' to 'tokens'.
+  void Tokenize(const string& input, const DelimiterMatcher& matcher, bool skip_empty,
+                std::vector<StringPiece>* tokens) {
+    const char* data = input.data();
+    const int64 size = static_cast<int64>(input.size());
+    int64 start = 0;
+    while (true) {
+      const int64 end = matcher.Find(data, size, start);
+      if (!skip_empty || end > start) tokens->emplace_back(data + start, end - start);
+      if (end == size) break;
+      start = end + 1;
+    }
+  }
+
+  inline uint64 RotateLeft(uint64 value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+
+  inline uint64 Load64(const char* data) {
+    uint64 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+  }
+
+  inline uint32 Load32(const char* data) {
+    uint32 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+  }
+
+  const uint64 kXXPrime1 = 11400714785074694791ULL;
+  const uint64 kXXPrime2 = 14029467366897019727ULL;
+  const uint64 kXXPrime3 = 1609587929392839161ULL;
+  const uint64 kXXPrime4 = 9650029242287828579ULL;
+  const uint64 kXXPrime5 = 2870177450012600261ULL;
+
+  inline uint64 XXHash64Round(uint64 accumulator, uint64 input) {
+    accumulator += input * kXXPrime2;
+    return RotateLeft(accumulator, 31) * kXXPrime1;
+  }
+
+  inline uint64 XXHash64Merge(uint64 hash, uint64 accumulator) {
+    hash ^= XXHash64Round(0, accumulator);
+    return hash * kXXPrime1 + kXXPrime4;
+  }
+
+  // Computes the 64-bit xxHash (with seed 0) of 'data[0, size)', assuming a little-endian platform.
+  uint64 XXHash64(const char* data, size_t size) {
+    const char* position = data;
+    const char* end = data + size;
+    uint64 hash;
+    if (size >= 32) {
+      uint64 v1 = kXXPrime1 + kXXPrime2;
+      uint64 v2 = kXXPrime2;
+      uint64 v3 = 0;
+      uint64 v4 = -kXXPrime1;
+      for (; position + 32 <= end; position += 32) {
+        v1 = XXHash64Round(v1, Load64(position));
+        v2 = XXHash64Round(v2, Load64(position + 8));
+        v3 = XXHash64Round(v3, Load64(position + 16));
+        v4 = XXHash64Round(v4, Load64(position + 24));
+      }
+      hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+      hash = XXHash64Merge(hash, v1);
+      hash = XXHash64Merge(hash, v2);
+      hash = XXHash64Merge(hash, v3);
+      hash = XXHash64Merge(hash, v4);
+    } else {
+      hash = kXXPrime5;
+    }
+    hash += static_cast<uint64>(size);
+    for (; position + 8 <= end; position += 8) {
+      hash ^= XXHash64Round(0, Load64(position));
+      hash = RotateLeft(hash, 27) * kXXPrime1 + kXXPrime4;
+    }
+    if (position + 4 <= end) {
+      hash ^= static_cast<uint64>(Load32(position)) * kXXPrime1;
+      hash = RotateLeft(hash, 23) * kXXPrime2 + kXXPrime3;
+      position += 4;
+    }
+    for (; position < end; ++position) {
+      hash ^= static_cast<uint64>(static_cast<uint8>(*position)) * kXXPrime5;
+      hash = RotateLeft(hash, 11) * kXXPrime1;
+    }
+    hash ^= hash >> 33;
+    hash *= kXXPrime2;
+    hash ^= hash >> 29;
+    hash *= kXXPrime3;
+    hash ^= hash >> 32;
+    return hash;
+  }
+
+  struct StringPieceHash {
+    size_t operator()(StringPiece piece) const { return static_cast<size_t>(Hash64(piece.data(), piece.size())); }
+  };
+
+  // WordPiece vocabulary, which maps each line of a vocabulary file to its (zero-based) line number. The file is
+  // memory-mapped (when supported by its file system) and the vocabulary entries point directly into it, so that large
+  // vocabularies are not copied.
+  class WordPieceVocabulary {
+   public:
+    Status Load(Env* env, const string& filename) {
+      const char* data;
+      size_t size;
+      Status status = env->NewReadOnlyMemoryRegionFromFile(filename, &region_);
+      if (status.ok()) {
+        data = static_cast<const char*>(region_->data());
+        size = static_cast<size_t>(region_->length());
+      } else if (errors::IsUnimplemented(status)) {
+        TF_RETURN_IF_ERROR(ReadFileToString(env, filename, &contents_));
+        data = contents_.data();
+        size = contents_.size();
+      } else {
+        return status;
+      }
+      int64 id = 0;
+      size_t start = 0;
+      while (start < size) {
+        const char* line_end = static_cast<const char*>(std::memchr(data + start, '\n', size - start));
+        size_t end = line_end == nullptr ? size : static_cast<size_t>(line_end - data);
+        const size_t next_start = end + 1;
+        if (end > start && data[end - 1] == '\r') --end;
+        ids_.emplace(StringPiece(data + start, end - start), id++);
+        start = next_start;
+      }
+      return Status::OK();
+    }
+
+    bool Find(StringPiece token, int64* id) const {
+      const auto it = ids_.find(token);
+      if (it == ids_.end()) return false;
+      *id = it->second;
+      return true;
+    }
+
+   private:
+    std::unique_ptr<ReadOnlyMemoryRegion> region_;
+    string contents_;
+    std::unordered_map<StringPiece, int64, StringPieceHash> ids_;
+  };
+}  // namespace
+
+// Kernel that splits strings into tokens, producing a ragged tensor represented by the tokens of all strings and the
+// row splits that separate the tokens of each string. The strings are processed in parallel.
+class TokenizeStringsOp : public OpKernel {
+ public:
+  explicit TokenizeStringsOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    string delimiter;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("delimiter", &delimiter));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("skip_empty", &skip_empty_));
+    OP_REQUIRES(ctx, !delimiter.empty(), errors::InvalidArgument("'delimiter' must not be empty."));
+    matcher_.reset(new DelimiterMatcher(delimiter));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const auto input = ctx->input(0).flat<string>();
+    const int64 num_strings = input.size();
+    std::vector<std::vector<StringPiece>> tokens(num_strings);
+    const DelimiterMatcher& matcher = *matcher_;
+    const bool skip_empty = skip_empty_;
+    auto work = [&input, &tokens, &matcher, skip_empty](int64 start, int64 limit) {
+      for (int64 i = start; i < limit; ++i) Tokenize(input(i), matcher, skip_empty, &tokens[i]);
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, num_strings, AverageSize(input) * kTokenizeByteCost,
+          work);
+
+    Tensor* row_splits;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, TensorShape({num_strings + 1}), &row_splits));
+    auto row_splits_flat = row_splits->flat<int64>();
+    row_splits_flat(0) = 0;
+    for (int64 i = 0; i < num_strings; ++i)
+      row_splits_flat(i + 1) = row_splits_flat(i) + static_cast<int64>(tokens[i].size());
+    Tensor* values;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({row_splits_flat(num_strings)}), &values));
+    auto values_flat = values->flat<string>();
+    auto copy = [&tokens, &row_splits_flat, &values_flat](int64 start, int64 limit) {
+      for (int64 i = start; i < limit; ++i) {
+        int64 position = row_splits_flat(i);
+        for (const StringPiece& token : tokens[i]) values_flat(position++).assign(token.data(), token.size());
+      }
+    };
+    Shard(worker_threads.num_threads, worker_threads.workers, num_strings, AverageSize(input), copy);
+  }
+
+ private:
+  std::unique_ptr<DelimiterMatcher> matcher_;
+  bool skip_empty_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(TokenizeStringsOp);
+};
+
+// Kernel that converts strings to hash buckets. The strings are hashed in parallel.
+class StringToHashBucketBatchOp : public OpKernel {
+ public:
+  explicit StringToHashBucketBatchOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("num_buckets", &num_buckets_));
+    string hash_function;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("hash_function", &hash_function));
+    use_xxhash_ = hash_function == "xxhash64";
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& input = ctx->input(0);
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, input.shape(), &output));
+    const auto input_flat = input.flat<string>();
+    auto output_flat = output->flat<int64>();
+    const uint64 num_buckets = static_cast<uint64>(num_buckets_);
+    const bool use_xxhash = use_xxhash_;
+    auto work = [&input_flat, &output_flat, num_buckets, use_xxhash](int64 start, int64 limit) {
+      if (use_xxhash) {
+        for (int64 i = start; i < limit; ++i) {
+          const string& value = input_flat(i);
+          output_flat(i) = static_cast<int64>(XXHash64(value.data(), value.size()) % num_buckets);
+        }
+      } else {
+        for (int64 i = start; i < limit; ++i)
+          output_flat(i) = static_cast<int64>(Fingerprint64(input_flat(i)) % num_buckets);
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, input_flat.size(),
+          AverageSize(input_flat) * kHashByteCost, work);
+  }
+
+ private:
+  int64 num_buckets_;
+  bool use_xxhash_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(StringToHashBucketBatchOp);
+};
+
+// Kernel that splits words into WordPiece sub-word units, using a greedy longest-match-first algorithm, and that
+// produces a ragged tensor represented by the vocabulary IDs of the units of all words and the row splits that separate
+// the units of each word. The vocabulary is loaded once, when the kernel is constructed, and the words are processed in
+// parallel.
+class WordPieceTokenizeOp : public OpKernel {
+ public:
+  explicit WordPieceTokenizeOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    string vocabulary_file;
+    string unknown_token;
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("vocabulary_file", &vocabulary_file));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("suffix_indicator", &suffix_indicator_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("unknown_token", &unknown_token));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("max_bytes_per_word", &max_bytes_per_word_));
+    OP_REQUIRES_OK(ctx, vocabulary_.Load(ctx->env(), vocabulary_file));
+    OP_REQUIRES(ctx, vocabulary_.Find(unknown_token, &unknown_token_id_),
+                errors::InvalidArgument("The unknown token '", unknown_token, "' is not in the vocabulary file '",
+                                        vocabulary_file, "'."));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const auto input = ctx->input(0).flat<string>();
+    const int64 num_words = input.size();
+    std::vector<std::vector<int64>> ids(num_words);
+    auto work = [this, &input, &ids](int64 start, int64 limit) {
+      string scratch;
+      for (int64 i = start; i < limit; ++i) Tokenize(input(i), &scratch, &ids[i]);
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, num_words, AverageSize(input) * kWordPieceByteCost,
+          work);
+
+    Tensor* row_splits;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, TensorShape({num_words + 1}), &row_splits));
+    auto row_splits_flat = row_splits->flat<int64>();
+    row_splits_flat(0) = 0;
+    for (int64 i = 0; i < num_words; ++i)
+      row_splits_flat(i + 1) = row_splits_flat(i) + static_cast<int64>(ids[i].size());
+    Tensor* values;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({row_splits_flat(num_words)}), &values));
+    int64* values_data = values->flat<int64>().data();
+    for (int64 i = 0; i < num_words; ++i)
+      std::copy(ids[i].begin(), ids[i].end(), values_data + row_splits_flat(i));
+  }
+
+ private:
+  // Appends the vocabulary IDs of the sub-word units of 'word' to 'ids'. Words that cannot be split into units that
+  // are all in the vocabulary (or that are too long) are represented by the unknown token. Units are only split at
+  // UTF-8 character boundaries.
+  void Tokenize(const string& word, string* scratch, std::vector<int64>* ids) const {
+    if (static_cast<int64>(word.size()) > max_bytes_per_word_) {
+      ids->push_back(unknown_token_id_);
+      return;
+    }
+    const size_t size = word.size();
+    size_t start = 0;
+    while (start < size) {
+      size_t end = size;
+      int64 id;
+      bool found = false;
+      while (end > start) {
+        StringPiece unit(word.data() + start, end - start);
+        if (start > 0) {
+          scratch->assign(suffix_indicator_);
+          scratch->append(unit.data(), unit.size());
+          unit = StringPiece(*scratch);
+        }
+        if (vocabulary_.Find(unit, &id)) {
+          found = true;
+          break;
+        }
+        --end;
+        while (end > start && (static_cast<uint8>(word[end]) & 0xC0) == 0x80) --end;
+      }
+      if (!found) {
+        ids->clear();
+        ids->push_back(unknown_token_id_);
+        return;
+      }
+      ids->push_back(id);
+      start = end;
+    }
+  }
+
+  WordPieceVocabulary vocabulary_;
+  string suffix_indicator_;
+  int64 max_bytes_per_word_;
+  int64 unknown_token_id_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(WordPieceTokenizeOp);
+};
+
+namespace {
+  // Sets the shapes of the outputs of ops that produce ragged tensors with one row per element of their first input.
+  Status RaggedOutputShapeFn(InferenceContext* c) {
+    c->set_output(0, c->Vector(InferenceContext::kUnknownDim));
+    DimensionHandle num_rows = c->UnknownDim();
+    if (c->FullyDefined(c->input(0))) {
+      int64 num_elements = 1;
+      for (int i = 0; i < c->Rank(c->input(0)); ++i) num_elements *= c->Value(c->Dim(c->input(0), i));
+      num_rows = c->MakeDim(num_elements + 1);
+    }
+    c->set_output(1, c->Vector(num_rows));
+    return Status::OK();
+  }
+}  // namespace
+
+REGISTER_OP("TokenizeStrings")
+    .Input("input: string")
+    .Output("values: string")
+    .Output("row_splits: int64")
+    .Attr("delimiter: string = ' \\t\\n\\r\\013\\014'")
+    .Attr("skip_empty: bool = true")
+    .SetShapeFn(RaggedOutputShapeFn)
+    .Doc(R"doc(
+Splits the elements of 'input' into tokens, using the bytes of 'delimiter' as delimiters.
+
+The tokens of all elements of 'input' (in row-major order) are returned in 'values', and the tokens of element 'i' are
+'values[row_splits[i]:row_splits[i + 1]]'. When 'delimiter' contains at most 8 distinct bytes, the strings are scanned
+for delimiters in chunks of 16 bytes (using SIMD instructions, when available). The elements of 'input' are processed
+in parallel.
+
+input: Strings to split.
+values: 1-D tensor containing the tokens of all strings.
+row_splits: 1-D tensor with one more element than 'input', containing the row splits of 'values'.
+delimiter: Set of delimiter bytes. Defaults to the ASCII whitespace characters.
+skip_empty: If true, empty tokens are skipped.
+)doc");
+
+REGISTER_OP("StringToHashBucketBatch")
+    .Input("input: string")
+    .Output("output: int64")
+    .Attr("num_buckets: int >= 1")
+    .Attr("hash_function: {'farmhash', 'xxhash64'} = 'farmhash'")
+    .SetShapeFn(shape_inference::UnchangedShape)
+    .Doc(R"doc(
+Converts each string in 'input' to its hash modulo the number of buckets.
+
+When 'hash_function' is 'farmhash', this op computes the same output as the 'StringToHashBucketFast' op. Unlike that
+op, the strings are hashed in parallel, which makes it more efficient for large batches of strings.
+
+input: Strings to assign to hash buckets.
+output: Tensor with the same shape as 'input', containing the hash buckets.
+num_buckets: Number of buckets.
+hash_function: Hash function to use. Can be either 'farmhash' (i.e., the 64-bit fingerprint) or 'xxhash64' (i.e., the
+  64-bit xxHash with seed 0).
+)doc");
+
+REGISTER_OP("WordPieceTokenize")
+    .Input("input: string")
+    .Output("values: int64")
+    .Output("row_splits: int64")
+    .Attr("vocabulary_file: string")
+    .Attr("suffix_indicator: string = '##'")
+    .Attr("unknown_token: string = '[UNK]'")
+    .Attr("max_bytes_per_word: int = 100")
+    .SetShapeFn(RaggedOutputShapeFn)
+    .Doc(R"doc(
+Splits the words in 'input' into WordPiece sub-word units and returns their vocabulary IDs.
+
+Each word is split using a greedy longest-match-first algorithm, where all units except for the first one of each word
+are looked up after prefixing them with 'suffix_indicator'. Words that cannot be split into units that are all in the
+vocabulary, or that are longer than 'max_bytes_per_word', are represented by the ID of 'unknown_token'. The IDs of the
+units of all words (in row-major order) are returned in 'values', and the IDs of the units of word 'i' are
+'values[row_splits[i]:row_splits[i + 1]]'. The words are processed in parallel.
+
+input: Words to split.
+values: 1-D tensor containing the vocabulary IDs of the units of all words.
+row_splits: 1-D tensor with one more element than 'input', containing the row splits of 'values'.
+vocabulary_file: Vocabulary file, containing one unit per line. The ID of each unit is its (zero-based) line number.
+  The file is memory-mapped, when supported by its file system, and it is only read when the kernel is created.
+suffix_indicator: Prefix of the units that do not start a word.
+unknown_token: Unit used to represent unknown words. It must be in the vocabulary.
+max_bytes_per_word: Maximum size (in bytes) of the words that are split.
+)doc");
+
+REGISTER_KERNEL_BUILDER(Name("TokenizeStrings").Device(DEVICE_CPU), TokenizeStringsOp);
+REGISTER_KERNEL_BUILDER(Name("StringToHashBucketBatch").Device(DEVICE_CPU), StringToHashBucketBatchOp);
+REGISTER_KERNEL_BUILDER(Name("WordPieceTokenize").Device(DEVICE_CPU), WordPieceTokenizeOp);
+
+}  // namespace tensorflow
@@ -0,0 +1,378 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+namespace {
+  using shape_inference::DimensionHandle;
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Number of consecutive values that are compared against a threshold at once.
+  const int kChunkSize = 8;
+
+  // Rows with fewer elements than this, or with 'k' larger than this fraction of their elements, are not filtered, and
+  // their top elements are selected by partially sorting all of their indices.
+  const int64 kMinFilteredRowSize = 1024;
+  const int64 kMaxFilteredRowFraction = 16;
+
+  // Per-element cost estimate of the top-k selection, in cycles, which is used to shard the batch over threads.
+  const int64 kElementCost = 2;
+
+  // Returns a bit mask with bit 'i' set if and only if 'values[i] > threshold', for each one of 'kChunkSize'
+  // consecutive values.
+  template <typename T>
+  inline uint32 GreaterMask(const T* values, T threshold) {
+    uint32 mask = 0;
+    for (int i = 0; i < kChunkSize; ++i)
+      if (values[i] > threshold) mask |= 1U << i;
+    return mask;
+  }
+
+  // Returns a bit mask with bit 'i' set if and only if 'values[i]' is infinite or NaN, for each one of 'kChunkSize'
+  // consecutive values.
+  template <typename T>
+  inline uint32 NonFiniteMask(const T* values) {
+    uint32 mask = 0;
+    for (int i = 0; i < kChunkSize; ++i)
+      if (!std::isfinite(values[i])) mask |= 1U << i;
+    return mask;
+  }
+
+#if defined(__AVX__)
+  template <>
+  inline uint32 GreaterMask<float>(const float* values, float threshold) {
+    const __m256 comparison = _mm256_cmp_ps(_mm256_loadu_ps(values), _mm256_set1_ps(threshold), _CMP_GT_OQ);
+    return static_cast<uint32>(_mm256_movemask_ps(comparison));
+  }
+
+  template <>
+  inline uint32 NonFiniteMask<float>(const float* values) {
+    // The absolute value of a finite number is at most FLT_MAX, while the comparison is true for NaN values.
+    const __m256 absolute_values = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_loadu_ps(values));
+    const __m256 comparison = _mm256_cmp_ps(absolute_values, _mm256_set1_ps(FLT_MAX), _CMP_NLE_UQ);
+    return static_cast<uint32>(_mm256_movemask_ps(comparison));
+  }
+#elif defined(__SSE2__)
+  template <>
+  inline uint32 GreaterMask<float>(const float* values, float threshold) {
+    const __m128 threshold_vector = _mm_set1_ps(threshold);
+    const int low = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(values), threshold_vector));
+    const int high = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(values + 4), threshold_vector));
+    return static_cast<uint32>(low | (high << 4));
+  }
+
+  template <>
+  inline uint32 NonFiniteMask<float>(const float* values) {
+    // The absolute value of a finite number is at most FLT_MAX, while the comparison is true for NaN values.
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 max = _mm_set1_ps(FLT_MAX);
+    const int low = _mm_movemask_ps(_mm_cmpnle_ps(_mm_andnot_ps(sign, _mm_loadu_ps(values)), max));
+    const int high = _mm_movemask_ps(_mm_cmpnle_ps(_mm_andnot_ps(sign, _mm_loadu_ps(values + 4)), max));
+    return static_cast<uint32>(low | (high << 4));
+  }
+#endif
+
+  inline int PopCount(uint32 mask) { return __builtin_popcount(mask); }
+
+  // Orders the indices of a row by decreasing value, breaking ties by increasing index, which is the same order as the
+  // one used by the 'TopKV2' op.
+  template <typename T>
+  struct IndexComparator {
+    const T* row;
+
+    bool operator()(int32 a, int32 b) const { return row[a] > row[b] || (row[a] == row[b] && a < b); }
+  };
+
+  // Keeps only the 'k' best candidates (which are moved to the front of 'candidates') and returns the value of the
+  // worst one among them.
+  template <typename T>
+  inline T ShrinkCandidates(const IndexComparator<T>& comparator, int64 k, std::vector<int32>* candidates) {
+    std::nth_element(candidates->begin(), candidates->begin() + (k - 1), candidates->end(), comparator);
+    candidates->resize(k);
+    return comparator.row[(*candidates)[k - 1]];
+  }
+
+  // Selects the 'k' largest elements of a row with 'n' elements, and writes their values and indices to 'values' and
+  // 'indices', respectively.
+  //
+  // For large rows and small 'k', the row is scanned once, comparing chunks of 'kChunkSize' elements at once (using
+  // SIMD instructions, when available) against the value of the k-th best candidate found so far. Only elements that
+  // are larger than that threshold become candidates and, whenever the candidates buffer fills up, it is shrunk back to
+  // the 'k' best candidates using a partial sort, which also raises the threshold. Since the row is scanned in order of
+  // increasing index, elements equal to the threshold can never beat the existing candidates, and so the selected
+  // elements are the same as the ones selected by the 'TopKV2' op.
+  template <typename T>
+  void SelectTopK(const T* row, int64 n, int64 k, bool sorted, std::vector<int32>* candidates, T* values,
+                  int32* indices) {
+    const IndexComparator<T> comparator{row};
+    candidates->clear();
+    if (n < kMinFilteredRowSize || k * kMaxFilteredRowFraction > n) {
+      for (int64 i = 0; i < n; ++i) candidates->push_back(static_cast<int32>(i));
+      if (k < n) ShrinkCandidates(comparator, k, candidates);
+    } else {
+      const int64 capacity = 2 * k + kChunkSize;
+      for (int64 i = 0; i < k; ++i) candidates->push_back(static_cast<int32>(i));
+      T threshold = row[*std::max_element(candidates->begin(), candidates->end(), comparator)];
+      int64 i = k;
+      for (; i + kChunkSize <= n; i += kChunkSize) {
+        uint32 mask = GreaterMask(row + i, threshold);
+        while (mask != 0) {
+          candidates->push_back(static_cast<int32>(i + __builtin_ctz(mask)));
+          mask &= mask - 1;
+        }
+        if (candidates->size() >= capacity) threshold = ShrinkCandidates(comparator, k, candidates);
+      }
+      for (; i < n; ++i)
+        if (row[i] > threshold) candidates->push_back(static_cast<int32>(i));
+      if (candidates->size() > k) ShrinkCandidates(comparator, k, candidates);
+    }
+    if (sorted) std::sort(candidates->begin(), candidates->end(), comparator);
+    for (int64 j = 0; j < k; ++j) {
+      indices[j] = (*candidates)[j];
+      values[j] = row[(*candidates)[j]];
+    }
+  }
+
+  // Returns true if the element with value 'target' is among the 'k' largest elements of a row with 'n' elements. This
+  // is the case if fewer than 'k' elements are strictly larger than it and, as for the 'InTopKV2' op, the row contains
+  // no infinite or NaN values. Elements are compared in chunks of 'kChunkSize' (using SIMD instructions, when
+  // available), and the scan stops early once 'k' larger elements have been found.
+  template <typename T>
+  bool IsInTopK(const T* row, int64 n, T target, int64 k) {
+    if (!std::isfinite(target)) return false;
+    int64 num_larger = 0;
+    int64 i = 0;
+    for (; i + kChunkSize <= n; i += kChunkSize) {
+      if (NonFiniteMask(row + i) != 0) return false;
+      num_larger += PopCount(GreaterMask(row + i, target));
+      if (num_larger >= k) return false;
+    }
+    for (; i < n; ++i) {
+      if (!std::isfinite(row[i])) return false;
+      if (row[i] > target && ++num_larger >= k) return false;
+    }
+    return true;
+  }
+}  // namespace
+
+// Kernel that finds the 'k' largest elements along the last axis of its input, which is specialized for large inputs
+// and small 'k' (e.g., for softmax outputs over very large vocabularies). The rows of the input are processed in
+// parallel.
+template <typename T>
+class LargeTopKOp : public OpKernel {
+ public:
+  explicit LargeTopKOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("sorted", &sorted_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& input = ctx->input(0);
+    const Tensor& k_tensor = ctx->input(1);
+    OP_REQUIRES(ctx, TensorShapeUtils::IsScalar(k_tensor.shape()),
+                errors::InvalidArgument("'k' must be a scalar, but has shape ", k_tensor.shape().DebugString(), "."));
+    const int64 k = k_tensor.scalar<int32>()();
+    OP_REQUIRES(ctx, k >= 0, errors::InvalidArgument("'k' must be non-negative, but it was ", k, "."));
+    OP_REQUIRES(ctx, input.dims() >= 1,
+                errors::InvalidArgument("'input' must have rank at least 1, but has shape ",
+                                        input.shape().DebugString(), "."));
+    const int64 n = input.dim_size(input.dims() - 1);
+    OP_REQUIRES(ctx, n >= k,
+                errors::InvalidArgument("'input' must have at least k = ", k, " columns, but it has ", n, "."));
+    OP_REQUIRES(ctx, n <= std::numeric_limits<int32>::max(),
+                errors::InvalidArgument("'input' must have at most ", std::numeric_limits<int32>::max(),
+                                        " columns, but it has ", n, "."));
+
+    TensorShape output_shape = input.shape();
+    output_shape.set_dim(input.dims() - 1, k);
+    Tensor* values;
+    Tensor* indices;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, output_shape, &values));
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(1, output_shape, &indices));
+    if (k == 0 || output_shape.num_elements() == 0) return;
+
+    const int64 num_rows = input.NumElements() / n;
+    const T* input_data = input.flat<T>().data();
+    T* values_data = values->flat<T>().data();
+    int32* indices_data = indices->flat<int32>().data();
+    const bool sorted = sorted_;
+    auto work = [input_data, values_data, indices_data, n, k, sorted](int64 start, int64 limit) {
+      std::vector<int32> candidates;
+      for (int64 r = start; r < limit; ++r)
+        SelectTopK(input_data + r * n, n, k, sorted, &candidates, values_data + r * k, indices_data + r * k);
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, num_rows, n * kElementCost, work);
+  }
+
+ private:
+  bool sorted_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(LargeTopKOp);
+};
+
+// Kernel that checks whether the targets are in the top 'k' predictions, which is specialized for large numbers of
+// classes. The rows of the predictions are processed in parallel.
+template <typename Tidx>
+class LargeInTopKOp : public OpKernel {
+ public:
+  explicit LargeInTopKOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& predictions = ctx->input(0);
+    const Tensor& targets = ctx->input(1);
+    const Tensor& k_tensor = ctx->input(2);
+    OP_REQUIRES(ctx, TensorShapeUtils::IsMatrix(predictions.shape()),
+                errors::InvalidArgument("'predictions' must be a matrix, but has shape ",
+                                        predictions.shape().DebugString(), "."));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsVector(targets.shape()),
+                errors::InvalidArgument("'targets' must be a vector, but has shape ", targets.shape().DebugString(),
+                                        "."));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsScalar(k_tensor.shape()),
+                errors::InvalidArgument("'k' must be a scalar, but has shape ", k_tensor.shape().DebugString(), "."));
+    const int64 batch_size = predictions.dim_size(0);
+    const int64 num_classes = predictions.dim_size(1);
+    OP_REQUIRES(ctx, targets.dim_size(0) == batch_size,
+                errors::InvalidArgument("'targets' must have ", batch_size, " elements, but has shape ",
+                                        targets.shape().DebugString(), "."));
+    const int64 k = static_cast<int64>(k_tensor.scalar<Tidx>()());
+
+    Tensor* output;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({batch_size}), &output));
+    const float* predictions_data = predictions.flat<float>().data();
+    const auto targets_flat = targets.flat<Tidx>();
+    auto output_flat = output->flat<bool>();
+    auto work = [predictions_data, &targets_flat, &output_flat, num_classes, k](int64 start, int64 limit) {
+      for (int64 b = start; b < limit; ++b) {
+        const int64 target = static_cast<int64>(targets_flat(b));
+        const float* row = predictions_data + b * num_classes;
+        output_flat(b) = target >= 0 && target < num_classes && IsInTopK(row, num_classes, row[target], k);
+      }
+    };
+    const auto& worker_threads = *ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads.num_threads, worker_threads.workers, batch_size, num_classes, work);
+  }
+
+ private:
+  TF_DISALLOW_COPY_AND_ASSIGN(LargeInTopKOp);
+};
+
+REGISTER_OP("LargeTopK")
+    .Input("input: T")
+    .Input("k: int32")
+    .Output("values: T")
+    .Output("indices: int32")
+    .Attr("sorted: bool = true")
+    .Attr("T: {float, double, int32, int64}")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle input;
+      TF_RETURN_IF_ERROR(c->WithRankAtLeast(c->input(0), 1, &input));
+      ShapeHandle k_shape;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 0, &k_shape));
+      DimensionHandle k;
+      TF_RETURN_IF_ERROR(c->MakeDimForScalarInput(1, &k));
+      DimensionHandle last_dim = c->Dim(input, -1);
+      if (c->ValueKnown(last_dim) && c->ValueKnown(k) && c->Value(last_dim) < c->Value(k))
+        return errors::InvalidArgument("'input' must have last dimension >= k = ", c->Value(k), ", but has shape ",
+                                       c->DebugString(input), ".");
+      ShapeHandle output;
+      TF_RETURN_IF_ERROR(c->ReplaceDim(input, -1, k, &output));
+      c->set_output(0, output);
+      c->set_output(1, output);
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Finds the values and indices of the 'k' largest elements along the last dimension of 'input'.
+
+This op computes the same outputs as the 'TopKV2' op, but it is specialized for large last dimensions and small 'k'.
+Each row is scanned once, comparing chunks of elements against the value of the k-th best element found so far (using
+SIMD instructions, when available), and only the elements that exceed it are partially sorted. If two elements are
+equal, the lower-index element appears first.
+
+input: 1-D or higher with last dimension at least 'k'.
+k: 0-D. Number of top elements to look for along the last dimension.
+values: The 'k' largest elements along each last dimensional slice.
+indices: The indices of 'values' within the last dimension of 'input'.
+sorted: If true, the resulting 'k' elements are sorted by their values in descending order.
+)doc");
+
+REGISTER_OP("LargeInTopK")
+    .Input("predictions: float")
+    .Input("targets: T")
+    .Input("k: T")
+    .Output("precision: bool")
+    .Attr("T: {int32, int64} = DT_INT32")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle predictions;
+      ShapeHandle targets;
+      ShapeHandle k;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &predictions));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &targets));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 0, &k));
+      DimensionHandle batch_size;
+      TF_RETURN_IF_ERROR(c->Merge(c->Dim(predictions, 0), c->Dim(targets, 0), &batch_size));
+      c->set_output(0, c->Vector(batch_size));
+      return Status::OK();
+    })
+    .Doc(R"doc(
+Says whether the targets are in the top 'k' predictions.
+
+This op computes the same output as the 'InTopKV2' op, but it is specialized for large numbers of classes. Each row is
+scanned counting the predictions that are larger than the prediction for the target (using SIMD instructions, when
+available), and the scan stops as soon as 'k' such predictions have been found.
+
+predictions: A 'batch_size' x 'classes' tensor.
+targets: A 'batch_size' vector of class ids.
+k: Number of top elements to look at for computing precision.
+precision: Computed precision at 'k' as a 'bool Tensor'.
+)doc");
+
+#define REGISTER_KERNEL(T) \
+  REGISTER_KERNEL_BUILDER(Name("LargeTopK").Device(DEVICE_CPU).TypeConstraint<T>("T"), LargeTopKOp<T>);
+
+REGISTER_KERNEL(float);
+REGISTER_KERNEL(double);
+REGISTER_KERNEL(int32);
+REGISTER_KERNEL(int64);
+#undef REGISTER_KERNEL
+
+REGISTER_KERNEL_BUILDER(Name("LargeInTopK").Device(DEVICE_CPU).TypeConstraint<int32>("T"), LargeInTopKOp<int32>);
+REGISTER_KERNEL_BUILDER(Name("LargeInTopK").Device(DEVICE_CPU).TypeConstraint<int64>("T"), LargeInTopKOp<int64>);
+
+}  // namespace tensorflow
@@ -0,0 +1,426 @@
+/* Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/resource_mgr.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/refcount.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+
+// Copy of the resource variable class of the TensorFlow kernels library (from
+// "tensorflow/core/kernels/variable_ops.h"), which is not part of the headers distributed with the TensorFlow library.
+// Resource lookups match resources by type name, and so this copy must have the same name and layout as the original.
+class Var : public ResourceBase {
+ public:
+  explicit Var(DataType dtype) : tensor_(dtype) {}
+  mutex* mu() { return &mu_; }
+  Tensor* tensor() { return &tensor_; }
+
+  string DebugString() override {
+    return strings::StrCat(DataTypeString(tensor_.dtype()), "/", tensor_.shape().DebugString());
+  }
+
+ private:
+  mutex mu_;
+  Tensor tensor_;
+
+  ~Var() override {}
+  TF_DISALLOW_COPY_AND_ASSIGN(Var);
+};
+
+// Makes sure that the buffer of `tensor` is not shared with any other tensor (e.g., with the result of a previous
+// variable read that is still in use), copying it if necessary, so that it can be updated in-place. This is the same
+// function as the one used by the TensorFlow training ops, and it is a friend of `Tensor`.
+template <typename Device, typename T>
+Status PrepareToUpdateVariable(OpKernelContext* ctx, Tensor* tensor) {
+  if (!tensor->RefCountIsOne()) {
+    PersistentTensor unused;
+    Tensor* tmp;
+    AllocatorAttributes attr;
+    attr.set_gpu_compatible(true);
+    attr.set_nic_compatible(true);
+    TF_RETURN_IF_ERROR(ctx->allocate_persistent(tensor->dtype(), tensor->shape(), &unused, &tmp, attr));
+    tmp->flat<T>().device(ctx->eigen_device<Device>()) = const_cast<const Tensor*>(tensor)->flat<T>();
+    *tensor = *tmp;
+  }
+  return Status::OK();
+}
+
+namespace {
+  using shape_inference::InferenceContext;
+  using shape_inference::ShapeHandle;
+
+  // Shape function for the "apply to list" ops, which checks that their hyper-parameters are scalars.
+  Status ApplyListShapeFn(InferenceContext* c, const std::vector<string>& scalar_names) {
+    for (const string& scalar_name : scalar_names) {
+      std::vector<ShapeHandle> shapes;
+      TF_RETURN_IF_ERROR(c->input(scalar_name, &shapes));
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRank(shapes[0], 0, &unused));
+    }
+    return Status::OK();
+  }
+
+  // Tensors with at least this many elements are updated using all intra-op threads. Smaller tensors are updated by
+  // single threads, with many tensors being updated in parallel.
+  const int64 kParallelUpdateThreshold = 1 << 16;
+
+  // Per-element cost estimate of the updates, in cycles, which is used to shard the small tensors over threads.
+  const int64 kElementUpdateCost = 10;
+}  // namespace
+
+// Base kernel for the ops that apply the updates of an optimizer to a list of `N` resource variables at once, instead
+// of using one op per variable. The inputs of these ops are, in order: the `N` variables, `N` resources for each one of
+// the `NUM_SLOTS` slots of the optimizer, `NUM_SCALARS` hyper-parameter scalars, and the `N` gradients.
+//
+// The update of each variable is an Eigen expression over its flattened values, which is vectorized. Small variables
+// are updated in parallel over the CPU worker threads, while large variables are updated one after the other, with
+// each update being multi-threaded.
+template <typename T, typename Update>
+class ApplyListOp : public OpKernel {
+ public:
+  explicit ApplyListOp(OpKernelConstruction* ctx) : OpKernel(ctx), update_(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("N", &n_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("use_locking", &use_locking_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const int num_resources = n_ * (1 + Update::kNumSlots);
+
+    // Look up all variables and slots.
+    std::vector<Var*> resources(num_resources, nullptr);
+    std::vector<std::unique_ptr<core::ScopedUnref>> unrefs;
+    unrefs.reserve(num_resources);
+    for (int i = 0; i < num_resources; ++i) {
+      OP_REQUIRES_OK(ctx, LookupResource(ctx, HandleFromInput(ctx, i), &resources[i]));
+      unrefs.emplace_back(new core::ScopedUnref(resources[i]));
+    }
+
+    // Lock all variables and slots, in a consistent order to avoid deadlocks between concurrent updates.
+    std::vector<std::unique_ptr<mutex_lock>> locks;
+    if (use_locking_) {
+      std::vector<mutex*> mutexes;
+      mutexes.reserve(num_resources);
+      for (Var* resource : resources) mutexes.push_back(resource->mu());
+      std::sort(mutexes.begin(), mutexes.end());
+      mutexes.erase(std::unique(mutexes.begin(), mutexes.end()), mutexes.end());
+      locks.reserve(mutexes.size());
+      for (mutex* mu : mutexes) locks.emplace_back(new mutex_lock{*mu});
+    }
+
+    // Read the hyper-parameters.
+    T scalars[Update::kNumScalars > 0 ? Update::kNumScalars : 1];
+    for (int s = 0; s < Update::kNumScalars; ++s) {
+      const Tensor& scalar = ctx->input(num_resources + s);
+      OP_REQUIRES(
+          ctx, TensorShapeUtils::IsScalar(scalar.shape()),
+          errors::InvalidArgument("Hyper-parameter ", s, " is not a scalar: ", scalar.shape().DebugString(), "."));
+      scalars[s] = scalar.scalar<T>()();
+    }
+
+    // Validate the shapes and prepare all tensors for in-place updates.
+    const int gradients_offset = num_resources + Update::kNumScalars;
+    std::vector<int> small_updates;
+    std::vector<int> large_updates;
+    int64 small_elements = 0;
+    for (int i = 0; i < n_; ++i) {
+      const Tensor& gradient = ctx->input(gradients_offset + i);
+      for (int k = 0; k <= Update::kNumSlots; ++k) {
+        Tensor* tensor = resources[k * n_ + i]->tensor();
+        OP_REQUIRES(
+            ctx, tensor->IsInitialized(),
+            errors::FailedPrecondition("Attempting to use uninitialized variables: ", requested_input(k * n_ + i)));
+        OP_REQUIRES(
+            ctx, tensor->dtype() == DataTypeToEnum<T>::v(),
+            errors::InvalidArgument(
+                "Variable ", requested_input(k * n_ + i), " has data type ", DataTypeString(tensor->dtype()),
+                ", but the update has data type ", DataTypeString(DataTypeToEnum<T>::v()), "."));
+        OP_REQUIRES(
+            ctx, tensor->shape().IsSameSize(gradient.shape()),
+            errors::InvalidArgument(
+                "Variable ", requested_input(k * n_ + i), " and its gradient must have the same shape, but they are "
+                "shaped ", tensor->shape().DebugString(), " and ", gradient.shape().DebugString(), "."));
+        OP_REQUIRES_OK(ctx, PrepareToUpdateVariable<CPUDevice, T>(ctx, tensor));
+      }
+      if (gradient.NumElements() >= kParallelUpdateThreshold) {
+        large_updates.push_back(i);
+      } else {
+        small_updates.push_back(i);
+        small_elements += gradient.NumElements();
+      }
+    }
+
+    // Apply the updates.
+    auto apply = [this, ctx, &resources, &scalars, gradients_offset](int i, bool multi_threaded) {
+      std::vector<typename TTypes<T>::Flat> slots;
+      slots.reserve(Update::kNumSlots);
+      for (int k = 0; k < Update::kNumSlots; ++k)
+        slots.push_back(resources[(k + 1) * n_ + i]->tensor()->template flat<T>());
+      typename TTypes<T>::Flat var = resources[i]->tensor()->template flat<T>();
+      typename TTypes<T>::ConstFlat gradient = ctx->input(gradients_offset + i).template flat<T>();
+      if (multi_threaded) {
+        update_(ctx->eigen_device<CPUDevice>(), scalars, var, slots.data(), gradient);
+      } else {
+        update_(Eigen::DefaultDevice(), scalars, var, slots.data(), gradient);
+      }
+    };
+
+    for (int i : large_updates) apply(i, true);
+
+    if (!small_updates.empty()) {
+      const DeviceBase::CpuWorkerThreads* worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+      const int64 cost_per_update = std::max<int64>(1, small_elements / small_updates.size()) * kElementUpdateCost;
+      Shard(worker_threads->num_threads, worker_threads->workers, small_updates.size(), cost_per_update,
+            [&apply, &small_updates](int64 start, int64 limit) {
+              for (int64 index = start; index < limit; ++index) apply(small_updates[index], false);
+            });
+    }
+  }
+
+ private:
+  int n_;
+  bool use_locking_;
+  Update update_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ApplyListOp);
+};
+
+namespace functor {
+// `var -= lr * grad`
+template <typename T>
+struct GradientDescentListUpdate {
+  static const int kNumSlots = 0;
+  static const int kNumScalars = 1;
+
+  explicit GradientDescentListUpdate(OpKernelConstruction* ctx) {}
+
+  template <typename Device>
+  void operator()(const Device& d, const T* scalars, typename TTypes<T>::Flat var, typename TTypes<T>::Flat* slots,
+                  typename TTypes<T>::ConstFlat grad) const {
+    var.device(d) -= grad * grad.constant(scalars[0]);
+  }
+};
+
+// `accum = accum * momentum + grad` and either `var -= lr * accum`, or, with Nesterov acceleration,
+// `var -= lr * grad + lr * momentum * accum`.
+template <typename T>
+struct MomentumListUpdate {
+  static const int kNumSlots = 1;
+  static const int kNumScalars = 2;
+
+  explicit MomentumListUpdate(OpKernelConstruction* ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("use_nesterov", &use_nesterov));
+  }
+
+  template <typename Device>
+  void operator()(const Device& d, const T* scalars, typename TTypes<T>::Flat var, typename TTypes<T>::Flat* slots,
+                  typename TTypes<T>::ConstFlat grad) const {
+    const T lr = scalars[0];
+    const T momentum = scalars[1];
+    typename TTypes<T>::Flat accum = slots[0];
+    accum.device(d) = accum * accum.constant(momentum) + grad;
+    if (use_nesterov) {
+      var.device(d) -= grad * grad.constant(lr) + accum * accum.constant(momentum * lr);
+    } else {
+      var.device(d) -= accum * accum.constant(lr);
+    }
+  }
+
+  bool use_nesterov;
+};
+
+// `accum += grad * grad` and `var -= lr * grad * rsqrt(accum)`
+template <typename T>
+struct AdagradListUpdate {
+  static const int kNumSlots = 1;
+  static const int kNumScalars = 1;
+
+  explicit AdagradListUpdate(OpKernelConstruction* ctx) {}
+
+  template <typename Device>
+  void operator()(const Device& d, const T* scalars, typename TTypes<T>::Flat var, typename TTypes<T>::Flat* slots,
+                  typename TTypes<T>::ConstFlat grad) const {
+    typename TTypes<T>::Flat accum = slots[0];
+    accum.device(d) += grad.square();
+    var.device(d) -= grad * accum.rsqrt() * grad.constant(scalars[0]);
+  }
+};
+
+// `accum = rho * accum + (1 - rho) * grad^2`,
+// `update = sqrt(accum_update + epsilon) * rsqrt(accum + epsilon) * grad`,
+// `accum_update = rho * accum_update + (1 - rho) * update^2`, and `var -= lr * update`
+template <typename T>
+struct AdadeltaListUpdate {
+  static const int kNumSlots = 2;
+  static const int kNumScalars = 3;
+
+  explicit AdadeltaListUpdate(OpKernelConstruction* ctx) {}
+
+  template <typename Device>
+  void operator()(const Device& d, const T* scalars, typename TTypes<T>::Flat var, typename TTypes<T>::Flat* slots,
+                  typename TTypes<T>::ConstFlat grad) const {
+    const T lr = scalars[0];
+    const T rho = scalars[1];
+    const T epsilon = scalars[2];
+    typename TTypes<T>::Flat accum = slots[0];
+    typename TTypes<T>::Flat accum_update = slots[1];
+    accum.device(d) = accum * accum.constant(rho) + grad.square() * grad.constant(T(1) - rho);
+    const auto update = (accum_update + accum_update.constant(epsilon)).sqrt() *
+                        (accum + accum.constant(epsilon)).rsqrt() * grad;
+    var.device(d) -= update * update.constant(lr);
+    accum_update.device(d) = accum_update * accum_update.constant(rho) + update.square() * update.constant(T(1) - rho);
+  }
+};
+}  // namespace functor
+
+REGISTER_OP("ResourceApplyGradientDescentList")
+    .Input("var: N * resource")
+    .Input("alpha: T")
+    .Input("delta: N * T")
+    .Attr("N: int >= 1")
+    .Attr("T: numbertype")
+    .Attr("use_locking: bool = false")
+    .SetShapeFn([](InferenceContext* c) { return ApplyListShapeFn(c, {"alpha"}); })
+    .Doc(R"doc(
+Updates each variable in '*var' by subtracting 'alpha' * 'delta' from it, in a single op.
+
+var: Should be from a Variable().
+alpha: Scaling factor. Must be a scalar.
+delta: The changes.
+use_locking: If `True`, the subtraction will be protected by a lock;
+  otherwise the behavior is undefined, but may exhibit less contention.
+)doc");
+
+REGISTER_OP("ResourceApplyMomentumList")
+    .Input("var: N * resource")
+    .Input("accum: N * resource")
+    .Input("lr: T")
+    .Input("momentum: T")
+    .Input("grad: N * T")
+    .Attr("N: int >= 1")
+    .Attr("T: numbertype")
+    .Attr("use_locking: bool = false")
+    .Attr("use_nesterov: bool = false")
+    .SetShapeFn([](InferenceContext* c) { return ApplyListShapeFn(c, {"lr", "momentum"}); })
+    .Doc(R"doc(
+Updates each variable in '*var' according to the momentum scheme, in a single op.
+
+accum = accum * momentum + grad
+var -= lr * accum
+
+var: Should be from a Variable().
+accum: Should be from a Variable().
+lr: Scaling factor. Must be a scalar.
+momentum: Momentum. Must be a scalar.
+grad: The gradients.
+use_locking: If `True`, updating of the var and accum tensors will be protected
+  by a lock; otherwise the behavior is undefined, but may exhibit less
+  contention.
+use_nesterov: If `True`, the tensors used to compute the gradients are
+  `var - lr * momentum * accum`, so in the end, the vars are updated as
+  `var -= lr * grad + lr * momentum * accum`.
+)doc");
+
+REGISTER_OP("ResourceApplyAdagradList")
+    .Input("var: N * resource")
+    .Input("accum: N * resource")
+    .Input("lr: T")
+    .Input("grad: N * T")
+    .Attr("N: int >= 1")
+    .Attr("T: numbertype")
+    .Attr("use_locking: bool = false")
+    .SetShapeFn([](InferenceContext* c) { return ApplyListShapeFn(c, {"lr"}); })
+    .Doc(R"doc(
+Updates each variable in '*var' according to the AdaGrad scheme, in a single op.
+
+accum += grad * grad
+var -= lr * grad * (1 / sqrt(accum))
+
+var: Should be from a Variable().
+accum: Should be from a Variable().
+lr: Scaling factor. Must be a scalar.
+grad: The gradients.
+use_locking: If `True`, updating of the var and accum tensors will be protected
+  by a lock; otherwise the behavior is undefined, but may exhibit less
+  contention.
+)doc");
+
+REGISTER_OP("ResourceApplyAdadeltaList")
+    .Input("var: N * resource")
+    .Input("accum: N * resource")
+    .Input("accum_update: N * resource")
+    .Input("lr: T")
+    .Input("rho: T")
+    .Input("epsilon: T")
+    .Input("grad: N * T")
+    .Attr("N: int >= 1")
+    .Attr("T: numbertype")
+    .Attr("use_locking: bool = false")
+    .SetShapeFn([](InferenceContext* c) { return ApplyListShapeFn(c, {"lr", "rho", "epsilon"}); })
+    .Doc(R"doc(
+Updates each variable in '*var' according to the AdaDelta scheme, in a single op.
+
+accum = rho() * accum + (1 - rho()) * grad.square();
+update = (update_accum + epsilon).sqrt() * (accum + epsilon()).rsqrt() * grad;
+update_accum = rho() * update_accum + (1 - rho()) * update.square();
+var -= update;
+
+var: Should be from a Variable().
+accum: Should be from a Variable().
+accum_update: Should be from a Variable().
+lr: Scaling factor. Must be a scalar.
+rho: Decay factor. Must be a scalar.
+epsilon: Constant factor. Must be a scalar.
+grad: The gradients.
+use_locking: If True, updating of the var, accum and update_accum tensors will be protected by
+  a lock; otherwise the behavior is undefined, but may exhibit less contention.
+)doc");
+
+#define REGISTER_CPU_KERNELS(T)                                                                       \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("ResourceApplyGradientDescentList").Device(DEVICE_CPU).TypeConstraint<T>("T"),            \
+      ApplyListOp<T, functor::GradientDescentListUpdate<T>>);                                         \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("ResourceApplyMomentumList").Device(DEVICE_CPU).TypeConstraint<T>("T"),                   \
+      ApplyListOp<T, functor::MomentumListUpdate<T>>);                                                \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("ResourceApplyAdagradList").Device(DEVICE_CPU).TypeConstraint<T>("T"),                    \
+      ApplyListOp<T, functor::AdagradListUpdate<T>>);                                                 \
+  REGISTER_KERNEL_BUILDER(                                                                            \
+      Name("ResourceApplyAdadeltaList").Device(DEVICE_CPU).TypeConstraint<T>("T"),                   \
+      ApplyListOp<T, functor::AdadeltaListUpdate<T>>);
+
+REGISTER_CPU_KERNELS(float);
+REGISTER_CPU_KERNELS(double);
+#undef REGISTER_CPU_KERNELS
+}  // namespace tensorflow
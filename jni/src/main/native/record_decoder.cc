@@ -0,0 +1,97 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "record_decoder.h"
+#include "jvm_cache.h"
+#include "utilities.h"
+
+#include <memory>
+
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/record_decoder.h"
+#include "tensorflow/c/status_helper.h"
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_RecordDecoder_00024_decodeFixedLengthRecords(
+    JNIEnv* env, jobject object, jstring file_path, jboolean gzip, jobjectArray tar_entries, jlong header_bytes,
+    jlong record_bytes, jlongArray field_offsets, jintArray field_ranks, jlongArray field_shapes,
+    jintArray field_permutations, jintArray field_data_types, jfloatArray field_scales, jfloatArray field_shifts) {
+  const jsize num_fields = env->GetArrayLength(field_offsets);
+  if (env->GetArrayLength(field_ranks) != num_fields || env->GetArrayLength(field_data_types) != num_fields ||
+      env->GetArrayLength(field_scales) != num_fields || env->GetArrayLength(field_shifts) != num_fields) {
+    throw_exception(env, jvm_illegal_argument_exception, "All field arrays must have the same length.");
+    return nullptr;
+  }
+  ArrayBuffer<jlong> offsets(num_fields);
+  ArrayBuffer<jint> ranks(num_fields);
+  ArrayBuffer<jint> data_types(num_fields);
+  ArrayBuffer<jfloat> scales(num_fields);
+  ArrayBuffer<jfloat> shifts(num_fields);
+  env->GetLongArrayRegion(field_offsets, 0, num_fields, offsets.data());
+  env->GetIntArrayRegion(field_ranks, 0, num_fields, ranks.data());
+  env->GetIntArrayRegion(field_data_types, 0, num_fields, data_types.data());
+  env->GetFloatArrayRegion(field_scales, 0, num_fields, scales.data());
+  env->GetFloatArrayRegion(field_shifts, 0, num_fields, shifts.data());
+
+  // The shapes and permutations of all fields are packed one after the other, each taking as many elements as the
+  // field rank. Empty permutations are allowed and denote the identity permutation for all fields.
+  const jsize num_shape_elements = env->GetArrayLength(field_shapes);
+  const jsize num_permutation_elements = env->GetArrayLength(field_permutations);
+  ArrayBuffer<jlong> shapes(num_shape_elements);
+  ArrayBuffer<jint> permutations(num_permutation_elements);
+  env->GetLongArrayRegion(field_shapes, 0, num_shape_elements, shapes.data());
+  env->GetIntArrayRegion(field_permutations, 0, num_permutation_elements, permutations.data());
+  std::vector<tensorflow::io::FixedLengthRecordField> fields(num_fields);
+  jsize position = 0;
+  for (jsize i = 0; i < num_fields; ++i) {
+    if (ranks[i] < 0 || position + ranks[i] > num_shape_elements ||
+        (num_permutation_elements > 0 && position + ranks[i] > num_permutation_elements)) {
+      throw_exception(env, jvm_illegal_argument_exception, "The field shapes do not match the field ranks.");
+      return nullptr;
+    }
+    tensorflow::io::FixedLengthRecordField& field = fields[i];
+    field.offset = static_cast<tensorflow::int64>(offsets[i]);
+    field.shape.assign(shapes.data() + position, shapes.data() + position + ranks[i]);
+    if (num_permutation_elements > 0)
+      field.permutation.assign(permutations.data() + position, permutations.data() + position + ranks[i]);
+    field.dtype = static_cast<tensorflow::DataType>(data_types[i]);
+    field.scale = scales[i];
+    field.shift = shifts[i];
+    position += ranks[i];
+  }
+
+  const char* c_file_path = env->GetStringUTFChars(file_path, nullptr);
+  std::string cpp_file_path(c_file_path);
+  env->ReleaseStringUTFChars(file_path, c_file_path);
+  const std::vector<std::string> cpp_tar_entries = to_string_vector(env, tar_entries);
+  std::vector<std::vector<tensorflow::Tensor>> outputs;
+  tensorflow::Status s = tensorflow::io::DecodeFixedLengthRecords(
+    cpp_file_path, static_cast<bool>(gzip), cpp_tar_entries, static_cast<tensorflow::int64>(header_bytes),
+    static_cast<tensorflow::int64>(record_bytes), fields, &outputs);
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), nullptr);
+  }
+
+  const jsize num_handles = static_cast<jsize>(outputs.size()) * num_fields;
+  ArrayBuffer<jlong> handles(num_handles);
+  for (size_t i = 0; i < outputs.size(); ++i)
+    for (jsize j = 0; j < num_fields; ++j)
+      handles[i * num_fields + j] = reinterpret_cast<jlong>(new TFE_TensorHandle(outputs[i][j], nullptr));
+  jlongArray result = env->NewLongArray(num_handles);
+  env->SetLongArrayRegion(result, 0, num_handles, handles.data());
+  return result;
+}
@@ -0,0 +1,21 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_RecordDecoder__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_RecordDecoder__
+#define _Included_org_platanios_tensorflow_jni_RecordDecoder__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordDecoder__
+ * Method:    decodeFixedLengthRecords
+ * Signature: (Ljava/lang/String;Z[Ljava/lang/String;JJ[J[I[J[I[I[F[F)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_RecordDecoder_00024_decodeFixedLengthRecords
+  (JNIEnv *, jobject, jstring, jboolean, jobjectArray, jlong, jlong, jlongArray, jintArray, jlongArray, jintArray, jintArray, jfloatArray, jfloatArray);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
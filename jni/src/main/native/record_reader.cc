@@ -14,20 +14,76 @@
  */
 
 #include "record_reader.h"
+#include "jvm_cache.h"
 #include "utilities.h"
 
+#include <algorithm>
 #include <string.h>
+#include <utility>
+#include <vector>
 
+#include "tensorflow/c/block_cache.h"
+#include "tensorflow/c/handle_tracker.h"
+#include "tensorflow/c/metrics_exporter.h"
+#include "tensorflow/c/native_event_recorder.h"
+#include "tensorflow/c/record_compression.h"
 #include "tensorflow/c/record_reader.h"
 #include "tensorflow/c/status_helper.h"
 #include "tensorflow/core/lib/io/record_reader.h"
 #include "tensorflow/core/platform/env.h"
 
+namespace {
+// Reads up to "max_records" records into a direct buffer, using at most "max_bytes" bytes of it. Each record is written
+// as its length, encoded as a little-endian 32-bit integer, followed by its contents. "Reader" is either a
+// "RecordReaderWrapper" or a "PrefetchingRecordReaderWrapper".
+template <class Reader>
+jint read_record_batch(JNIEnv* env, Reader* reader, jint max_records, jint max_bytes, jobject buffer) {
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventRecordRead, "RecordReader.readBatch");
+  char* buffer_data = static_cast<char*>(env->GetDirectBufferAddress(buffer));
+  if (buffer_data == nullptr) {
+    throw_exception(env, jvm_illegal_argument_exception, "The provided buffer is not a direct buffer.");
+    return 0;
+  }
+  const jlong capacity = std::min(env->GetDirectBufferCapacity(buffer), static_cast<jlong>(max_bytes));
+
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  jint num_records = 0;
+  jlong position = 0;
+  while (num_records < max_records) {
+    reader->GetNext(status.get());
+    if (TF_GetCode(status.get()) != TF_OK) {
+      // Errors (including reaching the end of the file) are only reported if no records have been read, so that the
+      // records already written to the buffer are not lost. Failed reads do not advance the reader and so the next
+      // call will report the same error.
+      if (num_records == 0)
+        CHECK_STATUS(env, status.get(), 0);
+      break;
+    }
+    const std::string& record = reader->record();
+    if (position + 4 + static_cast<jlong>(record.size()) > capacity) {
+      // The record does not fit in the buffer and so we push it back, so that it is returned again by the next call.
+      reader->Unread();
+      break;
+    }
+    const tensorflow::uint32 length = static_cast<tensorflow::uint32>(record.size());
+    for (int i = 0; i < 4; ++i)
+      buffer_data[position++] = static_cast<char>((length >> (8 * i)) & 0xff);
+    memcpy(buffer_data + position, record.data(), record.size());
+    position += record.size();
+    ++num_records;
+  }
+  tensorflow::jni_metrics::RecordRecordReaderBytes(static_cast<tensorflow::uint64>(position - 4 * num_records));
+  event.set_num_bytes(position - 4 * num_records);
+  event.set_num_outputs(num_records);
+  return num_records;
+}
+}  // namespace
+
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newRandomAccessFile(
     JNIEnv* env, jobject object, jstring filename) {
   const char* c_filename = env->GetStringUTFChars(filename, nullptr);
   std::unique_ptr<tensorflow::RandomAccessFile> file;
-  tensorflow::Status s = tensorflow::Env::Default()->NewRandomAccessFile(std::string(c_filename), &file);
+  tensorflow::Status s = tensorflow::NewCachedRandomAccessFile(std::string(c_filename), &file);
   if (!s.ok()) {
     std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
     Set_TF_Status_from_Status(status.get(), s);
@@ -47,16 +103,26 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_new
     JNIEnv* env, jobject object, jlong file_handle, jstring compression_type) {
   REQUIRE_HANDLE(file, tensorflow::RandomAccessFile, file_handle, 0);
   const char* c_compression_type = env->GetStringUTFChars(compression_type, nullptr);
+  const std::string compression_type_string(c_compression_type);
+  env->ReleaseStringUTFChars(compression_type, c_compression_type);
+  // Frame compressed files must be wrapped when they are opened, and so they are only supported by the wrappers.
+  if (tensorflow::io::IsFrameCompressionType(compression_type_string)) {
+    throw_exception(
+        env, tf_invalid_argument_exception,
+        "Compression type '%s' is only supported by the record reader wrappers.", compression_type_string.c_str());
+    return 0;
+  }
   tensorflow::io::RecordReaderOptions options =
-    tensorflow::io::RecordReaderOptions::CreateRecordReaderOptions(std::string(c_compression_type));
+    tensorflow::io::RecordReaderOptions::CreateRecordReaderOptions(compression_type_string);
   auto* reader = new tensorflow::io::RecordReader(file, options);
-  env->ReleaseStringUTFChars(compression_type, c_compression_type);
+  tensorflow::HandleTracker::Global()->Track(tensorflow::HandleTracker::kRecordReader, reader, 0);
   return reinterpret_cast<jlong>(reader);
 }
 
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_recordReaderRead(
     JNIEnv* env, jobject object, jlong reader_handle, jlong offset) {
   REQUIRE_HANDLE(reader, tensorflow::io::RecordReader, reader_handle, nullptr);
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventRecordRead, "RecordReader.read");
   tensorflow::uint64 c_offset = static_cast<tensorflow::uint64>(offset);
   std::string record;
   tensorflow::Status s = reader->ReadRecord(&c_offset, &record);
@@ -65,6 +131,8 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_0002
     Set_TF_Status_from_Status(status.get(), s);
     CHECK_STATUS(env, status.get(), 0);
   }
+  tensorflow::jni_metrics::RecordRecordReaderBytes(record.size());
+  event.set_num_bytes(static_cast<tensorflow::int64>(record.size()));
   jbyteArray record_array = env->NewByteArray(static_cast<jsize>(record.size()));
   jbyte* record_array_elements = env->GetByteArrayElements(record_array, nullptr);
   memcpy(record_array_elements, record.data(), record.size());
@@ -75,6 +143,7 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_0002
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteRecordReader(
     JNIEnv* env, jobject object, jlong reader_handle) {
   REQUIRE_HANDLE(reader, tensorflow::io::RecordReader, reader_handle, void());
+  tensorflow::HandleTracker::Global()->Untrack(reader);
   delete reader;
 }
 
@@ -82,16 +151,26 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_new
     JNIEnv* env, jobject object, jlong file_handle, jstring compression_type) {
   REQUIRE_HANDLE(file, tensorflow::RandomAccessFile, file_handle, 0);
   const char* c_compression_type = env->GetStringUTFChars(compression_type, nullptr);
+  const std::string compression_type_string(c_compression_type);
+  env->ReleaseStringUTFChars(compression_type, c_compression_type);
+  // Frame compressed files must be wrapped when they are opened, and so they are only supported by the wrappers.
+  if (tensorflow::io::IsFrameCompressionType(compression_type_string)) {
+    throw_exception(
+        env, tf_invalid_argument_exception,
+        "Compression type '%s' is only supported by the record reader wrappers.", compression_type_string.c_str());
+    return 0;
+  }
   tensorflow::io::RecordReaderOptions options =
-    tensorflow::io::RecordReaderOptions::CreateRecordReaderOptions(std::string(c_compression_type));
+    tensorflow::io::RecordReaderOptions::CreateRecordReaderOptions(compression_type_string);
   auto* reader = new tensorflow::io::SequentialRecordReader(file, options);
-  env->ReleaseStringUTFChars(compression_type, c_compression_type);
+  tensorflow::HandleTracker::Global()->Track(tensorflow::HandleTracker::kRecordReader, reader, 0);
   return reinterpret_cast<jlong>(reader);
 }
 
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_sequentialRecordReaderReadNext(
     JNIEnv* env, jobject object, jlong reader_handle) {
   REQUIRE_HANDLE(reader, tensorflow::io::SequentialRecordReader, reader_handle, nullptr);
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventRecordRead, "RecordReader.readNext");
   std::string record;
   tensorflow::Status s = reader->ReadRecord(&record);
   if (!s.ok()) {
@@ -99,6 +178,8 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_0002
     Set_TF_Status_from_Status(status.get(), s);
     CHECK_STATUS(env, status.get(), 0);
   }
+  tensorflow::jni_metrics::RecordRecordReaderBytes(record.size());
+  event.set_num_bytes(static_cast<tensorflow::int64>(record.size()));
   jbyteArray record_array = env->NewByteArray(static_cast<jsize>(record.size()));
   jbyte* record_array_elements = env->GetByteArrayElements(record_array, nullptr);
   memcpy(record_array_elements, record.data(), record.size());
@@ -109,6 +190,7 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_0002
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteSequentialRecordReader(
     JNIEnv* env, jobject object, jlong reader_handle) {
   REQUIRE_HANDLE(reader, tensorflow::io::SequentialRecordReader, reader_handle, void());
+  tensorflow::HandleTracker::Global()->Untrack(reader);
   delete reader;
 }
 
@@ -123,23 +205,32 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_new
   CHECK_STATUS(env, status.get(), 0);
   env->ReleaseStringUTFChars(compression_type, c_compression_type);
   env->ReleaseStringUTFChars(filename, c_filename);
+  tensorflow::HandleTracker::Global()->Track(tensorflow::HandleTracker::kRecordReader, reader, 0);
   return reinterpret_cast<jlong>(reader);
 }
 
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_recordReaderWrapperReadNext(
     JNIEnv* env, jobject object, jlong reader_handle) {
   REQUIRE_HANDLE(reader, tensorflow::io::RecordReaderWrapper, reader_handle, nullptr);
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventRecordRead, "RecordReader.readNext");
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
   reader->GetNext(status.get());
   CHECK_STATUS(env, status.get(), nullptr);
-  std::string record = reader->record();
+  const std::string& record = reader->record();
+  tensorflow::jni_metrics::RecordRecordReaderBytes(record.size());
+  event.set_num_bytes(static_cast<tensorflow::int64>(record.size()));
   jbyteArray record_array = env->NewByteArray(static_cast<jsize>(record.size()));
-  jbyte* record_array_elements = env->GetByteArrayElements(record_array, nullptr);
-  memcpy(record_array_elements, record.data(), record.size());
-  env->ReleaseByteArrayElements(record_array, record_array_elements, JNI_COMMIT);
+  env->SetByteArrayRegion(
+      record_array, 0, static_cast<jsize>(record.size()), reinterpret_cast<const jbyte*>(record.data()));
   return record_array;
 }
 
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_recordReaderWrapperReadBatch(
+    JNIEnv* env, jobject object, jlong reader_handle, jint max_records, jint max_bytes, jobject buffer) {
+  REQUIRE_HANDLE(reader, tensorflow::io::RecordReaderWrapper, reader_handle, 0);
+  return read_record_batch(env, reader, max_records, max_bytes, buffer);
+}
+
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_recordReaderWrapperOffset(
     JNIEnv* env, jobject object, jlong reader_handle) {
   REQUIRE_HANDLE(reader, tensorflow::io::RecordReaderWrapper, reader_handle, -1);
@@ -149,5 +240,284 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_rec
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteRecordReaderWrapper(
     JNIEnv* env, jobject object, jlong reader_handle) {
   REQUIRE_HANDLE(reader, tensorflow::io::RecordReaderWrapper, reader_handle, void());
+  tensorflow::HandleTracker::Global()->Untrack(reader);
+  delete reader;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newPrefetchingRecordReaderWrapper(
+    JNIEnv* env, jobject object, jstring filename, jstring compression_type, jlong start_offset,
+    jlong max_buffered_records, jlong max_buffered_bytes) {
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  const char* c_compression_type = env->GetStringUTFChars(compression_type, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* reader = tensorflow::io::PrefetchingRecordReaderWrapper::New(
+    std::string(c_filename), static_cast<tensorflow::uint64>(start_offset), std::string(c_compression_type),
+    static_cast<tensorflow::int64>(max_buffered_records), static_cast<tensorflow::int64>(max_buffered_bytes),
+    status.get());
+  env->ReleaseStringUTFChars(compression_type, c_compression_type);
+  env->ReleaseStringUTFChars(filename, c_filename);
+  CHECK_STATUS(env, status.get(), 0);
+  tensorflow::HandleTracker::Global()->Track(tensorflow::HandleTracker::kRecordReader, reader, 0);
+  return reinterpret_cast<jlong>(reader);
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_prefetchingRecordReaderWrapperReadNext(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::PrefetchingRecordReaderWrapper, reader_handle, nullptr);
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventRecordRead, "RecordReader.readNext");
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  reader->GetNext(status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  const std::string& record = reader->record();
+  tensorflow::jni_metrics::RecordRecordReaderBytes(record.size());
+  event.set_num_bytes(static_cast<tensorflow::int64>(record.size()));
+  jbyteArray record_array = env->NewByteArray(static_cast<jsize>(record.size()));
+  env->SetByteArrayRegion(
+      record_array, 0, static_cast<jsize>(record.size()), reinterpret_cast<const jbyte*>(record.data()));
+  return record_array;
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_prefetchingRecordReaderWrapperReadBatch(
+    JNIEnv* env, jobject object, jlong reader_handle, jint max_records, jint max_bytes, jobject buffer) {
+  REQUIRE_HANDLE(reader, tensorflow::io::PrefetchingRecordReaderWrapper, reader_handle, 0);
+  return read_record_batch(env, reader, max_records, max_bytes, buffer);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_prefetchingRecordReaderWrapperOffset(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::PrefetchingRecordReaderWrapper, reader_handle, -1);
+  return static_cast<jlong>(reader->offset());
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_prefetchingRecordReaderWrapperStatistics(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::PrefetchingRecordReaderWrapper, reader_handle, nullptr);
+  const JVMCache& cache = jvm_cache();
+  return env->CallStaticObjectMethod(
+      cache.record_reader_statistics_class, cache.record_reader_statistics_apply,
+      static_cast<jlong>(reader->stall_time_micros()), static_cast<jlong>(reader->buffered_records()),
+      static_cast<jlong>(reader->buffered_bytes()));
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deletePrefetchingRecordReaderWrapper(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::PrefetchingRecordReaderWrapper, reader_handle, void());
+  tensorflow::HandleTracker::Global()->Untrack(reader);
+  delete reader;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newInterleavedRecordReaderWrapper(
+    JNIEnv* env, jobject object, jobjectArray file_patterns, jstring compression_type, jint cycle_length,
+    jboolean deterministic, jlong max_buffered_records_per_file) {
+  std::vector<std::string> c_file_patterns = to_string_vector(env, file_patterns);
+  const char* c_compression_type = env->GetStringUTFChars(compression_type, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* reader = tensorflow::io::InterleavedRecordReaderWrapper::New(
+    c_file_patterns, std::string(c_compression_type), static_cast<int>(cycle_length), deterministic == JNI_TRUE,
+    static_cast<tensorflow::int64>(max_buffered_records_per_file), status.get());
+  env->ReleaseStringUTFChars(compression_type, c_compression_type);
+  CHECK_STATUS(env, status.get(), 0);
+  tensorflow::HandleTracker::Global()->Track(tensorflow::HandleTracker::kRecordReader, reader, 0);
+  return reinterpret_cast<jlong>(reader);
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_interleavedRecordReaderWrapperReadNext(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::InterleavedRecordReaderWrapper, reader_handle, nullptr);
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventRecordRead, "RecordReader.readNext");
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  reader->GetNext(status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  const std::string& record = reader->record();
+  tensorflow::jni_metrics::RecordRecordReaderBytes(record.size());
+  event.set_num_bytes(static_cast<tensorflow::int64>(record.size()));
+  jbyteArray record_array = env->NewByteArray(static_cast<jsize>(record.size()));
+  env->SetByteArrayRegion(
+      record_array, 0, static_cast<jsize>(record.size()), reinterpret_cast<const jbyte*>(record.data()));
+  return record_array;
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_interleavedRecordReaderWrapperReadBatch(
+    JNIEnv* env, jobject object, jlong reader_handle, jint max_records, jint max_bytes, jobject buffer) {
+  REQUIRE_HANDLE(reader, tensorflow::io::InterleavedRecordReaderWrapper, reader_handle, 0);
+  return read_record_batch(env, reader, max_records, max_bytes, buffer);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_interleavedRecordReaderWrapperNumFiles(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::InterleavedRecordReaderWrapper, reader_handle, -1);
+  return static_cast<jlong>(reader->num_files());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteInterleavedRecordReaderWrapper(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::InterleavedRecordReaderWrapper, reader_handle, void());
+  tensorflow::HandleTracker::Global()->Untrack(reader);
+  delete reader;
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_buildRecordIndices(
+    JNIEnv* env, jobject object, jobjectArray filenames, jobjectArray index_filenames, jint num_threads) {
+  std::vector<tensorflow::uint64> num_records;
+  tensorflow::Status s = tensorflow::io::BuildRecordIndices(
+    to_string_vector(env, filenames), to_string_vector(env, index_filenames), static_cast<int>(num_threads),
+    &num_records);
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), nullptr);
+  }
+  const jsize num_files = static_cast<jsize>(num_records.size());
+  std::vector<jlong> num_records_elements(num_records.begin(), num_records.end());
+  jlongArray num_records_array = env->NewLongArray(num_files);
+  env->SetLongArrayRegion(num_records_array, 0, num_files, num_records_elements.data());
+  return num_records_array;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newIndexedRecordReader(
+    JNIEnv* env, jobject object, jstring filename, jstring index_filename, jboolean verify_checksums) {
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  const char* c_index_filename = env->GetStringUTFChars(index_filename, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* reader = tensorflow::io::IndexedRecordReaderWrapper::New(
+    std::string(c_filename), std::string(c_index_filename), verify_checksums == JNI_TRUE, status.get());
+  env->ReleaseStringUTFChars(index_filename, c_index_filename);
+  env->ReleaseStringUTFChars(filename, c_filename);
+  CHECK_STATUS(env, status.get(), 0);
+  tensorflow::HandleTracker::Global()->Track(tensorflow::HandleTracker::kRecordReader, reader, 0);
+  return reinterpret_cast<jlong>(reader);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_indexedRecordReaderNumRecords(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::IndexedRecordReaderWrapper, reader_handle, -1);
+  return static_cast<jlong>(reader->num_records());
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_indexedRecordReaderRead(
+    JNIEnv* env, jobject object, jlong reader_handle, jlong index) {
+  REQUIRE_HANDLE(reader, tensorflow::io::IndexedRecordReaderWrapper, reader_handle, nullptr);
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventRecordRead, "RecordReader.readIndexed");
+  if (index < 0 || static_cast<tensorflow::uint64>(index) >= reader->num_records()) {
+    throw_exception(env, jvm_index_out_of_bounds_exception, "Record index %lld is out of range.",
+                    static_cast<long long>(index));
+    return nullptr;
+  }
+  const tensorflow::uint64 length = reader->record_length(static_cast<tensorflow::uint64>(index));
+  std::unique_ptr<char[]> record(new char[length]);
+  tensorflow::Status s = reader->Read(static_cast<tensorflow::uint64>(index), record.get());
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), nullptr);
+  }
+  tensorflow::jni_metrics::RecordRecordReaderBytes(length);
+  event.set_num_bytes(static_cast<tensorflow::int64>(length));
+  jbyteArray record_array = env->NewByteArray(static_cast<jsize>(length));
+  env->SetByteArrayRegion(record_array, 0, static_cast<jsize>(length), reinterpret_cast<const jbyte*>(record.get()));
+  return record_array;
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_indexedRecordReaderReadBatch(
+    JNIEnv* env, jobject object, jlong reader_handle, jlongArray indices, jint max_bytes, jobject buffer) {
+  REQUIRE_HANDLE(reader, tensorflow::io::IndexedRecordReaderWrapper, reader_handle, 0);
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventRecordRead, "RecordReader.readIndexedBatch");
+  char* buffer_data = static_cast<char*>(env->GetDirectBufferAddress(buffer));
+  if (buffer_data == nullptr) {
+    throw_exception(env, jvm_illegal_argument_exception, "The provided buffer is not a direct buffer.");
+    return 0;
+  }
+  const jlong capacity = std::min(env->GetDirectBufferCapacity(buffer), static_cast<jlong>(max_bytes));
+  const jsize num_indices = env->GetArrayLength(indices);
+  std::vector<jlong> c_indices(static_cast<size_t>(num_indices));
+  env->GetLongArrayRegion(indices, 0, num_indices, c_indices.data());
+
+  // Records are written in the same format as for the sequential readers and are read directly into the buffer.
+  jint num_records = 0;
+  jlong position = 0;
+  for (jlong index : c_indices) {
+    if (index < 0 || static_cast<tensorflow::uint64>(index) >= reader->num_records()) {
+      throw_exception(env, jvm_index_out_of_bounds_exception, "Record index %lld is out of range.",
+                      static_cast<long long>(index));
+      return 0;
+    }
+    const tensorflow::uint64 length = reader->record_length(static_cast<tensorflow::uint64>(index));
+    if (position + 4 + static_cast<jlong>(length) > capacity) break;
+    for (int i = 0; i < 4; ++i)
+      buffer_data[position++] = static_cast<char>((length >> (8 * i)) & 0xff);
+    tensorflow::Status s = reader->Read(static_cast<tensorflow::uint64>(index), buffer_data + position);
+    if (!s.ok()) {
+      std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+      Set_TF_Status_from_Status(status.get(), s);
+      CHECK_STATUS(env, status.get(), 0);
+    }
+    position += length;
+    ++num_records;
+  }
+  event.set_num_bytes(position - 4 * num_records);
+  event.set_num_outputs(num_records);
+  return num_records;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteIndexedRecordReader(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::IndexedRecordReaderWrapper, reader_handle, void());
+  tensorflow::HandleTracker::Global()->Untrack(reader);
+  delete reader;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newMappedRecordReader(
+    JNIEnv* env, jobject object, jstring filename, jlong start_offset, jboolean verify_checksums) {
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* reader = tensorflow::io::MappedRecordReaderWrapper::New(
+    std::string(c_filename), static_cast<tensorflow::uint64>(start_offset), verify_checksums == JNI_TRUE,
+    status.get());
+  env->ReleaseStringUTFChars(filename, c_filename);
+  CHECK_STATUS(env, status.get(), 0);
+  tensorflow::HandleTracker::Global()->Track(tensorflow::HandleTracker::kRecordReader, reader, 0);
+  return reinterpret_cast<jlong>(reader);
+}
+
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_mappedRecordReaderReadBatch(
+    JNIEnv* env, jobject object, jlong reader_handle, jint max_records) {
+  REQUIRE_HANDLE(reader, tensorflow::io::MappedRecordReaderWrapper, reader_handle, nullptr);
+  std::vector<std::pair<const char*, tensorflow::uint64>> records;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  while (static_cast<jint>(records.size()) < max_records) {
+    const char* data;
+    tensorflow::uint64 length;
+    reader->GetNext(&data, &length, status.get());
+    if (TF_GetCode(status.get()) != TF_OK) {
+      // Errors are only reported if no records have been read. Failed reads do not advance the reader.
+      if (records.empty())
+        CHECK_STATUS(env, status.get(), nullptr);
+      break;
+    }
+    records.emplace_back(data, length);
+  }
+
+  // The returned buffers point directly into the mapped file.
+  const jsize num_records = static_cast<jsize>(records.size());
+  jobjectArray buffers = env->NewObjectArray(num_records, jvm_cache().byte_buffer_class, nullptr);
+  for (jsize i = 0; i < num_records; ++i) {
+    jobject buffer = env->NewDirectByteBuffer(
+        const_cast<char*>(records[i].first), static_cast<jlong>(records[i].second));
+    env->SetObjectArrayElement(buffers, i, buffer);
+    env->DeleteLocalRef(buffer);
+  }
+  return buffers;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_mappedRecordReaderOffset(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::MappedRecordReaderWrapper, reader_handle, -1);
+  return static_cast<jlong>(reader->offset());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteMappedRecordReader(
+    JNIEnv* env, jobject object, jlong reader_handle) {
+  REQUIRE_HANDLE(reader, tensorflow::io::MappedRecordReaderWrapper, reader_handle, void());
+  tensorflow::HandleTracker::Global()->Untrack(reader);
   delete reader;
 }
@@ -87,6 +87,14 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_new
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_recordReaderWrapperReadNext
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    recordReaderWrapperReadBatch
+ * Signature: (JIILjava/nio/ByteBuffer;)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_recordReaderWrapperReadBatch
+  (JNIEnv *, jobject, jlong, jint, jint, jobject);
+
 /*
  * Class:     org_platanios_tensorflow_jni_RecordReader__
  * Method:    recordReaderWrapperOffset
@@ -103,6 +111,174 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_rec
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteRecordReaderWrapper
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    newPrefetchingRecordReaderWrapper
+ * Signature: (Ljava/lang/String;Ljava/lang/String;JJJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newPrefetchingRecordReaderWrapper
+  (JNIEnv *, jobject, jstring, jstring, jlong, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    prefetchingRecordReaderWrapperReadNext
+ * Signature: (J)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_prefetchingRecordReaderWrapperReadNext
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    prefetchingRecordReaderWrapperReadBatch
+ * Signature: (JIILjava/nio/ByteBuffer;)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_prefetchingRecordReaderWrapperReadBatch
+  (JNIEnv *, jobject, jlong, jint, jint, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    prefetchingRecordReaderWrapperOffset
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_prefetchingRecordReaderWrapperOffset
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    prefetchingRecordReaderWrapperStatistics
+ * Signature: (J)Lorg/platanios/tensorflow/jni/RecordReaderStatistics;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_prefetchingRecordReaderWrapperStatistics
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    deletePrefetchingRecordReaderWrapper
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deletePrefetchingRecordReaderWrapper
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    newInterleavedRecordReaderWrapper
+ * Signature: ([Ljava/lang/String;Ljava/lang/String;IZJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newInterleavedRecordReaderWrapper
+  (JNIEnv *, jobject, jobjectArray, jstring, jint, jboolean, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    interleavedRecordReaderWrapperReadNext
+ * Signature: (J)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_interleavedRecordReaderWrapperReadNext
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    interleavedRecordReaderWrapperReadBatch
+ * Signature: (JIILjava/nio/ByteBuffer;)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_interleavedRecordReaderWrapperReadBatch
+  (JNIEnv *, jobject, jlong, jint, jint, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    interleavedRecordReaderWrapperNumFiles
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_interleavedRecordReaderWrapperNumFiles
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    deleteInterleavedRecordReaderWrapper
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteInterleavedRecordReaderWrapper
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    buildRecordIndices
+ * Signature: ([Ljava/lang/String;[Ljava/lang/String;I)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_buildRecordIndices
+  (JNIEnv *, jobject, jobjectArray, jobjectArray, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    newIndexedRecordReader
+ * Signature: (Ljava/lang/String;Ljava/lang/String;Z)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newIndexedRecordReader
+  (JNIEnv *, jobject, jstring, jstring, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    indexedRecordReaderNumRecords
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_indexedRecordReaderNumRecords
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    indexedRecordReaderRead
+ * Signature: (JJ)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_indexedRecordReaderRead
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    indexedRecordReaderReadBatch
+ * Signature: (J[JILjava/nio/ByteBuffer;)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_indexedRecordReaderReadBatch
+  (JNIEnv *, jobject, jlong, jlongArray, jint, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    deleteIndexedRecordReader
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteIndexedRecordReader
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    newMappedRecordReader
+ * Signature: (Ljava/lang/String;JZ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_newMappedRecordReader
+  (JNIEnv *, jobject, jstring, jlong, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    mappedRecordReaderReadBatch
+ * Signature: (JI)[Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_mappedRecordReaderReadBatch
+  (JNIEnv *, jobject, jlong, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    mappedRecordReaderOffset
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_mappedRecordReaderOffset
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordReader__
+ * Method:    deleteMappedRecordReader
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordReader_00024_deleteMappedRecordReader
+  (JNIEnv *, jobject, jlong);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,88 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "record_writer.h"
+#include "utilities.h"
+
+#include <memory>
+
+#include "tensorflow/c/record_writer.h"
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_newRecordWriter(
+    JNIEnv* env, jobject object, jstring filename, jstring compression_type, jboolean append,
+    jlong flush_interval_millis) {
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  const char* c_compression_type = env->GetStringUTFChars(compression_type, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* writer = tensorflow::io::RecordWriterWrapper::New(
+    std::string(c_filename), std::string(c_compression_type), append == JNI_TRUE,
+    static_cast<tensorflow::int64>(flush_interval_millis), status.get());
+  env->ReleaseStringUTFChars(compression_type, c_compression_type);
+  env->ReleaseStringUTFChars(filename, c_filename);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(writer);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_recordWriterWrite(
+    JNIEnv* env, jobject object, jlong writer_handle, jbyteArray record) {
+  REQUIRE_HANDLE(writer, tensorflow::io::RecordWriterWrapper, writer_handle, void());
+  const jsize length = env->GetArrayLength(record);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  // The record is written while the array is pinned, which avoids copying it, and the status is checked once the
+  // array has been released.
+  char* data = static_cast<char*>(env->GetPrimitiveArrayCritical(record, nullptr));
+  writer->Write(tensorflow::StringPiece(data, static_cast<size_t>(length)), status.get());
+  env->ReleasePrimitiveArrayCritical(record, data, JNI_ABORT);
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_recordWriterWriteBatch(
+    JNIEnv* env, jobject object, jlong writer_handle, jobject buffer, jint length, jint num_records) {
+  REQUIRE_HANDLE(writer, tensorflow::io::RecordWriterWrapper, writer_handle, void());
+  const char* data = static_cast<const char*>(env->GetDirectBufferAddress(buffer));
+  if (data == nullptr) {
+    throw_exception(env, jvm_illegal_argument_exception, "The provided buffer is not a direct buffer.");
+    return;
+  }
+  if (length < 0 || static_cast<jlong>(length) > env->GetDirectBufferCapacity(buffer)) {
+    throw_exception(env, jvm_illegal_argument_exception, "Invalid batch length: %d.", length);
+    return;
+  }
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  writer->WriteBatch(data, static_cast<size_t>(length), static_cast<tensorflow::int64>(num_records), status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_recordWriterFlush(
+    JNIEnv* env, jobject object, jlong writer_handle) {
+  REQUIRE_HANDLE(writer, tensorflow::io::RecordWriterWrapper, writer_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  writer->Flush(status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_recordWriterClose(
+    JNIEnv* env, jobject object, jlong writer_handle) {
+  REQUIRE_HANDLE(writer, tensorflow::io::RecordWriterWrapper, writer_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  writer->Close(status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_deleteRecordWriter(
+    JNIEnv* env, jobject object, jlong writer_handle) {
+  REQUIRE_HANDLE(writer, tensorflow::io::RecordWriterWrapper, writer_handle, void());
+  delete writer;
+}
@@ -0,0 +1,61 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_RecordWriter__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_RecordWriter__
+#define _Included_org_platanios_tensorflow_jni_RecordWriter__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordWriter__
+ * Method:    newRecordWriter
+ * Signature: (Ljava/lang/String;Ljava/lang/String;ZJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_newRecordWriter
+  (JNIEnv *, jobject, jstring, jstring, jboolean, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordWriter__
+ * Method:    recordWriterWrite
+ * Signature: (J[B)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_recordWriterWrite
+  (JNIEnv *, jobject, jlong, jbyteArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordWriter__
+ * Method:    recordWriterWriteBatch
+ * Signature: (JLjava/nio/ByteBuffer;II)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_recordWriterWriteBatch
+  (JNIEnv *, jobject, jlong, jobject, jint, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordWriter__
+ * Method:    recordWriterFlush
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_recordWriterFlush
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordWriter__
+ * Method:    recordWriterClose
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_recordWriterClose
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_RecordWriter__
+ * Method:    deleteRecordWriter
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_RecordWriter_00024_deleteRecordWriter
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
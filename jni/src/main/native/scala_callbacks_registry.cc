@@ -0,0 +1,34 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "scala_callbacks_registry.h"
+#include "exception.h"
+
+namespace {
+  // Signature of the completion functions of asynchronous JVM callback ops, which are defined in the op library.
+  typedef void (*AsyncCallbackCompletionFunction)(
+      JNIEnv* env, jlong call_handle, jlongArray outputs, jstring exception_class_name, jstring message);
+}  // namespace
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_ScalaCallbacksRegistry_00024_completeAsync(
+    JNIEnv* env, jobject object, jlong completion_function_pointer, jlong call_handle, jlongArray outputs,
+    jstring exception_class_name, jstring message) {
+  if (completion_function_pointer == 0 || call_handle == 0) {
+    throw_exception(env, jvm_null_pointer_exception, "Invalid asynchronous callback completion handle.");
+    return;
+  }
+  auto complete = reinterpret_cast<AsyncCallbackCompletionFunction>(completion_function_pointer);
+  complete(env, call_handle, outputs, exception_class_name, message);
+}
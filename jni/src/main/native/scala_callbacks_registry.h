@@ -0,0 +1,21 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_ScalaCallbacksRegistry__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_ScalaCallbacksRegistry__
+#define _Included_org_platanios_tensorflow_jni_ScalaCallbacksRegistry__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_ScalaCallbacksRegistry__
+ * Method:    completeAsync
+ * Signature: (JJ[JLjava/lang/String;Ljava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_ScalaCallbacksRegistry_00024_completeAsync
+  (JNIEnv *, jobject, jlong, jlong, jlongArray, jstring, jstring);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
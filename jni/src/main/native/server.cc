@@ -17,10 +17,48 @@
 #include "server.h"
 #include "utilities.h"
 
+#include "jvm_cache.h"
+
+#include "tensorflow/c/cluster_membership.h"
 #include "tensorflow/c/status_helper.h"
 #include "tensorflow/core/distributed_runtime/server_lib.h"
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/mutex.h"
+
+#include <unordered_map>
+
+namespace {
+  // Servers that have been detached from their Java objects, and which keep running (along with the state of their
+  // devices) until a new server is created with the same configuration, keyed by their "ServerDef" text format (which
+  // prints map fields in a deterministic order).
+  struct DetachedServers {
+    tensorflow::mutex mu;
+    std::unordered_map<std::string, tensorflow::ServerInterface*> servers;
+    // Keys of all servers created through this library, used to move them to and from the set of detached servers.
+    std::unordered_map<tensorflow::ServerInterface*, std::string> keys;
+  };
+
+  DetachedServers& detached_servers() {
+    static DetachedServers* servers = new DetachedServers;
+    return *servers;
+  }
+
+  // Throws a Java exception if "status" is not OK, and otherwise returns "version".
+  jlong membership_version_or_throw(JNIEnv* env, const tensorflow::Status& status, tensorflow::int64 version) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> c_status(TF_NewStatus(), TF_DeleteStatus);
+    tensorflow::Set_TF_Status_from_Status(c_status.get(), status);
+    CHECK_STATUS(env, c_status.get(), 0);
+    return static_cast<jlong>(version);
+  }
+
+  std::string to_std_string(JNIEnv* env, jstring value) {
+    const char* c_value = env->GetStringUTFChars(value, nullptr);
+    std::string result(c_value);
+    env->ReleaseStringUTFChars(value, c_value);
+    return result;
+  }
+}  // namespace
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_newServer(
     JNIEnv* env, jobject object, jbyteArray server_def_proto) {
@@ -29,15 +67,29 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_newServer
   tensorflow::Status status;
   if (!server_def.ParseFromArray(c_server_def_proto, static_cast<size_t>(env->GetArrayLength(server_def_proto))))
     status = tensorflow::errors::InvalidArgument("Unparsable ServerDef proto.");
-  std::unique_ptr<tensorflow::ServerInterface>* server;
-  if (status.ok())
-    status = tensorflow::NewServer(server_def, server);
-  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> c_status(TF_NewStatus(), TF_DeleteStatus);
   if (server_def_proto != nullptr)
     env->ReleaseByteArrayElements(server_def_proto, c_server_def_proto, JNI_ABORT);
+  std::unique_ptr<tensorflow::ServerInterface> server;
+  if (status.ok()) {
+    // Reattach to a detached server with the same configuration, if there is one, so that the state of its devices
+    // (e.g., variables, queues, and tables) is preserved.
+    const std::string key = server_def.DebugString();
+    DetachedServers& detached = detached_servers();
+    tensorflow::mutex_lock lock(detached.mu);
+    auto it = detached.servers.find(key);
+    if (it != detached.servers.end()) {
+      server.reset(it->second);
+      detached.servers.erase(it);
+    } else {
+      status = tensorflow::NewServer(server_def, &server);
+      if (status.ok()) detached.keys[server.get()] = key;
+    }
+  }
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> c_status(TF_NewStatus(), TF_DeleteStatus);
   tensorflow::Set_TF_Status_from_Status(c_status.get(), status);
   CHECK_STATUS(env, c_status.get(), 0);
-  return reinterpret_cast<jlong>(server->release());
+  tensorflow::ClusterMembership::Global()->Register(server->target(), server_def);
+  return reinterpret_cast<jlong>(server.release());
 }
 
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Server_00024_target(
@@ -78,5 +130,121 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Server_00024_deleteServ
     JNIEnv* env, jobject object, jlong server_handle) {
   typedef tensorflow::ServerInterface ServerInterface;
   REQUIRE_HANDLE(server, ServerInterface, server_handle, void());
+  {
+    DetachedServers& detached = detached_servers();
+    tensorflow::mutex_lock lock(detached.mu);
+    detached.keys.erase(server);
+  }
+  tensorflow::ClusterMembership::Global()->Unregister(server->target());
   delete server;
 }
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Server_00024_detachServer(
+    JNIEnv* env, jobject object, jlong server_handle) {
+  typedef tensorflow::ServerInterface ServerInterface;
+  REQUIRE_HANDLE(server, ServerInterface, server_handle, void());
+  DetachedServers& detached = detached_servers();
+  tensorflow::mutex_lock lock(detached.mu);
+  auto key = detached.keys.find(server);
+  if (key == detached.keys.end()) {
+    throw_exception(env, tf_invalid_argument_exception, "The provided server was not created by this library.");
+    return;
+  }
+  auto existing = detached.servers.find(key->second);
+  if (existing != detached.servers.end() && existing->second != server) {
+    throw_exception(
+        env, tf_already_exists_exception, "Another server with the same configuration has already been detached.");
+    return;
+  }
+  detached.servers[key->second] = server;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_updateCluster(
+    JNIEnv* env, jobject object, jlong server_handle, jbyteArray cluster_def_proto) {
+  typedef tensorflow::ServerInterface ServerInterface;
+  REQUIRE_HANDLE(server, ServerInterface, server_handle, 0);
+  tensorflow::ClusterDef cluster_def;
+  jbyte* c_cluster_def_proto = env->GetByteArrayElements(cluster_def_proto, nullptr);
+  const bool parsed = cluster_def.ParseFromArray(
+      c_cluster_def_proto, static_cast<int>(env->GetArrayLength(cluster_def_proto)));
+  env->ReleaseByteArrayElements(cluster_def_proto, c_cluster_def_proto, JNI_ABORT);
+  tensorflow::int64 version = 0;
+  tensorflow::Status status = parsed
+      ? tensorflow::ClusterMembership::Global()->Update(server->target(), cluster_def, &version)
+      : tensorflow::errors::InvalidArgument("Unparsable ClusterDef proto.");
+  return membership_version_or_throw(env, status, version);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_addTask(
+    JNIEnv* env, jobject object, jlong server_handle, jstring job_name, jint task_index, jstring address) {
+  typedef tensorflow::ServerInterface ServerInterface;
+  REQUIRE_HANDLE(server, ServerInterface, server_handle, 0);
+  tensorflow::int64 version = 0;
+  tensorflow::Status status = tensorflow::ClusterMembership::Global()->AddTask(
+      server->target(), to_std_string(env, job_name), static_cast<tensorflow::int32>(task_index),
+      to_std_string(env, address), &version);
+  return membership_version_or_throw(env, status, version);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_removeTask(
+    JNIEnv* env, jobject object, jlong server_handle, jstring job_name, jint task_index) {
+  typedef tensorflow::ServerInterface ServerInterface;
+  REQUIRE_HANDLE(server, ServerInterface, server_handle, 0);
+  tensorflow::int64 version = 0;
+  tensorflow::Status status = tensorflow::ClusterMembership::Global()->RemoveTask(
+      server->target(), to_std_string(env, job_name), static_cast<tensorflow::int32>(task_index), &version);
+  return membership_version_or_throw(env, status, version);
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Server_00024_cluster(
+    JNIEnv* env, jobject object, jlong server_handle) {
+  typedef tensorflow::ServerInterface ServerInterface;
+  REQUIRE_HANDLE(server, ServerInterface, server_handle, nullptr);
+  tensorflow::ClusterDef cluster_def;
+  tensorflow::int64 version = 0;
+  tensorflow::Status status = tensorflow::ClusterMembership::Global()->Get(server->target(), &cluster_def, &version);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> c_status(TF_NewStatus(), TF_DeleteStatus);
+  tensorflow::Set_TF_Status_from_Status(c_status.get(), status);
+  CHECK_STATUS(env, c_status.get(), nullptr);
+  const std::string serialized = cluster_def.SerializeAsString();
+  jbyteArray result = env->NewByteArray(static_cast<jsize>(serialized.size()));
+  env->SetByteArrayRegion(
+      result, 0, static_cast<jsize>(serialized.size()), reinterpret_cast<const jbyte*>(serialized.data()));
+  return result;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_clusterVersion(
+    JNIEnv* env, jobject object, jlong server_handle) {
+  typedef tensorflow::ServerInterface ServerInterface;
+  REQUIRE_HANDLE(server, ServerInterface, server_handle, 0);
+  tensorflow::ClusterDef cluster_def;
+  tensorflow::int64 version = 0;
+  tensorflow::Status status = tensorflow::ClusterMembership::Global()->Get(server->target(), &cluster_def, &version);
+  return membership_version_or_throw(env, status, version);
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Server_00024_collectMetrics(
+    JNIEnv* env, jobject object, jlong server_handle, jstring prefix) {
+  typedef tensorflow::ServerInterface ServerInterface;
+  REQUIRE_HANDLE(server, ServerInterface, server_handle, nullptr);
+  std::string c_prefix;
+  if (prefix != nullptr) {
+    const char* prefix_chars = env->GetStringUTFChars(prefix, nullptr);
+    c_prefix = prefix_chars;
+    env->ReleaseStringUTFChars(prefix, prefix_chars);
+  }
+
+  // The metrics registry is shared by the whole process, and so it includes the metrics of the server, along with
+  // those of any sessions running in the same process.
+  return collected_metrics_to_java(env, c_prefix);
+}
+
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_Server_00024_isProtocolSupported(
+    JNIEnv* env, jobject object, jstring protocol) {
+  const char* c_protocol = env->GetStringUTFChars(protocol, nullptr);
+  tensorflow::ServerDef server_def;
+  server_def.set_protocol(c_protocol);
+  env->ReleaseStringUTFChars(protocol, c_protocol);
+  tensorflow::ServerFactory* factory;
+  return static_cast<jboolean>(tensorflow::ServerFactory::GetFactory(server_def, &factory).ok());
+}
@@ -55,6 +55,70 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Server_00024_joinServer
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Server_00024_deleteServer
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Server__
+ * Method:    collectMetrics
+ * Signature: (JLjava/lang/String;)Lorg/platanios/tensorflow/jni/CollectedMetrics;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Server_00024_collectMetrics
+  (JNIEnv *, jobject, jlong, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Server__
+ * Method:    isProtocolSupported
+ * Signature: (Ljava/lang/String;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_Server_00024_isProtocolSupported
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Server__
+ * Method:    detachServer
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Server_00024_detachServer
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Server__
+ * Method:    updateCluster
+ * Signature: (J[B)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_updateCluster
+  (JNIEnv *, jobject, jlong, jbyteArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Server__
+ * Method:    addTask
+ * Signature: (JLjava/lang/String;ILjava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_addTask
+  (JNIEnv *, jobject, jlong, jstring, jint, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Server__
+ * Method:    removeTask
+ * Signature: (JLjava/lang/String;I)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_removeTask
+  (JNIEnv *, jobject, jlong, jstring, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Server__
+ * Method:    cluster
+ * Signature: (J)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Server_00024_cluster
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Server__
+ * Method:    clusterVersion
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Server_00024_clusterVersion
+  (JNIEnv *, jobject, jlong);
+
 #ifdef __cplusplus
 }
 #endif
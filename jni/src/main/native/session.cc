@@ -14,13 +14,34 @@
  */
 
 #include "exception.h"
+#include "jvm_cache.h"
 #include "session.h"
 #include "utilities.h"
 
 #include <string.h>
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <vector>
 
 #include "tensorflow/c/c_api.h"
+#include "tensorflow/c/batch_scheduler.h"
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/c/chrome_trace.h"
+#include "tensorflow/c/cluster_membership.h"
+#include "tensorflow/c/dataset_iterator.h"
+#include "tensorflow/c/metrics_exporter.h"
+#include "tensorflow/c/native_event_recorder.h"
+#include "tensorflow/c/native_executor.h"
+#include "tensorflow/c/session_recovery.h"
+#include "tensorflow/c/shared_thread_pools.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/c/step_stats_aggregator.h"
+#include "tensorflow/core/common_runtime/device_mgr.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/protobuf/config.pb.h"
+#include "tensorflow/core/protobuf/meta_graph.pb.h"
 
 namespace {
   void TF_MaybeDeleteBuffer(TF_Buffer* buffer) {
@@ -33,12 +54,93 @@ namespace {
   unique_tf_buffer MakeUniqueBuffer(TF_Buffer* buffer) {
     return unique_tf_buffer(buffer, (void (&&)(TF_Buffer*)) TF_MaybeDeleteBuffer);
   }
+
+  // Pre-resolved feeds, fetches, and targets of a session step, along with the run options to use when executing it.
+  // Callables allow running the same step repeatedly without marshalling all of its arguments over JNI every time.
+  struct SessionCallable {
+    TF_Session* session;
+    std::vector<TF_Output> inputs;
+    std::vector<TF_Output> outputs;
+    std::vector<TF_Operation*> targets;
+    unique_tf_buffer run_options;
+    // Run options with full tracing enabled, used for the steps that are profiled, and the same options with the
+    // output of the partition graphs also enabled.
+    unique_tf_buffer traced_run_options;
+    unique_tf_buffer partitioned_traced_run_options;
+    // Index of the inter-op thread pool that the steps run on (i.e., "RunOptions.inter_op_thread_pool").
+    tensorflow::int32 inter_op_thread_pool = 0;
+
+    SessionCallable()
+        : session(nullptr), run_options(MakeUniqueBuffer(nullptr)), traced_run_options(MakeUniqueBuffer(nullptr)),
+          partitioned_traced_run_options(MakeUniqueBuffer(nullptr)) {}
+
+    void Run(TF_Tensor* const* input_values, TF_Tensor** output_values, TF_Buffer* run_metadata, TF_Status* status) {
+      Run(run_options.get(), input_values, output_values, run_metadata, status);
+    }
+
+    void Run(
+        const TF_Buffer* options, TF_Tensor* const* input_values, TF_Tensor** output_values, TF_Buffer* run_metadata,
+        TF_Status* status) {
+      tensorflow::jni_metrics::ScopedSessionRunTimer timer;
+      tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventSessionRun, "Session.runCallable");
+      event.set_num_inputs(static_cast<tensorflow::int32>(inputs.size()));
+      event.set_num_outputs(static_cast<tensorflow::int32>(outputs.size()));
+      tensorflow::SharedThreadPoolRegistry::ScopedStep step(session, inter_op_thread_pool);
+      TF_SessionRun(
+          session, options, inputs.data(), input_values, static_cast<int>(inputs.size()), outputs.data(),
+          output_values, static_cast<int>(outputs.size()), targets.data(), static_cast<int>(targets.size()),
+          run_metadata, status);
+    }
+  };
+
+  // Number of timestamps in the timing records of session runs: (i) entry to the native method (i.e., start of the
+  // marshalling of the arguments), (ii) entry to TF_SessionRun, (iii) exit from TF_SessionRun, and (iv) end of the
+  // marshalling of the outputs.
+  const jsize kNumRunTimestamps = 4;
+
+  // Returns a timestamp of a monotonic high-resolution clock, in nanoseconds. Only differences between these
+  // timestamps are meaningful.
+  inline jlong MonotonicNanos() {
+    return static_cast<jlong>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+  }
+
+  // Parses "config_proto", sizes its named inter-op thread pools using the shared thread pool registry, and sets it as
+  // the configuration of "options". Returns "false", after throwing a Java exception, if any of these steps fails.
+  bool SetResolvedConfig(
+      JNIEnv* env, jbyteArray config_proto, TF_SessionOptions* options, tensorflow::ConfigProto* config) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    jbyte* c_config_proto = env->GetByteArrayElements(config_proto, nullptr);
+    const bool parsed = config->ParseFromArray(c_config_proto, static_cast<int>(env->GetArrayLength(config_proto)));
+    env->ReleaseByteArrayElements(config_proto, c_config_proto, JNI_ABORT);
+    tensorflow::Status s = parsed ? tensorflow::SharedThreadPoolRegistry::Global()->ResolveConfig(config)
+                                  : tensorflow::errors::InvalidArgument("Unparseable ConfigProto.");
+    if (s.ok()) {
+      const std::string serialized = config->SerializeAsString();
+      TF_SetConfig(options, serialized.data(), serialized.size(), status.get());
+    } else {
+      Set_TF_Status_from_Status(status.get(), s);
+    }
+    CHECK_STATUS(env, status.get(), false);
+    return true;
+  }
+
+  jbyteArray RunMetadataToByteArray(JNIEnv* env, const TF_Buffer* run_metadata) {
+    if (run_metadata == nullptr) return nullptr;
+    jbyteArray return_array = env->NewByteArray(static_cast<jsize>(run_metadata->length));
+    env->SetByteArrayRegion(
+        return_array, 0, static_cast<jsize>(run_metadata->length), static_cast<const jbyte*>(run_metadata->data));
+    return return_array;
+  }
 }  // namespace
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocate(
-    JNIEnv* env, jobject object, jlong graph_handle, jstring target, jbyteArray config_proto) {
+    JNIEnv* env, jobject object, jlong graph_handle, jstring target, jbyteArray config_proto, jintArray cpus,
+    jint numa_node) {
   REQUIRE_HANDLE(graph, TF_Graph, graph_handle, 0);
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<int> cpu_set;
+  if (!resolve_cpu_set(env, cpus, numa_node, &cpu_set)) return 0;
 
   TF_SessionOptions* options = TF_NewSessionOptions();
 
@@ -50,14 +152,28 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocate
   }
 
   // Set the configuration proto, if one has been provided.
-  jbyte* c_config_proto;
-  if (config_proto != nullptr) {
-    c_config_proto = env->GetByteArrayElements(config_proto, nullptr);
-    TF_SetConfig(options, c_config_proto, static_cast<size_t>(env->GetArrayLength(config_proto)), status.get());
+  tensorflow::ConfigProto config;
+  if (config_proto != nullptr && !SetResolvedConfig(env, config_proto, options, &config)) return 0;
+
+  // Sessions created on the target of a server whose cluster has been updated use its current cluster, unless their
+  // configuration specifies one.
+  if (target != nullptr && !config.has_cluster_def() &&
+      tensorflow::ClusterMembership::Global()->Apply(c_target, &config)) {
+    const std::string serialized = config.SerializeAsString();
+    TF_SetConfig(options, serialized.data(), serialized.size(), status.get());
     CHECK_STATUS(env, status.get(), 0);
   }
 
-  TF_Session* session = TF_NewSession(graph, options, status.get());
+  // The session thread pools are created along with the session and inherit the CPU affinity of this thread.
+  TF_Session* session = nullptr;
+  {
+    tensorflow::ScopedThreadAffinity affinity(cpu_set);
+    if (!affinity.status().ok()) {
+      Set_TF_Status_from_Status(status.get(), affinity.status());
+      CHECK_STATUS(env, status.get(), 0);
+    }
+    session = TF_NewSession(graph, options, status.get());
+  }
   CHECK_STATUS(env, status.get(), 0);
 
   TF_DeleteSessionOptions(options);
@@ -66,16 +182,80 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocate
     env->ReleaseStringUTFChars(target, c_target);
   }
 
-  if (config_proto != nullptr) {
-    env->ReleaseByteArrayElements(config_proto, c_config_proto, JNI_ABORT);
+  tensorflow::SharedThreadPoolRegistry::Global()->AttachSession(session, config);
+  return reinterpret_cast<jlong>(session);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_loadFromSavedModel(
+    JNIEnv* env, jobject object, jlong graph_handle, jstring export_dir, jobjectArray tags, jbyteArray config_proto,
+    jbyteArray run_options, jintArray cpus, jint numa_node, jobjectArray meta_graph_def) {
+  REQUIRE_HANDLE(graph, TF_Graph, graph_handle, 0);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<int> cpu_set;
+  if (!resolve_cpu_set(env, cpus, numa_node, &cpu_set)) return 0;
+
+  std::unique_ptr<TF_SessionOptions, decltype(&TF_DeleteSessionOptions)> options(
+      TF_NewSessionOptions(), TF_DeleteSessionOptions);
+  tensorflow::ConfigProto config;
+  if (config_proto != nullptr && !SetResolvedConfig(env, config_proto, options.get(), &config)) return 0;
+  unique_tf_buffer c_run_options = MakeUniqueBuffer(nullptr);
+  if (run_options != nullptr) {
+    jbyte* c_run_options_bytes = env->GetByteArrayElements(run_options, nullptr);
+    c_run_options.reset(TF_NewBufferFromString(
+        c_run_options_bytes, static_cast<size_t>(env->GetArrayLength(run_options))));
+    env->ReleaseByteArrayElements(run_options, c_run_options_bytes, JNI_ABORT);
   }
+  std::vector<std::string> c_tags = to_string_vector(env, tags);
+  std::vector<const char*> c_tag_pointers;
+  for (const std::string& tag : c_tags)
+    c_tag_pointers.push_back(tag.c_str());
+  const char* c_export_dir = env->GetStringUTFChars(export_dir, nullptr);
+  unique_tf_buffer c_meta_graph_def = MakeUniqueBuffer(TF_NewBuffer());
 
+  // The graph is imported and the variables are restored by running the restore op of the saver of the SavedModel,
+  // all natively and without going through the JVM. As for "allocate", the session thread pools are created along
+  // with the session and inherit the CPU affinity of this thread.
+  TF_Session* session = nullptr;
+  {
+    tensorflow::ScopedThreadAffinity affinity(cpu_set);
+    if (!affinity.status().ok()) {
+      env->ReleaseStringUTFChars(export_dir, c_export_dir);
+      Set_TF_Status_from_Status(status.get(), affinity.status());
+      CHECK_STATUS(env, status.get(), 0);
+    }
+    session = TF_LoadSessionFromSavedModel(
+        options.get(), c_run_options.get(), c_export_dir, c_tag_pointers.data(),
+        static_cast<int>(c_tag_pointers.size()), graph, c_meta_graph_def.get(), status.get());
+  }
+  env->ReleaseStringUTFChars(export_dir, c_export_dir);
+  CHECK_STATUS(env, status.get(), 0);
+
+  // The graph definition is already in the graph and so it is dropped from the returned meta graph definition, which
+  // is then mostly made up of the signature definitions.
+  tensorflow::MetaGraphDef c_meta_graph_def_proto;
+  if (!c_meta_graph_def_proto.ParseFromArray(
+      c_meta_graph_def->data, static_cast<int>(c_meta_graph_def->length))) {
+    TF_CloseSession(session, status.get());
+    TF_DeleteSession(session, status.get());
+    throw_exception(env, tf_invalid_argument_exception, "Unable to parse the loaded 'MetaGraphDef'.");
+    return 0;
+  }
+  c_meta_graph_def_proto.clear_graph_def();
+  const std::string serialized = c_meta_graph_def_proto.SerializeAsString();
+  jbyteArray meta_graph_def_bytes = env->NewByteArray(static_cast<jsize>(serialized.size()));
+  env->SetByteArrayRegion(
+      meta_graph_def_bytes, 0, static_cast<jsize>(serialized.size()),
+      reinterpret_cast<const jbyte*>(serialized.data()));
+  env->SetObjectArrayElement(meta_graph_def, 0, meta_graph_def_bytes);
+  env->DeleteLocalRef(meta_graph_def_bytes);
+  tensorflow::SharedThreadPoolRegistry::Global()->AttachSession(session, config);
   return reinterpret_cast<jlong>(session);
 }
 
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_delete(
     JNIEnv* env, jobject object, jlong handle) {
   REQUIRE_HANDLE(session, TF_Session, handle, void());
+  tensorflow::SharedThreadPoolRegistry::Global()->DetachSession(session);
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
   TF_CloseSession(session, status.get());
   CHECK_STATUS(env, status.get(), void());
@@ -87,8 +267,16 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_delete(
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_run(
     JNIEnv* env, jobject object, jlong handle, jbyteArray jrun_options, jlongArray input_tensor_handles,
     jlongArray input_op_handles, jintArray input_op_indices, jlongArray output_op_handles, jintArray output_op_indices,
-    jlongArray target_op_handles, jboolean want_run_metadata, jlongArray output_tensor_handles) {
+    jlongArray target_op_handles, jboolean want_run_metadata, jlongArray output_tensor_handles, jlongArray timings) {
+  jlong timestamps[kNumRunTimestamps];
+  timestamps[0] = MonotonicNanos();
   REQUIRE_HANDLE(session, TF_Session, handle, nullptr);
+  if (timings != nullptr && env->GetArrayLength(timings) != kNumRunTimestamps) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Expected a timings array with length %d, but got %d, instead.",
+        kNumRunTimestamps, env->GetArrayLength(timings));
+    return nullptr;
+  }
 
   const jint num_inputs = env->GetArrayLength(input_tensor_handles);
   const jint num_outputs = env->GetArrayLength(output_tensor_handles);
@@ -107,37 +295,833 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_run
   REQUIRE_HANDLES(target_op_handles, targets.get(), num_targets, nullptr);
 
   unique_tf_buffer run_options(MakeUniqueBuffer(nullptr));
-  jbyte* jrun_options_data = nullptr;
   if (jrun_options != nullptr) {
     size_t sz = (size_t) env->GetArrayLength(jrun_options);
     if (sz > 0) {
-      jrun_options_data = env->GetByteArrayElements(jrun_options, nullptr);
+      // The run options are copied into the buffer and so the array elements can be released right away.
+      jbyte* jrun_options_data = static_cast<jbyte*>(env->GetPrimitiveArrayCritical(jrun_options, nullptr));
       run_options.reset(TF_NewBufferFromString(static_cast<void*>(jrun_options_data), sz));
+      env->ReleasePrimitiveArrayCritical(jrun_options, jrun_options_data, JNI_ABORT);
     }
   }
 
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
-  TF_SessionRun(
-      session, run_options.get(), inputs.get(), input_values.get(), static_cast<int>(num_inputs), outputs.get(),
-      output_values.get(), static_cast<int>(num_outputs), reinterpret_cast<const TF_Operation* const*>(targets.get()),
-      static_cast<int>(num_targets), run_metadata.get(), status.get());
+  timestamps[1] = MonotonicNanos();
+  tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventSessionRun, "Session.run");
+  if (event.active()) {
+    event.set_num_inputs(num_inputs);
+    event.set_num_outputs(num_outputs);
+    tensorflow::int64 num_feed_bytes = 0;
+    for (jint i = 0; i < num_inputs; ++i)
+      num_feed_bytes += static_cast<tensorflow::int64>(TF_TensorByteSize(input_values[i]));
+    event.set_num_bytes(num_feed_bytes);
+  }
+  {
+    tensorflow::SharedThreadPoolRegistry::ScopedStep step(
+        session, run_options != nullptr ? run_options->data : nullptr,
+        run_options != nullptr ? run_options->length : 0);
+    TF_SessionRun(
+        session, run_options.get(), inputs.get(), input_values.get(), static_cast<int>(num_inputs), outputs.get(),
+        output_values.get(), static_cast<int>(num_outputs), reinterpret_cast<const TF_Operation* const*>(targets.get()),
+        static_cast<int>(num_targets), run_metadata.get(), status.get());
+  }
+  timestamps[2] = MonotonicNanos();
+  tensorflow::jni_metrics::RecordSessionRun(static_cast<tensorflow::uint64>((timestamps[2] - timestamps[1]) / 1000));
+  CHECK_STATUS(env, status.get(), nullptr);
+
+  set_handles(env, output_values.get(), output_tensor_handles, num_outputs);
+
+  jbyteArray run_metadata_array = RunMetadataToByteArray(env, run_metadata.get());
+  timestamps[3] = MonotonicNanos();
+  if (timings != nullptr) env->SetLongArrayRegion(timings, 0, kNumRunTimestamps, timestamps);
+  return run_metadata_array;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_makeCallable(
+    JNIEnv* env, jobject object, jlong handle, jbyteArray jrun_options, jlongArray input_op_handles,
+    jintArray input_op_indices, jlongArray output_op_handles, jintArray output_op_indices,
+    jlongArray target_op_handles) {
+  REQUIRE_HANDLE(session, TF_Session, handle, 0);
+
+  const jint num_inputs = env->GetArrayLength(input_op_handles);
+  const jint num_outputs = env->GetArrayLength(output_op_handles);
+  const jint num_targets = env->GetArrayLength(target_op_handles);
+
+  std::unique_ptr<SessionCallable> callable(new SessionCallable());
+  callable->session = session;
+  callable->inputs.resize(static_cast<size_t>(num_inputs));
+  callable->outputs.resize(static_cast<size_t>(num_outputs));
+  callable->targets.resize(static_cast<size_t>(num_targets));
+
+  REQUIRE_OUTPUTS(input_op_handles, input_op_indices, callable->inputs.data(), num_inputs, 0);
+  REQUIRE_OUTPUTS(output_op_handles, output_op_indices, callable->outputs.data(), num_outputs, 0);
+  REQUIRE_HANDLES(target_op_handles, callable->targets.data(), num_targets, 0);
+
+  if (jrun_options != nullptr) {
+    size_t sz = (size_t) env->GetArrayLength(jrun_options);
+    if (sz > 0) {
+      jbyte* jrun_options_data = static_cast<jbyte*>(env->GetPrimitiveArrayCritical(jrun_options, nullptr));
+      callable->run_options.reset(TF_NewBufferFromString(static_cast<void*>(jrun_options_data), sz));
+      env->ReleasePrimitiveArrayCritical(jrun_options, jrun_options_data, JNI_ABORT);
+    }
+  }
+
+  tensorflow::RunOptions traced_run_options;
+  if (callable->run_options != nullptr)
+    traced_run_options.ParseFromArray(callable->run_options->data, static_cast<int>(callable->run_options->length));
+  callable->inter_op_thread_pool = traced_run_options.inter_op_thread_pool();
+  traced_run_options.set_trace_level(tensorflow::RunOptions::FULL_TRACE);
+  std::string serialized_traced_run_options = traced_run_options.SerializeAsString();
+  callable->traced_run_options.reset(
+      TF_NewBufferFromString(serialized_traced_run_options.data(), serialized_traced_run_options.size()));
+  traced_run_options.set_output_partition_graphs(true);
+  serialized_traced_run_options = traced_run_options.SerializeAsString();
+  callable->partitioned_traced_run_options.reset(
+      TF_NewBufferFromString(serialized_traced_run_options.data(), serialized_traced_run_options.size()));
+
+  return reinterpret_cast<jlong>(callable.release());
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallable(
+    JNIEnv* env, jobject object, jlong callable_handle, jlongArray input_tensor_handles, jboolean want_run_metadata,
+    jlongArray output_tensor_handles) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, nullptr);
+
+  const jint num_inputs = static_cast<jint>(callable->inputs.size());
+  const jint num_outputs = static_cast<jint>(callable->outputs.size());
+  if (env->GetArrayLength(output_tensor_handles) != num_outputs) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Expected %d output tensor handles, but got %d, instead.", num_outputs,
+        env->GetArrayLength(output_tensor_handles));
+    return nullptr;
+  }
+
+  std::unique_ptr<TF_Tensor* []> input_values(new TF_Tensor* [num_inputs]);
+  std::unique_ptr<TF_Tensor* []> output_values(new TF_Tensor* [num_outputs]);
+  unique_tf_buffer run_metadata(MakeUniqueBuffer(want_run_metadata ? TF_NewBuffer() : nullptr));
+
+  REQUIRE_HANDLES(input_tensor_handles, input_values.get(), num_inputs, nullptr);
+
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  callable->Run(input_values.get(), output_values.get(), run_metadata.get(), status.get());
   CHECK_STATUS(env, status.get(), nullptr);
 
-  if (jrun_options_data != nullptr)
-    env->ReleaseByteArrayElements(jrun_options, jrun_options_data, JNI_ABORT);
+  set_handles(env, output_values.get(), output_tensor_handles, num_outputs);
+
+  return RunMetadataToByteArray(env, run_metadata.get());
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableBatch(
+    JNIEnv* env, jobject object, jlong callable_handle, jint num_steps, jlongArray input_tensor_handles,
+    jboolean want_run_metadata, jlongArray output_tensor_handles) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, nullptr);
+
+  const jint num_inputs = static_cast<jint>(callable->inputs.size());
+  const jint num_outputs = static_cast<jint>(callable->outputs.size());
+  if (num_steps < 0) {
+    throw_exception(env, tf_invalid_argument_exception, "The number of steps must be non-negative.");
+    return nullptr;
+  }
+  if (env->GetArrayLength(output_tensor_handles) != num_steps * num_outputs) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Expected %d output tensor handles, but got %d, instead.",
+        num_steps * num_outputs, env->GetArrayLength(output_tensor_handles));
+    return nullptr;
+  }
+
+  std::unique_ptr<TF_Tensor* []> input_values(new TF_Tensor* [num_steps * num_inputs]);
+  std::unique_ptr<TF_Tensor* []> output_values(new TF_Tensor* [num_steps * num_outputs]);
+  unique_tf_buffer run_metadata(MakeUniqueBuffer(want_run_metadata ? TF_NewBuffer() : nullptr));
+
+  REQUIRE_HANDLES(input_tensor_handles, input_values.get(), num_steps * num_inputs, nullptr);
+
+  // The steps are executed back-to-back and only the run metadata of the last step is collected.
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  for (int step = 0; step < num_steps; ++step) {
+    TF_Buffer* step_run_metadata = step == num_steps - 1 ? run_metadata.get() : nullptr;
+    callable->Run(
+        input_values.get() + step * num_inputs, output_values.get() + step * num_outputs, step_run_metadata,
+        status.get());
+    if (TF_GetCode(status.get()) != TF_OK) {
+      // Release the outputs of the steps that have already completed before reporting the failure.
+      for (int i = 0; i < step * num_outputs; ++i)
+        TF_DeleteTensor(output_values[i]);
+      break;
+    }
+  }
+  CHECK_STATUS(env, status.get(), nullptr);
+
+  set_handles(env, output_values.get(), output_tensor_handles, num_steps * num_outputs);
+
+  return RunMetadataToByteArray(env, run_metadata.get());
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableIntoBuffers(
+    JNIEnv* env, jobject object, jlong callable_handle, jlongArray input_tensor_handles, jboolean want_run_metadata,
+    jobjectArray output_buffers, jlongArray output_num_bytes) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, nullptr);
+
+  const jint num_inputs = static_cast<jint>(callable->inputs.size());
+  const jint num_outputs = static_cast<jint>(callable->outputs.size());
+  if (env->GetArrayLength(output_buffers) != num_outputs || env->GetArrayLength(output_num_bytes) != num_outputs) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Expected %d output buffers, but got %d, instead.", num_outputs,
+        env->GetArrayLength(output_buffers));
+    return nullptr;
+  }
+
+  // The output buffers are resolved before running the step, so that invalid buffers never waste a step.
+  std::vector<void*> output_data(static_cast<size_t>(num_outputs));
+  std::vector<jlong> output_capacities(static_cast<size_t>(num_outputs));
+  for (jint i = 0; i < num_outputs; ++i) {
+    jobject buffer = env->GetObjectArrayElement(output_buffers, i);
+    output_data[i] = buffer == nullptr ? nullptr : env->GetDirectBufferAddress(buffer);
+    output_capacities[i] = buffer == nullptr ? 0 : env->GetDirectBufferCapacity(buffer);
+    if (buffer != nullptr) env->DeleteLocalRef(buffer);
+    if (output_data[i] == nullptr) {
+      throw_exception(env, tf_invalid_argument_exception, "Output buffer %d is not a direct buffer.", i);
+      return nullptr;
+    }
+  }
+
+  std::unique_ptr<TF_Tensor* []> input_values(new TF_Tensor* [num_inputs]);
+  std::unique_ptr<TF_Tensor* []> output_values(new TF_Tensor* [num_outputs]);
+  unique_tf_buffer run_metadata(MakeUniqueBuffer(want_run_metadata ? TF_NewBuffer() : nullptr));
+
+  REQUIRE_HANDLES(input_tensor_handles, input_values.get(), num_inputs, nullptr);
+
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  callable->Run(input_values.get(), output_values.get(), run_metadata.get(), status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+
+  // The fetched tensors are copied into the output buffers and deleted right away, and so they never reach the JVM.
+  std::vector<jlong> num_bytes(static_cast<size_t>(num_outputs));
+  jint failed_output = -1;
+  for (jint i = 0; i < num_outputs; ++i) {
+    TF_Tensor* tensor = output_values[i];
+    num_bytes[i] = static_cast<jlong>(TF_TensorByteSize(tensor));
+    if (failed_output < 0 && (TF_TensorType(tensor) == TF_STRING || num_bytes[i] > output_capacities[i]))
+      failed_output = i;
+    if (failed_output < 0) memcpy(output_data[i], TF_TensorData(tensor), static_cast<size_t>(num_bytes[i]));
+    TF_DeleteTensor(tensor);
+  }
+  if (failed_output >= 0) {
+    throw_exception(
+        env, tf_invalid_argument_exception,
+        "Fetch %d (with %lld bytes) does not fit in its output buffer (with %lld bytes), or is a string tensor.",
+        failed_output, static_cast<long long>(num_bytes[failed_output]),
+        static_cast<long long>(output_capacities[failed_output]));
+    return nullptr;
+  }
+  env->SetLongArrayRegion(output_num_bytes, 0, num_outputs, num_bytes.data());
+
+  return RunMetadataToByteArray(env, run_metadata.get());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableAsync(
+    JNIEnv* env, jobject object, jlong callable_handle, jlongArray input_tensor_handles, jboolean want_run_metadata,
+    jobject callback) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, void());
+
+  const jint num_inputs = static_cast<jint>(callable->inputs.size());
+  std::vector<TF_Tensor*> input_values(static_cast<size_t>(num_inputs));
+  REQUIRE_HANDLES(input_tensor_handles, input_values.data(), num_inputs, void());
+
+  const JVMCache& cache = jvm_cache();
+  jmethodID on_success = cache.async_run_callback_on_success;
+  jmethodID on_failure = cache.async_run_callback_on_failure;
+
+  JavaVM* jvm;
+  env->GetJavaVM(&jvm);
+  jobject callback_ref = env->NewGlobalRef(callback);
+  bool collect_run_metadata = want_run_metadata == JNI_TRUE;
+
+  // From this point on, the input tensors are owned by the scheduled run, which deletes them once it completes.
+  // The native executor threads are attached to the JVM when they start, and so attaching the thread below is cheap.
+  tensorflow::NativeExecutor::Global()->Schedule(
+      tensorflow::NativeExecutor::kSessionCallbacks,
+      [jvm, callable, input_values, collect_run_metadata, callback_ref, on_success, on_failure]() {
+        const size_t num_outputs = callable->outputs.size();
+        std::vector<TF_Tensor*> output_values(num_outputs);
+        unique_tf_buffer run_metadata(MakeUniqueBuffer(collect_run_metadata ? TF_NewBuffer() : nullptr));
+        std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+        callable->Run(input_values.data(), output_values.data(), run_metadata.get(), status.get());
+        for (TF_Tensor* input_value : input_values)
+          TF_DeleteTensor(input_value);
+
+        JNIEnv* thread_env = attach_current_thread(jvm);
+        if (thread_env == nullptr) {
+          // The JVM is shutting down and so there is no one left to consume the outputs.
+          if (TF_GetCode(status.get()) == TF_OK)
+            for (TF_Tensor* output_value : output_values)
+              TF_DeleteTensor(output_value);
+          return;
+        }
+
+        // Local references are never released automatically on natively attached threads and so they are deleted
+        // explicitly.
+        if (TF_GetCode(status.get()) == TF_OK) {
+          jlongArray outputs_array = thread_env->NewLongArray(static_cast<jsize>(num_outputs));
+          set_handles(thread_env, output_values.data(), outputs_array, static_cast<jint>(num_outputs));
+          jbyteArray run_metadata_array = RunMetadataToByteArray(thread_env, run_metadata.get());
+          thread_env->CallVoidMethod(callback_ref, on_success, outputs_array, run_metadata_array);
+          thread_env->DeleteLocalRef(outputs_array);
+          if (run_metadata_array != nullptr)
+            thread_env->DeleteLocalRef(run_metadata_array);
+        } else {
+          jstring message = thread_env->NewStringUTF(TF_Message(status.get()));
+          thread_env->CallVoidMethod(callback_ref, on_failure, static_cast<jint>(TF_GetCode(status.get())), message);
+          thread_env->DeleteLocalRef(message);
+        }
+
+        // Exceptions thrown by the callback have nowhere to propagate to from this thread.
+        if (thread_env->ExceptionCheck())
+          thread_env->ExceptionClear();
+        thread_env->DeleteGlobalRef(callback_ref);
+      });
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_warmUpCallable(
+    JNIEnv* env, jobject object, jlong callable_handle, jlongArray input_tensor_handles, jint num_runs) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, nullptr);
+
+  const jint num_inputs = static_cast<jint>(callable->inputs.size());
+  const jint num_outputs = static_cast<jint>(callable->outputs.size());
+  std::unique_ptr<TF_Tensor* []> input_values(new TF_Tensor* [num_inputs]);
+  std::unique_ptr<TF_Tensor* []> output_values(new TF_Tensor* [num_outputs]);
+  std::vector<jlong> latencies(static_cast<size_t>(std::max(num_runs, 0)));
+
+  REQUIRE_HANDLES(input_tensor_handles, input_values.get(), num_inputs, nullptr);
+
+  // The same inputs are fed to every run and the outputs are deleted right away, so that warming up never crosses the
+  // JNI boundary between runs.
+  tensorflow::Env* tf_env = tensorflow::Env::Default();
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  for (size_t run = 0; run < latencies.size(); ++run) {
+    const tensorflow::uint64 start_micros = tf_env->NowMicros();
+    callable->Run(input_values.get(), output_values.get(), nullptr, status.get());
+    CHECK_STATUS(env, status.get(), nullptr);
+    latencies[run] = static_cast<jlong>(tf_env->NowMicros() - start_micros);
+    for (int i = 0; i < num_outputs; ++i)
+      TF_DeleteTensor(output_values[i]);
+  }
+
+  jlongArray latencies_array = env->NewLongArray(static_cast<jsize>(latencies.size()));
+  env->SetLongArrayRegion(latencies_array, 0, static_cast<jsize>(latencies.size()), latencies.data());
+  return latencies_array;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deleteCallable(
+    JNIEnv* env, jobject object, jlong callable_handle) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, void());
+  delete callable;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_makeBatchScheduler(
+    JNIEnv* env, jobject object, jlong callable_handle, jint max_batch_size, jlong batch_timeout_micros,
+    jint max_queue_size, jint num_batch_threads) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, 0);
+  if (callable->inputs.empty()) {
+    throw_exception(env, tf_invalid_argument_exception, "Only callables with at least one feed can be batched.");
+    return 0;
+  }
+  // The callable must outlive the scheduler, which is guaranteed by the JVM side holding a reference to it.
+  tensorflow::BatchScheduler* scheduler = new tensorflow::BatchScheduler(
+      static_cast<int>(callable->inputs.size()), static_cast<int>(callable->outputs.size()),
+      [callable](TF_Tensor* const* input_values, TF_Tensor** output_values, TF_Status* status) {
+        callable->Run(input_values, output_values, nullptr, status);
+      },
+      static_cast<int>(max_batch_size), static_cast<tensorflow::int64>(batch_timeout_micros),
+      static_cast<int>(max_queue_size), static_cast<int>(num_batch_threads));
+  return reinterpret_cast<jlong>(scheduler);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_batchSchedulerSchedule(
+    JNIEnv* env, jobject object, jlong scheduler_handle, jlongArray input_tensor_handles, jobject callback) {
+  REQUIRE_HANDLE(scheduler, tensorflow::BatchScheduler, scheduler_handle, void());
+
+  const jint num_inputs = env->GetArrayLength(input_tensor_handles);
+  std::vector<TF_Tensor*> input_values(static_cast<size_t>(num_inputs));
+  REQUIRE_HANDLES(input_tensor_handles, input_values.data(), num_inputs, void());
+
+  const JVMCache& cache = jvm_cache();
+  jmethodID on_success = cache.async_run_callback_on_success;
+  jmethodID on_failure = cache.async_run_callback_on_failure;
 
-  jlong* output_tensor_handles_array = env->GetLongArrayElements(output_tensor_handles, nullptr);
-  for (int i = 0; i < num_outputs; ++i)
-    output_tensor_handles_array[i] = reinterpret_cast<jlong>(output_values[i]);
-  env->ReleaseLongArrayElements(output_tensor_handles, output_tensor_handles_array, 0);
+  JavaVM* jvm;
+  env->GetJavaVM(&jvm);
+  jobject callback_ref = env->NewGlobalRef(callback);
 
-  jbyteArray return_array = nullptr;
-  if (run_metadata != nullptr) {
-    return_array = env->NewByteArray(static_cast<jsize>(run_metadata->length));
-    jbyte* elements = env->GetByteArrayElements(return_array, nullptr);
-    memcpy(elements, run_metadata->data, run_metadata->length);
-    env->ReleaseByteArrayElements(return_array, elements, JNI_COMMIT);
+  // The completion callback is invoked from the batch threads, which attach themselves to the JVM the first time they
+  // complete a request, and stay attached from then on.
+  tensorflow::Status s = scheduler->Schedule(
+      std::move(input_values), [jvm, callback_ref, on_success, on_failure](
+          const tensorflow::Status& status, const std::vector<TF_Tensor*>& output_values) {
+        JNIEnv* thread_env = attach_current_thread(jvm);
+        if (thread_env == nullptr) {
+          // The JVM is shutting down and so there is no one left to consume the outputs.
+          for (TF_Tensor* output_value : output_values)
+            TF_DeleteTensor(output_value);
+          return;
+        }
+
+        // Local references are never released automatically on natively attached threads and so they are deleted
+        // explicitly.
+        if (status.ok()) {
+          const jint num_outputs = static_cast<jint>(output_values.size());
+          jlongArray outputs_array = thread_env->NewLongArray(num_outputs);
+          set_handles(thread_env, output_values.data(), outputs_array, num_outputs);
+          thread_env->CallVoidMethod(callback_ref, on_success, outputs_array, nullptr);
+          thread_env->DeleteLocalRef(outputs_array);
+        } else {
+          jstring message = thread_env->NewStringUTF(status.error_message().c_str());
+          thread_env->CallVoidMethod(callback_ref, on_failure, static_cast<jint>(status.code()), message);
+          thread_env->DeleteLocalRef(message);
+        }
+
+        // Exceptions thrown by the callback have nowhere to propagate to from this thread.
+        if (thread_env->ExceptionCheck())
+          thread_env->ExceptionClear();
+        thread_env->DeleteGlobalRef(callback_ref);
+      });
+  if (!s.ok()) {
+    // The request was not scheduled and so the caller keeps ownership of the input tensors.
+    env->DeleteGlobalRef(callback_ref);
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), void());
   }
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_batchSchedulerStatistics(
+    JNIEnv* env, jobject object, jlong scheduler_handle) {
+  REQUIRE_HANDLE(scheduler, tensorflow::BatchScheduler, scheduler_handle, nullptr);
+  const tensorflow::BatchScheduler::Statistics statistics = scheduler->GetStatistics();
+  std::vector<jlong> values = {
+      statistics.num_requests, statistics.num_rejected, statistics.num_batches, statistics.queue_depth,
+      statistics.peak_queue_depth};
+  values.insert(values.end(), statistics.queue_depth_histogram.begin(), statistics.queue_depth_histogram.end());
+  values.insert(values.end(), statistics.batch_size_histogram.begin(), statistics.batch_size_histogram.end());
+  jlongArray values_array = env->NewLongArray(static_cast<jsize>(values.size()));
+  env->SetLongArrayRegion(values_array, 0, static_cast<jsize>(values.size()), values.data());
+  return values_array;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deleteBatchScheduler(
+    JNIEnv* env, jobject object, jlong scheduler_handle) {
+  REQUIRE_HANDLE(scheduler, tensorflow::BatchScheduler, scheduler_handle, void());
+  delete scheduler;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_partialRunSetup(
+    JNIEnv* env, jobject object, jlong handle, jlongArray input_op_handles, jintArray input_op_indices,
+    jlongArray output_op_handles, jintArray output_op_indices, jlongArray target_op_handles) {
+  REQUIRE_HANDLE(session, TF_Session, handle, 0);
+
+  const jint num_inputs = env->GetArrayLength(input_op_handles);
+  const jint num_outputs = env->GetArrayLength(output_op_handles);
+  const jint num_targets = env->GetArrayLength(target_op_handles);
+
+  std::unique_ptr<TF_Output[]> inputs(new TF_Output[num_inputs]);
+  std::unique_ptr<TF_Output[]> outputs(new TF_Output[num_outputs]);
+  std::unique_ptr<TF_Operation* []> targets(new TF_Operation* [num_targets]);
+
+  REQUIRE_OUTPUTS(input_op_handles, input_op_indices, inputs.get(), num_inputs, 0);
+  REQUIRE_OUTPUTS(output_op_handles, output_op_indices, outputs.get(), num_outputs, 0);
+  REQUIRE_HANDLES(target_op_handles, targets.get(), num_targets, 0);
+
+  // The partial run handle is a string owned by the native library, which is deleted using "deletePartialRun".
+  const char* partial_run_handle = nullptr;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_SessionPRunSetup(
+      session, inputs.get(), static_cast<int>(num_inputs), outputs.get(), static_cast<int>(num_outputs),
+      reinterpret_cast<const TF_Operation* const*>(targets.get()), static_cast<int>(num_targets), &partial_run_handle,
+      status.get());
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(partial_run_handle);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_partialRun(
+    JNIEnv* env, jobject object, jlong handle, jlong partial_run_handle, jlongArray input_tensor_handles,
+    jlongArray input_op_handles, jintArray input_op_indices, jlongArray output_op_handles, jintArray output_op_indices,
+    jlongArray target_op_handles, jlongArray output_tensor_handles) {
+  REQUIRE_HANDLE(session, TF_Session, handle, void());
+  REQUIRE_HANDLE(c_partial_run_handle, const char, partial_run_handle, void());
+
+  const jint num_inputs = env->GetArrayLength(input_tensor_handles);
+  const jint num_outputs = env->GetArrayLength(output_tensor_handles);
+  const jint num_targets = env->GetArrayLength(target_op_handles);
+
+  std::unique_ptr<TF_Output[]> inputs(new TF_Output[num_inputs]);
+  std::unique_ptr<TF_Tensor* []> input_values(new TF_Tensor* [num_inputs]);
+  std::unique_ptr<TF_Output[]> outputs(new TF_Output[num_outputs]);
+  std::unique_ptr<TF_Tensor* []> output_values(new TF_Tensor* [num_outputs]);
+  std::unique_ptr<TF_Operation* []> targets(new TF_Operation* [num_targets]);
+
+  REQUIRE_HANDLES(input_tensor_handles, input_values.get(), num_inputs, void());
+  REQUIRE_OUTPUTS(input_op_handles, input_op_indices, inputs.get(), num_inputs, void());
+  REQUIRE_OUTPUTS(output_op_handles, output_op_indices, outputs.get(), num_outputs, void());
+  REQUIRE_HANDLES(target_op_handles, targets.get(), num_targets, void());
 
-  return return_array;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_SessionPRun(
+      session, c_partial_run_handle, inputs.get(), input_values.get(), static_cast<int>(num_inputs), outputs.get(),
+      output_values.get(), static_cast<int>(num_outputs), reinterpret_cast<const TF_Operation* const*>(targets.get()),
+      static_cast<int>(num_targets), status.get());
+  CHECK_STATUS(env, status.get(), void());
+
+  set_handles(env, output_values.get(), output_tensor_handles, num_outputs);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deletePartialRun(
+    JNIEnv* env, jobject object, jlong partial_run_handle) {
+  REQUIRE_HANDLE(c_partial_run_handle, const char, partial_run_handle, void());
+  TF_DeletePRunHandle(c_partial_run_handle);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocateProfiler(
+    JNIEnv* env, jobject object, jlong sampling_period) {
+  return reinterpret_cast<jlong>(new tensorflow::StepStatsAggregator(static_cast<tensorflow::int64>(sampling_period)));
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableProfiled(
+    JNIEnv* env, jobject object, jlong callable_handle, jlongArray input_tensor_handles, jlong profiler_handle,
+    jlongArray output_tensor_handles) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, void());
+  REQUIRE_HANDLE(profiler, tensorflow::StepStatsAggregator, profiler_handle, void());
+
+  const jint num_inputs = static_cast<jint>(callable->inputs.size());
+  const jint num_outputs = static_cast<jint>(callable->outputs.size());
+  if (env->GetArrayLength(output_tensor_handles) != num_outputs) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Expected %d output tensor handles, but got %d, instead.", num_outputs,
+        env->GetArrayLength(output_tensor_handles));
+    return;
+  }
+
+  std::unique_ptr<TF_Tensor* []> input_values(new TF_Tensor* [num_inputs]);
+  std::unique_ptr<TF_Tensor* []> output_values(new TF_Tensor* [num_outputs]);
+
+  REQUIRE_HANDLES(input_tensor_handles, input_values.get(), num_inputs, void());
+
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  if (profiler->ShouldSample()) {
+    // The run metadata of profiled steps is parsed and aggregated natively and never crosses the JNI boundary.
+    // The partition graphs are only collected once for each callable, in order to find the XLA clusters it executes.
+    unique_tf_buffer run_metadata(MakeUniqueBuffer(TF_NewBuffer()));
+    const bool collect_partition_graphs = profiler->ShouldCollectPartitionGraphs(callable);
+    callable->Run(
+        collect_partition_graphs ? callable->partitioned_traced_run_options.get() : callable->traced_run_options.get(),
+        input_values.get(), output_values.get(), run_metadata.get(), status.get());
+    CHECK_STATUS(env, status.get(), void());
+    tensorflow::RunMetadata metadata;
+    if (metadata.ParseFromArray(run_metadata->data, static_cast<int>(run_metadata->length))) {
+      profiler->AddStep(metadata.step_stats());
+      for (const tensorflow::GraphDef& partition_graph : metadata.partition_graphs())
+        profiler->AddPartitionGraph(partition_graph);
+    }
+  } else {
+    callable->Run(input_values.get(), output_values.get(), nullptr, status.get());
+    CHECK_STATUS(env, status.get(), void());
+  }
+
+  set_handles(env, output_values.get(), output_tensor_handles, num_outputs);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_profilerNumSteps(
+    JNIEnv* env, jobject object, jlong profiler_handle) {
+  REQUIRE_HANDLE(profiler, tensorflow::StepStatsAggregator, profiler_handle, 0);
+  return static_cast<jlong>(profiler->NumSteps());
+}
+
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Session_00024_profilerSummary(
+    JNIEnv* env, jobject object, jlong profiler_handle, jboolean by_node, jint max_rows) {
+  REQUIRE_HANDLE(profiler, tensorflow::StepStatsAggregator, profiler_handle, nullptr);
+  return env->NewStringUTF(profiler->Summary(by_node == JNI_TRUE, static_cast<int>(max_rows)).c_str());
+}
+
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Session_00024_profilerJitSummary(
+    JNIEnv* env, jobject object, jlong profiler_handle) {
+  REQUIRE_HANDLE(profiler, tensorflow::StepStatsAggregator, profiler_handle, nullptr);
+  return env->NewStringUTF(profiler->JitSummary().c_str());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_resetProfiler(
+    JNIEnv* env, jobject object, jlong profiler_handle) {
+  REQUIRE_HANDLE(profiler, tensorflow::StepStatsAggregator, profiler_handle, void());
+  profiler->Reset();
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deleteProfiler(
+    JNIEnv* env, jobject object, jlong profiler_handle) {
+  REQUIRE_HANDLE(profiler, tensorflow::StepStatsAggregator, profiler_handle, void());
+  delete profiler;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_writeChromeTrace(
+    JNIEnv* env, jobject object, jbyteArray run_metadata, jstring filename, jboolean show_memory) {
+  tensorflow::RunMetadata metadata;
+  const jsize length = env->GetArrayLength(run_metadata);
+  jbyte* run_metadata_data = static_cast<jbyte*>(env->GetPrimitiveArrayCritical(run_metadata, nullptr));
+  const bool parsed = metadata.ParseFromArray(run_metadata_data, static_cast<int>(length));
+  env->ReleasePrimitiveArrayCritical(run_metadata, run_metadata_data, JNI_ABORT);
+  if (!parsed) {
+    throw_exception(env, tf_invalid_argument_exception, "Unable to parse the provided RunMetadata protocol buffer.");
+    return;
+  }
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  tensorflow::Status s = tensorflow::WriteChromeTrace(
+      metadata.step_stats(), std::string(c_filename), show_memory == JNI_TRUE);
+  env->ReleaseStringUTFChars(filename, c_filename);
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), void());
+  }
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableWithTimeline(
+    JNIEnv* env, jobject object, jlong callable_handle, jlongArray input_tensor_handles, jstring filename,
+    jboolean show_memory, jlongArray output_tensor_handles) {
+  REQUIRE_HANDLE(callable, SessionCallable, callable_handle, void());
+
+  const jint num_inputs = static_cast<jint>(callable->inputs.size());
+  const jint num_outputs = static_cast<jint>(callable->outputs.size());
+  if (env->GetArrayLength(output_tensor_handles) != num_outputs) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Expected %d output tensor handles, but got %d, instead.", num_outputs,
+        env->GetArrayLength(output_tensor_handles));
+    return;
+  }
+
+  std::unique_ptr<TF_Tensor* []> input_values(new TF_Tensor* [num_inputs]);
+  std::unique_ptr<TF_Tensor* []> output_values(new TF_Tensor* [num_outputs]);
+  unique_tf_buffer run_metadata(MakeUniqueBuffer(TF_NewBuffer()));
+
+  REQUIRE_HANDLES(input_tensor_handles, input_values.get(), num_inputs, void());
+
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  callable->Run(
+      callable->traced_run_options.get(), input_values.get(), output_values.get(), run_metadata.get(), status.get());
+  CHECK_STATUS(env, status.get(), void());
+
+  set_handles(env, output_values.get(), output_tensor_handles, num_outputs);
+
+  tensorflow::RunMetadata metadata;
+  if (!metadata.ParseFromArray(run_metadata->data, static_cast<int>(run_metadata->length))) {
+    throw_exception(env, tf_internal_exception, "Unable to parse the collected RunMetadata protocol buffer.");
+    return;
+  }
+  const char* c_filename = env->GetStringUTFChars(filename, nullptr);
+  tensorflow::Status s = tensorflow::WriteChromeTrace(
+      metadata.step_stats(), std::string(c_filename), show_memory == JNI_TRUE);
+  env->ReleaseStringUTFChars(filename, c_filename);
+  if (!s.ok()) {
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), void());
+  }
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocatorStatistics(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(session, TF_Session, handle, nullptr);
+  const tensorflow::DeviceMgr* device_mgr = nullptr;
+  tensorflow::Status s = session->session->LocalDeviceManager(&device_mgr);
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), nullptr);
+  }
+  std::vector<std::pair<std::string, tensorflow::Device*>> devices;
+  for (tensorflow::Device* device : device_mgr->ListDevices())
+    devices.emplace_back(device->name(), device);
+  std::vector<tensorflow::DeviceAllocatorStats> stats;
+  tensorflow::CollectAllocatorStats(devices, &stats);
+  return allocator_statistics_to_java(env, stats);
+}
+
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_listDevices(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(session, TF_Session, handle, nullptr);
+  const tensorflow::DeviceMgr* device_mgr = nullptr;
+  tensorflow::Status s = session->session->LocalDeviceManager(&device_mgr);
+  if (!s.ok()) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    Set_TF_Status_from_Status(status.get(), s);
+    CHECK_STATUS(env, status.get(), nullptr);
+  }
+
+  // "TF_SessionListDevices" only exposes the names, types, and memory limits of the devices, and so the full device
+  // attributes (which also include their locality and physical description) are obtained from the device manager.
+  const std::vector<tensorflow::Device*> devices = device_mgr->ListDevices();
+  jobjectArray attributes = env->NewObjectArray(
+      static_cast<jsize>(devices.size()), jvm_cache().byte_array_class, nullptr);
+  std::string serialized;
+  for (size_t i = 0; i < devices.size(); ++i) {
+    devices[i]->attributes().SerializeToString(&serialized);
+    jbyteArray device_attributes = env->NewByteArray(static_cast<jsize>(serialized.size()));
+    env->SetByteArrayRegion(
+        device_attributes, 0, static_cast<jsize>(serialized.size()), reinterpret_cast<const jbyte*>(serialized.data()));
+    env->SetObjectArrayElement(attributes, static_cast<jsize>(i), device_attributes);
+    env->DeleteLocalRef(device_attributes);
+  }
+  return attributes;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_setCurrentThreadAffinity(
+    JNIEnv* env, jobject object, jintArray cpus, jint numa_node) {
+  std::vector<int> cpu_set;
+  if (!resolve_cpu_set(env, cpus, numa_node, &cpu_set)) return;
+  if (cpu_set.empty()) return;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  Set_TF_Status_from_Status(status.get(), tensorflow::SetCurrentThreadAffinity(cpu_set));
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_registerSharedThreadPool(
+    JNIEnv* env, jobject object, jstring name, jint num_threads) {
+  const char* c_name = env->GetStringUTFChars(name, nullptr);
+  tensorflow::Status s = tensorflow::SharedThreadPoolRegistry::Global()->Register(c_name, num_threads);
+  env->ReleaseStringUTFChars(name, c_name);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  Set_TF_Status_from_Status(status.get(), s);
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Session_00024_sharedThreadPoolStatistics(
+    JNIEnv* env, jobject object) {
+  const std::vector<tensorflow::SharedThreadPoolRegistry::Statistics> statistics =
+      tensorflow::SharedThreadPoolRegistry::Global()->statistics();
+  const JVMCache& cache = jvm_cache();
+  const jsize num_pools = static_cast<jsize>(statistics.size());
+  jobjectArray names = env->NewObjectArray(num_pools, cache.string_class, nullptr);
+  std::vector<jlong> values;
+  values.reserve(statistics.size() * 6);
+  for (jsize i = 0; i < num_pools; ++i) {
+    jstring pool_name = env->NewStringUTF(statistics[i].name.c_str());
+    env->SetObjectArrayElement(names, i, pool_name);
+    env->DeleteLocalRef(pool_name);
+    values.push_back(static_cast<jlong>(statistics[i].num_threads));
+    values.push_back(static_cast<jlong>(statistics[i].num_sessions));
+    values.push_back(static_cast<jlong>(statistics[i].active_steps));
+    values.push_back(static_cast<jlong>(statistics[i].peak_active_steps));
+    values.push_back(static_cast<jlong>(statistics[i].total_steps));
+    values.push_back(static_cast<jlong>(statistics[i].step_micros));
+  }
+  jlongArray values_array = env->NewLongArray(static_cast<jsize>(values.size()));
+  env->SetLongArrayRegion(values_array, 0, static_cast<jsize>(values.size()), values.data());
+  return env->CallStaticObjectMethod(
+      cache.shared_thread_pool_statistics_class, cache.shared_thread_pool_statistics_apply, names, values_array);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocateDatasetIterator(
+    JNIEnv* env, jobject object, jlong handle, jlongArray output_op_handles, jintArray output_op_indices,
+    jint prefetch_size, jint num_threads, jboolean autotune, jint max_prefetch_size, jint max_threads,
+    jlong max_buffered_bytes) {
+  REQUIRE_HANDLE(session, TF_Session, handle, 0);
+  const jint num_outputs = env->GetArrayLength(output_op_handles);
+  std::vector<TF_Output> outputs(static_cast<size_t>(num_outputs));
+  REQUIRE_OUTPUTS(output_op_handles, output_op_indices, outputs.data(), num_outputs, 0);
+  tensorflow::DatasetIteratorOptions options;
+  options.prefetch_size = static_cast<int>(prefetch_size);
+  options.num_threads = static_cast<int>(num_threads);
+  options.autotune = autotune == JNI_TRUE;
+  options.max_prefetch_size = static_cast<int>(max_prefetch_size);
+  options.max_threads = static_cast<int>(max_threads);
+  options.max_buffered_bytes = static_cast<tensorflow::int64>(max_buffered_bytes);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  tensorflow::DatasetIterator* iterator = tensorflow::DatasetIterator::New(
+      session, std::move(outputs), options, status.get());
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(iterator);
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_datasetIteratorNext(
+    JNIEnv* env, jobject object, jlong iterator_handle) {
+  REQUIRE_HANDLE(iterator, tensorflow::DatasetIterator, iterator_handle, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<TF_Tensor*> element;
+  iterator->GetNext(&element, status.get());
+  if (TF_GetCode(status.get()) == TF_OUT_OF_RANGE) return nullptr;
+  CHECK_STATUS(env, status.get(), nullptr);
+  // The eager tensor handles share the buffers of the fetched tensors, which can thus be deleted right away.
+  std::vector<jlong> tensor_handles(element.size(), 0);
+  for (size_t i = 0; i < element.size(); ++i) {
+    if (TF_GetCode(status.get()) == TF_OK)
+      tensor_handles[i] = reinterpret_cast<jlong>(TFE_NewTensorHandle(element[i], status.get()));
+    TF_DeleteTensor(element[i]);
+  }
+  if (TF_GetCode(status.get()) != TF_OK) {
+    for (jlong tensor_handle : tensor_handles)
+      if (tensor_handle != 0) TFE_DeleteTensorHandle(reinterpret_cast<TFE_TensorHandle*>(tensor_handle));
+    CHECK_STATUS(env, status.get(), nullptr);
+  }
+  jlongArray tensor_handles_array = env->NewLongArray(static_cast<jsize>(tensor_handles.size()));
+  env->SetLongArrayRegion(
+      tensor_handles_array, 0, static_cast<jsize>(tensor_handles.size()), tensor_handles.data());
+  return tensor_handles_array;
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_Session_00024_datasetIteratorBufferedElements(
+    JNIEnv* env, jobject object, jlong iterator_handle) {
+  REQUIRE_HANDLE(iterator, tensorflow::DatasetIterator, iterator_handle, 0);
+  return static_cast<jint>(iterator->buffered_elements());
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_datasetIteratorStatistics(
+    JNIEnv* env, jobject object, jlong iterator_handle) {
+  REQUIRE_HANDLE(iterator, tensorflow::DatasetIterator, iterator_handle, nullptr);
+  const tensorflow::DatasetIteratorStatistics statistics = iterator->statistics();
+  // The order of the values must match the one expected by the Scala side.
+  const jlong values[] = {
+      static_cast<jlong>(statistics.prefetch_size), static_cast<jlong>(statistics.num_threads),
+      statistics.elements_produced, statistics.buffered_elements, statistics.buffered_bytes,
+      statistics.peak_buffered_bytes, statistics.consumer_waits, statistics.consumer_wait_micros,
+      statistics.producer_micros};
+  const jsize num_values = static_cast<jsize>(sizeof(values) / sizeof(values[0]));
+  jlongArray values_array = env->NewLongArray(num_values);
+  env->SetLongArrayRegion(values_array, 0, num_values, values);
+  return values_array;
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deleteDatasetIterator(
+    JNIEnv* env, jobject object, jlong iterator_handle) {
+  REQUIRE_HANDLE(iterator, tensorflow::DatasetIterator, iterator_handle, void());
+  delete iterator;
+}
+
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_recover(
+    JNIEnv* env, jobject object, jlong handle, jstring checkpoint_prefix, jstring restore_op, jstring filename_tensor,
+    jstring ready_for_local_init_tensor, jstring local_init_op, jstring ready_tensor) {
+  REQUIRE_HANDLE(session, TF_Session, handle, nullptr);
+  auto to_string = [env](jstring value) {
+    if (value == nullptr) return std::string();
+    const char* c_value = env->GetStringUTFChars(value, nullptr);
+    std::string result(c_value);
+    env->ReleaseStringUTFChars(value, c_value);
+    return result;
+  };
+  tensorflow::SessionRecoveryOptions options;
+  options.checkpoint_prefix = to_string(checkpoint_prefix);
+  options.restore_op = to_string(restore_op);
+  options.filename_tensor = to_string(filename_tensor);
+  options.ready_for_local_init_tensor = to_string(ready_for_local_init_tensor);
+  options.local_init_op = to_string(local_init_op);
+  options.ready_tensor = to_string(ready_tensor);
+  tensorflow::SessionRecoveryResult result;
+  tensorflow::Status s = tensorflow::RecoverSession(session, options, &result);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  Set_TF_Status_from_Status(status.get(), s);
+  CHECK_STATUS(env, status.get(), nullptr);
+
+  // Empty messages are returned as "null", which means that the corresponding check passed.
+  jobjectArray messages = env->NewObjectArray(2, jvm_cache().string_class, nullptr);
+  const std::string* message_values[] = {&result.not_ready_for_local_init_message, &result.not_ready_message};
+  for (jsize i = 0; i < 2; ++i) {
+    if (message_values[i]->empty()) continue;
+    jstring message = env->NewStringUTF(message_values[i]->c_str());
+    env->SetObjectArrayElement(messages, i, message);
+    env->DeleteLocalRef(message);
+  }
+  return messages;
 }
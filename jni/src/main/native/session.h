@@ -10,10 +10,18 @@ extern "C" {
 /*
  * Class:     org_platanios_tensorflow_jni_Session__
  * Method:    allocate
- * Signature: (JLjava/lang/String;[B)J
+ * Signature: (JLjava/lang/String;[B[II)J
  */
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocate
-  (JNIEnv *, jobject, jlong, jstring, jbyteArray);
+  (JNIEnv *, jobject, jlong, jstring, jbyteArray, jintArray, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    loadFromSavedModel
+ * Signature: (JLjava/lang/String;[Ljava/lang/String;[B[B[II[[B)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_loadFromSavedModel
+  (JNIEnv *, jobject, jlong, jstring, jobjectArray, jbyteArray, jbyteArray, jintArray, jint, jobjectArray);
 
 /*
  * Class:     org_platanios_tensorflow_jni_Session__
@@ -26,10 +34,282 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_delete
 /*
  * Class:     org_platanios_tensorflow_jni_Session__
  * Method:    run
- * Signature: (J[B[J[J[I[J[I[JZ[J)[B
+ * Signature: (J[B[J[J[I[J[I[JZ[J[J)[B
  */
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_run
-  (JNIEnv *, jobject, jlong, jbyteArray, jlongArray, jlongArray, jintArray, jlongArray, jintArray, jlongArray, jboolean, jlongArray);
+  (JNIEnv *, jobject, jlong, jbyteArray, jlongArray, jlongArray, jintArray, jlongArray, jintArray, jlongArray, jboolean, jlongArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    makeCallable
+ * Signature: (J[B[J[I[J[I[J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_makeCallable
+  (JNIEnv *, jobject, jlong, jbyteArray, jlongArray, jintArray, jlongArray, jintArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    runCallable
+ * Signature: (J[JZ[J)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallable
+  (JNIEnv *, jobject, jlong, jlongArray, jboolean, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    runCallableBatch
+ * Signature: (JI[JZ[J)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableBatch
+  (JNIEnv *, jobject, jlong, jint, jlongArray, jboolean, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    runCallableIntoBuffers
+ * Signature: (J[JZ[Ljava/nio/ByteBuffer;[J)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableIntoBuffers
+  (JNIEnv *, jobject, jlong, jlongArray, jboolean, jobjectArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    runCallableAsync
+ * Signature: (J[JZLorg/platanios/tensorflow/jni/AsyncRunCallback;)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableAsync
+  (JNIEnv *, jobject, jlong, jlongArray, jboolean, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    warmUpCallable
+ * Signature: (J[JI)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_warmUpCallable
+  (JNIEnv *, jobject, jlong, jlongArray, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    deleteCallable
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deleteCallable
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    makeBatchScheduler
+ * Signature: (JIJII)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_makeBatchScheduler
+  (JNIEnv *, jobject, jlong, jint, jlong, jint, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    batchSchedulerSchedule
+ * Signature: (J[JLorg/platanios/tensorflow/jni/AsyncRunCallback;)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_batchSchedulerSchedule
+  (JNIEnv *, jobject, jlong, jlongArray, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    batchSchedulerStatistics
+ * Signature: (J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_batchSchedulerStatistics
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    deleteBatchScheduler
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deleteBatchScheduler
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    partialRunSetup
+ * Signature: (J[J[I[J[I[J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_partialRunSetup
+  (JNIEnv *, jobject, jlong, jlongArray, jintArray, jlongArray, jintArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    partialRun
+ * Signature: (JJ[J[J[I[J[I[J[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_partialRun
+  (JNIEnv *, jobject, jlong, jlong, jlongArray, jlongArray, jintArray, jlongArray, jintArray, jlongArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    deletePartialRun
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deletePartialRun
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    allocateProfiler
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocateProfiler
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    runCallableProfiled
+ * Signature: (J[JJ[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableProfiled
+  (JNIEnv *, jobject, jlong, jlongArray, jlong, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    profilerNumSteps
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_profilerNumSteps
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    profilerSummary
+ * Signature: (JZI)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Session_00024_profilerSummary
+  (JNIEnv *, jobject, jlong, jboolean, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    profilerJitSummary
+ * Signature: (J)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Session_00024_profilerJitSummary
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    resetProfiler
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_resetProfiler
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    deleteProfiler
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deleteProfiler
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    runCallableWithTimeline
+ * Signature: (J[JLjava/lang/String;Z[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_runCallableWithTimeline
+  (JNIEnv *, jobject, jlong, jlongArray, jstring, jboolean, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    writeChromeTrace
+ * Signature: ([BLjava/lang/String;Z)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_writeChromeTrace
+  (JNIEnv *, jobject, jbyteArray, jstring, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    allocatorStatistics
+ * Signature: (J)Lorg/platanios/tensorflow/jni/AllocatorStatistics;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocatorStatistics
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    listDevices
+ * Signature: (J)[[B
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_listDevices
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    setCurrentThreadAffinity
+ * Signature: ([II)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_setCurrentThreadAffinity
+  (JNIEnv *, jobject, jintArray, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    registerSharedThreadPool
+ * Signature: (Ljava/lang/String;I)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_registerSharedThreadPool
+  (JNIEnv *, jobject, jstring, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    sharedThreadPoolStatistics
+ * Signature: ()Lorg/platanios/tensorflow/jni/SharedThreadPoolStatistics;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Session_00024_sharedThreadPoolStatistics
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    allocateDatasetIterator
+ * Signature: (J[J[IIIZIIJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Session_00024_allocateDatasetIterator
+  (JNIEnv *, jobject, jlong, jlongArray, jintArray, jint, jint, jboolean, jint, jint, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    datasetIteratorNext
+ * Signature: (J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_datasetIteratorNext
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    datasetIteratorBufferedElements
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_Session_00024_datasetIteratorBufferedElements
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    datasetIteratorStatistics
+ * Signature: (J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_datasetIteratorStatistics
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    deleteDatasetIterator
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Session_00024_deleteDatasetIterator
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Session__
+ * Method:    recover
+ * Signature: (JLjava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)[Ljava/lang/String;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_platanios_tensorflow_jni_Session_00024_recover
+  (JNIEnv *, jobject, jlong, jstring, jstring, jstring, jstring, jstring, jstring);
 
 #ifdef __cplusplus
 }
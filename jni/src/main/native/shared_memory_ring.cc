@@ -0,0 +1,150 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "shared_memory_ring.h"
+#include "exception.h"
+#include "utilities.h"
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/shared_memory_ring.h"
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_createSharedMemoryRing(
+    JNIEnv* env, jobject object, jstring name, jint num_slots, jlong slot_size) {
+  if (slot_size <= 0) {
+    throw_exception(env, tf_invalid_argument_exception, "The slot size must be positive.");
+    return 0;
+  }
+  const char* c_name = env->GetStringUTFChars(name, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* ring = tensorflow::SharedMemoryRing::Create(
+      std::string(c_name), static_cast<int>(num_slots), static_cast<tensorflow::uint64>(slot_size), status.get());
+  env->ReleaseStringUTFChars(name, c_name);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(ring);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_openSharedMemoryRing(
+    JNIEnv* env, jobject object, jstring name) {
+  const char* c_name = env->GetStringUTFChars(name, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  auto* ring = tensorflow::SharedMemoryRing::Open(std::string(c_name), status.get());
+  env->ReleaseStringUTFChars(name, c_name);
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(ring);
+}
+
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingNumSlots(
+    JNIEnv* env, jobject object, jlong ring_handle) {
+  REQUIRE_HANDLE(ring, tensorflow::SharedMemoryRing, ring_handle, 0);
+  return static_cast<jint>(ring->num_slots());
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingSlotSize(
+    JNIEnv* env, jobject object, jlong ring_handle) {
+  REQUIRE_HANDLE(ring, tensorflow::SharedMemoryRing, ring_handle, 0);
+  return static_cast<jlong>(ring->slot_size());
+}
+
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingWrite(
+    JNIEnv* env, jobject object, jlong ring_handle, jlongArray tensor_handles, jlong timeout_micros) {
+  REQUIRE_HANDLE(ring, tensorflow::SharedMemoryRing, ring_handle, JNI_FALSE);
+  const jsize num_tensors = env->GetArrayLength(tensor_handles);
+  std::unique_ptr<jlong[]> handles(new jlong[num_tensors]);
+  env->GetLongArrayRegion(tensor_handles, 0, num_tensors, handles.get());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  // The resolved tensors share the buffers of the eager tensors, which are copied directly into the claimed slot.
+  std::vector<TF_Tensor*> element;
+  for (jsize i = 0; i < num_tensors && TF_GetCode(status.get()) == TF_OK; ++i) {
+    TFE_TensorHandle* tensor_handle = reinterpret_cast<TFE_TensorHandle*>(handles[i]);
+    if (tensor_handle == nullptr) {
+      for (TF_Tensor* tensor : element) TF_DeleteTensor(tensor);
+      throw_exception(env, jvm_null_pointer_exception, "Tensor handle %d is null.", i);
+      return JNI_FALSE;
+    }
+    if (!await_tensor_handle(env, tensor_handle)) {
+      for (TF_Tensor* tensor : element) TF_DeleteTensor(tensor);
+      return JNI_FALSE;
+    }
+    TF_Tensor* tensor = TFE_TensorHandleResolve(tensor_handle, status.get());
+    if (TF_GetCode(status.get()) == TF_OK) element.push_back(tensor);
+  }
+  bool written = false;
+  if (TF_GetCode(status.get()) == TF_OK)
+    written = ring->Write(element, static_cast<tensorflow::int64>(timeout_micros), status.get());
+  for (TF_Tensor* tensor : element) TF_DeleteTensor(tensor);
+  CHECK_STATUS(env, status.get(), JNI_FALSE);
+  return static_cast<jboolean>(written);
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingClaim(
+    JNIEnv* env, jobject object, jlong ring_handle, jlong timeout_micros, jlongArray sequence) {
+  REQUIRE_HANDLE(ring, tensorflow::SharedMemoryRing, ring_handle, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  tensorflow::uint64 c_sequence;
+  char* data;
+  const bool claimed = ring->Claim(static_cast<tensorflow::int64>(timeout_micros), &c_sequence, &data, status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  if (!claimed) return nullptr;
+  const jlong j_sequence = static_cast<jlong>(c_sequence);
+  env->SetLongArrayRegion(sequence, 0, 1, &j_sequence);
+  return env->NewDirectByteBuffer(data, static_cast<jlong>(ring->slot_size()));
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingCommit(
+    JNIEnv* env, jobject object, jlong ring_handle, jlong sequence, jintArray data_types, jintArray ranks,
+    jlongArray dims, jlongArray num_bytes) {
+  REQUIRE_HANDLE(ring, tensorflow::SharedMemoryRing, ring_handle, void());
+  const jsize num_components = env->GetArrayLength(data_types);
+  std::vector<jint> c_data_types(static_cast<size_t>(num_components));
+  std::vector<jint> c_ranks(static_cast<size_t>(num_components));
+  std::vector<jlong> c_num_bytes(static_cast<size_t>(num_components));
+  std::vector<jlong> c_dims(static_cast<size_t>(env->GetArrayLength(dims)));
+  env->GetIntArrayRegion(data_types, 0, num_components, c_data_types.data());
+  env->GetIntArrayRegion(ranks, 0, num_components, c_ranks.data());
+  env->GetLongArrayRegion(num_bytes, 0, num_components, c_num_bytes.data());
+  env->GetLongArrayRegion(dims, 0, static_cast<jsize>(c_dims.size()), c_dims.data());
+  std::vector<tensorflow::SharedMemoryRing::Component> components(static_cast<size_t>(num_components));
+  size_t dim = 0;
+  for (jsize i = 0; i < num_components; ++i) {
+    components[i].dtype = static_cast<TF_DataType>(c_data_types[i]);
+    components[i].num_bytes = static_cast<tensorflow::uint64>(c_num_bytes[i]);
+    for (jint d = 0; d < c_ranks[i] && dim < c_dims.size(); ++d)
+      components[i].dims.push_back(static_cast<int64_t>(c_dims[dim++]));
+  }
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  ring->Commit(static_cast<tensorflow::uint64>(sequence), components, status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingRead(
+    JNIEnv* env, jobject object, jlong ring_handle, jlong timeout_micros) {
+  REQUIRE_HANDLE(ring, tensorflow::SharedMemoryRing, ring_handle, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::vector<TF_Tensor*> element;
+  const bool read = ring->Read(static_cast<tensorflow::int64>(timeout_micros), &element, status.get());
+  CHECK_STATUS(env, status.get(), nullptr);
+  if (!read) return nullptr;
+  return tensors_to_tensor_handles(env, element);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_deleteSharedMemoryRing(
+    JNIEnv* env, jobject object, jlong ring_handle) {
+  REQUIRE_HANDLE(ring, tensorflow::SharedMemoryRing, ring_handle, void());
+  delete ring;
+}
@@ -0,0 +1,85 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_SharedMemoryRing__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_SharedMemoryRing__
+#define _Included_org_platanios_tensorflow_jni_SharedMemoryRing__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    createSharedMemoryRing
+ * Signature: (Ljava/lang/String;IJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_createSharedMemoryRing
+  (JNIEnv *, jobject, jstring, jint, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    openSharedMemoryRing
+ * Signature: (Ljava/lang/String;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_openSharedMemoryRing
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    sharedMemoryRingNumSlots
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingNumSlots
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    sharedMemoryRingSlotSize
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingSlotSize
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    sharedMemoryRingWrite
+ * Signature: (J[JJ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingWrite
+  (JNIEnv *, jobject, jlong, jlongArray, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    sharedMemoryRingClaim
+ * Signature: (JJ[J)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingClaim
+  (JNIEnv *, jobject, jlong, jlong, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    sharedMemoryRingCommit
+ * Signature: (JJ[I[I[J[J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingCommit
+  (JNIEnv *, jobject, jlong, jlong, jintArray, jintArray, jlongArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    sharedMemoryRingRead
+ * Signature: (JJ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_sharedMemoryRingRead
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_SharedMemoryRing__
+ * Method:    deleteSharedMemoryRing
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_SharedMemoryRing_00024_deleteSharedMemoryRing
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
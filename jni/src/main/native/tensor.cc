@@ -14,18 +14,503 @@
  */
 
 #include "exception.h"
+#include "jvm_cache.h"
 #include "tensor.h"
 #include "utilities.h"
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
+#include "tensorflow/c/async_eager_executor.h"
 #include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_api_internal.h"
 #include "tensorflow/c/c_eager_api.h"
+#include "tensorflow/c/deferred_release.h"
+#include "tensorflow/c/eager_tape.h"
+#include "tensorflow/c/handle_tracker.h"
+#include "tensorflow/c/image_ingest.h"
+#include "tensorflow/c/native_executor.h"
+#include "tensorflow/c/pinned_host_memory.h"
+#include "tensorflow/c/status_helper.h"
+#include "tensorflow/c/tensor_proto_codec.h"
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/mem.h"
+
+namespace {
+  // Deallocator argument for native tensors that adopt the memory of a direct Java NIO byte buffer.
+  struct DirectBufferReference {
+    JavaVM* jvm;
+    jobject buffer;
+  };
+
+  // Releases the global reference that keeps an adopted byte buffer alive. TensorFlow may free tensors from any of its
+  // own threads and so we cannot reuse the JNI environment of the thread that created the tensor. Instead, we obtain
+  // an environment for the current thread, attaching it to the JVM temporarily, if necessary.
+  void ReleaseDirectBufferReference(void* data, size_t len, void* arg) {
+    auto* buffer_reference = reinterpret_cast<DirectBufferReference*>(arg);
+    JNIEnv* env;
+    int env_status = buffer_reference->jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
+    bool attached = false;
+    if (env_status == JNI_EDETACHED) {
+      attached = buffer_reference->jvm->AttachCurrentThreadAsDaemon(reinterpret_cast<void**>(&env), nullptr) == JNI_OK;
+      env_status = attached ? JNI_OK : env_status;
+    }
+    // If we cannot obtain an environment, the JVM is shutting down and the reference does not need to be released.
+    if (env_status == JNI_OK)
+      env->DeleteGlobalRef(buffer_reference->buffer);
+    if (attached)
+      buffer_reference->jvm->DetachCurrentThread();
+    delete buffer_reference;
+  }
+
+  // Pool of aligned host buffers backing the tensors created by "Tensor.allocate". Buffers are grouped into size
+  // classes and, when a tensor is deallocated, its buffer is returned to the pool instead of being freed, as long as the
+  // total number of bytes held by the pool does not exceed its capacity. A capacity of zero disables pooling. There are
+  // two pools: one for pageable buffers and one for pinned (i.e., page-locked) buffers, which are much more expensive
+  // to allocate and to free, and so are worth pooling even more.
+  class TensorBufferPool {
+   public:
+    static TensorBufferPool* Global(bool pinned) {
+      // Intentionally leaked, so that tensors deallocated during shutdown can still return their buffers.
+      static TensorBufferPool* pageable_pool = new TensorBufferPool(false);
+      static TensorBufferPool* pinned_pool = new TensorBufferPool(true);
+      return pinned ? pinned_pool : pageable_pool;
+    }
+
+    bool enabled() {
+      std::lock_guard<std::mutex> lock(mu_);
+      return capacity_ > 0;
+    }
+
+    // Returns the size class for buffers of `num_bytes` bytes. Size classes are spaced at eighths of powers of two, which
+    // bounds the wasted space to 25% of the requested size.
+    static size_t SizeClass(size_t num_bytes) {
+      size_t power = kMinSizeClass;
+      while (power < num_bytes) power <<= 1;
+      if (power == kMinSizeClass) return power;
+      size_t step = power >> 3;
+      return ((num_bytes + step - 1) / step) * step;
+    }
+
+    void* Allocate(size_t size_class) {
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = free_buffers_.find(size_class);
+        if (it != free_buffers_.end() && !it->second.empty()) {
+          void* data = it->second.back();
+          it->second.pop_back();
+          bytes_held_ -= size_class;
+          ++hits_;
+          return data;
+        }
+        ++misses_;
+      }
+      if (pinned_) return tensorflow::AllocatePinnedHostMemory(size_class);
+      return tensorflow::port::AlignedMalloc(size_class, tensorflow::Allocator::kAllocatorAlignment);
+    }
+
+    void Release(void* data, size_t size_class) {
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (bytes_held_ + size_class <= capacity_) {
+          free_buffers_[size_class].push_back(data);
+          bytes_held_ += size_class;
+          return;
+        }
+      }
+      Free(data);
+    }
+
+    void SetCapacity(size_t capacity) {
+      std::vector<void*> evicted;
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        capacity_ = capacity;
+        for (auto it = free_buffers_.begin(); it != free_buffers_.end() && bytes_held_ > capacity_; ++it) {
+          while (!it->second.empty() && bytes_held_ > capacity_) {
+            evicted.push_back(it->second.back());
+            it->second.pop_back();
+            bytes_held_ -= it->first;
+          }
+        }
+      }
+      for (void* data : evicted)
+        Free(data);
+    }
+
+    void Statistics(int64_t* hits, int64_t* misses, int64_t* bytes_held, int64_t* capacity) {
+      std::lock_guard<std::mutex> lock(mu_);
+      *hits = hits_;
+      *misses = misses_;
+      *bytes_held = static_cast<int64_t>(bytes_held_);
+      *capacity = static_cast<int64_t>(capacity_);
+    }
+
+   private:
+    static constexpr size_t kMinSizeClass = 64;
+
+    explicit TensorBufferPool(bool pinned) : pinned_(pinned) {}
+
+    void Free(void* data) {
+      if (pinned_)
+        tensorflow::FreePinnedHostMemory(data);
+      else
+        tensorflow::port::AlignedFree(data);
+    }
+
+    const bool pinned_;
+    std::mutex mu_;
+    size_t capacity_ = 0;
+    size_t bytes_held_ = 0;
+    int64_t hits_ = 0;
+    int64_t misses_ = 0;
+    std::unordered_map<size_t, std::vector<void*>> free_buffers_;
+  };
+
+  constexpr size_t TensorBufferPool::kMinSizeClass;
+
+  // Deallocators for pooled tensor buffers. The size class of the buffer is packed in the deallocator argument.
+  void ReleasePooledBuffer(void* data, size_t len, void* arg) {
+    TensorBufferPool::Global(false)->Release(data, reinterpret_cast<size_t>(arg));
+  }
+
+  void ReleasePinnedPooledBuffer(void* data, size_t len, void* arg) {
+    TensorBufferPool::Global(true)->Release(data, reinterpret_cast<size_t>(arg));
+  }
+
+  // Allocates a host tensor whose buffer is uninitialized. Pinned buffers always go through the pinned pool, even if it
+  // is disabled (in which case they are freed as soon as their tensors are deallocated), so that they are always freed
+  // using the right deallocator. Returns "nullptr" if the allocation fails.
+  TF_Tensor* AllocateHostTensor(TF_DataType dtype, const int64_t* dims, int num_dims, size_t num_bytes, bool pinned) {
+    TensorBufferPool* pool = TensorBufferPool::Global(pinned);
+    if (num_bytes == 0 || (!pinned && !pool->enabled()))
+      return TF_AllocateTensor(dtype, dims, num_dims, num_bytes);
+    size_t size_class = TensorBufferPool::SizeClass(num_bytes);
+    void* data = pool->Allocate(size_class);
+    if (data == nullptr) return nullptr;
+    return TF_NewTensor(
+        dtype, dims, num_dims, data, num_bytes, pinned ? ReleasePinnedPooledBuffer : ReleasePooledBuffer,
+        reinterpret_cast<void*>(size_class));
+  }
+
+  // Host mirrors of eager tensors, keyed by eager tensor handle. A mirror is a resolved copy of the tensor in host
+  // memory that is created lazily, the first time that the tensor is read, and that is kept until the eager tensor
+  // handle is deleted. Eager tensors are immutable and so mirrors never need to be invalidated otherwise. This avoids
+  // copying tensors that are placed on other devices to the host (and resolving them) on every read.
+  class HostMirrorCache {
+   public:
+    static HostMirrorCache* Global() {
+      static HostMirrorCache* cache = new HostMirrorCache();
+      return cache;
+    }
+
+    TF_Tensor* Lookup(TFE_TensorHandle* handle) {
+      std::lock_guard<std::mutex> lock(mu_);
+      auto it = mirrors_.find(handle);
+      return it == mirrors_.end() ? nullptr : it->second;
+    }
+
+    // Inserts `mirror` for `handle`, unless another thread inserted one first, in which case `mirror` is deleted and
+    // the existing one is returned.
+    TF_Tensor* Insert(TFE_TensorHandle* handle, TF_Tensor* mirror) {
+      TF_Tensor* existing = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto inserted = mirrors_.emplace(handle, mirror);
+        if (inserted.second) return mirror;
+        existing = inserted.first->second;
+      }
+      TF_DeleteTensor(mirror);
+      return existing;
+    }
+
+    void Erase(TFE_TensorHandle* handle) {
+      TF_Tensor* mirror = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = mirrors_.find(handle);
+        if (it == mirrors_.end()) return;
+        mirror = it->second;
+        mirrors_.erase(it);
+      }
+      TF_DeleteTensor(mirror);
+    }
+
+   private:
+    HostMirrorCache() = default;
+
+    std::mutex mu_;
+    std::unordered_map<TFE_TensorHandle*, TF_Tensor*> mirrors_;
+  };
+
+  // Records "tensor" in the handle tracker (if tracking is enabled) and returns its handle.
+  jlong TrackedTensorHandle(TF_Tensor* tensor) {
+    if (tensor != nullptr) {
+      tensorflow::HandleTracker::Global()->Track(
+          tensorflow::HandleTracker::kTensor, tensor, static_cast<tensorflow::int64>(TF_TensorByteSize(tensor)));
+    }
+    return reinterpret_cast<jlong>(tensor);
+  }
+
+  void DeleteTensor(void* tensor) {
+    tensorflow::HandleTracker::Global()->Untrack(tensor);
+    TF_DeleteTensor(static_cast<TF_Tensor*>(tensor));
+  }
+
+  void DeleteEagerTensor(void* handle) {
+    TFE_TensorHandle* eager_tensor = static_cast<TFE_TensorHandle*>(handle);
+    // Pending handles are filled in asynchronously and so they cannot be deleted before that happens.
+    tensorflow::ForgetTensorHandle(eager_tensor);
+    tensorflow::EagerTape::ForgetOnLiveTapes(eager_tensor);
+    tensorflow::HandleTracker::Global()->Untrack(eager_tensor);
+    HostMirrorCache::Global()->Erase(eager_tensor);
+    TFE_DeleteTensorHandle(eager_tensor);
+  }
+
+  // Returns the host mirror of "eager_tensor", creating it if necessary. "context" is only used (and so it may be null)
+  // if the tensor is not already in host memory. Returns null if "status" is set to an error.
+  TF_Tensor* HostMirror(TFE_TensorHandle* eager_tensor, TFE_Context* context, TF_Status* status) {
+    TF_Tensor* mirror = HostMirrorCache::Global()->Lookup(eager_tensor);
+    if (mirror != nullptr) return mirror;
+    if (eager_tensor->d == nullptr) {
+      mirror = TFE_TensorHandleResolve(eager_tensor, status);
+    } else {
+      std::unique_ptr<TFE_TensorHandle, decltype(&TFE_DeleteTensorHandle)> host_tensor(
+          TFE_TensorHandleCopyToDevice(eager_tensor, context, "CPU:0", status), TFE_DeleteTensorHandle);
+      if (TF_GetCode(status) != TF_OK) return nullptr;
+      mirror = TFE_TensorHandleResolve(host_tensor.get(), status);
+    }
+    if (TF_GetCode(status) != TF_OK) return nullptr;
+    return HostMirrorCache::Global()->Insert(eager_tensor, mirror);
+  }
+
+  // Returns a native tensor with the contents of "eager_tensor", in host memory. Tensors in host memory are shared
+  // through a new native tensor, which is stored in "owned", and all other tensors are read through their host mirrors.
+  const TF_Tensor* HostTensor(
+      TFE_TensorHandle* eager_tensor, TFE_Context* context,
+      std::unique_ptr<TF_Tensor, decltype(&TF_DeleteTensor)>* owned, TF_Status* status) {
+    if (eager_tensor->d != nullptr) return HostMirror(eager_tensor, context, status);
+    owned->reset(tensorflow::TF_TensorFromTensor(eager_tensor->t, status));
+    return owned->get();
+  }
+
+  // Batches smaller than this number of bytes are packed on the calling thread, because dispatching the copies to the
+  // native executor would cost more than what is gained by parallelizing them. Larger batches are split in shards of at
+  // least this number of bytes.
+  const size_t kMinParallelPackingBytes = 1 << 20;
+
+  // Copies each of "parts", which contain "part_size" bytes each, to consecutive locations in "dst".
+  void PackParts(const std::vector<const void*>& parts, size_t part_size, char* dst) {
+    auto copy = [&parts, part_size, dst](tensorflow::int64 start, tensorflow::int64 limit) {
+      for (tensorflow::int64 i = start; i < limit; ++i)
+        memcpy(dst + static_cast<size_t>(i) * part_size, parts[i], part_size);
+    };
+    const tensorflow::int64 num_parts = static_cast<tensorflow::int64>(parts.size());
+    const tensorflow::int64 num_shards = std::min(
+        num_parts, static_cast<tensorflow::int64>(parts.size() * part_size / kMinParallelPackingBytes));
+    if (num_shards <= 1) {
+      copy(0, num_parts);
+      return;
+    }
+    // Packing is bound by memory bandwidth, and so it uses at most one thread per CPU.
+    tensorflow::NativeExecutor::Global()->ParallelFor(
+        tensorflow::NativeExecutor::kTensorPacking, num_shards, tensorflow::port::NumSchedulableCPUs(),
+        [&copy, num_parts, num_shards](tensorflow::int64 shard) {
+          copy(shard * num_parts / num_shards, (shard + 1) * num_parts / num_shards);
+        });
+  }
+
+  // Allocates a tensor with shape "[num_parts] + part_shape" and packs "parts" into it.
+  TF_Tensor* PackTensor(TF_DataType dtype, const std::vector<int64_t>& part_shape, size_t part_size,
+                        const std::vector<const void*>& parts) {
+    std::vector<int64_t> dims;
+    dims.reserve(part_shape.size() + 1);
+    dims.push_back(static_cast<int64_t>(parts.size()));
+    dims.insert(dims.end(), part_shape.begin(), part_shape.end());
+    TF_Tensor* tensor = TF_AllocateTensor(dtype, dims.data(), static_cast<int>(dims.size()), parts.size() * part_size);
+    PackParts(parts, part_size, static_cast<char*>(TF_TensorData(tensor)));
+    return tensor;
+  }
+
+  // Returns true if tensors of type "data_type" can be converted to and from Java primitive arrays.
+  bool IsArrayConvertible(TF_DataType data_type) {
+    switch (data_type) {
+      case TF_FLOAT: case TF_DOUBLE: case TF_INT8: case TF_UINT8: case TF_INT16: case TF_UINT16: case TF_INT32:
+      case TF_INT64: case TF_BOOL:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // Returns true if "data_type" is the data type of the elements of a Java primitive array.
+  bool IsJavaArrayType(TF_DataType data_type) {
+    switch (data_type) {
+      case TF_FLOAT: case TF_DOUBLE: case TF_INT8: case TF_INT16: case TF_INT32: case TF_INT64: case TF_BOOL:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // Copies "n" elements starting at "offset" from a Java primitive array whose elements have type "array_type" to
+  // "data", using the "Get<Type>ArrayRegion" JNI functions, which avoid pinning the array.
+  void GetArrayRegion(JNIEnv* env, jarray array, TF_DataType array_type, jsize offset, jsize n, void* data) {
+    switch (array_type) {
+      case TF_FLOAT:
+        env->GetFloatArrayRegion(static_cast<jfloatArray>(array), offset, n, static_cast<jfloat*>(data));
+        break;
+      case TF_DOUBLE:
+        env->GetDoubleArrayRegion(static_cast<jdoubleArray>(array), offset, n, static_cast<jdouble*>(data));
+        break;
+      case TF_INT8:
+        env->GetByteArrayRegion(static_cast<jbyteArray>(array), offset, n, static_cast<jbyte*>(data));
+        break;
+      case TF_INT16:
+        env->GetShortArrayRegion(static_cast<jshortArray>(array), offset, n, static_cast<jshort*>(data));
+        break;
+      case TF_INT32:
+        env->GetIntArrayRegion(static_cast<jintArray>(array), offset, n, static_cast<jint*>(data));
+        break;
+      case TF_INT64:
+        env->GetLongArrayRegion(static_cast<jlongArray>(array), offset, n, static_cast<jlong*>(data));
+        break;
+      case TF_BOOL:
+        env->GetBooleanArrayRegion(static_cast<jbooleanArray>(array), offset, n, static_cast<jboolean*>(data));
+        break;
+      default:
+        break;
+    }
+  }
+
+  // Inverse of "GetArrayRegion", using the "Set<Type>ArrayRegion" JNI functions.
+  void SetArrayRegion(JNIEnv* env, jarray array, TF_DataType array_type, jsize offset, jsize n, const void* data) {
+    switch (array_type) {
+      case TF_FLOAT:
+        env->SetFloatArrayRegion(static_cast<jfloatArray>(array), offset, n, static_cast<const jfloat*>(data));
+        break;
+      case TF_DOUBLE:
+        env->SetDoubleArrayRegion(static_cast<jdoubleArray>(array), offset, n, static_cast<const jdouble*>(data));
+        break;
+      case TF_INT8:
+        env->SetByteArrayRegion(static_cast<jbyteArray>(array), offset, n, static_cast<const jbyte*>(data));
+        break;
+      case TF_INT16:
+        env->SetShortArrayRegion(static_cast<jshortArray>(array), offset, n, static_cast<const jshort*>(data));
+        break;
+      case TF_INT32:
+        env->SetIntArrayRegion(static_cast<jintArray>(array), offset, n, static_cast<const jint*>(data));
+        break;
+      case TF_INT64:
+        env->SetLongArrayRegion(static_cast<jlongArray>(array), offset, n, static_cast<const jlong*>(data));
+        break;
+      case TF_BOOL:
+        env->SetBooleanArrayRegion(static_cast<jbooleanArray>(array), offset, n, static_cast<const jboolean*>(data));
+        break;
+      default:
+        break;
+    }
+  }
+
+  // Converts "n" elements using C++ conversion semantics (e.g., truncating floating-point numbers). The loop is kept
+  // trivial so that the compiler can vectorize it.
+  template <typename Src, typename Dst>
+  void ConvertElements(const void* src, void* dst, int64_t n) {
+    const Src* s = static_cast<const Src*>(src);
+    Dst* d = static_cast<Dst*>(dst);
+    for (int64_t i = 0; i < n; ++i)
+      d[i] = static_cast<Dst>(s[i]);
+  }
+
+  template <typename Src>
+  void ConvertElementsFrom(const void* src, TF_DataType dst_type, void* dst, int64_t n) {
+    switch (dst_type) {
+      case TF_FLOAT: ConvertElements<Src, float>(src, dst, n); break;
+      case TF_DOUBLE: ConvertElements<Src, double>(src, dst, n); break;
+      case TF_INT8: ConvertElements<Src, int8_t>(src, dst, n); break;
+      case TF_UINT8: ConvertElements<Src, uint8_t>(src, dst, n); break;
+      case TF_INT16: ConvertElements<Src, int16_t>(src, dst, n); break;
+      case TF_UINT16: ConvertElements<Src, uint16_t>(src, dst, n); break;
+      case TF_INT32: ConvertElements<Src, int32_t>(src, dst, n); break;
+      case TF_INT64: ConvertElements<Src, int64_t>(src, dst, n); break;
+      case TF_BOOL: ConvertElements<Src, bool>(src, dst, n); break;
+      default: break;
+    }
+  }
+
+  // Converts "n" elements of type "src_type" to "dst_type". Both types must be array-convertible.
+  void ConvertElements(TF_DataType src_type, const void* src, TF_DataType dst_type, void* dst, int64_t n) {
+    switch (src_type) {
+      case TF_FLOAT: ConvertElementsFrom<float>(src, dst_type, dst, n); break;
+      case TF_DOUBLE: ConvertElementsFrom<double>(src, dst_type, dst, n); break;
+      case TF_INT8: ConvertElementsFrom<int8_t>(src, dst_type, dst, n); break;
+      case TF_UINT8: ConvertElementsFrom<uint8_t>(src, dst_type, dst, n); break;
+      case TF_INT16: ConvertElementsFrom<int16_t>(src, dst_type, dst, n); break;
+      case TF_UINT16: ConvertElementsFrom<uint16_t>(src, dst_type, dst, n); break;
+      case TF_INT32: ConvertElementsFrom<int32_t>(src, dst_type, dst, n); break;
+      case TF_INT64: ConvertElementsFrom<int64_t>(src, dst_type, dst, n); break;
+      case TF_BOOL: ConvertElementsFrom<bool>(src, dst_type, dst, n); break;
+      default: break;
+    }
+  }
+
+  // Creates an eager context (see "eagerAllocateContext"). If "per_thread_executors" is true and the context is
+  // asynchronous, each thread that uses it gets its own asynchronous executor.
+  jlong allocate_context(
+      JNIEnv* env, jbyteArray config_proto, jboolean async, bool per_thread_executors, jintArray cpus,
+      jint numa_node) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    std::vector<int> cpu_set;
+    if (!resolve_cpu_set(env, cpus, numa_node, &cpu_set)) return 0;
+    std::unique_ptr<TF_SessionOptions, decltype(&TF_DeleteSessionOptions)> options(
+      TF_NewSessionOptions(), TF_DeleteSessionOptions);
+
+    // Set the configuration proto (e.g., with the thread pool sizes and the GPU options), if one has been provided.
+    if (config_proto != nullptr) {
+      const jsize config_proto_length = env->GetArrayLength(config_proto);
+      ArrayBuffer<jbyte> c_config_proto(config_proto_length);
+      env->GetByteArrayRegion(config_proto, 0, config_proto_length, c_config_proto.data());
+      TF_SetConfig(options.get(), c_config_proto.data(), static_cast<size_t>(config_proto_length), status.get());
+      CHECK_STATUS(env, status.get(), 0);
+    }
+
+    // The context thread pools (including that of the asynchronous executor) are created along with the context and
+    // inherit the CPU affinity of this thread.
+    tensorflow::ScopedThreadAffinity affinity(cpu_set);
+    if (!affinity.status().ok()) {
+      Set_TF_Status_from_Status(status.get(), affinity.status());
+      CHECK_STATUS(env, status.get(), 0);
+    }
+    TFE_Context* context = TFE_NewContext(options.get(), status.get());
+    CHECK_STATUS(env, status.get(), 0);
+    if (async) {
+      TF_DeviceList* devices = TFE_ContextListDevices(context, status.get());
+      if (TF_GetCode(status.get()) != TF_OK) {
+        std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> delete_status(TF_NewStatus(), TF_DeleteStatus);
+        TFE_DeleteContext(context, delete_status.get());
+        CHECK_STATUS(env, status.get(), 0);
+      }
+      std::vector<std::string> device_names;
+      for (int i = 0; i < TF_DeviceListCount(devices); ++i)
+        device_names.emplace_back(TF_DeviceListName(devices, i, status.get()));
+      TF_DeleteDeviceList(devices);
+      if (per_thread_executors)
+        tensorflow::AsyncEagerExecutor::RegisterPerThread(context, std::move(device_names));
+      else
+        tensorflow::AsyncEagerExecutor::Register(context, new tensorflow::AsyncEagerExecutor(std::move(device_names)));
+    }
+    return reinterpret_cast<jlong>(context);
+  }
+}  // namespace
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_allocate(
-    JNIEnv* env, jobject object, jint data_type, jlongArray shape, jlong num_bytes) {
+    JNIEnv* env, jobject object, jint data_type, jlongArray shape, jlong num_bytes, jboolean pinned) {
   TF_DataType dtype = static_cast<TF_DataType>(data_type);
   const int num_dims = env->GetArrayLength(shape);
   std::unique_ptr<int64_t[]> dims(new int64_t[num_dims]);
@@ -35,12 +520,17 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_allocate(
       dims[i] = static_cast<int64_t>(shape_elems[i]);
     env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
   }
-  TF_Tensor* tensor = TF_AllocateTensor(dtype, dims.get(), num_dims, static_cast<size_t>(num_bytes));
-  return reinterpret_cast<jlong>(tensor);
+  size_t c_num_bytes = static_cast<size_t>(num_bytes);
+  TF_Tensor* tensor = AllocateHostTensor(dtype, dims.get(), num_dims, c_num_bytes, pinned == JNI_TRUE);
+  if (tensor == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "Unable to create new native Tensor.");
+    return 0;
+  }
+  return TrackedTensorHandle(tensor);
 }
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromBuffer(
-    JNIEnv* env, jobject object, jint data_type, jlongArray shape, jlong num_bytes, jobject buffer) {
+    JNIEnv* env, jobject object, jint data_type, jlongArray shape, jlong num_bytes, jobject buffer, jboolean pinned) {
   TF_DataType dtype = static_cast<TF_DataType>(data_type);
   const int num_dims = env->GetArrayLength(shape);
   std::unique_ptr<int64_t[]> dims(new int64_t[num_dims]);
@@ -51,52 +541,190 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromBuffe
     env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
   }
   size_t c_num_bytes = static_cast<size_t>(num_bytes);
-  TF_Tensor* tensor = TF_AllocateTensor(dtype, dims.get(), num_dims, c_num_bytes);
+  TF_Tensor* tensor = AllocateHostTensor(dtype, dims.get(), num_dims, c_num_bytes, pinned == JNI_TRUE);
+  if (tensor == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "Unable to create new native Tensor.");
+    return 0;
+  }
   memcpy(TF_TensorData(tensor), env->GetDirectBufferAddress(buffer), c_num_bytes);
-  return reinterpret_cast<jlong>(tensor);
-}
-
-//JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromBuffer(
-//    JNIEnv* env, jobject object, jobject buffer, jint dtype, jlongArray shape, jlong sizeInBytes) {
-//  int num_dims = static_cast<int>(env->GetArrayLength(shape));
-//  jlong* dims = nullptr;
-//  if (num_dims > 0) {
-//    jboolean is_copy;
-//    dims = env->GetLongArrayElements(shape, &is_copy);
-//  }
-//  static_assert(sizeof(jlong) == sizeof(int64_t), "Scala \"Long\" is not compatible with the TensorFlow C API.");
-//  // On some platforms "jlong" is a "long" while "int64_t" is a "long long".
-//  //
-//  // Thus, static_cast<int64_t*>(dims) will trigger a compiler error:
-//  // static_cast from 'jlong *' (aka 'long *') to 'int64_t *' (aka 'long long
-//  // *') is not allowed
-//  //
-//  // Since this array is typically very small, use the guaranteed safe scheme of
-//  // creating a copy.
-//  int64_t* dims_copy = new int64_t[num_dims];
-//  for (int i = 0; i < num_dims; ++i)
-//    dims_copy[i] = static_cast<int64_t>(dims[i]);
-//  // Notifying the JVM of the existence of this reference to the byte buffer, to avoid garbage collection.
-//  // More details can be found here: http://docs.oracle.com/javase/6/docs/technotes/guides/jni/spec/design.html#wp1242
-//  jobject buffer_ref = env->NewGlobalRef(buffer);
-//  std::pair<JNIEnv*, jobject>* deallocator_arg = new std::pair<JNIEnv*, jobject>(env, buffer_ref);
-//  TF_Tensor* tensor_handle = TF_NewTensor(
-//      static_cast<TF_DataType>(dtype), dims_copy, num_dims,
-//      env->GetDirectBufferAddress(buffer), static_cast<size_t>(sizeInBytes),
-//      [](void* data, size_t len, void* arg) {
-//        std::pair<JNIEnv*, jobject>* pair = reinterpret_cast<std::pair<JNIEnv*, jobject>*>(arg);
-//        pair->first->DeleteGlobalRef(reinterpret_cast<jobject>(pair->second));
-//        delete (pair);
-//      }, deallocator_arg);
-//  delete[] dims_copy;
-//  if (dims != nullptr)
-//    env->ReleaseLongArrayElements(shape, dims, JNI_ABORT);
-//  if (tensor_handle == nullptr) {
-//    throw_exception(env, tf_invalid_argument_exception, "Unable to create new native Tensor.");
-//    return 0;
-//  }
-//  return reinterpret_cast<jlong>(tensor_handle);
-//}
+  return TrackedTensorHandle(tensor);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromBufferNoCopy(
+    JNIEnv* env, jobject object, jint data_type, jlongArray shape, jlong num_bytes, jobject buffer) {
+  void* data = env->GetDirectBufferAddress(buffer);
+  if (data == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "Only direct buffers can be adopted by native tensors.");
+    return 0;
+  }
+  if (env->GetDirectBufferCapacity(buffer) < num_bytes) {
+    throw_exception(env, tf_invalid_argument_exception, "The provided buffer is smaller than the requested tensor.");
+    return 0;
+  }
+  TF_DataType dtype = static_cast<TF_DataType>(data_type);
+  const int num_dims = env->GetArrayLength(shape);
+  std::unique_ptr<int64_t[]> dims(new int64_t[num_dims]);
+  if (num_dims > 0) {
+    jlong *shape_elems = env->GetLongArrayElements(shape, nullptr);
+    for (int i = 0; i < num_dims; ++i)
+      dims[i] = static_cast<int64_t>(shape_elems[i]);
+    env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
+  }
+  size_t c_num_bytes = static_cast<size_t>(num_bytes);
+
+  // TensorFlow requires tensor buffers to be aligned for Eigen. Misaligned buffers are copied, which is also what
+  // "TF_NewTensor" would end up doing internally.
+  if (reinterpret_cast<intptr_t>(data) % tensorflow::Allocator::kAllocatorAlignment != 0) {
+    TF_Tensor* tensor = TF_AllocateTensor(dtype, dims.get(), num_dims, c_num_bytes);
+    memcpy(TF_TensorData(tensor), data, c_num_bytes);
+    return TrackedTensorHandle(tensor);
+  }
+
+  // Notifying the JVM of the existence of this reference to the byte buffer, to avoid garbage collection.
+  // More details can be found here: http://docs.oracle.com/javase/6/docs/technotes/guides/jni/spec/design.html#wp1242
+  JavaVM* jvm;
+  env->GetJavaVM(&jvm);
+  auto* buffer_reference = new DirectBufferReference{jvm, env->NewGlobalRef(buffer)};
+  TF_Tensor* tensor = TF_NewTensor(
+      dtype, dims.get(), num_dims, data, c_num_bytes, ReleaseDirectBufferReference, buffer_reference);
+  if (tensor == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "Unable to create new native Tensor.");
+    return 0;
+  }
+  return TrackedTensorHandle(tensor);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromArray(
+    JNIEnv* env, jobject object, jobject array, jint array_data_type, jint offset, jint data_type, jlongArray shape) {
+  TF_DataType dtype = static_cast<TF_DataType>(data_type);
+  TF_DataType array_dtype = static_cast<TF_DataType>(array_data_type);
+  if (!IsArrayConvertible(dtype) || !IsJavaArrayType(array_dtype)) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Cannot create a tensor with data type %d from an array with data type %d.",
+        dtype, array_dtype);
+    return 0;
+  }
+  const int num_dims = env->GetArrayLength(shape);
+  std::unique_ptr<int64_t[]> dims(new int64_t[num_dims]);
+  int64_t num_elements = 1;
+  if (num_dims > 0) {
+    jlong *shape_elems = env->GetLongArrayElements(shape, nullptr);
+    for (int i = 0; i < num_dims; ++i) {
+      dims[i] = static_cast<int64_t>(shape_elems[i]);
+      num_elements *= dims[i];
+    }
+    env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
+  }
+  jarray java_array = static_cast<jarray>(array);
+  if (offset < 0 || num_elements > static_cast<int64_t>(env->GetArrayLength(java_array)) - offset) {
+    throw_exception(
+        env, jvm_index_out_of_bounds_exception, "Cannot copy %lld elements from an array of length %d at offset %d.",
+        static_cast<long long>(num_elements), env->GetArrayLength(java_array), offset);
+    return 0;
+  }
+  TF_Tensor* tensor = TF_AllocateTensor(
+      dtype, dims.get(), num_dims, static_cast<size_t>(num_elements) * TF_DataTypeSize(dtype));
+  const jsize n = static_cast<jsize>(num_elements);
+  if (array_dtype == dtype) {
+    GetArrayRegion(env, java_array, array_dtype, offset, n, TF_TensorData(tensor));
+  } else {
+    // The conversion loop does not call back into the JVM and so the array can be accessed without copying it.
+    void* elements = env->GetPrimitiveArrayCritical(java_array, nullptr);
+    const char* array_data = static_cast<char*>(elements) + static_cast<size_t>(offset) * TF_DataTypeSize(array_dtype);
+    ConvertElements(array_dtype, array_data, dtype, TF_TensorData(tensor), num_elements);
+    env->ReleasePrimitiveArrayCritical(java_array, elements, JNI_ABORT);
+  }
+  return TrackedTensorHandle(tensor);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_ingestUInt8(
+    JNIEnv* env, jobject object, jobject buffer, jint data_type, jlongArray shape, jfloatArray scale,
+    jfloatArray shift) {
+  const uint8_t* data = static_cast<const uint8_t*>(env->GetDirectBufferAddress(buffer));
+  if (data == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "Only direct buffers can be ingested into native tensors.");
+    return 0;
+  }
+  TF_DataType dtype = static_cast<TF_DataType>(data_type);
+  if (dtype != TF_FLOAT && dtype != TF_HALF) {
+    throw_exception(env, tf_invalid_argument_exception, "Bytes can only be ingested into FLOAT32 or FLOAT16 tensors.");
+    return 0;
+  }
+  const int num_dims = env->GetArrayLength(shape);
+  std::unique_ptr<int64_t[]> dims(new int64_t[num_dims]);
+  int64_t num_elements = 1;
+  if (num_dims > 0) {
+    jlong *shape_elems = env->GetLongArrayElements(shape, nullptr);
+    for (int i = 0; i < num_dims; ++i) {
+      dims[i] = static_cast<int64_t>(shape_elems[i]);
+      num_elements *= dims[i];
+    }
+    env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
+  }
+  if (env->GetDirectBufferCapacity(buffer) < num_elements) {
+    throw_exception(env, tf_invalid_argument_exception, "The provided buffer is smaller than the requested tensor.");
+    return 0;
+  }
+
+  // The channel is the innermost dimension and a single scale or shift value applies to all channels.
+  const int64_t num_channels = num_dims > 0 && dims[num_dims - 1] > 0 ? dims[num_dims - 1] : 1;
+  const jsize num_scale = env->GetArrayLength(scale);
+  const jsize num_shift = env->GetArrayLength(shift);
+  if ((num_scale != 1 && num_scale != num_channels) || (num_shift != 1 && num_shift != num_channels)) {
+    throw_exception(
+        env, tf_invalid_argument_exception,
+        "The scale and the shift must contain either one value or one value per channel (i.e., %lld values).",
+        static_cast<long long>(num_channels));
+    return 0;
+  }
+  std::vector<float> channel_scale(static_cast<size_t>(num_channels));
+  std::vector<float> channel_shift(static_cast<size_t>(num_channels));
+  env->GetFloatArrayRegion(scale, 0, num_scale, channel_scale.data());
+  env->GetFloatArrayRegion(shift, 0, num_shift, channel_shift.data());
+  std::fill(channel_scale.begin() + num_scale, channel_scale.end(), channel_scale[0]);
+  std::fill(channel_shift.begin() + num_shift, channel_shift.end(), channel_shift[0]);
+
+  TF_Tensor* tensor = TF_AllocateTensor(
+      dtype, dims.get(), num_dims, static_cast<size_t>(num_elements) * TF_DataTypeSize(dtype));
+  if (dtype == TF_FLOAT) {
+    tensorflow::IngestUInt8(
+        data, num_elements, num_channels, channel_scale.data(), channel_shift.data(),
+        static_cast<float*>(TF_TensorData(tensor)));
+  } else {
+    tensorflow::IngestUInt8(
+        data, num_elements, num_channels, channel_scale.data(), channel_shift.data(),
+        static_cast<Eigen::half*>(TF_TensorData(tensor)));
+  }
+  return TrackedTensorHandle(tensor);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_packBuffers(
+    JNIEnv* env, jobject object, jint data_type, jlongArray shape, jlong num_bytes, jobjectArray buffers) {
+  const jsize num_parts = env->GetArrayLength(buffers);
+  std::vector<const void*> parts(static_cast<size_t>(num_parts));
+  for (jsize i = 0; i < num_parts; ++i) {
+    jobject buffer = env->GetObjectArrayElement(buffers, i);
+    parts[i] = env->GetDirectBufferAddress(buffer);
+    const jlong capacity = env->GetDirectBufferCapacity(buffer);
+    env->DeleteLocalRef(buffer);
+    if (parts[i] == nullptr || capacity < num_bytes) {
+      throw_exception(
+          env, tf_invalid_argument_exception,
+          "Buffer %d is not a direct buffer or it is smaller than the requested number of bytes.", i);
+      return 0;
+    }
+  }
+  const int num_dims = env->GetArrayLength(shape);
+  std::vector<int64_t> dims(static_cast<size_t>(num_dims));
+  if (num_dims > 0) {
+    jlong *shape_elems = env->GetLongArrayElements(shape, nullptr);
+    for (int i = 0; i < num_dims; ++i)
+      dims[i] = static_cast<int64_t>(shape_elems[i]);
+    env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
+  }
+  return TrackedTensorHandle(
+      PackTensor(static_cast<TF_DataType>(data_type), dims, static_cast<size_t>(num_bytes), parts));
+}
 
 JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_dataType(
     JNIEnv* env, jobject object, jlong handle) {
@@ -130,7 +758,37 @@ JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_buffer(
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_delete(
     JNIEnv* env, jobject object, jlong handle) {
   REQUIRE_HANDLE(tensor, TF_Tensor, handle, void());
-  TF_DeleteTensor(tensor);
+  DeleteTensor(tensor);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_deleteDeferred(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(tensor, TF_Tensor, handle, void());
+  tensorflow::DeferredRelease::Global()->Schedule(DeleteTensor, tensor);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_flushDeferredDeletes(
+    JNIEnv* env, jobject object) {
+  tensorflow::DeferredRelease::Global()->Flush();
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_setPoolCapacity(
+    JNIEnv* env, jobject object, jlong num_bytes, jboolean pinned) {
+  if (num_bytes < 0) {
+    throw_exception(env, tf_invalid_argument_exception, "The tensor buffer pool capacity must be non-negative.");
+    return;
+  }
+  TensorBufferPool::Global(pinned == JNI_TRUE)->SetCapacity(static_cast<size_t>(num_bytes));
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_poolStatistics(
+    JNIEnv* env, jobject object, jboolean pinned) {
+  int64_t hits, misses, bytes_held, capacity;
+  TensorBufferPool::Global(pinned == JNI_TRUE)->Statistics(&hits, &misses, &bytes_held, &capacity);
+  const JVMCache& cache = jvm_cache();
+  return env->CallStaticObjectMethod(
+      cache.tensor_pool_statistics_class, cache.tensor_pool_statistics_apply, static_cast<jlong>(hits), static_cast<jlong>(misses),
+      static_cast<jlong>(bytes_held), static_cast<jlong>(capacity));
 }
 
 JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_getEncodedStringSize(
@@ -174,24 +832,173 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_getS
   return return_array;
 }
 
-JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocateContext(
-    JNIEnv* env, jobject object) {
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_encodeStrings(
+    JNIEnv* env, jobject object, jlongArray shape, jbyteArray string_bytes, jlongArray string_offsets) {
+  const int num_dims = env->GetArrayLength(shape);
+  ArrayBuffer<jlong> dims(num_dims);
+  env->GetLongArrayRegion(shape, 0, num_dims, dims.data());
+  int64_t num_strings = 1;
+  for (int i = 0; i < num_dims; ++i)
+    num_strings *= static_cast<int64_t>(dims[i]);
+  const jsize num_offsets = env->GetArrayLength(string_offsets);
+  if (num_offsets != num_strings + 1) {
+    throw_exception(
+      env, jvm_illegal_argument_exception, "Expected %lld string offsets for a tensor with %lld elements, but got %d.",
+      static_cast<long long>(num_strings + 1), static_cast<long long>(num_strings), num_offsets);
+    return 0;
+  }
+  ArrayBuffer<jlong> offsets(num_offsets);
+  env->GetLongArrayRegion(string_offsets, 0, num_offsets, offsets.data());
+  const jlong num_string_bytes = static_cast<jlong>(env->GetArrayLength(string_bytes));
+  // The encoded tensor consists of a table with the offset of each encoded string, followed by the encoded strings,
+  // and so its size is known before encoding anything.
+  size_t num_bytes = sizeof(uint64_t) * static_cast<size_t>(num_strings);
+  for (int64_t i = 0; i < num_strings; ++i) {
+    if (offsets[i] < 0 || offsets[i] > offsets[i + 1] || offsets[i + 1] > num_string_bytes) {
+      throw_exception(env, jvm_illegal_argument_exception, "Invalid offset for string %lld.", static_cast<long long>(i));
+      return 0;
+    }
+    num_bytes += TF_StringEncodedSize(static_cast<size_t>(offsets[i + 1] - offsets[i]));
+  }
+  static_assert(sizeof(jlong) == sizeof(int64_t), "Scala \"Long\" is not compatible with the TensorFlow C API.");
+  TF_Tensor* tensor = TF_AllocateTensor(TF_STRING, reinterpret_cast<const int64_t*>(dims.data()), num_dims, num_bytes);
+  if (tensor == nullptr) {
+    throw_exception(env, tf_invalid_argument_exception, "Unable to create new native Tensor.");
+    return 0;
+  }
+  uint64_t* table = static_cast<uint64_t*>(TF_TensorData(tensor));
+  char* data_start = static_cast<char*>(TF_TensorData(tensor)) + sizeof(uint64_t) * num_strings;
+  char* data_end = static_cast<char*>(TF_TensorData(tensor)) + num_bytes;
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
-  TF_SessionOptions* options = TF_NewSessionOptions();
-  TFE_Context* context = TFE_NewContext(options, status.get());
-  TF_DeleteSessionOptions(options);
-  CHECK_STATUS(env, status.get(), 0);
-  return reinterpret_cast<jlong>(context);
+  // No JNI calls are made while the Java array is pinned.
+  const char* src = static_cast<const char*>(env->GetPrimitiveArrayCritical(string_bytes, nullptr));
+  char* dst = data_start;
+  for (int64_t i = 0; i < num_strings && TF_GetCode(status.get()) == TF_OK; ++i) {
+    table[i] = static_cast<uint64_t>(dst - data_start);
+    dst += TF_StringEncode(
+      src + offsets[i], static_cast<size_t>(offsets[i + 1] - offsets[i]), dst, static_cast<size_t>(data_end - dst),
+      status.get());
+  }
+  env->ReleasePrimitiveArrayCritical(string_bytes, const_cast<char*>(src), JNI_ABORT);
+  if (TF_GetCode(status.get()) != TF_OK) {
+    TF_DeleteTensor(tensor);
+    CHECK_STATUS(env, status.get(), 0);
+  }
+  return TrackedTensorHandle(tensor);
+}
+
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_decodeStrings(
+    JNIEnv* env, jobject object, jlong handle, jlongArray string_offsets) {
+  REQUIRE_HANDLE(tensor, TF_Tensor, handle, nullptr);
+  if (TF_TensorType(tensor) != TF_STRING) {
+    throw_exception(env, jvm_illegal_argument_exception, "Only string tensors can be decoded into strings.");
+    return nullptr;
+  }
+  int64_t num_strings = 1;
+  for (int i = 0; i < TF_NumDims(tensor); ++i)
+    num_strings *= TF_Dim(tensor, i);
+  if (env->GetArrayLength(string_offsets) != num_strings + 1) {
+    throw_exception(
+      env, jvm_illegal_argument_exception, "Expected an offsets array with %lld elements.",
+      static_cast<long long>(num_strings + 1));
+    return nullptr;
+  }
+  const uint64_t* table = static_cast<const uint64_t*>(TF_TensorData(tensor));
+  const char* data_start = static_cast<const char*>(TF_TensorData(tensor)) + sizeof(uint64_t) * num_strings;
+  const size_t data_size = TF_TensorByteSize(tensor) - sizeof(uint64_t) * num_strings;
+  // The strings are decoded in place (i.e., decoding only parses their length prefixes) and copied into the returned
+  // array once their total size is known.
+  std::vector<const char*> strings(static_cast<size_t>(num_strings));
+  ArrayBuffer<jlong> offsets(static_cast<jsize>(num_strings + 1));
+  offsets[0] = 0;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  for (int64_t i = 0; i < num_strings; ++i) {
+    if (table[i] > data_size) {
+      throw_exception(env, tf_invalid_argument_exception, "Malformed string tensor.");
+      return nullptr;
+    }
+    size_t length = 0;
+    TF_StringDecode(data_start + table[i], data_size - table[i], &strings[i], &length, status.get());
+    CHECK_STATUS(env, status.get(), nullptr);
+    offsets[i + 1] = offsets[i] + static_cast<jlong>(length);
+  }
+  if (offsets[num_strings] > static_cast<jlong>(std::numeric_limits<jsize>::max())) {
+    throw_exception(env, jvm_illegal_argument_exception, "The decoded strings do not fit in a single Java array.");
+    return nullptr;
+  }
+  jbyteArray result = env->NewByteArray(static_cast<jsize>(offsets[num_strings]));
+  if (result == nullptr) return nullptr;
+  char* dst = static_cast<char*>(env->GetPrimitiveArrayCritical(result, nullptr));
+  for (int64_t i = 0; i < num_strings; ++i)
+    std::memcpy(dst + offsets[i], strings[i], static_cast<size_t>(offsets[i + 1] - offsets[i]));
+  env->ReleasePrimitiveArrayCritical(result, dst, 0);
+  env->SetLongArrayRegion(string_offsets, 0, static_cast<jsize>(num_strings + 1), offsets.data());
+  return result;
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocateContext(
+    JNIEnv* env, jobject object, jbyteArray config_proto, jboolean async, jintArray cpus, jint numa_node) {
+  return allocate_context(env, config_proto, async, false, cpus, numa_node);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocateSharedContext(
+    JNIEnv* env, jobject object, jbyteArray config_proto, jboolean async, jintArray cpus, jint numa_node) {
+  return allocate_context(env, config_proto, async, true, cpus, numa_node);
 }
 
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDeleteContext(
     JNIEnv* env, jobject object, jlong handle) {
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
   REQUIRE_HANDLE(context, TFE_Context, handle, void());
+  tensorflow::AsyncEagerExecutor::Unregister(context);
   TFE_DeleteContext(context, status.get());
   CHECK_STATUS(env, status.get(), void());
 }
 
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocatorStatistics(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(context, TFE_Context, handle, nullptr);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::unique_ptr<TF_DeviceList, decltype(&TF_DeleteDeviceList)> device_list(
+      TFE_ContextListDevices(context, status.get()), TF_DeleteDeviceList);
+  CHECK_STATUS(env, status.get(), nullptr);
+
+  // The devices of eager contexts are not exposed by the C API, and so they are obtained by copying a scalar to each
+  // one of them. Device allocators are shared by all contexts and sessions in the process, and so this is only needed
+  // in order to find them.
+  std::vector<std::pair<std::string, tensorflow::Device*>> devices;
+  std::vector<std::unique_ptr<TFE_TensorHandle>> probes;
+  TFE_TensorHandle probe(tensorflow::Tensor(tensorflow::DT_INT32, tensorflow::TensorShape({})), nullptr);
+  for (int i = 0; i < TF_DeviceListCount(device_list.get()); ++i) {
+    const char* device_name = TF_DeviceListName(device_list.get(), i, status.get());
+    CHECK_STATUS(env, status.get(), nullptr);
+    probes.emplace_back(TFE_TensorHandleCopyToDevice(&probe, context, device_name, status.get()));
+    CHECK_STATUS(env, status.get(), nullptr);
+    devices.emplace_back(device_name, probes.back()->d);
+  }
+  std::vector<tensorflow::DeviceAllocatorStats> stats;
+  tensorflow::CollectAllocatorStats(devices, &stats);
+  return allocator_statistics_to_java(env, stats);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerSync(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(context, TFE_Context, handle, void());
+  tensorflow::AsyncEagerExecutor* executor = tensorflow::AsyncEagerExecutor::ForContext(context);
+  if (executor == nullptr) return;
+  const tensorflow::Status s = executor->Sync();
+  if (!s.ok()) {
+    TF_Status* status = thread_local_status();
+    TF_SetStatus(status, static_cast<TF_Code>(s.code()), s.error_message().c_str());
+    CHECK_STATUS(env, status, void());
+  }
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAwait(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_TENSOR_HANDLE(eager_tensor, handle, void());
+}
+
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocate(
     JNIEnv* env, jobject object, jlong tensor_handle) {
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
@@ -225,29 +1032,250 @@ JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eage
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDevice(
     JNIEnv* env,  jobject object, jlong handle) {
   REQUIRE_HANDLE(tensor, TFE_TensorHandle, handle, nullptr);
+  // Pending handles already have their final data type and shape, but not their final device.
+  std::string pending_device;
+  if (tensorflow::PendingTensorHandleDevice(tensor, &pending_device))
+    return env->NewStringUTF(pending_device.c_str());
+  if (!await_tensor_handle(env, tensor)) return nullptr;
   return env->NewStringUTF(TFE_TensorHandleDeviceName(tensor));
 }
 
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDelete(
     JNIEnv* env, jobject object, jlong handle) {
   REQUIRE_HANDLE(eager_tensor, TFE_TensorHandle, handle, void());
-  TFE_DeleteTensorHandle(eager_tensor);
+  DeleteEagerTensor(eager_tensor);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDeleteDeferred(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_HANDLE(eager_tensor, TFE_TensorHandle, handle, void());
+  tensorflow::DeferredRelease::Global()->Schedule(DeleteEagerTensor, eager_tensor);
 }
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerResolve(
     JNIEnv* env, jobject object, jlong handle) {
-  REQUIRE_HANDLE(eager_tensor, TFE_TensorHandle, handle, 0);
+  REQUIRE_TENSOR_HANDLE(eager_tensor, handle, 0);
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
   TF_Tensor* tensor = TFE_TensorHandleResolve(eager_tensor, status.get());
   CHECK_STATUS(env, status.get(), 0);
-  return reinterpret_cast<jlong>(tensor);
+  return TrackedTensorHandle(tensor);
+}
+
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerHostBuffer(
+    JNIEnv* env, jobject object, jlong handle) {
+  REQUIRE_TENSOR_HANDLE(eager_tensor, handle, nullptr);
+  // Only tensors in host memory whose storage matches the C API representation can be viewed directly. Strings, for
+  // example, are stored as C++ strings rather than in the encoded format that the C API exposes.
+  if (eager_tensor->d != nullptr || !tensorflow::DataTypeCanUseMemcpy(eager_tensor->t.dtype())) return nullptr;
+  const tensorflow::StringPiece data = eager_tensor->t.tensor_data();
+  // Direct buffers cannot have a null address, which empty tensors may have.
+  static char empty_data;
+  void* address = data.empty() ? &empty_data : const_cast<char*>(data.data());
+  return env->NewDirectByteBuffer(address, static_cast<jlong>(data.size()));
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerHostMirror(
+    JNIEnv* env, jobject object, jlong handle, jlong context_handle) {
+  REQUIRE_TENSOR_HANDLE(eager_tensor, handle, 0);
+  TFE_Context* context = nullptr;
+  if (eager_tensor->d != nullptr) {
+    REQUIRE_HANDLE(device_context, TFE_Context, context_handle, 0);
+    context = device_context;
+  }
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  TF_Tensor* mirror = HostMirror(eager_tensor, context, status.get());
+  CHECK_STATUS(env, status.get(), 0);
+  return reinterpret_cast<jlong>(mirror);
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerCopyToArray(
+    JNIEnv* env, jobject object, jlong handle, jlong context_handle, jobject array, jint array_data_type,
+    jint offset) {
+  REQUIRE_TENSOR_HANDLE(eager_tensor, handle, void());
+  TF_DataType dtype = static_cast<TF_DataType>(eager_tensor->t.dtype());
+  TF_DataType array_dtype = static_cast<TF_DataType>(array_data_type);
+  if (!IsArrayConvertible(dtype) || !IsJavaArrayType(array_dtype)) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "Cannot copy a tensor with data type %d to an array with data type %d.",
+        dtype, array_dtype);
+    return;
+  }
+  jarray java_array = static_cast<jarray>(array);
+  const int64_t num_elements = eager_tensor->t.NumElements();
+  if (offset < 0 || num_elements > static_cast<int64_t>(env->GetArrayLength(java_array)) - offset) {
+    throw_exception(
+        env, jvm_index_out_of_bounds_exception, "Cannot copy %lld elements to an array of length %d at offset %d.",
+        static_cast<long long>(num_elements), env->GetArrayLength(java_array), offset);
+    return;
+  }
+
+  // Tensors in host memory are read in place and all other tensors are read through their (cached) host mirrors.
+  const void* data;
+  if (eager_tensor->d == nullptr) {
+    data = eager_tensor->t.tensor_data().data();
+  } else {
+    REQUIRE_HANDLE(context, TFE_Context, context_handle, void());
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    TF_Tensor* mirror = HostMirror(eager_tensor, context, status.get());
+    CHECK_STATUS(env, status.get(), void());
+    data = TF_TensorData(mirror);
+  }
+  const jsize n = static_cast<jsize>(num_elements);
+  if (array_dtype == dtype) {
+    SetArrayRegion(env, java_array, array_dtype, offset, n, data);
+  } else {
+    void* elements = env->GetPrimitiveArrayCritical(java_array, nullptr);
+    char* array_data = static_cast<char*>(elements) + static_cast<size_t>(offset) * TF_DataTypeSize(array_dtype);
+    ConvertElements(dtype, data, array_dtype, array_data, num_elements);
+    env->ReleasePrimitiveArrayCritical(java_array, elements, 0);
+  }
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerTensorProtoSize(
+    JNIEnv* env, jobject object, jlong handle, jlong context_handle) {
+  REQUIRE_TENSOR_HANDLE(eager_tensor, handle, 0);
+  TFE_Context* context = reinterpret_cast<TFE_Context*>(context_handle);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::unique_ptr<TF_Tensor, decltype(&TF_DeleteTensor)> owned(nullptr, TF_DeleteTensor);
+  const TF_Tensor* tensor = HostTensor(eager_tensor, context, &owned, status.get());
+  CHECK_STATUS(env, status.get(), 0);
+  tensorflow::uint64 size;
+  Set_TF_Status_from_Status(status.get(), tensorflow::TensorProtoSize(tensor, &size));
+  CHECK_STATUS(env, status.get(), 0);
+  return static_cast<jlong>(size);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerSerializeTensorProto(
+    JNIEnv* env, jobject object, jlong handle, jlong context_handle, jlong offset, jobject buffer) {
+  REQUIRE_TENSOR_HANDLE(eager_tensor, handle, 0);
+  char* data = static_cast<char*>(env->GetDirectBufferAddress(buffer));
+  if (data == nullptr || offset < 0) {
+    throw_exception(
+        env, tf_invalid_argument_exception, "TensorProtos can only be serialized into direct buffers, at non-negative "
+        "offsets.");
+    return 0;
+  }
+  TFE_Context* context = reinterpret_cast<TFE_Context*>(context_handle);
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::unique_ptr<TF_Tensor, decltype(&TF_DeleteTensor)> owned(nullptr, TF_DeleteTensor);
+  const TF_Tensor* tensor = HostTensor(eager_tensor, context, &owned, status.get());
+  CHECK_STATUS(env, status.get(), 0);
+  tensorflow::uint64 num_written;
+  Set_TF_Status_from_Status(status.get(), tensorflow::SerializeTensorProto(
+      tensor, static_cast<tensorflow::uint64>(offset), data,
+      static_cast<tensorflow::uint64>(env->GetDirectBufferCapacity(buffer)), &num_written));
+  CHECK_STATUS(env, status.get(), 0);
+  return static_cast<jlong>(num_written);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_parseTensorProto(
+    JNIEnv* env, jobject object, jobjectArray buffers) {
+  const jsize num_chunks = env->GetArrayLength(buffers);
+  std::vector<tensorflow::StringPiece> chunks;
+  chunks.reserve(static_cast<size_t>(num_chunks));
+  for (jsize i = 0; i < num_chunks; ++i) {
+    jobject buffer = env->GetObjectArrayElement(buffers, i);
+    const char* data = static_cast<const char*>(env->GetDirectBufferAddress(buffer));
+    const jlong capacity = env->GetDirectBufferCapacity(buffer);
+    env->DeleteLocalRef(buffer);
+    if (data == nullptr) {
+      throw_exception(env, tf_invalid_argument_exception, "TensorProtos can only be parsed from direct buffers.");
+      return 0;
+    }
+    chunks.emplace_back(data, static_cast<size_t>(capacity));
+  }
+  TF_Tensor* tensor = nullptr;
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  Set_TF_Status_from_Status(status.get(), tensorflow::ParseTensorProto(chunks, &tensor));
+  CHECK_STATUS(env, status.get(), 0);
+  return TrackedTensorHandle(tensor);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerPack(
+    JNIEnv* env, jobject object, jlongArray handles) {
+  const jsize num_parts = env->GetArrayLength(handles);
+  if (num_parts == 0) {
+    throw_exception(env, tf_invalid_argument_exception, "At least one tensor must be provided for packing.");
+    return 0;
+  }
+  std::unique_ptr<TFE_TensorHandle*[]> eager_tensors(new TFE_TensorHandle*[num_parts]);
+  REQUIRE_HANDLES(handles, eager_tensors.get(), num_parts, 0);
+  std::vector<const void*> parts(static_cast<size_t>(num_parts));
+  for (jsize i = 0; i < num_parts; ++i) {
+    if (!await_tensor_handle(env, eager_tensors[i])) return 0;
+    const tensorflow::Tensor& t = eager_tensors[i]->t;
+    // Only tensors whose storage can be read in place are packed natively. The caller falls back to a pack op for the
+    // rest (e.g., for tensors placed on GPUs or for string tensors).
+    if (eager_tensors[i]->d != nullptr || !tensorflow::DataTypeCanUseMemcpy(t.dtype())) return 0;
+    const tensorflow::Tensor& first = eager_tensors[0]->t;
+    if (t.dtype() != first.dtype() || t.shape() != first.shape()) {
+      throw_exception(
+          env, tf_invalid_argument_exception,
+          "All packed tensors must have the same data type and shape, but tensor %d has shape %s, while tensor 0 has "
+          "shape %s.", i, t.shape().DebugString().c_str(), first.shape().DebugString().c_str());
+      return 0;
+    }
+    parts[i] = t.tensor_data().data();
+  }
+  const tensorflow::Tensor& first = eager_tensors[0]->t;
+  std::vector<int64_t> dims(static_cast<size_t>(first.dims()));
+  for (int i = 0; i < first.dims(); ++i)
+    dims[i] = static_cast<int64_t>(first.dim_size(i));
+  return TrackedTensorHandle(
+      PackTensor(static_cast<TF_DataType>(first.dtype()), dims, first.TotalBytes(), parts));
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerSliceView(
+    JNIEnv* env, jobject object, jlong handle, jlong start, jlong end, jboolean shrink) {
+  REQUIRE_TENSOR_HANDLE(eager_tensor, handle, 0);
+  const tensorflow::Tensor& t = eager_tensor->t;
+  if (t.dims() == 0 || start < 0 || start > end || end > t.dim_size(0) || (shrink && end - start != 1)) {
+    throw_exception(
+        env, jvm_index_out_of_bounds_exception, "Invalid leading axis slice [%lld, %lld) for a tensor with shape %s.",
+        static_cast<long long>(start), static_cast<long long>(end), t.shape().DebugString().c_str());
+    return 0;
+  }
+  // Slices along the leading axis are contiguous in memory and so they can share the (reference-counted) buffer of
+  // the sliced tensor. Kernels require tensor buffers to be aligned though and so misaligned views are not created.
+  tensorflow::Tensor slice = t.Slice(start, end);
+  if (!slice.IsAligned()) return 0;
+  if (shrink) {
+    tensorflow::TensorShape shape = slice.shape();
+    shape.RemoveDim(0);
+    tensorflow::Tensor shrunk;
+    if (!shrunk.CopyFrom(slice, shape)) return 0;
+    slice = shrunk;
+  }
+  return reinterpret_cast<jlong>(new TFE_TensorHandle(slice, eager_tensor->d));
 }
 
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerCopyToDevice(
     JNIEnv* env,  jobject object,  jlong tensor_handle, jlong context_handle, jstring device) {
-  REQUIRE_HANDLE(tensor, TFE_TensorHandle, tensor_handle, 0);
+  REQUIRE_TENSOR_HANDLE(tensor, tensor_handle, 0);
   REQUIRE_HANDLE(context, TFE_Context, context_handle, 0);
   const char* c_device = env->GetStringUTFChars(device, nullptr);
+  tensorflow::AsyncEagerExecutor* executor = tensorflow::AsyncEagerExecutor::ForContext(context);
+  const std::string device_name = executor == nullptr ? "" : executor->FullDeviceName(c_device);
+  if (!device_name.empty()) {
+    // The copy is enqueued and its output handle, which already has the data type and shape of the copied tensor but
+    // no storage, is returned right away. The source handle is duplicated, so that it can be deleted in the meantime.
+    auto source = std::make_shared<TFE_TensorHandle>(tensor->t, tensor->d);
+    env->ReleaseStringUTFChars(device, c_device);
+    TFE_TensorHandle* output = new TFE_TensorHandle(
+      tensorflow::TensorCApi::MakeTensor(
+        static_cast<TF_DataType>(tensor->t.dtype()), tensor->t.shape(), nullptr), nullptr);
+    executor->Enqueue(output, device_name, [source, output, context, device_name]() {
+      std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+      TFE_TensorHandle* copy = TFE_TensorHandleCopyToDevice(source.get(), context, device_name.c_str(), status.get());
+      if (TF_GetCode(status.get()) != TF_OK)
+        return tensorflow::Status(static_cast<tensorflow::error::Code>(TF_GetCode(status.get())), TF_Message(status.get()));
+      output->t = copy->t;
+      output->d = copy->d;
+      TFE_DeleteTensorHandle(copy);
+      return tensorflow::Status::OK();
+    });
+    return reinterpret_cast<jlong>(output);
+  }
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
   TFE_TensorHandle* eager_tensor = TFE_TensorHandleCopyToDevice(tensor, context, c_device, status.get());
   env->ReleaseStringUTFChars(device, c_device);
@@ -264,3 +1292,49 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerSetOp
   env->ReleaseStringUTFChars(device, c_device);
   CHECK_STATUS(env, status.get(), void());
 }
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAddFunction(
+    JNIEnv* env, jobject object, jlong context_handle, jlong function_handle) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, void());
+  REQUIRE_HANDLE(function, TF_Function, function_handle, void());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> function_def(TF_NewBuffer(), TF_DeleteBuffer);
+  TF_FunctionToFunctionDef(function, function_def.get(), status.get());
+  CHECK_STATUS(env, status.get(), void());
+  TFE_ContextAddFunctionDef(
+      context, static_cast<const char*>(function_def->data), function_def->length, status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerExecuteFunction(
+    JNIEnv* env, jobject object, jlong context_handle, jstring function_name, jlongArray input_handles,
+    jint num_outputs) {
+  REQUIRE_HANDLE(context, TFE_Context, context_handle, nullptr);
+  TF_Status* status = thread_local_status();
+
+  const char* c_function_name = env->GetStringUTFChars(function_name, nullptr);
+  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(TFE_NewOp(context, c_function_name, status), TFE_DeleteOp);
+  env->ReleaseStringUTFChars(function_name, c_function_name);
+  CHECK_STATUS(env, status, nullptr);
+
+  const int num_inputs = env->GetArrayLength(input_handles);
+  std::vector<TFE_TensorHandle*> inputs(static_cast<size_t>(num_inputs));
+  REQUIRE_HANDLES(input_handles, inputs.data(), num_inputs, nullptr);
+  for (TFE_TensorHandle* input : inputs) {
+    if (!await_tensor_handle(env, input)) return nullptr;
+    TFE_OpAddInput(op.get(), input, status);
+    CHECK_STATUS(env, status, nullptr);
+  }
+
+  std::vector<TFE_TensorHandle*> outputs(static_cast<size_t>(num_outputs));
+  int actual_num_outputs = num_outputs;
+  execute_eager_op(op.get(), "<function>", outputs.data(), &actual_num_outputs, status);
+  CHECK_STATUS(env, status, nullptr);
+
+  jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(actual_num_outputs));
+  jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
+  for (int i = 0; i < actual_num_outputs; ++i)
+    output_elems[i] = reinterpret_cast<jlong>(outputs[i]);
+  env->ReleaseLongArrayElements(outputs_array, output_elems, 0);
+  return outputs_array;
+}
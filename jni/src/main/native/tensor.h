@@ -10,26 +10,50 @@ extern "C" {
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
  * Method:    allocate
- * Signature: (I[JJ)J
+ * Signature: (I[JJZ)J
  */
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_allocate
-  (JNIEnv *, jobject, jint, jlongArray, jlong);
+  (JNIEnv *, jobject, jint, jlongArray, jlong, jboolean);
 
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
  * Method:    fromBuffer
- * Signature: (I[JJL)J
+ * Signature: (I[JJLjava/nio/ByteBuffer;Z)J
  */
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromBuffer
+  (JNIEnv *, jobject, jint, jlongArray, jlong, jobject, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    fromBufferNoCopy
+ * Signature: (I[JJLjava/nio/ByteBuffer;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromBufferNoCopy
   (JNIEnv *, jobject, jint, jlongArray, jlong, jobject);
 
-///*
-// * Class:     org_platanios_tensorflow_jni_Tensor__
-// * Method:    fromBuffer
-// * Signature: (LI[JJ)J
-// */
-//JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromBuffer
-//  (JNIEnv *, jobject, jobject, jint, jlongArray, jlong);
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    fromArray
+ * Signature: (Ljava/lang/Object;III[J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_fromArray
+  (JNIEnv *, jobject, jobject, jint, jint, jint, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    ingestUInt8
+ * Signature: (Ljava/nio/ByteBuffer;I[J[F[F)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_ingestUInt8
+  (JNIEnv *, jobject, jobject, jint, jlongArray, jfloatArray, jfloatArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    packBuffers
+ * Signature: (I[JJ[Ljava/nio/ByteBuffer;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_packBuffers
+  (JNIEnv *, jobject, jint, jlongArray, jlong, jobjectArray);
 
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
@@ -63,6 +87,38 @@ JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_buffer
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_delete
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    deleteDeferred
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_deleteDeferred
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    flushDeferredDeletes
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_flushDeferredDeletes
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    setPoolCapacity
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_setPoolCapacity
+  (JNIEnv *, jobject, jlong, jboolean);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    poolStatistics
+ * Signature: (Z)Lorg/platanios/tensorflow/jni/TensorPoolStatistics;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_poolStatistics
+  (JNIEnv *, jobject, jboolean);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
  * Method:    getEncodedStringSize
@@ -87,13 +143,37 @@ JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_setStringB
 JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_getStringBytes
   (JNIEnv *, jobject, jobject);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    encodeStrings
+ * Signature: ([J[B[J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_encodeStrings
+  (JNIEnv *, jobject, jlongArray, jbyteArray, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    decodeStrings
+ * Signature: (J[J)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_decodeStrings
+  (JNIEnv *, jobject, jlong, jlongArray);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
  * Method:    eagerAllocateContext
- * Signature: ()J
+ * Signature: ([BZ[II)J
  */
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocateContext
-  (JNIEnv *, jobject);
+  (JNIEnv *, jobject, jbyteArray, jboolean, jintArray, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerAllocateSharedContext
+ * Signature: ([BZ[II)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocateSharedContext
+  (JNIEnv *, jobject, jbyteArray, jboolean, jintArray, jint);
 
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
@@ -103,6 +183,30 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllo
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDeleteContext
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerAllocatorStatistics
+ * Signature: (J)Lorg/platanios/tensorflow/jni/AllocatorStatistics;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAllocatorStatistics
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerSync
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerSync
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerAwait
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAwait
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
  * Method:    eagerAllocate
@@ -143,6 +247,14 @@ JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDe
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDelete
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerDeleteDeferred
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDeleteDeferred
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
  * Method:    eagerResolve
@@ -151,6 +263,70 @@ JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerDelet
 JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerResolve
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerHostBuffer
+ * Signature: (J)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerHostBuffer
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerHostMirror
+ * Signature: (JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerHostMirror
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerCopyToArray
+ * Signature: (JJLjava/lang/Object;II)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerCopyToArray
+  (JNIEnv *, jobject, jlong, jlong, jobject, jint, jint);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerTensorProtoSize
+ * Signature: (JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerTensorProtoSize
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerSerializeTensorProto
+ * Signature: (JJJLjava/nio/ByteBuffer;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerSerializeTensorProto
+  (JNIEnv *, jobject, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    parseTensorProto
+ * Signature: ([Ljava/nio/ByteBuffer;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_parseTensorProto
+  (JNIEnv *, jobject, jobjectArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerPack
+ * Signature: ([J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerPack
+  (JNIEnv *, jobject, jlongArray);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerSliceView
+ * Signature: (JJJZ)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerSliceView
+  (JNIEnv *, jobject, jlong, jlong, jlong, jboolean);
+
 /*
  * Class:     org_platanios_tensorflow_jni_Tensor__
  * Method:    eagerCopyToDevice
@@ -167,6 +343,22 @@ JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerCopy
 JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerSetOpDevice
   (JNIEnv *, jobject, jlong, jlong, jstring);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerAddFunction
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerAddFunction
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_Tensor__
+ * Method:    eagerExecuteFunction
+ * Signature: (JLjava/lang/String;[JI)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_platanios_tensorflow_jni_Tensor_00024_eagerExecuteFunction
+  (JNIEnv *, jobject, jlong, jstring, jlongArray, jint);
+
 #ifdef __cplusplus
 }
 #endif
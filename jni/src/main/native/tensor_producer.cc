@@ -0,0 +1,87 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "tensor_producer.h"
+#include "exception.h"
+#include "utilities.h"
+#include "ops/tensor_producer.h"
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/c_api_internal.h"
+#include "tensorflow/c/c_eager_api.h"
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_allocate(
+    JNIEnv* env, jobject object, jlong capacity) {
+  if (capacity <= 0) {
+    throw_exception(env, tf_invalid_argument_exception, "The tensor producer capacity must be positive.");
+    return 0;
+  }
+  return reinterpret_cast<jlong>(new tensorflow::TensorProducer(static_cast<tensorflow::int64>(capacity)));
+}
+
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_pointer(
+    JNIEnv* env, jobject object, jlong producer_handle) {
+  REQUIRE_HANDLE(producer, tensorflow::TensorProducer, producer_handle, nullptr);
+  return env->NewStringUTF(pointerToString(producer).c_str());
+}
+
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_push(
+    JNIEnv* env, jobject object, jlong producer_handle, jlongArray tensor_handles, jlong timeout_micros) {
+  REQUIRE_HANDLE(producer, tensorflow::TensorProducer, producer_handle, JNI_FALSE);
+  const jsize num_tensors = env->GetArrayLength(tensor_handles);
+  std::unique_ptr<jlong[]> handles(new jlong[num_tensors]);
+  env->GetLongArrayRegion(tensor_handles, 0, num_tensors, handles.get());
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  // The pushed tensors share the buffers of the eager tensors, and so no data is copied.
+  std::vector<tensorflow::Tensor> element(static_cast<size_t>(num_tensors));
+  for (jsize i = 0; i < num_tensors; ++i) {
+    TFE_TensorHandle* tensor_handle = reinterpret_cast<TFE_TensorHandle*>(handles[i]);
+    if (tensor_handle == nullptr) {
+      throw_exception(env, jvm_null_pointer_exception, "Tensor handle %d is null.", i);
+      return JNI_FALSE;
+    }
+    if (!await_tensor_handle(env, tensor_handle)) return JNI_FALSE;
+    TF_Tensor* tensor = TFE_TensorHandleResolve(tensor_handle, status.get());
+    CHECK_STATUS(env, status.get(), JNI_FALSE);
+    status->status = tensorflow::TF_TensorToTensor(tensor, &element[i]);
+    TF_DeleteTensor(tensor);
+    CHECK_STATUS(env, status.get(), JNI_FALSE);
+  }
+  const bool pushed = producer->Push(
+      std::move(element), static_cast<tensorflow::int64>(timeout_micros), &status->status);
+  CHECK_STATUS(env, status.get(), JNI_FALSE);
+  return static_cast<jboolean>(pushed);
+}
+
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_size(
+    JNIEnv* env, jobject object, jlong producer_handle) {
+  REQUIRE_HANDLE(producer, tensorflow::TensorProducer, producer_handle, 0);
+  return static_cast<jlong>(producer->size());
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_close(
+    JNIEnv* env, jobject object, jlong producer_handle) {
+  REQUIRE_HANDLE(producer, tensorflow::TensorProducer, producer_handle, void());
+  producer->Close();
+}
+
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_delete(
+    JNIEnv* env, jobject object, jlong producer_handle) {
+  REQUIRE_HANDLE(producer, tensorflow::TensorProducer, producer_handle, void());
+  delete producer;
+}
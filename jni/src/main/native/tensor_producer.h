@@ -0,0 +1,61 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_platanios_tensorflow_jni_TensorProducer__ */
+
+#ifndef _Included_org_platanios_tensorflow_jni_TensorProducer__
+#define _Included_org_platanios_tensorflow_jni_TensorProducer__
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorProducer__
+ * Method:    allocate
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_allocate
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorProducer__
+ * Method:    pointer
+ * Signature: (J)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_pointer
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorProducer__
+ * Method:    push
+ * Signature: (J[JJ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_push
+  (JNIEnv *, jobject, jlong, jlongArray, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorProducer__
+ * Method:    size
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_size
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorProducer__
+ * Method:    close
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_close
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorProducer__
+ * Method:    delete
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_TensorProducer_00024_delete
+  (JNIEnv *, jobject, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
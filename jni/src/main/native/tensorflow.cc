@@ -14,14 +14,18 @@
  */
 
 #include "exception.h"
+#include "jvm_cache.h"
 #include "tensorflow.h"
 #include "utilities.h"
 
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include "tensorflow/c/c_api.h"
+#include "tensorflow/c/native_executor.h"
+#include "tensorflow/c/op_registry_index.h"
 #include "tensorflow/c/python_api.h"
 
 namespace {
@@ -47,6 +51,14 @@ TF_Graph* require_graph_handle(JNIEnv *env, jlong handle) {
 }
 }
 
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* jvm, void* reserved) {
+  JNIEnv* env;
+  if (jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK) return JNI_ERR;
+  if (!cache_jvm_exception_classes(env) || !initialize_jvm_cache(env)) return JNI_ERR;
+  tensorflow::NativeExecutor::SetJavaVM(jvm);
+  return JNI_VERSION_1_6;
+}
+
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_jvmPointer(
     JNIEnv* env, jobject object) {
   JavaVM* jvm;
@@ -57,19 +69,40 @@ JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_jvm
 
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryPointer(
     JNIEnv* env, jobject object) {
-  jclass registry = env->FindClass("org/platanios/tensorflow/jni/ScalaCallbacksRegistry");
+  jclass registry = jvm_cache().callbacks_registry_class;
   std::string pointer = pointerToString<jobject>(env->NewGlobalRef(reinterpret_cast<jobject>(registry)));
   return env->NewStringUTF(pointer.c_str());
 }
 
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryCallMethodPointer(
     JNIEnv* env, jobject object) {
-  jclass registry = env->FindClass("org/platanios/tensorflow/jni/ScalaCallbacksRegistry");
-  jmethodID registry_call = env->GetStaticMethodID(registry, "call", "(I[J)[J");
+  jmethodID registry_call = jvm_cache().callbacks_registry_call;
   std::string pointer = pointerToString<jobject>(env->NewGlobalRef(reinterpret_cast<jobject>(registry_call)));
   return env->NewStringUTF(pointer.c_str());
 }
 
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryCallAsyncMethodPointer(
+    JNIEnv* env, jobject object) {
+  jmethodID registry_call_async = jvm_cache().callbacks_registry_call_async;
+  std::string pointer = pointerToString<jmethodID>(registry_call_async);
+  return env->NewStringUTF(pointer.c_str());
+}
+
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryCallBatchMethodPointer(
+    JNIEnv* env, jobject object) {
+  jmethodID registry_call_batch = jvm_cache().callbacks_registry_call_batch;
+  std::string pointer = pointerToString<jmethodID>(registry_call_batch);
+  return env->NewStringUTF(pointer.c_str());
+}
+
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryCallBuffersMethodPointer(
+    JNIEnv* env, jobject object) {
+  // Method IDs are not objects and remain valid for as long as their class is loaded.
+  jmethodID registry_call_buffers = jvm_cache().callbacks_registry_call_buffers;
+  std::string pointer = pointerToString<jmethodID>(registry_call_buffers);
+  return env->NewStringUTF(pointer.c_str());
+}
+
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_version(
   JNIEnv* env, jobject object) {
   return env->NewStringUTF(TF_Version());
@@ -86,6 +119,8 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_
   std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
   TF_Library* library = TF_LoadLibrary(c_library_filename, status.get());
   CHECK_STATUS(env, status.get(), nullptr);
+  // The library may have registered new ops and so, the cached op list snapshot needs to be recomputed.
+  tensorflow::InvalidateOpListSnapshot();
   TF_Buffer op_list_buffer = TF_GetOpList(library);
   jbyteArray op_list = env->NewByteArray(op_list_buffer.length);
   jbyte* op_list_elems = env->GetByteArrayElements(op_list, nullptr);
@@ -114,6 +149,23 @@ JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_update
   return 0;
 }
 
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_updateInputs(
+  JNIEnv* env, jobject object, jlong graph_handle, jlongArray input_op_handles, jintArray input_indices,
+  jlongArray output_op_handles, jintArray output_indices) {
+  REQUIRE_HANDLE(graph, TF_Graph, graph_handle, void());
+  const int num_edges = env->GetArrayLength(input_op_handles);
+  std::vector<TF_Output> input_outputs(static_cast<size_t>(num_edges));
+  REQUIRE_OUTPUTS(input_op_handles, input_indices, input_outputs.data(), num_edges, void());
+  std::vector<TF_Output> outputs(static_cast<size_t>(num_edges));
+  REQUIRE_OUTPUTS(output_op_handles, output_indices, outputs.data(), num_edges, void());
+  std::vector<TF_Input> inputs(static_cast<size_t>(num_edges));
+  for (int i = 0; i < num_edges; ++i)
+    inputs[i] = TF_Input{input_outputs[i].oper, input_outputs[i].index};
+  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+  tensorflow::UpdateEdges(graph, outputs.data(), inputs.data(), num_edges, status.get());
+  CHECK_STATUS(env, status.get(), void());
+}
+
 JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_addControlInput(
   JNIEnv* env, jobject object, jlong graph_handle, jlong op_handle, jlong input_op_handle) {
   TF_Graph* graph = require_graph_handle(env, graph_handle);
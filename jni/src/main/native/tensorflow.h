@@ -31,6 +31,30 @@ JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_cal
 JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryCallMethodPointer
   (JNIEnv *, jobject);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorFlow__
+ * Method:    callbackRegistryCallAsyncMethodPointer
+ * Signature: ()Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryCallAsyncMethodPointer
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorFlow__
+ * Method:    callbackRegistryCallBatchMethodPointer
+ * Signature: ()Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryCallBatchMethodPointer
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorFlow__
+ * Method:    callbackRegistryCallBuffersMethodPointer
+ * Signature: ()Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_callbackRegistryCallBuffersMethodPointer
+  (JNIEnv *, jobject);
+
 /*
  * Class:     org_platanios_tensorflow_jni_TensorFlow__
  * Method:    version
@@ -63,6 +87,14 @@ JNIEXPORT jbyteArray JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_
 JNIEXPORT jint JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_updateInput
   (JNIEnv *, jobject, jlong, jlong, jint, jlong, jint);
 
+/*
+ * Class:     org_platanios_tensorflow_jni_TensorFlow__
+ * Method:    updateInputs
+ * Signature: (J[J[I[J[I)V
+ */
+JNIEXPORT void JNICALL Java_org_platanios_tensorflow_jni_TensorFlow_00024_updateInputs
+  (JNIEnv *, jobject, jlong, jlongArray, jintArray, jlongArray, jintArray);
+
 /*
  * Class:     org_platanios_tensorflow_jni_TensorFlow__
  * Method:    addControlInput
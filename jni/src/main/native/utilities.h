@@ -16,9 +16,21 @@
 #ifndef TENSORFLOW_JNI_UTILITIES_H_
 #define TENSORFLOW_JNI_UTILITIES_H_
 
+#include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "exception.h"
+#include "jvm_cache.h"
+#include "tensorflow/c/allocator_statistics.h"
+#include "tensorflow/c/async_eager_executor.h"
+#include "tensorflow/c/c_api.h"
+#include "tensorflow/c/metrics_exporter.h"
+#include "tensorflow/c/native_event_recorder.h"
+#include "tensorflow/c/thread_affinity.h"
+#include "tensorflow/core/lib/monitoring/collection_registry.h"
+#include "tensorflow/core/lib/strings/strcat.h"
 
 namespace {
   template <typename T>
@@ -48,6 +60,47 @@ namespace {
     return reinterpret_cast<T*>(handle);
   }
   
+  // Returns a vector containing copies of the strings stored in the provided Java string array.
+  inline std::vector<std::string> to_string_vector(JNIEnv* env, jobjectArray array) {
+    const jsize length = env->GetArrayLength(array);
+    std::vector<std::string> strings;
+    strings.reserve(static_cast<size_t>(length));
+    for (jsize i = 0; i < length; ++i) {
+      jstring string = static_cast<jstring>(env->GetObjectArrayElement(array, i));
+      const char* c_string = env->GetStringUTFChars(string, nullptr);
+      strings.emplace_back(c_string);
+      env->ReleaseStringUTFChars(string, c_string);
+      env->DeleteLocalRef(string);
+    }
+    return strings;
+  }
+
+  // Maximum number of elements that the array helpers below copy through stack buffers. Larger arrays are copied
+  // through heap buffers.
+  constexpr jsize kMaxStackArrayLength = 64;
+
+  // Buffer holding a copy of (part of) a Java primitive array, that lives on the stack for small arrays. The elements
+  // are copied using "Get<Type>ArrayRegion", which never pins or copies the whole array and does not need to be
+  // released, so callers can return early (e.g., after throwing an exception) without leaking.
+  template<class T>
+  class ArrayBuffer {
+   public:
+    explicit ArrayBuffer(jsize length) : data_(stack_data_) {
+      if (length > kMaxStackArrayLength) {
+        heap_data_.reset(new T[length]);
+        data_ = heap_data_.get();
+      }
+    }
+
+    T* data() { return data_; }
+    T& operator[](jsize i) { return data_[i]; }
+
+   private:
+    T stack_data_[kMaxStackArrayLength];
+    std::unique_ptr<T[]> heap_data_;
+    T* data_;
+  };
+
   template<class T>
   inline void require_handles(JNIEnv* env, jlongArray src_array, T** dst_array, jint src_array_length) {
     jint len = env->GetArrayLength(src_array);
@@ -57,18 +110,17 @@ namespace {
       throw_exception(env, tf_invalid_argument_exception, msg.str().c_str());
       return;
     }
-    jlong* src_start = env->GetLongArrayElements(src_array, nullptr);
-    jlong* src = src_start;
-    for (int i = 0; i < src_array_length; ++i, ++src, ++dst_array) {
-      if (*src == 0) {
+    ArrayBuffer<jlong> src(src_array_length);
+    env->GetLongArrayRegion(src_array, 0, src_array_length, src.data());
+    for (int i = 0; i < src_array_length; ++i) {
+      if (src[i] == 0) {
         std::stringstream msg;
         msg << "Invalid handle (# " << i << " of " << src_array_length << ").";
         throw_exception(env, tf_invalid_argument_exception, msg.str().c_str());
         return;
       }
-      *dst_array = reinterpret_cast<T*>(*src);
+      dst_array[i] = reinterpret_cast<T*>(src[i]);
     }
-    env->ReleaseLongArrayElements(src_array, src_start, JNI_ABORT);
   }
 
   inline void require_outputs(
@@ -87,8 +139,10 @@ namespace {
       throw_exception(env, tf_invalid_argument_exception, msg.str().c_str());
       return;
     }
-    jlong* op_handles = env->GetLongArrayElements(src_ops, nullptr);
-    jint* indices = env->GetIntArrayElements(src_indices, nullptr);
+    ArrayBuffer<jlong> op_handles(src_ops_length);
+    ArrayBuffer<jint> indices(src_ops_length);
+    env->GetLongArrayRegion(src_ops, 0, src_ops_length, op_handles.data());
+    env->GetIntArrayRegion(src_indices, 0, src_ops_length, indices.data());
     for (int i = 0; i < src_ops_length; ++i) {
       if (op_handles[i] == 0) {
         std::stringstream msg;
@@ -98,8 +152,196 @@ namespace {
       }
       dst_array[i] = TF_Output{reinterpret_cast<TF_Operation*>(op_handles[i]), static_cast<int>(indices[i])};
     }
-    env->ReleaseIntArrayElements(src_indices, indices, JNI_ABORT);
-    env->ReleaseLongArrayElements(src_ops, op_handles, JNI_ABORT);
+  }
+
+  // Stores the provided native object pointers as handles in a Java long array, which must have at least
+  // "src_array_length" elements.
+  template<class T>
+  inline void set_handles(JNIEnv* env, T* const* src_array, jlongArray dst_array, jint src_array_length) {
+    ArrayBuffer<jlong> dst(src_array_length);
+    for (int i = 0; i < src_array_length; ++i)
+      dst[i] = reinterpret_cast<jlong>(src_array[i]);
+    env->SetLongArrayRegion(dst_array, 0, src_array_length, dst.data());
+  }
+
+  // Detaches the current thread from the JVM when it exits, if it was attached by "attach_current_thread".
+  struct JVMThreadDetacher {
+    JavaVM* jvm = nullptr;
+    ~JVMThreadDetacher() {
+      if (jvm != nullptr)
+        jvm->DetachCurrentThread();
+    }
+  };
+
+  // Returns a JNI environment for the current thread, attaching the thread to the JVM as a daemon thread, if necessary.
+  // Threads attached by this function stay attached until they exit, so that native worker threads that call into the
+  // JVM repeatedly only pay the cost of attaching once. Returns a null pointer if the thread cannot be attached.
+  inline JNIEnv* attach_current_thread(JavaVM* jvm) {
+    JNIEnv* env;
+    if (jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) == JNI_OK) return env;
+    if (jvm->AttachCurrentThreadAsDaemon(reinterpret_cast<void**>(&env), nullptr) != JNI_OK) return nullptr;
+    static thread_local JVMThreadDetacher detacher;
+    detacher.jvm = jvm;
+    return env;
+  }
+
+  // Returns a status object that is owned by the current thread, after clearing it. This avoids allocating a new status
+  // object for every native call in functions that are invoked very frequently (e.g., eager op executions). The
+  // returned status must not be used after the next call to this function on the same thread.
+  inline TF_Status* thread_local_status() {
+    static thread_local std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    TF_SetStatus(status.get(), TF_OK, "");
+    return status.get();
+  }
+
+  // Executes the provided eager op, recording its dispatch in the metrics of the JNI bindings and, if native event
+  // recording is enabled, as a native event named "op_name" (which must have static storage duration).
+  inline void execute_eager_op(
+      TFE_Op* op, const char* op_name, TFE_TensorHandle** retvals, int* num_retvals, TF_Status* status) {
+    tensorflow::jni_metrics::RecordEagerDispatch();
+    tensorflow::ScopedNativeEvent event(tensorflow::kNativeEventEagerExecute, op_name);
+    TFE_Execute(op, retvals, num_retvals, status);
+    if (event.active()) event.set_num_outputs(static_cast<tensorflow::int32>(*num_retvals));
+  }
+
+  // Waits for the provided eager tensor handle, if it is being filled in asynchronously, and returns false, with an
+  // exception pending, if the operation that filled it in failed.
+  inline bool await_tensor_handle(JNIEnv* env, TFE_TensorHandle* handle) {
+    const tensorflow::Status s = tensorflow::AwaitTensorHandle(handle);
+    if (s.ok()) return true;
+    TF_Status* status = thread_local_status();
+    TF_SetStatus(status, static_cast<TF_Code>(s.code()), s.error_message().c_str());
+    throw_exception_if_not_ok(env, status);
+    return false;
+  }
+
+  // Converts the provided tensors to eager tensor handles, which share their buffers, and deletes them. If the
+  // conversion fails, the created handles are deleted and an exception is thrown.
+  inline jlongArray tensors_to_tensor_handles(JNIEnv* env, const std::vector<TF_Tensor*>& tensors) {
+    std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+    std::vector<jlong> tensor_handles(tensors.size(), 0);
+    for (size_t i = 0; i < tensors.size(); ++i) {
+      if (TF_GetCode(status.get()) == TF_OK)
+        tensor_handles[i] = reinterpret_cast<jlong>(TFE_NewTensorHandle(tensors[i], status.get()));
+      TF_DeleteTensor(tensors[i]);
+    }
+    if (TF_GetCode(status.get()) != TF_OK) {
+      for (jlong tensor_handle : tensor_handles)
+        if (tensor_handle != 0) TFE_DeleteTensorHandle(reinterpret_cast<TFE_TensorHandle*>(tensor_handle));
+      CHECK_STATUS(env, status.get(), nullptr);
+    }
+    jlongArray tensor_handles_array = env->NewLongArray(static_cast<jsize>(tensor_handles.size()));
+    env->SetLongArrayRegion(tensor_handles_array, 0, static_cast<jsize>(tensor_handles.size()), tensor_handles.data());
+    return tensor_handles_array;
+  }
+
+  // Resolves the CPU set made up of the CPUs in "cpus" (which may be null) and the CPUs of NUMA node "numa_node" (if
+  // non-negative), and returns false, with an exception pending, if that fails.
+  inline bool resolve_cpu_set(JNIEnv* env, jintArray cpus, jint numa_node, std::vector<int>* cpu_set) {
+    std::vector<int> cpu_indices;
+    if (cpus != nullptr) {
+      cpu_indices.resize(static_cast<size_t>(env->GetArrayLength(cpus)));
+      env->GetIntArrayRegion(cpus, 0, env->GetArrayLength(cpus), reinterpret_cast<jint*>(cpu_indices.data()));
+    }
+    tensorflow::Status s = tensorflow::ResolveCpuSet(cpu_indices, static_cast<int>(numa_node), cpu_set);
+    if (s.ok()) return true;
+    TF_Status* status = thread_local_status();
+    TF_SetStatus(status, static_cast<TF_Code>(s.code()), s.error_message().c_str());
+    throw_exception_if_not_ok(env, status);
+    return false;
+  }
+
+  // Converts the provided allocator statistics to an "AllocatorStatistics" Java object, packing the statistics of each
+  // allocator in consecutive elements of a single array.
+  inline jobject allocator_statistics_to_java(
+      JNIEnv* env, const std::vector<tensorflow::DeviceAllocatorStats>& stats) {
+    const JVMCache& cache = jvm_cache();
+    const jsize num_allocators = static_cast<jsize>(stats.size());
+    jobjectArray devices = env->NewObjectArray(num_allocators, cache.string_class, nullptr);
+    jobjectArray allocators = env->NewObjectArray(num_allocators, cache.string_class, nullptr);
+    std::vector<jlong> values;
+    values.reserve(stats.size() * 5);
+    for (jsize i = 0; i < num_allocators; ++i) {
+      jstring device = env->NewStringUTF(stats[i].device.c_str());
+      env->SetObjectArrayElement(devices, i, device);
+      env->DeleteLocalRef(device);
+      jstring allocator = env->NewStringUTF(stats[i].allocator.c_str());
+      env->SetObjectArrayElement(allocators, i, allocator);
+      env->DeleteLocalRef(allocator);
+      values.push_back(static_cast<jlong>(stats[i].stats.num_allocs));
+      values.push_back(static_cast<jlong>(stats[i].stats.bytes_in_use));
+      values.push_back(static_cast<jlong>(stats[i].stats.max_bytes_in_use));
+      values.push_back(static_cast<jlong>(stats[i].stats.max_alloc_size));
+      values.push_back(static_cast<jlong>(stats[i].stats.bytes_limit));
+    }
+    jlongArray values_array = env->NewLongArray(static_cast<jsize>(values.size()));
+    env->SetLongArrayRegion(values_array, 0, static_cast<jsize>(values.size()), values.data());
+    return env->CallStaticObjectMethod(
+        cache.allocator_statistics_class, cache.allocator_statistics_apply, devices, allocators, values_array);
+  }
+
+  // Formats the labels of a metric point as a string of the form "name1=value1,name2=value2".
+  inline std::string format_metric_labels(const tensorflow::monitoring::Point& point) {
+    std::string labels;
+    for (const auto& label : point.labels) {
+      if (!labels.empty()) labels += ",";
+      tensorflow::strings::StrAppend(&labels, label.name, "=", label.value);
+    }
+    return labels;
+  }
+
+  // Collects the points of the metrics in the process-wide monitoring registry whose names start with "prefix" and
+  // converts them to a "CollectedMetrics" Java object.
+  inline jobject collected_metrics_to_java(JNIEnv* env, const std::string& prefix) {
+    tensorflow::monitoring::CollectionRegistry::CollectMetricsOptions options;
+    options.collect_metric_descriptors = false;
+    std::unique_ptr<tensorflow::monitoring::CollectedMetrics> metrics =
+        tensorflow::monitoring::CollectionRegistry::Default()->CollectMetrics(options);
+    std::vector<const tensorflow::monitoring::Point*> points;
+    std::vector<const std::string*> point_names;
+    for (const auto& point_set : metrics->point_set_map) {
+      if (point_set.first.compare(0, prefix.size(), prefix) != 0) continue;
+      for (const auto& point : point_set.second->points) {
+        points.push_back(point.get());
+        point_names.push_back(&point_set.first);
+      }
+    }
+
+    const JVMCache& cache = jvm_cache();
+    const jsize num_points = static_cast<jsize>(points.size());
+    jobjectArray names = env->NewObjectArray(num_points, cache.string_class, nullptr);
+    jobjectArray labels = env->NewObjectArray(num_points, cache.string_class, nullptr);
+    jobjectArray histograms = env->NewObjectArray(num_points, cache.byte_array_class, nullptr);
+    std::vector<jlong> values(points.size(), 0);
+    std::vector<jlong> timestamps(points.size(), 0);
+    std::string serialized;
+    for (jsize i = 0; i < num_points; ++i) {
+      const tensorflow::monitoring::Point* point = points[i];
+      jstring name = env->NewStringUTF(point_names[i]->c_str());
+      env->SetObjectArrayElement(names, i, name);
+      env->DeleteLocalRef(name);
+      jstring point_labels = env->NewStringUTF(format_metric_labels(*point).c_str());
+      env->SetObjectArrayElement(labels, i, point_labels);
+      env->DeleteLocalRef(point_labels);
+      if (point->value_type == tensorflow::monitoring::ValueType::kHistogram) {
+        point->histogram_value.SerializeToString(&serialized);
+        jbyteArray histogram = env->NewByteArray(static_cast<jsize>(serialized.size()));
+        env->SetByteArrayRegion(
+            histogram, 0, static_cast<jsize>(serialized.size()), reinterpret_cast<const jbyte*>(serialized.data()));
+        env->SetObjectArrayElement(histograms, i, histogram);
+        env->DeleteLocalRef(histogram);
+      } else {
+        values[i] = static_cast<jlong>(point->int64_value);
+      }
+      timestamps[i] = static_cast<jlong>(point->end_timestamp_millis);
+    }
+    jlongArray values_array = env->NewLongArray(num_points);
+    env->SetLongArrayRegion(values_array, 0, num_points, values.data());
+    jlongArray timestamps_array = env->NewLongArray(num_points);
+    env->SetLongArrayRegion(timestamps_array, 0, num_points, timestamps.data());
+    return env->CallStaticObjectMethod(
+        cache.collected_metrics_class, cache.collected_metrics_apply, names, labels, values_array, histograms,
+        timestamps_array);
   }
 }  // namespace
 
@@ -107,6 +349,12 @@ namespace {
   type* name = require_handle<type>(env, variable_name, #variable_name);   \
   if (name == nullptr) return null_return_value;
 
+// Same as "REQUIRE_HANDLE" for eager tensor handles whose values are about to be used (e.g., as op inputs), which also
+// waits for them if they are being filled in asynchronously.
+#define REQUIRE_TENSOR_HANDLE(name, variable_name, null_return_value)    \
+  REQUIRE_HANDLE(name, TFE_TensorHandle, variable_name, null_return_value) \
+  if (!await_tensor_handle(env, name)) return null_return_value;
+
 #define REQUIRE_HANDLES(src_array, dst_array, src_array_length, null_return_value)   \
   require_handles(env, src_array, dst_array, src_array_length);                      \
   if (env->ExceptionCheck()) return null_return_value;
@@ -0,0 +1,31 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Statistics of the native memory allocators used by a set of devices. Allocators shared by multiple devices are only
+  * reported once, for the first device that uses them.
+  *
+  * @param  deviceNames    Name of the device that each allocator was found through.
+  * @param  allocatorNames Name of each allocator.
+  * @param  statistics     Statistics of each allocator, packed in consecutive groups of
+  *                        [[AllocatorStatistics.NumValues]] elements: number of allocations, bytes in use, peak bytes in
+  *                        use, largest allocation size, and bytes limit (zero if unknown).
+  */
+case class AllocatorStatistics(deviceNames: Array[String], allocatorNames: Array[String], statistics: Array[Long])
+
+object AllocatorStatistics {
+  val NumValues: Int = 5
+}
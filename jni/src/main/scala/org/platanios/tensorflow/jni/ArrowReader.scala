@@ -0,0 +1,45 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Native readers for Arrow IPC files, which memory-map them and decode a projection of their columns directly into
+  * one tensor per column and record batch.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object ArrowReader {
+  TensorFlow.load()
+
+  /** Creates a reader for the file at `filename` which decodes the columns named `columns`, for the rows whose values in
+    * the columns named `predicateColumns` lie within the corresponding `[predicateMins, predicateMaxs]` ranges. */
+  @native def newArrowReader(
+      filename: String, columns: Array[String], predicateColumns: Array[String], predicateMins: Array[Double],
+      predicateMaxs: Array[Double]): Long
+
+  @native def arrowReaderNumRecordBatches(readerHandle: Long): Long
+
+  /** Returns the total number of rows in the file, before any predicates are applied. */
+  @native def arrowReaderNumRows(readerHandle: Long): Long
+
+  /** Returns the data types (i.e., `TF_DataType` values) of the projected columns. */
+  @native def arrowReaderDataTypes(readerHandle: Long): Array[Int]
+
+  /** Returns eager tensor handles for the projected columns of the rows of the `index`-th record batch that satisfy
+    * all predicates, or `null` if no rows satisfy them. */
+  @native def arrowReaderReadRecordBatch(readerHandle: Long, index: Long): Array[Long]
+
+  @native def deleteArrowReader(readerHandle: Long): Unit
+}
@@ -0,0 +1,41 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Native readers for delimiter-separated text files (e.g., CSV or TSV files), which parse a projection of the columns
+  * of those files directly into batch tensors.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object CSVReader {
+  TensorFlow.load()
+
+  /** Creates a reader for the file at `filename` which decodes the columns with indices `columns` into tensors with
+    * data types `dataTypes`. `defaults` contains the values used for empty fields of the projected columns, encoded as
+    * text, with `null` entries for required columns. It may also be `null` itself, if all columns are required. */
+  @native def newCSVReader(
+      filename: String, delimiter: Byte, useQuotes: Boolean, skipHeaderLines: Int, columns: Array[Int],
+      dataTypes: Array[Int], defaults: Array[String], blockSize: Int): Long
+
+  /** Returns eager tensor handles for the projected columns of the next batch of at most `batchSize` records, or
+    * `null` if the end of the file has been reached. */
+  @native def csvReaderNextBatch(readerHandle: Long, batchSize: Int): Array[Long]
+
+  /** Returns the number of lines consumed so far, including any header lines. */
+  @native def csvReaderLineNumber(readerHandle: Long): Long
+
+  @native def deleteCSVReader(readerHandle: Long): Unit
+}
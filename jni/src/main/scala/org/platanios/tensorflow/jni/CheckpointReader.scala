@@ -15,6 +15,8 @@
 
 package org.platanios.tensorflow.jni
 
+import java.nio.ByteBuffer
+
 /**
   * @author Emmanouil Antonios Platanios
   */
@@ -22,8 +24,40 @@ object CheckpointReader {
   TensorFlow.load()
 
   @native def newCheckpointReader(filePattern: String): Long
+
+  /** Returns the prefix of the base checkpoint of the V2 checkpoint with prefix `prefix`, if it is a delta checkpoint,
+    * and `null` otherwise. Only the index file of the checkpoint is read. */
+  @native def deltaBase(prefix: String): String
   @native def debugString(handle: Long): String
+
+  /** Returns the names, data types (i.e., `TF_DataType` values), and shapes of all variables stored in the checkpoint,
+    * sorted by name. */
+  @native def variables(handle: Long): CheckpointVariables
   @native def hasTensor(handle: Long, name: String): Boolean
   @native def getTensor(handle: Long, name: String): Long
+
+  /** Same as [[getTensor]], except that, for V2 checkpoints stored on the local file system, the returned tensor aliases
+    * a memory mapping of the checkpoint data file. If `copyOnWrite` is `false`, the mapping is read-only. */
+  @native def getMappedTensor(handle: Long, name: String, copyOnWrite: Boolean): Long
+
+  /** Reads the tensors named `names`, using `numThreads` native threads for V2 checkpoints, and returns handles to eager
+    * tensors holding them, in the same order. New reads only start while the total size of the tensors being read is
+    * below `maxBytesInFlight`. */
+  @native def getTensors(handle: Long, names: Array[String], numThreads: Int, maxBytesInFlight: Long): Array[Long]
+
+  /** Reads only the slice of the tensor named `name` that starts at `begin` and has size `size` (where sizes equal to
+    * `-1` denote the full extent of the corresponding dimension), and returns a handle to an eager tensor holding it. */
+  @native def getTensorSlice(handle: Long, name: String, begin: Array[Long], size: Array[Long]): Long
+
+  /** Reads the same slice as [[getTensorSlice]] directly into the direct byte buffer, starting at `offset` (i.e.,
+    * ignoring its position), in row-major order, and returns the number of bytes written. String tensors are not
+    * supported. */
+  @native def getTensorSliceInto(
+      handle: Long, name: String, begin: Array[Long], size: Array[Long], buffer: ByteBuffer, offset: Int): Long
   @native def delete(handle: Long): Unit
 }
+
+/** Packed representation of the variables stored in a checkpoint. The shape of the `i`-th variable consists of the
+  * elements of `shapes` in `[shapeOffsets(i), shapeOffsets(i + 1))`, and so `shapeOffsets` has one more element than
+  * `names`. */
+case class CheckpointVariables(names: Array[String], dataTypes: Array[Int], shapeOffsets: Array[Int], shapes: Array[Long])
@@ -0,0 +1,31 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Points (i.e., values for specific label values) of the metrics registered in the native monitoring registry.
+  *
+  * @param  names         Name of the metric of each point.
+  * @param  labels        Labels of each point, formatted as `"name1=value1,name2=value2"`.
+  * @param  int64Values   Value of each point, for integer-valued metrics (e.g., counters), or zero.
+  * @param  histograms    Serialized `HistogramProto` of each point, for histogram-valued metrics, or `null`.
+  * @param  timestamps    Time at which each point was last updated, in milliseconds since the epoch.
+  */
+case class CollectedMetrics(
+    names: Array[String],
+    labels: Array[String],
+    int64Values: Array[Long],
+    histograms: Array[Array[Byte]],
+    timestamps: Array[Long])
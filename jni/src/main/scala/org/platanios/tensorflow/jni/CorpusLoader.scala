@@ -0,0 +1,32 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Native loader for text corpora, which tokenizes files in parallel and converts them to token IDs.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object CorpusLoader {
+  TensorFlow.load()
+
+  /** Loads the corpus stored in `filenames` and returns eager tensor handles for the token IDs, the offsets at which
+    * the IDs of each file start (followed by the total number of IDs), the vocabulary, and the vocabulary token counts.
+    * Empty `endOfLineToken` and `unknownToken` values mean that no such tokens are used, and a non-positive
+    * `maxVocabularySize` means that the vocabulary size is unbounded. */
+  @native def loadCorpus(
+      filenames: Array[String], delimiters: String, endOfLineToken: String, unknownToken: String, minCount: Long,
+      maxVocabularySize: Long, chunkSize: Long): Array[Long]
+}
@@ -0,0 +1,28 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Host CPU feature detection, which is provided by the small `tensorflow_cpu_features` native library. That library
+  * does not depend on TensorFlow and so it can be loaded before the JNI bindings, in order to choose which of their
+  * instruction set architecture (ISA) variants to load.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object CpuFeatures {
+  /** Returns the highest ISA level that the host CPU (and operating system) supports: `2` for AVX-512 (i.e., the F,
+    * CD, BW, DQ, and VL extensions), `1` for AVX2 and FMA, and `0` otherwise. */
+  @native def isaLevel: Int
+}
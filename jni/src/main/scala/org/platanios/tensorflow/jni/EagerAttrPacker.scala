@@ -0,0 +1,130 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+import java.nio.{ByteBuffer, ByteOrder}
+
+/** Packs op attribute values in the format expected by the [[EagerDispatcher]] (i.e., one after the other, in native
+  * byte order, with strings and lists prefixed by their lengths and shapes prefixed by their ranks).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+final class EagerAttrPacker {
+  private[this] var buffer: ByteBuffer = ByteBuffer.allocate(EagerAttrPacker.INITIAL_CAPACITY)
+      .order(ByteOrder.nativeOrder())
+
+  private[this] def ensureRemaining(numBytes: Int): Unit = {
+    if (buffer.remaining() < numBytes) {
+      val newBuffer = ByteBuffer.allocate(math.max(2 * buffer.capacity(), buffer.position() + numBytes))
+          .order(ByteOrder.nativeOrder())
+      buffer.flip()
+      newBuffer.put(buffer)
+      buffer = newBuffer
+    }
+  }
+
+  def putString(value: Array[Byte]): EagerAttrPacker = {
+    ensureRemaining(4 + value.length)
+    buffer.putInt(value.length).put(value)
+    this
+  }
+
+  def putInt(value: Long): EagerAttrPacker = {
+    ensureRemaining(8)
+    buffer.putLong(value)
+    this
+  }
+
+  def putFloat(value: Float): EagerAttrPacker = {
+    ensureRemaining(4)
+    buffer.putFloat(value)
+    this
+  }
+
+  def putBoolean(value: Boolean): EagerAttrPacker = {
+    ensureRemaining(1)
+    buffer.put(if (value) 1.toByte else 0.toByte)
+    this
+  }
+
+  def putType(value: Int): EagerAttrPacker = {
+    ensureRemaining(4)
+    buffer.putInt(value)
+    this
+  }
+
+  /** Packs a shape, which may be `null` if its rank is unknown. */
+  def putShape(value: Array[Long]): EagerAttrPacker = {
+    if (value == null) {
+      ensureRemaining(4)
+      buffer.putInt(-1)
+    } else {
+      ensureRemaining(4 + 8 * value.length)
+      buffer.putInt(value.length)
+      value.foreach(buffer.putLong)
+    }
+    this
+  }
+
+  def putStringList(value: Array[Array[Byte]]): EagerAttrPacker = {
+    ensureRemaining(4)
+    buffer.putInt(value.length)
+    value.foreach(putString)
+    this
+  }
+
+  def putIntList(value: Array[Long]): EagerAttrPacker = {
+    ensureRemaining(4 + 8 * value.length)
+    buffer.putInt(value.length)
+    value.foreach(buffer.putLong)
+    this
+  }
+
+  def putFloatList(value: Array[Float]): EagerAttrPacker = {
+    ensureRemaining(4 + 4 * value.length)
+    buffer.putInt(value.length)
+    value.foreach(buffer.putFloat)
+    this
+  }
+
+  def putBooleanList(value: Array[Boolean]): EagerAttrPacker = {
+    ensureRemaining(4 + value.length)
+    buffer.putInt(value.length)
+    value.foreach(v => buffer.put(if (v) 1.toByte else 0.toByte))
+    this
+  }
+
+  def putTypeList(value: Array[Int]): EagerAttrPacker = {
+    ensureRemaining(4 + 4 * value.length)
+    buffer.putInt(value.length)
+    value.foreach(buffer.putInt)
+    this
+  }
+
+  def putShapeList(value: Array[Array[Long]]): EagerAttrPacker = {
+    ensureRemaining(4)
+    buffer.putInt(value.length)
+    value.foreach(putShape)
+    this
+  }
+
+  /** Returns the packed attributes. */
+  def toArray: Array[Byte] = java.util.Arrays.copyOf(buffer.array(), buffer.position())
+}
+
+object EagerAttrPacker {
+  private[EagerAttrPacker] val INITIAL_CAPACITY: Int = 64
+}
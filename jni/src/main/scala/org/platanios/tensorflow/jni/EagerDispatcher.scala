@@ -0,0 +1,55 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Generic native eager op dispatcher, which executes any op whose eager dispatch specification has been generated
+  * along with the op bindings, using a single JNI function for all ops.
+  *
+  * The specification of each op lists its inputs, the attributes that are inferred from them (e.g., data types and
+  * list lengths), the types of the rest of its attributes (which are provided packed, using an [[EagerAttrPacker]]),
+  * and how to compute its number of outputs.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object EagerDispatcher {
+  TensorFlow.load()
+
+  /** Returns a handle to the eager dispatch specification of the op named `opName`, which remains valid for the
+    * lifetime of the process and so it can be cached.
+    *
+    * @throws NotFoundException If no specification has been generated for the op.
+    */
+  @native def lookUpOp(opName: String): Long
+
+  /** Executes an op eagerly and returns handles to its outputs.
+    *
+    * @param  contextHandle Handle to the eager context.
+    * @param  opSpecHandle  Handle to the specification of the op, obtained using [[lookUpOp]].
+    * @param  inputs        Handles to the input tensors, for all inputs, in order.
+    * @param  inputLengths  Number of tensors of each input (i.e., `1` for inputs that are not lists).
+    * @param  attributes    Packed attributes that are not inferred from the inputs, in the order of the specification,
+    *                       or `null` if there are none.
+    * @return Handles to the output tensors.
+    */
+  @native def execute(
+      contextHandle: Long, opSpecHandle: Long, inputs: Array[Long], inputLengths: Array[Int],
+      attributes: Array[Byte]): Array[Long]
+
+  /** Same as [[execute]], but for ops with a single output, which avoids allocating an array for it. */
+  @native def executeSingleOutput(
+      contextHandle: Long, opSpecHandle: Long, inputs: Array[Long], inputLengths: Array[Int],
+      attributes: Array[Byte]): Long
+}
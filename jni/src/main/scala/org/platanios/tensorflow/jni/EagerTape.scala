@@ -0,0 +1,46 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Native gradient tape, which records the eager ops executed through the [[EagerDispatcher]] while it is pushed on
+  * the current thread, and computes gradients by executing the recorded computation's gradient as a single eager
+  * function (which is cached per tape structure).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object EagerTape {
+  TensorFlow.load()
+
+  @native def allocate(): Long
+  @native def delete(handle: Long): Unit
+
+  /** Starts recording the ops executed by the current thread on the tape with handle `handle`. */
+  @native def push(handle: Long): Unit
+
+  /** Stops recording the ops executed by the current thread on the tape with handle `handle`. */
+  @native def pop(handle: Long): Unit
+
+  /** Watches the eager tensor with handle `tensorHandle`, so that gradients can be computed with respect to it. */
+  @native def watch(handle: Long, tensorHandle: Long): Unit
+
+  /** Computes the gradients of the sum of `targets` with respect to `sources` and returns handles to them. Zero-valued
+    * `targetGradients` entries correspond to tensors filled with ones and zero-valued returned handles correspond to
+    * sources that the targets do not depend on. */
+  @throws[IllegalArgumentException]
+  @native def gradient(
+      handle: Long, contextHandle: Long, targets: Array[Long], targetGradients: Array[Long],
+      sources: Array[Long]): Array[Long]
+}
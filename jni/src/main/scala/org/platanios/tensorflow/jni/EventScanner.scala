@@ -0,0 +1,51 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Native scanner of event files, which extracts scalar summaries into packed arrays.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object EventScanner {
+  TensorFlow.load()
+
+  /** Creates a scanner that keeps the scalar summaries with tags in `tags` (or all scalar summaries, if `tags` is
+    * empty), reservoir sampling at most `reservoirSize` values per file and tag (or keeping all of them, if
+    * `reservoirSize` is `0`), and that scans files in parallel using `numThreads` threads. */
+  @native def newEventScanner(tags: Array[String], reservoirSize: Long, seed: Long, numThreads: Int): Long
+
+  /** Reads the records that were appended to the provided files since they were last scanned. */
+  @native def eventScannerScan(scannerHandle: Long, filenames: Array[String]): Unit
+
+  /** Returns the sorted tags of the scalar summaries found in the provided files. */
+  @native def eventScannerTags(scannerHandle: Long, filenames: Array[String]): Array[String]
+
+  /** Returns the scalar summaries with tag `tag` found in the provided files, with steps in `[minStep, maxStep]`, and
+    * downsampled to `maxPoints` values, if `maxPoints` is positive. */
+  @native def eventScannerScalars(
+      scannerHandle: Long, filenames: Array[String], tag: String, minStep: Long, maxStep: Long,
+      maxPoints: Long): ScalarEvents
+
+  @native def deleteEventScanner(scannerHandle: Long): Unit
+}
+
+/** Scalar summary values of a single tag, stored as packed arrays.
+  *
+  * @param  steps     Step of each value.
+  * @param  wallTimes Wall time of each value, in seconds.
+  * @param  values    Values.
+  */
+case class ScalarEvents(steps: Array[Long], wallTimes: Array[Double], values: Array[Double])
@@ -0,0 +1,51 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+import java.nio.ByteBuffer
+
+/**
+  * @author Emmanouil Antonios Platanios
+  */
+object ExampleParser {
+  TensorFlow.load()
+
+  /** Parses the serialized `Example` protos stored in bytes `[offset, offset + length)` of the direct buffer `buffer`,
+    * each one prefixed by its size encoded as a varint (i.e., as written by `writeDelimitedTo`), in parallel and
+    * entirely natively, and returns handles to eager tensors holding the parsed features, in the same format as the
+    * `ParseExample` op.
+    *
+    * The dense features are described by `denseKeys`, `denseDataTypes` (i.e., `TF_DataType` values), and
+    * `denseShapes` (packed one feature after the other, with `denseRanks` elements per feature). Dense features whose
+    * first dimension is `-1` have variable length. `denseDefaults` contains handles to eager (host) tensors holding the
+    * default values of the dense features, or `0` for required features. The sparse features are described by
+    * `sparseKeys` and `sparseDataTypes`.
+    *
+    * The returned array contains the handles of the indices, the values, and the dense shapes of all sparse features,
+    * followed by the handles of the values of all dense features.
+    */
+  @native def parseExamples(
+      buffer: ByteBuffer,
+      offset: Long,
+      length: Long,
+      denseKeys: Array[String],
+      denseDataTypes: Array[Int],
+      denseRanks: Array[Int],
+      denseShapes: Array[Long],
+      denseDefaults: Array[Long],
+      sparseKeys: Array[String],
+      sparseDataTypes: Array[Int]): Array[Long]
+}
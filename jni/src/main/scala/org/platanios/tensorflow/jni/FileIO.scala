@@ -15,30 +15,78 @@
 
 package org.platanios.tensorflow.jni
 
+import java.nio.ByteBuffer
+
 /**
   * @author Emmanouil Antonios Platanios
   */
 case class FileStatistics(length: Long, lastModifiedTime: Long, isDirectory: Boolean)
 
+/** Batch of paths returned by a native file lister. The statistics arrays are aligned with `paths` and are only
+  * populated (i.e., non-zero) if the lister was created with statistics enabled. */
+case class FileListing(
+    paths: Array[String], lengths: Array[Long], lastModifiedTimes: Array[Long], isDirectory: Array[Boolean])
+
 object FileIO {
   TensorFlow.load()
 
   @native def fileExists(filename: String): Unit
   @native def deleteFile(filename: String): Unit
   @native def readFileToString(filename: String): String
+
+  /** Reads up to `length` bytes from the file, starting at `fileOffset`, directly into the direct byte buffer, starting
+    * at `offset` (i.e., ignoring its position). Returns the number of bytes read, which is less than `length` only if
+    * the end of the file was reached. */
+  @native def readFileInto(filename: String, fileOffset: Long, buffer: ByteBuffer, offset: Int, length: Int): Int
+
   @native def writeStringToFile(filename: String, content: String): Unit
   @native def getChildren(filename: String): Array[String]
   @native def getMatchingFiles(filename: String): Array[String]
+
+  /** Creates a file lister that expands `pattern` by listing the directories it spans in parallel, on `numThreads`
+    * native threads. If `recursive` is `true`, matching directories are also listed recursively. If `withStatistics` is
+    * `true`, the statistics of each matching path are obtained in the same pass. */
+  @native def newFileLister(pattern: String, numThreads: Int, recursive: Boolean, withStatistics: Boolean): Long
+
+  /** Returns up to `maxEntries` matching paths, in no particular order, blocking until at least one is available, or
+    * `null` once all matching paths have been returned. */
+  @native def fileListerNext(listerHandle: Long, maxEntries: Int): FileListing
+
+  @native def deleteFileLister(listerHandle: Long): Unit
   @native def mkDir(dirname: String): Unit
   @native def mkDirs(dirname: String): Unit
-  @native def copyFile(oldPath: String, newPath: String, overwrite: Boolean): Unit
+  @native def copyFile(oldPath: String, newPath: String, overwrite: Boolean, chunkSize: Long): Unit
   @native def renameFile(oldPath: String, newPath: String, overwrite: Boolean): Unit
   @native def deleteRecursively(dirname: String): Unit
   @native def isDirectory(dirname: String): Boolean
   @native def statistics(path: String): FileStatistics
 
+  /** Checks whether each of the provided paths exists, issuing the file system requests concurrently. */
+  @native def existsMany(paths: Array[String]): Array[Boolean]
+
+  /** Obtains the statistics of each of the provided paths, issuing the file system requests concurrently, and stores
+    * them in the provided arrays, at the index of the corresponding path. `kinds` is set to `0` for paths that do not
+    * exist (in which case their length and last modified time are set to `-1`), `1` for files, and `2` for
+    * directories. */
+  @native def statisticsMany(
+      paths: Array[String], lengths: Array[Long], lastModifiedTimes: Array[Long], kinds: Array[Byte]): Unit
+
   @native def newBufferedInputStream(filename: String, bufferSize: Long): Long
   @native def readFromBufferedInputStream(handle: Long, numBytes: Long): String
+
+  /** Reads up to `length` bytes from the stream into the direct byte buffer, starting at `offset` (i.e., ignoring its
+    * position). Returns the number of bytes read, which is less than `length` only if the end of the file was
+    * reached. */
+  @native def readFromBufferedInputStreamInto(handle: Long, buffer: ByteBuffer, offset: Int, length: Int): Int
+
+  /** Reads up to `offsets.length - 1` whole lines from the stream and packs their bytes into the direct byte buffer,
+    * starting at `offset` and using up to `length` bytes. Line `i` is stored in `[offsets(i), offsets(i + 1))`, and its
+    * new-line character is only included if `keepNewLines` is `true`. If `validateUtf8` is `true`, an exception is
+    * thrown for lines that are not valid UTF-8. Returns the number of lines read, which is `0` at the end of the file,
+    * or `-1` if the next line does not fit in `length` bytes, in which case nothing is read. */
+  @native def readLinesFromBufferedInputStream(
+      handle: Long, buffer: ByteBuffer, offset: Int, length: Int, offsets: Array[Int], keepNewLines: Boolean,
+      validateUtf8: Boolean): Int
   @native def readLineAsStringFromBufferedInputStream(handle: Long): String
   @native def tellBufferedInputStream(handle: Long): Long
   @native def seekBufferedInputStream(handle: Long, position: Long): Unit
@@ -46,6 +94,33 @@ object FileIO {
 
   @native def newWritableFile(filename: String, mode: String): Long
   @native def appendToWritableFile(handle: Long, content: String): Unit
+  @native def appendBytesToWritableFile(handle: Long, content: Array[Byte], offset: Int, length: Int): Unit
+
+  /** Appends `length` bytes, starting at `offset` in the direct byte buffer (i.e., ignoring its position). */
+  @native def appendBufferToWritableFile(handle: Long, buffer: ByteBuffer, offset: Int, length: Int): Unit
+
   @native def flushWritableFile(handle: Long): Unit
+  @native def syncWritableFile(handle: Long): Unit
   @native def deleteWritableFile(handle: Long): Unit
+
+  /** Creates a writable file that coalesces appends into buffers of `bufferSize` bytes, which are written by a native
+    * background thread. Errors that occur while writing are reported by all subsequent calls. Flushing and syncing
+    * wait for all appended data to be written first. */
+  @native def newAsyncWritableFile(filename: String, append: Boolean, bufferSize: Long): Long
+  @native def asyncWritableFileAppendBytes(handle: Long, content: Array[Byte], offset: Int, length: Int): Unit
+  @native def asyncWritableFileAppendBuffer(handle: Long, buffer: ByteBuffer, offset: Int, length: Int): Unit
+  @native def asyncWritableFileFlush(handle: Long): Unit
+  @native def asyncWritableFileSync(handle: Long): Unit
+  @native def asyncWritableFileClose(handle: Long): Unit
+  @native def deleteAsyncWritableFile(handle: Long): Unit
+
+  /** Enables the process-wide block cache of remote files, which stores at most `capacityBytes` bytes of blocks of
+    * `blockSize` bytes in the local directory `directory`. All native readers then read remote files through it. */
+  @native def enableBlockCache(directory: String, capacityBytes: Long, blockSize: Long): Unit
+
+  @native def disableBlockCache(): Unit
+
+  /** Returns the number of hits, misses, bytes saved, bytes fetched, and evictions of the block cache, followed by the
+    * number of bytes and blocks that it currently stores. */
+  @native def blockCacheStatistics(): Array[Long]
 }
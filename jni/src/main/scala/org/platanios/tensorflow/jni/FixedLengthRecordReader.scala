@@ -0,0 +1,41 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Native readers for files of fixed-length records, which read batches of records concurrently on multiple threads
+  * and return each batch as a single tensor.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object FixedLengthRecordReader {
+  TensorFlow.load()
+
+  /** Creates a reader for the file at `filename`, which starts reading batches of `recordsPerBatch` records on
+    * `numThreads` threads, keeping at most `maxBufferedBatches` batches ahead of the consumer. */
+  @native def newParallelFixedLengthReader(
+      filename: String, headerBytes: Long, recordBytes: Long, footerBytes: Long, recordsPerBatch: Long,
+      numThreads: Int, maxBufferedBatches: Int, useDirectIO: Boolean): Long
+
+  @native def parallelFixedLengthReaderNumRecords(readerHandle: Long): Long
+
+  /** Returns `true` if the reader reads the file using direct I/O (i.e., bypassing the page cache). */
+  @native def parallelFixedLengthReaderDirectIO(readerHandle: Long): Boolean
+
+  /** Returns an eager tensor handle for the next batch of records, or `0` once all batches have been returned. */
+  @native def parallelFixedLengthReaderNext(readerHandle: Long): Long
+
+  @native def deleteParallelFixedLengthReader(readerHandle: Long): Unit
+}
@@ -28,5 +28,6 @@ object Function {
       outputNames: Array[String]): Long
   @native def copyToGraph(graphHandle: Long, functionHandle: Long, gradientHandle: Long): Unit
   @native def toFunctionDef(handle: Long): Array[Byte]
+  @native def toFunctionDefFile(handle: Long, filename: String): Unit
   @native def delete(handle: Long): Unit
 }
@@ -15,6 +15,8 @@
 
 package org.platanios.tensorflow.jni
 
+import java.nio.ByteBuffer
+
 /**
   * @author Emmanouil Antonios Platanios
   */
@@ -25,12 +27,146 @@ object Graph {
   @native def delete(handle: Long): Unit
   @native def findOp(handle: Long, name: String): Long
   @native def ops(handle: Long): Array[Long]
+
+  /** Collects the metadata of all ops in a graph (i.e., names, types, devices, inputs, control inputs, and output
+    * data types and shapes) in a single call, avoiding one JNI crossing per op and per property. */
+  @native def snapshot(handle: Long): GraphSnapshot
   @native def addGradients(handle: Long, y: Array[Output], x: Array[Output], dx: Array[Output]): Array[Output]
+
+  /** Returns, for each op in `opHandles`, whether its gradient can be built by [[addGradients]] (i.e., whether its op
+    * type has a gradient function in the C++ gradient registry and it is not marked for XLA compilation). */
+  @native def nativeGradientSupport(handle: Long, opHandles: Array[Long]): Array[Boolean]
   @throws[IllegalArgumentException]
   @native def importGraphDef(
       handle: Long, graphDef: Array[Byte], prefix: String, inputsMapSourceOpNames: Array[String],
       inputsMapSourceOutputIndices: Array[Int], inputsMapDestinationOpHandles: Array[Long],
       inputsMapDestinationOutputIndices: Array[Int], controlDependenciesMapSourceOpNames: Array[String],
       controlDependenciesMapDestinationOpHandles: Array[Long], controlDependenciesOpHandles: Array[Long]): Unit
+  /** Same as [[importGraphDef]], except that the serialized graph definition is read directly from a direct byte
+    * buffer, without being copied. */
+  @throws[IllegalArgumentException]
+  @native def importGraphDefFromBuffer(
+      handle: Long, graphDef: ByteBuffer, prefix: String, inputsMapSourceOpNames: Array[String],
+      inputsMapSourceOutputIndices: Array[Int], inputsMapDestinationOpHandles: Array[Long],
+      inputsMapDestinationOutputIndices: Array[Int], controlDependenciesMapSourceOpNames: Array[String],
+      controlDependenciesMapDestinationOpHandles: Array[Long], controlDependenciesOpHandles: Array[Long]): Unit
+
+  /** Same as [[importGraphDef]], except that the serialized graph definition is read from a memory-mapped file. Mapped
+    * files are cached natively, so that importing the same file multiple times only reads it once. The cache can be
+    * cleared using [[clearGraphDefFileCache]]. */
+  @throws[IllegalArgumentException]
+  @native def importGraphDefFromFile(
+      handle: Long, filename: String, prefix: String, inputsMapSourceOpNames: Array[String],
+      inputsMapSourceOutputIndices: Array[Int], inputsMapDestinationOpHandles: Array[Long],
+      inputsMapDestinationOutputIndices: Array[Int], controlDependenciesMapSourceOpNames: Array[String],
+      controlDependenciesMapDestinationOpHandles: Array[Long], controlDependenciesOpHandles: Array[Long]): Unit
+
+  /** Same as [[importGraphDef]], except that the imported graph definition is that of the graph with handle
+    * `sourceHandle`, after it has been optimized by Grappler using the (serialized) `RewriterConfig`
+    * `rewriterConfig` (which may be `null`, for the default configuration). `fetches` are the names of the nodes whose
+    * outputs must be preserved by the optimizations. */
+  @throws[IllegalArgumentException]
+  @native def importOptimizedGraphDef(
+      handle: Long, sourceHandle: Long, rewriterConfig: Array[Byte], fetches: Array[String], prefix: String,
+      inputsMapSourceOpNames: Array[String], inputsMapSourceOutputIndices: Array[Int],
+      inputsMapDestinationOpHandles: Array[Long], inputsMapDestinationOutputIndices: Array[Int],
+      controlDependenciesMapSourceOpNames: Array[String], controlDependenciesMapDestinationOpHandles: Array[Long],
+      controlDependenciesOpHandles: Array[Long]): Unit
+
+  /** Estimates the cost of computing the nodes named `fetches` using the graph with handle `handle`, analytically and
+    * without running it. */
+  @throws[IllegalArgumentException]
+  @native def estimateCosts(handle: Long, fetches: Array[String]): GraphCostReport
+
+  /** Returns a serialized `GraphDef` of the graph with handle `handle`, after only the Grappler layout optimizer has
+    * been run on it, as if its unplaced ops were placed on a GPU. `fetches` are the names of the nodes whose outputs
+    * must be preserved by the optimization. */
+  @throws[IllegalArgumentException]
+  @native def optimizeLayout(handle: Long, fetches: Array[String]): Array[Byte]
+
+  /** Returns a serialized `GraphDef` that only contains the nodes of the graph with handle `handle` that are needed in
+    * order to compute `fetches`, given that `feeds` are fed, and in which the variables have been replaced by constants.
+    * The variable values are read using the session with handle `sessionHandle`, if it is not `0`, or from the
+    * checkpoint with prefix `checkpointPrefix`, otherwise. */
+  @throws[IllegalArgumentException]
+  @native def freezeAndPrune(
+      handle: Long, sessionHandle: Long, checkpointPrefix: String, fetches: Array[String],
+      feeds: Array[String]): Array[Byte]
+
+  /** Returns the names of the tensors of the graph with handle `handle` whose ranges must be calibrated in order to
+    * quantize it using [[importQuantizedGraphDef]]. */
+  @throws[IllegalArgumentException]
+  @native def quantizationCalibrationTensors(handle: Long): Array[String]
+
+  /** Same as [[importGraphDef]], except that the imported graph definition is that of the graph with handle
+    * `sourceHandle`, after its supported ops have been rewritten to eight-bit quantized ops, using the calibrated
+    * ranges `[rangeMins(i), rangeMaxs(i)]` of the tensors named `rangeTensors(i)`. */
+  @throws[IllegalArgumentException]
+  @native def importQuantizedGraphDef(
+      handle: Long, sourceHandle: Long, rangeTensors: Array[String], rangeMins: Array[Float],
+      rangeMaxs: Array[Float], prefix: String, inputsMapSourceOpNames: Array[String],
+      inputsMapSourceOutputIndices: Array[Int], inputsMapDestinationOpHandles: Array[Long],
+      inputsMapDestinationOutputIndices: Array[Int], controlDependenciesMapSourceOpNames: Array[String],
+      controlDependenciesMapDestinationOpHandles: Array[Long], controlDependenciesOpHandles: Array[Long]): Unit
+
+  /** Unmaps all files cached by [[importGraphDefFromFile]]. */
+  @native def clearGraphDefFileCache(): Unit
+
+  /** Enables the process-wide persistent cache of the graphs optimized by [[importOptimizedGraphDef]], which stores
+    * them in `directory`. */
+  @throws[IllegalArgumentException]
+  @native def enableOptimizedGraphCache(directory: String): Unit
+
+  @native def disableOptimizedGraphCache(): Unit
+
+  /** Returns the number of hits, misses, and failed writes of the optimized graph cache, followed by the time spent
+    * optimizing graphs on misses, in microseconds. */
+  @native def optimizedGraphCacheStatistics(): Array[Long]
+
+  /** Same as [[importGraphDef]], except that it also returns handles to the ops named `opNames` (without the prefix),
+    * after the import. Missing ops are represented by zero-valued handles. */
+  @throws[IllegalArgumentException]
+  @native def importOps(
+      handle: Long, graphDef: Array[Byte], prefix: String, inputsMapSourceOpNames: Array[String],
+      inputsMapSourceOutputIndices: Array[Int], inputsMapDestinationOpHandles: Array[Long],
+      inputsMapDestinationOutputIndices: Array[Int], controlDependenciesMapSourceOpNames: Array[String],
+      controlDependenciesMapDestinationOpHandles: Array[Long], controlDependenciesOpHandles: Array[Long],
+      opNames: Array[String]): Array[Long]
   @native def toGraphDef(handle: Long): Array[Byte]
+
+  /** Writes the serialized graph definition directly to a file, without going through a Java byte array. */
+  @native def toGraphDefFile(handle: Long, filename: String): Unit
+
+  /** Writes the serialized graph definition into a direct byte buffer and returns its size. If the buffer is too small
+    * to hold the serialized graph definition, nothing is written to it. */
+  @native def toGraphDefBuffer(handle: Long, buffer: ByteBuffer): Long
+
+  /** Writes the node definitions of all ops created at or after `startPosition` in a graph to a file, serialized as a
+    * `GraphDef` that only contains nodes, and returns the position to use for the next call. Files built by appending
+    * the output of successive calls can be parsed as a single `GraphDef`. */
+  @native def nodeDefsToFile(handle: Long, startPosition: Long, filename: String, append: Boolean): Long
 }
+
+/** Metadata of all ops in a graph, stored in flat arrays indexed by op, in graph construction order.
+  *
+  * Per-op variable-length data (i.e., inputs, control inputs, and outputs) is stored in concatenated arrays, along with
+  * offset arrays of length `opHandles.length + 1`, such that, for example, the inputs of op `i` are stored at indices
+  * `[inputOffsets(i), inputOffsets(i + 1))` of `inputOpHandles` and `inputOutputIndices`. Similarly, the shape of
+  * output `j` (indexed over all outputs) has rank `outputRanks(j)` (`-1` if unknown) and its dimensions are stored
+  * starting at index `outputShapeOffsets(j)` of `outputShapes`.
+  */
+case class GraphSnapshot(
+    opHandles: Array[Long], names: Array[String], opTypes: Array[String], devices: Array[String],
+    inputOffsets: Array[Int], inputOpHandles: Array[Long], inputOutputIndices: Array[Int],
+    controlInputOffsets: Array[Int], controlInputOpHandles: Array[Long], outputOffsets: Array[Int],
+    outputDataTypes: Array[Int], outputRanks: Array[Int], outputShapeOffsets: Array[Int], outputShapes: Array[Long])
+
+/** Analytical cost estimate of a graph, returned by [[Graph.estimateCosts]], stored in flat arrays. All times are in
+  * microseconds. Devices and nodes are described by the arrays prefixed with `device` and `node`, respectively, and
+  * nodes are stored in the order in which they were scheduled.
+  */
+case class GraphCostReport(
+    executionMicros: Long, deviceNames: Array[String], deviceExecutionMicros: Array[Long],
+    devicePeakMemoryBytes: Array[Long], nodeNames: Array[String], nodeOpTypes: Array[String],
+    nodeDevices: Array[String], nodeExecutionMicros: Array[Long], nodeComputeMicros: Array[Long],
+    nodeMemoryMicros: Array[Long])
@@ -0,0 +1,52 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Opt-in native registry of the live handles handed out by the native library (e.g., tensors and readers), which is
+  * used to find leaked handles.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object HandleTracker {
+  TensorFlow.load()
+
+  /** Enables or disables tracking. All statistics are cleared when tracking is disabled. */
+  @native def setEnabled(enabled: Boolean): Unit
+
+  /** Sets the allocation site tag of the handles created by the current thread. */
+  @native def setThreadTag(tag: String): Unit
+
+  /** Tracks the eager tensor with handle `handle`. Eager tensors are created by many native functions (e.g., by all
+    * eager ops) and so, unlike other handles, they are registered by their owners on the JVM. */
+  @native def trackEagerTensor(handle: Long): Unit
+
+  /** Returns the current statistics of the tracked handles. */
+  @native def snapshot(): HandleStatistics
+}
+
+/** Statistics of the tracked native handles, per handle type and allocation site tag.
+  *
+  * @param  handleTypes Handle type of each entry.
+  * @param  tags        Allocation site tag of each entry.
+  * @param  statistics  Statistics of each entry, packed in consecutive groups of [[HandleStatistics.NumValues]]
+  *                     elements: number of live handles, number of bytes held by live handles, number of handles
+  *                     created, and number of handles released.
+  */
+case class HandleStatistics(handleTypes: Array[String], tags: Array[String], statistics: Array[Long])
+
+object HandleStatistics {
+  val NumValues: Int = 4
+}
@@ -0,0 +1,51 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Native dataset caches, which store each element component in a contiguous column file and are memory-mapped when
+  * read, so that the cached elements are returned as eager tensors over the mapped files.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object MappedCache {
+  TensorFlow.load()
+
+  /** Creates a writer for a new cache with file prefix `prefix`. Fails if a complete cache already exists. */
+  @native def newMappedCacheWriter(prefix: String): Long
+
+  /** Appends an element, represented by the provided eager tensor handles, to the cache. */
+  @native def mappedCacheWriterAppend(writerHandle: Long, tensorHandles: Array[Long]): Unit
+
+  /** Completes the cache, after which it can be read. */
+  @native def mappedCacheWriterFinish(writerHandle: Long): Unit
+
+  @native def deleteMappedCacheWriter(writerHandle: Long): Unit
+
+  /** Returns `true` if a complete cache exists with file prefix `prefix`. */
+  @native def mappedCacheExists(prefix: String): Boolean
+
+  @native def newMappedCacheReader(prefix: String): Long
+  @native def mappedCacheReaderNumElements(readerHandle: Long): Long
+
+  /** Returns eager tensor handles for the `index`-th cached element. */
+  @native def mappedCacheReaderElement(readerHandle: Long, index: Long): Array[Long]
+
+  /** Returns eager tensor handles for the batch of `count` cached elements starting at `start`, stacked along a new
+    * leading dimension. */
+  @native def mappedCacheReaderBatch(readerHandle: Long, start: Long, count: Long): Array[Long]
+
+  @native def deleteMappedCacheReader(readerHandle: Long): Unit
+}
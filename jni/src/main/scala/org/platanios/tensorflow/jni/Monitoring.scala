@@ -0,0 +1,43 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Access to the process-wide native monitoring registry, which holds the metrics of the TensorFlow runtime along with
+  * those of the JNI bindings (i.e., the ones whose names start with `/tensorflow/jni/`).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object Monitoring {
+  TensorFlow.load()
+
+  /** Collects the current values of all metrics registered in the process whose names start with `prefix` (which may be
+    * `null` or empty, in order to collect all metrics). */
+  @native def collectMetrics(prefix: String): CollectedMetrics
+
+  /** Same as [[collectMetrics]], but returns the metrics formatted in the OpenMetrics text format, encoded in UTF-8. */
+  @native def collectOpenMetrics(prefix: String): Array[Byte]
+
+  /** Starts serving the metrics whose names start with `prefix` in the OpenMetrics text format over HTTP, at path
+    * `/metrics`, on a native background thread, listening on `port` (or on an ephemeral port, if `port` is `0`) of the
+    * IPv4 address `host`. Returns a handle to the exporter. */
+  @native def startMetricsHttpExporter(host: String, port: Int, prefix: String): Long
+
+  /** Returns the port that the exporter with handle `exporterHandle` listens on. */
+  @native def metricsHttpExporterPort(exporterHandle: Long): Int
+
+  /** Stops the exporter with handle `exporterHandle` and deletes it. */
+  @native def deleteMetricsHttpExporter(exporterHandle: Long): Unit
+}
@@ -0,0 +1,49 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+import java.nio.ByteBuffer
+
+/** Access to the native event recorder, which records timed events for the hot paths of the JNI bindings (i.e., session
+  * runs, eager op executions, and record reads) into per-thread native ring buffers.
+  *
+  * Each drained event occupies [[eventSize]] bytes, in native byte order, with the following layout: start time (in
+  * nanoseconds since the epoch), duration (in nanoseconds), name address, number of bytes, and thread ID, all as 64-bit
+  * integers, followed by the kind, the number of inputs, and the number of outputs, as 32-bit integers, and 4 bytes of
+  * padding.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object NativeEvents {
+  TensorFlow.load()
+
+  /** Enables or disables the recording of native events. Recording is disabled by default. */
+  @native def setEnabled(enabled: Boolean): Unit
+
+  /** Returns the size of each drained event, in bytes. */
+  @native def eventSize(): Int
+
+  /** Moves as many of the recorded events as fit in the provided direct buffer to it and returns their number. Only
+    * one thread may drain events at a time. */
+  @native def drain(buffer: ByteBuffer): Int
+
+  /** Returns the total number of events that were dropped because their ring buffer was full. */
+  @native def numDropped(): Long
+
+  /** Returns the name stored at the name address `name` of a drained event, or `null` if `name` is `0`. Names have
+    * static storage duration and so they can be cached by their address. */
+  @native def eventName(name: Long): String
+}
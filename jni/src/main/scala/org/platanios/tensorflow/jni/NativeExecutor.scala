@@ -0,0 +1,48 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+
+package org.platanios.tensorflow.jni
+
+/** Access to the process-wide native executor, which runs the background work of the JNI bindings (i.e., concurrent
+  * file system requests, the packing of large tensor batches, asynchronous callable runs, and the tokenization of text
+  * corpora) on a shared set of native threads that are attached to the JVM.
+  *
+  * Subsystems and priorities are identified by their native indices (i.e., `0` for file I/O, `1` for tensor packing,
+  * `2` for session callbacks, and `3` for corpus loading, and `0` for low, `1` for normal, and `2` for high
+  * priority).
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object NativeExecutor {
+  TensorFlow.load()
+
+  /** Number of statistics values per subsystem returned by [[statistics]]. */
+  val NumValues: Int = 6
+
+  /** Sets the number of executor threads. This must be called before the executor is first used. */
+  @native def setNumThreads(numThreads: Int): Unit
+
+  /** Returns the number of executor threads, creating the executor if necessary. */
+  @native def numThreads(): Int
+
+  /** Sets the priority of the tasks that are scheduled on behalf of `subsystem`. */
+  @native def setPriority(subsystem: Int, priority: Int): Unit
+
+  /** Returns the statistics of all subsystems, packed in consecutive groups of [[NumValues]] elements, by subsystem
+    * index: priority, number of scheduled tasks, number of completed tasks, number of running tasks, number of queued
+    * tasks, and total task time in microseconds. */
+  @native def statistics(): Array[Long]
+}
@@ -40,6 +40,19 @@ object Op {
   @native def outputDataType(graphHandle: Long, opHandle: Long, outputIndex: Int): Int
   @native def shape(graphHandle: Long, opHandle: Long, output: Int): Array[Long]
   @native def setShape(graphHandle: Long, opHandle: Long, output: Int, shape: Array[Long], rank: Int): Unit
+
+  /** Returns the shapes of outputs `outputs(i)` of ops `opHandles(i)`, while holding the native graph lock only once.
+    * The shapes are packed in a single array, where each shape is represented by its rank (`-1` if unknown), followed
+    * by its dimensions (`-1` for unknown dimensions), if its rank is known. */
+  @throws[IllegalArgumentException]
+  @native def shapes(graphHandle: Long, opHandles: Array[Long], outputs: Array[Int]): Array[Long]
+
+  /** Sets the shapes of outputs `outputs(i)` of ops `opHandles(i)`, while holding the native graph lock only once. The
+    * shape of output `i` has rank `ranks(i)` (`-1` if unknown) and its dimensions are stored in `shapes`, right after
+    * the dimensions of the previous outputs. */
+  @throws[IllegalArgumentException]
+  @native def setShapes(
+      graphHandle: Long, opHandles: Array[Long], outputs: Array[Int], ranks: Array[Int], shapes: Array[Long]): Unit
   @native def getAttrString(handle: Long, name: String): String
   @native def getAttrStringList(handle: Long, name: String): Array[String]
   @native def getAttrInt(handle: Long, name: String): Long
@@ -52,11 +65,33 @@ object Op {
   @native def getAttrTypeList(handle: Long, name: String): Array[Int]
   @native def getAttrTensor(handle: Long, name: String): Long
   @native def getAttrShape(handle: Long, name: String): Array[Long]
+
+  /** Returns the serialized `OpList` of all registered ops. The serialized list is cached natively and only recomputed
+    * after new ops get registered (e.g., by [[TensorFlow.loadOpLibrary]]), which also increments [[allOpsVersion]].
+    * Callers that only need information about a few ops should use [[opDef]] or [[opSignature]] instead. */
   @native def allOps: Array[Byte]
 
+  /** Returns the version of the op list returned by [[allOps]], which changes whenever new ops get registered. Callers
+    * that keep a parsed copy of that list can use this version to check whether it is still up to date. */
+  @native def allOpsVersion: Long
+
+  /** Returns the serialized `OpDef` of the op type `opType`, looked up by name in the native op registry, or `null` if
+    * no such op type has been registered. */
+  @native def opDef(opType: String): Array[Byte]
+
+  /** Returns the argument and attribute signature of the op type `opType`, looked up by name in the native op
+    * registry, or `null` if no such op type has been registered. */
+  @native def opSignature(opType: String): OpSignature
+
   // Operation Builder
   @native def allocate(graphHandle: Long, opType: String, name: String): Long
   @native def finish(handle: Long): Long
+
+  /** Finishes all the op descriptions in `handles`, which must belong to the graph with handle `graphHandle`, while
+    * holding the native graph lock only once, and returns the handles of the created ops. All descriptions are
+    * consumed, even if finishing one of them fails. */
+  @throws[IllegalArgumentException]
+  @native def finishAll(graphHandle: Long, handles: Array[Long]): Array[Long]
   @native def addInput(handle: Long, operationHandle: Long, index: Int): Unit
   @native def addInputList(handle: Long, operationHandles: Array[Long], indices: Array[Int]): Unit
   @native def addControlInput(handle: Long, inputOpHandle: Long): Unit
@@ -82,3 +117,13 @@ object Op {
       handle: Long, name: String, shapes: Array[Array[Long]], numDims: Array[Int], numShapes: Int): Unit
   @native def setAttrProto(handle: Long, name: String, value: Array[Byte]): Unit
 }
+
+/** Argument and attribute signature of an op type, returned by [[Op.opSignature]].
+  *
+  * Argument data types are represented by their C API values, where `0` (i.e., `DT_INVALID`) is used for arguments
+  * whose data types are determined by attributes. Attribute types are represented as in `OpDef`s (e.g., `"type"`,
+  * `"list(int)"`, or `"shape"`).
+  */
+case class OpSignature(
+    inputArgNames: Array[String], inputArgTypes: Array[Int], outputArgNames: Array[String],
+    outputArgTypes: Array[Int], attrNames: Array[String], attrTypes: Array[String], isStateful: Boolean)
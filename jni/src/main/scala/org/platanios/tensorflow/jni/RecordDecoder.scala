@@ -0,0 +1,52 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/**
+  * @author Emmanouil Antonios Platanios
+  */
+object RecordDecoder {
+  TensorFlow.load()
+
+  /** Decodes the fixed-length records stored in the file at `filePath`, which consist of a header of `headerBytes`
+    * bytes followed by records of `recordBytes` bytes, entirely natively, and returns handles to eager tensors holding
+    * the decoded fields.
+    *
+    * If `gzip` is `true`, the file is decompressed while being read. If `tarEntries` is non-empty, the file is treated
+    * as a tar archive and the entries whose names end with the provided names are decoded in a single pass over it.
+    * The handle of field `j` of entry `i` is stored at index `i * numFields + j` of the returned array (a plain file
+    * counts as a single entry).
+    *
+    * Each field consists of `fieldShapes` elements (packed one field after the other, with `fieldRanks` elements per
+    * field) starting at byte `fieldOffsets` of each record. The field dimensions are reordered according to
+    * `fieldPermutations` (packed in the same way, or empty for no reordering), and each byte `b` is decoded as `b *
+    * scale + shift` into the data type `fieldDataTypes` (i.e., a `TF_DataType` value, which must be `UINT8` or
+    * `FLOAT32`).
+    */
+  @native def decodeFixedLengthRecords(
+      filePath: String,
+      gzip: Boolean,
+      tarEntries: Array[String],
+      headerBytes: Long,
+      recordBytes: Long,
+      fieldOffsets: Array[Long],
+      fieldRanks: Array[Int],
+      fieldShapes: Array[Long],
+      fieldPermutations: Array[Int],
+      fieldDataTypes: Array[Int],
+      fieldScales: Array[Float],
+      fieldShifts: Array[Float]): Array[Long]
+}
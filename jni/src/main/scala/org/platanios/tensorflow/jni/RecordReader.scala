@@ -15,6 +15,8 @@
 
 package org.platanios.tensorflow.jni
 
+import java.nio.ByteBuffer
+
 /**
   * @author Emmanouil Antonios Platanios
   */
@@ -34,6 +36,78 @@ object RecordReader {
 
   @native def newRecordReaderWrapper(filename: String, compressionType: String, startOffset: Long): Long
   @native def recordReaderWrapperReadNext(readerHandle: Long): Array[Byte]
+
+  /** Reads up to `maxRecords` records into a direct byte buffer, using at most `maxBytes` bytes of it, starting at its
+    * beginning (i.e., ignoring its position). Each record is written as its length, encoded as a little-endian 32-bit
+    * integer, followed by its contents. Errors are only reported if no records could be read.
+    *
+    * @return Number of records that were written. This is zero if the next record does not fit in the buffer, in which
+    *         case it can still be read using [[recordReaderWrapperReadNext]].
+    */
+  @native def recordReaderWrapperReadBatch(readerHandle: Long, maxRecords: Int, maxBytes: Int, buffer: ByteBuffer): Int
+
   @native def recordReaderWrapperOffset(readerHandle: Long): Long
   @native def deleteRecordReaderWrapper(readerHandle: Long): Unit
+
+  /** Creates a record reader that reads records ahead of time on a native I/O thread, buffering up to
+    * `maxBufferedRecords` records or `maxBufferedBytes` bytes. The remaining methods of this reader behave in the same
+    * way as the corresponding `recordReaderWrapper*` methods. */
+  @native def newPrefetchingRecordReaderWrapper(
+      filename: String, compressionType: String, startOffset: Long, maxBufferedRecords: Long,
+      maxBufferedBytes: Long): Long
+  @native def prefetchingRecordReaderWrapperReadNext(readerHandle: Long): Array[Byte]
+  @native def prefetchingRecordReaderWrapperReadBatch(
+      readerHandle: Long, maxRecords: Int, maxBytes: Int, buffer: ByteBuffer): Int
+  @native def prefetchingRecordReaderWrapperOffset(readerHandle: Long): Long
+  @native def prefetchingRecordReaderWrapperStatistics(readerHandle: Long): RecordReaderStatistics
+  @native def deletePrefetchingRecordReaderWrapper(readerHandle: Long): Unit
+
+  /** Creates a record reader that interleaves the records of all files matching the provided patterns, reading up to
+    * `cycleLength` files concurrently on a native thread pool, and buffering up to `maxBufferedRecordsPerFile` records
+    * per file being read. If `deterministic` is `true`, the records are returned in round-robin order over the files
+    * being read. Otherwise, they are returned as soon as they become available. Errors encountered while reading a file
+    * are reported in place of its remaining records. The remaining methods of this reader behave in the same way as the
+    * corresponding `recordReaderWrapper*` methods. */
+  @native def newInterleavedRecordReaderWrapper(
+      filePatterns: Array[String], compressionType: String, cycleLength: Int, deterministic: Boolean,
+      maxBufferedRecordsPerFile: Long): Long
+  @native def interleavedRecordReaderWrapperReadNext(readerHandle: Long): Array[Byte]
+  @native def interleavedRecordReaderWrapperReadBatch(
+      readerHandle: Long, maxRecords: Int, maxBytes: Int, buffer: ByteBuffer): Int
+  @native def interleavedRecordReaderWrapperNumFiles(readerHandle: Long): Long
+  @native def deleteInterleavedRecordReaderWrapper(readerHandle: Long): Unit
+
+  /** Scans the provided uncompressed TFRecord files, using up to `numThreads` threads, and writes an index of their
+    * record offsets to the corresponding index files. Returns the number of records indexed for each file. */
+  @native def buildRecordIndices(filenames: Array[String], indexFilenames: Array[String], numThreads: Int): Array[Long]
+
+  /** Creates a reader that provides random access to the records of an uncompressed TFRecord file, using the index
+    * built for it by [[buildRecordIndices]]. */
+  @native def newIndexedRecordReader(filename: String, indexFilename: String, verifyChecksums: Boolean): Long
+  @native def indexedRecordReaderNumRecords(readerHandle: Long): Long
+  @native def indexedRecordReaderRead(readerHandle: Long, index: Long): Array[Byte]
+
+  /** Reads the records with the provided indices, in order, into a direct byte buffer, using the same format as
+    * [[recordReaderWrapperReadBatch]], and returns the number of records written. */
+  @native def indexedRecordReaderReadBatch(
+      readerHandle: Long, indices: Array[Long], maxBytes: Int, buffer: ByteBuffer): Int
+  @native def deleteIndexedRecordReader(readerHandle: Long): Unit
+
+  /** Creates a reader that memory-maps an uncompressed TFRecord file and returns its records without copying them. */
+  @native def newMappedRecordReader(filename: String, startOffset: Long, verifyChecksums: Boolean): Long
+
+  /** Reads up to `maxRecords` records and returns them as direct byte buffers that point into the memory-mapped file.
+    * The buffers must not be written to and must not be used after the reader is deleted. Errors are only reported if
+    * no records could be read. */
+  @native def mappedRecordReaderReadBatch(readerHandle: Long, maxRecords: Int): Array[ByteBuffer]
+  @native def mappedRecordReaderOffset(readerHandle: Long): Long
+  @native def deleteMappedRecordReader(readerHandle: Long): Unit
 }
+
+/** Statistics of a prefetching record reader.
+  *
+  * @param  stallTimeMicros Total time (in microseconds) that the reader spent waiting for records to be read.
+  * @param  bufferedRecords Number of records currently buffered.
+  * @param  bufferedBytes   Number of bytes currently buffered.
+  */
+case class RecordReaderStatistics(stallTimeMicros: Long, bufferedRecords: Long, bufferedBytes: Long)
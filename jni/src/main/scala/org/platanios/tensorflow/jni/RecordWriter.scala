@@ -0,0 +1,41 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+import java.nio.ByteBuffer
+
+/**
+  * @author Emmanouil Antonios Platanios
+  */
+object RecordWriter {
+  TensorFlow.load()
+
+  /** Creates a TFRecord file writer. If `flushIntervalMillis` is positive, the writer is flushed every
+    * `flushIntervalMillis` milliseconds on a native background thread, and any error encountered while doing so is
+    * reported by the next call to the writer. */
+  @native def newRecordWriter(
+      filename: String, compressionType: String, append: Boolean, flushIntervalMillis: Long): Long
+  @native def recordWriterWrite(writerHandle: Long, record: Array[Byte]): Unit
+
+  /** Writes `numRecords` records stored in the first `length` bytes of a direct byte buffer (i.e., ignoring its
+    * position). Each record must be stored as its length, encoded as a little-endian 32-bit integer, followed by its
+    * contents. */
+  @native def recordWriterWriteBatch(writerHandle: Long, buffer: ByteBuffer, length: Int, numRecords: Int): Unit
+
+  @native def recordWriterFlush(writerHandle: Long): Unit
+  @native def recordWriterClose(writerHandle: Long): Unit
+  @native def deleteRecordWriter(writerHandle: Long): Unit
+}
@@ -15,7 +15,11 @@
 
 package org.platanios.tensorflow.jni
 
+import java.nio.{ByteBuffer, ByteOrder}
+
 import scala.collection.mutable
+import scala.concurrent.{ExecutionContext, Future}
+import scala.util.{Failure, Success}
 
 /** Keeps a map from unique tokens (i.e., integer IDs) to Scala functions (i.e., callbacks), each of which takes an
   * array with handles of tensors as input and returns an array with handles of tensors as output.
@@ -23,13 +27,18 @@ import scala.collection.mutable
   * @author Emmanouil Antonios Platanios
   */
 object ScalaCallbacksRegistry {
+  TensorFlow.load()
+
   private[this] object Lock
 
   private[this] var uniqueId  = 0
   private[this] val callbacks = mutable.Map.empty[Int, (Array[Long]) => Array[Long]]
+  private[this] val batchCallbacks  = mutable.Map.empty[Int, (Array[Long], Int) => Array[Long]]
+  private[this] val asyncCallbacks  = mutable.Map.empty[Int, ((Array[Long]) => Future[Array[Long]], ExecutionContext)]
+  private[this] val bufferCallbacks = mutable.Map.empty[Int, BufferCallback]
 
   /** Number of callbacks currently registered. */
-  def size: Int = callbacks.size
+  def size: Int = callbacks.size + batchCallbacks.size + asyncCallbacks.size + bufferCallbacks.size
 
   /** Registers the provided callback function and returns a unique token to use when creating ops invoking it. */
   def register(function: (Array[Long]) => Array[Long]): Int = Lock synchronized {
@@ -39,9 +48,121 @@ object ScalaCallbacksRegistry {
     token
   }
 
+  /** Registers the provided batch callback function and returns a unique token to use when creating ops invoking it.
+    * Batch callback functions take an array with handles of tensors, flattened over the examples in a batch, along with
+    * the number of examples in the batch, and return an array with handles of tensors, flattened in the same way. */
+  def registerBatch(function: (Array[Long], Int) => Array[Long]): Int = Lock synchronized {
+    val token = uniqueId
+    batchCallbacks.update(uniqueId, function)
+    uniqueId += 1
+    token
+  }
+
+  /** Registers the provided asynchronous callback function and returns a unique token to use when creating ops
+    * invoking it. The function is invoked using `executionContext`, rather than on the TensorFlow thread executing the
+    * op. */
+  def registerAsync(
+      function: (Array[Long]) => Future[Array[Long]],
+      executionContext: ExecutionContext
+  ): Int = Lock synchronized {
+    val token = uniqueId
+    asyncCallbacks.update(uniqueId, (function, executionContext))
+    uniqueId += 1
+    token
+  }
+
+  /** Registers the provided buffer callback function and returns a unique token to use when creating ops invoking it. */
+  def registerBuffers(function: BufferCallback): Int = Lock synchronized {
+    val token = uniqueId
+    bufferCallbacks.update(uniqueId, function)
+    uniqueId += 1
+    token
+  }
+
   /** De-registers (i.e., removes from this registry) the function that corresponds to the provided token. */
-  def deregister(token: Int): Unit = callbacks.remove(token)
+  def deregister(token: Int): Unit = Lock synchronized {
+    callbacks.remove(token)
+    batchCallbacks.remove(token)
+    asyncCallbacks.remove(token)
+    bufferCallbacks.remove(token)
+  }
 
   /** Invokes the callback identified by `token` using the provides input arguments. */
   def call(token: Int, inputs: Array[Long]): Array[Long] = callbacks(token)(inputs)
+
+  /** Invokes the batch callback identified by `token` using the provided inputs of `batchSize` examples. */
+  def callBatch(token: Int, inputs: Array[Long], batchSize: Int): Array[Long] = batchCallbacks(token)(inputs, batchSize)
+
+  /** Invokes the asynchronous callback identified by `token` using the provided input arguments, and returns
+    * immediately. Once the future returned by the callback resolves, the pending native call identified by `callHandle`
+    * is completed using the native function pointed to by `completionFunction`. This method only throws if the callback
+    * is not registered, in which case the native call is not completed. */
+  def callAsync(token: Int, inputs: Array[Long], completionFunction: Long, callHandle: Long): Unit = {
+    val (function, executionContext) = Lock.synchronized(asyncCallbacks(token))
+    Future(function(inputs))(executionContext).flatMap(identity)(executionContext).onComplete({
+      case Success(outputs) => completeAsync(completionFunction, callHandle, outputs, null, null)
+      case Failure(exception) =>
+        completeAsync(completionFunction, callHandle, null, exception.getClass.getName, exception.toString)
+    })(SameThreadExecutionContext)
+  }
+
+  /** Completes a pending native asynchronous call. `outputs` must be `null` if and only if the call failed, in which
+    * case `exceptionClassName` and `message` describe the failure. */
+  @native private[this] def completeAsync(
+      completionFunction: Long, callHandle: Long, outputs: Array[Long], exceptionClassName: String,
+      message: String): Unit
+
+  /** Execution context that runs tasks in the thread that submits them, used to complete native asynchronous calls
+    * without an additional thread hop. */
+  private[this] object SameThreadExecutionContext extends ExecutionContext {
+    override def execute(runnable: Runnable): Unit = runnable.run()
+    override def reportFailure(cause: Throwable): Unit = ()
+  }
+
+  /** Invokes the buffer callback identified by `token` using the provided input and output buffers, after setting
+    * their byte order to the native one. */
+  def callBuffers(
+      token: Int,
+      inputs: Array[ByteBuffer],
+      inputDataTypes: Array[Int],
+      inputShapes: Array[Long],
+      inputRanks: Array[Int],
+      outputs: Array[ByteBuffer]
+  ): Unit = {
+    var i = 0
+    while (i < inputs.length) {
+      inputs(i).order(ByteOrder.nativeOrder())
+      i += 1
+    }
+    i = 0
+    while (i < outputs.length) {
+      outputs(i).order(ByteOrder.nativeOrder())
+      i += 1
+    }
+    bufferCallbacks(token).call(inputs, inputDataTypes, inputShapes, inputRanks, outputs)
+  }
+}
+
+/** Callback function that operates directly on the memory of the input and output tensors of an op.
+  *
+  * Implementations are invoked from native TensorFlow threads, possibly concurrently, and the provided buffers are only
+  * valid for the duration of each invocation.
+  */
+trait BufferCallback {
+  /** Invokes this callback.
+    *
+    * @param inputs         Direct buffers over the memory of the input tensors. They must not be written to.
+    * @param inputDataTypes Data types of the input tensors (i.e., `TF_DataType` values).
+    * @param inputShapes    Shapes of the input tensors, flattened (i.e., the shape of the `i`-th input consists of the
+    *                       next `inputRanks(i)` elements, after the ones of the preceding inputs).
+    * @param inputRanks     Ranks of the input tensors.
+    * @param outputs        Direct buffers over the memory of the already allocated output tensors, which must be
+    *                       filled in by this callback.
+    */
+  def call(
+      inputs: Array[ByteBuffer],
+      inputDataTypes: Array[Int],
+      inputShapes: Array[Long],
+      inputRanks: Array[Int],
+      outputs: Array[ByteBuffer]): Unit
 }
@@ -22,9 +22,42 @@ object Server {
   TensorFlow.load()
 
   @native def newServer(serverDef: Array[Byte]): Long
+
+  /** Returns `true` if a server factory that supports the communication protocol `protocol` (e.g., `"grpc+verbs"`) has
+    * been linked into the native library. */
+  @native def isProtocolSupported(protocol: String): Boolean
   @native def target(serverHandle: Long): String
   @native def startServer(serverHandle: Long): Unit
   @native def stopServer(serverHandle: Long): Unit
   @native def joinServer(serverHandle: Long): Unit
   @native def deleteServer(serverHandle: Long): Unit
+
+  /** Detaches a server from its handle, which must not be used afterwards, without stopping or deleting it. The server
+    * keeps running, along with the state of its devices, and is returned by [[newServer]] the next time it is called
+    * with an identical `ServerDef`. */
+  @native def detachServer(serverHandle: Long): Unit
+
+  /** Replaces the cluster of the server with handle `serverHandle` by the (serialized) `ClusterDef` `clusterDef`, which
+    * must still contain the task of the server itself. Sessions created on the server target afterwards use the new
+    * cluster. Returns the new version of the cluster membership of the server. */
+  @native def updateCluster(serverHandle: Long, clusterDef: Array[Byte]): Long
+
+  /** Adds task `taskIndex` of job `jobName`, at `address`, to the cluster of the server with handle `serverHandle`, or
+    * changes its address, and returns the new version of the cluster membership of the server. */
+  @native def addTask(serverHandle: Long, jobName: String, taskIndex: Int, address: String): Long
+
+  /** Removes task `taskIndex` of job `jobName` from the cluster of the server with handle `serverHandle`, and returns
+    * the new version of the cluster membership of the server. */
+  @native def removeTask(serverHandle: Long, jobName: String, taskIndex: Int): Long
+
+  /** Returns the current (serialized) `ClusterDef` of the server with handle `serverHandle`. */
+  @native def cluster(serverHandle: Long): Array[Byte]
+
+  /** Returns the version of the cluster membership of the server with handle `serverHandle`, which is `0` until its
+    * cluster is first updated and is incremented by every update. */
+  @native def clusterVersion(serverHandle: Long): Long
+
+  /** Collects the current values of all metrics registered in the process whose names start with `prefix` (which may be
+    * `null` or empty, in order to collect all metrics). */
+  @native def collectMetrics(serverHandle: Long, prefix: String): CollectedMetrics
 }
@@ -15,15 +15,46 @@
 
 package org.platanios.tensorflow.jni
 
+import java.nio.ByteBuffer
+
 /**
   * @author Emmanouil Antonios Platanios
   */
 object Session {
   TensorFlow.load()
 
-  @native def allocate(graphHandle: Long, target: String, configProto: Array[Byte]): Long
+  /** Creates a session. If a CPU set (i.e., `cpus` and/or the CPUs of NUMA node `numaNode`, if non-negative) is
+    * provided, the thread pools created along with the session are pinned to it. */
+  @native def allocate(
+      graphHandle: Long, target: String, configProto: Array[Byte], cpus: Array[Int], numaNode: Int): Long
+
+  /** Loads the meta-graph tagged with `tags` from the SavedModel export stored in `exportDir` into the (empty) graph
+    * with handle `graphHandle`, creates a session for it, restores its variables (using `runOptions`, which may be
+    * `null`), and returns the handle of that session. The serialized `MetaGraphDef` of the loaded model, without its
+    * graph definition, is stored in `metaGraphDef(0)`. The rest of the arguments are the same as for [[allocate]]. */
+  @native def loadFromSavedModel(
+      graphHandle: Long, exportDir: String, tags: Array[String], configProto: Array[Byte], runOptions: Array[Byte],
+      cpus: Array[Int], numaNode: Int, metaGraphDef: Array[Array[Byte]]): Long
+
   @native def delete(handle: Long): Unit
-  // TODO: [SESSION] "listDevices".
+
+  /** Returns the statistics of the allocators used by the local devices of the session with handle `handle`. */
+  @native def allocatorStatistics(handle: Long): AllocatorStatistics
+
+  /** Pins the calling thread to a CPU set (i.e., `cpus` and/or the CPUs of NUMA node `numaNode`, if non-negative). */
+  @native def setCurrentThreadAffinity(cpus: Array[Int], numaNode: Int): Unit
+
+  /** Registers the named inter-op thread pool `name` with `numThreads` threads. Sessions whose configurations include
+    * a `session_inter_op_thread_pool` entry with global name `name` share this pool, and their configurations are
+    * rewritten to use its registered size. The size of a pool cannot change once a session has used it. */
+  @native def registerSharedThreadPool(name: String, numThreads: Int): Unit
+
+  /** Returns the statistics of all registered named inter-op thread pools. */
+  @native def sharedThreadPoolStatistics(): SharedThreadPoolStatistics
+
+  /** Returns the serialized `DeviceAttributes` protocol buffers of the local devices of the session with handle
+    * `handle`, which include their names, types, memory limits, and localities. */
+  @native def listDevices(handle: Long): Array[Array[Byte]]
 
   /** Executes a computation in a session.
     *
@@ -48,6 +79,9 @@ object Session {
     * @param wantRunMetadata     indicates whether metadata about this execution should be returned.
     * @param outputTensorHandles will be filled in with handles to the outputs requested. It is
     *                            required that outputTensorHandles.length == outputOpHandles.length.
+    * @param timings             if not null, will be filled in with monotonic timestamps, in nanoseconds, taken when
+    *                            entering the native method, when entering and exiting TF_SessionRun, and after the
+    *                            outputs have been marshalled. It is required that timings.length == NumRunTimestamps.
     * @return if wantRunMetadata is true, serialized representation of the RunMetadata protocol
     *         buffer, false otherwise.
     */
@@ -61,5 +95,322 @@ object Session {
       outputOpIndices: Array[Int],
       targetOpHandles: Array[Long],
       wantRunMetadata: Boolean,
+      outputTensorHandles: Array[Long],
+      timings: Array[Long]): Array[Byte]
+
+  /** Number of timestamps in the timing records filled in by [[run]]. */
+  val NumRunTimestamps: Int = 4
+
+  /** Creates a callable for repeatedly running the same step in a session. The feeds, fetches, targets, and run options
+    * of the step are resolved once and cached natively, so that running the callable only requires passing the input
+    * tensor handles over the JNI boundary.
+    *
+    * @param handle          to the C API TF_Session object (Session.nativeHandle)
+    * @param runOptions      serialized representation of a RunOptions protocol buffer, or null
+    * @param inputOpHandles  (see inputOpIndices)
+    * @param inputOpIndices  together with inputOpHandles identifies the values that will be fed when running the
+    *                        callable.
+    * @param outputOpHandles (see outputOpIndices)
+    * @param outputOpIndices together with outputOpHandles identifies the values that will be fetched when running the
+    *                        callable.
+    * @param targetOpHandles is the set of Operations in the graph that are to be executed but whose output will not be
+    *                        returned
+    * @return handle to the native callable object, which must be deleted using [[deleteCallable]].
+    */
+  @native def makeCallable(
+      handle: Long,
+      runOptions: Array[Byte],
+      inputOpHandles: Array[Long],
+      inputOpIndices: Array[Int],
+      outputOpHandles: Array[Long],
+      outputOpIndices: Array[Int],
+      targetOpHandles: Array[Long]): Long
+
+  /** Runs a callable created using [[makeCallable]].
+    *
+    * @param callableHandle      handle to the native callable object.
+    * @param inputTensorHandles  handles to the tensors to feed, in the order of the callable feeds.
+    * @param wantRunMetadata     indicates whether metadata about this execution should be returned.
+    * @param outputTensorHandles will be filled in with handles to the fetched tensors, in the order of the callable
+    *                            fetches.
+    * @return if wantRunMetadata is true, serialized representation of the RunMetadata protocol buffer, null otherwise.
+    */
+  @native def runCallable(
+      callableHandle: Long,
+      inputTensorHandles: Array[Long],
+      wantRunMetadata: Boolean,
+      outputTensorHandles: Array[Long]): Array[Byte]
+
+  /** Runs a callable created using [[makeCallable]] multiple times, back-to-back, within a single native call.
+    *
+    * @param callableHandle      handle to the native callable object.
+    * @param numSteps            number of times to run the callable.
+    * @param inputTensorHandles  handles to the tensors to feed, flattened over steps (i.e., the handles for step `i` are
+    *                            stored at indices `[i * numInputs, (i + 1) * numInputs)`).
+    * @param wantRunMetadata     indicates whether metadata about the execution of the last step should be returned.
+    * @param outputTensorHandles will be filled in with handles to the fetched tensors, flattened over steps in the same
+    *                            way as inputTensorHandles.
+    * @return if wantRunMetadata is true, serialized representation of the RunMetadata protocol buffer of the last step,
+    *         null otherwise.
+    */
+  @native def runCallableBatch(
+      callableHandle: Long,
+      numSteps: Int,
+      inputTensorHandles: Array[Long],
+      wantRunMetadata: Boolean,
       outputTensorHandles: Array[Long]): Array[Byte]
+
+  /** Runs a callable created using [[makeCallable]] and copies the fetched tensors into preallocated direct buffers,
+    * instead of returning them as new tensors. The fetched tensors are deleted natively, right after being copied.
+    *
+    * @param callableHandle     handle to the native callable object.
+    * @param inputTensorHandles handles to the tensors to feed, in the order of the callable feeds.
+    * @param wantRunMetadata    indicates whether metadata about this execution should be returned.
+    * @param outputBuffers      direct buffers to copy the fetched tensors into, in the order of the callable fetches.
+    *                           Each buffer must be large enough to hold the corresponding tensor, which cannot be a
+    *                           string tensor.
+    * @param outputNumBytes     will be filled in with the number of bytes copied into each output buffer.
+    * @return if wantRunMetadata is true, serialized representation of the RunMetadata protocol buffer, null otherwise.
+    */
+  @native def runCallableIntoBuffers(
+      callableHandle: Long,
+      inputTensorHandles: Array[Long],
+      wantRunMetadata: Boolean,
+      outputBuffers: Array[ByteBuffer],
+      outputNumBytes: Array[Long]): Array[Byte]
+
+  /** Runs a callable created using [[makeCallable]] on a native worker thread and returns immediately.
+    *
+    * The native side takes ownership of the provided input tensors and deletes them once the run completes. Exactly one
+    * of the callback methods is invoked, from the native worker thread, once the run completes.
+    *
+    * @param callableHandle     handle to the native callable object.
+    * @param inputTensorHandles handles to the tensors to feed, in the order of the callable feeds.
+    * @param wantRunMetadata    indicates whether metadata about this execution should be passed to the callback.
+    * @param callback           callback to invoke once the run completes.
+    */
+  @native def runCallableAsync(
+      callableHandle: Long,
+      inputTensorHandles: Array[Long],
+      wantRunMetadata: Boolean,
+      callback: AsyncRunCallback): Unit
+
+  /** Runs a callable created using [[makeCallable]] multiple times, feeding the same tensors to every run and
+    * discarding the fetched tensors, in order to warm it up (e.g., instantiate its kernels and grow the allocators).
+    *
+    * @param callableHandle     handle to the native callable object.
+    * @param inputTensorHandles handles to the tensors to feed, in the order of the callable feeds.
+    * @param numRuns            number of times to run the callable.
+    * @return latency of each run, in microseconds.
+    */
+  @native def warmUpCallable(callableHandle: Long, inputTensorHandles: Array[Long], numRuns: Int): Array[Long]
+
+  @native def deleteCallable(callableHandle: Long): Unit
+
+  /** Creates a native dynamic batching scheduler for a callable created using [[makeCallable]]. The scheduler queues
+    * the requests scheduled using [[batchSchedulerSchedule]] and runs them in batches, concatenating their inputs and
+    * splitting the fetched tensors along their leading dimension. The callable must not be deleted before the
+    * scheduler.
+    *
+    * @param callableHandle     handle to the native callable object.
+    * @param maxBatchSize       maximum number of rows (i.e., elements of the leading dimension of the inputs) in each
+    *                           batch.
+    * @param batchTimeoutMicros maximum time to wait for more requests after the oldest queued request was scheduled,
+    *                           in microseconds.
+    * @param maxQueueSize       maximum number of queued requests, above which requests are rejected.
+    * @param numBatchThreads    number of threads that form and run batches.
+    * @return handle to the native scheduler object, which must be deleted using [[deleteBatchScheduler]].
+    */
+  @native def makeBatchScheduler(
+      callableHandle: Long,
+      maxBatchSize: Int,
+      batchTimeoutMicros: Long,
+      maxQueueSize: Int,
+      numBatchThreads: Int): Long
+
+  /** Schedules a request using a scheduler created using [[makeBatchScheduler]] and returns immediately.
+    *
+    * If the request is scheduled, the native side takes ownership of the provided input tensors and exactly one of
+    * the callback methods is invoked, from a native batch thread, once its batch completes (or once the scheduler is
+    * deleted, if it is still queued at that point). Otherwise (e.g., if the queue is full), an exception is thrown and
+    * the caller keeps ownership of the input tensors.
+    *
+    * @param schedulerHandle    handle to the native scheduler object.
+    * @param inputTensorHandles handles to the tensors to feed, in the order of the callable feeds.
+    * @param callback           callback to invoke once the request completes. Run metadata is never collected.
+    */
+  @native def batchSchedulerSchedule(
+      schedulerHandle: Long,
+      inputTensorHandles: Array[Long],
+      callback: AsyncRunCallback): Unit
+
+  /** Returns the statistics of a native batch scheduler, in the following order: number of scheduled requests,
+    * number of rejected requests, number of batches, current queue depth, peak queue depth, followed by 32 elements
+    * containing the queue depth histogram (where element `i` counts the requests that found between `2^(i-1)` and
+    * `2^i - 1` other requests queued), followed by the batch size histogram (where element `i` counts the batches with
+    * `i` rows and the last element counts the batches with more than `maxBatchSize` rows). */
+  @native def batchSchedulerStatistics(schedulerHandle: Long): Array[Long]
+
+  /** Deletes a native batch scheduler, after its running batches complete. Requests that are still queued are failed
+    * with a cancellation error. */
+  @native def deleteBatchScheduler(schedulerHandle: Long): Unit
+
+  /** Allocates a native step-level profiler, which traces every `samplingPeriod`-th step run using
+    * [[runCallableProfiled]] and aggregates the execution statistics of the traced steps.
+    *
+    * @param samplingPeriod number of steps per traced step.
+    * @return handle to the native profiler object, which must be deleted using [[deleteProfiler]].
+    */
+  @native def allocateProfiler(samplingPeriod: Long): Long
+
+  /** Runs a callable created using [[makeCallable]], profiling the step using a profiler created using
+    * [[allocateProfiler]]. The run metadata of traced steps is aggregated natively and is not returned.
+    *
+    * @param callableHandle      handle to the native callable object.
+    * @param inputTensorHandles  handles to the tensors to feed, in the order of the callable feeds.
+    * @param profilerHandle      handle to the native profiler object.
+    * @param outputTensorHandles will be filled in with handles to the fetched tensors, in the order of the callable
+    *                            fetches.
+    */
+  @native def runCallableProfiled(
+      callableHandle: Long,
+      inputTensorHandles: Array[Long],
+      profilerHandle: Long,
+      outputTensorHandles: Array[Long]): Unit
+
+  @native def profilerNumSteps(profilerHandle: Long): Long
+  @native def profilerSummary(profilerHandle: Long, byNode: Boolean, maxRows: Int): String
+  @native def profilerJitSummary(profilerHandle: Long): String
+  @native def resetProfiler(profilerHandle: Long): Unit
+  @native def deleteProfiler(profilerHandle: Long): Unit
+
+  /** Runs a callable created using [[makeCallable]] with full tracing enabled and writes the collected step statistics
+    * to a file, as a timeline in the Chrome trace event format. The run metadata never crosses the JNI boundary.
+    *
+    * @param callableHandle      handle to the native callable object.
+    * @param inputTensorHandles  handles to the tensors to feed, in the order of the callable feeds.
+    * @param filename            file to write the timeline to.
+    * @param showMemory          indicates whether the memory in use by each allocator should also be included in the
+    *                            timeline.
+    * @param outputTensorHandles will be filled in with handles to the fetched tensors, in the order of the callable
+    *                            fetches.
+    */
+  @native def runCallableWithTimeline(
+      callableHandle: Long,
+      inputTensorHandles: Array[Long],
+      filename: String,
+      showMemory: Boolean,
+      outputTensorHandles: Array[Long]): Unit
+
+  /** Writes the step statistics contained in a RunMetadata protocol buffer to a file, as a timeline in the Chrome trace
+    * event format.
+    *
+    * @param runMetadata serialized representation of a RunMetadata protocol buffer.
+    * @param filename    file to write the timeline to.
+    * @param showMemory  indicates whether the memory in use by each allocator should also be included in the timeline.
+    */
+  @native def writeChromeTrace(runMetadata: Array[Byte], filename: String, showMemory: Boolean): Unit
+
+  /** Sets up a partial run in a session, whose feeds and fetches are provided incrementally over multiple calls to
+    * [[partialRun]].
+    *
+    * @param handle          to the C API TF_Session object (Session.nativeHandle)
+    * @param inputOpHandles  (see inputOpIndices)
+    * @param inputOpIndices  together with inputOpHandles identifies the values that may be fed over the partial run.
+    * @param outputOpHandles (see outputOpIndices)
+    * @param outputOpIndices together with outputOpHandles identifies the values that may be fetched over the partial
+    *                        run.
+    * @param targetOpHandles is the set of Operations in the graph that are to be executed but whose output will not be
+    *                        returned
+    * @return handle to the native partial run object, which must be deleted using [[deletePartialRun]].
+    */
+  @native def partialRunSetup(
+      handle: Long,
+      inputOpHandles: Array[Long],
+      inputOpIndices: Array[Int],
+      outputOpHandles: Array[Long],
+      outputOpIndices: Array[Int],
+      targetOpHandles: Array[Long]): Long
+
+  /** Continues a partial run created using [[partialRunSetup]]. The arguments have the same semantics as those of
+    * [[run]], except that all fed and fetched values must have been declared when setting up the partial run.
+    */
+  @native def partialRun(
+      handle: Long,
+      partialRunHandle: Long,
+      inputTensorHandles: Array[Long],
+      inputOpHandles: Array[Long],
+      inputOpIndices: Array[Int],
+      outputOpHandles: Array[Long],
+      outputOpIndices: Array[Int],
+      targetOpHandles: Array[Long],
+      outputTensorHandles: Array[Long]): Unit
+
+  @native def deletePartialRun(partialRunHandle: Long): Unit
+
+  /** Creates a native iterator over the elements of an initialized dataset iterator, which runs the op that gets its
+    * next element directly within the native session, without crossing the JNI boundary for each element.
+    *
+    * @param handle          to the C API TF_Session object (Session.nativeHandle)
+    * @param outputOpHandles (see outputOpIndices)
+    * @param outputOpIndices together with outputOpHandles identifies the outputs of the `IteratorGetNext` op.
+    * @param prefetchSize     number of elements to produce ahead of time on native threads, or `0` to produce each
+    *                         element when it is requested (initial value, if autotuning).
+    * @param numThreads       number of native threads that produce elements ahead of time (initial value, if
+    *                         autotuning). With more than one thread, elements may be produced out of order.
+    * @param autotune         if `true`, the prefetch size and the number of threads are adjusted at runtime whenever
+    *                         the consumer has to wait for an element, within the following limits.
+    * @param maxPrefetchSize  maximum prefetch size, when autotuning.
+    * @param maxThreads       maximum number of threads, when autotuning.
+    * @param maxBufferedBytes maximum number of bytes of buffered elements, when autotuning, or `0` for no limit.
+    * @return handle to the native dataset iterator object, which must be deleted using [[deleteDatasetIterator]],
+    *         before the session is deleted.
+    */
+  @native def allocateDatasetIterator(
+      handle: Long, outputOpHandles: Array[Long], outputOpIndices: Array[Int], prefetchSize: Int, numThreads: Int,
+      autotune: Boolean, maxPrefetchSize: Int, maxThreads: Int, maxBufferedBytes: Long): Long
+
+  /** Returns handles to the eager tensors of the next element of a native dataset iterator, or `null` if the iterator
+    * is exhausted. */
+  @native def datasetIteratorNext(iteratorHandle: Long): Array[Long]
+
+  @native def datasetIteratorBufferedElements(iteratorHandle: Long): Int
+
+  /** Returns the statistics of a native dataset iterator, in the following order: prefetch size, number of threads,
+    * elements produced, buffered elements, buffered bytes, peak buffered bytes, consumer waits, consumer wait time in
+    * microseconds, and producer time in microseconds (summed over all threads). */
+  @native def datasetIteratorStatistics(iteratorHandle: Long): Array[Long]
+  @native def deleteDatasetIterator(iteratorHandle: Long): Unit
+
+  /** Restores the variables of the session with handle `handle` from the checkpoint with prefix `checkpointPrefix`,
+    * using the restore op named `restoreOpName`, whose checkpoint prefix is fed through the tensor named
+    * `filenameTensorName`. The tensors of V2 checkpoints are read in parallel natively. The op named `localInitOpName`
+    * is then run, if the tensor named `readyForLocalInitTensorName` is empty, and the tensor named `readyTensorName` is
+    * evaluated once. Any of the last three names may be `null`. Returns the reasons why the model is not ready for
+    * local initialization and why it is not ready, where `null` means that the corresponding check passed. */
+  @native def recover(
+      handle: Long, checkpointPrefix: String, restoreOpName: String, filenameTensorName: String,
+      readyForLocalInitTensorName: String, localInitOpName: String, readyTensorName: String): Array[String]
+}
+
+/** Callback used to report the completion of asynchronous session runs (i.e., [[Session.runCallableAsync]]).
+  *
+  * Implementations are invoked from native worker threads and should return quickly. Exceptions thrown by them are
+  * ignored.
+  */
+trait AsyncRunCallback {
+  /** Invoked when the run completes successfully.
+    *
+    * @param outputTensorHandles handles to the fetched tensors, in the order of the callable fetches. The callback is
+    *                            responsible for deleting them.
+    * @param runMetadata         serialized representation of the RunMetadata protocol buffer, if requested, or `null`.
+    */
+  def onSuccess(outputTensorHandles: Array[Long], runMetadata: Array[Byte]): Unit
+
+  /** Invoked when the run fails.
+    *
+    * @param errorCode TensorFlow error code (i.e., `TF_Code`) of the failure.
+    * @param message   error message.
+    */
+  def onFailure(errorCode: Int, message: String): Unit
 }
@@ -0,0 +1,64 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+import java.nio.ByteBuffer
+
+/** Native shared memory rings, which move elements (i.e., lists of numeric tensors) between processes through a named
+  * POSIX shared memory object, without copying them on the consumer side.
+  *
+  * All timeouts are in microseconds, where negative timeouts mean waiting forever.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object SharedMemoryRing {
+  TensorFlow.load()
+
+  /** Creates a new ring named `name`, with `numSlots` slots of `slotSize` bytes each. */
+  @native def createSharedMemoryRing(name: String, numSlots: Int, slotSize: Long): Long
+
+  /** Opens an existing ring named `name`. */
+  @native def openSharedMemoryRing(name: String): Long
+
+  @native def sharedMemoryRingNumSlots(ringHandle: Long): Int
+  @native def sharedMemoryRingSlotSize(ringHandle: Long): Long
+
+  /** Copies the element represented by the provided eager tensor handles into the next free slot. Returns `false` if
+    * no slot became free before the timeout. */
+  @native def sharedMemoryRingWrite(ringHandle: Long, tensorHandles: Array[Long], timeoutMicros: Long): Boolean
+
+  /** Claims the next free slot and returns a direct byte buffer over its data, storing its sequence number in
+    * `sequence(0)`, or returns `null` if no slot became free before the timeout. The slot must then be committed using
+    * [[sharedMemoryRingCommit]]. */
+  @native def sharedMemoryRingClaim(ringHandle: Long, timeoutMicros: Long, sequence: Array[Long]): ByteBuffer
+
+  /** Publishes a claimed slot, which contains components with the provided data types, ranks, dimensions (flattened
+    * over components), and sizes in bytes. Component `i` starts at the first multiple of 64 bytes after the end of
+    * component `i - 1`. */
+  @native def sharedMemoryRingCommit(
+      ringHandle: Long,
+      sequence: Long,
+      dataTypes: Array[Int],
+      ranks: Array[Int],
+      dims: Array[Long],
+      numBytes: Array[Long]): Unit
+
+  /** Returns eager tensor handles for the next element, which are tensors over its slot, or `null` if no element was
+    * published before the timeout. */
+  @native def sharedMemoryRingRead(ringHandle: Long, timeoutMicros: Long): Array[Long]
+
+  @native def deleteSharedMemoryRing(ringHandle: Long): Unit
+}
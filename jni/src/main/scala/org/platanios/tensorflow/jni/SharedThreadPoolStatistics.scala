@@ -0,0 +1,29 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Statistics of the named inter-op thread pools shared by sessions.
+  *
+  * @param  names      Name of each pool.
+  * @param  statistics Statistics of each pool, packed in consecutive groups of [[SharedThreadPoolStatistics.NumValues]]
+  *                    elements: number of threads, number of live sessions using the pool, number of running steps,
+  *                    peak number of running steps, total number of steps, and total step time in microseconds.
+  */
+case class SharedThreadPoolStatistics(names: Array[String], statistics: Array[Long])
+
+object SharedThreadPoolStatistics {
+  val NumValues: Int = 6
+}
@@ -17,28 +17,109 @@ package org.platanios.tensorflow.jni
 
 import java.nio.ByteBuffer
 
+/** Statistics of the native buffer pool used by [[Tensor.allocate]].
+  *
+  * @param  hits      Number of allocations served by a pooled buffer.
+  * @param  misses    Number of allocations that required allocating a new buffer.
+  * @param  bytesHeld Number of bytes currently held by the pool in unused buffers.
+  * @param  capacity  Maximum number of bytes that the pool may hold in unused buffers.
+  */
+case class TensorPoolStatistics(hits: Long, misses: Long, bytesHeld: Long, capacity: Long)
+
 /**
   * @author Emmanouil Antonios Platanios
   */
 object Tensor {
   TensorFlow.load()
 
-  @native def allocate(dataType: Int, shape: Array[Long], numBytes: Long): Long
-  @native def fromBuffer(dataType: Int, shape: Array[Long], numBytes: Long, buffer: ByteBuffer): Long
-  // @native def fromBuffer(buffer: ByteBuffer, dataType: Int, shape: Array[Long], byteSize: Long): Long
+  /** Creates a native tensor with uninitialized contents. If `pinned` is `true`, the tensor is backed by pinned (i.e.,
+    * page-locked) host memory, which GPU devices can copy from using DMA, without first staging it through their own
+    * pinned buffers. Pinned memory requires the native library to be built with CUDA support and a visible GPU, and
+    * pageable memory is used otherwise. */
+  @native def allocate(dataType: Int, shape: Array[Long], numBytes: Long, pinned: Boolean): Long
+  @native def fromBuffer(dataType: Int, shape: Array[Long], numBytes: Long, buffer: ByteBuffer, pinned: Boolean): Long
+  @native def fromBufferNoCopy(dataType: Int, shape: Array[Long], numBytes: Long, buffer: ByteBuffer): Long
+
+  /** Creates a native tensor with data type `dataType` and shape `shape` from the elements of the Java primitive array
+    * `array` that start at `offset`. `arrayDataType` is the data type that corresponds to the element type of `array`
+    * and, if it differs from `dataType`, the elements are converted while being copied. */
+  @native def fromArray(array: AnyRef, arrayDataType: Int, offset: Int, dataType: Int, shape: Array[Long]): Long
+
+  /** Creates a native tensor with data type `dataType` (which must be `FLOAT32` or `FLOAT16`) and shape `shape` from
+    * the unsigned bytes stored in the direct buffer `buffer`, computing `byte * scale(c) + shift(c)` for each byte in
+    * channel `c` (i.e., the innermost dimension), in a single vectorized pass. `scale` and `shift` contain either one
+    * value per channel or a single value for all channels. */
+  @native def ingestUInt8(
+      buffer: ByteBuffer, dataType: Int, shape: Array[Long], scale: Array[Float], shift: Array[Float]): Long
+
+  /** Creates a native tensor with data type `dataType` and shape `[buffers.length] + shape` by packing the first
+    * `numBytes` bytes of each of the provided direct buffers, which are copied in parallel for large batches. */
+  @native def packBuffers(dataType: Int, shape: Array[Long], numBytes: Long, buffers: Array[ByteBuffer]): Long
+
   @native def dataType(handle: Long): Int
   @native def shape(handle: Long): Array[Long]
   @native def buffer(handle: Long): ByteBuffer
   @native def delete(handle: Long): Unit
+
+  /** Schedules the tensor with handle `handle` to be deleted by a native background thread, without blocking on any of
+    * the locks taken when deleting tensors. Deferred deletes are queued using a lock-free queue and they are executed
+    * in batches, in the order in which they were scheduled. */
+  @native def deleteDeferred(handle: Long): Unit
+
+  /** Waits until all deferred deletes scheduled before this call (using [[deleteDeferred]] or
+    * [[eagerDeleteDeferred]]) have been executed. */
+  @native def flushDeferredDeletes(): Unit
+
+  /** Sets the maximum number of bytes that the native tensor buffer pool may hold in unused buffers. Buffers of tensors
+    * created using [[allocate]] are returned to the pool when those tensors are deleted, as long as this capacity is
+    * not exceeded, and are reused by subsequent allocations of the same size class. A capacity of zero (the default)
+    * disables pooling and releases all currently pooled buffers. Pinned and pageable buffers are held in separate
+    * pools, and `pinned` selects the pool to configure. */
+  @native def setPoolCapacity(numBytes: Long, pinned: Boolean): Unit
+  @native def poolStatistics(pinned: Boolean): TensorPoolStatistics
+
   @native def getEncodedStringSize(numStringBytes: Int): Int
   @native def setStringBytes(stringBytes: Array[Byte], buffer: ByteBuffer): Int
   @native def getStringBytes(buffer: ByteBuffer): Array[Byte]
 
+  /** Creates a string tensor with shape `shape` whose `i`-th element consists of the bytes of `stringBytes` in
+    * `[stringOffsets(i), stringOffsets(i + 1))`, encoding all elements within a single native call, and returns a
+    * handle to it. */
+  @native def encodeStrings(shape: Array[Long], stringBytes: Array[Byte], stringOffsets: Array[Long]): Long
+
+  /** Decodes all elements of the string tensor with handle `handle` within a single native call, and returns their
+    * bytes packed one after the other. `stringOffsets` must have one more element than the tensor and is filled such
+    * that the `i`-th element consists of the returned bytes in `[stringOffsets(i), stringOffsets(i + 1))`. */
+  @native def decodeStrings(handle: Long, stringOffsets: Array[Long]): Array[Byte]
+
   //region Eager Execution API
 
   // TODO: [SESSION] Add support for session options.
-  @native def eagerAllocateContext(): Long
+  /** Creates an eager execution context, configured using the serialized `ConfigProto` `configProto`, or using the
+    * default configuration, if it is `null`. If `async` is `true`, copies between devices are enqueued and executed in
+    * order on a native thread, and their output handles are returned right away. Using such handles (e.g., as op
+    * inputs) waits for them, and errors are reported when they are used, or by [[eagerSync]]. If a CPU set (i.e.,
+    * `cpus` and/or the CPUs of NUMA node `numaNode`, if non-negative) is provided, the thread pools created along with
+    * the context are pinned to it. */
+  @native def eagerAllocateContext(configProto: Array[Byte], async: Boolean, cpus: Array[Int], numaNode: Int): Long
+
+  /** Same as [[eagerAllocateContext]], except that the created context is meant to be shared by many threads. If it is
+    * asynchronous, each thread gets its own native executor, and so the operations of different threads are not
+    * executed in order with each other and [[eagerSync]] only waits for the operations of the calling thread. */
+  @native def eagerAllocateSharedContext(
+      configProto: Array[Byte], async: Boolean, cpus: Array[Int], numaNode: Int): Long
   @native def eagerDeleteContext(handle: Long): Unit
+
+  /** Returns the statistics of the allocators used by the devices of the eager context with handle `handle`. */
+  @native def eagerAllocatorStatistics(handle: Long): AllocatorStatistics
+
+  /** Waits for all pending operations of the eager context with handle `handle` and throws the first error that any of
+    * them produced since the last call to this function. Returns immediately for synchronous contexts. */
+  @native def eagerSync(handle: Long): Unit
+
+  /** Waits until the eager tensor with handle `handle` has been computed and throws the error that its computation
+    * produced, if any. */
+  @native def eagerAwait(handle: Long): Unit
   // TODO: [SESSION] "listDevices".
 
   @native def eagerAllocate(tensorHandle: Long): Long
@@ -46,9 +127,66 @@ object Tensor {
   @native def eagerShape(handle: Long): Array[Long]
   @native def eagerDevice(handle: Long): String
   @native def eagerDelete(handle: Long): Unit
+
+  /** Deferred version of [[eagerDelete]] (see [[deleteDeferred]]). */
+  @native def eagerDeleteDeferred(handle: Long): Unit
   @native def eagerResolve(handle: Long): Long
+
+  /** Returns a direct byte buffer over the storage of the eager tensor with handle `handle`, without copying it, or
+    * `null` if the tensor is not in host memory or if its storage cannot be viewed directly (e.g., for string tensors).
+    * The buffer is only valid while the eager tensor handle has not been deleted. */
+  @native def eagerHostBuffer(handle: Long): ByteBuffer
+
+  /** Returns the handle of a native tensor that mirrors the eager tensor with handle `handle` in host memory, copying
+    * the eager tensor to the host (using the eager context with handle `contextHandle`) and resolving it the first time
+    * that this method is called for it. The mirror is owned by the eager tensor and so it must not be deleted. It is
+    * only valid while the eager tensor handle has not been deleted. */
+  @native def eagerHostMirror(handle: Long, contextHandle: Long): Long
+
+  /** Copies the elements of the eager tensor with handle `handle` to the Java primitive array `array`, starting at
+    * `offset`, converting them to `arrayDataType` (i.e., the data type that corresponds to the element type of
+    * `array`), if necessary. Tensors that are not in host memory are read through their host mirrors (see
+    * [[eagerHostMirror]]). */
+  @native def eagerCopyToArray(handle: Long, contextHandle: Long, array: AnyRef, arrayDataType: Int, offset: Int): Unit
+
+  /** Returns the number of bytes of the serialized `TensorProto` that represents the eager tensor with handle `handle`.
+    * Tensors that are not in host memory are read through their host mirrors (see [[eagerHostMirror]]). */
+  @native def eagerTensorProtoSize(handle: Long, contextHandle: Long): Long
+
+  /** Writes the bytes `[offset, offset + buffer.capacity)` of the serialized `TensorProto` that represents the eager
+    * tensor with handle `handle` to the direct buffer `buffer` and returns the number of bytes written, which is
+    * smaller than the buffer capacity only for the last chunk of the serialized message. Numeric tensor contents are
+    * streamed from the tensor buffer without any intermediate copies, and so messages larger than 2GB are supported
+    * (as long as they are written in multiple chunks). */
+  @native def eagerSerializeTensorProto(handle: Long, contextHandle: Long, offset: Long, buffer: ByteBuffer): Long
+
+  /** Parses the serialized `TensorProto` stored in the concatenation of the direct buffers `buffers` (each of which is
+    * read in full, up to its capacity) and returns the handle of a new native tensor with its contents. */
+  @native def parseTensorProto(buffers: Array[ByteBuffer]): Long
+
+  /** Creates a native tensor by stacking the eager tensors with handles `handles`, which must all have the same data
+    * type and shape, along a new leading axis, copying them in parallel for large batches. Returns `0` if any of the
+    * tensors cannot be read in place (e.g., because it is not placed in host memory or because it is a string
+    * tensor). */
+  @native def eagerPack(handles: Array[Long]): Long
+
+  /** Returns the handle of a new eager tensor that is a view of the rows `[start, end)` of the eager tensor with handle
+    * `handle` (i.e., a slice along its leading axis), sharing its buffer without copying it, or `0` if such a view
+    * cannot be created (e.g., because it would not be properly aligned). If `shrink` is `true`, then `end - start`
+    * must be `1` and the leading axis is removed from the view. */
+  @native def eagerSliceView(handle: Long, start: Long, end: Long, shrink: Boolean): Long
+
   @native def eagerCopyToDevice(handle: Long, contextHandle: Long, device: String): Long
   @native def eagerSetOpDevice(opHandle: Long, device: String): Unit
 
+  /** Registers the provided function (i.e., `TF_Function`) with an eager execution context, so that it can be executed
+    * using [[eagerExecuteFunction]]. */
+  @native def eagerAddFunction(contextHandle: Long, functionHandle: Long): Unit
+
+  /** Executes a function that has been registered using [[eagerAddFunction]], as a single eager op, and returns handles
+    * to its outputs. */
+  @native def eagerExecuteFunction(
+      contextHandle: Long, functionName: String, inputHandles: Array[Long], numOutputs: Int): Array[Long]
+
   //endregion Eager Execution API
 }
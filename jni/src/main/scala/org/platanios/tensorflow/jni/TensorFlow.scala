@@ -41,6 +41,19 @@ object TensorFlow {
   /** TensorFlow ops library name. */
   private[this] val OPS_LIB_NAME: String = "tensorflow_ops"
 
+  /** CPU feature detection library name (see [[CpuFeatures]]). */
+  private[this] val CPU_FEATURES_LIB_NAME: String = "tensorflow_cpu_features"
+
+  /** Instruction set architecture (ISA) variants of the JNI bindings and the ops libraries, in order of preference,
+    * along with the ISA level that each one requires (see [[CpuFeatures.isaLevel]]). The baseline variant is the one
+    * without a library name suffix. */
+  private[this] val ISA_VARIANTS: Seq[(String, Int)] = Seq("avx512" -> 2, "avx2" -> 1, "baseline" -> 0)
+
+  /** System property that can be used to limit the ISA variant that is loaded (e.g., to `avx2` or `baseline`). */
+  val ISA_VARIANT_PROPERTY: String = "org.platanios.tensorflow.isa"
+
+  @volatile private[this] var loadedIsaVariant: Option[String] = None
+
   /** Current platform operating system. */
   private[this] val os = {
     val name = System.getProperty("os.name").toLowerCase
@@ -82,9 +95,14 @@ object TensorFlow {
       Option(classLoader.getResourceAsStream(makeResourceName(LIB_NAME)))
           .map(extractResource(LIB_NAME, _, tempDirectory))
 
+      // Choose the best ISA variant of the JNI bindings that is packaged and that the host CPU supports.
+      val isaVariant = chooseIsaVariant(classLoader, tempDirectory)
+      loadedIsaVariant = Some(isaVariant)
+
       // Load the TensorFlow JNI bindings from the appropriate resource.
-      val jniResourceStream = Option(classLoader.getResourceAsStream(makeResourceName(JNI_LIB_NAME)))
-      val jniPath = jniResourceStream.map(extractResource(JNI_LIB_NAME, _, tempDirectory))
+      val jniLibName = isaVariantLibName(JNI_LIB_NAME, isaVariant)
+      val jniResourceStream = Option(classLoader.getResourceAsStream(makeResourceName(jniLibName)))
+      val jniPath = jniResourceStream.map(extractResource(jniLibName, _, tempDirectory))
       if (jniPath.isEmpty)
         throw new UnsatisfiedLinkError(
           s"Cannot find the TensorFlow JNI bindings for OS: $os, and architecture: $architecture. See " +
@@ -100,14 +118,57 @@ object TensorFlow {
         }
       })
 
-      // Load the TensorFlow ops library from the appropriate resource.
-      val opsResourceStream = Option(classLoader.getResourceAsStream(makeResourceName(OPS_LIB_NAME)))
-      val opsPath = opsResourceStream.map(extractResource(OPS_LIB_NAME, _, tempDirectory))
+      // Load the TensorFlow ops library from the appropriate resource, falling back to the baseline variant if the
+      // chosen one is not packaged.
+      val opsLibName = Seq(isaVariantLibName(OPS_LIB_NAME, isaVariant), OPS_LIB_NAME)
+          .find(lib => classLoader.getResource(makeResourceName(lib)) != null)
+          .getOrElse(OPS_LIB_NAME)
+      val opsResourceStream = Option(classLoader.getResourceAsStream(makeResourceName(opsLibName)))
+      val opsPath = opsResourceStream.map(extractResource(opsLibName, _, tempDirectory))
       // TODO: !!! For some reason this can be called twice.
       opsPath.foreach(path => loadOpLibrary(path.toAbsolutePath.toString))
     }
   }
 
+  /** Returns the instruction set architecture (ISA) variant of the JNI bindings and the ops libraries that was loaded
+    * (i.e., `avx512`, `avx2`, or `baseline`), or `None` if the native code was already present in the process (e.g.,
+    * because it was statically linked). */
+  def isaVariant: Option[String] = loadedIsaVariant
+
+  /** Returns the name of the `isaVariant` variant of the `lib` library. */
+  private[this] def isaVariantLibName(lib: String, isaVariant: String): String = {
+    if (isaVariant == "baseline") lib else s"${lib}_$isaVariant"
+  }
+
+  /** Chooses the best ISA variant of the JNI bindings that is provided as a resource and that the host CPU supports,
+    * according to the CPU feature detection library (if that is provided as a resource), and limited by the
+    * [[ISA_VARIANT_PROPERTY]] system property (if set). */
+  private[this] def chooseIsaVariant(classLoader: ClassLoader, directory: Path): String = {
+    val hostIsaLevel = Option(classLoader.getResourceAsStream(makeResourceName(CPU_FEATURES_LIB_NAME)))
+        .map(extractResource(CPU_FEATURES_LIB_NAME, _, directory))
+        .flatMap(path => {
+          try {
+            System.load(path.toAbsolutePath.toString)
+            Some(CpuFeatures.isaLevel)
+          } catch {
+            case exception: UnsatisfiedLinkError =>
+              logger.warn(s"Unable to detect the host CPU features. Error: ${exception.getMessage}.")
+              None
+          }
+        }).getOrElse(0)
+    val maxIsaLevel = Option(System.getProperty(ISA_VARIANT_PROPERTY)).map(variant => {
+      ISA_VARIANTS.find(_._1 == variant).map(_._2).getOrElse(throw new IllegalArgumentException(
+        s"Invalid ISA variant '$variant'. Supported variants are: ${ISA_VARIANTS.map(_._1).mkString(", ")}."))
+    }).getOrElse(hostIsaLevel)
+    val isaVariant = ISA_VARIANTS.collectFirst {
+      case (variant, level) if level <= math.min(hostIsaLevel, maxIsaLevel) &&
+          classLoader.getResource(makeResourceName(isaVariantLibName(JNI_LIB_NAME, variant))) != null => variant
+    }.getOrElse("baseline")
+    logger.info(
+      s"Loading the '$isaVariant' variant of the TensorFlow JNI bindings (host CPU ISA level: $hostIsaLevel).")
+    isaVariant
+  }
+
   /** Checks if the TensorFlow JNI bindings library has been loaded. */
   private[this] def checkIfLoaded(): Boolean = {
     try {
@@ -157,10 +218,16 @@ object TensorFlow {
   lazy val currentJvmPointer                       : String = jvmPointer
   lazy val currentCallbackRegistryPointer          : String = callbackRegistryPointer
   lazy val currentCallbackRegistryCallMethodPointer: String = callbackRegistryCallMethodPointer
+  lazy val currentCallbackRegistryCallAsyncMethodPointer  : String = callbackRegistryCallAsyncMethodPointer
+  lazy val currentCallbackRegistryCallBatchMethodPointer  : String = callbackRegistryCallBatchMethodPointer
+  lazy val currentCallbackRegistryCallBuffersMethodPointer: String = callbackRegistryCallBuffersMethodPointer
 
   @native private[jni] def jvmPointer: String
   @native private[jni] def callbackRegistryPointer: String
   @native private[jni] def callbackRegistryCallMethodPointer: String
+  @native private[jni] def callbackRegistryCallAsyncMethodPointer: String
+  @native private[jni] def callbackRegistryCallBatchMethodPointer: String
+  @native private[jni] def callbackRegistryCallBuffersMethodPointer: String
   @native def version: String
   @native def dataTypeSize(dataTypeCValue: Int): Int
   @native def loadOpLibrary(libraryPath: String): Array[Byte]
@@ -169,6 +236,10 @@ object TensorFlow {
 
   @native private[tensorflow] def updateInput(
       graphHandle: Long, inputOpHandle: Long, inputIndex: Int, outputOpHandle: Long, outputIndex: Int): Unit
+  /** Same as [[updateInput]], but for multiple edges at once, while acquiring the graph lock only once. */
+  @native private[tensorflow] def updateInputs(
+      graphHandle: Long, inputOpHandles: Array[Long], inputIndices: Array[Int], outputOpHandles: Array[Long],
+      outputIndices: Array[Int]): Unit
   @native private[tensorflow] def addControlInput(graphHandle: Long, opHandle: Long, inputOpHandle: Long): Int
   @native private[tensorflow] def clearControlInputs(graphHandle: Long, opHandle: Long): Int
 
@@ -21,6 +21,28 @@ package org.platanios.tensorflow.jni
   */
 abstract class TensorFlowException(message: String, cause: Throwable) extends RuntimeException(message, cause)
 
+object TensorFlowException {
+  /** Creates the exception that corresponds to the provided TensorFlow error code (i.e., `TF_Code`). */
+  def fromCode(code: Int, message: String): TensorFlowException = code match {
+    case 1 => CancelledException(message)
+    case 3 => InvalidArgumentException(message)
+    case 4 => DeadlineExceededException(message)
+    case 5 => NotFoundException(message)
+    case 6 => AlreadyExistsException(message)
+    case 7 => PermissionDeniedException(message)
+    case 8 => ResourceExhaustedException(message)
+    case 9 => FailedPreconditionException(message)
+    case 10 => AbortedException(message)
+    case 11 => OutOfRangeException(message)
+    case 12 => UnimplementedException(message)
+    case 13 => InternalException(message)
+    case 14 => UnavailableException(message)
+    case 15 => DataLossException(message)
+    case 16 => UnauthenticatedException(message)
+    case _ => UnknownException(message)
+  }
+}
+
 class CancelledException(message: String, cause: Throwable) extends TensorFlowException(message, cause) {
   def this(message: String) = this(message, null)
 }
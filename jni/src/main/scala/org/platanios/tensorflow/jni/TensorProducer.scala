@@ -0,0 +1,45 @@
+/* Copyright 2017, Emmanouil Antonios Platanios. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+package org.platanios.tensorflow.jni
+
+/** Native tensor producers, which are bounded buffers of elements (i.e., lists of tensors) that JVM threads push into
+  * directly and that `TensorProducerDequeue` ops pop from, without copying the tensors.
+  *
+  * All timeouts are in microseconds, where negative timeouts mean waiting forever.
+  *
+  * @author Emmanouil Antonios Platanios
+  */
+object TensorProducer {
+  TensorFlow.load()
+
+  /** Creates a new producer that can buffer up to `capacity` elements. */
+  @native def allocate(capacity: Long): Long
+
+  /** Returns the string representation of the producer pointer, used as the `producer_pointer` attribute of
+    * `TensorProducerDequeue` ops. */
+  @native def pointer(producerHandle: Long): String
+
+  /** Pushes the element represented by the provided eager tensor handles. Returns `false` if the producer did not have
+    * space for it before the timeout. */
+  @native def push(producerHandle: Long, tensorHandles: Array[Long], timeoutMicros: Long): Boolean
+
+  @native def size(producerHandle: Long): Long
+
+  /** Closes the producer, so that pushes fail and dequeues fail with an out-of-range error once it is empty. */
+  @native def close(producerHandle: Long): Unit
+
+  @native def delete(producerHandle: Long): Unit
+}
@@ -36,6 +36,8 @@ object NN {
   @native def sparseSoftmaxCrossEntropyWithLogits(contextHandle: Long, features: Long, labels: Long): Array[Long]
   @native def topKV2(contextHandle: Long, input: Long, k: Long, sorted: Boolean): Array[Long]
   @native def inTopKV2(contextHandle: Long, predictions: Long, targets: Long, k: Long): Long
+  @native def largeTopK(contextHandle: Long, input: Long, k: Long, sorted: Boolean): Array[Long]
+  @native def largeInTopK(contextHandle: Long, predictions: Long, targets: Long, k: Long): Long
   @native def avgPool(contextHandle: Long, value: Long, ksize: Array[Long], strides: Array[Long], padding: Array[Byte], data_format: Array[Byte]): Long
   @native def avgPool3D(contextHandle: Long, input: Long, ksize: Array[Long], strides: Array[Long], padding: Array[Byte], data_format: Array[Byte]): Long
   @native def maxPool(contextHandle: Long, input: Long, ksize: Array[Long], strides: Array[Long], padding: Array[Byte], data_format: Array[Byte]): Long
@@ -23,4 +23,8 @@ object Sparse {
   TensorFlow.load()
 
   @native def sparseToDense(contextHandle: Long, sparse_indices: Long, output_shape: Long, sparse_values: Long, default_value: Long, validate_indices: Boolean): Long
+  @native def sparseTensorToCSR(contextHandle: Long, indices: Long, values: Long, dense_shape: Long): Array[Long]
+  @native def cSRSparseDenseMatMul(
+      contextHandle: Long, row_pointers: Long, column_indices: Long, values: Long, dense_shape: Long, b: Long,
+      adjoint_a: Boolean): Long
 }
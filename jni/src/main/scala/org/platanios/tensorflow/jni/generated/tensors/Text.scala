@@ -29,4 +29,11 @@ object Text {
   @native def stringToHashBucket(contextHandle: Long, string_tensor: Long, num_buckets: Long): Long
   @native def stringToHashBucketFast(contextHandle: Long, input: Long, num_buckets: Long): Long
   @native def stringToHashBucketStrong(contextHandle: Long, input: Long, num_buckets: Long, key: Array[Long]): Long
+  @native def tokenizeStrings(
+      contextHandle: Long, input: Long, delimiter: Array[Byte], skip_empty: Boolean): Array[Long]
+  @native def stringToHashBucketBatch(
+      contextHandle: Long, input: Long, num_buckets: Long, hash_function: Array[Byte]): Long
+  @native def wordPieceTokenize(
+      contextHandle: Long, input: Long, vocabulary_file: Array[Byte], suffix_indicator: Array[Byte],
+      unknown_token: Array[Byte], max_bytes_per_word: Long): Array[Long]
 }
@@ -41,57 +41,172 @@ case class OpGenerator(opDef: OpDef) {
   /** Name of this op used to name the generated functions. */
   val name: String = OpGenerator.processName(opDef.getName)
 
-  /** Generates code containing the JNI bindings for the provided [[OpDef]].
+  /** Generates code containing the bindings for executing the provided [[OpDef]] eagerly.
+    *
+    * No JNI function is generated for eager execution. Instead, the generated Scala function packs the op inputs and
+    * its non-inferrable attributes and executes the op using the generic native eager dispatcher (i.e.,
+    * `EagerDispatcher`), which infers the remaining attributes and the number of outputs using the op specification
+    * generated by [[generateEagerOpSpec]]. The specification is looked up once and cached in the generated object.
+    *
+    * @return Generated code that contains the Scala function definition, but no JNI code.
+    */
+  @throws[UnsupportedOperationException]
+  def generateCode(): GeneratedCode = {
+    val isList = inputs.map(i => argumentTypes(i._1) == "list(tensor)")
+    val inputsExpression = {
+      if (inputs.isEmpty)
+        "Array.empty[Long]"
+      else if (!isList.contains(true))
+        s"Array[Long](${inputs.map(_._2).mkString(", ")})"
+      else
+        s"Array.concat(${inputs.zip(isList).map(i => if (i._2) i._1._2 else s"Array(${i._1._2})").mkString(", ")})"
+    }
+    val inputLengthsExpression = {
+      if (inputs.isEmpty)
+        "Array.empty[Int]"
+      else
+        s"Array[Int](${inputs.zip(isList).map(i => if (i._2) s"${i._1._2}.length" else "1").mkString(", ")})"
+    }
+    val attributesExpression = {
+      if (parameters.isEmpty)
+        "null"
+      else
+        "new EagerAttrPacker()" +
+            parameters.map(p => s".${typeToAttrPackerMethod(argumentTypes(p._1))}(${p._2})").mkString + ".toArray"
+    }
+    val (scalaReturnType, executeFunction) = (numFixedOutputs, outputLengthAttributes.isEmpty) match {
+      case (0, true) => ("Unit", "execute")
+      case (1, true) => ("Long", "executeSingleOutput")
+      case _ => ("Array[Long]", "execute")
+    }
+
+    val specName = s"${name}OpSpec"
+    val scalaArguments = ("contextHandle: Long" +: (inputs ++ parameters).map(p => {
+      s"${p._2}: ${typeToScalaType(argumentTypes(p._1))}"
+    })).mkString(", ")
+
+    val scalaFunction =
+      s"""  private[this] lazy val $specName: Long = EagerDispatcher.lookUpOp("${opDef.getName}")
+         |
+         |  def $name($scalaArguments): $scalaReturnType = {
+         |    EagerDispatcher.$executeFunction(
+         |      contextHandle, $specName, $inputsExpression, $inputLengthsExpression,
+         |      $attributesExpression)
+         |  }""".stripMargin
+
+    GeneratedCode(scalaFunction, "", "")
+  }
+
+  /** Generates the specification of the provided [[OpDef]] that the generic native eager dispatcher uses in order to
+    * infer the op attributes from its inputs, unpack the rest of its attributes, and compute its number of outputs.
+    *
+    * @return Generated code that contains the C definitions of the arrays that the specification refers to, along with
+    *         the C initializer of the specification.
+    */
+  @throws[UnsupportedOperationException]
+  def generateEagerOpSpec(): EagerOpSpecCode = {
+    val definitions = mutable.ListBuffer.empty[String]
+
+    def array(suffix: String, elementType: String, elements: Seq[String]): String = {
+      if (elements.isEmpty) {
+        "nullptr"
+      } else {
+        val arrayName = s"k${opDef.getName}$suffix"
+        definitions.append(
+          s"""const $elementType $arrayName[] = {
+             |    ${elements.mkString(",\n    ")}};""".stripMargin)
+        arrayName
+      }
+    }
+
+    val inputsArray = array("Inputs", "tensorflow::EagerOpInput", inputs.map(i => {
+      s"""{"${i._1}", ${argumentTypes(i._1) == "list(tensor)"}}"""
+    }))
+    val inferencesArray = array("Inferences", "tensorflow::EagerAttrInference", attributeInferences.map(i => {
+      s"""{"${i._1}", tensorflow::${typeToEagerInferenceKind(i._2)}, ${i._3}}"""
+    }))
+    val parametersArray = array("Parameters", "tensorflow::EagerAttrParameter", parameters.map(p => {
+      s"""{"${p._1}", tensorflow::${typeToEagerAttrType(argumentTypes(p._1))}}"""
+    }))
+    val outputLengthAttributesArray = array(
+      "OutputLengthAttrs", "char* const", outputLengthAttributes.map(a => s""""$a""""))
+
+    val initializer =
+      s"""{"${opDef.getName}", ${inputs.size}, $inputsArray, ${attributeInferences.size}, $inferencesArray,
+         |     ${parameters.size}, $parametersArray, $numFixedOutputs, ${outputLengthAttributes.size},
+         |     $outputLengthAttributesArray}""".stripMargin
+
+    EagerOpSpecCode(definitions.mkString("\n"), initializer)
+  }
+
+  /** Generates code containing the JNI bindings for building the provided [[OpDef]] in a graph, using a single native
+    * call. The generated function adds all inputs, control inputs, and attributes to a new op description, finishes
+    * the op, and returns a handle to the created op. Attributes that are inferrable from the op inputs are not set
+    * explicitly, since `TF_FinishOperation` infers them when validating the op.
     *
     * @param  className JNI class name to use for the generated code that includes the package. For example:
     *                   `"org_platanios_tensorflow_jni_generated_tensors_Basic"`.
     * @return Generated code that contains function definitions and implementations, but not the complete code files.
     */
-  def generateCode(className: String): GeneratedCode = {
+  def generateGraphCode(className: String): GeneratedCode = {
     val codeBuilder = StringBuilder.newBuilder
-    val deallocationBuilder = StringBuilder.newBuilder
 
     codeBuilder.append(
-      s"""  REQUIRE_HANDLE(context, TFE_Context, context_handle, $cNullValuePlaceholder);
-         |  std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)> status(TF_NewStatus(), TF_DeleteStatus);
+      s"""  REQUIRE_HANDLE(graph, TF_Graph, graph_handle, 0);
          |
-         |  std::unique_ptr<TFE_Op, decltype(&TFE_DeleteOp)> op(
-         |      TFE_NewOp(context, "${opDef.getName}", status.get()), TFE_DeleteOp);
-         |  CHECK_STATUS(env, status.get(), $cNullValuePlaceholder);""".stripMargin)
-
-    addInputs(codeBuilder)
-    addInferredAttributes(codeBuilder)
-    addParameters(codeBuilder, deallocationBuilder)
-    addExecute(codeBuilder, deallocationBuilder)
-
-    val (scalaReturnType, jniReturnType) = numOutputsExpression match {
-      case "0" => ("Unit", ("V", "void"))
-      case "1" => ("Long", ("J", "jlong"))
-      case _ => ("Array[Long]", ("[J", "jlongArray"))
-    }
+         |  const int num_control_inputs = env->GetArrayLength(control_input_handles);
+         |  std::unique_ptr<TF_Operation* []> control_inputs(new TF_Operation* [num_control_inputs]);
+         |  REQUIRE_HANDLES(control_input_handles, control_inputs.get(), num_control_inputs, 0);""".stripMargin)
 
-    val arguments = inputs ++ parameters
-    val scalaArguments = arguments.map(p => s"${p._2}: ${typeToScalaType(argumentTypes(p._1))}").mkString(", ")
-    val jniHeaderArguments = arguments.map(_._1).map(p => s"${typeToJni(argumentTypes(p))}").mkString(", ")
-    val jniHeaderSignatureArguments = arguments.map(_._1).map(p => s"${typeToShortJni(argumentTypes(p))}").mkString("")
-    val jniImplementationArguments = arguments.map(p => s"${typeToJni(argumentTypes(p._1))} ${p._2}").mkString(", ")
+    addGraphInputs(codeBuilder)
+    addGraphParameters(codeBuilder)
 
-    val scalaFunction = s"""  @native def $name(contextHandle: Long, $scalaArguments): $scalaReturnType""".stripMargin
+    codeBuilder.append(
+      s"""
+         |
+         |  TF_Status* status = thread_local_status();
+         |  TF_Operation* op = TF_FinishOperation(d, status);
+         |  CHECK_STATUS(env, status, 0);
+         |  return reinterpret_cast<jlong>(op);""".stripMargin)
+
+    val graphName = s"${name}Graph"
+    val graphInputs = inputs.map(i => argumentTypes(i._1) match {
+      case "tensor" => (Seq(s"${i._2}Op: Long", s"${i._2}Index: Int"), "JI", "jlong, jint",
+          s"jlong ${i._2}_op_handle, jint ${i._2}_index")
+      case "list(tensor)" => (Seq(s"${i._2}Ops: Array[Long]", s"${i._2}Indices: Array[Int]"), "[J[I",
+          "jlongArray, jintArray", s"jlongArray ${i._2}_op_handles, jintArray ${i._2}_indices")
+      case inputType => throw new IllegalArgumentException(s"Invalid input argument type '$inputType'.")
+    })
+    val scalaArguments = (graphInputs.flatMap(_._1) ++
+        parameters.map(p => s"${p._2}: ${typeToScalaType(argumentTypes(p._1))}")).mkString(", ")
+    val jniHeaderSignatureArguments =
+      (graphInputs.map(_._2) ++ parameters.map(p => typeToShortJni(argumentTypes(p._1)))).mkString("")
+    val jniHeaderArguments = (Seq("JNIEnv *", "jobject", "jlong", "jstring", "jstring", "jlongArray") ++
+        graphInputs.map(_._3) ++ parameters.map(p => typeToJni(argumentTypes(p._1)))).mkString(", ")
+    val jniImplementationArguments = (Seq(
+      "JNIEnv* env", "jobject object", "jlong graph_handle", "jstring name", "jstring device",
+      "jlongArray control_input_handles") ++
+        graphInputs.map(_._4) ++ parameters.map(p => s"${typeToJni(argumentTypes(p._1))} ${p._2}")).mkString(", ")
+
+    val scalaFunction =
+      s"""  @native def $graphName(
+         |      graphHandle: Long, name: String, device: String, controlInputs: Array[Long]${
+        if (scalaArguments.nonEmpty) s",\n      $scalaArguments" else ""}): Long""".stripMargin
 
     val jniHeaderFunction =
       s"""/*
          | * Class:     ${className}__
-         | * Method:    $name
-         | * Signature: (J$jniHeaderSignatureArguments)${jniReturnType._1}
+         | * Method:    $graphName
+         | * Signature: (JLjava/lang/String;Ljava/lang/String;[J$jniHeaderSignatureArguments)J
          | */
-         |JNIEXPORT ${jniReturnType._2} JNICALL Java_${className}_00024_$name
-         |  (JNIEnv *, jobject, jlong, $jniHeaderArguments);""".stripMargin
+         |JNIEXPORT jlong JNICALL Java_${className}_00024_$graphName
+         |  ($jniHeaderArguments);""".stripMargin
 
     val jniImplementationFunction =
-      s"""JNIEXPORT ${jniReturnType._2} JNICALL Java_${className}_00024_$name(
-         |    JNIEnv* env, jobject object, jlong context_handle, $jniImplementationArguments) {
+      s"""JNIEXPORT jlong JNICALL Java_${className}_00024_$graphName(
+         |    $jniImplementationArguments) {
          |${codeBuilder.mkString}
-         |}""".stripMargin.replace(cNullValuePlaceholder, cNullValue)
+         |}""".stripMargin
 
     GeneratedCode(scalaFunction, jniHeaderFunction, jniImplementationFunction)
   }
@@ -104,10 +219,6 @@ case class OpGenerator(opDef: OpDef) {
     throw new UnsupportedOperationException(
       s"Op '$name' is not supported on the Scala API. Error message: Op outputs cannot be reference types.")
 
-  /** Placeholder used for the C code expression to return when the op construction/execution fails. Its value in the
-    * generated code will be replaced by the value of [[cNullValue]], once that value is computed. */
-  private[this] val cNullValuePlaceholder: String = "##NULL_VALUE##"
-
   private[this] val initializationOutputs = initialize()
 
   /** Map from argument (i.e., input or attribute) names to corresponding TensorFlow type. */
@@ -123,64 +234,51 @@ case class OpGenerator(opDef: OpDef) {
   /** Map from parameter name (original -- not processed) to their default values. */
   val parameterDefaults: Map[String, AttrValue] = initializationOutputs._4
 
-  /** Map from inferrable attribute name to the first input argument it is inferred from. */
-  val inferrableAttributes: Map[String, String] = initializationOutputs._5
+  /** Inferrable attribute names, paired with their types and the indices of the inputs they are inferred from, in the
+    * order of the inputs. Attributes that are inferred from multiple inputs appear once for each of these inputs. */
+  val attributeInferences: Seq[(String, String, Int)] = initializationOutputs._5
 
-  /** Map from inferrable attribute name to a list of the parameter indices to which it corresponds. */
-  val inferrableAttributeToInputs: Map[String, Seq[Int]] = initializationOutputs._6
+  /** Number of outputs of this op that are single tensors. */
+  val numFixedOutputs: Int = initializationOutputs._6
 
-  /** C code expressions that create and initialize all variables related to inferring attribute values. */
-  val inferredAttributeExpressions: Seq[String] = initializationOutputs._7
-
-  /** Map from attribute name to the C expression that computes its value (often simply set to the parameter name). */
-  private[this] val attributeExpressions: Map[String, String] = initializationOutputs._8
-
-  /** C code expression that computes the number of outputs of this op. */
-  private[this] val numOutputsExpression: String = initializationOutputs._9
-
-  /** C code expression to return when the op construction/execution fails. */
-  private[this] val cNullValue: String = numOutputsExpression match {
-    case "0" => "void()"
-    case "1" => "0"
-    case _ => "nullptr"
-  }
+  /** Names of the attributes whose values determine the lengths of the list outputs of this op (i.e., int attributes,
+    * or list(type) attributes whose lengths are used). */
+  val outputLengthAttributes: Seq[String] = initializationOutputs._7
 
   /** Initializes this op generator. Initialization consists of computing the values of all the fields used by this op
     * generator, by parsing the provided op definition. */
   private[this] def initialize(): (
-      Map[String, String],        // argumentTypes
-          Seq[(String, String)],  // inputs
-          Seq[(String, String)],  // parameters
-          Map[String, AttrValue], // parameterDefaults
-          Map[String, String],    // inferrableAttributes
-          Map[String, Seq[Int]],  // attributeToParameters
-          Seq[String],            // inferredAttributeExpressions
-          Map[String, String],    // attributeExpressions
-          String                  // numOutputsExpression
+      Map[String, String],                // argumentTypes
+          Seq[(String, String)],          // inputs
+          Seq[(String, String)],          // parameters
+          Map[String, AttrValue],         // parameterDefaults
+          Seq[(String, String, Int)],     // attributeInferences
+          Int,                            // numFixedOutputs
+          Seq[String]                     // outputLengthAttributes
       ) = {
     val argumentTypes = mutable.HashMap.empty[String, String]
     val inputs = mutable.ListBuffer.empty[(String, String)]
     val parameters = mutable.ListBuffer.empty[(String, String)]
     val parameterDefaults = mutable.HashMap.empty[String, AttrValue]
-    val inferrableAttributes = mutable.HashMap.empty[String, String]
-    val inferrableAttributeToInputs = mutable.HashMap.empty[String, mutable.ListBuffer[Int]]
-    val inferredAttributeExpressions = mutable.ListBuffer.empty[String]
-    val attributeExpressions = mutable.HashMap.empty[String, String]
+    val inferrableAttributes = mutable.HashSet.empty[String]
+    val attributeInferences = mutable.ListBuffer.empty[(String, String, Int)]
+    val outputLengthAttributes = mutable.ListBuffer.empty[String]
 
     // Process input arguments.
     opDef.getInputArgList.asScala.zipWithIndex.foreach { case (arg, index) =>
-      argumentTypes.update(arg.getName, if (!arg.getNumberAttr.isEmpty) "list(tensor)" else "tensor")
+      val isList = !arg.getNumberAttr.isEmpty || !arg.getTypeListAttr.isEmpty
+      argumentTypes.update(arg.getName, if (isList) "list(tensor)" else "tensor")
       val inferrableAttrs = mutable.ListBuffer.empty[(String, String)]
       if (!arg.getTypeAttr.isEmpty)
         inferrableAttrs.append((arg.getTypeAttr, "type"))
-      else
+      else if (!arg.getTypeListAttr.isEmpty)
         inferrableAttrs.append((arg.getTypeListAttr, "list(type)"))
       if (!arg.getNumberAttr.isEmpty)
         inferrableAttrs.append((arg.getNumberAttr, "int"))
       inferrableAttrs.foreach(a => {
         argumentTypes.update(a._1, a._2)
-        inferrableAttributes.getOrElseUpdate(a._1, opDef.getInputArg(index).getName)
-        inferrableAttributeToInputs.getOrElseUpdate(a._1, mutable.ListBuffer.empty[Int]).append(index)
+        inferrableAttributes.add(a._1)
+        attributeInferences.append((a._1, a._2, index))
       })
       inputs.append((arg.getName, OpGenerator.processName(arg.getName)))
     }
@@ -204,100 +302,31 @@ case class OpGenerator(opDef: OpDef) {
     attrsWithoutDefaults.foreach(a => parameters.append((a, OpGenerator.processName(a))))
     attrsWithDefaults.foreach(a => parameters.append((a, OpGenerator.processName(a))))
 
-    // Infer attribute values and create the appropriate attribute expressions.
-    inferrableAttributeToInputs.foreach({ case (attrName, inputIndices) =>
-      argumentTypes(attrName) match {
-        case "int" =>
-          // Inferred int attributes are the lengths of input lists.
-          if (!attributeExpressions.contains(attrName)) {
-            val inputName = inputs(inputIndices.head)._2
-            val attrValueName = s"attr_$attrName"
-            val attrValueExpression =
-              s"""
-                 |
-                 |  const int $attrValueName = env->GetArrayLength($inputName);
-                 |  TFE_OpSetAttrInt(op.get(), "$attrName", static_cast<int64_t>($attrValueName));""".stripMargin
-            inferredAttributeExpressions.append(attrValueExpression)
-            attributeExpressions.update(attrName, attrValueName)
-          }
-        case "type" =>
-          if (!attributeExpressions.contains(attrName)) {
-            val inputName = inputs(inputIndices.head)._2
-            val inputType = argumentTypes(inputs(inputIndices.head)._1)
-            val attrValueName = s"attr_$attrName"
-            inputType match {
-              case "tensor" =>
-                val tensorHandle = s"${attrValueName}_${inputName}_handle"
-                val attrValueExpression =
-                  s"""
-                     |
-                     |  REQUIRE_HANDLE($tensorHandle, TFE_TensorHandle, $inputName, $cNullValuePlaceholder);
-                     |  const TF_DataType $attrValueName = TFE_TensorHandleDataType($tensorHandle);
-                     |  TFE_OpSetAttrType(op.get(), "$attrName", $attrValueName);""".stripMargin
-                inferredAttributeExpressions.append(attrValueExpression)
-                attributeExpressions.update(attrName, attrValueName)
-              case "list(tensor)" =>
-                val tensorElems = s"${inputName}_attr_${attrName}_elems"
-                val attrValueExpression =
-                  s"""
-                     |
-                     |  jlong *$tensorElems = env->GetLongArrayElements($inputName, nullptr);
-                     |  REQUIRE_HANDLE(${tensorElems}_head, TFE_TensorHandle, $tensorElems[0], $cNullValuePlaceholder);
-                     |  const TF_DataType $attrValueName = TFE_TensorHandleDataType(${tensorElems}_head);
-                     |  TFE_OpSetAttrType(op.get(), "$attrName", $attrValueName);
-                     |  env->ReleaseLongArrayElements($inputName, $tensorElems, JNI_ABORT);""".stripMargin
-                inferredAttributeExpressions.append(attrValueExpression)
-                attributeExpressions.update(attrName, attrValueName)
-            }
-          }
-        case "list(type)" => // TODO: Manage "list(type)" attributes.
-      }
-    })
-
-    // Add attribute expressions for the non-inferrable attributes (i.e., the parameters).
-    parameters.foreach(p => attributeExpressions.update(p._1, p._2))
-
-    // Create an expression that computes the number of outputs of this op.
-    // If output i is list output, outputSizes[i] will be set to a string with the Scala expression that will evaluate
-    // to its length. outputSizes[i] is empty for non-list outputs.
+    // Collect the attributes that determine the lengths of the list outputs. The number of outputs is the number of
+    // fixed outputs plus the sum of these lengths, and it is computed by the native eager dispatcher.
     var numFixedOutputs = 0
-    val numOutputsExpression = StringBuilder.newBuilder
     opDef.getOutputArgList.asScala.foreach(outputArg => {
-      if (outputArg.getNumberAttr.nonEmpty) {
-        if (numOutputsExpression.nonEmpty) numOutputsExpression.append(" + ")
-        numOutputsExpression.append(attributeExpressions(outputArg.getNumberAttr))
-      } else if (outputArg.getTypeListAttr.nonEmpty) {
-        if (numOutputsExpression.nonEmpty) numOutputsExpression.append(" + ")
-        val inferred = inferrableAttributes.getOrElse(
-          outputArg.getTypeListAttr, attributeExpressions(outputArg.getTypeListAttr))
-        if (argumentTypes(inferred).startsWith("list("))
-          numOutputsExpression.append(s"env->GetArrayLength($inferred)")
-        else
-          numOutputsExpression.append(inferred)
-      } else {
+      if (outputArg.getNumberAttr.nonEmpty)
+        outputLengthAttributes.append(outputArg.getNumberAttr)
+      else if (outputArg.getTypeListAttr.nonEmpty)
+        outputLengthAttributes.append(outputArg.getTypeListAttr)
+      else
         numFixedOutputs += 1
-      }
     })
-    if (numFixedOutputs > 0) {
-      if (numOutputsExpression.nonEmpty) numOutputsExpression.append(" + ")
-      numOutputsExpression.append(numFixedOutputs)
-    } else if (numOutputsExpression.isEmpty) {
-      numOutputsExpression.append("0")
-    }
 
     (argumentTypes.toMap,
         inputs.toList,
         parameters.toList,
         parameterDefaults.toMap,
-        inferrableAttributes.toMap,
-        inferrableAttributeToInputs.mapValues(_.toList).toMap,
-        inferredAttributeExpressions.toList,
-        attributeExpressions.toMap,
-        numOutputsExpression.mkString)
+        attributeInferences.toList,
+        numFixedOutputs,
+        outputLengthAttributes.toList)
   }
 
-  /** Appends code to `codeBuilder` that adds the op inputs in the C implementation. */
-  private[this] def addInputs(codeBuilder: mutable.StringBuilder): Unit = {
+  /** Appends code to `codeBuilder` that resolves the op inputs, creates the op description, and adds the op inputs and
+    * control inputs to it, in the C implementation of the graph op builder. All input handles are resolved before the
+    * op description is created so that invalid handles do not result in dangling op descriptions. */
+  private[this] def addGraphInputs(codeBuilder: mutable.StringBuilder): Unit = {
     inputs.foreach(param => {
       val inputName = param._2
       val inputType = argumentTypes(param._1)
@@ -306,147 +335,89 @@ case class OpGenerator(opDef: OpDef) {
           codeBuilder.append(
             s"""
                |
-               |  REQUIRE_HANDLE(${inputName}_handle, TFE_TensorHandle, $inputName, $cNullValuePlaceholder);
-               |  TFE_OpAddInput(op.get(), ${inputName}_handle, status.get());
-               |  CHECK_STATUS(env, status.get(), $cNullValuePlaceholder);""".stripMargin)
+               |  REQUIRE_HANDLE(${inputName}_op, TF_Operation, ${inputName}_op_handle, 0);
+               |  const TF_Output ${inputName}_input = {
+               |      ${inputName}_op, static_cast<int>(${inputName}_index)};""".stripMargin)
         case "list(tensor)" =>
-          val numTensors = s"${inputName}_num_tensors"
-          val tensorElems = s"${inputName}_elems"
+          val numInputs = s"${inputName}_num_inputs"
           codeBuilder.append(
             s"""
                |
-               |  const int $numTensors = env->GetArrayLength($inputName);
-               |  jlong *$tensorElems = env->GetLongArrayElements($inputName, nullptr);
-               |  for (int i = 0; i < $numTensors; ++i) {
-               |    REQUIRE_HANDLE(tensor_handle, TFE_TensorHandle, $tensorElems[i], 0);
-               |    TFE_OpAddInput(op.get(), tensor_handle, status.get());
-               |    CHECK_STATUS(env, status.get(), $cNullValuePlaceholder);
-               |  }
-               |  env->ReleaseLongArrayElements($inputName, $tensorElems, JNI_ABORT);""".stripMargin)
+               |  const int $numInputs = env->GetArrayLength(${inputName}_op_handles);
+               |  std::unique_ptr<TF_Output[]> ${inputName}_inputs(new TF_Output[$numInputs]);
+               |  REQUIRE_OUTPUTS(
+               |      ${inputName}_op_handles, ${inputName}_indices, ${inputName}_inputs.get(), $numInputs,
+               |      0);""".stripMargin)
         case _ => throw new IllegalArgumentException(s"Invalid input argument type '$inputType'.")
       }
     })
-  }
-
-  /** Appends code to `codeBuilder` that adds the inferred attributes in the C implementation. */
-  private[this] def addInferredAttributes(codeBuilder: mutable.StringBuilder): Unit = {
-    // Add all attribute value inference code and validate consistence of inferred attribute values with the inputs.
-    inferredAttributeExpressions.foreach(codeBuilder.append)
-    inferrableAttributeToInputs.foreach({ case (attrName, inputIndices) =>
-      argumentTypes(attrName) match {
-        case "int" =>
-          // Inferred int attributes are the lengths of input lists.
-          // Check that those inputs are lists of the same length.
-          inputIndices.tail.foreach(inputIndex => {
-            val inputName = inputs(inputIndex)._2
-            val attrValueName = attributeExpressions(attrName)
-            codeBuilder.append(
-              s"""
-                 |
-                 |  const int attr_${attrName}_$inputName = env->GetArrayLength($inputName);
-                 |  if ($attrValueName != attr_${attrName}_$inputName) {
-                 |      std::stringstream error_msg;
-                 |      error_msg
-                 |          << "List argument '$inputName' of '$name' op with length '"
-                 |          << attr_${attrName}_$inputName
-                 |          << "' must match length '"
-                 |          << $attrValueName
-                 |          << "' of argument '${inferrableAttributes(attrName)}'";
-                 |      throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
-                 |  }""".stripMargin)
-          })
-        case "type" =>
-          inputIndices.tail.foreach(input => {
-            val inputName = inputs(input)._2
-            val inputType = argumentTypes(inputs(input)._1)
-            inputType match {
-              case "tensor" =>
-                val attrValueName = attributeExpressions(attrName)
-                val tensorHandle = s"${attrValueName}_${inputName}_handle"
-                codeBuilder.append(
-                  s"""
-                     |
-                     |  REQUIRE_HANDLE($tensorHandle, TFE_TensorHandle, $inputName, $cNullValuePlaceholder);
-                     |  const TF_DataType attr_${attrName}_$inputName = TFE_TensorHandleDataType($tensorHandle);
-                     |  if ($attrValueName != attr_${attrName}_$inputName) {
-                     |      std::stringstream error_msg;
-                     |      error_msg
-                     |          << "Argument '$inputName' of '$name' op with data type '"
-                     |          << attr_${attrName}_$inputName
-                     |          << "' must match data type '"
-                     |          << $attrValueName
-                     |          << "' of argument '${inferrableAttributes(attrName)}'";
-                     |      throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
-                     |  }""".stripMargin)
-              case "list(tensor)" =>
-                val attrValueName = attributeExpressions(attrName)
-                val numTensors = s"${inputName}_attr_${attrName}_num_tensors"
-                val tensorElems = s"${inputName}_attr_${attrName}_elems"
-                codeBuilder.append(
-                  s"""
-                     |
-                     |  const int $numTensors = env->GetArrayLength($inputName);
-                     |  $tensorElems = env->GetLongArrayElements($inputName, nullptr);
-                     |  for (int i = 0; i < $numTensors; ++i) {
-                     |    REQUIRE_HANDLE(tensor, TFE_TensorHandle, $tensorElems[i], 0);
-                     |    const TF_DataType data_type = TFE_TensorHandleDataType(tensor);
-                     |    if ($attrValueName != data_type) {
-                     |      std::stringstream error_msg;
-                     |      error_msg
-                     |          << "Argument '$inputName' of '$name' op with data type '"
-                     |          << data_type
-                     |          << "' must match data type '"
-                     |          << $attrValueName
-                     |          << "' of argument '${inferrableAttributes(attrName)}'";
-                     |      throw_exception(env, tf_invalid_argument_exception, error_msg.str().c_str());
-                     |    }
-                     |  }
-                     |  env->ReleaseLongArrayElements($inputName, $tensorElems, JNI_ABORT);""".stripMargin)
-              case _ => throw new IllegalArgumentException(s"Invalid input argument type '$inputType'.")
-            }
-          })
-        case "list(type)" => // TODO: Manage "list(type)" attributes.
+    codeBuilder.append(
+      s"""
+         |
+         |  const char* c_name = env->GetStringUTFChars(name, nullptr);
+         |  TF_OperationDescription* d = TF_NewOperation(graph, "${opDef.getName}", c_name);
+         |  env->ReleaseStringUTFChars(name, c_name);
+         |  if (device != nullptr) {
+         |    const char* c_device = env->GetStringUTFChars(device, nullptr);
+         |    TF_SetDevice(d, c_device);
+         |    env->ReleaseStringUTFChars(device, c_device);
+         |  }
+         |  for (int i = 0; i < num_control_inputs; ++i) {
+         |    TF_AddControlInput(d, control_inputs[i]);
+         |  }""".stripMargin)
+    inputs.foreach(param => {
+      val inputName = param._2
+      argumentTypes(param._1) match {
+        case "tensor" =>
+          codeBuilder.append(
+            s"""
+               |  TF_AddInput(d, ${inputName}_input);""".stripMargin)
+        case "list(tensor)" =>
+          codeBuilder.append(
+            s"""
+               |  TF_AddInputList(d, ${inputName}_inputs.get(), ${inputName}_num_inputs);""".stripMargin)
       }
     })
   }
 
-  /** Appends code to `codeBuilder` that adds the parameters (i.e., non-inferred attributes) in the C implementation. */
+  /** Appends code to `codeBuilder` that sets the parameters (i.e., non-inferred attributes) on the op description, in
+    * the C implementation of the graph op builder. The op description copies all attribute values and so all JNI
+    * arrays are released right after each attribute is set. */
   @throws[IllegalArgumentException]
-  private[this] def addParameters(
-      codeBuilder: mutable.StringBuilder, deallocationBuilder: mutable.StringBuilder): Unit = {
-    // TODO: !!! Deal with null-valued parameters.
+  private[this] def addGraphParameters(codeBuilder: mutable.StringBuilder): Unit = {
     parameters.foreach(parameter => {
       val attrName = parameter._1
       val attrType = argumentTypes(attrName)
-      val value = attributeExpressions(attrName)
+      val value = parameter._2
       attrType match {
         case "string" =>
           codeBuilder.append(
             s"""
                |
                |  jbyte *${attrName}_c_value = env->GetByteArrayElements($value, nullptr);
-               |  TFE_OpSetAttrString(op.get(), "$attrName", reinterpret_cast<const char *>(${attrName}_c_value));
+               |  TF_SetAttrString(
+               |      d, "$attrName", ${attrName}_c_value, static_cast<size_t>(env->GetArrayLength($value)));
                |  env->ReleaseByteArrayElements($value, ${attrName}_c_value, JNI_ABORT);""".stripMargin)
         case "int" =>
           codeBuilder.append(
             s"""
                |
-               |  TFE_OpSetAttrInt(op.get(), "$attrName", static_cast<int64_t>($value));""".stripMargin)
+               |  TF_SetAttrInt(d, "$attrName", static_cast<int64_t>($value));""".stripMargin)
         case "float" =>
           codeBuilder.append(
             s"""
                |
-               |  TFE_OpSetAttrFloat(op.get(), "$attrName", static_cast<float>($value));""".stripMargin)
+               |  TF_SetAttrFloat(d, "$attrName", static_cast<float>($value));""".stripMargin)
         case "bool" =>
           codeBuilder.append(
             s"""
                |
-               |  TFE_OpSetAttrBool(op.get(), "$attrName", static_cast<unsigned char>($value));""".stripMargin)
+               |  TF_SetAttrBool(d, "$attrName", static_cast<unsigned char>($value));""".stripMargin)
         case "type" =>
           codeBuilder.append(
             s"""
                |
-               |  TFE_OpSetAttrType(op.get(), "$attrName", static_cast<TF_DataType>($value));""".stripMargin)
+               |  TF_SetAttrType(d, "$attrName", static_cast<TF_DataType>($value));""".stripMargin)
         case "shape" =>
           codeBuilder.append(
             s"""
@@ -462,36 +433,32 @@ case class OpGenerator(opDef: OpDef) {
                |    }
                |    env->ReleaseLongArrayElements($value, ${attrName}_elems, JNI_ABORT);
                |  }
-               |  TFE_OpSetAttrShape(
-               |      op.get(), "$attrName", ${attrName}_c_value.get(), static_cast<int>(${attrName}_num_dims),
-               |      status.get());
-               |  CHECK_STATUS(env, status.get(), $cNullValuePlaceholder);""".stripMargin)
+               |  TF_SetAttrShape(
+               |      d, "$attrName", ${attrName}_c_value.get(),
+               |      static_cast<int>(${attrName}_num_dims));""".stripMargin)
         case "tensor" => throw new UnsupportedOperationException(s"Unsupported attribute type '$attrType'.")
         case "func" => throw new UnsupportedOperationException(s"Unsupported attribute type '$attrType'.")
         case "list(string)" =>
           codeBuilder.append(
             s"""
                |
-               |  int ${attrName}_num_strings = env->GetArrayLength($value);
-               |  jbyteArray **${attrName}_arrays = new jbyteArray *[${attrName}_num_strings];
-               |  jbyte **${attrName}_strings = new jbyte *[${attrName}_num_strings];
-               |  for (int i = 0; i < ${attrName}_num_strings; i++) {
+               |  const int ${attrName}_num_strings = env->GetArrayLength($value);
+               |  std::unique_ptr<jbyteArray[]> ${attrName}_arrays(new jbyteArray[${attrName}_num_strings]);
+               |  std::unique_ptr<jbyte* []> ${attrName}_strings(new jbyte* [${attrName}_num_strings]);
+               |  std::unique_ptr<size_t[]> ${attrName}_lengths(new size_t[${attrName}_num_strings]);
+               |  for (int i = 0; i < ${attrName}_num_strings; ++i) {
                |    ${attrName}_arrays[i] = (jbyteArray) env->GetObjectArrayElement($value, i);
+               |    ${attrName}_lengths[i] = static_cast<size_t>(env->GetArrayLength(${attrName}_arrays[i]));
                |    ${attrName}_strings[i] = env->GetByteArrayElements(${attrName}_arrays[i], nullptr);
                |  }
-               |  TFE_OpSetAttrStringList(
-               |    op.get(), "$attrName", const_cast<const char **>(reinterpret_cast<char **>(${attrName}_strings)),
-               |    ${attrName}_num_strings);""".stripMargin)
-          deallocationBuilder.append(
-            s"""
-               |
-               |  for (int i = 0; i < ${attrName}_num_strings; i++) {
+               |  TF_SetAttrStringList(
+               |      d, "$attrName", reinterpret_cast<const void* const*>(${attrName}_strings.get()),
+               |      ${attrName}_lengths.get(), ${attrName}_num_strings);
+               |  for (int i = 0; i < ${attrName}_num_strings; ++i) {
                |    env->ReleaseByteArrayElements(${attrName}_arrays[i], ${attrName}_strings[i], JNI_ABORT);
+               |    env->DeleteLocalRef(${attrName}_arrays[i]);
                |  }""".stripMargin)
         case "list(int)" =>
-          // Make a copy of the array to paper over any differences in byte representations of the JVM type and the
-          // corresponding C type. For example, jint vs TF_DataType. If this copy turns out to be a problem in
-          // practice, we can avoid it for many types.
           codeBuilder.append(
             s"""
                |
@@ -501,12 +468,9 @@ case class OpGenerator(opDef: OpDef) {
                |  for (int i = 0; i < ${attrName}_n; ++i) {
                |    ${attrName}_c_value[i] = static_cast<int64_t>(${attrName}_elems[i]);
                |  }
-               |  TFE_OpSetAttrIntList(op.get(), "$attrName", ${attrName}_c_value.get(), ${attrName}_n);
+               |  TF_SetAttrIntList(d, "$attrName", ${attrName}_c_value.get(), ${attrName}_n);
                |  env->ReleaseLongArrayElements($value, ${attrName}_elems, JNI_ABORT);""".stripMargin)
         case "list(float)" =>
-          // Make a copy of the array to paper over any differences in byte representations of the JVM type and the
-          // corresponding C type. For example, jint vs TF_DataType. If this copy turns out to be a problem in
-          // practice, we can avoid it for many types.
           codeBuilder.append(
             s"""
                |
@@ -516,12 +480,9 @@ case class OpGenerator(opDef: OpDef) {
                |  for (int i = 0; i < ${attrName}_n; ++i) {
                |    ${attrName}_c_value[i] = static_cast<float>(${attrName}_elems[i]);
                |  }
-               |  TFE_OpSetAttrFloatList(op.get(), "$attrName", ${attrName}_c_value.get(), ${attrName}_n);
+               |  TF_SetAttrFloatList(d, "$attrName", ${attrName}_c_value.get(), ${attrName}_n);
                |  env->ReleaseFloatArrayElements($value, ${attrName}_elems, JNI_ABORT);""".stripMargin)
         case "list(bool)" =>
-          // Make a copy of the array to paper over any differences in byte representations of the JVM type and the
-          // corresponding C type. For example, jint vs TF_DataType. If this copy turns out to be a problem in
-          // practice, we can avoid it for many types.
           codeBuilder.append(
             s"""
                |
@@ -531,12 +492,9 @@ case class OpGenerator(opDef: OpDef) {
                |  for (int i = 0; i < ${attrName}_n; ++i) {
                |    ${attrName}_c_value[i] = static_cast<unsigned char>(${attrName}_elems[i]);
                |  }
-               |  TFE_OpSetAttrBoolList(op.get(), "$attrName", ${attrName}_c_value.get(), ${attrName}_n);
+               |  TF_SetAttrBoolList(d, "$attrName", ${attrName}_c_value.get(), ${attrName}_n);
                |  env->ReleaseBooleanArrayElements($value, ${attrName}_elems, JNI_ABORT);""".stripMargin)
         case "list(type)" =>
-          // Make a copy of the array to paper over any differences in byte representations of the JVM type and the
-          // corresponding C type. For example, jint vs TF_DataType. If this copy turns out to be a problem in
-          // practice, we can avoid it for many types.
           codeBuilder.append(
             s"""
                |
@@ -546,91 +504,62 @@ case class OpGenerator(opDef: OpDef) {
                |  for (int i = 0; i < ${attrName}_n; ++i) {
                |    ${attrName}_c_value[i] = static_cast<TF_DataType>(${attrName}_elems[i]);
                |  }
-               |  TFE_OpSetAttrTypeList(op.get(), "$attrName", ${attrName}_c_value.get(), ${attrName}_n);
+               |  TF_SetAttrTypeList(d, "$attrName", ${attrName}_c_value.get(), ${attrName}_n);
                |  env->ReleaseIntArrayElements($value, ${attrName}_elems, JNI_ABORT);""".stripMargin)
         case "list(shape)" =>
           codeBuilder.append(
             s"""
                |
-               |  std::unique_ptr<int[]> ${attrName}_c_num_dims;
-               |  std::unique_ptr<int64_t*[]> ${attrName}_c_shapes;
                |  const int ${attrName}_c_num_shapes = env->GetArrayLength($value);
-               |  if (${attrName}_c_num_shapes > 0) {
-               |    ${attrName}_c_num_dims.reset(new int[${attrName}_c_num_shapes]);
-               |    ${attrName}_c_shapes.reset(new int64_t*[${attrName}_c_num_shapes]);
-               |    for (int j = 0; j < ${attrName}_c_num_shapes; ++j) {
-               |      jlongArray shape = (jlongArray) env->GetObjectArrayElement($value, j);
-               |      ${attrName}_c_num_dims[j] = -1;
-               |      if (shape != nullptr) {
-               |        ${attrName}_c_num_dims[j] = env->GetArrayLength(shape);
-               |        ${attrName}_c_shapes[j] = new int64_t[${attrName}_c_num_dims[j]];
-               |        jlong *shape_elems = env->GetLongArrayElements(shape, nullptr);
-               |        for (int i = 0; i < ${attrName}_c_num_dims[j]; ++i) {
-               |          ${attrName}_c_shapes[j][i] = static_cast<int64_t>(shape_elems[i]);
-               |        }
-               |        env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
-               |      } else {
-               |        ${attrName}_c_shapes[j] = new int64_t[0];
+               |  std::unique_ptr<int[]> ${attrName}_c_num_dims(new int[${attrName}_c_num_shapes]);
+               |  std::unique_ptr<std::unique_ptr<int64_t[]>[]> ${attrName}_c_dims(
+               |      new std::unique_ptr<int64_t[]>[${attrName}_c_num_shapes]);
+               |  std::unique_ptr<int64_t* []> ${attrName}_c_shapes(new int64_t* [${attrName}_c_num_shapes]);
+               |  for (int j = 0; j < ${attrName}_c_num_shapes; ++j) {
+               |    jlongArray shape = (jlongArray) env->GetObjectArrayElement($value, j);
+               |    ${attrName}_c_num_dims[j] = -1;
+               |    if (shape != nullptr) {
+               |      ${attrName}_c_num_dims[j] = env->GetArrayLength(shape);
+               |      ${attrName}_c_dims[j].reset(new int64_t[${attrName}_c_num_dims[j]]);
+               |      jlong *shape_elems = env->GetLongArrayElements(shape, nullptr);
+               |      for (int i = 0; i < ${attrName}_c_num_dims[j]; ++i) {
+               |        ${attrName}_c_dims[j][i] = static_cast<int64_t>(shape_elems[i]);
                |      }
+               |      env->ReleaseLongArrayElements(shape, shape_elems, JNI_ABORT);
+               |      env->DeleteLocalRef(shape);
                |    }
+               |    ${attrName}_c_shapes[j] = ${attrName}_c_dims[j].get();
                |  }
-               |  TFE_OpSetAttrShapeList(
-               |      op.get(), "$attrName", const_cast<const int64_t **>(${attrName}_c_shapes.get()),
-               |      ${attrName}_c_num_dims.get(), ${attrName}_c_num_shapes, status.get());
-               |  CHECK_STATUS(env, status.get(), $cNullValuePlaceholder);""".stripMargin)
+               |  TF_SetAttrShapeList(
+               |      d, "$attrName", const_cast<const int64_t* const*>(${attrName}_c_shapes.get()),
+               |      ${attrName}_c_num_dims.get(), ${attrName}_c_num_shapes);""".stripMargin)
         case "list(tensor)" => throw new UnsupportedOperationException(s"Unsupported attribute type '$attrType'.")
         case "list(func)" => throw new UnsupportedOperationException(s"Unsupported attribute type '$attrType'.")
         case _ => throw new IllegalArgumentException(s"Invalid attribute type '$attrType'.")
       }
     })
   }
-
-  /** Appends code to `codeBuilder` that adds the op execution code in the C implementation. */
-  private[this] def addExecute(codeBuilder: mutable.StringBuilder, deallocationBuilder: mutable.StringBuilder): Unit = {
-    codeBuilder.append(
-      s"""
-         |
-         |  const int num_outputs = $numOutputsExpression;
-         |  std::unique_ptr<TFE_TensorHandle* []> outputs(new TFE_TensorHandle* [num_outputs]);
-         |  std::unique_ptr<int[]> actual_num_outputs(new int[1] {num_outputs});
-         |  TFE_Execute(op.get(), outputs.get(), actual_num_outputs.get(), status.get());
-         |  CHECK_STATUS(env, status.get(), $cNullValuePlaceholder);
-         |${if (deallocationBuilder.nonEmpty) deallocationBuilder.mkString else ""}""".stripMargin)
-    numOutputsExpression match {
-      case "0" => codeBuilder.append(
-        s"""
-           |  return;""".stripMargin)
-      case "1" =>
-        codeBuilder.append(
-          s"""
-             |  return reinterpret_cast<jlong>(outputs[0]);""".stripMargin)
-      case _ =>
-        codeBuilder.append(
-          s"""
-             |  jlongArray outputs_array = env->NewLongArray(static_cast<jsize>(num_outputs));
-             |  jlong* output_elems = env->GetLongArrayElements(outputs_array, nullptr);
-             |  for (int i = 0; i < num_outputs; ++i) {
-             |    output_elems[i] = reinterpret_cast<jlong>(outputs[i]);
-             |  }
-             |  env->ReleaseLongArrayElements(outputs_array, output_elems, 0);
-             |  return outputs_array;""".stripMargin)
-    }
-  }
 }
 
-/** Contains helper functions for generating JNI bindings for eager op execution in TensorFlow. */
+/** Contains helper functions for generating bindings for eager op execution and graph op construction in
+  * TensorFlow. */
 object OpGenerator {
   /** Generates files for grouped ops.
     *
     * `ops` must be a [[Map]] from group names to sequences of op names, as they are defined in the TensorFlow native
     * library. Then, for each group, this function generates three files, with their Scala package set to
     * `<scalaPackage>.<group>`:
-    *   - `<path>/scala/<scalaPackage>/<group>.scala`: Contains a Scala object with the native function declarations.
-    *     Note that in the file path, the dots in `scalaPackage` are replaced with path separators (e.g., `"/"`).
+    *   - `<path>/scala/<scalaPackage>/<group>.scala`: Contains a Scala object with the eager execution functions and
+    *     the native function declarations. Note that in the file path, the dots in `scalaPackage` are replaced with
+    *     path separators (e.g., `"/"`).
     *   - `<path>/native/generated/tensor_<group.toLowerCase>_ops.h`: Contains the C function declarations for the
     *     generated JNI bindinds.
     *   - `<path>/native/generated/tensor_<group.toLowerCase>_ops.cc`: Contains the C implementations for the functions
-    *     defined in the header file.
+    *     defined in the header file, along with the eager dispatch specifications of the ops.
+    *
+    * For each op, a Scala function that executes the op eagerly using the generic native eager dispatcher and a native
+    * function (whose name is suffixed with `"Graph"`) that builds the op in a graph using a single native call are
+    * generated.
     *
     * Note that all pre-existing files in the relevant directories will be replaced.
     *
@@ -649,12 +578,17 @@ object OpGenerator {
   /** Generates files for a named group of ops.
     *
     * The Scala package of the generated files is set to `<scalaPackage>.<group>`. Three files are generated:
-    *   - `<path>/scala/<scalaPackage>/<group>.scala`: Contains a Scala object with the native function declarations.
-    *     Note that in the file path, the dots in `scalaPackage` are replaced with path separators (e.g., `"/"`).
+    *   - `<path>/scala/<scalaPackage>/<group>.scala`: Contains a Scala object with the eager execution functions and
+    *     the native function declarations. Note that in the file path, the dots in `scalaPackage` are replaced with
+    *     path separators (e.g., `"/"`).
     *   - `<path>/native/generated/tensor_<group.toLowerCase>_ops.h`: Contains the C function declarations for the
     *     generated JNI bindinds.
     *   - `<path>/native/generated/tensor_<group.toLowerCase>_ops.cc`: Contains the C implementations for the functions
-    *     defined in the header file.
+    *     defined in the header file, along with the eager dispatch specifications of the ops.
+    *
+    * For each op, a Scala function that executes the op eagerly using the generic native eager dispatcher and a native
+    * function (whose name is suffixed with `"Graph"`) that builds the op in a graph using a single native call are
+    * generated.
     *
     * Note that all pre-existing files in the relevant directories will be replaced.
     *
@@ -675,7 +609,11 @@ object OpGenerator {
 
     // Generate the code.
     val jniObjectName = s"$scalaPackage.$group".replace(".", "_")
-    val opCode = opDefs.map(OpGenerator(_).generateCode(jniObjectName))
+    val generators = opDefs.map(OpGenerator(_))
+    val opCode = generators.flatMap(generator => Seq(
+      generator.generateCode(),
+      generator.generateGraphCode(jniObjectName)))
+    val eagerOpSpecs = generators.map(_.generateEagerOpSpec())
 
     // Create Scala file.
     Files.write(
@@ -699,12 +637,12 @@ object OpGenerator {
          |
          |package $scalaPackage
          |
-         |import org.platanios.tensorflow.jni.TensorFlow
+         |import org.platanios.tensorflow.jni.{EagerAttrPacker, EagerDispatcher, TensorFlow}
          |
          |object $group {
          |  TensorFlow.load()
          |
-         |${opCode.map(_.scalaFunction).mkString("\n")}
+         |${opCode.map(_.scalaFunction).mkString("\n\n")}
          |}
          |""".stripMargin.getBytes())
 
@@ -720,7 +658,7 @@ object OpGenerator {
          |#ifdef __cplusplus
          |extern "C" {
          |#endif
-         |${opCode.map(_.jniHeaderFunction).mkString("\n\n")}
+         |${opCode.map(_.jniHeaderFunction).filter(_.nonEmpty).mkString("\n\n")}
          |
          |#ifdef __cplusplus
          |}
@@ -759,8 +697,18 @@ object OpGenerator {
          |
          |#include "tensorflow/c/c_api.h"
          |#include "tensorflow/c/c_eager_api.h"
+         |#include "tensorflow/c/eager_dispatcher.h"
+         |
+         |namespace {
+         |${eagerOpSpecs.map(_.definitions).filter(_.nonEmpty).mkString("\n\n")}
+         |
+         |const tensorflow::EagerOpSpec kEagerOpSpecs[] = {
+         |    ${eagerOpSpecs.map(_.initializer).mkString(",\n    ")}};
+         |}  // namespace
          |
-         |${opCode.map(_.jniImplementationFunction).mkString("\n\n")}
+         |REGISTER_EAGER_OP_SPECS(kEagerOpSpecs);
+         |
+         |${opCode.map(_.jniImplementationFunction).filter(_.nonEmpty).mkString("\n\n")}
          |""".stripMargin.getBytes())
   }
 
@@ -772,6 +720,13 @@ object OpGenerator {
     */
   case class GeneratedCode(scalaFunction: String, jniHeaderFunction: String, jniImplementationFunction: String)
 
+  /** Eager dispatch specification of an op, generated by an [[OpGenerator]].
+    *
+    * @param  definitions C definitions of the arrays that the specification refers to.
+    * @param  initializer C initializer of the `tensorflow::EagerOpSpec` struct.
+    */
+  case class EagerOpSpecCode(definitions: String, initializer: String)
+
   // TODO: Add C reserved keywords.
   /** Set which contains all of the Scala language reserved keywords. */
   private[this] val reservedKeywords = Set(
@@ -843,6 +798,44 @@ object OpGenerator {
   /** Map from TensorFlow attribute types to JNI types. */
   private[OpGenerator] val typeToJni: Map[String, String] = typeToScalaType.mapValues(scalaTypeToJni)
 
+  /** Map from TensorFlow attribute types to the `EagerAttrPacker` methods that pack their values. */
+  private[OpGenerator] val typeToAttrPackerMethod: Map[String, String] = Map(
+    "string" -> "putString",
+    "int" -> "putInt",
+    "float" -> "putFloat",
+    "bool" -> "putBoolean",
+    "type" -> "putType",
+    "shape" -> "putShape",
+    "list(string)" -> "putStringList",
+    "list(int)" -> "putIntList",
+    "list(float)" -> "putFloatList",
+    "list(bool)" -> "putBooleanList",
+    "list(type)" -> "putTypeList",
+    "list(shape)" -> "putShapeList"
+  ).withDefault(t => throw new UnsupportedOperationException(s"Unsupported attribute type '$t'."))
+
+  /** Map from TensorFlow attribute types to the corresponding `tensorflow::EagerAttrType` values. */
+  private[OpGenerator] val typeToEagerAttrType: Map[String, String] = Map(
+    "string" -> "kEagerAttrString",
+    "int" -> "kEagerAttrInt",
+    "float" -> "kEagerAttrFloat",
+    "bool" -> "kEagerAttrBool",
+    "type" -> "kEagerAttrType",
+    "shape" -> "kEagerAttrShape",
+    "list(string)" -> "kEagerAttrStringList",
+    "list(int)" -> "kEagerAttrIntList",
+    "list(float)" -> "kEagerAttrFloatList",
+    "list(bool)" -> "kEagerAttrBoolList",
+    "list(type)" -> "kEagerAttrTypeList",
+    "list(shape)" -> "kEagerAttrShapeList"
+  ).withDefault(t => throw new UnsupportedOperationException(s"Unsupported attribute type '$t'."))
+
+  /** Map from the types of inferrable attributes to the corresponding `tensorflow::EagerAttrInferenceKind` values. */
+  private[OpGenerator] val typeToEagerInferenceKind: Map[String, String] = Map(
+    "type" -> "kEagerInferType",
+    "list(type)" -> "kEagerInferTypeList",
+    "int" -> "kEagerInferNumber")
+
   /** Converts the provided TensorFlow attribute value to a string representing the same value in Scala. */
   private[OpGenerator] def attrValueToScala(attr: AttrDef, value: AttrValue): Option[String] = {
     // Note that the return value of this function may contain spaces (for example, it could be a string "foo bar"
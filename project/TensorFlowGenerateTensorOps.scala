@@ -22,7 +22,8 @@ import scala.collection.JavaConverters._
 import sbt._
 import sbt.Keys._
 
-/** Adds functionality for generating JNI header and implementation files for executing TensorFlow eager tensor ops.
+/** Adds functionality for generating JNI header and implementation files for executing TensorFlow eager tensor ops and
+  * for building TensorFlow graph ops.
   *
   * @author Emmanouil Antonios Platanios
   */
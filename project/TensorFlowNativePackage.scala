@@ -209,6 +209,38 @@ object TensorFlowNativePackage extends AutoPlugin {
 
     val cMakeListsAdditions: String = ""
 
+    /** Instruction set architecture (ISA) variants of the JNI and the op libraries that are built in addition to the
+      * baseline ones, along with their compiler flags. The best variant that the host CPU supports is chosen at load
+      * time, using the `tensorflow_cpu_features` library. */
+    val isaVariants: Seq[(String, String)] = Seq(
+      "avx2" -> "-mavx2 -mfma",
+      "avx512" -> "-mavx2 -mfma -mavx512f -mavx512cd -mavx512bw -mavx512dq -mavx512vl")
+
+    def cMakeIsaVariants: String = {
+      if (isaVariants.isEmpty) {
+        ""
+      } else {
+        val variants = isaVariants.map { case (isa, flags) =>
+          s"""add_library($${JNI_LIB_NAME}_$isa MODULE $${JNI_LIB_SRC})
+             |set_target_properties($${JNI_LIB_NAME}_$isa PROPERTIES COMPILE_FLAGS "$flags")
+             |target_link_libraries($${JNI_LIB_NAME}_$isa $${LIB_TENSORFLOW} $${LIB_TENSORFLOW_FRAMEWORK})
+             |install(TARGETS $${JNI_LIB_NAME}_$isa LIBRARY DESTINATION .)
+             |
+             |add_library($${OP_LIB_NAME}_$isa MODULE $${OP_LIB_SRC})
+             |set_target_properties($${OP_LIB_NAME}_$isa PROPERTIES COMPILE_FLAGS "$flags")
+             |target_link_libraries($${OP_LIB_NAME}_$isa $${LIB_TENSORFLOW} $${LIB_TENSORFLOW_FRAMEWORK})
+             |install(TARGETS $${OP_LIB_NAME}_$isa LIBRARY DESTINATION .)
+             |""".stripMargin
+        }
+        s"""# ISA variants of the JNI and the op libraries
+           |
+           |${variants.mkString("\n")}
+           |add_library($${PROJECT_NAME}_cpu_features MODULE cpu_features/cpu_features.cc)
+           |install(TARGETS $${PROJECT_NAME}_cpu_features LIBRARY DESTINATION .)
+           |""".stripMargin
+      }
+    }
+
     val dockerfile: String = {
       s"""# Pull base image
          |FROM multiarch/crossbuild
@@ -303,6 +335,7 @@ object TensorFlowNativePackage extends AutoPlugin {
          |target_link_libraries($${OP_LIB_NAME} $${LIB_TENSORFLOW} $${LIB_TENSORFLOW_FRAMEWORK})
          |install(TARGETS $${OP_LIB_NAME} LIBRARY DESTINATION .)
          |
+         |$cMakeIsaVariants
          |$cMakeListsAdditions
          |""".stripMargin
     }